@@ -35,7 +35,8 @@ ClassImp(AliCFContainer)
 AliCFContainer::AliCFContainer() : 
   AliCFFrame(),
   fNStep(0),
-  fGrid(0x0)
+  fGrid(0x0),
+  fBinCache()
 {
   //
   // default constructor
@@ -43,19 +44,21 @@ AliCFContainer::AliCFContainer() :
 }
 
 //____________________________________________________________________
-AliCFContainer::AliCFContainer(const Char_t* name, const Char_t* title, const Int_t nSelSteps, const Int_t nVarIn, const Int_t* nBinIn) :  
+AliCFContainer::AliCFContainer(const Char_t* name, const Char_t* title, const Int_t nSelSteps, const Int_t nVarIn, const Int_t* nBinIn, Bool_t denseFill) :  
   AliCFFrame(name,title),
   fNStep(nSelSteps),
-  fGrid(0x0)
+  fGrid(0x0),
+  fBinCache()
 {
   //
   // main constructor
+  // if denseFill is true the grids are filled through dense THnF's (see AliCFGridSparse::SetDenseFill)
   //
 
   // The grids 
   fGrid = new AliCFGridSparse*[fNStep]; //the grids at the various selection steps
   for (Int_t istep=0; istep<fNStep; istep++) {
-    fGrid[istep] = new AliCFGridSparse(Form("%s_SelStep%d",name,istep),Form("step%d",istep),nVarIn,nBinIn);
+    fGrid[istep] = new AliCFGridSparse(Form("%s_SelStep%d",name,istep),Form("step%d",istep),nVarIn,nBinIn,denseFill);
     fGrid[istep]->SumW2();
   }
   for (Int_t iVar=0; iVar<nVarIn; iVar++) SetVarTitle(iVar,Form("var%d",iVar));
@@ -65,7 +68,8 @@ AliCFContainer::AliCFContainer(const Char_t* name, const Char_t* title, const In
 AliCFContainer::AliCFContainer(const AliCFContainer& c) :
   AliCFFrame(c.fName,c.fTitle),
   fNStep(0),
-  fGrid(0x0)
+  fGrid(0x0),
+  fBinCache()
 {
   //
   // copy constructor
@@ -123,6 +127,33 @@ void AliCFContainer::Fill(const Double_t *var, Int_t istep, Double_t weight)
   fGrid[istep]->Fill(var,weight);
 }
 
+//____________________________________________________________________
+void AliCFContainer::Fill(const Double_t *var, Int_t nSteps, const Int_t* steps, Double_t weight)
+{
+  //
+  // Fills the grids at the nSteps selection steps given in steps for the same set
+  // of values of the input variables. The bin coordinates are computed once and
+  // used for all steps (e.g. the cut steps passed by a particle in AliCFManager)
+  //
+  fBinCache.resize(GetNVar());
+  GetBinCoordinates(var,&fBinCache[0]);
+  for (Int_t i=0; i<nSteps; i++) FillBin(&fBinCache[0],steps[i],weight);
+}
+
+//____________________________________________________________________
+void AliCFContainer::FillBin(const Int_t *bin, Int_t istep, Double_t weight)
+{
+  //
+  // Fills the cell with coordinates bin (see GetBinCoordinates) of the grid
+  // at selection step istep with a given weight (by default w=1)
+  //
+  if(istep >= fNStep || istep < 0){
+    AliError("Non-existent selection step, grid was not filled");
+    return;
+  }
+  fGrid[istep]->FillBin(bin,weight);
+}
+
 //____________________________________________________________________
 TH1* AliCFContainer::Project(Int_t istep, Int_t ivar1, Int_t ivar2, Int_t ivar3) const
 {
@@ -10,6 +10,7 @@
 //                                                                    //
 //--------------------------------------------------------------------//
 
+#include <vector>
 #include "AliCFFrame.h"
 #include "AliCFGridSparse.h"
 
@@ -22,7 +23,7 @@ class AliCFContainer : public AliCFFrame
 {
  public:
   AliCFContainer();
-  AliCFContainer(const Char_t* name, const Char_t* title,const Int_t nSelStep, const Int_t nVarIn, const Int_t* nBinIn);
+  AliCFContainer(const Char_t* name, const Char_t* title,const Int_t nSelStep, const Int_t nVarIn, const Int_t* nBinIn, Bool_t denseFill=kFALSE);
   AliCFContainer(const AliCFContainer& c);
   AliCFContainer& operator=(const AliCFContainer& corr);
   virtual void Copy(TObject& c) const;
@@ -62,6 +63,10 @@ class AliCFContainer : public AliCFFrame
   virtual Int_t GetNStep() const {return fNStep;};
   virtual void  SetNStep(Int_t nStep) {fNStep=nStep;}
   virtual void  Fill(const Double_t *var, Int_t istep, Double_t weight=1.) ;
+  virtual void  Fill(const Double_t *var, Int_t nSteps, const Int_t* steps, Double_t weight=1.) ; // same values at several steps
+  virtual void  FillBin(const Int_t *bin, Int_t istep, Double_t weight=1.) ;
+  virtual void  GetBinCoordinates(const Double_t *var, Int_t *bin) const {fGrid[0]->GetBinCoordinates(var,bin);}
+  virtual void  SetDenseFill(Bool_t dense=kTRUE) ;
 
   virtual Float_t  GetOverFlows (Int_t var,Int_t istep,Bool_t excl=kFALSE) const;
   virtual Float_t  GetUnderFlows(Int_t var,Int_t istep,Bool_t excl=kFALSE) const ;
@@ -96,8 +101,9 @@ class AliCFContainer : public AliCFFrame
  private:
   Int_t    fNStep; //number of selection steps
   AliCFGridSparse **fGrid;//[fNStep]
+  std::vector<Int_t> fBinCache; //! bin coordinates of the last multi-step fill
   
-  ClassDef(AliCFContainer,5);
+  ClassDef(AliCFContainer,6);
 };
 
 inline void AliCFContainer::SetBinLimits(Int_t ivar, const Double_t* array) {
@@ -135,6 +141,10 @@ inline Int_t AliCFContainer::GetVar(const Char_t* title) const {
   return fGrid[0]->GetVar(title);
 }
 
+inline void AliCFContainer::SetDenseFill(Bool_t dense) {
+  for (Int_t iStep=0; iStep<fNStep; iStep++) fGrid[iStep]->SetDenseFill(dense);
+}
+
 inline void AliCFContainer::SetBinLabel(Int_t iVar, Int_t iBin, const Char_t* label) {
   for (Int_t iStep=0; iStep<GetNStep(); iStep++) GetAxis(iVar,iStep)->SetBinLabel(iBin,label);
 }
@@ -31,6 +31,9 @@
 #include "TH1D.h"
 #include "TH2D.h"
 #include "TH3D.h"
+#include "THashList.h"
+#include "THnSparse.h"
+#include <vector>
 
 //____________________________________________________________________
 ClassImp(AliCFEffGrid)
@@ -40,7 +43,8 @@ AliCFEffGrid::AliCFEffGrid() :
   AliCFGridSparse(),
   fContainer(0x0),
   fSelNum(-1),
-  fSelDen(-1)
+  fSelDen(-1),
+  fProjectionCache(0x0)
 {
   //
   // default constructor
@@ -52,7 +56,8 @@ AliCFEffGrid::AliCFEffGrid(const Char_t* name, const Char_t* title, const Int_t
   AliCFGridSparse(name,title,nVarIn,nBinIn),
   fContainer(0x0),
   fSelNum(-1),
-  fSelDen(-1)
+  fSelDen(-1),
+  fProjectionCache(0x0)
 {
   //
   // ctor
@@ -64,7 +69,8 @@ AliCFEffGrid::AliCFEffGrid(const Char_t* name, const Char_t* title, const AliCFC
   AliCFGridSparse(name,title,c.GetNVar(),c.GetNBins()),
   fContainer(NULL),
   fSelNum(-1),
-  fSelDen(-1)
+  fSelDen(-1),
+  fProjectionCache(0x0)
 {
   //
   // main constructor
@@ -86,7 +92,8 @@ AliCFEffGrid::AliCFEffGrid(const AliCFEffGrid& eff) :
   AliCFGridSparse(eff),
   fContainer(0x0),
   fSelNum(-1),
-  fSelDen(-1)
+  fSelDen(-1),
+  fProjectionCache(0x0)
 {
   //
   // copy constructor
@@ -100,6 +107,7 @@ AliCFEffGrid::~AliCFEffGrid()
   //
   // destructor
   //
+  delete fProjectionCache;
 }
 
 //____________________________________________________________________
@@ -125,6 +133,7 @@ void AliCFEffGrid::CalculateEfficiency(Int_t istep1,Int_t istep2, Option_t *opti
 
   fSelNum=istep1;
   fSelDen=istep2;
+  ClearProjectionCache();
   AliCFGridSparse *num=GetNum();
   AliCFGridSparse *den=GetDen();
   num->SumW2();
@@ -135,6 +144,125 @@ void AliCFEffGrid::CalculateEfficiency(Int_t istep1,Int_t istep2, Option_t *opti
 
   AliInfo(Form("Efficiency calculated for steps %i and %i.",fSelNum,fSelDen));
 } 
+//____________________________________________________________________
+void AliCFEffGrid::CalculateEfficiencies(Int_t nEff, AliCFEffGrid** eff, const Int_t* stepsNum, const Int_t* stepsDen, Option_t *option)
+{
+  //
+  // Calculate the efficiencies eff[i] = stepsNum[i] / stepsDen[i] of the
+  // containers assigned to the grids eff[i], with the same contents and
+  // errors as CalculateEfficiency(stepsNum[i],stepsDen[i],option).
+  // The filled bins of each denominator step are visited only once for
+  // all the efficiencies sharing it, and the numerator bins are looked up
+  // by coordinates. Bins with empty denominator are left empty.
+  //
+  // 'option' : "B" binomial errors, otherwise uncorrelated errors
+  //
+
+  TString opt = option;
+  opt.ToUpper();
+  const Bool_t binomial = opt.Contains("B");
+
+  std::vector<Bool_t> done(nEff,kFALSE);
+  for (Int_t iEff=0; iEff<nEff; iEff++) {
+    if (!eff[iEff] || !eff[iEff]->fContainer) {
+      AliErrorClass(Form("Efficiency grid %i has no container, skipped",iEff));
+      done[iEff]=kTRUE;
+      continue;
+    }
+    eff[iEff]->fSelNum=stepsNum[iEff];
+    eff[iEff]->fSelDen=stepsDen[iEff];
+    eff[iEff]->ClearProjectionCache();
+    eff[iEff]->SumW2();
+    eff[iEff]->GetGrid()->Reset();
+    eff[iEff]->SetTitle(Form("Efficiency: %s / %s",eff[iEff]->fContainer->GetStepTitle(stepsNum[iEff]),eff[iEff]->fContainer->GetStepTitle(stepsDen[iEff])));
+  }
+
+  std::vector<Int_t> group;
+  std::vector<THnSparse*> num, out;
+  for (Int_t iEff=0; iEff<nEff; iEff++) {
+    if (done[iEff]) continue;
+    // all the efficiencies with the same denominator
+    group.clear();
+    for (Int_t jEff=iEff; jEff<nEff; jEff++) {
+      if (done[jEff] || eff[jEff]->fContainer!=eff[iEff]->fContainer || stepsDen[jEff]!=stepsDen[iEff]) continue;
+      if (eff[jEff]->GetNVar()!=eff[iEff]->GetNVar()) {
+        AliErrorClass(Form("Different number of variables in efficiency grid %i, skipped",jEff));
+        done[jEff]=kTRUE;
+        continue;
+      }
+      group.push_back(jEff);
+      done[jEff]=kTRUE;
+    }
+    num.resize(group.size());
+    out.resize(group.size());
+    for (UInt_t k=0; k<group.size(); k++) {
+      num[k]=eff[group[k]]->GetNum()->GetGrid();
+      out[k]=eff[group[k]]->GetGrid();
+    }
+
+    THnSparse *den = eff[iEff]->GetDen()->GetGrid();
+    std::vector<Int_t> coord(den->GetNdimensions());
+    for (Long64_t iBin=0; iBin<den->GetNbins(); iBin++) {
+      const Double_t b2 = den->GetBinContent(iBin,coord.data());
+      if (b2==0) continue;
+      const Double_t e2sq = den->GetBinError2(iBin);
+      for (UInt_t k=0; k<group.size(); k++) {
+        const Long64_t jBin = num[k]->GetBin(coord.data(),kFALSE);
+        if (jBin<0) continue;
+        const Double_t b1 = num[k]->GetBinContent(jBin);
+        if (b1==0) continue;
+        const Double_t e1sq = num[k]->GetBinError2(jBin);
+        Double_t err2 = 0;
+        if (binomial) {
+          if (b1!=b2) {
+            const Double_t w = b1/b2;
+            err2 = TMath::Abs(((1.-2.*w)*e1sq + w*w*e2sq)/(b2*b2));
+          }
+        }
+        else err2 = (e1sq*b2*b2 + e2sq*b1*b1)/(b2*b2*b2*b2);
+        const Long64_t oBin = out[k]->GetBin(coord.data());
+        out[k]->SetBinContent(oBin,b1/b2);
+        out[k]->SetBinError2(oBin,err2);
+      }
+    }
+  }
+  AliInfoClass(Form("%i efficiencies calculated.",nEff));
+}
+//____________________________________________________________________
+void AliCFEffGrid::ClearProjectionCache()
+{
+  //
+  // Delete the cached projections of the container steps
+  //
+  if (fProjectionCache) fProjectionCache->Delete();
+}
+//____________________________________________________________________
+TH1* AliCFEffGrid::GetStepProjection(Int_t istep, Int_t ivar1, Int_t ivar2, Int_t ivar3) const
+{
+  //
+  // Projection of step istep of the container along ivar1 (and ivar2 (and ivar3)),
+  // computed once and kept until the efficiency or the container changes
+  //
+  TString key = Form("step%i_proj_%i_%i_%i",istep,ivar1,ivar2,ivar3);
+  if (fProjectionCache) {
+    TH1* h = (TH1*)fProjectionCache->FindObject(key);
+    if (h) return h;
+  }
+  else {
+    fProjectionCache = new THashList();
+    fProjectionCache->SetOwner(kTRUE);
+  }
+
+  THnSparse* grid = fContainer->GetGrid(istep)->GetGrid();
+  TH1* h ;
+  if (ivar3>=0)      h = grid->Projection(ivar1,ivar2,ivar3,"E");
+  else if (ivar2>=0) h = grid->Projection(ivar2,ivar1,"E");
+  else               h = grid->Projection(ivar1,"E");
+  h->SetDirectory(0);
+  h->SetName(key);
+  fProjectionCache->Add(h);
+  return h;
+}
 //_____________________________________________________________________
 Double_t AliCFEffGrid::GetAverage() const 
 {
@@ -166,37 +294,20 @@ TH1* AliCFEffGrid::Project(Int_t ivar1, Int_t ivar2, Int_t ivar3) const
     AliError("You must call CalculateEfficiency() first !");
     return 0x0;
   }
-  const Int_t nDim = 3 ;
-  Int_t dim[nDim] = {ivar1,ivar2,ivar3} ;
-  
-  THnSparse *hNum, *hDen, *ratio;
-  TH1* h ;
-
-  if (ivar3<0) {
-    if (ivar2<0) {
-      hNum = ((AliCFGridSparse*)GetNum())->GetGrid()->Projection(nDim-2,dim);
-      hDen = ((AliCFGridSparse*)GetDen())->GetGrid()->Projection(nDim-2,dim);
-      ratio = (THnSparse*)hNum->Clone();
-      ratio->Divide(hNum,hDen,1.,1.,"B");
-      h = ratio->Projection(0);
-    }
-    else{
-      hNum = ((AliCFGridSparse*)GetNum())->GetGrid()->Projection(nDim-1,dim);
-      hDen = ((AliCFGridSparse*)GetDen())->GetGrid()->Projection(nDim-1,dim);
-      ratio = (THnSparse*)hNum->Clone();
-      ratio->Divide(hNum,hDen,1.,1.,"B");
-      h = ratio->Projection(1,0);
-    }
-  }
-  else {
-    hNum = ((AliCFGridSparse*)GetNum())->GetGrid()->Projection(nDim,dim);
-    hDen = ((AliCFGridSparse*)GetDen())->GetGrid()->Projection(nDim,dim);
-    ratio = (THnSparse*)hNum->Clone();
-    ratio->Divide(hNum,hDen,1.,1.,"B");
-    h = ratio->Projection(0,1,2);
+  if (!fContainer) {
+    AliError("No container assigned !");
+    return 0x0;
   }
+  // the step projections are cached, the numerator and denominator
+  // are projected only once for repeated calls over the same axes
+  TH1* hNum = GetStepProjection(fSelNum,ivar1,ivar2,ivar3);
+  TH1* hDen = GetStepProjection(fSelDen,ivar1,ivar2,ivar3);
 
-  delete hNum; delete hDen; delete ratio;
+  TString name = Form("%s_proj_%i",GetName(),ivar1);
+  if (ivar2>=0) name += Form("_%i",ivar2);
+  if (ivar3>=0) name += Form("_%i",ivar3);
+  TH1* h = (TH1*)hNum->Clone(name);
+  h->Divide(hNum,hDen,1.,1.,"B");
   return h ;
 } 
 //___________________________________________________________________
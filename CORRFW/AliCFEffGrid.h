@@ -15,6 +15,7 @@
 class TH1D;
 class TH2D;
 class TH3D;
+class THashList;
 
 class AliCFEffGrid : public AliCFGridSparse
 {
@@ -35,16 +36,21 @@ class AliCFEffGrid : public AliCFGridSparse
 
   //Efficiency calculation
   virtual void  CalculateEfficiency(Int_t istep1, Int_t istep2, Option_t *option ="B" /*binomial*/);
+  static  void  CalculateEfficiencies(Int_t nEff, AliCFEffGrid** eff, const Int_t* stepsNum, const Int_t* stepsDen, Option_t *option ="B" /*binomial*/);
   virtual AliCFGridSparse*  GetNum() const {return fContainer->GetGrid(fSelNum);};
   virtual AliCFGridSparse*  GetDen() const {return fContainer->GetGrid(fSelDen);};
-  virtual void  SetContainer(const AliCFContainer &c) {fContainer=&c;};
+  virtual void  SetContainer(const AliCFContainer &c) {fContainer=&c; ClearProjectionCache();};
+  void          ClearProjectionCache(); // to be called if the container is modified after Project()
 
  private:
+  TH1* GetStepProjection(Int_t istep, Int_t ivar1, Int_t ivar2, Int_t ivar3) const;
+
   const AliCFContainer *fContainer; //pointer to the input AliContainer
   Int_t fSelNum;                    //numerator selection step
   Int_t fSelDen;                    //denominator selection step
+  mutable THashList *fProjectionCache; //! projections of the container steps, reused by Project()
   
-  ClassDef(AliCFEffGrid,1);
+  ClassDef(AliCFEffGrid,2);
 };
     
 #endif
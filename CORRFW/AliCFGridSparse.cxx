@@ -26,6 +26,7 @@
 //
 #include "AliCFGridSparse.h"
 #include "THnSparse.h"
+#include "THn.h"
 #include "AliLog.h"
 #include "TMath.h"
 #include "TROOT.h"
@@ -42,7 +43,9 @@ ClassImp(AliCFGridSparse)
 AliCFGridSparse::AliCFGridSparse() : 
   AliCFFrame(),
   fSumW2(kFALSE),
-  fData(0x0)
+  fData(0x0),
+  fDenseFill(kFALSE),
+  fDense(0x0)
 {
   // default constructor
 }
@@ -50,18 +53,23 @@ AliCFGridSparse::AliCFGridSparse() :
 AliCFGridSparse::AliCFGridSparse(const Char_t* name, const Char_t* title) : 
   AliCFFrame(name,title),
   fSumW2(kFALSE),
-  fData(0x0)
+  fData(0x0),
+  fDenseFill(kFALSE),
+  fDense(0x0)
 {
   // default constructor
 }
 //____________________________________________________________________
-AliCFGridSparse::AliCFGridSparse(const Char_t* name, const Char_t* title, Int_t nVarIn, const Int_t * nBinIn) :  
+AliCFGridSparse::AliCFGridSparse(const Char_t* name, const Char_t* title, Int_t nVarIn, const Int_t * nBinIn, Bool_t denseFill) :  
   AliCFFrame(name,title),
   fSumW2(kFALSE),
-  fData(0x0)
+  fData(0x0),
+  fDenseFill(denseFill),
+  fDense(0x0)
 {
   //
   // main constructor
+  // if denseFill is true the grid is filled through a dense THnF (see SetDenseFill)
   //
 
   fData = new THnSparseF(name,title,nVarIn,nBinIn);
@@ -74,13 +82,16 @@ AliCFGridSparse::~AliCFGridSparse()
   // destructor
   //
   if (fData) delete fData;
+  if (fDense) delete fDense;
 }
 
 //____________________________________________________________________
 AliCFGridSparse::AliCFGridSparse(const AliCFGridSparse& c) :
   AliCFFrame(c),
   fSumW2(kFALSE),
-  fData(0x0)
+  fData(0x0),
+  fDenseFill(kFALSE),
+  fDense(0x0)
 {
   //
   // copy constructor
@@ -107,7 +118,7 @@ void AliCFGridSparse::SetBinLimits(Int_t ivar, Double_t min, Double_t max)
   Int_t nBins = GetNBins(ivar);
   Double_t * array = new Double_t[nBins+1];
   for (Int_t iEdge=0; iEdge<=nBins; iEdge++) array[iEdge] = min + iEdge * (max-min)/nBins ;
-  fData->SetBinEdges(ivar, array);
+  SetBinLimits(ivar, array);
   delete [] array ;
 } 
 
@@ -117,6 +128,7 @@ void AliCFGridSparse::SetBinLimits(Int_t ivar, const Double_t *array)
   //
   // setting the arrays containing the bin limits 
   //
+  ResetDenseGrid();
   fData->SetBinEdges(ivar, array);
 } 
 
@@ -128,7 +140,126 @@ void AliCFGridSparse::Fill(const Double_t *var, Double_t weight)
   // given a set of values of the input variable, 
   // with weight (by default w=1)
   //
-  fData->Fill(var,weight);
+  if (!fDenseFill) {
+    fData->Fill(var,weight);
+    return;
+  }
+  Int_t* bin = new Int_t[GetNVar()];
+  GetBinCoordinates(var,bin);
+  FillBin(bin,weight);
+  delete [] bin;
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::GetBinCoordinates(const Double_t *var, Int_t *bin) const
+{
+  //
+  // Computes the bin coordinates of the set of values var of the input variables,
+  // as THnSparse::Fill does. The coordinates can be passed to FillBin of this grid
+  // and of all grids with the same binning, e.g. the steps of an AliCFContainer
+  //
+  for (Int_t iVar=0; iVar<GetNVar(); iVar++) bin[iVar] = fData->GetAxis(iVar)->FindBin(var[iVar]);
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::FillBin(const Int_t *bin, Double_t weight)
+{
+  //
+  // Fill the cell with coordinates bin (see GetBinCoordinates) with weight.
+  // Unlike Fill, the sums of weight*var used for the axis statistics of the
+  // projections are not updated
+  //
+  if (fDenseFill && !fDense) CreateDenseGrid();
+  if (fDense) {
+    fDense->FillBin(fDense->GetBin(bin),weight);
+    return;
+  }
+  fData->FillBin(fData->GetBin(bin),weight);
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::SetDenseFill(Bool_t dense)
+{
+  //
+  // In dense fill mode the grid is filled through a THnF with all the cells of the grid
+  // (including under- and overflows), which avoids the hashing of the bin index done
+  // by THnSparse at each fill. Its content is added to the THnSparse the next time the
+  // content of the grid is accessed (GetGrid() and all operations of this class).
+  // To be used only for grids whose total number of cells fits in memory.
+  // The bin limits must be set before filling.
+  //
+  if (!dense) ResetDenseGrid();
+  fDenseFill = dense;
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::CreateDenseGrid()
+{
+  //
+  // creates the dense fill buffer with the binning of fData
+  //
+  const Int_t nVar = GetNVar();
+  Int_t* nBins = new Int_t[nVar];
+  Double_t* min = new Double_t[nVar];
+  Double_t* max = new Double_t[nVar];
+  Double_t nCells = 1;
+  for (Int_t iVar=0; iVar<nVar; iVar++) {
+    TAxis* axis = fData->GetAxis(iVar);
+    nBins[iVar] = axis->GetNbins();
+    min[iVar] = axis->GetXmin();
+    max[iVar] = axis->GetXmax();
+    nCells *= nBins[iVar]+2;
+  }
+  if (nCells > kMaxInt) {
+    AliError(Form("%s: %.3g cells are too many for a dense grid, filling the THnSparse",GetName(),nCells));
+    fDenseFill = kFALSE;
+  }
+  else {
+    AliInfo(Form("%s: dense fill grid with %.0f cells",GetName(),nCells));
+    fDense = new THnF(Form("%s_dense",GetName()),GetTitle(),nVar,nBins,min,max);
+    for (Int_t iVar=0; iVar<nVar; iVar++) {
+      const TArrayD* edges = fData->GetAxis(iVar)->GetXbins();
+      if (edges->GetSize()) fDense->SetBinEdges(iVar,edges->GetArray());
+    }
+    if (fSumW2) fDense->Sumw2();
+  }
+  delete [] nBins;
+  delete [] min;
+  delete [] max;
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::FlushDenseGrid() const
+{
+  //
+  // adds the content of the dense fill buffer to the THnSparse and resets the buffer
+  //
+  if (!fDense || fDense->GetEntries() == 0) return;
+  Int_t* bin = new Int_t[GetNVar()];
+  const Bool_t errors = fDense->GetCalculateErrors();
+  for (Long64_t i=0; i<fDense->GetNbins(); i++) {
+    Double_t v = fDense->GetBinContent(i,bin);
+    Double_t e2 = errors ? fDense->GetBinError2(i) : 0;
+    if (v == 0 && e2 == 0) continue;
+    Long64_t index = fData->GetBin(bin,kTRUE);
+    fData->AddBinContent(index,v);
+    if (errors) fData->AddBinError2(index,e2);
+  }
+  fData->SetEntries(fData->GetEntries()+fDense->GetEntries());
+  fDense->Reset();
+  delete [] bin;
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::ResetDenseGrid()
+{
+  //
+  // flushes and deletes the dense fill buffer, to be recreated with the current binning
+  //
+  if (!fDense) return;
+  FlushDenseGrid();
+  delete fDense;
+  fDense = 0x0;
 }
 
 //___________________________________________________________________
@@ -150,7 +281,7 @@ AliCFGridSparse* AliCFGridSparse::MakeSlice(Int_t nVars, const Int_t* vars, cons
   AliCFGridSparse* out = new AliCFGridSparse(fName,fTitle,nVars,bins);
 
   //set the range in the THnSparse to project
-  THnSparse* clone = ((THnSparse*)fData->Clone());
+  THnSparse* clone = ((THnSparse*)GetGrid()->Clone());
   if (varMin && varMax) {
     for (Int_t iAxis=0; iAxis<GetNVar(); iAxis++) {
       SetAxisRange(clone->GetAxis(iAxis),varMin[iAxis],varMax[iAxis],useBins);
@@ -172,7 +303,7 @@ Float_t AliCFGridSparse::GetBinCenter(Int_t ivar, Int_t ibin) const
   // Returns the center of specified bin for variable axis ivar
   // 
   
-  return (Float_t) fData->GetAxis(ivar)->GetBinCenter(ibin);
+  return (Float_t) GetGrid()->GetAxis(ivar)->GetBinCenter(ibin);
 }
 
 //____________________________________________________________________
@@ -182,7 +313,7 @@ Float_t AliCFGridSparse::GetBinSize(Int_t ivar, Int_t ibin) const
   // Returns the size of specified bin for variable axis ivar
   // 
   
-  return (Float_t) fData->GetAxis(ivar)->GetBinUpEdge(ibin) - fData->GetAxis(ivar)->GetBinLowEdge(ibin);
+  return (Float_t) GetGrid()->GetAxis(ivar)->GetBinUpEdge(ibin) - GetGrid()->GetAxis(ivar)->GetBinLowEdge(ibin);
 }
 
 //____________________________________________________________________
@@ -192,7 +323,7 @@ Float_t AliCFGridSparse::GetEntries() const
   // total entries (including overflows and underflows)
   //
 
-  return fData->GetEntries();
+  return GetGrid()->GetEntries();
 }
 
 //____________________________________________________________________
@@ -202,7 +333,7 @@ Float_t AliCFGridSparse::GetElement(Long_t index) const
   // Returns content of grid element index 
   //
   
-  return fData->GetBinContent(index);
+  return GetGrid()->GetBinContent(index);
 }
 //____________________________________________________________________
 Float_t AliCFGridSparse::GetElement(const Int_t *bin) const
@@ -210,7 +341,7 @@ Float_t AliCFGridSparse::GetElement(const Int_t *bin) const
   //
   // Get the content in a bin corresponding to a set of bin indexes
   //
-  return fData->GetBinContent(bin);
+  return GetGrid()->GetBinContent(bin);
 
 }  
 //____________________________________________________________________
@@ -220,9 +351,9 @@ Float_t AliCFGridSparse::GetElement(const Double_t *var) const
   // Get the content in a bin corresponding to a set of input variables
   //
 
-  Long_t index = fData->GetBin(var,kFALSE);
+  Long_t index = GetGrid()->GetBin(var,kFALSE);
   if (index<0) return 0.;
-  return fData->GetBinContent(index);
+  return GetGrid()->GetBinContent(index);
 } 
 
 //____________________________________________________________________
@@ -232,7 +363,7 @@ Float_t AliCFGridSparse::GetElementError(Long_t index) const
   // Returns the error on the content 
   //
 
-  return fData->GetBinError(index);
+  return GetGrid()->GetBinError(index);
 }
 //____________________________________________________________________
 Float_t AliCFGridSparse::GetElementError(const Int_t *bin) const
@@ -240,7 +371,7 @@ Float_t AliCFGridSparse::GetElementError(const Int_t *bin) const
  //
   // Get the error in a bin corresponding to a set of bin indexes
   //
-  return fData->GetBinError(bin);
+  return GetGrid()->GetBinError(bin);
 
 }  
 //____________________________________________________________________
@@ -250,9 +381,9 @@ Float_t AliCFGridSparse::GetElementError(const Double_t *var) const
   // Get the error in a bin corresponding to a set of input variables
   //
 
-  Long_t index=fData->GetBin(var,kFALSE); //this is the THnSparse index (do not allocate new cells if content is empy)
+  Long_t index=GetGrid()->GetBin(var,kFALSE); //this is the THnSparse index (do not allocate new cells if content is empy)
   if (index<0) return 0.;
-  return fData->GetBinError(index);
+  return GetGrid()->GetBinError(index);
 } 
 
 //____________________________________________________________________
@@ -262,7 +393,7 @@ void AliCFGridSparse::SetElement(Long_t index, Float_t val)
   // Sets grid element value
   //
   Int_t* bin = new Int_t[GetNVar()];
-  fData->GetBinContent(index,bin); //affects the bin coordinates
+  GetGrid()->GetBinContent(index,bin); //affects the bin coordinates
   SetElement(bin,val);
   delete [] bin ;
 }
@@ -273,7 +404,7 @@ void AliCFGridSparse::SetElement(const Int_t *bin, Float_t val)
   //
   // Sets grid element of bin indeces bin to val
   //
-  fData->SetBinContent(bin,val);
+  GetGrid()->SetBinContent(bin,val);
 }
 //____________________________________________________________________
 void AliCFGridSparse::SetElement(const Double_t *var, Float_t val) 
@@ -281,9 +412,9 @@ void AliCFGridSparse::SetElement(const Double_t *var, Float_t val)
   //
   // Set the content in a bin to value val corresponding to a set of input variables
   //
-  Long_t index=fData->GetBin(var,kTRUE); //THnSparse index: allocate the cell
+  Long_t index=GetGrid()->GetBin(var,kTRUE); //THnSparse index: allocate the cell
   Int_t *bin = new Int_t[GetNVar()];
-  fData->GetBinContent(index,bin); //trick to access the array of bins
+  GetGrid()->GetBinContent(index,bin); //trick to access the array of bins
   SetElement(bin,val);
   delete [] bin;
 }
@@ -295,7 +426,7 @@ void AliCFGridSparse::SetElementError(Long_t index, Float_t val)
   // Sets grid element iel error to val (linear indexing) in AliCFFrame
   //
   Int_t *bin = new Int_t[GetNVar()];
-  fData->GetBinContent(index,bin);
+  GetGrid()->GetBinContent(index,bin);
   SetElementError(bin,val);
   delete [] bin;
 }
@@ -306,7 +437,7 @@ void AliCFGridSparse::SetElementError(const Int_t *bin, Float_t val)
   //
   // Sets grid element error of bin indeces bin to val
   //
-  fData->SetBinError(bin,val);
+  GetGrid()->SetBinError(bin,val);
 }
 //____________________________________________________________________
 void AliCFGridSparse::SetElementError(const Double_t *var, Float_t val) 
@@ -314,9 +445,9 @@ void AliCFGridSparse::SetElementError(const Double_t *var, Float_t val)
   //
   // Set the error in a bin to value val corresponding to a set of input variables
   //
-  Long_t index=fData->GetBin(var); //THnSparse index
+  Long_t index=GetGrid()->GetBin(var); //THnSparse index
   Int_t *bin = new Int_t[GetNVar()];
-  fData->GetBinContent(index,bin); //trick to access the array of bins
+  GetGrid()->GetBinContent(index,bin); //trick to access the array of bins
   SetElementError(bin,val);
   delete [] bin;
 }
@@ -328,7 +459,8 @@ void AliCFGridSparse::SumW2()
   //set calculation of the squared sum of the weighted entries
   //
   if(!fSumW2){
-    fData->CalculateErrors(kTRUE); 
+    GetGrid()->CalculateErrors(kTRUE); 
+    if (fDense) fDense->Sumw2();
   }
   fSumW2=kTRUE;
 }
@@ -346,7 +478,7 @@ void AliCFGridSparse::Add(const AliCFGridSparse* aGrid, Double_t c)
   } 
   
   if (!fSumW2  && aGrid->GetSumW2()) SumW2();
-  fData->Add(aGrid->GetGrid(),c);
+  GetGrid()->Add(aGrid->GetGrid(),c);
 }
 
 //____________________________________________________________________
@@ -363,9 +495,9 @@ void AliCFGridSparse::Add(const AliCFGridSparse* aGrid1, const AliCFGridSparse*
   
   if (!fSumW2  && (aGrid1->GetSumW2() || aGrid2->GetSumW2())) SumW2();
 
-  fData->Reset();
-  fData->Add(aGrid1->GetGrid(),c1);
-  fData->Add(aGrid2->GetGrid(),c2);
+  GetGrid()->Reset();
+  GetGrid()->Add(aGrid1->GetGrid(),c1);
+  GetGrid()->Add(aGrid2->GetGrid(),c2);
 }
 
 //____________________________________________________________________
@@ -382,8 +514,8 @@ void AliCFGridSparse::Multiply(const AliCFGridSparse* aGrid, Double_t c)
   
   if(!fSumW2  && aGrid->GetSumW2()) SumW2();
   THnSparse *h = aGrid->GetGrid();
-  fData->Multiply(h);
-  fData->Scale(c);
+  GetGrid()->Multiply(h);
+  GetGrid()->Scale(c);
 }
 
 //____________________________________________________________________
@@ -400,12 +532,12 @@ void AliCFGridSparse::Multiply(const AliCFGridSparse* aGrid1, const AliCFGridSpa
   
   if(!fSumW2  && (aGrid1->GetSumW2() || aGrid2->GetSumW2())) SumW2();
 
-  fData->Reset();
+  GetGrid()->Reset();
   THnSparse *h1 = aGrid1->GetGrid();
   THnSparse *h2 = aGrid2->GetGrid();
   h2->Multiply(h1);
   h2->Scale(c1*c2);
-  fData->Add(h2);
+  GetGrid()->Add(h2);
 }
 
 //____________________________________________________________________
@@ -423,9 +555,9 @@ void AliCFGridSparse::Divide(const AliCFGridSparse* aGrid, Double_t c)
   if (!fSumW2  && aGrid->GetSumW2()) SumW2();
 
   THnSparse *h1 = aGrid->GetGrid();
-  THnSparse *h2 = (THnSparse*)fData->Clone();
-  fData->Divide(h2,h1);
-  fData->Scale(c);
+  THnSparse *h2 = (THnSparse*)GetGrid()->Clone();
+  GetGrid()->Divide(h2,h1);
+  GetGrid()->Scale(c);
 }
 
 //____________________________________________________________________
@@ -445,7 +577,7 @@ void AliCFGridSparse::Divide(const AliCFGridSparse* aGrid1, const AliCFGridSpars
 
   THnSparse *h1= aGrid1->GetGrid();
   THnSparse *h2= aGrid2->GetGrid();
-  fData->Divide(h1,h2,c1,c2,option);
+  GetGrid()->Divide(h1,h2,c1,c2,option);
 }
 
 
@@ -462,8 +594,9 @@ void AliCFGridSparse::Rebin(const Int_t* group)
     if (group[i]!=1) AliInfo(Form(" merging bins along dimension %i in groups of %i bins", i,group[i]));
   }
 
-  THnSparse *rebinned =fData->Rebin(group);
-  fData->Reset();
+  ResetDenseGrid();
+  THnSparse *rebinned =GetGrid()->Rebin(group);
+  GetGrid()->Reset();
   fData = rebinned;
 }
 //____________________________________________________________________
@@ -553,7 +686,7 @@ Double_t AliCFGridSparse::GetIntegral() const
   //
   // Get full Integral
   //
-  return fData->ComputeIntegral();  
+  return GetGrid()->ComputeIntegral();  
 } 
 
 //____________________________________________________________________
@@ -606,8 +739,9 @@ void AliCFGridSparse::Copy(TObject& c) const
   AliCFFrame::Copy(c);
   AliCFGridSparse& target = (AliCFGridSparse &) c;
   target.fSumW2 = fSumW2 ;
+  target.fDenseFill = fDenseFill ;
   if (fData) {
-    target.fData = (THnSparse*)fData->Clone();
+    target.fData = (THnSparse*)GetGrid()->Clone();
   }
 }
 
@@ -621,7 +755,7 @@ TH1* AliCFGridSparse::Slice(Int_t iVar1, Int_t iVar2, Int_t iVar3, const Double_
   // If useBins=true, varMin and varMax are taken as bin numbers
   // if varmin or varmax point to null, all the range is taken, including over- and underflows
 
-  THnSparse* clone = (THnSparse*)fData->Clone();
+  THnSparse* clone = (THnSparse*)GetGrid()->Clone();
   if (varMin != 0x0 && varMax != 0x0) {
     for (Int_t iAxis=0; iAxis<GetNVar(); iAxis++) SetAxisRange(clone->GetAxis(iAxis),varMin[iAxis],varMax[iAxis],useBins);
   }
@@ -712,9 +846,9 @@ void AliCFGridSparse::SetRangeUser(Int_t iVar, Double_t varMin, Double_t varMax,
   //
   // set range of axis iVar. 
   //
-  SetAxisRange(fData->GetAxis(iVar),varMin,varMax,useBins);
+  SetAxisRange(GetGrid()->GetAxis(iVar),varMin,varMax,useBins);
 	//AliInfo(Form("AliCFGridSparse axis %d range has been modified",iVar));
-	TAxis* currAxis = fData->GetAxis(iVar);
+	TAxis* currAxis = GetGrid()->GetAxis(iVar);
   TString outString = Form("%s new range: %.5f < %s < %.5f", GetName(), currAxis->GetBinLowEdge(currAxis->GetFirst()), currAxis->GetTitle(), currAxis->GetBinUpEdge(currAxis->GetLast()));
   TString binLabel = currAxis->GetBinLabel(currAxis->GetFirst());
   if ( ! binLabel.IsNull() ) {
@@ -749,8 +883,8 @@ Float_t AliCFGridSparse::GetOverFlows(Int_t ivar, Bool_t exclusive) const
   Int_t* bin = new Int_t[GetNVar()];
   memset(bin, 0, sizeof(Int_t) * GetNVar());
   Float_t ovfl=0.;
-  for (Long64_t i = 0; i < fData->GetNbins(); i++) {
-    Double_t v = fData->GetBinContent(i, bin);
+  for (Long64_t i = 0; i < GetGrid()->GetNbins(); i++) {
+    Double_t v = GetGrid()->GetBinContent(i, bin);
     Bool_t add=kTRUE;
     if (exclusive) {
       for(Int_t j=0;j<GetNVar();j++){
@@ -775,8 +909,8 @@ Float_t AliCFGridSparse::GetUnderFlows(Int_t ivar, Bool_t exclusive) const
   Int_t* bin = new Int_t[GetNVar()];
   memset(bin, 0, sizeof(Int_t) * GetNVar());
   Float_t unfl=0.;
-  for (Long64_t i = 0; i < fData->GetNbins(); i++) {
-    Double_t v = fData->GetBinContent(i, bin);
+  for (Long64_t i = 0; i < GetGrid()->GetNbins(); i++) {
+    Double_t v = GetGrid()->GetBinContent(i, bin);
     Bool_t add=kTRUE;
     if (exclusive) {
       for(Int_t j=0;j<GetNVar();j++){
@@ -801,5 +935,5 @@ void AliCFGridSparse::Smooth() {
   AliInfo("Your GridSparse is going to be smoothed");
   AliInfo(Form("N TOTAL  BINS : %li",GetNBinsTotal()));
   AliInfo(Form("N FILLED BINS : %li",GetNFilledBins()));
-  AliCFUnfolding::SmoothUsingNeighbours(fData);
+  AliCFUnfolding::SmoothUsingNeighbours(GetGrid());
 }
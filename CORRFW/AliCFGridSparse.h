@@ -10,6 +10,7 @@
 
 #include "AliCFFrame.h"
 #include "THnSparse.h"
+#include "THn.h"
 #include "AliLog.h"
 #include "TAxis.h"
 
@@ -22,7 +23,7 @@ class AliCFGridSparse : public AliCFFrame
  public:
   AliCFGridSparse();
   AliCFGridSparse(const Char_t* name, const Char_t* title);
-  AliCFGridSparse(const Char_t* name, const Char_t* title, Int_t nVarIn, const Int_t* nBinIn);
+  AliCFGridSparse(const Char_t* name, const Char_t* title, Int_t nVarIn, const Int_t* nBinIn, Bool_t denseFill=kFALSE);
   AliCFGridSparse(const AliCFGridSparse& c);
   virtual ~AliCFGridSparse();
   AliCFGridSparse& operator=(const AliCFGridSparse& c);
@@ -37,7 +38,7 @@ class AliCFGridSparse : public AliCFFrame
   virtual void       GetBinLimits(Int_t ivar, Double_t * array) const ;
   virtual Double_t * GetBinLimits(Int_t ivar) const ;
   virtual Long_t     GetNBinsTotal() const ;
-  virtual Long_t     GetNFilledBins() const {return fData->GetNbins();}
+  virtual Long_t     GetNFilledBins() const {return GetGrid()->GetNbins();}
   virtual Int_t      GetNBins(Int_t ivar) const {return fData->GetAxis(ivar)->GetNbins();}
   virtual Int_t *    GetNBins() const ;
   virtual Float_t    GetBinCenter(Int_t ivar,Int_t ibin) const ;
@@ -56,6 +57,10 @@ class AliCFGridSparse : public AliCFFrame
   //virtual Int_t      GetBinIndex(Int_t ivar, Int_t ind) const ;
 
   virtual void    Fill(const Double_t *var, Double_t weight=1.);
+  virtual void    GetBinCoordinates(const Double_t *var, Int_t *bin) const; // bin coordinates to be used in FillBin
+  virtual void    FillBin(const Int_t *bin, Double_t weight=1.);
+  virtual void    SetDenseFill(Bool_t dense=kTRUE); // fill through a dense THnF instead of the THnSparse
+  Bool_t          IsDenseFill() const {return fDenseFill;}
   virtual Float_t GetEntries()const;
   virtual Float_t GetElement(Long_t iel)               const; 
   virtual Float_t GetElement(const Int_t *bin)         const; 
@@ -99,8 +104,8 @@ class AliCFGridSparse : public AliCFFrame
   //virtual Double_t GetIntegral(const Double_t *varMin, const Double_t *varMax) const;
   virtual Long64_t Merge(TCollection* list);
 
-  virtual void     SetGrid(THnSparse* grid) {if (fData) delete fData ; fData=grid;}
-  THnSparse   *    GetGrid() const {return fData;}
+  virtual void     SetGrid(THnSparse* grid) {ResetDenseGrid(); if (fData) delete fData ; fData=grid;}
+  THnSparse   *    GetGrid() const {FlushDenseGrid(); return fData;}
 
   virtual Float_t GetOverFlows (Int_t var, Bool_t excl=kFALSE) const;
   virtual Float_t GetUnderFlows(Int_t var, Bool_t excl=kFALSE) const;
@@ -118,12 +123,17 @@ class AliCFGridSparse : public AliCFFrame
   void     SetAxisRange(TAxis* axis, Double_t min, Double_t max, Bool_t useBins) const;
   void     GetProjectionName (TString& s,Int_t var0, Int_t var1=-1, Int_t var2=-1) const;
   void     GetProjectionTitle(TString& s,Int_t var0, Int_t var1=-1, Int_t var2=-1) const;
+  void     CreateDenseGrid();
+  void     FlushDenseGrid() const;
+  void     ResetDenseGrid();
 
   // data members:
   Bool_t      fSumW2    ; // Flag to check if calculation of squared weights enabled
   THnSparse  *fData     ; // The data Container: a THnSparse  
+  Bool_t      fDenseFill; // Flag to fill through fDense instead of fData
+  THnF       *fDense    ; // Dense fill buffer, added to fData when the content is accessed
 
-  ClassDef(AliCFGridSparse,3);
+  ClassDef(AliCFGridSparse,4);
 };
 
 
@@ -136,6 +136,57 @@ Bool_t AliCFManager::CheckEventCuts(Int_t isel, TObject *obj, const TString  &se
   return kTRUE;
 }
 
+//_____________________________________________________________________________
+Int_t AliCFManager::CheckParticleCutsCumulative(TObject *obj, UInt_t *stepMask) const {
+  //
+  // returns the last particle-level selection step passed by obj together with
+  // all the previous steps (see CheckCutsCumulative)
+  //
+  return CheckCutsCumulative(fPartCutList,fNStepPart,obj,stepMask);
+}
+
+//_____________________________________________________________________________
+Int_t AliCFManager::CheckEventCutsCumulative(TObject *obj, UInt_t *stepMask) const {
+  //
+  // returns the last event-level selection step passed by obj together with
+  // all the previous steps (see CheckCutsCumulative)
+  //
+  return CheckCutsCumulative(fEvtCutList,fNStepEvt,obj,stepMask);
+}
+
+//_____________________________________________________________________________
+Int_t AliCFManager::CheckCutsCumulative(TObjArray **cutList, Int_t nstep, TObject *obj, UInt_t *stepMask) const {
+  //
+  // checks the steps in order and stops at the first step not passed.
+  // The cut list of a step usually contains the cuts of the previous steps:
+  // since these have all been passed, only the cuts not in the lists of the
+  // previous steps are evaluated, so that each cut is called once per object
+  // instead of once per step.
+  //
+
+  if (stepMask) *stepMask = 0;
+  Int_t lastStep = -1;
+  for (Int_t isel=0; isel<nstep; isel++) {
+    TObjArray* cuts = cutList ? cutList[isel] : 0x0;
+    if (cuts) {
+      TObjArrayIter iter(cuts);
+      AliCFCutBase *cut = 0;
+      Bool_t passed = kTRUE;
+      while ( passed && (cut = (AliCFCutBase*)iter.Next()) ) {
+	Bool_t checked = kFALSE;
+	for (Int_t iprev=0; iprev<isel && !checked; iprev++) {
+	  if (cutList[iprev] && cutList[iprev]->IndexOf(cut) >= 0) checked = kTRUE;
+	}
+	if (!checked && !cut->IsSelected(obj)) passed = kFALSE;
+      }
+      if (!passed) break;
+    }
+    lastStep = isel;
+    if (stepMask && isel < 32) *stepMask |= (1u << isel);
+  }
+  return lastStep;
+}
+
 //_____________________________________________________________________________
 void  AliCFManager::SetMCEventInfo(const TObject *obj) const {
 
@@ -116,6 +116,15 @@ class AliCFManager : public TNamed
   virtual Bool_t CheckEventCuts(Int_t isel, TObject *obj, const TString &selcuts="all") const;
   virtual Bool_t CheckParticleCuts(Int_t isel, TObject *obj, const TString &selcuts="all") const;
 
+  //Cumulative cut checkers: the steps are checked in order, each cut being
+  //evaluated once, and the last step passed together with all the previous
+  //ones is returned (-1 if the first step is not passed). Bit i of stepMask
+  //is set if step i is passed (steps after the first failing one are not
+  //evaluated and their bits are not set)
+
+  virtual Int_t CheckEventCutsCumulative(TObject *obj, UInt_t *stepMask=0x0) const;
+  virtual Int_t CheckParticleCutsCumulative(TObject *obj, UInt_t *stepMask=0x0) const;
+
  private:
   
   //number of steps
@@ -131,6 +140,7 @@ class AliCFManager : public TNamed
   TObjArray **fPartCutList ; //[fNStepPart] arrays of cuts for each particle-selection level
 
   Bool_t CompareStrings(const TString  &cutname,const TString  &selcuts) const;
+  Int_t  CheckCutsCumulative(TObjArray **cutList, Int_t nstep, TObject *obj, UInt_t *stepMask) const;
 
   ClassDef(AliCFManager,2);
 };
@@ -65,6 +65,14 @@
 // If no argument is passed to this function, then the second option   //
 // is used.                                                            //
 //                                                                     //
+// With ::UseCompressedResponse(nThreads) the conditional matrix is    //
+// converted once into a compressed sparse row structure and the       //
+// iterations loop over plain arrays, using nThreads threads. If       //
+// nThreads>1 and no smoothing is used, the unfolding of the           //
+// randomized distributions for the correlated errors is also run      //
+// concurrently. In this case GetInverseResponse() and                 //
+// GetEstMeasured() return the matrices of the nominal unfolding.      //
+//                                                                     //
 // IMPORTANT:                                                          //
 //-----------                                                          //
 // With this approach, the efficiency map must be calculated           //
@@ -92,6 +100,38 @@
 #include "TH2D.h"
 #include "TH3D.h"
 #include "TRandom3.h"
+#include <map>
+#include <thread>
+
+namespace {
+  // calls f(first,last) on nThreads consecutive ranges of [0,n) in parallel
+  template <typename F> void ParallelFor(Int_t nThreads, Long64_t n, F f) {
+    if (nThreads > n) nThreads = n;
+    if (nThreads <= 1) {
+      f(0, n);
+      return;
+    }
+    std::vector<std::thread> threads;
+    Long64_t chunk = (n + nThreads - 1) / nThreads;
+    for (Long64_t first = 0; first < n; first += chunk) threads.emplace_back(f, first, TMath::Min(first + chunk, n));
+    for (UInt_t i = 0; i < threads.size(); i++) threads[i].join();
+  }
+}
+
+//______________________________________________________________
+struct AliCFUnfolding::CompressedState {
+  //
+  // spectra of one unfolding on the compressed response
+  //
+  std::vector<Double_t> fPrior;     // prior, by true bin
+  std::vector<Double_t> fEff;       // efficiency, by true bin
+  std::vector<Double_t> fMeasured;  // measured spectrum, by measured bin
+  std::vector<Double_t> fPriorEff;  // prior times efficiency, by true bin
+  std::vector<Double_t> fEst;       // measured estimate, by measured bin
+  std::vector<Double_t> fInv;       // inverse response, by cell
+  std::vector<Double_t> fUnfolded;  // unfolded spectrum, by true bin
+  std::vector<Char_t>   fFilled;    // unfolded bin filled
+};
 
 
 ClassImp(AliCFUnfolding)
@@ -130,7 +170,20 @@ AliCFUnfolding::AliCFUnfolding() :
   fDeltaUnfoldedP(0x0),
   fDeltaUnfoldedN(0x0),
   fNCalcCorrErrors(0),
-  fRandomSeed(0)
+  fRandomSeed(0),
+  fNThreads(0),
+  fNCompM(0),
+  fNCompT(0),
+  fCompCoordM(),
+  fCompCoordT(),
+  fCompRowStart(),
+  fCompCellM(),
+  fCompCellT(),
+  fCompCond(),
+  fCompBin(),
+  fCompColStart(),
+  fCompColCell(),
+  fCompInv()
 {
   //
   // default constructor
@@ -174,7 +227,20 @@ AliCFUnfolding::AliCFUnfolding(const Char_t* name, const Char_t* title, const In
   fDeltaUnfoldedP(0x0),
   fDeltaUnfoldedN(0x0),
   fNCalcCorrErrors(0),
-  fRandomSeed(randomSeed)
+  fRandomSeed(randomSeed),
+  fNThreads(0),
+  fNCompM(0),
+  fNCompT(0),
+  fCompCoordM(),
+  fCompCoordT(),
+  fCompRowStart(),
+  fCompCellM(),
+  fCompCellT(),
+  fCompCond(),
+  fCompBin(),
+  fCompColStart(),
+  fCompColCell(),
+  fCompInv()
 {
   //
   // named constructor
@@ -353,11 +419,26 @@ void AliCFUnfolding::Unfold() {
   Int_t iIterBayes     = 0 ;
   Double_t convergence = 0.;
 
+  CompressedState state;
+  if (fNThreads > 0) {
+    if (fCompCond.empty()) CreateCompressedResponse();
+    GetCompressedInput(fEfficiency,kTRUE ,state.fEff);
+    GetCompressedInput(fMeasured  ,kFALSE,state.fMeasured);
+    state.fInv = fCompInv;
+  }
+
   for (iIterBayes=0; iIterBayes<fMaxNumIterations; iIterBayes++) { // bayes iterations
 
-    CreateEstMeasured(); // create measured estimate from prior
-    CreateInvResponse(); // create inverse response  from prior
-    CreateUnfolded();    // create unfoled spectrum  from measured and inverse response
+    if (fNThreads > 0) {
+      GetCompressedInput(fPrior,kTRUE,state.fPrior);
+      UnfoldCompressedIteration(state,fNThreads); // same as the 3 steps below
+      SetCompressedOutput(fUnfolded,state.fUnfolded,state.fFilled);
+    }
+    else {
+      CreateEstMeasured(); // create measured estimate from prior
+      CreateInvResponse(); // create inverse response  from prior
+      CreateUnfolded();    // create unfoled spectrum  from measured and inverse response
+    }
 
     convergence = GetConvergence();
     AliDebug(0,Form("convergence at iteration %d is %e",iIterBayes,convergence));
@@ -371,6 +452,7 @@ void AliCFUnfolding::Unfold() {
     if (fUseSmoothing) {
       if (Smooth()) {
 	AliError("Couldn't smooth the unfolded spectrum!!");
+	if (fNThreads > 0) StoreCompressedResponse(state);
 	if (fNCalcCorrErrors>0) {
 	  AliInfo(Form("=======================\nUnfold of randomized distribution finished at iteration %d with convergence %e \n",iIterBayes,convergence));
 	}
@@ -388,6 +470,8 @@ void AliCFUnfolding::Unfold() {
 
   } // end bayes iteration
 
+  if (fNThreads > 0) StoreCompressedResponse(state);
+
   if (fNCalcCorrErrors==0) fUnfoldedFinal = (THnSparse*) fUnfolded->Clone() ;
 
   //
@@ -457,7 +541,8 @@ void AliCFUnfolding::CalculateCorrelatedErrors() {
 
 
   //Do fNRandomIterations = bayes iterations performed
-  for (int i=0; i<fNRandomIterations; i++) {
+  if (fNThreads > 1 && !fUseSmoothing) CalculateCorrelatedErrorsCompressed();
+  else for (int i=0; i<fNRandomIterations; i++) {
     
     // reset prior to original one
     if (fPrior) delete fPrior ;
@@ -504,6 +589,238 @@ void AliCFUnfolding::CalculateCorrelatedErrors() {
   fNCalcCorrErrors = 2;
 }
 
+//______________________________________________________________
+void AliCFUnfolding::CalculateCorrelatedErrorsCompressed() {
+  //
+  // Steps 1-4 of CalculateCorrelatedErrors on the compressed response :
+  // the randomized distributions are created in the same order as in the serial loop,
+  // then unfolded concurrently with fNThreads threads. The delta profile is filled in
+  // the order of the randomized distributions.
+  // fUnfolded and fPrior are left to the ones of the last randomized distribution,
+  // the inverse response and measured estimate to the ones of the nominal unfolding.
+  //
+
+  const Int_t nRandom = fNRandomIterations;
+  std::vector<std::vector<Double_t> > eff(nRandom), measured(nRandom), unfolded(nRandom);
+  std::vector<std::vector<Char_t> > filled(nRandom);
+  std::vector<Double_t> prior;
+  GetCompressedInput(fPriorOrig,kTRUE,prior);
+
+  for (Int_t i=0; i<nRandom; i++) {
+    CreateRandomizedDist();
+
+    if (fResponse) delete fResponse ;
+    fResponse = (THnSparse*) fRandomResponse->Clone();
+    fResponse->SetTitle("Response");
+
+    if (fEfficiency) delete fEfficiency ;
+    fEfficiency = (THnSparse*) fRandomEfficiency->Clone();
+    fEfficiency->SetTitle("Efficiency");
+
+    if (fMeasured)   delete fMeasured   ;
+    fMeasured = (THnSparse*) fRandomMeasured->Clone();
+    fMeasured->SetTitle("Measured");
+
+    GetCompressedInput(fEfficiency,kTRUE ,eff[i]);
+    GetCompressedInput(fMeasured  ,kFALSE,measured[i]);
+  }
+
+  AliInfo(Form("Unfolding %d randomized distributions with %d threads",nRandom,fNThreads));
+  ParallelFor(fNThreads, nRandom, [&](Long64_t first, Long64_t last) {
+    CompressedState state;
+    for (Long64_t i=first; i<last; i++) {
+      state.fEff.swap(eff[i]);
+      state.fMeasured.swap(measured[i]);
+      state.fInv   = fCompInv;
+      state.fPrior = prior;
+      for (Int_t iIterBayes=0; iIterBayes<fMaxNumIterations; iIterBayes++) {
+	UnfoldCompressedIteration(state,1);
+	for (Int_t t=0; t<fNCompT; t++) state.fPrior[t] = state.fFilled[t] ? state.fUnfolded[t] : 0.;
+      }
+      unfolded[i].swap(state.fUnfolded);
+      filled[i].swap(state.fFilled);
+    }
+  });
+
+  for (Int_t i=0; i<nRandom; i++) {
+    SetCompressedOutput(fUnfolded,unfolded[i],filled[i]);
+    FillDeltaUnfoldedProfile();
+  }
+  if (fPrior) delete fPrior ;
+  fPrior = (THnSparse*)fUnfolded->Clone() ;
+  fPrior->SetTitle("Prior");
+}
+
+//______________________________________________________________
+void AliCFUnfolding::CreateCompressedResponse() {
+  //
+  // Converts the conditional matrix into a compressed sparse row structure :
+  // the distinct measured (M) and true (T) bins of the filled cells are numbered,
+  // the cells are sorted by measured bin (rows) and indexed by true bin (columns),
+  // so that the iterations run on arrays without any THnSparse bin lookup
+  //
+
+  const Int_t nVar = fNVariables;
+  Int_t* coord = new Int_t[2*nVar];
+  std::map<Long64_t,Int_t> indexM, indexT;
+  const Long64_t nCells = fConditional->GetNbins();
+  std::vector<Int_t> cellM(nCells), cellT(nCells);
+
+  fCompCoordM.clear();
+  fCompCoordT.clear();
+  for (Long64_t iBin=0; iBin<nCells; iBin++) {
+    fConditional->GetBinContent(iBin,coord);
+    Long64_t keyM = 0, keyT = 0;
+    for (Int_t i=0; i<nVar; i++) {
+      keyM = keyM * (fConditional->GetAxis(i     )->GetNbins()+2) + coord[i];
+      keyT = keyT * (fConditional->GetAxis(i+nVar)->GetNbins()+2) + coord[i+nVar];
+    }
+    std::map<Long64_t,Int_t>::iterator it = indexM.find(keyM);
+    if (it == indexM.end()) {
+      it = indexM.insert(std::make_pair(keyM,(Int_t)indexM.size())).first;
+      fCompCoordM.insert(fCompCoordM.end(),coord,coord+nVar);
+    }
+    cellM[iBin] = it->second;
+    it = indexT.find(keyT);
+    if (it == indexT.end()) {
+      it = indexT.insert(std::make_pair(keyT,(Int_t)indexT.size())).first;
+      fCompCoordT.insert(fCompCoordT.end(),coord+nVar,coord+2*nVar);
+    }
+    cellT[iBin] = it->second;
+  }
+  fNCompM = indexM.size();
+  fNCompT = indexT.size();
+
+  // rows : cells sorted by measured bin
+  fCompRowStart.assign(fNCompM+1,0);
+  for (Long64_t iBin=0; iBin<nCells; iBin++) fCompRowStart[cellM[iBin]+1]++;
+  for (Int_t m=0; m<fNCompM; m++) fCompRowStart[m+1] += fCompRowStart[m];
+  std::vector<Int_t> next(fCompRowStart.begin(),fCompRowStart.end()-1);
+  fCompCellM.resize(nCells);
+  fCompCellT.resize(nCells);
+  fCompCond .resize(nCells);
+  fCompBin  .resize(nCells);
+  fCompInv  .resize(nCells);
+  for (Long64_t iBin=0; iBin<nCells; iBin++) {
+    Int_t k = next[cellM[iBin]]++;
+    fCompCellM[k] = cellM[iBin];
+    fCompCellT[k] = cellT[iBin];
+    fCompCond [k] = fConditional->GetBinContent(iBin,coord);
+    fCompBin  [k] = fInverseResponse->GetBin(coord);
+    fCompInv  [k] = fInverseResponse->GetBinContent(fCompBin[k]);
+  }
+
+  // columns : cells indexed by true bin
+  fCompColStart.assign(fNCompT+1,0);
+  for (Long64_t k=0; k<nCells; k++) fCompColStart[fCompCellT[k]+1]++;
+  for (Int_t t=0; t<fNCompT; t++) fCompColStart[t+1] += fCompColStart[t];
+  next.assign(fCompColStart.begin(),fCompColStart.end()-1);
+  fCompColCell.resize(nCells);
+  for (Long64_t k=0; k<nCells; k++) fCompColCell[next[fCompCellT[k]]++] = k;
+
+  delete [] coord;
+  AliInfo(Form("Compressed response : %lld cells, %d measured bins, %d true bins",nCells,fNCompM,fNCompT));
+}
+
+//______________________________________________________________
+void AliCFUnfolding::GetCompressedInput(const THnSparse* hist, Bool_t trueBins, std::vector<Double_t> &values) const {
+  //
+  // fills values with the content of hist in the true (or measured) bins of the compressed response
+  //
+  const Int_t n = trueBins ? fNCompT : fNCompM;
+  const Int_t* coord = trueBins ? fCompCoordT.data() : fCompCoordM.data();
+  values.resize(n);
+  for (Int_t i=0; i<n; i++) values[i] = hist->GetBinContent(coord+i*fNVariables);
+}
+
+//______________________________________________________________
+void AliCFUnfolding::SetCompressedOutput(THnSparse* hist, const std::vector<Double_t> &values, const std::vector<Char_t> &filled) const {
+  //
+  // stores the unfolded spectrum values (by true bin) in hist, as CreateUnfolded does
+  //
+  hist->Reset();
+  for (Int_t t=0; t<fNCompT; t++) {
+    if (!filled[t]) continue;
+    const Int_t* coord = &fCompCoordT[t*fNVariables];
+    hist->SetBinError  (coord,0.);
+    hist->AddBinContent(coord,values[t]);
+  }
+}
+
+//______________________________________________________________
+void AliCFUnfolding::StoreCompressedResponse(const CompressedState &state) {
+  //
+  // stores the inverse response and the measured estimate of the compressed unfolding
+  // in fInverseResponse and fMeasuredEstimate
+  //
+  fCompInv = state.fInv;
+  for (UInt_t k=0; k<fCompInv.size(); k++) {
+    if (fCompInv[k]>0. || fInverseResponse->GetBinContent(fCompBin[k])>0.) {
+      fInverseResponse->SetBinContent(fCompBin[k],fCompInv[k]);
+      fInverseResponse->SetBinError2 (fCompBin[k],0.);
+    }
+  }
+  fMeasuredEstimate->Reset();
+  for (Int_t m=0; m<fNCompM; m++) {
+    if (!(state.fEst[m]>0.)) continue;
+    const Int_t* coord = &fCompCoordM[m*fNVariables];
+    fMeasuredEstimate->AddBinContent(coord,state.fEst[m]);
+    fMeasuredEstimate->SetBinError(coord,0.);
+  }
+}
+
+//______________________________________________________________
+void AliCFUnfolding::UnfoldCompressedIteration(CompressedState &state, Int_t nThreads) const {
+  //
+  // one bayes iteration on the compressed response, equivalent to
+  // CreateEstMeasured(), CreateInvResponse() and CreateUnfolded().
+  // The folding and the inverse response are computed in parallel over the
+  // measured bins, the unfolded spectrum in parallel over the true bins.
+  //
+  state.fPriorEff.resize(fNCompT);
+  state.fEst     .resize(fNCompM);
+  state.fUnfolded.resize(fNCompT);
+  state.fFilled  .resize(fNCompT);
+  for (Int_t t=0; t<fNCompT; t++) state.fPriorEff[t] = state.fPrior[t] * state.fEff[t];
+
+  // M(i) = SUM_k { COND(i,k) * T(k) * E(k) } and INV(i,j) = COND(i,j) * T(j) * E(j) / M(i)
+  ParallelFor(nThreads, fNCompM, [&](Long64_t first, Long64_t last) {
+    for (Long64_t m=first; m<last; m++) {
+      Double_t est = 0.;
+      for (Int_t k=fCompRowStart[m]; k<fCompRowStart[m+1]; k++) {
+	Double_t fill = fCompCond[k] * state.fPriorEff[fCompCellT[k]];
+	if (fill>0.) est += fill;
+      }
+      state.fEst[m] = est;
+      for (Int_t k=fCompRowStart[m]; k<fCompRowStart[m+1]; k++) {
+	Double_t fill = (est>0. ? fCompCond[k] * state.fPriorEff[fCompCellT[k]] / est : 0.);
+	if (fill>0. || state.fInv[k]>0.) state.fInv[k] = fill;
+      }
+    }
+  });
+
+  // T(i) = SUM_k { INV(i,k) * M(k) } / E(i)
+  ParallelFor(nThreads, fNCompT, [&](Long64_t first, Long64_t last) {
+    for (Long64_t t=first; t<last; t++) {
+      Double_t unfolded = 0.;
+      Char_t filled = 0;
+      Double_t eff = state.fEff[t];
+      if (eff>0.) {
+	for (Int_t j=fCompColStart[t]; j<fCompColStart[t+1]; j++) {
+	  Int_t k = fCompColCell[j];
+	  Double_t fill = state.fInv[k] * state.fMeasured[fCompCellM[k]] / eff;
+	  if (fill>0.) {
+	    unfolded += fill;
+	    filled = 1;
+	  }
+	}
+      }
+      state.fUnfolded[t] = unfolded;
+      state.fFilled[t]   = filled;
+    }
+  });
+}
+
 //______________________________________________________________
 void AliCFUnfolding::CreateRandomizedDist() {
   //
@@ -10,6 +10,7 @@
 // Author : renaud.vernet@cern.ch                                     //
 //--------------------------------------------------------------------//
 
+#include <vector>
 #include "TNamed.h"
 #include "THnSparse.h"
 #include "AliLog.h"
@@ -43,6 +44,10 @@ class AliCFUnfolding : public TNamed {
     fSmoothOption=opt;
   } 
                                                                                                 
+  void UseCompressedResponse(Int_t nThreads=1) { // the iterations are done on a compressed copy of the conditional matrix
+    fNThreads = nThreads;                         // with nThreads threads (0 switches back to the THnSparse loops)
+  }
+
   void Unfold();
 
   const THnSparse* GetResponse()             const {return fResponseOrig;}
@@ -112,6 +117,22 @@ class AliCFUnfolding : public TNamed {
   Short_t        fNCalcCorrErrors;   // Book-keeping to prevend infinite loop
   UInt_t         fRandomSeed;        // Random seed
 
+  /* compressed response */
+  struct CompressedState;
+  Int_t                 fNThreads;        // Number of threads used with the compressed response (0 : use the THnSparse loops)
+  Int_t                 fNCompM;          //! Number of measured bins of the compressed response
+  Int_t                 fNCompT;          //! Number of true bins of the compressed response
+  std::vector<Int_t>    fCompCoordM;      //! Coordinates of the measured bins (fNVariables per bin)
+  std::vector<Int_t>    fCompCoordT;      //! Coordinates of the true bins (fNVariables per bin)
+  std::vector<Int_t>    fCompRowStart;    //! First cell of each measured bin (cells are sorted by measured bin)
+  std::vector<Int_t>    fCompCellM;       //! Measured bin of each cell
+  std::vector<Int_t>    fCompCellT;       //! True bin of each cell
+  std::vector<Double_t> fCompCond;        //! Conditional probability of each cell
+  std::vector<Long64_t> fCompBin;         //! Index of each cell in fConditional and fInverseResponse
+  std::vector<Int_t>    fCompColStart;    //! First entry in fCompColCell of each true bin
+  std::vector<Int_t>    fCompColCell;     //! Cells sorted by true bin
+  std::vector<Double_t> fCompInv;         //! Inverse response of each cell
+
 
   // functions
   void     Init();                  // initialisation of the internal settings
@@ -131,8 +152,15 @@ class AliCFUnfolding : public TNamed {
   void     CreateRandomizedDist();      // Create randomized dist from measured distribution
   void     FillDeltaUnfoldedProfile();  // Fills the fDeltaUnfoldedP profile
   void     SetMaxConvergencePerDOF (Double_t val);
-
-  ClassDef(AliCFUnfolding,1);
+  /* compressed response */
+  void     CreateCompressedResponse();  // converts the conditional matrix into a compressed sparse row structure
+  void     GetCompressedInput(const THnSparse* hist, Bool_t trueBins, std::vector<Double_t> &values) const; // values of hist in the compressed bins
+  void     SetCompressedOutput(THnSparse* hist, const std::vector<Double_t> &values, const std::vector<Char_t> &filled) const; // stores an unfolded spectrum in hist
+  void     StoreCompressedResponse(const CompressedState &state); // stores inverse response and measured estimate
+  void     UnfoldCompressedIteration(CompressedState &state, Int_t nThreads) const; // one iteration on the compressed response
+  void     CalculateCorrelatedErrorsCompressed(); // unfolds the randomized distributions concurrently
+
+  ClassDef(AliCFUnfolding,2);
 };
 
 #endif
@@ -30,6 +30,7 @@
 #include "TEveProjectionAxes.h"
 #include "TGLWidget.h"
 #include "TStopwatch.h"
+#include "TTree.h"
 
 //______________________________________________________________________________
 // This class provides the following features:
@@ -47,6 +48,13 @@
 // 4) Possibility to use AliPhysicsSelection during the all events histograms creation.
 // It is also possible to switch between real data and simulation data (MC).
 //
+// The tracks of an event are binned once, for all tracks and for the primary
+// tracks, and kept per event. The all events histograms are the sum of the
+// cached events, updated by adding / subtracting single events when the
+// collision candidate selection changes, and pT maximum and particle type
+// filters are applied on the sums, so changing a selection does not read
+// the ESD tree again.
+//
 
 ClassImp(AliEveLego)
 Double_t kPi = TMath::Pi();
@@ -99,7 +107,17 @@ AliEveLego::AliEveLego(const char* name) :
   fAl(0),
   fHisto2dLegoOverlay(0),
   fHisto2dAllEventsLegoOverlay(0),
-  fHisto2dAllEventsSlot(0)
+  fHisto2dAllEventsSlot(0),
+  fEventBins(),
+  fCurrentEventBins(),
+  fCurrentEventEntry(-1),
+  fCurrentSum(),
+  fSumAllEvents(),
+  fSumTracksMode(-1),
+  fSumCandidatesOnly(kFALSE),
+  fCandidatesValid(kFALSE),
+  fScratch(),
+  fScratchCells()
 {
   // Constructor.
   gEve->AddToListTree(this,0);
@@ -251,203 +269,169 @@ namespace
 }
 
 //______________________________________________________________________________
-TEveCaloDataHist* AliEveLego::LoadData()
+void AliEveLego::BinEvent(EventBins_t &bins)
 {
-   // Load data from ESD tree
-   fHistopos->Reset();
-   fHistoneg->Reset();
-   fHistoElectrons->Reset();
-   fHistoMuons->Reset();
-   fHistoPions->Reset();
-   fHistoKaons->Reset();
-   fHistoProtons->Reset();
-
-   // Getting current tracks, filling histograms
-   for (int n = 0; n < fEsd->GetNumberOfTracks(); ++n) {
-
-     AliESDtrack *track = fEsd->GetTrack(n);
-     const Double_t sign = fEsd->GetTrack(n)->GetSign();
-     const Int_t prob = GetParticleType(track);     
-
-     // Filling histograms
-     if (sign > 0)
-       fHistopos->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
-
-     if (sign < 0)
-       fHistoneg->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
-
-     if (prob == 0)
-       fHistoElectrons->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
+   // Bin the tracks of the current ESD event, for all tracks and for primary tracks
+   // Slices: 0 positive, 1 negative, 2-6 electrons, muons, pions, kaons, protons
+   const Int_t ncells = fHistopos->GetNcells();
+   if ((Int_t) fScratch.size() != 7 * ncells) fScratch.assign(7 * ncells, 0.);
 
-     if (prob == 1)
-       fHistoMuons->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
-
-     if (prob == 2)
-       fHistoPions->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
-
-     if (prob == 3)
-       fHistoKaons->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
+   const AliESDVertex *pv = fEsd->GetPrimaryVertex();
+   for (Int_t mode = 0; mode < 2; mode++)
+   {
+      const Int_t ntracks = (mode == 0) ? fEsd->GetNumberOfTracks() : pv->GetNIndices();
+      for (Int_t n = 0; n < ntracks; n++)
+      {
+         AliESDtrack *track = fEsd->GetTrack((mode == 0) ? n : pv->GetIndices()[n]);
+         const Double_t sign = track->GetSign();
+         const Int_t prob = GetParticleType(track);
+         const Int_t bin = fHistopos->FindBin(track->Eta(), getphi(track->Phi()));
+         const Double_t pt = fabs(track->Pt());
+
+         Int_t slices[2] = { -1, 2 + prob };
+         if (sign > 0) slices[0] = 0;
+         if (sign < 0) slices[0] = 1;
+
+         for (Int_t i = 0; i < 2; i++)
+         {
+           if (slices[i] < 0) continue;
+           const Int_t cell = slices[i] * ncells + bin;
+           if (fScratch[cell] == 0) fScratchCells.push_back(cell);
+           fScratch[cell] += pt;
+         }
+      }
 
-     if (prob == 4)
-       fHistoProtons->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
+      // Keep the non-empty cells only
+      bins.fCells[mode].clear();
+      bins.fWeights[mode].clear();
+      for (UInt_t i = 0; i < fScratchCells.size(); i++)
+      {
+         const Int_t cell = fScratchCells[i];
+         if (fScratch[cell] != 0) {
+           bins.fCells[mode].push_back(cell);
+           bins.fWeights[mode].push_back(fScratch[cell]);
+         }
+         fScratch[cell] = 0;
+      }
+      fScratchCells.clear();
    }
+   bins.fIsCandidate = kTRUE;
+}
 
-   fData->DataChanged();
+//______________________________________________________________________________
+void AliEveLego::AddEventBins(const EventBins_t &bins, Int_t mode, Double_t scale, std::vector<Double_t> &sum) const
+{
+   // Add (scale 1) or subtract (scale -1) the binned content of one event
+   for (UInt_t i = 0; i < bins.fCells[mode].size(); i++)
+     sum[bins.fCells[mode][i]] += scale * bins.fWeights[mode][i];
+}
 
-   FilterData();
+//______________________________________________________________________________
+void AliEveLego::FillHistograms(TH2F **histos, const std::vector<Double_t> &sum, Float_t maxPt, const Bool_t *types) const
+{
+   // Fill the displayed histograms from the summed content,
+   // applying the maximum pT and the particle type selection
+   const Int_t ncells = histos[0]->GetNcells();
+   for (Int_t slice = 0; slice < 7; slice++)
+   {
+      histos[slice]->Reset();
+      if (types[slice] == kFALSE) continue;
 
-   return fData;
+      for (Int_t bin = 0; bin < ncells; bin++)
+      {
+         Double_t content = sum[slice * ncells + bin];
+         // Leftovers of subtracted events
+         if (fabs(content) < 1e-6) continue;
+         if (content >= maxPt) content = maxPt;
+         histos[slice]->SetBinContent(bin, content);
+      }
+   }
 }
 
 //______________________________________________________________________________
-TEveCaloDataHist* AliEveLego::LoadAllData()
+Bool_t AliEveLego::LoadEventBins(Bool_t reload)
 {
-   // Load data from all events ESD
-   fHistoposAllEvents->Reset();
-   fHistonegAllEvents->Reset();
-   fHistoElectronsAllEvents->Reset();
-   fHistoMuonsAllEvents->Reset();
-   fHistoPionsAllEvents->Reset();
-   fHistoKaonsAllEvents->Reset();
-   fHistoProtonsAllEvents->Reset();
+   // Bin all events of the ESD tree, unless already done
+   if (!reload && !fEventBins.empty()) return kTRUE;
 
    TTree* t = AliEveEventManager::GetMaster()->GetESDTree();
+   if (!t) return kFALSE;
 
-   // Getting current tracks for each event, filling histograms
-   Int_t fAcceptedEvents = 0;
+   fEventBins.assign(t->GetEntries(), EventBins_t());
    for (int event = 0; event < t->GetEntries(); event++) {
       t->GetEntry(event);
-
-      if (fCollisionCandidatesOnly == kTRUE)
-        if (fPhysicsSelection->IsCollisionCandidate(fEsd) == kFALSE) continue;
-
-      fAcceptedEvents++;
-
-      for (int n = 0; n < fEsd->GetNumberOfTracks(); ++n) {
-
-           AliESDtrack *track = fEsd->GetTrack(n);
-           const Double_t sign = track->GetSign();
-           const Int_t prob = GetParticleType(track);
-
-           if (sign > 0)
-             fHistoposAllEvents->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
-
-           if (sign < 0)
-             fHistonegAllEvents->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
-
-           if (prob == 0)
-             fHistoElectronsAllEvents->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
-
-           if (prob == 1)
-             fHistoMuonsAllEvents->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
-
-           if (prob == 2)
-             fHistoPionsAllEvents->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
-
-           if (prob == 3)
-             fHistoKaonsAllEvents->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
-
-           if (prob == 4)
-             fHistoProtonsAllEvents->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
-        }
+      BinEvent(fEventBins[event]);
    }
 
    // Setting the current view to the first event
    t->GetEntry(0);
 
-   // Usefull information,
-   // with this we can estimate the event efficiency
-   printf("Number of events loaded: %i, with AliPhysicsSelection: %i\n",fAcceptedEvents,fCollisionCandidatesOnly);
-
-   fDataAllEvents->DataChanged();
-
-   return fDataAllEvents;
+   fCandidatesValid = kFALSE;
+   fSumTracksMode = -1;
+   return kTRUE;
 }
 
 //______________________________________________________________________________
-TEveCaloDataHist* AliEveLego::FilterData()
+void AliEveLego::UpdateCandidateFlags()
 {
-   // Tracks selection
-   if ( fTracksId == 2 )
-   {
-      fHistopos->Reset();
-      fHistoneg->Reset();
-      fHistoElectrons->Reset();
-      fHistoMuons->Reset();
-      fHistoPions->Reset();
-      fHistoKaons->Reset();
-      fHistoProtons->Reset();
-
-      const AliESDVertex *pv  = fEsd->GetPrimaryVertex();
-
-      for (Int_t n = 0; n < pv->GetNIndices(); n++ )
-      {
-         AliESDtrack *at = fEsd->GetTrack(pv->GetIndices()[n]);
-         const Double_t sign = at->GetSign();
-         const Int_t prob = GetParticleType(at);
-
-         if (sign > 0)
-           fHistopos->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-
-         if (sign < 0)
-           fHistoneg->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-
-         if (prob == 0)
-           fHistoElectrons->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-
-         if (prob == 1)
-           fHistoMuons->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-
-         if (prob == 2)
-           fHistoPions->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-
-         if (prob == 3)
-           fHistoKaons->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
+   // Evaluate the physics selection for all cached events
+   TTree* t = AliEveEventManager::GetMaster()->GetESDTree();
+   if (!t) return;
 
-         if (prob == 4)
-           fHistoProtons->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-      }
+   for (int event = 0; event < t->GetEntries() && event < (int) fEventBins.size(); event++) {
+      t->GetEntry(event);
+      fEventBins[event].fIsCandidate = fPhysicsSelection->IsCollisionCandidate(fEsd);
    }
+   t->GetEntry(0);
 
-   fData->DataChanged();
+   fCandidatesValid = kTRUE;
+}
 
-   // Max Pt threshold
-   if (GetPtMax() >= fMaxPt){
-      for (Int_t binx = 1; binx <= 100; binx++) {
-         for (Int_t biny = 1; biny <= 80; biny++) {
+//______________________________________________________________________________
+TEveCaloDataHist* AliEveLego::LoadData()
+{
+   // Load data from ESD tree
+   TTree* t = AliEveEventManager::GetMaster()->GetESDTree();
+   const Long64_t entry = t ? t->GetReadEntry() : -1;
+
+   // Bin the current event unless it is cached
+   if (entry < 0 || entry != fCurrentEventEntry) {
+      if (entry >= 0 && entry < (Long64_t) fEventBins.size())
+        fCurrentEventBins = fEventBins[entry];
+      else
+        BinEvent(fCurrentEventBins);
+      fCurrentEventEntry = entry;
+   }
 
-           if (fHistopos->GetBinContent(binx, biny) >= fMaxPt)
-             fHistopos->SetBinContent(binx, biny, fMaxPt);
+   FilterData();
 
-           if (fHistoneg->GetBinContent(binx, biny) >= fMaxPt)
-             fHistoneg->SetBinContent(binx, biny, fMaxPt);
+   return fData;
+}
 
-           if (fHistoElectrons->GetBinContent(binx, biny) >= fMaxPt)
-             fHistoElectrons->SetBinContent(binx, biny, fMaxPt);
+//______________________________________________________________________________
+TEveCaloDataHist* AliEveLego::LoadAllData()
+{
+   // Load data from all events ESD
+   if (!LoadEventBins(kTRUE)) return fDataAllEvents;
 
-           if (fHistoMuons->GetBinContent(binx, biny) >= fMaxPt)
-             fHistoMuons->SetBinContent(binx, biny, fMaxPt);
+   FilterAllData();
 
-           if (fHistoPions->GetBinContent(binx, biny) >= fMaxPt)
-             fHistoPions->SetBinContent(binx, biny, fMaxPt);
+   return fDataAllEvents;
+}
 
-           if (fHistoKaons->GetBinContent(binx, biny) >= fMaxPt)
-             fHistoKaons->SetBinContent(binx, biny, fMaxPt);
+//______________________________________________________________________________
+TEveCaloDataHist* AliEveLego::FilterData()
+{
+   // Tracks selection
+   const Int_t mode = (fTracksId == 2) ? 1 : 0;
 
-           if (fHistoProtons->GetBinContent(binx, biny) >= fMaxPt)
-             fHistoProtons->SetBinContent(binx, biny, fMaxPt);
-         }
-      }
-   }
+   fCurrentSum.assign(7 * fHistopos->GetNcells(), 0.);
+   AddEventBins(fCurrentEventBins, mode, 1., fCurrentSum);
 
-   // Particle type filter
-   if ( fParticleTypeId[0] == kFALSE) fHistopos->Reset();
-   if ( fParticleTypeId[1] == kFALSE) fHistoneg->Reset();
-   if ( fParticleTypeId[2] == kFALSE) fHistoElectrons->Reset();
-   if ( fParticleTypeId[3] == kFALSE) fHistoMuons->Reset();
-   if ( fParticleTypeId[4] == kFALSE) fHistoPions->Reset();
-   if ( fParticleTypeId[5] == kFALSE) fHistoKaons->Reset();
-   if ( fParticleTypeId[6] == kFALSE) fHistoProtons->Reset();
+   // Max Pt threshold and particle type filter
+   TH2F *histos[7] = { fHistopos, fHistoneg, fHistoElectrons, fHistoMuons,
+                       fHistoPions, fHistoKaons, fHistoProtons };
+   FillHistograms(histos, fCurrentSum, fMaxPt, fParticleTypeId);
 
    fData->DataChanged();
 
@@ -458,106 +442,49 @@ TEveCaloDataHist* AliEveLego::FilterData()
 TEveCaloDataHist* AliEveLego::FilterAllData()
 {
    // Tracks selection
-   if ( fTracksIdAE == 2 )
-   {
-      fHistoposAllEvents->Reset();
-      fHistonegAllEvents->Reset();
-      fHistoElectronsAllEvents->Reset();
-      fHistoMuonsAllEvents->Reset();
-      fHistoPionsAllEvents->Reset();
-      fHistoKaonsAllEvents->Reset();
-      fHistoProtonsAllEvents->Reset();
-
-      TTree* t = AliEveEventManager::GetMaster()->GetESDTree();
-
-      // Getting current tracks for each event, filling histograms
-      Int_t fAcceptedEvents = 0;
-      for (int event = 0; event < t->GetEntries(); event++) {
-
-        t->GetEntry(event);
-        const AliESDVertex *pv  = fEsd->GetPrimaryVertex();
+   if (!LoadEventBins()) return fDataAllEvents;
 
-        if (fCollisionCandidatesOnly == kTRUE)
-          if (fPhysicsSelection->IsCollisionCandidate(fEsd) == kFALSE) continue;
-
-        fAcceptedEvents++;
-
-        for (Int_t n = 0; n < pv->GetNIndices(); n++ )
-        {
-          AliESDtrack *at = fEsd->GetTrack(pv->GetIndices()[n]);
-          const Double_t sign = at->GetSign();
-          const Int_t prob = GetParticleType(at);
-
-          if (sign > 0)
-            fHistoposAllEvents->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-
-          if (sign < 0)
-            fHistonegAllEvents->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-
-          if (prob == 0)
-            fHistoElectronsAllEvents->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-
-          if (prob == 1)
-            fHistoMuonsAllEvents->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-
-          if (prob == 2)
-            fHistoPionsAllEvents->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
+   if (fCollisionCandidatesOnly == kTRUE && fCandidatesValid == kFALSE)
+   {
+     UpdateCandidateFlags();
+     // Flags may have changed, sum again
+     fSumTracksMode = -1;
+   }
 
-          if (prob == 3)
-            fHistoKaonsAllEvents->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
+   const Int_t mode = (fTracksIdAE == 2) ? 1 : 0;
+   const Int_t ncells = fHistoposAllEvents->GetNcells();
 
-          if (prob == 4)
-            fHistoProtonsAllEvents->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-        }
+   if (fSumTracksMode != mode)
+   {
+      // Sum of all accepted events
+      fSumAllEvents.assign(7 * ncells, 0.);
+      for (UInt_t event = 0; event < fEventBins.size(); event++)
+      {
+        if (fCollisionCandidatesOnly == kTRUE && fEventBins[event].fIsCandidate == kFALSE) continue;
+        AddEventBins(fEventBins[event], mode, 1., fSumAllEvents);
       }
-      t->GetEntry(0);
-      printf("Number of events loaded: %i, with AliPhysicsSelection: %i\n",fAcceptedEvents,fCollisionCandidatesOnly);
-
-   } else {
-
-      LoadAllData();
-
-    }
-   
-   fDataAllEvents->DataChanged();
-
-   // Max Pt threshold
-   if (GetPtMaxAE() >= fMaxPtAE){
-      for (Int_t binx = 1; binx <= 100; binx++) {
-         for (Int_t biny = 1; biny <= 80; biny++) {
-
-            if (fHistoposAllEvents->GetBinContent(binx, biny) >= fMaxPtAE)            
-              fHistoposAllEvents->SetBinContent(binx, biny, fMaxPtAE);
-
-            if (fHistonegAllEvents->GetBinContent(binx, biny) >= fMaxPtAE)            
-              fHistonegAllEvents->SetBinContent(binx, biny, fMaxPtAE);
-
-            if (fHistoElectronsAllEvents->GetBinContent(binx, biny) >= fMaxPt)
-              fHistoElectronsAllEvents->SetBinContent(binx, biny, fMaxPt);
-
-            if (fHistoMuonsAllEvents->GetBinContent(binx, biny) >= fMaxPt)
-              fHistoMuonsAllEvents->SetBinContent(binx, biny, fMaxPt);
-
-            if (fHistoPionsAllEvents->GetBinContent(binx, biny) >= fMaxPt)
-              fHistoPionsAllEvents->SetBinContent(binx, biny, fMaxPt);
-
-            if (fHistoKaonsAllEvents->GetBinContent(binx, biny) >= fMaxPt)
-              fHistoKaonsAllEvents->SetBinContent(binx, biny, fMaxPt);
-
-            if (fHistoProtonsAllEvents->GetBinContent(binx, biny) >= fMaxPt)
-              fHistoProtonsAllEvents->SetBinContent(binx, biny, fMaxPt);
-         }
+   } else if (fSumCandidatesOnly != fCollisionCandidatesOnly) {
+      // Only the events which are no collision candidates change
+      for (UInt_t event = 0; event < fEventBins.size(); event++)
+      {
+        if (fEventBins[event].fIsCandidate == kTRUE) continue;
+        AddEventBins(fEventBins[event], mode, fCollisionCandidatesOnly ? -1. : 1., fSumAllEvents);
       }
    }
+   fSumTracksMode = mode;
+   fSumCandidatesOnly = fCollisionCandidatesOnly;
+
+   // Usefull information,
+   // with this we can estimate the event efficiency
+   Int_t fAcceptedEvents = 0;
+   for (UInt_t event = 0; event < fEventBins.size(); event++)
+     if (fCollisionCandidatesOnly == kFALSE || fEventBins[event].fIsCandidate == kTRUE) fAcceptedEvents++;
+   printf("Number of events loaded: %i, with AliPhysicsSelection: %i\n",fAcceptedEvents,fCollisionCandidatesOnly);
 
-   // Particles species and charges filter
-   if ( fParticleTypeIdAE[0] == kFALSE ) fHistoposAllEvents->Reset();
-   if ( fParticleTypeIdAE[1] == kFALSE ) fHistonegAllEvents->Reset();
-   if ( fParticleTypeIdAE[2] == kFALSE ) fHistoElectronsAllEvents->Reset();
-   if ( fParticleTypeIdAE[3] == kFALSE ) fHistoMuonsAllEvents->Reset();
-   if ( fParticleTypeIdAE[4] == kFALSE ) fHistoPionsAllEvents->Reset();
-   if ( fParticleTypeIdAE[5] == kFALSE ) fHistoKaonsAllEvents->Reset();
-   if ( fParticleTypeIdAE[6] == kFALSE ) fHistoProtonsAllEvents->Reset();
+   // Max Pt threshold and particles species and charges filter
+   TH2F *histos[7] = { fHistoposAllEvents, fHistonegAllEvents, fHistoElectronsAllEvents, fHistoMuonsAllEvents,
+                       fHistoPionsAllEvents, fHistoKaonsAllEvents, fHistoProtonsAllEvents };
+   FillHistograms(histos, fSumAllEvents, fMaxPtAE, fParticleTypeIdAE);
 
    fDataAllEvents->DataChanged();
 
@@ -955,6 +882,7 @@ void AliEveLego::SwitchDataType(Bool_t status)
   fPhysicsSelection = new AliPhysicsSelection();
   fPhysicsSelection->SetAnalyzeMC(fIsMC);
   fPhysicsSelection->Initialize(fEsd);
+  fCandidatesValid = kFALSE;
   FilterAllData();
 }
 
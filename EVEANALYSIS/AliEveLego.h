@@ -10,6 +10,8 @@
 #ifndef ALIEVELEGO_H
 #define ALIEVELEGO_H
 
+#include <vector>
+
 #include "TEveElement.h"
 
 class AliESDEvent;
@@ -32,6 +34,9 @@ class TH2F;
 //______________________________________________________________________________
 // 2D & 3D calorimeter like histograms from the ESD data.
 //
+// The eta-phi binned content of each event is cached, the histograms shown
+// are derived from the cache when the selection changes.
+//
 
 class AliEveLego : public TEveElementList
 {
@@ -81,6 +86,20 @@ public:
 
 
 private:
+  // Binned content of one event, non-empty cells only
+  struct EventBins_t
+  {
+    std::vector<Int_t>   fCells[2];    // slice * number of cells + global bin, all tracks / primary tracks
+    std::vector<Float_t> fWeights[2];  // summed pT in the cell
+    Bool_t               fIsCandidate; // collision candidate, valid if fCandidatesValid
+  };
+
+  void    BinEvent(EventBins_t &bins);
+  void    AddEventBins(const EventBins_t &bins, Int_t mode, Double_t scale, std::vector<Double_t> &sum) const;
+  void    FillHistograms(TH2F **histos, const std::vector<Double_t> &sum, Float_t maxPt, const Bool_t *types) const;
+  Bool_t  LoadEventBins(Bool_t reload = kFALSE);
+  void    UpdateCandidateFlags();
+
   Bool_t              fIsMC;                    // Switch to MC mode for AliPhysicsSelection
   Bool_t              fCollisionCandidatesOnly; // Activate flag when loading all events
   Bool_t              *fParticleTypeId;         // Determine how particles to show
@@ -127,6 +146,16 @@ private:
   TEveCaloLegoOverlay *fHisto2dLegoOverlay;     // Overlay for calo lego
   TEveCaloLegoOverlay *fHisto2dAllEventsLegoOverlay; // Overlay for calo lego all events
   TEveWindowSlot      *fHisto2dAllEventsSlot;   // Window slot for 2d all events histogram
+  std::vector<EventBins_t> fEventBins;          //! Binned content of all events of the ESD tree
+  EventBins_t         fCurrentEventBins;        //! Binned content of the displayed event
+  Long64_t            fCurrentEventEntry;       //! Tree entry of fCurrentEventBins (-1: none)
+  std::vector<Double_t> fCurrentSum;            //! Content of the displayed event before pT and type filters
+  std::vector<Double_t> fSumAllEvents;          //! Content of the accepted events before pT and type filters
+  Int_t               fSumTracksMode;           //! Track selection of fSumAllEvents (0 all, 1 primary, -1 not filled)
+  Bool_t              fSumCandidatesOnly;       //! Collision candidate selection of fSumAllEvents
+  Bool_t              fCandidatesValid;         //! Collision candidate flags of fEventBins up to date
+  std::vector<Double_t> fScratch;               //! Dense buffer for binning one event
+  std::vector<Int_t>  fScratchCells;            //! Cells touched in fScratch
 
   AliEveLego(const AliEveLego&);                // Not implemented
   AliEveLego& operator=(const AliEveLego&);     // Not implemented
@@ -0,0 +1,166 @@
+//
+// Class AliMixCompactPool
+//
+// AliMixCompactPool keeps compact records of the selected tracks
+// of the last events of each mixing bin
+//
+
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <TMath.h>
+
+#include "AliLog.h"
+#include "AliVEvent.h"
+#include "AliVTrack.h"
+#include "AliVVertex.h"
+#include "AliAODTrack.h"
+
+#include "AliMixCompactPool.h"
+
+ClassImp(AliMixCompactPool)
+
+//_________________________________________________________________________________________________
+AliMixCompactPool::AliMixCompactPool(const char *name, const char *title) : TNamed(name, title),
+   fDepth(10),
+   fMaxTracks(4000),
+   fFilterMask(0),
+   fMinPt(0.0),
+   fMaxEta(10.0),
+   fMappedFile(),
+   fNBins(0),
+   fSlotSize(0),
+   fMappedSize(0),
+   fStorage(0),
+   fFd(-1),
+   fHead(),
+   fCount()
+{
+   //
+   // Default constructor.
+   //
+}
+
+//_________________________________________________________________________________________________
+AliMixCompactPool::~AliMixCompactPool()
+{
+   //
+   // Destructor
+   //
+   Unmap();
+}
+
+//_________________________________________________________________________________________________
+Bool_t AliMixCompactPool::Init(Int_t nBins)
+{
+   //
+   // Maps storage for nBins rings of fDepth slots
+   //
+   Unmap();
+   if (nBins < 1 || fDepth < 1 || fMaxTracks < 1) {
+      AliError(Form("Wrong configuration: bins=%d depth=%d maxTracks=%d", nBins, fDepth, fMaxTracks));
+      return kFALSE;
+   }
+
+   fNBins = nBins;
+   fSlotSize = sizeof(AliMixCompactEvent) + (Long64_t) fMaxTracks * sizeof(AliMixCompactTrack);
+   fSlotSize = (fSlotSize + 7) / 8 * 8;
+   fMappedSize = fSlotSize * fDepth * fNBins;
+
+   void *storage = MAP_FAILED;
+   if (fMappedFile.IsNull()) {
+      storage = mmap(0, fMappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+   } else {
+      fFd = open(fMappedFile.Data(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+      if (fFd >= 0 && ftruncate(fFd, fMappedSize) == 0)
+         storage = mmap(0, fMappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fFd, 0);
+   }
+   if (storage == MAP_FAILED) {
+      AliError(Form("Cannot map %lld bytes for %d bins (%s)", fMappedSize, fNBins, fMappedFile.IsNull() ? "anonymous" : fMappedFile.Data()));
+      if (fFd >= 0) close(fFd);
+      fFd = -1;
+      fNBins = 0;
+      return kFALSE;
+   }
+   fStorage = (Char_t *) storage;
+   fHead.assign(fNBins, 0);
+   fCount.assign(fNBins, 0);
+   AliInfo(Form("Mapped %lld bytes for %d bins x %d events", fMappedSize, fNBins, fDepth));
+   return kTRUE;
+}
+
+//_________________________________________________________________________________________________
+void AliMixCompactPool::Unmap()
+{
+   //
+   // Releases storage
+   //
+   if (fStorage) munmap(fStorage, fMappedSize);
+   if (fFd >= 0) {
+      close(fFd);
+      unlink(fMappedFile.Data());
+   }
+   fStorage = 0;
+   fFd = -1;
+   fNBins = 0;
+   fHead.clear();
+   fCount.clear();
+}
+
+//_________________________________________________________________________________________________
+void AliMixCompactPool::Store(Int_t bin, AliVEvent *ev, Long64_t entry)
+{
+   //
+   // Stores selected tracks of event in ring of bin (overwrites oldest event)
+   //
+   if (!fStorage || !ev || bin < 0 || bin >= fNBins) return;
+
+   AliMixCompactEvent *slot = GetSlot(bin, fHead[bin]);
+   AliMixCompactTrack *tracks = reinterpret_cast<AliMixCompactTrack *>(slot + 1);
+   slot->fEntry = entry;
+   slot->fNTracks = 0;
+   slot->fNTracksAll = 0;
+   slot->fMagField = ev->GetMagneticField();
+   const AliVVertex *vtx = ev->GetPrimaryVertex();
+   slot->fVertex[0] = vtx ? vtx->GetX() : 0;
+   slot->fVertex[1] = vtx ? vtx->GetY() : 0;
+   slot->fVertex[2] = vtx ? vtx->GetZ() : 0;
+
+   Int_t nTracks = ev->GetNumberOfTracks();
+   for (Int_t i = 0; i < nTracks; i++) {
+      AliVTrack *track = dynamic_cast<AliVTrack *>(ev->GetTrack(i));
+      if (!track) continue;
+      AliAODTrack *aodTrack = dynamic_cast<AliAODTrack *>(track);
+      UInt_t filterMap = aodTrack ? aodTrack->GetFilterMap() : 0;
+      if (fFilterMask && aodTrack && !(filterMap & fFilterMask)) continue;
+      if (track->Pt() < fMinPt) continue;
+      if (TMath::Abs(track->Eta()) > fMaxEta) continue;
+      slot->fNTracksAll++;
+      if (slot->fNTracks >= fMaxTracks) continue;
+      AliMixCompactTrack &rec = tracks[slot->fNTracks++];
+      rec.fPt = track->Pt();
+      rec.fEta = track->Eta();
+      rec.fPhi = track->Phi();
+      rec.fCharge = track->Charge();
+      rec.fFilterMap = filterMap;
+      rec.fLabel = track->GetLabel();
+      rec.fID = track->GetID();
+   }
+   if (slot->fNTracksAll > slot->fNTracks)
+      AliWarning(Form("Event %lld: %d of %d tracks stored (SetMaxTracks)", entry, slot->fNTracks, slot->fNTracksAll));
+
+   fHead[bin] = (fHead[bin] + 1) % fDepth;
+   if (fCount[bin] < fDepth) fCount[bin]++;
+}
+
+//_________________________________________________________________________________________________
+const AliMixCompactEvent *AliMixCompactPool::GetPartner(Int_t bin, Int_t i) const
+{
+   //
+   // Returns i-th last stored event of bin
+   //
+   if (i < 0 || i >= GetNPartners(bin)) return 0;
+   Int_t slot = (fHead[bin] - 1 - i + fDepth) % fDepth;
+   return GetSlot(bin, slot);
+}
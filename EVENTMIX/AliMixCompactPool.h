@@ -0,0 +1,90 @@
+//
+// Class AliMixCompactPool
+//
+// AliMixCompactPool keeps compact records of the selected tracks
+// of the last events of each mixing bin (see AliMixEventPool), so that
+// partner events do not have to be read again from the input chain.
+// The records are stored in one ring per bin with a fixed number of
+// slots in memory mapped storage (anonymous or backed by a file).
+// Only the pages of the slots which are filled are in memory.
+//
+
+#ifndef ALIMIXCOMPACTPOOL_H
+#define ALIMIXCOMPACTPOOL_H
+
+#include <vector>
+
+#include <TNamed.h>
+#include <TString.h>
+
+class AliVEvent;
+
+// track record
+struct AliMixCompactTrack {
+   Float_t  fPt;        // transverse momentum
+   Float_t  fEta;       // pseudorapidity
+   Float_t  fPhi;       // azimuthal angle
+   Int_t    fCharge;    // charge
+   UInt_t   fFilterMap; // filter map (AOD tracks only)
+   Int_t    fLabel;     // MC label
+   Int_t    fID;        // track ID
+};
+
+// event record, followed in memory by its track records
+struct AliMixCompactEvent {
+   Long64_t fEntry;      // entry in chain of processed files
+   Int_t    fNTracks;    // number of stored tracks
+   Int_t    fNTracksAll; // number of selected tracks (more than fNTracks if the slot was full)
+   Float_t  fVertex[3];  // primary vertex
+   Float_t  fMagField;   // magnetic field
+
+   Int_t GetNTracks() const { return fNTracks; }
+   const AliMixCompactTrack *GetTrack(Int_t i) const { return reinterpret_cast<const AliMixCompactTrack *>(this + 1) + i; }
+};
+
+class AliMixCompactPool : public TNamed {
+public:
+   AliMixCompactPool(const char *name = "mixCompactPool", const char *title = "Compact mix pool");
+   virtual ~AliMixCompactPool();
+
+   void        SetDepth(Int_t depth) { fDepth = depth; }
+   void        SetMaxTracks(Int_t maxTracks) { fMaxTracks = maxTracks; }
+   void        SetTrackSelection(UInt_t filterMask, Float_t minPt = 0.0, Float_t maxEta = 10.0) { fFilterMask = filterMask; fMinPt = minPt; fMaxEta = maxEta; }
+   void        SetMappedFile(const char *fileName) { fMappedFile = fileName; }
+   Int_t       GetDepth() const { return fDepth; }
+   Int_t       GetMaxTracks() const { return fMaxTracks; }
+
+   Bool_t      Init(Int_t nBins);
+   Bool_t      IsInitialized() const { return fStorage != 0; }
+   Int_t       GetNumberOfBins() const { return fNBins; }
+
+   void        Store(Int_t bin, AliVEvent *ev, Long64_t entry);
+   Int_t       GetNPartners(Int_t bin) const { return (bin >= 0 && bin < fNBins) ? fCount[bin] : 0; }
+   const AliMixCompactEvent *GetPartner(Int_t bin, Int_t i) const; // i = 0 is the last stored event
+
+private:
+   AliMixCompactEvent *GetSlot(Int_t bin, Int_t slot) const { return reinterpret_cast<AliMixCompactEvent *>(fStorage + (fSlotSize * ((Long64_t) bin * fDepth + slot))); }
+   void        Unmap();
+
+   Int_t       fDepth;        // number of events kept in each bin
+   Int_t       fMaxTracks;    // maximum number of tracks stored per event
+   UInt_t      fFilterMask;   // filter mask of stored AOD tracks (0 = all)
+   Float_t     fMinPt;        // minimum pt of stored tracks
+   Float_t     fMaxEta;       // maximum |eta| of stored tracks
+   TString     fMappedFile;   // file backing the storage (anonymous memory if empty)
+
+   Int_t       fNBins;        //! number of bins
+   Long64_t    fSlotSize;     //! size of one slot in bytes
+   Long64_t    fMappedSize;   //! size of the mapping in bytes
+   Char_t     *fStorage;      //! mapped storage
+   Int_t       fFd;           //! file descriptor of the mapped file
+   std::vector<Int_t> fHead;  //! next slot to be filled in each bin
+   std::vector<Int_t> fCount; //! number of filled slots in each bin
+
+   AliMixCompactPool(const AliMixCompactPool &obj);
+   AliMixCompactPool &operator=(const AliMixCompactPool &obj);
+
+   ClassDef(AliMixCompactPool, 1)
+};
+
+#endif
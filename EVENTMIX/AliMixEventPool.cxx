@@ -192,8 +192,22 @@ TEntryList *AliMixEventPool::FindEntryList(AliVEvent *ev, Int_t &idEntryList)
    // Find entrlist in list of entrlist
    //
    AliDebug(AliLog::kDebug + 5, "<-");
+   Int_t index = FindBinIndex(ev);
+   if (index < 0) return 0;
+   idEntryList = index;
+   AliDebug(AliLog::kDebug + 5, "->");
+   return (TEntryList *) fListOfEntryList.At(idEntryList - 1);
+}
+
+//_________________________________________________________________________________________________
+Int_t AliMixEventPool::FindBinIndex(AliVEvent *ev)
+{
+   //
+   // Returns index of bin (starting from 1) of event or -1 if event is outside of binning
+   //
+   AliDebug(AliLog::kDebug + 5, "<-");
    Int_t num = fListOfEventCuts.GetEntriesFast();
-   if (num < 1) return 0;
+   if (num < 1) return -1;
    Int_t *indexes = new Int_t[num] ;
    Int_t *lenght = new Int_t[num];
    Int_t i = 0;
@@ -205,20 +219,33 @@ TEntryList *AliMixEventPool::FindEntryList(AliVEvent *ev, Int_t &idEntryList)
          AliDebug(AliLog::kDebug, Form("idEntryList %d", -1));
          delete [] indexes;
          delete [] lenght;
-         return 0;
+         return -1;
       }
       lenght[i] = cut->GetNumberOfBins();
       AliDebug(AliLog::kDebug + 1, Form("indexes[%d] %d", i, indexes[i]));
       i++;
    }
-   idEntryList = 0;
+   Int_t idEntryList = 0;
    SearchIndexRecursive(fListOfEventCuts.GetEntries() - 1, &indexes[0], &lenght[0], idEntryList);
    AliDebug(AliLog::kDebug, Form("idEntryList %d", idEntryList - 1));
    // index which start with 0 (idEntryList-1)
    delete [] indexes;
    delete [] lenght;
    AliDebug(AliLog::kDebug + 5, "->");
-   return (TEntryList *) fListOfEntryList.At(idEntryList - 1);
+   return idEntryList;
+}
+
+//_________________________________________________________________________________________________
+Int_t AliMixEventPool::GetNumberOfBins() const
+{
+   //
+   // Returns total number of bins (product of bins of all cuts)
+   //
+   Int_t num = 1;
+   TObjArrayIter next(&fListOfEventCuts);
+   AliMixEventCutObj *cut;
+   while ((cut = (AliMixEventCutObj *) next())) num *= cut->GetNumberOfBins();
+   return num;
 }
 
 //_________________________________________________________________________________________________
@@ -36,6 +36,8 @@ public:
 
    Bool_t      AddEntry(Long64_t entry, AliVEvent *ev);
    TEntryList *FindEntryList(AliVEvent *ev, Int_t &idEntryList);
+   Int_t       FindBinIndex(AliVEvent *ev);
+   Int_t       GetNumberOfBins() const;
 
    void        AddCut(AliMixEventCutObj *cut);
 
@@ -11,14 +11,17 @@
 #include <TChain.h>
 #include <TChainElement.h>
 #include <TSystem.h>
+#include <TMath.h>
 
 #include "AliLog.h"
 #include "AliAnalysisManager.h"
 #include "AliInputEventHandler.h"
 
 #include "AliMixEventPool.h"
+#include "AliMixCompactPool.h"
 #include "AliMixInputEventHandler.h"
 #include "AliMixInputHandlerInfo.h"
+#include "AliInputTreeCache.h"
 
 #include "AliAnalysisTaskSE.h"
 
@@ -33,6 +36,7 @@ AliMixInputEventHandler::AliMixInputEventHandler(const Int_t size, const Int_t m
    fEventPool(0),
    fNumberMixed(0),
    fMixNumber(mixNum),
+   fCompactPool(0),
    fUseDefautProcess(kFALSE),
    fDoMixExtra(kTRUE),
    fDoMixIfNotEnoughEvents(kTRUE),
@@ -43,7 +47,8 @@ AliMixInputEventHandler::AliMixInputEventHandler(const Int_t size, const Int_t m
    fCurrentBinIndex(-1),
    fOfflineTriggerMask(0),
    fCurrentMixEntry(),
-   fCurrentEntryMainTree(0)
+   fCurrentEntryMainTree(0),
+   fCurrentCompactEvent(0)
 {
    //
    // Default constructor.
@@ -192,7 +197,10 @@ Bool_t AliMixInputEventHandler::GetEntry()
    //
    AliDebug(AliLog::kDebug + 5, Form("<-"));
 
-   if (!fEventPool) {
+   if (fCompactPool) {
+      MixCompact();
+   }
+   else if (!fEventPool) {
       MixStd();
    }
    // if buffer size is higher then 1
@@ -495,6 +503,60 @@ Bool_t AliMixInputEventHandler::MixEventsMoreTimesWithBuffer()
    return kFALSE;
 }
 
+//_____________________________________________________________________________
+Bool_t AliMixInputEventHandler::MixCompact()
+{
+   //
+   // Mix with compact records of last events in same bin (fMixNumber partners)
+   // Binning is taken from event pool (one bin without event pool)
+   //
+   AliDebug(AliLog::kDebug + 5, "<-");
+   AliDebug(AliLog::kDebug + 1, "Mix method");
+   // get correct handler
+   AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+   AliMultiInputEventHandler *mh = dynamic_cast<AliMultiInputEventHandler *>(mgr->GetInputEventHandler());
+   AliInputEventHandler *inEvHMain = 0;
+   if (mh) inEvHMain = dynamic_cast<AliInputEventHandler *>(mh->GetFirstInputEventHandler());
+   else inEvHMain = dynamic_cast<AliInputEventHandler *>(mgr->GetInputEventHandler());
+   if (!inEvHMain) return kFALSE;
+
+   // check for PhysSelection
+   if (!IsEventCurrentSelected()) return kFALSE;
+
+   if (!fCompactPool->IsInitialized()) {
+      if (!fCompactPool->Init(fEventPool ? fEventPool->GetNumberOfBins() : 1)) return kFALSE;
+   }
+
+   // find out zero chain entries
+   Long64_t zeroChainEntries = fMixIntupHandlerInfoTmp->GetChain()->GetEntries() - inEvHMain->GetTree()->GetTree()->GetEntries();
+   Long64_t currentMainEntry = inEvHMain->GetTree()->GetTree()->GetReadEntry() + zeroChainEntries;
+
+   Int_t idEntryList = fEventPool ? fEventPool->FindBinIndex(inEvHMain->GetEvent()) : 1;
+   Int_t bin = idEntryList - 1;
+   if (bin < 0 || bin >= fCompactPool->GetNumberOfBins()) {
+      AliDebug(AliLog::kDebug + 3, Form("++++++++++++++ END SETUP EVENT %lld SKIPPED (no bin) +++++++++++++++++++", fEntryCounter));
+      UserExecMixAllTasks(fEntryCounter, -1, currentMainEntry, -1, 0);
+      return kTRUE;
+   }
+
+   // mix with partners (newest first), then store main event
+   fNumberMixed = 0;
+   Int_t nPartners = TMath::Min(fCompactPool->GetNPartners(bin), fMixNumber);
+   if (nPartners < fMixNumber && !fDoMixIfNotEnoughEvents) nPartners = 0;
+   if (!nPartners) UserExecMixAllTasks(fEntryCounter, fDoMixIfNotEnoughEvents ? idEntryList : -1, currentMainEntry, -1, 0);
+   for (Int_t i = 0; i < nPartners; i++) {
+      fCurrentCompactEvent = fCompactPool->GetPartner(bin, i);
+      fNumberMixed++;
+      UserExecMixAllTasks(fEntryCounter, idEntryList, currentMainEntry, fCurrentCompactEvent->fEntry, fNumberMixed);
+   }
+   fCurrentCompactEvent = 0;
+   fCompactPool->Store(bin, inEvHMain->GetEvent(), currentMainEntry);
+
+   AliDebug(AliLog::kDebug + 3, Form("fEntryCounter=%lld fMixEventNumber=%d", fEntryCounter, fNumberMixed));
+   AliDebug(AliLog::kDebug + 5, "->");
+   return kTRUE;
+}
+
 //_____________________________________________________________________________
 Bool_t AliMixInputEventHandler::FinishEvent()
 {
@@ -508,6 +570,16 @@ Bool_t AliMixInputEventHandler::FinishEvent()
    return kTRUE;
 }
 
+//_____________________________________________________________________________
+Bool_t AliMixInputEventHandler::TerminateIO()
+{
+   //
+   // Reports the bytes read per mixed entry
+   //
+   if (fMixIntupHandlerInfoTmp) AliInputTreeCache::Instance()->Print(fMixIntupHandlerInfoTmp->GetName());
+   return AliMultiInputEventHandler::TerminateIO();
+}
+
 //_____________________________________________________________________________
 void AliMixInputEventHandler::AddInputEventHandler(AliVEventHandler *)
 {
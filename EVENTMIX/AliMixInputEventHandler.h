@@ -21,6 +21,8 @@
 class TChain;
 class TChainElement;
 class AliMixEventPool;
+class AliMixCompactPool;
+struct AliMixCompactEvent;
 class AliMixInputHandlerInfo;
 class AliInputEventHandler;
 class AliMixInputEventHandler : public AliMultiInputEventHandler {
@@ -36,6 +38,7 @@ public:
    virtual Bool_t  BeginEvent(Long64_t entry);
    virtual Bool_t  GetEntry();
    virtual Bool_t  FinishEvent();
+   virtual Bool_t  TerminateIO();
 
    // removing default impementation
    virtual void            AddInputEventHandler(AliVEventHandler */*inHandler*/);
@@ -44,6 +47,10 @@ public:
    void                    SetEventPool(AliMixEventPool *const evPool) { fEventPool = evPool; }
 
    AliMixEventPool        *GetEventPool() const { return fEventPool; }
+   // mixing with compact track records instead of reading partner events from input chain
+   void                    SetCompactPool(AliMixCompactPool *const pool) { fCompactPool = pool; }
+   AliMixCompactPool      *GetCompactPool() const { return fCompactPool; }
+   const AliMixCompactEvent *GetCompactMixedEvent() const { return fCurrentCompactEvent; } // valid in UserExecMix() only
    Int_t                   BufferSize() const { return fBufferSize; }
    Int_t                   NumberMixedTimes() const { return fNumberMixed; }
    Int_t                   MixNumber() const { return fMixNumber; }
@@ -82,6 +89,7 @@ protected:
    AliMixEventPool        *fEventPool;             // event pool
    Int_t                   fNumberMixed;           // number of mixed events with current event
    Int_t                   fMixNumber;             // user's mix number request
+   AliMixCompactPool      *fCompactPool;           // compact pool (optional)
 
 private:
 
@@ -99,18 +107,20 @@ private:
 
    TEntryList fCurrentMixEntry;    //! array of mix entries currently used (user should touch)
    Long64_t fCurrentEntryMainTree; //! current entry in current tree (main event)
+   const AliMixCompactEvent *fCurrentCompactEvent; //! current compact mixed event
 
    virtual Bool_t          MixStd();
    virtual Bool_t          MixBuffer();
    virtual Bool_t          MixEventsMoreTimesWithOneEvent();
    virtual Bool_t          MixEventsMoreTimesWithBuffer();
+   virtual Bool_t          MixCompact();
 
    void                    UserExecMixAllTasks(Long64_t entryCounter, Int_t idEntryList, Long64_t entryMainReal, Long64_t entryMixReal, Int_t numMixed);
 
    AliMixInputEventHandler(const AliMixInputEventHandler &handler);
    AliMixInputEventHandler &operator=(const AliMixInputEventHandler &handler);
 
-   ClassDef(AliMixInputEventHandler, 5)
+   ClassDef(AliMixInputEventHandler, 6)
 };
 
 #endif
@@ -14,6 +14,7 @@
 
 #include "AliLog.h"
 #include "AliInputEventHandler.h"
+#include "AliInputTreeCache.h"
 
 #include "AliMixInputHandlerInfo.h"
 
@@ -133,6 +134,8 @@ void AliMixInputHandlerInfo::PrepareEntry(TChainElement *te, Long64_t entry, Ali
          fChain->GetEntry(0);
          eh->Init(opt);
          eh->Init(fChain->GetTree(), opt);
+         // the mixed entries are read at random, only the used branches are worth caching
+         AliInputTreeCache::Instance()->ConfigureTree(fChain, te->GetName());
       }
       fNeedNotify = kTRUE;
       AliDebug(AliLog::kDebug + 5, "->");
@@ -151,8 +154,11 @@ void AliMixInputHandlerInfo::PrepareEntry(TChainElement *te, Long64_t entry, Ali
          fChain->GetEntry(0);
          eh->Init(opt);
          eh->Init(fChain->GetTree(), opt);
+         // the mixed entries are read at random, only the used branches are worth caching
+         AliInputTreeCache::Instance()->ConfigureTree(fChain, te->GetName());
          eh->Notify(te->GetTitle());
          fChain->GetEntry(entry);
+         AliInputTreeCache::Instance()->CountEvent(te->GetName());
          eh->BeginEvent(entry);
          fNeedNotify = kFALSE;
       } else {
@@ -161,6 +167,7 @@ void AliMixInputHandlerInfo::PrepareEntry(TChainElement *te, Long64_t entry, Ali
          fNeedNotify = kFALSE;
          AliDebug(AliLog::kDebug, Form("Entry is %lld  fChain->GetEntries %lld ...", entry, fChain->GetEntries()));
          fChain->GetEntry(entry);
+         AliInputTreeCache::Instance()->CountEvent(te->GetName());
          eh->BeginEvent(entry);
          // file is in tree fChain already
       }
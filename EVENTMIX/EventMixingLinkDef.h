@@ -1,5 +1,8 @@
 #ifdef __CINT__
 
+#pragma link C++ class AliMixCompactPool+;
+#pragma link C++ class AliMixCompactTrack+;
+#pragma link C++ class AliMixCompactEvent+;
 #pragma link C++ class AliMixEventCutObj+;
 #pragma link C++ class AliMixEventPool+;
 
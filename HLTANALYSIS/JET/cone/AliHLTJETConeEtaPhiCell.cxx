@@ -58,6 +58,19 @@ ClassImp(AliHLTJETConeEtaPhiCell)
   // visit http://web.ift.uib.no/~kjeks/doc/alice-hlt
 }
 
+//##################################################################################
+AliHLTJETConeEtaPhiCell::AliHLTJETConeEtaPhiCell( Int_t etaIdx, Int_t phiIdx ) :
+    fEtaIdx(etaIdx),
+    fPhiIdx(phiIdx),
+    fPt(0.),
+    fEta(0.),
+    fPhi(0.),
+    fNTracks(0), 
+    fTrackList(NULL),
+    fTrackType( kTrackESD ) {  
+  // see header file for class documentation
+}
+
 //##################################################################################
 AliHLTJETConeEtaPhiCell::AliHLTJETConeEtaPhiCell( Int_t etaIdx, Int_t phiIdx, 
 						  AliESDtrack* track ) :
@@ -115,6 +128,22 @@ void AliHLTJETConeEtaPhiCell::Clear( Option_t* /*option*/ ) {
   return;
 }
 
+//##################################################################################
+void AliHLTJETConeEtaPhiCell::Reset() {
+  // see header file for class documentation
+
+  fPt      = 0.;
+  fEta     = 0.;
+  fPhi     = 0.;
+  fNTracks = 0;
+
+  // -- tracks are not owned, keep the allocated list
+  if ( fTrackList )
+    fTrackList->Clear();
+
+  return;
+}
+
 /*
  * ---------------------------------------------------------------------------------
  *                                     Process 
@@ -125,6 +154,11 @@ void AliHLTJETConeEtaPhiCell::Clear( Option_t* /*option*/ ) {
 void AliHLTJETConeEtaPhiCell::AddTrack( AliESDtrack* track  ){
   // see header file for class documentation
 
+  if ( ! fTrackList )
+    fTrackList = new TObjArray(20); // XXXXXX 20
+
+  fTrackType = kTrackESD;
+
   Float_t weight = 1.0; // **  XXXX
   
   fEta   += (weight * track->Eta());
@@ -141,6 +175,11 @@ void AliHLTJETConeEtaPhiCell::AddTrack( AliESDtrack* track  ){
 void AliHLTJETConeEtaPhiCell::AddTrack( TParticle* particle ){
   // see header file for class documentation
 
+  if ( ! fTrackList )
+    fTrackList = new TObjArray(20); // XXXXXX 20
+
+  fTrackType = kTrackMC;
+
   Float_t weight = 1.0; // **  XXXX
 
   fEta   += (weight * particle->Eta());
@@ -46,6 +46,9 @@ public:
    * ---------------------------------------------------------------------------------
    */
   
+  /** Constructor for an empty cell, filled via AddTrack */
+  AliHLTJETConeEtaPhiCell( Int_t etaIdx, Int_t phiIdx );
+
   /** Constructor for ESD tracks */
   AliHLTJETConeEtaPhiCell( Int_t etaIdx, Int_t phiIdx, AliESDtrack* track );
 
@@ -58,6 +61,9 @@ public:
   /** A destructor like class, called by TClonesArray->Clear("C") */
   void Clear(Option_t* option = "");
 
+  /** Empty the cell for the next event, the track list is kept */
+  void Reset();
+
   /*
    * ---------------------------------------------------------------------------------
    *                                     Getter
@@ -285,6 +285,17 @@ Int_t AliHLTJETConeFinder::FindConeJets() {
     
     AliHLTJETConeJetCandidate* jet = reinterpret_cast<AliHLTJETConeJetCandidate*> ((*jetCandidates)[iter]);
     
+    // -- Whole cells : take the square around the seed from the summed-area table
+    if ( jet->GetUseWholeCell() ) {
+      Float_t aSums[] = { 0., 0., 0. };
+      Int_t nTracks = fGrid->GetConeSums( jet->GetSeedEtaIdx(), jet->GetSeedPhiIdx(), aSums );
+
+      if ( ( iResult = jet->AddCellSums( aSums, nTracks ) ) )
+	HLTError( "Error adding cell sums to jet candiate %d", iter);
+
+      continue;
+    }
+
     // -- Set iterator for cells around seed
     fGrid->SetCellIter( jet->GetSeedEtaIdx(), jet->GetSeedPhiIdx() ); 
 
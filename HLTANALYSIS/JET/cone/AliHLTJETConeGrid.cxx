@@ -28,6 +28,8 @@
 // or
 // visit http://web.ift.uib.no/~kjeks/doc/alice-hlt   
 
+#include <cstring>
+
 #include "AliHLTJETConeGrid.h"
 #include "AliHLTJETConeEtaPhiCell.h"
 
@@ -46,6 +48,10 @@ ClassImp(AliHLTJETConeGrid)
 AliHLTJETConeGrid::AliHLTJETConeGrid()
   : 
   fGrid(NULL),
+  fOccupiedCells(NULL),
+  fNOccupiedCells(0),
+  fSumTable(NULL),
+  fSumTableValid(kFALSE),
   fEtaMin(-0.9),
   fEtaMax(0.9),
   fPhiMin(0.0),
@@ -83,6 +89,14 @@ AliHLTJETConeGrid::~AliHLTJETConeGrid() {
     delete fGrid;
   }
   fGrid = NULL;
+
+  if ( fOccupiedCells )
+    delete[] fOccupiedCells;
+  fOccupiedCells = NULL;
+
+  if ( fSumTable )
+    delete[] fSumTable;
+  fSumTable = NULL;
  
 }
 
@@ -114,13 +128,35 @@ Int_t AliHLTJETConeGrid::Initialize() {
   HLTInfo(" NRBins    (%d,%d)", fEtaNRBins   , fPhiNRBins);
   HLTInfo(" NBins      %d", fNBins );
 
+  if ( fGrid ) {
+    fGrid->Clear("C");
+    delete fGrid;
+  }
+  if ( fOccupiedCells )
+    delete[] fOccupiedCells;
+  if ( fSumTable )
+    delete[] fSumTable;
+
   fGrid = new TClonesArray("AliHLTJETConeEtaPhiCell", fNBins );
   
   if ( ! fGrid ) {
     HLTError( "Error: Setup search grid with size %d .", fNBins );
     iResult = 1;
+    return iResult;
   }
 
+  // -- Create all cells once, they are reused in every event
+  for ( Int_t cellIdx = 0; cellIdx < fNBins; cellIdx++ )
+    new( (*fGrid) [cellIdx] ) AliHLTJETConeEtaPhiCell( cellIdx % fEtaNGridBins, 
+						       cellIdx / fEtaNGridBins );
+
+  fOccupiedCells  = new Int_t[fNBins];
+  fNOccupiedCells = 0;
+
+  // -- 4 entries per node : eta, phi, pt, nTracks
+  fSumTable       = new Double_t[ 4 * (fEtaNGridBins+1) * (fPhiNGridBins+1) ];
+  fSumTableValid  = kFALSE;
+
   return iResult;
 }
 
@@ -128,8 +164,12 @@ Int_t AliHLTJETConeGrid::Initialize() {
 void AliHLTJETConeGrid::Reset() { 
   // see header file for class documentation
 
-  if ( fGrid )
-    fGrid->Clear("C");
+  // -- Empty only the cells filled in this event
+  for ( Int_t iter = 0; iter < fNOccupiedCells; iter++ )
+    (reinterpret_cast<AliHLTJETConeEtaPhiCell*> (fGrid->UncheckedAt(fOccupiedCells[iter])))->Reset();
+
+  fNOccupiedCells = 0;
+  fSumTableValid  = kFALSE;
 
   return;
 }
@@ -159,16 +199,7 @@ Int_t AliHLTJETConeGrid::FillTrack( TParticle* particle, const Float_t* aEtaPhi,
   // -- Fill track in primary region
   // ---------------------------
   
-  // -- Create new cell and add track to cell
-  if (! fGrid->UncheckedAt( aGridIdx[kIdxPrimary] ) ) {
-    new( (*fGrid ) [aGridIdx[kIdxPrimary]] ) AliHLTJETConeEtaPhiCell( aGridIdx[kIdxEtaPrimary], 
-								      aGridIdx[kIdxPhiPrimary], 
-								      particle );
-  }
-  // -- Add track to existing cell
-  else {
-    (reinterpret_cast<AliHLTJETConeEtaPhiCell*> ((*fGrid)[aGridIdx[kIdxPrimary]]))->AddTrack(particle);
-  }
+  GetFillCell( aGridIdx[kIdxPrimary] )->AddTrack(particle);
 
   // ---------------------------
   // -- Fill track in outter region
@@ -177,16 +208,7 @@ Int_t AliHLTJETConeGrid::FillTrack( TParticle* particle, const Float_t* aEtaPhi,
   // -- if it has to be filled
   if ( iResult == 1 ) {
 
-    // -- Create new cell and add track to cell
-    if (! fGrid->UncheckedAt( aGridIdx[kIdxOutter] ) ) {
-      new( (*fGrid) [aGridIdx[kIdxOutter]] ) AliHLTJETConeEtaPhiCell( aGridIdx[kIdxEtaPrimary], 
-								      aGridIdx[kIdxPhiOutter], 
-								      particle );
-    }
-    // -- Add track to existing cell
-    else {
-      (reinterpret_cast<AliHLTJETConeEtaPhiCell*> ((*fGrid)[aGridIdx[kIdxOutter]]))->AddTrack(particle);
-    }
+    GetFillCell( aGridIdx[kIdxOutter] )->AddTrack(particle);
   }
 
   return 0;
@@ -211,16 +233,7 @@ Int_t AliHLTJETConeGrid::FillTrack( AliESDtrack *esdTrack, const Float_t* aEtaPh
   // -- Fill track in primary region
   // ---------------------------
   
-  // -- Create new cell and add track to cell
-  if (! fGrid->UncheckedAt( aGridIdx[kIdxPrimary] ) ) {
-    new( (*fGrid ) [aGridIdx[kIdxPrimary]] ) AliHLTJETConeEtaPhiCell( aGridIdx[kIdxEtaPrimary], 
-								      aGridIdx[kIdxPhiPrimary], 
-								      esdTrack );
-  }
-  // -- Add track to existing cell
-  else {
-    (reinterpret_cast<AliHLTJETConeEtaPhiCell*> ((*fGrid)[aGridIdx[kIdxPrimary]]))->AddTrack(esdTrack);
-  }
+  GetFillCell( aGridIdx[kIdxPrimary] )->AddTrack(esdTrack);
    
   // ---------------------------
   // -- Fill track in outter region
@@ -229,16 +242,7 @@ Int_t AliHLTJETConeGrid::FillTrack( AliESDtrack *esdTrack, const Float_t* aEtaPh
   // -- if it has to be filled
   if ( iResult == 1 ) {
     
-    // -- Create new cell and add track to cell
-    if (! fGrid->UncheckedAt( aGridIdx[kIdxOutter] ) ) {
-      new( (*fGrid) [aGridIdx[kIdxOutter]] ) AliHLTJETConeEtaPhiCell( aGridIdx[kIdxEtaPrimary], 
-								      aGridIdx[kIdxPhiOutter], 
-								      esdTrack );
-    }
-    // -- Add track to existing cell
-    else {
-      (reinterpret_cast<AliHLTJETConeEtaPhiCell*> ((*fGrid)[aGridIdx[kIdxOutter]]))->AddTrack(esdTrack);
-    }
+    GetFillCell( aGridIdx[kIdxOutter] )->AddTrack(esdTrack);
   }
   
   return 0;
@@ -284,23 +288,127 @@ Int_t AliHLTJETConeGrid::NextCell() {
 void AliHLTJETConeGrid::SetCellIter( const Int_t etaIdx, const Int_t phiIdx ) {
   // see header file for class documentation
 
-  fEtaIdxMax = etaIdx + fEtaNRBins;
-  fEtaIdxMin = etaIdx - fEtaNRBins;
+  // -- Clamp to grid, otherwise the 1D index wraps into the neighbouring row
+  fEtaIdxMax = TMath::Min( etaIdx + fEtaNRBins, fEtaNGridBins - 1 );
+  fEtaIdxMin = TMath::Max( etaIdx - fEtaNRBins, 0 );
   fEtaIdxCurrent = fEtaIdxMin;
 
-  fPhiIdxMax = phiIdx + fPhiNRBins;
-  fPhiIdxMin = phiIdx - fPhiNRBins;
+  fPhiIdxMax = TMath::Min( phiIdx + fPhiNRBins, fPhiNGridBins - 1 );
+  fPhiIdxMin = TMath::Max( phiIdx - fPhiNRBins, 0 );
   fPhiIdxCurrent = fPhiIdxMin - 1;
 
   return;
 }
 
+// #################################################################################
+TObject* AliHLTJETConeGrid::UncheckedAt( Int_t cellIdx ) {
+  // see header file for class documentation
+
+  AliHLTJETConeEtaPhiCell* cell = reinterpret_cast<AliHLTJETConeEtaPhiCell*> (fGrid->UncheckedAt(cellIdx));
+  
+  if ( !cell || !cell->GetNTracks() )
+    return NULL;
+
+  return cell;
+}
+
+// #################################################################################
+Int_t AliHLTJETConeGrid::GetConeSums( const Int_t etaIdx, const Int_t phiIdx, Float_t* aSums ) {
+  // see header file for class documentation
+
+  if ( ! fSumTableValid )
+    BuildSumTable();
+
+  // -- Square around the seed, clamped to the grid as in SetCellIter
+  Int_t etaLow  = TMath::Max( etaIdx - fEtaNRBins, 0 );
+  Int_t etaHigh = TMath::Min( etaIdx + fEtaNRBins, fEtaNGridBins - 1 ) + 1;
+  Int_t phiLow  = TMath::Max( phiIdx - fPhiNRBins, 0 );
+  Int_t phiHigh = TMath::Min( phiIdx + fPhiNRBins, fPhiNGridBins - 1 ) + 1;
+
+  aSums[kIdxEta] = 0.;
+  aSums[kIdxPhi] = 0.;
+  aSums[kIdxPt]  = 0.;
+
+  if ( etaLow >= etaHigh || phiLow >= phiHigh )
+    return 0;
+
+  const Int_t nEtaNodes = fEtaNGridBins + 1;
+  
+  const Double_t* sHH = fSumTable + 4 * ( etaHigh + phiHigh * nEtaNodes );
+  const Double_t* sLH = fSumTable + 4 * ( etaLow  + phiHigh * nEtaNodes );
+  const Double_t* sHL = fSumTable + 4 * ( etaHigh + phiLow  * nEtaNodes );
+  const Double_t* sLL = fSumTable + 4 * ( etaLow  + phiLow  * nEtaNodes );
+
+  aSums[kIdxEta] = static_cast<Float_t>( sHH[0] - sLH[0] - sHL[0] + sLL[0] );
+  aSums[kIdxPhi] = static_cast<Float_t>( sHH[1] - sLH[1] - sHL[1] + sLL[1] );
+  aSums[kIdxPt]  = static_cast<Float_t>( sHH[2] - sLH[2] - sHL[2] + sLL[2] );
+
+  return TMath::Nint( sHH[3] - sLH[3] - sHL[3] + sLL[3] );
+}
+
 /*
  * ---------------------------------------------------------------------------------
  *                             Helper - private
  * ---------------------------------------------------------------------------------
  */
 
+//##################################################################################
+AliHLTJETConeEtaPhiCell* AliHLTJETConeGrid::GetFillCell( Int_t cellIdx ) {
+  // see header file for class documentation
+
+  AliHLTJETConeEtaPhiCell* cell = reinterpret_cast<AliHLTJETConeEtaPhiCell*> (fGrid->UncheckedAt(cellIdx));
+
+  // -- First track in this cell for this event
+  if ( ! cell->GetNTracks() )
+    fOccupiedCells[fNOccupiedCells++] = cellIdx;
+
+  fSumTableValid = kFALSE;
+
+  return cell;
+}
+
+//##################################################################################
+void AliHLTJETConeGrid::BuildSumTable() {
+  // see header file for class documentation
+
+  const Int_t nEtaNodes = fEtaNGridBins + 1;
+  const Int_t nPhiNodes = fPhiNGridBins + 1;
+
+  memset( fSumTable, 0, 4 * nEtaNodes * nPhiNodes * sizeof(Double_t) );
+  
+  // -- Scatter the occupied cells, cell (eta,phi) goes to node (eta+1,phi+1)
+  for ( Int_t iter = 0; iter < fNOccupiedCells; iter++ ) {
+    Int_t cellIdx = fOccupiedCells[iter];
+    AliHLTJETConeEtaPhiCell* cell = reinterpret_cast<AliHLTJETConeEtaPhiCell*> (fGrid->UncheckedAt(cellIdx));
+    
+    Double_t* node = fSumTable + 4 * ( (cellIdx % fEtaNGridBins) + 1 + 
+				       ( (cellIdx / fEtaNGridBins) + 1 ) * nEtaNodes );
+    node[0] = cell->GetEta();
+    node[1] = cell->GetPhi();
+    node[2] = cell->GetPt();
+    node[3] = cell->GetNTracks();
+  }
+
+  // -- Prefix sums in eta, then in phi
+  for ( Int_t phiIter = 1; phiIter < nPhiNodes; phiIter++ ) {
+    Double_t* row = fSumTable + 4 * phiIter * nEtaNodes;
+    for ( Int_t etaIter = 1; etaIter < nEtaNodes; etaIter++ ) 
+      for ( Int_t idx = 0; idx < 4; idx++ )
+	row[4*etaIter+idx] += row[4*(etaIter-1)+idx];
+  }
+
+  for ( Int_t phiIter = 2; phiIter < nPhiNodes; phiIter++ ) {
+    Double_t* row     = fSumTable + 4 * phiIter * nEtaNodes;
+    Double_t* prevRow = row - 4 * nEtaNodes;
+    for ( Int_t idx = 4; idx < 4 * nEtaNodes; idx++ ) 
+      row[idx] += prevRow[idx];
+  }
+
+  fSumTableValid = kTRUE;
+
+  return;
+}
+
 //##################################################################################
 Int_t AliHLTJETConeGrid::GetCellIndex( const Float_t* aEtaPhi, Int_t* aGridIdx ) {
   // see header file for class documentation
@@ -30,10 +30,17 @@
 #include "AliHLTLogging.h"
 #include "AliHLTJETBase.h"
 
+class AliHLTJETConeEtaPhiCell;
+
 /**
  * @class  AliHLTJETConeGrid
  * Eta-Phi grid of the cone finder
  *
+ * All cells are created once in Initialize() and reused for every event,
+ * Reset() only empties the cells which were filled. For the square cell
+ * algorithm the cone sums are read from a summed-area table of the grid,
+ * which is built once per event on the first request.
+ *
  * @ingroup alihlt_jet_cone
  */
 
@@ -83,12 +90,12 @@ public:
    * ---------------------------------------------------------------------------------
    */
 
-  /** Initialize grid 
+  /** Initialize grid, all cells are allocated here
    *  @return 0 on sucess, < 0 for error
    */
   Int_t Initialize();
 
-  /** Reset grid */
+  /** Reset grid, empties only the filled cells */
   void Reset();
 
   /*
@@ -137,7 +144,17 @@ public:
    *  @param   cellIdx    CellIdx where there coulf be an object
    *  @return             ptr to cell, NULL if empty
    */
-  TObject* UncheckedAt( Int_t cellIdx ) { return fGrid->UncheckedAt(cellIdx); }
+  TObject* UncheckedAt( Int_t cellIdx );
+
+  /** Sums of all cells in the square of +- fEtaNRBins, fPhiNRBins
+   *  around a seed cell, using the summed-area table.
+   *  Same cells as visited with SetCellIter() / NextCell().
+   *  @param etaIdx Eta index of seed
+   *  @param phiIdx Phi index of seed
+   *  @param aSums  array to be filled with summed (eta,phi,pt)
+   *  @return       number of tracks in the square
+   */
+  Int_t GetConeSums( const Int_t etaIdx, const Int_t phiIdx, Float_t* aSums );
   
 
   //  reinterpret_cast<AliHLTJETConeEtaPhiCell*>((*fGrid)[cellIdx])
@@ -175,6 +192,15 @@ private:
    */
   Int_t GetCellIndex( const Float_t* aEtaPhi, Int_t* aGridIdx );
 
+  /** Get cell to be filled, registers it as occupied
+   *  @param   cellIdx    1D cell index
+   *  @return             ptr to cell
+   */
+  AliHLTJETConeEtaPhiCell* GetFillCell( Int_t cellIdx );
+
+  /** Build the summed-area table out of the occupied cells */
+  void BuildSumTable();
+
   /*
    * ---------------------------------------------------------------------------------
    *                             Members - private
@@ -186,6 +212,20 @@ private:
   /** Search Grid */
   TClonesArray*  fGrid;                    //! transient
 
+  /** Indices of the cells filled in this event */
+  Int_t*         fOccupiedCells;           //! transient
+
+  /** Number of cells filled in this event */
+  Int_t          fNOccupiedCells;          // see above
+
+  /** Summed-area table of (eta,phi,pt,nTracks) 
+   *  with (fEtaNGridBins+1)*(fPhiNGridBins+1) nodes
+   */
+  Double_t*      fSumTable;                //! transient
+
+  /** Summed-area table is up to date */
+  Bool_t         fSumTableValid;           // see above
+
   // -- Grid boundaries in eta and phi - set via setter
 
   /** Minimum eta */
@@ -260,7 +300,7 @@ private:
   /** Cone radius */
   Float_t        fConeRadius;              // see above
 
-  ClassDef(AliHLTJETConeGrid, 1)
+  ClassDef(AliHLTJETConeGrid, 2)
 
 };
 #endif
@@ -28,6 +28,8 @@
 // or
 // visit http://web.ift.uib.no/~kjeks/doc/alice-hlt
 
+#include <cerrno>
+
 #include "AliHLTJETConeJetCandidate.h"
 #include "AliHLTJETConeEtaPhiCell.h"
 
@@ -169,6 +171,26 @@ Int_t AliHLTJETConeJetCandidate::AddCell( AliHLTJETConeEtaPhiCell* cell ) {
   return 0;
 }
 
+//##################################################################################
+Int_t AliHLTJETConeJetCandidate::AddCellSums( const Float_t* aSums, Int_t nTracks ) {
+  // see header file for class documentation
+  
+  if ( ! fUseWholeCell ) {
+    HLTError("Cell sums can only be used with whole cells.");
+    return -EINVAL;
+  }
+
+  fPt  += aSums[kIdxPt];
+  fPhi += aSums[kIdxPhi];
+  fEta += aSums[kIdxEta];
+  fNTracks += nTracks;
+
+  HLTDebug("Cell sums : eta: %f - phi: %f - pt: %f - nTracks: %d .", 
+	   aSums[kIdxEta], aSums[kIdxPhi], aSums[kIdxPt], nTracks );
+
+  return 0;
+}
+
 /*
  * ---------------------------------------------------------------------------------
  *                                Sort of JetCandidates 
@@ -77,6 +77,9 @@ public:
 
   /** Get pt of seed */
   Float_t       GetSeedPt()        { return fSeedPt; }  
+
+  /** Get flag if whole cells are added */
+  Bool_t        GetUseWholeCell()  { return fUseWholeCell; }
   
   // -- Jet properties
 
@@ -104,6 +107,13 @@ public:
    */
   Int_t AddCell( AliHLTJETConeEtaPhiCell* cell );
 
+  /** Add summed cells to JetCandidate, only for whole cells
+   *  @param aSums    summed (eta,phi,pt) of the cells
+   *  @param nTracks  number of tracks in the cells
+   *  @return 0 on success, <0 on failure
+   */
+  Int_t AddCellSums( const Float_t* aSums, Int_t nTracks );
+
 
 
   /* XXXXXXXXXX
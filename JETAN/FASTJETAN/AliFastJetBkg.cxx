@@ -52,7 +52,8 @@ ClassImp(AliFastJetBkg)
 AliFastJetBkg::AliFastJetBkg():
   TObject(),
   fHeader(0),
-  fInputFJ(0)
+  fInputFJ(0),
+  fClustSeqBkg(0)
 {
   // Default constructor
 }
@@ -61,7 +62,8 @@ AliFastJetBkg::AliFastJetBkg():
 AliFastJetBkg::AliFastJetBkg(const AliFastJetBkg& input):
   TObject(input),
   fHeader(input.fHeader),
-  fInputFJ(input.fInputFJ)
+  fInputFJ(input.fInputFJ),
+  fClustSeqBkg(input.fClustSeqBkg)
 {
   // copy constructor
 }
@@ -74,6 +76,7 @@ AliFastJetBkg& AliFastJetBkg::operator=(const AliFastJetBkg& source)
    TObject::operator=(source);
    fHeader = source.fHeader;
    fInputFJ = source.fInputFJ;
+   fClustSeqBkg = source.fClustSeqBkg;
   }
   
   return *this;
@@ -89,7 +92,7 @@ void AliFastJetBkg::BkgFastJetb(Double_t& rho,Double_t& sigma,
   AliFastJetHeaderV1 *header = (AliFastJetHeaderV1*)fHeader; 
   Int_t debug  = header->GetDebug();     // debug option
   if(debug>0) cout<<"===============  AliFastJetBkg::BkgFastJetb()  =========== "<<endl;
-  vector<fastjet::PseudoJet> inputParticles=fInputFJ->GetInputParticles();
+  const vector<fastjet::PseudoJet>& inputParticles=fInputFJ->GetInputParticles();
   
   double rParamBkg = header->GetRparamBkg(); //Radius for background calculation
 
@@ -111,7 +114,7 @@ void AliFastJetBkg::BkgFastJetWoHardest(Double_t& rho,Double_t& sigma,
   AliFastJetHeaderV1 *header = (AliFastJetHeaderV1*)fHeader; 
   Int_t debug  = header->GetDebug();     // debug option
   if(debug) cout<<"===============  AliFastJetBkg::BkgWoHardest()  =========== "<<endl;
-  vector<fastjet::PseudoJet> inputParticles=fInputFJ->GetInputParticles();
+  const vector<fastjet::PseudoJet>& inputParticles=fInputFJ->GetInputParticles();
   
   double rParamBkg = header->GetRparamBkg(); //Radius for background calculation  
   Double_t medianb,sigmab,meanareab;
@@ -125,7 +128,7 @@ void AliFastJetBkg::BkgFastJetWoHardest(Double_t& rho,Double_t& sigma,
 //____________________________________________________________________
 void AliFastJetBkg::CalcRhob(Double_t& median,Double_t& 
 			     sigma,Double_t& 
-			     meanarea,vector<fastjet::PseudoJet> inputParticles,Double_t 
+			     meanarea,const vector<fastjet::PseudoJet>& inputParticles,Double_t 
 			     rParamBkg,TString method)
 {
   // calculate rho using the fastjet method
@@ -151,25 +154,26 @@ void AliFastJetBkg::CalcRhob(Double_t& median,Double_t&
   fastjet::AreaType areaType = header->GetAreaType();
   areaDef = fastjet::AreaDefinition(areaType,ghost_spec);
   
-  //fastjet::ClusterSequenceArea clust_seq(inputParticles, jetDef);
-  fastjet::ClusterSequenceArea clust_seq(inputParticles, jetDef,areaDef);
+  // reuse the clustering of the jet finder if it was done with the same definitions
+  Bool_t reuse = IsBkgClusterSequence(jetDef,areaDef);
+  fastjet::ClusterSequenceArea *clustSeq = reuse ? fClustSeqBkg : new fastjet::ClusterSequenceArea(inputParticles,jetDef,areaDef);
   TString comment = "Running FastJet algorithm for BKG calculation with the following setup. ";
   comment+= "Jet definition: ";
   comment+= TString(jetDef.description());
   // comment+= ". Area definition: ";
   // comment+= TString(areaDef.description());
   comment+= ". Strategy adopted by FastJet: ";
-  comment+= TString(clust_seq.strategy_string());
+  comment+= TString(clustSeq->strategy_string());
   comment+= Form("Method: %s",method.Data());
   header->SetComment(comment);
   if(debug>0){
     cout << "--------------------------------------------------------" << endl;
     cout << comment << endl;
+    if(reuse) cout << "Clustering reused from the jet finder" << endl;
     cout << "--------------------------------------------------------" << endl;
   }
 
-  vector<fastjet::PseudoJet> inclusiveJets = clust_seq.inclusive_jets(0.);
-  vector<fastjet::PseudoJet> jets = sorted_by_pt(inclusiveJets); 
+  vector<fastjet::PseudoJet> inclusiveJets = clustSeq->inclusive_jets(0.);
 
   double phiMin = 0, phiMax = 0, rapMin = 0, rapMax = 0;
 
@@ -182,7 +186,8 @@ void AliFastJetBkg::CalcRhob(Double_t& median,Double_t&
   fastjet::RangeDefinition range(rapMin, rapMax, phiMin, phiMax);
 
   double medianb, sigmab, meanareab;
-  clust_seq.get_median_rho_and_sigma(inclusiveJets, range, false, medianb, sigmab, meanareab, false);
+  clustSeq->get_median_rho_and_sigma(inclusiveJets, range, false, medianb, sigmab, meanareab, false);
+  if(!reuse) delete clustSeq;
   median=medianb;
   sigma=sigmab;
   meanarea=meanareab; 
@@ -191,7 +196,7 @@ void AliFastJetBkg::CalcRhob(Double_t& median,Double_t&
 
 //____________________________________________________________________
 void AliFastJetBkg::CalcRhoWoHardest(Double_t& median,Double_t& 
-				     sigma,Double_t& meanarea,vector<fastjet::PseudoJet> inputParticles,Double_t 
+				     sigma,Double_t& meanarea,const vector<fastjet::PseudoJet>& inputParticles,Double_t 
 				     rParamBkg,TString method)
 {
   // calculate rho (without the hardest jet) using the fastjet method
@@ -216,26 +221,26 @@ void AliFastJetBkg::CalcRhoWoHardest(Double_t& median,Double_t&
   // and from that get an area definition
   fastjet::AreaType areaType = header->GetAreaType();
   areaDef = fastjet::AreaDefinition(areaType,ghost_spec);
-  //fastjet::ClusterSequenceArea clust_seq(inputParticles, jetDef);
-  fastjet::ClusterSequenceArea clust_seq(inputParticles,jetDef,areaDef);
+  // reuse the clustering of the jet finder if it was done with the same definitions
+  Bool_t reuse = IsBkgClusterSequence(jetDef,areaDef);
+  fastjet::ClusterSequenceArea *clustSeq = reuse ? fClustSeqBkg : new fastjet::ClusterSequenceArea(inputParticles,jetDef,areaDef);
   TString comment = "Running FastJet algorithm for BKG calculation with the following setup. ";
   comment+= "Jet definition: ";
   comment+= TString(jetDef.description());
   // comment+= ". Area definition: ";
   // comment+= TString(areaDef.description());
   comment+= ". Strategy adopted by FastJet: ";
-  comment+= TString(clust_seq.strategy_string());
+  comment+= TString(clustSeq->strategy_string());
   comment+= Form("Method: %s",method.Data());
   header->SetComment(comment);
 if(debug>0){
     cout << "--------------------------------------------------------" << endl;
     cout << comment << endl;
+    if(reuse) cout << "Clustering reused from the jet finder" << endl;
     cout << "--------------------------------------------------------" << endl;
   }
 
-  vector<fastjet::PseudoJet> inclusiveJets = clust_seq.inclusive_jets(0.);
-  vector<fastjet::PseudoJet> jets = sorted_by_pt(inclusiveJets); 
-  vector<fastjet::PseudoJet> jets2=sorted_by_pt(inclusiveJets);
+  vector<fastjet::PseudoJet> jets2=sorted_by_pt(clustSeq->inclusive_jets(0.));
   if(jets2.size()>=2) jets2.erase(jets2.begin(),jets2.begin()+1);
     
   double phiMin = 0, phiMax = 0, rapMin = 0, rapMax = 0;
@@ -249,8 +254,9 @@ if(debug>0){
   fastjet::RangeDefinition range(rapMin, rapMax, phiMin, phiMax);
 
   double medianb, sigmab, meanareab;
-  clust_seq.get_median_rho_and_sigma(jets2, range, false, medianb, sigmab, 
+  clustSeq->get_median_rho_and_sigma(jets2, range, false, medianb, sigmab, 
 				     meanareab, false);
+  if(!reuse) delete clustSeq;
   median=medianb;
   sigma=sigmab;
   meanarea=meanareab; 
@@ -266,7 +272,7 @@ Float_t AliFastJetBkg::BkgFastJet()
   Int_t debug  = header->GetDebug();     // debug option
 
   if(debug>0) cout<<"===============  AliFastJetBkg::BkgFastJet()  =========== "<<endl;
-  vector<fastjet::PseudoJet> inputParticles=fInputFJ->GetInputParticles();
+  const vector<fastjet::PseudoJet>& inputParticles=fInputFJ->GetInputParticles();
   
   if(debug>0) cout<<"printing inputParticles for BKG "<<inputParticles.size()<<endl;
   
@@ -287,7 +293,7 @@ Float_t AliFastJetBkg::BkgChargedFastJet()
 
   if(debug>0) cout<<"===============  AliFastJetBkg::BkgChargedFastJet()  =========== "<<endl;
 
-  vector<fastjet::PseudoJet> inputParticlesCharged=fInputFJ->GetInputParticlesCh();
+  const vector<fastjet::PseudoJet>& inputParticlesCharged=fInputFJ->GetInputParticlesCh();
   
   if(debug>0) cout<<"printing CHARGED inputParticles for BKG "<<inputParticlesCharged.size()<<endl;
 
@@ -377,7 +383,7 @@ Float_t AliFastJetBkg::BkgFastJetCone(TClonesArray* fAODJets)
   
   // cout<<" nIn = "<<nIn<<endl;
   Float_t sumpt=0;
-  vector<fastjet::PseudoJet> inputParticles=fInputFJ->GetInputParticles();
+  const vector<fastjet::PseudoJet>& inputParticles=fInputFJ->GetInputParticles();
   for(UInt_t i=0; i<inputParticles.size(); i++)
     { // Loop over input list of particles
       pt    = inputParticles[i].perp();
@@ -445,7 +451,7 @@ Float_t AliFastJetBkg::BkgFastJetCone(TClonesArray* fAODJets)
 }
 
 //___________________________________________________________________
-Double_t AliFastJetBkg::CalcRho(vector<fastjet::PseudoJet> inputParticles,Double_t rParamBkg,TString method)
+Double_t AliFastJetBkg::CalcRho(const vector<fastjet::PseudoJet>& inputParticles,Double_t rParamBkg,TString method)
 {
   // calculate rho using the fastjet method
 
@@ -527,6 +533,17 @@ Double_t AliFastJetBkg::CalcRho(vector<fastjet::PseudoJet> inputParticles,Double
 
 }
 
+//___________________________________________________________________
+Bool_t AliFastJetBkg::IsBkgClusterSequence(const fastjet::JetDefinition& jetDef, const fastjet::AreaDefinition& areaDef) const
+{
+  // check whether the clustering set with SetBkgClusterSequence() was done with these definitions
+
+  if(!fClustSeqBkg) return kFALSE;
+  return fClustSeqBkg->jet_def().description() == jetDef.description() &&
+         fClustSeqBkg->area_def().description() == areaDef.description();
+
+}
+
 //___________________________________________________________________
 Double_t  AliFastJetBkg::BkgFunction(Double_t */*x*/,Double_t */*par*/)
 {
@@ -23,6 +23,11 @@ namespace fastjet {
   class PsuedoJet;
 }
 #endif
+namespace fastjet {
+  class ClusterSequenceArea;
+  class JetDefinition;
+  class AreaDefinition;
+}
 class TString;
 class TClonesArray;
 class AliFastJetInput;
@@ -36,6 +41,7 @@ class AliFastJetBkg : public TObject
   virtual          ~AliFastJetBkg() {;}
   void             SetHeader(AliJetHeader *header)  {fHeader=header;}
   void             SetFastJetInput(AliFastJetInput *fjinput)  {fInputFJ=fjinput;}
+  void             SetBkgClusterSequence(fastjet::ClusterSequenceArea *clustSeq) {fClustSeqBkg=clustSeq;} // not owned
   void             BkgFastJetb(Double_t& x,Double_t& y, Double_t& z);
   void             BkgFastJetWoHardest(Double_t& x,Double_t& y, Double_t& z);
   Float_t          BkgFastJet();
@@ -47,16 +53,18 @@ class AliFastJetBkg : public TObject
   static Double_t  BkgFunction(Double_t *x,Double_t *par);
     
  private:
-  Double_t         CalcRho(vector<fastjet::PseudoJet> input_particles,Double_t RparamBkg,TString method);
+  Double_t         CalcRho(const vector<fastjet::PseudoJet>& input_particles,Double_t RparamBkg,TString method);
   void             CalcRhob(Double_t& median, Double_t& sigma, Double_t& meanarea,
-			    vector<fastjet::PseudoJet> input_particles,Double_t RparamBkg,TString method);
+			    const vector<fastjet::PseudoJet>& input_particles,Double_t RparamBkg,TString method);
   void             CalcRhoWoHardest(Double_t& median, Double_t& sigma, Double_t& meanarea,
-				    vector<fastjet::PseudoJet> input_particles,Double_t RparamBkg,TString method);
+				    const vector<fastjet::PseudoJet>& input_particles,Double_t RparamBkg,TString method);
+  Bool_t           IsBkgClusterSequence(const fastjet::JetDefinition& jetDef, const fastjet::AreaDefinition& areaDef) const;
 
   AliJetHeader*    fHeader;  //! header
   AliFastJetInput* fInputFJ; //! input particles
+  fastjet::ClusterSequenceArea* fClustSeqBkg; //! clustering of the current event from the jet finder, reused for the bkg if the definitions match
 
-  ClassDef(AliFastJetBkg, 2)   //  Fastjet backgroud analysis
+  ClassDef(AliFastJetBkg, 3)   //  Fastjet backgroud analysis
  
 };
  
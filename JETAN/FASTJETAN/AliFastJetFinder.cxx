@@ -52,7 +52,9 @@ ClassImp(AliFastJetFinder)
 AliFastJetFinder::AliFastJetFinder():
   AliJetFinder(),
   fInputFJ(new AliFastJetInput()),
-  fJetBkg(new  AliFastJetBkg())
+  fJetBkg(new  AliFastJetBkg()),
+  fClustSeq(0),
+  fClustSeqBkg(0)
 {
   // Constructor
 }
@@ -61,6 +63,7 @@ AliFastJetFinder::AliFastJetFinder():
 AliFastJetFinder::~AliFastJetFinder()
 {
   // destructor
+  ResetClusterSequences();
   delete  fInputFJ;
   delete  fJetBkg;
 
@@ -80,7 +83,7 @@ void AliFastJetFinder::FindJets()
   // RUN ALGORITHM  
   // read input particles -----------------------------
 
-  vector<fastjet::PseudoJet> inputParticles=fInputFJ->GetInputParticles();
+  const vector<fastjet::PseudoJet>& inputParticles=fInputFJ->GetInputParticles();
   if(inputParticles.size()==0){
     if(debug>0) Printf("%s:%d No input particles found, skipping event",(char*)__FILE__,__LINE__);
     return;
@@ -109,7 +112,14 @@ void AliFastJetFinder::FindJets()
   
   //***************************** JETS FINDING
   // run the jet clustering with the above jet definition
-  fastjet::ClusterSequenceArea clust_seq(inputParticles, jetDef, areaDef);
+  // the cluster sequences are kept until the end of the event, to be reused for the background
+  ResetClusterSequences();
+  fClustSeq = new fastjet::ClusterSequenceArea(inputParticles, jetDef, areaDef);
+  fastjet::ClusterSequenceArea& clust_seq = *fClustSeq;
+
+  // the signal clustering can serve for rho if it uses the bkg jet definition
+  fastjet::JetDefinition jetDefBkg(header->GetBGAlgorithm(), rBkgParam, recombScheme, strategy);
+  if(jetDefBkg.description() == jetDef.description()) fClustSeqBkg = fClustSeq;
 
   vector<fastjet::PseudoJet> jets;
 
@@ -117,9 +127,8 @@ void AliFastJetFinder::FindJets()
     {
       //***************************** JETS FINDING FOR RHO ESTIMATION
       // run the jet clustering with the above jet definition
-      fastjet::JetAlgorithm algorithmBkg = header->GetBGAlgorithm();
-      fastjet::JetDefinition jetDefBkg(algorithmBkg, rBkgParam, recombScheme, strategy);
-      fastjet::ClusterSequenceArea clust_seq_bkg(inputParticles, jetDefBkg, areaDef);
+      if(!fClustSeqBkg) fClustSeqBkg = new fastjet::ClusterSequenceArea(inputParticles, jetDefBkg, areaDef);
+      fastjet::ClusterSequenceArea& clust_seq_bkg = *fClustSeqBkg;
 
       // save a comment in the header
       TString comment = "Running FastJet algorithm with the following setup. ";
@@ -218,14 +227,12 @@ void AliFastJetFinder::FindJets()
 	ind[i]=mPart.user_index();
 
 	// Jet constituents (charged tracks) added to the AliAODJet
+	// the user index is the position of the track in the CalTrk event
 	AliJetCalTrkEvent* calEvt  = GetCalTrkEvent();
-	for(Int_t itrack=0; itrack<calEvt->GetNCalTrkTracks(); itrack++)
+	if(ind[i]>=0 && ind[i]<calEvt->GetNCalTrkTracks())
 	  {
-	    if(itrack==ind[i])
-	      {
-		TObject *track = calEvt->GetCalTrkTrack(itrack)->GetTrackObject();
-		aodjet.AddTrack(track);
-	      }
+	    TObject *track = calEvt->GetCalTrkTrack(ind[i])->GetTrackObject();
+	    aodjet.AddTrack(track);
 	  }
       } // End loop on Constituents
 
@@ -345,6 +352,7 @@ Bool_t AliFastJetFinder::ProcessEvent()
 
     fJetBkg->SetHeader(fHeader);
     fJetBkg->SetFastJetInput(fInputFJ);
+    fJetBkg->SetBkgClusterSequence(fClustSeqBkg);
     
      Int_t count = 0;  
      if(header->GetBkgFastJetb()){
@@ -363,7 +371,21 @@ Bool_t AliFastJetFinder::ProcessEvent()
 
   }  
 
+  fJetBkg->SetBkgClusterSequence(0);
+  ResetClusterSequences();
   Reset();  
   return kTRUE;
 
 }
+
+//____________________________________________________________________________
+void AliFastJetFinder::ResetClusterSequences()
+{
+  // Delete the cluster sequences of the current event
+
+  if(fClustSeqBkg != fClustSeq) delete fClustSeqBkg;
+  delete fClustSeq;
+  fClustSeq = 0;
+  fClustSeqBkg = 0;
+
+}
@@ -53,10 +53,14 @@ class AliFastJetFinder : public AliJetFinder
   protected:
   AliFastJetFinder(const AliFastJetFinder& rfj);
   AliFastJetFinder& operator = (const AliFastJetFinder& rsfj);
+  void              ResetClusterSequences();
+
   AliFastJetInput*  fInputFJ;  //! input particles array
   AliFastJetBkg*    fJetBkg;   //! pointer to bkg class
+  fastjet::ClusterSequenceArea* fClustSeq;    //! clustering of the signal jets in the current event
+  fastjet::ClusterSequenceArea* fClustSeqBkg; //! clustering for rho in the current event, handed to the bkg class
 
-  ClassDef(AliFastJetFinder,3) //  Fastjet analysis class
+  ClassDef(AliFastJetFinder,4) //  Fastjet analysis class
 
 };
 
@@ -44,8 +44,7 @@ ClassImp(AliFastJetInput)
 AliFastJetInput::AliFastJetInput():
   fHeader(0x0),
   fCalTrkEvent(0x0),
-  fInputParticles(0),
-  fInputParticlesCh(0)
+  fInputParticles(0)
 {
   // Default constructor
 }
@@ -55,8 +54,7 @@ AliFastJetInput::AliFastJetInput(const AliFastJetInput &input):
   TObject(input),
   fHeader(input.fHeader),
   fCalTrkEvent(input.fCalTrkEvent),
-  fInputParticles(input.fInputParticles),
-  fInputParticlesCh(input.fInputParticlesCh)
+  fInputParticles(input.fInputParticles)
 {
   // copy constructor
 }
@@ -70,7 +68,6 @@ AliFastJetInput& AliFastJetInput::operator=(const AliFastJetInput& source)
    fHeader = source.fHeader;
    fCalTrkEvent = source.fCalTrkEvent;
    fInputParticles = source.fInputParticles;
-   fInputParticlesCh = source.fInputParticlesCh;
   }
 
   return *this;
@@ -87,38 +84,25 @@ void AliFastJetInput::FillInput()
 
   if(debug>0) cout<<"-------- AliFastJetInput::FillInput()  ----------------"<<endl;
 
+  // the buffer keeps its capacity, no reallocation once the largest event is seen
   fInputParticles.clear();
-  fInputParticlesCh.clear();
 
   // RUN ALGORITHM  
   // read input particles -----------------------------
-  vector<fastjet::PseudoJet> inputParticles;
-
   if(fCalTrkEvent == 0) { cout << "Could not get the CalTrk Event" << endl; return; }
   Int_t nIn =  fCalTrkEvent->GetNCalTrkTracks() ;
   if(nIn == 0) { if (debug>0) cout << "entries = 0 ; Event empty !!!" << endl ; return; }
+  fInputParticles.reserve(nIn);
 
   // Information extracted from fCalTrkEvent
-  // load input vectors and calculate total energy in array
-  Float_t px = -999., py = -999., pz = -999., en = -999.; 
- 
-  // Fill charged tracks
-  for(Int_t i = 0; i < fCalTrkEvent->GetNCalTrkTracks(); i++)
+  // Fill charged tracks (TPC+ITS), the only input, so that the same vector serves as charged input
+  for(Int_t i = 0; i < nIn; i++)
     { // loop for all input particles
-      if (fCalTrkEvent->GetCalTrkTrack(i)->GetCutFlag() != 1) continue;
-      px =  fCalTrkEvent->GetCalTrkTrack(i)->GetPx();
-      py =  fCalTrkEvent->GetCalTrkTrack(i)->GetPy();
-      pz =  fCalTrkEvent->GetCalTrkTrack(i)->GetPz();
-      en =  fCalTrkEvent->GetCalTrkTrack(i)->GetP();
-
-      fastjet::PseudoJet inputPart(px,py,pz,en);  // create PseudoJet object
-      inputPart.set_user_index(i);      //label the particle into Fastjet algortihm
-      fInputParticles.push_back(inputPart);       // back of the inputParticles vector
- 
-      // only for charged particles (TPC+ITS)
-      fastjet::PseudoJet inputPartCh(px,py,pz,en); // create PseudoJet object
-      inputPartCh.set_user_index(i);               //label the particle into Fastjet algortihm
-      fInputParticlesCh.push_back(inputPartCh);    // back of the inputParticles vector
+      AliJetCalTrkTrack *calTrk = fCalTrkEvent->GetCalTrkTrack(i);
+      if (calTrk->GetCutFlag() != 1) continue;
+
+      fInputParticles.push_back(fastjet::PseudoJet(calTrk->GetPx(),calTrk->GetPy(),calTrk->GetPz(),calTrk->GetP()));
+      fInputParticles.back().set_user_index(i);   //label the particle into Fastjet algortihm
     } // End loop on CalTrk
 
 }
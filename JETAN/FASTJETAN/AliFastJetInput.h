@@ -43,18 +43,17 @@ class AliFastJetInput : public TObject
   void                       SetHeader(AliJetHeader *header)            {fHeader=header;}
   void                       SetCalTrkEvent(AliJetCalTrkEvent *caltrk)  {fCalTrkEvent=caltrk;}
   void                       FillInput();
-  vector<fastjet::PseudoJet> GetInputParticles()   const                {return fInputParticles;}
-  vector<fastjet::PseudoJet> GetInputParticlesCh() const                {return fInputParticlesCh;}
+  const vector<fastjet::PseudoJet>& GetInputParticles()   const         {return fInputParticles;}
+  const vector<fastjet::PseudoJet>& GetInputParticlesCh() const         {return fInputParticles;} // only charged tracks in the input
   static Double_t            Thermalspectrum(const Double_t *x, const Double_t *par);
 
  private:
   AliJetHeader *fHeader;                        //! header 
   AliJetCalTrkEvent *fCalTrkEvent;              //! caltrkevent
    
-  vector<fastjet::PseudoJet> fInputParticles;   //! input particles for FastJet
-  vector<fastjet::PseudoJet> fInputParticlesCh; //! input charged particles for FastJet
+  vector<fastjet::PseudoJet> fInputParticles;   //! input particles for FastJet, buffer reused from event to event
 
-  ClassDef(AliFastJetInput, 2)                  //  fills input particles for FASTJET based analysis
+  ClassDef(AliFastJetInput, 3)                  //  fills input particles for FASTJET based analysis
     
 };
  
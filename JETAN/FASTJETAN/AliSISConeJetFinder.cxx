@@ -81,7 +81,7 @@ void AliSISConeJetFinder::FindJets()
   Bool_t bgMode               = header->GetBGMode();// Here one choose to subtract BG or not
 
   // Read input particles 
-  vector<fastjet::PseudoJet> inputParticles=fInputFJ->GetInputParticles();
+  const vector<fastjet::PseudoJet>& inputParticles=fInputFJ->GetInputParticles();
   if(inputParticles.size()==0){
     if(debug>0) Printf("%s:%d No input particles found, skipping event",(char*)__FILE__,__LINE__);
     return;
@@ -37,6 +37,7 @@
 #include <TKey.h>
 #include <TGrid.h>
 #include <TObjString.h>
+#include <TEnv.h>
 
 
 #include "AliAnalysisTaskFastEmbedding.h"
@@ -144,6 +145,13 @@ AliAnalysisTaskFastEmbedding::AliAnalysisTaskFastEmbedding()
   ,fNevents(0)
   ,fXsection(0)
   ,fAvgTrials(0)
+  ,fAODCacheSize(0)
+  ,fAsyncPrefetch(kFALSE)
+  ,fPrefetchCacheDir("")
+  ,fNExtraEventReuse(1)
+  ,fReuseRotatePhi(kFALSE)
+  ,fExtraEventUses(0)
+  ,fEmbBuffer()
   ,fHistList(0)
   ,fHistEvtSelection(0)
   ,fh1Xsec(0)
@@ -265,6 +273,13 @@ AliAnalysisTaskFastEmbedding::AliAnalysisTaskFastEmbedding(const char *name)
 ,fNevents(0)
 ,fXsection(0)
 ,fAvgTrials(0)
+,fAODCacheSize(0)
+,fAsyncPrefetch(kFALSE)
+,fPrefetchCacheDir("")
+,fNExtraEventReuse(1)
+,fReuseRotatePhi(kFALSE)
+,fExtraEventUses(0)
+,fEmbBuffer()
 ,fHistList(0)
 ,fHistEvtSelection(0)
 ,fh1Xsec(0)
@@ -386,6 +401,13 @@ AliAnalysisTaskFastEmbedding::AliAnalysisTaskFastEmbedding(const AliAnalysisTask
 ,fNevents(copy.fNevents)
 ,fXsection(copy.fXsection)
 ,fAvgTrials(copy.fAvgTrials)
+,fAODCacheSize(copy.fAODCacheSize)
+,fAsyncPrefetch(copy.fAsyncPrefetch)
+,fPrefetchCacheDir(copy.fPrefetchCacheDir)
+,fNExtraEventReuse(copy.fNExtraEventReuse)
+,fReuseRotatePhi(copy.fReuseRotatePhi)
+,fExtraEventUses(copy.fExtraEventUses)
+,fEmbBuffer(copy.fEmbBuffer)
 ,fHistList(copy.fHistList)
 ,fHistEvtSelection(copy.fHistEvtSelection)
 ,fh1Xsec(copy.fh1Xsec)
@@ -513,6 +535,13 @@ AliAnalysisTaskFastEmbedding& AliAnalysisTaskFastEmbedding::operator=(const AliA
       fNevents           = o.fNevents;
       fXsection          = o.fXsection;
       fAvgTrials         = o.fAvgTrials;
+      fAODCacheSize      = o.fAODCacheSize;
+      fAsyncPrefetch     = o.fAsyncPrefetch;
+      fPrefetchCacheDir  = o.fPrefetchCacheDir;
+      fNExtraEventReuse  = o.fNExtraEventReuse;
+      fReuseRotatePhi    = o.fReuseRotatePhi;
+      fExtraEventUses    = o.fExtraEventUses;
+      fEmbBuffer         = o.fEmbBuffer;
       fHistList          = o.fHistList;
       fHistEvtSelection  = o.fHistEvtSelection;
       fh1Xsec            = o.fh1Xsec;
@@ -606,7 +635,7 @@ void AliAnalysisTaskFastEmbedding::UserCreateOutputObjects()
 
 
    // embed mode with AOD
-   if(fEmbedMode==kAODFull || fEmbedMode==kAODJetTracks || fEmbedMode==kAODJet4Mom){
+   if(fEmbedMode==kAODFull || fEmbedMode==kAODJetTracks || fEmbedMode==kAODJet4Mom || fEmbedMode==kAODCompactTracks){
 
       // open input AOD
       fFileId = OpenAODfile();
@@ -1153,7 +1182,9 @@ void AliAnalysisTaskFastEmbedding::UserExec(Option_t *)
       PostData(1, fHistList);
       return;
    }
-   tracks->Delete();
+   // compact records reuse the track objects of the previous event
+   if(fEmbedMode==kAODCompactTracks) tracks->Clear();
+   else                              tracks->Delete();
    Int_t nAODtracks=0;
 
    TClonesArray *extrav0s = (TClonesArray*)(fAODout->FindListObject("aodExtraV0s"));
@@ -1218,7 +1249,7 @@ void AliAnalysisTaskFastEmbedding::UserExec(Option_t *)
    TRef dummy;
 
    // === embed mode with AOD ===
-   if(fEmbedMode==kAODFull || fEmbedMode==kAODJetTracks || fEmbedMode==kAODJet4Mom){
+   if(fEmbedMode==kAODFull || fEmbedMode==kAODJetTracks || fEmbedMode==kAODJet4Mom || fEmbedMode==kAODCompactTracks){
       if(!fAODevent){
          AliError("Need input AOD, but is not connected."); 
          PostData(1, fHistList);
@@ -1227,7 +1258,11 @@ void AliAnalysisTaskFastEmbedding::UserExec(Option_t *)
 
       //essential part of PYTHIA embedding -> randomly picked PYTHIA event is checked, if good it is attached to PbPb real data event in AliAOD.root output file, if not the next PYTHIA event is randomly picked and checked 
 
-      Bool_t useEntry = kFALSE;
+      // kAODCompactTracks: the current extra event is embedded again from the buffer
+      Bool_t reuseEntry = (fEmbedMode==kAODCompactTracks && fExtraEventUses>0 && fExtraEventUses<fNExtraEventReuse);
+      if(!reuseEntry) fExtraEventUses = 0;
+
+      Bool_t useEntry = reuseEntry;
       while(!useEntry){  // protection needed, if no (PYTHIA?) event fulfills requirement
 
          fAODEntry++; // go to next event 
@@ -1741,6 +1776,17 @@ void AliAnalysisTaskFastEmbedding::UserExec(Option_t *)
       } // end: embed jets as 4-momenta
 
 
+      if(fEmbedMode==kAODCompactTracks){
+
+         if(!reuseEntry) FillEmbeddingBuffer();
+         Double_t dPhi = 0.;
+         if(fReuseRotatePhi && fNExtraEventReuse>1) dPhi = TMath::TwoPi()*fExtraEventUses/fNExtraEventReuse;
+         nAODtracks = EmbedFromBuffer(tracks, dPhi);
+         fExtraEventUses++;
+
+      } // end: embed compact track records
+
+
    } //end: embed mode with AOD
 
 
@@ -1909,6 +1955,9 @@ Int_t AliAnalysisTaskFastEmbedding::OpenAODfile(Int_t trial)
      TGrid::Connect("alien://");
    }
 
+   // blocks prefetched in the background are kept in the local cache directory
+   if(fAsyncPrefetch && fPrefetchCacheDir.Length()) TFile::SetCacheFileDir(fPrefetchCacheDir.Data());
+
    TDirectory *owd = gDirectory;
    if (fAODfile && fAODfile->IsOpen()) fAODfile->Close();
    fAODfile = TFile::Open(fAODPath.Data(),"TIMEOUT=180");
@@ -1972,6 +2021,20 @@ Int_t AliAnalysisTaskFastEmbedding::OpenAODfile(Int_t trial)
       fAODtree->SetBranchStatus("mcHeader*",1);
    */
 
+   // the prefetching thread is started with the TTreeCache, only for the extra AODs
+   if(fAODCacheSize>0 || fAsyncPrefetch){
+      Int_t oldPrefetch = gEnv->GetValue("TFile.AsyncPrefetching", 0);
+      if(fAsyncPrefetch) gEnv->SetValue("TFile.AsyncPrefetching", 1);
+      Long64_t cacheSize = fAODCacheSize>0 ? fAODCacheSize : 30000000;
+      fAODtree->SetCacheSize(cacheSize);
+      fAODtree->SetCacheLearnEntries(10);
+      if(fAODtreeJets){
+         fAODtreeJets->SetCacheSize(cacheSize);
+         fAODtreeJets->SetCacheLearnEntries(10);
+      }
+      gEnv->SetValue("TFile.AsyncPrefetching", oldPrefetch);
+   }
+
    delete fAODevent;
    fAODevent = new AliAODEvent();
    fAODevent->ReadFromTree(fAODtree);
@@ -2018,11 +2081,89 @@ Int_t AliAnalysisTaskFastEmbedding::OpenAODfile(Int_t trial)
    }
 
    fCountEvents=0; // new file, reset counter
+   fExtraEventUses=0;
 
    return fFileId;  // file position in AOD path array, if array available
 }
 
 
+//__________________________________________________________________________
+void AliAnalysisTaskFastEmbedding::FillEmbeddingBuffer()
+{
+   // copy the kinematic record of all tracks of the current extra event
+
+   fEmbBuffer.clear();
+   Int_t nTracks = fAODevent->GetNumberOfTracks();
+   fEmbBuffer.reserve(nTracks);
+   for(Int_t it=0; it<nTracks; ++it){
+      AliAODTrack *tr = dynamic_cast<AliAODTrack*>(fAODevent->GetTrack(it));
+      if(!tr) continue;
+      EmbTrack_t rec;
+      rec.fPt           = tr->Pt();
+      rec.fPhi          = tr->Phi();
+      rec.fTheta        = tr->Theta();
+      rec.fCharge       = tr->Charge();
+      rec.fID           = tr->GetID();
+      rec.fLabel        = tr->GetLabel();
+      rec.fFilterMap    = tr->GetFilterMap();
+      rec.fStatus       = tr->GetStatus();
+      rec.fType         = tr->GetType();
+      rec.fHybridTPC    = tr->IsHybridTPCConstrainedGlobal();
+      rec.fHybridGlobal = tr->IsHybridGlobalConstrainedGlobal();
+      fEmbBuffer.push_back(rec);
+   }
+}
+
+//__________________________________________________________________________
+Int_t AliAnalysisTaskFastEmbedding::EmbedFromBuffer(TClonesArray *tracks, Double_t dPhi)
+{
+   // write the buffered tracks (rotated by dPhi) to the extra track branch,
+   // with the same efficiency dicing as kAODFull
+   // returns the nb. of embedded tracks
+
+   TRef dummy;
+   Int_t nAODtracks = 0;
+   Int_t nTracks = fEmbBuffer.size();
+   fh1TrackN->Fill((Float_t)nTracks);
+
+   for(Int_t it=0; it<nTracks; ++it){
+      const EmbTrack_t &rec = fEmbBuffer[it];
+      Double_t rd=rndm->Uniform(0.,1.);
+      if(rd>fExtraEffPb) continue;
+      if(fDiceMapEff==kTRUE){
+         Double_t pTtmp=rec.fPt;
+         if(pTtmp>100) pTtmp=100;
+         Double_t efffrac=fhEffH1->GetBinContent(fhEffH1->FindBin(pTtmp));
+         if(rd>efffrac) continue;
+      }
+      Double_t phi = rec.fPhi;
+      if(dPhi!=0.) phi = TVector2::Phi_0_2pi(phi+dPhi);
+
+      // objects of the previous event are reused, all fields read by the jet finders are set
+      AliAODTrack *tr = (AliAODTrack*)tracks->ConstructedAt(nAODtracks++);
+      tr->SetPt(rec.fPt);
+      tr->SetPhi(phi);
+      tr->SetTheta(rec.fTheta);
+      tr->SetCharge(rec.fCharge);
+      tr->SetID(rec.fID);
+      tr->SetLabel(rec.fLabel);
+      tr->SetFilterMap(rec.fFilterMap);
+      tr->SetFlags(rec.fStatus | AliESDtrack::kEmbedded);
+      tr->SetType((AliAODTrack::AODTrk_t)rec.fType);
+      tr->SetIsHybridTPCConstrainedGlobal(rec.fHybridTPC);
+      tr->SetIsHybridGlobalConstrainedGlobal(rec.fHybridGlobal);
+      dummy = tr;
+
+      if(fTrackFilterMap<=0 || tr->TestFilterBit(fTrackFilterMap)){
+         if(rec.fPt>0.15 && TMath::Abs(tr->Eta())<0.9) fh1TrackPt->Fill(rec.fPt);
+         if(rec.fPt>0.15 && TMath::Abs(tr->Eta())<0.9) fh2TrackEtaPhi->Fill(tr->Eta(), phi);
+      }
+   }
+
+   return nAODtracks;
+}
+
+
 //____________________________________________________________________________
 Float_t AliAnalysisTaskFastEmbedding::GetPtHard(Bool_t bSet, Float_t newValue){
 
@@ -6,6 +6,7 @@
 
 /* $Id$ */
 
+#include <vector>
 #include "AliAnalysisTaskSE.h"
 
 class AliAODv0;
@@ -23,6 +24,7 @@ class TH1F;
 class TH2F;
 class TString;
 class TList;
+class TClonesArray;
 class TProfile;
 class AliAODMCHeader;
 class AliAODJet;
@@ -92,6 +94,10 @@ public:
       fToyMinTrackEta = minEta; fToyMaxTrackEta = maxEta;
       fToyMinTrackPhi = minPhi; fToyMaxTrackPhi = maxPhi;}
    void SetToyFilterMap(UInt_t f) {fToyFilterMap = f;}
+   // TTreeCache of the extra AOD trees, with background prefetching of the baskets (and local copies in cacheDir)
+   void SetAODCacheSize(Long64_t size = 30000000, Bool_t asyncPrefetch = kTRUE, TString cacheDir = "") {fAODCacheSize = size; fAsyncPrefetch = asyncPrefetch; fPrefetchCacheDir = cacheDir;}
+   // kAODCompactTracks: embed each extra event into n consecutive events, the k-th use rotated by 2pi*k/n in phi if rotatePhi
+   void SetExtraEventReuse(Int_t n = 1, Bool_t rotatePhi = kFALSE) {fNExtraEventReuse = n; fReuseRotatePhi = rotatePhi;}
    void SetTrackFilterMap(UInt_t f) {fTrackFilterMap = f;}
 
    //AZ
@@ -120,7 +126,7 @@ public:
    virtual void SetEfficiencyMap(TH1 *h1);
 
    // embedding modes
-   enum {kAODFull=0, kAODJetTracks, kAODJet4Mom, kToyTracks};
+   enum {kAODFull=0, kAODJetTracks, kAODJet4Mom, kToyTracks, kAODCompactTracks};
    // event selection from AOD
    enum {kEventsAll=0, kEventsJetPt};
 
@@ -223,6 +229,29 @@ private:
    Float_t       fXsection;     // average xsection of the event
    Float_t       fAvgTrials;    // average number of trials per event
 
+   // compact embedding and reading of the extra AODs
+   struct EmbTrack_t {          // kinematic record of an extra track, as used by the jet finders
+      Float_t  fPt;             // transverse momentum
+      Float_t  fPhi;            // azimuth
+      Float_t  fTheta;          // polar angle
+      Short_t  fCharge;         // charge
+      Short_t  fID;             // track ID
+      Int_t    fLabel;          // MC label
+      UInt_t   fFilterMap;      // filter bits
+      ULong_t  fStatus;         // status flags
+      Char_t   fType;           // AliAODTrack::AODTrk_t
+      Bool_t   fHybridTPC;      // IsHybridTPCConstrainedGlobal
+      Bool_t   fHybridGlobal;   // IsHybridGlobalConstrainedGlobal
+   };
+
+   Long64_t fAODCacheSize;      // TTreeCache size for the extra AOD trees (0: ROOT default)
+   Bool_t   fAsyncPrefetch;     // prefetch the baskets of the extra AODs on a background thread
+   TString  fPrefetchCacheDir;  // local directory to cache the prefetched blocks ("": no local copies)
+   Int_t    fNExtraEventReuse;  // nb. of events an extra event is embedded into (kAODCompactTracks)
+   Bool_t   fReuseRotatePhi;    // rotate the reused extra event in phi by 2pi*k/fNExtraEventReuse
+   Int_t    fExtraEventUses;    //! nb. of events the current extra event was embedded into
+   std::vector<EmbTrack_t> fEmbBuffer; //! tracks of the current extra event (kAODCompactTracks)
+
 
    // histos
    TList *fHistList;          //  list of histograms
@@ -270,9 +299,11 @@ private:
    Int_t GetJobID();    // get job id (sub-job id on the GRID)
    Int_t SelectAODfile();
    Int_t OpenAODfile(Int_t trial = 0);
+   void  FillEmbeddingBuffer();
+   Int_t EmbedFromBuffer(TClonesArray *tracks, Double_t dPhi);
 
 
-   ClassDef(AliAnalysisTaskFastEmbedding, 6);
+   ClassDef(AliAnalysisTaskFastEmbedding, 7);
 };
 
 #endif
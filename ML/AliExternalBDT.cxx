@@ -13,9 +13,13 @@
 #include "AliExternalBDT.h"
 
 #include <cassert>
+#include <cmath>
 #include <iostream>
+#include <map>
+#include <mutex>
 #include <stdio.h>
 #include <stdlib.h>
+#include <TMD5.h>
 #include <TSystem.h>
 
 namespace {
@@ -28,6 +32,35 @@ namespace {
       return false;
     }
   }
+
+  /// compiler settings, they enter the cache key of the compiled models
+  const std::string kCompilerName{"ast_native"};
+  const std::string kCompilerFlags{"-O1 -fPIC"};
+
+  /// predictor shared by all the AliExternalBDT instances loading the same model
+  struct PredictorCacheEntry {
+    PredictorHandle predictor;
+    std::size_t outSize;
+    std::size_t numFeatures;
+    int refCount;
+  };
+
+  std::map<std::string, PredictorCacheEntry> &predictorCache() {
+    static std::map<std::string, PredictorCacheEntry> cache;
+    return cache;
+  }
+
+  std::mutex &predictorCacheMutex() {
+    static std::mutex mutex;
+    return mutex;
+  }
+
+  std::string md5String(const std::string &input) {
+    TMD5 md5;
+    md5.Update(reinterpret_cast<const UChar_t *>(input.data()), input.size());
+    md5.Final();
+    return md5.AsString();
+  }
 }
 
 AliExternalBDT::AliExternalBDT(std::string name) :
@@ -38,50 +71,132 @@ AliExternalBDT::AliExternalBDT(std::string name) :
   fCompiler{},
   fPredictor{},
   fOutSize{0u},
-  fNumFeatures{0u}
+  fNumFeatures{0u},
+  fCacheKey{""},
+  fEntries{},
+  fOutput{}
 {
   gSystem->Setenv("TREELITE_BIND_THREADS","0");
 }
 
+AliExternalBDT::AliExternalBDT(const AliExternalBDT &source) :
+  fBDTname{source.fBDTname},
+  fModel{},
+  fModelPath{source.fModelPath},
+  fModelName{source.fModelName},
+  fCompiler{},
+  fPredictor{},
+  fOutSize{0u},
+  fNumFeatures{0u},
+  fCacheKey{""},
+  fEntries{},
+  fOutput{}
+{
+  AcquireCachedPredictor(source.fCacheKey);
+}
+
+AliExternalBDT &AliExternalBDT::operator=(const AliExternalBDT &source) {
+  if (&source == this) return *this;
+
+  ReleasePredictor();
+  fBDTname = source.fBDTname;
+  fModelPath = source.fModelPath;
+  fModelName = source.fModelName;
+  AcquireCachedPredictor(source.fCacheKey);
+
+  return *this;
+}
+
+AliExternalBDT::~AliExternalBDT() {
+  ReleasePredictor();
+}
+
+bool AliExternalBDT::AcquireCachedPredictor(const std::string &key) {
+  if (key.empty()) return false;
+
+  std::lock_guard<std::mutex> lock(predictorCacheMutex());
+  auto entry = predictorCache().find(key);
+  if (entry == predictorCache().end()) return false;
+
+  entry->second.refCount++;
+  fCacheKey = key;
+  fPredictor = entry->second.predictor;
+  fOutSize = entry->second.outSize;
+  fNumFeatures = entry->second.numFeatures;
+  return true;
+}
+
+void AliExternalBDT::ReleasePredictor() {
+  if (fCacheKey.empty()) return;
+
+  std::lock_guard<std::mutex> lock(predictorCacheMutex());
+  auto entry = predictorCache().find(fCacheKey);
+  if (entry != predictorCache().end() && --entry->second.refCount == 0) {
+    TreelitePredictorFree(entry->second.predictor);
+    predictorCache().erase(entry);
+  }
+  fCacheKey.clear();
+  fPredictor = PredictorHandle{};
+  fOutSize = 0u;
+  fNumFeatures = 0u;
+}
+
+std::string AliExternalBDT::ComputeCacheKey(const std::string &path, int type) {
+  // the key is built from the content of the model and the compiler settings, so that
+  // identical models loaded from different locations share the same compiled library
+  TMD5 *fileMD5 = TMD5::FileChecksum(path.data());
+  std::string content = fileMD5 ? fileMD5->AsString() : path;
+  delete fileMD5;
+  return md5String(content + "_" + std::to_string(type) + "_" + kCompilerName + "_" + kCompilerFlags);
+}
+
+std::string AliExternalBDT::GetCacheDirectory() {
+  const char *cacheDir = gSystem->Getenv("ALIML_MODEL_CACHE_DIR");
+  if (cacheDir && cacheDir[0] != '\0') return cacheDir;
+  return std::string(gSystem->TempDirectory()) + "/aliml_model_cache";
+}
 
 bool AliExternalBDT::CompileAndLoadModelLibrary() {
   std::string path = GetUniquePath();
-  if (checkFile(path + "/main.so")) {
-    std::cout << "Library found: " << path.data() << "/main.so . Loading it!" << std::endl;
-  } else {
-    std::cout << "Starting the model compilation, depending on the model size it can take a while..." << std::endl;
-    system((std::string("gcc -c -O1 -fPIC ") + path + "/main.c -o " + path + "/main.o && gcc -shared " + path + \
-          "/main.o -o " + path + "/main.so").data());
+  std::string workPath = path + "_tmp" + std::to_string(gSystem->GetPid());
+  std::cout << "Starting the model compilation, depending on the model size it can take a while..." << std::endl;
+  // the library is compiled in a private folder and then moved to the cache, so that concurrent
+  // jobs on the same node never load a partially written library
+  const int status = system((std::string("gcc -c ") + kCompilerFlags + " " + workPath + "/main.c -o " + workPath + "/main.o && gcc -shared " + \
+        workPath + "/main.o -o " + workPath + "/main.so").data());
+  if (status != 0 || !checkFile(workPath + "/main.so")) {
+    std::cerr << "Model compilation failed (status " << status << ")" << std::endl;
+    system((std::string("rm -rf ") + workPath).data());
+    return false;
   }
-  return LoadModelLibrary(path + "/main.so");
+  gSystem->mkdir(path.data(), kTRUE);
+  if (!checkFile(path + "/main.so")) {
+    gSystem->Rename((workPath + "/main.so").data(), (path + "/main.so").data());
+  }
+  system((std::string("rm -rf ") + workPath).data());
+  return LoadLibraryWithKey(path + "/main.so", fCacheKey);
 }
 
 bool AliExternalBDT::CreateModelCode() {
-  std::string path = GetUniquePath();
-  if (checkFile(path + "/main.c")) {
-    std::cout << "Code found: " << path.data() << "/main.c . \
-      Remove it or unset/change the AliExternalBDT name to force its regeneration." << std::endl;
-  } else {
-    const int status_comp = TreeliteCompilerCreate("ast_native", &fCompiler);
-    if (status_comp != 0) {
-      std::cerr << "Compiler creation failed." << std::endl;
-      return false;
-    }
-    const int status_gen = TreeliteCompilerGenerateCode(fCompiler, fModel, 1, path.data());
-    if (status_gen != 0) {
-      std::cerr << "Code generation failed." << std::endl;
-      return false;
-    }
+  std::string workPath = GetUniquePath() + "_tmp" + std::to_string(gSystem->GetPid());
+  gSystem->mkdir(workPath.data(), kTRUE);
+  const int status_comp = TreeliteCompilerCreate(kCompilerName.data(), &fCompiler);
+  if (status_comp != 0) {
+    std::cerr << "Compiler creation failed." << std::endl;
+    return false;
+  }
+  const int status_gen = TreeliteCompilerGenerateCode(fCompiler, fModel, 1, workPath.data());
+  TreeliteCompilerFree(fCompiler);
+  fCompiler = CompilerHandle{};
+  if (status_gen != 0) {
+    std::cerr << "Code generation failed." << std::endl;
+    return false;
   }
   return true;
 }
 
 std::string AliExternalBDT::GetUniquePath() {
-  if (fBDTname.empty()) {
-    return fModelName + std::to_string((unsigned long)this);
-  } else {
-    return fBDTname + "_" + fModelName;
-  }
+  return GetCacheDirectory() + "/" + fCacheKey;
 }
 
 bool AliExternalBDT::LoadModel(const std::string &path, int type) {
@@ -96,8 +211,24 @@ bool AliExternalBDT::LoadModel(const std::string &path, int type) {
     return LoadModelLibrary(path);
   }
 
+  ReleasePredictor();
   fModelPath = path;
   fModelName = fModelPath.substr(fModelPath.find_last_of("\\/")+1,fModelPath.size());
+
+  // model already compiled and loaded by another instance in this process
+  const std::string key = ComputeCacheKey(fModelPath, type);
+  if (AcquireCachedPredictor(key)) {
+    std::cout << "Model " << fModelName << " already loaded, sharing its predictor" << std::endl;
+    return true;
+  }
+  fCacheKey = key;
+
+  // model already compiled by a previous job on this node
+  if (checkFile(GetUniquePath() + "/main.so")) {
+    std::cout << "Library found: " << GetUniquePath() << "/main.so . Loading it!" << std::endl;
+    return LoadLibraryWithKey(GetUniquePath() + "/main.so", key);
+  }
+
   int status = 0;
   switch (type) {
     case 0:
@@ -108,14 +239,22 @@ bool AliExternalBDT::LoadModel(const std::string &path, int type) {
       break;
     default:
       std::cerr << "Invalid model type" << std::endl;
+      fCacheKey.clear();
       return false;
   }
   if (status != 0) {
     std::cerr << "Model loading failed" << std::endl;
+    fCacheKey.clear();
+    return false;
+  }
+  // the model is not needed anymore once the code is generated
+  const bool codeCreated = CreateModelCode();
+  TreeliteFreeModel(fModel);
+  fModel = ModelHandle{};
+  if (!codeCreated || !CompileAndLoadModelLibrary()) {
+    fCacheKey.clear();
     return false;
   }
-  if (!CreateModelCode()) return false;
-  if (!CompileAndLoadModelLibrary()) return false;
   return true;
 }
 
@@ -130,34 +269,82 @@ bool AliExternalBDT::LoadLightGBMModel(std::string path) {
 }
 
 bool AliExternalBDT::LoadModelLibrary(std::string path) {
-  const int status = TreelitePredictorLoad(path.data(), 1, &fPredictor);
+  ReleasePredictor();
+  const std::string key = ComputeCacheKey(path, 2);
+  if (AcquireCachedPredictor(key)) return true;
+  return LoadLibraryWithKey(path, key);
+}
 
-  TreelitePredictorQueryResultSizeSingleInst(fPredictor, &fOutSize);
-  TreelitePredictorQueryNumFeature(fPredictor, &fNumFeatures);
+bool AliExternalBDT::LoadLibraryWithKey(const std::string &path, const std::string &key) {
+  if (AcquireCachedPredictor(key)) return true;
 
+  const int status = TreelitePredictorLoad(path.data(), 1, &fPredictor);
   if (status != 0) {
     std::cerr << "Library loading failed" << std::endl;
+    fCacheKey.clear();
     return false;
   }
+
+  TreelitePredictorQueryResultSizeSingleInst(fPredictor, &fOutSize);
+  TreelitePredictorQueryNumFeature(fPredictor, &fNumFeatures);
+
+  std::lock_guard<std::mutex> lock(predictorCacheMutex());
+  auto inserted = predictorCache().emplace(key, PredictorCacheEntry{fPredictor, fOutSize, fNumFeatures, 1});
+  if (!inserted.second) {
+    // another instance loaded the same library in the meantime: use its predictor
+    TreelitePredictorFree(fPredictor);
+    PredictorCacheEntry &entry = inserted.first->second;
+    entry.refCount++;
+    fPredictor = entry.predictor;
+    fOutSize = entry.outSize;
+    fNumFeatures = entry.numFeatures;
+  }
+  fCacheKey = key;
   return true;
 }
 
 bool AliExternalBDT::Predict(double *features, int size, std::vector<double> &outputScores, bool useRawScore) {
-  std::vector<TreelitePredictorEntry> entries(size);
-  for (std::size_t iEntry = 0; iEntry < entries.size(); ++iEntry) {
-    entries[iEntry].fvalue = static_cast<float>(features[iEntry]);
+  // scratch buffers are kept across calls to avoid per-candidate allocations
+  if (fEntries.size() < static_cast<std::size_t>(size)) fEntries.resize(size);
+  for (int iEntry = 0; iEntry < size; ++iEntry) {
+    fEntries[iEntry].fvalue = static_cast<float>(features[iEntry]);
   }
 
-  std::vector<float> output(fOutSize);
-  int predict = TreelitePredictorPredictInst(fPredictor, entries.data(),
-      static_cast<int>(useRawScore), &output[0],
-      &fOutSize);
+  if (fOutput.size() < fOutSize) fOutput.resize(fOutSize);
+  std::size_t outSize = fOutSize;
+  int predict = TreelitePredictorPredictInst(fPredictor, fEntries.data(),
+      static_cast<int>(useRawScore), fOutput.data(),
+      &outSize);
   if(predict<0)
     return false;
 
-  for (std::size_t iEntry = 0; iEntry < fOutSize; ++iEntry) {
-    outputScores.push_back(static_cast<double>(output[iEntry]));
+  for (std::size_t iEntry = 0; iEntry < outSize; ++iEntry) {
+    outputScores.push_back(static_cast<double>(fOutput[iEntry]));
   }
 
   return true;
 }
+
+bool AliExternalBDT::PredictBatch(const float *rowMajor, std::size_t nRows, std::vector<double> &outputScores, bool useRawScore) {
+  if (nRows == 0) return true;
+
+  DenseBatchHandle batch;
+  if (TreeliteAssembleDenseBatch(rowMajor, std::nanf(""), nRows, fNumFeatures, &batch) != 0) {
+    std::cerr << "Dense batch creation failed" << std::endl;
+    return false;
+  }
+
+  std::size_t resultSize = 0;
+  TreelitePredictorQueryResultSize(fPredictor, batch, 0, &resultSize);
+  if (fOutput.size() < resultSize) fOutput.resize(resultSize);
+
+  std::size_t outSize = 0;
+  int predict = TreelitePredictorPredictBatch(fPredictor, batch, 0, 0, static_cast<int>(useRawScore),
+      fOutput.data(), &outSize);
+  TreeliteDeleteDenseBatch(batch);
+  if (predict != 0)
+    return false;
+
+  outputScores.insert(outputScores.end(), fOutput.begin(), fOutput.begin() + outSize);
+  return true;
+}
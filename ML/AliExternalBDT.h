@@ -23,21 +23,33 @@
 class AliExternalBDT {
 public:
   AliExternalBDT(std::string name = "");
-  virtual ~AliExternalBDT(){};
+  AliExternalBDT(const AliExternalBDT &source);
+  AliExternalBDT &operator=(const AliExternalBDT &source);
+  virtual ~AliExternalBDT();
 
   bool LoadLightGBMModel(std::string path);
   bool LoadModelLibrary(std::string path);
   bool LoadXGBoostModel(std::string path);
 
   bool Predict(double *features, int size, std::vector<double> &outputScores, bool useRaw = false);
+  /// Evaluate nRows candidates stored row-major (nRows x GetNumberOfFeatures()) in a single call.
+  /// The scores are appended to outputScores (nRows x GetOutputSize(), row-major)
+  bool PredictBatch(const float *rowMajor, std::size_t nRows, std::vector<double> &outputScores, bool useRaw = false);
 
   std::size_t GetOutputSize() const {return fOutSize;}
   std::size_t GetNumberOfFeatures() const {return fNumFeatures;}
 
+  /// Folder where the compiled models are cached, $ALIML_MODEL_CACHE_DIR if set
+  static std::string GetCacheDirectory();
+
 private:
+  bool AcquireCachedPredictor(const std::string &key);
+  void ReleasePredictor();
+  static std::string ComputeCacheKey(const std::string &path, int type);
   bool CompileAndLoadModelLibrary();
   bool CreateModelCode();
   std::string GetUniquePath();
+  bool LoadLibraryWithKey(const std::string &path, const std::string &key);
   bool LoadModel(const std::string &path, int type);
 
   std::string fBDTname;       /// Unique name of this external BDT handler
@@ -48,6 +60,10 @@ private:
   PredictorHandle fPredictor;
   std::size_t fOutSize;
   std::size_t fNumFeatures;
+  std::string fCacheKey;      /// Key of the shared predictor (model content + compiler settings)
+
+  std::vector<TreelitePredictorEntry> fEntries; /// scratch buffer for single-instance predictions
+  std::vector<float> fOutput;                    /// scratch buffer for predictor output
 };
 
 #endif
@@ -88,9 +88,9 @@ AliMLModelHandler::AliMLModelHandler(const AliMLModelHandler &source)
     : TNamed(source.GetName(), source.GetTitle()), fModel{nullptr}, fPath{source.fPath},
       fLibrary{source.fLibrary}, fScoreCut{source.fScoreCut}, fScoreCutOpt{source.fScoreCutOpt} {
   //
-  // Copy constructor
+  // Copy constructor, the compiled predictor is shared with the source
   //
-  fModel = new AliExternalBDT(*source.fModel);
+  fModel = source.fModel ? new AliExternalBDT(*source.fModel) : new AliExternalBDT();
 }
 
 AliMLModelHandler &AliMLModelHandler::operator=(const AliMLModelHandler &source) {
@@ -103,7 +103,7 @@ AliMLModelHandler &AliMLModelHandler::operator=(const AliMLModelHandler &source)
 
   if(fModel)
     delete fModel;
-  fModel = new AliExternalBDT(*source.fModel);
+  fModel = source.fModel ? new AliExternalBDT(*source.fModel) : new AliExternalBDT();
 
   fPath        = source.fPath;
   fLibrary     = source.fLibrary;
@@ -115,6 +115,8 @@ AliMLModelHandler &AliMLModelHandler::operator=(const AliMLModelHandler &source)
 
 //_______________________________________________________________________________
 bool AliMLModelHandler::CompileModel() {
+  // models with the same content are compiled once per node and loaded once per process,
+  // see AliExternalBDT::GetCacheDirectory
 
   std::map<std::string, int> libraryMap = {{"kXGBoost", AliMLModelHandler::kXGBoost}, 
                                            {"kLightGBM", AliMLModelHandler::kLightGBM},
@@ -12,6 +12,8 @@
 
 #include "AliMLResponse.h"
 
+#include <algorithm>
+
 #include "yaml-cpp/yaml.h"
 
 #include "AliExternalBDT.h"
@@ -29,7 +31,7 @@ ClassImp(AliMLResponse);
 //_______________________________________________________________________________
 AliMLResponse::AliMLResponse()
     : TNamed(), fConfigFilePath{}, fModels{}, fCentClasses{}, fBins{}, fVariableNames{}, fNBins{}, fNVariables{},
-      fBinsBegin{}, fRaw{} {
+      fBinsBegin{}, fVarIndices{}, fFeatures{}, fScores{}, fRaw{}, fBatchFeatures{}, fBatchCandidates{}, fBatchScores{}, fBatchBins{} {
   //
   // Default constructor
   //
@@ -38,7 +40,7 @@ AliMLResponse::AliMLResponse()
 //_______________________________________________________________________________
 AliMLResponse::AliMLResponse(const Char_t *name, const Char_t *title)
     : TNamed(name, title), fConfigFilePath{""}, fModels{}, fCentClasses{}, fBins{}, fVariableNames{}, fNBins{},
-      fNVariables{}, fBinsBegin{}, fRaw{} {
+      fNVariables{}, fBinsBegin{}, fVarIndices{}, fFeatures{}, fScores{}, fRaw{}, fBatchFeatures{}, fBatchCandidates{}, fBatchScores{}, fBatchBins{} {
   //
   // Standard constructor
   //
@@ -55,7 +57,9 @@ AliMLResponse::~AliMLResponse() {
 AliMLResponse::AliMLResponse(const AliMLResponse &source)
     : TNamed(source.GetName(), source.GetTitle()), fConfigFilePath{source.fConfigFilePath}, fModels{source.fModels},
       fCentClasses{source.fCentClasses}, fBins{source.fBins}, fVariableNames{source.fVariableNames},
-      fNBins{source.fNBins}, fNVariables{source.fNVariables}, fBinsBegin{source.fBinsBegin}, fRaw{source.fRaw} {
+      fNBins{source.fNBins}, fNVariables{source.fNVariables}, fBinsBegin{source.fBinsBegin},
+      fVarIndices{source.fVarIndices}, fFeatures{}, fScores{}, fRaw{source.fRaw},
+      fBatchFeatures{}, fBatchCandidates{}, fBatchScores{}, fBatchBins{} {
   //
   // Copy constructor
   //
@@ -77,6 +81,7 @@ AliMLResponse &AliMLResponse::operator=(const AliMLResponse &source) {
   fNBins          = source.fNBins;
   fNVariables     = source.fNVariables;
   fBinsBegin      = source.fBinsBegin;
+  fVarIndices     = source.fVarIndices;
   fRaw            = source.fRaw;
 
   return *this;
@@ -157,29 +162,76 @@ int AliMLResponse::FindBin(double binvar) {
 }
 
 //_______________________________________________________________________________
-double AliMLResponse::Predict(double binvar, map<string, double> varmap) {
+void AliMLResponse::BindVariables(const vector<string> &varNames) {
+  fVarIndices.clear();
+  for (const auto &varname : fVariableNames) {
+    auto it = std::find(varNames.begin(), varNames.end(), varname);
+    if (it == varNames.end()) {
+      AliFatal(Form("Variable |%s| not found in variable list provided for binding! Exit", varname.data()));
+    }
+    fVarIndices.push_back(it - varNames.begin());
+  }
+  fFeatures.resize(fNVariables);
+}
+
+//_______________________________________________________________________________
+void AliMLResponse::FillFeatures(const map<string, double> &varmap) {
   if ((int)varmap.size() < fNVariables) {
     AliFatal("The variable map you provided to the predictor has a size smaller than the variable list size! Exit");
   }
 
-  vector<double> features;
-  for (const auto &varname : fVariableNames) {
-    if (varmap.find(varname) == varmap.end()) {
-      AliFatal(Form("Variable |%s| not found in variable list provided in config! Exit", varname.data()));
+  fFeatures.resize(fNVariables);
+  for (int iVar = 0; iVar < fNVariables; ++iVar) {
+    auto it = varmap.find(fVariableNames[iVar]);
+    if (it == varmap.end()) {
+      AliFatal(Form("Variable |%s| not found in variable list provided in config! Exit", fVariableNames[iVar].data()));
     }
-    features.push_back(varmap[varname]);
+    fFeatures[iVar] = it->second;
   }
+}
+
+//_______________________________________________________________________________
+void AliMLResponse::GatherFeatures(const double *values) {
+  if (fVarIndices.empty()) {
+    AliFatal("Variables not bound, call BindVariables before passing an array of values! Exit");
+  }
+
+  fFeatures.resize(fNVariables);
+  for (int iVar = 0; iVar < fNVariables; ++iVar) {
+    fFeatures[iVar] = values[fVarIndices[iVar]];
+  }
+}
+
+//_______________________________________________________________________________
+double AliMLResponse::Predict(double binvar, const map<string, double> &varmap) {
+  FillFeatures(varmap);
 
   int bin = FindBin(binvar);
   if (bin < 0)
     return -999.;
 
-  vector<double> scores;
-  bool predict = fModels.at(bin - 1).GetModel()->Predict(&features[0], fNVariables, scores, fRaw);
+  fScores.clear();
+  bool predict = fModels.at(bin - 1).GetModel()->Predict(fFeatures.data(), fNVariables, fScores, fRaw);
   if(!predict)
     return -999.;
 
-  return scores[0];
+  return fScores[0];
+}
+
+//_______________________________________________________________________________
+double AliMLResponse::Predict(double binvar, const double *values) {
+  GatherFeatures(values);
+
+  int bin = FindBin(binvar);
+  if (bin < 0)
+    return -999.;
+
+  fScores.clear();
+  bool predict = fModels.at(bin - 1).GetModel()->Predict(fFeatures.data(), fNVariables, fScores, fRaw);
+  if(!predict)
+    return -999.;
+
+  return fScores[0];
 }
 
 //_______________________________________________________________________________
@@ -193,33 +245,34 @@ double AliMLResponse::Predict(double binvar, vector<double> variables) {
   if (bin < 0)
     return -999.;
 
-  vector<double> scores;
-  bool predict = fModels.at(bin - 1).GetModel()->Predict(&variables[0], fNVariables, scores, fRaw);
+  fScores.clear();
+  bool predict = fModels.at(bin - 1).GetModel()->Predict(&variables[0], fNVariables, fScores, fRaw);
   if(!predict)
     return -999.;
 
-  return scores[0];
+  return fScores[0];
 }
 
 //_______________________________________________________________________________
-bool AliMLResponse::PredictMultiClass(double binvar, map<string, double> varmap, vector<double> &outScores) {
-  if ((int)varmap.size() < fNVariables) {
-    AliFatal("The variable map you provided to the predictor has a size smaller than the variable list size! Exit");
-  }
+bool AliMLResponse::PredictMultiClass(double binvar, const map<string, double> &varmap, vector<double> &outScores) {
+  FillFeatures(varmap);
 
-  vector<double> features;
-  for (const auto &varname : fVariableNames) {
-    if (varmap.find(varname) == varmap.end()) {
-      AliFatal(Form("Variable |%s| not found in variable list provided in config! Exit", varname.data()));
-    }
-    features.push_back(varmap[varname]);
-  }
+  int bin = FindBin(binvar);
+  if (bin < 0)
+    return false;
+
+  return fModels.at(bin - 1).GetModel()->Predict(fFeatures.data(), fNVariables, outScores, fRaw);
+}
+
+//_______________________________________________________________________________
+bool AliMLResponse::PredictMultiClass(double binvar, const double *values, vector<double> &outScores) {
+  GatherFeatures(values);
 
   int bin = FindBin(binvar);
   if (bin < 0)
     return false;
 
-  return fModels.at(bin - 1).GetModel()->Predict(&features[0], fNVariables, outScores, fRaw);
+  return fModels.at(bin - 1).GetModel()->Predict(fFeatures.data(), fNVariables, outScores, fRaw);
 }
 
 //_______________________________________________________________________________
@@ -237,11 +290,17 @@ bool AliMLResponse::PredictMultiClass(double binvar, vector<double> variables, v
 }
 
 //_______________________________________________________________________________
-bool AliMLResponse::IsSelected(double binvar, map<std::string, double> varmap) {
+bool AliMLResponse::IsSelected(double binvar, const map<std::string, double> &varmap) {
   double score{0.};
   return IsSelected(binvar, varmap, score);
 }
 
+//_______________________________________________________________________________
+bool AliMLResponse::IsSelected(double binvar, const double *values) {
+  double score{0.};
+  return IsSelected(binvar, values, score);
+}
+
 //_______________________________________________________________________________
 bool AliMLResponse::IsSelected(double binvar, vector<double> variables) {
   double score{0.};
@@ -249,13 +308,108 @@ bool AliMLResponse::IsSelected(double binvar, vector<double> variables) {
 }
 
 //_______________________________________________________________________________
-bool AliMLResponse::IsSelectedMultiClass(double binvar, map<std::string, double> varmap) {
-  vector<double> score;
-  return IsSelectedMultiClass(binvar, varmap, score);
+bool AliMLResponse::IsSelectedMultiClass(double binvar, const map<std::string, double> &varmap) {
+  fScores.clear();
+  return IsSelectedMultiClass(binvar, varmap, fScores);
 }
 
 //_______________________________________________________________________________
 bool AliMLResponse::IsSelectedMultiClass(double binvar, vector<double> variables) {
-  vector<double> score;
-  return IsSelectedMultiClass(binvar, variables, score);
-}
\ No newline at end of file
+  fScores.clear();
+  return IsSelectedMultiClass(binvar, variables, fScores);
+}
+
+//_______________________________________________________________________________
+bool AliMLResponse::IsSelectedMultiClass(double binvar, const double *values) {
+  fScores.clear();
+  return IsSelectedMultiClass(binvar, values, fScores);
+}
+
+//_______________________________________________________________________________
+std::size_t AliMLResponse::GetOutputSize() {
+  if (fModels.empty())
+    return 0u;
+  return fModels.front().GetModel()->GetOutputSize();
+}
+
+//_______________________________________________________________________________
+bool AliMLResponse::PredictBatch(const vector<double> &binvars, const vector<double> &features, vector<double> &outScores) {
+  const std::size_t nCand = binvars.size();
+  if (features.size() != nCand * fNVariables) {
+    AliFatal(Form("Number of features passed (%d) different from number of candidates times number of variables (%d)! Exit",
+                  (int)features.size(), (int)(nCand * fNVariables)));
+  }
+
+  const std::size_t nOut = GetOutputSize();
+  outScores.assign(nCand * nOut, -999.);
+  fBatchBins.assign(nCand, -1);
+  if (nCand == 0)
+    return true;
+
+  /// group the candidates per model, reusing the scratch buffers across events
+  fBatchFeatures.resize(fModels.size());
+  fBatchCandidates.resize(fModels.size());
+  for (std::size_t iModel = 0; iModel < fModels.size(); ++iModel) {
+    fBatchFeatures[iModel].clear();
+    fBatchCandidates[iModel].clear();
+  }
+
+  for (std::size_t iCand = 0; iCand < nCand; ++iCand) {
+    int bin = FindBin(binvars[iCand]);
+    fBatchBins[iCand] = bin;
+    if (bin < 0)
+      continue;
+    vector<float> &buffer = fBatchFeatures[bin - 1];
+    for (int iVar = 0; iVar < fNVariables; ++iVar) {
+      buffer.push_back(static_cast<float>(features[iCand * fNVariables + iVar]));
+    }
+    fBatchCandidates[bin - 1].push_back(iCand);
+  }
+
+  bool status = true;
+  for (std::size_t iModel = 0; iModel < fModels.size(); ++iModel) {
+    const vector<std::size_t> &candidates = fBatchCandidates[iModel];
+    if (candidates.empty())
+      continue;
+    fBatchScores.clear();
+    if (!fModels[iModel].GetModel()->PredictBatch(fBatchFeatures[iModel].data(), candidates.size(), fBatchScores, fRaw)) {
+      status = false;
+      continue;
+    }
+    for (std::size_t iCand = 0; iCand < candidates.size(); ++iCand) {
+      for (std::size_t iScore = 0; iScore < nOut; ++iScore) {
+        outScores[candidates[iCand] * nOut + iScore] = fBatchScores[iCand * nOut + iScore];
+      }
+    }
+  }
+
+  return status;
+}
+
+//_______________________________________________________________________________
+bool AliMLResponse::IsSelectedBatch(const vector<double> &binvars, const vector<double> &features, vector<bool> &selected,
+                                    vector<double> &outScores) {
+  selected.assign(binvars.size(), false);
+  if (!PredictBatch(binvars, features, outScores))
+    return false;
+
+  const std::size_t nOut = GetOutputSize();
+  for (std::size_t iCand = 0; iCand < binvars.size(); ++iCand) {
+    int bin = fBatchBins[iCand];
+    if (bin < 0)
+      continue;
+    const vector<double> &cuts = fModels.at(bin - 1).GetScoreCut();
+    const vector<int> &cutOpts = fModels.at(bin - 1).GetScoreCutOpt();
+    bool isSel = true;
+    for (std::size_t iScore = 0; iScore < nOut && isSel; ++iScore) {
+      double score = outScores[iCand * nOut + iScore];
+      if (cutOpts[iScore] == AliMLModelHandler::kLowerCut && score < cuts[iScore])
+        isSel = false;
+      if (cutOpts[iScore] == AliMLModelHandler::kUpperCut && score > cuts[iScore])
+        isSel = false;
+    }
+    selected[iCand] = isSel;
+  }
+
+  return true;
+}
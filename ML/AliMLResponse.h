@@ -46,34 +46,68 @@ public:
   void CompileModels(std::string configLocalPath);     /// (it has to be done run time)
   void MLResponseInit();    /// (it has to be done run time)
 
+  /// resolve once the variables used by the models into slots of the array passed to the
+  /// Predict/IsSelected overloads taking a const double* (to be called e.g. in UserCreateOutputObjects)
+  void BindVariables(const std::vector<std::string> &varNames);
+  /// return true if BindVariables was called
+  bool AreVariablesBound() const { return !fVarIndices.empty(); }
+
   /// return the bin index
   int FindBin(double binvar);
   /// return the ML model predicted score (raw or proba, depending on useraw)
-  double Predict(double binvar, std::map<std::string, double> varmap);
+  double Predict(double binvar, const std::map<std::string, double> &varmap);
   /// overload to pass directly a vector of variables
   double Predict(double binvar, std::vector<double> variables);
+  /// overload to pass an array of values ordered as in BindVariables
+  double Predict(double binvar, const double *values);
   /// return true if predicted score for map is above the threshold given in the config
-  bool IsSelected(double binvar, std::map<std::string, double> varmap);
+  bool IsSelected(double binvar, const std::map<std::string, double> &varmap);
   /// overload for getting the model score too
-  template <typename F> bool IsSelected(double binvar, std::map<std::string, double> varmap, F &score);
+  template <typename F> bool IsSelected(double binvar, const std::map<std::string, double> &varmap, F &score);
   /// overload to pass directly a vector of variables
   bool IsSelected(double binvar, std::vector<double> variables);
   /// overload for getting the model score too
   template <typename F> bool IsSelected(double binvar, std::vector<double> variables, F &score);
+  /// overload to pass an array of values ordered as in BindVariables
+  bool IsSelected(double binvar, const double *values);
+  /// overload for getting the model score too
+  template <typename F> bool IsSelected(double binvar, const double *values, F &score);
   /// return the ML model predicted scores (raw or proba, depending on useraw)
-  bool PredictMultiClass(double binvar, std::map<std::string, double> varmap, std::vector<double> &outScores);
+  bool PredictMultiClass(double binvar, const std::map<std::string, double> &varmap, std::vector<double> &outScores);
   /// overload to pass directly a vector of variables
   bool PredictMultiClass(double binvar, std::vector<double> variables, std::vector<double> &outScores);
+  /// overload to pass an array of values ordered as in BindVariables
+  bool PredictMultiClass(double binvar, const double *values, std::vector<double> &outScores);
   /// return true if predicted score for map is above the threshold given in the config
-  bool IsSelectedMultiClass(double binvar, std::map<std::string, double> varmap);
+  bool IsSelectedMultiClass(double binvar, const std::map<std::string, double> &varmap);
   /// overload for getting the model score too
-  template <typename F> bool IsSelectedMultiClass(double binvar, std::map<std::string, double> varmap, std::vector<F> &outScores);
+  template <typename F> bool IsSelectedMultiClass(double binvar, const std::map<std::string, double> &varmap, std::vector<F> &outScores);
   /// overload to pass directly a vector of variables
   bool IsSelectedMultiClass(double binvar, std::vector<double> variables);
   /// overload for getting the model score too
   template <typename F> bool IsSelectedMultiClass(double binvar, std::vector<double> variables, std::vector<F> &outScores);
+  /// overload to pass an array of values ordered as in BindVariables
+  bool IsSelectedMultiClass(double binvar, const double *values);
+  /// overload for getting the model score too
+  template <typename F> bool IsSelectedMultiClass(double binvar, const double *values, std::vector<F> &outScores);
+  /// return the ML model predicted scores for a set of candidates (e.g. all the candidates of an event) in one call
+  /// features are stored row-major (binvars.size() x number of variables), outScores is filled with
+  /// binvars.size() x number of model outputs (-999 for candidates outside the bin range)
+  bool PredictBatch(const std::vector<double> &binvars, const std::vector<double> &features, std::vector<double> &outScores);
+  /// return for each candidate whether the predicted scores pass the thresholds given in the config
+  bool IsSelectedBatch(const std::vector<double> &binvars, const std::vector<double> &features, std::vector<bool> &selected, std::vector<double> &outScores);
+
+  /// return the number of model outputs (scores) per candidate
+  std::size_t GetOutputSize();
 
 protected:
+  /// fill fFeatures from the variable map, in the order of the model variables
+  void FillFeatures(const std::map<std::string, double> &varmap);
+  /// fill fFeatures from an array of values, using the slots resolved in BindVariables
+  void GatherFeatures(const double *values);
+  /// apply the score cuts of the model in a given bin
+  template <typename F> bool PassScoreCuts(int bin, const std::vector<F> &outScores);
+
   std::string fConfigFilePath;    /// path of the config file
 
   std::vector<AliMLModelHandler> fModels;     //!<! vector of models
@@ -85,15 +119,23 @@ protected:
   int fNVariables;    /// number of variables (features) stored for checks
 
   std::vector<float>::iterator fBinsBegin;    //!<!  evaluate just once is better
+  std::vector<int> fVarIndices;               //!<! slots of the model variables in the bound array
+  std::vector<double> fFeatures;              //!<! scratch buffer for the features of one candidate
+  std::vector<double> fScores;                //!<! scratch buffer for the scores of one candidate
 
   bool fRaw;    /// set to true to use raw score instead of probability
 
+  std::vector<std::vector<float>> fBatchFeatures;          //!<! per-bin scratch buffers for batched predictions
+  std::vector<std::vector<std::size_t>> fBatchCandidates;  //!<! candidate indices per bin for batched predictions
+  std::vector<double> fBatchScores;                        //!<! scratch buffer for batched scores
+  std::vector<int> fBatchBins;                             //!<! bin index of each candidate of the last batch
+
   /// \cond CLASSIMP
   ClassDef(AliMLResponse, 2);    ///
   /// \endcond
 };
 
-template <typename F> bool AliMLResponse::IsSelected(double binvar, std::map<std::string, double> varmap, F &score) {
+template <typename F> bool AliMLResponse::IsSelected(double binvar, const std::map<std::string, double> &varmap, F &score) {
   int bin = FindBin(binvar);
   if (bin < 0)
     return false;
@@ -109,25 +151,38 @@ template <typename F> bool AliMLResponse::IsSelected(double binvar, std::vector<
   return score >= fModels.at(bin - 1).GetScoreCut()[0];
 }
 
-template <typename F> bool AliMLResponse::IsSelectedMultiClass(double binvar, std::map<std::string, double> varmap, std::vector<F> &outScores) {
+template <typename F> bool AliMLResponse::IsSelected(double binvar, const double *values, F &score) {
   int bin = FindBin(binvar);
   if (bin < 0)
     return false;
+  score = Predict(binvar, values);
+  return score >= fModels.at(bin - 1).GetScoreCut()[0];
+}
 
-  bool predict = PredictMultiClass(binvar, varmap, outScores);
-  if(!predict)
-    return false;
-
+template <typename F> bool AliMLResponse::PassScoreCuts(int bin, const std::vector<F> &outScores) {
+  const std::vector<double> &cuts = fModels.at(bin - 1).GetScoreCut();
+  const std::vector<int> &cutOpts = fModels.at(bin - 1).GetScoreCutOpt();
   for(std::size_t iScore=0; iScore < outScores.size(); iScore++) {
-    if(fModels.at(bin - 1).GetScoreCutOpt()[iScore] == AliMLModelHandler::kLowerCut && outScores[iScore] < fModels.at(bin - 1).GetScoreCut()[iScore])
+    if(cutOpts[iScore] == AliMLModelHandler::kLowerCut && outScores[iScore] < cuts[iScore])
       return false;
-    if(fModels.at(bin - 1).GetScoreCutOpt()[iScore] == AliMLModelHandler::kUpperCut && outScores[iScore] > fModels.at(bin - 1).GetScoreCut()[iScore])
+    if(cutOpts[iScore] == AliMLModelHandler::kUpperCut && outScores[iScore] > cuts[iScore])
       return false;
   }
-
   return true;
 }
 
+template <typename F> bool AliMLResponse::IsSelectedMultiClass(double binvar, const std::map<std::string, double> &varmap, std::vector<F> &outScores) {
+  int bin = FindBin(binvar);
+  if (bin < 0)
+    return false;
+
+  bool predict = PredictMultiClass(binvar, varmap, outScores);
+  if(!predict)
+    return false;
+
+  return PassScoreCuts(bin, outScores);
+}
+
 template <typename F> bool AliMLResponse::IsSelectedMultiClass(double binvar, std::vector<double> variables, std::vector<F> &outScores) {
   int bin = FindBin(binvar);
   if (bin < 0)
@@ -137,14 +192,19 @@ template <typename F> bool AliMLResponse::IsSelectedMultiClass(double binvar, st
   if(!predict)
     return false;
 
-  for(std::size_t iScore=0; iScore < outScores.size(); iScore++) {
-    if(fModels.at(bin - 1).GetScoreCutOpt()[iScore] == AliMLModelHandler::kLowerCut && outScores[iScore] < fModels.at(bin - 1).GetScoreCut()[iScore])
-      return false;
-    if(fModels.at(bin - 1).GetScoreCutOpt()[iScore] == AliMLModelHandler::kUpperCut && outScores[iScore] > fModels.at(bin - 1).GetScoreCut()[iScore])
-      return false;
-  }
+  return PassScoreCuts(bin, outScores);
+}
 
-  return true;
+template <typename F> bool AliMLResponse::IsSelectedMultiClass(double binvar, const double *values, std::vector<F> &outScores) {
+  int bin = FindBin(binvar);
+  if (bin < 0)
+    return false;
+
+  bool predict = PredictMultiClass(binvar, values, outScores);
+  if(!predict)
+    return false;
+
+  return PassScoreCuts(bin, outScores);
 }
 
 #endif
@@ -17,6 +17,7 @@
 #include "AliVMultiplicity.h"
 #include "AliPPVsMultUtils.h"
 #include "AliESDtrackCuts.h"
+#include "AliEventSummary.h"
 
 #include "AliAnalysisUtils.h"
 
@@ -51,6 +52,42 @@ AliAnalysisUtils::~AliAnalysisUtils()
 {
 }
 
+//______________________________________________________________________
+ULong64_t AliAnalysisUtils::HashBytes(const void* data, Int_t size, ULong64_t hash)
+{
+  // FNV-1a hash of a block of memory
+  const UChar_t* bytes = static_cast<const UChar_t*>(data);
+  for (Int_t i = 0; i < size; i++) {
+    hash ^= bytes[i];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+//______________________________________________________________________
+ULong64_t AliAnalysisUtils::GetConfigurationHash() const
+{
+  // hash of the cut settings (the AOD/ESD flag is a state, not a setting)
+  ULong64_t hash = HashBytes(&fMinVtxContr, sizeof(fMinVtxContr));
+  hash = HashBytes(&fMaxVtxZ, sizeof(fMaxVtxZ), hash);
+  hash = HashBytes(&fCutOnZVertexSPD, sizeof(fCutOnZVertexSPD), hash);
+  hash = HashBytes(&fUseMVPlpSelection, sizeof(fUseMVPlpSelection), hash);
+  hash = HashBytes(&fUseOutOfBunchPileUp, sizeof(fUseOutOfBunchPileUp), hash);
+  hash = HashBytes(&fMinPlpContribMV, sizeof(fMinPlpContribMV), hash);
+  hash = HashBytes(&fMaxPlpChi2MV, sizeof(fMaxPlpChi2MV), hash);
+  hash = HashBytes(&fMinWDistMV, sizeof(fMinWDistMV), hash);
+  hash = HashBytes(&fCheckPlpFromDifferentBCMV, sizeof(fCheckPlpFromDifferentBCMV), hash);
+  hash = HashBytes(&fMinPlpContribSPD, sizeof(fMinPlpContribSPD), hash);
+  hash = HashBytes(&fMinPlpZdistSPD, sizeof(fMinPlpZdistSPD), hash);
+  hash = HashBytes(&fnSigmaPlpZdistSPD, sizeof(fnSigmaPlpZdistSPD), hash);
+  hash = HashBytes(&fnSigmaPlpDiamXYSPD, sizeof(fnSigmaPlpDiamXYSPD), hash);
+  hash = HashBytes(&fnSigmaPlpDiamZSPD, sizeof(fnSigmaPlpDiamZSPD), hash);
+  hash = HashBytes(&fUseSPDCutInMultBins, sizeof(fUseSPDCutInMultBins), hash);
+  hash = HashBytes(&fASPDCvsTCut, sizeof(fASPDCvsTCut), hash);
+  hash = HashBytes(&fBSPDCvsTCut, sizeof(fBSPDCvsTCut), hash);
+  return hash;
+}
+
 //______________________________________________________________________
 Bool_t AliAnalysisUtils::IsVertexSelected2013pA(AliVEvent *event)
 {
@@ -163,34 +200,23 @@ Bool_t AliAnalysisUtils::IsPileUpMV(AliVEvent *event)
     return kFALSE;
   }
   //
-  const AliVVertex* vtPrm = 0;
-  const AliVVertex* vtPlp = 0;
-  Int_t nPlp = 0;
-  //
-  if (aod) {
-    if ( !(nPlp=aod->GetNumberOfPileupVerticesTracks()) ) return kFALSE;
-    vtPrm = aod->GetPrimaryVertex();
-    if (vtPrm == aod->GetPrimaryVertexSPD()) return kTRUE; // there are pile-up vertices but no primary
-  }
-  else {
-    if ( !(nPlp=esd->GetNumberOfPileupVerticesTracks())) return kFALSE;
-    vtPrm = esd->GetPrimaryVertexTracks();
-    if (((AliESDVertex*)vtPrm)->GetStatus()!=1) return kTRUE; // there are pile-up vertices but no primary
-  }
-  Int_t bcPrim = vtPrm->GetBC();
+  // the pileup vertices and their distance to the primary are evaluated once per event
+  AliEventSummary* summary = AliEventSummary::Get(event);
+  if (!summary->fMVFilled) FillSummaryMV(event, summary);
+  if (!summary->fNPileupVtxMV) return kFALSE;
+  if (summary->fNoPrimaryMV) return kTRUE; // there are pile-up vertices but no primary
+  Int_t bcPrim = summary->fBCPrimaryMV;
   //
-  for (Int_t ipl=0;ipl<nPlp;ipl++) {
-    vtPlp = aod ? (const AliVVertex*)aod->GetPileupVertexTracks(ipl) : (const AliVVertex*)esd->GetPileupVertexTracks(ipl);
-    //
-    if (vtPlp->GetNContributors() < fMinPlpContribMV) continue;
-    if (vtPlp->GetChi2perNDF() > fMaxPlpChi2MV) continue;
+  for (Int_t ipl=0;ipl<summary->fNPileupVtxMV;ipl++) {
+    if (summary->fContribMV[ipl] < fMinPlpContribMV) continue;
+    if (summary->fChi2MV[ipl] > fMaxPlpChi2MV) continue;
     if(fCheckPlpFromDifferentBCMV)
       {
-	Int_t bcPlp = vtPlp->GetBC();
+	Int_t bcPlp = summary->fBCMV[ipl];
 	if (bcPlp!=AliVTrack::kTOFBCNA && TMath::Abs(bcPlp-bcPrim)>2) return kTRUE; // pile-up from other BC
       }
     //
-    Double_t wDst = GetWDist(vtPrm,vtPlp);
+    Double_t wDst = summary->fWDistMV[ipl];
     if (wDst<fMinWDistMV) continue;
     //
     return kTRUE; // pile-up: well separated vertices
@@ -200,6 +226,57 @@ Bool_t AliAnalysisUtils::IsPileUpMV(AliVEvent *event)
   //
 }
 
+//______________________________________________________________________
+void AliAnalysisUtils::FillSummaryMV(AliVEvent *event, AliEventSummary *summary)
+{
+  // fills the multi-vertexer section of the event summary
+  const AliAODEvent *aod = dynamic_cast<const AliAODEvent*>(event);
+  const AliESDEvent *esd = dynamic_cast<const AliESDEvent*>(event);
+  summary->fMVFilled = kTRUE;
+  summary->fNPileupVtxMV = 0;
+  summary->fNoPrimaryMV = kFALSE;
+  //
+  const AliVVertex* vtPrm = 0;
+  Int_t nPlp = 0;
+  if (aod) {
+    if ( !(nPlp=aod->GetNumberOfPileupVerticesTracks()) ) return;
+    vtPrm = aod->GetPrimaryVertex();
+    summary->fNoPrimaryMV = (vtPrm == aod->GetPrimaryVertexSPD());
+  }
+  else {
+    if ( !(nPlp=esd->GetNumberOfPileupVerticesTracks())) return;
+    vtPrm = esd->GetPrimaryVertexTracks();
+    summary->fNoPrimaryMV = (((AliESDVertex*)vtPrm)->GetStatus()!=1);
+  }
+  summary->fNPileupVtxMV = nPlp;
+  if (summary->fNoPrimaryMV) return;
+  summary->fBCPrimaryMV = vtPrm->GetBC();
+  summary->fContribMV.resize(nPlp);
+  summary->fChi2MV.resize(nPlp);
+  summary->fBCMV.resize(nPlp);
+  summary->fWDistMV.resize(nPlp);
+  for (Int_t ipl=0;ipl<nPlp;ipl++) {
+    const AliVVertex* vtPlp = aod ? (const AliVVertex*)aod->GetPileupVertexTracks(ipl) : (const AliVVertex*)esd->GetPileupVertexTracks(ipl);
+    summary->fContribMV[ipl] = vtPlp->GetNContributors();
+    summary->fChi2MV[ipl] = vtPlp->GetChi2perNDF();
+    summary->fBCMV[ipl] = vtPlp->GetBC();
+    summary->fWDistMV[ipl] = GetWDist(vtPrm,vtPlp);
+  }
+}
+//______________________________________________________________________
+Bool_t AliAnalysisUtils::IsPileUpSPDInMultBins(AliVEvent *event)
+{
+  // IsPileupFromSPDInMultBins, evaluated once per event
+  AliEventSummary* summary = AliEventSummary::Get(event);
+  if (summary->fSPDPileupInMultBins < 0) {
+    const AliAODEvent *aod = dynamic_cast<const AliAODEvent*>(event);
+    const AliESDEvent *esd = dynamic_cast<const AliESDEvent*>(event);
+    if (aod) summary->fSPDPileupInMultBins = aod->IsPileupFromSPDInMultBins();
+    else if (esd) summary->fSPDPileupInMultBins = esd->IsPileupFromSPDInMultBins();
+    else return kFALSE;
+  }
+  return summary->fSPDPileupInMultBins;
+}
 //______________________________________________________________________
 Bool_t AliAnalysisUtils::IsPileUpSPD(AliVEvent *event)
 {
@@ -212,8 +289,25 @@ Bool_t AliAnalysisUtils::IsPileUpSPD(AliVEvent *event)
     return kFALSE;
   }
   //
-  if (aod) return (fUseSPDCutInMultBins)?aod->IsPileupFromSPDInMultBins():aod->IsPileupFromSPD(fMinPlpContribSPD,fMinPlpZdistSPD,fnSigmaPlpZdistSPD,fnSigmaPlpDiamXYSPD,fnSigmaPlpDiamZSPD);
-  else return (fUseSPDCutInMultBins)?esd->IsPileupFromSPDInMultBins():esd->IsPileupFromSPD(fMinPlpContribSPD,fMinPlpZdistSPD,fnSigmaPlpZdistSPD,fnSigmaPlpDiamXYSPD,fnSigmaPlpDiamZSPD);
+  if (fUseSPDCutInMultBins) return IsPileUpSPDInMultBins(event);
+  //
+  // the result is kept in the event summary for each set of settings
+  AliEventSummary* summary = AliEventSummary::Get(event);
+  for (UInt_t i=0;i<summary->fSPDPileup.size();i++) {
+    const AliEventSummary::SPDPileup& plp = summary->fSPDPileup[i];
+    if (plp.fMinContrib==fMinPlpContribSPD && plp.fMinZdist==fMinPlpZdistSPD && plp.fNSigmaZdist==fnSigmaPlpZdistSPD &&
+        plp.fNSigmaDiamXY==fnSigmaPlpDiamXYSPD && plp.fNSigmaDiamZ==fnSigmaPlpDiamZSPD) return plp.fIsPileup;
+  }
+  AliEventSummary::SPDPileup plp;
+  plp.fMinContrib = fMinPlpContribSPD;
+  plp.fMinZdist = fMinPlpZdistSPD;
+  plp.fNSigmaZdist = fnSigmaPlpZdistSPD;
+  plp.fNSigmaDiamXY = fnSigmaPlpDiamXYSPD;
+  plp.fNSigmaDiamZ = fnSigmaPlpDiamZSPD;
+  if (aod) plp.fIsPileup = aod->IsPileupFromSPD(fMinPlpContribSPD,fMinPlpZdistSPD,fnSigmaPlpZdistSPD,fnSigmaPlpDiamXYSPD,fnSigmaPlpDiamZSPD);
+  else plp.fIsPileup = esd->IsPileupFromSPD(fMinPlpContribSPD,fMinPlpZdistSPD,fnSigmaPlpZdistSPD,fnSigmaPlpDiamXYSPD,fnSigmaPlpDiamZSPD);
+  summary->fSPDPileup.push_back(plp);
+  return plp.fIsPileup;
 }
 
 //______________________________________________________________________
@@ -227,11 +321,17 @@ Bool_t AliAnalysisUtils::IsOutOfBunchPileUp(AliVEvent *event)
     AliFatal("Event is neither of AOD nor ESD type");
     return kFALSE;
   }
-  Int_t bc2 = (aod)?((AliVAODHeader*)aod->GetHeader())->GetIRInt2ClosestInteractionMap():esd->GetHeader()->GetIRInt2ClosestInteractionMap();
+  AliEventSummary* summary = AliEventSummary::Get(event);
+  if (!summary->fIRFilled) {
+    summary->fIRInt2 = (aod)?((AliVAODHeader*)aod->GetHeader())->GetIRInt2ClosestInteractionMap():esd->GetHeader()->GetIRInt2ClosestInteractionMap();
+    summary->fIRInt1 = (aod)?((AliVAODHeader*)aod->GetHeader())->GetIRInt1ClosestInteractionMap():esd->GetHeader()->GetIRInt1ClosestInteractionMap();
+    summary->fIRFilled = kTRUE;
+  }
+  Int_t bc2 = summary->fIRInt2;
   if (bc2 != 0)
     return kTRUE;
   
-  Int_t bc1 = (aod)?((AliVAODHeader*)aod->GetHeader())->GetIRInt1ClosestInteractionMap():esd->GetHeader()->GetIRInt1ClosestInteractionMap();
+  Int_t bc1 = summary->fIRInt1;
   if (bc1 != 0)
     return kTRUE;
   
@@ -241,9 +341,16 @@ Bool_t AliAnalysisUtils::IsOutOfBunchPileUp(AliVEvent *event)
 
 //______________________________________________________________________
 Bool_t AliAnalysisUtils::IsSPDClusterVsTrackletBG(AliVEvent *event){
-  Int_t nClustersLayer0 = event->GetNumberOfITSClusters(0);
-  Int_t nClustersLayer1 = event->GetNumberOfITSClusters(1);
-  Int_t nTracklets      = event->GetMultiplicity()->GetNumberOfTracklets();
+  AliEventSummary* summary = AliEventSummary::Get(event);
+  if (!summary->fSPDFilled) {
+    summary->fSPDClusters[0] = event->GetNumberOfITSClusters(0);
+    summary->fSPDClusters[1] = event->GetNumberOfITSClusters(1);
+    summary->fSPDTracklets   = event->GetMultiplicity()->GetNumberOfTracklets();
+    summary->fSPDFilled = kTRUE;
+  }
+  Int_t nClustersLayer0 = summary->fSPDClusters[0];
+  Int_t nClustersLayer1 = summary->fSPDClusters[1];
+  Int_t nTracklets      = summary->fSPDTracklets;
   if (nClustersLayer0 + nClustersLayer1 > fASPDCvsTCut + nTracklets*fBSPDCvsTCut) return kTRUE;
   return kFALSE;
 }
@@ -23,6 +23,7 @@ class AliAODMCHeader;
 class AliESDtrackCuts;
 class AliAODEvent;
 class AliAODTrack;
+class AliEventSummary;
 
 class AliAnalysisUtils : public TObject {
 
@@ -37,10 +38,15 @@ class AliAnalysisUtils : public TObject {
   Bool_t IsPileUpEvent(AliVEvent *event); //to be used in the analysis
   Bool_t IsPileUpMV(AliVEvent *event); //MV pileup selection implemented here
   Bool_t IsPileUpSPD(AliVEvent *event); //this calls IsPileUpFromSPD
+  static Bool_t IsPileUpSPDInMultBins(AliVEvent *event); //IsPileupFromSPDInMultBins, evaluated once per event
   Bool_t IsOutOfBunchPileUp(AliVEvent *event); //out-of-bunch pileup rejection using trigger information
   Bool_t IsSPDClusterVsTrackletBG(AliVEvent *event); // background rejection with cluster-vs-tracklet cut
   
   Double_t GetWDist(const AliVVertex* v0, const AliVVertex* v1);
+
+  // hash of the pileup and vertex cut settings, to compare configurations
+  ULong64_t GetConfigurationHash() const;
+  static ULong64_t HashBytes(const void* data, Int_t size, ULong64_t hash = 14695981039346656037ULL);
   
   void SetMinVtxContr(Int_t contr=1) {fMinVtxContr=contr;}
   void SetMaxVtxZ(Float_t z=1e6) {fMaxVtxZ=z;}
@@ -118,6 +124,8 @@ class AliAnalysisUtils : public TObject {
   
   AliPPVsMultUtils *fPPVsMultUtils; //! multiplicity selection in pp
 
+  void FillSummaryMV(AliVEvent *event, AliEventSummary *summary); // pileup vertices of the event summary
+
   AliAnalysisUtils(const AliAnalysisUtils& obj); // copy constructor
   AliAnalysisUtils& operator=(const AliAnalysisUtils& other); // assignment
     
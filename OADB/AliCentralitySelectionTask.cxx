@@ -1699,60 +1699,28 @@ void AliCentralitySelectionTask::UserExec(Option_t */*option*/)
   }
 
   // ***** Centrality Selection
-  if(fHtempV0M) fCentV0M = fHtempV0M->GetBinContent(fHtempV0M->FindBin((v0Corr)));
-  if(fHtempV0A) fCentV0A = fHtempV0A->GetBinContent(fHtempV0A->FindBin((multV0ACorr)));
-  if(fHtempV0A0) fCentV0A0 = fHtempV0A0->GetBinContent(fHtempV0A0->FindBin((multV0A0Corr)));
-  if(fHtempV0A123) fCentV0A123 = fHtempV0A123->GetBinContent(fHtempV0A123->FindBin((multV0A123Corr)));
-  if(fHtempV0C) fCentV0C = fHtempV0C->GetBinContent(fHtempV0C->FindBin((multV0CCorr)));
-  if(fHtempV0A23) fCentV0A23 = fHtempV0A23->GetBinContent(fHtempV0A23->FindBin((multV0A23Corr)));
-  if(fHtempV0C01) fCentV0C01 = fHtempV0C01->GetBinContent(fHtempV0C01->FindBin((multV0C01Corr)));
-  if(fHtempV0S)  fCentV0S = fHtempV0S->GetBinContent(fHtempV0S->FindBin((multV0SCorr)));
-  if(fHtempV0MEq) fCentV0MEq = fHtempV0MEq->GetBinContent(fHtempV0MEq->FindBin((multV0AEq+multV0CEq)));
-  if(fHtempV0AEq) fCentV0AEq = fHtempV0AEq->GetBinContent(fHtempV0AEq->FindBin((multV0AEq)));
-  if(fHtempV0CEq) fCentV0CEq = fHtempV0CEq->GetBinContent(fHtempV0CEq->FindBin((multV0CEq)));
-  if(fHtempFMD) fCentFMD = fHtempFMD->GetBinContent(fHtempFMD->FindBin((multFMDA+multFMDC)));
-  if(fHtempTRK) fCentTRK = fHtempTRK->GetBinContent(fHtempTRK->FindBin(nTracks));
-  if(fHtempTKL) fCentTKL = fHtempTKL->GetBinContent(fHtempTKL->FindBin(nTracklets));
-  if(fHtempCL0) fCentCL0 = fHtempCL0->GetBinContent(fHtempCL0->FindBin(nClusters[0]));
-  if(fHtempCL1) fCentCL1 = fHtempCL1->GetBinContent(fHtempCL1->FindBin(spdCorr));
-  if(fHtempCND) fCentCND = fHtempCND->GetBinContent(fHtempCND->FindBin(multCND));
-  if(fHtempZNA) {
-    if(znaFired) fCentZNA = fHtempZNA->GetBinContent(fHtempZNA->FindBin(znaTower));
-    else fCentZNA = 101;
+  // estimator values and percentiles in the order of the lookups
+  const Double_t lkValues[kNLookups] = {
+    v0Corr, multV0ACorr, multV0A0Corr, multV0A123Corr, multV0CCorr, multV0A23Corr, multV0C01Corr, multV0SCorr,
+    multV0AEq+multV0CEq, multV0AEq, multV0CEq, multFMDA+multFMDC, nTracks, nTracklets, nClusters[0], spdCorr, multCND,
+    znaTower, zncTower, zpaTower, zpcTower, multV0A+multV0C, nTracklets,
+    Npart, multV0ACorr+multV0CCorr, multV0ACorr, multV0CCorr, multV0AEq+multV0CEq, multV0AEq, multV0CEq, multFMDA+multFMDC,
+    nTracks, nTracklets, nClusters[0], spdCorr, multCND, znaTower, zncTower };
+  Float_t* const lkCent[kNLookups] = {
+    &fCentV0M, &fCentV0A, &fCentV0A0, &fCentV0A123, &fCentV0C, &fCentV0A23, &fCentV0C01, &fCentV0S,
+    &fCentV0MEq, &fCentV0AEq, &fCentV0CEq, &fCentFMD, &fCentTRK, &fCentTKL, &fCentCL0, &fCentCL1, &fCentCND,
+    &fCentZNA, &fCentZNC, &fCentZPA, &fCentZPC, &fCentV0MvsFMD, &fCentTKLvsV0M,
+    &fCentNPA, &fCentV0Mtrue, &fCentV0Atrue, &fCentV0Ctrue, &fCentV0MEqtrue, &fCentV0AEqtrue, &fCentV0CEqtrue, &fCentFMDtrue,
+    &fCentTRKtrue, &fCentTKLtrue, &fCentCL0true, &fCentCL1true, &fCentCNDtrue, &fCentZNAtrue, &fCentZNCtrue };
+  for (Int_t ilk = 0; ilk < kNLookups; ilk++) {
+    if (fLookup[ilk].IsSet()) *lkCent[ilk] = fLookup[ilk].GetPercentile(lkValues[ilk]);
   }
-  if(fHtempZNC) {
-    if(zncFired) fCentZNC = fHtempZNC->GetBinContent(fHtempZNC->FindBin(zncTower));
-    else fCentZNC = 101;
-  }
-  if(fHtempZPA) {
-    if(znaFired) fCentZPA = fHtempZPA->GetBinContent(fHtempZPA->FindBin(zpaTower));
-    else fCentZPA = 101;
-  }
-  if(fHtempZPC) {
-    if(zpcFired) fCentZPC = fHtempZPC->GetBinContent(fHtempZPC->FindBin(zpcTower));
-    else fCentZPC = 101;
-  }
-
-
-  if(fHtempV0MvsFMD) fCentV0MvsFMD = fHtempV0MvsFMD->GetBinContent(fHtempV0MvsFMD->FindBin((multV0A+multV0C)));
-  if(fHtempTKLvsV0M) fCentTKLvsV0M = fHtempTKLvsV0M->GetBinContent(fHtempTKLvsV0M->FindBin(nTracklets));
+  // ZDC estimators without signal
+  if(fLookup[kLkZNA].IsSet() && !znaFired) fCentZNA = 101;
+  if(fLookup[kLkZNC].IsSet() && !zncFired) fCentZNC = 101;
+  if(fLookup[kLkZPA].IsSet() && !znaFired) fCentZPA = 101;
+  if(fLookup[kLkZPC].IsSet() && !zpcFired) fCentZPC = 101;
   if(fHtempZEMvsZDC) fCentZEMvsZDC = fHtempZEMvsZDC->GetBinContent(fHtempZEMvsZDC->FindBin(zem1Energy+zem2Energy,zncEnergy+znaEnergy+zpcEnergy+zpaEnergy));
-
-  if(fHtempNPA) fCentNPA = fHtempNPA->GetBinContent(fHtempNPA->FindBin(Npart));
-  if(fHtempV0Mtrue) fCentV0Mtrue = fHtempV0Mtrue->GetBinContent(fHtempV0Mtrue->FindBin((multV0ACorr+multV0CCorr)));
-  if(fHtempV0Atrue) fCentV0Atrue = fHtempV0Atrue->GetBinContent(fHtempV0Atrue->FindBin((multV0ACorr)));
-  if(fHtempV0Ctrue) fCentV0Ctrue = fHtempV0Ctrue->GetBinContent(fHtempV0Ctrue->FindBin((multV0CCorr)));
-  if(fHtempV0MEqtrue) fCentV0MEqtrue = fHtempV0MEqtrue->GetBinContent(fHtempV0MEqtrue->FindBin((multV0AEq+multV0CEq)));
-  if(fHtempV0AEqtrue) fCentV0AEqtrue = fHtempV0AEqtrue->GetBinContent(fHtempV0AEqtrue->FindBin((multV0AEq)));
-  if(fHtempV0CEqtrue) fCentV0CEqtrue = fHtempV0CEqtrue->GetBinContent(fHtempV0CEqtrue->FindBin((multV0CEq)));
-  if(fHtempFMDtrue) fCentFMDtrue = fHtempFMDtrue->GetBinContent(fHtempFMDtrue->FindBin((multFMDA+multFMDC)));
-  if(fHtempTRKtrue) fCentTRKtrue = fHtempTRKtrue->GetBinContent(fHtempTRKtrue->FindBin(nTracks));
-  if(fHtempTKLtrue) fCentTKLtrue = fHtempTKLtrue->GetBinContent(fHtempTKLtrue->FindBin(nTracklets));
-  if(fHtempCL0true) fCentCL0true = fHtempCL0true->GetBinContent(fHtempCL0true->FindBin(nClusters[0]));
-  if(fHtempCL1true) fCentCL1true = fHtempCL1true->GetBinContent(fHtempCL1true->FindBin(spdCorr));
-  if(fHtempCNDtrue) fCentCNDtrue = fHtempCNDtrue->GetBinContent(fHtempCNDtrue->FindBin(multCND));
-  if(fHtempZNAtrue) fCentZNAtrue = fHtempZNAtrue->GetBinContent(fHtempZNAtrue->FindBin(znaTower));
-  if(fHtempZNCtrue) fCentZNCtrue = fHtempZNCtrue->GetBinContent(fHtempZNCtrue->FindBin(zncTower));
    
 
   // ***** Cleaning
@@ -2157,6 +2125,15 @@ Int_t AliCentralitySelectionTask::SetupRun(const AliVEvent* const esd)
   fV0MZDCEcalOutlierPar0 =  centOADB->V0MZDCEcalOutlierPar0();  
   fV0MZDCEcalOutlierPar1 =  centOADB->V0MZDCEcalOutlierPar1();  
 
+  // percentile lookups, in the order of the enum
+  TH1F* const lkHistos[kNLookups] = {
+    fHtempV0M, fHtempV0A, fHtempV0A0, fHtempV0A123, fHtempV0C, fHtempV0A23, fHtempV0C01, fHtempV0S,
+    fHtempV0MEq, fHtempV0AEq, fHtempV0CEq, fHtempFMD, fHtempTRK, fHtempTKL, fHtempCL0, fHtempCL1, fHtempCND,
+    fHtempZNA, fHtempZNC, fHtempZPA, fHtempZPC, fHtempV0MvsFMD, fHtempTKLvsV0M,
+    fHtempNPA, fHtempV0Mtrue, fHtempV0Atrue, fHtempV0Ctrue, fHtempV0MEqtrue, fHtempV0AEqtrue, fHtempV0CEqtrue, fHtempFMDtrue,
+    fHtempTRKtrue, fHtempTKLtrue, fHtempCL0true, fHtempCL1true, fHtempCNDtrue, fHtempZNAtrue, fHtempZNCtrue };
+  for (Int_t ilk = 0; ilk < kNLookups; ilk++) fLookup[ilk].Build(lkHistos[ilk]);
+
   return 0;
 }
 
@@ -10,6 +10,7 @@
 //*****************************************************
 
 #include "AliAnalysisTaskSE.h"
+#include "AliOADBCentrality.h"
 
 class TFile;
 class TH1F;
@@ -193,6 +194,13 @@ class AliCentralitySelectionTask : public AliAnalysisTaskSE {
   TH1F    *fHtempZPAtrue;       // histogram with centrality true (sim) vs multiplicity using ZPA
   TH1F    *fHtempZPCtrue;       // histogram with centrality true (sim) vs multiplicity using ZPC
 
+  // flat copies of the 1D percentile histograms, built in SetupRun
+  enum { kLkV0M, kLkV0A, kLkV0A0, kLkV0A123, kLkV0C, kLkV0A23, kLkV0C01, kLkV0S, kLkV0MEq, kLkV0AEq, kLkV0CEq,
+         kLkFMD, kLkTRK, kLkTKL, kLkCL0, kLkCL1, kLkCND, kLkZNA, kLkZNC, kLkZPA, kLkZPC, kLkV0MvsFMD, kLkTKLvsV0M,
+         kLkNPA, kLkV0Mtrue, kLkV0Atrue, kLkV0Ctrue, kLkV0MEqtrue, kLkV0AEqtrue, kLkV0CEqtrue, kLkFMDtrue,
+         kLkTRKtrue, kLkTKLtrue, kLkCL0true, kLkCL1true, kLkCNDtrue, kLkZNAtrue, kLkZNCtrue, kNLookups };
+  AliCentralityLookup fLookup[kNLookups]; //! percentile lookups of the current run
+
   TList   *fOutputList; // output list
   
 
@@ -327,7 +335,7 @@ class AliCentralitySelectionTask : public AliAnalysisTaskSE {
   TH1F *fHOutVertex ;           //control histogram for vertex SPD
   TH1F *fHOutVertexT0 ;         //control histogram for vertex T0
 
-  ClassDef(AliCentralitySelectionTask, 31);
+  ClassDef(AliCentralitySelectionTask, 32);
 };
 
 #endif
@@ -89,6 +89,9 @@ AliAnalysisTaskSE(),
   fQyContainer(0),
   fSparseDist(0),
   fHruns(0),
+  fPhiWeights(),
+  fQMeanTable(),
+  fQRmsTable(),
   fQVector(0),
   fQContributionX(0),
   fQContributionY(0),
@@ -140,6 +143,9 @@ AliEPSelectionTask::AliEPSelectionTask(const char *name):
   fQyContainer(0),
   fSparseDist(0),
   fHruns(0),
+  fPhiWeights(),
+  fQMeanTable(),
+  fQRmsTable(),
   fQVector(0),
   fQContributionX(0),
   fQContributionY(0),
@@ -294,11 +300,11 @@ void AliEPSelectionTask::UserExec(Option_t */*option*/)
 
       if (nt>4){
 
-	// qvector full event
-	fQVector = new TVector2(GetQ(esdEP,tracklist));
+	// qvector full event and subevents
+	TVector2 qq;
+	GetQAndQsub(qq, qq1, qq2, tracklist, esdEP);
+	fQVector = new TVector2(qq);
 	fEventplaneQ = fQVector->Phi()/2;
-	// q vector subevents
-	GetQsub(qq1, qq2, tracklist, esdEP);
 	fQsub1 = new TVector2(qq1);
 	fQsub2 = new TVector2(qq2);
 	fQsubRes = (fQsub1->Phi()/2 - fQsub2->Phi()/2);
@@ -388,11 +394,11 @@ void AliEPSelectionTask::UserExec(Option_t */*option*/)
 
       if (NT>4){
 
-	// qvector full event
-	fQVector = new TVector2(GetQ(esdEP,tracklist));
+	// qvector full event and subevents
+	TVector2 qq;
+	GetQAndQsub(qq, qq1, qq2, tracklist, esdEP);
+	fQVector = new TVector2(qq);
 	fEventplaneQ = fQVector->Phi()/2;
-	// q vector subevents
-	GetQsub(qq1, qq2, tracklist, esdEP);
 	fQsub1 = new TVector2(qq1);
 	fQsub2 = new TVector2(qq2);
 	fQsubRes = (fQsub1->Phi()/2 - fQsub2->Phi()/2);
@@ -619,6 +625,87 @@ void AliEPSelectionTask::GetQsub(TVector2 &Q1, TVector2 &Q2, TObjArray* tracklis
   Q2 = mQ[1];
 }
 
+//________________________________________________________________________
+void AliEPSelectionTask::GetQAndQsub(TVector2 &Q, TVector2 &Q1, TVector2 &Q2, TObjArray* tracklist, AliEventplane* EP)
+{
+  // Full event and subevent Q vectors in one loop over the tracks, same result as GetQ and GetQsub:
+  // the weight and the track contribution are computed once and added to the full event and its subevent
+  float mQx=0, mQy=0, mQx1=0, mQy1=0, mQx2=0, mQy2=0;
+  // get recentering values
+  Double_t mean[2], rms[2];
+  Recenter(0, mean);
+  Recenter(1, rms);
+
+  Bool_t knownSplit = (fSplitMethod == AliEPSelectionTask::kRandom || fSplitMethod == AliEPSelectionTask::kEta || fSplitMethod == AliEPSelectionTask::kCharge);
+  Bool_t negID = (fAnalysisInput.CompareTo("AOD")==0) && (fAODfilterbit == 128);
+  TRandom2 rn = 0;
+
+  int nt = tracklist->GetEntries();
+  int nhalf = int(nt/2.);
+  int trackcounter1=0, trackcounter2=0;
+
+  for (Int_t i = 0; i < nt; i++) {
+    AliVTrack* track = dynamic_cast<AliVTrack*> (tracklist->At(i));
+    if (!track) continue;
+    Double_t weight = GetWeight(track);
+    Int_t idtemp = track->GetID();
+    if (negID) idtemp = idtemp*(-1) - 1;
+    Double_t qx = weight*cos(2*track->Phi())/rms[0];
+    Double_t qy = weight*sin(2*track->Phi())/rms[1];
+
+    mQx += qx;
+    mQy += qy;
+    if (fSaveTrackContribution){
+      EP->GetQContributionXArray()->AddAt(qx,idtemp);
+      EP->GetQContributionYArray()->AddAt(qy,idtemp);
+    }
+
+    // subevent of the track, 0 if in none
+    Int_t sub = 0;
+    if (fSplitMethod == AliEPSelectionTask::kRandom){
+      // split the track set into 2 random subsets
+      if (trackcounter1 < nhalf && trackcounter2 < nhalf) sub = (rn.Rndm() < .5) ? 1 : 2;
+      else if (trackcounter1 >= nhalf) sub = 2;
+      else sub = 1;
+      if (sub == 1) trackcounter1++;
+      else trackcounter2++;
+    } else if (fSplitMethod == AliEPSelectionTask::kEta) {
+      Double_t eta = track->Eta();
+      if (eta > fEtaGap/2.) sub = 1;
+      else if (eta < -1.*fEtaGap/2.) sub = 2;
+    } else if (fSplitMethod == AliEPSelectionTask::kCharge) {
+      Short_t cha = track->Charge();
+      if (cha > 0) sub = 1;
+      else if (cha < 0) sub = 2;
+    }
+
+    if (sub == 1) {
+      mQx1 += qx;
+      mQy1 += qy;
+      if (fSaveTrackContribution){
+        EP->GetQContributionXArraysub1()->AddAt(qx,idtemp);
+        EP->GetQContributionYArraysub1()->AddAt(qy,idtemp);
+      }
+    } else if (sub == 2) {
+      mQx2 += qx;
+      mQy2 += qy;
+      if (fSaveTrackContribution){
+        EP->GetQContributionXArraysub2()->AddAt(qx,idtemp);
+        EP->GetQContributionYArraysub2()->AddAt(qy,idtemp);
+      }
+    }
+  }
+
+  // apply recenetering
+  Q.Set(mQx-(mean[0]/rms[0]), mQy-(mean[1]/rms[1]));
+  if (!knownSplit) {
+    printf("plane resolution determination method not available!\n\n ");
+    return;
+  }
+  Q1.Set(mQx1-(mean[0]/rms[0]), mQy1-(mean[1]/rms[1]));
+  Q2.Set(mQx2-(mean[0]/rms[0]), mQy2-(mean[1]/rms[1]));
+}
+
 //________________________________________________________________________
 void AliEPSelectionTask::SetPersonalESDtrackCuts(AliESDtrackCuts* trackcuts){
 
@@ -693,21 +780,16 @@ Double_t AliEPSelectionTask::GetPhiWeight(TObject* track1)
   Double_t phiweight=1;
   AliVTrack* track = dynamic_cast<AliVTrack*>(track1);
 
-  TH1F *phiDist = 0x0;
-  if(track) phiDist = SelectPhiDist(track);
-
-  if (fUsePhiWeight && phiDist && track) {
-    Double_t nParticles = phiDist->Integral();
-    Double_t nPhibins = phiDist->GetNbinsX();
-
-    Double_t Phi = track->Phi();
-
-    while (Phi<0) Phi += TMath::TwoPi();
-    while (Phi>TMath::TwoPi()) Phi -= TMath::TwoPi();
-
-    Double_t PhiDistValue = phiDist->GetBinContent(1+TMath::FloorNint((track->Phi())*nPhibins/TMath::TwoPi()));
-
-    if (PhiDistValue > 0) phiweight = nParticles/nPhibins/PhiDistValue;
+  if (fUsePhiWeight && track) {
+    // weights per bin are tabulated in SetPhiWeightTables on run change
+    Int_t idist = SelectPhiDistIndex(track);
+    if (idist >= 0 && fPhiWeights[idist].GetSize()) {
+      Int_t nPhibins = fPhiWeights[idist].GetSize() - 2;
+      Int_t bin = 1+TMath::FloorNint((track->Phi())*nPhibins/TMath::TwoPi());
+      if (bin < 0) bin = 0;
+      if (bin > nPhibins+1) bin = nPhibins+1;
+      phiweight = fPhiWeights[idist][bin];
+    }
   }
   return phiweight;
 }
@@ -716,16 +798,17 @@ Double_t AliEPSelectionTask::GetPhiWeight(TObject* track1)
 void AliEPSelectionTask::Recenter(Int_t var, Double_t * values)
 {
 
-  if (fUseRecentering && fQDist[0] && fQDist[1] && fCentrality!=-1.) {
+  if (fUseRecentering && fQDist[0] && fQDist[1] && fQMeanTable[0].GetSize() && fCentrality!=-1.) {
+    // mean and rms per bin are tabulated in SetRecenteringTables on run change
     Int_t centbin = fQDist[0]->FindBin(fCentrality);
 
     if(var==0) { // fill mean
-      values[0] = fQDist[0]->GetBinContent(centbin);
-      values[1] = fQDist[1]->GetBinContent(centbin);
+      values[0] = fQMeanTable[0][centbin];
+      values[1] = fQMeanTable[1][centbin];
     }
     else if(var==1) { // fill rms
-      values[0] = fQDist[0]->GetBinError(centbin);
-      values[1] = fQDist[1]->GetBinError(centbin);
+      values[0] = fQRmsTable[0][centbin];
+      values[1] = fQRmsTable[1][centbin];
       // protection against division by zero
       if(values[0]==0.0) values[0]=1.0;
       if(values[1]==0.0) values[1]=1.0;
@@ -814,6 +897,25 @@ void AliEPSelectionTask::SetPhiDist()
   AliInfo("No Phi-weights available. All Phi weights set to 1");
   SetUsePhiWeight(kFALSE);
   }
+  SetPhiWeightTables();
+}
+
+//__________________________________________________________________________
+void AliEPSelectionTask::SetPhiWeightTables()
+{
+  // Tabulate the phi weight of every bin (incl. under/overflow) of the phi distributions,
+  // so that GetPhiWeight does not need the integral and the bin search for every track
+  for (Int_t i = 0; i < 4; i++) {
+    fPhiWeights[i].Set(0);
+    if (!fPhiDist[i]) continue;
+    Int_t nPhibins = fPhiDist[i]->GetNbinsX();
+    Double_t nParticles = fPhiDist[i]->Integral();
+    fPhiWeights[i].Set(nPhibins+2);
+    for (Int_t bin = 0; bin <= nPhibins+1; bin++) {
+      Double_t PhiDistValue = fPhiDist[i]->GetBinContent(bin);
+      fPhiWeights[i][bin] = (PhiDistValue > 0) ? nParticles/nPhibins/PhiDistValue : 1.;
+    }
+  }
 }
 
 //__________________________________________________________________________
@@ -826,6 +928,7 @@ void AliEPSelectionTask::SetQvectorDist()
 
   if (!fQDist[0] || !fQDist[1]) {
     AliError(Form("Cannot find OADB q-vector distributions for run %d. Using default values (mean=0,rms=1).", fRunNumber));
+    SetRecenteringTables();
     return;
   }
 
@@ -852,6 +955,27 @@ void AliEPSelectionTask::SetQvectorDist()
   if (emptybins) {
     AliError("After Maximum of rebinning still empty Qxy-bins!!!");
   }
+  SetRecenteringTables();
+}
+
+//__________________________________________________________________________
+void AliEPSelectionTask::SetRecenteringTables()
+{
+  // Tabulate mean and rms of the q vector components for every centrality bin (incl. under/overflow)
+  for (Int_t i = 0; i < 2; i++) {
+    fQMeanTable[i].Set(0);
+    fQRmsTable[i].Set(0);
+  }
+  if (!fQDist[0] || !fQDist[1]) return;
+  for (Int_t i = 0; i < 2; i++) {
+    Int_t nbins = fQDist[i]->GetNbinsX();
+    fQMeanTable[i].Set(nbins+2);
+    fQRmsTable[i].Set(nbins+2);
+    for (Int_t bin = 0; bin <= nbins+1; bin++) {
+      fQMeanTable[i][bin] = fQDist[i]->GetBinContent(bin);
+      fQRmsTable[i][bin] = fQDist[i]->GetBinError(bin);
+    }
+  }
 }
 
 //__________________________________________________________________________
@@ -965,22 +1089,29 @@ void AliEPSelectionTask::SetOADBandPeriod()
 //_________________________________________________________________________
 TH1F* AliEPSelectionTask::SelectPhiDist(AliVTrack *track)
 {
-  if (fPeriod.CompareTo("LHC10h")==0  || fUserphidist) return fPhiDist[0];
+  Int_t idist = SelectPhiDistIndex(track);
+  return (idist >= 0) ? fPhiDist[idist] : 0;
+}
+
+//_________________________________________________________________________
+Int_t AliEPSelectionTask::SelectPhiDistIndex(AliVTrack *track) const
+{
+  if (fPeriod.CompareTo("LHC10h")==0  || fUserphidist) return 0;
   else if(fPeriod.CompareTo("LHC11h")==0)
     {
      if (track->Charge() < 0)
        {
-        if(track->Eta() < 0.)       return fPhiDist[0];
-        else if (track->Eta() > 0.) return fPhiDist[2];
+        if(track->Eta() < 0.)       return 0;
+        else if (track->Eta() > 0.) return 2;
        }
       else if (track->Charge() > 0)
        {
-        if(track->Eta() < 0.)       return fPhiDist[1];
-        else if (track->Eta() > 0.) return fPhiDist[3];
+        if(track->Eta() < 0.)       return 1;
+        else if (track->Eta() > 0.) return 3;
        }
 
     }
-  return 0;
+  return -1;
 }
 
 TObjArray* AliEPSelectionTask::GetTracksForLHC11h(AliESDEvent* esd)
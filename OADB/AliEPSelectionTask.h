@@ -9,6 +9,7 @@
 //   author: Alberica Toia, Johanna Gramling
 //*****************************************************
 
+#include "TArrayD.h"
 #include "AliAnalysisTaskSE.h"
 
 class TFile;
@@ -44,6 +45,7 @@ class AliEPSelectionTask : public AliAnalysisTaskSE {
   
   TVector2 GetQ(AliEventplane* EP, TObjArray* event);
   void GetQsub(TVector2& Qsub1, TVector2& Qsub2, TObjArray* event,AliEventplane* EP);
+  void GetQAndQsub(TVector2& Q, TVector2& Qsub1, TVector2& Qsub2, TObjArray* event, AliEventplane* EP); // GetQ and GetQsub in one loop over the tracks
   Double_t GetWeight(TObject* track1);
   Double_t GetPhiWeight(TObject* track1);
   void Recenter(Int_t var, Double_t * values);
@@ -72,6 +74,9 @@ class AliEPSelectionTask : public AliAnalysisTaskSE {
   TObjArray* GetAODTracksAndMaxID(AliAODEvent* aod, Int_t& maxid);
   void SetOADBandPeriod();
   TH1F* SelectPhiDist(AliVTrack *track);
+  Int_t SelectPhiDistIndex(AliVTrack *track) const;
+  void SetPhiWeightTables();
+  void SetRecenteringTables();
   TObjArray* GetTracksForLHC11h(AliESDEvent* esd);
 
   TString  fAnalysisInput; 		// "ESD", "AOD"
@@ -100,6 +105,9 @@ class AliEPSelectionTask : public AliAnalysisTaskSE {
   THnSparse *fSparseDist;               //! THn for eta-charge phi-weighting
   TProfile* fQDist[2];			// array of TProfiles with mean+rms for recentering
   TH1F *fHruns;                         // information about runwise statistics of phi-weights
+  TArrayD fPhiWeights[4];               //! phi weights per bin of fPhiDist (incl. under/overflow), set on run change
+  TArrayD fQMeanTable[2];               //! mean of q vector components per centrality bin of fQDist, set on run change
+  TArrayD fQRmsTable[2];                //! rms of q vector components per centrality bin of fQDist, set on run change
 
   TVector2* fQVector;			//! Q-Vector of the event  
   Double_t* fQContributionX;		//! array of the tracks' contributions to X component of Q-Vector - index = track ID
@@ -119,7 +127,7 @@ class AliEPSelectionTask : public AliAnalysisTaskSE {
   TH2F*	 fHOutDiff;			//! control histogram: Difference of MC RP and EP - only filled if fUseMCRP is true!
   TH2F*  fHOutleadPTPsi;		//! control histogram: emission angle of leading pT track vs EP angle
 
-  ClassDef(AliEPSelectionTask,4); 
+  ClassDef(AliEPSelectionTask,5); 
 };
 
 #endif
@@ -36,6 +36,7 @@ using std::vector;
 #include <AliLog.h>
 
 ClassImp(AliEventCutsContainer);
+ClassImp(AliEventCutsDecisions);
 ClassImp(AliEventCuts);
 
 
@@ -107,6 +108,7 @@ AliEventCuts::AliEventCuts(bool saveplots) : TList(),
   fSelectInelGt0{false},
   fOverrideInelGt0{false},
   fOverrideCentralityFramework{false},
+  fUseSharedDecisions{false},
   fTimeRangeCut{},
   fEMCALLEDEventsCut{},
   fCutStats{nullptr},
@@ -156,6 +158,126 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
     AddQAplotsToList();
   }
 
+  AliVMultiplicity* mult = ev->GetMultiplicity();
+  const int ntrkl = mult->GetNumberOfTracklets();
+
+  if (fUseMultiplicityDependentPileUpCuts) {
+    if (ntrkl < 20) fSPDpileupMinContributors = 3;
+    else if (ntrkl < 50) fSPDpileupMinContributors = 4;
+    else fSPDpileupMinContributors = 5;
+  }
+
+  /// Selection result, shared with the other instances with the same configuration if requested
+  double dz = 0.;
+  if (fUseSharedDecisions) {
+    AliEventCutsDecisions* decisions = static_cast<AliEventCutsDecisions*>(ev->FindListObject("AliEventCutsDecisions"));
+    if (!decisions) {
+      decisions = new AliEventCutsDecisions;
+      ev->AddObject(decisions);
+    }
+    decisions->SetEvent(ev);
+    const unsigned long long fingerprint = ConfigurationFingerprint();
+    const int idx = decisions->Find(fingerprint);
+    if (idx >= 0) {
+      fFlag = decisions->fFlag[idx];
+      fCentPercentiles[0] = decisions->fCentPercentiles[2 * idx];
+      fCentPercentiles[1] = decisions->fCentPercentiles[2 * idx + 1];
+      dz = decisions->fDeltaZ[idx];
+      fPrimaryVertex = const_cast<AliVVertex*>(decisions->fTrackVertex[idx] ? ev->GetPrimaryVertex() : ev->GetPrimaryVertexSPD());
+      fContainer.fMultESD = decisions->fMult[6 * idx];
+      fContainer.fMultTrkFB32 = decisions->fMult[6 * idx + 1];
+      fContainer.fMultTrkFB32Acc = decisions->fMult[6 * idx + 2];
+      fContainer.fMultTrkFB32TOF = decisions->fMult[6 * idx + 3];
+      fContainer.fMultTrkTPC = decisions->fMult[6 * idx + 4];
+      fContainer.fMultTrkTPCout = decisions->fMult[6 * idx + 5];
+      fContainer.fMultVZERO = decisions->fMultVZERO[idx];
+    } else {
+      ComputeFlag(ev, ntrkl, dz);
+      decisions->fFingerprint.push_back(fingerprint);
+      decisions->fFlag.push_back(fFlag);
+      decisions->fCentPercentiles.push_back(fCentPercentiles[0]);
+      decisions->fCentPercentiles.push_back(fCentPercentiles[1]);
+      decisions->fDeltaZ.push_back(dz);
+      decisions->fTrackVertex.push_back(fPrimaryVertex == ev->GetPrimaryVertex() ? 1 : 0);
+      decisions->fMult.push_back(fContainer.fMultESD);
+      decisions->fMult.push_back(fContainer.fMultTrkFB32);
+      decisions->fMult.push_back(fContainer.fMultTrkFB32Acc);
+      decisions->fMult.push_back(fContainer.fMultTrkFB32TOF);
+      decisions->fMult.push_back(fContainer.fMultTrkTPC);
+      decisions->fMult.push_back(fContainer.fMultTrkTPCout);
+      decisions->fMultVZERO.push_back(fContainer.fMultVZERO);
+    }
+  } else
+    ComputeFlag(ev, ntrkl, dz);
+  const AliVVertex* vtx = fPrimaryVertex;
+
+  //
+  /// Check if the EMCal event is bad due to LED system flashes
+  //
+  if ( fUseEMCALLEDEventsCut )
+  {
+    if ( !fEMCALLEDEventsCut.IsEMCALLEDEvent(ev,fCurrentRun) ) 
+      fFlag |= BIT(kEMCALEDCut); // accept event
+  }
+  else 
+    fFlag |= BIT(kEMCALEDCut); // accept event
+  //
+  
+  /// Ignore SPD/tracks vertex position and reconstruction individual flags
+  bool allcuts = CheckNormalisationMask(kPassesAllCuts);
+  if (allcuts) {
+    fFlag |= BIT(kAllCuts);
+  }
+  if (fCutStats) {
+    for (int iCut = kNoCuts; iCut <= kAllCuts; ++iCut) {
+      if (TESTBIT(fFlag,iCut)) {
+        fCutStats->Fill(iCut);
+        if (TESTBIT(fFlag,kTrigger)) {
+          fCutStatsAfterTrigger->Fill(iCut);
+        }
+        if (TESTBIT(fFlag,kMultiplicity)) {
+          fCutStatsAfterMultSelection->Fill(iCut);
+        }
+      }
+    }
+  }
+
+  /// Filling normalisation histogram
+  array <NormMask,5> norm_masks {
+    kAnyEvent,
+    kTriggeredEvent,
+    kPassesNonVertexRelatedSelections,
+    kHasReconstructedVertex,
+    kPassesAllCuts
+  };
+  for (int iC = 0; iC < 5; ++iC) {
+    if (CheckNormalisationMask(norm_masks[iC])) {
+      if (fNormalisationHist) {
+        fNormalisationHist->Fill(iC);
+      }
+    }
+  }
+
+  /// Filling the monitoring histograms (first iteration always filled, second iteration only for selected events.
+  for (int befaft = 0; befaft < 2; ++befaft) {
+    if (fCentrality[befaft]) fCentrality[befaft]->Fill(fCentPercentiles[0]);
+    if (fEstimCorrelation[befaft]) fEstimCorrelation[befaft]->Fill(fCentPercentiles[1],fCentPercentiles[0]);
+    if (fMultCentCorrelation[befaft]) fMultCentCorrelation[befaft]->Fill(fCentPercentiles[0],ntrkl);
+    if (fVtz[befaft]) fVtz[befaft]->Fill(vtx->GetZ());
+    if (fDeltaTrackSPDvtz[befaft]) fDeltaTrackSPDvtz[befaft]->Fill(dz);
+    if (fTOFvsFB32[befaft]) fTOFvsFB32[befaft]->Fill(fContainer.fMultTrkFB32,fContainer.fMultTrkFB32TOF);
+    if (fTPCvsAll[befaft])  fTPCvsAll[befaft]->Fill(fContainer.fMultTrkTPC,float(fContainer.fMultESD) - fESDvsTPConlyLinearCut[1] * fContainer.fMultTrkTPC);
+    if (fMultvsV0M[befaft]) fMultvsV0M[befaft]->Fill(GetCentrality(),fContainer.fMultTrkFB32Acc);
+    if (fTPCvsTrkl[befaft]) fTPCvsTrkl[befaft]->Fill(ntrkl,fContainer.fMultTrkTPC);
+    if (fVZEROvsTPCout[befaft]) fVZEROvsTPCout[befaft]->Fill(fContainer.fMultTrkTPCout,fContainer.fMultVZERO);
+    if (!allcuts) return false; /// Do not fill the "after" histograms if the event does not pass the cuts.
+  }
+
+  return true;
+}
+
+void AliEventCuts::ComputeFlag(AliVEvent *ev, int ntrkl, double &dz) {
+  /// Evaluation of all the cuts except the EMCal LED events cut, the result is stored in fFlag
   /// Event selection flag, as soon as the event does not pass one cut this becomes false.
   fFlag = BIT(kNoCuts);
 
@@ -211,7 +333,7 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
   double covTrc[6],covSPD[6];
   vtTrc->GetCovarianceMatrix(covTrc);
   vtSPD->GetCovarianceMatrix(covSPD);
-  double dz = bool(fFlag & kVertexSPD) && bool(fFlag & kVertexTracks) ? vtTrc->GetZ() - vtSPD->GetZ() : 0.; /// If one of the two vertices is not available this cut is always passed.
+  dz = bool(fFlag & kVertexSPD) && bool(fFlag & kVertexTracks) ? vtTrc->GetZ() - vtSPD->GetZ() : 0.; /// If one of the two vertices is not available this cut is always passed.
   double errTot = TMath::Sqrt(covTrc[5]+covSPD[5]);
   double errTrc = bool(fFlag & kVertexTracks) ? TMath::Sqrt(covTrc[5]) : 1.;
   double nsigTot = TMath::Abs(dz) / errTot, nsigTrc = TMath::Abs(dz) / errTrc;
@@ -229,13 +351,6 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
   bool usePileUpMV = (fUseCombinedMVSPDcut && vtx != vtSPD) || fPileUpCutMV;
   bool usePileUpSPD = (fUseCombinedMVSPDcut && vtx == vtSPD) || fUseSPDpileUpCut;
   AliVMultiplicity* mult = ev->GetMultiplicity();
-  const int ntrkl = mult->GetNumberOfTracklets();
-
-  if (fUseMultiplicityDependentPileUpCuts) {
-    if (ntrkl < 20) fSPDpileupMinContributors = 3;
-    else if (ntrkl < 50) fSPDpileupMinContributors = 4;
-    else fSPDpileupMinContributors = 5;
-  }
   if ((!usePileUpSPD || !ev->IsPileupFromSPD(fSPDpileupMinContributors,fSPDpileupMinZdist,fSPDpileupNsigmaZdist,fSPDpileupNsigmaDiamXY,fSPDpileupNsigmaDiamZ)) &&
       (!fTrackletBGcut || !fUtils.IsSPDClusterVsTrackletBG(ev)) &&
       (!usePileUpMV || !fUtils.IsPileUpMV(ev)))
@@ -326,69 +441,6 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
     fFlag |= BIT(kTimeRangeCut);
   }
 
-  //
-  /// Check if the EMCal event is bad due to LED system flashes
-  //
-  if ( fUseEMCALLEDEventsCut )
-  {
-    if ( !fEMCALLEDEventsCut.IsEMCALLEDEvent(ev,fCurrentRun) ) 
-      fFlag |= BIT(kEMCALEDCut); // accept event
-  }
-  else 
-    fFlag |= BIT(kEMCALEDCut); // accept event
-  //
-  
-  /// Ignore SPD/tracks vertex position and reconstruction individual flags
-  bool allcuts = CheckNormalisationMask(kPassesAllCuts);
-  if (allcuts) {
-    fFlag |= BIT(kAllCuts);
-  }
-  if (fCutStats) {
-    for (int iCut = kNoCuts; iCut <= kAllCuts; ++iCut) {
-      if (TESTBIT(fFlag,iCut)) {
-        fCutStats->Fill(iCut);
-        if (TESTBIT(fFlag,kTrigger)) {
-          fCutStatsAfterTrigger->Fill(iCut);
-        }
-        if (TESTBIT(fFlag,kMultiplicity)) {
-          fCutStatsAfterMultSelection->Fill(iCut);
-        }
-      }
-    }
-  }
-
-  /// Filling normalisation histogram
-  array <NormMask,5> norm_masks {
-    kAnyEvent,
-    kTriggeredEvent,
-    kPassesNonVertexRelatedSelections,
-    kHasReconstructedVertex,
-    kPassesAllCuts
-  };
-  for (int iC = 0; iC < 5; ++iC) {
-    if (CheckNormalisationMask(norm_masks[iC])) {
-      if (fNormalisationHist) {
-        fNormalisationHist->Fill(iC);
-      }
-    }
-  }
-
-  /// Filling the monitoring histograms (first iteration always filled, second iteration only for selected events.
-  for (int befaft = 0; befaft < 2; ++befaft) {
-    if (fCentrality[befaft]) fCentrality[befaft]->Fill(fCentPercentiles[0]);
-    if (fEstimCorrelation[befaft]) fEstimCorrelation[befaft]->Fill(fCentPercentiles[1],fCentPercentiles[0]);
-    if (fMultCentCorrelation[befaft]) fMultCentCorrelation[befaft]->Fill(fCentPercentiles[0],ntrkl);
-    if (fVtz[befaft]) fVtz[befaft]->Fill(vtx->GetZ());
-    if (fDeltaTrackSPDvtz[befaft]) fDeltaTrackSPDvtz[befaft]->Fill(dz);
-    if (fTOFvsFB32[befaft]) fTOFvsFB32[befaft]->Fill(fContainer.fMultTrkFB32,fContainer.fMultTrkFB32TOF);
-    if (fTPCvsAll[befaft])  fTPCvsAll[befaft]->Fill(fContainer.fMultTrkTPC,float(fContainer.fMultESD) - fESDvsTPConlyLinearCut[1] * fContainer.fMultTrkTPC);
-    if (fMultvsV0M[befaft]) fMultvsV0M[befaft]->Fill(GetCentrality(),fContainer.fMultTrkFB32Acc);
-    if (fTPCvsTrkl[befaft]) fTPCvsTrkl[befaft]->Fill(ntrkl,fContainer.fMultTrkTPC);
-    if (fVZEROvsTPCout[befaft]) fVZEROvsTPCout[befaft]->Fill(fContainer.fMultTrkTPCout,fContainer.fMultVZERO);
-    if (!allcuts) return false; /// Do not fill the "after" histograms if the event does not pass the cuts.
-  }
-
-  return true;
 }
 
 void AliEventCuts::AddQAplotsToList(TList *qaList, bool addCorrelationPlots) {
@@ -601,6 +653,105 @@ string AliEventCuts::GetCentralityEstimator (unsigned int estimator) const {
 }
 
 
+bool AliEventCutsDecisions::SetEvent(AliVEvent *ev) {
+  /// The stored results are dropped when a new event is found
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  const unsigned long long key[4] = {
+    (unsigned long long)(mgr ? mgr->GetCurrentEntry() : -1),
+    ((unsigned long long)(ev->GetBunchCrossNumber()) << 32) + ev->GetTimeStamp(),
+    (unsigned long long)ev->GetRunNumber(),
+    (unsigned long long)ev->GetNumberOfTracks()
+  };
+  if (key[0] == fEventKey[0] && key[1] == fEventKey[1] && key[2] == fEventKey[2] && key[3] == fEventKey[3]) return false;
+  for (int i = 0; i < 4; ++i) fEventKey[i] = key[i];
+  Clear();
+  return true;
+}
+
+int AliEventCutsDecisions::Find(unsigned long long fingerprint) const {
+  for (size_t i = 0; i < fFingerprint.size(); ++i)
+    if (fFingerprint[i] == fingerprint) return int(i);
+  return -1;
+}
+
+void AliEventCutsDecisions::Clear(Option_t*) {
+  fFingerprint.clear();
+  fFlag.clear();
+  fCentPercentiles.clear();
+  fDeltaZ.clear();
+  fTrackVertex.clear();
+  fMult.clear();
+  fMultVZERO.clear();
+}
+
+unsigned long long AliEventCuts::ConfigurationFingerprint() const {
+  /// Hash of all the settings entering ComputeFlag. The number of SPD pile-up contributors is
+  /// skipped when it is set from the event multiplicity.
+  unsigned long long h = fUtils.GetConfigurationHash();
+#define HASH_MEMBER(x) h = AliAnalysisUtils::HashBytes(&(x), sizeof(x), h)
+  HASH_MEMBER(fMC);
+  HASH_MEMBER(fRequireTrackVertex);
+  HASH_MEMBER(fMinVtz);
+  HASH_MEMBER(fMaxVtz);
+  HASH_MEMBER(fMaxDeltaSpdTrackAbsolute);
+  HASH_MEMBER(fMaxDeltaSpdTrackNsigmaSPD);
+  HASH_MEMBER(fMaxDeltaSpdTrackNsigmaTrack);
+  HASH_MEMBER(fMaxResolutionSPDvertex);
+  HASH_MEMBER(fMaxDispersionSPDvertex);
+  HASH_MEMBER(fCheckAODvertex);
+  HASH_MEMBER(fRejectDAQincomplete);
+  HASH_MEMBER(fRequiredSolenoidPolarity);
+  HASH_MEMBER(fUseCombinedMVSPDcut);
+  HASH_MEMBER(fUseMultiplicityDependentPileUpCuts);
+  HASH_MEMBER(fUseSPDpileUpCut);
+  if (!fUseMultiplicityDependentPileUpCuts) HASH_MEMBER(fSPDpileupMinContributors);
+  HASH_MEMBER(fSPDpileupMinZdist);
+  HASH_MEMBER(fSPDpileupNsigmaZdist);
+  HASH_MEMBER(fSPDpileupNsigmaDiamXY);
+  HASH_MEMBER(fSPDpileupNsigmaDiamZ);
+  HASH_MEMBER(fTrackletBGcut);
+  HASH_MEMBER(fPileUpCutMV);
+  HASH_MEMBER(fCentralityFramework);
+  HASH_MEMBER(fMinCentrality);
+  HASH_MEMBER(fMaxCentrality);
+  HASH_MEMBER(fUseVariablesCorrelationCuts);
+  HASH_MEMBER(fUseEstimatorsCorrelationCut);
+  HASH_MEMBER(fUseStrongVarCorrelationCut);
+  HASH_MEMBER(fUseITSTPCCluCorrelationCut);
+  HASH_MEMBER(fUseTPCTracklCorrelationCut);
+  HASH_MEMBER(fEstimatorsCorrelationCoef);
+  HASH_MEMBER(fEstimatorsSigmaPars);
+  HASH_MEMBER(fDeltaEstimatorNsigma);
+  HASH_MEMBER(fTOFvsFB32correlationPars);
+  HASH_MEMBER(fTOFvsFB32sigmaPars);
+  HASH_MEMBER(fTOFvsFB32nSigmaCut);
+  HASH_MEMBER(fESDvsTPConlyLinearCut);
+  HASH_MEMBER(fFB128vsTrklLinearCut);
+  HASH_MEMBER(fVZEROvsTPCoutPolCut);
+  HASH_MEMBER(fITSvsTPCcluPolCut);
+  HASH_MEMBER(fRequireExactTriggerMask);
+  HASH_MEMBER(fTriggerMask);
+  HASH_MEMBER(fMultSelectionEvCuts);
+  HASH_MEMBER(fUseTimeRangeCut);
+  HASH_MEMBER(fSelectInelGt0);
+  const bool trackMultQA = (fTOFvsFB32[0] != nullptr);
+  HASH_MEMBER(trackMultQA);
+#undef HASH_MEMBER
+  for (const std::string& myClass : fTriggerClasses)
+    h = AliAnalysisUtils::HashBytes(myClass.data(), myClass.size() + 1, h);
+  for (int i = 0; i < 2; ++i)
+    h = AliAnalysisUtils::HashBytes(fCentEstimators[i].data(), fCentEstimators[i].size() + 1, h);
+  const TString& oadbPath = fTimeRangeCut.GetOADPath();
+  h = AliAnalysisUtils::HashBytes(oadbPath.Data(), oadbPath.Length() + 1, h);
+  if (fMultiplicityV0McorrCut) {
+    const TString formula = fMultiplicityV0McorrCut->GetExpFormula();
+    h = AliAnalysisUtils::HashBytes(formula.Data(), formula.Length() + 1, h);
+    const int nPar = fMultiplicityV0McorrCut->GetNpar();
+    if (nPar > 0) h = AliAnalysisUtils::HashBytes(fMultiplicityV0McorrCut->GetParameters(), nPar * sizeof(double), h);
+  }
+  return h;
+}
+
 void AliEventCuts::ComputeTrackMultiplicity(AliVEvent *ev) {
   AliEventCutsContainer* tmp_cont = static_cast<AliEventCutsContainer*>(ev->FindListObject("AliEventCutsContainer"));
   if (tmp_cont) {
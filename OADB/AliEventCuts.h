@@ -46,6 +46,35 @@ class AliEventCutsContainer : public TNamed {
   ClassDef(AliEventCutsContainer,2)
 };
 
+/// Event selection results of the AliEventCuts instances of a train, shared through the event
+/// and keyed on the configuration fingerprint, see AliEventCuts::UseSharedDecisions
+class AliEventCutsDecisions : public TNamed {
+  public:
+    AliEventCutsDecisions() : TNamed("AliEventCutsDecisions","AliEventCutsDecisions"),
+    fEventKey{0ull,0ull,0ull,0ull},
+    fFingerprint{},
+    fFlag{},
+    fCentPercentiles{},
+    fDeltaZ{},
+    fTrackVertex{},
+    fMult{},
+    fMultVZERO{} {}
+
+    bool SetEvent(AliVEvent *ev);   ///< returns true if the stored results belong to another event
+    int  Find(unsigned long long fingerprint) const;
+    void Clear(Option_t* = "");
+
+    unsigned long long fEventKey[4];            ///< event identifier (entry in the chain, bunch crossing and time stamp, run, number of tracks)
+    std::vector<unsigned long long> fFingerprint; ///< configuration fingerprint of each result
+    std::vector<unsigned long> fFlag;           ///< flag of the passed cuts
+    std::vector<float> fCentPercentiles;        ///< centrality percentiles, 2 per result
+    std::vector<double> fDeltaZ;                ///< track-SPD vertex distance
+    std::vector<int> fTrackVertex;              ///< primary vertex from tracks (1) or SPD (0)
+    std::vector<int> fMult;                     ///< track multiplicities of AliEventCutsContainer, 6 per result
+    std::vector<double> fMultVZERO;             ///< VZERO multiplicity of AliEventCutsContainer
+  ClassDef(AliEventCutsDecisions,1)
+};
+
 class AliEventCuts : public TList {
   public:
     AliEventCuts(bool savePlots = false);
@@ -102,6 +131,9 @@ class AliEventCuts : public TList {
     void   SetupRun2pA(int iPeriod);
     void   UseMultSelectionEventSelection(bool useIt = true);
     void   SetAcceptedTriggerClasses(TString classes);
+    /// share the event selection result with the instances with identical configuration
+    /// (evaluated once per event, the QA histograms are filled by each instance)
+    void   UseSharedDecisions(bool useIt = true) { fUseSharedDecisions = useIt; }
 
     static bool GoodPrimaryAODVertex(AliVEvent *ev);
 
@@ -197,6 +229,8 @@ class AliEventCuts : public TList {
     AliEventCuts operator=(const AliEventCuts& copy);
     void          AutomaticSetup (AliVEvent *ev);
     void          ComputeTrackMultiplicity(AliVEvent *ev);
+    void          ComputeFlag(AliVEvent *ev, int ntrkl, double &dz);
+    unsigned long long ConfigurationFingerprint() const;
     template<typename F> F PolN(F x, F* coef, int n);
 
     bool          fManualMode;                    ///< if true the cuts are not loaded automatically looking at the run number
@@ -220,6 +254,7 @@ class AliEventCuts : public TList {
     bool          fSelectInelGt0;                 ///< Select only INEL > 0 events
     bool          fOverrideInelGt0;               ///< If the user ask for a configuration, let's not touch it
     bool          fOverrideCentralityFramework;   ///< If the user ask (not) to run a centrality framework this should be onored by AliEventCuts 
+    bool          fUseSharedDecisions;            ///< Share the selection result with the instances with identical configuration
 
     AliTimeRangeCut fTimeRangeCut;       ///< Time Range cut
   
@@ -245,7 +280,7 @@ class AliEventCuts : public TList {
     AliESDtrackCuts* fFB32trackCuts; //!<! Cuts corresponding to FB32 in the ESD (used only for correlations cuts in ESDs)
     AliESDtrackCuts* fTPConlyCuts;   //!<! Cuts corresponding to the standalone TPC cuts in the ESDs (used only for correlations cuts in ESDs)
 
-    ClassDef(AliEventCuts, 16)
+    ClassDef(AliEventCuts, 17)
 };
 
 template<typename F> F AliEventCuts::PolN(F x,F* coef, int n) {
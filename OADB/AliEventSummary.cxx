@@ -0,0 +1,99 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+//-------------------------------------------------------------------------
+//                      Implementation of Class AliEventSummary
+//
+// Per-event summary for the pileup and multiplicity selections, see the
+// header
+//-------------------------------------------------------------------------
+
+#include "AliEventSummary.h"
+#include "AliVEvent.h"
+#include "AliAnalysisManager.h"
+
+ClassImp(AliEventSummary)
+
+AliEventSummary* AliEventSummary::fgSummary = 0;
+
+AliEventSummary::AliEventSummary() :
+  TObject(),
+  fMVFilled(kFALSE),
+  fNPileupVtxMV(0),
+  fNoPrimaryMV(kFALSE),
+  fBCPrimaryMV(0),
+  fContribMV(),
+  fChi2MV(),
+  fBCMV(),
+  fWDistMV(),
+  fSPDPileup(),
+  fSPDPileupInMultBins(-1),
+  fSPDFilled(kFALSE),
+  fSPDTracklets(0),
+  fIRFilled(kFALSE),
+  fIRInt1(0),
+  fIRInt2(0),
+  fV0Filled(kFALSE),
+  fV0Available(kFALSE),
+  fV0A(0),
+  fV0C(0),
+  fV0AEq(0),
+  fV0CEq(0),
+  fV0Apartial(0),
+  fV0Cpartial(0),
+  fINELgtZERO(-1),
+  fAcceptedVertex(-1),
+  fConsistentVertices(-1),
+  fReferenceMult(-999),
+  fEvent(0),
+  fEntry(-1)
+{
+  // constructor
+  fSPDClusters[0] = fSPDClusters[1] = 0;
+}
+
+void AliEventSummary::Reset()
+{
+  // invalidates all the sections
+  fMVFilled = kFALSE;
+  fContribMV.clear();
+  fChi2MV.clear();
+  fBCMV.clear();
+  fWDistMV.clear();
+  fSPDPileup.clear();
+  fSPDPileupInMultBins = -1;
+  fSPDFilled = kFALSE;
+  fIRFilled = kFALSE;
+  fV0Filled = kFALSE;
+  fINELgtZERO = -1;
+  fAcceptedVertex = -1;
+  fConsistentVertices = -1;
+  fReferenceMult = -999;
+}
+
+AliEventSummary* AliEventSummary::Get(const AliVEvent* event)
+{
+  // summary of the event, reset if it was filled for another event
+  // (without analysis manager the entry is unknown and the summary is always reset)
+  AliAnalysisManager* mgr = AliAnalysisManager::GetAnalysisManager();
+  Long64_t entry = mgr ? mgr->GetCurrentEntry() : -1;
+  if (!fgSummary) fgSummary = new AliEventSummary();
+  if (event != fgSummary->fEvent || entry != fgSummary->fEntry || entry < 0) {
+    fgSummary->Reset();
+    fgSummary->fEvent = event;
+    fgSummary->fEntry = entry;
+  }
+  return fgSummary;
+}
@@ -0,0 +1,91 @@
+#ifndef ALIEVENTSUMMARY_H
+#define ALIEVENTSUMMARY_H
+
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+//-------------------------------------------------------------------------
+//                      Class AliEventSummary
+//
+// Per-event summary of the quantities used by the pileup, background and
+// multiplicity selections of AliAnalysisUtils and AliPPVsMultUtils
+// (pileup vertices, SPD clusters and tracklets, VZERO amplitudes, ...).
+// A single summary is shared by all the instances of the utilities in the
+// train; each section is filled by the first utility which needs it and
+// the summary is reset when the analysis manager moves to another entry.
+// Outside of an analysis manager the summary is reset at each request.
+//-------------------------------------------------------------------------
+
+#include <vector>
+
+#include <TObject.h>
+
+class AliVEvent;
+
+class AliEventSummary : public TObject {
+public:
+  AliEventSummary();
+  virtual ~AliEventSummary() {}
+
+  static AliEventSummary* Get(const AliVEvent* event);
+  void Reset();
+
+  // multi-vertexer pileup vertices (AliAnalysisUtils::IsPileUpMV)
+  Bool_t                fMVFilled;          //! section filled
+  Int_t                 fNPileupVtxMV;      //! number of track pileup vertices
+  Bool_t                fNoPrimaryMV;       //! pileup vertices but no track primary vertex
+  Int_t                 fBCPrimaryMV;       //! BC of the primary vertex
+  std::vector<Int_t>    fContribMV;         //! contributors of the pileup vertices
+  std::vector<Float_t>  fChi2MV;            //! chi2/ndf of the pileup vertices
+  std::vector<Int_t>    fBCMV;              //! BC of the pileup vertices
+  std::vector<Float_t>  fWDistMV;           //! weighted distance to the primary vertex
+
+  // SPD pileup (IsPileupFromSPD for each set of settings, IsPileupFromSPDInMultBins)
+  struct SPDPileup {
+    Int_t   fMinContrib;
+    Float_t fMinZdist;
+    Float_t fNSigmaZdist;
+    Float_t fNSigmaDiamXY;
+    Float_t fNSigmaDiamZ;
+    Bool_t  fIsPileup;
+  };
+  std::vector<SPDPileup> fSPDPileup;        //! IsPileupFromSPD results
+  Int_t                 fSPDPileupInMultBins; //! IsPileupFromSPDInMultBins, -1 if not evaluated
+
+  // SPD clusters and tracklets, out-of-bunch pileup from the trigger
+  Bool_t                fSPDFilled;         //! section filled
+  Int_t                 fSPDClusters[2];    //! SPD clusters per layer
+  Int_t                 fSPDTracklets;      //! SPD tracklets
+  Bool_t                fIRFilled;          //! section filled
+  Int_t                 fIRInt1;            //! closest Int1 interaction in the IR map
+  Int_t                 fIRInt2;            //! closest Int2 interaction in the IR map
+
+  // VZERO amplitudes (AliPPVsMultUtils::GetMultiplicityPercentile)
+  Bool_t                fV0Filled;          //! section filled
+  Bool_t                fV0Available;       //! VZERO data present
+  Float_t               fV0A;               //! multiplicity V0 side A
+  Float_t               fV0C;               //! multiplicity V0 side C
+  Float_t               fV0AEq;             //! equalized multiplicity V0 side A
+  Float_t               fV0CEq;             //! equalized multiplicity V0 side C
+  Float_t               fV0Apartial;        //! multiplicity of the inner rings of V0A
+  Float_t               fV0Cpartial;        //! multiplicity of the outer rings of V0C
+
+  // event selection of AliPPVsMultUtils, -1 if not evaluated
+  Int_t                 fINELgtZERO;        //! INEL>0 with tracklets
+  Int_t                 fAcceptedVertex;    //! |z| of the primary vertex < 10 cm
+  Int_t                 fConsistentVertices; //! no inconsistent SPD and track vertices
+  Long_t                fReferenceMult;     //! standard reference multiplicity, -999 if not evaluated
+
+private:
+  AliEventSummary(const AliEventSummary&);
+  AliEventSummary& operator=(const AliEventSummary&);
+
+  const AliVEvent*      fEvent;             //! event of the summary
+  Long64_t              fEntry;             //! analysis manager entry of the event
+
+  static AliEventSummary* fgSummary;        //! summary shared by the utilities
+
+  ClassDef(AliEventSummary, 1); // Per-event summary for the pileup and multiplicity selections
+};
+
+#endif
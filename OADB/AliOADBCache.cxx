@@ -0,0 +1,196 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+#include <algorithm>
+
+#include "TFile.h"
+#include "TChain.h"
+#include "TObjArray.h"
+#include "TObjString.h"
+#include "TPRegexp.h"
+
+#include "AliLog.h"
+#include "AliOADBContainer.h"
+
+#include "AliOADBCache.h"
+
+ClassImp(AliOADBCache)
+
+AliOADBCache* AliOADBCache::fgInstance = 0x0;
+
+//______________________________________________________________________________
+AliOADBCache::AliOADBCache() :
+  TObject(),
+  fFiles(),
+  fContainers(),
+  fObjects(),
+  fObjectIndex(),
+  fMaxObjects(64),
+  fNHits(0),
+  fNMisses(0)
+{
+}
+
+//______________________________________________________________________________
+AliOADBCache::~AliOADBCache()
+{
+  Clear();
+  if (fgInstance == this) fgInstance = 0x0;
+}
+
+//______________________________________________________________________________
+AliOADBCache* AliOADBCache::Instance()
+{
+  if (!fgInstance) fgInstance = new AliOADBCache();
+  return fgInstance;
+}
+
+//______________________________________________________________________________
+TFile* AliOADBCache::GetFile(const char* fileName)
+{
+  // open the file on first use, 0x0 if it cannot be opened
+  const std::string key(fileName);
+  std::map<std::string, TFile*>::iterator it = fFiles.find(key);
+  if (it != fFiles.end()) return it->second;
+
+  TFile* file = TFile::Open(fileName);
+  if (!file || !file->IsOpen()) {
+    delete file;
+    AliErrorF("Cannot open OADB file %s", fileName);
+    return 0x0;
+  }
+  AliInfoF("Opened OADB file %s", fileName);
+  fFiles[key] = file;
+  return file;
+}
+
+//______________________________________________________________________________
+AliOADBContainer* AliOADBCache::GetContainer(const char* fileName, const char* containerName)
+{
+  // read the container on first use, 0x0 if not found
+  const std::string key = std::string(fileName) + "#" + containerName;
+  std::map<std::string, AliOADBContainer*>::iterator it = fContainers.find(key);
+  if (it != fContainers.end()) return it->second;
+
+  TFile* file = GetFile(fileName);
+  if (!file) return 0x0;
+  AliOADBContainer* cont = dynamic_cast<AliOADBContainer*>(file->Get(containerName));
+  if (!cont) {
+    AliErrorF("OADB file %s does not contain an AliOADBContainer named %s", fileName, containerName);
+    return 0x0;
+  }
+  fContainers[key] = cont;
+  return cont;
+}
+
+//______________________________________________________________________________
+TObject* AliOADBCache::GetObject(const char* fileName, const char* containerName, Int_t run,
+                                 const char* defaultName, const char* passName)
+{
+  // object for the run from the container, memoized (also if not found)
+  const std::string key = Form("%s#%s#%d#%s#%s", fileName, containerName, run, defaultName, passName);
+  std::map<std::string, ObjectList_t::iterator>::iterator it = fObjectIndex.find(key);
+  if (it != fObjectIndex.end()) {
+    ++fNHits;
+    fObjects.splice(fObjects.begin(), fObjects, it->second);
+    return it->second->second;
+  }
+
+  AliOADBContainer* cont = GetContainer(fileName, containerName);
+  if (!cont) return 0x0;
+  ++fNMisses;
+  TObject* obj = cont->GetObject(run, defaultName, passName);
+
+  fObjects.push_front(std::make_pair(key, obj));
+  fObjectIndex[key] = fObjects.begin();
+  while (fObjects.size() > fMaxObjects) {
+    // the objects are owned by the containers, only the lookup is dropped
+    fObjectIndex.erase(fObjects.back().first);
+    fObjects.pop_back();
+  }
+  return obj;
+}
+
+//______________________________________________________________________________
+Int_t AliOADBCache::Prefetch(const char* fileName, const char* containerName, const std::vector<Int_t>& runs,
+                             const char* defaultName, const char* passName)
+{
+  // read the objects of the given runs, returns the number of runs with an object
+  if (runs.size() > fMaxObjects) SetMaxObjects(runs.size());
+  Int_t nFound = 0;
+  for (size_t i = 0; i < runs.size(); ++i) {
+    if (GetObject(fileName, containerName, runs[i], defaultName, passName)) ++nFound;
+  }
+  AliInfoF("Prefetched %d/%d runs from %s (%s)", nFound, (Int_t)runs.size(), fileName, containerName);
+  return nFound;
+}
+
+//______________________________________________________________________________
+void AliOADBCache::GetRunsFromChain(TChain* chain, std::vector<Int_t>& runs)
+{
+  // run numbers from the file names of the chain (run directory, e.g. /000245145/ or /282343/)
+  runs.clear();
+  if (!chain || !chain->GetListOfFiles()) return;
+  TPRegexp re("/0*([1-9][0-9]{5})/");
+  TIter next(chain->GetListOfFiles());
+  TObject* element = 0x0;
+  while ((element = next())) {
+    TString fileName = element->GetTitle();
+    TObjArray* match = re.MatchS(fileName);
+    if (match && match->GetEntriesFast() > 1) {
+      const Int_t run = static_cast<TObjString*>(match->At(1))->GetString().Atoi();
+      if (std::find(runs.begin(), runs.end(), run) == runs.end()) runs.push_back(run);
+    }
+    delete match;
+  }
+  std::sort(runs.begin(), runs.end());
+}
+
+//______________________________________________________________________________
+void AliOADBCache::SetMaxObjects(UInt_t n)
+{
+  fMaxObjects = n > 0 ? n : 1;
+  while (fObjects.size() > fMaxObjects) {
+    fObjectIndex.erase(fObjects.back().first);
+    fObjects.pop_back();
+  }
+}
+
+//______________________________________________________________________________
+void AliOADBCache::Clear(Option_t*)
+{
+  // drop the objects and containers and close the files
+  fObjects.clear();
+  fObjectIndex.clear();
+  for (std::map<std::string, AliOADBContainer*>::iterator it = fContainers.begin(); it != fContainers.end(); ++it) {
+    delete it->second;
+  }
+  fContainers.clear();
+  for (std::map<std::string, TFile*>::iterator it = fFiles.begin(); it != fFiles.end(); ++it) {
+    it->second->Close();
+    delete it->second;
+  }
+  fFiles.clear();
+}
+
+//______________________________________________________________________________
+void AliOADBCache::Print(Option_t*) const
+{
+  Printf("AliOADBCache: %d files, %d containers, %d/%u objects, %llu hits, %llu misses",
+         (Int_t)fFiles.size(), (Int_t)fContainers.size(), (Int_t)fObjects.size(), fMaxObjects, fNHits, fNMisses);
+  for (std::map<std::string, AliOADBContainer*>::const_iterator it = fContainers.begin(); it != fContainers.end(); ++it) {
+    Printf("  %s", it->first.c_str());
+  }
+}
@@ -0,0 +1,77 @@
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+#ifndef ALIOADBCACHE_H
+#define ALIOADBCACHE_H
+
+/// \file AliOADBCache.h
+/// \brief Process-wide cache of OADB files, containers and objects
+
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "TObject.h"
+
+class TFile;
+class TChain;
+class AliOADBContainer;
+
+/// \class AliOADBCache
+/// \brief Process-wide cache of OADB files, containers and objects
+///
+/// The OADB files are opened once per process and the containers are read once per file,
+/// instead of on every run change by each user (AliMultSelectionTask, AliPhysicsSelection,
+/// AliTimeRangeCut, ...). The results of AliOADBContainer::GetObject are memoized in a
+/// least-recently-used list of size GetMaxObjects().
+///
+/// The objects returned by GetObject() are owned by the cached containers: users that
+/// modify or delete them have to work on a copy.
+///
+/// Usage:
+///   `AliOADBContainer* cont = AliOADBCache::Instance()->GetContainer(fileName, "MultSel");`
+///   `TObject* obj = AliOADBCache::Instance()->GetObject(fileName, "MultSel", run, "Default");`
+/// Optionally, the objects for all the runs of the input chain can be read before the event loop:
+///   `std::vector<Int_t> runs; AliOADBCache::GetRunsFromChain(chain, runs);`
+///   `AliOADBCache::Instance()->Prefetch(fileName, "MultSel", runs, "Default");`
+class AliOADBCache : public TObject {
+  public:
+    static AliOADBCache* Instance();
+    virtual ~AliOADBCache();
+
+    TFile* GetFile(const char* fileName);
+    AliOADBContainer* GetContainer(const char* fileName, const char* containerName);
+    TObject* GetObject(const char* fileName, const char* containerName, Int_t run,
+                       const char* defaultName = "", const char* passName = "");
+
+    Int_t Prefetch(const char* fileName, const char* containerName, const std::vector<Int_t>& runs,
+                   const char* defaultName = "", const char* passName = "");
+    static void GetRunsFromChain(TChain* chain, std::vector<Int_t>& runs);
+
+    void   SetMaxObjects(UInt_t n);
+    UInt_t GetMaxObjects() const { return fMaxObjects; }
+
+    virtual void Clear(Option_t* option = "");
+    virtual void Print(Option_t* option = "") const;
+
+  private:
+    AliOADBCache();
+    AliOADBCache(const AliOADBCache&);
+    AliOADBCache& operator= (const AliOADBCache&);
+
+    typedef std::list<std::pair<std::string, TObject*> > ObjectList_t;
+
+    std::map<std::string, TFile*> fFiles;                          //!<! open files by name
+    std::map<std::string, AliOADBContainer*> fContainers;          //!<! containers by file and name
+    ObjectList_t fObjects;                                         //!<! memoized objects, most recent first
+    std::map<std::string, ObjectList_t::iterator> fObjectIndex;    //!<! position of the objects in fObjects
+    UInt_t fMaxObjects;                                            //!<! maximum number of memoized objects
+    ULong64_t fNHits;                                              //!<! object lookups served from the cache
+    ULong64_t fNMisses;                                            //!<! object lookups done in the containers
+
+    static AliOADBCache* fgInstance;                               //!<! singleton instance
+
+    ClassDef(AliOADBCache, 1)
+};
+
+#endif
@@ -23,6 +23,7 @@
 
 #include "AliOADBCentrality.h"
 ClassImp(AliOADBCentrality);
+ClassImp(AliCentralityLookup);
 
 //______________________________________________________________________________
 AliOADBCentrality::AliOADBCentrality() : 
@@ -89,3 +90,22 @@ AliOADBCentrality::~AliOADBCentrality()
 {
   // destructor
 }
+//______________________________________________________________________________
+void AliCentralityLookup::Build(const TH1* h)
+{
+  // copy the axis and the bin contents of the histogram, reset if null
+  fEdges.clear();
+  fContents.clear();
+  fNbins = 0;
+  if (!h) return;
+  const TAxis* axis = h->GetXaxis();
+  fNbins = axis->GetNbins();
+  fXmin  = axis->GetXmin();
+  fXmax  = axis->GetXmax();
+  if (axis->GetXbins()->GetSize()) {
+    const TArrayD* edges = axis->GetXbins();
+    fEdges.assign(edges->GetArray(), edges->GetArray()+edges->GetSize());
+  }
+  fContents.resize(fNbins+2);
+  for (Int_t ib = 0; ib <= fNbins+1; ib++) fContents[ib] = h->GetBinContent(ib);
+}
@@ -11,10 +11,13 @@
 //     Author: Andreas Morsch, CERN
 //-------------------------------------------------------------------------
 
+#include <vector>
+
 #include <TNamed.h>
 #include <TList.h>
 #include <TH1F.h>
 #include <TH2F.h>
+#include <TMath.h>
 
 
 class AliOADBCentrality : public TNamed {
@@ -174,4 +177,39 @@ class AliOADBCentrality : public TNamed {
   ClassDef(AliOADBCentrality, 3);
 };
 
+//-------------------------------------------------------------------------
+//     Flat copy of a centrality percentile histogram, built once per run.
+//     GetPercentile(x) returns the same value as h->GetBinContent(h->FindBin(x))
+//     (including the underflow and overflow bins) without the virtual calls
+//     of the histogram interface.
+//-------------------------------------------------------------------------
+class AliCentralityLookup {
+
+ public :
+  AliCentralityLookup() : fNbins(0), fXmin(0), fXmax(0), fEdges(), fContents() {}
+  virtual ~AliCentralityLookup() {}
+
+  void    Build(const TH1* h);
+  Bool_t  IsSet() const {return fNbins>0;}
+  Float_t GetPercentile(Double_t x) const
+  {
+    // same bin as TAxis::FindFixBin
+    Int_t bin;
+    if (x < fXmin) bin = 0;
+    else if (!(x < fXmax)) bin = fNbins+1;
+    else if (fEdges.empty()) bin = 1 + Int_t(fNbins*(x-fXmin)/(fXmax-fXmin));
+    else bin = 1 + TMath::BinarySearch(fNbins+1, &fEdges[0], x);
+    return fContents[bin];
+  }
+
+ private :
+  Int_t                 fNbins;     // number of bins, 0 if not set
+  Double_t              fXmin;      // lower edge of the axis
+  Double_t              fXmax;      // upper edge of the axis
+  std::vector<Double_t> fEdges;     // bin edges for variable bins, empty for fixed bins
+  std::vector<Float_t>  fContents;  // bin contents including underflow and overflow
+
+  ClassDef(AliCentralityLookup, 1);
+};
+
 #endif
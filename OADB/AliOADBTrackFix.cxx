@@ -29,7 +29,8 @@
 ClassImp(AliOADBTrackFix);
 
 //______________________________________________________________________________
-AliOADBTrackFix::AliOADBTrackFix()
+AliOADBTrackFix::AliOADBTrackFix() :
+  fPtInvCorTablesReady(kFALSE)
 {
   // Default constructor
   for (int imd=0;imd<kNCorModes;imd++) {
@@ -40,7 +41,8 @@ AliOADBTrackFix::AliOADBTrackFix()
 }
 //______________________________________________________________________________
 AliOADBTrackFix::AliOADBTrackFix(const char* name) : 
-  TNamed(name, "TrackFix")
+  TNamed(name, "TrackFix"),
+  fPtInvCorTablesReady(kFALSE)
 {
   // Constructor
   for (int imd=0;imd<kNCorModes;imd++) {
@@ -65,6 +67,27 @@ void AliOADBTrackFix::SetPtInvCorr(int mode,int side, const TGraph* gr)
     fPtInvCor[mode][side] = 0;
   }
   fPtInvCor[mode][side] = gr;
+  fPtInvCorTablesReady = kFALSE;
+}
+
+//______________________________________________________________________________
+void AliOADBTrackFix::InitPtInvCorrTables()
+{
+  // copy the 1/pt corrections of the graphs to dense tables on the phi binning of side A,
+  // to be called once per run before the per-track GetPtInvCorr calls.
+  // Side C bins beyond its number of points take its last point.
+  for (int imd=0;imd<kNCorModes;imd++) {
+    for (int iside=0;iside<2;iside++) fPtInvCorTable[imd][iside].clear();
+    if (!fPtInvCor[imd][0] || !fPtInvCor[imd][1]) continue;
+    int nb = fPtInvCor[imd][0]->GetN();
+    for (int iside=0;iside<2;iside++) {
+      const TGraph* gr = fPtInvCor[imd][iside];
+      int np = gr->GetN();
+      fPtInvCorTable[imd][iside].resize(nb);
+      for (int ib=0;ib<nb;ib++) fPtInvCorTable[imd][iside][ib] = np>0 ? gr->GetY()[ib<np ? ib : np-1] : 0;
+    }
+  }
+  fPtInvCorTablesReady = kTRUE;
 }
 
 //______________________________________________________________________________
@@ -75,6 +98,14 @@ Double_t AliOADBTrackFix::GetPtInvCorr(int mode, double sideAfrac, double phi) c
   if (!fPtInvCor[mode][0] || !fPtInvCor[mode][1]) return 0; // no graph 
   while (phi>2*TMath::Pi()) phi -= 2*TMath::Pi();
   while (phi<0) phi += 2*TMath::Pi();  
+  if (fPtInvCorTablesReady) {
+    const std::vector<Double_t> &corA = fPtInvCorTable[mode][0], &corC = fPtInvCorTable[mode][1];
+    int nb = corA.size();
+    if (!nb) return 0;
+    int bin = int( phi/(2*TMath::Pi())*nb );
+    if (bin==nb) bin = nb-1;
+    return sideAfrac*corA[bin] + (1.-sideAfrac)*corC[bin];
+  }
   int nb = fPtInvCor[mode][0]->GetN();
   int bin = int( phi/(2*TMath::Pi())*nb );
   if (bin==nb) bin = nb-1;
@@ -10,6 +10,7 @@
 //     Author: ruben.shahoyan@cern.ch
 //-------------------------------------------------------------------------
 
+#include <vector>
 #include <TNamed.h>
 class TGraph;
 
@@ -30,6 +31,9 @@ class AliOADBTrackFix : public TNamed
   void     SetPtInvCorr(int mode,int side, const TGraph* gr);
   void     SetXIniPtInvCorr(int mode, double x=0)                 {fXIniPtInvCorr[mode] = x;}
   //
+  void     InitPtInvCorrTables();
+  Bool_t   ArePtInvCorrTablesReady()                          const {return fPtInvCorTablesReady;}
+  //
  private:
   AliOADBTrackFix(const AliOADBTrackFix& cont); 
   AliOADBTrackFix& operator=(const AliOADBTrackFix& cont);
@@ -38,7 +42,10 @@ class AliOADBTrackFix : public TNamed
   const TGraph   *fPtInvCor[kNCorModes][2];    // graphs with 1/pt correction vs phi for A,C sides
   Double_t        fXIniPtInvCorr[kNCorModes];  // if >0 use as the reper X for slope,position correction of corresponding mode
   //
-  ClassDef(AliOADBTrackFix, 1);
+  Bool_t                fPtInvCorTablesReady;                //! tables below are filled from the graphs
+  std::vector<Double_t> fPtInvCorTable[kNCorModes][2];       //! 1/pt correction per phi bin for A,C sides, on the binning of side A
+  //
+  ClassDef(AliOADBTrackFix, 2);
 };
 
 #endif
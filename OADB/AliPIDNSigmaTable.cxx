@@ -0,0 +1,186 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+//-------------------------------------------------------------------------
+//                      Implementation of Class AliPIDNSigmaTable
+//
+// Per-event table of the ITS, TPC and TOF n-sigmas, see the header
+//-------------------------------------------------------------------------
+
+#include <cstring>
+
+#include "AliPIDNSigmaTable.h"
+#include "AliVEvent.h"
+#include "AliVTrack.h"
+#include "AliAnalysisManager.h"
+
+ClassImp(AliPIDNSigmaTable)
+
+AliPIDNSigmaTable* AliPIDNSigmaTable::fgCurrent = 0;
+
+AliPIDNSigmaTable::AliPIDNSigmaTable(const char* name) :
+  TNamed(name, "PID n-sigma table"),
+  fPIDResponse(0),
+  fEvent(0),
+  fEntry(-1),
+  fTracks(),
+  fRowOfID(),
+  fNSigma()
+{
+  // constructor
+}
+
+AliPIDNSigmaTable::~AliPIDNSigmaTable()
+{
+  // destructor
+  Deactivate();
+}
+
+void AliPIDNSigmaTable::Reset()
+{
+  // invalidates the table
+  fPIDResponse = 0;
+  fEvent = 0;
+  fEntry = -1;
+  fTracks.clear();
+  fRowOfID.clear();
+  fNSigma.clear();
+}
+
+Int_t AliPIDNSigmaTable::GetDetectorIndex(AliPIDResponse::EDetector detector)
+{
+  // index of the detector in the table, -1 if not stored
+  switch (detector) {
+    case AliPIDResponse::kITS: return kITS;
+    case AliPIDResponse::kTPC: return kTPC;
+    case AliPIDResponse::kTOF: return kTOF;
+    default: return -1;
+  }
+}
+
+void AliPIDNSigmaTable::Fill(const AliVEvent* event, AliPIDResponse* pid, Long64_t entry)
+{
+  // evaluates the n-sigmas of all tracks of the event with tracks ID >= 0
+  // (the tracks are looked up by their ID, the ID of the TPC-only AOD tracks is negative)
+
+  Reset();
+  if (!event || !pid) return;
+  fPIDResponse = pid;
+  fEvent = event;
+  fEntry = entry;
+
+  static const AliPIDResponse::EDetector kDetectors[kNDetectors] = { AliPIDResponse::kITS, AliPIDResponse::kTPC, AliPIDResponse::kTOF };
+  Int_t nTracks = event->GetNumberOfTracks();
+  fTracks.reserve(nTracks);
+  fNSigma.reserve(nTracks * kNDetectors * kNSpecies);
+  for (Int_t i = 0; i < nTracks; i++) {
+    const AliVTrack* track = dynamic_cast<const AliVTrack*>(event->GetTrack(i));
+    if (!track) continue;
+    Int_t id = track->GetID();
+    if (id < 0) continue;
+    if (id >= (Int_t) fRowOfID.size()) fRowOfID.resize(id + 1, -1);
+    if (fRowOfID[id] >= 0) continue; // keep the first track with a given ID
+    fRowOfID[id] = fTracks.size();
+    fTracks.push_back(track);
+    for (Int_t idet = 0; idet < kNDetectors; idet++) {
+      Bool_t ok = pid->CheckPIDStatus(kDetectors[idet], track) == AliPIDResponse::kDetPidOk;
+      for (Int_t ispecies = 0; ispecies < kNSpecies; ispecies++) {
+        Float_t nSigma = ok ? pid->NumberOfSigmas(kDetectors[idet], track, (AliPID::EParticleType) ispecies) : -999.;
+        fNSigma.push_back(FloatToHalf(nSigma));
+      }
+    }
+  }
+}
+
+Bool_t AliPIDNSigmaTable::IsCurrent() const
+{
+  // true if the table was filled for the event being processed
+  if (!fEvent) return kFALSE;
+  AliAnalysisManager* mgr = AliAnalysisManager::GetAnalysisManager();
+  return mgr && mgr->GetCurrentEntry() == fEntry;
+}
+
+Bool_t AliPIDNSigmaTable::GetNSigma(const AliVParticle* track, AliPIDResponse::EDetector detector, Int_t species, Float_t& nSigma) const
+{
+  // n-sigma of the track, kFALSE if the track is not in the table
+  Int_t idet = GetDetectorIndex(detector);
+  if (idet < 0 || species < 0 || species >= kNSpecies || !track) return kFALSE;
+  Int_t id = track->GetID();
+  if (id < 0 || id >= (Int_t) fRowOfID.size()) return kFALSE;
+  Int_t row = fRowOfID[id];
+  if (row < 0 || fTracks[row] != track) return kFALSE; // a copy or a different track with the same ID
+  nSigma = HalfToFloat(fNSigma[(row * kNDetectors + idet) * kNSpecies + species]);
+  return kTRUE;
+}
+
+Float_t AliPIDNSigmaTable::NumberOfSigmas(AliPIDResponse* pid, AliPIDResponse::EDetector detector, const AliVParticle* track, AliPID::EParticleType type)
+{
+  // n-sigma from the table of the current event if it was filled with the same PID response,
+  // otherwise from the PID response
+  Float_t nSigma = 0;
+  if (fgCurrent && fgCurrent->fPIDResponse == pid && fgCurrent->IsCurrent() &&
+      fgCurrent->GetNSigma(track, detector, type, nSigma)) return nSigma;
+  return pid->NumberOfSigmas(detector, track, type);
+}
+
+UShort_t AliPIDNSigmaTable::FloatToHalf(Float_t value)
+{
+  // IEEE 754 half precision, rounded to nearest
+  UInt_t x;
+  memcpy(&x, &value, sizeof(x));
+  UInt_t sign = (x >> 16) & 0x8000;
+  Int_t  exp  = (Int_t) ((x >> 23) & 0xff);
+  UInt_t mant = x & 0x7fffff;
+  if (exp == 0xff) return sign | 0x7c00 | (mant ? 0x200 : 0); // inf, nan
+  exp += 15 - 127;
+  if (exp >= 0x1f) return sign | 0x7c00;      // overflow
+  if (exp <= 0) {                             // subnormal
+    if (exp < -10) return sign;
+    mant |= 0x800000;
+    UInt_t shift = 14 - exp;
+    UInt_t half = mant >> shift;
+    if ((mant >> (shift - 1)) & 1) half++;
+    return sign | half;
+  }
+  UInt_t half = sign | (exp << 10) | (mant >> 13);
+  if (mant & 0x1000) half++;                  // a carry into the exponent is correct
+  return half;
+}
+
+Float_t AliPIDNSigmaTable::HalfToFloat(UShort_t value)
+{
+  // inverse of FloatToHalf
+  UInt_t sign = (UInt_t) (value & 0x8000) << 16;
+  Int_t  exp  = (value >> 10) & 0x1f;
+  UInt_t mant = value & 0x3ff;
+  UInt_t x;
+  if (exp == 0) {
+    if (!mant) {
+      x = sign;
+    } else {                                  // subnormal, normalize
+      exp = 1;
+      while (!(mant & 0x400)) { mant <<= 1; exp--; }
+      mant &= 0x3ff;
+      x = sign | ((UInt_t) (exp + 127 - 15) << 23) | (mant << 13);
+    }
+  } else if (exp == 0x1f) {
+    x = sign | 0x7f800000 | (mant << 13);
+  } else {
+    x = sign | ((UInt_t) (exp + 127 - 15) << 23) | (mant << 13);
+  }
+  Float_t result;
+  memcpy(&result, &x, sizeof(result));
+  return result;
+}
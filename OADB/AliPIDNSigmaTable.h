@@ -0,0 +1,77 @@
+#ifndef ALIPIDNSIGMATABLE_H
+#define ALIPIDNSIGMATABLE_H
+
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+//-------------------------------------------------------------------------
+//                      Class AliPIDNSigmaTable
+//
+// Per-event table of the ITS, TPC and TOF n-sigmas of all tracks for the
+// e, mu, pi, K, p, d, t and He3 hypotheses, filled once per event by
+// AliPIDNSigmaTableTask at the beginning of the train. The values are
+// stored as half-precision floats (relative precision 1e-3), -999 if the
+// detector PID is not available for the track.
+//
+// The helpers read the n-sigmas through the static NumberOfSigmas*
+// methods, which fall back to the AliPIDResponse if no table is filled
+// for the current event, if the table was filled with a different PID
+// response or if the track is not in the table.
+//-------------------------------------------------------------------------
+
+#include <vector>
+
+#include <TNamed.h>
+#include "AliPID.h"
+#include "AliPIDResponse.h"
+
+class AliVEvent;
+class AliVTrack;
+class AliVParticle;
+
+class AliPIDNSigmaTable : public TNamed {
+public:
+  enum EDetector { kITS, kTPC, kTOF, kNDetectors };
+  enum { kNSpecies = AliPID::kHe3+1 };   // e, mu, pi, K, p, d, t, He3
+
+  AliPIDNSigmaTable(const char* name = "PIDNSigmaTable");
+  virtual ~AliPIDNSigmaTable();
+
+  void   Fill(const AliVEvent* event, AliPIDResponse* pid, Long64_t entry);
+  void   Reset();
+  Bool_t IsCurrent() const;
+  Int_t  GetNTracks() const { return fTracks.size(); }
+  Bool_t GetNSigma(const AliVParticle* track, AliPIDResponse::EDetector detector, Int_t species, Float_t& nSigma) const;
+
+  void   Activate()   { fgCurrent = this; }
+  void   Deactivate() { if (fgCurrent == this) fgCurrent = 0; }
+  static AliPIDNSigmaTable* GetCurrent() { return fgCurrent; }
+
+  // n-sigma from the table of the current event, or from the PID response if not available
+  static Float_t NumberOfSigmas(AliPIDResponse* pid, AliPIDResponse::EDetector detector, const AliVParticle* track, AliPID::EParticleType type);
+  static Float_t NumberOfSigmasITS(AliPIDResponse* pid, const AliVParticle* track, AliPID::EParticleType type) { return NumberOfSigmas(pid, AliPIDResponse::kITS, track, type); }
+  static Float_t NumberOfSigmasTPC(AliPIDResponse* pid, const AliVParticle* track, AliPID::EParticleType type) { return NumberOfSigmas(pid, AliPIDResponse::kTPC, track, type); }
+  static Float_t NumberOfSigmasTOF(AliPIDResponse* pid, const AliVParticle* track, AliPID::EParticleType type) { return NumberOfSigmas(pid, AliPIDResponse::kTOF, track, type); }
+
+  static UShort_t FloatToHalf(Float_t value);
+  static Float_t  HalfToFloat(UShort_t value);
+
+private:
+  AliPIDNSigmaTable(const AliPIDNSigmaTable&);
+  AliPIDNSigmaTable& operator=(const AliPIDNSigmaTable&);
+
+  static Int_t GetDetectorIndex(AliPIDResponse::EDetector detector);
+
+  const AliPIDResponse*   fPIDResponse; //! PID response used to fill the table
+  const AliVEvent*        fEvent;       //! event for which the table was filled
+  Long64_t                fEntry;       //! analysis manager entry of the event
+  std::vector<const AliVTrack*> fTracks; //! tracks of the table rows
+  std::vector<Int_t>      fRowOfID;     //! table row by track ID, -1 if not in the table
+  std::vector<UShort_t>   fNSigma;      //! n-sigmas [row][detector][species] as half floats
+
+  static AliPIDNSigmaTable* fgCurrent;  //! table read by the static accessors
+
+  ClassDef(AliPIDNSigmaTable, 1); // Per-event table of the PID n-sigmas
+};
+
+#endif
@@ -0,0 +1,98 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+#include "AliPIDNSigmaTableTask.h"
+#include "AliPIDNSigmaTable.h"
+#include "AliAnalysisManager.h"
+#include "AliInputEventHandler.h"
+#include "AliPIDResponse.h"
+#include "AliVEvent.h"
+#include "AliLog.h"
+
+ClassImp(AliPIDNSigmaTableTask)
+
+AliPIDNSigmaTableTask::AliPIDNSigmaTableTask() :
+  AliAnalysisTaskSE(),
+  fTable(0)
+{
+  //
+  // Default constructor
+  //
+}
+
+AliPIDNSigmaTableTask::AliPIDNSigmaTableTask(const char* name) :
+  AliAnalysisTaskSE(name),
+  fTable(0)
+{
+  //
+  // Constructor, no output
+  //
+}
+
+AliPIDNSigmaTableTask::~AliPIDNSigmaTableTask()
+{
+  //
+  // Destructor
+  //
+  delete fTable;
+}
+
+void AliPIDNSigmaTableTask::UserCreateOutputObjects()
+{
+  // creates the table and makes it the one read by the static accessors
+  if (!fTable) fTable = new AliPIDNSigmaTable();
+  fTable->Activate();
+}
+
+void AliPIDNSigmaTableTask::UserExec(Option_t*)
+{
+  // fills the table for the current event
+  AliAnalysisManager* mgr = AliAnalysisManager::GetAnalysisManager();
+  AliInputEventHandler* handler = dynamic_cast<AliInputEventHandler*> (mgr->GetInputEventHandler());
+  AliPIDResponse* pid = handler ? handler->GetPIDResponse() : 0;
+  if (!pid) {
+    AliError("No PID response, the table is not filled");
+    fTable->Reset();
+    return;
+  }
+  fTable->Fill(InputEvent(), pid, mgr->GetCurrentEntry());
+}
+
+void AliPIDNSigmaTableTask::Terminate(Option_t*)
+{
+  // the table is no longer valid after the event loop
+  if (fTable) {
+    fTable->Reset();
+    fTable->Deactivate();
+  }
+}
+
+AliPIDNSigmaTableTask* AliPIDNSigmaTableTask::AddTaskPIDNSigmaTable(const char* name)
+{
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  if (!mgr) {
+    ::Error("AddTaskPIDNSigmaTable", "No analysis manager to connect to.");
+    return NULL;
+  }
+  if (!mgr->GetInputEventHandler()) {
+    ::Error("AddTaskPIDNSigmaTable", "This task requires an input event handler");
+    return NULL;
+  }
+
+  AliPIDNSigmaTableTask *task = new AliPIDNSigmaTableTask(name);
+  mgr->AddTask(task);
+  mgr->ConnectInput(task, 0, mgr->GetCommonInputContainer());
+  return task;
+}
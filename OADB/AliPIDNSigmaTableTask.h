@@ -0,0 +1,39 @@
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#ifndef ALIPIDNSIGMATABLETASK_H
+#define ALIPIDNSIGMATABLETASK_H
+
+//-------------------------------------------------------------------------
+// Fills the AliPIDNSigmaTable once per event with the PID response of the
+// input handler. To be added after the PID response task and before the
+// tasks using the table.
+//-------------------------------------------------------------------------
+
+#include "AliAnalysisTaskSE.h"
+
+class AliPIDNSigmaTable;
+
+class AliPIDNSigmaTableTask : public AliAnalysisTaskSE {
+  public:
+    AliPIDNSigmaTableTask();
+    AliPIDNSigmaTableTask(const char* name);
+    virtual ~AliPIDNSigmaTableTask();
+
+    virtual void   UserCreateOutputObjects();
+    virtual void   UserExec(Option_t*);
+    virtual void   Terminate(Option_t*);
+
+    AliPIDNSigmaTable* GetTable() const { return fTable; }
+    static AliPIDNSigmaTableTask* AddTaskPIDNSigmaTable(const char* name = "PIDNSigmaTableTask");
+
+  protected:
+    AliPIDNSigmaTable* fTable;   //! table filled per event
+  private:
+    AliPIDNSigmaTableTask(const AliPIDNSigmaTableTask&);
+    AliPIDNSigmaTableTask& operator=(const AliPIDNSigmaTableTask&);
+
+  ClassDef(AliPIDNSigmaTableTask, 1);
+};
+
+#endif
@@ -26,6 +26,8 @@
 #include "AliAODHeader.h"
 #include "AliInputEventHandler.h"
 #include "AliAnalysisManager.h"
+#include "AliAnalysisUtils.h"
+#include "AliEventSummary.h"
 
 
 ClassImp(AliPPVsMultUtils)
@@ -143,68 +145,22 @@ Float_t AliPPVsMultUtils::GetMultiplicityPercentile(AliVEvent *event, TString lM
     Float_t lreturnval = -1;
 
     //Get VZERO Information for multiplicity later
-    AliVVZERO* esdV0 = event->GetVZEROData();
-    if (!esdV0) {
+    //(summed once per event and shared by all the instances)
+    AliEventSummary *summary = AliEventSummary::Get(event);
+    if ( !summary->fV0Filled ) FillSummaryV0(event, summary);
+    if ( !summary->fV0Available ) {
         AliError("AliVVZERO not available");
         return -1;
     }
+    if ( !event->InheritsFrom("AliESDEvent") && !event->InheritsFrom("AliAODEvent") ) return kFALSE;
 
     // VZERO PART
-    Float_t  multV0A  = 0;            //  multiplicity from V0 reco side A
-    Float_t  multV0C  = 0;            //  multiplicity from V0 reco side C
-    Float_t  multV0AEq  = 0;          //  multiplicity from V0 reco side A
-    Float_t  multV0CEq  = 0;          //  multiplicity from V0 reco side C
-    Float_t  multV0ACorr  = 0;            //  multiplicity from V0 reco side A
-    Float_t  multV0CCorr  = 0;            //  multiplicity from V0 reco side C
-    Float_t multV0Apartial = 0;
-    Float_t multV0Cpartial = 0;
-
-
-    //Non-Equalized Signal: copy of multV0ACorr and multV0CCorr from AliCentralitySelectionTask
-    //Getters for uncorrected multiplicity
-    multV0A=esdV0->GetMTotV0A();
-    multV0C=esdV0->GetMTotV0C();
-
-    //Getting around to the SPD vertex -> typecast to ESD/AOD
-    const AliVVertex *lPrimarySPDVtx = NULL;
-    /* get ESD vertex SPD */
-    if (event->InheritsFrom("AliESDEvent")) {
-        AliESDEvent *esdevent = dynamic_cast<AliESDEvent *>(event);
-        if (!esdevent) return kFALSE;
-        lPrimarySPDVtx = esdevent->GetPrimaryVertexSPD();
-    }
-    /* get AOD vertex SPD */
-    else if (event->InheritsFrom("AliAODEvent")) {
-        AliAODEvent *aodevent = dynamic_cast<AliAODEvent *>(event);
-        if (!aodevent) return kFALSE;
-        lPrimarySPDVtx = aodevent->GetPrimaryVertexSPD();
-    }
-
-    //Get Z vertex position of SPD vertex (why not Tracking if available?)
-    Float_t zvtx = lPrimarySPDVtx->GetZ();
-
-    //Acquire Corrected multV0A
-    multV0ACorr = AliESDUtils::GetCorrV0A(multV0A,zvtx);
-    multV0CCorr = AliESDUtils::GetCorrV0C(multV0C,zvtx);
-
-    // Equalized signals // From AliCentralitySelectionTask // Updated
-    for(Int_t iCh = 32; iCh < 64; ++iCh) {
-        Double_t mult = event->GetVZEROEqMultiplicity(iCh);
-        multV0AEq += mult;
-    }
-    for(Int_t iCh = 0; iCh < 32; ++iCh) {
-        Double_t mult = event->GetVZEROEqMultiplicity(iCh);
-        multV0CEq += mult;
-    }
-
-    for(Int_t iCh = 32; iCh < 48; iCh++) {
-        Double_t mult = esdV0->GetMultiplicity(iCh);
-        multV0Apartial += mult;
-    }
-    for(Int_t iCh = 0; iCh < 16; iCh++) {
-        Double_t mult = esdV0->GetMultiplicity(iCh);
-        multV0Cpartial += mult;
-    }
+    Float_t  multV0A  = summary->fV0A;       //  multiplicity from V0 reco side A
+    Float_t  multV0C  = summary->fV0C;       //  multiplicity from V0 reco side C
+    Float_t  multV0AEq  = summary->fV0AEq;   //  multiplicity from V0 reco side A
+    Float_t  multV0CEq  = summary->fV0CEq;   //  multiplicity from V0 reco side C
+    Float_t multV0Apartial = summary->fV0Apartial;
+    Float_t multV0Cpartial = summary->fV0Cpartial;
 
     if ( lMethod == "V0M" ) lreturnval =
             fBoundaryHisto_V0M -> GetBinContent( fBoundaryHisto_V0M->FindBin(multV0A+multV0C) );
@@ -242,6 +198,45 @@ Float_t AliPPVsMultUtils::GetMultiplicityPercentile(AliVEvent *event, TString lM
     return lreturnval;
 }
 
+//______________________________________________________________________
+void AliPPVsMultUtils::FillSummaryV0(AliVEvent *event, AliEventSummary *summary)
+// Sums the VZERO amplitudes of the event summary
+{
+    summary->fV0Filled = kTRUE;
+    AliVVZERO* esdV0 = event->GetVZEROData();
+    summary->fV0Available = (esdV0 != 0x0);
+    if (!esdV0) return;
+
+    //Non-Equalized Signal: copy of multV0ACorr and multV0CCorr from AliCentralitySelectionTask
+    //Getters for uncorrected multiplicity
+    summary->fV0A = esdV0->GetMTotV0A();
+    summary->fV0C = esdV0->GetMTotV0C();
+
+    // Equalized signals // From AliCentralitySelectionTask // Updated
+    Float_t multV0AEq = 0, multV0CEq = 0, multV0Apartial = 0, multV0Cpartial = 0;
+    for(Int_t iCh = 32; iCh < 64; ++iCh) {
+        Double_t mult = event->GetVZEROEqMultiplicity(iCh);
+        multV0AEq += mult;
+    }
+    for(Int_t iCh = 0; iCh < 32; ++iCh) {
+        Double_t mult = event->GetVZEROEqMultiplicity(iCh);
+        multV0CEq += mult;
+    }
+
+    for(Int_t iCh = 32; iCh < 48; iCh++) {
+        Double_t mult = esdV0->GetMultiplicity(iCh);
+        multV0Apartial += mult;
+    }
+    for(Int_t iCh = 0; iCh < 16; iCh++) {
+        Double_t mult = esdV0->GetMultiplicity(iCh);
+        multV0Cpartial += mult;
+    }
+    summary->fV0AEq = multV0AEq;
+    summary->fV0CEq = multV0CEq;
+    summary->fV0Apartial = multV0Apartial;
+    summary->fV0Cpartial = multV0Cpartial;
+}
+
 //______________________________________________________________________
 Bool_t AliPPVsMultUtils::LoadCalibration(Int_t lLoadThisCalibration)
 //To be called if starting analysis on a new run
@@ -542,6 +537,8 @@ Bool_t AliPPVsMultUtils::IsINELgtZERO(AliVEvent *event)
 // Function to check for INEL > 0 condition
 // Makes use of tracklets and requires at least and SPD vertex
 {
+    AliEventSummary *summary = AliEventSummary::Get(event);
+    if ( summary->fINELgtZERO >= 0 ) return summary->fINELgtZERO;
     Bool_t lReturnValue = kFALSE;
     //Use Ref.Mult. code...
     if (event->InheritsFrom("AliESDEvent")) {
@@ -567,6 +564,7 @@ Bool_t AliPPVsMultUtils::IsINELgtZERO(AliVEvent *event)
             if ( lStoredRefMult != -1 && lStoredRefMult != -2 && TMath::Abs(spdmult->GetEta(i)) < 1.0 ) lReturnValue = kTRUE;
         }
     }
+    summary->fINELgtZERO = lReturnValue;
     return lReturnValue;
 }
 
@@ -575,6 +573,8 @@ Bool_t AliPPVsMultUtils::IsAcceptedVertexPosition(AliVEvent *event)
 // Simple check for the best primary vertex Z position:
 // Will accept events only if |z| < 10cm
 {
+    AliEventSummary *summary = AliEventSummary::Get(event);
+    if ( summary->fAcceptedVertex >= 0 ) return summary->fAcceptedVertex;
     Bool_t lReturnValue = kFALSE;
     //Getting around to the best vertex -> typecast to ESD/AOD
     const AliVVertex *lPrimaryVtx = NULL;
@@ -591,6 +591,7 @@ Bool_t AliPPVsMultUtils::IsAcceptedVertexPosition(AliVEvent *event)
         lPrimaryVtx = aodevent->GetPrimaryVertex();
     }
     if ( TMath::Abs( lPrimaryVtx->GetZ() ) <= 10.0 ) lReturnValue = kTRUE;
+    summary->fAcceptedVertex = lReturnValue;
     return lReturnValue;
 }
 
@@ -600,6 +601,9 @@ Bool_t AliPPVsMultUtils::HasNoInconsistentSPDandTrackVertices(AliVEvent *event)
 // N.B.: It is rigorously a "Not Inconsistent" function which will
 // let events with only SPD vertex go through without troubles.
 {
+    AliEventSummary *summary = AliEventSummary::Get(event);
+    if ( summary->fConsistentVertices >= 0 ) return summary->fConsistentVertices;
+
     //It's consistent until proven otherwise...
     Bool_t lReturnValue = kTRUE;
 
@@ -637,6 +641,7 @@ Bool_t AliPPVsMultUtils::HasNoInconsistentSPDandTrackVertices(AliVEvent *event)
         Int_t lStoredRefMult = header->GetRefMultiplicityComb08();
         if( lStoredRefMult == -4 ) lReturnValue = kFALSE;
     }
+    summary->fConsistentVertices = lReturnValue;
     return lReturnValue;
 }
 
@@ -650,8 +655,11 @@ Int_t AliPPVsMultUtils::GetStandardReferenceMultiplicity(AliVEvent *event, Bool_
     //It's consistent until proven otherwise...
     Long_t lReturnValue = -10; //Kill this event, please
     
+    //The reference multiplicity is evaluated once per event
+    AliEventSummary *summary = AliEventSummary::Get(event);
+    if ( summary->fReferenceMult != -999 ) lReturnValue = summary->fReferenceMult;
     /* get ESD vertex */
-    if (event->InheritsFrom("AliESDEvent")) {
+    else if (event->InheritsFrom("AliESDEvent")) {
         AliESDEvent *esdevent = dynamic_cast<AliESDEvent *>(event);
         if (!esdevent) return kFALSE;
         //It should always be this easy...
@@ -691,6 +699,7 @@ Int_t AliPPVsMultUtils::GetStandardReferenceMultiplicity(AliVEvent *event, Bool_
             lReturnValue = lStoredRefMult;
         }
     }
+    summary->fReferenceMult = lReturnValue;
 
     if ( lEmbedEventSelection ) {
         if(IsSelectedTrigger                        ( event ) == kFALSE ) lReturnValue = -200;
@@ -709,16 +718,9 @@ Bool_t AliPPVsMultUtils::IsNotPileupSPDInMultBins(AliVEvent *event)
 // Checks if not pileup from SPD (via IsPileupFromSPDInMultBins)
 {
     Bool_t lReturnValue = kTRUE;
-    //Getting around to the SPD vertex -> typecast to ESD/AOD
-    if (event->InheritsFrom("AliESDEvent")) {
-        AliESDEvent *esdevent = dynamic_cast<AliESDEvent *>(event);
-        if (!esdevent) return kFALSE;
-        if ( esdevent->IsPileupFromSPDInMultBins() == kTRUE ) lReturnValue = kFALSE;
-    }
-    else if (event->InheritsFrom("AliAODEvent")) {
-        AliAODEvent *aodevent = dynamic_cast<AliAODEvent *>(event);
-        if (!aodevent) return kFALSE;
-        if ( aodevent->IsPileupFromSPDInMultBins() == kTRUE ) lReturnValue = kFALSE;
+    //Shared with AliAnalysisUtils through the event summary
+    if (event->InheritsFrom("AliESDEvent") || event->InheritsFrom("AliAODEvent")) {
+        if ( AliAnalysisUtils::IsPileUpSPDInMultBins(event) == kTRUE ) lReturnValue = kFALSE;
     }
     return lReturnValue;
 }
@@ -8,6 +8,7 @@ class AliVEvent;
 class AliVVertex;
 class AliESDEvent;
 class AliAODEvent;
+class AliEventSummary;
 
 class AliPPVsMultUtils : public TObject {
 
@@ -45,6 +46,8 @@ public:
 
 private:
 
+    static void FillSummaryV0(AliVEvent *event, AliEventSummary *summary);
+
     Int_t fRunNumber; // for control of run changes
     Bool_t fCalibrationLoaded; // control flag
 
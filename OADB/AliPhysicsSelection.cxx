@@ -66,6 +66,8 @@
 //           Michele Floris, CERN
 //-------------------------------------------------------------------------
 #include <vector>
+#include <map>
+#include <algorithm>
 
 #include <Riostream.h>
 #include <TH1F.h>
@@ -96,6 +98,7 @@
 #include "TPRegexp.h"
 #include "TFile.h"
 #include "AliOADBContainer.h"
+#include "AliOADBCache.h"
 #include "AliOADBPhysicsSelection.h"
 #include "AliOADBFillingScheme.h"
 #include "AliOADBTriggerAnalysis.h"
@@ -111,6 +114,31 @@
 
 class StringToRegexp : public std::map<std::string, TPRegexp> {};
 
+// Trigger class definition (see CheckTriggerClass) parsed once per run; the required and
+// rejected trigger class groups are given as bit masks over the distinct regexps of all definitions
+struct CompiledTriggerClass {
+  std::vector<ULong64_t> fRequired;  // regexps which have to match
+  std::vector<ULong64_t> fRejected;  // regexps which must not match
+  std::vector<Int_t>     fBCs;       // accepted bunch crossings (any BC if empty)
+  UInt_t                 fReturnCode;
+  Int_t                  fTriggerLogic;
+  FormulaAndBits*        fOnline;    // hardware trigger logic
+  FormulaAndBits*        fOffline;   // offline trigger logic
+};
+
+class CompiledTriggerClasses {
+public:
+  std::vector<CompiledTriggerClass> fClasses;  // in the order of fCollTrigClasses and fBGTrigClasses
+  std::vector<TPRegexp*>            fRegexps;  // distinct regexps, owned by fTriggerToRegexp
+  std::map<std::string, Int_t>      fRegexpIndex;
+  std::vector<ULong64_t>            fMatched;  // regexps matching the fired classes of the current event
+  TString                           fMatchedClasses; // fired classes for which fMatched was evaluated
+  Bool_t                            fMatchedValid;
+  std::vector<Int_t>                fDecisions; // trigger decisions of the current event by bit (online, offline), -1 if not evaluated
+
+  Int_t GetNWords() const { return (fRegexps.size() + 63) / 64; }
+};
+
 ClassImp(AliPhysicsSelection)
 
 AliPhysicsSelection::AliPhysicsSelection() :
@@ -132,7 +160,8 @@ fPSOADB(0),
 fFillOADB(0),
 fTriggerOADB(0),
 fTriggerToFormula(new StringToFormula()),
-fTriggerToRegexp(new StringToRegexp())
+fTriggerToRegexp(new StringToRegexp()),
+fCompiledTriggers(new CompiledTriggerClasses())
 {
   // constructor
   fCollTrigClasses.SetOwner(1);
@@ -162,7 +191,8 @@ AliPhysicsSelection::AliPhysicsSelection(const char *name) :
  fFillOADB(0),
  fTriggerOADB(0),
  fTriggerToFormula(new StringToFormula()),
- fTriggerToRegexp(new StringToRegexp())
+ fTriggerToRegexp(new StringToRegexp()),
+ fCompiledTriggers(new CompiledTriggerClasses())
  {
    // constructor
    fCollTrigClasses.SetOwner(1);
@@ -177,6 +207,7 @@ AliPhysicsSelection::~AliPhysicsSelection(){
   if (fPSOADB)       delete fPSOADB;
   if (fFillOADB)     delete fFillOADB;
   if (fTriggerOADB)  delete fTriggerOADB;
+  delete fCompiledTriggers;
   delete fTriggerToFormula;
   delete fTriggerToRegexp;
 }
@@ -259,6 +290,93 @@ UInt_t AliPhysicsSelection::CheckTriggerClass(const AliVEvent* event, const char
   return returnCode;
 }
 
+void AliPhysicsSelection::CompileTriggerClasses() {
+  // parses the trigger class definitions of fCollTrigClasses and fBGTrigClasses once (format see CheckTriggerClass),
+  // so that per event each distinct regexp is matched once against the fired classes and the definitions
+  // are resolved with bit mask operations
+
+  CompiledTriggerClasses& compiled = *fCompiledTriggers;
+  compiled.fClasses.clear();
+  compiled.fRegexps.clear();
+  compiled.fRegexpIndex.clear();
+  compiled.fMatchedValid = kFALSE;
+
+  struct Util {
+    static Int_t atoi(const char*& str) {
+      Int_t ret = 0;
+      while (*str && *str != ' ')
+        ret = 10 * ret + (*str++ - '0');
+      return ret;
+    }
+  };
+
+  // first pass: collect the distinct regexps and the per class requirements as regexp indices
+  std::vector<std::vector<Int_t> > required, rejected;
+  Int_t nColl = fCollTrigClasses.GetEntries();
+  Int_t nBG   = fBGTrigClasses.GetEntries();
+  for (Int_t i=0; i<nColl+nBG; i++) {
+    const char* trigger = i<nColl ? fCollTrigClasses.At(i)->GetName() : fBGTrigClasses.At(i-nColl)->GetName();
+
+    CompiledTriggerClass def;
+    def.fReturnCode = AliVEvent::kUserDefined;
+    def.fTriggerLogic = 0;
+    required.push_back(std::vector<Int_t>());
+    rejected.push_back(std::vector<Int_t>());
+
+    std::string str;
+    while (*trigger) {
+      if (*trigger == '+' || *trigger == '-') {
+        Bool_t flag = (*trigger == '+');
+        trigger++;
+
+        const char* begin = trigger;
+        while (*trigger && *trigger != ' ')
+          trigger++;
+        str.assign(begin, trigger);
+
+        auto it = compiled.fRegexpIndex.find(str);
+        if (it == compiled.fRegexpIndex.end()) {
+          it = compiled.fRegexpIndex.emplace(str, (Int_t) compiled.fRegexps.size()).first;
+          compiled.fRegexps.push_back(&FindRegexp(str));
+        }
+        (flag ? required : rejected).back().push_back(it->second);
+        continue;
+      }
+      if (*trigger == '#') {
+        def.fBCs.push_back(Util::atoi(++trigger));
+        continue;
+      }
+      if (*trigger == '&') {
+        def.fReturnCode = Util::atoi(++trigger);
+        continue;
+      }
+      if (*trigger == '*') {
+        def.fTriggerLogic = Util::atoi(++trigger);
+        continue;
+      }
+      trigger++;
+    }
+
+    def.fOnline  = &FindForumla(fPSOADB->GetHardwareTrigger(def.fTriggerLogic));
+    def.fOffline = &FindForumla(fPSOADB->GetOfflineTrigger(def.fTriggerLogic));
+    compiled.fClasses.push_back(def);
+  }
+
+  // second pass: convert the indices into masks, now that the number of regexps is known
+  Int_t nWords = compiled.GetNWords();
+  compiled.fMatched.assign(nWords, 0);
+  for (UInt_t i=0; i<compiled.fClasses.size(); i++) {
+    CompiledTriggerClass& def = compiled.fClasses[i];
+    def.fRequired.assign(nWords, 0);
+    def.fRejected.assign(nWords, 0);
+    for (Int_t idx : required[i]) def.fRequired[idx / 64] |= 1ull << (idx % 64);
+    for (Int_t idx : rejected[i]) def.fRejected[idx / 64] |= 1ull << (idx % 64);
+  }
+
+  AliInfo(Form("Compiled %d trigger class definitions using %d distinct trigger class patterns",
+               (Int_t) compiled.fClasses.size(), (Int_t) compiled.fRegexps.size()));
+}
+
 /// Evaluate if the given event fulfills a given trigger logic
 ///
 /// \param event Pointer to the current event
@@ -270,7 +388,12 @@ UInt_t AliPhysicsSelection::CheckTriggerClass(const AliVEvent* event, const char
 Bool_t AliPhysicsSelection::EvaluateTriggerLogic(const AliVEvent* event,
 						 AliTriggerAnalysis* triggerAnalysis,
 						 const char* triggerLogic, Bool_t offline){
-  auto& formula_and_bits = FindForumla(triggerLogic);
+  return EvaluateTriggerLogic(event, triggerAnalysis, FindForumla(triggerLogic), offline);
+}
+
+Bool_t AliPhysicsSelection::EvaluateTriggerLogic(const AliVEvent* event,
+						 AliTriggerAnalysis* triggerAnalysis,
+						 FormulaAndBits& formula_and_bits, Bool_t offline){
   auto& trg_formula = formula_and_bits.first;
   auto& bits = formula_and_bits.second;
   // Get the values for each individual trigger in the trigger logic string;
@@ -280,12 +403,31 @@ Bool_t AliPhysicsSelection::EvaluateTriggerLogic(const AliVEvent* event,
   for (size_t i = 0; i < bits.size(); ++i) {
     typedef AliTriggerAnalysis::Trigger Trigger;
     Trigger bit = static_cast<Trigger>(bits[i] | offline_flag);
-    paras[i] = triggerAnalysis->EvaluateTrigger(event, bit);
+    paras[i] = EvaluateTrigger(event, triggerAnalysis, bit);
   }
   Double_t dummy_val[] = {0};
   return trg_formula.EvalPar(dummy_val, paras.data());
 }
 
+/// Evaluate a single trigger bit, caching the decision for the current event
+///
+/// All AliTriggerAnalysis objects are configured identically and
+/// EvaluateTrigger does not fill histograms, so the decision is shared
+/// among the trigger classes. The cache is reset in IsCollisionCandidate.
+Int_t AliPhysicsSelection::EvaluateTrigger(const AliVEvent* event,
+					   AliTriggerAnalysis* triggerAnalysis,
+					   AliTriggerAnalysis::Trigger trigger){
+  UInt_t triggerNoFlags = (UInt_t) trigger % (UInt_t) AliTriggerAnalysis::kStartOfFlags;
+  if ((UInt_t) trigger != triggerNoFlags && (UInt_t) trigger != (triggerNoFlags | AliTriggerAnalysis::kOfflineFlag))
+    return triggerAnalysis->EvaluateTrigger(event, trigger); // other flags are not cached
+
+  std::vector<Int_t>& decisions = fCompiledTriggers->fDecisions;
+  UInt_t index = triggerNoFlags + ((trigger & AliTriggerAnalysis::kOfflineFlag) ? AliTriggerAnalysis::kStartOfFlags : 0);
+  if (decisions.size() <= index) decisions.resize(2 * AliTriggerAnalysis::kStartOfFlags, -1);
+  if (decisions[index] < 0) decisions[index] = triggerAnalysis->EvaluateTrigger(event, trigger);
+  return decisions[index];
+}
+
 //______________________________________________________________________________
 UInt_t AliPhysicsSelection::IsCollisionCandidate(const AliVEvent* event){
   // checks if the given event is a collision candidate
@@ -302,21 +444,43 @@ UInt_t AliPhysicsSelection::IsCollisionCandidate(const AliVEvent* event){
     if (eventType != 7) return kFALSE;
   }
   
-  UInt_t accept = 0;
+  CompiledTriggerClasses& compiled = *fCompiledTriggers;
   Int_t nColl = fCollTrigClasses.GetEntries();
   Int_t nBG   = fBGTrigClasses.GetEntries();
+  if ((Int_t) compiled.fClasses.size() != nColl+nBG) CompileTriggerClasses();
+  
+  // match each distinct trigger class pattern once; consecutive events often have the same fired classes
+  TString classes = event->GetFiredTriggerClasses();
+  AliDebug(AliLog::kDebug+1, Form("Processing event with triggers %s", classes.Data()));
+  if (!compiled.fMatchedValid || classes != compiled.fMatchedClasses) {
+    std::fill(compiled.fMatched.begin(), compiled.fMatched.end(), 0);
+    for (UInt_t j=0; j<compiled.fRegexps.size(); j++)
+      if (compiled.fRegexps[j]->Match(classes, "", 0, 1)) compiled.fMatched[j / 64] |= 1ull << (j % 64);
+    compiled.fMatchedClasses = classes;
+    compiled.fMatchedValid = kTRUE;
+  }
+  std::fill(compiled.fDecisions.begin(), compiled.fDecisions.end(), -1);
+  
+  Int_t nWords = compiled.GetNWords();
+  Int_t bc = event->GetBunchCrossNumber();
+  UInt_t accept = 0;
   for (Int_t i=0; i<nColl+nBG; i++) {
-    const char* triggerClass = i<nColl ? fCollTrigClasses.At(i)->GetName() : fBGTrigClasses.At(i-nColl)->GetName();
-    AliDebug(AliLog::kDebug+1, Form("Processing trigger class %s", triggerClass));
+    const CompiledTriggerClass& def = compiled.fClasses[i];
+    AliDebug(AliLog::kDebug+1, Form("Processing trigger class %s", i<nColl ? fCollTrigClasses.At(i)->GetName() : fBGTrigClasses.At(i-nColl)->GetName()));
     
     AliTriggerAnalysis* triggerAnalysis = static_cast<AliTriggerAnalysis*> (fTriggerAnalysis.At(i));
     triggerAnalysis->FillTriggerClasses(event);
     
-    Int_t triggerLogic = 0;
-    UInt_t singleTriggerResult = CheckTriggerClass(event, triggerClass, triggerLogic);
+    Bool_t classFired = kTRUE;
+    for (Int_t w=0; w<nWords && classFired; w++)
+      classFired = (compiled.fMatched[w] & def.fRequired[w]) == def.fRequired[w] && !(compiled.fMatched[w] & def.fRejected[w]);
+    if (!classFired) continue;
+    if (!def.fBCs.empty() && std::find(def.fBCs.begin(), def.fBCs.end(), bc) == def.fBCs.end()) continue;
+    
+    UInt_t singleTriggerResult = def.fReturnCode;
     if (!singleTriggerResult) continue;
-    Bool_t onlineDecision  = EvaluateTriggerLogic(event, triggerAnalysis, fPSOADB->GetHardwareTrigger(triggerLogic), kFALSE);
-    Bool_t offlineDecision = EvaluateTriggerLogic(event, triggerAnalysis, fPSOADB->GetOfflineTrigger(triggerLogic), kTRUE);
+    Bool_t onlineDecision  = EvaluateTriggerLogic(event, triggerAnalysis, *def.fOnline, kFALSE);
+    Bool_t offlineDecision = EvaluateTriggerLogic(event, triggerAnalysis, *def.fOffline, kTRUE);
     triggerAnalysis->FillHistograms(event,onlineDecision,offlineDecision);
     if (!onlineDecision) continue;
     if (!offlineDecision) continue;
@@ -362,28 +526,30 @@ Bool_t AliPhysicsSelection::Initialize(Int_t runNumber){
   /// Open OADB file and fetch OADB objects
   TString oadbfilename = AliPhysicsSelection::GetOADBFileName();
   
-  TFile * foadb = TFile::Open(oadbfilename);
-  if(!foadb->IsOpen()) AliFatal(Form("Cannot open OADB file %s", oadbfilename.Data()));
+  // the file and the containers are read once per process through the OADB cache,
+  // the objects are owned by the cached containers and are therefore copied
+  AliOADBCache * oadbCache = AliOADBCache::Instance();
+  if(!oadbCache->GetFile(oadbfilename)) AliFatal(Form("Cannot open OADB file %s", oadbfilename.Data()));
   
   if(!fPSOADB || !fUsingCustomClasses) { // if it's already set and custom class is required, we use the one provided by the user
     AliInfo("Using Standard OADB");
-    AliOADBContainer * psContainer = (AliOADBContainer*) foadb->Get("physSel");
-    if (!psContainer) AliFatal("Cannot fetch OADB container for Physics selection");
-    fPSOADB = (AliOADBPhysicsSelection*) psContainer->GetObject(runNumber, fIsPP ? "oadbDefaultPP" : "oadbDefaultPbPb",fPassName);
+    if (!oadbCache->GetContainer(oadbfilename, "physSel")) AliFatal("Cannot fetch OADB container for Physics selection");
+    TObject * psObj = oadbCache->GetObject(oadbfilename, "physSel", runNumber, fIsPP ? "oadbDefaultPP" : "oadbDefaultPbPb", fPassName);
+    fPSOADB = psObj ? (AliOADBPhysicsSelection*) psObj->Clone() : 0;
     if (!fPSOADB) AliFatal(Form("Cannot find physics selection object for run %d", runNumber));
   } else {
     AliInfo("Using Custom OADB");
   }
   if(!fFillOADB || !fUsingCustomClasses) { // if it's already set and custom class is required, we use the one provided by the user
-    AliOADBContainer * fillContainer = (AliOADBContainer*) foadb->Get("fillScheme");
-    if (!fillContainer) AliFatal("Cannot fetch OADB container for filling scheme");
-    fFillOADB = (AliOADBFillingScheme*) fillContainer->GetObject(runNumber, "Default",fPassName);
+    if (!oadbCache->GetContainer(oadbfilename, "fillScheme")) AliFatal("Cannot fetch OADB container for filling scheme");
+    TObject * fillObj = oadbCache->GetObject(oadbfilename, "fillScheme", runNumber, "Default", fPassName);
+    fFillOADB = fillObj ? (AliOADBFillingScheme*) fillObj->Clone() : 0;
     if (!fFillOADB) AliFatal(Form("Cannot find  filling scheme object for run %d", runNumber));
   }
   if(!fTriggerOADB || !fUsingCustomClasses) { // if it's already set and custom class is required, we use the one provided by the user
-    AliOADBContainer * triggerContainer = (AliOADBContainer*) foadb->Get("trigAnalysis");
-    if (!triggerContainer) AliFatal("Cannot fetch OADB container for trigger analysis");
-    fTriggerOADB = (AliOADBTriggerAnalysis*) triggerContainer->GetObject(runNumber, "Default",fPassName);
+    if (!oadbCache->GetContainer(oadbfilename, "trigAnalysis")) AliFatal("Cannot fetch OADB container for trigger analysis");
+    TObject * triggerObj = oadbCache->GetObject(oadbfilename, "trigAnalysis", runNumber, "Default", fPassName);
+    fTriggerOADB = triggerObj ? (AliOADBTriggerAnalysis*) triggerObj->Clone() : 0;
     if (!fTriggerOADB) AliFatal(Form("Cannot find  trigger analysis object for run %d", runNumber));
     fTriggerOADB->Print();
   }
@@ -487,6 +653,9 @@ Bool_t AliPhysicsSelection::Initialize(Int_t runNumber){
     }
   }
   
+  // the trigger logic of the classes depends on the physics selection object of the run
+  CompileTriggerClasses();
+  
   fCurrentRun = runNumber;
 
   TH1::AddDirectory(oldStatus);
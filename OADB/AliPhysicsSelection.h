@@ -45,6 +45,7 @@ class AliOADBFillingScheme;
 class AliOADBTriggerAnalysis;
 class TPRegexp;
 class StringToRegexp;
+class CompiledTriggerClasses;
 
 typedef std::pair<R5TFormula, std::vector<AliTriggerAnalysis::Trigger>> FormulaAndBits;
 typedef std::map<std::string, FormulaAndBits> StringToFormula;
@@ -102,6 +103,9 @@ public:
 protected:
   UInt_t CheckTriggerClass(const AliVEvent* event, const char* trigger, Int_t& triggerLogic) const;
   Bool_t EvaluateTriggerLogic(const AliVEvent* event, AliTriggerAnalysis* triggerAnalysis, const char* triggerLogic, Bool_t offline);
+  Bool_t EvaluateTriggerLogic(const AliVEvent* event, AliTriggerAnalysis* triggerAnalysis, FormulaAndBits& formulaAndBits, Bool_t offline);
+  void   CompileTriggerClasses();
+  Int_t  EvaluateTrigger(const AliVEvent* event, AliTriggerAnalysis* triggerAnalysis, AliTriggerAnalysis::Trigger trigger);
   const char * GetTriggerString(TObjString * obj);
 
   TString fPassName;          // pass name for current run
@@ -128,7 +132,9 @@ protected:
   StringToRegexp* fTriggerToRegexp; //!
   TPRegexp& FindRegexp(const std::string& triggers) const;
 
-  ClassDef(AliPhysicsSelection, 24)
+  CompiledTriggerClasses* fCompiledTriggers; //! Trigger class definitions parsed once per run, and per-event trigger decisions
+
+  ClassDef(AliPhysicsSelection, 25)
 private:
   AliPhysicsSelection(const AliPhysicsSelection&);
   AliPhysicsSelection& operator=(const AliPhysicsSelection&);
@@ -13,6 +13,8 @@
  * provided "as is" without express or implied warranty.                  *
  **************************************************************************/
 
+#include <algorithm>
+
 #include "TSystem.h"
 
 #include "AliProdInfo.h"
@@ -21,6 +23,7 @@
 #include "AliVEventHandler.h"
 #include "AliAnalysisManager.h"
 #include "AliOADBContainer.h"
+#include "AliOADBCache.h"
 
 #include "AliTimeRangeCut.h"
 
@@ -70,10 +73,46 @@ void AliTimeRangeCut::InitFromRunNumber(const Int_t run)
   printf("pass: %s\n", passName.Data());
 
   // ===| Get the AliTimeRangeMasking object |===
-  AliOADBContainer cont("TimeRangeMasking");
-  cont.InitFromFile(Form("%s/COMMON/PHYSICSSELECTION/data/TimeRangeMasking.root", fOADBPath.Data()), "TimeRangeMasking");
+  // the container is read once per process, the object is owned by the cache
+  const TString fileName = Form("%s/COMMON/PHYSICSSELECTION/data/TimeRangeMasking.root", fOADBPath.Data());
+  fTimeRangeMasking = (AliTimeRangeMasking<ULong64_t, UShort_t>*)AliOADBCache::Instance()->GetObject(fileName, "TimeRangeMasking", run, "", passName);
+
+  BuildIndex();
+}
 
-  fTimeRangeMasking = (AliTimeRangeMasking<ULong64_t, UShort_t>*)cont.GetObject(run, "", passName);
+//______________________________________________________________________________
+void AliTimeRangeCut::BuildIndex()
+{
+  // flatten the ranges sorted by start time
+  fRangeStart.clear();
+  fRangeEnd.clear();
+  fRangeMask.clear();
+  fUseIndex = kFALSE;
+  fLastSlot = -2;
+  if (!fTimeRangeMasking) return;
+
+  const Int_t nRanges = fTimeRangeMasking->GetNumberOfTimeRangeMasks();
+  std::vector<std::pair<ULong64_t, Int_t> > order(nRanges);
+  for (Int_t i = 0; i < nRanges; ++i) {
+    order[i] = std::make_pair(fTimeRangeMasking->GetTimeRangeMask(i)->GetStart(), i);
+  }
+  std::sort(order.begin(), order.end());
+
+  for (Int_t i = 0; i < nRanges; ++i) {
+    const AliTimeRangeMask<ULong64_t, UShort_t>* range = fTimeRangeMasking->GetTimeRangeMask(order[i].second);
+    // overlapping ranges: keep the linear search, which returns the first matching range
+    if (i > 0 && range->GetStart() <= fRangeEnd.back()) {
+      AliWarningF("Overlapping time ranges in TimeRangeMasking for run %d, using linear search", fLastRun);
+      fRangeStart.clear();
+      fRangeEnd.clear();
+      fRangeMask.clear();
+      return;
+    }
+    fRangeStart.push_back(range->GetStart());
+    fRangeEnd.push_back(range->GetEnd());
+    fRangeMask.push_back(range->GetMaskReasons());
+  }
+  fUseIndex = kTRUE;
 
 }
 
@@ -93,10 +132,27 @@ UShort_t AliTimeRangeCut::GetMask(const AliVEvent* event) const
 //______________________________________________________________________________
 UShort_t AliTimeRangeCut::GetMask(const ULong64_t gid) const
 {
-  AliTimeRangeMask<ULong64_t, UShort_t>* range = fTimeRangeMasking->FindTimeRangeMask(gid);
+  if (!fTimeRangeMasking) return 0;
+
+  if (!fUseIndex) {
+    AliTimeRangeMask<ULong64_t, UShort_t>* range = fTimeRangeMasking->FindTimeRangeMask(gid);
+
+    if (!range) return 0;
+    return range->GetMaskReasons();
+  }
+
+  // slot i: fRangeStart[i] <= gid < fRangeStart[i+1], slot -1: before the first range
+  const Int_t nRanges = fRangeStart.size();
+  Int_t slot = fLastSlot;
+  if (slot < -1 || slot >= nRanges ||
+      (slot >= 0 && gid < fRangeStart[slot]) ||
+      (slot + 1 < nRanges && gid >= fRangeStart[slot + 1])) {
+    slot = Int_t(std::upper_bound(fRangeStart.begin(), fRangeStart.end(), gid) - fRangeStart.begin()) - 1;
+    fLastSlot = slot;
+  }
 
-  if (!range) return 0;
-  return range->GetMaskReasons();
+  if (slot < 0 || gid > fRangeEnd[slot]) return 0;
+  return fRangeMask[slot];
 }
 
 //______________________________________________________________________________
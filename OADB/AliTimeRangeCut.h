@@ -7,6 +7,8 @@
 /// \brief A class for cutting on AliTimeRangeMasking definitions
 /// \author Jens Wiechula, jens.wiechula@ikf.uni-frankfurt.de
 
+#include <vector>
+
 #include "TString.h"
 
 #include "AliTimeRangeMasking.h"
@@ -33,8 +35,9 @@ class AliVEvent;
 ///     for the bit definitions see [AliTimeRangeMask](@ref AliTimeRangeMask)
 class AliTimeRangeCut : public TObject {
   public:
-    AliTimeRangeCut() : fOADBPath(), fTimeRangeMasking(0x0), fLastRun(-1) {}
-    ~AliTimeRangeCut() { delete fTimeRangeMasking; }
+    AliTimeRangeCut() : fOADBPath(), fTimeRangeMasking(0x0), fLastRun(-1),
+                        fRangeStart(), fRangeEnd(), fRangeMask(), fUseIndex(kFALSE), fLastSlot(-2) {}
+    ~AliTimeRangeCut() {}
 
     void InitFromEvent(const AliVEvent* event); 
     void InitFromRunNumber(const Int_t run);
@@ -53,11 +56,20 @@ class AliTimeRangeCut : public TObject {
     AliTimeRangeCut(const AliTimeRangeCut&);
     AliTimeRangeCut& operator= (const AliTimeRangeCut&);
 
+    void BuildIndex();
+
     TString fOADBPath; ///< OADB path
-    AliTimeRangeMasking<ULong64_t, UShort_t>* fTimeRangeMasking; //!< Time Range masksking object
+    AliTimeRangeMasking<ULong64_t, UShort_t>* fTimeRangeMasking; //!< Time Range masksking object (owned by AliOADBCache)
     Int_t fLastRun; //!< last set run number
 
-    ClassDef(AliTimeRangeCut, 1)
+    // ranges sorted by start time for the binary search, see BuildIndex
+    std::vector<ULong64_t> fRangeStart; //!< start of the ranges
+    std::vector<ULong64_t> fRangeEnd;   //!< end of the ranges
+    std::vector<UShort_t>  fRangeMask;  //!< mask reasons of the ranges
+    Bool_t fUseIndex;                   //!< sorted ranges are used (false if ranges overlap)
+    mutable Int_t fLastSlot;            //!< last range slot found, events are mostly time ordered
+
+    ClassDef(AliTimeRangeCut, 2)
 };
 
 #endif
@@ -82,6 +82,9 @@ class AliTimeRangeMasking : public TObject {
 
     AliTimeRangeMask<time_type, bitmap_type>* FindTimeRangeMask(time_type time) const;
 
+    Int_t GetNumberOfTimeRangeMasks() const { return fArrTimeRanges.GetEntriesFast(); }
+    const AliTimeRangeMask<time_type, bitmap_type>* GetTimeRangeMask(Int_t i) const { return (const AliTimeRangeMask<time_type, bitmap_type>*)fArrTimeRanges.UncheckedAt(i); }
+
     virtual void Print(Option_t* option = "") const;
 
   private:
@@ -20,11 +20,15 @@
 #include "TBrowser.h"
 #include "TFormula.h"
 #include "RVersion.h"
+#include "TMath.h"
+#include <cstdlib>
+#include <cstring>
 
 ClassImp(AliMultEstimator);
 //________________________________________________________________
 AliMultEstimator::AliMultEstimator() :
   TNamed(), fDefinition(""), fIsInteger(kFALSE), fValue(0), fMean(0), fPercentile(0), fFormula(0),
+fOps(), fArgs(), fStack(), fDepth(0), fNVarsCompiled(0),
 fkUseAnchor(kFALSE), fAnchorPoint(0), fAnchorPercentile(100.0)
 {
   // Constructor
@@ -32,6 +36,7 @@ fkUseAnchor(kFALSE), fAnchorPoint(0), fAnchorPercentile(100.0)
 }
 AliMultEstimator::AliMultEstimator(const char * name, const char * title, TString lInitDef):
 TNamed(name,title), fDefinition(""), fIsInteger(kFALSE), fValue(0), fMean(0), fPercentile(0), fFormula(0),
+fOps(), fArgs(), fStack(), fDepth(0), fNVarsCompiled(0),
 fkUseAnchor(kFALSE), fAnchorPoint(0), fAnchorPercentile(100.0)
 {
     //Named, titled, definition constructor
@@ -46,6 +51,11 @@ fValue(e.fValue),
 fMean(e.fMean),
 fPercentile(e.fPercentile),
 fFormula(0),
+fOps(e.fOps),
+fArgs(e.fArgs),
+fStack(e.fStack),
+fDepth(0),
+fNVarsCompiled(e.fNVarsCompiled),
 fkUseAnchor(e.fkUseAnchor),
 fAnchorPoint(e.fAnchorPoint),
 fAnchorPercentile(e.fAnchorPercentile)
@@ -67,6 +77,10 @@ AliMultEstimator& AliMultEstimator::operator=(const AliMultEstimator& e)
     if (fFormula) delete fFormula;
     fFormula = 0;
     if (e.fFormula) fFormula = new TFormula(*e.fFormula);
+    fOps           = e.fOps;
+    fArgs          = e.fArgs;
+    fStack         = e.fStack;
+    fNVarsCompiled = e.fNVarsCompiled;
     
     //Anchor point configs
     fkUseAnchor         = e.fkUseAnchor;
@@ -121,24 +135,191 @@ void AliMultEstimator::SetupFormula(const AliMultInput* lInput)
         lVarName.Prepend("(");
         expr.ReplaceAll(lVarName, repl);
     }
+    if (fFormula) delete fFormula;
     fFormula = new TFormula(Form("e%s", GetName()), expr);
 #if ROOT_VERSION_CODE < ROOT_VERSION(5,99,4)
     fFormula->Optimize();
 #endif
+    
+    //Compile the definition, cross-checked against TFormula on a test input
+    if (!Compile(expr, nVar)) {
+        Printf("AliMultEstimator: definition of %s not compiled, using TFormula: %s", GetName(), fDefinition.Data());
+        return;
+    }
+    std::vector<Double_t> lTest(nVar > 0 ? nVar : 1);
+    for (Int_t i = 0; i < nVar; i++) lTest[i] = 1.5 + 0.25*i;
+    Double_t lX[1] = {0.};
+    Double_t lValFormula  = fFormula->EvalPar(lX, &lTest[0]);
+    Double_t lValCompiled = Execute(&lTest[0]);
+    if ( TMath::Abs(lValCompiled - lValFormula) > 1e-9*TMath::Max(1.0, TMath::Abs(lValFormula)) ) {
+        Printf("AliMultEstimator: compiled definition of %s differs from TFormula (%g vs %g), using TFormula",
+               GetName(), lValCompiled, lValFormula);
+        fOps.clear();
+        fArgs.clear();
+    }
 }
 //________________________________________________________________
 Float_t AliMultEstimator::Evaluate(const AliMultInput* lInput)
 {
+    if (!fFormula && !IsCompiled()) return fValue = 0;
+    std::vector<Double_t> lValues;
+    lInput->GetValues(lValues);
+    return Evaluate(lValues.empty() ? 0x0 : &lValues[0]);
+}
+//________________________________________________________________
+Float_t AliMultEstimator::Evaluate(const Double_t* lValues)
+{
+    if (IsCompiled()) return fValue = Execute(lValues);
     if (!fFormula) return fValue = 0;
-    Float_t lVertexZ = lInput->GetVariable("fEvSel_VtxZ")->GetValue();
-    for (Int_t i = 0; i < lInput->GetNVariables(); i++) {
-        AliMultVariable* v = lInput->GetVariable(i);
-        Double_t lv = v->IsInteger() ? v->GetValueInteger() : v->GetValue();
-        if(v->GetUseVertexZCorrection()){
-          Float_t lCorrection = lInput->GetVtxZCorrection(v, lVertexZ)/lInput->GetVtxZCorrection(v, 0.0);
-          lv = lv / lCorrection; //automatic vertex correction if requested
+    Double_t lX[1] = {0.};
+    return fValue = fFormula->EvalPar(lX, lValues);
+}
+//________________________________________________________________
+Double_t AliMultEstimator::Execute(const Double_t* lValues)
+{
+    //Run the compiled operations on the input values
+    Double_t* s = &fStack[0];
+    Int_t n = 0;
+    const Int_t lNOps = fOps.size();
+    for (Int_t i = 0; i < lNOps; i++) {
+        switch (fOps[i]) {
+            case kOpConst: s[n++] = fArgs[i]; break;
+            case kOpVar:   s[n++] = lValues[(Int_t)fArgs[i]]; break;
+            case kOpAdd:   n--; s[n-1] += s[n]; break;
+            case kOpSub:   n--; s[n-1] -= s[n]; break;
+            case kOpMul:   n--; s[n-1] *= s[n]; break;
+            case kOpDiv:   n--; s[n-1] /= s[n]; break;
+            case kOpPow:   n--; s[n-1] = TMath::Power(s[n-1], s[n]); break;
+            case kOpNeg:   s[n-1] = -s[n-1]; break;
+            case kOpSqrt:  s[n-1] = TMath::Sqrt(s[n-1]); break;
+            case kOpAbs:   s[n-1] = TMath::Abs(s[n-1]); break;
+            case kOpLog:   s[n-1] = TMath::Log(s[n-1]); break;
+            case kOpExp:   s[n-1] = TMath::Exp(s[n-1]); break;
+        }
+    }
+    return s[0];
+}
+//________________________________________________________________
+void AliMultEstimator::PushOp(Int_t lOp, Double_t lArg, Int_t lDepthChange)
+{
+    fOps.push_back(lOp);
+    fArgs.push_back(lArg);
+    fDepth += lDepthChange;
+    if (fDepth > (Int_t)fStack.size()) fStack.resize(fDepth);
+}
+//________________________________________________________________
+Bool_t AliMultEstimator::Compile(const TString& lExpr, Int_t lNVars)
+{
+    //Supported syntax: numbers, parameters [i], + - * / ^, parentheses,
+    //sqrt, abs, log, exp, pow (also with the TMath:: prefix)
+    fOps.clear();
+    fArgs.clear();
+    fStack.assign(1, 0.);
+    fDepth = 0;
+    fNVarsCompiled = lNVars;
+    const char* p = lExpr.Data();
+    Bool_t lOK = ParseSum(p);
+    while (lOK && *p == ' ') p++;
+    if (!lOK || *p != '\0' || fDepth != 1) {
+        fOps.clear();
+        fArgs.clear();
+        return kFALSE;
+    }
+    return kTRUE;
+}
+//________________________________________________________________
+Bool_t AliMultEstimator::ParseSum(const char*& p)
+{
+    if (!ParseProduct(p)) return kFALSE;
+    while (kTRUE) {
+        while (*p == ' ') p++;
+        if (*p != '+' && *p != '-') return kTRUE;
+        Int_t lOp = (*p == '+') ? kOpAdd : kOpSub;
+        p++;
+        if (!ParseProduct(p)) return kFALSE;
+        PushOp(lOp);
+    }
+}
+//________________________________________________________________
+Bool_t AliMultEstimator::ParseProduct(const char*& p)
+{
+    if (!ParseUnary(p)) return kFALSE;
+    while (kTRUE) {
+        while (*p == ' ') p++;
+        if (*p != '*' && *p != '/') return kTRUE;
+        Int_t lOp = (*p == '*') ? kOpMul : kOpDiv;
+        p++;
+        if (!ParseUnary(p)) return kFALSE;
+        PushOp(lOp);
+    }
+}
+//________________________________________________________________
+Bool_t AliMultEstimator::ParseUnary(const char*& p)
+{
+    while (*p == ' ') p++;
+    if (*p == '-') { p++; if (!ParseUnary(p)) return kFALSE; PushOp(kOpNeg, 0., 0); return kTRUE; }
+    if (*p == '+') { p++; return ParseUnary(p); }
+    if (!ParsePrimary(p)) return kFALSE;
+    while (*p == ' ') p++;
+    if (*p == '^') {
+        //right-associative power, binds tighter than the unary minus on its left
+        p++;
+        if (!ParseUnary(p)) return kFALSE;
+        PushOp(kOpPow);
+    }
+    return kTRUE;
+}
+//________________________________________________________________
+Bool_t AliMultEstimator::ParsePrimary(const char*& p)
+{
+    while (*p == ' ') p++;
+    if ((*p >= '0' && *p <= '9') || *p == '.') {
+        char* lEnd = 0;
+        Double_t lVal = strtod(p, &lEnd);
+        if (lEnd == p) return kFALSE;
+        p = lEnd;
+        PushOp(kOpConst, lVal, 1);
+        return kTRUE;
+    }
+    if (*p == '[') {
+        char* lEnd = 0;
+        Long_t lIdx = strtol(p+1, &lEnd, 10);
+        if (lEnd == p+1 || *lEnd != ']' || lIdx < 0 || lIdx >= fNVarsCompiled) return kFALSE;
+        p = lEnd+1;
+        PushOp(kOpVar, lIdx, 1);
+        return kTRUE;
+    }
+    if (*p == '(') {
+        p++;
+        if (!ParseSum(p)) return kFALSE;
+        while (*p == ' ') p++;
+        if (*p != ')') return kFALSE;
+        p++;
+        return kTRUE;
+    }
+    //functions
+    if (strncmp(p, "TMath::", 7) == 0) p += 7;
+    static const char* lFuncNames[] = { "sqrt", "Sqrt", "abs", "Abs", "log", "Log", "exp", "Exp", "pow", "Power" };
+    static const Int_t lFuncOps[]   = { kOpSqrt, kOpSqrt, kOpAbs, kOpAbs, kOpLog, kOpLog, kOpExp, kOpExp, kOpPow, kOpPow };
+    for (Int_t iFunc = 0; iFunc < 10; iFunc++) {
+        Int_t lLen = strlen(lFuncNames[iFunc]);
+        if (strncmp(p, lFuncNames[iFunc], lLen) != 0) continue;
+        const char* q = p + lLen;
+        while (*q == ' ') q++;
+        if (*q != '(') continue;
+        q++;
+        if (!ParseSum(q)) return kFALSE;
+        while (*q == ' ') q++;
+        if (lFuncOps[iFunc] == kOpPow) {
+            if (*q != ',') return kFALSE;
+            q++;
+            if (!ParseSum(q)) return kFALSE;
+            while (*q == ' ') q++;
         }
-        fFormula->SetParameter(i, lv);
+        if (*q != ')') return kFALSE;
+        p = q+1;
+        PushOp(lFuncOps[iFunc], 0., lFuncOps[iFunc] == kOpPow ? -1 : 0);
+        return kTRUE;
     }
-    return fValue = fFormula->Eval(0);
+    return kFALSE;
 }
@@ -1,6 +1,7 @@
 #ifndef AliMultEstimator_H
 #define AliMultEstimator_H
 #include <TNamed.h>
+#include <vector>
 class AliMultInput;
 class TFormula;
 
@@ -43,8 +44,25 @@ public:
     //Pre-processing for speed
     void SetupFormula(const AliMultInput* lInput);
     Float_t Evaluate(const AliMultInput* lInput);
+    //Evaluation from the (vertex-Z corrected) input values, see AliMultInput::GetValues
+    Float_t Evaluate(const Double_t* lValues);
+    Bool_t  IsCompiled() const { return !fOps.empty(); }
     
 private:
+    //Compiled definition: the expression is translated once into a
+    //sequence of stack operations, TFormula is used as fallback if the
+    //expression contains constructs not handled by the compiler
+    enum EOpCode { kOpConst, kOpVar, kOpAdd, kOpSub, kOpMul, kOpDiv, kOpNeg,
+                   kOpPow, kOpSqrt, kOpAbs, kOpLog, kOpExp };
+    Bool_t Compile(const TString& lExpr, Int_t lNVars);
+    Bool_t ParseSum(const char*& p);
+    Bool_t ParseProduct(const char*& p);
+    Bool_t ParseUnary(const char*& p);
+    Bool_t ParsePrimary(const char*& p);
+    void   PushOp(Int_t lOp, Double_t lArg = 0., Int_t lDepthChange = -1);
+    Double_t Execute(const Double_t* lValues);
+    
+
     TString fDefinition; //How to evaluate based on AliMultVariables
     Bool_t fIsInteger; //Requires special treatment when calibrating
     
@@ -52,13 +70,19 @@ private:
     Float_t fMean;   // estimator mean value
     Float_t fPercentile;   //Percentile
     TFormula* fFormula; //!
+    std::vector<Int_t>    fOps;     //! compiled operations
+    std::vector<Double_t> fArgs;    //! constant value or input index of each operation
+    std::vector<Double_t> fStack;   //! evaluation stack
+    Int_t fDepth;                   //! stack depth while compiling
+    Int_t fNVarsCompiled;           //! number of input variables while compiling
     
     //Anchor point definition
     Bool_t  fkUseAnchor;        //Use Anchor Logic (default: No)
     Float_t fAnchorPoint;       //Raw value below which
     Float_t fAnchorPercentile;  //Percentile of X-section at anchor point
     
-    ClassDef(AliMultEstimator, 2)
+    ClassDef(AliMultEstimator, 3)
    //2 - addition of auto-vertex-Z corrections
+   //3 - compiled evaluation (transient only)
 };
 #endif
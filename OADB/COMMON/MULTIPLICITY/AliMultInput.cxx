@@ -159,6 +159,25 @@ AliMultVariable* AliMultInput::GetVariable (Long_t iIdx) const
   return static_cast<AliMultVariable*>(fVariableList->At(iIdx));
 }
 
+void AliMultInput::GetValues ( std::vector<Double_t>& lValues ) const
+{
+  //Evaluated once per event and shared by all the estimators
+  lValues.resize(fNVars);
+  AliMultVariable* lVtxZVar = GetVariable("fEvSel_VtxZ");
+  Float_t lVertexZ = lVtxZVar ? lVtxZVar->GetValue() : 0.;
+  TIter next(fVariableList);
+  AliMultVariable* v = 0;
+  Long_t i = 0;
+  while ((v = static_cast<AliMultVariable*>(next())) && i < fNVars) {
+    Double_t lv = v->IsInteger() ? v->GetValueInteger() : v->GetValue();
+    if(v->GetUseVertexZCorrection()){
+      Float_t lCorrection = GetVtxZCorrection(v, lVertexZ)/GetVtxZCorrection(v, 0.0);
+      lv = lv / lCorrection; //automatic vertex correction if requested
+    }
+    lValues[i++] = lv;
+  }
+}
+
 void AliMultInput::AddVtxZ ( TProfile *prof )
 {
   //Warning: not protected against naming!
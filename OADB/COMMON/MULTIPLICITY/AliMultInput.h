@@ -3,6 +3,7 @@
 #include <TNamed.h>
 #include "TProfile.h"
 #include <TMap.h>
+#include <vector>
 #include "AliMultVariable.h"
 #include "AliOADBMultSelection.h"
 
@@ -19,6 +20,8 @@ public:
   AliMultVariable* GetVariable (const TString& lName) const;
   AliMultVariable* GetVariable (Long_t iIdx) const;
   Long_t GetNVariables         () const { return fNVars; }
+  //Values of all variables (vertex-Z corrected if requested), by variable index
+  void GetValues ( std::vector<Double_t>& lValues ) const;
   
   void     AddVtxZ ( TProfile *prof );
   TProfile* GetVtxZProfile   (const AliMultVariable *v) const;
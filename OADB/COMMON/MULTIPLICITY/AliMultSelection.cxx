@@ -239,11 +239,16 @@ void AliMultSelection::Evaluate( AliMultInput *lInput )
 //Master function to evaluate all existing estimators based on
 //a set of input variables. Error handling to be done with care...
 {
+    //Input values (with vertex-Z corrections) computed once for all estimators
+    std::vector<Double_t> lValues;
+    lInput->GetValues(lValues);
+    const Double_t* lValuesPtr = lValues.empty() ? 0x0 : &lValues[0];
+    
     //Loop over estimators defined in the acquired list
     AliMultEstimator* estimator = 0;
     TIter             next(fEstimatorList);
     while ((estimator = static_cast<AliMultEstimator*>(next())))
-        estimator->Evaluate(lInput);
+        estimator->Evaluate(lValuesPtr);
 
 //deprecated evaluation
 #if 0
@@ -82,6 +82,7 @@ class AliESDAD; //AD
 
 //For MultSelection Framework
 #include "AliOADBContainer.h"
+#include "AliOADBCache.h"
 #include "AliOADBMultSelection.h"
 #include "AliMultEstimator.h"
 #include "AliMultVariable.h"
@@ -2628,19 +2629,20 @@ Int_t AliMultSelectionTask::SetupRun(const AliVEvent* const esd)
   }
   
   //Open File without calling InitFromFile, don't load it all!
-  
-  TFile * foadb = TFile::Open(fileName);
-  if( !foadb->IsOpen() && fkPreferSuperCalib ){
+  //File and container are read once per process through the OADB cache
+  AliOADBCache *lOADBCache = AliOADBCache::Instance();
+  TFile * foadb = lOADBCache->GetFile(fileName);
+  if( !foadb && fkPreferSuperCalib ){
     fileName.ReplaceAll("_SuperCalib", "");
-    foadb = TFile::Open(fileName);
+    foadb = lOADBCache->GetFile(fileName);
   }
   
-  if(!foadb->IsOpen()) AliFatal(Form("Cannot open OADB file %s", fileName.Data()));
+  if(!foadb) AliFatal(Form("Cannot open OADB file %s", fileName.Data()));
   
   //Managed to open, save name of opened OADB file
   lHistTitle.Append(Form(", OADB: %s",lOADBref.Data()));
   
-  AliOADBContainer * MultContainer = (AliOADBContainer*) foadb->Get("MultSel");
+  AliOADBContainer * MultContainer = lOADBCache->GetContainer(fileName, "MultSel");
   if(!MultContainer) AliFatal(Form("OADB file %s does not contain OADBContainer named MultSel, stopping here", fileName.Data()));
   
   //Get Object for this run!
@@ -2731,13 +2733,12 @@ Int_t AliMultSelectionTask::SetupRun(const AliVEvent* const esd)
     
     //Open fileNameAlter
     TFile * foadbAlter = 0x0;
-    foadbAlter = TFile::Open(fileNameAlter);
+    foadbAlter = lOADBCache->GetFile(fileNameAlter);
     
     //Check existence, please
     if(!foadbAlter) AliFatal(Form("Cannot open OADB file %s", fileNameAlter.Data()));
-    if(!foadbAlter->IsOpen()) AliFatal(Form("Cannot open OADB file %s", fileNameAlter.Data()));
     
-    AliOADBContainer * MultContainerAlter = (AliOADBContainer*) foadbAlter->Get("MultSel");
+    AliOADBContainer * MultContainerAlter = lOADBCache->GetContainer(fileNameAlter, "MultSel");
     if(!MultContainerAlter) AliFatal(Form("OADB file %s does not contain OADBContainer named MultSel, stopping here", fileNameAlter.Data()));
     
     //Get Object for this run
@@ -7,10 +7,12 @@
 #pragma link off all functions;
 
 #pragma link C++ class AliOADBCentrality+;
+#pragma link C++ class AliCentralityLookup+;
 #pragma link C++ class AliOADBPhysicsSelection+;
 #pragma link C++ class AliOADBFillingScheme+;
 #pragma link C++ class AliOADBTriggerAnalysis+;
 #pragma link C++ class AliOADBTrackFix+;
+#pragma link C++ class AliOADBCache+;
 
 #pragma link C++ class AliAnalysisUtils+;
 #pragma link C++ class AliPPVsMultUtils+;
@@ -24,10 +26,14 @@
 #pragma link C++ class AliCollisionNormalizationTask+;
 #pragma link C++ class AliEventCuts+;
 #pragma link C++ class AliEventCutsContainer+;
+#pragma link C++ class AliEventCutsDecisions+;
 #pragma link C++ class AliTimeRangeMask<ULong64_t, UShort_t>+;
 #pragma link C++ class AliTimeRangeMasking<ULong64_t, UShort_t>+;
 #pragma link C++ class AliTimeRangeCut;
 #pragma link C++ class AliEMCALLEDEventsCut;
+#pragma link C++ class AliPIDNSigmaTable+;
+#pragma link C++ class AliPIDNSigmaTableTask+;
+#pragma link C++ class AliEventSummary+;
 
 #pragma link C++ class AliMultVariable+;
 #pragma link C++ class AliMultInput+;
@@ -1138,6 +1138,40 @@ void AliAnaCaloTrackCorrMaker::Init()
 
   } // Loop on analysis defined
 
+  CheckAnalysisOrder();
+}
+
+//_____________________________________________________________________________________
+/// Check the dependencies between the analyses of the list.
+/// The AOD branches are emptied at the beginning of each event and the analyses are
+/// executed in the order of the list, so an analysis reading the AOD branch created
+/// by another analysis of the list has to be placed after it. Otherwise it always finds
+/// the branch empty. Input branches not created by any analysis of the list
+/// (from the input delta AOD) are not checked.
+//_____________________________________________________________________________________
+void AliAnaCaloTrackCorrMaker::CheckAnalysisOrder() const
+{
+  Int_t nana = fAnalysisContainer->GetEntries() ;
+  for(Int_t iana = 0; iana < nana; iana++)
+  {
+    AliAnaCaloTrackCorrBaseClass * ana = ((AliAnaCaloTrackCorrBaseClass *) fAnalysisContainer->At(iana)) ;
+    
+    TString inputName = ana->GetInputAODName();
+    if ( inputName.Length() == 0 ) continue;
+    
+    // First analysis of the list creating the branch
+    for(Int_t jana = 0; jana < nana; jana++)
+    {
+      AliAnaCaloTrackCorrBaseClass * producer = ((AliAnaCaloTrackCorrBaseClass *) fAnalysisContainer->At(jana)) ;
+      
+      if ( !producer->NewOutputAOD() || producer->GetOutputAODName() != inputName ) continue;
+      
+      if ( jana > iana )
+        AliWarning(Form("Analysis %d <%s> reads AOD branch <%s> created by analysis %d <%s> executed later, input always empty!",
+                        iana, ana->GetName(), inputName.Data(), jana, producer->GetName()));
+      break;
+    }
+  }
 }
 
 //_____________________________________________
@@ -102,6 +102,8 @@ class AliAnaCaloTrackCorrMaker : public TObject {
   
   void    InitParameters();
   
+  void    CheckAnalysisOrder() const;
+  
   void    Print(const Option_t * opt) const;
   
   void    ProcessEvent(Int_t iEntry, const char * currentFileName) ;
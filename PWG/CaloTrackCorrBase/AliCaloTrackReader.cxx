@@ -387,12 +387,17 @@ Bool_t  AliCaloTrackReader::AcceptParticleMCLabel(Int_t mcLabel) const
 /// Copy of AliMCEvent::GetCocktailGeneratorAndIndex(), modified to get the 
 /// the generator index in the cocktail
 ///
+/// The generator label ranges and the result per label are kept for 
+/// the event in AliMCAnalysisUtils when available.
+///
 /// \param index: mc label index
 /// \param nameGen: cocktail generator name for this index
 /// \return cocktail generator index
 //_____________________________________________________________________
 Int_t AliCaloTrackReader::GetCocktailGeneratorAndIndex(Int_t index, TString & nameGen) const
 {
+  if ( fMCUtils ) return fMCUtils->GetCocktailGeneratorAndIndex(index, GetMC(), nameGen);
+  
   //method that gives the generator for a given particle with label index (or that of the corresponding primary)
   AliVParticle* mcpart0 = (AliVParticle*) GetMC()->GetTrack(index);
   Int_t genIndex = -1;
@@ -5009,12 +5014,26 @@ void AliCaloTrackReader::RemapMCLabelForAODs(Int_t & label)
 
 //___________________________________
 /// Reset lists, called in AliAnaCaloTrackCorrMaker.
+/// The arrays keep their capacity, so that filling them does not allocate
+/// once the size of the larger events is reached. In case of kMC data type, the
+/// tracks and clusters are created by the reader and are deleted here.
 //___________________________________
 void AliCaloTrackReader::ResetLists()
 {  
-  if(fCTSTracks)       fCTSTracks     -> Clear();
-  if(fEMCALClusters)   fEMCALClusters -> Clear("C");
-  if(fPHOSClusters)    fPHOSClusters  -> Clear("C");
+  if ( fDataType != kMC )
+  {
+    if(fCTSTracks)       fCTSTracks     -> Clear();
+    if(fEMCALClusters)   fEMCALClusters -> Clear("C");
+    if(fDCALClusters)    fDCALClusters  -> Clear("C");
+    if(fPHOSClusters)    fPHOSClusters  -> Clear("C");
+  }
+  else
+  {
+    if(fCTSTracks)       fCTSTracks     -> Delete();
+    if(fEMCALClusters)   fEMCALClusters -> Delete();
+    if(fDCALClusters)    fDCALClusters  -> Delete();
+    if(fPHOSClusters)    fPHOSClusters  -> Delete();
+  }
   
   fV0ADC[0] = 0;   fV0ADC[1] = 0;
   fV0Mul[0] = 0;   fV0Mul[1] = 0;
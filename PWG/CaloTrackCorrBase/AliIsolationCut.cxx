@@ -58,6 +58,11 @@ fUseLeadingPtUEFactor(0), fLeadingPtUEFactor(10000),
 fUseMaxPtUE(0),      fMaxPtUE(1000),
 fJetRhoTaskName(""),
 fDebug(0),           fMomentum(),                   fTrackVector(),
+fKineTrackArray(0),  fKineTrackEvent(-1),
+fKineTrackPt(),      fKineTrackEta(),               fKineTrackPhi(),
+fKineClusterArray(0),fKineClusterEvent(-1),         fKineClusterPID(0),
+fKineClusterPt(),    fKineClusterEta(),             fKineClusterPhi(),
+fKineClusterMatched(),
 fEMCEtaSize(-1),     fEMCPhiMin(-1),                fEMCPhiMax(-1),
 fTPCEtaSize(-1),     fTPCPhiSize(-1),
 // Histograms
@@ -261,13 +266,17 @@ void AliIsolationCut::CalculateCaloSignalInCone
   
   TObjArray * refclusters  = 0x0;
   Int_t       nclusterrefs = 0;
+
+  // Kinematics of the reader clusters, calculated once per event for all the candidates
+  Bool_t useKine   = FillClusterKinematics(plNe, reader);
+  Int_t  nClusters = plNe->GetEntries();
   
   //
   // Get the clusters in the cone
   //
   //printf("Loop calo\n");
 
-  for(Int_t ipr = 0;ipr < plNe->GetEntries() ; ipr ++ )
+  for(Int_t ipr = 0;ipr < nClusters ; ipr ++ )
   {
     AliVCluster * calo = dynamic_cast<AliVCluster *>(plNe->At(ipr)) ;
     
@@ -285,19 +294,24 @@ void AliIsolationCut::CalculateCaloSignalInCone
       // Skip matched clusters with tracks in case of neutral+charged analysis
       if ( fIsTMClusterInConeRejected )
       {
-        Bool_t bRes = kFALSE, bEoP = kFALSE;
-        Bool_t matched = pid->IsTrackMatched(calo, reader->GetCaloUtils(), 
-                                             reader->GetInputEvent(),
-                                             bEoP,bRes);
-        if ( fPartInCone == kNeutralAndCharged && matched ) continue ;
+        if ( fPartInCone == kNeutralAndCharged && IsClusterTrackMatched(ipr, calo, reader, pid, useKine) ) continue ;
+      }
+
+      if ( useKine )
+      {
+        pt  = fKineClusterPt [ipr];
+        eta = fKineClusterEta[ipr];
+        phi = fKineClusterPhi[ipr];
+      }
+      else
+      {
+        // Assume that come from vertex in straight line
+        calo->GetMomentum(fMomentum,reader->GetVertex(evtIndex)) ;
+
+        pt  = fMomentum.Pt()  ;
+        eta = fMomentum.Eta() ;
+        phi = fMomentum.Phi() ;
       }
-      
-      // Assume that come from vertex in straight line
-      calo->GetMomentum(fMomentum,reader->GetVertex(evtIndex)) ;
-      
-      pt  = fMomentum.Pt()  ;
-      eta = fMomentum.Eta() ;
-      phi = fMomentum.Phi() ;
     }
     else
     {// Mixed event stored in AliCaloTrackParticles
@@ -442,7 +456,7 @@ void AliIsolationCut::CalculateCaloSignalInCone
   // Get the UE clusters out of the cone
   //
 
-  for(Int_t ipr = 0;ipr < plNe->GetEntries() ; ipr ++ )
+  for(Int_t ipr = 0;ipr < nClusters ; ipr ++ )
   {
     AliVCluster * calo = dynamic_cast<AliVCluster *>(plNe->At(ipr)) ;
 
@@ -460,19 +474,24 @@ void AliIsolationCut::CalculateCaloSignalInCone
       // Skip matched clusters with tracks in case of neutral+charged analysis
       if ( fIsTMClusterInConeRejected )
       {
-        Bool_t bRes = kFALSE, bEoP = kFALSE;
-        Bool_t matched = pid->IsTrackMatched(calo, reader->GetCaloUtils(),
-                                             reader->GetInputEvent(),
-                                             bEoP,bRes);
-        if ( fPartInCone == kNeutralAndCharged && matched ) continue ;
+        if ( fPartInCone == kNeutralAndCharged && IsClusterTrackMatched(ipr, calo, reader, pid, useKine) ) continue ;
       }
 
-      // Assume that come from vertex in straight line
-      calo->GetMomentum(fMomentum,reader->GetVertex(evtIndex)) ;
+      if ( useKine )
+      {
+        pt  = fKineClusterPt [ipr];
+        eta = fKineClusterEta[ipr];
+        phi = fKineClusterPhi[ipr];
+      }
+      else
+      {
+        // Assume that come from vertex in straight line
+        calo->GetMomentum(fMomentum,reader->GetVertex(evtIndex)) ;
 
-      pt  = fMomentum.Pt()  ;
-      eta = fMomentum.Eta() ;
-      phi = fMomentum.Phi() ;
+        pt  = fMomentum.Pt()  ;
+        eta = fMomentum.Eta() ;
+        phi = fMomentum.Phi() ;
+      }
     }
     else
     {// Mixed event stored in AliCaloTrackParticles
@@ -756,11 +775,15 @@ void AliIsolationCut::CalculateTrackSignalInCone
   TObjArray * reftracks  = 0x0;
   Int_t       ntrackrefs = 0;
 
+  // Kinematics of the reader tracks, calculated once per event for all the candidates
+  Bool_t useKine = FillTrackKinematics(plCTS, reader);
+  Int_t  nTracks = plCTS->GetEntries();
+
   //-----------------------------------------------------------
   // Get the tracks in cone
   //-----------------------------------------------------------
 
-  for(Int_t ipr = 0;ipr < plCTS->GetEntries() ; ipr ++ )
+  for(Int_t ipr = 0;ipr < nTracks ; ipr ++ )
   {
     AliVTrack* track = dynamic_cast<AliVTrack*>(plCTS->At(ipr)) ;
 
@@ -782,10 +805,19 @@ void AliIsolationCut::CalculateTrackSignalInCone
         if ( contained ) continue ;
       }
 
-      fTrackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
-      ptTrack  = fTrackVector.Pt();
-      etaTrack = fTrackVector.Eta();
-      phiTrack = fTrackVector.Phi() ;
+      if ( useKine )
+      {
+        ptTrack  = fKineTrackPt [ipr];
+        etaTrack = fKineTrackEta[ipr];
+        phiTrack = fKineTrackPhi[ipr];
+      }
+      else
+      {
+        fTrackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
+        ptTrack  = fTrackVector.Pt();
+        etaTrack = fTrackVector.Eta();
+        phiTrack = fTrackVector.Phi() ;
+      }
     }
     else
     {// Mixed event stored in AliCaloTrackParticles
@@ -919,7 +951,7 @@ void AliIsolationCut::CalculateTrackSignalInCone
   // Select the UE tracks
   //-----------------------------------------------------------
 
-  for(Int_t ipr = 0;ipr < plCTS->GetEntries() ; ipr ++ )
+  for(Int_t ipr = 0;ipr < nTracks ; ipr ++ )
   {
     AliVTrack* track = dynamic_cast<AliVTrack*>(plCTS->At(ipr)) ;
 
@@ -941,10 +973,19 @@ void AliIsolationCut::CalculateTrackSignalInCone
         if ( contained ) continue ;
       }
 
-      fTrackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
-      ptTrack  = fTrackVector.Pt();
-      etaTrack = fTrackVector.Eta();
-      phiTrack = fTrackVector.Phi() ;
+      if ( useKine )
+      {
+        ptTrack  = fKineTrackPt [ipr];
+        etaTrack = fKineTrackEta[ipr];
+        phiTrack = fKineTrackPhi[ipr];
+      }
+      else
+      {
+        fTrackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
+        ptTrack  = fTrackVector.Pt();
+        etaTrack = fTrackVector.Eta();
+        phiTrack = fTrackVector.Phi() ;
+      }
     }
     else
     {// Mixed event stored in AliCaloTrackParticles
@@ -1287,6 +1328,115 @@ void AliIsolationCut::CalculateUEBandClusterNormalization
            coneArea, coneAreaGap, fEMCEtaSize, fEMCPhiSize);
 }
 
+//________________________________________________________________________________________________________________________________
+/// Fill the kinematics of the clusters of the reader for the current event, if not done yet.
+/// The clusters are the same for all the isolation candidates of the event, so their momentum
+/// is calculated once instead of for each candidate.
+/// \param clusters: array of clusters used for the isolation.
+/// \param reader: pointer to AliCaloTrackReader.
+/// \return kTRUE if the array is one of the reader and the kinematics are available by index in the array.
+//________________________________________________________________________________________________________________________________
+Bool_t AliIsolationCut::FillClusterKinematics(TObjArray * clusters, AliCaloTrackReader * reader)
+{
+  if ( clusters != reader->GetEMCALClusters() && clusters != reader->GetPHOSClusters() ) return kFALSE ;
+
+  Int_t nClusters = clusters->GetEntriesFast();
+  if ( clusters == fKineClusterArray && reader->GetEventNumber() == fKineClusterEvent &&
+       nClusters == (Int_t) fKineClusterPt.size() ) return kTRUE ;
+
+  fKineClusterArray = clusters;
+  fKineClusterEvent = reader->GetEventNumber();
+  fKineClusterPt     .assign(nClusters,    0);
+  fKineClusterEta    .assign(nClusters,    0);
+  fKineClusterPhi    .assign(nClusters,    0);
+  fKineClusterMatched.assign(nClusters,   -1);
+  fKineClusterPID = 0x0;
+
+  for(Int_t icl = 0; icl < nClusters; icl++)
+  {
+    AliVCluster * calo = dynamic_cast<AliVCluster *>(clusters->At(icl)) ;
+    if ( !calo ) continue ;
+
+    // Get the index where the cluster comes, to retrieve the corresponding vertex
+    Int_t evtIndex = 0 ;
+    if ( reader->GetMixedEvent() )
+      evtIndex=reader->GetMixedEvent()->EventIndexForCaloCluster(calo->GetID()) ;
+
+    // Assume that come from vertex in straight line
+    calo->GetMomentum(fMomentum,reader->GetVertex(evtIndex)) ;
+
+    fKineClusterPt [icl] = fMomentum.Pt()  ;
+    fKineClusterEta[icl] = fMomentum.Eta() ;
+    fKineClusterPhi[icl] = fMomentum.Phi() ;
+  }
+
+  return kTRUE ;
+}
+
+//________________________________________________________________________________________________________________________________
+/// Fill the kinematics of the tracks of the reader for the current event, if not done yet.
+/// \param tracks: array of tracks used for the isolation.
+/// \param reader: pointer to AliCaloTrackReader.
+/// \return kTRUE if the array is the one of the reader and the kinematics are available by index in the array.
+//________________________________________________________________________________________________________________________________
+Bool_t AliIsolationCut::FillTrackKinematics(TObjArray * tracks, AliCaloTrackReader * reader)
+{
+  if ( tracks != reader->GetCTSTracks() ) return kFALSE ;
+
+  Int_t nTracks = tracks->GetEntriesFast();
+  if ( tracks == fKineTrackArray && reader->GetEventNumber() == fKineTrackEvent &&
+       nTracks == (Int_t) fKineTrackPt.size() ) return kTRUE ;
+
+  fKineTrackArray = tracks;
+  fKineTrackEvent = reader->GetEventNumber();
+  fKineTrackPt .assign(nTracks, 0);
+  fKineTrackEta.assign(nTracks, 0);
+  fKineTrackPhi.assign(nTracks, 0);
+
+  for(Int_t itr = 0; itr < nTracks; itr++)
+  {
+    AliVTrack * track = dynamic_cast<AliVTrack*>(tracks->At(itr)) ;
+    if ( !track ) continue ;
+
+    fTrackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
+    fKineTrackPt [itr] = fTrackVector.Pt();
+    fKineTrackEta[itr] = fTrackVector.Eta();
+    fKineTrackPhi[itr] = fTrackVector.Phi() ;
+  }
+
+  return kTRUE ;
+}
+
+//________________________________________________________________________________________________________________________________
+/// Check if the cluster is matched with a track, reusing the result of a previous
+/// candidate of the event when the cluster kinematics of the reader are used.
+/// \param icl: index of the cluster in the array.
+/// \param calo: cluster.
+/// \param reader: pointer to AliCaloTrackReader.
+/// \param pid: pointer to AliCaloPID.
+/// \param useKine: the clusters are the ones of the reader, see FillClusterKinematics().
+//________________________________________________________________________________________________________________________________
+Bool_t AliIsolationCut::IsClusterTrackMatched(Int_t icl, AliVCluster * calo, AliCaloTrackReader * reader,
+                                              AliCaloPID * pid, Bool_t useKine)
+{
+  if ( useKine && pid != fKineClusterPID )
+  {
+    fKineClusterMatched.assign(fKineClusterMatched.size(), -1);
+    fKineClusterPID = pid;
+  }
+
+  if ( useKine && fKineClusterMatched[icl] >= 0 ) return fKineClusterMatched[icl] ;
+
+  Bool_t bRes = kFALSE, bEoP = kFALSE;
+  Bool_t matched = pid->IsTrackMatched(calo, reader->GetCaloUtils(),
+                                       reader->GetInputEvent(),
+                                       bEoP,bRes);
+
+  if ( useKine ) fKineClusterMatched[icl] = matched;
+
+  return matched ;
+}
+
 //________________________________________________________________________________________________________________________________
 /// Get normalization of track background band.
 //________________________________________________________________________________________________________________________________
@@ -24,12 +24,14 @@ class TObjArray ;
 class TList ;
 class TH3F ;
 #include <TLorentzVector.h>
+#include <vector>
 
 // --- ANALYSIS system ---
 class AliCaloTrackParticleCorrelation ;
 class AliCaloTrackReader ;
 class AliCaloPID ;
 class AliHistogramRanges ;
+class AliVCluster ;
 
 class AliIsolationCut : public TObject {
 
@@ -232,6 +234,15 @@ class AliIsolationCut : public TObject {
 
  private:
 
+  // Per event kinematics of the reader tracks and clusters, shared by the candidates
+
+  Bool_t     FillClusterKinematics(TObjArray * clusters, AliCaloTrackReader * reader) ;
+
+  Bool_t     FillTrackKinematics  (TObjArray * tracks  , AliCaloTrackReader * reader) ;
+
+  Bool_t     IsClusterTrackMatched(Int_t icl, AliVCluster * calo, AliCaloTrackReader * reader,
+                                   AliCaloPID * pid, Bool_t useKine) ;
+
   Bool_t     fFillHistograms;                          ///< Fill histograms if GetCreateOuputObjects() was called. 
   
   Bool_t     fFillEtaPhiHistograms;                    ///< Fill histograms if GetCreateOuputObjects() was called with eta/phi or band related histograms 
@@ -289,6 +300,20 @@ class AliIsolationCut : public TObject {
   TLorentzVector fMomentum;                            //!<! Momentum of cluster, temporal object.
 
   TVector3   fTrackVector;                             //!<! Track moment, temporal object.
+
+  TObjArray *          fKineTrackArray;                //!<! Reader track array of the stored kinematics.
+  Int_t                fKineTrackEvent;                //!<! Event number of the stored track kinematics.
+  std::vector<Float_t> fKineTrackPt;                   //!<! pT of the reader tracks, by index in the array.
+  std::vector<Float_t> fKineTrackEta;                  //!<! Eta of the reader tracks, by index in the array.
+  std::vector<Float_t> fKineTrackPhi;                  //!<! Phi of the reader tracks, by index in the array.
+
+  TObjArray *          fKineClusterArray;              //!<! Reader cluster array of the stored kinematics.
+  Int_t                fKineClusterEvent;              //!<! Event number of the stored cluster kinematics.
+  AliCaloPID *         fKineClusterPID;                //!<! PID used for the stored track matching results.
+  std::vector<Float_t> fKineClusterPt;                 //!<! pT of the reader clusters, by index in the array.
+  std::vector<Float_t> fKineClusterEta;                //!<! Eta of the reader clusters, by index in the array.
+  std::vector<Float_t> fKineClusterPhi;                //!<! Phi of the reader clusters, by index in the array.
+  std::vector<Char_t>  fKineClusterMatched;            //!<! Track matching of the reader clusters, -1 if not checked yet.
   
   Float_t    fEMCEtaSize;                              ///< Eta size of Calo
   Float_t    fEMCPhiMin;                               ///< Minimim Phi limit of Calo
@@ -579,7 +604,7 @@ class AliIsolationCut : public TObject {
   AliIsolationCut & operator = (const AliIsolationCut & g) ; 
 
   /// \cond CLASSIMP
-  ClassDef(AliIsolationCut,29) ;
+  ClassDef(AliIsolationCut,30) ;
   /// \endcond
 
 } ;
@@ -53,7 +53,18 @@ fPyProcess(-1),
 fPyFirstParticle(0), 
 fPyVersion(0),
 fMinPartonicParent(5),
-fMaxPartonicParent(8)
+fMaxPartonicParent(8),
+fUseOriginMemo(kTRUE),
+fMemoEvent(-1),
+fMemoMCEvent(NULL),
+fMemoNTracks(0),
+fOriginMemo(),
+fGeneratorMemo(),
+fGenTableBuilt(kFALSE),
+fHasCocktailList(kFALSE),
+fGenFirstLabel(),
+fGenEndLabel(),
+fGenNames()
 {}
 
 //_______________________________________
@@ -269,8 +280,69 @@ Int_t AliMCAnalysisUtils::CheckOrigin(const Int_t *labels, const UShort_t * edep
   //////////////// End get the Pythia header //////////
   
   // Most significant particle contributing to the cluster
-  Int_t label=labels[0];
+  Int_t  label         = labels[0];
+  Int_t  momLabel      = -1;
+  Int_t  mesonLabel    = -1;
+  Bool_t checkLostPair = kFALSE;
+  
+  // Ancestry of the label, walked only once per event and label if the memo is on
+  if ( fUseOriginMemo )
+  {
+    CheckMemoEvent(mcevent);
+    
+    Int_t * memo = &fOriginMemo[label*kNOriginMemo];
+    if ( memo[0] < 0 )
+    {
+      Bool_t checkLost = kFALSE;
+      ClassifyLabel(label, mcevent, memo[0], memo[1], memo[2], checkLost);
+      memo[3] = checkLost;
+    }
+    
+    tag           = memo[0];
+    momLabel      = memo[1];
+    mesonLabel    = memo[2];
+    checkLostPair = memo[3];
+  }
+  else
+  {
+    ClassifyLabel(label, mcevent, tag, momLabel, mesonLabel, checkLostPair);
+  }
+  
+  // Cluster dependent checks, pi0/eta (decay photons)
+  if ( mesonLabel >= 0 )
+  {
+    // Set to kMCPi0/kMCEta if 2 gammas in same cluster
+    CheckOverlapped2GammaDecay(labels, edepFrac, nlabels, mesonLabel, clusE, mcevent, tag); 
     
+    // In case it did not merge, check if the decay companion is lost
+    UInt_t mergedBit = CheckTagBit(tag,kMCPi0Decay) ? kMCPi0 : kMCEta;
+    if ( checkLostPair && !CheckTagBit(tag,mergedBit) && 
+        !CheckTagBit(tag,kMCDecayPairInCalo) && !CheckTagBit(tag,kMCDecayPairLost) )
+      CheckLostDecayPair(arrayCluster, momLabel, mesonLabel, mcevent, tag);
+  }
+  
+  return tag;
+}
+
+//__________________________________________________________________________________________
+/// Classify the origin of a MC label walking its ancestry, the part of CheckOrigin()
+/// that depends only on the label and on the event header.
+///
+/// \param label    : MC label, must be valid
+/// \param mcevent  : pointer to MCEvent()
+/// \param tag      : tag with the origin bits
+/// \param momLabel : label of the mother after skipping conversions
+/// \param mesonLabel    : pi0/eta label to check for overlapped decay photons in the cluster, -1 if none
+/// \param checkLostPair : check if the decay companion is lost in case it did not merge
+//__________________________________________________________________________________________
+void AliMCAnalysisUtils::ClassifyLabel(Int_t label, AliMCEvent* mcevent, Int_t & tag, Int_t & momLabel,
+                                       Int_t & mesonLabel, Bool_t & checkLostPair)
+{
+  tag           = 0;
+  momLabel      = -1;
+  mesonLabel    = -1;
+  checkLostPair = kFALSE;
+  
   // Mother
   AliVParticle * mom = mcevent->GetTrack(label);
   Int_t iMom     = label;
@@ -400,7 +472,7 @@ Int_t AliMCAnalysisUtils::CheckOrigin(const Int_t *labels, const UShort_t * edep
     
     AliDebug(2,"First mother is directly pi0, not decayed by generator");
     
-    CheckOverlapped2GammaDecay(labels, edepFrac, nlabels, iMom, clusE, mcevent, tag); //set to kMCPi0 if 2 gammas in same cluster
+    mesonLabel = iMom; //set to kMCPi0 if 2 gammas in same cluster, checked in CheckOrigin
   }
   else if(mPdg == 221)
   {
@@ -408,7 +480,7 @@ Int_t AliMCAnalysisUtils::CheckOrigin(const Int_t *labels, const UShort_t * edep
     
     AliDebug(2,"First mother is directly eta, not decayed by generator");
     
-    CheckOverlapped2GammaDecay(labels, edepFrac, nlabels, iMom, clusE, mcevent, tag); //set to kMCEta if 2 gammas in same cluster
+    mesonLabel = iMom; //set to kMCEta if 2 gammas in same cluster, checked in CheckOrigin
   }
   //Photons  
   else if(mPdg == 22)
@@ -421,16 +493,10 @@ Int_t AliMCAnalysisUtils::CheckOrigin(const Int_t *labels, const UShort_t * edep
       
       AliDebug(2,"Generator pi0 decay photon");
       
-      // Set to kMCPi0 if 2 gammas in same cluster
-      CheckOverlapped2GammaDecay(labels, edepFrac, nlabels, iParent, clusE, mcevent, tag); 
-                                                                            
-      // In case it did not merge, check if the decay companion is lost
-      if(!CheckTagBit(tag, kMCPi0) && !CheckTagBit(tag,kMCDecayPairInCalo) && !CheckTagBit(tag,kMCDecayPairLost))
-      {
-        CheckLostDecayPair(arrayCluster,iMom, iParent, mcevent, tag);
-      }
-      
-      //printf("Bit set is Merged %d, Pair in calo %d, Lost %d\n",CheckTagBit(tag, kMCPi0),CheckTagBit(tag,kMCDecayPairInCalo),CheckTagBit(tag,kMCDecayPairLost));
+      // Set to kMCPi0 if 2 gammas in same cluster, 
+      // in case it did not merge, check if the decay companion is lost, both in CheckOrigin
+      mesonLabel    = iParent;
+      checkLostPair = kTRUE;
     }
     else if ( pPdg == 221 )
     {
@@ -438,12 +504,10 @@ Int_t AliMCAnalysisUtils::CheckOrigin(const Int_t *labels, const UShort_t * edep
       
       AliDebug(2,"Generator eta decay photon");
       
-      // Set to kMCEta if 2 gammas in same cluster
-      CheckOverlapped2GammaDecay(labels, edepFrac, nlabels, iParent, clusE, mcevent, tag); 
-      
-      // In case it did not merge, check if the decay companion is lost
-      if(!CheckTagBit(tag, kMCEta) && !CheckTagBit(tag,kMCDecayPairInCalo) && !CheckTagBit(tag,kMCDecayPairLost))
-        CheckLostDecayPair(arrayCluster,iMom, iParent, mcevent, tag);
+      // Set to kMCEta if 2 gammas in same cluster, 
+      // in case it did not merge, check if the decay companion is lost, both in CheckOrigin
+      mesonLabel    = iParent;
+      checkLostPair = kTRUE;
     }
     else if ( pPdg >  100 )
     {
@@ -611,7 +675,167 @@ Int_t AliMCAnalysisUtils::CheckOrigin(const Int_t *labels, const UShort_t * edep
     SetTagBit(tag,kMCUnknown);
   }
   
-  return tag;
+  momLabel = iMom;
+}
+
+//__________________________________________________________________________________________
+/// Reset the memo of CheckOrigin() and GetCocktailGeneratorAndIndex() 
+/// when the event changed. The memo arrays are filled on demand.
+///
+/// \param mcevent : pointer to MCEvent()
+//__________________________________________________________________________________________
+void AliMCAnalysisUtils::CheckMemoEvent(AliMCEvent* mcevent)
+{
+  Int_t eventN = -1;
+  AliAnalysisManager * manager = AliAnalysisManager::GetAnalysisManager();
+  if ( manager && manager->GetInputEventHandler() )
+    eventN = manager->GetInputEventHandler()->GetReadEntry();
+  
+  Int_t ntracks = mcevent->GetNumberOfTracks();
+  
+  if ( fMemoEvent == eventN && fMemoMCEvent == mcevent && fMemoNTracks == ntracks ) return;
+  
+  fMemoEvent   = eventN;
+  fMemoMCEvent = mcevent;
+  fMemoNTracks = ntracks;
+  
+  fOriginMemo   .assign(ntracks*kNOriginMemo, -1);
+  fGeneratorMemo.clear();
+  fGenTableBuilt = kFALSE;
+}
+
+//__________________________________________________________________________________________
+/// Fill the label ranges of the cocktail generators of the event,
+/// as in AliCaloTrackReader::GetGeneratorNameAndIndex(). 
+/// The last generator ends at the number of primaries, the first one starts at 0.
+///
+/// \param mcevent : pointer to MCEvent()
+//__________________________________________________________________________________________
+void AliMCAnalysisUtils::BuildGeneratorTable(AliMCEvent* mcevent)
+{
+  fGenFirstLabel.clear();
+  fGenEndLabel  .clear();
+  fGenNames     .clear();
+  fGenTableBuilt = kTRUE;
+  
+  TList* lh = mcevent->GetCocktailList();
+  fHasCocktailList = (lh != NULL);
+  if ( !lh ) return;
+  
+  Int_t nh       = lh->GetEntries();
+  Int_t nsumpart = mcevent->GetNumberOfPrimaries();
+  
+  fGenFirstLabel.resize(nh);
+  fGenEndLabel  .resize(nh);
+  fGenNames     .resize(nh);
+  
+  for (Int_t i = nh-1; i >= 0; i--)
+  {
+    AliGenEventHeader* gh = (AliGenEventHeader*)lh->At(i);
+    
+    Int_t npart = gh->NProduced();
+    
+    if (i == 0) npart = nsumpart;
+    
+    fGenNames     [i] = gh->GetName();
+    fGenEndLabel  [i] = nsumpart;
+    fGenFirstLabel[i] = nsumpart-npart;
+    
+    nsumpart-=npart;
+  }
+  
+  fGeneratorMemo.assign(fMemoNTracks, kGenNotResolved);
+}
+
+//__________________________________________________________________________________________
+/// \return index of the cocktail generator in which label range the label is, -1 if none.
+//__________________________________________________________________________________________
+Int_t AliMCAnalysisUtils::GetGeneratorIndexFromTable(Int_t label) const
+{
+  for (Int_t i = (Int_t)fGenNames.size()-1; i >= 0; i--)
+  {
+    if ( label < fGenEndLabel[i] && label >= fGenFirstLabel[i] ) return i;
+  }
+  
+  return -1;
+}
+
+//__________________________________________________________________________________________
+/// Get the name and index of the cocktail generator that generated a given particle 
+/// or its first ancestor in the generator label ranges. Same as 
+/// AliCaloTrackReader::GetCocktailGeneratorAndIndex(), but the generator label ranges 
+/// are obtained once per event and the result is kept per label.
+///
+/// \param label   : mc label index
+/// \param mcevent : pointer to MCEvent()
+/// \param genName : cocktail generator name for this label
+/// \return cocktail generator index
+//__________________________________________________________________________________________
+Int_t AliMCAnalysisUtils::GetCocktailGeneratorAndIndex(Int_t label, AliMCEvent* mcevent, TString & genName)
+{
+  AliVParticle* mcpart0 = mcevent->GetTrack(label);
+  
+  if ( !mcpart0 )
+  {
+    AliWarning(Form("AliMCEvent-BREAK: No valid AliMCParticle at label %i",label));
+    return -1;
+  }
+  
+  CheckMemoEvent(mcevent);
+  
+  if ( !fGenTableBuilt ) BuildGeneratorTable(mcevent);
+  
+  if ( !fHasCocktailList ) 
+  {
+    genName = "nococktailheader";
+    return -1;
+  }
+  
+  Bool_t memo = fUseOriginMemo && label >= 0 && label < fMemoNTracks;
+  
+  Int_t genIndex = memo ? fGeneratorMemo[label] : kGenNotResolved;
+  
+  if ( genIndex == kGenNotResolved )
+  {
+    genIndex = GetGeneratorIndexFromTable(label);
+    
+    Int_t lab = label;
+    
+    while ( genIndex < 0 || fGenNames[genIndex].IsWhitespace() )
+    {
+      AliVParticle* mcpart = mcevent->GetTrack(lab);
+      
+      if ( !mcpart )
+      {
+        AliWarning(Form("AliMCEvent-BREAK: No valid AliMCParticle at label %i",lab));
+        break;
+      }
+      
+      Int_t mother = mcpart->GetMother();
+      
+      if ( mother < 0 )
+      {
+        AliWarning("AliMCEvent - BREAK: Reached primary particle without valid mother");
+        break;
+      }
+      
+      if ( !mcevent->GetTrack(mother) )
+      {
+        AliWarning(Form("AliMCEvent-BREAK: No valid AliMCParticle mother at label %i",mother));
+        break;
+      }
+      
+      lab = mother;
+      
+      genIndex = GetGeneratorIndexFromTable(mother);
+    }
+    
+    if ( memo ) fGeneratorMemo[label] = genIndex;
+  }
+  
+  genName = ( genIndex >= 0 ? fGenNames[genIndex] : TString("") );
+  
+  return genIndex;
 }
 
 //_________________________________________________________________________________________
@@ -1862,6 +2086,7 @@ void AliMCAnalysisUtils::Print(const Option_t * opt) const
   
   printf("Debug level    = %d\n",fDebug);
   printf("MC Generator   = %s\n",fMCGeneratorString.Data());
+  printf("Origin memo    = %d\n",fUseOriginMemo);
   printf(" \n");
 } 
 
@@ -1962,6 +2187,8 @@ void AliMCAnalysisUtils::PrintMCTag(Int_t tag) const
 //__________________________________________________
 void AliMCAnalysisUtils::SetMCGenerator(Int_t mcgen)
 {  
+  fMemoEvent   = -1;
+  fMemoMCEvent = NULL;
   fMCGenerator = mcgen ;
   if     (mcgen == kPythia) fMCGeneratorString = "PYTHIA";
   else if(mcgen == kHerwig) fMCGeneratorString = "HERWIG";
@@ -1978,6 +2205,8 @@ void AliMCAnalysisUtils::SetMCGenerator(Int_t mcgen)
 //____________________________________________________
 void AliMCAnalysisUtils::SetMCGenerator(TString mcgen)
 {  
+  fMemoEvent   = -1;
+  fMemoMCEvent = NULL;
   fMCGeneratorString = mcgen ;
   
   if     (mcgen == "PYTHIA") fMCGenerator = kPythia;
@@ -20,6 +20,7 @@
 //_________________________________________________________________________
 
 // --- ROOT system ---
+#include <vector>
 #include <TObject.h>
 #include <TString.h>
 #include <TLorentzVector.h>
@@ -71,6 +72,14 @@ class AliMCAnalysisUtils : public TObject {
                       AliMCEvent* mcevent, TString selectHeaderName, Float_t clusE,
                       const TObjArray *arrayCluster = 0x0) ; 
   
+  // Memo of the label ancestry walk in CheckOrigin() and of the
+  // cocktail generator of the labels, reset every event
+  void    SwitchOnOriginMemo()          { fUseOriginMemo = kTRUE  ; }
+  void    SwitchOffOriginMemo()         { fUseOriginMemo = kFALSE ; }
+  Bool_t  IsOriginMemoOn()        const { return fUseOriginMemo ; }
+  
+  Int_t   GetCocktailGeneratorAndIndex(Int_t label, AliMCEvent* mcevent, TString & genName) ;
+  
   void    CheckOverlapped2GammaDecay(const Int_t *labels, const UShort_t * edepFrac, Int_t nlabels, 
                                      Int_t mesonIndex, Float_t clusE, const AliMCEvent* mcevent, Int_t & tag); 
   
@@ -150,6 +159,14 @@ class AliMCAnalysisUtils : public TObject {
 
  private:
 
+  void    ClassifyLabel(Int_t label, AliMCEvent* mcevent, Int_t & tag, Int_t & momLabel,
+                        Int_t & mesonLabel, Bool_t & checkLostPair) ;
+  void    CheckMemoEvent(AliMCEvent* mcevent) ;
+  void    BuildGeneratorTable(AliMCEvent* mcevent) ;
+  Int_t   GetGeneratorIndexFromTable(Int_t label) const ;
+  
+  enum memo { kNOriginMemo = 4, kGenNotResolved = -2 } ;
+  
   Int_t          fCurrentEvent;        ///<  Current Event number - GetJets()
   
   Int_t          fDebug;               ///<  Debug level
@@ -181,6 +198,19 @@ class AliMCAnalysisUtils : public TObject {
   Int_t         fMinPartonicParent;   ///< Minimum label of partonic parent of direct photon
   Int_t         fMaxPartonicParent;   ///< Minimum label of partonic parent of direct photon
   
+  // Per event memo of CheckOrigin() and GetCocktailGeneratorAndIndex()
+  Bool_t        fUseOriginMemo;       ///< Memoize the label ancestry and generator per event
+  Int_t         fMemoEvent;           //!<! Event number of the memo
+  AliMCEvent  * fMemoMCEvent;         //!<! MC event of the memo
+  Int_t         fMemoNTracks;         //!<! Number of MC particles in the event of the memo
+  std::vector<Int_t>   fOriginMemo;   //!<! Per label: tag (-1 not classified yet), mother label, pi0/eta label, check lost pair
+  std::vector<Int_t>   fGeneratorMemo;//!<! Per label cocktail generator index, kGenNotResolved if not resolved yet
+  Bool_t        fGenTableBuilt;       //!<! Generator label ranges filled for the memo event
+  Bool_t        fHasCocktailList;     //!<! Event has a cocktail list
+  std::vector<Int_t>   fGenFirstLabel;//!<! First label of each cocktail generator
+  std::vector<Int_t>   fGenEndLabel;  //!<! Label after the last one of each cocktail generator
+  std::vector<TString> fGenNames;     //!<! Name of each cocktail generator
+  
   /// Copy constructor not implemented.
   AliMCAnalysisUtils & operator = (const AliMCAnalysisUtils & mcu) ; 
   
@@ -188,7 +218,7 @@ class AliMCAnalysisUtils : public TObject {
   AliMCAnalysisUtils(              const AliMCAnalysisUtils & mcu) ; 
   
   /// \cond CLASSIMP
-  ClassDef(AliMCAnalysisUtils,8) ;
+  ClassDef(AliMCAnalysisUtils,9) ;
   /// \endcond
 
 } ;
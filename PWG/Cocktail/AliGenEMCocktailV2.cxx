@@ -74,7 +74,10 @@ AliGenEMCocktailV2::AliGenEMCocktailV2():AliGenCocktail(),
   fDynPtRange(kFALSE),
   fForceConv(kFALSE),
   fSelectedParticles(kGenHadrons),
-  fUseFixedEP(kFALSE)  
+  fUseFixedEP(kFALSE),
+  fV2TableBins(0),
+  fV2TableMaxPt(20.),
+  fPtTableBins(0)
 {
   // Constructor
 }
@@ -186,6 +189,7 @@ void AliGenEMCocktailV2::CreateCocktail()
   AliInfo(Form("Selected Params:collision system - %d , centrality - %d",fCollisionSystem, fCentrality));
   //Initialize user selection for Pt Parameterization and centrality:
   AliGenEMlibV2::SelectParams(fCollisionSystem, fCentrality,fV2Systematic);
+  AliGenEMlibV2::SetV2Tabulation(fV2TableBins, fV2TableMaxPt);
   AliGenEMlibV2::SetMtScalingFactors(fParametrizationFile, fParametrizationDir);
   SetMtScalingFactors();
   AliGenEMlibV2::SetPtParametrizations(fParametrizationFile, fParametrizationDir);
@@ -803,6 +807,8 @@ void AliGenEMCocktailV2::AddSource2Generator(Char_t* nameSource,
   genSource->SetForceGammaConversion(fForceConv);
   if (!TVirtualMC::GetMC()) genSource->SetDecayer(fDecayer);
   genSource->Init();
+  // finer inverse-CDF table for the pt sampling, filled once at the first generated particle
+  if (fPtTableBins>0 && genSource->GetPt()) genSource->GetPt()->SetNpx(fPtTableBins);
 
   AddGenerator(genSource,nameSource,1.); // Adding Generator
 }
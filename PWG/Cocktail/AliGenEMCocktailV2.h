@@ -72,6 +72,8 @@ public:
   static  void    SetMtScalingFactors();
   static  Bool_t  SetPtYDistributions();
   void    SetFixedEventPlane(Bool_t toFix=kTRUE){fUseFixedEP=toFix;} //Default is random
+  void    SetV2Tabulation(Int_t nBins, Double_t ptMax=20.)            { fV2TableBins = nBins; fV2TableMaxPt = ptMax; }
+  void    SetPtTableBins(Int_t nBins)                                 { fPtTableBins = nBins;             }
  
   // getters
   Bool_t    GetDynamicalPtRangeOption()       const                   { return fDynPtRange;               }
@@ -140,8 +142,11 @@ private:
   Bool_t        fForceConv;                             // select whether you want to force all gammas to convert imidediately
   UInt_t        fSelectedParticles;                     // which particles to simulate, allows to switch on and off 32 different particles
   Bool_t        fUseFixedEP;                            // use random Event Plane or fixed Psi=0
+  Int_t         fV2TableBins;                           // number of pt bins of the tabulated v2 of the sources, 0: evaluate per particle
+  Double_t      fV2TableMaxPt;                          // upper pt limit of the tabulated v2
+  Int_t         fPtTableBins;                           // number of points of the pt sampling tables of the sources, 0: TF1 default
   
-  ClassDef(AliGenEMCocktailV2,9)                        // cocktail for EM physics
+  ClassDef(AliGenEMCocktailV2,10)                        // cocktail for EM physics
 };
 
 #endif
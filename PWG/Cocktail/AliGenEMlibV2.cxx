@@ -50,6 +50,27 @@ Int_t AliGenEMlibV2::fgSelectedCentrality       = AliGenEMlibV2::kpp;
 Int_t AliGenEMlibV2::fgSelectedV2Systematic     = AliGenEMlibV2::kNoV2Sys;
 TF1*  AliGenEMlibV2::fV2Parametrization[]={0x0} ;
 Int_t AliGenEMlibV2::fV2RefParameterization[] = {0} ;
+Int_t    AliGenEMlibV2::fgV2TableBins           = 0;
+Double_t AliGenEMlibV2::fgV2TableMaxPt          = 20.;
+GenFunc  AliGenEMlibV2::fgV2Func[]              = {0x0};
+std::vector<Double_t> AliGenEMlibV2::fgV2Table[28];
+
+namespace {
+  // one callback per source, as GenFunc carries no source index
+  template <Int_t np> Double_t V2TabulatedSource(const Double_t *px, const Double_t */*dummy*/)
+  {
+    return AliGenEMlibV2::V2Tabulated(np, px[0]);
+  }
+
+  const GenFunc kV2TabulatedFunc[28] = {
+    V2TabulatedSource<0>,  V2TabulatedSource<1>,  V2TabulatedSource<2>,  V2TabulatedSource<3>,
+    V2TabulatedSource<4>,  V2TabulatedSource<5>,  V2TabulatedSource<6>,  V2TabulatedSource<7>,
+    V2TabulatedSource<8>,  V2TabulatedSource<9>,  V2TabulatedSource<10>, V2TabulatedSource<11>,
+    V2TabulatedSource<12>, V2TabulatedSource<13>, V2TabulatedSource<14>, V2TabulatedSource<15>,
+    V2TabulatedSource<16>, V2TabulatedSource<17>, V2TabulatedSource<18>, V2TabulatedSource<19>,
+    V2TabulatedSource<20>, V2TabulatedSource<21>, V2TabulatedSource<22>, V2TabulatedSource<23>,
+    V2TabulatedSource<24>, V2TabulatedSource<25>, V2TabulatedSource<26>, V2TabulatedSource<27>};
+}
 
 Double_t AliGenEMlibV2::CrossOverLc(double a, double b, double x){
   if(x<b-a/2) return 1.0;
@@ -1296,6 +1317,50 @@ Double_t AliGenEMlibV2::EtScalingV2(Double_t ptPart, Int_t iPart, Int_t iRef)
 }
 
 
+//--------------------------------------------------------------------------
+//
+//                             Tabulated V2
+//
+//--------------------------------------------------------------------------
+void AliGenEMlibV2::SetV2Tabulation(Int_t nBins, Double_t ptMax)
+{
+  // v2 of the sources is linearly interpolated in nBins equidistant pt bins
+  // between 0 and ptMax, instead of evaluating the parametrization for every
+  // generated particle; nBins=0 switches the tables off
+  fgV2TableBins   = (nBins>0 && ptMax>0.) ? nBins : 0;
+  fgV2TableMaxPt  = ptMax;
+  ResetV2Tables();
+}
+
+void AliGenEMlibV2::ResetV2Tables()
+{
+  // tables depend on the selected parameters, refill them at the next call
+  for (Int_t i=0; i<28; i++) fgV2Table[i].clear();
+}
+
+Double_t AliGenEMlibV2::V2Tabulated(Int_t np, Double_t pt)
+{
+  GenFunc func = fgV2Func[np];
+  if (!func) return 0.;
+  if (pt<0. || pt>=fgV2TableMaxPt || fgV2TableBins<=0) return func(&pt, &pt);
+
+  std::vector<Double_t> &table = fgV2Table[np];
+  const Double_t binWidth = fgV2TableMaxPt/fgV2TableBins;
+  if (table.empty()) {
+    table.resize(fgV2TableBins+1);
+    for (Int_t i=0; i<=fgV2TableBins; i++) {
+      Double_t ptEdge = i*binWidth;
+      table[i] = func(&ptEdge, &ptEdge);
+    }
+  }
+
+  Double_t x = pt/binWidth;
+  Int_t bin = TMath::Min((Int_t)x, fgV2TableBins-1);
+  Double_t frac = x-bin;
+  return (1.-frac)*table[bin] + frac*table[bin+1];
+}
+
+
 //--------------------------------------------------------------------------
 //
 //                                  TAA
@@ -1398,6 +1463,7 @@ Bool_t AliGenEMlibV2::SetFlowParametrizations(TString fileName, TString dirName)
   //If dirname is not zero, read parameterizations from file
   //for particles with missing parametrizations the Mt scaling is applied
 
+  ResetV2Tables();
   if(dirName.Length()==0){ //use built-in parameterizations, do nothing
     return kTRUE;
   }
@@ -2028,5 +2094,10 @@ GenFunc AliGenEMlibV2::GetV2(Int_t param, const char * tname) const
       func=0;
       printf("<AliGenEMlibV2::GetV2> unknown parametrisation\n");
   }
+  if (func && fgV2TableBins>0 && param>=0 && param<28) {
+    // the generator evaluates v2 once per particle, use the table instead
+    fgV2Func[param] = func;
+    func = kV2TabulatedFunc[param];
+  }
   return func;
 }
@@ -20,6 +20,7 @@
 #include "TF1.h"
 #include "TH1D.h"
 #include "TH2F.h"
+#include <vector>
 
 class iostream;
 class TRandom;
@@ -53,6 +54,7 @@ public:
     fgSelectedCollisionsSystem  = collisionSystem;
     fgSelectedCentrality        = centSelect;
     fgSelectedV2Systematic      = v2sys;
+    ResetV2Tables();
   }
   
   GenFunc   GetPt(Int_t param, const char * tname=0) const;
@@ -69,6 +71,11 @@ public:
   static TH1D*  GetMtScalingFactors();
   static TH2F*  GetPtYDistribution(Int_t np);
 
+  // v2(pt) evaluated from tables filled at the first call (nBins=0: no tables, default)
+  static void     SetV2Tabulation(Int_t nBins, Double_t ptMax);
+  static Double_t V2Tabulated(Int_t np, Double_t pt);
+  static void     ResetV2Tables();
+
   static Int_t fgSelectedCollisionsSystem;                                                      // selected pT parameter
   static Int_t fgSelectedCentrality;                                                            // selected Centrality
   static Int_t fgSelectedV2Systematic;                                                          // selected v2 systematics, usefully values: -1,0,1
@@ -273,6 +280,10 @@ private:
   static TH2F*    fPtYDistribution[26];       // pt-y distributions
   static TF1*     fV2Parametrization[27];     // pt paramtrizations
   static Int_t    fV2RefParameterization[27]; // ID of a hadron used for parameterization of V2 for Et scaling
+  static Int_t    fgV2TableBins;              // number of pt bins of the v2 tables
+  static Double_t fgV2TableMaxPt;             // upper pt limit of the v2 tables, above v2 is evaluated directly
+  static GenFunc  fgV2Func[28];               // v2 parametrization of each source used to fill its table
+  static std::vector<Double_t> fgV2Table[28]; // v2 at the bin edges of each source
 
   ClassDef(AliGenEMlibV2,7);
 };
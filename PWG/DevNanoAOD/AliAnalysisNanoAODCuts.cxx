@@ -22,7 +22,7 @@ ClassImp(AliNanoAODSimpleSetter)
 
 
 AliAnalysisNanoAODTrackCuts::AliAnalysisNanoAODTrackCuts():
-AliAnalysisCuts(), fBitMask(1), fMinPt(0), fMaxEta(10)
+AliAnalysisCuts(), fBitMask(1), fMinPt(0), fMaxEta(10), fFilterMapBuf(), fPtBuf(), fEtaBuf()
 {
   // default ctor 
 }
@@ -40,6 +40,33 @@ Bool_t AliAnalysisNanoAODTrackCuts::IsSelected(TObject* obj)
   return kTRUE;  
 }
 
+void AliAnalysisNanoAODTrackCuts::SelectTracks(Int_t n, TObject* const* tracks, std::vector<Char_t>& selection)
+{
+  // Evaluates the cuts for n tracks (AliAODTrack): the inputs are gathered first,
+  // then the cuts are combined without branches so that the loop can be vectorized
+  
+  fFilterMapBuf.resize(n);
+  fPtBuf.resize(n);
+  fEtaBuf.resize(n);
+  selection.resize(n);
+  for (Int_t i = 0; i < n; i++) {
+    const AliAODTrack* track = static_cast<const AliAODTrack*>(tracks[i]);
+    fFilterMapBuf[i] = track->GetFilterMap();
+    fPtBuf[i] = track->Pt();
+    fEtaBuf[i] = track->Eta();
+  }
+  
+  const UInt_t* filterMap = fFilterMapBuf.data();
+  const Double_t* pt = fPtBuf.data();
+  const Double_t* eta = fEtaBuf.data();
+  Char_t* sel = selection.data();
+  const UInt_t mask = fBitMask;
+  const Double_t minPt = fMinPt;
+  const Double_t maxEta = fMaxEta;
+  for (Int_t i = 0; i < n; i++)
+    sel[i] = ((filterMap[i] & mask) != 0) & !(pt[i] < minPt) & !(TMath::Abs(eta[i]) > maxEta);
+}
+
 AliAnalysisNanoAODV0Cuts::AliAnalysisNanoAODV0Cuts()
     : AliAnalysisCuts(),
       fSelectOnFly(false),
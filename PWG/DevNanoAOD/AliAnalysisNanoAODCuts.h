@@ -6,6 +6,7 @@
 #include "AliAnalysisUtils.h"
 #include "AliEventCuts.h"
 #include <map>
+#include <vector>
 
 class AliEventCuts;
 
@@ -16,6 +17,7 @@ public:
   virtual ~AliAnalysisNanoAODTrackCuts()  {}
   virtual Bool_t IsSelected(TObject* obj); // TObject should be an AliAODTrack
   virtual Bool_t IsSelected(TList*   /* list */ ) { return kTRUE; }
+  void SelectTracks(Int_t n, TObject* const* tracks, std::vector<Char_t>& selection); // same decisions as IsSelected, for all tracks of an event
   UInt_t GetBitMask() { return fBitMask; }
   void  SetBitMask (UInt_t var) { fBitMask = var;}
   Float_t GetMinPt() { return fMinPt; }
@@ -28,7 +30,11 @@ private:
   Float_t fMinPt; // miminum pt of the tracks
   Float_t fMaxEta; // MaxEta
 
-  ClassDef(AliAnalysisNanoAODTrackCuts,1); // track cut object for nano AOD filtering
+  std::vector<UInt_t>  fFilterMapBuf; //! filter maps of the tracks in SelectTracks
+  std::vector<Double_t> fPtBuf;       //! pt of the tracks in SelectTracks
+  std::vector<Double_t> fEtaBuf;      //! eta of the tracks in SelectTracks
+
+  ClassDef(AliAnalysisNanoAODTrackCuts,2); // track cut object for nano AOD filtering
 };
 
 class AliAnalysisNanoAODV0Cuts : public AliAnalysisCuts
@@ -45,6 +45,12 @@
 #include "AliNanoFilterNormalisation.h"
 #include "AliMultSelectionTask.h"
 
+#include <thread>
+#include <set>
+#include <TObjArray.h>
+#include <TObjString.h>
+#include <TROOT.h>
+
 ClassImp(AliAnalysisTaskNanoAODFilter)
 
 
@@ -63,7 +69,11 @@ AliAnalysisTaskNanoAODFilter::AliAnalysisTaskNanoAODFilter() // All data members
   fNmultBins(100),
   fMinMult(0),
   fMaxMult(100),
-  fNormalisation(0x0)
+  fNormalisation(0x0),
+  fExtraReplicators(),
+  fExtraFileNames(),
+  fParallelOutputs(kFALSE),
+  fTrackSelections()
 
 {
   // Dummy constructor ALWAYS needed for I/O.
@@ -84,7 +94,11 @@ AliAnalysisTaskNanoAODFilter::AliAnalysisTaskNanoAODFilter(const char *name, Boo
    fNmultBins(100),
    fMinMult(0),
    fMaxMult(100),
-   fNormalisation(0x0)
+   fNormalisation(0x0),
+   fExtraReplicators(),
+   fExtraFileNames(),
+   fParallelOutputs(kFALSE),
+   fTrackSelections()
 
 {
   // Constructor
@@ -103,6 +117,15 @@ AliAnalysisTaskNanoAODFilter::~AliAnalysisTaskNanoAODFilter()
   // Destructor. Clean-up the output list, but not the histograms that are put inside
   // (the list is owner and will clean-up these histograms). Protect in PROOF case.
   
+  // replicators delete their track cuts, which can be shared between outputs
+  std::set<AliAnalysisCuts*> deletedCuts;
+  if (fReplicator)
+    deletedCuts.insert(fReplicator->GetTrackCuts());
+  for (UInt_t i = 0; i < fExtraReplicators.size(); i++) {
+    if (!deletedCuts.insert(fExtraReplicators[i]->GetTrackCuts()).second)
+      fExtraReplicators[i]->SetTrackCuts(0);
+    delete fExtraReplicators[i];
+  }
   delete fReplicator;
   if (fQAOutput) 
     delete fQAOutput;
@@ -126,9 +149,63 @@ void AliAnalysisTaskNanoAODFilter::UserCreateOutputObjects()
   PostData(1, fNormalisation);
 }
 
-void AliAnalysisTaskNanoAODFilter::AddFilteredAOD(const char* aodfilename, const char* title)
+AliNanoAODReplicator* AliAnalysisTaskNanoAODFilter::AddOutput(const char* aodfilename)
+{
+  // Adds an output file with its own replicator, which is returned for configuration
+
+  for (Int_t i = 0; i < GetNumberOfOutputs(); i++)
+    if (strcmp(GetOutputFileName(i), aodfilename) == 0)
+      AliFatal(Form("Output %s already exists", aodfilename));
+
+  AliNanoAODReplicator* replicator = new AliNanoAODReplicator(Form("NanoAODReplicator_%d", GetNumberOfOutputs()), "remove non interesting tracks, writes special tracks array tracks");
+  fExtraReplicators.push_back(replicator);
+  fExtraFileNames.push_back(aodfilename);
+  return replicator;
+}
+
+void AliAnalysisTaskNanoAODFilter::MergeTrackVarLists()
+{
+  // The track mapping is a singleton: all outputs store the union of the track variables.
+  // Columnar outputs keep writing only the columns of their own list.
+
+  std::vector<AliNanoAODReplicator*> replicators(1, fReplicator);
+  replicators.insert(replicators.end(), fExtraReplicators.begin(), fExtraReplicators.end());
+
+  TString merged;
+  for (UInt_t i = 0; i < replicators.size(); i++) {
+    TObjArray* vars = TString(replicators[i]->GetVarListTrack()).Tokenize(",");
+    TIter next(vars);
+    TObjString* token = 0;
+    while ((token = (TObjString*) next())) {
+      TString var = token->GetString().Strip(TString::kBoth, ' ');
+      if (var.IsNull() || TString("," + merged + ",").Contains("," + var + ","))
+        continue;
+      if (!merged.IsNull())
+        merged += ",";
+      merged += var;
+    }
+    delete vars;
+  }
+
+  for (UInt_t i = 0; i < replicators.size(); i++) {
+    TString own(replicators[i]->GetVarListTrack());
+    own.ReplaceAll(" ", "");
+    if (own == merged)
+      continue;
+    if (replicators[i]->IsColumnarTracks())
+      replicators[i]->SetColumnVarList(own);
+    else
+      AliWarning(Form("Output %s stores the track variables of all outputs: %s", GetOutputFileName(i), merged.Data()));
+    replicators[i]->SetVarListTrack(merged);
+  }
+}
+
+void AliAnalysisTaskNanoAODFilter::AddFilteredAOD(const char* aodfilename, const char* title, AliNanoAODReplicator* replicator)
 {
-  // The replicator is added to the extension
+  // The replicator (by default the one of the first output) is added to the extension
+
+  if (!replicator)
+    replicator = fReplicator;
 
   AliAODHandler *aodH = (AliAODHandler*)((AliAnalysisManager::GetAnalysisManager())->GetOutputEventHandler());
   if (!aodH) AliFatal("No AOD handler");
@@ -138,16 +215,16 @@ void AliAnalysisTaskNanoAODFilter::AddFilteredAOD(const char* aodfilename, const
     AliFatal("Cannot get extension");
   }
   
-  fReplicator->SetMCMode(fMCMode);
+  replicator->SetMCMode(fMCMode);
      
-  if (!fInputArrayName.IsNull()) fReplicator->SetInputArrayName(fInputArrayName);
-  if (!fOutputArrayName.IsNull()) fReplicator->SetOutputArrayName(fOutputArrayName);
+  if (!fInputArrayName.IsNull()) replicator->SetInputArrayName(fInputArrayName);
+  if (!fOutputArrayName.IsNull()) replicator->SetOutputArrayName(fOutputArrayName);
 
   ext->DropUnspecifiedBranches(); // all branches not part of a FilterBranch call (below) will be dropped
       
-  ext->FilterBranch("tracks",fReplicator);
-  ext->FilterBranch("vertices",fReplicator);  
-  ext->FilterBranch("header",fReplicator);  
+  ext->FilterBranch("tracks",replicator); // with columnar tracks this writes the track columns (and the track array only if kept)
+  ext->FilterBranch("vertices",replicator);  
+  ext->FilterBranch("header",replicator);  
             
   if ( fMCMode > 0 ) 
     {
@@ -156,15 +233,22 @@ void AliAnalysisTaskNanoAODFilter::AddFilteredAOD(const char* aodfilename, const
       // For events w/o muon, mcparticles array will be empty and mcheader will be dummy
       // (e.g. strlen(GetGeneratorName())==0)
       
-      ext->FilterBranch("mcparticles",fReplicator);
-      ext->FilterBranch("mcHeader",fReplicator);
+      ext->FilterBranch("mcparticles",replicator);
+      ext->FilterBranch("mcHeader",replicator);
     }
 }
 
 void AliAnalysisTaskNanoAODFilter::Init()
 {
   // Initialization
-  AddFilteredAOD("AliAOD.NanoAOD.root", "NanoAODTracksEvents");
+  if (fExtraReplicators.size())
+    MergeTrackVarLists();
+  if (fParallelOutputs)
+    ROOT::EnableThreadSafety();
+
+  AddFilteredAOD(GetOutputFileName(0), "NanoAODTracksEvents");
+  for (Int_t i = 1; i < GetNumberOfOutputs(); i++)
+    AddFilteredAOD(GetOutputFileName(i), Form("NanoAODTracksEvents_%d", i), fExtraReplicators[i - 1]);
 }
 
 void AliAnalysisTaskNanoAODFilter::UserExec(Option_t *) 
@@ -200,12 +284,60 @@ void AliAnalysisTaskNanoAODFilter::UserExec(Option_t *)
 
   AliAODHandler* handler = dynamic_cast<AliAODHandler*>(AliAnalysisManager::GetAnalysisManager()->GetOutputEventHandler());
   if ( handler ){
-    AliAODExtension *extNanoAOD = handler->GetFilteredAOD("AliAOD.NanoAOD.root");
-   if ( extNanoAOD ) {				
-     extNanoAOD->SetEvent(lAODevent);
-     extNanoAOD->SelectEvent();
-     extNanoAOD->FinishEvent();
-   }
+    if (fExtraReplicators.empty()) {
+      AliAODExtension *extNanoAOD = handler->GetFilteredAOD("AliAOD.NanoAOD.root");
+      if ( extNanoAOD ) {				
+        extNanoAOD->SetEvent(lAODevent);
+        extNanoAOD->SelectEvent();
+        extNanoAOD->FinishEvent();
+      }
+      return;
+    }
+
+    // Several outputs: track cuts shared by outputs are evaluated once
+    std::vector<AliNanoAODReplicator*> replicators(1, fReplicator);
+    replicators.insert(replicators.end(), fExtraReplicators.begin(), fExtraReplicators.end());
+    fTrackSelections.resize(replicators.size());
+    for (UInt_t i = 0; i < replicators.size(); i++) {
+      AliAnalysisCuts* cuts = replicators[i]->GetTrackCuts();
+      if (!cuts)
+        continue;
+      for (UInt_t k = 0; k < i; k++) {
+        if (replicators[k]->GetTrackCuts() != cuts)
+          continue;
+        if (fTrackSelections[k].empty())
+          replicators[k]->EvaluateTrackCuts(*lAODevent, fTrackSelections[k]);
+        replicators[k]->SetTrackSelection(&fTrackSelections[k]);
+        replicators[i]->SetTrackSelection(&fTrackSelections[k]);
+        break;
+      }
+    }
+
+    std::vector<AliAODExtension*> extensions;
+    for (Int_t i = 0; i < GetNumberOfOutputs(); i++) {
+      AliAODExtension *ext = handler->GetFilteredAOD(GetOutputFileName(i));
+      if (!ext)
+        continue;
+      ext->SetEvent(lAODevent);
+      ext->SelectEvent();
+      extensions.push_back(ext);
+    }
+
+    // copy and writing of the outputs are independent
+    if (fParallelOutputs) {
+      std::vector<std::thread> pool;
+      for (UInt_t i = 1; i < extensions.size(); i++)
+        pool.emplace_back([](AliAODExtension* ext) { ext->FinishEvent(); }, extensions[i]);
+      if (extensions.size())
+        extensions[0]->FinishEvent();
+      for (auto &thread : pool) thread.join();
+    } else {
+      for (UInt_t i = 0; i < extensions.size(); i++)
+        extensions[i]->FinishEvent();
+    }
+
+    for (UInt_t i = 0; i < fTrackSelections.size(); i++)
+      fTrackSelections[i].clear();
   }
 }
 
@@ -218,22 +350,32 @@ void AliAnalysisTaskNanoAODFilter::FinishTaskOutput() {
   // We save here the user info
 
   AliAODHandler* handler = dynamic_cast<AliAODHandler*>(AliAnalysisManager::GetAnalysisManager()->GetOutputEventHandler());
-  AliAODExtension *extNanoAOD = handler->GetFilteredAOD("AliAOD.NanoAOD.root");
-
-  // copy production version info
   AliVEventHandler* inputHandler = AliAnalysisManager::GetAnalysisManager()->GetInputEventHandler();
-  if (inputHandler->GetUserInfo()) {
-    TObject* prodInfo = inputHandler->GetUserInfo()->FindObject("alirootVersion");
-    if (prodInfo)
-      extNanoAOD->GetTree()->GetUserInfo()->Add(prodInfo->Clone());
+
+  for (Int_t i = 0; i < GetNumberOfOutputs(); i++) {
+    AliAODExtension *extNanoAOD = handler->GetFilteredAOD(GetOutputFileName(i));
+    if (!extNanoAOD)
+      continue;
+
+    // copy production version info
+    if (inputHandler->GetUserInfo()) {
+      TObject* prodInfo = inputHandler->GetUserInfo()->FindObject("alirootVersion");
+      if (prodInfo)
+        extNanoAOD->GetTree()->GetUserInfo()->Add(prodInfo->Clone());
+    }
+
+    // the mapping is common to all outputs, the additional outputs store a copy
+    AliNanoAODTrackMapping* mapping = AliNanoAODTrackMapping::GetInstance(fReplicator->GetVarListTrack());
+    if (i == 0) {
+      Printf("****************************************************************");
+      extNanoAOD->GetTree()->GetUserInfo()->Add(mapping);
+      mapping->Print();
+      Printf("****************************************************************");
+    } else
+      extNanoAOD->GetTree()->GetUserInfo()->Add(mapping->Clone());
+
+    extNanoAOD->GetTree()->GetUserInfo()->Add(fNormalisation->Clone());
   }
-  
-  Printf("****************************************************************");
-  extNanoAOD->GetTree()->GetUserInfo()->Add(AliNanoAODTrackMapping::GetInstance(fReplicator->GetVarListTrack()));
-  AliNanoAODTrackMapping::GetInstance()->Print();
-  Printf("****************************************************************");
-  
-  extNanoAOD->GetTree()->GetUserInfo()->Add(fNormalisation->Clone());
 }
 
 void AliAnalysisTaskNanoAODFilter::AddPIDField(AliNanoAODTrack::ENanoPIDResponse response, AliPID::EParticleType particle)
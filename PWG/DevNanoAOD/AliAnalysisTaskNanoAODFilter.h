@@ -23,6 +23,7 @@ class AliNanoFilterNormalisation;
 #include "AliNanoAODTrack.h"
 #include "AliPID.h"
 #include <list>
+#include <vector>
 
 class AliAnalysisTaskNanoAODFilter : public AliAnalysisTaskSE {
 public:
@@ -39,7 +40,7 @@ public:
 
   Int_t GetMCMode() { return fMCMode; }
   void  SetMCMode (Int_t var) { fMCMode = var;}
-  void  AddFilteredAOD(const char* aodfilename, const char* title);
+  void  AddFilteredAOD(const char* aodfilename, const char* title, AliNanoAODReplicator* replicator = 0);
 
   void  AddEvtCuts     (AliAnalysisCuts * var           ) { fEvtCuts.push_back(var);}
   void  SetTrkCuts     (AliAnalysisCuts * var           ) { fReplicator->SetTrackCuts(var); if (fSaveCutsFlag) fQAOutput->Add(var);}
@@ -62,10 +63,20 @@ public:
     fMaxMult = max;
   }
   
-  AliNanoAODReplicator* GetReplicator() { return fReplicator; }
+  AliNanoAODReplicator* GetReplicator(Int_t output = 0) { return output == 0 ? fReplicator : fExtraReplicators.at(output - 1); }
+
+  // Additional outputs: each output has its own replicator (cuts, variable lists, setters) and file,
+  // the event selection of the task is common. The setters of the task configure the first output only.
+  // The outputs share one track storage layout (the union of the track variable lists);
+  // outputs in columnar mode write only the columns of their own variable list.
+  AliNanoAODReplicator* AddOutput(const char* aodfilename);
+  Int_t GetNumberOfOutputs() const { return fExtraReplicators.size() + 1; }
+  // Process the outputs on separate threads (copy and writing). Custom setters must then be thread safe and not shared between outputs.
+  void  SetParallelOutputs(Bool_t var) { fParallelOutputs = var; }
 
   void SetInputArrayName(TString name) {fInputArrayName=name;}
   void SetOutputArrayName(TString name) {fOutputArrayName=name;}
+  void SetColumnarTracks(Bool_t var, Bool_t keepTrackArray = kFALSE) { fReplicator->SetColumnarTracks(var, keepTrackArray); }
 
   bool         fUseAliEventCuts;
   AliEventCuts fEventCuts;
@@ -89,10 +100,18 @@ protected:
   Float_t fMinMult;     // min value of the axis of normalisation historgram
   Float_t fMaxMult;     // min value of the axis of normalisation historgram
 
+  std::vector<AliNanoAODReplicator*> fExtraReplicators; // replicators of the additional outputs
+  std::vector<TString> fExtraFileNames; // file names of the additional outputs
+  Bool_t fParallelOutputs; // if true the outputs are processed on separate threads
+  std::vector<std::vector<Char_t> > fTrackSelections; //! track cut decisions shared by several outputs
+
+  void  MergeTrackVarLists();
+  const char* GetOutputFileName(Int_t output) const { return output == 0 ? "AliAOD.NanoAOD.root" : fExtraFileNames[output - 1].Data(); }
+
   AliAnalysisTaskNanoAODFilter(const AliAnalysisTaskNanoAODFilter&); // not implemented
   AliAnalysisTaskNanoAODFilter& operator=(const AliAnalysisTaskNanoAODFilter&); // not implemented
 
-  ClassDef(AliAnalysisTaskNanoAODFilter, 9); // Nano AOD Filter Task
+  ClassDef(AliAnalysisTaskNanoAODFilter, 10); // Nano AOD Filter Task
 };
 
 #endif
@@ -23,6 +23,10 @@ public:
   virtual ~AliNanoAODCustomSetter() {;}
   virtual void SetNanoAODHeader(const AliAODEvent * event   , AliNanoAODHeader * head , TString varListHeader  ) =0;
   virtual void SetNanoAODTrack (const AliAODTrack * aodTrack, AliNanoAODTrack * spTrack) =0;
+  // Called once per event with all the selected tracks, can be overridden to process them in batch
+  virtual void SetNanoAODTracks(Int_t n, const AliAODTrack * const * aodTracks, AliNanoAODTrack * const * spTracks) {
+    for (Int_t i = 0; i < n; i++) SetNanoAODTrack(aodTracks[i], spTracks[i]);
+  }
 
   ClassDef(AliNanoAODCustomSetter, 1)
 };
@@ -49,6 +49,7 @@ class AliAODRecoDecay;
 #include "TObjArray.h"
 #include "AliAnalysisFilter.h"
 #include "AliNanoAODTrack.h"
+#include "AliNanoAODTrackColumn.h"
 
 #include <TFile.h>
 #include <TDatabasePDG.h>
@@ -112,7 +113,16 @@ AliAODBranchReplicator(),
   fInputArrayName(""),
   fOutputArrayName("tracks"),
   fKeepDaughters(),
-  fClonedVertices()
+  fClonedVertices(),
+  fColumnarTracks(kFALSE),
+  fKeepTrackArray(kFALSE),
+  fColumnPrefix("trackcol"),
+  fColumnVarList(""),
+  fTrackSelection(0),
+  fOwnTrackSelection(),
+  fSetterInput(),
+  fSetterOutput(),
+  fColumns()
   {
   // Default ctor. we need it to avoid instantiating a wrong mapping when reading from file
   }
@@ -152,7 +162,16 @@ AliNanoAODReplicator::AliNanoAODReplicator(const char* name, const char* title)
   fInputArrayName(""),
   fOutputArrayName("tracks"),
   fKeepDaughters(),
-  fClonedVertices()
+  fClonedVertices(),
+  fColumnarTracks(kFALSE),
+  fKeepTrackArray(kFALSE),
+  fColumnPrefix("trackcol"),
+  fColumnVarList(""),
+  fTrackSelection(0),
+  fOwnTrackSelection(),
+  fSetterInput(),
+  fSetterOutput(),
+  fColumns()
 {
   // default ctor
 }
@@ -162,6 +181,8 @@ AliNanoAODReplicator::~AliNanoAODReplicator()
 {
   // dtor
   delete fTrackCuts;
+  if (fList && !fList->FindObject(fTracks))
+    delete fTracks;
   delete fList;
 }
 
@@ -568,13 +589,33 @@ TList* AliNanoAODReplicator::GetList() const
         if (AliNanoAODTrackMapping::GetInstance()->GetVarIndex("ID") == -1)
           AliFatal("Conversion Photons requested but field 'id' missing in track variables");
       }
+      if (!IsTrackArrayWritten() && (fSaveV0s || fSaveCascades || fSaveConversionPhotons))
+        AliFatal("V0s, cascades and conversion photons reference the tracks: use SetColumnarTracks(kTRUE, kTRUE) to keep the track array");
       
       fList = new TList;
       fList->SetOwner(kTRUE);
 
       fTracks = new TClonesArray("AliNanoAODTrack");
       fTracks->SetName(fOutputArrayName.Data());
-      fList->Add(fTracks);
+      if (IsTrackArrayWritten())
+        fList->Add(fTracks);
+
+      if (fColumnarTracks) {
+        // one column per variable of the track storage, plus label and nano flags
+        AliNanoAODTrackMapping* mapping = AliNanoAODTrackMapping::GetInstance(fVarList);
+        TString columnVars = "," + fColumnVarList + ",";
+        columnVars.ReplaceAll(" ", "");
+        for (Int_t i = 0; i < mapping->GetSize(); i++)
+          if (fColumnVarList.IsNull() || columnVars.Contains(TString::Format(",%s,", mapping->GetVarName(i))))
+            fColumns.push_back(new AliNanoAODTrackColumn(AliNanoAODTrackColumn::GetColumnName(fColumnPrefix, mapping->GetVarName(i)), kFALSE, i));
+        for (Int_t i = 0; i < mapping->GetSizeInt(); i++)
+          if (fColumnVarList.IsNull() || columnVars.Contains(TString::Format(",%s,", mapping->GetVarNameInt(i))))
+            fColumns.push_back(new AliNanoAODTrackColumn(AliNanoAODTrackColumn::GetColumnName(fColumnPrefix, mapping->GetVarNameInt(i)), kTRUE, i));
+        fColumns.push_back(new AliNanoAODTrackColumn(AliNanoAODTrackColumn::GetColumnName(fColumnPrefix, "label"), kTRUE, AliNanoAODTrackColumn::kLabel));
+        fColumns.push_back(new AliNanoAODTrackColumn(AliNanoAODTrackColumn::GetColumnName(fColumnPrefix, "flags"), kTRUE, AliNanoAODTrackColumn::kNanoFlags));
+        for (UInt_t i = 0; i < fColumns.size(); i++)
+          fList->Add(fColumns[i]);
+      }
 
       Int_t numberOfHeaderParam = 0;
       Int_t numberOfHeaderParamInt = 0;
@@ -824,6 +865,14 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
   
   std::map<TObject*, AliNanoAODTrack*> trackAssociation;
   
+  // nano track cuts are evaluated for all tracks at once
+  if (!fTrackSelection && dynamic_cast<AliAnalysisNanoAODTrackCuts*>(fTrackCuts)) {
+    EvaluateTrackCuts(source, fOwnTrackSelection);
+    fTrackSelection = &fOwnTrackSelection;
+  }
+  fSetterInput.clear();
+  fSetterOutput.clear();
+  
   // Tracks
   Int_t ntracks(0);
   for(Int_t j=0; j<entries; j++) {
@@ -834,7 +883,10 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
     AliAODTrack *aodtrack = (AliAODTrack*) track;
 
     Bool_t selected = kFALSE;
-    if (!fTrackCuts || fTrackCuts->IsSelected(aodtrack)) 
+    if (fTrackSelection && fTrackSelection->size() == (UInt_t) entries) {
+      if ((*fTrackSelection)[j])
+        selected = kTRUE;
+    } else if (!fTrackCuts || fTrackCuts->IsSelected(aodtrack)) 
       selected = kTRUE;
     
     // store tracks needed for V0s
@@ -851,12 +903,15 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
       continue;
 
     AliNanoAODTrack* nanoTrack = new((*fTracks)[ntracks++]) AliNanoAODTrack (aodtrack, fVarList);
-
-    for (std::list<AliNanoAODCustomSetter*>::iterator it = fCustomSetters.begin(); it != fCustomSetters.end(); ++it)
-      (*it)->SetNanoAODTrack(aodtrack, nanoTrack);
+    fSetterInput.push_back(aodtrack);
+    fSetterOutput.push_back(nanoTrack);
     
     trackAssociation[aodtrack] = nanoTrack;
   }
+
+  // custom variables are set by each setter for all the tracks of the event
+  for (std::list<AliNanoAODCustomSetter*>::iterator it = fCustomSetters.begin(); it != fCustomSetters.end(); ++it)
+    (*it)->SetNanoAODTracks(fSetterInput.size(), fSetterInput.data(), fSetterOutput.data());
   
   // Replace references to stored tracks. 
   // NOTE this has to respect the order in which they were stored (e.g. for a V0 the first daugther needs to be the positive one).
@@ -884,6 +939,55 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
   if ( fMCMode > 0 ) {
     FilterMC(source);      
   }
+
+  // Columns are filled last, after the labels were remapped
+  if (fColumnarTracks)
+    FillTrackColumns();
+
+  fTrackSelection = 0;
+}
+
+//_____________________________________________________________________________
+void AliNanoAODReplicator::EvaluateTrackCuts(const AliAODEvent& source, std::vector<Char_t>& selection) const
+{
+  // Evaluates the track cuts for all input tracks, in the order used by ReplicateAndFilter
+
+  TClonesArray* particleArray = 0x0;
+  Int_t entries = -1;
+  if(!fInputArrayName.IsNull()){
+    particleArray = static_cast<TClonesArray*> (source.FindListObject(fInputArrayName.Data()));
+    entries = particleArray->GetEntries();
+  }else{
+    entries = source.GetNumberOfTracks();
+  }
+
+  selection.resize(entries);
+  AliAnalysisNanoAODTrackCuts* nanoCuts = dynamic_cast<AliAnalysisNanoAODTrackCuts*>(fTrackCuts);
+  if (nanoCuts) {
+    std::vector<TObject*> tracks(entries);
+    for (Int_t j = 0; j < entries; j++)
+      tracks[j] = particleArray ? particleArray->At(j) : source.GetTrack(j);
+    nanoCuts->SelectTracks(entries, tracks.data(), selection);
+    return;
+  }
+  for (Int_t j = 0; j < entries; j++) {
+    TObject* track = particleArray ? particleArray->At(j) : source.GetTrack(j);
+    selection[j] = (!fTrackCuts || fTrackCuts->IsSelected(track));
+  }
+}
+
+//_____________________________________________________________________________
+void AliNanoAODReplicator::FillTrackColumns()
+{
+  // Splits the selected tracks into the columns, one variable at a time
+
+  const Int_t ntracks = fTracks->GetEntriesFast();
+  for (UInt_t i = 0; i < fColumns.size(); i++) {
+    AliNanoAODTrackColumn* column = fColumns[i];
+    column->Clear();
+    for (Int_t j = 0; j < ntracks; j++)
+      column->Fill(static_cast<AliNanoAODTrack*>(fTracks->UncheckedAt(j)));
+  }
 }
 
 void AliNanoAODReplicator::Terminate()
@@ -16,6 +16,7 @@
 
 #include <iostream>
 #include <list>
+#include <vector>
 //
 // Implementation of a branch replicator 
 // to produce nano AOD.
@@ -49,6 +50,7 @@ class AliAODHeader;
 class AliNanoAODHeader;
 class AliAnalysisTaskSE;
 class AliNanoAODTrack;
+class AliNanoAODTrackColumn;
 class AliAODTrack;
 class AliNanoAODCustomSetter;
 class AliAODZDC;
@@ -74,6 +76,7 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   void  SetVarListHeader (const char * var) { fVarListHeader = var;}
   
   void SetTrackCuts(AliAnalysisCuts* cuts) { fTrackCuts = cuts; }
+  AliAnalysisCuts* GetTrackCuts() const { return fTrackCuts; }
   void SetV0Cuts(AliAnalysisCuts* cuts) { fV0Cuts = cuts; }
   void SetCascadeCuts(AliAnalysisCuts* cuts) { fCascadeCuts = cuts; }
   void SetConversionPhotonCuts(AliAnalysisCuts* cuts) { fConversionPhotonCuts = cuts; }
@@ -97,6 +100,24 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   void SetOutputArrayName(TString name) {fOutputArrayName=name;}
 
   void SetVarListHeaderTC(TString var) {fVarListHeader_fTC=var;}
+
+  // Columnar tracks: one branch <prefix>_<variable> per track variable (see AliNanoAODTrackColumn)
+  // The track array is only written if keepTrackArray is set (needed as reference for V0s, cascades and photons)
+  void SetColumnarTracks(Bool_t b, Bool_t keepTrackArray = kFALSE, const char* prefix = "trackcol") {
+    fColumnarTracks = b;
+    fKeepTrackArray = keepTrackArray;
+    fColumnPrefix = prefix;
+  }
+  // Variables written as columns, by default all the variables of the track list
+  void SetColumnVarList(const char* var) { fColumnVarList = var; }
+  Bool_t IsColumnarTracks() const { return fColumnarTracks; }
+  Bool_t IsTrackArrayWritten() const { return !fColumnarTracks || fKeepTrackArray; }
+  const char* GetColumnPrefix() const { return fColumnPrefix; }
+
+  // Track cut decisions evaluated outside of the replicator (e.g. shared by several outputs)
+  // The selection is used for the next call to ReplicateAndFilter only
+  void EvaluateTrackCuts(const AliAODEvent& source, std::vector<Char_t>& selection) const;
+  void SetTrackSelection(const std::vector<Char_t>* selection) { fTrackSelection = selection; }
     
  private:
 
@@ -107,6 +128,7 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   void RelabelAODPhotonCandidates(AliAODConversionPhoton *PhotonCandidate);
   void FilterMC(const AliAODEvent& source);
   AliAODVertex* CloneAndStoreVertex(AliAODVertex* toClone);
+  void FillTrackColumns();
  
   AliAnalysisCuts* fTrackCuts; // decides which tracks to keep
   AliAnalysisCuts* fV0Cuts;    // decides which V0s to keep
@@ -156,10 +178,20 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   std::map<AliAODVertex*, std::vector<TObject*> > fKeepDaughters; //! Tracks needed as references to V0s and cascades
   std::map<AliAODVertex*, AliAODVertex*> fClonedVertices; //! avoid that vertices are stored several times
 
+  Bool_t fColumnarTracks; // if kTRUE the track variables are stored in columns
+  Bool_t fKeepTrackArray; // if kTRUE the track array is written in addition to the columns
+  TString fColumnPrefix;  // prefix of the column branch names
+  TString fColumnVarList; // variables written as columns (all if empty)
+  const std::vector<Char_t>* fTrackSelection; //! externally evaluated track cut decisions for the current event
+  std::vector<Char_t> fOwnTrackSelection; //! track cut decisions evaluated in batch by the replicator
+  std::vector<const AliAODTrack*> fSetterInput; //! selected input tracks, passed to the custom setters
+  std::vector<AliNanoAODTrack*> fSetterOutput;  //! corresponding nanoAOD tracks
+  mutable std::vector<AliNanoAODTrackColumn*> fColumns; //! track columns (owned by fList)
+
   AliNanoAODReplicator(const AliNanoAODReplicator&);
   AliNanoAODReplicator& operator=(const AliNanoAODReplicator&);
 
-  ClassDef(AliNanoAODReplicator, 7) // Branch replicator for ESD to muon AOD.
+  ClassDef(AliNanoAODReplicator, 10) // Branch replicator for ESD to muon AOD.
 };
 
 #endif
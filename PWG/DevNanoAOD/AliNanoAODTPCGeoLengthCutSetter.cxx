@@ -2,6 +2,7 @@
 
 #include "AliAODEvent.h"
 #include "AliESDtrack.h"
+#include "AliExternalTrackParam.h"
 #include "AliNanoAODHeader.h"
 #include "AliVTrack.h"
 
@@ -18,7 +19,13 @@ ClassImp(AliNanoAODTPCGeoLengthCutSetter)
       fRequireCutGeoNcrNclGeom1Pt(1.5),
       fCutGeoNcrNclFractionNcr(0.85),
       fCutGeoNcrNclFractionNcl(0.7),
-      fIndex(-1) {}
+      fIndex(-1),
+      fUseLengthTable(kFALSE),
+      fTableNPhi(180),
+      fTableNInvPt(1000),
+      fTableMaxInvPt(10.),
+      fLengthTable(),
+      fTableMagField(0) {}
 
 AliNanoAODTPCGeoLengthCutSetter::~AliNanoAODTPCGeoLengthCutSetter() {}
 
@@ -37,6 +44,28 @@ void AliNanoAODTPCGeoLengthCutSetter::SetNanoAODTrack(
   if (fIndex == -1)
     fIndex = -2;  // prevent useless run.
 
+  if (fIndex >= 0 && fUseLengthTable && fMode == 0) {
+    Double_t lengthInActiveZoneTPC = 0;
+    if (GetTableLength(aodTrack, lengthInActiveZoneTPC)) {
+      // same inputs as the AliESDtrack built below
+      auto checkResult = true;
+      auto cutGeoNcrNclLength =
+          fRequireCutGeoNcrNclLength -
+          TMath::Power(1. / aodTrack->Pt(), fRequireCutGeoNcrNclGeom1Pt);
+      if (lengthInActiveZoneTPC < cutGeoNcrNclLength)
+        checkResult = false;
+      if (aodTrack->GetTPCNCrossedRows() <
+          fCutGeoNcrNclFractionNcr * cutGeoNcrNclLength)
+        checkResult = false;
+      if (aodTrack->GetTPCNcls() <
+          fCutGeoNcrNclFractionNcl * cutGeoNcrNclLength)
+        checkResult = false;
+
+      spTrack->SetVar(fIndex, (checkResult) ? 1. : 0.);
+      return;
+    }
+  }
+
   if (fIndex >= 0) {
     auto checkResult = true;
     AliESDtrack fESDTrack(aodTrack);
@@ -60,4 +89,59 @@ void AliNanoAODTPCGeoLengthCutSetter::SetNanoAODTrack(
 
     spTrack->SetVar(fIndex, (checkResult) ? 1. : 0.);
   }
-};
\ No newline at end of file
+};
+
+void AliNanoAODTPCGeoLengthCutSetter::BuildLengthTable() {
+  // Length of tracks from the origin with tgl = 0, at the bin centres
+  fLengthTable.assign(fTableNInvPt * fTableNPhi, 0);
+  fTableMagField = fMagField;
+  const Double_t sectorWidth = TMath::Pi() / 9;
+  Double_t xyz[3] = {0, 0, 0};
+  Double_t cov[21] = {0};
+  for (Int_t iq = 0; iq < fTableNInvPt; iq++) {
+    Double_t invPt = -fTableMaxInvPt + (iq + 0.5) * 2 * fTableMaxInvPt / fTableNInvPt;
+    for (Int_t iphi = 0; iphi < fTableNPhi; iphi++) {
+      Double_t phi = (iphi + 0.5) * sectorWidth / fTableNPhi;
+      Double_t pxpypz[3] = {TMath::Cos(phi) / TMath::Abs(invPt),
+                            TMath::Sin(phi) / TMath::Abs(invPt), 0};
+      AliExternalTrackParam param(xyz, pxpypz, cov, invPt > 0 ? 1 : -1);
+      fLengthTable[iq * fTableNPhi + iphi] = AliESDtrack::GetLengthInActiveZone(
+          &param, fDeltaY, fDeltaZ, fMagField);
+    }
+  }
+}
+
+Bool_t AliNanoAODTPCGeoLengthCutSetter::GetTableLength(
+    const AliAODTrack* aodTrack,
+    Double_t& length) {
+  // Returns kFALSE if the track has to be computed exactly
+  if (fMagField == 0 || aodTrack->Pt() <= 0)
+    return kFALSE;
+
+  Double_t invPt = aodTrack->Charge() / aodTrack->Pt();
+  if (TMath::Abs(invPt) >= fTableMaxInvPt)
+    return kFALSE;
+
+  // the table assumes the z limit is not reached: bound the arc length up to the outer radius
+  const Double_t rOut = 245;
+  Double_t xyz[3];
+  aodTrack->GetXYZ(xyz);
+  Double_t reach = rOut + TMath::Sqrt(xyz[0] * xyz[0] + xyz[1] * xyz[1]);
+  Double_t radius = aodTrack->Pt() / (0.000299792458 * TMath::Abs(fMagField));
+  if (2 * radius <= reach)
+    return kFALSE;
+  Double_t arc = 2 * radius * TMath::ASin(0.5 * reach / radius);
+  Double_t tgl = aodTrack->Pz() / aodTrack->Pt();
+  if (TMath::Abs(xyz[2]) + TMath::Abs(tgl) * arc >= fDeltaZ)
+    return kFALSE;
+
+  if (fLengthTable.empty() || fTableMagField != fMagField)
+    BuildLengthTable();
+
+  const Double_t sectorWidth = TMath::Pi() / 9;
+  Double_t phiLocal = TMath::Max(0., aodTrack->Phi() - TMath::Floor(aodTrack->Phi() / sectorWidth) * sectorWidth);
+  Int_t iphi = TMath::Min(Int_t(phiLocal / sectorWidth * fTableNPhi), fTableNPhi - 1);
+  Int_t iq = TMath::Min(Int_t((invPt + fTableMaxInvPt) / (2 * fTableMaxInvPt) * fTableNInvPt), fTableNInvPt - 1);
+  length = fLengthTable[iq * fTableNPhi + iphi];
+  return kTRUE;
+}
\ No newline at end of file
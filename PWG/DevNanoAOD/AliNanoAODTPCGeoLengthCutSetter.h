@@ -1,6 +1,8 @@
 #ifndef AliNanoAODTPCGeoLengthCutSetter_h
 #define AliNanoAODTPCGeoLengthCutSetter_h
 
+#include <vector>
+
 #include "AliAODEvent.h"
 #include "AliAODTrack.h"
 #include "AliNanoAODCustomSetter.h"
@@ -18,6 +20,19 @@ class AliNanoAODTPCGeoLengthCutSetter : public AliNanoAODCustomSetter {
   virtual void SetNanoAODTrack(const AliAODTrack* aodTrack,
                                AliNanoAODTrack* spTrack);
 
+  // Tabulates the length in the active zone in bins of the local phi in the
+  // sector and of q/pt, once per magnetic field value. Tracks reaching the z
+  // limit of the active zone and tracks outside the q/pt range are computed
+  // exactly. The result is exact up to the bin width.
+  void SetUseLengthTable(Bool_t use, Int_t nPhiBins = 180,
+                         Int_t nInvPtBins = 1000, Double_t maxInvPt = 10.) {
+    fUseLengthTable = use;
+    fTableNPhi = nPhiBins;
+    fTableNInvPt = nInvPtBins;
+    fTableMaxInvPt = maxInvPt;
+    fLengthTable.clear();
+  }
+
   int fMode;
   Double_t fDeltaY;
   Double_t fDeltaZ;
@@ -28,10 +43,20 @@ class AliNanoAODTPCGeoLengthCutSetter : public AliNanoAODCustomSetter {
   Double_t fCutGeoNcrNclFractionNcl;
 
  protected:
+  void BuildLengthTable();
+  Bool_t GetTableLength(const AliAODTrack* aodTrack, Double_t& length);
+
   bool fGoodToGo;
   int fIndex;
 
-  ClassDef(AliNanoAODTPCGeoLengthCutSetter, 1)
+  Bool_t fUseLengthTable;    // use the tabulated length in the active zone
+  Int_t fTableNPhi;          // number of local phi bins of the table
+  Int_t fTableNInvPt;        // number of q/pt bins of the table
+  Double_t fTableMaxInvPt;   // q/pt range of the table (-max, max)
+  std::vector<Float_t> fLengthTable;  //! length by (q/pt bin, phi bin)
+  Double_t fTableMagField;   //! magnetic field the table was built for
+
+  ClassDef(AliNanoAODTPCGeoLengthCutSetter, 2)
 };
 
 #endif /* AliNanoAODTPCGeoLengthCutSetter_h */
@@ -0,0 +1,145 @@
+/**************************************************************************
+ * Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+
+//-------------------------------------------------------------------------
+//     Columnar storage of the nanoAOD track variables, see the header
+//-------------------------------------------------------------------------
+
+#include <TList.h>
+#include <TTree.h>
+#include "AliLog.h"
+#include "AliVEvent.h"
+#include "AliAnalysisManager.h"
+
+#include "AliNanoAODTrackColumn.h"
+
+ClassImp(AliNanoAODTrackColumn)
+
+//______________________________________________________________________________
+AliNanoAODTrackColumn::AliNanoAODTrackColumn() :
+  TNamed(),
+  fIsInt(kFALSE),
+  fVarIndex(-1),
+  fFloat(),
+  fInt()
+{
+  // default constructor
+}
+
+//______________________________________________________________________________
+AliNanoAODTrackColumn::AliNanoAODTrackColumn(const char* name, Bool_t isInt, Int_t varIndex) :
+  TNamed(name, name),
+  fIsInt(isInt),
+  fVarIndex(varIndex),
+  fFloat(),
+  fInt()
+{
+  // constructor
+}
+
+//______________________________________________________________________________
+void AliNanoAODTrackColumn::Clear(Option_t* /*opt*/)
+{
+  // removes the values of the previous event, keeping the allocated memory
+  fFloat.clear();
+  fInt.clear();
+}
+
+//______________________________________________________________________________
+void AliNanoAODTrackColumn::Fill(const AliNanoAODTrack* track)
+{
+  // appends the value of the track
+  if (fVarIndex == kLabel)
+    fInt.push_back(track->GetLabel());
+  else if (fVarIndex == kNanoFlags)
+    fInt.push_back(track->GetNanoFlags());
+  else if (fIsInt)
+    fInt.push_back(track->GetVarInt(fVarIndex));
+  else
+    fFloat.push_back(track->GetVar(fVarIndex));
+}
+
+//______________________________________________________________________________
+AliNanoAODTrackColumnView::AliNanoAODTrackColumnView(const char* prefix) :
+  fPrefix(prefix),
+  fVars(),
+  fColumns(),
+  fList(0),
+  fTreeNumber(-1),
+  fNTracks(0),
+  fPt(-1),
+  fPhi(-1),
+  fTheta(-1),
+  fLabel(-1),
+  fFlags(-1)
+{
+  // constructor
+  fPt = AddColumn("pt");
+  fPhi = AddColumn("phi");
+  fTheta = AddColumn("theta");
+  fLabel = AddColumn("label");
+  fFlags = AddColumn("flags");
+}
+
+//______________________________________________________________________________
+Int_t AliNanoAODTrackColumnView::AddColumn(const char* var)
+{
+  // requests the column of a variable, returns its index in the view
+  for (UInt_t i = 0; i < fVars.size(); i++)
+    if (fVars[i] == var)
+      return i;
+  fVars.push_back(var);
+  fColumns.push_back(0);
+  fList = 0; // resolve again in the next Connect
+  return fVars.size() - 1;
+}
+
+//______________________________________________________________________________
+Bool_t AliNanoAODTrackColumnView::Connect(const AliVEvent* event)
+{
+  // resolves the columns if the input file changed and reads the number of tracks
+  // returns kFALSE if the event does not contain columnar tracks
+  fNTracks = 0;
+  if (!event || !event->GetList())
+    return kFALSE;
+
+  Int_t treeNumber = -1;
+  AliAnalysisManager* mgr = AliAnalysisManager::GetAnalysisManager();
+  if (mgr && mgr->GetTree())
+    treeNumber = mgr->GetTree()->GetTreeNumber();
+
+  if (event->GetList() != fList || treeNumber != fTreeNumber) {
+    fList = event->GetList();
+    fTreeNumber = treeNumber;
+    for (UInt_t i = 0; i < fVars.size(); i++)
+      fColumns[i] = dynamic_cast<AliNanoAODTrackColumn*>(fList->FindObject(AliNanoAODTrackColumn::GetColumnName(fPrefix, fVars[i])));
+  }
+
+  Bool_t found = kFALSE;
+  for (UInt_t i = 0; i < fColumns.size(); i++) {
+    if (!fColumns[i])
+      continue;
+    if (!found) {
+      fNTracks = fColumns[i]->GetEntries();
+      found = kTRUE;
+    } else if (fColumns[i]->GetEntries() != fNTracks) {
+      AliErrorClass(Form("Column %s has %d entries instead of %d", fColumns[i]->GetName(), fColumns[i]->GetEntries(), fNTracks));
+      fNTracks = 0;
+      return kFALSE;
+    }
+  }
+  return found;
+}
@@ -0,0 +1,104 @@
+#ifndef AliNanoAODTrackColumn_H
+#define AliNanoAODTrackColumn_H
+/* Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+
+//-------------------------------------------------------------------------
+//     Columnar storage of the nanoAOD track variables
+//     With AliNanoAODReplicator::SetColumnarTracks each variable of the
+//     track variable list (and the MC label and the nano flags) is written
+//     in its own branch "<prefix>_<variable>" holding the values of all the
+//     tracks of the event. A consumer reading only some variables can
+//     disable the other branches (AliInputEventHandler::SetInactiveBranches)
+//     and accesses the values with AliNanoAODTrackColumnView, which resolves
+//     the columns once per input file.
+//-------------------------------------------------------------------------
+
+#include <vector>
+
+#include <TMath.h>
+#include <TNamed.h>
+#include <TString.h>
+#include "AliNanoAODTrack.h"
+
+class AliVEvent;
+class TList;
+
+class AliNanoAODTrackColumn : public TNamed {
+
+public:
+  enum { kLabel = -2, kNanoFlags = -3 }; // variable index of the label and nano flags columns
+
+  AliNanoAODTrackColumn();
+  AliNanoAODTrackColumn(const char* name, Bool_t isInt, Int_t varIndex);
+  virtual ~AliNanoAODTrackColumn() {}
+
+  virtual void Clear(Option_t* opt = "");
+
+  void    Fill(const AliNanoAODTrack* track);
+  Int_t   GetEntries() const { return fIsInt ? fInt.size() : fFloat.size(); }
+  Bool_t  IsInt() const { return fIsInt; }
+  Int_t   GetVarIndex() const { return fVarIndex; }
+  Float_t GetValue(Int_t i) const { return fIsInt ? fInt[i] : fFloat[i]; }
+  Int_t   GetValueInt(Int_t i) const { return fIsInt ? fInt[i] : Int_t(fFloat[i]); }
+  const Float_t* GetFloatArray() const { return fFloat.empty() ? 0 : &fFloat[0]; }
+  const Int_t*   GetIntArray() const { return fInt.empty() ? 0 : &fInt[0]; }
+
+  static TString GetColumnName(const char* prefix, const char* var) { return TString::Format("%s_%s", prefix, var); }
+
+private:
+  Bool_t               fIsInt;    // integer column
+  Int_t                fVarIndex; //! index of the variable in the track storage (writer side)
+  std::vector<Float_t> fFloat;    // values of the tracks (floating point variables)
+  std::vector<Int_t>   fInt;      // values of the tracks (integer variables, label, flags)
+
+  ClassDef(AliNanoAODTrackColumn, 1); // Columnar storage of one nanoAOD track variable
+};
+
+//-------------------------------------------------------------------------
+//     Read access to the columnar nanoAOD tracks. The columns are requested
+//     by variable name with AddColumn, which returns the index to be used
+//     with the getters; the indices do not change from file to file.
+//     Connect has to be called in each event and looks up the column
+//     branches only when the input file changes.
+//-------------------------------------------------------------------------
+class AliNanoAODTrackColumnView {
+
+public:
+  AliNanoAODTrackColumnView(const char* prefix = "trackcol");
+  virtual ~AliNanoAODTrackColumnView() {}
+
+  Int_t  AddColumn(const char* var);
+  Bool_t Connect(const AliVEvent* event);
+  Bool_t HasColumn(Int_t column) const { return column >= 0 && column < (Int_t) fColumns.size() && fColumns[column]; }
+
+  Int_t   GetNTracks() const { return fNTracks; }
+  Float_t GetVar(Int_t column, Int_t track) const { return fColumns[column]->GetValue(track); }
+  Int_t   GetVarInt(Int_t column, Int_t track) const { return fColumns[column]->GetValueInt(track); }
+  const AliNanoAODTrackColumn* GetColumn(Int_t column) const { return HasColumn(column) ? fColumns[column] : 0; }
+
+  // frequently used variables, -999 if the column is not stored
+  Float_t Pt(Int_t track) const    { return HasColumn(fPt) ? GetVar(fPt, track) : -999.; }
+  Float_t Phi(Int_t track) const   { return HasColumn(fPhi) ? GetVar(fPhi, track) : -999.; }
+  Float_t Theta(Int_t track) const { return HasColumn(fTheta) ? GetVar(fTheta, track) : -999.; }
+  Float_t Eta(Int_t track) const   { return HasColumn(fTheta) ? -TMath::Log(TMath::Tan(0.5 * GetVar(fTheta, track))) : -999.; }
+  Int_t   GetLabel(Int_t track) const { return HasColumn(fLabel) ? GetVarInt(fLabel, track) : -999; }
+  Short_t Charge(Int_t track) const { return HasColumn(fFlags) ? (TESTBIT(GetVarInt(fFlags, track), AliNanoAODTrack::kNanoCharge) ? 1 : -1) : 0; }
+  Bool_t  TestNanoFlag(Int_t track, Int_t bit) const { return HasColumn(fFlags) && TESTBIT(GetVarInt(fFlags, track), bit); }
+
+private:
+  TString                       fPrefix;   // prefix of the column branches
+  std::vector<TString>          fVars;     // requested variables
+  std::vector<AliNanoAODTrackColumn*> fColumns; // columns of the requested variables in the current file, 0 if missing
+  const TList*                  fList;     // event object list for which the columns were resolved
+  Int_t                         fTreeNumber; // input tree number for which the columns were resolved
+  Int_t                         fNTracks;  // number of tracks in the current event
+  Int_t                         fPt;       // column index of pt
+  Int_t                         fPhi;      // column index of phi
+  Int_t                         fTheta;    // column index of theta
+  Int_t                         fLabel;    // column index of the label
+  Int_t                         fFlags;    // column index of the nano flags
+};
+
+#endif
@@ -6,6 +6,7 @@
 #pragma link C++ class AliNanoAODReplicator+;
 #pragma link C++ class AliAnalysisTaskNanoAODFilter+;
 #pragma link C++ class AliNanoAODTrack+;
+#pragma link C++ class AliNanoAODTrackColumn+;
 #pragma link C++ class AliNanoAODCustomSetter+;
 #pragma link C++ class AliAnalysisNanoAODTrackCuts+;
 #pragma link C++ class AliAnalysisNanoAODV0Cuts+;
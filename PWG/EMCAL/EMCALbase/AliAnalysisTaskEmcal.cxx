@@ -51,6 +51,7 @@
 #include "AliEmcalMCPartonInfo.h"
 #include "AliEmcalPythiaFileHandler.h"
 #include "AliEmcalPythiaInfo.h"
+#include "AliEmcalTaskInstrumentation.h"
 #include "AliEMCALTriggerPatchInfo.h"
 #include "AliESDEvent.h"
 #include "AliAODInputHandler.h"
@@ -76,6 +77,7 @@
 #include "AliAnalysisTaskEmcalEmbeddingHelper.h"
 
 Double_t AliAnalysisTaskEmcal::fgkEMCalDCalPhiDivide = 4.;
+Bool_t AliAnalysisTaskEmcal::fgInstrumentation = kFALSE;
 
 ClassImp(AliAnalysisTaskEmcal);
 
@@ -193,7 +195,8 @@ AliAnalysisTaskEmcal::AliAnalysisTaskEmcal() :
   fHistEventPlane(nullptr),
   fHistEventRejection(nullptr),
   fHistTriggerClasses(nullptr),
-  fHistTriggerClassesCorr(nullptr)
+  fHistTriggerClassesCorr(nullptr),
+  fTaskInstrumentation(nullptr)
 {
   fVertex[0] = 0;
   fVertex[1] = 0;
@@ -320,7 +323,8 @@ AliAnalysisTaskEmcal::AliAnalysisTaskEmcal(const char *name, Bool_t histo) :
   fHistEventPlane(nullptr),
   fHistEventRejection(nullptr),
   fHistTriggerClasses(nullptr),
-  fHistTriggerClassesCorr(nullptr)
+  fHistTriggerClassesCorr(nullptr),
+  fTaskInstrumentation(nullptr)
 {
   fVertex[0] = 0;
   fVertex[1] = 0;
@@ -412,6 +416,11 @@ void AliAnalysisTaskEmcal::UserCreateOutputObjects()
   fOutput->SetUseScaling(fUsePtHardBinScaling);
   fOutput->SetOwner();
 
+  if (fgInstrumentation) {
+    fTaskInstrumentation = new PWG::EMCAL::AliEmcalTaskInstrumentation("fTaskInstrumentation");
+    fOutput->Add(fTaskInstrumentation);
+  }
+
   if (fForceBeamType == kpp)
     fNcentBins = 1;
 
@@ -657,7 +666,13 @@ void AliAnalysisTaskEmcal::UserExec(Option_t *option)
     fFileChanged = kFALSE;
   }
 
-  if (!RetrieveEventObjects())
+  // Timing of the full event, stopped on every return path (no-op without instrumentation)
+  PWG::EMCAL::AliEmcalTaskInstrumentation::StepGuard eventTiming(fTaskInstrumentation, PWG::EMCAL::AliEmcalTaskInstrumentation::kEvent);
+
+  if (fTaskInstrumentation) fTaskInstrumentation->Start(PWG::EMCAL::AliEmcalTaskInstrumentation::kRetrieveEventObjects);
+  Bool_t retrieved = RetrieveEventObjects();
+  if (fTaskInstrumentation) fTaskInstrumentation->Stop(PWG::EMCAL::AliEmcalTaskInstrumentation::kRetrieveEventObjects);
+  if (!retrieved)
     return;
 
   if(InputEvent()->GetRunNumber() != fRunNumber){
@@ -726,11 +741,17 @@ void AliAnalysisTaskEmcal::UserExec(Option_t *option)
       return;
   }
 
-  if (!Run())
+  if (fTaskInstrumentation) fTaskInstrumentation->Start(PWG::EMCAL::AliEmcalTaskInstrumentation::kRun);
+  Bool_t runSuccess = Run();
+  if (fTaskInstrumentation) fTaskInstrumentation->Stop(PWG::EMCAL::AliEmcalTaskInstrumentation::kRun);
+  if (!runSuccess)
     return;
 
   if (fCreateHisto) {
-    if (!FillHistograms())
+    if (fTaskInstrumentation) fTaskInstrumentation->Start(PWG::EMCAL::AliEmcalTaskInstrumentation::kFillHistograms);
+    Bool_t fillSuccess = FillHistograms();
+    if (fTaskInstrumentation) fTaskInstrumentation->Stop(PWG::EMCAL::AliEmcalTaskInstrumentation::kFillHistograms);
+    if (!fillSuccess)
       return;
   }
 
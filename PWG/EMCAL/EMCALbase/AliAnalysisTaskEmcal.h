@@ -66,6 +66,7 @@ namespace PWG {
   namespace EMCAL {
 
     class AliEmcalMCPartonInfo;
+    class AliEmcalTaskInstrumentation;
   
   }
 }
@@ -516,6 +517,25 @@ class AliAnalysisTaskEmcal : public AliAnalysisTaskSE {
    */
   void                        SetMakeGeneralHistograms(Bool_t g)                    { fGeneralHistograms = g                              ; }
 
+  /**
+   * @brief Switch on/off the timing and memory instrumentation of the processing steps
+   *
+   * Applies to all tasks creating their output objects afterwards. The instrumented tasks
+   * add a PWG::EMCAL::AliEmcalTaskInstrumentation object (fTaskInstrumentation) to their
+   * output list, with the per-task cumulative CPU/wall time, resident memory growth and
+   * latency histograms of RetrieveEventObjects, Run, FillHistograms and of the full event.
+   * Requires the output list (fCreateHisto).
+   *
+   * @param instrument If true the processing steps are instrumented
+   */
+  static void                 SetInstrumentation(Bool_t instrument)                 { fgInstrumentation = instrument                      ; }
+
+  /**
+   * @brief Check whether the processing steps of newly created tasks are instrumented
+   * @return True if the instrumentation is switched on
+   */
+  static Bool_t               IsInstrumentation()                                   { return fgInstrumentation                            ; }
+
   /**
    * @brief Switch on/off getting \f$ p_{t,hard}\f$ bin from the file path.
    *
@@ -1352,6 +1372,7 @@ class AliAnalysisTaskEmcal : public AliAnalysisTaskSE {
   static Double_t             GetParallelFraction(const TVector3& vect1, AliVParticle* part2);
 
   static Double_t             fgkEMCalDCalPhiDivide;       ///<  phi value used to distinguish between DCal and EMCal
+  static Bool_t               fgInstrumentation;           ///<  instrument the processing steps of the tasks (see SetInstrumentation)
 
   // Task configuration
   TString                     fPythiaInfoName;             ///< name of pythia info object
@@ -1473,6 +1494,7 @@ class AliAnalysisTaskEmcal : public AliAnalysisTaskSE {
   TH1                        *fHistEventRejection;         //!<! book keep reasons for rejecting event
   TH1                        *fHistTriggerClasses;         //!<! number of events in each trigger class
   TH1                        *fHistTriggerClassesCorr;     //!<! corrected number of events in each trigger class
+  PWG::EMCAL::AliEmcalTaskInstrumentation *fTaskInstrumentation; //!<! timing and memory of the processing steps (see SetInstrumentation)
 
  private:
   AliAnalysisTaskEmcal(const AliAnalysisTaskEmcal&);            // not implemented
@@ -21,11 +21,16 @@
 #include <fstream>
 #include <iostream>
 #include <bitset>
+#include <future>
+#include <map>
+#include <set>
 
 #include <TFile.h>
 #include <TMath.h>
 #include <TRandom.h>
 #include <TChain.h>
+#include <TChainElement.h>
+#include <TROOT.h>
 #include <TGrid.h>
 #include <TGridResult.h>
 #include <TSystem.h>
@@ -49,6 +54,7 @@
 #include <AliGenPythiaEventHeader.h>
 
 #include "AliYAMLConfiguration.h"
+#include "AliInputTreeCache.h"
 #include "AliEmcalList.h"
 #include "AliEmcalContainerUtils.h"
 
@@ -58,6 +64,18 @@
 ClassImp(AliAnalysisTaskEmcalEmbeddingHelper);
 /// \endcond
 
+/**
+ * \struct AliAnalysisTaskEmcalEmbeddingHelper::PrefetchState
+ * \brief Bookkeeping of the files of the chain which are opened or staged ahead of time
+ */
+struct AliAnalysisTaskEmcalEmbeddingHelper::PrefetchState {
+  std::vector<std::string> fRemoteNames;                  ///< Original names of the files in the chain (by chain index)
+  std::set<UInt_t> fAsyncOpened;                          ///< Chain indices with a pending asynchronous open
+  std::map<UInt_t, std::future<std::string>> fStaging;    ///< Chain index -> local copy (empty string if the copy failed)
+  UInt_t fStagedIndex = 0;                                ///< Chain index of the staged file which is currently read
+  std::string fStagedFile;                                ///< Local copy which is currently read
+};
+
 /**
  * Helper function to connect to AliEn (so the code doesn't need to be duplicated).
  */
@@ -173,7 +191,12 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper() :
   fPythiaCrossSectionFromFile(0.),
   fPythiaPtHard(0.),
   fPrintTimingInfoToLog(false),
-  fTimer()
+  fTimer(),
+  fNPrefetchFiles(0),
+  fTreeCacheSize(0),
+  fStageFilesLocally(false),
+  fStagingDirectory(""),
+  fPrefetchState(nullptr)
 {
   if (fgInstance != nullptr) {
     AliError("An instance of AliAnalysisTaskEmcalEmbeddingHelper already exists: it will be deleted!!!");
@@ -250,7 +273,12 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper(const c
   fPythiaCrossSectionFromFile(0.),
   fPythiaPtHard(0.),
   fPrintTimingInfoToLog(false),
-  fTimer()
+  fTimer(),
+  fNPrefetchFiles(0),
+  fTreeCacheSize(0),
+  fStageFilesLocally(false),
+  fStagingDirectory(""),
+  fPrefetchState(nullptr)
 {
   if (fgInstance != 0) {
     AliError("An instance of AliAnalysisTaskEmcalEmbeddingHelper already exists: it will be deleted!!!");
@@ -278,6 +306,15 @@ AliAnalysisTaskEmcalEmbeddingHelper::~AliAnalysisTaskEmcalEmbeddingHelper()
     fExternalFile->Close();
     delete fExternalFile;
   }
+  if (fPrefetchState) {
+    // Wait for pending copies so that no staged file is left behind
+    for (auto & staging : fPrefetchState->fStaging) {
+      std::string localName = staging.second.get();
+      if (localName != "") gSystem->Unlink(localName.c_str());
+    }
+    if (fPrefetchState->fStagedFile != "") gSystem->Unlink(fPrefetchState->fStagedFile.c_str());
+    delete fPrefetchState;
+  }
 }
 
 bool AliAnalysisTaskEmcalEmbeddingHelper::Initialize(bool removeDummyTask)
@@ -336,6 +373,10 @@ void AliAnalysisTaskEmcalEmbeddingHelper::RetrieveTaskPropertiesFromYAMLConfig()
   res = fYAMLConfig.GetProperty("randomFileAccess", fRandomFileAccess, false);
   res = fYAMLConfig.GetProperty("createHisto", fCreateHisto, false);
   res = fYAMLConfig.GetProperty("printTimingInfoInLog", fPrintTimingInfoToLog, false);
+  res = fYAMLConfig.GetProperty("nPrefetchFiles", fNPrefetchFiles, false);
+  res = fYAMLConfig.GetProperty("treeCacheSize", fTreeCacheSize, false);
+  res = fYAMLConfig.GetProperty("stageFilesLocally", fStageFilesLocally, false);
+  res = fYAMLConfig.GetProperty("stagingDirectory", fStagingDirectory, false);
   // More general embedding helper properties
   res = fYAMLConfig.GetProperty("filePattern", fFilePattern, false);
   res = fYAMLConfig.GetProperty("inputFilename", fInputFilename, false);
@@ -951,6 +992,7 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
       fChain->GetEntry(fCurrentEntry);
     }
     AliDebug(4, TString::Format("Loading entry %i between %i-%i, starting with offset %i from the lower bound of %i", fCurrentEntry, fLowerEntry, fUpperEntry, fOffset, fLowerEntry));
+    AliInputTreeCache::Instance()->CountEvent(fTreeName);
 
     // Set relevant event properties
     SetEmbeddedEventProperties();
@@ -1427,9 +1469,139 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::SetupInputFiles()
   Bool_t res = InitEvent();
   if (!res) return kFALSE;
 
+  // The random entry point into each file leads to scattered reads, so the cache learns
+  // the used branches on the first entries and then reads them in large blocks. Branches
+  // registered for the tree by the tasks in AliInputTreeCache are cached from the first entry.
+  AliInputTreeCache::Instance()->ConfigureTree(fChain, fTreeName, fTreeCacheSize);
+
+  SetupPrefetching();
+
   return kTRUE;
 }
 
+/**
+ * Setup the opening (or local staging) of the upcoming files of the chain ahead of time.
+ * The first file is opened when the event is connected to the chain, so prefetching starts
+ * with the second file.
+ */
+void AliAnalysisTaskEmcalEmbeddingHelper::SetupPrefetching()
+{
+  if (fNPrefetchFiles <= 0) return;
+
+  if (fPrefetchState) delete fPrefetchState;
+  fPrefetchState = new PrefetchState;
+  TIter next(fChain->GetListOfFiles());
+  TChainElement * element = nullptr;
+  while ((element = static_cast<TChainElement *>(next()))) {
+    fPrefetchState->fRemoteNames.push_back(element->GetTitle());
+  }
+
+  if (fStageFilesLocally) {
+    // The copies are done with ROOT I/O in a background thread
+    ROOT::EnableThreadSafety();
+    if (fStagingDirectory == "") fStagingDirectory = gSystem->TempDirectory();
+    AliInfoStream() << "Staging up to " << fNPrefetchFiles << " upcoming files to " << fStagingDirectory << "\n";
+  }
+  else {
+    AliInfoStream() << "Opening up to " << fNPrefetchFiles << " upcoming files ahead of time\n";
+  }
+
+  PrefetchUpcomingFiles(1);
+}
+
+/**
+ * Start opening (or copying to local disk) the files of the chain following the given one.
+ * Files which are already being prefetched are skipped.
+ *
+ * @param[in] firstFile Chain index of the first file to be prefetched
+ */
+void AliAnalysisTaskEmcalEmbeddingHelper::PrefetchUpcomingFiles(UInt_t firstFile)
+{
+  if (!fPrefetchState) return;
+
+  for (UInt_t fileIndex = firstFile; fileIndex < firstFile + fNPrefetchFiles && fileIndex < fPrefetchState->fRemoteNames.size(); fileIndex++)
+  {
+    const std::string & remoteName = fPrefetchState->fRemoteNames.at(fileIndex);
+    if (!fStageFilesLocally) {
+      // TChain completes the pending request when it opens the file
+      if (fPrefetchState->fAsyncOpened.insert(fileIndex).second) {
+        AliDebugStream(2) << "Opening file " << remoteName << " asynchronously.\n";
+        TFile::AsyncOpen(remoteName.c_str());
+      }
+      continue;
+    }
+    if (fPrefetchState->fStaging.count(fileIndex)) continue;
+
+    // Archives are copied as a whole, the member is selected again when the file is read
+    std::string archiveName = remoteName;
+    std::string member = "";
+    std::size_t pos = archiveName.find(".zip#");
+    if (pos != std::string::npos) {
+      member = archiveName.substr(pos + 4);
+      archiveName.erase(pos + 4);
+    }
+    std::string localName = TString::Format("%s/embedding_%d_%u_%s", fStagingDirectory.c_str(), gSystem->GetPid(), fileIndex, gSystem->BaseName(archiveName.c_str())).Data();
+
+    AliDebugStream(2) << "Staging file " << archiveName << " to " << localName << ".\n";
+    fPrefetchState->fStaging[fileIndex] = std::async(std::launch::async, [archiveName, localName, member]() {
+      if (!TFile::Cp(archiveName.c_str(), localName.c_str(), kFALSE)) {
+        gSystem->Unlink(localName.c_str());
+        return std::string("");
+      }
+      return localName + member;
+    });
+  }
+}
+
+/**
+ * Switch the chain to the local copy of the given file if it has been staged, remove the
+ * previously read copy, and prefetch the files following it. Must be called before the chain
+ * loads the file.
+ *
+ * @param[in] fileIndex Chain index of the file which is about to be read
+ */
+void AliAnalysisTaskEmcalEmbeddingHelper::UsePrefetchedFile(UInt_t fileIndex)
+{
+  if (!fPrefetchState) return;
+
+  ReleaseStagedFile();
+  fPrefetchState->fAsyncOpened.erase(fileIndex);
+
+  auto staging = fPrefetchState->fStaging.find(fileIndex);
+  if (staging != fPrefetchState->fStaging.end()) {
+    std::string localName = staging->second.get();
+    fPrefetchState->fStaging.erase(staging);
+    if (localName != "") {
+      AliDebugStream(2) << "Reading staged file " << localName << ".\n";
+      static_cast<TChainElement *>(fChain->GetListOfFiles()->At(fileIndex))->SetTitle(localName.c_str());
+      fPrefetchState->fStagedIndex = fileIndex;
+      fPrefetchState->fStagedFile = localName;
+    }
+    else {
+      AliWarningStream() << "Staging of file " << fPrefetchState->fRemoteNames.at(fileIndex) << " failed, reading it remotely.\n";
+    }
+  }
+
+  PrefetchUpcomingFiles(fileIndex + 1);
+}
+
+/**
+ * Remove the local copy of the file which was read last and point the chain back to the
+ * original file, in case the chain is read again from the beginning.
+ */
+void AliAnalysisTaskEmcalEmbeddingHelper::ReleaseStagedFile()
+{
+  if (!fPrefetchState || fPrefetchState->fStagedFile == "") return;
+
+  UInt_t fileIndex = fPrefetchState->fStagedIndex;
+  static_cast<TChainElement *>(fChain->GetListOfFiles()->At(fileIndex))->SetTitle(fPrefetchState->fRemoteNames.at(fileIndex).c_str());
+  std::string localName = fPrefetchState->fStagedFile;
+  std::size_t pos = localName.find(".zip#");
+  if (pos != std::string::npos) localName.erase(pos + 4);
+  gSystem->Unlink(localName.c_str());
+  fPrefetchState->fStagedFile = "";
+}
+
 /**
  * Check if the file pythia base filename can be found in the folder or archive corresponding where
  * the external event input file is found.
@@ -1536,6 +1708,9 @@ void AliAnalysisTaskEmcalEmbeddingHelper::InitTree()
     std::cout << "InitTree() has started for file " << (fFilenameIndex + fFileNumber + 1) % fMaxNumberOfFiles << fChain->GetCurrentFile()->GetName() << "..." << std::endl;
   }
   
+  // Switch to the prefetched copy of the next file (if available) before it gets loaded
+  UsePrefetchedFile(fUpperEntry == 0 ? 0 : fFileNumber + 1);
+
   // Load first entry of the (next) file so that we can query information about it
   // (it is inaccessible otherwise).
   // Since fUpperEntry is the total number of entries, loading it will retrieve the
@@ -1861,6 +2036,10 @@ void AliAnalysisTaskEmcalEmbeddingHelper::ValidatePhysicsSelectionForInternalEve
  */
 void AliAnalysisTaskEmcalEmbeddingHelper::Terminate(Option_t*)
 {
+  // Bytes read per embedded entry (only available in the process which read the entries)
+  if (AliInputTreeCache::Instance()->HasRegisteredBranches(fTreeName) || fTreeCacheSize > 0) {
+    AliInputTreeCache::Instance()->Print(fTreeName);
+  }
 }
 
 /**
@@ -2007,6 +2186,9 @@ std::string AliAnalysisTaskEmcalEmbeddingHelper::toString(bool includeFileList)
   tempSS << "File list filename: \"" << fFileListFilename << "\"\n";
   tempSS << "Tree name: " << fTreeName << "\n";
   tempSS << "Print timing info to log: " << fPrintTimingInfoToLog << "\n";
+  tempSS << "Number of prefetched files: " << fNPrefetchFiles << "\n";
+  tempSS << "Tree cache size: " << fTreeCacheSize << "\n";
+  tempSS << "Stage files locally: " << fStageFilesLocally << " (directory: \"" << fStagingDirectory << "\")\n";
   tempSS << "Random event number access: " << fRandomEventNumberAccess << "\n";
   tempSS << "Random file access: " << fRandomFileAccess << "\n";
   tempSS << "Starting file index: " << fFilenameIndex << "\n";
@@ -136,6 +136,16 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   void SetAOD(const char * treeName = "aodTree")                  { fTreeName     = treeName; }
   /// Set whether to print and plot execution time of InitTree()
   void SetPrintTimingInfoToLog(bool b)                            { fPrintTimingInfoToLog = b;}
+  /**
+   * Open the next n files of the chain ahead of time (asynchronously), so that switching to
+   * the next file does not block on the remote open. If local staging is enabled, the files
+   * are instead copied to local disk in a background thread.
+   */
+  void SetNumberOfPrefetchedFiles(Int_t n)                        { fNPrefetchFiles = n; }
+  /// Set the size (in bytes) of the TTreeCache of the external event chain. 0 keeps the ROOT default.
+  void SetTreeCacheSize(Long64_t size)                            { fTreeCacheSize = size; }
+  /// Copy upcoming files to a local directory before they are read (requires prefetched files > 0)
+  void SetStageFilesLocally(bool b, const char * dir = "")        { fStageFilesLocally = b; fStagingDirectory = dir; }
   /**
    * Enable to begin embedding at a random entry in each embedded file. Will then loop around in order
    * so that all entries are made available.
@@ -308,6 +318,10 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   virtual Bool_t  CheckIsEmbeddedEventSelected();
   Bool_t          InitEvent()           ;
   void            InitTree()            ;
+  void            SetupPrefetching()    ;
+  void            UsePrefetchedFile(UInt_t fileIndex);
+  void            PrefetchUpcomingFiles(UInt_t firstFile);
+  void            ReleaseStagedFile()   ;
   bool            PythiaInfoFromCrossSectionFile(std::string filename);
   // Validation helper
   void            ValidatePhysicsSelectionForInternalEventSelection();
@@ -387,6 +401,13 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   bool                                          fPrintTimingInfoToLog; ///< Flag to print time to execute InitTree(), for logging purposes
   TStopwatch                                    fTimer            ;    //!<! Timer for the InitTree() function
 
+  struct PrefetchState;
+  Int_t                                         fNPrefetchFiles   ; ///< Number of upcoming files which are opened (or staged) ahead of time
+  Long64_t                                      fTreeCacheSize    ; ///< Size of the TTreeCache of the external event chain (0: ROOT default)
+  bool                                          fStageFilesLocally; ///< If true, upcoming files are copied to local disk in a background thread
+  std::string                                   fStagingDirectory ; ///< Directory for the staged files (temp directory if empty)
+  PrefetchState                                *fPrefetchState    ; //!<! Pending asynchronous opens and local copies of upcoming files
+
   static AliAnalysisTaskEmcalEmbeddingHelper   *fgInstance        ; //!<! Global instance of this class
 
  private:
@@ -394,7 +415,7 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   AliAnalysisTaskEmcalEmbeddingHelper &operator=(const AliAnalysisTaskEmcalEmbeddingHelper&); // not implemented
 
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisTaskEmcalEmbeddingHelper, 14);
+  ClassDef(AliAnalysisTaskEmcalEmbeddingHelper, 15);
   /// \endcond
 };
 #endif
@@ -166,6 +166,12 @@ AliVCluster* AliClusterContainer::GetAcceptClusterWithLabel(Int_t lab) const
   return GetAcceptCluster(i);
 }
 
+Int_t AliClusterContainer::GetLabelOfEntry(Int_t i) const
+{
+  const AliVCluster *clus = dynamic_cast<const AliVCluster *>(fClArray->At(i));
+  return clus ? clus->GetLabel() : -1;
+}
+
 AliVCluster* AliClusterContainer::GetNextAcceptCluster() 
 {
   const Int_t n = GetNEntries();
@@ -473,6 +479,16 @@ const char* AliClusterContainer::GetTitle() const
   return clusterString.Data();
 }
 
+TString AliClusterContainer::GetSelectionKey() const
+{
+  TString key = AliEmcalContainer::GetSelectionKey() + TString::Format(":%g:%g:%d:%d:%d:%d:%d:%g:%d:%g:%g:%g:%g:%d:%g",
+      fClusTimeCutLow, fClusTimeCutUp, fExoticCut, fDefaultClusterEnergy, fIncludePHOS, fIncludePHOSonly,
+      fPhosMinNcells, fPhosMinM02, fEmcalMinNcells, fEmcalMinM02, fEmcalMaxM02, fEmcalMaxM02CutEnergy,
+      fMaxFracEnergyLeadingCell, fSelectOneCellCluster, fEmcalMaxNCellEffCutEnergy);
+  for (Int_t i = 0; i <= AliVCluster::kLastUserDefEnergy; i++) key += TString::Format(":%g", fUserDefEnergyCut[i]);
+  return key;
+}
+
 TString AliClusterContainer::GetDefaultArrayName(const AliVEvent * const ev) const {
   if(ev->IsA() == AliAODEvent::Class()) return "caloClusters";
   else if(ev->IsA() == AliESDEvent::Class()) return "CaloClusters";
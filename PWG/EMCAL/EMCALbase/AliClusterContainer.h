@@ -78,6 +78,8 @@ class AliClusterContainer : public AliEmcalContainer {
    */
   virtual ~AliClusterContainer(){;}
 
+  virtual TString             GetSelectionKey() const;
+
   /**
    * @brief Access to cluster at a given index
    * @param index Index in the container
@@ -501,6 +503,12 @@ class AliClusterContainer : public AliEmcalContainer {
    */
   virtual TString             GetDefaultArrayName(const AliVEvent * const ev) const;
 
+  /**
+   * @brief Label of the cluster at a given index, used for the label hash map
+   * @param[in] i Index of the cluster
+   * @return Leading MC label of the cluster
+   */
+  virtual Int_t               GetLabelOfEntry(Int_t i) const;
 
 #if !(defined(__CINT__) || defined(__MAKECINT__))
   static AliEmcalContainerIndexMap <TClonesArray, AliVCluster> fgEmcalContainerIndexMap; //!<! Mapping from containers to indices
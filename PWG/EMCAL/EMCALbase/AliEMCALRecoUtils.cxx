@@ -13,8 +13,12 @@
  * provided "as is" without express or implied warranty.                  *
  **************************************************************************/
 
+// std includes
+#include <algorithm>
+
 // ROOT includes
 #include <TH2F.h>
+#include <TVector2.h>
 #include <TArrayI.h>
 #include <TArrayF.h>
 #include <TObjArray.h>
@@ -81,6 +85,9 @@ AliEMCALRecoUtils::AliEMCALRecoUtils():
   fStepSurface(0),                        fStepCluster(0),
   fITSTrackSA(kFALSE),                    fUseTrackDCA(kTRUE), // keep it active, but not working for old MC
   fUseOuterTrackParam(kFALSE),            fEMCalSurfaceDistance(440.),
+  fUseTrackPropagationCache(kFALSE),      fUseTrackHelixPreselection(kFALSE),
+  fTrackHelixEtaMargin(0.05),             fTrackHelixPhiMargin(10*TMath::DegToRad()),
+  fTrackPropagationCache(),               fTrackPropagationEvent(0),              fTrackPropagationEventID(0),
   fTrackCutsType(0),                      fCutMinTrackPt(0),                      fCutMinNClusterTPC(0),
   fCutMinNClusterITS(0),                  fCutMaxChi2PerClusterTPC(0),            fCutMaxChi2PerClusterITS(0),
   fCutRequireTPCRefit(kFALSE),            fCutRequireITSRefit(kFALSE),            fCutAcceptKinkDaughters(kFALSE),
@@ -152,6 +159,10 @@ AliEMCALRecoUtils::AliEMCALRecoUtils(const AliEMCALRecoUtils & reco)
   fMass(reco.fMass),        fStepSurface(reco.fStepSurface), fStepCluster(reco.fStepCluster),
   fITSTrackSA(reco.fITSTrackSA),                             fUseTrackDCA(reco.fUseTrackDCA),
   fUseOuterTrackParam(reco.fUseOuterTrackParam),             fEMCalSurfaceDistance(440.),
+  fUseTrackPropagationCache(reco.fUseTrackPropagationCache), fUseTrackHelixPreselection(reco.fUseTrackHelixPreselection),
+  fTrackHelixEtaMargin(reco.fTrackHelixEtaMargin),           fTrackHelixPhiMargin(reco.fTrackHelixPhiMargin),
+  fTrackPropagationCache(),                                  fTrackPropagationEvent(0),
+  fTrackPropagationEventID(0),
   fTrackCutsType(reco.fTrackCutsType),                       fCutMinTrackPt(reco.fCutMinTrackPt),
   fCutMinNClusterTPC(reco.fCutMinNClusterTPC),               fCutMinNClusterITS(reco.fCutMinNClusterITS),
   fCutMaxChi2PerClusterTPC(reco.fCutMaxChi2PerClusterTPC),   fCutMaxChi2PerClusterITS(reco.fCutMaxChi2PerClusterITS),
@@ -287,6 +298,11 @@ AliEMCALRecoUtils & AliEMCALRecoUtils::operator = (const AliEMCALRecoUtils & rec
   fUseTrackDCA               = reco.fUseTrackDCA;
   fUseOuterTrackParam        = reco.fUseOuterTrackParam;
   fEMCalSurfaceDistance      = reco.fEMCalSurfaceDistance;
+  fUseTrackPropagationCache  = reco.fUseTrackPropagationCache;
+  fUseTrackHelixPreselection = reco.fUseTrackHelixPreselection;
+  fTrackHelixEtaMargin       = reco.fTrackHelixEtaMargin;
+  fTrackHelixPhiMargin       = reco.fTrackHelixPhiMargin;
+  ResetTrackPropagationCache();
 
   fTrackCutsType             = reco.fTrackCutsType;
   fCutMinTrackPt             = reco.fCutMinTrackPt;
@@ -4101,6 +4117,8 @@ void AliEMCALRecoUtils::FindMatches(AliVEvent *event,
   AliESDEvent* esdevent = dynamic_cast<AliESDEvent*> (event);
   AliAODEvent* aodevent = dynamic_cast<AliAODEvent*> (event);
 
+  SetTrackPropagationEvent(event);
+
   // Init the magnetic field if not already on
   if (!TGeoGlobalMagField::Instance()->GetField())
   {
@@ -4261,9 +4279,10 @@ void AliEMCALRecoUtils::FindMatches(AliVEvent *event,
     }
 
     // Extrapolate the track to EMCal surface, see AliEMCALRecoUtilsBase
-    AliExternalTrackParam emcalParam(*trackParam);
+    AliExternalTrackParam emcalParam;
     Float_t eta, phi, pt;
-    if (!ExtrapolateTrackToEMCalSurface(&emcalParam, fEMCalSurfaceDistance, fMass, fStepSurface, eta, phi, pt))
+    Int_t trackID = esdTrack ? esdTrack->GetID() : aodTrack->GetID();
+    if (!PropagateTrackParamToEMCalSurface(trackID, trackParam, emcalParam, eta, phi, pt))
     {
       if (aodevent    && trackParam) delete trackParam;
       if (fITSTrackSA && trackParam) delete trackParam;
@@ -4320,6 +4339,228 @@ void AliEMCALRecoUtils::FindMatches(AliVEvent *event,
   fResidualEta.Set(matched);
 }
 
+///
+/// Propagate the track parameters to the EMCal surface, see AliEMCALRecoUtilsBase::ExtrapolateTrackToEMCalSurface().
+/// If the cache is switched on (SwitchOnTrackPropagationCache()), the result is kept per
+/// track ID and reused as long as the same track parameters are propagated again, so that
+/// the different track matching methods called for the same track in an event only propagate
+/// it once. The entries are validated against the input parameters, and the cache is cleared
+/// when FindMatches() or PropagateTracksToEMCalSurface() are called for a new event.
+///
+/// \param trackID: track ID, key of the cache (no caching for negative IDs)
+/// \param trkParam: track parameters at the starting point of the propagation
+/// \param emcalParam: track parameters on the EMCal surface, filled if the propagation succeeds
+/// \param eta: track eta on the EMCal surface
+/// \param phi: track phi on the EMCal surface
+/// \param pt: track pt on the EMCal surface
+///
+/// \return kTRUE if the track reached the EMCal surface
+///
+//________________________________________________________________________________
+Bool_t AliEMCALRecoUtils::PropagateTrackParamToEMCalSurface(Int_t trackID, const AliExternalTrackParam *trkParam,
+                                                            AliExternalTrackParam &emcalParam,
+                                                            Float_t &eta, Float_t &phi, Float_t &pt)
+{
+  eta = -999, phi = -999, pt = -999;
+  if (!trkParam) return kFALSE;
+
+  Double_t input[7] = {trkParam->GetX(), trkParam->GetAlpha()};
+  for (Int_t i = 0; i < 5; i++) input[i+2] = trkParam->GetParameter()[i];
+
+  TrackPropagation *entry = 0;
+  if (fUseTrackPropagationCache && trackID >= 0)
+  {
+    entry = &fTrackPropagationCache[trackID];
+    if (entry->fValid && std::equal(input, input+7, entry->fInput))
+    {
+      if (!entry->fPropagated) return kFALSE;
+      emcalParam = entry->fParamAtEMCal;
+      eta = entry->fEta; phi = entry->fPhi; pt = entry->fPt;
+      return kTRUE;
+    }
+  }
+
+  Bool_t propagated = kFALSE;
+  if (!fUseTrackHelixPreselection || IsTrackInEMCalHelixAcceptance(trkParam))
+  {
+    emcalParam = *trkParam;
+    propagated = ExtrapolateTrackToEMCalSurface(&emcalParam, fEMCalSurfaceDistance, fMass, fStepSurface, eta, phi, pt);
+  }
+
+  if (entry)
+  {
+    entry->fValid = kTRUE;
+    std::copy(input, input+7, entry->fInput);
+    entry->fPropagated = propagated;
+    entry->fEta = eta; entry->fPhi = phi; entry->fPt = pt;
+    if (propagated) entry->fParamAtEMCal = emcalParam;
+  }
+
+  return propagated;
+}
+
+///
+/// Fast preselection of the track by its helix: reject tracks which do not reach
+/// the EMCal surface or which point outside the EMCal/DCal acceptance, extended by
+/// the margins set with SetTrackHelixPreselectionMargins(). Energy loss and material
+/// are not considered, so the margins must cover the difference with respect to the
+/// full propagation.
+///
+/// \param trkParam: track parameters at the starting point of the propagation
+///
+/// \return kFALSE if the track can be rejected before the propagation
+///
+//________________________________________________________________________________
+Bool_t AliEMCALRecoUtils::IsTrackInEMCalHelixAcceptance(const AliExternalTrackParam *trkParam) const
+{
+  if (!trkParam) return kFALSE;
+
+  Double_t bz = AliTrackerBase::GetBz();
+  Double_t x = 0;
+  if (!trkParam->GetXatLabR(fEMCalSurfaceDistance, x, bz, 1)) return kFALSE;
+
+  Double_t xyz[3];
+  if (!trkParam->GetXYZAt(x, bz, xyz)) return kTRUE;
+
+  TVector3 pos(xyz[0], xyz[1], xyz[2]);
+  if (TMath::Abs(pos.Eta()) > 0.75 + fTrackHelixEtaMargin) return kFALSE;
+
+  Double_t phi = TVector2::Phi_0_2pi(pos.Phi());
+  if (phi > (80 *TMath::DegToRad() - fTrackHelixPhiMargin) &&
+      phi < (187*TMath::DegToRad() + fTrackHelixPhiMargin)) return kTRUE; // EMCal
+
+  AliEMCALGeometry *geom = AliEMCALGeometry::GetInstance();
+  if (geom && geom->GetNumberOfSuperModules() < 13) return kFALSE; // Run1 10 (12, 2 not active but present)
+
+  return phi > (260*TMath::DegToRad() - fTrackHelixPhiMargin) &&
+         phi < (327*TMath::DegToRad() + fTrackHelixPhiMargin); // DCal
+}
+
+///
+/// Propagate the track to the EMCal surface, starting from the same track parameters as FindMatches().
+/// See PropagateTrackParamToEMCalSurface().
+///
+/// \param track: ESD or AOD track
+/// \param eta: track eta on the EMCal surface
+/// \param phi: track phi on the EMCal surface
+/// \param pt: track pt on the EMCal surface
+/// \param setTrackOnEMCal: store the result in the track with AliVTrack::SetTrackPhiEtaPtOnEMCal()
+///
+/// \return kTRUE if the track reached the EMCal surface
+///
+//________________________________________________________________________________
+Bool_t AliEMCALRecoUtils::PropagateTrackToEMCalSurface(AliVTrack *track, Float_t &eta, Float_t &phi, Float_t &pt,
+                                                       Bool_t setTrackOnEMCal)
+{
+  eta = -999, phi = -999, pt = -999;
+  if (!track) return kFALSE;
+
+  AliExternalTrackParam buffer;
+  const AliExternalTrackParam *trackParam = 0;
+  if (AliESDtrack *esdTrack = dynamic_cast<AliESDtrack*>(track))
+  {
+    if (!fITSTrackSA) // if TPC Available
+      trackParam = fUseOuterTrackParam ? esdTrack->GetOuterParam() : esdTrack->GetInnerParam();
+    else
+    {
+      buffer.CopyFromVTrack(esdTrack); // If ITS Track Standing alone
+      trackParam = &buffer;
+    }
+  }
+  else if (AliAODTrack *aodTrack = dynamic_cast<AliAODTrack*>(track))
+  {
+    Double_t pos[3], mom[3], cv[21] = {0.};
+
+    if ( fUseTrackDCA )
+      aodTrack->GetXYZ(pos);
+    else
+      aodTrack->XvYvZv(pos);
+
+    aodTrack->GetPxPyPz(mom);
+    buffer.Set(pos, mom, cv, aodTrack->Charge());
+    trackParam = &buffer;
+  }
+  else
+  {
+    AliWarning("Wrong input track type! Should be \"AOD\" or \"ESD\" ");
+    return kFALSE;
+  }
+
+  AliExternalTrackParam emcalParam;
+  if (!PropagateTrackParamToEMCalSurface(track->GetID(), trackParam, emcalParam, eta, phi, pt))
+    return kFALSE;
+
+  if (setTrackOnEMCal) track->SetTrackPhiEtaPtOnEMCal(phi, eta, pt);
+
+  return kTRUE;
+}
+
+///
+/// Propagate all tracks of the event to the EMCal surface in one pass, so that the
+/// track matching methods called later for these tracks find the propagation in the cache
+/// (if switched on with SwitchOnTrackPropagationCache()).
+/// Tracks outside |eta| < 0.9 or, without DCal, outside 10 < phi < 250 deg are skipped as in FindMatches().
+///
+/// \param event: ESD or AOD event
+/// \param setTrackOnEMCal: store the results in the tracks with AliVTrack::SetTrackPhiEtaPtOnEMCal()
+///
+/// \return the number of tracks which reached the EMCal surface
+///
+//________________________________________________________________________________
+Int_t AliEMCALRecoUtils::PropagateTracksToEMCalSurface(AliVEvent *event, Bool_t setTrackOnEMCal)
+{
+  if (!event) return 0;
+
+  SetTrackPropagationEvent(event);
+
+  // Init the magnetic field if not already on
+  if (!TGeoGlobalMagField::Instance()->GetField() && !event->InitMagneticField())
+  {
+    AliInfo("Mag Field not initialized, null esd/aod evetn pointers");
+    return 0;
+  }
+
+  AliEMCALGeometry *geom = AliEMCALGeometry::GetInstance();
+  Bool_t noDCal = geom && geom->GetNumberOfSuperModules() < 13;
+
+  Int_t npropagated = 0;
+  Float_t eta, phi, pt;
+  for (Int_t itr = 0; itr < event->GetNumberOfTracks(); itr++)
+  {
+    AliVTrack *track = dynamic_cast<AliVTrack*>(event->GetTrack(itr));
+    if (!track) continue;
+    if (track->Pt() < fCutMinTrackPt) continue;
+    if (TMath::Abs(track->Eta()) > 0.9) continue;
+    if (noDCal)
+    {
+      Double_t trackPhi = track->Phi()*TMath::RadToDeg();
+      if ( trackPhi <= 10 || trackPhi >= 250 ) continue;
+    }
+
+    if (PropagateTrackToEMCalSurface(track, eta, phi, pt, setTrackOnEMCal)) npropagated++;
+  }
+
+  return npropagated;
+}
+
+///
+/// Clear the track propagation cache if the event differs from the one of the cached entries.
+///
+/// \param event: event whose tracks are propagated next
+///
+//________________________________________________________________________________
+void AliEMCALRecoUtils::SetTrackPropagationEvent(const AliVEvent *event)
+{
+  if (!fUseTrackPropagationCache || !event) return;
+
+  ULong64_t eventID = (ULong64_t(event->GetPeriodNumber()) << 36) | (ULong64_t(event->GetOrbitNumber()) << 12) | event->GetBunchCrossNumber();
+  if (event == fTrackPropagationEvent && eventID == fTrackPropagationEventID) return;
+
+  fTrackPropagationCache.clear();
+  fTrackPropagationEvent = event;
+  fTrackPropagationEventID = eventID;
+}
+
 ///
 /// Find matched cluster in event. See Find MatchedClusterInClusterArr().
 ///
@@ -4360,10 +4601,10 @@ Int_t AliEMCALRecoUtils::FindMatchedClusterInEvent(const AliESDtrack *track,
     trackParam = new AliExternalTrackParam(*track);
 
   if (!trackParam) return index;
-  AliExternalTrackParam emcalParam(*trackParam);
+  AliExternalTrackParam emcalParam;
 
   Float_t eta, phi, pt;
-  if (!AliEMCALRecoUtilsBase::ExtrapolateTrackToEMCalSurface(&emcalParam, fEMCalSurfaceDistance, fMass, fStepSurface, eta, phi, pt))
+  if (!PropagateTrackParamToEMCalSurface(track->GetID(), trackParam, emcalParam, eta, phi, pt))
   {
     if (fITSTrackSA) delete trackParam;
     return index;
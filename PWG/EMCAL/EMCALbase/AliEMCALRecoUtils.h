@@ -31,6 +31,9 @@
 ///
 ///////////////////////////////////////////////////////////////////////////////
 
+// std includes
+#include <unordered_map>
+
 // Root includes
 #include <TArray.h>
 #include <TArrayL64.h>
@@ -51,6 +54,7 @@ class AliVEvent;
 #include "AliLog.h"
 class AliMCEvent;
 #include "AliCaloCalibPedestal.h"
+#include "AliExternalTrackParam.h"
 
 // EMCAL includes
 #include "AliEMCALRecoUtilsBase.h"
@@ -174,6 +178,8 @@ public:
   Int_t    GetNonLinearityThreshold()              const { return fNonLinearThreshold      ; }
   void     SetUseTowerShaperNonlinarityCorrection(Bool_t doCorr)     { fUseShaperNonlin = doCorr ; }
   void     SetUseDetermineLowGain(Bool_t doCorr)     { fUseDetermineLowGain = doCorr ; }
+  Bool_t   IsTowerShaperNonlinarityCorrectionOn()  const { return fUseShaperNonlin         ; }
+  Bool_t   IsDetermineLowGainOn()                  const { return fUseDetermineLowGain     ; }
   void     SetUseTowerAdditionalScaleCorrection(Bool_t doCorr)       { fUseAdditionalScale = doCorr;}
   void     SetUseTowerAdditionalScaleCorrectionEtaDep(Bool_t doCorr) { fUseAdditionalScaleEtaDep = doCorr;}
   void     SetTowerAdditionalScaleCorrection(Int_t i, Float_t val)   { if(i < 3 && i >= 0) fAdditionalScaleSM[i] = val;
@@ -206,6 +212,7 @@ public:
   void     RecalibrateCells(AliVCaloCells * cells, Int_t bc) ; // Energy and Time
   void     RecalibrateClusterEnergy(const AliEMCALGeometry* geom, AliVCluster* cluster, AliVCaloCells * cells, Int_t bc=-1) ; // Energy and time
   void     ResetCellsCalibrated()                        { fCellsRecalibrated = kFALSE; }
+  void     SetCellsCalibrated()                          { fCellsRecalibrated = kTRUE ; }
 
   // Energy recalibration
   Bool_t   IsRecalibrationOn()                     const { return fRecalibration ; }
@@ -478,6 +485,17 @@ public:
   Bool_t   ExtrapolateTrackToCluster (AliExternalTrackParam *trkParam, const AliVCluster *cluster,
                                       Float_t &tmpEta, Float_t &tmpPhi);
 
+  // Propagation of tracks to the EMCal surface, cached per track ID
+  Bool_t   PropagateTrackParamToEMCalSurface(Int_t trackID, const AliExternalTrackParam *trkParam,
+                                             AliExternalTrackParam &emcalParam,
+                                             Float_t &eta, Float_t &phi, Float_t &pt);
+  Bool_t   PropagateTrackToEMCalSurface(AliVTrack *track, Float_t &eta, Float_t &phi, Float_t &pt,
+                                        Bool_t setTrackOnEMCal = kTRUE);
+  Int_t    PropagateTracksToEMCalSurface(AliVEvent *event, Bool_t setTrackOnEMCal = kTRUE);
+  Bool_t   IsTrackInEMCalHelixAcceptance(const AliExternalTrackParam *trkParam) const;
+  void     ResetTrackPropagationCache()               { fTrackPropagationCache.clear() ; fTrackPropagationEvent = 0 ; }
+  void     SetTrackPropagationEvent(const AliVEvent *event);
+
   UInt_t   FindMatchedPosForCluster(Int_t clsIndex) const;
   UInt_t   FindMatchedPosForTrack  (Int_t trkIndex) const;
   void     GetMatchedResiduals       (Int_t clsIndex, Float_t &dEta, Float_t &dPhi);
@@ -511,6 +529,13 @@ public:
   void     SetITSTrackSA(Bool_t isITS)                { fITSTrackSA = isITS           ; } //Special Handle of AliExternTrackParam
   void     SwitchOnOuterTrackParam()                  { fUseOuterTrackParam = kTRUE   ; }
   void     SwitchOffOuterTrackParam()                 { fUseOuterTrackParam = kFALSE  ; }
+  void     SwitchOnTrackPropagationCache()            { fUseTrackPropagationCache = kTRUE  ; }
+  void     SwitchOffTrackPropagationCache()           { fUseTrackPropagationCache = kFALSE ; ResetTrackPropagationCache() ; }
+  Bool_t   IsTrackPropagationCacheOn()          const { return fUseTrackPropagationCache     ; }
+  void     SwitchOnTrackHelixPreselection()           { fUseTrackHelixPreselection = kTRUE  ; }
+  void     SwitchOffTrackHelixPreselection()          { fUseTrackHelixPreselection = kFALSE ; }
+  Bool_t   IsTrackHelixPreselectionOn()         const { return fUseTrackHelixPreselection    ; }
+  void     SetTrackHelixPreselectionMargins(Float_t eta, Float_t phi) { fTrackHelixEtaMargin = eta ; fTrackHelixPhiMargin = phi ; }
 
 
   // Track Cuts
@@ -736,6 +761,24 @@ private:
   Bool_t     fUseTrackDCA;               ///< Activate use of aodtrack->GetXYZ or XvYxZv like in AliEMCALRecoUtilsBase::ExtrapolateTrackToEMCalSurface
   Bool_t     fUseOuterTrackParam;        ///< Use OuterTrackParam not InnerTrackParam, ESDs
   Double_t   fEMCalSurfaceDistance;      ///< EMCal surface distance (= 430 by default, the last 10 cm are propagated on a cluster-track pair basis)
+  Bool_t     fUseTrackPropagationCache;  ///< Reuse the propagation of a track to the EMCal surface when the same track is propagated again in the event (off by default)
+  Bool_t     fUseTrackHelixPreselection; ///< Reject tracks whose helix does not reach the EMCal/DCal acceptance before the full propagation
+  Float_t    fTrackHelixEtaMargin;       ///< Margin in eta of the helix preselection acceptance
+  Float_t    fTrackHelixPhiMargin;       ///< Margin in phi (rad) of the helix preselection acceptance
+
+  /// Propagation of a track to the EMCal surface, see PropagateTrackParamToEMCalSurface()
+  struct TrackPropagation {
+    Bool_t                fValid = kFALSE;      ///< Entry filled
+    Double_t              fInput[7] = {0.};     ///< Parameters of the propagated track: x, alpha and the 5 track parameters
+    Bool_t                fPropagated = kFALSE; ///< The track reached the EMCal surface
+    Float_t               fEta = -999;          ///< Track eta on the EMCal surface
+    Float_t               fPhi = -999;          ///< Track phi on the EMCal surface
+    Float_t               fPt = -999;           ///< Track pt on the EMCal surface
+    AliExternalTrackParam fParamAtEMCal;        ///< Track parameters on the EMCal surface
+  };
+  std::unordered_map<Int_t, TrackPropagation> fTrackPropagationCache; //!<! Propagated tracks by track ID
+  const AliVEvent *fTrackPropagationEvent;     //!<! Event of the entries in the propagation cache
+  ULong64_t  fTrackPropagationEventID;         //!<! Orbit, bunch crossing and period of that event
 
   // Track cuts
   Int_t      fTrackCutsType;             ///< ESD track cuts type for matching, see enum TrackCutsType
@@ -759,7 +802,7 @@ private:
   Bool_t     fMCGenerToAcceptForTrack;   ///<  Activate the removal of tracks entering the track matching that come from a particular generator
 
   /// \cond CLASSIMP
-  ClassDef(AliEMCALRecoUtils, 44) ;
+  ClassDef(AliEMCALRecoUtils, 46) ;
   /// \endcond
 
 };
@@ -60,6 +60,14 @@ AliEmcalContainer::AliEmcalContainer():
   fCurrentID(0),
   fLabelMap(0),
   fLoadedClass(0),
+  fCacheAccepted(kFALSE),
+  fAcceptCacheValid(kFALSE),
+  fAcceptedIndices(),
+  fRejectionReasons(),
+  fUseLabelHashMap(kFALSE),
+  fLabelHashValid(kFALSE),
+  fLabelHashKeys(),
+  fLabelHashIndices(),
   fClassName()
 {
   fVertex[0] = 0;
@@ -90,6 +98,14 @@ AliEmcalContainer::AliEmcalContainer(const char *name):
   fCurrentID(0),
   fLabelMap(0),
   fLoadedClass(0),
+  fCacheAccepted(kFALSE),
+  fAcceptCacheValid(kFALSE),
+  fAcceptedIndices(),
+  fRejectionReasons(),
+  fUseLabelHashMap(kFALSE),
+  fLabelHashValid(kFALSE),
+  fLabelHashKeys(),
+  fLabelHashIndices(),
   fClassName()
 {
   fVertex[0] = 0;
@@ -113,6 +129,13 @@ void AliEmcalContainer::SetClassName(const char *clname)
   }
 }
 
+TString AliEmcalContainer::GetSelectionKey() const
+{
+  return TString::Format("%s:%s:%s:%d:%u:%g:%g:%g:%g:%g:%g:%g:%g:%d:%d:%g:%d", IsA()->GetName(), fClArrayName.Data(), fClassName.Data(),
+      fIsParticleLevel, fBitMap, fMinPt, fMaxPt, fMinE, fMaxE, fMinEta, fMaxEta, fMinPhi, fMaxPhi,
+      fMinMCLabel, fMaxMCLabel, fMassHypothesis, fIsEmbedding);
+}
+
 void AliEmcalContainer::GetVertexFromEvent(const AliVEvent * event)
 {
   const AliVVertex *vertex = event->GetPrimaryVertex();
@@ -132,6 +155,7 @@ void AliEmcalContainer::SetArray(const AliVEvent *event)
   if (!event) return;
 
   GetVertexFromEvent(event);
+  InvalidateAcceptCache();
 
   if (!fClArrayName.IsNull() && !fClArray) {
     fClArray = dynamic_cast<TClonesArray*>(event->FindListObject(fClArrayName));
@@ -165,9 +189,11 @@ void AliEmcalContainer::NextEvent(const AliVEvent * event)
   if (!event) return;
 
   GetVertexFromEvent(event);
+  InvalidateAcceptCache();
 }
 
 Int_t AliEmcalContainer::GetNAcceptEntries() const{
+  if(fCacheAccepted) return GetAcceptedIndices().size();
   Int_t result = 0;
   for(int index = 0; index < GetNEntries(); index++){
     UInt_t rejectionReason = 0;
@@ -176,8 +202,80 @@ Int_t AliEmcalContainer::GetNAcceptEntries() const{
   return result;
 }
 
+const std::vector<Int_t> &AliEmcalContainer::GetAcceptedIndices() const {
+  // The size check protects against arrays modified within the event
+  if(!fCacheAccepted || !fAcceptCacheValid || (Int_t)fRejectionReasons.size() != GetNEntries()) BuildAcceptCache();
+  return fAcceptedIndices;
+}
+
+UInt_t AliEmcalContainer::GetRejectionReason(Int_t i) const {
+  if(fCacheAccepted) {
+    GetAcceptedIndices();
+    return (i >= 0 && i < (Int_t)fRejectionReasons.size()) ? fRejectionReasons[i] : 0;
+  }
+  UInt_t rejectionReason = 0;
+  AcceptObject(i, rejectionReason);
+  return rejectionReason;
+}
+
+void AliEmcalContainer::BuildAcceptCache() const {
+  Int_t nentries = GetNEntries();
+  fAcceptedIndices.clear();
+  fAcceptedIndices.reserve(nentries);
+  fRejectionReasons.assign(nentries, 0);
+  for(int index = 0; index < nentries; index++){
+    if(AcceptObject(index, fRejectionReasons[index])) fAcceptedIndices.push_back(index);
+  }
+  fAcceptCacheValid = kTRUE;
+}
+
+namespace {
+  /// Start slot of a label in a hash table with 2^nbits slots (Fibonacci hashing)
+  inline UInt_t LabelHashSlot(Int_t lab, UInt_t mask) {
+    return (static_cast<UInt_t>(lab) * 2654435761u) & mask;
+  }
+}
+
+Int_t AliEmcalContainer::GetLabelOfEntry(Int_t i) const
+{
+  const AliVParticle *part = dynamic_cast<const AliVParticle *>(fClArray->At(i));
+  return part ? part->GetLabel() : -1;
+}
+
+void AliEmcalContainer::BuildLabelHashMap() const
+{
+  Int_t nentries = GetNEntries();
+  UInt_t nslots = 16;
+  while (nslots < 2u * nentries) nslots <<= 1;
+  UInt_t mask = nslots - 1;
+  fLabelHashKeys.assign(nslots, 0);
+  fLabelHashIndices.assign(nslots, -1);
+  for (Int_t i = 0; i < nentries; i++) {
+    if (!fClArray->At(i)) continue;
+    Int_t lab = GetLabelOfEntry(i);
+    UInt_t slot = LabelHashSlot(lab, mask);
+    while (fLabelHashIndices[slot] >= 0 && fLabelHashKeys[slot] != lab) slot = (slot + 1) & mask;
+    if (fLabelHashIndices[slot] >= 0) continue; // keep the first entry with this label
+    fLabelHashKeys[slot] = lab;
+    fLabelHashIndices[slot] = i;
+  }
+  fLabelHashValid = kTRUE;
+}
+
 Int_t AliEmcalContainer::GetIndexFromLabel(Int_t lab) const
 { 
+  if (fUseLabelHashMap && fClArray) {
+    if (!fLabelHashValid) BuildLabelHashMap();
+    UInt_t mask = fLabelHashKeys.size() - 1;
+    UInt_t slot = LabelHashSlot(lab, mask);
+    while (fLabelHashIndices[slot] >= 0) {
+      if (fLabelHashKeys[slot] == lab) return fLabelHashIndices[slot];
+      slot = (slot + 1) & mask;
+    }
+    AliDebug(3,Form("%s_AliEmcalContainer::GetIndexFromLabel - Label not found in the hash map, returning -1...",fClArrayName.Data()));
+    return -1;
+  }
+
   if (fLabelMap) {
     if (lab < fLabelMap->GetSize()) {
       return fLabelMap->At(lab); 
@@ -38,6 +38,7 @@ class AliNamedArrayI;
 class AliVParticle;
 
 #include <TNamed.h>
+#include <vector>
 #include <TClonesArray.h>
 
 #if !(defined(__CINT__) || defined(__MAKECINT__))
@@ -212,9 +213,26 @@ class AliEmcalContainer : public TObject {
    * @brief Get the index in the container from a given label
    * @param lab Label to check
    * @return Index (-1 if not found)
+   *
+   * If the label hash map is enabled (SetUseLabelHashMap), the index is taken
+   * from a hash map of the labels of the objects in the container, otherwise
+   * from the label-index map provided in the event (array name + "_Map").
    */
   Int_t                       GetIndexFromLabel(Int_t lab)    const;
 
+  /**
+   * @brief Use a hash map of the object labels for GetIndexFromLabel
+   *
+   * The hash map (open addressing, sized to the number of entries) is built
+   * on the first label query in the event. In contrast to the label-index map
+   * provided in the event, its size does not depend on the range of the labels,
+   * e.g. with label offsets in embedding. For several entries with the same
+   * label the first one is returned.
+   * @param[in] b If true the hash map is used
+   */
+  void                        SetUseLabelHashMap(Bool_t b)          { fUseLabelHashMap = b; fLabelHashValid = kFALSE; }
+  Bool_t                      GetUseLabelHashMap() const            { return fUseLabelHashMap           ; }
+
   Int_t                       GetNEntries()                   const { return fClArray ? fClArray->GetEntriesFast() : 0 ; }
   virtual Bool_t              GetMomentum(TLorentzVector &mom, Int_t i) const = 0;
   virtual Bool_t              GetAcceptMomentum(TLorentzVector &mom, Int_t i) const = 0;
@@ -229,6 +247,37 @@ class AliEmcalContainer : public TObject {
    */
   Int_t                       GetNAcceptEntries() const;
 
+  /**
+   * @brief Indices of the accepted entries in the current event
+   *
+   * With the accept cache enabled (see SetCacheAcceptedIndices) the selection is
+   * run once per event, on the first call, and all later calls (including
+   * GetNAcceptEntries and the accepted() iterators) only walk the array.
+   * Without the cache the selection is evaluated on every call.
+   * @return Indices of the accepted entries, in ascending order
+   */
+  const std::vector<Int_t>&   GetAcceptedIndices() const;
+
+  /**
+   * @brief Rejection reason of an entry in the current event
+   *
+   * Taken from the accept cache if enabled, evaluated otherwise.
+   * @param[in] i Index of the entry
+   * @return Rejection bitmap (0 if accepted)
+   */
+  UInt_t                      GetRejectionReason(Int_t i) const;
+
+  /**
+   * @brief Enable the per-event cache of the selection
+   *
+   * The cache is invalidated in NextEvent and SetArray. Tasks that change
+   * the selection in the middle of an event must call InvalidateAcceptCache.
+   * @param[in] b If true the selection is cached
+   */
+  void                        SetCacheAcceptedIndices(Bool_t b)     { fCacheAccepted = b; InvalidateAcceptCache(); }
+  Bool_t                      GetCacheAcceptedIndices() const       { return fCacheAccepted             ; }
+  void                        InvalidateAcceptCache()               { fAcceptCacheValid = kFALSE; fLabelHashValid = kFALSE; }
+
   /**
    * @brief Reset the iterator to a given index
    * 
@@ -289,6 +338,15 @@ class AliEmcalContainer : public TObject {
    */
   Bool_t                      GetIsEmbedding() const                    { return fIsEmbedding; }
 
+  /**
+   * @brief Key describing the input array and all the selection settings of the container
+   *
+   * Containers with identical keys accept the same objects in every event. Derived
+   * classes append their own selection settings.
+   * @return Selection key
+   */
+  virtual TString             GetSelectionKey() const;
+
   const char*                 GetName()                       const { return fName.Data()               ; }
 
   /**
@@ -372,6 +430,23 @@ class AliEmcalContainer : public TObject {
    */
   void                        GetVertexFromEvent(const AliVEvent * event);
 
+  /**
+   * @brief Run the selection on all entries and fill the accept cache
+   */
+  void                        BuildAcceptCache() const;
+
+  /**
+   * @brief Label of the object at a given index, used for the label hash map
+   * @param[in] i Index of the object
+   * @return Label of the object (-1 if the object does not carry a label)
+   */
+  virtual Int_t               GetLabelOfEntry(Int_t i) const;
+
+  /**
+   * @brief Fill the label hash map with the labels of all entries
+   */
+  void                        BuildLabelHashMap() const;
+
   TString                     fName;                    ///< object name
   TString                     fClArrayName;             ///< name of branch
   TString                     fBaseClassName;           ///< name of the base class that this container can handle
@@ -394,6 +469,14 @@ class AliEmcalContainer : public TObject {
   AliNamedArrayI             *fLabelMap;                //!<! Label-Index map
   Double_t                    fVertex[3];               //!<! event vertex array
   TClass                     *fLoadedClass;             //!<! Class of the objects contained in the TClonesArray
+  Bool_t                      fCacheAccepted;           ///< Cache the selection once per event
+  mutable Bool_t              fAcceptCacheValid;        //!<! Accept cache filled for the current event
+  mutable std::vector<Int_t>  fAcceptedIndices;         //!<! Accepted indices in the current event
+  mutable std::vector<UInt_t> fRejectionReasons;        //!<! Rejection reason of all entries in the current event
+  Bool_t                      fUseLabelHashMap;         ///< Use the hash map of the object labels in GetIndexFromLabel
+  mutable Bool_t              fLabelHashValid;          //!<! Label hash map filled for the current event
+  mutable std::vector<Int_t>  fLabelHashKeys;           //!<! Labels in the hash map (open addressing)
+  mutable std::vector<Int_t>  fLabelHashIndices;        //!<! Index belonging to the label (-1 for empty slots)
 
  private:
   TString                     fClassName;               ///< name of the class in the TClonesArray
@@ -401,6 +484,6 @@ class AliEmcalContainer : public TObject {
   AliEmcalContainer(const AliEmcalContainer& obj); // copy constructor
   AliEmcalContainer& operator=(const AliEmcalContainer& other); // assignment
 
-  ClassDef(AliEmcalContainer,9);
+  ClassDef(AliEmcalContainer,11);
 };
 #endif
@@ -333,6 +333,13 @@ T *AliEmcalIterableContainerT<T, STAR>::operator[](int index) const {
  */
 template <typename T, typename STAR>
 void AliEmcalIterableContainerT<T, STAR>::BuildAcceptIndices(){
+  if(fkContainer->GetCacheAcceptedIndices()){
+    // selection already done for this event, only copy the indices
+    const std::vector<Int_t> &accepted = fkContainer->GetAcceptedIndices();
+    fAcceptIndices.Set(accepted.size());
+    for(UInt_t index = 0; index < accepted.size(); index++) fAcceptIndices[index] = accepted[index];
+    return;
+  }
   fAcceptIndices.Set(fkContainer->GetNAcceptEntries());
   int acceptCounter = 0;
   for(int index = 0; index < fkContainer->GetNEntries(); index++){
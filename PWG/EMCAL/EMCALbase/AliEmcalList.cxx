@@ -42,10 +42,18 @@ ClassImp(AliEmcalList)
 AliEmcalList::AliEmcalList() : TList(), 
   fUseScaling(kFALSE),
   fNameXsec("fHistXsection"),
-  fNameNTrials("fHistTrials")
+  fNameNTrials("fHistTrials"),
+  fUseDeferredScaling(kFALSE),
+  fPtHardBinAccumulators()
 {
 }
 
+//________________________________________________________________________
+AliEmcalList::~AliEmcalList()
+{
+  for(auto accumulator : fPtHardBinAccumulators) delete accumulator.second;
+}
+
 //________________________________________________________________________
 Long64_t AliEmcalList::Merge(TCollection *hlist)
 {
@@ -69,6 +77,12 @@ Long64_t AliEmcalList::Merge(TCollection *hlist)
   // This is easy to find out checking the std histos in hlist
   Bool_t  isLastLevel = IsLastMergeLevel(hlist);
  
+  if(isLastLevel && fUseDeferredScaling)
+  {
+    AliInfoStream() << "===== LAST LEVEL OF MERGING (deferred scaling) =====" << std::endl;
+    return MergeDeferred(hlist);
+  }
+
   // #### On last level, do the scaling
   if(isLastLevel)
   {
@@ -95,6 +109,111 @@ Long64_t AliEmcalList::Merge(TCollection *hlist)
   return hlist->GetEntries() + 1;
 }
 
+//________________________________________________________________________
+Long64_t AliEmcalList::MergeDeferred(TCollection *hlist)
+{
+  // #### Group the lists by pt-hard bin, lists without single filled bin (already scaled) go to bin 0
+  std::map<Int_t, std::vector<AliEmcalList *>> listsPerBin;
+  Int_t binNumberThis = GetFilledBinNumber(static_cast<TH1*>(FindObject(fNameXsec.Data())));
+  if(binNumberThis) listsPerBin[binNumberThis].push_back(this);
+
+  TIter listIterator(hlist);
+  while (AliEmcalList* tmpList = static_cast<AliEmcalList*>(listIterator()))
+  {
+    TH1 *xsection = static_cast<TH1*>(tmpList->FindObject(fNameXsec.Data()));
+    listsPerBin[xsection ? GetFilledBinNumber(xsection) : 0].push_back(tmpList);
+  }
+
+  // #### Merge the unscaled lists of each bin into the first one and scale it once
+  TList scaledLists;
+  for(auto &bin : listsPerBin)
+  {
+    if(!bin.first)
+    {
+      for(auto unscaled : bin.second) scaledLists.Add(unscaled);
+      continue;
+    }
+    AliEmcalList *accumulator = bin.second.front();
+    if(bin.second.size() > 1)
+    {
+      TList inputs;
+      for(size_t ilist = 1; ilist < bin.second.size(); ilist++) inputs.Add(bin.second[ilist]);
+      accumulator->TList::Merge(&inputs);
+    }
+    ScaleAccumulated(accumulator);
+    if(accumulator != this) scaledLists.Add(accumulator);
+  }
+
+  // #### Add the scaled bins to this list
+  if(scaledLists.GetEntries()) TList::Merge(&scaledLists);
+
+  AliInfoStream() << "Merge() done." << std::endl;
+  return hlist->GetEntries() + 1;
+}
+
+//________________________________________________________________________
+void AliEmcalList::AddPtHardInput(const AliEmcalList *input)
+{
+  if(!input) return;
+  TH1 *xsection = static_cast<TH1*>(input->FindObject(fNameXsec.Data()));
+  Int_t binNumber = xsection ? GetFilledBinNumber(xsection) : 0;
+
+  auto accumulator = fPtHardBinAccumulators.find(binNumber);
+  if(accumulator == fPtHardBinAccumulators.end())
+  {
+    AliEmcalList *binlist = static_cast<AliEmcalList *>(input->Clone());
+    binlist->SetOwner(kTRUE);
+    fPtHardBinAccumulators[binNumber] = binlist;
+    return;
+  }
+
+  TList inputs;
+  inputs.Add(const_cast<AliEmcalList *>(input));
+  accumulator->second->TList::Merge(&inputs);
+}
+
+//________________________________________________________________________
+Long64_t AliEmcalList::FinalizePtHardMerge()
+{
+  TList scaledLists;
+  scaledLists.SetOwner(kTRUE);
+  for(auto &bin : fPtHardBinAccumulators)
+  {
+    if(bin.first) ScaleAccumulated(bin.second);
+    scaledLists.Add(bin.second);
+  }
+  fPtHardBinAccumulators.clear();
+  Long64_t nmerged = scaledLists.GetEntries();
+  if(!nmerged) return 0;
+
+  if(!GetEntries())
+  {
+    // Take over the content of the first accumulator
+    AliEmcalList *first = static_cast<AliEmcalList *>(scaledLists.First());
+    scaledLists.Remove(first);
+    first->SetOwner(kFALSE);
+    TIter firstIterator(first);
+    while (TObject *obj = firstIterator()) Add(obj);
+    SetOwner(kTRUE);
+    delete first;
+  }
+  if(scaledLists.GetEntries()) TList::Merge(&scaledLists);
+  return nmerged;
+}
+
+//________________________________________________________________________
+void AliEmcalList::ScaleAccumulated(AliEmcalList *accumulator)
+{
+  TH1* xsection = static_cast<TH1*>(accumulator->FindObject(fNameXsec.Data()));
+  TH1* ntrials  = static_cast<TH1*>(accumulator->FindObject(fNameNTrials.Data()));
+  if(!(xsection && ntrials))
+  {
+    AliErrorStream() << "List without " << fNameXsec << " or " << fNameNTrials << " - not scaled" << std::endl;
+    return;
+  }
+  ScaleAllHistograms(accumulator, GetScalingFactor(xsection, ntrials));
+}
+
 //________________________________________________________________________
 void AliEmcalList::ScaleAllHistograms(TCollection *hlist, Double_t scalingFactor)
 {
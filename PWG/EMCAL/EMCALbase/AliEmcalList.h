@@ -29,6 +29,8 @@
 
 class TH1;
 
+#include <map>
+#include <vector>
 #include "TList.h"
 #include "TString.h"
 
@@ -42,6 +44,13 @@ class TH1;
  * Must be activated using SetUseScaling(kTRUE). Otherwise the behavior is like a TList
  * Scaling is recursively applied also to all nested lists deriving from TCollection
  * fHistXsection and fHistTrials must be added directly to the list (not to a nested list)
+ *
+ * With SetUseDeferredScaling(kTRUE) the last merge level first merges the unscaled
+ * lists of each \f$p_{t}\f$-hard bin and scales the merged list of each bin once with
+ * the cross section and the summed number of trials of that bin, instead of scaling
+ * every input list. For merging outside of TFileMerger the inputs can be streamed
+ * into the list one by one via AddPtHardInput() and FinalizePtHardMerge(), holding
+ * only one accumulator per \f$p_{t}\f$-hard bin in memory.
  */
 class AliEmcalList : public TList {
 
@@ -55,7 +64,7 @@ public:
   /**
    * @brief Destructor
    */
-  ~AliEmcalList() {}
+  ~AliEmcalList();
   /**
    * @brief Merge function including the reweighting of \f$p_{t}\f$-hard bins
    * @param hlist Collection of object to be merged
@@ -85,6 +94,36 @@ public:
    */
   Bool_t                      IsUseScaling() const { return fUseScaling; }
 
+  /**
+   * @brief Scale the merged list of each \f$p_{t}\f$-hard bin once instead of every input list
+   * @param val True for deferred scaling, false for scaling of each input list
+   */
+  void                        SetUseDeferredScaling(Bool_t val) { fUseDeferredScaling = val; }
+
+  /**
+   * @brief Check if the scaling is deferred to the merged list of each \f$p_{t}\f$-hard bin
+   * @return If true the scaling is deferred
+   */
+  Bool_t                      IsUseDeferredScaling() const { return fUseDeferredScaling; }
+
+  /**
+   * @brief Streaming merge: add an unscaled input list to the accumulator of its \f$p_{t}\f$-hard bin
+   * @param input Input list (not modified, can be deleted after the call)
+   *
+   * The first input of each \f$p_{t}\f$-hard bin is cloned, all further inputs of
+   * the same bin are merged into this clone. Inputs without a single filled bin
+   * in the cross section histogram (already scaled) are accumulated without scaling.
+   */
+  void                        AddPtHardInput(const AliEmcalList *input);
+
+  /**
+   * @brief Streaming merge: scale the accumulator of each \f$p_{t}\f$-hard bin once and merge them into this list
+   * @return Number of accumulators merged
+   *
+   * If this list is empty it takes over the content of the first accumulator.
+   */
+  Long64_t                    FinalizePtHardMerge();
+
   /**
    * @brief Set the name of the cross section histogram used for the weight calculation
    * @param name Name of the cross section histogram
@@ -122,6 +161,22 @@ private:
    * scale factors are not scaled.
    */
   void                        ScaleAllHistograms(TCollection *hlist, Double_t scalingFactor);
+
+  /**
+   * @brief Last merge level with deferred scaling
+   * @param hlist Collection of AliEmcalList objects to be merged
+   * @return Number of entries merged
+   *
+   * Groups the lists by \f$p_{t}\f$-hard bin, merges the unscaled lists of each
+   * bin into one of them (this list for its own bin) and scales it once.
+   */
+  Long64_t                    MergeDeferred(TCollection *hlist);
+
+  /**
+   * @brief Scale an accumulated list with the cross section and trials it contains
+   * @param accumulator List to be scaled
+   */
+  void                        ScaleAccumulated(AliEmcalList *accumulator);
   
   /**
    * @brief Helper function scaling factor
@@ -159,8 +214,10 @@ private:
   Bool_t                      fUseScaling;                    ///< if true, scaling will be done. if false AliEmcalList simplifies to TList
   TString                     fNameXsec;                      ///< Name of the cross section histogram
   TString                     fNameNTrials;                   ///< Name of the histogram with the number of trials
+  Bool_t                      fUseDeferredScaling;            ///< if true, scale the merged list of each pt-hard bin once
+  std::map<Int_t, AliEmcalList *> fPtHardBinAccumulators;     //!<! Unscaled accumulators per pt-hard bin for the streaming merge
 
-  ClassDef(AliEmcalList, 2);
+  ClassDef(AliEmcalList, 3);
 };
 
 #endif
@@ -40,17 +40,7 @@ AliEmcalParticle::AliEmcalParticle(AliVTrack* track, Int_t id) :
 {
   // Constructor.
 
-  if (!track) {
-    AliWarning("Null pointer passed as particle.");
-    return;
-  }
-
-  fEta = fTrack->Eta();
-  fPhi = fTrack->Phi();
-  fPt  = fTrack->Pt();
-  fM   = fTrack->M();
-
-  ResetMatchedObjects();
+  Set(track, id);
 }
 
 //_________________________________________________________________________________________________
@@ -68,25 +58,7 @@ AliEmcalParticle::AliEmcalParticle(AliVCluster* cluster, Int_t id, Double_t vx,
 {
   // Constructor.
 
-  if (!cluster) {
-    AliWarning("Null pointer passed as particle.");
-    return;
-  }
-  
-  Double_t vtx[3]; vtx[0]=vx;vtx[1]=vy;vtx[2]=vz;
-  TLorentzVector vect;
-  if (ude >= 0 && ude <= AliVCluster::kLastUserDefEnergy) {
-    fCluster->GetMomentum(vect, vtx, (AliVCluster::VCluUserDefEnergy_t)ude);
-  }
-  else {
-    fCluster->GetMomentum(vect, vtx);
-  }
-  fEta = vect.Eta();
-  fPhi = vect.Phi();
-  fPt  = vect.Pt();
-  fM   = 0.;
-
-  ResetMatchedObjects();
+  Set(cluster, id, vx, vy, vz, ude);
 }
   
 //_________________________________________________________________________________________________
@@ -140,6 +112,69 @@ AliEmcalParticle &AliEmcalParticle::operator=(const AliEmcalParticle &p)
   return *this;
 }
 
+//_________________________________________________________________________________________________
+void AliEmcalParticle::Set(AliVTrack* track, Int_t id)
+{
+  // Set the particle from a track, overwriting the previous content.
+
+  fTrack      = track;
+  fCluster    = 0;
+  fNMatched   = 0;
+  fId         = id;
+  fPhi        = 0;
+  fEta        = 0;
+  fPt         = 0;
+  fM          = 0;
+  fMatchedPtr = 0;
+
+  ResetMatchedObjects();
+
+  if (!track) {
+    AliWarning("Null pointer passed as particle.");
+    return;
+  }
+
+  fEta = fTrack->Eta();
+  fPhi = fTrack->Phi();
+  fPt  = fTrack->Pt();
+  fM   = fTrack->M();
+}
+
+//_________________________________________________________________________________________________
+void AliEmcalParticle::Set(AliVCluster* cluster, Int_t id, Double_t vx, Double_t vy, Double_t vz, Int_t ude)
+{
+  // Set the particle from a cluster, overwriting the previous content.
+
+  fTrack      = 0;
+  fCluster    = cluster;
+  fNMatched   = 0;
+  fId         = id;
+  fPhi        = 0;
+  fEta        = 0;
+  fPt         = 0;
+  fM          = 0;
+  fMatchedPtr = 0;
+
+  ResetMatchedObjects();
+
+  if (!cluster) {
+    AliWarning("Null pointer passed as particle.");
+    return;
+  }
+  
+  Double_t vtx[3]; vtx[0]=vx;vtx[1]=vy;vtx[2]=vz;
+  TLorentzVector vect;
+  if (ude >= 0 && ude <= AliVCluster::kLastUserDefEnergy) {
+    fCluster->GetMomentum(vect, vtx, (AliVCluster::VCluUserDefEnergy_t)ude);
+  }
+  else {
+    fCluster->GetMomentum(vect, vtx);
+  }
+  fEta = vect.Eta();
+  fPhi = vect.Phi();
+  fPt  = vect.Pt();
+}
+
 //_________________________________________________________________________________________________
 void AliEmcalParticle::ResetMatchedObjects()
 {
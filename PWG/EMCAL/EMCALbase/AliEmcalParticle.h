@@ -17,6 +17,10 @@ class AliEmcalParticle: public AliVParticle {
   AliEmcalParticle &operator=(const AliEmcalParticle &p);
   virtual ~AliEmcalParticle();
 
+  // Overwrite the full content, to reuse constructed objects in a TClonesArray (ConstructedAt)
+  void              Set(AliVTrack* track, Int_t id = -1);
+  void              Set(AliVCluster* cluster, Int_t id = -1, Double_t vx=0, Double_t vy=0, Double_t vz=0, Int_t ude=-1);
+
   // AliVParticle interface
   Double_t          Px()        const { return fPt*TMath::Cos(fPhi);  }
   Double_t          Py()        const { return fPt*TMath::Sin(fPhi);  };
@@ -0,0 +1,130 @@
+/************************************************************************************
+ * Copyright (C) 2024, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#include <iostream>
+
+#include <TCollection.h>
+#include <TH1D.h>
+#include <TMath.h>
+#include <TSystem.h>
+
+#include "AliEmcalTaskInstrumentation.h"
+
+/// \cond CLASSIMP
+ClassImp(PWG::EMCAL::AliEmcalTaskInstrumentation)
+/// \endcond
+
+using namespace PWG::EMCAL;
+
+AliEmcalTaskInstrumentation::AliEmcalTaskInstrumentation() :
+  TNamed()
+{
+  for(int istep = 0; istep < kNSteps; istep++) {
+    fNCalls[istep] = 0;
+    fCpuTime[istep] = 0.;
+    fRealTime[istep] = 0.;
+    fMemoryGrowth[istep] = 0.;
+    fHistLatency[istep] = nullptr;
+    fMemoryStart[istep] = 0;
+  }
+}
+
+AliEmcalTaskInstrumentation::AliEmcalTaskInstrumentation(const char *name) :
+  TNamed(name, "Timing and memory of the task processing steps")
+{
+  for(int istep = 0; istep < kNSteps; istep++) {
+    fNCalls[istep] = 0;
+    fCpuTime[istep] = 0.;
+    fRealTime[istep] = 0.;
+    fMemoryGrowth[istep] = 0.;
+    fMemoryStart[istep] = 0;
+    TString histname = TString::Format("%s_Latency%s", name, GetStepName(static_cast<Step_t>(istep)));
+    fHistLatency[istep] = new TH1D(histname, TString::Format("Wall time per call of %s; log_{10}(t/s); calls", GetStepName(static_cast<Step_t>(istep))), 100, -7., 3.);
+    fHistLatency[istep]->SetDirectory(nullptr);
+  }
+}
+
+AliEmcalTaskInstrumentation::~AliEmcalTaskInstrumentation() {
+  for(int istep = 0; istep < kNSteps; istep++) delete fHistLatency[istep];
+}
+
+const char *AliEmcalTaskInstrumentation::GetStepName(Step_t step) {
+  switch(step) {
+    case kRetrieveEventObjects: return "RetrieveEventObjects";
+    case kRun: return "Run";
+    case kFillHistograms: return "FillHistograms";
+    case kEvent: return "Event";
+    default: return "Unknown";
+  };
+}
+
+void AliEmcalTaskInstrumentation::Start(Step_t step) {
+  ProcInfo_t procinfo;
+  gSystem->GetProcInfo(&procinfo);
+  fMemoryStart[step] = procinfo.fMemResident;
+  fStopwatch[step].Start(kTRUE);
+}
+
+void AliEmcalTaskInstrumentation::Stop(Step_t step) {
+  fStopwatch[step].Stop();
+  ProcInfo_t procinfo;
+  gSystem->GetProcInfo(&procinfo);
+  Double_t realtime = fStopwatch[step].RealTime();
+  fNCalls[step]++;
+  fCpuTime[step] += fStopwatch[step].CpuTime();
+  fRealTime[step] += realtime;
+  fMemoryGrowth[step] += procinfo.fMemResident - fMemoryStart[step];
+  // calls below the stopwatch resolution end up in the underflow bin
+  if(fHistLatency[step]) fHistLatency[step]->Fill(realtime > 0. ? TMath::Log10(realtime) : -100.);
+}
+
+Long64_t AliEmcalTaskInstrumentation::Merge(TCollection *list) {
+  if(!list) return 0;
+  TIter next(list);
+  Long64_t nmerged = 0;
+  while(TObject *obj = next()) {
+    AliEmcalTaskInstrumentation *other = dynamic_cast<AliEmcalTaskInstrumentation *>(obj);
+    if(!other) continue;
+    for(int istep = 0; istep < kNSteps; istep++) {
+      fNCalls[istep] += other->fNCalls[istep];
+      fCpuTime[istep] += other->fCpuTime[istep];
+      fRealTime[istep] += other->fRealTime[istep];
+      fMemoryGrowth[istep] += other->fMemoryGrowth[istep];
+      if(fHistLatency[istep] && other->fHistLatency[istep]) fHistLatency[istep]->Add(other->fHistLatency[istep]);
+    }
+    nmerged++;
+  }
+  return nmerged;
+}
+
+void AliEmcalTaskInstrumentation::Print(Option_t *) const {
+  std::cout << "Instrumentation " << GetName() << std::endl;
+  for(int istep = 0; istep < kNSteps; istep++) {
+    std::cout << "  " << GetStepName(static_cast<Step_t>(istep)) << ": " << fNCalls[istep] << " calls, CPU " << fCpuTime[istep]
+              << " s, wall " << fRealTime[istep] << " s (" << (fNCalls[istep] ? 1e3 * fRealTime[istep] / fNCalls[istep] : 0.)
+              << " ms/call), resident memory growth " << fMemoryGrowth[istep] << " kB" << std::endl;
+  }
+}
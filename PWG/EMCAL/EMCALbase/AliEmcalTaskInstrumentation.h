@@ -0,0 +1,163 @@
+/************************************************************************************
+ * Copyright (C) 2024, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#ifndef ALIEMCALTASKINSTRUMENTATION_H
+#define ALIEMCALTASKINSTRUMENTATION_H
+
+#include <TNamed.h>
+#include <TStopwatch.h>
+
+class TCollection;
+class TH1;
+
+namespace PWG {
+
+namespace EMCAL{
+
+/**
+ * @class AliEmcalTaskInstrumentation
+ * @brief Timing and memory book-keeping of the processing steps of an EMCAL analysis task
+ * @ingroup EMCALCOREFW
+ * @since Oct 15, 2026
+ *
+ * Records for the steps of AliAnalysisTaskEmcal::UserExec (RetrieveEventObjects, Run,
+ * FillHistograms and the full event) the number of calls, the cumulative CPU and wall
+ * time, the cumulative growth of the resident memory, and the per-call wall time
+ * (log10(t/s)) in a latency histogram. The object is added to the output list of the
+ * task and summed in the merging, independently of the \f$p_{t}\f$-hard scaling of
+ * AliEmcalList.
+ *
+ * The instrumentation is enabled for all tasks created afterwards via
+ *
+ * ~~~{.cxx}
+ * AliAnalysisTaskEmcal::SetInstrumentation(kTRUE);
+ * ~~~
+ */
+class AliEmcalTaskInstrumentation : public TNamed {
+public:
+  /**
+   * @enum Step_t
+   * @brief Instrumented processing steps
+   */
+  enum Step_t {
+    kRetrieveEventObjects = 0,      ///< AliAnalysisTaskEmcal::RetrieveEventObjects
+    kRun = 1,                       ///< AliAnalysisTaskEmcal::Run
+    kFillHistograms = 2,            ///< AliAnalysisTaskEmcal::FillHistograms
+    kEvent = 3,                     ///< Full AliAnalysisTaskEmcal::UserExec
+    kNSteps = 4                     ///< Number of steps
+  };
+
+  /**
+   * @class StepGuard
+   * @brief Measures a step for the lifetime of the guard (no-op for a null instrumentation)
+   */
+  class StepGuard {
+  public:
+    StepGuard(AliEmcalTaskInstrumentation *instrumentation, Step_t step) : fInstrumentation(instrumentation), fStep(step) { if(fInstrumentation) fInstrumentation->Start(fStep); }
+    ~StepGuard() { if(fInstrumentation) fInstrumentation->Stop(fStep); }
+  private:
+    StepGuard(const StepGuard &);
+    StepGuard &operator=(const StepGuard &);
+    AliEmcalTaskInstrumentation *fInstrumentation;
+    Step_t fStep;
+  };
+
+  /**
+   * @brief Dummy constructor, for ROOT I/O
+   */
+  AliEmcalTaskInstrumentation();
+
+  /**
+   * @brief Constructor, creating the latency histograms
+   * @param name Name of the object in the output list
+   */
+  AliEmcalTaskInstrumentation(const char *name);
+
+  /**
+   * @brief Destructor, deleting the latency histograms
+   */
+  virtual ~AliEmcalTaskInstrumentation();
+
+  /**
+   * @brief Start the measurement of a step
+   * @param step Step to be measured
+   */
+  void Start(Step_t step);
+
+  /**
+   * @brief Stop the measurement of a step and add it to the cumulative values
+   * @param step Step measured
+   */
+  void Stop(Step_t step);
+
+  /**
+   * @brief Sum the measurements of other instrumentation objects
+   * @param list Objects to be merged
+   * @return Number of merged objects
+   */
+  Long64_t Merge(TCollection *list);
+
+  /**
+   * @brief Print the cumulative values and the mean time per call of the steps
+   * @param option Not used
+   */
+  virtual void Print(Option_t *option = "") const;
+
+  Long64_t GetNCalls(Step_t step) const { return fNCalls[step]; }
+  Double_t GetCpuTime(Step_t step) const { return fCpuTime[step]; }
+  Double_t GetRealTime(Step_t step) const { return fRealTime[step]; }
+  Double_t GetMemoryGrowth(Step_t step) const { return fMemoryGrowth[step]; }
+  TH1 *GetLatencyHistogram(Step_t step) const { return fHistLatency[step]; }
+
+  /**
+   * @brief Name of a step
+   * @param step Step
+   * @return Name of the step
+   */
+  static const char *GetStepName(Step_t step);
+
+private:
+  AliEmcalTaskInstrumentation(const AliEmcalTaskInstrumentation &);
+  AliEmcalTaskInstrumentation &operator=(const AliEmcalTaskInstrumentation &);
+
+  Long64_t                    fNCalls[kNSteps];            ///< number of measured calls
+  Double_t                    fCpuTime[kNSteps];           ///< cumulative CPU time (s)
+  Double_t                    fRealTime[kNSteps];          ///< cumulative wall time (s)
+  Double_t                    fMemoryGrowth[kNSteps];      ///< cumulative growth of the resident memory (kB)
+  TH1                        *fHistLatency[kNSteps];       ///< wall time per call, log10(t/s)
+  TStopwatch                  fStopwatch[kNSteps];         //!<! stopwatches of the running steps
+  Long_t                      fMemoryStart[kNSteps];       //!<! resident memory at the start of the running steps (kB)
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalTaskInstrumentation, 1);
+  /// \endcond
+};
+
+}
+
+}
+
+#endif /* ALIEMCALTASKINSTRUMENTATION_H */
@@ -134,6 +134,11 @@ AliAODMCParticle* AliMCParticleContainer::GetNextMCParticle()
   return p;
 }
 
+TString AliMCParticleContainer::GetSelectionKey() const
+{
+  return AliParticleContainer::GetSelectionKey() + TString::Format(":%u:%g:%g:%g:%g", fMCFlag, fMinPtCharged, fMinPtNeutral, fMinECharged, fMinENeutral);
+}
+
 Bool_t AliMCParticleContainer::AcceptMCParticle(const AliAODMCParticle *vp, UInt_t &rejectionReason) const
 {
   // Return true if vp is accepted.
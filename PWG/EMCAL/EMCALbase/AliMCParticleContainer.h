@@ -68,6 +68,8 @@ class AliMCParticleContainer : public AliParticleContainer {
    */
   virtual ~AliMCParticleContainer(){;}
 
+  virtual TString             GetSelectionKey() const;
+
   /**
    * @brief Apply MC particle cuts, e.g. primary particle selection.
    * @param[in] vp Particle to be checked
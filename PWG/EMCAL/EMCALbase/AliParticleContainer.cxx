@@ -210,6 +210,11 @@ Bool_t AliParticleContainer::AcceptParticle(Int_t i, UInt_t &rejectionReason) co
   return ApplyKinematicCuts(mom, rejectionReason);
 }
 
+TString AliParticleContainer::GetSelectionKey() const
+{
+  return AliEmcalContainer::GetSelectionKey() + TString::Format(":%g:%d:%d", fMinDistanceTPCSectorEdge, static_cast<Int_t>(fChargeCut), fGeneratorIndex);
+}
+
 Bool_t AliParticleContainer::ApplyParticleCuts(const AliVParticle* vp, UInt_t &rejectionReason) const
 {
   if (!vp) {
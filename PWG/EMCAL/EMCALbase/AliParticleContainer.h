@@ -72,6 +72,8 @@ class AliParticleContainer : public AliEmcalContainer {
    */
   virtual ~AliParticleContainer(){;}
 
+  virtual TString             GetSelectionKey() const;
+
   /**
    * @brief Index operator 
    * @param[in] index Index of the particle in the array
@@ -66,6 +66,34 @@ AliPicoTrack &AliPicoTrack::operator=(const AliPicoTrack &pc)
   return *this;
 }
 
+//_________________________________________________________________________________________________
+void AliPicoTrack::Set(Double_t pt, Double_t eta, Double_t phi, Byte_t q, Int_t lab, Byte_t type,
+                       Double_t etaemc, Double_t phiemc, Double_t ptemc, Bool_t ise, Double_t mass)
+{
+  // Overwrite the full content as the constructor with the same arguments,
+  // to reuse constructed objects in a TClonesArray (ConstructedAt) instead of
+  // destructing and constructing them in every event.
+
+  SetUniqueID(0);
+  ResetBit(kHasUUID);
+  ResetBit(kIsReferenced);
+  fPt             = pt;
+  fEta            = eta;
+  fPhi            = phi;
+  fM              = mass;
+  fQ              = q;
+  fLabel          = lab;
+  fTrackType      = type;
+  fEtaEmc         = etaemc;
+  fPhiEmc         = phiemc;
+  fPtEmc          = ptemc;
+  fEmcal          = ise;
+  fFlag           = 0;
+  fGeneratorIndex = -1;
+  fClusId         = -1;
+  fOrig           = 0;
+}
+
 //_________________________________________________________________________________________________
 Int_t AliPicoTrack::Compare(const TObject* obj) const
 {
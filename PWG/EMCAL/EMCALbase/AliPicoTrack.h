@@ -17,6 +17,9 @@ class AliPicoTrack: public AliVTrack {
   AliPicoTrack(const AliPicoTrack &pc); 
   AliPicoTrack &operator=(const AliPicoTrack &pc);
 
+  void            Set(Double_t pt, Double_t eta, Double_t phi, Byte_t q, Int_t label, Byte_t type,
+                      Double_t etaemc=0, Double_t phiemc=0, Double_t ptemc=0, Bool_t ise=0, Double_t mass=0.13957);
+
   Double_t        Px()                        const { return fPt*TMath::Cos(fPhi);  }
   Double_t        Py()                        const { return fPt*TMath::Sin(fPhi);  }
   Double_t        Pz()                        const { return fPt*TMath::SinH(fEta); }
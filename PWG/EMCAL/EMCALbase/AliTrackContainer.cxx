@@ -26,8 +26,12 @@
  ************************************************************************************/
 #include <bitset>
 #include <iostream>
+#include <map>
+#include <string>
+#include <vector>
 #include <TClonesArray.h>
 
+#include "AliAnalysisManager.h"
 #include "AliAODEvent.h"
 #include "AliESDEvent.h"
 #include "AliVEvent.h"
@@ -45,6 +49,27 @@
 
 ClassImp(AliTrackContainer);
 
+namespace {
+  /// Track selection result shared between track containers with the same selection on the same input array
+  struct SharedTrackSelection {
+    const TClonesArray      *fArray;   ///< input array the selection was run on
+    const AliVEvent         *fEvent;   ///< event the selection was run for
+    Long64_t                 fEntry;   ///< current entry of the analysis manager when the selection was run
+    std::vector<AliVTrack *> fTracks;  ///< tracks as provided by the track selection
+    std::vector<Char_t>      fTypes;   ///< track types (kRejected for rejected tracks)
+  };
+
+  std::map<std::string, SharedTrackSelection> &SharedTrackSelections() {
+    static std::map<std::string, SharedTrackSelection> selections;
+    return selections;
+  }
+
+  Long64_t CurrentEntry() {
+    AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+    return mgr ? mgr->GetCurrentEntry() : -1;
+  }
+}
+
 TString AliTrackContainer::fgDefTrackCutsPeriod = "";
 
 // string to enum map for use with the %YAML config
@@ -69,6 +94,7 @@ AliTrackContainer::AliTrackContainer():
   fAODFilterBits(0),
   fTrackCutsPeriod(),
   fEmcalTrackSelection(0),
+  fShareTrackSelection(kTRUE),
   fFilteredTracks(),
   fTrackTypes(5000)
 {
@@ -86,6 +112,7 @@ AliTrackContainer::AliTrackContainer(const char *name, const char *period):
   fAODFilterBits(0),
   fTrackCutsPeriod(period),
   fEmcalTrackSelection(0),
+  fShareTrackSelection(kTRUE),
   fFilteredTracks(),
   fTrackTypes(5000)
 {
@@ -166,8 +193,6 @@ void AliTrackContainer::NextEvent(const AliVEvent * event)
 
   fTrackTypes.Reset(kUndefined);
   if (fEmcalTrackSelection) {
-    auto acceptedTracks = fEmcalTrackSelection->GetAcceptedTracks(fClArray);
-
     TObjArray *trackarray(fFilteredTracks.GetData());
     if(!trackarray){
       trackarray = new TObjArray;
@@ -178,6 +203,31 @@ void AliTrackContainer::NextEvent(const AliVEvent * event)
       trackarray->Clear();
     }
 
+    // Containers with the same pre-defined track selection on the same input array
+    // share the result of the first container processing the event
+    SharedTrackSelection *shared = nullptr;
+    Long64_t entry = CurrentEntry();
+    if (fShareTrackSelection && fTrackFilterType != AliEmcalTrackSelection::kCustomTrackFilter && entry >= 0) {
+      shared = &(SharedTrackSelections()[GetTrackSelectionKey()]);
+      if (shared->fArray == fClArray && shared->fEvent == event && shared->fEntry == entry) {
+        Int_t ntracks = shared->fTypes.size();
+        if (ntracks > fTrackTypes.GetSize()) fTrackTypes.Set(ntracks * 2);
+        for (Int_t i = 0; i < ntracks; i++) {
+          trackarray->AddLast(shared->fTracks[i]);
+          fTrackTypes[i] = shared->fTypes[i];
+        }
+        AliDebugStream(1) << "Track selection shared from previous container (" << ntracks << " tracks)" << std::endl;
+        return;
+      }
+      shared->fArray = fClArray;
+      shared->fEvent = event;
+      shared->fEntry = entry;
+      shared->fTracks.clear();
+      shared->fTypes.clear();
+    }
+
+    auto acceptedTracks = fEmcalTrackSelection->GetAcceptedTracks(fClArray);
+
     int naccepted(0), nrejected(0), nhybridTracks1(0), nhybridTracks2a(0), nhybridTracks2b(0), nhybridTracks3(0);
     Int_t i = 0;
     for(auto accresult : *acceptedTracks) {
@@ -216,6 +266,10 @@ void AliTrackContainer::NextEvent(const AliVEvent * event)
           };
         }
       }
+      if (shared) {
+        shared->fTracks.push_back(vTrack);
+        shared->fTypes.push_back(fTrackTypes[i]);
+      }
      i++;
     }
     AliDebugStream(1) << "Accepted: " << naccepted << ", Rejected: " << nrejected << ", hybrid: (" << nhybridTracks1 << " | [" << nhybridTracks2a << " | " << nhybridTracks2b  << "] | " << nhybridTracks3 << ")" << std::endl;
@@ -476,6 +530,21 @@ AliVCuts* AliTrackContainer::GetTrackCuts(Int_t icut)
   return NULL;
 }
 
+TString AliTrackContainer::GetSelectionKey() const {
+  TString key = AliParticleContainer::GetSelectionKey() + TString::Format(":%d:%u:%s:%d:%d", static_cast<int>(fTrackFilterType), fAODFilterBits,
+      fTrackCutsPeriod.Data(), fSelectionModeAny, fITSHybridTrackDistinction);
+  // the parameters of custom cut objects are not known here: only the same cut objects give the same key
+  if (fListOfCuts) {
+    for (Int_t icut = 0; icut < fListOfCuts->GetEntries(); icut++) key += TString::Format(":%p", static_cast<const void *>(fListOfCuts->At(icut)));
+  }
+  return key;
+}
+
+TString AliTrackContainer::GetTrackSelectionKey() const {
+  return TString::Format("%p_%s_%d_%s", static_cast<const void *>(fClArray), fLoadedClass ? fLoadedClass->GetName() : "",
+                         static_cast<int>(fTrackFilterType), fTrackCutsPeriod.Data());
+}
+
 bool AliTrackContainer::IsHybridTrackSelection() const {
   return (fTrackFilterType == AliEmcalTrackSelection::kHybridTracks) ||
          (fTrackFilterType == AliEmcalTrackSelection::kHybridTracks2010wNoRefit) ||
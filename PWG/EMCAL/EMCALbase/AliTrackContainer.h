@@ -179,6 +179,8 @@ class AliTrackContainer : public AliParticleContainer {
    */
   virtual ~AliTrackContainer(){;}
 
+  virtual TString             GetSelectionKey() const;
+
   /**
    * @brief Select track based on track cuts in container
    * @param[in] vp Track to be checked
@@ -439,6 +441,19 @@ class AliTrackContainer : public AliParticleContainer {
 
   void                        SetTrackCutsPeriod(const char* period)            { fTrackCutsPeriod = period; }
 
+  /**
+   * @brief Share the track selection result with other containers
+   * @param[in] doShare If true (default) the selection result is shared
+   *
+   * Containers with the same pre-defined track filter type and period on the
+   * same input array run the track selection only once per event: the first
+   * container processing the event stores the accepted tracks and their track
+   * types, the following containers copy them. Custom track selections are
+   * never shared.
+   */
+  void                        SetShareTrackSelection(Bool_t doShare)            { fShareTrackSelection = doShare; }
+  Bool_t                      IsShareTrackSelection()                     const { return fShareTrackSelection; }
+
   /**
    * @brief Add new track cuts to the container.
    * @param[in] cuts Cuts to be  added
@@ -538,6 +553,12 @@ class AliTrackContainer : public AliParticleContainer {
 
   PWG::EMCAL::AliEmcalTrackSelResultHybrid::HybridType_t  GetHybridDefinition(const PWG::EMCAL::AliEmcalTrackSelResultPtr &selectionResult) const;
 
+  /**
+   * @brief Key identifying the track selection configuration on the input array
+   * @return Key built from input array, track class, filter type and period
+   */
+  TString                     GetTrackSelectionKey() const;
+
   static TString              fgDefTrackCutsPeriod;           //!<! default period string used to generate track cuts
 
   ETrackFilterType_t          fTrackFilterType;               ///< track filter type
@@ -547,6 +568,7 @@ class AliTrackContainer : public AliParticleContainer {
   UInt_t                      fAODFilterBits;                 ///< track filter bits
   TString                     fTrackCutsPeriod;               ///< period string used to generate track cuts
   AliEmcalTrackSelection     *fEmcalTrackSelection;  //!<! track selection object
+  Bool_t                      fShareTrackSelection;           ///< share the selection result with containers using the same selection
   TrackOwnerHandler           fFilteredTracks;                //!<! tracks filtered using fEmcalTrackSelection
   TArrayC                     fTrackTypes;                    //!<! track types
 
@@ -554,7 +576,7 @@ class AliTrackContainer : public AliParticleContainer {
   AliTrackContainer(const AliTrackContainer& obj); // copy constructor
   AliTrackContainer& operator=(const AliTrackContainer& other); // assignment
 
-  ClassDef(AliTrackContainer,1);
+  ClassDef(AliTrackContainer,2);
 };
 
 #endif
@@ -35,6 +35,7 @@
 #pragma link C++ namespace PWG;
 #pragma link C++ namespace PWG::EMCAL;
 #pragma link C++ class PWG::EMCAL::AliEmcalDownscaleFactorsOCDB+;
+#pragma link C++ class PWG::EMCAL::AliEmcalTaskInstrumentation+;
 #pragma link C++ class PWG::EMCAL::AliEmcalTrackSelResultPtr+;
 #pragma link C++ class PWG::EMCAL::AliEmcalTrackSelResultUserPtr+;
 #pragma link C++ class PWG::EMCAL::AliEmcalTrackSelResultUserStorage+;
@@ -203,8 +203,9 @@ void AliEmcalClusTrackMatcherTask::GenerateEmcalParticles()
   AliParticleContainer *tracks = GetParticleContainer(0);
   AliClusterContainer *clusters = GetClusterContainer(0);
 
-  fEmcalTracks->Delete();
-  fEmcalClusters->Delete();
+  // The particles are only used within the event: keep them constructed and overwrite them with Set
+  fEmcalTracks->Clear();
+  fEmcalClusters->Clear();
 
   fNEmcalTracks = 0;
   fNEmcalClusters = 0;
@@ -234,8 +235,8 @@ void AliEmcalClusTrackMatcherTask::GenerateEmcalParticles()
     }
 
     // Create AliEmcalParticle objects to handle the matching
-    AliEmcalParticle* emcalCluster = new ((*fEmcalClusters)[fNEmcalClusters])
-          AliEmcalParticle(cluster, clusters->GetCurrentID(), fVertex[0], fVertex[1], fVertex[2], AliVCluster::kNonLinCorr);
+    AliEmcalParticle* emcalCluster = static_cast<AliEmcalParticle*>(fEmcalClusters->ConstructedAt(fNEmcalClusters));
+    emcalCluster->Set(cluster, clusters->GetCurrentID(), fVertex[0], fVertex[1], fVertex[2], AliVCluster::kNonLinCorr);
     emcalCluster->SetMatchedPtr(fEmcalTracks);
 
     fNEmcalClusters++;
@@ -264,7 +265,8 @@ void AliEmcalClusTrackMatcherTask::GenerateEmcalParticles()
     if (propthistrack) AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(track, fPropDist);
 
     // Create AliEmcalParticle objects to handle the matching
-    AliEmcalParticle* emcalTrack = new ((*fEmcalTracks)[fNEmcalTracks]) AliEmcalParticle(track, tracks->GetCurrentID());
+    AliEmcalParticle* emcalTrack = static_cast<AliEmcalParticle*>(fEmcalTracks->ConstructedAt(fNEmcalTracks));
+    emcalTrack->Set(track, tracks->GetCurrentID());
     emcalTrack->SetMatchedPtr(fEmcalClusters);
 
     AliDebug(2, Form("Now adding track (pT = %.3f, eta = %.3f, phi = %.3f)"
@@ -94,13 +94,37 @@ void AliEmcalCorrectionCellBadChannel::UserCreateOutputObjects()
 Bool_t AliEmcalCorrectionCellBadChannel::Run()
 {
   AliEmcalCorrectionComponent::Run();
+
+  Bool_t runChanged = kFALSE;
+  if (!PrepareCellCorrection(runChanged)) return kFALSE;
+
+  // mark the cells not recalibrated
+  fRecoUtils->ResetCellsCalibrated();
+
+  FillCellCorrectionQA(kFALSE); // "before" QA
+  
+  // CELL RECALIBRATION -------------------------------------------------------
+  // update cell objects
+  UpdateCells();
   
+  FillCellCorrectionQA(kTRUE); // "after" QA
+
+  return kTRUE;
+}
+
+/**
+ * Check the event and configure the reco utils for the bad channel removal.
+ * Shared by Run() and the fused cell correction (AliEmcalCorrectionCellPipeline).
+ */
+Bool_t AliEmcalCorrectionCellBadChannel::PrepareCellCorrection(Bool_t & runChanged)
+{
+  runChanged = kFALSE;
   if (!fEventManager.InputEvent()) {
     AliError("Event ptr = 0, returning");
     return kFALSE;
   }
   
-  CheckIfRunChanged();
+  runChanged = CheckIfRunChanged();
   
   // CONFIGURE THE RECO UTILS -------------------------------------------------
 
@@ -113,23 +137,19 @@ Bool_t AliEmcalCorrectionCellBadChannel::Run()
     AliWarning(Form("Number of EMCAL cells = %d, returning", fCaloCells->GetNumberOfCells()));
     return kFALSE;
   }
-  
-  // mark the cells not recalibrated
-  fRecoUtils->ResetCellsCalibrated();
-
-  if(fCreateHisto)
-    FillCellQA(fCellEnergyDistBefore); // "before" QA
-  
-  // CELL RECALIBRATION -------------------------------------------------------
-  // update cell objects
-  UpdateCells();
-  
-  if(fCreateHisto)
-    FillCellQA(fCellEnergyDistAfter); // "after" QA
 
   return kTRUE;
 }
 
+/**
+ * Fill the cell energy distribution before or after the correction.
+ */
+void AliEmcalCorrectionCellBadChannel::FillCellCorrectionQA(Bool_t afterCorrection)
+{
+  if(fCreateHisto)
+    FillCellQA(afterCorrection ? fCellEnergyDistAfter : fCellEnergyDistBefore);
+}
+
 /**
  * This function is called if the run changes (it inherits from the base component),
  * to load a new bad channel and fill relevant variables.
@@ -32,6 +32,11 @@ class AliEmcalCorrectionCellBadChannel : public AliEmcalCorrectionComponent {
   void UserCreateOutputObjects();
   Bool_t Run();
   Bool_t CheckIfRunChanged();
+
+  // Fused cell correction
+  Bool_t SupportsFusedCellCorrection() const { return kTRUE; }
+  Bool_t PrepareCellCorrection(Bool_t & runChanged);
+  void FillCellCorrectionQA(Bool_t afterCorrection);
   
 protected:
   TH1F* fCellEnergyDistBefore;              //!<! cell energy distribution, before bad channel correction
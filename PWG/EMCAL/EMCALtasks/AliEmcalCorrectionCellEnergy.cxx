@@ -121,12 +121,39 @@ Bool_t AliEmcalCorrectionCellEnergy::Run()
 {
   AliEmcalCorrectionComponent::Run();
 
+  Bool_t runChanged = kFALSE;
+  if (!PrepareCellCorrection(runChanged)) return kFALSE;
+
+  // mark the cells not recalibrated
+  fRecoUtils->ResetCellsCalibrated();
+
+
+  FillCellCorrectionQA(kFALSE); // "before" QA
+
+  // CELL RECALIBRATION -------------------------------------------------------
+  // update cell objects
+  UpdateCells();
+
+  FillCellCorrectionQA(kTRUE); // "after" QA
+
+  FinishCellCorrection();
+
+  return kTRUE;
+}
+
+/**
+ * Check the event and configure the reco utils for the energy recalibration.
+ * Shared by Run() and the fused cell correction (AliEmcalCorrectionCellPipeline).
+ */
+Bool_t AliEmcalCorrectionCellEnergy::PrepareCellCorrection(Bool_t & runChanged)
+{
+  runChanged = kFALSE;
   if (!fEventManager.InputEvent()) {
     AliError("Event ptr = 0, returning");
     return kFALSE;
   }
 
-  CheckIfRunChanged();
+  runChanged = CheckIfRunChanged();
 
   // CONFIGURE THE RECO UTILS -------------------------------------------------
   fRecoUtils->SwitchOnRecalibration();
@@ -139,26 +166,27 @@ Bool_t AliEmcalCorrectionCellEnergy::Run()
     return kFALSE;
   }
 
-  // mark the cells not recalibrated
-  fRecoUtils->ResetCellsCalibrated();
-
-
-  if(fCreateHisto)
-    FillCellQA(fCellEnergyDistBefore); // "before" QA
-
-  // CELL RECALIBRATION -------------------------------------------------------
-  // update cell objects
-  UpdateCells();
-
-  if(fCreateHisto)
-    FillCellQA(fCellEnergyDistAfter); // "after" QA
+  return kTRUE;
+}
 
+/**
+ * Switch off the recalibration after the cells were updated.
+ */
+void AliEmcalCorrectionCellEnergy::FinishCellCorrection()
+{
   // switch off recalibrations so those are not done multiple times
   // this is just for safety, the recalibrated flag of cell object
   // should not allow for farther processing anyways
   fRecoUtils->SwitchOffRecalibration();
+}
 
-  return kTRUE;
+/**
+ * Fill the cell energy distribution before or after the correction.
+ */
+void AliEmcalCorrectionCellEnergy::FillCellCorrectionQA(Bool_t afterCorrection)
+{
+  if(fCreateHisto)
+    FillCellQA(afterCorrection ? fCellEnergyDistAfter : fCellEnergyDistBefore);
 }
 
 /**
@@ -34,6 +34,12 @@ class AliEmcalCorrectionCellEnergy : public AliEmcalCorrectionComponent {
   Bool_t Run();
   Bool_t CheckIfRunChanged();
 
+  // Fused cell correction
+  Bool_t SupportsFusedCellCorrection() const { return kTRUE; }
+  Bool_t PrepareCellCorrection(Bool_t & runChanged);
+  void FinishCellCorrection();
+  void FillCellCorrectionQA(Bool_t afterCorrection);
+
 protected:
   TH1F* fCellEnergyDistBefore;        //!<! cell energy distribution, before energy calibration
   TH1F* fCellEnergyDistAfter;         //!<! cell energy distribution, after energy calibration
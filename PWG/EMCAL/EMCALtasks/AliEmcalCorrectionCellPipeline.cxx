@@ -0,0 +1,297 @@
+// AliEmcalCorrectionCellPipeline
+//
+
+#include "AliEmcalCorrectionCellPipeline.h"
+
+#include <AliLog.h>
+#include <AliVEvent.h>
+#include <AliVCaloCells.h>
+#include <AliEMCALGeometry.h>
+#include <AliEMCALRecoUtils.h>
+
+#include "AliEmcalCorrectionComponent.h"
+
+/// \cond CLASSIMP
+ClassImp(AliEmcalCorrectionCellPipeline);
+/// \endcond
+
+/// Number of bunch crossing phases in the time lookup table: bc%4, and one for bc < 0
+static const Int_t kNBCPhases = 5;
+
+/**
+ * Default constructor
+ */
+AliEmcalCorrectionCellPipeline::AliEmcalCorrectionCellPipeline() :
+  TObject(),
+  fStages(),
+  fGeom(0),
+  fNChannels(0),
+  fSuperModule(),
+  fProbeCells(),
+  fAbsId(),
+  fAmplitude(),
+  fTime(),
+  fMCLabel(),
+  fEFraction(),
+  fHighGain()
+{
+  fProbeCells.SetType(AliVCaloCells::kEMCALCell);
+  fProbeCells.CreateContainer(1);
+}
+
+/**
+ * Check whether a component can be executed as a stage of the pipeline. This requires
+ * that its full cell correction is done in AliEMCALRecoUtils::RecalibrateCells(), and
+ * that the gain information of the cells is not modified by the reco utils.
+ *
+ * @param[in] component Cell correction component
+ * @return True if the component can be added to a pipeline
+ */
+Bool_t AliEmcalCorrectionCellPipeline::CanBeFused(AliEmcalCorrectionComponent * component)
+{
+  if (!component || !component->SupportsFusedCellCorrection()) return kFALSE;
+  if (!component->GetCaloCells()) return kFALSE;
+
+  AliEMCALRecoUtils * recoUtils = component->GetRecoUtils();
+  if (!recoUtils || recoUtils->IsDetermineLowGainOn()) return kFALSE;
+
+  return kTRUE;
+}
+
+/**
+ * Add a component at the end of the pipeline. All the stages have to correct the same cells.
+ *
+ * @param[in] component Cell correction component
+ */
+void AliEmcalCorrectionCellPipeline::AddStage(AliEmcalCorrectionComponent * component)
+{
+  if (!CanBeFused(component)) {
+    AliError(Form("Component %s cannot be executed in the fused cell correction!", component ? component->GetName() : ""));
+    return;
+  }
+  if (fStages.size() && component->GetCaloCells() != GetCaloCells()) {
+    AliError(Form("Component %s does not correct the same cells as the other stages!", component->GetName()));
+    return;
+  }
+
+  Stage stage;
+  stage.fComponent = component;
+  stage.fProcess = kFALSE;
+  stage.fActive = kFALSE;
+  stage.fRun = -1;
+  fStages.push_back(stage);
+}
+
+/**
+ * @return Cells corrected by the pipeline
+ */
+AliVCaloCells * AliEmcalCorrectionCellPipeline::GetCaloCells() const
+{
+  return fStages.size() ? fStages.front().fComponent->GetCaloCells() : nullptr;
+}
+
+/**
+ * Same condition as in AliEMCALRecoUtils::RecalibrateCells() for the cells to be modified.
+ */
+Bool_t AliEmcalCorrectionCellPipeline::IsActive(AliEMCALRecoUtils * recoUtils) const
+{
+  return recoUtils->IsRecalibrationOn() || recoUtils->IsTimeRecalibrationOn() || recoUtils->IsL1PhaseInTimeRecalibrationOn() ||
+         recoUtils->IsBadChannelsRemovalSwitchedOn() || recoUtils->IsSingleChannelRecalibrationOn();
+}
+
+/**
+ * Build the per-channel lookup tables of a stage. Each channel is evaluated with a single
+ * probe cell of unit amplitude and zero time through AliEMCALRecoUtils::AcceptCalibrateCell(),
+ * for both gains and all bunch crossing phases. The corrections which depend on the cell
+ * energy or on the event (time vs energy, shaper non-linearity, L1 phase) are switched off
+ * while probing, and applied in ApplyStage().
+ *
+ * @param[in,out] stage Stage for which the tables are built
+ * @param[in] run Current run number
+ */
+void AliEmcalCorrectionCellPipeline::BuildLookupTables(Stage & stage, Int_t run)
+{
+  fGeom = AliEMCALGeometry::GetInstance();
+  if (!fGeom) {
+    AliFatal("No instance of the geometry is available");
+    return;
+  }
+
+  const Int_t nSM = fGeom->GetNumberOfSuperModules();
+  fNChannels = 24*48*nSM;
+  fSuperModule.resize(fNChannels);
+  for (Int_t absId = 0; absId < fNChannels; absId++) {
+    Int_t iSM = fGeom->GetSuperModuleNumber(absId);
+    fSuperModule[absId] = iSM >= 0 && iSM < nSM ? iSM : 0;
+  }
+
+  AliEMCALRecoUtils * recoUtils = stage.fComponent->GetRecoUtils();
+  const Bool_t timeVsE = recoUtils->IsTimeECorrectionOn();
+  const Bool_t l1Phase = recoUtils->IsL1PhaseInTimeRecalibrationOn();
+  const Bool_t shaperNonLin = recoUtils->IsTowerShaperNonlinarityCorrectionOn();
+  recoUtils->SwitchOffTimeECorrection();
+  recoUtils->SwitchOffL1PhaseInTimeRecalibration();
+  recoUtils->SetUseTowerShaperNonlinarityCorrection(kFALSE);
+  recoUtils->ResetCellsCalibrated();
+
+  stage.fBad.assign(fNChannels, 0);
+  stage.fEnergyScale.assign(fNChannels, 0.);
+  stage.fTimeShift.assign(kNBCPhases*2*fNChannels, 0.);
+  stage.fL1PhaseShift.assign(nSM, 0.);
+
+  Float_t amp = 0.;
+  Double_t time = 0.;
+  for (Int_t absId = 0; absId < fNChannels; absId++) {
+    for (Int_t lowGain = 0; lowGain < 2; lowGain++) {
+      for (Int_t bcPhase = 0; bcPhase < kNBCPhases; bcPhase++) {
+        fProbeCells.SetCell(0, absId, 1., 0., -1, 0., !lowGain);
+        Bool_t accept = recoUtils->AcceptCalibrateCell(absId, bcPhase < 4 ? bcPhase : -1, amp, time, &fProbeCells);
+        if (!lowGain && bcPhase == 0) {
+          stage.fBad[absId] = !accept;
+          stage.fEnergyScale[absId] = accept ? amp : 0.;
+        }
+        stage.fTimeShift[(2*bcPhase + lowGain)*fNChannels + absId] = accept ? -time : 0.;
+      }
+    }
+  }
+
+  if (timeVsE) recoUtils->SwitchOnTimeECorrection();
+  if (l1Phase) recoUtils->SwitchOnL1PhaseInTimeRecalibration();
+  recoUtils->SetUseTowerShaperNonlinarityCorrection(shaperNonLin);
+
+  stage.fRun = run;
+  AliDebug(2, Form("Built cell lookup tables of %s for run %d (%d channels)", stage.fComponent->GetName(), run, fNChannels));
+}
+
+/**
+ * Apply the correction of one stage to the flat copy of the cells.
+ *
+ * @param[in,out] stage Stage to be applied
+ * @param[in] bc Bunch crossing number of the event
+ */
+void AliEmcalCorrectionCellPipeline::ApplyStage(Stage & stage, Int_t bc)
+{
+  AliEMCALRecoUtils * recoUtils = stage.fComponent->GetRecoUtils();
+  const Bool_t shaperNonLin = recoUtils->IsTowerShaperNonlinarityCorrectionOn() && recoUtils->IsRecalibrationOn();
+  const Bool_t timeVsE = recoUtils->IsTimeECorrectionOn();
+  const Bool_t l1Phase = recoUtils->IsL1PhaseInTimeRecalibrationOn() && bc >= 0;
+
+  if (l1Phase) {
+    for (UInt_t iSM = 0; iSM < stage.fL1PhaseShift.size(); iSM++) {
+      Double_t shift = 0.;
+      recoUtils->RecalibrateCellTimeL1Phase(iSM, bc, shift, recoUtils->GetCurrentParNumber());
+      stage.fL1PhaseShift[iSM] = -shift;
+    }
+  }
+
+  const Int_t bcPhase = bc >= 0 ? bc%4 : 4;
+  const UChar_t * bad = stage.fBad.data();
+  const Float_t * energyScale = stage.fEnergyScale.data();
+  const Double_t * timeShiftHG = stage.fTimeShift.data() + (2*bcPhase)*fNChannels;
+  const Double_t * timeShiftLG = stage.fTimeShift.data() + (2*bcPhase + 1)*fNChannels;
+  const Double_t * l1PhaseShift = stage.fL1PhaseShift.data();
+
+  const Int_t nCells = fAbsId.size();
+  for (Int_t iCell = 0; iCell < nCells; iCell++) {
+    const Int_t absId = fAbsId[iCell];
+    if (absId < 0 || absId >= fNChannels || bad[absId]) {
+      fAmplitude[iCell] = 0;
+      fTime[iCell] = -1;
+      continue;
+    }
+
+    const Bool_t isLowGain = !fHighGain[iCell];
+    Float_t amp = fAmplitude[iCell];
+    if (shaperNonLin && isLowGain) amp = recoUtils->CorrectShaperNonLin(amp, 1.);
+    amp *= energyScale[absId];
+
+    Double_t time = fTime[iCell];
+    if (timeVsE) recoUtils->CorrectCellTimeVsE(amp, time, isLowGain);
+    time -= isLowGain ? timeShiftLG[absId] : timeShiftHG[absId];
+    if (l1Phase) time -= l1PhaseShift[fSuperModule[absId]];
+
+    fAmplitude[iCell] = amp;
+    fTime[iCell] = time;
+  }
+}
+
+/**
+ * Execute all stages on the cells of the current event. The cells are copied once into flat
+ * arrays, corrected by each stage in turn, and written back once.
+ *
+ * @return True if the cells were corrected
+ */
+Bool_t AliEmcalCorrectionCellPipeline::Run()
+{
+  AliVCaloCells * cells = GetCaloCells();
+  if (!cells) return kFALSE;
+
+  // Configure the stages as their Run() would do
+  Bool_t process = kFALSE;
+  Int_t bc = -1;
+  for (auto & stage : fStages) {
+    AliEmcalCorrectionComponent * component = stage.fComponent;
+    component->AliEmcalCorrectionComponent::Run();
+
+    Bool_t runChanged = kFALSE;
+    stage.fProcess = component->PrepareCellCorrection(runChanged);
+    if (!stage.fProcess) continue;
+    process = kTRUE;
+
+    AliEMCALRecoUtils * recoUtils = component->GetRecoUtils();
+    component->UpdateRecoUtilsParNumber();
+    recoUtils->ResetCellsCalibrated();
+    stage.fActive = IsActive(recoUtils);
+
+    AliVEvent * event = component->GetInputEvent();
+    bc = event->GetBunchCrossNumber();
+    if (stage.fActive && (runChanged || stage.fRun != event->GetRunNumber())) {
+      BuildLookupTables(stage, event->GetRunNumber());
+    }
+  }
+  if (!process) return kFALSE;
+
+  for (auto & stage : fStages) {
+    if (stage.fProcess) stage.fComponent->FillCellCorrectionQA(kFALSE);
+  }
+
+  // Copy the cells
+  const Int_t nCells = cells->GetNumberOfCells();
+  fAbsId.resize(nCells);
+  fAmplitude.resize(nCells);
+  fTime.resize(nCells);
+  fMCLabel.resize(nCells);
+  fEFraction.resize(nCells);
+  fHighGain.resize(nCells);
+  Short_t absId = -1;
+  Double_t amp = 0., time = 0., efrac = 0.;
+  Int_t mclabel = -1;
+  for (Int_t iCell = 0; iCell < nCells; iCell++) {
+    cells->GetCell(iCell, absId, amp, time, mclabel, efrac);
+    fAbsId[iCell] = absId;
+    fAmplitude[iCell] = amp;
+    fTime[iCell] = time;
+    fMCLabel[iCell] = mclabel;
+    fEFraction[iCell] = efrac;
+    fHighGain[iCell] = cells->GetCellHighGain(absId);
+  }
+
+  for (auto & stage : fStages) {
+    if (stage.fProcess && stage.fActive) ApplyStage(stage, bc);
+  }
+
+  // Write back the cells
+  for (Int_t iCell = 0; iCell < nCells; iCell++) {
+    cells->SetCell(iCell, fAbsId[iCell], fAmplitude[iCell], fTime[iCell], fMCLabel[iCell], fEFraction[iCell], fHighGain[iCell]);
+  }
+  cells->Sort();
+
+  for (auto & stage : fStages) {
+    if (!stage.fProcess) continue;
+    if (stage.fActive) stage.fComponent->GetRecoUtils()->SetCellsCalibrated();
+    stage.fComponent->FillCellCorrectionQA(kTRUE);
+    stage.fComponent->FinishCellCorrection();
+  }
+
+  return kTRUE;
+}
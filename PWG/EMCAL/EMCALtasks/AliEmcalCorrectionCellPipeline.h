@@ -0,0 +1,95 @@
+#ifndef ALIEMCALCORRECTIONCELLPIPELINE_H
+#define ALIEMCALCORRECTIONCELLPIPELINE_H
+
+#include <vector>
+
+#include <TObject.h>
+#include <AliAODCaloCells.h>
+
+class AliEMCALGeometry;
+class AliEMCALRecoUtils;
+class AliVCaloCells;
+class AliEmcalCorrectionComponent;
+
+/**
+ * @class AliEmcalCorrectionCellPipeline
+ * @ingroup EMCALCORRECTIONFW
+ * @brief Fused execution of consecutive cell correction components
+ *
+ * Cell components such as AliEmcalCorrectionCellBadChannel, AliEmcalCorrectionCellEnergy and
+ * AliEmcalCorrectionCellTimeCalib each loop over all cells through AliEMCALRecoUtils::RecalibrateCells(),
+ * looking up the calibration maps cell by cell. The pipeline instead executes a sequence of such
+ * components (stages) in one pass over flat arrays of absId, amplitude, time and gain, which are
+ * written back to the cells once at the end.
+ *
+ * For each stage the reco utils are evaluated once per run for all channels and all bunch
+ * crossing phases, giving per-channel lookup tables for the bad channel flag, the energy calibration
+ * factor and the time shift. The L1 phase shift is evaluated once per event and supermodule. The
+ * energy dependent corrections (time vs energy, shaper non-linearity of low gain cells) are applied
+ * per cell through the reco utils.
+ *
+ * Components using the low gain determination from the ADC value cannot be fused, since it modifies
+ * the gain information before the calibration. The task does not add them to a pipeline.
+ *
+ * Since the cells are only written back after the last stage, the QA histograms of the components
+ * are filled with the cells before the first and after the last stage of the pipeline.
+ */
+class AliEmcalCorrectionCellPipeline : public TObject {
+ public:
+  AliEmcalCorrectionCellPipeline();
+  virtual ~AliEmcalCorrectionCellPipeline() {}
+
+  static Bool_t CanBeFused(AliEmcalCorrectionComponent * component);
+
+  void AddStage(AliEmcalCorrectionComponent * component);
+  UInt_t GetNumberOfStages() const { return fStages.size(); }
+  AliEmcalCorrectionComponent * GetStage(UInt_t i) const { return i < fStages.size() ? fStages[i].fComponent : nullptr; }
+  AliEmcalCorrectionComponent * GetLastStage() const { return fStages.size() ? fStages.back().fComponent : nullptr; }
+  AliVCaloCells * GetCaloCells() const;
+
+  Bool_t Run();
+
+ protected:
+  /**
+   * @struct Stage
+   * @brief Lookup tables of one cell correction component
+   */
+  struct Stage {
+    AliEmcalCorrectionComponent  *fComponent;      ///< Component executed by the stage
+    Bool_t                        fProcess;        ///< Stage applied in the current event
+    Bool_t                        fActive;         ///< If false the reco utils do not change the cells
+    Int_t                         fRun;            ///< Run for which the tables were built
+    std::vector<UChar_t>          fBad;            ///< Channel rejected (by absId)
+    std::vector<Float_t>          fEnergyScale;    ///< Energy calibration factor (by absId)
+    std::vector<Double_t>         fTimeShift;      ///< Time shift in s, by (bc phase (4 for bc < 0), low gain, absId)
+    std::vector<Double_t>         fL1PhaseShift;   ///< L1 phase time shift of the current event in s (by supermodule)
+  };
+
+  void   BuildLookupTables(Stage & stage, Int_t run);
+  void   ApplyStage(Stage & stage, Int_t bc);
+  Bool_t IsActive(AliEMCALRecoUtils * recoUtils) const;
+
+  std::vector<Stage>    fStages;          //!<! Cell correction stages in the order of execution
+  AliEMCALGeometry     *fGeom;            //!<! EMCal geometry
+  Int_t                 fNChannels;       //!<! Number of EMCal channels in the geometry
+  std::vector<UChar_t>  fSuperModule;     //!<! Supermodule of each channel
+  AliAODCaloCells       fProbeCells;      //!<! Single cell used to evaluate the reco utils for each channel
+
+  // Flat copy of the cells of the current event
+  std::vector<Short_t>  fAbsId;           //!<! Cell absId
+  std::vector<Float_t>  fAmplitude;       //!<! Cell amplitude
+  std::vector<Double_t> fTime;            //!<! Cell time
+  std::vector<Int_t>    fMCLabel;         //!<! Cell MC label
+  std::vector<Double_t> fEFraction;       //!<! Cell embedded energy fraction
+  std::vector<UChar_t>  fHighGain;        //!<! Cell high gain flag
+
+ private:
+  AliEmcalCorrectionCellPipeline(const AliEmcalCorrectionCellPipeline &);             // Not implemented
+  AliEmcalCorrectionCellPipeline &operator=(const AliEmcalCorrectionCellPipeline &);  // Not implemented
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalCorrectionCellPipeline, 1); // Fused execution of EMCal cell correction components
+  /// \endcond
+};
+
+#endif /* ALIEMCALCORRECTIONCELLPIPELINE_H */
@@ -106,12 +106,36 @@ Bool_t AliEmcalCorrectionCellTimeCalib::Run()
 {
   AliEmcalCorrectionComponent::Run();
   
+  Bool_t runChanged = kFALSE;
+  if (!PrepareCellCorrection(runChanged)) return kFALSE;
+  
+  // mark the cells not recalibrated
+  fRecoUtils->ResetCellsCalibrated();
+  
+  FillCellCorrectionQA(kFALSE); // "before" QA
+  
+  // CELL RECALIBRATION -------------------------------------------------------
+  // cell objects will be updated
+  UpdateCells();
+  
+  FillCellCorrectionQA(kTRUE); // "after" QA
+  
+  return kTRUE;
+}
+
+/**
+ * Check the event and configure the reco utils for the time calibration.
+ * Shared by Run() and the fused cell correction (AliEmcalCorrectionCellPipeline).
+ */
+Bool_t AliEmcalCorrectionCellTimeCalib::PrepareCellCorrection(Bool_t & runChanged)
+{
+  runChanged = kFALSE;
   if (!fEventManager.InputEvent()) {
     AliError("Event ptr = 0, returning");
     return kFALSE;
   }
 
-  CheckIfRunChanged();
+  runChanged = CheckIfRunChanged();
   
   // CONFIGURE THE RECO UTILS -------------------------------------------------
   if (fCalibrateTimeVsE)
@@ -137,23 +161,19 @@ Bool_t AliEmcalCorrectionCellTimeCalib::Run()
     AliWarning(Form("Number of EMCAL cells = %d, returning", fCaloCells->GetNumberOfCells()));
     return kFALSE;
   }
-  
-  // mark the cells not recalibrated
-  fRecoUtils->ResetCellsCalibrated();
-  
-  if(fCreateHisto)
-    FillCellQA(fCellTimeDistBefore); // "before" QA
-  
-  // CELL RECALIBRATION -------------------------------------------------------
-  // cell objects will be updated
-  UpdateCells();
-  
-  if(fCreateHisto)
-    FillCellQA(fCellTimeDistAfter); // "after" QA
-  
+
   return kTRUE;
 }
 
+/**
+ * Fill the cell time distribution before or after the correction.
+ */
+void AliEmcalCorrectionCellTimeCalib::FillCellCorrectionQA(Bool_t afterCorrection)
+{
+  if(fCreateHisto)
+    FillCellQA(afterCorrection ? fCellTimeDistAfter : fCellTimeDistBefore);
+}
+
 
 /**
  * Initialize the energy dependent time calibration.
@@ -32,6 +32,11 @@ class AliEmcalCorrectionCellTimeCalib : public AliEmcalCorrectionComponent {
   void UserCreateOutputObjects();
   Bool_t Run();
   Bool_t CheckIfRunChanged();
+
+  // Fused cell correction
+  Bool_t SupportsFusedCellCorrection() const { return kTRUE; }
+  Bool_t PrepareCellCorrection(Bool_t & runChanged);
+  void FillCellCorrectionQA(Bool_t afterCorrection);
   
 protected:
   TH1F* fCellTimeDistBefore;            //!<! cell energy distribution, before time calibration
@@ -31,6 +31,7 @@ class AliEmcalCorrectionClusterEnergyVariation : public AliEmcalCorrectionCompon
   void UserCreateOutputObjects();
   void ExecOnce();
   Bool_t Run();
+  Bool_t ModifiesOnlyClusterEnergies() const { return kTRUE; }
   
 protected:
   Double_t               fEnergyScaleShift;               ///< Fraction of cluster energy to shift (positive means upward shift)
@@ -36,6 +36,7 @@ class AliEmcalCorrectionClusterNonLinearity : public AliEmcalCorrectionComponent
   Bool_t Initialize();
   void UserCreateOutputObjects();
   Bool_t Run();
+  Bool_t ModifiesOnlyClusterEnergies() const { return kTRUE; }
 
 protected:
   TH1F                  *fEnergyDistBefore;          //!<!energy distribution before
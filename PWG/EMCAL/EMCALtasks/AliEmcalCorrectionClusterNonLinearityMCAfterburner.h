@@ -32,6 +32,7 @@ class AliEmcalCorrectionClusterNonLinearityMCAfterburner : public AliEmcalCorrec
   Bool_t Initialize();
   void UserCreateOutputObjects();
   Bool_t Run();
+  Bool_t ModifiesOnlyClusterEnergies() const { return kTRUE; }
 
   /// MC Nonlinearity afterburner enum list of four possible ways of determining the parameters.
   /// Standard is kPCM_EMCal
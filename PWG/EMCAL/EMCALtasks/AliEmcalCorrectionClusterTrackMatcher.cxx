@@ -245,8 +245,9 @@ Int_t AliEmcalCorrectionClusterTrackMatcher::GetMomBin(Double_t p) const
  */
 void AliEmcalCorrectionClusterTrackMatcher::GenerateEmcalParticles()
 {
-  fEmcalTracks->Delete();
-  fEmcalClusters->Delete();
+  // The particles are only used within the event: keep them constructed and overwrite them with Set
+  fEmcalTracks->Clear();
+  fEmcalClusters->Clear();
 
   fNEmcalTracks = 0;
   fNEmcalClusters = 0;
@@ -282,8 +283,8 @@ void AliEmcalCorrectionClusterTrackMatcher::GenerateEmcalParticles()
       }
 
       // Create AliEmcalParticle objects to handle the matching
-      AliEmcalParticle* emcalCluster = new ((*fEmcalClusters)[fNEmcalClusters])
-      AliEmcalParticle(cluster, fClusterContainerIndexMap.GlobalIndexFromLocalIndex(clusCont, clusIterator.current_index()), fVertex[0], fVertex[1], fVertex[2], AliVCluster::kNonLinCorr);
+      AliEmcalParticle* emcalCluster = static_cast<AliEmcalParticle*>(fEmcalClusters->ConstructedAt(fNEmcalClusters));
+      emcalCluster->Set(cluster, fClusterContainerIndexMap.GlobalIndexFromLocalIndex(clusCont, clusIterator.current_index()), fVertex[0], fVertex[1], fVertex[2], AliVCluster::kNonLinCorr);
       emcalCluster->SetMatchedPtr(fEmcalTracks);
 
       fNEmcalClusters++;
@@ -358,7 +359,8 @@ void AliEmcalCorrectionClusterTrackMatcher::GenerateEmcalParticles()
       track->ResetBit(TObject::kIsReferenced);
 
       // Create AliEmcalParticle objects to handle the matching
-      AliEmcalParticle* emcalTrack = new ((*fEmcalTracks)[fNEmcalTracks]) AliEmcalParticle(track, fParticleContainerIndexMap.GlobalIndexFromLocalIndex(partCont, partIterator.current_index()));
+      AliEmcalParticle* emcalTrack = static_cast<AliEmcalParticle*>(fEmcalTracks->ConstructedAt(fNEmcalTracks));
+      emcalTrack->Set(track, fParticleContainerIndexMap.GlobalIndexFromLocalIndex(partCont, partIterator.current_index()));
       emcalTrack->SetMatchedPtr(fEmcalClusters);
       
       AliDebug(2, Form("Now adding track %i (pT = %.3f, eta = %.3f, phi = %.3f)"
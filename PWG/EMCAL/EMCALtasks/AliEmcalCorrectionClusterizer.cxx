@@ -16,6 +16,9 @@
  **************************************************************************/
 
 // --- Root ---
+#include <cstring>
+#include <map>
+#include <vector>
 #include <TObjArray.h>
 #include <TArrayI.h>
 #include <TStopwatch.h>
@@ -41,10 +44,44 @@
 #include "AliEMCALRecoUtils.h"
 #include "AliAODEvent.h"
 #include "AliESDEvent.h"
+#include "AliAODCaloCluster.h"
+#include "AliESDCaloCluster.h"
 #include "AliAnalysisManager.h"
 
 #include "AliEmcalCorrectionClusterizer.h"
 
+namespace {
+  /// Number of energies stored per cluster for the shared output: E() and the user defined energies
+  const Int_t kNSharedClusterEnergies = AliVCluster::kLastUserDefEnergy + 2;
+
+  /// Clusterizer output shared between clusterizers of the same configuration running on the same cells
+  struct SharedClusterizerOutput {
+    const AliEmcalCorrectionClusterizer *fProducer = 0;     ///< Clusterizer which produced the output
+    const AliVEvent                     *fEvent = 0;        ///< Event of the output
+    Int_t                                fNCells = 0;       ///< Number of input cells
+    ULong64_t                            fCellChecksum = 0; ///< Checksum of the input cells
+    Bool_t                               fOnlyEnergies = kFALSE; ///< The output clusters of the producer are only modified in energy
+    TClonesArray                        *fClusters = 0;     ///< Output clusters of the producer (not owned)
+    std::vector<Double_t>                fEnergies;         ///< Energies of the output clusters right after the clusterization
+    TClonesArray                        *fSnapshot = 0;     ///< Copy of the output clusters right after the clusterization (owned)
+  };
+
+  std::map<std::string, SharedClusterizerOutput> & SharedClusterizerOutputs()
+  {
+    static std::map<std::string, SharedClusterizerOutput> outputs;
+    return outputs;
+  }
+
+  /// Copy a cluster into a cluster array of the same type
+  AliVCluster * CopyCluster(AliVCluster * cluster, TClonesArray & array, Int_t index)
+  {
+    if (array.GetClass() == AliESDCaloCluster::Class()) {
+      return new (array[index]) AliESDCaloCluster(*static_cast<AliESDCaloCluster *>(cluster));
+    }
+    return new (array[index]) AliAODCaloCluster(*static_cast<AliAODCaloCluster *>(cluster));
+  }
+}
+
 /// \cond CLASSIMP
 ClassImp(AliEmcalCorrectionClusterizer);
 /// \endcond
@@ -100,7 +137,11 @@ AliEmcalCorrectionClusterizer::AliEmcalCorrectionClusterizer() :
   fRecalShowerShape(kFALSE),
   fCaloClusters(0),
   fEsd(0),
-  fAod(0)
+  fAod(0),
+  fShareOutput(kFALSE),
+  fShareOutputConfig(),
+  fSharedOutputKey(),
+  fCellChecksum(0)
 {
   for(Int_t i = 0; i < AliEMCALGeoParams::fgkEMCALModules; i++) fGeomMatrix[i] = 0 ;
   for(Int_t j = 0; j < fgkTotalCellNumber;                 j++)
@@ -112,6 +153,7 @@ AliEmcalCorrectionClusterizer::AliEmcalCorrectionClusterizer() :
  */
 AliEmcalCorrectionClusterizer::~AliEmcalCorrectionClusterizer()
 {
+  ReleaseSharedOutput();
   delete fClusterizer;
   delete fUnfolder;
   delete fRecParam;
@@ -215,6 +257,15 @@ Bool_t AliEmcalCorrectionClusterizer::Initialize()
   // Load 1D bad channel map
   GetProperty("load1DBadChMap", fLoad1DBadChMap);
   fRecoUtils->SetUse1DBadChannelMap(fLoad1DBadChMap);
+
+  // Share the output with the clusterizers of other correction tasks with the same configuration
+  GetProperty("shareOutput", fShareOutput, false);
+  fShareOutputConfig = TString::Format("%s;unfold=%d,%d,%g,%g;cellE=%g;seedE=%g;time=%g,%g,%g;w0=%g;diffE=%g;nxm=%d,%d;"
+                                       "distBC=%d;showerShape=%d;mcLabel=%d,%d,%d;mcGen=%d,%s,%s,%d;testPattern=%d;badChMap1D=%d",
+                                       clusterizerTypeStr.c_str(), unfold, unfoldRejectBelowThreshold, fUnfoldCellMinE, fUnfoldCellMinEFrac,
+                                       cellE, seedE, timeMin, timeMax, timeCut, w0, diffEAggregation, fNxMRowDiff, fNxMColDiff,
+                                       fRecalDistToBadChannels, fRecalShowerShape, fRemapMCLabelForAODs, fSetCellMCLabelFromCluster, fSetCellMCLabelFromEdepFrac,
+                                       removeNMCGenerators, removeMCGen1.Data(), removeMCGen2.Data(), enableMCGenRemovTrack, fTestPatternInput, fLoad1DBadChMap);
   
   return kTRUE;
 }
@@ -293,20 +344,26 @@ Bool_t AliEmcalCorrectionClusterizer::Run()
     }
   }
   
-  Init();
-  
-  if (fJustUnfold) {
-    AliWarning("Unfolding not implemented");
-    return kTRUE;
+  // Reuse the output of an equivalent clusterizer which already ran on the same cells
+  if (fShareOutput) fCellChecksum = GetCellChecksum();
+  if (!fShareOutput || !CopySharedOutput()) {
+    Init();
+
+    if (fJustUnfold) {
+      AliWarning("Unfolding not implemented");
+      return kTRUE;
+    }
+
+    FillDigitsArray();
+
+    Clusterize();
+
+    UpdateClusters();
+
+    CalibrateClusters();
+
+    if (fShareOutput) StoreSharedOutput();
   }
-  
-  FillDigitsArray();
-  
-  Clusterize();
-  
-  UpdateClusters();
-  
-  CalibrateClusters();
 
   if (fCreateHisto) {
     fTimer->Stop();
@@ -1018,3 +1075,167 @@ void AliEmcalCorrectionClusterizer::ClearEMCalClusters()
     }
   }
 }
+
+/**
+ * Checksum of the input cells, used to check that the shared output was produced from the same cells.
+ */
+ULong64_t AliEmcalCorrectionClusterizer::GetCellChecksum() const
+{
+  ULong64_t checksum = 14695981039346656037ULL;
+  auto add = [&checksum](ULong64_t value) {
+    checksum ^= value;
+    checksum *= 1099511628211ULL;
+    checksum ^= checksum >> 29;
+  };
+
+  Short_t cellNumber = 0;
+  Double_t amp = 0, cellTime = 0, cellEFrac = 0;
+  Int_t cellMCLabel = -1;
+  ULong64_t bits = 0;
+  const Int_t ncells = fCaloCells->GetNumberOfCells();
+  for (Int_t icell = 0; icell < ncells; ++icell)
+  {
+    if (fCaloCells->GetCell(icell, cellNumber, amp, cellTime, cellMCLabel, cellEFrac) != kTRUE)
+      break;
+    add(static_cast<ULong64_t>(cellNumber) << 32 | static_cast<UInt_t>(cellMCLabel));
+    std::memcpy(&bits, &amp, sizeof(bits));
+    add(bits);
+    std::memcpy(&bits, &cellTime, sizeof(bits));
+    add(bits);
+    std::memcpy(&bits, &cellEFrac, sizeof(bits));
+    add(bits);
+  }
+  return checksum;
+}
+
+/**
+ * Key of the shared output: the clusterizer configuration and the input cells.
+ */
+std::string AliEmcalCorrectionClusterizer::GetSharedOutputKey()
+{
+  if (fSharedOutputKey.empty()) {
+    fSharedOutputKey = TString::Format("%s;cells=%s;pass=%s;customBC=%s", fShareOutputConfig.Data(), fCaloCells->GetName(),
+                                       fFilepass.Data(), fCustomBadChannelFilePath.Data()).Data();
+  }
+  return fSharedOutputKey;
+}
+
+/**
+ * Copy the clusters of an equivalent clusterizer which already ran on the same cells in this event.
+ *
+ * @return True if the clusters were copied
+ */
+Bool_t AliEmcalCorrectionClusterizer::CopySharedOutput()
+{
+  auto & outputs = SharedClusterizerOutputs();
+  auto entry = outputs.find(GetSharedOutputKey());
+  if (entry == outputs.end()) return kFALSE;
+
+  const SharedClusterizerOutput & shared = entry->second;
+  if (shared.fProducer == this || shared.fEvent != fEventManager.InputEvent() ||
+      shared.fNCells != fCaloCells->GetNumberOfCells() || shared.fCellChecksum != fCellChecksum) {
+    return kFALSE;
+  }
+
+  TClonesArray * source = shared.fOnlyEnergies ? shared.fClusters : shared.fSnapshot;
+  if (!source || source == fCaloClusters || source->GetClass() != fCaloClusters->GetClass()) return kFALSE;
+
+  const Int_t nSource = source->GetEntriesFast();
+  if (shared.fOnlyEnergies) {
+    // The clusters of the producer must not have been added or removed since the clusterization
+    Int_t nSourceEMCal = 0;
+    for (Int_t i = 0; i < nSource; ++i) {
+      AliVCluster * cluster = static_cast<AliVCluster*>(source->At(i));
+      if (cluster && cluster->IsEMCAL()) nSourceEMCal++;
+    }
+    if (nSourceEMCal * kNSharedClusterEnergies != static_cast<Int_t>(shared.fEnergies.size())) return kFALSE;
+  }
+
+  CheckIfRunChanged();
+
+  ClearEMCalClusters();
+  fCaloClusters->Compress();
+
+  Int_t nout = fCaloClusters->GetEntriesFast();
+  const Double_t * energies = shared.fEnergies.data();
+  for (Int_t i = 0; i < nSource; ++i) {
+    AliVCluster * sourceCluster = static_cast<AliVCluster*>(source->At(i));
+    if (!sourceCluster || !sourceCluster->IsEMCAL()) continue;
+
+    AliVCluster * cluster = CopyCluster(sourceCluster, *fCaloClusters, nout);
+    cluster->SetID(nout++);
+    if (shared.fOnlyEnergies) {
+      cluster->SetE(energies[0]);
+      for (Int_t iEnergy = 0; iEnergy <= AliVCluster::kLastUserDefEnergy; iEnergy++) {
+        cluster->SetUserDefEnergy(static_cast<AliVCluster::VCluUserDefEnergy_t>(iEnergy), energies[iEnergy + 1]);
+      }
+      energies += kNSharedClusterEnergies;
+    }
+  }
+
+  AliDebug(2, Form("Copied %d clusters from the shared clusterizer output", nout));
+  return kTRUE;
+}
+
+/**
+ * Publish the clusters of this event for equivalent clusterizers executed later in the event.
+ */
+void AliEmcalCorrectionClusterizer::StoreSharedOutput()
+{
+  SharedClusterizerOutput & shared = SharedClusterizerOutputs()[GetSharedOutputKey()];
+  shared.fProducer = this;
+  shared.fEvent = fEventManager.InputEvent();
+  shared.fNCells = fCaloCells->GetNumberOfCells();
+  shared.fCellChecksum = fCellChecksum;
+  shared.fOnlyEnergies = fOnlyClusterEnergiesModifiedDownstream;
+  shared.fClusters = fCaloClusters;
+  shared.fEnergies.clear();
+
+  if (shared.fSnapshot) {
+    shared.fSnapshot->Delete();
+    if (shared.fSnapshot->GetClass() != fCaloClusters->GetClass()) {
+      delete shared.fSnapshot;
+      shared.fSnapshot = 0;
+    }
+  }
+  if (!shared.fOnlyEnergies && !shared.fSnapshot) {
+    shared.fSnapshot = new TClonesArray(fCaloClusters->GetClass()->GetName());
+  }
+
+  Int_t nout = 0;
+  const Int_t nclusters = fCaloClusters->GetEntriesFast();
+  for (Int_t i = 0; i < nclusters; ++i) {
+    AliVCluster * cluster = static_cast<AliVCluster*>(fCaloClusters->At(i));
+    if (!cluster || !cluster->IsEMCAL()) continue;
+
+    if (shared.fOnlyEnergies) {
+      shared.fEnergies.push_back(cluster->E());
+      for (Int_t iEnergy = 0; iEnergy <= AliVCluster::kLastUserDefEnergy; iEnergy++) {
+        shared.fEnergies.push_back(cluster->GetUserDefEnergy(static_cast<AliVCluster::VCluUserDefEnergy_t>(iEnergy)));
+      }
+    }
+    else {
+      CopyCluster(cluster, *shared.fSnapshot, nout++);
+    }
+  }
+}
+
+/**
+ * Remove the shared output published by this clusterizer.
+ */
+void AliEmcalCorrectionClusterizer::ReleaseSharedOutput()
+{
+  auto & outputs = SharedClusterizerOutputs();
+  for (auto entry = outputs.begin(); entry != outputs.end(); ) {
+    if (entry->second.fProducer == this) {
+      if (entry->second.fSnapshot) {
+        entry->second.fSnapshot->Delete();
+        delete entry->second.fSnapshot;
+      }
+      entry = outputs.erase(entry);
+    }
+    else {
+      ++entry;
+    }
+  }
+}
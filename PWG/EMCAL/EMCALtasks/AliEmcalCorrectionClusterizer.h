@@ -22,6 +22,14 @@ class TStopwatch;
  *
  * At this point the energy of the cluster will be available through `cluster->E()` where cluster is the pointer to the AliAODCaloCluster or AliESDCaloCluster object.
  *
+ * When several correction tasks run the same clusterizer on the same cells (for example systematic variations
+ * which only change the non-linearity or the energy scale), the output can be shared by enabling `shareOutput`
+ * (or SetShareOutput()). The first clusterizer executed in the event clusterizes and publishes its output; the
+ * others with the same configuration find that the input cells are identical and copy those clusters instead of
+ * clusterizing again. If all components executed after the publishing clusterizer only modify cluster energies
+ * (see AliEmcalCorrectionComponent::ModifiesOnlyClusterEnergies()), the clusters are copied from its output branch
+ * and only the energies are restored; otherwise a copy of the clusters is kept right after the clusterization.
+ *
  * Based on code in AliAnalysisTaskEMCALClusterizeFast, in turn based on code by Deepa Thomas.
  *
  * @author Constantin Loizides, LBNL, AliAnalysisTaskEMCALClusterizeFast
@@ -44,6 +52,8 @@ class AliEmcalCorrectionClusterizer : public AliEmcalCorrectionComponent {
   void UserCreateOutputObjects();
   Bool_t Run();
   Bool_t CheckIfRunChanged();
+
+  void SetShareOutput(Bool_t b) { fShareOutput = b; }
   
 protected:
   void           Clusterize();
@@ -56,6 +66,12 @@ protected:
   void           RemapMCLabelForAODs(Int_t &label);
   void           SetClustersMCLabelFromOriginalClusters();
   void           ClearEMCalClusters();
+
+  ULong64_t      GetCellChecksum() const;
+  std::string    GetSharedOutputKey();
+  Bool_t         CopySharedOutput();
+  void           StoreSharedOutput();
+  void           ReleaseSharedOutput();
   
   TH1F* fHistCPUTime;                                     //!<! CPU time for the Run() function (event loop)
   TH1F* fHistRealTime;                                    //!<! Real time for the Run() function (event loop)
@@ -110,6 +126,11 @@ protected:
   AliESDEvent           *fEsd;                            //!<!esd event
   AliAODEvent           *fAod;                            //!<!aod event
 
+  Bool_t                 fShareOutput;                    ///< share the output with other clusterizers of the same configuration on the same cells
+  TString                fShareOutputConfig;              ///< configuration string identifying equivalent clusterizers
+  std::string            fSharedOutputKey;                //!<!key of the shared output (configuration and cells)
+  ULong64_t              fCellChecksum;                   //!<!checksum of the input cells of the current event
+
  private:
   AliEmcalCorrectionClusterizer(const AliEmcalCorrectionClusterizer &);               // Not implemented
   AliEmcalCorrectionClusterizer &operator=(const AliEmcalCorrectionClusterizer &);    // Not implemented
@@ -118,7 +139,7 @@ protected:
   static RegisterCorrectionComponent<AliEmcalCorrectionClusterizer> reg;
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalCorrectionClusterizer, 6); // EMCal correction clusterizer component
+  ClassDef(AliEmcalCorrectionClusterizer, 7); // EMCal correction clusterizer component
   /// \endcond
 };
 
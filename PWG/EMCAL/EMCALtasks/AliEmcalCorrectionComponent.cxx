@@ -52,8 +52,8 @@ AliEmcalCorrectionComponent::AliEmcalCorrectionComponent() :
   fRecoUtils(0),
   fOutput(0),
   fBasePath(""),
-  fCustomBadChannelFilePath("")
-
+  fCustomBadChannelFilePath(""),
+  fOnlyClusterEnergiesModifiedDownstream(kFALSE)
 {
   fVertex[0] = 0;
   fVertex[1] = 0;
@@ -88,7 +88,8 @@ AliEmcalCorrectionComponent::AliEmcalCorrectionComponent(const char * name) :
   fRecoUtils(0),
   fOutput(0),
   fBasePath(""),
-  fCustomBadChannelFilePath("")
+  fCustomBadChannelFilePath(""),
+  fOnlyClusterEnergiesModifiedDownstream(kFALSE)
 {
   fVertex[0] = 0;
   fVertex[1] = 0;
@@ -209,24 +210,36 @@ void AliEmcalCorrectionComponent::UpdateCells()
   Int_t bunchCrossNo = fEventManager.InputEvent()->GetBunchCrossNumber();
   
   if (fRecoUtils){
-    //In case of PAR run check global event ID
-    if(fRecoUtils->IsParRun()){
-      Short_t currentParIndex = 0;
-      ULong64_t globalEventID = (ULong64_t)bunchCrossNo + (ULong64_t)fEventManager.InputEvent()->GetOrbitNumber() * (ULong64_t)3564 + (ULong64_t)fEventManager.InputEvent()->GetPeriodNumber() * (ULong64_t)59793994260;
-      for(Short_t ipar=0;ipar<fRecoUtils->GetNPars();ipar++){
-        if(globalEventID >= fRecoUtils->GetGlobalIDPar(ipar)) {
-          currentParIndex++;
-        }
-      }
-      fRecoUtils->SetCurrentParNumber(currentParIndex);      
-    }
-    //end of PAR run settings
+    UpdateRecoUtilsParNumber();
 
     fRecoUtils->RecalibrateCells(fCaloCells, bunchCrossNo);
   }
   fCaloCells->Sort();
 }
 
+/**
+ * In case of a PAR run, set the PAR number of the current event in the reco utils
+ * from the global event ID.
+ */
+void AliEmcalCorrectionComponent::UpdateRecoUtilsParNumber()
+{
+  if (!fEventManager.InputEvent() || !fRecoUtils) return;
+
+  //In case of PAR run check global event ID
+  if(fRecoUtils->IsParRun()){
+    Int_t bunchCrossNo = fEventManager.InputEvent()->GetBunchCrossNumber();
+    Short_t currentParIndex = 0;
+    ULong64_t globalEventID = (ULong64_t)bunchCrossNo + (ULong64_t)fEventManager.InputEvent()->GetOrbitNumber() * (ULong64_t)3564 + (ULong64_t)fEventManager.InputEvent()->GetPeriodNumber() * (ULong64_t)59793994260;
+    for(Short_t ipar=0;ipar<fRecoUtils->GetNPars();ipar++){
+      if(globalEventID >= fRecoUtils->GetGlobalIDPar(ipar)) {
+        currentParIndex++;
+      }
+    }
+    fRecoUtils->SetCurrentParNumber(currentParIndex);      
+  }
+  //end of PAR run settings
+}
+
 /**
  * Check whether the run changed.
  */
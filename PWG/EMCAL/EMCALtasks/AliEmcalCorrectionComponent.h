@@ -53,9 +53,32 @@ class AliEmcalCorrectionComponent : public TNamed {
   virtual Bool_t Run();
   virtual Bool_t UserNotify();
   virtual Bool_t CheckIfRunChanged();
+
+  /** @{
+   * @name Fused cell correction (see AliEmcalCorrectionCellPipeline)
+   *
+   * Cell components whose correction is fully done by AliEMCALRecoUtils::RecalibrateCells()
+   * can be executed together in one pass over the cells. Run() of such a component is split
+   * into PrepareCellCorrection(), the cell update, and FinishCellCorrection().
+   */
+  /// True if the component can be executed as a stage of the fused cell correction
+  virtual Bool_t SupportsFusedCellCorrection() const { return kFALSE; }
+  /// Check the event and configure the reco utils. Returns kFALSE if the cells should not be corrected.
+  virtual Bool_t PrepareCellCorrection(Bool_t & runChanged) { runChanged = kFALSE; return kFALSE; }
+  /// Reset the reco utils configuration after the cells were updated
+  virtual void FinishCellCorrection() {}
+  /// Fill the cell QA before or after the correction
+  virtual void FillCellCorrectionQA(Bool_t /*afterCorrection*/) {}
+  /** @} */
+
+  /// True if the component only modifies cluster energies (E() and the user defined energies)
+  virtual Bool_t ModifiesOnlyClusterEnergies() const { return kFALSE; }
+  /// Set by the correction task if all components executed after this one only modify cluster energies
+  void SetOnlyClusterEnergiesModifiedDownstream(Bool_t b) { fOnlyClusterEnergiesModifiedDownstream = b; }
   
   void GetEtaPhiDiff(const AliVTrack *t, const AliVCluster *v, Double_t &phidiff, Double_t &etadiff);
   void UpdateCells();
+  void UpdateRecoUtilsParNumber();
   void GetPass();
   void FillCellQA(TH1F* h);
   Int_t InitBadChannels();
@@ -82,6 +105,7 @@ class AliEmcalCorrectionComponent : public TNamed {
   AliEMCALRecoUtils      *GetRecoUtils()  const { return fRecoUtils; }
   AliVCaloCells          *GetCaloCells()  const { return fCaloCells; }
   TList                  *GetOutputList() const { return fOutput; }
+  AliVEvent              *GetInputEvent() const { return fEventManager.InputEvent(); }
   
   void SetCaloCells(AliVCaloCells * cells) { fCaloCells = cells; }
   void SetRecoUtils(AliEMCALRecoUtils *ru) { fRecoUtils = ru; }
@@ -136,13 +160,14 @@ class AliEmcalCorrectionComponent : public TNamed {
   
   TString                fBasePath;                       ///< Base folder path to get root files
   TString                fCustomBadChannelFilePath;       ///< Custom path to bad channel map OADB file
+  Bool_t                 fOnlyClusterEnergiesModifiedDownstream; //!<! All components executed after this one only modify cluster energies
 
  private:
   AliEmcalCorrectionComponent(const AliEmcalCorrectionComponent &);               // Not implemented
   AliEmcalCorrectionComponent &operator=(const AliEmcalCorrectionComponent &);    // Not implemented
   
   /// \cond CLASSIMP
-  ClassDef(AliEmcalCorrectionComponent, 9); // EMCal correction component
+  ClassDef(AliEmcalCorrectionComponent, 10); // EMCal correction component
   /// \endcond
 };
 
@@ -5,6 +5,7 @@
 
 #include "AliEmcalCorrectionTask.h"
 #include "AliEmcalCorrectionComponent.h"
+#include "AliEmcalCorrectionCellPipeline.h"
 
 #include <vector>
 #include <set>
@@ -61,6 +62,9 @@ AliEmcalCorrectionTask::AliEmcalCorrectionTask() :
   fForceBeamType(kNA),
   fNeedEmcalGeom(kTRUE),
   fGeom(0),
+  fUseFusedCellPipeline(kFALSE),
+  fCellPipelines(),
+  fComponentCellPipeline(),
   fParticleCollArray(),
   fClusterCollArray(),
   fCellCollArray(),
@@ -106,6 +110,9 @@ AliEmcalCorrectionTask::AliEmcalCorrectionTask(const char * name) :
   fForceBeamType(kNA),
   fNeedEmcalGeom(kTRUE),
   fGeom(0),
+  fUseFusedCellPipeline(kFALSE),
+  fCellPipelines(),
+  fComponentCellPipeline(),
   fParticleCollArray(),
   fClusterCollArray(),
   fCellCollArray(),
@@ -151,6 +158,9 @@ AliEmcalCorrectionTask::AliEmcalCorrectionTask(const AliEmcalCorrectionTask & ta
   fForceBeamType(task.fForceBeamType),
   fNeedEmcalGeom(task.fNeedEmcalGeom),
   fGeom(task.fGeom),
+  fUseFusedCellPipeline(task.fUseFusedCellPipeline),
+  fCellPipelines(),
+  fComponentCellPipeline(),
   fParticleCollArray(*(static_cast<TObjArray *>(task.fParticleCollArray.Clone()))),
   fClusterCollArray(*(static_cast<TObjArray *>(task.fClusterCollArray.Clone()))),
   fOutput(task.fOutput)                           // TODO: More care is needed here!
@@ -214,6 +224,9 @@ void swap(AliEmcalCorrectionTask & first, AliEmcalCorrectionTask & second)
   swap(first.fForceBeamType, second.fForceBeamType);
   swap(first.fNeedEmcalGeom, second.fNeedEmcalGeom);
   swap(first.fGeom, second.fGeom);
+  swap(first.fUseFusedCellPipeline, second.fUseFusedCellPipeline);
+  swap(first.fCellPipelines, second.fCellPipelines);
+  swap(first.fComponentCellPipeline, second.fComponentCellPipeline);
   swap(first.fParticleCollArray, second.fParticleCollArray);
   swap(first.fClusterCollArray, second.fClusterCollArray);
   swap(first.fCellCollArray, second.fCellCollArray);
@@ -227,6 +240,9 @@ void swap(AliEmcalCorrectionTask & first, AliEmcalCorrectionTask & second)
 AliEmcalCorrectionTask::~AliEmcalCorrectionTask()
 {
   // Destructor
+  for (auto pipeline : fCellPipelines) {
+    delete pipeline;
+  }
 }
 
 void AliEmcalCorrectionTask::Initialize(bool removeDummyTask)
@@ -1204,6 +1220,64 @@ void AliEmcalCorrectionTask::ExecOnceComponents()
       AddContainersToComponent(component, AliEmcalContainerUtils::kCaloCells, true);
     }
   }
+
+  // Let each component know whether the components executed after it only modify cluster energies.
+  // This allows the clusterizer to share its output cheaply between correction tasks (see AliEmcalCorrectionClusterizer).
+  Bool_t onlyClusterEnergies = kTRUE;
+  for (auto it = fCorrectionComponents.rbegin(); it != fCorrectionComponents.rend(); ++it)
+  {
+    (*it)->SetOnlyClusterEnergiesModifiedDownstream(onlyClusterEnergies);
+    onlyClusterEnergies = onlyClusterEnergies && (*it)->ModifiesOnlyClusterEnergies();
+  }
+
+  BuildCellPipelines();
+}
+
+/**
+ * Group consecutive cell correction components which can be fused and which correct the same cells
+ * into pipelines (see AliEmcalCorrectionCellPipeline). Components in a pipeline are executed in one
+ * pass over the cells when the last component of the pipeline is reached in Run(). Groups of a single
+ * component are executed as usual.
+ */
+void AliEmcalCorrectionTask::BuildCellPipelines()
+{
+  for (auto pipeline : fCellPipelines) {
+    delete pipeline;
+  }
+  fCellPipelines.clear();
+  fComponentCellPipeline.assign(fCorrectionComponents.size(), -1);
+
+  if (!fUseFusedCellPipeline) return;
+
+  std::vector <std::vector <std::size_t> > groups;
+  AliVCaloCells * groupCells = 0;
+  for (std::size_t i = 0; i < fCorrectionComponents.size(); i++)
+  {
+    AliEmcalCorrectionComponent * component = fCorrectionComponents.at(i);
+    if (!AliEmcalCorrectionCellPipeline::CanBeFused(component)) {
+      groupCells = 0;
+      continue;
+    }
+    if (!groupCells || component->GetCaloCells() != groupCells) {
+      groups.push_back(std::vector <std::size_t>());
+      groupCells = component->GetCaloCells();
+    }
+    groups.back().push_back(i);
+  }
+
+  for (const auto & group : groups)
+  {
+    if (group.size() < 2) continue;
+    AliEmcalCorrectionCellPipeline * pipeline = new AliEmcalCorrectionCellPipeline();
+    std::stringstream stages;
+    for (auto i : group) {
+      pipeline->AddStage(fCorrectionComponents.at(i));
+      fComponentCellPipeline.at(i) = fCellPipelines.size();
+      stages << " " << fCorrectionComponents.at(i)->GetName();
+    }
+    fCellPipelines.push_back(pipeline);
+    AliInfoStream() << "Fused cell correction pipeline:" << stages.str() << "\n";
+  }
 }
 
 /**
@@ -1306,15 +1380,23 @@ Bool_t AliEmcalCorrectionTask::RetrieveEventObjects()
 Bool_t AliEmcalCorrectionTask::Run()
 {
   // Run the initialization for all derived classes.
-  for (auto component : fCorrectionComponents)
+  for (std::size_t i = 0; i < fCorrectionComponents.size(); i++)
   {
+    AliEmcalCorrectionComponent * component = fCorrectionComponents.at(i);
     component->SetInputEvent(InputEvent());
     component->SetMCEvent(MCEvent());
     component->SetCentralityBin(fCentBin);
     component->SetCentrality(fCent);
     component->SetVertex(fVertex);
 
-    component->Run();
+    // Components in a fused pipeline are executed together with the last component of the pipeline
+    Int_t pipelineIndex = i < fComponentCellPipeline.size() ? fComponentCellPipeline.at(i) : -1;
+    if (pipelineIndex < 0) {
+      component->Run();
+    }
+    else if (fCellPipelines.at(pipelineIndex)->GetLastStage() == component) {
+      fCellPipelines.at(pipelineIndex)->Run();
+    }
   }
 
   PostData(1, fOutput);
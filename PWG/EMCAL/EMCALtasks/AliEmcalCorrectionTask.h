@@ -3,6 +3,7 @@
 
 class AliEmcalCorrectionCellContainer;
 class AliEmcalCorrectionComponent;
+class AliEmcalCorrectionCellPipeline;
 class AliEMCALGeometry;
 class AliVEvent;
 
@@ -100,6 +101,8 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   // Set
   void                        SetForceBeamType(BeamType f)                          { fForceBeamType     = f                              ; }
   void                        SetNeedEmcalGeometry(Bool_t b)                        { fNeedEmcalGeom     = b                              ; }
+  /// Execute consecutive cell correction components on the same cells in one pass (see AliEmcalCorrectionCellPipeline)
+  void                        SetUseFusedCellPipeline(Bool_t b)                     { fUseFusedCellPipeline = b                           ; }
   // Centrality options
   void                        SetUseNewCentralityEstimation(Bool_t b)               { fUseNewCentralityEstimation = b                     ; }
   void                        SetCentralityEstimator(const char * c)                { fCentEst           = c                              ; }
@@ -191,6 +194,7 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   // Execute component functions
   void UserCreateOutputObjectsComponents();
   void ExecOnceComponents();
+  void BuildCellPipelines();
 
   // Initialization functions
   void InitializeConfiguration();
@@ -241,6 +245,9 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   BeamType                    fForceBeamType;              ///< forced beam type
   Bool_t                      fNeedEmcalGeom;              ///< whether or not the task needs the emcal geometry
   AliEMCALGeometry           *fGeom;                       //!<! Emcal geometry
+  Bool_t                      fUseFusedCellPipeline;       ///< Execute consecutive cell components in a fused pipeline
+  std::vector <AliEmcalCorrectionCellPipeline *> fCellPipelines; //!<! Fused cell correction pipelines
+  std::vector <Int_t>         fComponentCellPipeline;      //!<! Index of the pipeline executing each component (-1 if none)
 
   TObjArray                   fParticleCollArray;          ///< Particle/track collection array
   TObjArray                   fClusterCollArray;           ///< Cluster collection array
@@ -249,7 +256,7 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   TList *                     fOutput;                     //!<! Output for histograms
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalCorrectionTask, 9); // EMCal correction task
+  ClassDef(AliEmcalCorrectionTask, 10); // EMCal correction task
   /// \endcond
 };
 
@@ -73,11 +73,13 @@ Bool_t AliEmcalParticleMaker::Run()
 
   if (fTracks && fTracksOut) {
     // clear container (normally a null operation as the event should clean it already)
-    fTracksOut->Delete();
+    // constructed particles are kept and overwritten with Set
+    fTracksOut->Clear();
     const Int_t Ntracks = fTracks->GetEntries();
     for (Int_t iTracks = 0; iTracks < Ntracks; ++iTracks) {
       AliVTrack *track = static_cast<AliVTrack*>(fTracks->At(iTracks));
-      AliEmcalParticle *ep = new ((*fTracksOut)[iTracks]) AliEmcalParticle(track, iTracks);
+      AliEmcalParticle *ep = static_cast<AliEmcalParticle*>(fTracksOut->ConstructedAt(iTracks));
+      ep->Set(track, iTracks);
       if (0&&fCaloClusters)
 	ep->SetMatchedPtr(fCaloClusters);
     }
@@ -85,14 +87,15 @@ Bool_t AliEmcalParticleMaker::Run()
 
   if (fCaloClusters && fCaloClustersOut) {
     // clear container (normally a null operation as the event should clean it already)
-    fCaloClustersOut->Delete();
+    fCaloClustersOut->Clear();
     const Int_t Nclusters = fCaloClusters->GetEntries();
     for (Int_t iClusters = 0, iN=0; iClusters < Nclusters; ++iClusters) {
       AliVCluster *cluster = static_cast<AliVCluster*>(fCaloClusters->At(iClusters));
       /* Commented because for simplicity prefer to keep indices aligned with clusters (CL)
         if (!cluster->IsEMCAL()) continue;
       */
-      AliEmcalParticle *ep = new ((*fCaloClustersOut)[iN++]) AliEmcalParticle(cluster, iClusters, fVertex[0], fVertex[1], fVertex[2]);
+      AliEmcalParticle *ep = static_cast<AliEmcalParticle*>(fCaloClustersOut->ConstructedAt(iN++));
+      ep->Set(cluster, iClusters, fVertex[0], fVertex[1], fVertex[2]);
       if (0&&fTracks)
 	ep->SetMatchedPtr(fTracks);
     }
@@ -130,7 +130,8 @@ void AliEmcalPicoTrackMaker::UserExec(Option_t *)
     fInit = kTRUE;
   }
 
-  fTracksOut->Delete();
+  // keep the constructed pico tracks, they are overwritten below
+  fTracksOut->Clear();
 
   // loop over tracks
   const Int_t Ntracks = fTracksIn->GetEntriesFast();
@@ -160,16 +161,17 @@ void AliEmcalPicoTrackMaker::UserExec(Option_t *)
 	track->GetTrackPhiOnEMCal() < 190 * TMath::DegToRad())
       isEmc = kTRUE;
 
-    AliPicoTrack *picotrack = new ((*fTracksOut)[nacc]) AliPicoTrack(track->Pt(), 
-								     track->Eta(), 
-								     track->Phi(), 
-								     track->Charge(), 
-								     track->GetLabel(),
-								     AliPicoTrack::GetTrackType(track),
-								     track->GetTrackEtaOnEMCal(), 
-								     track->GetTrackPhiOnEMCal(), 
-								     track->GetTrackPtOnEMCal(), 
-								     isEmc);
+    AliPicoTrack *picotrack = static_cast<AliPicoTrack*>(fTracksOut->ConstructedAt(nacc));
+    picotrack->Set(track->Pt(), 
+		   track->Eta(), 
+		   track->Phi(), 
+		   track->Charge(), 
+		   track->GetLabel(),
+		   AliPicoTrack::GetTrackType(track),
+		   track->GetTrackEtaOnEMCal(), 
+		   track->GetTrackPhiOnEMCal(), 
+		   track->GetTrackPtOnEMCal(), 
+		   isEmc);
     picotrack->SetTrack(track);
     
     if (fCopyMCFlag && track->GetLabel() != 0) {
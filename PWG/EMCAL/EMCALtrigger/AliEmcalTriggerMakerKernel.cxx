@@ -24,6 +24,7 @@
  * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS      *
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                       *
  **************************************************************************************/
+#include <algorithm>
 #include <iostream>
 #include <vector>
 #include <cstring>
@@ -94,6 +95,7 @@ AliEmcalTriggerMakerKernel::AliEmcalTriggerMakerKernel():
   fPatchEnergySimpleSmeared(nullptr),
   fLevel0TimeMap(nullptr),
   fTriggerBitMap(nullptr),
+  fSmearedEnergyIntegral(),
   fADCtoGeV(1.)
 {
   memset(fThresholdConstants, 0, sizeof(Int_t) * 12);
@@ -589,6 +591,8 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
   bkgPatchMask = 1 << fTriggerBitConfig->GetBkgBit();
       //l0PatchMask = 1 << fTriggerBitConfig->GetLevel0Bit();
 
+  if(fPatchEnergySimpleSmeared) BuildSmearedEnergyIntegral();
+
   std::vector<AliEMCALTriggerRawPatch> patches;
   if (fPatchFinder) {
     if (useL0amp) {
@@ -638,12 +642,7 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
     fullpatch.SetOffSet(offset);
     if(fPatchEnergySimpleSmeared){
       // Add smeared energy
-      double energysmear = 0;
-      for(int icol = 0; icol < fullpatch.GetPatchSize(); icol++){
-        for(int irow = 0; irow < fullpatch.GetPatchSize(); irow++){
-          energysmear += (*fPatchEnergySimpleSmeared)(fullpatch.GetColStart() + icol, fullpatch.GetRowStart() + irow);
-        }
-      }
+      double energysmear = GetSmearedPatchEnergy(fullpatch.GetColStart(), fullpatch.GetRowStart(), fullpatch.GetPatchSize());
       AliDebugStream(1) << "Patch size(" << fullpatch.GetPatchSize() <<") energy " << fullpatch.GetPatchE() << " smeared " << energysmear << std::endl;
       fullpatch.SetSmearedEnergy(energysmear);
     }
@@ -677,19 +676,35 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
     fullpatch.SetTriggerBitConfig(fTriggerBitConfig);
     if(fPatchEnergySimpleSmeared){
       // Add smeared energy
-      double energysmear = 0;
-      for(int icol = 0; icol < fullpatch.GetPatchSize(); icol++){
-        for(int irow = 0; irow < fullpatch.GetPatchSize(); irow++){
-          energysmear += (*fPatchEnergySimpleSmeared)(fullpatch.GetColStart() + icol, fullpatch.GetRowStart() + irow);
-        }
-      }
-      fullpatch.SetSmearedEnergy(energysmear);
+      fullpatch.SetSmearedEnergy(GetSmearedPatchEnergy(fullpatch.GetColStart(), fullpatch.GetRowStart(), fullpatch.GetPatchSize()));
     }
     outputcont.push_back(fullpatch);
   }
   // std::cout << "Finished finding trigger patches" << std::endl;
 }
 
+void AliEmcalTriggerMakerKernel::BuildSmearedEnergyIntegral(){
+  const int ncols = fPatchEnergySimpleSmeared->GetNumberOfCols(), nrows = fPatchEnergySimpleSmeared->GetNumberOfRows(),
+            stride = ncols + 1;
+  fSmearedEnergyIntegral.assign(stride * (nrows + 1), 0.);
+  for(int irow = 0; irow < nrows; irow++){
+    double rowsum = 0;
+    for(int icol = 0; icol < ncols; icol++){
+      rowsum += (*fPatchEnergySimpleSmeared)(icol, irow);
+      fSmearedEnergyIntegral[(irow + 1) * stride + icol + 1] = fSmearedEnergyIntegral[irow * stride + icol + 1] + rowsum;
+    }
+  }
+}
+
+double AliEmcalTriggerMakerKernel::GetSmearedPatchEnergy(Int_t colstart, Int_t rowstart, Int_t patchsize) const {
+  const int ncols = fPatchEnergySimpleSmeared->GetNumberOfCols(), nrows = fPatchEnergySimpleSmeared->GetNumberOfRows(),
+            stride = ncols + 1;
+  const int colend = std::min(colstart + patchsize, ncols), rowend = std::min(rowstart + patchsize, nrows);
+  if(colstart < 0 || rowstart < 0 || colstart >= colend || rowstart >= rowend) return 0.;
+  return fSmearedEnergyIntegral[rowend * stride + colend] - fSmearedEnergyIntegral[rowstart * stride + colend]
+       - fSmearedEnergyIntegral[rowend * stride + colstart] + fSmearedEnergyIntegral[rowstart * stride + colstart];
+}
+
 double AliEmcalTriggerMakerKernel::GetL0TriggerChannelAmplitude(Int_t col, Int_t row) const{
   double amp = 0;
   try {
@@ -573,6 +573,25 @@ protected:
    */
   bool HasPHOSOverlap(const AliEMCALTriggerRawPatch &patch) const;
 
+  /**
+   * @brief Build the summed-area table of the smeared energies
+   *
+   * Entry (col, row) of the table holds the sum of the smeared energies in
+   * all channels with smaller column and row, so that the energy of any
+   * patch is obtained from four lookups. Built once per event and shared
+   * by all patch sizes.
+   */
+  void BuildSmearedEnergyIntegral();
+
+  /**
+   * @brief Get the smeared energy of a patch from the summed-area table
+   * @param[in] colstart Starting column of the patch
+   * @param[in] rowstart Starting row of the patch
+   * @param[in] patchsize Size of the patch (in FastORs)
+   * @return Sum of the smeared energies in the patch
+   */
+  double GetSmearedPatchEnergy(Int_t colstart, Int_t rowstart, Int_t patchsize) const;
+
   std::set<Short_t>                         fBadChannels;                 ///< Container of bad channels
   std::set<Short_t>                         fOfflineBadChannels;          ///< Abd ID of offline bad channels
   TArrayF                                   fFastORPedestal;              ///< FastOR pedestal
@@ -619,6 +638,7 @@ protected:
   AliEMCALTriggerDataGrid<char>             *fLevel0TimeMap;              //!<! Map needed to store the level0 times
   AliEMCALTriggerDataGrid<int>              *fTriggerBitMap;              //!<! Map of trigger bits
   Double_t                                  fRhoValues[kNIndRho];         //!<! Rho values for background subtraction (only online ADC)
+  std::vector<double>                       fSmearedEnergyIntegral;       //!<! Summed-area table of the smeared energies, (cols+1) x (rows+1)
 
   Double_t                                  fADCtoGeV;                    //!<! Conversion factor from ADC to GeV
 
@@ -75,7 +75,9 @@ ClassImp(AliFlowAnalysisWithLeeYangZeros)
     fHistImDtheta(NULL),
     fHistQsumforChi(NULL),
     fCommonHists(NULL),
-    fCommonHistsRes(NULL)
+    fCommonHistsRes(NULL),
+    fRPPhi(),
+    fRPProjections()
   
 {
   //default constructor
@@ -1189,11 +1191,23 @@ void AliFlowAnalysisWithLeeYangZeros::GetOutputHistograms(TList *outputListHisto
   fQ2sum += vQ.Mod2();
   fHistQsumforChi->SetBinContent(3,fQ2sum);
   
+  //for the product generating function: get the RPs once for all theta and r
+  if (!fUseSum) {
+    fRPPhi.clear();
+    Int_t iNumberOfTracks = anEvent->NumberOfTracks();
+    for (Int_t i=0;i<iNumberOfTracks;i++) {
+      AliFlowTrackSimple* pTrack = anEvent->GetTrack(i);
+      if (!pTrack) {cerr << "no particle pointer !!!"<<endl; continue;}
+      if (pTrack->InRPSelection()) fRPPhi.push_back(pTrack->Phi());
+    }
+  }
+
   for (Int_t theta=0;theta<iNtheta;theta++) {
     Double_t dTheta = ((double)theta/iNtheta)*TMath::Pi()/dOrder; 
 	  
     //calculate dQtheta = cos(dOrder*(fPhi-dTheta);the projection of the Q vector on the reference direction dTheta
     Double_t dQtheta = GetQtheta(vQ, dTheta);
+    if (!fUseSum) FillRPProjections(dTheta);
 	     	   
     for (Int_t bin=1;bin<=iNbins;bin++) {
       Double_t dR = fHist1[theta]->GetBinCenter(bin); //bincentre of bins in histogram  //FIXED???
@@ -1204,7 +1218,7 @@ void AliFlowAnalysisWithLeeYangZeros::GetOutputHistograms(TList *outputListHisto
       }
       else {
 	//calculate the product generating function
-	cGtheta = GetGrtheta(anEvent, dR, dTheta);  
+	cGtheta = GetGrtheta(dR);  
 	if (cGtheta.Rho2() > 100.) break;
       }
       //fill real and imaginary part of cGtheta
@@ -1369,6 +1383,37 @@ TComplex AliFlowAnalysisWithLeeYangZeros::GetGrtheta(AliFlowEventSimple* const a
 } 
 
 
+//-----------------------------------------------------------------------   
+void AliFlowAnalysisWithLeeYangZeros::FillRPProjections(Double_t aTheta) 
+{
+  // cos(2(phi-theta)) of the RPs in fRPPhi, the factors of the product
+  // generating function are then 1 + i*r*projection for every r
+  
+  Double_t dOrder = 2.;
+  fRPProjections.resize(fRPPhi.size());
+  for (UInt_t i=0;i<fRPPhi.size();i++) {
+    fRPProjections[i] = cos(dOrder*(fRPPhi[i] - aTheta));
+  }
+}
+
+//-----------------------------------------------------------------------   
+TComplex AliFlowAnalysisWithLeeYangZeros::GetGrtheta(Double_t aR) const
+{
+  // Product Generating Function for LeeYangZeros method, same as
+  // GetGrtheta(anEvent, aR, aTheta) for the projections of FillRPProjections(aTheta)
+  
+  Double_t dRe = 1.;
+  Double_t dIm = 0.;
+  for (UInt_t i=0;i<fRPProjections.size();i++) {
+    Double_t dGIm = aR*fRPProjections[i];
+    Double_t dReNew = dRe - dIm*dGIm; //(dRe + i dIm)*(1 + i dGIm)
+    dIm = dRe*dGIm + dIm;
+    dRe = dReNew;
+  }
+  
+  return TComplex(dRe,dIm);
+}
+
 //-----------------------------------------------------------------------   
 TComplex AliFlowAnalysisWithLeeYangZeros::GetDiffFlow(AliFlowEventSimple* const anEvent, Double_t aR0, Int_t theta) 
 {
@@ -7,6 +7,8 @@
 #ifndef ALIFLOWANALYSISWITHLEEYANGZEROS_H
 #define ALIFLOWANALYSISWITHLEEYANGZEROS_H
 
+#include <vector>
+
 ////////////////////////////////////////////////////////////////////
 // Description: Maker to analyze Flow by the LeeYangZeros method
 //              One needs to do two runs over the data; 
@@ -128,6 +130,8 @@ class AliFlowAnalysisWithLeeYangZeros {
    Bool_t   MakeControlHistograms(AliFlowEventSimple* anEvent); 
    Bool_t   FillFromFlowEvent(AliFlowEventSimple* anEvent);
    Bool_t   SecondFillFromFlowEvent(AliFlowEventSimple* anEvent);
+   void     FillRPProjections(Double_t aTheta);  //projections of the RPs on direction aTheta
+   TComplex GetGrtheta(Double_t aR) const;       //product generating function from the projections
 
 #ifndef __CINT__
    
@@ -169,6 +173,9 @@ class AliFlowAnalysisWithLeeYangZeros {
 
   AliFlowCommonHist*        fCommonHists;     //control histograms
   AliFlowCommonHistResults* fCommonHistsRes;  //final results histograms
+
+  std::vector<Double_t> fRPPhi;          //! phi of the RPs of the current event
+  std::vector<Double_t> fRPProjections;  //! cos(2(phi-theta)) of the RPs for the current theta
  
   ClassDef(AliFlowAnalysisWithLeeYangZeros,0)  // macro for rootcint
 };
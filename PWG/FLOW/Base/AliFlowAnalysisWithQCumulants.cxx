@@ -362,6 +362,9 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
  Double_t wPt  = 1.; // pt weight
  Double_t wEta = 1.; // eta weight
  Double_t wTrack = 1.; // track weight
+ Double_t wPow[9] = {0.}; // (wPhi*wPt*wEta*wTrack)^k
+ Double_t cosPhi[12] = {0.}; // cos((m+1)*n*dPhi)
+ Double_t sinPhi[12] = {0.}; // sin((m+1)*n*dPhi)
  Int_t nCounterNoRPs = 0; // needed only for shuffling
  fNumberOfRPsEBE = anEvent->GetNumberOfRPs(); // number of RPs (i.e. number of reference particles)
  if(fExactNoRPs > 0 && fNumberOfRPsEBE<fExactNoRPs){return;}
@@ -409,13 +412,16 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
     {
      wTrack = aftsTrack->Weight(); 
     }
+    // Powers of the weight and harmonics of the azimuthal angle, calculated once for all loops bellow:
+    for(Int_t k=0;k<9;k++){wPow[k]=pow(wPhi*wPt*wEta*wTrack,k);}
+    for(Int_t m=0;m<12;m++){cosPhi[m]=TMath::Cos((m+1)*n*dPhi);sinPhi[m]=TMath::Sin((m+1)*n*dPhi);}
     // Calculate Re[Q_{m*n,k}] and Im[Q_{m*n,k}] for this event (m = 1,2,...,12, k = 0,1,...,8):
     for(Int_t m=0;m<12;m++) // to be improved - hardwired 6 
     {
      for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
      {
-      (*fReQ)(m,k)+=pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1)*n*dPhi); 
-      (*fImQ)(m,k)+=pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1)*n*dPhi); 
+      (*fReQ)(m,k)+=wPow[k]*cosPhi[m]; 
+      (*fImQ)(m,k)+=wPow[k]*sinPhi[m]; 
      } 
     }
     // Calculate S_{p,k} for this event (Remark: final calculation of S_{p,k} follows after the loop over data bellow):
@@ -423,7 +429,7 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
     {
      for(Int_t k=0;k<9;k++)
      {     
-      (*fSpk)(p,k)+=pow(wPhi*wPt*wEta*wTrack,k);
+      (*fSpk)(p,k)+=wPow[k];
      }
     } 
     // Differential flow:
@@ -440,21 +446,21 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
        {
         for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
         {
-         fReRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-         fImRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);          
+         fReRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],wPow[k]*cosPhi[m],1.);
+         fImRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],wPow[k]*sinPhi[m],1.);          
          if(m==0) // s_{p,k} does not depend on index m
          {
-          fs1dEBE[0][pe][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k),1.);
+          fs1dEBE[0][pe][k]->Fill(ptEta[pe],wPow[k],1.);
          } // end of if(m==0) // s_{p,k} does not depend on index m
         } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
        } // end of if(fCalculateDiffFlow) 
        if(fCalculate2DDiffFlow)
        {
-        fReRPQ2dEBE[0][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-        fImRPQ2dEBE[0][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);      
+        fReRPQ2dEBE[0][m][k]->Fill(dPt,dEta,wPow[k]*cosPhi[m],1.);
+        fImRPQ2dEBE[0][m][k]->Fill(dPt,dEta,wPow[k]*sinPhi[m],1.);      
         if(m==0) // s_{p,k} does not depend on index m
         {
-         fs2dEBE[0][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k),1.);
+         fs2dEBE[0][k]->Fill(dPt,dEta,wPow[k],1.);
         } // end of if(m==0) // s_{p,k} does not depend on index m
        } // end of if(fCalculate2DDiffFlow)
       } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
@@ -471,21 +477,21 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
         {
          for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
          {
-          fReRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-          fImRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);          
+          fReRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],wPow[k]*cosPhi[m],1.);
+          fImRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],wPow[k]*sinPhi[m],1.);          
           if(m==0) // s_{p,k} does not depend on index m
           {
-           fs1dEBE[2][pe][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k),1.);
+           fs1dEBE[2][pe][k]->Fill(ptEta[pe],wPow[k],1.);
           } // end of if(m==0) // s_{p,k} does not depend on index m
          } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
         } // end of if(fCalculateDiffFlow) 
         if(fCalculate2DDiffFlow)
         {
-         fReRPQ2dEBE[2][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-         fImRPQ2dEBE[2][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);      
+         fReRPQ2dEBE[2][m][k]->Fill(dPt,dEta,wPow[k]*cosPhi[m],1.);
+         fImRPQ2dEBE[2][m][k]->Fill(dPt,dEta,wPow[k]*sinPhi[m],1.);      
          if(m==0) // s_{p,k} does not depend on index m
          {
-          fs2dEBE[2][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k),1.);
+          fs2dEBE[2][k]->Fill(dPt,dEta,wPow[k],1.);
          } // end of if(m==0) // s_{p,k} does not depend on index m
         } // end of if(fCalculate2DDiffFlow)
        } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
@@ -519,6 +525,12 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
     {
      wTrack = aftsTrack->Weight(); 
     }
+    // Powers of the weight and harmonics of the azimuthal angle, calculated once for all loops bellow:
+    if(fCalculateDiffFlow || fCalculate2DDiffFlow)
+    {
+     for(Int_t k=0;k<9;k++){wPow[k]=pow(wPhi*wPt*wEta*wTrack,k);}
+     for(Int_t m=0;m<4;m++){cosPhi[m]=TMath::Cos((m+1)*n*dPhi);sinPhi[m]=TMath::Sin((m+1)*n*dPhi);}
+    }
     ptEta[0] = dPt;
     ptEta[1] = dEta;
     // Calculate p_{m*n,k} ('p-vector' for POIs): 
@@ -530,14 +542,14 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
       {
        for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
        {
-        fReRPQ1dEBE[1][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-        fImRPQ1dEBE[1][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);          
+        fReRPQ1dEBE[1][pe][m][k]->Fill(ptEta[pe],wPow[k]*cosPhi[m],1.);
+        fImRPQ1dEBE[1][pe][m][k]->Fill(ptEta[pe],wPow[k]*sinPhi[m],1.);          
        } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
       } // end of if(fCalculateDiffFlow) 
       if(fCalculate2DDiffFlow)
       {
-       fReRPQ2dEBE[1][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-       fImRPQ2dEBE[1][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);      
+       fReRPQ2dEBE[1][m][k]->Fill(dPt,dEta,wPow[k]*cosPhi[m],1.);
+       fImRPQ2dEBE[1][m][k]->Fill(dPt,dEta,wPow[k]*sinPhi[m],1.);      
       } // end of if(fCalculate2DDiffFlow)
      } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
     } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9    
@@ -76,6 +76,9 @@ AliFlowEventSimple::AliFlowEventSimple():
   fShuffledIndexes(NULL),
   fShuffleTracks(kFALSE),
   fMothersCollection(NULL),
+  fTrackColumns(),
+  fTrackColumnsValid(kFALSE),
+  fUseTrackColumns(kFALSE),
   fCentrality(-1.),
   fCentralityCL1(-1.),
   fNITSCL1(-1.),
@@ -139,6 +142,9 @@ AliFlowEventSimple::AliFlowEventSimple( Int_t n,
   fShuffledIndexes(NULL),
   fShuffleTracks(kFALSE),
   fMothersCollection(new TObjArray()),
+  fTrackColumns(),
+  fTrackColumnsValid(kFALSE),
+  fUseTrackColumns(kFALSE),
   fCentrality(-1.),
   fCentralityCL1(-1.),
   fNITSCL1(-1.),
@@ -204,6 +210,9 @@ AliFlowEventSimple::AliFlowEventSimple(const AliFlowEventSimple& anEvent):
   fShuffledIndexes(NULL),
   fShuffleTracks(anEvent.fShuffleTracks),
   fMothersCollection(new TObjArray()),
+  fTrackColumns(),
+  fTrackColumnsValid(kFALSE),
+  fUseTrackColumns(anEvent.fUseTrackColumns),
   fCentrality(anEvent.fCentrality),
   fCentralityCL1(anEvent.fCentralityCL1),
   fNITSCL1(anEvent.fNITSCL1),
@@ -297,6 +306,8 @@ AliFlowEventSimple& AliFlowEventSimple::operator=(const AliFlowEventSimple& anEv
   fNumberOfPOIsWrap = anEvent.fNumberOfPOIsWrap;
   fMCReactionPlaneAngleWrap = anEvent.fMCReactionPlaneAngleWrap;
   fShuffleTracks = anEvent.fShuffleTracks;
+  fTrackColumnsValid = kFALSE;
+  fUseTrackColumns = anEvent.fUseTrackColumns;
   fCentrality = anEvent.fCentrality;
   fCentralityCL1 = anEvent.fCentralityCL1;
   fNITSCL1 = anEvent.fNITSCL1;
@@ -428,6 +439,7 @@ void AliFlowEventSimple::Generate(Int_t nParticles,
     fMCReactionPlaneAngleIsSet=kTRUE;
   }
   SetUserModified();
+  InvalidateTrackColumns();
 }
 
 //-----------------------------------------------------------------------
@@ -486,6 +498,7 @@ void AliFlowEventSimple::TrackAdded()
 {
   //book keeping after a new track has been added
   fNumberOfTracks++;
+  InvalidateTrackColumns();
   if (fShuffledIndexes)
   {
     delete [] fShuffledIndexes;
@@ -504,6 +517,49 @@ AliFlowTrackSimple* AliFlowEventSimple::MakeNewTrack()
    return t;
 }
 
+//-----------------------------------------------------------------------
+const AliFlowEventSimple::TrackColumns& AliFlowEventSimple::GetTrackColumns()
+{
+  //columnar copy of the tracks, filled once and kept until the tracks are changed
+  //through the methods of the event. The memory is kept from event to event.
+  //If tracks are modified through GetTrack(), call InvalidateTrackColumns().
+  if (fTrackColumnsValid) return fTrackColumns;
+  TrackColumns& c = fTrackColumns;
+  c.fN = fNumberOfTracks;
+  c.fPhi.resize(c.fN);
+  c.fPt.resize(c.fN);
+  c.fEta.resize(c.fN);
+  c.fWeight.resize(c.fN);
+  c.fCharge.resize(c.fN);
+  c.fPOIBits.resize(c.fN);
+  c.fSubeventBits.resize(c.fN);
+  for (Int_t i=0; i<c.fN; i++)
+  {
+    AliFlowTrackSimple* pTrack = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
+    if (!pTrack)
+    {
+      c.fPhi[i] = c.fPt[i] = c.fEta[i] = c.fWeight[i] = 0.;
+      c.fCharge[i] = 0;
+      c.fPOIBits[i] = c.fSubeventBits[i] = 0;
+      continue;
+    }
+    c.fPhi[i] = pTrack->Phi();
+    c.fPt[i] = pTrack->Pt();
+    c.fEta[i] = pTrack->Eta();
+    c.fWeight[i] = pTrack->Weight();
+    c.fCharge[i] = pTrack->Charge();
+    UInt_t bits = 0;
+    const TBits* poiBits = pTrack->GetPOItype();
+    for (UInt_t b=poiBits->FirstSetBit(); b<UInt_t(TrackColumns::kNBits); b=poiBits->FirstSetBit(b+1)) bits |= 1u<<b;
+    c.fPOIBits[i] = bits;
+    bits = 0;
+    for (Int_t s=0; s<TrackColumns::kNBits; s++) if (pTrack->InSubevent(s)) bits |= 1u<<s;
+    c.fSubeventBits[i] = bits;
+  }
+  fTrackColumnsValid = kTRUE;
+  return fTrackColumns;
+}
+
 //-----------------------------------------------------------------------
 AliFlowVector AliFlowEventSimple::GetQ( Int_t n,
                                         TList *weightsList,
@@ -567,18 +623,31 @@ AliFlowVector AliFlowEventSimple::GetQ( Int_t n,
     }
   } // end of if(weightsList)
 
+  // read the tracks from the columnar copy if asked
+  const TrackColumns* columns = fUseTrackColumns ? &GetTrackColumns() : NULL;
+
   // loop over tracks
   for(Int_t i=0; i<fNumberOfTracks; i++)
   {
-    pTrack = (AliFlowTrackSimple*)fTrackCollection->At(i);
-    if(pTrack)
+    pTrack = columns ? NULL : (AliFlowTrackSimple*)fTrackCollection->At(i);
+    if(columns || pTrack)
     {
-      if(pTrack->InRPSelection())
+      if(columns ? columns->InRPSelection(i) : pTrack->InRPSelection())
       {
-        dPhi = pTrack->Phi();
-        dPt  = pTrack->Pt();
-        dEta = pTrack->Eta();
-	      dWeight = pTrack->Weight();
+        if(columns)
+        {
+          dPhi = columns->GetPhi()[i];
+          dPt  = columns->GetPt()[i];
+          dEta = columns->GetEta()[i];
+          dWeight = columns->GetWeight()[i];
+        }
+        else
+        {
+          dPhi = pTrack->Phi();
+          dPt  = pTrack->Pt();
+          dEta = pTrack->Eta();
+          dWeight = pTrack->Weight();
+        }
 
         // determine Phi weight: (to be improved, I should here only access it + the treatment of gaps in the if statement)
         if(phiWeights && nBinsPhi)
@@ -692,65 +761,77 @@ void AliFlowEventSimple::Get2Qsub( AliFlowVector* Qarray,
     }
   } // end of if(weightsList)
 
+  // read the tracks from the columnar copy if asked
+  const TrackColumns* columns = fUseTrackColumns ? &GetTrackColumns() : NULL;
+
   //loop over the two subevents
   for (Int_t s=0; s<2; s++)
   {
     // loop over tracks
     for(Int_t i=0; i<fNumberOfTracks; i++)
     {
-      pTrack = (AliFlowTrackSimple*)fTrackCollection->At(i);
-      if(!pTrack)
+      if(columns)
       {
-        cerr << "no particle!!!"<<endl;
-        continue;
+        if(!(columns->InRPSelection(i) && columns->InSubevent(i,s))) continue;
+        dPhi    = columns->GetPhi()[i];
+        dPt     = columns->GetPt()[i];
+        dEta    = columns->GetEta()[i];
+        dWeight = columns->GetWeight()[i];
       }
-      if(pTrack->InRPSelection() && (pTrack->InSubevent(s)))
+      else
       {
+        pTrack = (AliFlowTrackSimple*)fTrackCollection->At(i);
+        if(!pTrack)
+        {
+          cerr << "no particle!!!"<<endl;
+          continue;
+        }
+        if(!(pTrack->InRPSelection() && (pTrack->InSubevent(s)))) continue;
         dPhi    = pTrack->Phi();
         dPt     = pTrack->Pt();
         dEta    = pTrack->Eta();
         dWeight = pTrack->Weight();
+      }
 
-        // determine Phi weight: (to be improved, I should here only access it + the treatment of gaps in the if statement)
-        //subevent 0
-        if(s == 0)  {
-          if(phiWeightsSub0 && iNbinsPhiSub0)  {
-            Int_t phiBin = 1+(Int_t)(TMath::Floor(dPhi*iNbinsPhiSub0/TMath::TwoPi()));
-            //use the phi value at the center of the bin
-            dPhi  = phiWeightsSub0->GetBinCenter(phiBin);
-            dWphi = phiWeightsSub0->GetBinContent(phiBin);
-          }
+      // determine Phi weight: (to be improved, I should here only access it + the treatment of gaps in the if statement)
+      //subevent 0
+      if(s == 0)  {
+        if(phiWeightsSub0 && iNbinsPhiSub0)  {
+          Int_t phiBin = 1+(Int_t)(TMath::Floor(dPhi*iNbinsPhiSub0/TMath::TwoPi()));
+          //use the phi value at the center of the bin
+          dPhi  = phiWeightsSub0->GetBinCenter(phiBin);
+          dWphi = phiWeightsSub0->GetBinContent(phiBin);
         }
-        //subevent 1
-        else if (s == 1) {
-          if(phiWeightsSub1 && iNbinsPhiSub1) {
-            Int_t phiBin = 1+(Int_t)(TMath::Floor(dPhi*iNbinsPhiSub1/TMath::TwoPi()));
-            //use the phi value at the center of the bin
-            dPhi  = phiWeightsSub1->GetBinCenter(phiBin);
-            dWphi = phiWeightsSub1->GetBinContent(phiBin);
-          }
+      }
+      //subevent 1
+      else if (s == 1) {
+        if(phiWeightsSub1 && iNbinsPhiSub1) {
+          Int_t phiBin = 1+(Int_t)(TMath::Floor(dPhi*iNbinsPhiSub1/TMath::TwoPi()));
+          //use the phi value at the center of the bin
+          dPhi  = phiWeightsSub1->GetBinCenter(phiBin);
+          dWphi = phiWeightsSub1->GetBinContent(phiBin);
         }
+      }
 
-        // determine v'(pt) weight:
-        if(ptWeights && dBinWidthPt)
-        {
-          dWpt=ptWeights->GetBinContent(1+(Int_t)(TMath::Floor((dPt-dPtMin)/dBinWidthPt)));
-        }
+      // determine v'(pt) weight:
+      if(ptWeights && dBinWidthPt)
+      {
+        dWpt=ptWeights->GetBinContent(1+(Int_t)(TMath::Floor((dPt-dPtMin)/dBinWidthPt)));
+      }
 
-        // determine v'(eta) weight:
-        if(etaWeights && dBinWidthEta)
-        {
-          dWeta=etaWeights->GetBinContent(1+(Int_t)(TMath::Floor((dEta-dEtaMin)/dBinWidthEta)));
-        }
+      // determine v'(eta) weight:
+      if(etaWeights && dBinWidthEta)
+      {
+        dWeta=etaWeights->GetBinContent(1+(Int_t)(TMath::Floor((dEta-dEtaMin)/dBinWidthEta)));
+      }
 
-        // building up the weighted Q-vector:
-        dQX += dWeight*dWphi*dWpt*dWeta*TMath::Cos(iOrder*dPhi);
-        dQY += dWeight*dWphi*dWpt*dWeta*TMath::Sin(iOrder*dPhi);
+      // building up the weighted Q-vector:
+      dQX += dWeight*dWphi*dWpt*dWeta*TMath::Cos(iOrder*dPhi);
+      dQY += dWeight*dWphi*dWpt*dWeta*TMath::Sin(iOrder*dPhi);
 
-        // weighted multiplicity:
-        sumOfWeights+=dWeight*dWphi*dWpt*dWeta;
+      // weighted multiplicity:
+      sumOfWeights+=dWeight*dWphi*dWpt*dWeta;
 
-      } // end of if (pTrack->InRPSelection())
     } // loop over particles
 
     Qarray[s].Set(dQX,dQY);
@@ -944,6 +1025,9 @@ AliFlowEventSimple::AliFlowEventSimple( TTree* inputTree,
   fShuffledIndexes(NULL),
   fShuffleTracks(kFALSE),
   fMothersCollection(new TObjArray()),
+  fTrackColumns(),
+  fTrackColumnsValid(kFALSE),
+  fUseTrackColumns(kFALSE),
   fCentrality(-1.),
   fCentralityCL1(-1.),
   fNITSCL1(-1.),
@@ -1035,6 +1119,7 @@ void AliFlowEventSimple::CloneTracks(Int_t n)
     }
   }
   SetUserModified();
+  InvalidateTrackColumns();
 }
 
 //_____________________________________________________________________________
@@ -1047,6 +1132,7 @@ void AliFlowEventSimple::ResolutionPt(Double_t res)
     if (track) track->ResolutionPt(res);
   }
   SetUserModified();
+  InvalidateTrackColumns();
 }
 
 //_____________________________________________________________________________
@@ -1065,6 +1151,7 @@ void AliFlowEventSimple::TagSubeventsInEta( Double_t etaMinA,
     if (eta >= etaMinA && eta <= etaMaxA) track->SetForSubevent(0);
     if (eta >= etaMinB && eta <= etaMaxB) track->SetForSubevent(1);
   }
+  InvalidateTrackColumns();
 }
 
 //_____________________________________________________________________________
@@ -1080,6 +1167,7 @@ void AliFlowEventSimple::TagSubeventsByCharge()
     if (charge<0) track->SetForSubevent(0);
     if (charge>0) track->SetForSubevent(1);
   }
+  InvalidateTrackColumns();
 }
 
 //_____________________________________________________________________________
@@ -1097,6 +1185,7 @@ void AliFlowEventSimple::AddV1( Double_t v1 )
     }
   }
   SetUserModified();
+  InvalidateTrackColumns();
 }
 
 //_____________________________________________________________________________
@@ -1114,6 +1203,7 @@ void AliFlowEventSimple::AddV2( Double_t v2 )
     }
   }
   SetUserModified();
+  InvalidateTrackColumns();
 }
 
 //_____________________________________________________________________________
@@ -1131,6 +1221,7 @@ void AliFlowEventSimple::AddV3( Double_t v3 )
     }
   }
   SetUserModified();
+  InvalidateTrackColumns();
 }
 
 //_____________________________________________________________________________
@@ -1148,6 +1239,7 @@ void AliFlowEventSimple::AddV4( Double_t v4 )
     }
   }
   SetUserModified();
+  InvalidateTrackColumns();
 }
 
 //_____________________________________________________________________________
@@ -1165,6 +1257,7 @@ void AliFlowEventSimple::AddV5( Double_t v5 )
     }
   }
   SetUserModified();
+  InvalidateTrackColumns();
 }
 
 //_____________________________________________________________________________
@@ -1178,6 +1271,7 @@ void AliFlowEventSimple::AddFlow( Double_t v1, Double_t v2, Double_t v3, Double_
     if (track) track->AddFlow(v1,v2,v3,v4,v5,rp1,rp2,rp3,rp4,rp5,fAfterBurnerPrecision);
   }
   SetUserModified();
+  InvalidateTrackColumns();
 }
 
 //_____________________________________________________________________________
@@ -1190,6 +1284,7 @@ void AliFlowEventSimple::AddFlow( Double_t v1, Double_t v2, Double_t v3, Double_
     if (track) track->AddFlow(v1,v2,v3,v4,v5,fMCReactionPlaneAngle, fAfterBurnerPrecision);
   }
   SetUserModified();
+  InvalidateTrackColumns();
 }
 
 //_____________________________________________________________________________
@@ -1204,6 +1299,7 @@ void AliFlowEventSimple::AddV2( TF1* ptDepV2 )
     track->AddV2(v2, fMCReactionPlaneAngle, fAfterBurnerPrecision);
   }
   SetUserModified();
+  InvalidateTrackColumns();
 }
 
 //_____________________________________________________________________________
@@ -1218,6 +1314,7 @@ void AliFlowEventSimple::AddV2( TF2* ptEtaDepV2 )
     track->AddV2(v2, fMCReactionPlaneAngle, fAfterBurnerPrecision);
   }
   SetUserModified();
+  InvalidateTrackColumns();
 }
 
 //_____________________________________________________________________________
@@ -1240,6 +1337,7 @@ void AliFlowEventSimple::TagRP( const AliFlowTrackSimpleCuts* cuts )
     }
     track->SetForRPSelection(pass);
   }
+  InvalidateTrackColumns();
 }
 
 //_____________________________________________________________________________
@@ -1262,6 +1360,7 @@ void AliFlowEventSimple::TagPOI( const AliFlowTrackSimpleCuts* cuts, Int_t poiTy
     }
     track->Tag(poiType,pass);
   }
+  InvalidateTrackColumns();
 }
 
 //_____________________________________________________________________________
@@ -1294,6 +1393,7 @@ void AliFlowEventSimple::DefineDeadZone( Double_t etaMin,
       track->ResetPOItype();
     }
   }
+  InvalidateTrackColumns();
 }
 
 //_____________________________________________________________________________
@@ -1311,6 +1411,7 @@ Int_t AliFlowEventSimple::CleanUpDeadTracks()
   fTrackCollection->Compress(); //clean up empty slots
   fNumberOfTracks-=ncleaned; //update number of tracks
   delete [] fShuffledIndexes; fShuffledIndexes=NULL;
+  InvalidateTrackColumns();
   return ncleaned;
 }
 
@@ -1350,4 +1451,5 @@ void AliFlowEventSimple::ClearFast()
   fAfterBurnerPrecision = 0.001;
   fUserModified = kFALSE;
   delete [] fShuffledIndexes; fShuffledIndexes=NULL;
+  InvalidateTrackColumns();
 }
@@ -16,6 +16,7 @@
 #ifndef ALIFLOWEVENTSIMPLE_H
 #define ALIFLOWEVENTSIMPLE_H
 
+#include <vector>
 #include "TObject.h"
 #include "TParameter.h"
 #include "TMath.h"
@@ -32,6 +33,34 @@ class AliFlowEventSimple: public TObject {
 
   enum ConstructionMethod {kEmpty,kGenerate};
 
+  // Contiguous copy of the tracks of the event, in the order of the track collection:
+  // phi, pt, eta, weight, charge, POI type bits (bit 0 = RP) and subevent bits of track i.
+  // Only the first kNBits POI types and subevents are kept. Filled by GetTrackColumns().
+  class TrackColumns {
+   public:
+    enum { kNBits = 32 };
+    TrackColumns() : fN(0), fPhi(), fPt(), fEta(), fWeight(), fCharge(), fPOIBits(), fSubeventBits() {}
+    Int_t           GetN() const                                  { return fN; }
+    const Double_t* GetPhi() const                                { return fPhi.data(); }
+    const Double_t* GetPt() const                                 { return fPt.data(); }
+    const Double_t* GetEta() const                                { return fEta.data(); }
+    const Double_t* GetWeight() const                             { return fWeight.data(); }
+    const Int_t*    GetCharge() const                             { return fCharge.data(); }
+    Bool_t          InRPSelection(Int_t i) const                  { return fPOIBits[i]&1u; }
+    Bool_t          InPOISelection(Int_t i, Int_t poiType=1) const { return poiType>=0 && poiType<kNBits && ((fPOIBits[i]>>poiType)&1u); }
+    Bool_t          InSubevent(Int_t i, Int_t s) const            { return s>=0 && s<kNBits && ((fSubeventBits[i]>>s)&1u); }
+   private:
+    friend class AliFlowEventSimple;
+    Int_t                 fN;            // number of tracks
+    std::vector<Double_t> fPhi;          // phi
+    std::vector<Double_t> fPt;           // pt
+    std::vector<Double_t> fEta;          // eta
+    std::vector<Double_t> fWeight;       // track weight
+    std::vector<Int_t>    fCharge;       // charge
+    std::vector<UInt_t>   fPOIBits;      // POI type bits, 0 for missing tracks
+    std::vector<UInt_t>   fSubeventBits; // subevent bits
+  };
+
   AliFlowEventSimple();
   AliFlowEventSimple( Int_t nParticles,
                       ConstructionMethod m=kEmpty,
@@ -117,6 +146,11 @@ class AliFlowEventSimple: public TObject {
   void TrackAdded();
   AliFlowTrackSimple* MakeNewTrack();
 
+  const TrackColumns& GetTrackColumns();
+  void     InvalidateTrackColumns()               { fTrackColumnsValid = kFALSE; }
+  void     SetUseTrackColumns(Bool_t b=kTRUE)     { fUseTrackColumns = b; }
+  Bool_t   GetUseTrackColumns() const             { return fUseTrackColumns; }
+
   virtual AliFlowVector GetQ(Int_t n=2, TList *weightsList=NULL, Bool_t usePhiWeights=kFALSE, Bool_t usePtWeights=kFALSE, Bool_t useEtaWeights=kFALSE);
   virtual void Get2Qsub(AliFlowVector* Qarray, Int_t n=2, TList *weightsList=NULL, Bool_t usePhiWeights=kFALSE, Bool_t usePtWeights=kFALSE, Bool_t useEtaWeights=kFALSE);
   virtual void GetZDC2Qsub(AliFlowVector* Qarray);
@@ -192,6 +226,9 @@ class AliFlowEventSimple: public TObject {
   Int_t*                  fShuffledIndexes;           //! placeholder for randomized indexes
   Bool_t                  fShuffleTracks;             // do we shuffle tracks on get?
   TObjArray*              fMothersCollection;         //!cache the particles with daughters
+  TrackColumns            fTrackColumns;              //! columnar copy of the tracks
+  Bool_t                  fTrackColumnsValid;         //! fTrackColumns is up to date
+  Bool_t                  fUseTrackColumns;           //! GetQ and Get2Qsub read the tracks from fTrackColumns
   Double_t                fCentrality;                // centrality
   Double_t                fCentralityCL1;             // centrality (CL1)
   Double_t                fNITSCL1;                   // number of clusters in ITS layer 1
@@ -73,7 +73,8 @@ fPi(TMath::Pi()),
 fUniformEfficiency(kTRUE),
 fPtMin(0.5),
 fPtMax(1.0),
-fPtProbability(0.75) 
+fPtProbability(0.75),
+fUseTrackColumns(kFALSE)
 {
  // Constructor.
   
@@ -202,6 +203,7 @@ AliFlowEventSimple* AliFlowEventSimpleMakerOnTheFly::CreateEventOnTheFly(AliFlow
  AliFlowEventSimple *pEvent = new AliFlowEventSimple(iMult); 
  pEvent->SetReferenceMultiplicity(iMult);
  pEvent->SetMCReactionPlaneAngle(dReactionPlane); 
+ pEvent->SetUseTrackColumns(fUseTrackColumns);
  Int_t nRPs = 0; // number of particles tagged RP in this event
  Int_t nPOIs = 0; // number of particles tagged POI in this event
  for(Int_t p=0;p<iMult;p++)
@@ -90,6 +90,8 @@ class AliFlowEventSimpleMakerOnTheFly{
   Double_t GetPtMax() const {return this->fPtMax;} 
   void SetPtProbability(Double_t ptp) {this->fPtProbability = ptp;}
   Double_t GetPtProbability() const {return this->fPtProbability;} 
+  void SetUseTrackColumns(Bool_t utc) {this->fUseTrackColumns = utc;}
+  Bool_t GetUseTrackColumns() const {return this->fUseTrackColumns;} 
 
  private:
   AliFlowEventSimpleMakerOnTheFly(const AliFlowEventSimpleMakerOnTheFly& anAnalysis); // copy constructor
@@ -130,8 +132,9 @@ class AliFlowEventSimpleMakerOnTheFly{
   Double_t fPtMin; // non-uniform efficiency vs pT starts at pT = fPtMin
   Double_t fPtMax; // non-uniform efficiency vs pT ends at pT = fPtMax
   Double_t fPtProbability; // particles emitted in fPtMin <= pT < fPtMax are taken with probability fPtProbability 
+  Bool_t fUseTrackColumns; // events read their tracks from AliFlowEventSimple::GetTrackColumns() in GetQ and Get2Qsub
 
-  ClassDef(AliFlowEventSimpleMakerOnTheFly,1) // macro for rootcint
+  ClassDef(AliFlowEventSimpleMakerOnTheFly,2) // macro for rootcint
 };
  
 #endif
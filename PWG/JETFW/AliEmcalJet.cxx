@@ -64,7 +64,8 @@ AliEmcalJet::AliEmcalJet() :
   fJetShapeProperties(0),
   fJetAcceptanceType(0),
   fParticleConstituents(),
-  fClusterConstituents()
+  fClusterConstituents(),
+  fConstituentsView()
 {
   fClosestJets[0] = 0;
   fClosestJets[1] = 0;
@@ -116,7 +117,8 @@ AliEmcalJet::AliEmcalJet(Double_t px, Double_t py, Double_t pz) :
   fJetShapeProperties(0),
   fJetAcceptanceType(0),
   fParticleConstituents(),
-  fClusterConstituents()
+  fClusterConstituents(),
+  fConstituentsView()
 {
   if (fPt != 0) {
     fPhi = TVector2::Phi_0_2pi(TMath::ATan2(py, px));
@@ -173,7 +175,8 @@ AliEmcalJet::AliEmcalJet(Double_t pt, Double_t eta, Double_t phi, Double_t m) :
   fJetShapeProperties(0),
   fJetAcceptanceType(0),
   fParticleConstituents(),
-  fClusterConstituents()
+  fClusterConstituents(),
+  fConstituentsView()
 {
   fPhi = TVector2::Phi_0_2pi(fPhi);
 
@@ -224,7 +227,8 @@ AliEmcalJet::AliEmcalJet(const AliEmcalJet& jet) :
   fJetShapeProperties(0),
   fJetAcceptanceType(jet.fJetAcceptanceType),
   fParticleConstituents(jet.fParticleConstituents),
-  fClusterConstituents(jet.fClusterConstituents)
+  fClusterConstituents(jet.fClusterConstituents),
+  fConstituentsView(jet.fConstituentsView)
 
 {
   // Copy constructor.
@@ -296,6 +300,7 @@ AliEmcalJet& AliEmcalJet::operator=(const AliEmcalJet& jet)
     fJetAcceptanceType  = jet.fJetAcceptanceType;
     fParticleConstituents = jet.fParticleConstituents;
     fClusterConstituents = jet.fClusterConstituents;
+    fConstituentsView = jet.fConstituentsView;
   }
 
   return *this;
@@ -677,6 +682,7 @@ void AliEmcalJet::Clear(Option_t */*option*/)
   fHasGhost = kFALSE;
   fClusterConstituents.clear();
   fParticleConstituents.clear();
+  fConstituentsView.Reset();
 }
 
 /**
@@ -853,6 +859,29 @@ void AliEmcalJet::AddFlavourTrack(AliVParticle* hftrack)
   fFlavourTracks->Add(hftrack);
 }
 
+/**
+ * Fill the contiguous view of the constituent kinematics. Track constituents are taken
+ * from the given array (or from the global container index map), cluster constituents
+ * from the cluster constituent objects, if they were filled by the jet finder.
+ * @param tracks Array with the tracks
+ * @return View with the constituent kinematics
+ */
+const PWG::JETFW::AliEmcalJetConstituentsView &AliEmcalJet::FillConstituentsView(TClonesArray *tracks)
+{
+  fConstituentsView.Reset();
+  fConstituentsView.Reserve(GetNumberOfTracks() + fClusterConstituents.size());
+  for (Int_t i = 0; i < GetNumberOfTracks(); i++) {
+    AliVParticle *part = tracks ? TrackAt(i, tracks) : Track(i);
+    if (!part) continue;
+    fConstituentsView.AddParticle(part->Pt(), part->Eta(), part->Phi(), part->M(), part->Charge(), part->GetLabel());
+  }
+  for (const auto &clust : fClusterConstituents) {
+    fConstituentsView.AddCluster(clust.Pt(), clust.Eta(), clust.Phi(), 0., clust.GetCluster() ? clust.GetCluster()->GetLabel() : -1);
+  }
+  fConstituentsView.SetFilled();
+  return fConstituentsView;
+}
+
 void AliEmcalJet::AddParticleConstituent(const AliVParticle *const part, Bool_t isEmbedding, UInt_t globalIndex) {
   PWG::JETFW::AliEmcalParticleJetConstituent constituent(part);
   constituent.SetIsFromEmbeddedEvent(isEmbedding);
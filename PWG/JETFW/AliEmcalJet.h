@@ -22,6 +22,7 @@
 #include "AliEmcalJetShapeProperties.h"
 #include "AliEmcalClusterJetConstituent.h"
 #include "AliEmcalParticleJetConstituent.h"
+#include "AliEmcalJetConstituentsView.h"
 
 /**
  * @class AliEmcalJet
@@ -241,6 +242,28 @@ class AliEmcalJet : public AliVParticle
    */
   bool HasParticleConstituent(const AliVParticle *const part) const;
 
+  /**
+   * @brief Get the contiguous view of the constituent kinematics
+   *
+   * The view is filled by the jet finder (see AliEmcalJetTask::SetFillConstituentsView)
+   * or by FillConstituentsView. Use HasConstituentsView to check whether it is available.
+   * @return View with pt, eta, phi, mass, charge and label of the constituents
+   */
+  const PWG::JETFW::AliEmcalJetConstituentsView &GetConstituentsView() const { return fConstituentsView; }
+
+  /**
+   * @brief Check whether the constituent view has been filled for this jet
+   * @return True if the view is available
+   */
+  Bool_t HasConstituentsView() const { return fConstituentsView.IsFilled(); }
+
+  /**
+   * @brief Fill the constituent view from the track constituents and, if available, the cluster constituents
+   * @param[in] tracks Array with the tracks (if null the global container index map is used)
+   * @return View with the constituent kinematics
+   */
+  const PWG::JETFW::AliEmcalJetConstituentsView &FillConstituentsView(TClonesArray *tracks = 0);
+
   // Fragmentation function
   Double_t          GetZ(const Double_t trkPx, const Double_t trkPy, const Double_t trkPz)  const;
   Double_t          GetZ(const AliVParticle* trk )                                          const;
@@ -435,6 +458,7 @@ class AliEmcalJet : public AliVParticle
 
   std::vector<PWG::JETFW::AliEmcalParticleJetConstituent>      fParticleConstituents;  ///< List of particle constituents
   std::vector<PWG::JETFW::AliEmcalClusterJetConstituent>       fClusterConstituents;   ///< List of cluster constituents
+  PWG::JETFW::AliEmcalJetConstituentsView                      fConstituentsView;      //!<! Contiguous view of the constituent kinematics
 
  private:
   /**
@@ -447,7 +471,7 @@ class AliEmcalJet : public AliVParticle
   };
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalJet,19);
+  ClassDef(AliEmcalJet,20);
   /// \endcond
 };
 
@@ -0,0 +1,153 @@
+/************************************************************************************
+ * Copyright (C) 2017, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#include <cmath>
+#include <TMath.h>
+#include "AliEmcalJetConstituentsView.h"
+
+ClassImp(PWG::JETFW::AliEmcalJetConstituentsView)
+
+namespace PWG {
+
+namespace JETFW {
+
+AliEmcalJetConstituentsView::AliEmcalJetConstituentsView() :
+  TObject(),
+  fPt(),
+  fEta(),
+  fPhi(),
+  fM(),
+  fCharge(),
+  fLabel(),
+  fNParticles(0),
+  fFilled(kFALSE)
+{
+}
+
+void AliEmcalJetConstituentsView::Reset() {
+  fPt.clear();
+  fEta.clear();
+  fPhi.clear();
+  fM.clear();
+  fCharge.clear();
+  fLabel.clear();
+  fNParticles = 0;
+  fFilled = kFALSE;
+}
+
+void AliEmcalJetConstituentsView::Reserve(UInt_t n) {
+  fPt.reserve(n);
+  fEta.reserve(n);
+  fPhi.reserve(n);
+  fM.reserve(n);
+  fCharge.reserve(n);
+  fLabel.reserve(n);
+}
+
+void AliEmcalJetConstituentsView::AddParticle(Double_t pt, Double_t eta, Double_t phi, Double_t m, Short_t charge, Int_t label) {
+  fPt.push_back(pt);
+  fEta.push_back(eta);
+  fPhi.push_back(phi);
+  fM.push_back(m);
+  fCharge.push_back(charge);
+  fLabel.push_back(label);
+  fNParticles++;
+  fFilled = kTRUE;
+}
+
+void AliEmcalJetConstituentsView::AddCluster(Double_t pt, Double_t eta, Double_t phi, Double_t m, Int_t label) {
+  fPt.push_back(pt);
+  fEta.push_back(eta);
+  fPhi.push_back(phi);
+  fM.push_back(m);
+  fCharge.push_back(0);
+  fLabel.push_back(label);
+  fFilled = kTRUE;
+}
+
+Double_t AliEmcalJetConstituentsView::SumPt(Bool_t particlesOnly) const {
+  const UInt_t n = particlesOnly ? fNParticles : fPt.size();
+  const Double_t *pt = fPt.data();
+  Double_t sum = 0.;
+  for (UInt_t i = 0; i < n; i++) sum += pt[i];
+  return sum;
+}
+
+Double_t AliEmcalJetConstituentsView::Angularity(Double_t jetEta, Double_t jetPhi, Double_t alpha, Double_t norm, Bool_t particlesOnly) const {
+  const UInt_t n = particlesOnly ? fNParticles : fPt.size();
+  if (!n) return 0.;
+  const Double_t *pt = fPt.data(), *eta = fEta.data(), *phi = fPhi.data();
+  const Double_t twopi = TMath::TwoPi(), pi = TMath::Pi();
+  Double_t num = 0., den = 0.;
+  if (alpha == 1.) {
+    // girth, avoids the pow call in the common case
+    for (UInt_t i = 0; i < n; i++) {
+      Double_t dphi = phi[i] - jetPhi;
+      dphi = dphi > pi ? dphi - twopi : (dphi < -pi ? dphi + twopi : dphi);
+      const Double_t deta = eta[i] - jetEta;
+      num += pt[i] * std::sqrt(deta * deta + dphi * dphi);
+      den += pt[i];
+    }
+  }
+  else {
+    const Double_t halfalpha = 0.5 * alpha;
+    for (UInt_t i = 0; i < n; i++) {
+      Double_t dphi = phi[i] - jetPhi;
+      dphi = dphi > pi ? dphi - twopi : (dphi < -pi ? dphi + twopi : dphi);
+      const Double_t deta = eta[i] - jetEta;
+      num += pt[i] * std::pow(deta * deta + dphi * dphi, halfalpha);
+      den += pt[i];
+    }
+  }
+  if (norm > 0.) den = norm;
+  return den > 0. ? num / den : 0.;
+}
+
+Double_t AliEmcalJetConstituentsView::PtD(Bool_t particlesOnly) const {
+  const UInt_t n = particlesOnly ? fNParticles : fPt.size();
+  if (!n) return 0.;
+  const Double_t *pt = fPt.data();
+  Double_t num = 0., den = 0.;
+  for (UInt_t i = 0; i < n; i++) {
+    num += pt[i] * pt[i];
+    den += pt[i];
+  }
+  return den > 0. ? std::sqrt(num) / den : 0.;
+}
+
+Double_t AliEmcalJetConstituentsView::JetCharge(Double_t jetPt, Double_t kappa) const {
+  if (jetPt <= 0.) return 0.;
+  const UInt_t n = fNParticles;
+  const Double_t *pt = fPt.data();
+  const Short_t *charge = fCharge.data();
+  Double_t num = 0.;
+  for (UInt_t i = 0; i < n; i++) num += charge[i] * std::pow(pt[i], kappa);
+  return num / std::pow(jetPt, kappa);
+}
+
+}
+
+}
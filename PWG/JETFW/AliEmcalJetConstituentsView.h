@@ -0,0 +1,154 @@
+/************************************************************************************
+ * Copyright (C) 2017, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#ifndef ALIEMCALJETCONSTITUENTSVIEW_H
+#define ALIEMCALJETCONSTITUENTSVIEW_H
+
+#include <vector>
+#include <TObject.h>
+
+namespace PWG {
+
+namespace JETFW {
+
+/**
+ * @class AliEmcalJetConstituentsView
+ * @brief Contiguous (structure-of-arrays) copy of the kinematics of the jet constituents
+ * @ingroup JETFW
+ *
+ * The view stores pt, eta, phi, mass, charge and MC label of the jet constituents
+ * in separate contiguous arrays. It is filled once per jet (in the jet finder or
+ * on first use) so that shape observables like angularities, girth, pTD or the jet
+ * charge are computed as plain array reductions instead of resolving the constituent
+ * objects from their containers at every call. Particle constituents are stored
+ * first, followed by the cluster constituents.
+ *
+ * The view is a transient cache, it is not streamed with the jet.
+ */
+class AliEmcalJetConstituentsView : public TObject {
+public:
+  /**
+   * @brief Constructor
+   */
+  AliEmcalJetConstituentsView();
+
+  /**
+   * @brief Destructor
+   */
+  virtual ~AliEmcalJetConstituentsView() {}
+
+  /**
+   * @brief Remove all constituents from the view, keeping the allocated memory
+   */
+  void Reset();
+
+  /**
+   * @brief Reserve memory for a given number of constituents
+   * @param[in] n Expected number of constituents
+   */
+  void Reserve(UInt_t n);
+
+  /**
+   * @brief Append a particle constituent
+   *
+   * Particle constituents must be added before the cluster constituents.
+   */
+  void AddParticle(Double_t pt, Double_t eta, Double_t phi, Double_t m, Short_t charge, Int_t label);
+
+  /**
+   * @brief Append a (neutral) cluster constituent
+   */
+  void AddCluster(Double_t pt, Double_t eta, Double_t phi, Double_t m, Int_t label);
+
+  /**
+   * @brief Mark the view as filled (also for jets without constituents)
+   */
+  void SetFilled() { fFilled = kTRUE; }
+
+  Bool_t          IsFilled()                 const { return fFilled; }
+  UInt_t          GetSize()                  const { return fPt.size(); }
+  UInt_t          GetNumberOfParticles()     const { return fNParticles; }
+  UInt_t          GetNumberOfClusters()      const { return fPt.size() - fNParticles; }
+
+  const Double_t *GetPt()                    const { return fPt.data(); }
+  const Double_t *GetEta()                   const { return fEta.data(); }
+  const Double_t *GetPhi()                   const { return fPhi.data(); }
+  const Double_t *GetM()                     const { return fM.data(); }
+  const Short_t  *GetCharge()                const { return fCharge.data(); }
+  const Int_t    *GetLabel()                 const { return fLabel.data(); }
+
+  /**
+   * @brief Scalar sum of the constituent transverse momenta
+   * @param[in] particlesOnly If true only particle constituents are considered
+   */
+  Double_t SumPt(Bool_t particlesOnly = kFALSE) const;
+
+  /**
+   * @brief Generalised angularity \f$ \sum p_{T,i} \Delta R_{i}^{\alpha} / norm \f$
+   * @param[in] jetEta Pseudorapidity of the jet axis
+   * @param[in] jetPhi Azimuth of the jet axis
+   * @param[in] alpha Angular exponent (1 corresponds to the girth)
+   * @param[in] norm Normalisation (if <= 0 the scalar sum of the constituent pt is used)
+   * @param[in] particlesOnly If true only particle constituents are considered
+   * @return Angularity (0 if the view is empty)
+   */
+  Double_t Angularity(Double_t jetEta, Double_t jetPhi, Double_t alpha = 1., Double_t norm = -1., Bool_t particlesOnly = kFALSE) const;
+
+  /**
+   * @brief Momentum dispersion \f$ \sqrt{\sum p_{T,i}^{2}} / \sum p_{T,i} \f$
+   * @param[in] particlesOnly If true only particle constituents are considered
+   * @return pTD (0 if the view is empty)
+   */
+  Double_t PtD(Bool_t particlesOnly = kFALSE) const;
+
+  /**
+   * @brief Momentum-weighted jet charge \f$ \sum q_{i} p_{T,i}^{\kappa} / p_{T,jet}^{\kappa} \f$
+   * @param[in] jetPt Transverse momentum of the jet
+   * @param[in] kappa Momentum weight exponent
+   * @return Jet charge (0 for jets with vanishing pt)
+   */
+  Double_t JetCharge(Double_t jetPt, Double_t kappa = 0.5) const;
+
+private:
+  std::vector<Double_t>   fPt;                ///< Constituent transverse momenta
+  std::vector<Double_t>   fEta;               ///< Constituent pseudorapidities
+  std::vector<Double_t>   fPhi;               ///< Constituent azimuths
+  std::vector<Double_t>   fM;                 ///< Constituent masses
+  std::vector<Short_t>    fCharge;            ///< Constituent charges (0 for clusters)
+  std::vector<Int_t>      fLabel;             ///< Constituent MC labels
+  UInt_t                  fNParticles;        ///< Number of particle constituents (stored first)
+  Bool_t                  fFilled;            ///< Whether the view has been filled for the current jet
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalJetConstituentsView, 1);
+  /// \endcond
+};
+
+}
+
+}
+
+#endif /* ALIEMCALJETCONSTITUENTSVIEW_H */
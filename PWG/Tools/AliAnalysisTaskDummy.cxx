@@ -14,14 +14,73 @@
  **************************************************************************/
 #include <iostream>
 #include <chrono>
+#include <set>
 #include <thread>
+#include <TFile.h>
+#include <TH1D.h>
+#include <TList.h>
+#include <TMath.h>
 #include <TString.h>
+#include <TTree.h>
 
+#include "AliAnalysisManager.h"
+#include "AliAnalysisDataContainer.h"
 #include "AliInputEventHandler.h"
 #include "AliAnalysisTaskDummy.h"
 
 ClassImp(AliAnalysisTaskDummy)
 
+namespace {
+
+/// Timestamps shared by all probes running on the same event
+struct ProbeRecord {
+  const TTree      *fTree = nullptr;       ///< Input tree of the current event
+  Long64_t          fEntry = -1;           ///< Read entry of the current event
+  std::set<Int_t>   fProbes;               ///< Probes already executed on the current event
+  Double_t          fLastStamp = -1.;      ///< Timestamp of the last executed probe (s)
+  TString           fLastProbe;            ///< Name of the last executed probe
+  Long64_t          fBytesRead = 0;        ///< Bytes read from the input files at the first probe of the current event
+};
+
+ProbeRecord gProbeRecord;
+Int_t gNextProbeID = 0;
+
+Double_t MonotonicTime() {
+  return std::chrono::duration<Double_t>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+}
+
+AliAnalysisTaskDummy::AliAnalysisTaskDummy(const char *name, EMode_t mode):
+  AliAnalysisTaskSE(name),
+  fMode(mode)
+{
+  if(fMode == kThroughputProbe) {
+    fProbeID = gNextProbeID++;
+    DefineOutput(1, TList::Class());
+  }
+}
+
+void AliAnalysisTaskDummy::UserCreateOutputObjects(){
+  if(fMode != kThroughputProbe) return;
+  fOutput = new TList;
+  fOutput->SetOwner(kTRUE);
+  fSegmentTime = new TH1D("hSegmentTime", "Time since the previous probe in the event; log_{10}(t/s); events", 160, -7., 1.);
+  fReadTime = new TH1D("hReadTime", "Time since the last probe of the previous event; log_{10}(t/s); events", 160, -7., 1.);
+  fBytesRead = new TH1D("hBytesRead", "Bytes read from the input per event; log_{10}(bytes); events", 100, 0., 10.);
+  fSummary = new TH1D("hSummary", "Probe summary", 5, 0.5, 5.5);
+  fSummary->GetXaxis()->SetBinLabel(1, "events");
+  fSummary->GetXaxis()->SetBinLabel(2, "first probe events");
+  fSummary->GetXaxis()->SetBinLabel(3, "segment time (s)");
+  fSummary->GetXaxis()->SetBinLabel(4, "read time (s)");
+  fSummary->GetXaxis()->SetBinLabel(5, "bytes read");
+  fOutput->Add(fSegmentTime);
+  fOutput->Add(fReadTime);
+  fOutput->Add(fBytesRead);
+  fOutput->Add(fSummary);
+  PostData(1, fOutput);
+}
+
 void AliAnalysisTaskDummy::UserExec(Option_t *){
   TString filename = "";
   if(fInputHandler) filename = fInputHandler->GetInputFileName();
@@ -31,4 +90,80 @@ void AliAnalysisTaskDummy::UserExec(Option_t *){
   std::chrono::milliseconds interval(fWaitTime);
   std::this_thread::sleep_for(interval);
 
+  if(fMode == kThroughputProbe) FillProbe();
+}
+
+/**
+ * Record the time since the previous probe. A new event is detected from the
+ * read entry of the input handler, or when this probe already ran on the
+ * current event (entry numbers restarting in a new file).
+ */
+void AliAnalysisTaskDummy::FillProbe(){
+  Double_t now = MonotonicTime();
+  const TTree *tree = fInputHandler ? fInputHandler->GetTree() : nullptr;
+  Long64_t entry = fInputHandler ? fInputHandler->GetReadEntry() : -1;
+  Bool_t newEvent = tree != gProbeRecord.fTree || entry != gProbeRecord.fEntry || gProbeRecord.fProbes.count(fProbeID);
+  fSummary->Fill(1);
+  if(newEvent) {
+    Long64_t bytesRead = TFile::GetFileBytesRead();
+    if(gProbeRecord.fLastStamp >= 0.) {
+      Double_t readTime = now - gProbeRecord.fLastStamp;
+      fReadTime->Fill(TMath::Log10(TMath::Max(readTime, 1e-9)));
+      fBytesRead->Fill(TMath::Log10(TMath::Max(bytesRead - gProbeRecord.fBytesRead, 1LL)));
+      fSummary->Fill(2);
+      fSummary->Fill(4, readTime);
+      fSummary->Fill(5, bytesRead - gProbeRecord.fBytesRead);
+    }
+    gProbeRecord.fTree = tree;
+    gProbeRecord.fEntry = entry;
+    gProbeRecord.fProbes.clear();
+    gProbeRecord.fBytesRead = bytesRead;
+  } else {
+    Double_t segmentTime = now - gProbeRecord.fLastStamp;
+    fSegmentTime->Fill(TMath::Log10(TMath::Max(segmentTime, 1e-9)));
+    fSummary->Fill(3, segmentTime);
+    TString title = Form("Time since probe %s; log_{10}(t/s); events", gProbeRecord.fLastProbe.Data());
+    if(title != fSegmentTime->GetTitle()) fSegmentTime->SetTitle(title);
+  }
+  gProbeRecord.fProbes.insert(fProbeID);
+  gProbeRecord.fLastProbe = GetName();
+  // Stamp after filling, the probe's own overhead is not attributed to the next segment
+  gProbeRecord.fLastStamp = MonotonicTime();
+  PostData(1, fOutput);
+}
+
+void AliAnalysisTaskDummy::Terminate(Option_t *){
+  if(fMode != kThroughputProbe) return;
+  TList *output = dynamic_cast<TList *>(GetOutputData(1));
+  TH1 *summary = output ? dynamic_cast<TH1 *>(output->FindObject("hSummary")) : nullptr;
+  if(!summary || summary->GetBinContent(1) <= 0) return;
+  Double_t nevents = summary->GetBinContent(1), nfirst = summary->GetBinContent(2);
+  std::cout << "Throughput probe " << GetName() << ": " << nevents << " events, "
+            << 1e3 * summary->GetBinContent(3) / nevents << " ms/event since the previous probe";
+  if(nfirst > 0) {
+    std::cout << ", " << 1e3 * summary->GetBinContent(4) / nfirst << " ms/event and "
+              << summary->GetBinContent(5) / nfirst << " bytes/event since the previous event";
+  }
+  std::cout << std::endl;
+}
+
+/**
+ * Create a throughput probe and add it at the current end of the train.
+ * The outputs of all probes are written to the folder ThroughputProbes
+ * of the common output file.
+ * @param[in] name Name of the probe, unique within the train
+ * @return The probe (nullptr if no analysis manager exists)
+ */
+AliAnalysisTaskDummy *AliAnalysisTaskDummy::AddThroughputProbe(const char *name){
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  if(!mgr){
+    std::cerr << "AliAnalysisTaskDummy::AddThroughputProbe: No analysis manager to connect to." << std::endl;
+    return nullptr;
+  }
+  AliAnalysisTaskDummy *probe = new AliAnalysisTaskDummy(name, kThroughputProbe);
+  mgr->AddTask(probe);
+  TString outputfile = Form("%s:ThroughputProbes", AliAnalysisManager::GetCommonFileName());
+  mgr->ConnectInput(probe, 0, mgr->GetCommonInputContainer());
+  mgr->ConnectOutput(probe, 1, mgr->CreateContainer(Form("probe_%s", name), TList::Class(), AliAnalysisManager::kOutputContainer, outputfile.Data()));
+  return probe;
 }
@@ -5,27 +5,57 @@
 
 #include "AliAnalysisTaskSE.h"
 
+class TH1;
+class TList;
+
 /**
  * \class AliAnalysisTaskDummy
  * \brief Dummy analysis task, only trying to read data - no memory allocation. For file corruption checks.
+ *
+ * In throughput probe mode several instances can be placed at different positions
+ * of a train. For each event a probe records the monotonic time elapsed since the
+ * previous probe in the same event. The first probe of an event instead records the
+ * time since the last probe of the previous event (input read, event loop overhead
+ * and the wagons after the last probe) together with the bytes read from the input
+ * files in that interval. Probes are ordered by the time they are executed,
+ * independent of their construction order.
  */
 class AliAnalysisTaskDummy : public AliAnalysisTaskSE {
 public:
+  enum EMode_t {
+    kReadCheck = 0,       ///< Only read the data (file corruption checks)
+    kThroughputProbe = 1  ///< Timing probe between wagons, with output in slot 1
+  };
+
   AliAnalysisTaskDummy() {}
   AliAnalysisTaskDummy(const char *name, Int_t wait_time) : AliAnalysisTaskSE(name) { fWaitTime = wait_time; }
+  AliAnalysisTaskDummy(const char *name, EMode_t mode);
   virtual ~AliAnalysisTaskDummy() {}
 
-  virtual void UserCreateOutputObjects() {}
+  virtual void UserCreateOutputObjects();
   virtual void UserExec(Option_t *);
-  virtual void Terminate(Option_t *) {}
+  virtual void Terminate(Option_t *);
 
   void SetDebugLevel(Int_t level) { fDebugLevel = level; }
+  void SetWaitTime(Int_t wait_time) { fWaitTime = wait_time; }
+
+  static AliAnalysisTaskDummy *AddThroughputProbe(const char *name);
 
 private:
+  void FillProbe();
+
   Int_t         fDebugLevel = 0;       ///< Debug level
   Int_t         fWaitTime = 0;         ///< Wait time in milliseconds
+  EMode_t       fMode = kReadCheck;    ///< Operation mode
+  Int_t         fProbeID = -1;         ///< Unique ID of the probe in the train
+
+  TList        *fOutput = nullptr;     //!<! Output list (throughput probe mode)
+  TH1          *fSegmentTime = nullptr;  //!<! log10 of the time since the previous probe in the event
+  TH1          *fReadTime = nullptr;     //!<! log10 of the time since the last probe of the previous event (first probe only)
+  TH1          *fBytesRead = nullptr;    //!<! log10 of the bytes read from the input files per event (first probe only)
+  TH1          *fSummary = nullptr;      //!<! Number of events, summed times and bytes
 
-  ClassDef(AliAnalysisTaskDummy, 2);
+  ClassDef(AliAnalysisTaskDummy, 3);
 };
 
 #endif /* ALIANALYSISTASKDUMMY_H */
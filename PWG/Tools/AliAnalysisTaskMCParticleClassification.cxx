@@ -0,0 +1,69 @@
+/**************************************************************************
+ * Copyright(c) 1998-2015, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+#include "AliAnalysisManager.h"
+#include "AliLog.h"
+#include "AliMCEvent.h"
+#include "AliVEvent.h"
+#include "AliMCParticleClassification.h"
+#include "AliAnalysisTaskMCParticleClassification.h"
+
+ClassImp(AliAnalysisTaskMCParticleClassification)
+
+AliAnalysisTaskMCParticleClassification::AliAnalysisTaskMCParticleClassification():
+  AliAnalysisTaskSE(),
+  fClassificationName(AliMCParticleClassification::DefaultName()),
+  fClassification(nullptr)
+{
+}
+
+AliAnalysisTaskMCParticleClassification::AliAnalysisTaskMCParticleClassification(const char *name):
+  AliAnalysisTaskSE(name),
+  fClassificationName(AliMCParticleClassification::DefaultName()),
+  fClassification(nullptr)
+{
+}
+
+AliAnalysisTaskMCParticleClassification::~AliAnalysisTaskMCParticleClassification(){
+  // the classification is owned by the input event once attached
+}
+
+void AliAnalysisTaskMCParticleClassification::UserExec(Option_t *){
+  AliVEvent *event = InputEvent();
+  if(!event) return;
+  AliMCEvent *mcEvent = MCEvent();
+  if(!mcEvent){
+    AliDebug(1, "No MC event, classification not filled");
+    return;
+  }
+  // the list of the input event may be rebuilt when a new file is opened
+  fClassification = AliMCParticleClassification::Get(event, fClassificationName.Data());
+  if(!fClassification){
+    fClassification = new AliMCParticleClassification(fClassificationName.Data());
+    event->AddObject(fClassification);
+  }
+  fClassification->Fill(mcEvent);
+}
+
+AliAnalysisTaskMCParticleClassification *AliAnalysisTaskMCParticleClassification::AddTaskMCParticleClassification(const char *name){
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  if(!mgr){
+    ::Error("AddTaskMCParticleClassification", "No analysis manager available");
+    return nullptr;
+  }
+  AliAnalysisTaskMCParticleClassification *task = new AliAnalysisTaskMCParticleClassification(name);
+  mgr->AddTask(task);
+  mgr->ConnectInput(task, 0, mgr->GetCommonInputContainer());
+  return task;
+}
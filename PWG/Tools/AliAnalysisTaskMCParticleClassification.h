@@ -0,0 +1,44 @@
+#ifndef ALIANALYSISTASKMCPARTICLECLASSIFICATION_H
+#define ALIANALYSISTASKMCPARTICLECLASSIFICATION_H
+/* Copyright(c) 1998-2015, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <TString.h>
+#include "AliAnalysisTaskSE.h"
+
+class AliMCParticleClassification;
+
+/**
+ * \class AliAnalysisTaskMCParticleClassification
+ * \brief Service task classifying the MC particles once per event for all wagons
+ *
+ * To be added early in the train. Fills an AliMCParticleClassification for each
+ * event and attaches it to the input event; later tasks retrieve it with
+ * AliMCParticleClassification::Get(InputEvent()) instead of calling
+ * AliMCEvent::IsPhysicalPrimary & co. and walking the mother chains themselves.
+ */
+class AliAnalysisTaskMCParticleClassification : public AliAnalysisTaskSE {
+public:
+  AliAnalysisTaskMCParticleClassification();
+  AliAnalysisTaskMCParticleClassification(const char *name);
+  virtual ~AliAnalysisTaskMCParticleClassification();
+
+  static AliAnalysisTaskMCParticleClassification *AddTaskMCParticleClassification(const char *name = "MCParticleClassificationTask");
+
+  virtual void UserCreateOutputObjects() {}
+  virtual void UserExec(Option_t *);
+  virtual void Terminate(Option_t *) {}
+
+  void SetClassificationName(const char *name) { fClassificationName = name; }
+
+private:
+  AliAnalysisTaskMCParticleClassification(const AliAnalysisTaskMCParticleClassification &);
+  AliAnalysisTaskMCParticleClassification &operator=(const AliAnalysisTaskMCParticleClassification &);
+
+  TString                      fClassificationName;   ///< Name of the classification in the input event
+  AliMCParticleClassification *fClassification;       //!<! Classification attached to the input event
+
+  ClassDef(AliAnalysisTaskMCParticleClassification, 1);
+};
+
+#endif /* ALIANALYSISTASKMCPARTICLECLASSIFICATION_H */
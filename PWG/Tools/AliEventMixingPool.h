@@ -0,0 +1,195 @@
+#ifndef ALIEVENTMIXINGPOOL_H
+#define ALIEVENTMIXINGPOOL_H
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See AliRoot license for full Copyright notice                          */
+
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <Rtypes.h>
+#include <TMath.h>
+#include <TString.h>
+
+/**
+ * @class AliEventMixingPool
+ * @brief Header-only event pool for event mixing with fixed capacity per bin
+ *
+ * Events are classified in bins of z vertex, multiplicity (or centrality) and
+ * event plane angle. Each bin keeps the last fDepth events in a ring. The track
+ * records are stored as structure of arrays: one array per field given as
+ * template argument, so that loops over one field of the tracks of a partner
+ * event access contiguous memory. The arrays of a bin are allocated once, the
+ * first time an event is added to the bin, with room for maxTracks tracks per
+ * event; afterwards no memory is allocated for adding events.
+ *
+ * ~~~{.cxx}
+ * // fields pt, eta, phi, charge
+ * typedef AliEventMixingPool<Float_t, Float_t, Float_t, Char_t> Pool_t;
+ * Pool_t pool(10, -10, 10, 5, 0, 100, 1, 0, TMath::Pi(), 20, 2000);
+ * Int_t bin = pool.FindBin(zvtx, centrality);
+ * for (Int_t ev = 0; ev < pool.GetNEvents(bin); ev++) {
+ *   const Float_t *pt = pool.GetField<0>(bin, ev);
+ *   for (Int_t i = 0; i < pool.GetNTracks(bin, ev); i++) ...
+ * }
+ * pool.StartEvent(bin); // replaces the oldest event once the bin is full
+ * pool.AddTrack(bin, track->Pt(), track->Eta(), track->Phi(), track->Charge());
+ * ~~~
+ *
+ * Tracks exceeding maxTracks in one event are not stored and counted in GetNDroppedTracks().
+ */
+template <typename... Fields>
+class AliEventMixingPool {
+public:
+  typedef std::tuple<std::vector<Fields>...> Arrays_t;
+  static const Int_t kNFields = sizeof...(Fields);
+
+  AliEventMixingPool(Int_t nZ, Double_t zMin, Double_t zMax, Int_t nMult, Double_t multMin, Double_t multMax, Int_t nEP, Double_t epMin, Double_t epMax, Int_t depth, Int_t maxTracks):
+    fNZ(nZ), fZMin(zMin), fZMax(zMax),
+    fNMult(nMult), fMultMin(multMin), fMultMax(multMax),
+    fNEP(nEP), fEPMin(epMin), fEPMax(epMax),
+    fDepth(depth), fMaxTracks(maxTracks),
+    fBins(nZ * nMult * nEP),
+    fNDropped(0)
+  {}
+
+  Int_t GetNumberOfBins() const { return fBins.size(); }
+  Int_t GetDepth() const { return fDepth; }
+  Int_t GetMaxTracks() const { return fMaxTracks; }
+
+  /// Bin of the event, -1 if outside of the binning
+  Int_t FindBin(Double_t zvtx, Double_t mult, Double_t ep = 0) const {
+    Int_t iz = FindAxisBin(zvtx, fNZ, fZMin, fZMax);
+    Int_t im = FindAxisBin(mult, fNMult, fMultMin, fMultMax);
+    Int_t ie = fNEP > 1 ? FindAxisBin(ep, fNEP, fEPMin, fEPMax) : 0;
+    if (iz < 0 || im < 0 || ie < 0) return -1;
+    return (ie * fNMult + im) * fNZ + iz;
+  }
+
+  /// Number of events of the bin available for mixing
+  Int_t GetNEvents(Int_t bin) const { return IsValid(bin) ? fBins[bin].fCount : 0; }
+  Bool_t IsReady(Int_t bin, Int_t minEvents) const { return GetNEvents(bin) >= minEvents; }
+
+  /// Number of tracks of the event ev of the bin (ev = 0 is the last added event)
+  Int_t GetNTracks(Int_t bin, Int_t ev) const { return fBins[bin].fNTracks[Slot(bin, ev)]; }
+
+  /// Values of field I of the tracks of event ev of the bin, GetNTracks(bin, ev) entries
+  template <Int_t I>
+  const typename std::tuple_element<I, std::tuple<Fields...> >::type *GetField(Int_t bin, Int_t ev) const {
+    return std::get<I>(fBins[bin].fArrays).data() + (Long64_t) Slot(bin, ev) * fMaxTracks;
+  }
+
+  /// Starts a new event in the bin, replacing the oldest one if the bin is full
+  Bool_t StartEvent(Int_t bin) {
+    if (!IsValid(bin)) return kFALSE;
+    Bin &b = fBins[bin];
+    if (b.fNTracks.empty()) {
+      b.fNTracks.assign(fDepth, 0);
+      Allocate<0>(b.fArrays);
+    }
+    b.fHead = (b.fHead + 1) % fDepth;
+    b.fNTracks[b.fHead] = 0;
+    if (b.fCount < fDepth) b.fCount++;
+    return kTRUE;
+  }
+
+  /// Adds a track to the event started last in the bin
+  Bool_t AddTrack(Int_t bin, Fields... values) {
+    if (!IsValid(bin) || !fBins[bin].fCount) return kFALSE;
+    Bin &b = fBins[bin];
+    Int_t &n = b.fNTracks[b.fHead];
+    if (n >= fMaxTracks) {
+      fNDropped++;
+      return kFALSE;
+    }
+    Set<0>(b.fArrays, (Long64_t) b.fHead * fMaxTracks + n, values...);
+    n++;
+    return kTRUE;
+  }
+
+  /// Removes all events (the memory is kept)
+  void Clear() {
+    for (UInt_t i = 0; i < fBins.size(); i++) {
+      fBins[i].fCount = 0;
+      fBins[i].fHead = -1;
+    }
+  }
+
+  Long64_t GetNDroppedTracks() const { return fNDropped; }
+
+  /// Memory allocated for the bin in bytes
+  ULong64_t GetMemoryUsage(Int_t bin) const {
+    if (!IsValid(bin) || fBins[bin].fNTracks.empty()) return 0;
+    return (ULong64_t) fDepth * (fMaxTracks * RecordSize<Fields...>() + sizeof(Int_t));
+  }
+
+  ULong64_t GetMemoryUsage() const {
+    ULong64_t sum = 0;
+    for (Int_t i = 0; i < GetNumberOfBins(); i++) sum += GetMemoryUsage(i);
+    return sum;
+  }
+
+  /// Prints number of events and allocated memory of the used bins
+  void PrintMemoryUsage() const {
+    for (Int_t i = 0; i < GetNumberOfBins(); i++) {
+      if (!GetMemoryUsage(i)) continue;
+      Int_t iz = i % fNZ, im = (i / fNZ) % fNMult, ie = i / (fNZ * fNMult);
+      Printf("bin %4d (z %d, mult %d, ep %d): %3d events, %8.1f kB", i, iz, im, ie, GetNEvents(i), GetMemoryUsage(i) / 1024.);
+    }
+    Printf("total: %.1f MB, %lld dropped tracks", GetMemoryUsage() / 1024. / 1024., fNDropped);
+  }
+
+private:
+  struct Bin {
+    Bin() : fArrays(), fNTracks(), fHead(-1), fCount(0) {}
+    Arrays_t           fArrays;  ///< field arrays, fDepth * fMaxTracks entries each
+    std::vector<Int_t> fNTracks; ///< number of tracks per slot
+    Int_t              fHead;    ///< slot of the last added event
+    Int_t              fCount;   ///< number of filled slots
+  };
+
+  static Int_t FindAxisBin(Double_t x, Int_t n, Double_t min, Double_t max) {
+    if (!(x >= min && x < max)) return -1;
+    return TMath::Min(Int_t((x - min) / (max - min) * n), n - 1);
+  }
+
+  Bool_t IsValid(Int_t bin) const { return bin >= 0 && bin < (Int_t) fBins.size(); }
+  Int_t Slot(Int_t bin, Int_t ev) const { return (fBins[bin].fHead - ev + fDepth) % fDepth; }
+
+  template <Int_t I>
+  typename std::enable_if<(I < kNFields)>::type Allocate(Arrays_t &arrays) {
+    std::get<I>(arrays).assign((Long64_t) fDepth * fMaxTracks, typename std::tuple_element<I, std::tuple<Fields...> >::type());
+    Allocate<I + 1>(arrays);
+  }
+  template <Int_t I>
+  typename std::enable_if<(I == kNFields)>::type Allocate(Arrays_t &) {}
+
+  template <Int_t I, typename T, typename... Rest>
+  static void Set(Arrays_t &arrays, Long64_t index, T value, Rest... rest) {
+    std::get<I>(arrays)[index] = value;
+    Set<I + 1>(arrays, index, rest...);
+  }
+  template <Int_t I>
+  static void Set(Arrays_t &, Long64_t) {}
+
+  template <typename... T>
+  static typename std::enable_if<(sizeof...(T) == 0), ULong64_t>::type RecordSize() { return 0; }
+  template <typename T, typename... Rest>
+  static ULong64_t RecordSize() { return sizeof(T) + RecordSize<Rest...>(); }
+
+  Int_t    fNZ;          ///< number of z vertex bins
+  Double_t fZMin;        ///< lower edge of z vertex axis
+  Double_t fZMax;        ///< upper edge of z vertex axis
+  Int_t    fNMult;       ///< number of multiplicity bins
+  Double_t fMultMin;     ///< lower edge of multiplicity axis
+  Double_t fMultMax;     ///< upper edge of multiplicity axis
+  Int_t    fNEP;         ///< number of event plane bins
+  Double_t fEPMin;       ///< lower edge of event plane axis
+  Double_t fEPMax;       ///< upper edge of event plane axis
+  Int_t    fDepth;       ///< number of events kept per bin
+  Int_t    fMaxTracks;   ///< maximum number of tracks stored per event
+  std::vector<Bin> fBins; ///< bins
+  Long64_t fNDropped;    ///< number of tracks not stored
+};
+
+#endif
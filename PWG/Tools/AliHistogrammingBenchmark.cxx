@@ -0,0 +1,411 @@
+/**************************************************************************
+ * Copyright(c) 1998-2019, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+#include <fstream>
+#include <TBufferFile.h>
+#include <TCollection.h>
+#include <THashList.h>
+#include <THn.h>
+#include <THnSparse.h>
+#include <TH1.h>
+#include <TH2.h>
+#include <TH3.h>
+#include <TList.h>
+#include <TMath.h>
+#include <TMethodCall.h>
+#include <TObjArray.h>
+#include <TRandom3.h>
+#include <TStopwatch.h>
+#include <TSystem.h>
+
+#include "AliCFGridSparse.h"
+#include "AliTHn.h"
+#include "THistManager.h"
+#include "AliHistogrammingBenchmark.h"
+
+/// \cond CLASSIMP
+ClassImp(AliHistogrammingBackend)
+ClassImp(AliHistogrammingBenchmark)
+/// \endcond
+
+namespace {
+
+/// Upper limit of the number of bins for backends allocating all bins at booking
+const Double_t kMaxDenseBins = 2e8;
+
+Double_t GetTotalBins(Int_t ndim, const Int_t *nbins) {
+  Double_t total = 1.;
+  for(Int_t idim = 0; idim < ndim; idim++) total *= nbins[idim] + 2;
+  return total;
+}
+
+/// THistManager, filled via typed handles (TH1/TH2/TH3 up to 3 dimensions, THnSparse above)
+class THistManagerBackend : public AliHistogrammingBackend {
+public:
+  THistManagerBackend() : AliHistogrammingBackend("THistManager", "THistManager (handles)"), fManager(nullptr), fNDim(0) {}
+  virtual ~THistManagerBackend() { Reset(); }
+
+  virtual Bool_t Book(Int_t ndim, const Int_t *nbins, const Double_t *min, const Double_t *max) {
+    fManager = new THistManager("benchTHistManager");
+    fNDim = ndim;
+    switch(ndim) {
+      case 1: fManager->CreateTH1("hBench", "hBench", nbins[0], min[0], max[0]); fH1 = fManager->GetHandle<TH1>("hBench"); break;
+      case 2: fManager->CreateTH2("hBench", "hBench", nbins[0], min[0], max[0], nbins[1], min[1], max[1]); fH2 = fManager->GetHandle<TH2>("hBench"); break;
+      case 3: fManager->CreateTH3("hBench", "hBench", nbins[0], min[0], max[0], nbins[1], min[1], max[1], nbins[2], min[2], max[2]); fH3 = fManager->GetHandle<TH3>("hBench"); break;
+      default: fManager->CreateTHnSparse("hBench", "hBench", ndim, nbins, min, max); fHn = fManager->GetHandle<THnSparse>("hBench"); break;
+    };
+    return kTRUE;
+  }
+  virtual void Fill(const Double_t *x, Double_t weight) {
+    switch(fNDim) {
+      case 1: fManager->Fill(fH1, x[0], weight); break;
+      case 2: fManager->Fill(fH2, x[0], x[1], weight); break;
+      case 3: fManager->Fill(fH3, x[0], x[1], x[2], weight); break;
+      default: fManager->Fill(fHn, x, weight); break;
+    };
+  }
+  virtual TObject *GetOutput() const { return fManager ? fManager->GetListOfHistograms() : nullptr; }
+  virtual void Reset() { delete fManager; fManager = nullptr; }
+
+private:
+  THistManager                    *fManager;
+  Int_t                            fNDim;
+  THistManager::Handle<TH1>        fH1;
+  THistManager::Handle<TH2>        fH2;
+  THistManager::Handle<TH3>        fH3;
+  THistManager::Handle<THnSparse>  fHn;
+};
+
+/// AliTHn with one step, dense or chunked storage
+class AliTHnBackend : public AliHistogrammingBackend {
+public:
+  AliTHnBackend(Int_t chunkSize) :
+    AliHistogrammingBackend(chunkSize ? "AliTHnChunked" : "AliTHn", chunkSize ? "AliTHn (chunked storage)" : "AliTHn (dense storage)"),
+    fHist(nullptr), fChunkSize(chunkSize) {}
+  virtual ~AliTHnBackend() { Reset(); }
+
+  virtual Bool_t Book(Int_t ndim, const Int_t *nbins, const Double_t *min, const Double_t *max) {
+    if(!fChunkSize && GetTotalBins(ndim, nbins) > kMaxDenseBins) return kFALSE;
+    fHist = new AliTHn("benchAliTHn", "benchAliTHn", 1, ndim, nbins);
+    for(Int_t idim = 0; idim < ndim; idim++) fHist->SetBinLimits(idim, min[idim], max[idim]);
+    if(fChunkSize) fHist->SetChunkedStorage(fChunkSize);
+    return kTRUE;
+  }
+  virtual void Fill(const Double_t *x, Double_t weight) { fHist->Fill(x, 0, weight); }
+  virtual TObject *GetOutput() const { return fHist; }
+  virtual void Reset() { delete fHist; fHist = nullptr; }
+
+private:
+  AliTHn  *fHist;
+  Int_t    fChunkSize;
+};
+
+/// AliCFGridSparse, sparse or dense fill
+class AliCFGridSparseBackend : public AliHistogrammingBackend {
+public:
+  AliCFGridSparseBackend(Bool_t denseFill) :
+    AliHistogrammingBackend(denseFill ? "AliCFGridSparseDense" : "AliCFGridSparse", denseFill ? "AliCFGridSparse (dense fill)" : "AliCFGridSparse"),
+    fGrid(nullptr), fDenseFill(denseFill) {}
+  virtual ~AliCFGridSparseBackend() { Reset(); }
+
+  virtual Bool_t Book(Int_t ndim, const Int_t *nbins, const Double_t *min, const Double_t *max) {
+    if(fDenseFill && GetTotalBins(ndim, nbins) > kMaxDenseBins) return kFALSE;
+    fGrid = new AliCFGridSparse("benchGrid", "benchGrid", ndim, nbins, fDenseFill);
+    for(Int_t idim = 0; idim < ndim; idim++) fGrid->SetBinLimits(idim, min[idim], max[idim]);
+    return kTRUE;
+  }
+  virtual void Fill(const Double_t *x, Double_t weight) { fGrid->Fill(x, weight); }
+  virtual TObject *GetOutput() const { return fGrid; }
+  virtual void Reset() { delete fGrid; fGrid = nullptr; }
+
+private:
+  AliCFGridSparse *fGrid;
+  Bool_t           fDenseFill;
+};
+
+/// Plain THnSparseD or THnD as reference
+class THnBackend : public AliHistogrammingBackend {
+public:
+  THnBackend(Bool_t sparse) :
+    AliHistogrammingBackend(sparse ? "THnSparseD" : "THnD", sparse ? "THnSparseD" : "THnD"),
+    fHist(nullptr), fSparse(sparse) {}
+  virtual ~THnBackend() { Reset(); }
+
+  virtual Bool_t Book(Int_t ndim, const Int_t *nbins, const Double_t *min, const Double_t *max) {
+    if(fSparse) {
+      fHist = new THnSparseD("benchTHnSparse", "benchTHnSparse", ndim, nbins, min, max);
+    } else {
+      if(GetTotalBins(ndim, nbins) > kMaxDenseBins) return kFALSE;
+      fHist = new THnD("benchTHn", "benchTHn", ndim, nbins, min, max);
+    }
+    return kTRUE;
+  }
+  virtual void Fill(const Double_t *x, Double_t weight) { fHist->Fill(x, weight); }
+  virtual TObject *GetOutput() const { return fHist; }
+  virtual void Reset() { delete fHist; fHist = nullptr; }
+
+private:
+  THnBase *fHist;
+  Bool_t   fSparse;
+};
+
+Double_t GetResidentMemory() {
+  ProcInfo_t procinfo;
+  gSystem->GetProcInfo(&procinfo);
+  return procinfo.fMemResident;
+}
+
+}
+
+AliHistogrammingBenchmark::AliHistogrammingBenchmark():
+  TNamed(),
+  fBackends(nullptr),
+  fNDim(0),
+  fNBins(),
+  fMin(),
+  fMax(),
+  fNFills(0),
+  fNMergeCopies(0),
+  fDistribution(kUniform),
+  fSeed(0),
+  fUseWeights(kFALSE),
+  fResults()
+{
+}
+
+AliHistogrammingBenchmark::AliHistogrammingBenchmark(const char *name):
+  TNamed(name, "Histogramming backend benchmark"),
+  fBackends(new TObjArray),
+  fNDim(0),
+  fNBins(),
+  fMin(),
+  fMax(),
+  fNFills(1000000),
+  fNMergeCopies(10),
+  fDistribution(kUniform),
+  fSeed(4357),
+  fUseWeights(kFALSE),
+  fResults()
+{
+  fBackends->SetOwner(kTRUE);
+  SetDimensions(3, 50);
+}
+
+AliHistogrammingBenchmark::~AliHistogrammingBenchmark() {
+  delete fBackends;
+}
+
+/**
+ * Register a backend. The benchmark takes ownership.
+ * @param[in] backend Backend to be benchmarked
+ */
+void AliHistogrammingBenchmark::AddBackend(AliHistogrammingBackend *backend) {
+  if(!fBackends) {
+    fBackends = new TObjArray;
+    fBackends->SetOwner(kTRUE);
+  }
+  fBackends->Add(backend);
+}
+
+/**
+ * Register all backends available in PWGTools and its dependencies
+ */
+void AliHistogrammingBenchmark::AddDefaultBackends() {
+  AddBackend(new THistManagerBackend);
+  AddBackend(new AliTHnBackend(0));
+  AddBackend(new AliTHnBackend(1024));
+  AddBackend(new AliCFGridSparseBackend(kFALSE));
+  AddBackend(new AliCFGridSparseBackend(kTRUE));
+  AddBackend(new THnBackend(kTRUE));
+  AddBackend(new THnBackend(kFALSE));
+}
+
+/**
+ * Set the dimensionality of the histogram set, the same binning is used for all variables
+ * @param[in] ndim Number of variables
+ * @param[in] nbins Number of bins per variable
+ * @param[in] min Lower edge of the range
+ * @param[in] max Upper edge of the range
+ */
+void AliHistogrammingBenchmark::SetDimensions(Int_t ndim, Int_t nbins, Double_t min, Double_t max) {
+  fNDim = ndim;
+  fNBins.assign(ndim, nbins);
+  fMin.assign(ndim, min);
+  fMax.assign(ndim, max);
+}
+
+/**
+ * Benchmark all registered backends. Each backend is filled with the same
+ * sequence of random points.
+ */
+void AliHistogrammingBenchmark::Run() {
+  fResults.clear();
+  if(!fBackends || !fNDim) {
+    Error("Run", "No backend registered or dimensionality not set");
+    return;
+  }
+  for(Int_t ibackend = 0; ibackend < fBackends->GetEntriesFast(); ibackend++) {
+    AliHistogrammingBackend *backend = static_cast<AliHistogrammingBackend *>(fBackends->At(ibackend));
+    Result_t result;
+    result.fBackend = backend->GetName();
+    result.fSupported = kFALSE;
+    result.fBookTime = result.fFillTime = result.fFillRate = 0.;
+    result.fMemory = result.fOutputSize = result.fMergeTime = 0.;
+    RunBackend(backend, result);
+    fResults.push_back(result);
+  }
+}
+
+/**
+ * Book, fill and merge a single backend. The random points are generated
+ * in blocks outside the timed region.
+ * @param[in] backend Backend to be benchmarked
+ * @param[out] result Measurement
+ */
+void AliHistogrammingBenchmark::RunBackend(AliHistogrammingBackend *backend, Result_t &result) {
+  const Int_t kBlockSize = 1024;
+  TRandom3 rng(fSeed);
+  std::vector<Double_t> points(kBlockSize * fNDim), weights(kBlockSize, 1.);
+  Double_t memStart = GetResidentMemory();
+
+  TStopwatch watch;
+  watch.Start();
+  result.fSupported = backend->Book(fNDim, fNBins.data(), fMin.data(), fMax.data());
+  watch.Stop();
+  result.fBookTime = watch.RealTime();
+  if(!result.fSupported) {
+    Info("RunBackend", "Backend %s does not support %d dimensions with %d bins, skipped", backend->GetName(), fNDim, fNBins[0]);
+    backend->Reset();
+    return;
+  }
+
+  watch.Reset();
+  for(Long64_t ifill = 0; ifill < fNFills; ifill += kBlockSize) {
+    Int_t nblock = static_cast<Int_t>(TMath::Min(static_cast<Long64_t>(kBlockSize), fNFills - ifill));
+    for(Int_t ipoint = 0; ipoint < nblock; ipoint++) {
+      for(Int_t idim = 0; idim < fNDim; idim++) {
+        Double_t width = fMax[idim] - fMin[idim];
+        points[ipoint * fNDim + idim] = (fDistribution == kGaussian) ? rng.Gaus(fMin[idim] + 0.5 * width, 0.15 * width) : fMin[idim] + width * rng.Rndm();
+      }
+      if(fUseWeights) weights[ipoint] = rng.Uniform(0.5, 1.5);
+    }
+    watch.Start(kFALSE);
+    for(Int_t ipoint = 0; ipoint < nblock; ipoint++) backend->Fill(points.data() + ipoint * fNDim, weights[ipoint]);
+    watch.Stop();
+  }
+  result.fFillTime = watch.RealTime();
+  result.fFillRate = result.fFillTime > 0. ? fNFills / result.fFillTime : 0.;
+  result.fMemory = GetResidentMemory() - memStart;
+
+  TObject *output = backend->GetOutput();
+  TBufferFile buffer(TBuffer::kWrite);
+  buffer.WriteObject(output);
+  result.fOutputSize = buffer.Length() / 1024.;
+
+  if(fNMergeCopies > 0) {
+    // Merge copies of the filled output into the output itself, as done for the worker outputs on the train
+    TList copies;
+    copies.SetOwner(kTRUE);
+    for(Int_t icopy = 0; icopy < fNMergeCopies; icopy++) copies.Add(output->Clone());
+    watch.Start();
+    if(MergeObject(output, &copies) < 0) {
+      Warning("RunBackend", "Output of backend %s (%s) is not mergeable", backend->GetName(), output->ClassName());
+    }
+    watch.Stop();
+    result.fMergeTime = watch.RealTime();
+  }
+  backend->Reset();
+}
+
+/**
+ * Merge objects into a target, as done by the analysis manager.
+ * Collections are merged element by element, matching the elements by name.
+ * @param[in] target Object the inputs are merged into
+ * @param[in] inputs Collection of objects of the same type as target
+ * @return Result of the Merge function of the target, -1 if the target is not mergeable
+ */
+Long64_t AliHistogrammingBenchmark::MergeObject(TObject *target, TCollection *inputs) {
+  TCollection *targetCollection = dynamic_cast<TCollection *>(target);
+  if(targetCollection) {
+    Long64_t result = 0;
+    TIter nextTarget(targetCollection);
+    TObject *element = nullptr;
+    while((element = nextTarget())) {
+      TList elementInputs;
+      TIter nextInput(inputs);
+      TObject *input = nullptr;
+      while((input = nextInput())) {
+        TCollection *inputCollection = dynamic_cast<TCollection *>(input);
+        TObject *inputElement = inputCollection ? inputCollection->FindObject(element->GetName()) : nullptr;
+        if(inputElement) elementInputs.Add(inputElement);
+      }
+      Long64_t elementResult = MergeObject(element, &elementInputs);
+      if(elementResult < 0) return elementResult;
+      result += elementResult;
+    }
+    return result;
+  }
+  TMethodCall callEnv;
+  callEnv.InitWithPrototype(target->IsA(), "Merge", "TCollection*");
+  if(!callEnv.IsValid()) return -1;
+  callEnv.SetParam((Long_t) inputs);
+  Long_t result = 0;
+  callEnv.Execute(target, result);
+  return result;
+}
+
+/**
+ * Print the results of the last run as table
+ * @param[in] opt Not used
+ */
+void AliHistogrammingBenchmark::Print(Option_t *) const {
+  Printf("Histogramming benchmark %s: %d dimensions x %d bins, %lld fills (%s%s), %d merge copies",
+      GetName(), fNDim, fNDim ? fNBins[0] : 0, fNFills, fDistribution == kGaussian ? "gaussian" : "uniform",
+      fUseWeights ? ", weighted" : "", fNMergeCopies);
+  Printf("%-22s %12s %10s %12s %12s %10s", "backend", "fills/s", "book [s]", "memory [kB]", "output [kB]", "merge [s]");
+  for(std::vector<Result_t>::const_iterator it = fResults.begin(); it != fResults.end(); ++it) {
+    if(!it->fSupported) {
+      Printf("%-22s %12s", it->fBackend.Data(), "n/a");
+      continue;
+    }
+    Printf("%-22s %12.4g %10.4f %12.0f %12.1f %10.4f", it->fBackend.Data(), it->fFillRate, it->fBookTime, it->fMemory, it->fOutputSize, it->fMergeTime);
+  }
+}
+
+/**
+ * Write the configuration and the results of the last run in JSON format
+ * @param[in] filename Name of the output file
+ */
+void AliHistogrammingBenchmark::WriteReport(const char *filename) const {
+  std::ofstream report(filename);
+  if(!report.good()) {
+    Error("WriteReport", "Cannot open %s", filename);
+    return;
+  }
+  report << "{\n";
+  report << "  \"ndim\": " << fNDim << ",\n";
+  report << "  \"nbins\": " << (fNDim ? fNBins[0] : 0) << ",\n";
+  report << "  \"nfills\": " << fNFills << ",\n";
+  report << "  \"distribution\": \"" << (fDistribution == kGaussian ? "gaussian" : "uniform") << "\",\n";
+  report << "  \"weighted\": " << (fUseWeights ? "true" : "false") << ",\n";
+  report << "  \"mergecopies\": " << fNMergeCopies << ",\n";
+  report << "  \"backends\": [\n";
+  for(std::vector<Result_t>::const_iterator it = fResults.begin(); it != fResults.end(); ++it) {
+    report << "    {\"name\": \"" << it->fBackend.Data() << "\", \"supported\": " << (it->fSupported ? "true" : "false")
+           << ", \"fillrate\": " << it->fFillRate << ", \"booktime\": " << it->fBookTime << ", \"filltime\": " << it->fFillTime
+           << ", \"memorykb\": " << it->fMemory << ", \"outputkb\": " << it->fOutputSize << ", \"mergetime\": " << it->fMergeTime << "}"
+           << (it + 1 != fResults.end() ? ",\n" : "\n");
+  }
+  report << "  ]\n}\n";
+}
@@ -0,0 +1,134 @@
+#ifndef ALIHISTOGRAMMINGBENCHMARK_H
+#define ALIHISTOGRAMMINGBENCHMARK_H
+/* Copyright(c) 1998-2019, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <vector>
+#include <TNamed.h>
+#include <TString.h>
+
+class TCollection;
+class TObjArray;
+
+/**
+ * \class AliHistogrammingBackend
+ * \brief Interface of a histogramming front-end benchmarked by AliHistogrammingBenchmark
+ *
+ * A backend books a histogram set of ndim uniformly binned variables,
+ * fills it point by point and exposes the object which would be written
+ * to the task output (and which is therefore merged on the train).
+ * Backends living in libraries which PWGTools cannot link (AliHistogramManager,
+ * AliDielectronHistos, AliJHistManager) are implemented in the macro
+ * PWG/Tools/macros/BenchmarkHistogrammingBackends.C.
+ */
+class AliHistogrammingBackend : public TNamed {
+public:
+  AliHistogrammingBackend() : TNamed() {}
+  AliHistogrammingBackend(const char *name, const char *title) : TNamed(name, title) {}
+  virtual ~AliHistogrammingBackend() {}
+
+  /**
+   * Book the histogram set
+   * @param[in] ndim Number of variables
+   * @param[in] nbins Number of bins per variable
+   * @param[in] min Lower edge per variable
+   * @param[in] max Upper edge per variable
+   * @return kFALSE if the backend does not support the requested dimensionality
+   */
+  virtual Bool_t Book(Int_t ndim, const Int_t *nbins, const Double_t *min, const Double_t *max) = 0;
+  /// Fill one point of ndim coordinates
+  virtual void Fill(const Double_t *x, Double_t weight) = 0;
+  /// Object as written to the output (not owned by the caller)
+  virtual TObject *GetOutput() const = 0;
+  /// Delete the booked histograms
+  virtual void Reset() = 0;
+
+  ClassDef(AliHistogrammingBackend, 1);
+};
+
+/**
+ * \class AliHistogrammingBenchmark
+ * \brief Benchmark of the histogramming front-ends used in hot loops
+ *
+ * Fills equivalent histogram sets through each registered backend with
+ * synthetic data of configurable dimensionality and measures
+ * - the fill rate (fills/s, random number generation excluded),
+ * - the resident memory growth and the serialised size of the output,
+ * - the time to merge a configurable number of output copies.
+ *
+ * Built-in backends: THistManager (handles, TH1/2/3 up to 3 dimensions, THnSparse above),
+ * AliTHn (dense and chunked storage), AliCFGridSparse (sparse and dense fill), THnSparseD and THnD.
+ *
+ * ~~~{.cxx}
+ * AliHistogrammingBenchmark bench("bench");
+ * bench.AddDefaultBackends();
+ * bench.SetDimensions(4, 50);
+ * bench.SetNumberOfFills(1000000);
+ * bench.Run();
+ * bench.WriteReport("histbench.json");
+ * ~~~
+ */
+class AliHistogrammingBenchmark : public TNamed {
+public:
+  enum EDistribution_t {
+    kUniform = 0,       ///< uniform in the histogram range, all bins populated
+    kGaussian = 1       ///< gaussian around the centre of the range, sparse occupancy of the outer bins
+  };
+
+  /// Measurement of a single backend
+  struct Result_t {
+    TString  fBackend;          ///< Name of the backend
+    Bool_t   fSupported;        ///< Backend accepted the configuration
+    Double_t fBookTime;         ///< Real time to book the histograms (s)
+    Double_t fFillTime;         ///< Real time spent in Fill (s)
+    Double_t fFillRate;         ///< Fills per second
+    Double_t fMemory;           ///< Resident memory growth after booking and filling (kB)
+    Double_t fOutputSize;       ///< Serialised size of the output (kB)
+    Double_t fMergeTime;        ///< Real time to merge the output copies (s)
+  };
+
+  AliHistogrammingBenchmark();
+  AliHistogrammingBenchmark(const char *name);
+  virtual ~AliHistogrammingBenchmark();
+
+  void AddBackend(AliHistogrammingBackend *backend);
+  void AddDefaultBackends();
+
+  void SetDimensions(Int_t ndim, Int_t nbins, Double_t min = 0., Double_t max = 1.);
+  void SetNumberOfFills(Long64_t nfills) { fNFills = nfills; }
+  void SetNumberOfMergeCopies(Int_t ncopies) { fNMergeCopies = ncopies; }
+  void SetDistribution(EDistribution_t dist) { fDistribution = dist; }
+  void SetSeed(UInt_t seed) { fSeed = seed; }
+  void SetUseWeights(Bool_t useWeights) { fUseWeights = useWeights; }
+
+  void Run();
+  void WriteReport(const char *filename) const;
+  virtual void Print(Option_t *opt = "") const;
+
+  const std::vector<Result_t> &GetResults() const { return fResults; }
+
+  static Long64_t MergeObject(TObject *target, TCollection *inputs);
+
+protected:
+  void RunBackend(AliHistogrammingBackend *backend, Result_t &result);
+
+  TObjArray                 *fBackends;         ///< Registered backends (owned)
+  Int_t                      fNDim;             ///< Number of variables
+  std::vector<Int_t>         fNBins;            ///< Number of bins per variable
+  std::vector<Double_t>      fMin;              ///< Lower edge per variable
+  std::vector<Double_t>      fMax;              ///< Upper edge per variable
+  Long64_t                   fNFills;           ///< Number of fills per backend
+  Int_t                      fNMergeCopies;     ///< Number of output copies merged
+  EDistribution_t            fDistribution;     ///< Distribution of the synthetic data
+  UInt_t                     fSeed;             ///< Seed of the random generator, identical for all backends
+  Bool_t                     fUseWeights;       ///< Fill with random weights (enables sumw2)
+  std::vector<Result_t>      fResults;          //!<! Results of the last Run
+
+private:
+  AliHistogrammingBenchmark(const AliHistogrammingBenchmark &);
+  AliHistogrammingBenchmark &operator=(const AliHistogrammingBenchmark &);
+
+  ClassDef(AliHistogrammingBenchmark, 1);
+};
+
+#endif /* ALIHISTOGRAMMINGBENCHMARK_H */
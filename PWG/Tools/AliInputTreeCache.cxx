@@ -0,0 +1,118 @@
+/**************************************************************************
+ * Copyright(c) 1998-2015, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+#include <algorithm>
+#include <TEnv.h>
+#include <TFile.h>
+#include <TObjArray.h>
+#include <TObjString.h>
+#include <TString.h>
+#include <TTree.h>
+
+#include "AliLog.h"
+#include "AliInputTreeCache.h"
+
+ClassImp(AliInputTreeCache)
+
+AliInputTreeCache *AliInputTreeCache::fgInstance = nullptr;
+
+namespace {
+const Long64_t kDefaultCacheSize = 30000000; ///< Cache size of registered trees when no size is given
+}
+
+AliInputTreeCache::AliInputTreeCache():
+  TNamed("AliInputTreeCache", "Used-branch registry and tree cache setup")
+{
+}
+
+AliInputTreeCache *AliInputTreeCache::Instance() {
+  if(!fgInstance) fgInstance = new AliInputTreeCache;
+  return fgInstance;
+}
+
+void AliInputTreeCache::RegisterBranch(const char *tree, const char *branch) {
+  if(!tree || !branch || !strlen(branch)) return;
+  std::vector<std::string> &branches = fTrees[tree].fBranches;
+  if(std::find(branches.begin(), branches.end(), branch) == branches.end()) branches.push_back(branch);
+}
+
+void AliInputTreeCache::RegisterBranches(const char *tree, const char *branches) {
+  // branches separated by spaces or commas
+  TObjArray *tokens = TString(branches).Tokenize(" ,");
+  for(Int_t i = 0; i < tokens->GetEntries(); i++) RegisterBranch(tree, tokens->At(i)->GetName());
+  delete tokens;
+}
+
+Bool_t AliInputTreeCache::HasRegisteredBranches(const char *tree) const {
+  auto it = fTrees.find(tree);
+  return it != fTrees.end() && !it->second.fBranches.empty();
+}
+
+Bool_t AliInputTreeCache::ConfigureTree(TTree *tree, const char *name, Long64_t cacheSize) {
+  // name: key of the registry (default: name of the tree)
+  // cacheSize: cache size requested by the reader, overridden by SetCacheSize()
+  // returns kFALSE if the tree was left untouched
+  if(!tree) return kFALSE;
+  if(fBytesReadStart < 0) fBytesReadStart = TFile::GetFileBytesRead();
+  TreeEntry_t &entry = fTrees[(name && strlen(name)) ? name : tree->GetName()];
+  entry.fTrees++;
+
+  Bool_t registered = !entry.fBranches.empty();
+  Long64_t size = fCacheSize > 0 ? fCacheSize : cacheSize;
+  if(size <= 0 && (registered || fAsyncPrefetching)) size = kDefaultCacheSize;
+  if(size <= 0) return kFALSE;
+
+  // the prefetching thread is attached to the file caches created from now on,
+  // which includes the caches of the following files of a chain
+  if(fAsyncPrefetching) gEnv->SetValue("TFile.AsyncPrefetching", 1);
+
+  if(registered && fReadOnlyRegistered) {
+    tree->SetBranchStatus("*", 0);
+    for(const auto &branch : entry.fBranches) {
+      UInt_t found = 0;
+      tree->SetBranchStatus(branch.c_str(), 1, &found);
+    }
+  }
+
+  tree->SetCacheSize(size);
+  tree->SetCacheLearnEntries(fLearnEntries);
+  for(const auto &branch : entry.fBranches) {
+    // names without wildcards are only added if the branch exists in this tree
+    if(branch.find_first_of("*?[") == std::string::npos && !tree->GetBranch(branch.c_str())) continue;
+    tree->AddBranchToCache(branch.c_str(), kTRUE);
+  }
+  AliDebug(1, Form("Tree %s: cache of %lld bytes, %lu registered branches", tree->GetName(), size, entry.fBranches.size()));
+  return kTRUE;
+}
+
+void AliInputTreeCache::CountEvent(const char *tree) {
+  if(fBytesReadStart < 0) fBytesReadStart = TFile::GetFileBytesRead();
+  fTrees[tree].fEvents++;
+}
+
+void AliInputTreeCache::Print(Option_t *tree) const {
+  // tree: only print this tree ("": all trees)
+  // The bytes are read by the whole process, the bytes per event of a tree include the
+  // reads of the other trees read in the same job.
+  Long64_t bytes = fBytesReadStart < 0 ? 0 : TFile::GetFileBytesRead() - fBytesReadStart;
+  TString selected(tree);
+  Printf("%s: %.1f MB read from the input files", GetName(), bytes / 1.e6);
+  for(const auto &entry : fTrees) {
+    if(selected.Length() && selected.CompareTo(entry.first.c_str())) continue;
+    const TreeEntry_t &stat = entry.second;
+    TString line = Form("  %-20s %lld events, %d trees, %lu registered branches", entry.first.c_str(), stat.fEvents, stat.fTrees, stat.fBranches.size());
+    if(stat.fEvents > 0) line += Form(", %.1f kB read per event", bytes / 1.e3 / stat.fEvents);
+    Printf("%s", line.Data());
+  }
+}
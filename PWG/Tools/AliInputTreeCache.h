@@ -0,0 +1,71 @@
+#ifndef ALIINPUTTREECACHE_H
+#define ALIINPUTTREECACHE_H
+/* Copyright(c) 1998-2015, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <map>
+#include <string>
+#include <vector>
+#include <TNamed.h>
+
+class TTree;
+
+/**
+ * \class AliInputTreeCache
+ * \brief Used-branch registry and TTreeCache setup shared by the input readers of a train
+ *
+ * Tasks register the branches they read, per tree name, in UserCreateOutputObjects().
+ * Reader classes (input handlers, embedding and mixing helpers) pass every tree or chain
+ * they connect to ConfigureTree(): the TTreeCache is sized, the registered branches are
+ * added to it from the first entry (the learning phase still picks up branches read by
+ * unregistered tasks) and the baskets can be prefetched on ROOT's background thread.
+ * Trees without registered branches and without explicit settings are left untouched.
+ * Readers count their events with CountEvent() and report the bytes read from the input
+ * files per event with Print() at the end of the job.
+ */
+class AliInputTreeCache : public TNamed {
+public:
+  static AliInputTreeCache *Instance();
+
+  void RegisterBranch(const char *tree, const char *branch);
+  void RegisterBranches(const char *tree, const char *branches);
+  Bool_t HasRegisteredBranches(const char *tree) const;
+
+  /// Size of the caches (0: use the reader's own size, or 30 MB for registered trees)
+  void SetCacheSize(Long64_t bytes) { fCacheSize = bytes; }
+  /// Number of entries of the learning phase
+  void SetLearnEntries(Int_t n) { fLearnEntries = n; }
+  /// Read the baskets ahead on a background thread (TFile.AsyncPrefetching)
+  void SetAsyncPrefetching(Bool_t prefetch = kTRUE) { fAsyncPrefetching = prefetch; }
+  /// Switch off all branches except the registered ones (only for trees with registered branches)
+  void SetReadOnlyRegisteredBranches(Bool_t only = kTRUE) { fReadOnlyRegistered = only; }
+
+  Bool_t ConfigureTree(TTree *tree, const char *name = nullptr, Long64_t cacheSize = 0);
+  void CountEvent(const char *tree);
+  virtual void Print(Option_t *tree = "") const;
+
+private:
+  AliInputTreeCache();
+  AliInputTreeCache(const AliInputTreeCache &);
+  AliInputTreeCache &operator=(const AliInputTreeCache &);
+
+  /// Registered branches and read statistics of one tree name
+  struct TreeEntry_t {
+    std::vector<std::string> fBranches;    ///< Registered branches (wildcards allowed)
+    Long64_t                 fEvents = 0;  ///< Events counted by the readers
+    Int_t                    fTrees = 0;   ///< Number of configured trees (files)
+  };
+
+  static AliInputTreeCache *fgInstance;   ///< Instance shared by the tasks and readers
+
+  Long64_t fCacheSize = 0;                 ///< Size of the caches (0: reader's size or default)
+  Int_t    fLearnEntries = 10;             ///< Entries of the learning phase
+  Bool_t   fAsyncPrefetching = kFALSE;     ///< Prefetch the baskets on a background thread
+  Bool_t   fReadOnlyRegistered = kFALSE;   ///< Switch off the unregistered branches
+  Long64_t fBytesReadStart = -1;           //!<! TFile::GetFileBytesRead() when the first tree was configured
+  std::map<std::string, TreeEntry_t> fTrees; //!<! Registry per tree name
+
+  ClassDef(AliInputTreeCache, 1);
+};
+
+#endif /* ALIINPUTTREECACHE_H */
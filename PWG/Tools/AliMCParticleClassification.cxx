@@ -0,0 +1,111 @@
+/**************************************************************************
+ * Copyright(c) 1998-2015, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+#include <TMath.h>
+
+#include "AliMCEvent.h"
+#include "AliVEvent.h"
+#include "AliVParticle.h"
+#include "AliMCParticleClassification.h"
+
+ClassImp(AliMCParticleClassification)
+
+AliMCParticleClassification::AliMCParticleClassification():
+  TNamed(),
+  fOrigin(),
+  fSpecies(),
+  fMother(),
+  fMotherPdg(),
+  fPrimaryAncestor(),
+  fGenerator()
+{
+}
+
+AliMCParticleClassification::AliMCParticleClassification(const char *name):
+  TNamed(name, "MC particle classification"),
+  fOrigin(),
+  fSpecies(),
+  fMother(),
+  fMotherPdg(),
+  fPrimaryAncestor(),
+  fGenerator()
+{
+}
+
+AliMCParticleClassification *AliMCParticleClassification::Get(const AliVEvent *event, const char *name){
+  if(!event) return nullptr;
+  return dynamic_cast<AliMCParticleClassification *>(event->FindListObject(name));
+}
+
+Int_t AliMCParticleClassification::GetSpeciesIndex(Int_t pdgCode){
+  switch(TMath::Abs(pdgCode)){
+    case 11:   return kElectron;
+    case 13:   return kMuon;
+    case 211:  return kPion;
+    case 321:  return kKaon;
+    case 2212: return kProton;
+    default:   return kUndefined;
+  };
+}
+
+void AliMCParticleClassification::Fill(AliMCEvent *mcEvent){
+  Int_t nParticles = mcEvent ? mcEvent->GetNumberOfTracks() : 0;
+  fOrigin.assign(nParticles, 0);
+  fSpecies.assign(nParticles, kUndefined);
+  fMother.assign(nParticles, -1);
+  fMotherPdg.assign(nParticles, 0);
+  fPrimaryAncestor.assign(nParticles, -1);
+  fGenerator.assign(nParticles, -1);
+
+  for(Int_t ipart = 0; ipart < nParticles; ipart++){
+    AliVParticle *part = mcEvent->GetTrack(ipart);
+    if(!part) continue;
+    UChar_t origin = 0;
+    if(mcEvent->IsPhysicalPrimary(ipart)) origin |= kPhysicalPrimary;
+    else if(mcEvent->IsSecondaryFromWeakDecay(ipart)) origin |= kSecondaryWeakDecay;
+    else if(mcEvent->IsSecondaryFromMaterial(ipart)) origin |= kSecondaryMaterial;
+    if(mcEvent->IsFromSubsidiaryEvent(ipart)) origin |= kSubsidiaryEvent;
+    fOrigin[ipart] = origin;
+    fSpecies[ipart] = GetSpeciesIndex(part->PdgCode());
+    fGenerator[ipart] = part->GetGeneratorIndex();
+    Int_t mother = part->GetMother();
+    if(mother >= 0 && mother < nParticles){
+      fMother[ipart] = mother;
+      AliVParticle *mpart = mcEvent->GetTrack(mother);
+      if(mpart) fMotherPdg[ipart] = mpart->PdgCode();
+    }
+  }
+
+  // mothers are stored before their daughters, so the primary ancestor of the
+  // mother is already known in a single pass in most cases - walk the chain otherwise
+  for(Int_t ipart = 0; ipart < nParticles; ipart++){
+    if(fOrigin[ipart] & kPhysicalPrimary){
+      fPrimaryAncestor[ipart] = ipart;
+      continue;
+    }
+    Int_t mother = fMother[ipart];
+    if(mother < 0) continue;
+    if(mother < ipart){
+      fPrimaryAncestor[ipart] = fPrimaryAncestor[mother];
+      continue;
+    }
+    for(Int_t depth = 0; mother >= 0 && depth < nParticles; depth++){
+      if(fOrigin[mother] & kPhysicalPrimary){
+        fPrimaryAncestor[ipart] = mother;
+        break;
+      }
+      mother = fMother[mother];
+    }
+  }
+}
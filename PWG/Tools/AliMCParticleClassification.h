@@ -0,0 +1,73 @@
+#ifndef ALIMCPARTICLECLASSIFICATION_H
+#define ALIMCPARTICLECLASSIFICATION_H
+/* Copyright(c) 1998-2015, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <vector>
+#include <TNamed.h>
+
+class AliMCEvent;
+class AliVEvent;
+
+/**
+ * \class AliMCParticleClassification
+ * \brief Classification of all MC particles of the event, filled once per event
+ *
+ * Flat per-label arrays with the origin (physical primary, secondary from weak
+ * decay or material, subsidiary event), the species index, the mother and the
+ * generator index of each MC particle. The object is filled by
+ * AliAnalysisTaskMCParticleClassification and attached to the input event, so
+ * all wagons of the train read the same classification with Get(InputEvent()).
+ */
+class AliMCParticleClassification : public TNamed {
+public:
+  enum EOrigin_t {
+    kPhysicalPrimary    = BIT(0),
+    kSecondaryWeakDecay = BIT(1),
+    kSecondaryMaterial  = BIT(2),
+    kSubsidiaryEvent    = BIT(3)
+  };
+  enum ESpecies_t {
+    kUndefined = -1,
+    kElectron = 0,
+    kMuon,
+    kPion,
+    kKaon,
+    kProton,
+    kNSpecies
+  };
+
+  AliMCParticleClassification();
+  AliMCParticleClassification(const char *name);
+  virtual ~AliMCParticleClassification() {}
+
+  static const char *DefaultName() { return "MCParticleClassification"; }
+  static AliMCParticleClassification *Get(const AliVEvent *event, const char *name = DefaultName());
+  static Int_t GetSpeciesIndex(Int_t pdgCode);
+
+  void   Fill(AliMCEvent *mcEvent);
+
+  Int_t  GetNParticles() const                    { return fOrigin.size(); }
+  Bool_t IsValid(Int_t label) const               { return label >= 0 && label < Int_t(fOrigin.size()); }
+  Bool_t IsPhysicalPrimary(Int_t label) const     { return IsValid(label) && (fOrigin[label] & kPhysicalPrimary); }
+  Bool_t IsSecondaryFromWeakDecay(Int_t label) const { return IsValid(label) && (fOrigin[label] & kSecondaryWeakDecay); }
+  Bool_t IsSecondaryFromMaterial(Int_t label) const  { return IsValid(label) && (fOrigin[label] & kSecondaryMaterial); }
+  Bool_t IsFromSubsidiaryEvent(Int_t label) const { return IsValid(label) && (fOrigin[label] & kSubsidiaryEvent); }
+  Int_t  GetSpecies(Int_t label) const            { return IsValid(label) ? fSpecies[label] : kUndefined; }
+  Int_t  GetMother(Int_t label) const             { return IsValid(label) ? fMother[label] : -1; }
+  Int_t  GetMotherPdg(Int_t label) const          { return IsValid(label) ? fMotherPdg[label] : 0; }
+  Int_t  GetPrimaryAncestor(Int_t label) const    { return IsValid(label) ? fPrimaryAncestor[label] : -1; }
+  Int_t  GetGeneratorIndex(Int_t label) const     { return IsValid(label) ? fGenerator[label] : -1; }
+
+private:
+  std::vector<UChar_t> fOrigin;          //!<! EOrigin_t bits per label
+  std::vector<Char_t>  fSpecies;         //!<! ESpecies_t per label
+  std::vector<Int_t>   fMother;          //!<! label of the mother, -1 if none
+  std::vector<Int_t>   fMotherPdg;       //!<! PDG code of the mother, 0 if none
+  std::vector<Int_t>   fPrimaryAncestor; //!<! first physical primary in the mother chain (the particle itself if primary)
+  std::vector<Short_t> fGenerator;       //!<! generator index per label
+
+  ClassDef(AliMCParticleClassification, 1);
+};
+
+#endif /* ALIMCPARTICLECLASSIFICATION_H */
@@ -62,7 +62,8 @@ fHistMCFractions(nullptr), fHistMCWeights(nullptr), fHistMCWeightsSysUp(nullptr)
 fMultOrCent(0), fNPartTypes(6), fNCentralities(0),
 fbTaskStatus(AliMCSpectraWeights::TaskState::kAllEmpty),
 fFlag(AliMCSpectraWeights::SysFlag::kNominal), fUseMultiplicity(kTRUE),
-fUseMBFractions(kFALSE), fDoInterpolation(kTRUE) {}
+fUseMBFractions(kFALSE), fDoInterpolation(kTRUE), fCachedHist(nullptr),
+fCachedMult(-1), fCachedMultLow(0), fCachedMultHigh(0), fCachedBinY{-1, -1} {}
 
 /**
  *  @brief standard way for constuctor
@@ -83,7 +84,9 @@ fHistMCGenPrimTrackParticle(nullptr), fHistDataFractions(nullptr),
 fHistMCFractions(nullptr), fHistMCWeights(nullptr),  fHistMCWeightsSysUp(nullptr), fHistMCWeightsSysDown(nullptr), fMCEvent(nullptr),
 fMultOrCent(0), fNPartTypes(6), fNCentralities(0),
 fbTaskStatus(AliMCSpectraWeights::TaskState::kAllEmpty), fFlag(flag),
-fUseMultiplicity(kTRUE), fUseMBFractions(kFALSE), fDoInterpolation(kTRUE) {
+fUseMultiplicity(kTRUE), fUseMBFractions(kFALSE), fDoInterpolation(kTRUE),
+fCachedHist(nullptr), fCachedMult(-1), fCachedMultLow(0), fCachedMultHigh(0),
+fCachedBinY{-1, -1} {
 #ifdef __AliMCSpectraWeights_DebugTiming__
     auto t1 = std::chrono::high_resolution_clock::now();
 #endif
@@ -1115,48 +1118,83 @@ int const AliMCSpectraWeights::CheckAndIdentifyParticle(TParticle* part) {
     return AliMCSpectraWeights::IdentifyMCParticle(part);
 }
 
-std::vector<int> const AliMCSpectraWeights::FindBinEntry(float pt, int const part) {
+/**
+ *  @brief multiplicity part of the bin lookup, once per event
+ *
+ *  The multiplicity class, its edges and the corresponding bins on the
+ *  multiplicity axis of the weight histograms only depend on fMultOrCent:
+ *  they are computed again only when the counted multiplicity (or the weight
+ *  histogram) changed since the last call.
+ */
+void AliMCSpectraWeights::UpdateMultCache() {
+    TH3F* const hist = fHistMCWeightsSys[AliMCSpectraWeights::SysFlag::kNominal];
+    if (fMultOrCent == fCachedMult && hist == fCachedHist)
+        return;
     fMultClass = AliMCSpectraWeights::GetCentFromMult(fMultOrCent); // nominal cent value
+    auto const _multTuple = AliMCSpectraWeights::GetMultTupleFromCent(fMultClass);
+    fCachedMultLow = _multTuple.front();
+    fCachedMultHigh = _multTuple.back();
+    fCachedMult = fMultOrCent;
+    fCachedHist = hist;
+    if (!hist) {
+        fCachedBinY[0] = fCachedBinY[1] = -1;
+        return;
+    }
+    TAxis* const axis = hist->GetYaxis();
+    if (fDoInterpolation) {
+        auto const icent_low    = AliMCSpectraWeights::GetCentFromMult(fCachedMultLow);
+        auto const icent_high   = AliMCSpectraWeights::GetCentFromMult(fCachedMultHigh);
+        fCachedBinY[0] = axis->FindBin(static_cast<float>(AliMCSpectraWeights::GetMultFromCent(icent_low)));
+        fCachedBinY[1] = axis->FindBin(static_cast<float>(AliMCSpectraWeights::GetMultFromCent(icent_high)));
+    } else {
+        fCachedBinY[0] = fCachedBinY[1] = axis->FindBin(static_cast<float>(AliMCSpectraWeights::GetMultFromCent(fMultClass)));
+    }
+}
+
+/**
+ *  @brief bins of the weight histograms for a particle of the current event
+ *  @param[in] pt
+ *  @param[in] part particle type
+ *  @param[out] bins global bins, low and high multiplicity for the interpolation
+ *  @return number of bins (1 or 2)
+ *
+ *  Same bins as TH3F::FindBin(pt, mult, part), with the multiplicity bins
+ *  taken from the per event cache.
+ */
+int const AliMCSpectraWeights::FindBinEntry(float pt, int const part, int* bins) {
+    AliMCSpectraWeights::UpdateMultCache();
     if (pt < 0.15) {
         DebugPCC("Warning: pt too low; pt = " + std::to_string(pt) + "\n");
-        return {-1};
+        bins[0] = -1;
+        return 1;
     }
     if (pt >= 20) {
         DebugPCC("Info: pt too high; pt = " + std::to_string(pt) + "; set to 19.9\n");
         pt = 19.9;
     }
-    auto const _multTuple = AliMCSpectraWeights::GetMultTupleFromCent(fMultClass);
-
-    std::vector<int> results;
-    auto const icent_low    = AliMCSpectraWeights::GetCentFromMult(_multTuple.front());
-    auto const icent_high   = AliMCSpectraWeights::GetCentFromMult(_multTuple.back());
-
-
-    if(fDoInterpolation){
-        std::array<float, 3> binEntry_low{
-            pt, static_cast<float>(AliMCSpectraWeights::GetMultFromCent(icent_low)),
-            static_cast<float>(part)};
-        auto const _iBin_low = GetBinFromTH3(
-                                             fHistMCWeightsSys[AliMCSpectraWeights::SysFlag::kNominal], binEntry_low);
-
-        std::array<float, 3> binEntry_high{
-            pt, static_cast<float>(AliMCSpectraWeights::GetMultFromCent(icent_high)),
-            static_cast<float>(part)};
-        auto const _iBin_high = GetBinFromTH3(
-                                              fHistMCWeightsSys[AliMCSpectraWeights::SysFlag::kNominal], binEntry_high);
-        results.push_back(_iBin_low);
-        results.push_back(_iBin_high);
-    } else {
-        std::array<float, 3> binEntry{
-            pt, static_cast<float>(AliMCSpectraWeights::GetMultFromCent(fMultClass)),
-            static_cast<float>(part)};
-        auto const _iBin = GetBinFromTH3(
-                                             fHistMCWeightsSys[AliMCSpectraWeights::SysFlag::kNominal], binEntry);
-        results.push_back(_iBin);
-    }
+    TH3F* const hist = fCachedHist;
+    int const ix = hist->GetXaxis()->FindBin(pt);
+    int const iz = hist->GetZaxis()->FindBin(static_cast<float>(part));
+    bins[0] = hist->GetBin(ix, fCachedBinY[0], iz);
+    if (!fDoInterpolation)
+        return 1;
+    bins[1] = hist->GetBin(ix, fCachedBinY[1], iz);
+    DebugPCC("Found bin at low: " + std::to_string(bins[0]) << "\t high: " << std::to_string(bins[1]) << "\n");
+    return 2;
+}
 
-    DebugPCC("Found bin at low: " + std::to_string(_iBin_low) << "\t high: " << std::to_string(_iBin_high) << "\n");
-    return results;
+/**
+ *  @brief weight of the bins found with FindBinEntry
+ *
+ *  With two bins the weight is interpolated linearly in the multiplicity
+ *  between the edges of the multiplicity class.
+ */
+float const AliMCSpectraWeights::GetWeightFromBins(TH3F* h, int const nBins, int const* bins) const {
+    if (nBins < 2)
+        return h->GetBinContent(bins[0]);
+    float const weight1 = h->GetBinContent(bins[0]);
+    float const weight2 = h->GetBinContent(bins[1]);
+    return weight1 + (weight2 - weight1)/(fCachedMultHigh - fCachedMultLow) * (fMultOrCent - fCachedMultLow); // linear interpolation
 }
 
 float const
@@ -1174,22 +1212,11 @@ AliMCSpectraWeights::GetMCSpectraWeightNominal(TParticle* mcGenParticle) {
         DebugPCC("Can't find particle type\n");
         return 1;
     }
-    auto const _iBin =
-    AliMCSpectraWeights::FindBinEntry(mcGenParticle->Pt(), particleType);
-    if (_iBin.size() < 1) {
-        DebugPCC("Can't find bin\n");
-        return 1;
-    }
-    float _weight_Interpolated = 1;
-    if(fDoInterpolation){
-        auto const _MultTuple = AliMCSpectraWeights::GetMultTupleFromCent(fMultClass);
-        float const weight1 = fHistMCWeightsSys[AliMCSpectraWeights::SysFlag::kNominal]->GetBinContent(_iBin.front());
-        float const weight2 = fHistMCWeightsSys[AliMCSpectraWeights::SysFlag::kNominal]->GetBinContent(_iBin.back());
-        _weight_Interpolated = weight1 + (weight2 - weight1)/(_MultTuple.back() - _MultTuple.front()) * (fMultOrCent - _MultTuple.front()); // linear interpolation
-    }
-    else {
-        _weight_Interpolated = fHistMCWeightsSys[AliMCSpectraWeights::SysFlag::kNominal]->GetBinContent(_iBin.front());
-    }
+    int _iBin[2];
+    int const _nBins =
+    AliMCSpectraWeights::FindBinEntry(mcGenParticle->Pt(), particleType, _iBin);
+    float _weight_Interpolated = AliMCSpectraWeights::GetWeightFromBins(
+        fHistMCWeightsSys[AliMCSpectraWeights::SysFlag::kNominal], _nBins, _iBin);
 
     if (_weight_Interpolated <= 0) {
         DebugPCC("ERROR: negative weight " << _weight_Interpolated << "; set to 1\n");
@@ -1237,39 +1264,15 @@ AliMCSpectraWeights::GetMCSpectraWeightSystematics(TParticle* mcGenParticle, Int
         DebugPCC("Can't find particle type\n");
         return 1;
     }
-    auto const _iBin =
-    AliMCSpectraWeights::FindBinEntry(mcGenParticle->Pt(), particleType);
-    if (_iBin.size() < 1) {
-        DebugPCC("Can't find bin\n");
-        return 1;
-    }
+    int _iBin[2];
+    int const _nBins =
+    AliMCSpectraWeights::FindBinEntry(mcGenParticle->Pt(), particleType, _iBin);
     float _weight_Interpolated = 1 ;
-    auto const _MultTuple = AliMCSpectraWeights::GetMultTupleFromCent(fMultClass);
-
-    if(fDoInterpolation){
-        if(SysCase > 0){
-            //weight = fHistMCWeightsSysUp->GetBinContent(_iBin);
-            float const weight1 = fHistMCWeightsSysUp->GetBinContent(_iBin.front());
-            float const weight2 = fHistMCWeightsSysUp->GetBinContent(_iBin.back());
-            _weight_Interpolated = weight1 + (weight2 - weight1)/(_MultTuple.back() - _MultTuple.front()) * (fMultOrCent - _MultTuple.front()); // linear interpolation
-
-        }
-        if(SysCase < 0){
-            //        weight = fHistMCWeightsSysDown->GetBinContent(_iBin);
-            float const weight1 = fHistMCWeightsSysDown->GetBinContent(_iBin.front());
-            float const weight2 = fHistMCWeightsSysDown->GetBinContent(_iBin.back());
-            _weight_Interpolated = weight1 + (weight2 - weight1)/(_MultTuple.back() - _MultTuple.front()) * (fMultOrCent - _MultTuple.front()); // linear interpolation
-        }
+    if(SysCase > 0){
+        _weight_Interpolated = AliMCSpectraWeights::GetWeightFromBins(fHistMCWeightsSysUp, _nBins, _iBin);
     }
-    else {
-        if(SysCase > 0){
-            //weight = fHistMCWeightsSysUp->GetBinContent(_iBin);
-            _weight_Interpolated = fHistMCWeightsSysUp->GetBinContent(_iBin.front());
-        }
-        if(SysCase < 0){
-            //        weight = fHistMCWeightsSysDown->GetBinContent(_iBin);
-            _weight_Interpolated = fHistMCWeightsSysDown->GetBinContent(_iBin.front());
-        }
+    if(SysCase < 0){
+        _weight_Interpolated = AliMCSpectraWeights::GetWeightFromBins(fHistMCWeightsSysDown, _nBins, _iBin);
     }
 
     if (_weight_Interpolated <= 0) {
@@ -1325,6 +1328,29 @@ AliMCSpectraWeights::GetMCSpectraWeight(Int_t mcGenParticle,
     }
 }
 
+/**
+ *  @brief weights for an array of particle labels of the current event
+ *  @param[in] nParticles
+ *  @param[in] mcGenParticles labels in fMCEvent
+ *  @param[out] weights
+ *  @param[in] SysCase
+ *
+ *  The task status is checked once for the whole array and the multiplicity
+ *  part of the bin lookup is shared by all particles of the event.
+ */
+void AliMCSpectraWeights::GetMCSpectraWeights(Int_t nParticles, Int_t const* mcGenParticles,
+                                              float* weights, Int_t SysCase) {
+    if (fbTaskStatus < AliMCSpectraWeights::TaskState::kMCWeightCalculated) {
+        DebugPCC("Warning: Status not kMCWeightCalculated\n");
+        std::fill(weights, weights + nParticles, 1.f);
+        return;
+    }
+    for (Int_t i = 0; i < nParticles; ++i) {
+        AliMCParticle* _MCpart = (AliMCParticle*)fMCEvent->GetTrack(mcGenParticles[i]);
+        weights[i] = AliMCSpectraWeights::GetMCSpectraWeight(_MCpart->Particle(), SysCase);
+    }
+}
+
 /**
  *  @brief identify secondary particle depending on mother pid
  *  @param[in] part
@@ -1424,19 +1450,20 @@ float const AliMCSpectraWeights::GetWeightForSecondaryParticle(Int_t partLabel,
         std::cerr << "AliMCSpectraWeights::Error: mother is not available\n";
         return 1;
     }
-    std::vector<int> _iBin = {};
+    int _iBin[2];
+    int _nBins = 0;
     switch (_SecondaryID) {
         case 0: // Lambda case
-            _iBin = AliMCSpectraWeights::FindBinEntry(motherPart->Pt(), AliMCSpectraWeights::ParticleType::kSigmaPlus);
+            _nBins = AliMCSpectraWeights::FindBinEntry(motherPart->Pt(), AliMCSpectraWeights::ParticleType::kSigmaPlus, _iBin);
             break;
         case 1: // Kaon0Short case
-            _iBin = AliMCSpectraWeights::FindBinEntry(motherPart->Pt(), AliMCSpectraWeights::ParticleType::kKaon);
+            _nBins = AliMCSpectraWeights::FindBinEntry(motherPart->Pt(), AliMCSpectraWeights::ParticleType::kKaon, _iBin);
             break;
         case 2: // electron from primary pion
-            _iBin = AliMCSpectraWeights::FindBinEntry(motherPart->Pt(), AliMCSpectraWeights::ParticleType::kPion);
+            _nBins = AliMCSpectraWeights::FindBinEntry(motherPart->Pt(), AliMCSpectraWeights::ParticleType::kPion, _iBin);
             break;
         case 3: // xi -> lambda -> proton
-            _iBin = AliMCSpectraWeights::FindBinEntry(motherPart->Pt(), AliMCSpectraWeights::ParticleType::kSigmaPlus);
+            _nBins = AliMCSpectraWeights::FindBinEntry(motherPart->Pt(), AliMCSpectraWeights::ParticleType::kSigmaPlus, _iBin);
             break;
 #ifdef __AliMCSpectraWeights_DebugPCC__
         case 4:
@@ -1447,40 +1474,17 @@ float const AliMCSpectraWeights::GetWeightForSecondaryParticle(Int_t partLabel,
         default:
             break;
     }
-    if (_iBin.size() < 1) {
+    if (_nBins < 1) {
         DebugPCC("\tCan't find bin;\n");
         return 1;
     }
 
-    auto const _MultTuple = AliMCSpectraWeights::GetMultTupleFromCent(fMultClass);
-
     if(SysCase==0){
-//        weight = fHistMCWeightsSys[AliMCSpectraWeights::SysFlag::kNominal]->GetBinContent(_iBin);
-        if(fDoInterpolation){
-            float const weight1 = fHistMCWeightsSys[AliMCSpectraWeights::SysFlag::kNominal]->GetBinContent(_iBin.front());
-            float const weight2 = fHistMCWeightsSys[AliMCSpectraWeights::SysFlag::kNominal]->GetBinContent(_iBin.back());
-            _weight_Interpolated = weight1 + (weight2 - weight1)/(_MultTuple.back() - _MultTuple.front()) * (fMultOrCent - _MultTuple.front()); // linear interpolation
-        } else {
-            _weight_Interpolated = fHistMCWeightsSys[AliMCSpectraWeights::SysFlag::kNominal]->GetBinContent(_iBin.front());
-        }
+        _weight_Interpolated = AliMCSpectraWeights::GetWeightFromBins(fHistMCWeightsSys[AliMCSpectraWeights::SysFlag::kNominal], _nBins, _iBin);
     } else if(SysCase<0){
-//        weight = fHistMCWeightsSysDown->GetBinContent(_iBin);
-        if(fDoInterpolation){
-            float const weight1 = fHistMCWeightsSysDown->GetBinContent(_iBin.front());
-            float const weight2 = fHistMCWeightsSysDown->GetBinContent(_iBin.back());
-            _weight_Interpolated = weight1 + (weight2 - weight1)/(_MultTuple.back() - _MultTuple.front()) * (fMultOrCent - _MultTuple.front()); // linear interpolation
-        } else {
-            _weight_Interpolated = fHistMCWeightsSysDown->GetBinContent(_iBin.front());
-        }
+        _weight_Interpolated = AliMCSpectraWeights::GetWeightFromBins(fHistMCWeightsSysDown, _nBins, _iBin);
     } else if(SysCase>0){
-//        weight = fHistMCWeightsSysUp->GetBinContent(_iBin);
-        if(fDoInterpolation){
-            float const weight1 = fHistMCWeightsSysUp->GetBinContent(_iBin.front());
-            float const weight2 = fHistMCWeightsSysUp->GetBinContent(_iBin.back());
-            _weight_Interpolated = weight1 + (weight2 - weight1)/(_MultTuple.back() - _MultTuple.front()) * (fMultOrCent - _MultTuple.front()); // linear interpolation
-        } else {
-            _weight_Interpolated = fHistMCWeightsSysUp->GetBinContent(_iBin.front());
-        }
+        _weight_Interpolated = AliMCSpectraWeights::GetWeightFromBins(fHistMCWeightsSysUp, _nBins, _iBin);
     }
 
     if(_weight_Interpolated < 1e-2){
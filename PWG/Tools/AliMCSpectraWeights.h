@@ -117,6 +117,12 @@ class AliMCSpectraWeights : public TNamed {
                                  dependent ones*/
     bool fDoSystematics;
     bool fDoInterpolation;    
+    // per event cache of the multiplicity lookup, see UpdateMultCache()
+    TH3F* fCachedHist;        //! nominal weight histogram the cache refers to
+    float fCachedMult;        //! fMultOrCent of the cache, -1 if not set
+    float fCachedMultLow;     //! lower edge of the multiplicity class
+    float fCachedMultHigh;    //! upper edge of the multiplicity class
+    int fCachedBinY[2];       //! multiplicity bins: nominal / low and high for the interpolation
 
     // functions
     // intern getter
@@ -141,7 +147,9 @@ class AliMCSpectraWeights : public TNamed {
     
 
     int const CheckAndIdentifyParticle(TParticle* part);
-    std::vector<int> const FindBinEntry(float pt, int const part);
+    void UpdateMultCache();
+    int const FindBinEntry(float pt, int const part, int* bins);
+    float const GetWeightFromBins(TH3F* h, int const nBins, int const* bins) const;
     
     // private = to be deleted
     AliMCSpectraWeights(const AliMCSpectraWeights&);//copy
@@ -185,6 +193,9 @@ class AliMCSpectraWeights : public TNamed {
     float const
     GetMCSpectraWeightSystematics(TParticle* mcGenParticle, Int_t SysCase = 1);
 
+    void GetMCSpectraWeights(Int_t nParticles, Int_t const* mcGenParticles,
+                             float* weights, Int_t SysCase=0); /*!< same as GetMCSpectraWeight for an array of labels */
+
     int const IdentifySecondaryType(Int_t partLabel);
     float const GetWeightForSecondaryParticle(Int_t partLabel, Int_t SysCase=0);
 
@@ -209,7 +220,7 @@ class AliMCSpectraWeights : public TNamed {
         }
     }
     void SetDoSystematics(bool doSys = true) { fDoSystematics = doSys; }
-    void SetDoInterpolation(bool doInter = true) {fDoInterpolation = doInter;}
+    void SetDoInterpolation(bool doInter = true) {fDoInterpolation = doInter; fCachedHist = nullptr;}
 
     // Getter
     std::vector<std::string> const GetParticleTypes() const {return fstPartTypes;}
@@ -227,7 +238,7 @@ class AliMCSpectraWeights : public TNamed {
 
     int const IdentifyMCParticle(TParticle* mcParticle);
 
-    ClassDef(AliMCSpectraWeights, 1);
+    ClassDef(AliMCSpectraWeights, 2);
 };
 
 struct AliMCSpectraWeightsHandler : public TNamed {
@@ -39,9 +39,38 @@
 #include "TArrayD.h"
 #include "THnSparse.h"
 #include "TMath.h"
+#include <cmath>
 
 templateClassImp(AliTHnT)
 
+namespace {
+  // rounds value to the closest multiple of the largest power of 2 which is not larger than maxError
+  Double_t RoundToPowerOfTwoStep(Double_t value, Double_t maxError)
+  {
+    if (!(maxError > 0))
+      return value;
+    Int_t exponent = 0;
+    frexp(maxError, &exponent); // maxError = m * 2^exponent with 0.5 <= m < 1
+    const Double_t step = ldexp(1., exponent - 1);
+    return TMath::Floor(value / step + 0.5) * step;
+  }
+
+  template <typename TemplateType>
+  void ReducePrecisionArray(TemplateType* values, TemplateType* sumw2, Long64_t n, Double_t relPrecision)
+  {
+    for (Long64_t l = 0; l<n; l++)
+    {
+      if (values[l] == 0)
+        continue;
+      // bins without sumw2 have been filled with weight 1
+      const Double_t error2 = TMath::Abs(sumw2 ? sumw2[l] : values[l]);
+      values[l] = RoundToPowerOfTwoStep(values[l], relPrecision * TMath::Sqrt(error2));
+      if (sumw2)
+        sumw2[l] = RoundToPowerOfTwoStep(sumw2[l], relPrecision * error2);
+    }
+  }
+}
+
 template <class TemplateArray, typename TemplateType>
 AliTHnT<TemplateArray, TemplateType>::AliTHnT() : 
   AliTHnBase(),
@@ -50,10 +79,18 @@ AliTHnT<TemplateArray, TemplateType>::AliTHnT() :
   fNSteps(0),
   fValues(0),
   fSumw2(0),
+  fChunkSize(0),
+  fChunkIndex(),
+  fChunkValues(),
+  fChunkSumw2(),
+  fChunkHasSumw2(kFALSE),
   axisCache(0),
   fNbinsCache(0),
   fLastVars(0),
-  fLastBins(0)
+  fLastBins(0),
+  fAxisUniform(0),
+  fAxisMin(0),
+  fAxisMax(0)
 {
   // Constructor
 }
@@ -66,10 +103,18 @@ AliTHnT<TemplateArray, TemplateType>::AliTHnT(const Char_t* name, const Char_t*
   fNSteps(nSelStep),
   fValues(0),
   fSumw2(0),
+  fChunkSize(0),
+  fChunkIndex(),
+  fChunkValues(),
+  fChunkSumw2(),
+  fChunkHasSumw2(kFALSE),
   axisCache(0),
   fNbinsCache(0),
   fLastVars(0),
-  fLastBins(0)
+  fLastBins(0),
+  fAxisUniform(0),
+  fAxisMin(0),
+  fAxisMax(0)
 {
   // Constructor
 
@@ -103,10 +148,18 @@ AliTHnT<TemplateArray, TemplateType>::AliTHnT(const AliTHnT &c) :
   fNSteps(c.fNSteps),
   fValues(new TemplateArray*[c.fNSteps]),
   fSumw2(new TemplateArray*[c.fNSteps]),
+  fChunkSize(c.fChunkSize),
+  fChunkIndex(c.fChunkIndex),
+  fChunkValues(c.fChunkValues),
+  fChunkSumw2(c.fChunkSumw2),
+  fChunkHasSumw2(c.fChunkHasSumw2),
   axisCache(0),
   fNbinsCache(0),
   fLastVars(0),
-  fLastBins(0)
+  fLastBins(0),
+  fAxisUniform(0),
+  fAxisMin(0),
+  fAxisMax(0)
 {
   //
   // AliTHnT copy constructor
@@ -131,10 +184,47 @@ AliTHnT<TemplateArray, TemplateType>::~AliTHnT()
   
   delete[] fValues;
   delete[] fSumw2;
+  DeleteAxisCache();
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::DeleteAxisCache()
+{
+  // delete the axis caches, they are rebuilt at the next Fill
+
   delete[] axisCache;
   delete[] fNbinsCache;
   delete[] fLastVars;
   delete[] fLastBins;
+  delete[] fAxisUniform;
+  delete[] fAxisMin;
+  delete[] fAxisMax;
+  axisCache = 0;
+  fNbinsCache = 0;
+  fLastVars = 0;
+  fLastBins = 0;
+  fAxisUniform = 0;
+  fAxisMin = 0;
+  fAxisMax = 0;
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::SetChunkedStorage(Int_t chunkSize)
+{
+  // switches to the chunked storage: the bins are grouped in chunks of <chunkSize> bins
+  // and only the chunks which are filled are allocated
+  // has to be called before the first Fill
+
+  if (chunkSize < 1)
+    AliFatal(Form("Invalid chunk size %d", chunkSize));
+
+  for (Int_t i=0; i<fNSteps; i++)
+    if (fValues[i])
+      AliFatal("The storage cannot be changed once the container has been filled");
+  if (!fChunkIndex.empty())
+    AliFatal("The storage cannot be changed once the container has been filled");
+
+  fChunkSize = chunkSize;
 }
 
 template <class TemplateArray, typename TemplateType>
@@ -156,6 +246,11 @@ void AliTHnT<TemplateArray, TemplateType>::DeleteContainers()
       fSumw2[i] = 0;
     }
   }
+
+  std::vector<Int_t>().swap(fChunkIndex);
+  std::vector<TemplateType>().swap(fChunkValues);
+  std::vector<TemplateType>().swap(fChunkSumw2);
+  fChunkHasSumw2 = kFALSE;
 }
 
 //____________________________________________________________________
@@ -191,9 +286,13 @@ AliTHnT<TemplateArray, TemplateType> &AliTHnT<TemplateArray, TemplateType>::oper
       fValues = 0;
       fSumw2 = 0;
     }
-    delete [] axisCache;
-    axisCache = new TAxis*[fNVars];
-    memcpy(axisCache, c.axisCache, fNVars*sizeof(TAxis*));
+    fChunkSize = c.fChunkSize;
+    fChunkIndex = c.fChunkIndex;
+    fChunkValues = c.fChunkValues;
+    fChunkSumw2 = c.fChunkSumw2;
+    fChunkHasSumw2 = c.fChunkHasSumw2;
+    // the cache refers to the axes of this object, it is rebuilt at the next Fill
+    DeleteAxisCache();
   }
   return *this;
 }
@@ -226,6 +325,12 @@ void AliTHnT<TemplateArray, TemplateType>::Copy(TObject& c) const
     else
       target.fSumw2[i] = 0;
   }
+
+  target.fChunkSize = fChunkSize;
+  target.fChunkIndex = fChunkIndex;
+  target.fChunkValues = fChunkValues;
+  target.fChunkSumw2 = fChunkSumw2;
+  target.fChunkHasSumw2 = fChunkHasSumw2;
 }
 
 //____________________________________________________________________
@@ -254,6 +359,16 @@ Long64_t AliTHnT<TemplateArray, TemplateType>::Merge(TCollection* list)
     if (entry == 0) 
       continue;
 
+    if (entry->fChunkSize != fChunkSize)
+      AliFatal(Form("Cannot merge containers with different storage (chunk size %d and %d)", fChunkSize, entry->fChunkSize));
+
+    if (fChunkSize > 0)
+    {
+      MergeChunked(entry);
+      count++;
+      continue;
+    }
+
     for (Int_t i=0; i<fNSteps; i++)
     {
       if (entry->fValues[i])
@@ -281,6 +396,51 @@ Long64_t AliTHnT<TemplateArray, TemplateType>::Merge(TCollection* list)
   return count+1;
 }
 
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::InitAxisCache(const Double_t *var)
+{
+  // fills the axis cache
+
+  axisCache = new TAxis*[fNVars];
+  fNbinsCache = new Int_t[fNVars];
+  fAxisUniform = new Bool_t[fNVars];
+  fAxisMin = new Double_t[fNVars];
+  fAxisMax = new Double_t[fNVars];
+  for (Int_t i=0; i<fNVars; i++)
+  {
+    axisCache[i] = GetAxis(i, 0);
+    fNbinsCache[i] = axisCache[i]->GetNbins();
+    fAxisUniform[i] = (axisCache[i]->GetXbins()->GetSize() == 0);
+    fAxisMin[i] = axisCache[i]->GetXmin();
+    fAxisMax[i] = axisCache[i]->GetXmax();
+  }
+  
+  fLastVars = new Double_t[fNVars];
+  fLastBins = new Int_t[fNVars];
+  
+  // initial values to prevent checking for 0 below
+  for (Int_t i=0; i<fNVars; i++)
+  {
+    fLastBins[i] = FindBinCached(i, var[i]);
+    fLastVars[i] = var[i];
+  }
+}
+
+template <class TemplateArray, typename TemplateType>
+Int_t AliTHnT<TemplateArray, TemplateType>::FindBinCached(Int_t i, Double_t x) const
+{
+  // same as TAxis::FindBin, without the function call for axes with fixed bin width
+
+  if (!fAxisUniform[i])
+    return axisCache[i]->FindBin(x);
+
+  if (x < fAxisMin[i])
+    return 0;
+  if (!(x < fAxisMax[i]))
+    return fNbinsCache[i] + 1;
+  return 1 + Int_t(fNbinsCache[i] * (x - fAxisMin[i]) / (fAxisMax[i] - fAxisMin[i]));
+}
+
 template <class TemplateArray, typename TemplateType>
 void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep, Double_t weight)
 {
@@ -288,25 +448,7 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
 
   // fill axis cache
   if (!axisCache)
-  {
-    axisCache = new TAxis*[fNVars];
-    fNbinsCache = new Int_t[fNVars];
-    for (Int_t i=0; i<fNVars; i++)
-    {
-      axisCache[i] = GetAxis(i, 0);
-      fNbinsCache[i] = axisCache[i]->GetNbins();
-    }
-    
-    fLastVars = new Double_t[fNVars];
-    fLastBins = new Int_t[fNVars];
-    
-    // initial values to prevent checking for 0 below
-    for (Int_t i=0; i<fNVars; i++)
-    {
-      fLastBins[i] = axisCache[i]->FindBin(var[i]);
-      fLastVars[i] = var[i];
-    }
-  }
+    InitAxisCache(var);
   
   // calculate global bin index
   Long64_t bin = 0;
@@ -319,7 +461,7 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
       tmpBin = fLastBins[i];
     else
     {
-      tmpBin = axisCache[i]->FindBin(var[i]);
+      tmpBin = FindBinCached(i, var[i]);
       fLastBins[i] = tmpBin;
       fLastVars[i] = var[i];
     }
@@ -334,6 +476,18 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
 //     Printf("%lld", bin);
   }
 
+  if (fChunkSize > 0)
+  {
+    const Long64_t offset = GetChunkOffset(istep, bin, kTRUE);
+    // initialize with already filled entries (which have been filled with weight == 1), in this case sumw2 := values
+    if (weight != 1 && !fChunkHasSumw2)
+      EnableChunkSumw2();
+    fChunkValues[offset] += weight;
+    if (fChunkHasSumw2)
+      fChunkSumw2[offset] += weight * weight;
+    return;
+  }
+
   if (!fValues[istep])
   {
     fValues[istep] = new TemplateArray(fNBins);
@@ -360,6 +514,80 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
 //   AliCFContainer::Fill(var, istep, weight);
 }
 
+template <class TemplateArray, typename TemplateType>
+Long64_t AliTHnT<TemplateArray, TemplateType>::GetChunkOffset(Int_t step, Long64_t bin, Bool_t create)
+{
+  // returns the position of global bin <bin> of step <step> in the chunked storage
+  // returns -1 if the chunk is not allocated and <create> is not set
+
+  const Long64_t nChunks = GetNChunks();
+  if (fChunkIndex.empty())
+  {
+    if (!create)
+      return -1;
+    fChunkIndex.assign(fNSteps * nChunks, -1);
+  }
+
+  Int_t& index = fChunkIndex[step * nChunks + bin / fChunkSize];
+  if (index < 0)
+  {
+    if (!create)
+      return -1;
+    index = fChunkValues.size() / fChunkSize;
+    fChunkValues.resize(fChunkValues.size() + fChunkSize, 0);
+    if (fChunkHasSumw2)
+      fChunkSumw2.resize(fChunkValues.size(), 0);
+  }
+
+  return (Long64_t) index * fChunkSize + bin % fChunkSize;
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::EnableChunkSumw2()
+{
+  // starts storing sumw2 in the chunked storage, the entries so far have weight 1: sumw2 := values
+
+  fChunkSumw2 = fChunkValues;
+  fChunkHasSumw2 = kTRUE;
+  AliInfo("Created sumw2 chunked storage");
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::MergeChunked(const AliTHnT* entry)
+{
+  // adds the chunked storage of <entry> to this
+
+  if (entry->fChunkIndex.empty())
+    return;
+
+  if (entry->fChunkHasSumw2 && !fChunkHasSumw2)
+    EnableChunkSumw2();
+
+  const Long64_t nChunks = GetNChunks();
+  for (Int_t i=0; i<fNSteps; i++)
+  {
+    for (Long64_t c = 0; c<nChunks; c++)
+    {
+      const Int_t sourceIndex = entry->fChunkIndex[i * nChunks + c];
+      if (sourceIndex < 0)
+        continue;
+
+      const Long64_t source = (Long64_t) sourceIndex * fChunkSize;
+      const Long64_t target = GetChunkOffset(i, c * fChunkSize, kTRUE);
+      for (Int_t k = 0; k<fChunkSize; k++)
+        fChunkValues[target + k] += entry->fChunkValues[source + k];
+
+      if (fChunkHasSumw2)
+      {
+        // entries without sumw2 have been filled with weight 1
+        const std::vector<TemplateType>& sourceSumw2 = entry->fChunkHasSumw2 ? entry->fChunkSumw2 : entry->fChunkValues;
+        for (Int_t k = 0; k<fChunkSize; k++)
+          fChunkSumw2[target + k] += sourceSumw2[source + k];
+      }
+    }
+  }
+}
+
 template <class TemplateArray, typename TemplateType>
 Long64_t AliTHnT<TemplateArray, TemplateType>::GetGlobalBinIndex(const Int_t* binIdx)
 {
@@ -384,6 +612,12 @@ void AliTHnT<TemplateArray, TemplateType>::FillContainer(AliCFContainer* cont)
   
   for (Int_t i=0; i<fNSteps; i++)
   {
+    if (fChunkSize > 0)
+    {
+      FillContainerChunked(cont, i);
+      continue;
+    }
+
     if (!fValues[i])
       continue;
       
@@ -443,6 +677,61 @@ void AliTHnT<TemplateArray, TemplateType>::FillContainer(AliCFContainer* cont)
   }  
 }
 
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::FillContainerChunked(AliCFContainer* cont, Int_t step)
+{
+  // fills step <step> of the container <cont> from the chunked storage, only the allocated chunks are visited
+
+  if (fChunkIndex.empty())
+    return;
+
+  THnSparse* target = cont->GetGrid(step)->GetGrid();
+
+  Int_t* binIdx = new Int_t[fNVars];
+  Int_t* nBins  = new Int_t[fNVars];
+  for (Int_t j=0; j<fNVars; j++)
+    nBins[j] = target->GetAxis(j)->GetNbins();
+
+  Long64_t count = 0;
+  Long64_t nAllocated = 0;
+  const Long64_t nChunks = GetNChunks();
+  for (Long64_t c = 0; c<nChunks; c++)
+  {
+    const Int_t index = fChunkIndex[step * nChunks + c];
+    if (index < 0)
+      continue;
+    nAllocated++;
+
+    const TemplateType* source = &fChunkValues[(Long64_t) index * fChunkSize];
+    // if sumw2 is not stored, the sqrt of the number of bin entries in source is filled below
+    const TemplateType* sourceSumw2 = fChunkHasSumw2 ? &fChunkSumw2[(Long64_t) index * fChunkSize] : source;
+
+    for (Int_t k = 0; k<fChunkSize; k++)
+    {
+      if (source[k] == 0)
+        continue;
+
+      // inverse of GetGlobalBinIndex
+      Long64_t globalBin = c * fChunkSize + k;
+      for (Int_t j=fNVars-1; j>=0; j--)
+      {
+        binIdx[j] = globalBin % nBins[j] + 1;
+        globalBin /= nBins[j];
+      }
+
+      target->SetBinContent(binIdx, source[k]);
+      target->SetBinError(binIdx, TMath::Sqrt(sourceSumw2[k]));
+
+      count++;
+    }
+  }
+
+  AliInfo(Form("Step %d: copied %lld entries out of %lld bins (%lld of %lld chunks allocated)", step, count, fNBins, nAllocated, nChunks));
+
+  delete[] binIdx;
+  delete[] nBins;
+}
+
 template <class TemplateArray, typename TemplateType>
 void AliTHnT<TemplateArray, TemplateType>::FillParent()
 {
@@ -451,6 +740,31 @@ void AliTHnT<TemplateArray, TemplateType>::FillParent()
   FillContainer(this);
 }
 
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::ReducePrecision(Double_t relPrecision)
+{
+  // rounds the content of each bin to a multiple of a power of 2 which is below <relPrecision> times
+  // the statistical uncertainty of the bin (sumw2 to <relPrecision> relative precision)
+  // The low mantissa bits of the stored numbers become 0, so that the containers compress much better
+  // in the output file, which reduces the file size and the I/O when merging. Bins with large
+  // statistics relative to their uncertainty are not changed, e.g. bins with unit weight entries
+  // for relPrecision < 1. Call before the container is written, e.g. relPrecision = 0.01
+  
+  if (relPrecision <= 0)
+    return;
+
+  if (fChunkSize > 0)
+  {
+    if (!fChunkValues.empty())
+      ReducePrecisionArray(&fChunkValues[0], fChunkHasSumw2 ? &fChunkSumw2[0] : (TemplateType*) 0, (Long64_t) fChunkValues.size(), relPrecision);
+    return;
+  }
+
+  for (Int_t i=0; i<fNSteps; i++)
+    if (fValues[i])
+      ReducePrecisionArray(fValues[i]->GetArray(), fSumw2[i] ? fSumw2[i]->GetArray() : (TemplateType*) 0, fNBins, relPrecision);
+}
+
 template <class TemplateArray, typename TemplateType>
 void AliTHnT<TemplateArray, TemplateType>::ReduceAxis()
 {
@@ -461,6 +775,12 @@ void AliTHnT<TemplateArray, TemplateType>::ReduceAxis()
   
   for (Int_t i=0; i<fNSteps; i++)
   {
+    if (fChunkSize > 0)
+    {
+      ReduceAxisChunked(i);
+      continue;
+    }
+
     if (!fValues[i])
       continue;
       
@@ -531,5 +851,47 @@ void AliTHnT<TemplateArray, TemplateType>::ReduceAxis()
   }
 }
 
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::ReduceAxisChunked(Int_t step)
+{
+  // ReduceAxis for the chunked storage
+  // the last axis is the fastest running index, so the entries are moved to the first bin of their row
+
+  if (fChunkIndex.empty())
+    return;
+
+  const Long64_t nLast = GetAxis(fNVars-1, 0)->GetNbins();
+  const Long64_t nChunks = GetNChunks();
+  for (Long64_t c = 0; c<nChunks; c++)
+  {
+    // positions are used instead of pointers since allocating the target chunks can move the storage
+    const Int_t index = fChunkIndex[step * nChunks + c];
+    if (index < 0)
+      continue;
+
+    for (Int_t k = 0; k<fChunkSize; k++)
+    {
+      const Long64_t globalBin = c * fChunkSize + k;
+      if (globalBin % nLast == 0)
+        continue;
+
+      const Long64_t source = (Long64_t) index * fChunkSize + k;
+      if (fChunkValues[source] == 0 && !(fChunkHasSumw2 && fChunkSumw2[source] != 0))
+        continue;
+
+      const Long64_t target = GetChunkOffset(step, globalBin - globalBin % nLast, kTRUE);
+      fChunkValues[target] += fChunkValues[source];
+      fChunkValues[source] = 0;
+      if (fChunkHasSumw2)
+      {
+        fChunkSumw2[target] += fChunkSumw2[source];
+        fChunkSumw2[source] = 0;
+      }
+    }
+  }
+
+  AliInfo(Form("Step %d: reduced %lld bins to %lld entries", step, fNBins, fNBins / nLast));
+}
+
 template class AliTHnT<TArrayF, Float_t>;
 template class AliTHnT<TArrayD, Double_t>;
@@ -9,7 +9,11 @@
 // Use AliTHn instead of AliCFContainer and your memory consumption will be drastically reduced
 // As AliTHn derives from AliCFContainer, you can just replace your current AliCFContainer object by AliTHn
 // Once you have the merged output, call FillParent() and you can use AliCFContainer as usual
+// For containers with many dimensions which are only sparsely filled call SetChunkedStorage() before the first Fill
+// The storage of a step is only allocated when the step is filled for the first time
+// ReducePrecision() rounds the content to the statistical precision, which makes the output file (and merging) much cheaper
 
+#include <vector>
 #include "TObject.h"
 #include "TString.h"
 #include "AliCFContainer.h"
@@ -34,6 +38,7 @@ public:
 
   virtual void DeleteContainers() = 0;
   virtual void ReduceAxis() = 0;  
+  virtual void ReducePrecision(Double_t relPrecision) = 0;
   
   ClassDef(AliTHnBase, 1) // AliTHn base class
 };
@@ -51,11 +56,15 @@ class AliTHnT : public AliTHnBase
   virtual void FillParent();
   virtual void FillContainer(AliCFContainer* cont);
   
-  virtual TArray* GetValues(Int_t step) { return fValues[step]; }
-  virtual TArray* GetSumw2(Int_t step)  { return fSumw2[step]; }
+  virtual TArray* GetValues(Int_t step) { return fValues[step]; } // 0 in chunked storage
+  virtual TArray* GetSumw2(Int_t step)  { return fSumw2[step]; }  // 0 in chunked storage
   
   virtual void DeleteContainers();
   virtual void ReduceAxis();
+  virtual void ReducePrecision(Double_t relPrecision);
+
+  void SetChunkedStorage(Int_t chunkSize = 1024);
+  Int_t GetChunkSize() const { return fChunkSize; }
   
   AliTHnT(const AliTHnT &c);
   AliTHnT& operator=(const AliTHnT& corr);
@@ -65,20 +74,38 @@ class AliTHnT : public AliTHnBase
   
 protected:
   void Init();
+  void InitAxisCache(const Double_t* var);
+  void DeleteAxisCache();
+  Int_t FindBinCached(Int_t i, Double_t x) const;
   Long64_t GetGlobalBinIndex(const Int_t* binIdx);
+  Long64_t GetNChunks() const { return (fNBins + fChunkSize - 1) / fChunkSize; }
+  Long64_t GetChunkOffset(Int_t step, Long64_t bin, Bool_t create);
+  void EnableChunkSumw2();
+  void FillContainerChunked(AliCFContainer* cont, Int_t step);
+  void ReduceAxisChunked(Int_t step);
+  void MergeChunked(const AliTHnT* entry);
   
   Long64_t fNBins;   // number of total bins
   Int_t    fNVars;   // number of variables
   Int_t    fNSteps;  // number of selection steps
   TemplateArray **fValues;  //[fNSteps] data container
   TemplateArray **fSumw2;   //[fNSteps] data container
+
+  Int_t    fChunkSize;                     // number of bins per chunk in chunked storage (0: dense storage in fValues/fSumw2)
+  std::vector<Int_t> fChunkIndex;          // [fNSteps*nChunks] position of the chunks in fChunkValues (-1: not allocated)
+  std::vector<TemplateType> fChunkValues;  // chunked storage of the values
+  std::vector<TemplateType> fChunkSumw2;   // chunked storage of sumw2, same layout as fChunkValues
+  Bool_t   fChunkHasSumw2;                 // sumw2 is stored in chunked storage (first weight != 1)
   
   TAxis** axisCache; //! cache axis pointers (about 50% of the time in Fill is spent in GetAxis otherwise)
   Int_t* fNbinsCache; //! cache Nbins per axis
   Double_t* fLastVars; //! caching of last used bins (in many loops some vars are the same for a while)
   Int_t* fLastBins; //! caching of last used bins (in many loops some vars are the same for a while)
+  Bool_t* fAxisUniform; //! axes with fixed bin width, for which the bin is computed without TAxis::FindBin
+  Double_t* fAxisMin; //! lower edge of the axes with fixed bin width
+  Double_t* fAxisMax; //! upper edge of the axes with fixed bin width
   
-  ClassDef(AliTHnT, 5) // THn like container
+  ClassDef(AliTHnT, 6) // THn like container
 };
 
 typedef AliTHnT<TArrayF, Float_t> AliTHn;
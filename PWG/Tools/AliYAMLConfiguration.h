@@ -9,6 +9,7 @@
 #include <string>
 #include <vector>
 #include <ostream>
+#include <unordered_map>
 
 #include <TObject.h>
 #include <TString.h>
@@ -124,6 +125,16 @@
  * Given the limitations, YAML anchors are recommended for more advanced usage as they can
  * be much more sophisticated.
  *
+ * Notes on performance:
+ *
+ * The node which a property name resolves to (after overrides between the configurations,
+ * specializations and shared parameters are taken into account) is cached the first time the
+ * property is requested, so repeated requests (for example, at each run change or event) only
+ * perform a hashed lookup and the type conversion. The cache is cleared whenever the
+ * configurations are changed through this class. If the nodes are modified directly through
+ * GetConfiguration(), call ClearPropertyCache() afterwards. The configurations are streamed as
+ * strings (see Initialize()), so the files are not fetched again from AliEn on the workers.
+ *
  * @author Raymond Ehlers <raymond.ehlers@yale.edu>, Yale University
  * @date Sept 19, 2017
  */
@@ -220,6 +231,9 @@ class AliYAMLConfiguration : public TObject {
   std::pair<std::string, YAML::Node> & GetConfiguration(const std::string & name)             { return GetConfiguration(GetConfigurationIndexFromName(name, fConfigurations)); }
   /** @} */
 
+  /// Forget the resolved properties. Needed if the nodes are modified directly.
+  void ClearPropertyCache()                                                                   { fResolvedProperties.clear(); }
+
   /** @{
    * @name Translate between configuration name and index.
    */
@@ -311,12 +325,13 @@ class AliYAMLConfiguration : public TObject {
   template<typename T>
   bool GetPropertyFromNode(const YAML::Node & node, std::string propertyName, T & property) const;
   template<typename T>
-  bool GetProperty(YAML::Node & node, YAML::Node & sharedParametersNode, const std::string & configurationName, std::string propertyName, T & property) const;
+  bool GetProperty(YAML::Node & node, YAML::Node & sharedParametersNode, const std::string & configurationName, std::string propertyName, T & property, YAML::Node & resolvedNode) const;
 
   template<typename T>
   void WriteValue(YAML::Node & node, std::string propertyName, T & proeprty);
 
   std::vector<std::pair<std::string, YAML::Node> > fConfigurations;         //!<! Contains all YAML configurations. The first element has the highest precedence.
+  mutable std::unordered_map<std::string, std::pair<bool, YAML::Node> > fResolvedProperties; //!<! Resolved node (and whether it was found) for each requested property.
   #endif
   std::vector<std::pair<std::string, std::string> > fConfigurationsStrings; ///<  Contains all YAML configurations as strings so that they can be streamed.
 
@@ -488,24 +503,43 @@ bool AliYAMLConfiguration::GetProperty(std::string propertyName, T & property, c
     propertyName.erase(prefixStringLocation, prefixStringLocation + fPrefixString.length());
   }
 
+  // Shared parameters are only resolved for simple types, so the resolved node depends on the kind of type.
+  const bool simpleType = std::is_arithmetic<T>::value || std::is_same<T, std::string>::value || std::is_same<T, bool>::value;
+  const std::string cacheKey = (simpleType ? "s" : "c") + propertyName;
+
   bool setProperty = false;
-  // Search in reverse so it is possible to override configuration values.
-  for (auto configPair : reverse(fConfigurations))
+  auto cached = fResolvedProperties.find(cacheKey);
+  if (cached != fResolvedProperties.end())
   {
-    if (setProperty == true) {
-      AliDebugGeneralStream("AliYAMLConfiguration", 2) << "Property \"" << propertyName << "\" found!\n";
-      break;
+    AliDebugGeneralStream("AliYAMLConfiguration", 2) << "Property \"" << propertyName << "\" taken from the cache.\n";
+    if (cached->second.first == true) {
+      property = cached->second.second.as<T>();
+      setProperty = true;
     }
-
-    // IsNull checks is a node is empty. A node is empty if it is created.
-    // IsDefined checks if the node that was requested was not actually created.
-    if (configPair.second.IsNull() != true)
+  }
+  else
+  {
+    YAML::Node resolvedNode;
+    // Search in reverse so it is possible to override configuration values.
+    for (const auto & configPair : reverse(fConfigurations))
     {
-      AliDebugGeneralStream("AliYAMLConfiguration", 2) << "Looking for parameter \"" << propertyName << "\" in \"" << configPair.first << "\" configuration\n";
-      // NOTE: This may not exist, but that is entirely fine.
-      YAML::Node sharedParameters = configPair.second["sharedParameters"];
-      setProperty = GetProperty(configPair.second, sharedParameters, configPair.first, propertyName, property);
+      if (setProperty == true) {
+        AliDebugGeneralStream("AliYAMLConfiguration", 2) << "Property \"" << propertyName << "\" found!\n";
+        break;
+      }
+
+      // IsNull checks is a node is empty. A node is empty if it is created.
+      // IsDefined checks if the node that was requested was not actually created.
+      if (configPair.second.IsNull() != true)
+      {
+        AliDebugGeneralStream("AliYAMLConfiguration", 2) << "Looking for parameter \"" << propertyName << "\" in \"" << configPair.first << "\" configuration\n";
+        // NOTE: This may not exist, but that is entirely fine.
+        YAML::Node configNode = configPair.second;
+        YAML::Node sharedParameters = configNode["sharedParameters"];
+        setProperty = GetProperty(configNode, sharedParameters, configPair.first, propertyName, property, resolvedNode);
+      }
     }
+    fResolvedProperties.emplace(cacheKey, std::make_pair(setProperty, resolvedNode));
   }
 
   if (setProperty != true && requiredProperty == true)
@@ -539,11 +573,12 @@ bool AliYAMLConfiguration::GetProperty(std::string propertyName, T & property, c
  * @param[in] configurationName Name of the configuration type.
  * @param[in] propertyName Name of the property to retrieve
  * @param[out] property Contains the retrieved property
+ * @param[out] resolvedNode Node from which the property was retrieved
  *
  * @return True if the property was set successfully
  */
 template<typename T>
-bool AliYAMLConfiguration::GetProperty(YAML::Node & node, YAML::Node & sharedParametersNode, const std::string & configurationName, std::string propertyName, T & property) const
+bool AliYAMLConfiguration::GetProperty(YAML::Node & node, YAML::Node & sharedParametersNode, const std::string & configurationName, std::string propertyName, T & property, YAML::Node & resolvedNode) const
 {
   // Used as a buffer for printing complicated messages
   std::stringstream tempMessage;
@@ -565,7 +600,7 @@ bool AliYAMLConfiguration::GetProperty(YAML::Node & node, YAML::Node & sharedPar
       // Retrieve node and then recurse
       YAML::Node tempNode = node[nodeName];
       AliDebugGeneralStream("AliYAMLConfiguration", 2) << "Attempting to retrieving property \"" << tempPropertyName << "\" by going a node deeper with node \"" << nodeName << "\".\n";
-      returnValue = GetProperty(tempNode, sharedParametersNode, configurationName, tempPropertyName, property);
+      returnValue = GetProperty(tempNode, sharedParametersNode, configurationName, tempPropertyName, property, resolvedNode);
     }
 
     // Check for the specialization if the nodeName is undefined.
@@ -579,7 +614,7 @@ bool AliYAMLConfiguration::GetProperty(YAML::Node & node, YAML::Node & sharedPar
         std::string specializationNodeName = nodeName.substr(0, delimiterPosition);
         YAML::Node tempNode = node[specializationNodeName];
         AliDebugGeneralStream("AliYAMLConfiguration", 2) << "Attempting to retrieving property \"" << tempPropertyName << "\" by going a node deeper through dropping the specializtion and using node \"" << specializationNodeName << "\".\n";
-        returnValue = GetProperty(tempNode, sharedParametersNode, configurationName, tempPropertyName, property);
+        returnValue = GetProperty(tempNode, sharedParametersNode, configurationName, tempPropertyName, property, resolvedNode);
       }
       else {
         returnValue = false;
@@ -619,9 +654,15 @@ bool AliYAMLConfiguration::GetProperty(YAML::Node & node, YAML::Node & sharedPar
       if (isShared == true) {
         // Retrieve from the shared parameter node directly.
         retrievalResult = GetPropertyFromNode(sharedParametersNode, sharedValueName, property);
+        if (retrievalResult == true) {
+          resolvedNode = sharedParametersNode[sharedValueName];
+        }
       }
       else {
         retrievalResult = GetPropertyFromNode(node, propertyName, property);
+        if (retrievalResult == true) {
+          resolvedNode = node[propertyName];
+        }
       }
 
       // Inform about the result
@@ -667,6 +708,8 @@ bool AliYAMLConfiguration::WriteProperty(std::string propertyName, T & property,
   std::pair<std::string, YAML::Node> & configPair = fConfigurations.at(configurationIndex);
 
   WriteValue(configPair.second, propertyName, property);
+  // The written value may override or create previously resolved properties.
+  ClearPropertyCache();
   AliDebugGeneralStream("AliYAMLConfiguration", 2) << "Final Node:\n" << configPair.second << "\n";
 
   return true;
@@ -29,7 +29,12 @@
 #pragma link C++ class AliJSONBool+;
 #pragma link C++ class AliJSONString+;
 #pragma link C++ class AliAnalysisTaskDummy+;
+#pragma link C++ class AliAnalysisTaskMCParticleClassification+;
+#pragma link C++ class AliMCParticleClassification+;
 #pragma link C++ class AliTLorentzVector+;
+#pragma link C++ class AliHistogrammingBackend+;
+#pragma link C++ class AliHistogrammingBenchmark+;
+#pragma link C++ class AliInputTreeCache+;
 #if ROOT_VERSION_CODE > ROOT_VERSION(6,4,0)
 #pragma link C++ class AliMCSpectraWeights+;
 #pragma link C++ class AliMCSpectraWeightsHandler+;
@@ -52,4 +57,5 @@
 #pragma link C++ function TestTHistManager::TestRunBuildGrouped();
 #pragma link C++ function TestTHistManager::TestRunFillSimple();
 #pragma link C++ function TestTHistManager::TestRunFillGrouped();
+#pragma link C++ function TestTHistManager::TestRunFillHandles();
 #endif
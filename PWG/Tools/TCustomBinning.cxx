@@ -12,9 +12,7 @@
  * about the suitability of this software for any purpose. It is          *
  * provided "as is" without express or implied warranty.                  *
  **************************************************************************/
-#include <algorithm>
 #include <cfloat>
-#include <functional>
 #include <vector>
 
 #include <TArrayD.h>
@@ -39,33 +37,73 @@ void TCustomBinning::AddStep(double maximum, double binwidth){
   fSteps.insert(std::pair<double, double>(maximum, binwidth));
 }
 
-void TCustomBinning::CreateBinEdges(TArrayD &binedges) const {
+std::vector<TCustomBinning::BinLookup::Segment> TCustomBinning::CreateSegments() const {
   if(!fMinimumSet){
     throw MinNotSetException();
   }
 
-  // sort the ranges
-  std::vector<double> keys;
-  for(auto it : fSteps) keys.push_back(it.first);
-  std::sort(keys.begin(), keys.end(), std::less<double>());
-  std::map<double, double> sortedsteps;
-  for(auto it : keys)
-    sortedsteps.insert(std::pair<double, double>(it, fSteps.find(it)->second));
-
-
-  std::vector<double> tmpedges;
+  // the map is sorted by the upper edge of the ranges. Edges are calculated as
+  // lower edge + i * binwidth within a range in order to avoid accumulating rounding errors
+  std::vector<BinLookup::Segment> segments;
   Double_t currentmin = fMinimum;
-  tmpedges.push_back(currentmin);
-  for(auto range : sortedsteps){
-    while((currentmin < range.first) && (TMath::Abs(currentmin - range.first) > DBL_EPSILON)){
-      currentmin += range.second;
-      tmpedges.push_back(currentmin);
+  Int_t firstbin = 1;
+  for(auto range : fSteps){
+    Int_t nbins = 0;
+    Double_t edge = currentmin;
+    while((edge < range.first) && (TMath::Abs(edge - range.first) > DBL_EPSILON)){
+      nbins++;
+      edge = currentmin + nbins * range.second;
     }
+    if(!nbins) continue;
+    BinLookup::Segment segment;
+    segment.fLow = currentmin;
+    segment.fHigh = edge;
+    segment.fWidth = range.second;
+    segment.fNBins = nbins;
+    segment.fFirstBin = firstbin;
+    segments.push_back(segment);
+    firstbin += nbins;
+    currentmin = edge;
   }
+  return segments;
+}
 
-  binedges.Set(tmpedges.size());
-  int bincounter = 0;
-  for(auto binedge : tmpedges) binedges[bincounter++] = binedge;
+void TCustomBinning::CreateBinEdges(TArrayD &binedges) const {
+  std::vector<BinLookup::Segment> segments = CreateSegments();
+  Int_t nbins = 0;
+  for(const auto &segment : segments) nbins += segment.fNBins;
+
+  binedges.Set(nbins + 1);
+  binedges[0] = fMinimum;
+  int bincounter = 1;
+  for(const auto &segment : segments){
+    for(Int_t ibin = 1; ibin <= segment.fNBins; ibin++) binedges[bincounter++] = segment.fLow + ibin * segment.fWidth;
+  }
+}
+
+TCustomBinning::BinLookup TCustomBinning::CreateBinLookup() const {
+  return BinLookup(CreateSegments());
+}
+
+TCustomBinning::BinLookup::BinLookup(const std::vector<Segment> &segments):
+  fSegments(segments),
+  fNBins(0)
+{
+  for(const auto &segment : fSegments) fNBins += segment.fNBins;
+}
+
+Int_t TCustomBinning::BinLookup::FindBin(Double_t x) const {
+  if(!fNBins || !(x >= fSegments.front().fLow)) return 0;
+  for(const auto &segment : fSegments){
+    if(x >= segment.fHigh) continue;
+    Int_t ibin = static_cast<Int_t>((x - segment.fLow) / segment.fWidth);
+    if(ibin >= segment.fNBins) ibin = segment.fNBins - 1;
+    // correct for rounding on the bin edges, which are defined as fLow + i * fWidth
+    if(ibin > 0 && x < segment.fLow + ibin * segment.fWidth) ibin--;
+    else if(ibin < segment.fNBins - 1 && x >= segment.fLow + (ibin + 1) * segment.fWidth) ibin++;
+    return segment.fFirstBin + ibin;
+  }
+  return fNBins + 1;
 }
 
 TBinning *TCustomBinning::MakeCopy() const {
@@ -9,6 +9,7 @@ class TArrayD;
 #include <TBinning.h>
 #include <exception>
 #include <map>
+#include <vector>
 
 /**
  * @class TCustomBinning
@@ -48,6 +49,15 @@ class TArrayD;
  *
  * @note In case the binning is used together with the THistManager the last step is done by the
  * THistManager and does not need to be performed by the user.
+ *
+ * The piecewise uniform structure is kept in a BinLookup, which finds the bin of a value
+ * by a division within the step instead of the binary search of TAxis::FindBin. Histograms
+ * created by the THistManager from a custom binning use it in the Fill functions taking a handle.
+ *
+ * ~~~{.cxx}
+ * TCustomBinning::BinLookup lookup = mybinning.CreateBinLookup();
+ * int bin = lookup.FindBin(5.5);    // same bin as TAxis::FindBin
+ * ~~~
  */
 class TCustomBinning : public TBinning {
 public:
@@ -82,6 +92,69 @@ public:
     virtual const char *what() const throw() { return "Minimum of the binning not set"; }
   };
 
+  /**
+   * @class BinLookup
+   * @brief Bin index lookup of a piecewise uniform binning
+   * @ingroup Histmanager
+   *
+   * The bin is found from the step containing the value by a division by the bin width,
+   * constant time in the number of bins. Bin numbers follow the TAxis convention
+   * (0: underflow, nbins+1: overflow) and are identical to TAxis::FindBin on an axis
+   * built from the bin edges of the same binning, including values on the bin edges.
+   */
+  class BinLookup {
+  public:
+    /**
+     * Range of bins with common bin width
+     */
+    struct Segment {
+      Double_t fLow;          ///< Lower edge of the step
+      Double_t fHigh;         ///< Upper edge of the step (upper edge of the last bin)
+      Double_t fWidth;        ///< Bin width
+      Int_t    fNBins;        ///< Number of bins in the step
+      Int_t    fFirstBin;     ///< Bin number (TAxis convention) of the first bin in the step
+    };
+
+    /**
+     * Constructor, creating an empty (invalid) lookup
+     */
+    BinLookup(): fSegments(), fNBins(0) {}
+
+    /**
+     * Constructor
+     * @param[in] segments Steps of the binning in increasing order
+     */
+    BinLookup(const std::vector<Segment> &segments);
+
+    /**
+     * Destructor
+     */
+    ~BinLookup() {}
+
+    /**
+     * Find the bin of a value
+     * @param[in] x Value
+     * @return Bin number (0: underflow, nbins+1: overflow)
+     */
+    Int_t FindBin(Double_t x) const;
+
+    /**
+     * Get the number of bins
+     * @return Number of bins
+     */
+    Int_t GetNbins() const { return fNBins; }
+
+    /**
+     * Check whether the lookup contains bins
+     * @return True if at least one bin is defined
+     */
+    Bool_t IsValid() const { return fNBins > 0; }
+
+  private:
+    std::vector<Segment>          fSegments;          ///< Steps in increasing order
+    Int_t                         fNBins;             ///< Total number of bins
+  };
+
   /**
    * Constructor
    */
@@ -122,7 +195,17 @@ public:
    */
   virtual void CreateBinEdges(TArrayD &edges) const;
 
+  /**
+   * Create the bin lookup from the minimum and the ranges. The bins
+   * are identical to the ones created by CreateBinEdges.
+   * @return Lookup of the bin index
+   * @throw MinNotSetException in case the minimum is not defined
+   */
+  BinLookup CreateBinLookup() const;
+
 private:
+  std::vector<BinLookup::Segment> CreateSegments() const;
+
   Double_t                        fMinimum;           ///< Minimum of the binning
   Bool_t                          fMinimumSet;        ///< Define whether minimum is set. Attention: Bin edges will not be created without minimum
   std::map<double, double>        fSteps;             ///< List of ranges with common bin width
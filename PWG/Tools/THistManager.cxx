@@ -33,6 +33,7 @@
 #include <TString.h>
 
 #include "TBinning.h"
+#include "TCustomBinning.h"
 #include "THistManager.h"
 
 /// \cond CLASSIMP
@@ -42,14 +43,16 @@ ClassImp(THistManager)
 THistManager::THistManager():
 		TNamed(),
 		fHistos(NULL),
-		fIsOwner(true)
+		fIsOwner(true),
+		fBinLookups()
 {
 }
 
 THistManager::THistManager(const char *name):
 		TNamed(name, Form("Histogram container %s", name)),
 		fHistos(NULL),
-		fIsOwner(true)
+		fIsOwner(true),
+		fBinLookups()
 {
 	fHistos = new THashList();
 	fHistos->SetName(Form("histos%s", name));
@@ -135,7 +138,9 @@ TH1* THistManager::CreateTH1(const char *name, const char *title, const TBinning
   } catch(std::exception &e){
     Fatal("THistManager::CreateTH1", "Exception raised: %s", e.what());
   }
-  return CreateTH1(name, title, myxbins, opt);
+  TH1 *h = CreateTH1(name, title, myxbins, opt);
+  RegisterBinLookups(h, xbin);
+  return h;
 }
 
 TH2* THistManager::CreateTH2(const char *name, const char *title, int nbinsx, double xmin, double xmax, int nbinsy, double ymin, double ymax, Option_t *opt){
@@ -202,7 +207,9 @@ TH2* THistManager::CreateTH2(const char *name, const char *title, const TBinning
     Fatal("THistManager::CreateTH2 (y-dir)", "Exception raised: %s", e.what());
   }
 
-  return CreateTH2(name, title, myxbins, myybins, opt);
+  TH2 *h = CreateTH2(name, title, myxbins, myybins, opt);
+  RegisterBinLookups(h, xbins, &ybins);
+  return h;
 }
 
 TH3* THistManager::CreateTH3(const char* name, const char* title, int nbinsx, double xmin, double xmax, int nbinsy, double ymin, double ymax, int nbinsz, double zmin, double zmax, Option_t *opt) {
@@ -274,7 +281,9 @@ TH3* THistManager::CreateTH3(const char *name, const char *title, const TBinning
     Fatal("THistManager::CreateTH2 (z-dir)", "Exception raised: %s", e.what());
   }
 
-  return CreateTH3(name, title, myxbins, myybins, myzbins);
+  TH3 *h = CreateTH3(name, title, myxbins, myybins, myzbins);
+  RegisterBinLookups(h, xbins, &ybins, &zbins);
+  return h;
 }
 
 THnSparse* THistManager::CreateTHnSparse(const char *name, const char *title, int ndim, const int *nbins, const double *min, const double *max, Option_t *opt) {
@@ -625,6 +634,66 @@ void THistManager::FillProfile(const char* name, double x, double y, double weig
   hist->Fill(x, y, weight);
 }
 
+namespace {
+
+/**
+ * Fill a bin found via the bin lookup. Follows TH1::Fill for the bin content,
+ * sum of weights squared and entries. The sums for the statistics are not
+ * updated, they are calculated from the bin contents instead.
+ */
+void FillBinFast(TH1 *hist, Int_t bin, double weight){
+  if(!hist->GetSumw2N() && weight != 1. && !hist->TestBit(TH1::kIsNotW)) hist->Sumw2();
+  hist->AddBinContent(bin, weight);
+  if(hist->GetSumw2N()) hist->GetSumw2()->fArray[bin] += weight * weight;
+  hist->SetEntries(hist->GetEntries() + 1);
+}
+
+Int_t FindBinFast(const TCustomBinning::BinLookup &lookup, const TAxis *axis, double x){
+  return lookup.IsValid() ? lookup.FindBin(x) : axis->FindFixBin(x);
+}
+
+}
+
+void THistManager::Fill(const Handle<TH1> &hist, double x, double weight){
+  const TCustomBinning::BinLookup *lookups = hist.GetBinLookups();
+  if(!lookups){
+    hist->Fill(x, weight);
+    return;
+  }
+  FillBinFast(hist.Get(), lookups[0].FindBin(x), weight);
+}
+
+void THistManager::Fill(const Handle<TH1> &hist, const char *label, double weight){
+  hist->Fill(label, weight);
+}
+
+void THistManager::Fill(const Handle<TH2> &hist, double x, double y, double weight){
+  const TCustomBinning::BinLookup *lookups = hist.GetBinLookups();
+  if(!lookups){
+    hist->Fill(x, y, weight);
+    return;
+  }
+  FillBinFast(hist.Get(), hist->GetBin(FindBinFast(lookups[0], hist->GetXaxis(), x), FindBinFast(lookups[1], hist->GetYaxis(), y)), weight);
+}
+
+void THistManager::Fill(const Handle<TH3> &hist, double x, double y, double z, double weight){
+  const TCustomBinning::BinLookup *lookups = hist.GetBinLookups();
+  if(!lookups){
+    hist->Fill(x, y, z, weight);
+    return;
+  }
+  FillBinFast(hist.Get(), hist->GetBin(FindBinFast(lookups[0], hist->GetXaxis(), x), FindBinFast(lookups[1], hist->GetYaxis(), y),
+                                       FindBinFast(lookups[2], hist->GetZaxis(), z)), weight);
+}
+
+void THistManager::Fill(const Handle<THnSparse> &hist, const double *x, double weight){
+  hist->Fill(x, weight);
+}
+
+void THistManager::Fill(const Handle<TProfile> &hist, double x, double y, double weight){
+  hist->Fill(x, y, weight);
+}
+
 TObject *THistManager::FindObject(const char *name) const {
 	TString dirname(basename(name)), hname(histname(name));
 	THashList *parent(FindGroup(dirname));
@@ -659,6 +728,25 @@ TString THistManager::histname(const TString &path) const {
 	return TString(path(index+1, path.Length() - (index+1)));
 }
 
+void THistManager::RegisterBinLookups(const TObject *hist, const TBinning &xbins, const TBinning *ybins, const TBinning *zbins){
+  const TBinning *binnings[3] = {&xbins, ybins, zbins};
+  std::vector<TCustomBinning::BinLookup> lookups(3);
+  bool hasLookup = false;
+  for(int iaxis = 0; iaxis < 3; iaxis++){
+    const TCustomBinning *custombinning = dynamic_cast<const TCustomBinning *>(binnings[iaxis]);
+    if(!custombinning) continue;
+    lookups[iaxis] = custombinning->CreateBinLookup();
+    hasLookup = hasLookup || lookups[iaxis].IsValid();
+  }
+  if(hasLookup) fBinLookups[hist] = lookups;
+}
+
+const TCustomBinning::BinLookup *THistManager::GetBinLookups(const TObject *hist) const {
+  std::map<const TObject *, std::vector<TCustomBinning::BinLookup> >::const_iterator found = fBinLookups.find(hist);
+  if(found == fBinLookups.end()) return nullptr;
+  return found->second.data();
+}
+
 //////////////////////////////////////////////////////////
 ///                                                    ///
 /// Implementation of THistManager::iterator           ///
@@ -1030,6 +1118,41 @@ namespace TestTHistManager {
     return success ? 0 : 1;
   }
 
+  int THistManagerTestSuite::TestFillHandles(){
+    THistManager testmgr("testmgr");
+    testmgr.CreateTH1("Test1D", "Test Histogram 1D", 1, 0., 1.);
+    testmgr.CreateTH2("Group1/Test2D", "Test Histogram 2D in group 1", 1, 0., 1., 1, 0., 1.);
+    testmgr.CreateTProfile("Group2/Subgroup1/TestProfile", "Test TProfile in subgroup", 1, 0., 1.);
+
+    THistManager::Handle<TH1> h1 = testmgr.GetHandle<TH1>("Test1D");
+    THistManager::Handle<TH2> h2 = testmgr.GetHandle<TH2>("Group1/Test2D");
+    THistManager::Handle<TProfile> hprof = testmgr.GetHandle<TProfile>("Group2/Subgroup1/TestProfile");
+    if(!(h1.IsValid() && h2.IsValid() && hprof.IsValid())){
+      std::cout << "Invalid handle" << std::endl;
+      return 1;
+    }
+    for(int i = 0; i < 100; i++){
+      testmgr.Fill(h1, 0.5);
+      testmgr.Fill(h2, 0.5, 0.5);
+      testmgr.Fill(hprof, 0.5, 1.);
+    }
+
+    bool success(true);
+    if(TMath::Abs(h1->GetBinContent(1) - 100) > DBL_EPSILON){
+      std::cout << "Test1D: Value mismatch: expected 100, found " << h1->GetBinContent(1) << std::endl;
+      success = false;
+    }
+    if(TMath::Abs(h2->GetBinContent(1,1) - 100) > DBL_EPSILON){
+      std::cout << "Group1/Test2D: Value mismatch: expected 100, found " << h2->GetBinContent(1,1) << std::endl;
+      success = false;
+    }
+    if(TMath::Abs(hprof->GetBinContent(1) - 1) > DBL_EPSILON){
+      std::cout << "Group2/Subgroup1/TestProfile: Value mismatch: expected 1, found " << hprof->GetBinContent(1) << std::endl;
+      success = false;
+    }
+    return success ? 0 : 1;
+  }
+
   int TestRunAll(){
     int testresult(0);
     THistManagerTestSuite testsuite;
@@ -1050,6 +1173,10 @@ namespace TestTHistManager {
     testresult += testsuite.TestFillGroupedHistograms();
     std::cout << "Result after test: " << testresult << std::endl;
 
+    std::cout << "Running test: Fill Handles" << std::endl;
+    testresult += testsuite.TestFillHandles();
+    std::cout << "Result after test: " << testresult << std::endl;
+
     return testresult;
   }
 
@@ -1072,4 +1199,9 @@ namespace TestTHistManager {
     THistManagerTestSuite testsuite;
     return testsuite.TestFillGroupedHistograms();
   }
+
+  int TestRunFillHandles(){
+    THistManagerTestSuite testsuite;
+    return testsuite.TestFillHandles();
+  }
 }
@@ -7,6 +7,8 @@
 #include <TIterator.h>
 #include <TNamed.h>
 #include <iterator>
+#include <map>
+#include "TCustomBinning.h"
 
 class TArrayD;
 class TAxis;
@@ -229,6 +231,40 @@ public:
     iterator();
   };
 
+  /**
+   * @class Handle
+   * @brief Typed reference to a histogram inside the histogram manager
+   * @ingroup Histmanager
+   *
+   * Handles are obtained once via GetHandle, for example in UserCreateOutputObjects,
+   * and then used in the Fill methods taking a handle. Filling via handle avoids the
+   * lookup of the histogram by name for every entry. The histogram type is part of
+   * the handle type, so the coordinates passed to Fill are checked by the compiler.
+   *
+   * For histograms created from a TCustomBinning the handle carries the bin lookup
+   * of the piecewise uniform axes, which replaces the binary search of TAxis::FindBin.
+   */
+  template<typename H>
+  class Handle {
+  public:
+    Handle(): fHist(nullptr), fLookups(nullptr) {}
+    explicit Handle(H *hist, const TCustomBinning::BinLookup *lookups = nullptr): fHist(hist), fLookups(lookups) {}
+
+    H *Get() const { return fHist; }
+    H *operator->() const { return fHist; }
+    bool IsValid() const { return fHist != nullptr; }
+
+    /**
+     * @brief Get the bin lookups of the histogram axes
+     * @return Array of lookups for x, y and z (nullptr if no axis has a custom binning)
+     */
+    const TCustomBinning::BinLookup *GetBinLookups() const { return fLookups; }
+
+  private:
+    H                                *fHist;          ///< Histogram connected to the handle (not owned)
+    const TCustomBinning::BinLookup  *fLookups;       ///< Bin lookups for x, y and z (owned by the histogram manager)
+  };
+
   /**
    * @brief Default constructor.
    *
@@ -634,6 +670,80 @@ public:
 	 */
   void FillProfile(const char *name, double x, double y, double weight = 1.);
 
+  /**
+   * @brief Get a typed handle to a histogram within the container.
+   *
+   * The histogram name also contains the parent group(s)
+   * according to the common group notation. Fails in case the
+   * histogram does not exist or is not of the requested type.
+   * @param[in] name Name of the histogram
+   * @return Handle to the histogram
+   */
+  template<typename H>
+  Handle<H> GetHandle(const char *name) const {
+    H *hist = dynamic_cast<H *>(FindObject(name));
+    if(!hist) Fatal("THistManager::GetHandle", "Histogram %s not found or not of the requested type", name);
+    return Handle<H>(hist, GetBinLookups(hist));
+  }
+
+  /**
+   * @brief Fill a 1D histogram via its handle.
+   *
+   * No name lookup is performed. The bin width options of
+   * the name-based Fill methods are not supported. For histograms
+   * with custom binning the bin is found via the bin lookup; as for
+   * histograms filled via SetBinContent the statistics (mean, RMS)
+   * are then calculated from the bin contents.
+   * @param[in] hist Handle of the histogram
+   * @param[in] x x-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void Fill(const Handle<TH1> &hist, double x, double weight = 1.);
+
+  /**
+   * @brief Fill a 1D histogram via its handle, using a bin label.
+   * @param[in] hist Handle of the histogram
+   * @param[in] label Label of the bin to fill
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void Fill(const Handle<TH1> &hist, const char *label, double weight = 1.);
+
+  /**
+   * @brief Fill a 2D histogram via its handle.
+   * @param[in] hist Handle of the histogram
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void Fill(const Handle<TH2> &hist, double x, double y, double weight = 1.);
+
+  /**
+   * @brief Fill a 3D histogram via its handle.
+   * @param[in] hist Handle of the histogram
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] z z-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void Fill(const Handle<TH3> &hist, double x, double y, double z, double weight = 1.);
+
+  /**
+   * @brief Fill a nD histogram via its handle.
+   * @param[in] hist Handle of the histogram
+   * @param[in] x coordinates of the data
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void Fill(const Handle<THnSparse> &hist, const double *x, double weight = 1.);
+
+  /**
+   * @brief Fill a profile histogram via its handle.
+   * @param[in] hist Handle of the profile histogram
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void Fill(const Handle<TProfile> &hist, double x, double y, double weight = 1.);
+
   /**
    * @brief Create forward iterator starting at the beginning of the
    * container
@@ -719,8 +829,25 @@ private:
 	 */
 	TString histname(const TString &path) const;
 
+	/**
+	 * @brief Store the bin lookups of the axes with custom binning
+	 * @param[in] hist Histogram created from the binnings
+	 * @param[in] xbins Binning in x-direction
+	 * @param[in] ybins Binning in y-direction (optional)
+	 * @param[in] zbins Binning in z-direction (optional)
+	 */
+	void RegisterBinLookups(const TObject *hist, const TBinning &xbins, const TBinning *ybins = nullptr, const TBinning *zbins = nullptr);
+
+	/**
+	 * @brief Get the bin lookups of a histogram
+	 * @param[in] hist Histogram
+	 * @return Array of bin lookups for x, y and z (nullptr if no axis has a custom binning)
+	 */
+	const TCustomBinning::BinLookup *GetBinLookups(const TObject *hist) const;
+
 	THashList *fHistos;                   ///< List of histograms
 	bool fIsOwner;                        ///< Set the ownership
+	std::map<const TObject *, std::vector<TCustomBinning::BinLookup> > fBinLookups;    //!<! Bin lookups of the histograms with custom binning (x, y, z)
 
   /// \cond CLASSIMP
 	ClassDef(THistManager, 1);  // Container for histograms
@@ -845,6 +972,20 @@ public:
    * @return 0 if test is passed, 1 if it failed
    */
   int TestFillGroupedHistograms();
+
+  /**
+   * Purpose of the test: Check whether histograms are filled correctly via handles
+   * Relies on: TestFillSimpleHistograms, TestFillGroupedHistograms
+   *
+   * Get handles for a TH1 at the top level, a TH2 in a group and a
+   * TProfile in a subgroup, and fill each 100 times with the same value.
+   *
+   * Test passed:
+   * - All handles are valid
+   * - All histograms have the expected value (100 for histograms, 1 for profile)
+   * @return 0 if test is passed, 1 if it failed
+   */
+  int TestFillHandles();
 };
 
 /**
@@ -882,5 +1023,12 @@ int TestRunFillSimple();
  */
 int TestRunFillGrouped();
 
+/**
+ * Run the test for filling histograms via handles. See @ref THistManagerTestSuite
+ * for details.
+ * @return 0 if test is passed, 1 if failed
+ */
+int TestRunFillHandles();
+
 }
 #endif
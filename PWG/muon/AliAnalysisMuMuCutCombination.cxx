@@ -28,7 +28,8 @@ AliAnalysisMuMuCutCombination::AliAnalysisMuMuCutCombination()
 : TObject(), fCuts(0x0), fName(""),
 fIsEventCutter(kFALSE), fIsEventHandlerCutter(kFALSE),
 fIsTrackCutter(kFALSE), fIsTrackPairCutter(kFALSE),
-fIsTriggerClassCutter(kFALSE)
+fIsTriggerClassCutter(kFALSE),
+fTrackCutMask(0), fTrackPairCutMask(0), fHasCutMasks(kFALSE)
 {
   /// Default ctor.
 }
@@ -63,6 +64,7 @@ void AliAnalysisMuMuCutCombination::Add(AliAnalysisMuMuCutElement* ce)
   if (!fCuts->FindObject(ce))
   {
     fCuts->Add(ce);
+    fHasCutMasks = kFALSE;
     fName += ce->GetName();
 
     fIsEventCutter = fIsEventCutter || ce->IsEventCutter();
@@ -276,6 +278,18 @@ Bool_t AliAnalysisMuMuCutCombination::Pass(const AliVParticle& p1, const AliVPar
   return kTRUE;
 }
 
+//_____________________________________________________________________________
+void AliAnalysisMuMuCutCombination::SetCutMasks(ULong64_t trackCutMask, ULong64_t trackPairCutMask, Bool_t complete)
+{
+  /// Set the bits of our elements in the masks of the registry (see AliAnalysisMuMuCutRegistry::GetTrackCutMask).
+  /// If not complete (i.e. some of our elements have no bit) the cut Pass methods taking a mask
+  /// evaluate the elements directly
+
+  fTrackCutMask = trackCutMask;
+  fTrackPairCutMask = trackPairCutMask;
+  fHasCutMasks = complete;
+}
+
 //_____________________________________________________________________________
 Bool_t AliAnalysisMuMuCutCombination::Pass(const TString& firedTriggerClasses,
                                            TString& acceptedTriggerClasses,
@@ -32,6 +32,18 @@ public:
 
   Bool_t Pass(const AliVParticle& p1, const AliVParticle& p2) const;
 
+  /// Same as Pass(particle), using the track cut results of AliAnalysisMuMuCutRegistry::GetTrackCutMask
+  Bool_t Pass(const AliVParticle& particle, ULong64_t trackCutMask) const
+  { return fHasCutMasks ? ( (trackCutMask & fTrackCutMask) == fTrackCutMask ) : Pass(particle); }
+
+  /// Same as Pass(p1,p2), using the track pair cut results of AliAnalysisMuMuCutRegistry::GetTrackPairCutMask
+  Bool_t Pass(const AliVParticle& p1, const AliVParticle& p2, ULong64_t trackPairCutMask) const
+  { return fHasCutMasks ? ( (trackPairCutMask & fTrackPairCutMask) == fTrackPairCutMask ) : Pass(p1,p2); }
+
+  void SetCutMasks(ULong64_t trackCutMask, ULong64_t trackPairCutMask, Bool_t complete);
+
+  const TObjArray* GetCutElements() const { return fCuts; }
+
   Bool_t Pass(const TString& firedTriggerClasses, TString& acceptedTriggerClasses,
               UInt_t L0, UInt_t L1, UInt_t L2) const;
 
@@ -63,8 +75,11 @@ private:
   Bool_t fIsTrackCutter; // whether or not the combination cuts on track
   Bool_t fIsTrackPairCutter; // whether or not the combination cuts on track pairs
   Bool_t fIsTriggerClassCutter; // whether or not the combination cuts on trigger class
+  ULong64_t fTrackCutMask; //! bits of our track cut elements in the registry mask
+  ULong64_t fTrackPairCutMask; //! bits of our track pair cut elements in the registry mask
+  Bool_t fHasCutMasks; //! whether all our track and track pair cut elements have a bit
 
-  ClassDef(AliAnalysisMuMuCutCombination,1) // combination of 1 or more individual cuts
+  ClassDef(AliAnalysisMuMuCutCombination,2) // combination of 1 or more individual cuts
 };
 
 #endif
@@ -23,8 +23,16 @@
  *
  * This class also defines a few default control cut elements aptly named AlwaysTrue.
  *
+ * The GetTrackCutMask and GetTrackPairCutMask methods evaluate each distinct track (pair)
+ * cut element used by the combinations once, and return the results as a bit mask. The
+ * decision of each combination is then a mask test (see AliAnalysisMuMuCutCombination::Pass),
+ * instead of calling again the cut methods of its elements. When more than 64 elements of
+ * a type are used, the elements beyond the 64th are not put in the mask and the combinations
+ * using them evaluate their elements directly.
+ *
  */
 
+#include <algorithm>
 #include <utility>
 #include "AliLog.h"
 #include "TMethodCall.h"
@@ -42,7 +50,10 @@ ClassImp(AliAnalysisMuMuCutRegistry)
 AliAnalysisMuMuCutRegistry::AliAnalysisMuMuCutRegistry()
 : TObject(),
 fCutElements(0x0),
-fCutCombinations(0x0)
+fCutCombinations(0x0),
+fMaskTrackCuts(),
+fMaskTrackPairCuts(),
+fCutMasksReady(kFALSE)
 {
   /// ctor
 }
@@ -83,6 +94,8 @@ Int_t AliAnalysisMuMuCutRegistry::AddCutCombination(const TObjArray& cutElements
 
   GetCutCombinations(AliAnalysisMuMuCutElement::kAny)->Add(cutCombination);
 
+  fCutMasksReady = kFALSE;
+
   if ( cutCombination->IsEventCutter() || cutCombination->IsEventHandlerCutter() )
   {
     GetCutCombinations(AliAnalysisMuMuCutElement::kEvent)->Add(cutCombination);
@@ -395,6 +408,103 @@ AliAnalysisMuMuCutElement* AliAnalysisMuMuCutRegistry::Not(const AliAnalysisMuMu
   return added;
 }
 
+//_____________________________________________________________________________
+void AliAnalysisMuMuCutRegistry::UpdateCutMasks() const
+{
+  /// Assign one bit to each distinct track and track pair cut element of the combinations,
+  /// and give each combination the masks of its elements
+
+  fMaskTrackCuts.clear();
+  fMaskTrackPairCuts.clear();
+  fCutMasksReady = kTRUE;
+
+  const TObjArray* combinations = GetCutCombinations(AliAnalysisMuMuCutElement::kAny);
+  if (!combinations) return;
+
+  TIter next(combinations);
+  AliAnalysisMuMuCutCombination* cutCombination;
+
+  while ( ( cutCombination = static_cast<AliAnalysisMuMuCutCombination*>(next()) ) )
+  {
+    ULong64_t trackMask(0);
+    ULong64_t trackPairMask(0);
+    Bool_t complete(kTRUE);
+
+    TIter nextCut(cutCombination->GetCutElements());
+    AliAnalysisMuMuCutElement* ce;
+
+    while ( ( ce = static_cast<AliAnalysisMuMuCutElement*>(nextCut()) ) )
+    {
+      std::vector<AliAnalysisMuMuCutElement*>* cuts(0x0);
+      ULong64_t* mask(0x0);
+
+      if ( ce->IsTrackCutter() )
+      {
+        cuts = &fMaskTrackCuts;
+        mask = &trackMask;
+      }
+      else if ( ce->IsTrackPairCutter() )
+      {
+        cuts = &fMaskTrackPairCuts;
+        mask = &trackPairMask;
+      }
+      else
+      {
+        continue;
+      }
+
+      UInt_t bit = std::find(cuts->begin(),cuts->end(),ce) - cuts->begin();
+
+      if ( bit == cuts->size() )
+      {
+        if ( bit >= 64 )
+        {
+          complete = kFALSE;
+          continue;
+        }
+        cuts->push_back(ce);
+      }
+      *mask |= (1ULL << bit);
+    }
+
+    cutCombination->SetCutMasks(trackMask,trackPairMask,complete);
+  }
+}
+
+//_____________________________________________________________________________
+ULong64_t AliAnalysisMuMuCutRegistry::GetTrackCutMask(const AliVParticle& particle) const
+{
+  /// Evaluate (once) each track cut element used by the combinations for this particle
+
+  if (!fCutMasksReady) UpdateCutMasks();
+
+  ULong64_t mask(0);
+
+  for ( UInt_t i = 0; i < fMaskTrackCuts.size(); ++i )
+  {
+    if ( fMaskTrackCuts[i]->Pass(particle) ) mask |= (1ULL << i);
+  }
+
+  return mask;
+}
+
+//_____________________________________________________________________________
+ULong64_t AliAnalysisMuMuCutRegistry::GetTrackPairCutMask(const AliVParticle& p1, const AliVParticle& p2) const
+{
+  /// Evaluate (once) each track pair cut element used by the combinations for this pair
+
+  if (!fCutMasksReady) UpdateCutMasks();
+
+  ULong64_t mask(0);
+
+  for ( UInt_t i = 0; i < fMaskTrackPairCuts.size(); ++i )
+  {
+    if ( fMaskTrackPairCuts[i]->Pass(p1,p2) ) mask |= (1ULL << i);
+  }
+
+  return mask;
+}
+
 //_____________________________________________________________________________
 void AliAnalysisMuMuCutRegistry::Print(Option_t* opt) const
 {
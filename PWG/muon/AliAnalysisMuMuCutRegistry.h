@@ -15,6 +15,7 @@
 #include "TString.h"
 #include "TMethodCall.h"
 #include "AliAnalysisMuMuCutElement.h"
+#include <vector>
 
 class AliVEvent;
 class AliAnalysisMuMuCutElementBar;
@@ -72,6 +73,12 @@ public:
   const TObjArray* GetCutElements(AliAnalysisMuMuCutElement::ECutType type) const;
   TObjArray* GetCutElements(AliAnalysisMuMuCutElement::ECutType type);
 
+  /// Results of all the track cut elements used by the combinations, one bit per element
+  ULong64_t GetTrackCutMask(const AliVParticle& particle) const;
+
+  /// Results of all the track pair cut elements used by the combinations, one bit per element
+  ULong64_t GetTrackPairCutMask(const AliVParticle& p1, const AliVParticle& p2) const;
+
   virtual void Print(Option_t* opt="") const;
 
   Bool_t AlwaysTrue(const AliVEvent& /*event*/) const { return kTRUE; }
@@ -93,12 +100,18 @@ private:
                                               const char* cutMethodPrototype,
                                               const char* defaultParameters);
 
+  void UpdateCutMasks() const;
+
 private:
 
   mutable TObjArray* fCutElements; // cut elements
   mutable TObjArray* fCutCombinations; // cut combinations
 
-  ClassDef(AliAnalysisMuMuCutRegistry,1) // storage for cut pointers
+  mutable std::vector<AliAnalysisMuMuCutElement*> fMaskTrackCuts; //! track cut elements, by bit of the mask
+  mutable std::vector<AliAnalysisMuMuCutElement*> fMaskTrackPairCuts; //! track pair cut elements, by bit of the mask
+  mutable Bool_t fCutMasksReady; //! whether the bits of the elements and the masks of the combinations are assigned
+
+  ClassDef(AliAnalysisMuMuCutRegistry,2) // storage for cut pointers
 };
 
 #endif
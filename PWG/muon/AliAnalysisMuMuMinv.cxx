@@ -49,7 +49,8 @@ fMinvBinSize(0.025),
 fMinvMin(0.0),
 fMinvMax(16.0),
 fmcptcutmin(0.0),
-fmcptcutmax(12.0)
+fmcptcutmax(12.0),
+fRangeNames()
 {
   // FIXME ? find the AccxEff histogram from HistogramCollection()->Histo("/EXCHANGE/JpsiAccEff")
 
@@ -502,10 +503,9 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
     {
       // Get Minv histo name associated to the bin
       TString minvName       = GetMinvHistoName(*r,kFALSE,PairCharge,IsMixedHisto);
-      TString hprofName      = Form("MeanPtVs%s",minvName.Data());
-      TString hprofNameSquare= Form("MeanPtSquareVs%s",minvName.Data());
-      TProfile* hprof        = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
-      TProfile* hprofsquare  = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data());
+      TProfile* hprof(0x0);
+      TProfile* hprofsquare(0x0);
+      GetMeanPtProfiles(kFALSE,eventSelection,triggerClassName,centrality,pairCutName,minvName,hprof,hprofsquare);
       FillMinvHisto(&minvName,hprof,hprofsquare,proxy,&pair4Momentum,inputWeight);
 
       // Create, fill and store Minv histo already corrected with accxeff
@@ -520,10 +520,7 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
         else okAccEff = kTRUE;
 
         minvName        = GetMinvHistoName(*r,kTRUE,PairCharge,IsMixedHisto);
-        hprofName       = Form("MeanPtVs%s",minvName.Data());
-        hprofNameSquare = Form("MeanPtSquareVs%s",minvName.Data());
-        hprof           = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
-        hprofsquare     = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data());
+        GetMeanPtProfiles(kFALSE,eventSelection,triggerClassName,centrality,pairCutName,minvName,hprof,hprofsquare);
         if( okAccEff ) FillMinvHisto(&minvName,hprof,hprofsquare,proxy,&pair4Momentum,inputWeight/AccxEff);
       }
     }
@@ -531,10 +528,9 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
     if ( okMC ) {
 
       TString minvName       = GetMinvHistoName(*r,kFALSE,PairCharge,IsMixedHisto);
-      TString hprofName      = Form("MeanPtVs%s",minvName.Data());
-      TString hprofNameSquare= Form("MeanPtSquareVs%s",minvName.Data());
-      TProfile* hprof        = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
-      TProfile* hprofsquare  = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data());
+      TProfile* hprof(0x0);
+      TProfile* hprofsquare(0x0);
+      GetMeanPtProfiles(kTRUE,eventSelection,triggerClassName,centrality,pairCutName,minvName,hprof,hprofsquare);
       FillMinvHisto(&minvName,hprof,hprofsquare,mcProxy,&pair4Momentum,inputWeight);
 
       // Create, fill and store Minv histo already corrected with accxeff
@@ -549,10 +545,7 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
         else okAccEff = kTRUE;
 
         minvName        = GetMinvHistoName(*r,kTRUE,PairCharge,IsMixedHisto);
-        hprofName       = Form("MeanPtVs%s",minvName.Data());
-        hprofNameSquare = Form("MeanPtSquareVs%s",minvName.Data());
-        hprof           = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
-        hprofsquare     = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data());
+        GetMeanPtProfiles(kTRUE,eventSelection,triggerClassName,centrality,pairCutName,minvName,hprof,hprofsquare);
         if( okAccEff ) FillMinvHisto(&minvName,hprof,hprofsquare,mcProxy,&pair4Momentum,inputWeight/AccxEff);
 
       }
@@ -717,7 +710,36 @@ TString AliAnalysisMuMuMinv::GetMinvHistoName(const AliAnalysisMuMuBinning::Rang
   if(mix) suffix += "Mix";
 
   return TString::Format("MinvUS%s%s%s%s",
-                         accEffCorrected ? "_AccEffCorr" : "",fMinvBinSeparator.Data(),r.AsString().Data(),suffix.Data());
+                         accEffCorrected ? "_AccEffCorr" : "",fMinvBinSeparator.Data(),GetRangeName(r).Data(),suffix.Data());
+}
+
+//_____________________________________________________________________________
+const TString& AliAnalysisMuMuMinv::GetRangeName(const AliAnalysisMuMuBinning::Range& r) const
+{
+  /// Name of the bin range, formatted once per range and not for each pair
+  std::map<const AliAnalysisMuMuBinning::Range*,TString>::iterator it = fRangeNames.find(&r);
+  if ( it == fRangeNames.end() ) it = fRangeNames.insert(std::make_pair(&r,r.AsString())).first;
+  return it->second;
+}
+
+//_____________________________________________________________________________
+void AliAnalysisMuMuMinv::GetMeanPtProfiles(Bool_t mc, const char* eventSelection, const char* triggerClassName,
+                                            const char* centrality, const char* pairCutName, const TString& minvName,
+                                            TProfile*& hprof, TProfile*& hprof2)
+{
+  /// Mean pt profiles associated to the Minv histo, only looked up if the mean pt is computed
+  hprof = hprof2 = 0x0;
+  if ( !fComputeMeanPt ) return;
+
+  TString hprofName(Form("MeanPtVs%s",minvName.Data()));
+  TString hprofNameSquare(Form("MeanPtSquareVs%s",minvName.Data()));
+  if ( mc ) {
+    hprof  = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
+    hprof2 = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data());
+  } else {
+    hprof  = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
+    hprof2 = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data());
+  }
 }
 
 
@@ -1109,6 +1131,7 @@ Bool_t AliAnalysisMuMuMinv::IsRapidityInRange(const AliVParticle& t1, const AliV
 void AliAnalysisMuMuMinv::SetBinsToFill(const char* particle, const char* bins)
 {
   delete fBinsToFill;
+  fRangeNames.clear();
   fBinsToFill = Binning()->CreateBinObjArray(particle,bins,"");
 }
 
@@ -8,6 +8,8 @@
  * \author L. Aphecetche, J. Martin Blanco and B. Audurier (Subatech)
  */
 
+#include <map>
+
 #include "AliAnalysisMuMuBase.h"
 #include "AliAnalysisMuMuBinning.h"
 #include "AliMergeableCollection.h"
@@ -83,6 +85,12 @@ private:
 
   TString GetMinvHistoName(const AliAnalysisMuMuBinning::Range& r, Bool_t accEffCorrected, Double_t PairCharge=0, Bool_t mix =kFALSE) const;
 
+  const TString& GetRangeName(const AliAnalysisMuMuBinning::Range& r) const;
+
+  void GetMeanPtProfiles(Bool_t mc, const char* eventSelection, const char* triggerClassName,
+                         const char* centrality, const char* pairCutName, const TString& minvName,
+                         TProfile*& hprof, TProfile*& hprof2);
+
   Double_t GetAccxEff(Double_t pt,Double_t rapidity);
 
   Double_t WeightMuonDistribution(Double_t pt);
@@ -111,8 +119,9 @@ private:
   Double_t fMinvMax;
   Double_t fmcptcutmin;
   Double_t fmcptcutmax;
+  mutable std::map<const AliAnalysisMuMuBinning::Range*,TString> fRangeNames; //!<! names of the ranges of fBinsToFill
 
-  ClassDef(AliAnalysisMuMuMinv,8) // implementation of AliAnalysisMuMuBase for muon pairs
+  ClassDef(AliAnalysisMuMuMinv,9) // implementation of AliAnalysisMuMuBase for muon pairs
 };
 
 #endif
@@ -90,7 +90,10 @@ fDisableHistoLoop(kFALSE),
 fLegacyCentrality(kFALSE),
 fPool(0x0),
 fMaxPoolSize(0),
-fMix(kFALSE)
+fMix(kFALSE),
+fMuonTracks(),
+fTrackCutMasks(),
+fTrackPairCutMasks()
 {
   /// Constructor with a predefined list of triggers to consider
   /// Note that we take ownership of cutRegister
@@ -389,6 +392,27 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
   // The main part, loop over subanalysis and fill histo
   if ( !IsHistogrammingDisabled() && !fDisableHistoLoop ){
 
+    // Evaluate the track and track pair cut elements once for all the sub-analysis
+    // and cut combinations, the combinations then only test the masks
+    fMuonTracks.clear();
+    for (Int_t i = 0; i < nTracks; ++i){
+      AliVParticle* track = AliAnalysisMuonUtility::GetTrack(i,Event());
+      if ( AliAnalysisMuonUtility::IsMuonTrack(track) ) fMuonTracks.push_back(track);
+    }
+    Int_t nMuons = fMuonTracks.size();
+
+    fTrackCutMasks.resize(nMuons);
+    for (Int_t i = 0; i < nMuons; ++i) fTrackCutMasks[i] = fCutRegistry->GetTrackCutMask(*fMuonTracks[i]);
+
+    fTrackPairCutMasks.assign(nMuons*nMuons,0);
+    if ( !fCutRegistry->GetCutCombinations(AliAnalysisMuMuCutElement::kTrackPair)->IsEmpty() ){
+      for (Int_t i = 0; i < nMuons; ++i){
+        for (Int_t j = i+1; j < nMuons; ++j){
+          fTrackPairCutMasks[i*nMuons+j] = fCutRegistry->GetTrackPairCutMask(*fMuonTracks[i],*fMuonTracks[j]);
+        }
+      }
+    }
+
     while ( ( analysis = static_cast<AliAnalysisMuMuBase*>(nextAnalysis()) ) )
     {
 
@@ -404,12 +428,11 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
       AliCodeTimerAuto(Form("%s (FillHistosForEvent)",analysis->ClassName()),1);
       analysis->FillHistosForEvent(eventSelection,triggerClassName,centrality); // Implemented in AliAnalysisMuMuNch at the moment
 
-      // --- Loop on all event tracks ---
-      for (Int_t i = 0; i < nTracks; ++i){
+      // --- Loop on all event muon tracks ---
+      for (Int_t i = 0; i < nMuons; ++i){
 
         // Get track
-        AliVParticle* tracki = AliAnalysisMuonUtility::GetTrack(i,Event());
-       if (!AliAnalysisMuonUtility::IsMuonTrack(tracki) ) continue;
+        AliVParticle* tracki = fMuonTracks[i];
 
         nextTrackCut.Reset();
         AliAnalysisMuMuCutCombination* trackCut;
@@ -417,7 +440,7 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
         // Loop on all track selections and fill histos for track that pass it
         while ( ( trackCut = static_cast<AliAnalysisMuMuCutCombination*>(nextTrackCut()) ) )
         {
-          if ( trackCut->Pass(*tracki) )
+          if ( trackCut->Pass(*tracki,fTrackCutMasks[i]) )
           {
             AliCodeTimerAuto(Form("%s (FillHistosForTrack)",analysis->ClassName()),2);
             analysis->FillHistosForTrack(eventSelection,triggerClassName,centrality,trackCut->GetName(),*tracki);
@@ -426,12 +449,9 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
 
         // --- loop on muon track pairs (no mix) ---
 
-        for (Int_t j = i+1; j < nTracks; ++j){
+        for (Int_t j = i+1; j < nMuons; ++j){
           // Get track
-          AliVParticle    * trackj = 0x0;
-          trackj = AliAnalysisMuonUtility::GetTrack(j,Event());
-
-          if (!AliAnalysisMuonUtility::IsMuonTrack(trackj) ) continue;
+          AliVParticle    * trackj = fMuonTracks[j];
 
           nextPairCut.Reset();
           AliAnalysisMuMuCutCombination* pairCut;
@@ -440,9 +460,9 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
           while ( ( pairCut = static_cast<AliAnalysisMuMuCutCombination*>(nextPairCut()) ) )
           {
             // Weither or not the pairs pass the tests
-            Bool_t testi  = (pairCut->IsTrackCutter()) ? pairCut->Pass(*tracki) : kTRUE;
-            Bool_t testj  = (pairCut->IsTrackCutter()) ? pairCut->Pass(*trackj) : kTRUE;
-            Bool_t testij = pairCut->Pass(*tracki,*trackj);
+            Bool_t testi  = (pairCut->IsTrackCutter()) ? pairCut->Pass(*tracki,fTrackCutMasks[i]) : kTRUE;
+            Bool_t testj  = (pairCut->IsTrackCutter()) ? pairCut->Pass(*trackj,fTrackCutMasks[j]) : kTRUE;
+            Bool_t testij = pairCut->Pass(*tracki,*trackj,fTrackPairCutMasks[i*nMuons+j]);
 
             if ( ( testi && testj ) && testij )
             {
@@ -478,7 +498,7 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
               trackj = static_cast<AliVParticle*>(currentPool->At(iTrack2));
 
               // Weither or not the pairs pass the tests
-              Bool_t testi  = trackCut->Pass(*tracki);
+              Bool_t testi  = trackCut->Pass(*tracki,fTrackCutMasks[i]);
               Bool_t testj  = trackCut->Pass(*trackj);
               Bool_t testij = pairCut->Pass(*tracki,*trackj);
 
@@ -31,6 +31,8 @@
 #  include "TMath.h"
 #endif
 
+#include <vector>
+
 class AliAnalysisMuMuBinning;
 class AliCounterCollection;
 class AliMergeableCollection;
@@ -174,7 +176,11 @@ private:
 
   Int_t fMaxPoolSize; // pool size
 
-  ClassDef(AliAnalysisTaskMuMu,31) // a class to analyse muon pairs (and single also ;-) )
+  std::vector<AliVParticle*> fMuonTracks; //! muon tracks of the current event
+  std::vector<ULong64_t> fTrackCutMasks; //! track cut results of the muon tracks (see AliAnalysisMuMuCutRegistry::GetTrackCutMask)
+  std::vector<ULong64_t> fTrackPairCutMasks; //! track pair cut results of the muon track pairs
+
+  ClassDef(AliAnalysisTaskMuMu,32) // a class to analyse muon pairs (and single also ;-) )
 };
 
 #endif
@@ -143,6 +143,8 @@ AliUEHist::AliUEHist(const char* reqHist, const char* binning) :
     useAliTHn = 0;
   if (TString(reqHist).Contains("Double"))
     useAliTHn = 2;
+  // AliTHn steps are allocated only when filled, with "Chunked" only the filled chunks of bins are allocated
+  Bool_t useChunkedStorage = TString(reqHist).Contains("Chunked");
   
   // selection depending on requested histogram
   Int_t axis = -1; // 0 = pT,lead, 1 = phi,lead
@@ -271,6 +273,11 @@ AliUEHist::AliUEHist(const char* reqHist, const char* binning) :
     else
       fTrackHist[i] = new AliCFContainer(Form("fTrackHist_%d", i), title, nSteps, nTrackVars, iTrackBin);
     
+    if (useChunkedStorage && axis >= 2 && useAliTHn == 1)
+      dynamic_cast<AliTHn*> (fTrackHist[i])->SetChunkedStorage();
+    else if (useChunkedStorage && axis >= 2 && useAliTHn == 2)
+      dynamic_cast<AliTHnD*> (fTrackHist[i])->SetChunkedStorage();
+    
     for (Int_t j=0; j<nTrackVars; j++)
     {
       fTrackHist[i]->SetBinLimits(j, trackBins[j]);
@@ -3064,6 +3071,18 @@ void AliUEHist::Scale(Double_t factor)
   fTrackHistEfficiency->Scale(factor);
 }
 
+void AliUEHist::ReducePrecision(Double_t relPrecision)
+{
+  // rounds the content of the AliTHn containers to the statistical precision (see AliTHnBase::ReducePrecision)
+  
+  for (Int_t i=0; i<4; i++)
+  {
+    AliTHnBase* thn = dynamic_cast<AliTHnBase*> (fTrackHist[i]);
+    if (thn)
+      thn->ReducePrecision(relPrecision);
+  }
+}
+
 void AliUEHist::Reset()
 {
   // resets all contained histograms
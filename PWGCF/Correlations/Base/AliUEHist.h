@@ -137,6 +137,7 @@ class AliUEHist : public TObject
   virtual Long64_t Merge(TCollection* list);
   void Scale(Double_t factor);
   void Reset();
+  void ReducePrecision(Double_t relPrecision);
   THnBase* ChangeToThn(THnBase* sparse);
   
   static TString CombineBinning(TString defaultBinning, TString customBinning);
@@ -30,6 +30,7 @@
 #include "AliAODTrack.h"
 
 #include "TList.h"
+#include "TFile.h"
 #include "TCanvas.h"
 #include "TH2F.h"
 #include "TH1F.h"
@@ -37,6 +38,8 @@
 #include "TMath.h"
 #include "TLorentzVector.h"
 #include "TFormula.h"
+
+#include <algorithm>
 #include "TRandom3.h"
 
 ClassImp(AliUEHistograms)
@@ -89,6 +92,16 @@ AliUEHistograms::AliUEHistograms(const char* name, const char* histograms, const
   fPtOrder(kTRUE),
   fTwoTrackCutMinRadius(0.8),
   fCheckEventNumberInCorrelation(kFALSE),
+  fUsePairEngine(kFALSE),
+  fPairPt(),
+  fPairEta(),
+  fPairPhi(),
+  fPairCharge(),
+  fPairEfficiency(),
+  fPairIndex(),
+  fPairParticle(),
+  fPairDEta(),
+  fPairDPhi(),
   fRunNumber(0),
   fMergeCount(1)
 {
@@ -272,6 +285,16 @@ AliUEHistograms::AliUEHistograms(const AliUEHistograms &c) :
   fPtOrder(kTRUE),
   fTwoTrackCutMinRadius(0.8),
   fCheckEventNumberInCorrelation(kFALSE),
+  fUsePairEngine(kFALSE),
+  fPairPt(),
+  fPairEta(),
+  fPairPhi(),
+  fPairCharge(),
+  fPairEfficiency(),
+  fPairIndex(),
+  fPairParticle(),
+  fPairDEta(),
+  fPairDPhi(),
   fRunNumber(0),
   fMergeCount(1)
 {
@@ -571,6 +594,350 @@ void AliUEHistograms::Fill(AliVParticle* leadingMC, AliVParticle* leadingReco)
   }
 }
 
+//____________________________________________________________________
+Bool_t AliUEHistograms::AcceptPair(Double_t tPt, Float_t tEta, Double_t tPhi, Short_t tCharge, Double_t aPt, Float_t aEta, Double_t aPhi, Short_t aCharge, Float_t bSign, Float_t twoTrackEfficiencyCutValue)
+{
+  // applies the conversion, resonance and two-track efficiency cuts on the pair of trigger (t) and associated (a) particle
+  // and fills the corresponding control histograms
+  // returns kFALSE if the pair is rejected
+
+  // conversions
+  if (fCutConversionsV > 0 && aCharge * tCharge < 0)
+  {
+    Float_t mass = GetInvMassSquaredCheap(tPt, tEta, tPhi, aPt, aEta, aPhi, 0.510e-3, 0.510e-3);
+
+    if (mass < fCutConversionsV * 5)
+    {
+      mass = GetInvMassSquared(tPt, tEta, tPhi, aPt, aEta, aPhi, 0.510e-3, 0.510e-3);
+
+      fControlConvResoncances->Fill(0.0, mass);
+
+      if (mass < fCutConversionsV*fCutConversionsV) 
+        return kFALSE;
+    }
+  }
+
+  // K0s
+  if (fCutK0sV > 0 && aCharge * tCharge < 0)
+  {
+    Float_t mass = GetInvMassSquaredCheap(tPt, tEta, tPhi, aPt, aEta, aPhi, 0.1396, 0.1396);
+
+    const Float_t kK0smass = 0.4976;
+
+    if (TMath::Abs(mass - kK0smass*kK0smass) < fCutK0sV * 5)
+    {
+      mass = GetInvMassSquared(tPt, tEta, tPhi, aPt, aEta, aPhi, 0.1396, 0.1396);
+
+      fControlConvResoncances->Fill(1, mass - kK0smass*kK0smass);
+
+      if (mass > (kK0smass-fCutK0sV)*(kK0smass-fCutK0sV) && mass < (kK0smass+fCutK0sV)*(kK0smass+fCutK0sV))
+        return kFALSE;
+    }
+  }
+
+  // Lambda
+  if (fCutLambdaV > 0 && aCharge * tCharge < 0)
+  {
+    Float_t mass1 = GetInvMassSquaredCheap(tPt, tEta, tPhi, aPt, aEta, aPhi, 0.1396, 0.9383);
+    Float_t mass2 = GetInvMassSquaredCheap(tPt, tEta, tPhi, aPt, aEta, aPhi, 0.9383, 0.1396);
+
+    const Float_t kLambdaMass = 1.115;
+
+    if (TMath::Abs(mass1 - kLambdaMass*kLambdaMass) < fCutLambdaV * 5)
+    {
+      mass1 = GetInvMassSquared(tPt, tEta, tPhi, aPt, aEta, aPhi, 0.1396, 0.9383);
+
+      fControlConvResoncances->Fill(2, mass1 - kLambdaMass*kLambdaMass);
+
+      if (mass1 > (kLambdaMass-fCutLambdaV)*(kLambdaMass-fCutLambdaV) && mass1 < (kLambdaMass+fCutLambdaV)*(kLambdaMass+fCutLambdaV))
+        return kFALSE;
+    }
+    if (TMath::Abs(mass2 - kLambdaMass*kLambdaMass) < fCutLambdaV * 5)
+    {
+      mass2 = GetInvMassSquared(tPt, tEta, tPhi, aPt, aEta, aPhi, 0.9383, 0.1396);
+
+      fControlConvResoncances->Fill(2, mass2 - kLambdaMass*kLambdaMass);
+
+      if (mass2 > (kLambdaMass-fCutLambdaV)*(kLambdaMass-fCutLambdaV) && mass2 < (kLambdaMass+fCutLambdaV)*(kLambdaMass+fCutLambdaV))
+        return kFALSE;
+    }
+  }
+
+  // Phi
+  if (fCutPhiV > 0 && aCharge * tCharge < 0)
+  {
+    Float_t mass = GetInvMassSquaredCheap(tPt, tEta, tPhi, aPt, aEta, aPhi, 0.4937, 0.4937);
+
+    const Float_t kPhimass = 1.019;
+
+    if (TMath::Abs(mass - kPhimass*kPhimass) < fCutPhiV * 5)
+    {
+      mass = GetInvMassSquared(tPt, tEta, tPhi, aPt, aEta, aPhi, 0.4937, 0.4937);
+
+      fControlConvResoncances->Fill(3, mass - kPhimass*kPhimass);
+
+      if (mass > (kPhimass-fCutPhiV)*(kPhimass-fCutPhiV) && mass < (kPhimass+fCutPhiV)*(kPhimass+fCutPhiV))
+        return kFALSE;
+    }
+  }	
+
+  // Rho
+  if (fCutRhoV > 0 && aCharge * tCharge < 0)
+  {
+    Float_t mass = GetInvMassSquaredCheap(tPt, tEta, tPhi, aPt, aEta, aPhi, 0.1396, 0.1396);
+
+    const Float_t kRhomass = 0.770;
+
+    if (TMath::Abs(mass - kRhomass*kRhomass) < fCutRhoV * 5)
+    {
+      mass = GetInvMassSquared(tPt, tEta, tPhi, aPt, aEta, aPhi, 0.1396, 0.1396);
+
+      fControlConvResoncances->Fill(4, mass - kRhomass*kRhomass);
+
+      if (mass > (kRhomass-fCutRhoV)*(kRhomass-fCutRhoV) && mass < (kRhomass+fCutRhoV)*(kRhomass+fCutRhoV))
+        return kFALSE;
+    }
+  }
+
+  // User-defined cut
+  if (fCutCustomMass > 0 && fCutCustomFirst > 0 && fCutCustomSecond > 0 && fCutCustomV > 0 && aCharge * tCharge < 0)
+  {
+    Float_t mass = GetInvMassSquaredCheap(tPt, tEta, tPhi, aPt, aEta, aPhi, fCutCustomFirst, fCutCustomSecond);
+
+    if (TMath::Abs(mass - fCutCustomMass*fCutCustomMass) < fCutCustomV * 5)
+    {
+      mass = GetInvMassSquared(tPt, tEta, tPhi, aPt, aEta, aPhi, fCutCustomFirst, fCutCustomSecond);
+
+      fControlConvResoncances->Fill(5, mass - fCutCustomMass*fCutCustomMass);
+
+      if (mass > (fCutCustomMass-fCutCustomV)*(fCutCustomMass-fCutCustomV) && mass < (fCutCustomMass+fCutCustomV)*(fCutCustomMass+fCutCustomV))
+        return kFALSE;
+    }
+  }
+
+  if (twoTrackEfficiencyCutValue > 0)
+  {
+    // the variables & cuthave been developed by the HBT group 
+    // see e.g. https://indico.cern.ch/materialDisplay.py?contribId=36&sessionId=6&materialId=slides&confId=142700
+
+    Float_t phi1 = tPhi;
+    Float_t pt1 = tPt;
+    Float_t charge1 = tCharge;
+
+    Float_t phi2 = aPhi;
+    Float_t pt2 = aPt;
+    Float_t charge2 = aCharge;
+
+    Float_t deta = tEta - aEta;
+
+    // optimization
+    if (TMath::Abs(deta) < twoTrackEfficiencyCutValue * 2.5 * 3)
+    {
+      // check first boundaries to see if is worth to loop and find the minimum
+      Float_t dphistar1 = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, fTwoTrackCutMinRadius, bSign);
+      Float_t dphistar2 = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, 2.5, bSign);
+
+      const Float_t kLimit = twoTrackEfficiencyCutValue * 3;
+
+      Float_t dphistarminabs = 1e5;
+      Float_t dphistarmin = 1e5;
+      if (TMath::Abs(dphistar1) < kLimit || TMath::Abs(dphistar2) < kLimit || dphistar1 * dphistar2 < 0)
+      {
+        for (Double_t rad=fTwoTrackCutMinRadius; rad<2.51; rad+=0.01) 
+        {
+  	Float_t dphistar = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, rad, bSign);
+
+  	Float_t dphistarabs = TMath::Abs(dphistar);
+
+  	if (dphistarabs < dphistarminabs)
+  	{
+  	  dphistarmin = dphistar;
+  	  dphistarminabs = dphistarabs;
+  	}
+        }
+
+        fTwoTrackDistancePt[0]->Fill(deta, dphistarmin, TMath::Abs(pt1 - pt2));
+
+        if (dphistarminabs < twoTrackEfficiencyCutValue && TMath::Abs(deta) < twoTrackEfficiencyCutValue)
+        {
+// 		Printf("Removed track pair %d %d with %f %f %f %f %f %f %f %f %f", i, j, deta, dphistarminabs, phi1, pt1, charge1, phi2, pt2, charge2, bSign);
+  	return kFALSE;
+        }
+
+    	      fTwoTrackDistancePt[1]->Fill(deta, dphistarmin, TMath::Abs(pt1 - pt2));
+      }
+    }
+  }
+
+  return kTRUE;
+}
+
+//____________________________________________________________________
+void AliUEHistograms::FillPairBuffers(TObjArray* input, const Float_t* eta, Double_t centrality, Float_t zVtx, Bool_t applyEfficiency, UInt_t resonanceDaughterFlag)
+{
+  // copies the associated particles into the arrays used by FillPairs
+  // the selections which only depend on the associated particle are applied here
+  // if fPtOrder is set, the particles are sorted by pt
+
+  const Int_t nInput = input->GetEntriesFast();
+  
+  std::vector<Double_t> pt(nInput);
+  fPairIndex.clear();
+  for (Int_t j=0; j<nInput; j++)
+  {
+    AliVParticle* particle = (AliVParticle*) input->UncheckedAt(j);
+
+    if (fAssociatedSelectCharge != 0)
+      if (particle->Charge() * fAssociatedSelectCharge < 0)
+        continue;
+
+    if (fOnlyOneAssocEtaSide != 0)
+      if (fOnlyOneAssocEtaSide * eta[j] < 0)
+        continue;
+
+    if (resonanceDaughterFlag && particle->TestBit(resonanceDaughterFlag))
+      continue;
+    
+    pt[j] = particle->Pt();
+    fPairIndex.push_back(j);
+  }
+  
+  if (fPtOrder)
+    std::stable_sort(fPairIndex.begin(), fPairIndex.end(), [&pt](Int_t a, Int_t b) { return pt[a] < pt[b]; });
+
+  const Int_t n = fPairIndex.size();
+  fPairPt.resize(n);
+  fPairEta.resize(n);
+  fPairPhi.resize(n);
+  fPairCharge.resize(n);
+  fPairEfficiency.resize(n);
+  fPairParticle.resize(n);
+  fPairDEta.resize(n);
+  fPairDPhi.resize(n);
+  
+  for (Int_t k=0; k<n; k++)
+  {
+    Int_t j = fPairIndex[k];
+    AliVParticle* particle = (AliVParticle*) input->UncheckedAt(j);
+    
+    fPairPt[k] = pt[j];
+    fPairEta[k] = eta[j];
+    fPairPhi[k] = particle->Phi();
+    fPairCharge[k] = particle->Charge();
+    fPairParticle[k] = particle;
+    
+    fPairEfficiency[k] = 1;
+    if (applyEfficiency && fEfficiencyCorrectionAssociated)
+    {
+      Int_t effVars[4];
+      effVars[0] = fEfficiencyCorrectionAssociated->GetAxis(0)->FindBin(eta[j]);
+      effVars[1] = fEfficiencyCorrectionAssociated->GetAxis(1)->FindBin(pt[j]);
+      effVars[2] = fEfficiencyCorrectionAssociated->GetAxis(2)->FindBin(centrality);
+      effVars[3] = fEfficiencyCorrectionAssociated->GetAxis(3)->FindBin((Double_t) zVtx);
+      fPairEfficiency[k] = fEfficiencyCorrectionAssociated->GetBinContent(effVars);
+    }
+  }
+}
+
+//____________________________________________________________________
+void AliUEHistograms::FillPairs(Int_t triggerIndex, AliVParticle* triggerParticle, Float_t triggerEta, Bool_t mixed, Double_t centrality, Float_t zVtx, AliUEHist::CFStep step, Float_t weight, Bool_t fillpT, Bool_t twoTrackCuts, Float_t bSign, Float_t twoTrackEfficiencyCutValue, Bool_t applyEfficiency, TH1* triggerWeighting)
+{
+  // fills the pairs of the trigger particle with the associated particles prepared by FillPairBuffers
+  // the result is the same as of the pair loop in FillCorrelations, but
+  //   the pt ordering is applied by a binary search in the pt sorted associated particles
+  //   delta eta and delta phi are calculated in a separate loop over the arrays, which the compiler can vectorize
+  //   the efficiency corrections are looked up once per particle instead of once per pair
+  
+  const Double_t triggerPt = triggerParticle->Pt();
+  const Double_t triggerPhi = triggerParticle->Phi();
+  const Short_t triggerCharge = triggerParticle->Charge();
+  
+  Int_t nAssoc = fPairPt.size();
+  if (fPtOrder)
+    nAssoc = std::lower_bound(fPairPt.begin(), fPairPt.end(), triggerPt) - fPairPt.begin();
+  if (nAssoc == 0)
+    return;
+
+  const Float_t* eta = &fPairEta[0];
+  const Double_t* phi = &fPairPhi[0];
+  Float_t* deta = &fPairDEta[0];
+  Double_t* dphi = &fPairDPhi[0];
+  for (Int_t j=0; j<nAssoc; j++)
+  {
+    deta[j] = triggerEta - eta[j];
+    Double_t d = triggerPhi - phi[j];
+    d = (d > 1.5 * TMath::Pi()) ? d - TMath::TwoPi() : d;
+    d = (d < -0.5 * TMath::Pi()) ? d + TMath::TwoPi() : d;
+    dphi[j] = d;
+  }
+  
+  Double_t triggerEfficiency = 1;
+  if (applyEfficiency && fEfficiencyCorrectionTriggers)
+  {
+    Int_t effVars[4];
+    effVars[0] = fEfficiencyCorrectionTriggers->GetAxis(0)->FindBin(triggerEta);
+    effVars[1] = fEfficiencyCorrectionTriggers->GetAxis(1)->FindBin(triggerPt);
+    effVars[2] = fEfficiencyCorrectionTriggers->GetAxis(2)->FindBin(centrality);
+    effVars[3] = fEfficiencyCorrectionTriggers->GetAxis(3)->FindBin((Double_t) zVtx);
+    triggerEfficiency = fEfficiencyCorrectionTriggers->GetBinContent(effVars);
+  }
+  
+  Double_t triggerWeight = 1;
+  if (fWeightPerEvent)
+    triggerWeight = triggerWeighting->GetBinContent(triggerWeighting->GetXaxis()->FindBin(triggerPt));
+  
+  AliCFContainer* container = fNumberDensityPhi->GetTrackHist(AliUEHist::kToward);
+  
+  Double_t vars[6];
+  vars[2] = triggerPt;
+  vars[3] = centrality;
+  vars[5] = zVtx;
+  
+  for (Int_t j=0; j<nAssoc; j++)
+  {
+    if (!mixed && fPairIndex[j] == triggerIndex)
+      continue;
+    
+    if (mixed && triggerParticle->IsEqual(fPairParticle[j]))
+      continue;
+    
+    // skip like sign (1) or unlike sign (2)
+    if (fSelectCharge == 1 && fPairCharge[j] * triggerCharge > 0)
+      continue;
+    if (fSelectCharge == 2 && fPairCharge[j] * triggerCharge < 0)
+      continue;
+    
+    if (fEtaOrdering)
+    {
+      if (triggerEta < 0 && eta[j] < triggerEta)
+        continue;
+      if (triggerEta > 0 && eta[j] > triggerEta)
+        continue;
+    }
+    
+    if (twoTrackCuts && !AcceptPair(triggerPt, triggerEta, triggerPhi, triggerCharge, fPairPt[j], eta[j], phi[j], fPairCharge[j], bSign, twoTrackEfficiencyCutValue))
+      continue;
+    
+    vars[0] = deta[j];
+    vars[1] = fPairPt[j];
+    vars[4] = dphi[j];
+    
+    // weight is a Float_t in FillCorrelations, keep the same rounding
+    Double_t useWeight = (fillpT) ? (Float_t) fPairPt[j] : weight;
+    if (applyEfficiency)
+    {
+      if (fEfficiencyCorrectionAssociated)
+        useWeight *= fPairEfficiency[j];
+      if (fEfficiencyCorrectionTriggers)
+        useWeight *= triggerEfficiency;
+    }
+    if (fWeightPerEvent)
+      useWeight /= triggerWeight;
+    
+    container->Fill(vars, step, useWeight);
+  }
+}
+
 //____________________________________________________________________
 void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEHist::CFStep step, TObjArray* particles, TObjArray* mixed, Float_t weight, Bool_t firstTime, Bool_t twoTrackCuts, Float_t bSign, Float_t twoTrackEfficiencyCutValue, Bool_t applyEfficiency)
 {
@@ -717,6 +1084,11 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
       }
     }
     
+    // the pair engine changes the order in which the pairs are processed, this would change the result of the random delta eta rejection
+    Bool_t usePairEngine = fUsePairEngine && !fDeltaEtaAcceptance && !fCheckEventNumberInCorrelation;
+    if (usePairEngine)
+      FillPairBuffers(input, eta.GetArray(), centrality, zVtx, applyEfficiency, (fRejectResonanceDaughters > 0) ? kResonanceDaughterFlag : 0);
+    
     for (Int_t i=0; i<particles->GetEntriesFast(); i++)
     {
       AliVParticle* triggerParticle = (AliVParticle*) particles->UncheckedAt(i);
@@ -744,6 +1116,9 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	  continue;
 	}
 	
+      if (usePairEngine)
+        FillPairs(i, triggerParticle, triggerEta, (mixed != 0), centrality, zVtx, step, weight, fillpT, twoTrackCuts, bSign, twoTrackEfficiencyCutValue, applyEfficiency, triggerWeighting);
+      else
       for (Int_t j=0; j<jMax; j++)
       {
         if (!mixed && i == j)
@@ -815,173 +1190,8 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	    continue;
 	}
 	
-	// conversions
-	if (twoTrackCuts && fCutConversionsV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
-	{
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.510e-3, 0.510e-3);
-	  
-	  if (mass < fCutConversionsV * 5)
-	  {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.510e-3, 0.510e-3);
-	    
-	    fControlConvResoncances->Fill(0.0, mass);
-
-	    if (mass < fCutConversionsV*fCutConversionsV) 
-	      continue;
-	  }
-	}
-	
-	// K0s
-	if (twoTrackCuts && fCutK0sV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
-	{
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.1396);
-	  
-	  const Float_t kK0smass = 0.4976;
-	  
-	  if (TMath::Abs(mass - kK0smass*kK0smass) < fCutK0sV * 5)
-	  {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.1396);
-	    
-	    fControlConvResoncances->Fill(1, mass - kK0smass*kK0smass);
-
-	    if (mass > (kK0smass-fCutK0sV)*(kK0smass-fCutK0sV) && mass < (kK0smass+fCutK0sV)*(kK0smass+fCutK0sV))
-	      continue;
-	  }
-	}
-
-	// Lambda
-	if (twoTrackCuts && fCutLambdaV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
-	{
-	  Float_t mass1 = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.9383);
-	  Float_t mass2 = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.9383, 0.1396);
-	  
-	  const Float_t kLambdaMass = 1.115;
-
-	  if (TMath::Abs(mass1 - kLambdaMass*kLambdaMass) < fCutLambdaV * 5)
-	  {
-	    mass1 = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.9383);
-
-	    fControlConvResoncances->Fill(2, mass1 - kLambdaMass*kLambdaMass);
-	    
-	    if (mass1 > (kLambdaMass-fCutLambdaV)*(kLambdaMass-fCutLambdaV) && mass1 < (kLambdaMass+fCutLambdaV)*(kLambdaMass+fCutLambdaV))
-	      continue;
-	  }
-	  if (TMath::Abs(mass2 - kLambdaMass*kLambdaMass) < fCutLambdaV * 5)
-	  {
-	    mass2 = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.9383, 0.1396);
-
-	    fControlConvResoncances->Fill(2, mass2 - kLambdaMass*kLambdaMass);
-
-	    if (mass2 > (kLambdaMass-fCutLambdaV)*(kLambdaMass-fCutLambdaV) && mass2 < (kLambdaMass+fCutLambdaV)*(kLambdaMass+fCutLambdaV))
-	      continue;
-	  }
-	}
-
-        // Phi
-	if (twoTrackCuts && fCutPhiV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
-	{
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.4937, 0.4937);
-	  
-	  const Float_t kPhimass = 1.019;
-	  
-	  if (TMath::Abs(mass - kPhimass*kPhimass) < fCutPhiV * 5)
-	  {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.4937, 0.4937);
-	    
-	    fControlConvResoncances->Fill(3, mass - kPhimass*kPhimass);
-	    
-	    if (mass > (kPhimass-fCutPhiV)*(kPhimass-fCutPhiV) && mass < (kPhimass+fCutPhiV)*(kPhimass+fCutPhiV))
-	      continue;
-	  }
-	}	
-
-        // Rho
-	if (twoTrackCuts && fCutRhoV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
-        {
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.1396);
-	  
-	  const Float_t kRhomass = 0.770;
-	  
-	  if (TMath::Abs(mass - kRhomass*kRhomass) < fCutRhoV * 5)
-          {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.1396);
-	    
-	    fControlConvResoncances->Fill(4, mass - kRhomass*kRhomass);
-	    
-	    if (mass > (kRhomass-fCutRhoV)*(kRhomass-fCutRhoV) && mass < (kRhomass+fCutRhoV)*(kRhomass+fCutRhoV))
-	      continue;
-	  }
-	}
-
-        // User-defined cut
-	if (twoTrackCuts && fCutCustomMass > 0 && fCutCustomFirst > 0 && fCutCustomSecond > 0 && fCutCustomV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
-        {
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), fCutCustomFirst, fCutCustomSecond);
-	  
-	  if (TMath::Abs(mass - fCutCustomMass*fCutCustomMass) < fCutCustomV * 5)
-          {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), fCutCustomFirst, fCutCustomSecond);
-	    
-	    fControlConvResoncances->Fill(5, mass - fCutCustomMass*fCutCustomMass);
-	    
-	    if (mass > (fCutCustomMass-fCutCustomV)*(fCutCustomMass-fCutCustomV) && mass < (fCutCustomMass+fCutCustomV)*(fCutCustomMass+fCutCustomV))
-	      continue;
-	  }
-	}
-
-	if (twoTrackCuts && twoTrackEfficiencyCutValue > 0)
-	{
-	  // the variables & cuthave been developed by the HBT group 
-	  // see e.g. https://indico.cern.ch/materialDisplay.py?contribId=36&sessionId=6&materialId=slides&confId=142700
-
-	  Float_t phi1 = triggerParticle->Phi();
-	  Float_t pt1 = triggerParticle->Pt();
-	  Float_t charge1 = triggerParticle->Charge();
-	    
-	  Float_t phi2 = particle->Phi();
-	  Float_t pt2 = particle->Pt();
-	  Float_t charge2 = particle->Charge();
-	      
-	  Float_t deta = triggerEta - eta[j];
-	      
-	  // optimization
-	  if (TMath::Abs(deta) < twoTrackEfficiencyCutValue * 2.5 * 3)
-	  {
-	    // check first boundaries to see if is worth to loop and find the minimum
-	    Float_t dphistar1 = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, fTwoTrackCutMinRadius, bSign);
-	    Float_t dphistar2 = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, 2.5, bSign);
-	    
-	    const Float_t kLimit = twoTrackEfficiencyCutValue * 3;
-
-	    Float_t dphistarminabs = 1e5;
-	    Float_t dphistarmin = 1e5;
-	    if (TMath::Abs(dphistar1) < kLimit || TMath::Abs(dphistar2) < kLimit || dphistar1 * dphistar2 < 0)
-	    {
-	      for (Double_t rad=fTwoTrackCutMinRadius; rad<2.51; rad+=0.01) 
-	      {
-		Float_t dphistar = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, rad, bSign);
-
-		Float_t dphistarabs = TMath::Abs(dphistar);
-		
-		if (dphistarabs < dphistarminabs)
-		{
-		  dphistarmin = dphistar;
-		  dphistarminabs = dphistarabs;
-		}
-	      }
-	      
-	      fTwoTrackDistancePt[0]->Fill(deta, dphistarmin, TMath::Abs(pt1 - pt2));
-	      
-	      if (dphistarminabs < twoTrackEfficiencyCutValue && TMath::Abs(deta) < twoTrackEfficiencyCutValue)
-	      {
-// 		Printf("Removed track pair %d %d with %f %f %f %f %f %f %f %f %f", i, j, deta, dphistarminabs, phi1, pt1, charge1, phi2, pt2, charge2, bSign);
-		continue;
-	      }
-
-    	      fTwoTrackDistancePt[1]->Fill(deta, dphistarmin, TMath::Abs(pt1 - pt2));
-	    }
-	  }
-	}
+	if (twoTrackCuts && !AcceptPair(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), triggerParticle->Charge(), particle->Pt(), eta[j], particle->Phi(), particle->Charge(), bSign, twoTrackEfficiencyCutValue))
+	  continue;
         
         Double_t vars[6];
         vars[0] = triggerEta - eta[j];
@@ -1388,6 +1598,7 @@ void AliUEHistograms::Copy(TObject& c) const
   target.fPtOrder = fPtOrder;
   target.fTwoTrackCutMinRadius = fTwoTrackCutMinRadius;
   target.fCheckEventNumberInCorrelation = fCheckEventNumberInCorrelation;
+  target.fUsePairEngine = fUsePairEngine;
 }
 
 //____________________________________________________________________
@@ -1522,6 +1733,74 @@ void AliUEHistograms::ExtendTrackingEfficiency(Bool_t verbose)
       GetUEHist(i)->ExtendTrackingEfficiency(verbose);
 }
 
+Long64_t AliUEHistograms::MergeFiles(TCollection* fileNames, const char* path, const char* objectName)
+{
+  // Merges the AliUEHistograms objects stored in a list of files into this, one file at a time, so that
+  // only one input object is in memory at any time (instead of all of them as when a list is given to Merge)
+  // fileNames: collection of TObjString with the file names
+  // path: path of the object in the files, either the AliUEHistograms itself or a collection 
+  //       containing it (e.g. "PWG4_PhiCorrelations/histosPhiCorrelations")
+  // objectName: name of the object in the collection (default: name of this object)
+  // Returns the number of merged objects (not including this).
+  
+  if (!objectName)
+    objectName = GetName();
+  
+  TIterator* iter = fileNames->MakeIterator();
+  TObject* fileName = 0;
+  TList single;
+  Long64_t count = 0;
+  while ((fileName = iter->Next()))
+  {
+    TFile* file = TFile::Open(fileName->GetName());
+    if (!file || file->IsZombie())
+    {
+      Printf("AliUEHistograms::MergeFiles: ERROR: Cannot open %s", fileName->GetName());
+      delete file;
+      continue;
+    }
+    
+    TObject* obj = file->Get(path);
+    AliUEHistograms* entry = dynamic_cast<AliUEHistograms*> (obj);
+    TCollection* collection = dynamic_cast<TCollection*> (obj);
+    if (!entry && collection)
+      entry = dynamic_cast<AliUEHistograms*> (collection->FindObject(objectName));
+    
+    if (entry)
+    {
+      single.Add(entry);
+      Merge(&single);
+      single.Clear();
+      count++;
+    }
+    else
+      Printf("AliUEHistograms::MergeFiles: ERROR: %s not found in %s:%s", objectName, fileName->GetName(), path);
+    
+    if (collection)
+    {
+      collection->SetOwner(kTRUE);
+      delete collection;
+    }
+    else
+      delete obj;
+    delete file;
+  }
+  delete iter;
+  
+  return count;
+}
+
+//____________________________________________________________________
+void AliUEHistograms::ReducePrecision(Double_t relPrecision)
+{
+  // rounds the content of the AliTHn containers to the statistical precision, see AliTHnBase::ReducePrecision
+  
+  for (Int_t i=0; i<fgkUEHists; i++)
+    if (GetUEHist(i))
+      GetUEHist(i)->ReducePrecision(relPrecision);
+}
+
+//____________________________________________________________________
 void AliUEHistograms::Scale(Double_t factor)
 {
   // scales all contained histograms by the given factor
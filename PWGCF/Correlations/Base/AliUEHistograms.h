@@ -11,6 +11,8 @@
 #include "TNamed.h"
 #include "AliUEHist.h"
 #include "TMath.h"
+#include <vector>
+
 #include "THn.h" // in cxx file causes .../THn.h:257: error: conflicting declaration ‘typedef class THnT<float> THnF’
 
 class AliVParticle;
@@ -18,6 +20,7 @@ class AliVParticle;
 class TList;
 class TSeqCollection;
 class TObjArray;
+class TH1;
 class TH1F;
 class TH2F;
 class TH3F;
@@ -109,6 +112,7 @@ class AliUEHistograms : public TNamed
   void SetTwoTrackCutMinRadius(Float_t min) { fTwoTrackCutMinRadius = min; }
 
   void SetCheckEventNumberInCorrelation(Bool_t val) { fCheckEventNumberInCorrelation = val; }
+  void SetUsePairEngine(Bool_t flag = kTRUE) { fUsePairEngine = flag; }
   void ExtendTrackingEfficiency(Bool_t verbose = kFALSE);
   void Reset();
 
@@ -117,7 +121,9 @@ class AliUEHistograms : public TNamed
   virtual void Copy(TObject& c) const;
 
   virtual Long64_t Merge(TCollection* list);
+  Long64_t MergeFiles(TCollection* fileNames, const char* path, const char* objectName = 0);
   void Scale(Double_t factor);
+  void ReducePrecision(Double_t relPrecision);
   
 protected:
   void FillRegion(AliUEHist::Region region, Float_t zVtx, AliUEHist::CFStep step, AliVParticle* leading, TList* list, Int_t multiplicity);
@@ -126,6 +132,9 @@ protected:
   inline Float_t GetInvMassSquared(Float_t pt1, Float_t eta1, Float_t phi1, Float_t pt2, Float_t eta2, Float_t phi2, Float_t m0_1, Float_t m0_2);
   inline Float_t GetInvMassSquaredCheap(Float_t pt1, Float_t eta1, Float_t phi1, Float_t pt2, Float_t eta2, Float_t phi2, Float_t m0_1, Float_t m0_2);
   inline Float_t GetDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t radius, Float_t bSign);
+  Bool_t AcceptPair(Double_t tPt, Float_t tEta, Double_t tPhi, Short_t tCharge, Double_t aPt, Float_t aEta, Double_t aPhi, Short_t aCharge, Float_t bSign, Float_t twoTrackEfficiencyCutValue);
+  void FillPairBuffers(TObjArray* input, const Float_t* eta, Double_t centrality, Float_t zVtx, Bool_t applyEfficiency, UInt_t resonanceDaughterFlag);
+  void FillPairs(Int_t triggerIndex, AliVParticle* triggerParticle, Float_t triggerEta, Bool_t mixed, Double_t centrality, Float_t zVtx, AliUEHist::CFStep step, Float_t weight, Bool_t fillpT, Bool_t twoTrackCuts, Float_t bSign, Float_t twoTrackEfficiencyCutValue, Bool_t applyEfficiency, TH1* triggerWeighting);
   
   static const Int_t fgkUEHists; // number of histograms
 
@@ -182,12 +191,24 @@ protected:
   Float_t fTwoTrackCutMinRadius; // min radius for TTR cut
 
   Bool_t fCheckEventNumberInCorrelation; // do not correlate two particles from the same event (only works for AliBasicParticles)
+  Bool_t fUsePairEngine;         // fill the correlations from pt sorted arrays of the associated particles (see FillPairs)
+
+  // associated particles of the current FillCorrelations call, sorted by pt if fPtOrder is set
+  std::vector<Double_t> fPairPt;       //! pt
+  std::vector<Float_t> fPairEta;       //! eta
+  std::vector<Double_t> fPairPhi;      //! phi
+  std::vector<Short_t> fPairCharge;    //! charge
+  std::vector<Double_t> fPairEfficiency; //! efficiency correction (fEfficiencyCorrectionAssociated)
+  std::vector<Int_t> fPairIndex;       //! index in the input array
+  std::vector<AliVParticle*> fPairParticle; //! particle
+  std::vector<Float_t> fPairDEta;      //! delta eta to the current trigger particle
+  std::vector<Double_t> fPairDPhi;     //! delta phi to the current trigger particle
 
   Long64_t fRunNumber;           // run number that has been processed
   
   Int_t fMergeCount;		// counts how many objects have been merged together
   
-  ClassDef(AliUEHistograms, 34)  // underlying event histogram container
+  ClassDef(AliUEHistograms, 35)  // underlying event histogram container
 };
 
 Float_t AliUEHistograms::GetDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t radius, Float_t bSign)
@@ -196,6 +196,7 @@ fSkipFastCluster(kFALSE),
 fWeightPerEvent(kFALSE),
 fCustomBinning(),
 fPtOrder(kTRUE),
+fUsePairEngine(kFALSE),
 fTriggersFromDetector(0),
 fAssociatedFromDetector(0),
 fUseUncheckedCentrality(kFALSE),
@@ -388,6 +389,8 @@ void  AliAnalysisTaskPhiCorrelations::CreateOutputObjects()
 
   fHistos->SetPtOrder(fPtOrder);
   fHistosMixed->SetPtOrder(fPtOrder);
+  fHistos->SetUsePairEngine(fUsePairEngine);
+  fHistosMixed->SetUsePairEngine(fUsePairEngine);
 
   fHistos->SetTwoTrackCutMinRadius(fTwoTrackCutMinRadius);
   fHistosMixed->SetTwoTrackCutMinRadius(fTwoTrackCutMinRadius);
@@ -626,6 +629,7 @@ void  AliAnalysisTaskPhiCorrelations::AddSettingsTree()
   settingsTree->Branch("fSkipFastCluster", &fSkipFastCluster,"SkipFastCluster/O");
   settingsTree->Branch("fWeightPerEvent", &fWeightPerEvent,"WeightPerEvent/O");
   settingsTree->Branch("fPtOrder", &fPtOrder,"PtOrder/O");
+  settingsTree->Branch("fUsePairEngine", &fUsePairEngine,"UsePairEngine/O");
   settingsTree->Branch("fTriggersFromDetector", &fTriggersFromDetector,"TriggersFromDetector/I");
   settingsTree->Branch("fAssociatedFromDetector", &fAssociatedFromDetector,"AssociatedFromDetector/I");
   settingsTree->Branch("fUseUncheckedCentrality", &fUseUncheckedCentrality,"UseUncheckedCentrality/O");
@@ -148,6 +148,7 @@ public:
   void SetWeightPerEvent(Bool_t flag = kTRUE) { fWeightPerEvent = flag; }
   void SetCustomBinning(const char* binningStr) { fCustomBinning = binningStr; }
   void SetPtOrder(Bool_t flag) { fPtOrder = flag; }
+  void SetUsePairEngine(Bool_t flag = kTRUE) { fUsePairEngine = flag; }
   void SetTriggersFromDetector(Int_t flag) { fTriggersFromDetector = flag; }
   void SetAssociatedFromDetector(Int_t flag) { fAssociatedFromDetector = flag; }
   void SetUseUncheckedCentrality(Bool_t flag) { fUseUncheckedCentrality = flag; }
@@ -326,6 +327,7 @@ private:
   Bool_t fWeightPerEvent;        // weight with the number of trigger particles per event
   TString fCustomBinning;        // supersedes default binning if set, see AliUEHist::GetBinning or AliUEHistograms::AliUEHistograms for syntax and examples
   Bool_t fPtOrder;               // apply pT,a < pt,t condition; default: kTRUE
+  Bool_t fUsePairEngine;         // fill the correlations with AliUEHistograms::FillPairs; default: kFALSE
   Int_t fTriggersFromDetector;   // 0 = tracks (default); 1 = VZERO_A; 2 = VZERO_C; 3 = SPD tracklets; 4 = forward muons; 5 = tracks w/o jets; 6, 7 = arbitrary AliVParticle-TClonesArrays (see SetCustomParticleArrayA())
   Int_t fAssociatedFromDetector; // 0 = tracks (default); 1 = VZERO_A; 2 = VZERO_C; 3 = SPD tracklets; 4 = forward muons; 5 = tracks w/o jets; 6,7 = arbitrary AliVParticle-TClonesArrays (see SetCustomParticleArrayB())
   Bool_t fUseUncheckedCentrality;// use unchecked centrality; default: kFALSE
@@ -355,7 +357,7 @@ private:
   Bool_t fUsePtBinnedEventPool;                   // uses event pool in pt bins
   Bool_t fCheckEventNumberInMixedEvent;           // check event number before correlation in mixed event
 
-  ClassDef(AliAnalysisTaskPhiCorrelations, 66); // Analysis task for delta phi correlations
+  ClassDef(AliAnalysisTaskPhiCorrelations, 67); // Analysis task for delta phi correlations
 };
 
 #endif
@@ -871,6 +871,7 @@ void AliAnalysisSPC::CalculateQvectors(Int_t CalculateQvectors_nParticles, Doubl
   } // for(Int_t h=0;h<kMaxHarmonic;h++)
  } //  for(Int_t i=0;i<fParticles;i++) // loop over particles
 
+ fCorrelator.SetQvectors(&fQvector[0][0],113,15); // Q-vectors changed: previously calculated correlators are not valid anymore
 
 } // void AliAnalysisSPC::CalculateQvectors(Int_t CalculateQvectors_nParticles, Double_t* CalculateQvectors_angles, Double_t* CalculateQvectors_weights)
 
@@ -920,37 +921,10 @@ TComplex AliAnalysisSPC::Q(Int_t n, Int_t p)
 TComplex AliAnalysisSPC::Recursion(Int_t n, Int_t* harmonic, Int_t mult = 1, Int_t skip = 0) 
 {
  // Calculate multi-particle correlators by using recursion (an improved faster version) originally developed by 
- // Kristjan Gulbrandsen (gulbrand@nbi.dk). 
-
-  Int_t nm1 = n-1;
-  TComplex c(Q(harmonic[nm1], mult));
-  if (nm1 == 0) return c;
-  c *= Recursion(nm1, harmonic);
-  if (nm1 == skip) return c;
-
-  Int_t multp1 = mult+1;
-  Int_t nm2 = n-2;
-  Int_t counter1 = 0;
-  Int_t hhold = harmonic[counter1];
-  harmonic[counter1] = harmonic[nm2];
-  harmonic[nm2] = hhold + harmonic[nm1];
-  TComplex c2(Recursion(nm1, harmonic, multp1, nm2));
-  Int_t counter2 = n-3;
-  while (counter2 >= skip) {
-    harmonic[nm2] = harmonic[counter1];
-    harmonic[counter1] = hhold;
-    ++counter1;
-    hhold = harmonic[counter1];
-    harmonic[counter1] = harmonic[nm2];
-    harmonic[nm2] = hhold + harmonic[nm1];
-    c2 += Recursion(nm1, harmonic, multp1, counter2);
-    --counter2;
-  }
-  harmonic[nm2] = harmonic[counter1];
-  harmonic[counter1] = hhold;
+ // Kristjan Gulbrandsen (gulbrand@nbi.dk). The subterms are memoized in fCorrelator for the current Q-vectors,
+ // so that the numerators, denominators and covariance terms of one event share them.
 
-  if (mult == 1) return c-c2;
-  return c-Double_t(mult)*c2;
+ return fCorrelator.Recursion(n, harmonic, mult, skip);
 
 } // TComplex AliFlowAnalysisWithMultiparticleCorrelations::Recursion(Int_t n, Int_t* harmonic, Int_t mult = 1, Int_t skip = 0) 
 
@@ -27,6 +27,7 @@
 #include "TList.h"
 #include "TFile.h"
 #include "AliJEfficiency.h"
+#include "AliJMultiCorrelator.h"
 #include "TSystem.h"
 
 class TClonesArray;
@@ -191,6 +192,7 @@ private:
   Int_t fi1, fi2, fi3, fi4, fi5, fi6, fi7;  //eigth set of harmonics 
   
   TComplex fQvector[113][15];       	// //[fMaxHarmonic*fMaxCorrelator+1][fMaxCorrelator+1] 
+  AliJMultiCorrelator fCorrelator; //! memoized recursion over fQvector
 
   // 4.) Final results:
    
@@ -215,7 +217,7 @@ private:
   TProfile *fProfileTrackCuts;  	//! Profile to save the cut values for track selection
   TList *fFinalResultsList[16];      	//! List to hold all histograms with final results for a specific centrality bin. Up to 16 centraliy bins possible
 
-  ClassDef(AliAnalysisSPC,5); 
+  ClassDef(AliAnalysisSPC,6); 
 };
 
 //================================================================================================================
@@ -22,6 +22,7 @@
 #include "TClonesArray.h"
 
 #include "AliJEfficiency.h"
+#include "AliJMultiCorrelator.h"
 
 class TClonesArray;
 class AliAnalysisSPCRun2 {
@@ -107,6 +108,7 @@ class AliAnalysisSPCRun2 {
   TProfile *fProfileTrackCuts;      //! Storage of the values used in some cuts.
 
   TComplex fQvector[113][15];       // All combinations of Q-vectors.
+  AliJMultiCorrelator fCorrelator;  //! Memoized recursion over fQvector.
   Int_t fHarmosArray[12][8];        // Array of combinations of harmonics for the SPC.
   
   TList *fCentralityList[16];       //! Results per centrality bins. Up to 16 possible bins.
@@ -131,7 +133,7 @@ class AliAnalysisSPCRun2 {
   TProfile *fProfileTPCEta[16];     //! Profile for 2-particle eta gap computation.
   Float_t fCentralityArray[17];     //! Edges for the centrality division. (0-80% with 5% width).
 
-  ClassDef(AliAnalysisSPCRun2, 1); 
+  ClassDef(AliAnalysisSPCRun2, 2); 
 };
 
 #endif  // ALIANALYSISSPCRUN2
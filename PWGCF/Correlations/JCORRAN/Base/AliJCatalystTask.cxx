@@ -55,6 +55,8 @@ AliJCatalystTask::AliJCatalystTask():
   AliAnalysisTaskSE(),
   fInputList(0),
   fInputListALICE(0),
+  fTrackColumns(0),
+  fTrackColumnsFilled(kFALSE),
   //fOutput(0),
   fCentDetName("V0M"),
   paodEvent(0),
@@ -114,6 +116,8 @@ AliJCatalystTask::AliJCatalystTask(const char *name):
   AliAnalysisTaskSE(name),
   fInputList(0),
   fInputListALICE(0),
+  fTrackColumns(0),
+  fTrackColumnsFilled(kFALSE),
   //fOutput(0),
   fTaskName(name),
   fCentDetName("V0M"),
@@ -182,6 +186,8 @@ AliJCatalystTask::AliJCatalystTask(const AliJCatalystTask& ap) :
   AliAnalysisTaskSE(ap.GetName()),
   fInputList(ap.fInputList),
   fInputListALICE(ap.fInputListALICE),
+  fTrackColumns(0),
+  fTrackColumnsFilled(kFALSE),
   //fOutput(ap.fOutput),
   fcent(ap.fcent),
   fZvert(ap.fZvert),
@@ -223,11 +229,25 @@ AliJCatalystTask& AliJCatalystTask::operator = (const AliJCatalystTask& ap)
   return *this;
 }
 
+//______________________________________________________________________________
+AliJTrackColumns *AliJCatalystTask::GetTrackColumns()
+{
+  // Columns of fInputList, filled at the first call in the event and shared
+  // by all the wagons reading this catalyst
+  if(!fTrackColumns) fTrackColumns = new AliJTrackColumns();
+  if(!fTrackColumnsFilled){
+    fTrackColumns->Fill(fInputList);
+    fTrackColumnsFilled = kTRUE;
+  }
+  return fTrackColumns;
+}
+
 //______________________________________________________________________________
 AliJCatalystTask::~AliJCatalystTask()
 {
   delete fInputList;
   delete fInputListALICE;
+  delete fTrackColumns;
   if (fMainList) {delete fMainList;}
 }
 
@@ -270,6 +290,7 @@ void AliJCatalystTask::UserExec(Option_t* /*option*/)
   fJCatalystEntry = fEntry;
   fInputList->Clear();
   fInputListALICE->Clear();
+  fTrackColumnsFilled = kFALSE;
 
   float fImpactParameter = .0; // setting 0 for the generator which doesn't have this info. 
   double fvertex[3];
@@ -441,6 +462,7 @@ void AliJCatalystTask::Init()
 //______________________________________________________________________________
 void AliJCatalystTask::ReadAODTracks(AliAODEvent *aod, TClonesArray *TrackList, float fcent)
 {
+  AliJCorrectionMapTask::PhiWeightLookup phiWeights(pPhiWeights,fZvert); // vertex bin found once per event
   //aod->Print();
   if(flags & FLUC_MC) {  // how to get a flag to check  MC or not !
     TClonesArray *mcArray;
@@ -627,7 +649,7 @@ void AliJCatalystTask::ReadAODTracks(AliAODEvent *aod, TClonesArray *TrackList,
             if(pPhiWeights) {
               Double_t phi = itrack->Phi();
               Double_t eta = itrack->Eta();
-              w = pPhiWeights->GetBinContent(pPhiWeights->FindBin(phi,eta,fZvert));
+              w = phiWeights.GetWeight(phi,eta);
             }
             else {
               w = 1.0;
@@ -27,6 +27,7 @@
 #include "AliVVertex.h"
 #include "AliStack.h"
 #include "AliJCorrectionMapTask.h"
+#include "AliJTrackColumns.h"
 #include "TH1F.h"
 #include "TFile.h"
 #include "AliEventCuts.h"
@@ -67,6 +68,8 @@ public:
 	// Particle list
 	TClonesArray * GetInputList() const{return fInputList;}
 	TClonesArray * GetInputListALICE() const{return fInputListALICE;}
+	// Same tracks as plain arrays, with the phi and efficiency corrections
+	AliJTrackColumns * GetTrackColumns();
 	// Getters Event Info, centrality, zvertex, runnumber
 	inline float GetCentrality() const{return fcent;};
 	inline double GetZVertex() const{return fZvert;};
@@ -169,6 +172,8 @@ public:
 private:
 	TClonesArray * fInputList;  // tracklist
 	TClonesArray * fInputListALICE;  // tracklist ALICE acceptance +-0.8 eta
+	AliJTrackColumns *fTrackColumns; //! columns of fInputList
+	Bool_t fTrackColumnsFilled; //! fTrackColumns filled for this event
 	//TDirectory *fOutput;     // output
 	TString fTaskName; //
 	TString fCentDetName; //
@@ -255,6 +260,6 @@ private:
 
   TH1F *fHistoCentWeight[138];		// Histograms to save the centrality correction for 15o per run.
 
-  ClassDef(AliJCatalystTask, 8);
+  ClassDef(AliJCatalystTask, 9);
 };
 #endif // AliJCatalystTask_H
@@ -265,6 +265,42 @@ double AliJCorrectionMapTask::GetEffCorrection(TGraphErrors *gr, double pt) cons
 	return cor;
 }
 
+void AliJCorrectionMapTask::GetEffCorrection(TGraphErrors *gr, UInt_t n, const double *pt, double *cor) const{
+	for(UInt_t i = 0; i < n; i++)
+		cor[i] = GetEffCorrection(gr,pt[i]);
+}
+
+AliJCorrectionMapTask::PhiWeightLookup::PhiWeightLookup(TH1 *pmap, double zvtx):
+	fMap(pmap),
+	fStrideY(0),
+	fOffsetZ(0)
+{
+	if(!fMap)
+		return;
+	SetAxis(fAxis[0],fMap->GetXaxis());
+	SetAxis(fAxis[1],fMap->GetYaxis());
+	const int dim = fMap->GetDimension();
+	if(dim > 1)
+		fStrideY = fAxis[0].fN+2;
+	if(dim > 2){
+		Axis z;
+		SetAxis(z,fMap->GetZaxis());
+		fOffsetZ = fStrideY*(fAxis[1].fN+2)*FindAxisBin(z,zvtx);
+	}
+}
+
+void AliJCorrectionMapTask::PhiWeightLookup::SetAxis(Axis &a, const TAxis *pAxis){
+	a.fMin = pAxis->GetXmin();
+	a.fMax = pAxis->GetXmax();
+	a.fN = pAxis->GetNbins();
+	a.fEdges = pAxis->GetXbins()->fN ? pAxis->GetXbins()->GetArray() : 0;
+}
+
+void AliJCorrectionMapTask::PhiWeightLookup::GetWeight(UInt_t n, const double *phi, const double *eta, double *w) const{
+	for(UInt_t i = 0; i < n; i++)
+		w[i] = GetWeight(phi[i],eta[i]);
+}
+
 //std::tuple<TH1 *, double> AliJCorrectionMapTask::GetEffCorrectionMap2(UInt_t run, EFF2_LABEL effLabel){
 TH1 * AliJCorrectionMapTask::GetEffCorrectionMap2(UInt_t run, EFF2_LABEL effLabel, double &V0mean){
 	auto m = std::find_if(runPeriods.begin(),runPeriods.end(),[&](/*auto &t*/const RunPeriod &t)->bool{
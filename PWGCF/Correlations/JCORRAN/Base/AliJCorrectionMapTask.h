@@ -18,6 +18,8 @@
 #include <iomanip>
 
 #include "AliAnalysisTaskSE.h"
+#include <TH1.h>
+#include <TMath.h>
 
 //==============================================================
 
@@ -67,8 +69,41 @@ public:
 	TH1 * GetCentCorrection();
 	TGraphErrors * GetEffCorrectionMap(UInt_t run, Double_t cent, UInt_t fEffFilterBit);
 	double GetEffCorrection(TGraphErrors *gCor, double pt ) const ;
+	void GetEffCorrection(TGraphErrors *gCor, UInt_t n, const double *pt, double *cor) const; // n tracks
 	TAxis * GetCentBinEff();
 
+	// Lookup in a phi weight map (phi, eta[, zvtx]) for the tracks of one
+	// event, equivalent to map->GetBinContent(map->FindBin(phi,eta,zvtx)).
+	// The vertex bin is found once, the phi and eta bins are computed
+	// directly from the axis parameters
+	class PhiWeightLookup{
+	public:
+		PhiWeightLookup(TH1 *pmap, double zvtx);
+		bool IsValid() const{return fMap != 0;}
+		double GetWeight(double phi, double eta) const{
+			return fMap->GetBinContent(FindAxisBin(fAxis[0],phi)+fStrideY*FindAxisBin(fAxis[1],eta)+fOffsetZ);
+		}
+		void GetWeight(UInt_t n, const double *phi, const double *eta, double *w) const; // n tracks
+	private:
+		struct Axis{
+			double fMin;
+			double fMax;
+			int fN;
+			const double *fEdges; // 0 for fixed bins
+		};
+		static void SetAxis(Axis &a, const TAxis *pAxis);
+		static int FindAxisBin(const Axis &a, double x){ // as TAxis::FindFixBin
+			if(x < a.fMin) return 0;
+			if(!(x < a.fMax)) return a.fN+1;
+			if(!a.fEdges) return 1+int(a.fN*(x-a.fMin)/(a.fMax-a.fMin));
+			return 1+TMath::BinarySearch(a.fN+1,a.fEdges,x);
+		}
+		TH1 *fMap;
+		Axis fAxis[2];
+		int fStrideY;
+		int fOffsetZ;
+	};
+
 	struct RunPeriod{
 		UInt_t runStart;
 		UInt_t runEnd;
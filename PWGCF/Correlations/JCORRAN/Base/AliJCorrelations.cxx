@@ -291,7 +291,7 @@ void AliJCorrelations::FillAzimuthHistos(fillType fTyp, int CentBin, int ZBin, A
   
   fIsIsolatedTrigger =  ftk1->GetIsIsolated()>0  ? true : false; //FK// trigger particle is isolated hadron
   
-  TLorentzVector vTrigger = ftk1->GetLorentzVector(), vAssoc = ftk2->GetLorentzVector();    // Lorentz vectors for trigger and associated particles
+  const TLorentzVector &vTrigger = *ftk1, &vAssoc = *ftk2;    // Lorentz vectors for trigger and associated particles, no copy per pair
   
   //phit= ftk1->Phi();                                 //for RP
   fpttBin       = ftk1->GetTriggBin();
@@ -306,7 +306,8 @@ void AliJCorrelations::FillAzimuthHistos(fillType fTyp, int CentBin, int ZBin, A
   //double dEtaFar   = ftk1->Eta() + ftk2->Eta();
   
   fNearSide     = cos(fPhiTrigger-fPhiAssoc) > 0 ? true : false;  // Traditional near side definition using deltaPhi
-  fNearSide3D   = vTrigger.Vect().Dot(vAssoc.Vect()) > 0 ? true : false; // Near side definition using half ball around the trigger
+  const double pDot = vTrigger.Vect().Dot(vAssoc.Vect());
+  fNearSide3D   = pDot > 0 ? true : false; // Near side definition using half ball around the trigger
 
   fEtaGapBin = fcard->GetBin( kEtaGapType, fabs(fDeltaEta));
   fPhiGapBinNear = fcard->GetBin( kEtaGapType, fabs(fDeltaPhiPiPi) );
@@ -316,7 +317,7 @@ void AliJCorrelations::FillAzimuthHistos(fillType fTyp, int CentBin, int ZBin, A
   fCentralityBin = CentBin;
   
   
-  fXlong = vTrigger.Vect().Dot(vAssoc.Vect())/pow(vTrigger.P(),2);
+  fXlong = pDot/pow(vTrigger.P(),2);
   fXlongBin = fcard->GetBin(kXeType, TMath::Abs(fXlong));
   
   //if( rGapBin != fRGapBinNear ) cout<<"dR vs fRGapBinNear = "<<rGapBin<<"\t"<<fRGapBinNear<<endl;
@@ -342,11 +343,6 @@ void AliJCorrelations::FillAzimuthHistos(fillType fTyp, int CentBin, int ZBin, A
   // =====================  Fill Histograms  ===========================
   // ===================================================================
   
-  bool fill2DBackgroundQualityControlHistograms = false;  // Choose whether to fill the DeltaPhi DeltaEta histograms for jT background
-  
-  // If quality control level is high enough, fill 2D quality control histograms
-  if(fcard->Get("QualityControlLevel")>1) fill2DBackgroundQualityControlHistograms = true;
-  
   //if(fhistos->fhCosThetaStar.Dimension()>0) FillPairPtAndCosThetaStarHistograms(fTyp, ftk1, ftk2);  // Fill the pair pT and cos(theta*) histograms TODO: Does not work! Needs debugging
   if(fhistos->fhxEF.Dimension()>0) FillXeHistograms(fTyp);  // Fill the xE and xLong histograms
   FillDeltaEtaHistograms(fTyp, ZBin);  // Fill all the delta eta histograms
@@ -446,10 +442,10 @@ void AliJCorrelations::FillDeltaEtaHistograms(fillType fTyp, int ZBin)
   
   if( fNearSide ){ //one could check the phiGapBin, but in the pi/2 <1.6 and thus phiGap is always>-1
     if( fTyp == 0 ) {
-      fhistos->fhDEtaNear[fCentralityBin][ZBin][fPhiGapBinNear][fpttBin][fptaBin]->Fill( fDeltaEta , fGeometricAcceptanceCorrection * fTrackPairEfficiency );
+      fhistos->fhDEtaNear(fCentralityBin,ZBin,fPhiGapBinNear,fpttBin,fptaBin)->Fill( fDeltaEta , fGeometricAcceptanceCorrection * fTrackPairEfficiency );
     } else {
-      fhistos->fhDEtaNearM[fCentralityBin][ZBin][fPhiGapBinNear][fpttBin][fptaBin]->Fill( fDeltaEta , fGeometricAcceptanceCorrection * fTrackPairEfficiency );
-      fhistos->fhDetaNearMixAcceptance[fCentralityBin][fpttBin][fptaBin]->Fill( fDeltaEta, fTrackPairEfficiency);
+      fhistos->fhDEtaNearM(fCentralityBin,ZBin,fPhiGapBinNear,fpttBin,fptaBin)->Fill( fDeltaEta , fGeometricAcceptanceCorrection * fTrackPairEfficiency );
+      fhistos->fhDetaNearMixAcceptance(fCentralityBin,fpttBin,fptaBin)->Fill( fDeltaEta, fTrackPairEfficiency);
     }
   } else {
     if(fPhiGapBinAway<=3) fhistos->fhDEtaFar[fTyp][fCentralityBin][fpttBin]->Fill( fDeltaEta, fGeometricAcceptanceCorrection * fTrackPairEfficiency );
@@ -475,7 +471,7 @@ void AliJCorrelations::FillDeltaPhiHistograms(fillType fTyp)
   // When hists are filled for thresholds they are not properly normalized and need to be subtracted
   // This induced improper errors - subtraction of not-independent entries
   
-  fhistos->fhDphiAssoc[fTyp][fCentralityBin][fEtaGapBin][fpttBin][fptaBin]->Fill( fDeltaPhi/kJPi , fGeometricAcceptanceCorrection * fTrackPairEfficiency);
+  fhistos->fhDphiAssoc(fTyp,fCentralityBin,fEtaGapBin,fpttBin,fptaBin)->Fill( fDeltaPhi/kJPi , fGeometricAcceptanceCorrection * fTrackPairEfficiency);
   if(fXlongBin>=0 && fNearSide3D) fhistos->fhDphiAssocXEbin[fTyp][fCentralityBin][fEtaGapBin][fpttBin][fXlongBin]->Fill( fDeltaPhi/kJPi , fGeometricAcceptanceCorrection3D * fTrackPairEfficiency);
   
   if(fIsIsolatedTrigger) fhistos->fhDphiAssocIsolTrigg[fTyp][fCentralityBin][fpttBin][fptaBin]->Fill( fDeltaPhi/kJPi , fGeometricAcceptanceCorrection * fTrackPairEfficiency); //FK//
@@ -488,7 +484,7 @@ void AliJCorrelations::FillDeltaEtaDeltaPhiHistograms(fillType fTyp, int zBin)
   
   // Fill the histogram in pTa bins
   if(fNearSide){
-    fhistos->fhDphiDetaPta[fTyp][fCentralityBin][zBin][fpttBin][fptaBin]->Fill(fDeltaEta, fDeltaPhiPiPi, fTrackPairEfficiency);
+    fhistos->fhDphiDetaPta(fTyp,fCentralityBin,zBin,fpttBin,fptaBin)->Fill(fDeltaEta, fDeltaPhiPiPi, fTrackPairEfficiency);
   }
   
   // Fill the histogram in xlong bins
@@ -504,7 +500,7 @@ void AliJCorrelations::FillPtaHistograms(fillType fTyp)
   
   if ( fTyp == kReal ) {
     //must be here, not in main, to avoid counting triggers
-    fhistos->fhAssocPtBin[fCentralityBin][fpttBin][fptaBin]->Fill(fpta ); //I think It should not be weighted by Eff
+    fhistos->fhAssocPtBin(fCentralityBin,fpttBin,fptaBin)->Fill(fpta ); //I think It should not be weighted by Eff
     
     //++++++++++++++++++++++++++++++++++++++++++++++++++
     // in order to get mean pTa in the jet peak one has
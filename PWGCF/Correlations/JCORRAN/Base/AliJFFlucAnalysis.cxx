@@ -6,6 +6,7 @@
 #include <TComplex.h>
 #include <TClonesArray.h>
 #include "AliJBaseTrack.h"
+#include "AliJTrackColumns.h"
 #include "AliJFFlucAnalysis.h"
 #pragma GCC diagnostic warning "-Wall"
 
@@ -15,6 +16,7 @@
 AliJFFlucAnalysis::AliJFFlucAnalysis() :
 	//: AliAnalysisTaskSE(),
 	fInputList(0),
+	fInputColumns(0),
 	fVertex(0),
 	fCent(0),
 	fCBin(0),
@@ -58,6 +60,7 @@ AliJFFlucAnalysis::AliJFFlucAnalysis() :
 AliJFFlucAnalysis::AliJFFlucAnalysis(const char *name) :
 	//: AliAnalysisTaskSE(name),
 	fInputList(0),
+	fInputColumns(0),
 	fVertex(0),
 	fCent(0),
 	fCBin(0),
@@ -121,6 +124,7 @@ UInt_t AliJFFlucAnalysis::NpttJacek = sizeof(AliJFFlucAnalysis::pttJacek)/sizeof
 AliJFFlucAnalysis::AliJFFlucAnalysis(const AliJFFlucAnalysis& a):
 	//AliAnalysisTaskSE(a.GetName()),
 	fInputList(a.fInputList),
+	fInputColumns(a.fInputColumns),
 	fVertex(a.fVertex),
 	fCent(a.fCent),
 	fCBin(a.fCBin),
@@ -529,12 +533,13 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 		for(int ih=2; ih<kNH; ih++){
 			for(int ik=1; ik<nKL; ik++){ // 2k(0) =1, 2k(1) =2, 2k(2)=4....
 				vn2[ih][ik] = corr[ih][ik].Re()/ref_2Np[ik-1];
-				fh_vn[ih][ik][fCBin]->Fill(vn2[ih][ik],ebe_2Np_weight[ik-1]);
-				fh_vna[ih][ik][fCBin]->Fill(ncorr[ih][ik].Re()/ref_2Np[ik-1],ebe_2Np_weight[ik-1]);
+				const int iG = fh_vn.GlobalIndex(ih,ik,fCBin); // same binning for fh_vna
+				fh_vn.At(iG)->Fill(vn2[ih][ik],ebe_2Np_weight[ik-1]);
+				fh_vna.At(iG)->Fill(ncorr[ih][ik].Re()/ref_2Np[ik-1],ebe_2Np_weight[ik-1]);
 				for(int ihh=2; ihh<kcNH; ihh++){
 					for(int ikk=1; ikk<nKL; ikk++){
 						vn2_vn2[ih][ik][ihh][ikk] = ncorr2[ih][ik][ihh][ikk]/ref_2Np[ik+ikk-1];//(ncorr[ih][ik]*ncorr[ihh][ikk]).Re()/ref_2Np[ik+ikk-1];
-						fh_vn_vn[ih][ik][ihh][ikk][fCBin]->Fill(vn2_vn2[ih][ik][ihh][ikk],ebe_2Np_weight[ik+ikk-1]); // Fill hvn_vn
+						fh_vn_vn.At(fh_vn_vn.GlobalIndex(ih,ik,ihh,ikk,fCBin))->Fill(vn2_vn2[ih][ik][ihh][ikk],ebe_2Np_weight[ik+ikk-1]); // Fill hvn_vn
 					}
 				}
 			}
@@ -839,10 +844,22 @@ void AliJFFlucAnalysis::CalculateQvectorsQC(double etamin, double etamax){
 		}
 	} // for max harmonics
 	//Calculate Q-vector with particle loop
-	Long64_t ntracks = fInputList->GetEntriesFast(); // all tracks from Task input
+	const AliJTrackColumns *pcol = fInputColumns; // same tracks as plain arrays, if given
+	Long64_t ntracks = pcol?pcol->GetN():fInputList->GetEntriesFast(); // all tracks from Task input
 	for( Long64_t it=0; it<ntracks; it++){
-		AliJBaseTrack *itrack = (AliJBaseTrack*)fInputList->At(it); // load track
-		Double_t eta = itrack->Eta();
+		Double_t eta, phi, tw;
+		if(pcol){
+			eta = pcol->GetEta()[it];
+			phi = pcol->GetPhi()[it];
+			tw = pcol->GetWeight()[it];
+		}else{
+			AliJBaseTrack *itrack = (AliJBaseTrack*)fInputList->At(it); // load track
+			eta = itrack->Eta();
+			phi = itrack->Phi();
+			Double_t effCorr = itrack->GetTrackEff();//fEfficiency->GetCorrection( pt, fEffFilterBit, fCent);
+			Double_t phi_module_corr = itrack->GetWeight();
+			tw = 1.0/(phi_module_corr*effCorr);
+		}
 		// track Eta cut Note! pt cuts already applied in AliJFFlucTask.cxx
 		// Do we need arbitary Eta cut for QC method?
 		// fixed eta ranged -0.8 < eta < 0.8 for QC
@@ -856,24 +873,20 @@ void AliJFFlucAnalysis::CalculateQvectorsQC(double etamin, double etamax){
 		/////////////////////////////////////////////////
 
 		int isub = (int)(eta > 0.0);
-		Double_t phi = itrack->Phi();
-		Double_t pt = itrack->Pt();
-
-		Double_t effCorr = itrack->GetTrackEff();//fEfficiency->GetCorrection( pt, fEffFilterBit, fCent);	
-		Double_t phi_module_corr = itrack->GetWeight();
 
 		for(int ih=0; ih<kNH; ih++){
 			Double_t tf = 1.0;
 			TComplex q[nKL];
+			const Double_t cosnphi = TMath::Cos(ih*phi), sinnphi = TMath::Sin(ih*phi); // same for all the powers of the weight
 			for(int ik=0; ik<nKL; ik++){
-				q[ik] = TComplex(tf*TMath::Cos(ih*phi),tf*TMath::Sin(ih*phi));
+				q[ik] = TComplex(tf*cosnphi,tf*sinnphi);
 				QvectorQC[ih][ik] += q[ik];
 
 				//this is for normalized SC ( denominator needs an eta gap )
 				if(TMath::Abs(eta) > etamin)//fQC_eta_gap_half)
 					QvectorQCeta10[isub][ih][ik] += q[ik];
 
-				tf *= 1.0/(phi_module_corr*effCorr);
+				tf *= tw;
 			}
 		}
 	} // track loop done.
@@ -8,6 +8,7 @@
 //#include <TF3.h>
 
 class TClonesArray;
+class AliJTrackColumns;
 
 class AliJFFlucAnalysis{// : public AliAnalysisTaskSE {
 public:
@@ -24,6 +25,7 @@ public:
 
 	void SetInputList(TClonesArray *inputarray){fInputList = inputarray;}
 	TClonesArray * GetInputList() const{return fInputList;}
+	void SetInputColumns(const AliJTrackColumns *columns){fInputColumns = columns;} // optional, same tracks as fInputList
 	void SetEventCentrality( float cent ){fCent = cent;}
 	float GetEventCentrality() const{return fCent;}
 	void SetEventImpactParameter( float ip ){ fImpactParameter = ip; }
@@ -114,6 +116,7 @@ public:
 private:
 
 	TClonesArray *fInputList;
+	const AliJTrackColumns *fInputColumns; // columns of fInputList (not owned), 0 to read the list
 	//AliJEfficiency *fEfficiency;
 	const Double_t *fVertex;//!
 	//TH1 *pPhiWeights;//!
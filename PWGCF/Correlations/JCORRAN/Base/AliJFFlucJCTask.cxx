@@ -91,6 +91,7 @@ void AliJFFlucJCTask::UserExec(Option_t *pOpt){
 
 	pfa->Init();
 	pfa->SetInputList(fJCatalystTask->GetInputList());
+	pfa->SetInputColumns(fJCatalystTask->GetTrackColumns());
 	pfa->SetEventCentrality(fJCatalystTask->GetCentrality());
 	pfa->SetEventVertex(fVertex);
 	pfa->SetEtaRange(fJCatalystTask->GetEtaMin(),fJCatalystTask->GetEtaMax()); //technically doesn't matter since catalyst has readily done the cutting
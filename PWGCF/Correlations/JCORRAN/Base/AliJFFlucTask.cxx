@@ -324,6 +324,7 @@ void AliJFFlucTask::Init()
 //______________________________________________________________________________
 void AliJFFlucTask::ReadAODTracks(AliAODEvent *aod, TClonesArray *TrackList)
 {
+	AliJCorrectionMapTask::PhiWeightLookup phiWeights(pPhiWeights,fVertex[2]); // vertex bin found once per event
 	//aod->Print();
 	if(flags & FLUC_MC){  // how to get a flag to check  MC or not !
 		TClonesArray *mcArray = (TClonesArray*) aod->FindListObject(AliAODMCParticle::StdBranchName());
@@ -465,7 +466,7 @@ void AliJFFlucTask::ReadAODTracks(AliAODEvent *aod, TClonesArray *TrackList)
 					if(pPhiWeights) {
 						Double_t phi = itrack->Phi();
 						Double_t eta = itrack->Eta();
-						w = pPhiWeights->GetBinContent(pPhiWeights->FindBin(phi,eta,fVertex[2]));
+						w = phiWeights.GetWeight(phi,eta);
 					} else {
 						w = 1.0;
 					}
@@ -269,6 +269,27 @@ void* AliJArrayBase::GetItem(){
     return item;
 }
 //_____________________________________________________
+int AliJArrayBase::GlobalIndex( int i0, int i1, int i2, int i3, int i4, int i5 ){
+    const int index[] = { i0, i1, i2, i3, i4, i5 };
+    const int nIndex = sizeof(index)/sizeof(index[0]);
+    if( Dimension() > nIndex ) JERROR(Form("Too many dimensions for GlobalIndex in %s", fName.Data()));
+    for( int d=0;d<nIndex;d++ ){
+        if( d < Dimension() ? OutOfSize( index[d], d ) : index[d] != -1 )
+            JERROR(Form("wrong Index %d of %dth in %s", index[d], d, fName.Data()));
+    }
+    return fAlg->GlobalIndex( index );
+}
+//_____________________________________________________
+void* AliJArrayBase::GetItemAt( int iG ){
+    void * item = fAlg->GetItemAt( iG );
+    if( !item ){
+        fAlg->SetGlobalIndex( iG ); // BuildItem names the entry after fIndex
+        BuildItem() ;
+        item = fAlg->GetItemAt( iG );
+    }
+    return item;
+}
+//_____________________________________________________
 void* AliJArrayBase::GetSingleItem(){
     if(fMode == kSingle )return GetItem();
     JERROR("This is not single array");
@@ -389,6 +410,12 @@ int  AliJArrayAlgorithmSimple::GlobalIndex(){
     return iG;
 
 }
+int  AliJArrayAlgorithmSimple::GlobalIndex( const int * index ){
+    int iG = 0;
+    for( int i=0;i<Dimension();i++ ) // index is checked by fCMD
+        iG+= index[i]*fDimFactor[i];
+    return iG;
+}
 void AliJArrayAlgorithmSimple::ReverseIndex( int iG ){
     int n = iG;
     for( int i=0;i<Dimension();i++ ){
@@ -31,6 +31,7 @@ class AliJTH1;
 class AliJHistManager;
 template<typename t> class AliJTH1Derived;
 template<typename t> class AliJTH1DerivedPlayer;
+template<typename t> class AliJTH1Handle;
 
 //////////////////////////////////////////////////////
 //  Utils
@@ -158,6 +159,10 @@ class AliJArrayBase : public AliJNamed{
 
         void * GetItem();
         void * GetSingleItem();
+        // Flat index of an entry, to be resolved with GetItemAt without the
+        // operator[] chain. Give one index per dimension.
+        int  GlobalIndex( int i0, int i1=-1, int i2=-1, int i3=-1, int i4=-1, int i5=-1 );
+        void * GetItemAt( int iG );
 
         ///void LockBin(bool is=true){}//TODO
         //bool IsBinLocked(){ return fIsBinLocked; }
@@ -212,6 +217,9 @@ class AliJArrayAlgorithm {
         virtual void InitIterator()=0;
         virtual bool Next(void *& item) = 0;
         virtual void ** GetRawItem()=0;
+        virtual int  GlobalIndex( const int * index )=0;
+        virtual void * GetItemAt( int iG )=0;
+        virtual void SetGlobalIndex( int iG )=0;
         virtual void * GetPosition()=0;
         virtual bool IsCurrentPosition(void * pos)=0;
         virtual void SetPosition(void * pos )=0;
@@ -232,6 +240,9 @@ class AliJArrayAlgorithmSimple : public AliJArrayAlgorithm {
         void ReverseIndex(int iG );
         virtual void * GetItem();
         virtual void SetItem(void * item);
+        virtual int  GlobalIndex( const int * index );
+        virtual void * GetItemAt( int iG ){ return fArray[iG]; }
+        virtual void SetGlobalIndex( int iG ){ ReverseIndex( iG ); }
         virtual void InitIterator(){ fPos = 0; }
         virtual void ** GetRawItem(){ return &fArray[GlobalIndex()]; }
         virtual bool Next(void *& item){
@@ -318,6 +329,14 @@ class AliJTH1Derived : public AliJTH1 {
         AliJTH1DerivedPlayer<T> & operator[](int i){ fPlayer.Init();fPlayer[i];return fPlayer; }
         T * operator->(){ return static_cast<T*>(GetSingleItem()); }
         operator T*(){ return static_cast<T*>(GetSingleItem()); }
+        // Direct access with a flat index from GlobalIndex
+        T * At( int iG ){ return static_cast<T*>(GetItemAt(iG)); }
+        T * operator()( int i0, int i1=-1, int i2=-1, int i3=-1, int i4=-1, int i5=-1 ){
+          return At( GlobalIndex(i0,i1,i2,i3,i4,i5) );
+        }
+        AliJTH1Handle<T> GetHandle( int i0, int i1=-1, int i2=-1, int i3=-1, int i4=-1, int i5=-1 ){
+          return AliJTH1Handle<T>( this, GlobalIndex(i0,i1,i2,i3,i4,i5) );
+        }
         // Virtual from AliJArrayBase
 
         // Virtual from AliJTH1
@@ -370,6 +389,27 @@ class AliJTH1DerivedPlayer {
         AliJTH1Derived<T> * fCMD;
 };
 
+//////////////////////////////////////////////////////////////////////////
+// AliJTH1Handle                                                        //
+//                                                                      //
+// Typed handle of one entry of an array, keeps the flat index and the  //
+// histogram once it is built. The entry is still built at first use.  //
+//////////////////////////////////////////////////////////////////////////
+template< typename T>
+class AliJTH1Handle {
+    public:
+        AliJTH1Handle():fCMD(NULL),fIndex(-1),fItem(NULL){}
+        AliJTH1Handle( AliJTH1Derived<T> * cmd, int iG ):fCMD(cmd),fIndex(iG),fItem(NULL){}
+        T* Get(){ if( !fItem ) fItem = fCMD->At(fIndex); return fItem; }
+        T* operator->(){ return Get(); }
+        operator T*(){ return Get(); }
+        int GetIndex() const { return fIndex; }
+    private:
+        AliJTH1Derived<T> * fCMD;
+        int fIndex;
+        T * fItem;
+};
+
 typedef AliJTH1Derived<TH1D> AliJTH1D;
 typedef AliJTH1Derived<TH2D> AliJTH2D;
 typedef AliJTH1Derived<TH3D> AliJTH3D;
@@ -0,0 +1,85 @@
+#include "AliJMultiCorrelator.h"
+
+AliJMultiCorrelator::AliJMultiCorrelator():
+	fQ(0),
+	fNHarmonics(0),
+	fNPowers(0),
+	fUseCache(true),
+	fHarmonics(),
+	fKey(),
+	fCache(){
+	//
+}
+
+AliJMultiCorrelator::~AliJMultiCorrelator(){
+	//
+}
+
+void AliJMultiCorrelator::SetQvectors(const TComplex *q, int nHarmonics, int nPowers){
+	fQ = q;
+	fNHarmonics = nHarmonics;
+	fNPowers = nPowers;
+	fCache.clear();
+}
+
+TComplex AliJMultiCorrelator::Q(int n, int p) const{
+	// Q{-n,p} = Q{n,p}^*
+	if(n >= 0) return fQ[n*fNPowers+p];
+	return TComplex::Conjugate(fQ[-n*fNPowers+p]);
+}
+
+TComplex AliJMultiCorrelator::Recursion(int n, const int *harmonic, int mult, int skip){
+	if(!fQ || n <= 0) return TComplex(0.,0.);
+	fHarmonics.assign(harmonic,harmonic+n);
+	return RecursionImpl(n,fHarmonics.data(),mult,skip);
+}
+
+TComplex AliJMultiCorrelator::RecursionImpl(int n, int *harmonic, int mult, int skip){
+	// Same expansion as AliAnalysisSPC::Recursion(). The result depends only on the first n
+	// harmonics, mult and skip, which form the cache key. One- and two-particle terms are
+	// cheaper to recalculate than to look up.
+	int nm1 = n-1;
+	if(fUseCache && nm1 > 1){
+		fKey.assign(harmonic,harmonic+n);
+		fKey.push_back(mult);
+		fKey.push_back(skip);
+		auto found = fCache.find(fKey);
+		if(found != fCache.end()) return found->second;
+	}
+
+	TComplex c(Q(harmonic[nm1],mult));
+	if(nm1 == 0) return c;
+	c *= RecursionImpl(nm1,harmonic,1,0);
+	if(nm1 != skip){
+		int multp1 = mult+1;
+		int nm2 = n-2;
+		int counter1 = 0;
+		int hhold = harmonic[counter1];
+		harmonic[counter1] = harmonic[nm2];
+		harmonic[nm2] = hhold+harmonic[nm1];
+		TComplex c2(RecursionImpl(nm1,harmonic,multp1,nm2));
+		int counter2 = n-3;
+		while(counter2 >= skip){
+			harmonic[nm2] = harmonic[counter1];
+			harmonic[counter1] = hhold;
+			++counter1;
+			hhold = harmonic[counter1];
+			harmonic[counter1] = harmonic[nm2];
+			harmonic[nm2] = hhold+harmonic[nm1];
+			c2 += RecursionImpl(nm1,harmonic,multp1,counter2);
+			--counter2;
+		}
+		harmonic[nm2] = harmonic[counter1];
+		harmonic[counter1] = hhold;
+		c = (mult == 1)?c-c2:c-double(mult)*c2;
+	}
+
+	// harmonics are restored at this point, the key can be built again
+	if(fUseCache && nm1 > 1){
+		std::vector<int> key(harmonic,harmonic+n);
+		key.push_back(mult);
+		key.push_back(skip);
+		fCache.emplace(std::move(key),c);
+	}
+	return c;
+}
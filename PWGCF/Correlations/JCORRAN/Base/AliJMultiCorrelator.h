@@ -0,0 +1,43 @@
+#ifndef ALIJMULTICORRELATOR_H
+#define ALIJMULTICORRELATOR_H
+
+#include <TComplex.h>
+#include <cstddef>
+#include <vector>
+#include <unordered_map>
+
+// Multi-particle correlators from Q-vectors with the recursion of K. Gulbrandsen.
+// The (sub)correlators are memoized for the current Q-vectors, so that the many
+// correlators requested in one event (e.g. symmetric cumulant sets, denominators,
+// joined covariances) share their common terms instead of being expanded again.
+// The Q-vectors are not copied: q[h*nPowers+p] must stay valid until Reset().
+class AliJMultiCorrelator{
+public:
+	AliJMultiCorrelator();
+	~AliJMultiCorrelator();
+	void SetQvectors(const TComplex *q, int nHarmonics, int nPowers);
+	void Reset(){ fCache.clear(); } // to be called whenever the Q-vectors change
+	void SetUseCache(bool use){ fUseCache = use; fCache.clear(); }
+	TComplex Q(int n, int p) const;
+	TComplex Recursion(int n, const int *harmonic, int mult = 1, int skip = 0);
+	size_t GetCacheSize() const { return fCache.size(); }
+private:
+	TComplex RecursionImpl(int n, int *harmonic, int mult, int skip);
+	struct KeyHash{
+		size_t operator()(const std::vector<int> &key) const{
+			size_t h = key.size();
+			for(int k : key) h ^= (size_t)(k+0x9e3779b9)+(h<<6)+(h>>2);
+			return h;
+		}
+	};
+	const TComplex *fQ;
+	int fNHarmonics;
+	int fNPowers;
+	bool fUseCache;
+	std::vector<int> fHarmonics; // working copy, modified during the recursion
+	std::vector<int> fKey;
+	std::unordered_map<std::vector<int>, TComplex, KeyHash> fCache;
+};
+
+#endif
+
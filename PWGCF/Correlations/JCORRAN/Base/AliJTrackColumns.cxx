@@ -0,0 +1,70 @@
+/**************************************************************************
+ * Copyright(c) 1998-2014, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+// Columns of the tracks of an AliJBaseTrack list, see the header
+
+#include <TClonesArray.h>
+#include "AliJBaseTrack.h"
+#include "AliJTrackColumns.h"
+
+//______________________________________________________________________________
+AliJTrackColumns::AliJTrackColumns():
+	fPhi(),
+	fEta(),
+	fPt(),
+	fCharge(),
+	fPhiWeight(),
+	fTrackEff(),
+	fWeight()
+{
+	// constructor
+}
+
+//______________________________________________________________________________
+void AliJTrackColumns::Clear(){
+	// the memory is kept for the next event
+	fPhi.clear();
+	fEta.clear();
+	fPt.clear();
+	fCharge.clear();
+	fPhiWeight.clear();
+	fTrackEff.clear();
+	fWeight.clear();
+}
+
+//______________________________________________________________________________
+void AliJTrackColumns::Fill(TClonesArray *tracks){
+	Clear();
+	if(!tracks)
+		return;
+	const Int_t ntracks = tracks->GetEntriesFast();
+	fPhi.resize(ntracks);
+	fEta.resize(ntracks);
+	fPt.resize(ntracks);
+	fCharge.resize(ntracks);
+	fPhiWeight.resize(ntracks);
+	fTrackEff.resize(ntracks);
+	fWeight.resize(ntracks);
+	for(Int_t it=0; it<ntracks; it++){
+		AliJBaseTrack *itrack = (AliJBaseTrack*)tracks->At(it);
+		fPhi[it] = itrack->Phi();
+		fEta[it] = itrack->Eta();
+		fPt[it] = itrack->Pt();
+		fCharge[it] = itrack->GetCharge();
+		fPhiWeight[it] = itrack->GetWeight();
+		fTrackEff[it] = itrack->GetTrackEff();
+		fWeight[it] = 1.0/(fPhiWeight[it]*fTrackEff[it]);
+	}
+}
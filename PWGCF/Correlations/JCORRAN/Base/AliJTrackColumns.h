@@ -0,0 +1,50 @@
+/* Copyright(c) 1998-2014, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice */
+
+///////////////////////////////////////////////////
+/*
+   \file AliJTrackColumns.h
+   \brief Columns (phi, eta, pt, charge, weights) of the tracks of an
+   AliJBaseTrack list, filled once per event so that several analyses of
+   the same track list loop over plain arrays. The weight is the inverse
+   of the phi (NUA) weight times the efficiency correction given to the
+   tracks, i.e. 1/(GetWeight()*GetTrackEff()).
+   */
+///////////////////////////////////////////////////
+
+#ifndef ALIJTRACKCOLUMNS_H
+#define ALIJTRACKCOLUMNS_H
+
+#include <vector>
+#include <Rtypes.h>
+
+class TClonesArray;
+
+class AliJTrackColumns {
+	public:
+		AliJTrackColumns();
+		virtual ~AliJTrackColumns(){;}
+
+		void Clear();
+		void Fill(TClonesArray *tracks);
+
+		Int_t GetN() const { return fPhi.size(); }
+		const Double_t * GetPhi() const { return fPhi.data(); }
+		const Double_t * GetEta() const { return fEta.data(); }
+		const Double_t * GetPt() const { return fPt.data(); }
+		const Short_t * GetCharge() const { return fCharge.data(); }
+		const Double_t * GetPhiWeight() const { return fPhiWeight.data(); } // AliJBaseTrack::GetWeight
+		const Double_t * GetTrackEff() const { return fTrackEff.data(); } // AliJBaseTrack::GetTrackEff
+		const Double_t * GetWeight() const { return fWeight.data(); } // 1/(phi weight*efficiency)
+
+	private:
+		std::vector<Double_t> fPhi;
+		std::vector<Double_t> fEta;
+		std::vector<Double_t> fPt;
+		std::vector<Short_t> fCharge;
+		std::vector<Double_t> fPhiWeight;
+		std::vector<Double_t> fTrackEff;
+		std::vector<Double_t> fWeight;
+};
+
+#endif
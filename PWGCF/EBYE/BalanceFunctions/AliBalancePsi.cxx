@@ -97,7 +97,8 @@ AliBalancePsi::AliBalancePsi() :
   fVertexBinning(kFALSE),
   fCustomBinning(""),
   fBinningString(""),
-  fEventClass("EventPlane"){
+  fEventClass("EventPlane"),
+  fSecond(){
   // Default constructor
 }
 
@@ -150,7 +151,8 @@ AliBalancePsi::AliBalancePsi(const AliBalancePsi& balance):
   fVertexBinning(balance.fVertexBinning),
   fCustomBinning(balance.fCustomBinning),
   fBinningString(balance.fBinningString),
-  fEventClass("EventPlane"){
+  fEventClass("EventPlane"),
+  fSecond(){
   //copy constructor
 }
 
@@ -465,14 +467,14 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
   // Eta() is extremely time consuming, therefore cache it for the inner loop here:
   TObjArray* particlesSecond = (particlesMixed) ? particlesMixed : particles;
 
-  TArrayF secondEta(jMax);
-  TArrayF secondPhi(jMax);
-  TArrayF secondPt(jMax);
-  TArrayS secondCharge(jMax);
-  TArrayD secondCorrection(jMax);
-  TArrayI secondLabel(jMax);
-  TArrayI secondMotherLabel(jMax);
-  TArrayI secondTrigOrAssoc(jMax);
+  vector<Float_t>&  secondEta         = fSecond.fEta;         secondEta.resize(jMax);
+  vector<Float_t>&  secondPhi         = fSecond.fPhi;         secondPhi.resize(jMax);
+  vector<Float_t>&  secondPt          = fSecond.fPt;          secondPt.resize(jMax);
+  vector<Short_t>&  secondCharge      = fSecond.fCharge;      secondCharge.resize(jMax);
+  vector<Double_t>& secondCorrection  = fSecond.fCorrection;  secondCorrection.resize(jMax);
+  vector<Int_t>&    secondLabel       = fSecond.fLabel;       secondLabel.assign(jMax, 0);
+  vector<Int_t>&    secondMotherLabel = fSecond.fMotherLabel; secondMotherLabel.assign(jMax, 0);
+  vector<Int_t>&    secondTrigOrAssoc = fSecond.fTrigOrAssoc; secondTrigOrAssoc.resize(jMax);
 
   for (Int_t i=0; i<jMax; i++){  
     secondTrigOrAssoc[i] = (Int_t)((AliBFBasicParticle*) particlesSecond->At(i))->GetTrigOrAssoc();
@@ -486,7 +488,7 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
   }
   
   //TLorenzVector implementation for resonances
-  TLorentzVector vectorMother, vectorDaughter[2];
+  TLorentzVector vectorMother;
   TParticle pPion, pProton, pRho0, pK0s, pLambda, pKaon, pPhi;
   pPion.SetPdgCode(211); //pion
   pRho0.SetPdgCode(113); //rho0
@@ -505,6 +507,29 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
   Double_t massForPhiData = 1.018;
   Double_t nSigmaRejection = 3.0;
 
+  // the single particle quantities of the pair cuts are computed once per particle and not for each pair
+  const Double_t massPion   = pPion.GetMass();
+  const Double_t massProton = pProton.GetMass();
+  const Double_t massKaon   = pKaon.GetMass();
+  Bool_t usePhiCut = (fResonancePhiCut && !particlesMixed);
+  vector<TLorentzVector>& secondPion     = fSecond.fPion;     if(fResonancesCut)  secondPion.resize(jMax);
+  vector<TLorentzVector>& secondProton   = fSecond.fProton;   if(fResonancesCut)  secondProton.resize(jMax);
+  vector<TLorentzVector>& secondKaon     = fSecond.fKaon;     if(usePhiCut)       secondKaon.resize(jMax);
+  vector<Float_t>&        secondTanTheta = fSecond.fTanTheta; if(fConversionCut)  secondTanTheta.resize(jMax);
+  for (Int_t i=0; i<jMax; i++){
+    if(fResonancesCut) {
+      secondPion[i].SetPtEtaPhiM(secondPt[i],secondEta[i],secondPhi[i],massPion);
+      secondProton[i].SetPtEtaPhiM(secondPt[i],secondEta[i],secondPhi[i],massProton);
+    }
+    if(usePhiCut) secondKaon[i].SetPtEtaPhiM(secondPt[i],secondEta[i],secondPhi[i],massKaon);
+    if(fConversionCut) {
+      secondTanTheta[i] = 1e10;
+      if (secondEta[i] < -1e-10 || secondEta[i] > 1e-10)
+	secondTanTheta[i] = 2 * TMath::Exp(-secondEta[i]) / ( 1 - TMath::Exp(-2*secondEta[i]));
+    }
+  }
+  TLorentzVector firstPion, firstProton, firstKaon;
+
   // 1st particle loop
   for (Int_t i = 0; i < iMax; i++) {
     //AliVParticle* firstParticle = (AliVParticle*) particles->At(i);    
@@ -525,6 +550,15 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
     if (firstTrigOrAssoc == 1)
     continue;
 
+    if(fResonancesCut) {
+      firstPion.SetPtEtaPhiM(firstPt,firstEta,firstPhi,massPion);
+      firstProton.SetPtEtaPhiM(firstPt,firstEta,firstPhi,massProton);
+    }
+    if(usePhiCut) firstKaon.SetPtEtaPhiM(firstPt,firstEta,firstPhi,massKaon);
+    Float_t firstTanTheta = 1e10;
+    if (fConversionCut && (firstEta < -1e-10 || firstEta > 1e-10))
+      firstTanTheta = 2 * TMath::Exp(-firstEta) / ( 1 - TMath::Exp(-2*firstEta));
+
     // Event plane (determine psi bin)
     Double_t gPsiMinusPhi    =   0.;
     Double_t gPsiMinusPhiBin = -10.;
@@ -602,9 +636,7 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
 	if (charge1 * charge2 < 0) {        
 
 	  //rho0
-	  vectorDaughter[0].SetPtEtaPhiM(firstPt,firstEta,firstPhi,pPion.GetMass());
-	  vectorDaughter[1].SetPtEtaPhiM(secondPt[j],secondEta[j],secondPhi[j],pPion.GetMass());
-	  vectorMother = vectorDaughter[0] + vectorDaughter[1];
+	  vectorMother = firstPion + secondPion[j];
 	  fHistResonancesBefore->Fill(trackVariablesPair[1],trackVariablesPair[2],vectorMother.M());
 	  if(TMath::Abs(vectorMother.M() - pRho0.GetMass()) <= nSigmaRejection*gWidthForRho0)
 	    continue;
@@ -617,15 +649,11 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
 	  
 	  
 	  //Lambda
-	  vectorDaughter[0].SetPtEtaPhiM(firstPt,firstEta,firstPhi,pPion.GetMass());
-	  vectorDaughter[1].SetPtEtaPhiM(secondPt[j],secondEta[j],secondPhi[j],pProton.GetMass());
-	  vectorMother = vectorDaughter[0] + vectorDaughter[1];
+	  vectorMother = firstPion + secondProton[j];
 	  if(TMath::Abs(vectorMother.M() - pLambda.GetMass()) <= nSigmaRejection*gWidthForLambda)
 	    continue;
 	  
-	  vectorDaughter[0].SetPtEtaPhiM(firstPt,firstEta,firstPhi,pProton.GetMass());
-	  vectorDaughter[1].SetPtEtaPhiM(secondPt[j],secondEta[j],secondPhi[j],pPion.GetMass());
-	  vectorMother = vectorDaughter[0] + vectorDaughter[1];
+	  vectorMother = firstProton + secondPion[j];
 	  if(TMath::Abs(vectorMother.M() - pLambda.GetMass()) <= nSigmaRejection*gWidthForLambda)
 	    continue;
 	  fHistResonancesLambda->Fill(trackVariablesPair[1],trackVariablesPair[2],vectorMother.M());
@@ -636,9 +664,7 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
       if(fResonancePhiCut) {
         if (!particlesMixed) {
 	//phi        
-	vectorDaughter[0].SetPtEtaPhiM(firstPt,firstEta,firstPhi,pKaon.GetMass());
-	vectorDaughter[1].SetPtEtaPhiM(secondPt[j],secondEta[j],secondPhi[j],pKaon.GetMass());
-	vectorMother = vectorDaughter[0] + vectorDaughter[1];
+	vectorMother = firstKaon + secondKaon[j];
 	  if (charge1 * charge2 > 0)
 	    fHistResonancesPhiBeforeLS->Fill(vectorMother.Pt(),vectorMother.M(),trackVariablesSingle[0]);
 	    else if (charge1 * charge2 < 0) { 
@@ -752,7 +778,7 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
 	  Double_t dphi = firstPhi - secondPhi[j];
 	  
 	  Float_t m0 = 0.510e-3;
-	  Float_t tantheta1 = 1e10;
+	  Float_t tantheta1 = firstTanTheta;
 	  
 	  // phi in rad
 	  //Float_t phi1rad = firstPhi*TMath::DegToRad();
@@ -760,12 +786,7 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
 	  Float_t phi1rad = firstPhi;
 	  Float_t phi2rad = secondPhi[j];
 	  
-	  if (firstEta < -1e-10 || firstEta > 1e-10)
-	    tantheta1 = 2 * TMath::Exp(-firstEta) / ( 1 - TMath::Exp(-2*firstEta));
-	  
-	  Float_t tantheta2 = 1e10;
-	  if (secondEta[j] < -1e-10 || secondEta[j] > 1e-10)
-	    tantheta2 = 2 * TMath::Exp(-secondEta[j]) / ( 1 - TMath::Exp(-2*secondEta[j]));
+	  Float_t tantheta2 = secondTanTheta[j];
 	  
 	  Float_t e1squ = m0 * m0 + firstPt * firstPt * (1.0 + 1.0 / tantheta1 / tantheta1);
 	  Float_t e2squ = m0 * m0 + secondPt[j] * secondPt[j] * (1.0 + 1.0 / tantheta2 / tantheta2);
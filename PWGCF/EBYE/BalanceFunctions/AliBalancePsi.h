@@ -16,6 +16,7 @@
 #include <TObject.h>
 #include "TString.h"
 #include "TH2D.h"
+#include "TLorentzVector.h"
 
 #include "AliTHn.h"
 
@@ -307,9 +308,20 @@ class AliBalancePsi : public TObject {
 
   TString fEventClass;
 
+  // particles of the 2nd loop of CalculateBalance(), the buffers are reused for all the calls
+  // (same event and each mixed event) instead of being allocated at each call
+  struct SecondParticles {
+    vector<Float_t>        fEta, fPhi, fPt, fTanTheta;
+    vector<Short_t>        fCharge;
+    vector<Double_t>       fCorrection;
+    vector<Int_t>          fLabel, fMotherLabel, fTrigOrAssoc;
+    vector<TLorentzVector> fPion, fProton, fKaon;
+  };
+  SecondParticles fSecond; //!
+
   AliBalancePsi & operator=(const AliBalancePsi & ) {return *this;}
 
-  ClassDef(AliBalancePsi, 5)
+  ClassDef(AliBalancePsi, 6)
 };
 
 #endif
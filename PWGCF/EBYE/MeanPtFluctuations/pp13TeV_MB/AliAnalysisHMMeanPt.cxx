@@ -414,16 +414,17 @@ void AliAnalysisHMMeanPt::UserExec(Option_t *){
 		fHistTPCcrossrows->Fill(track->GetTPCCrossedRows());
 		fHistTPCFoundFrac->Fill(track->GetTPCFoundFraction());
 
+		const double trackpt = track->Pt();
 		fHistEta->Fill(track->Eta());        
-        fHistPt->Fill(track->Pt()); 
+        fHistPt->Fill(trackpt); 
        	fHistPhi->Fill(track->Phi()); 
 
 		//TPCrows[trk] = track->GetTPCCrossedRows();
 		//pt[trk] 	= track->Pt();
 		//charge[trk] = track->Charge();
 
-		sum_trackpt = sum_trackpt + track->Pt() ;
-		sum_ptiptj  = sum_ptiptj + ( track->Pt() * track->Pt() ) ;
+		sum_trackpt = sum_trackpt + trackpt ;
+		sum_ptiptj  = sum_ptiptj + ( trackpt * trackpt ) ;
 			
 		/* ALICE method...
 			int trkall =0;		
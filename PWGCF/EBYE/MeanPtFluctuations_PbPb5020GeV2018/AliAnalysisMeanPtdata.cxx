@@ -851,7 +851,6 @@ void AliAnalysisMeanPtdata::UserExec(Option_t *)
     Double_t MeanQ1=0., twopart=0., threepart=0., fourpart=0.;
     Double_t  twopart1=0., threepart1=0., fourpart1=0.;
     float spdTracklet = -999.;
-    Double_t tracks[100000]= {0.};	// array of track Pts, needed for the two-particle correlator
 
 	    if( centbin == 0){fEventSee->Fill(1);}
 	    if( centbin == 1){fEventSee->Fill(2);}
@@ -1025,11 +1024,14 @@ void AliAnalysisMeanPtdata::UserExec(Option_t *)
 
 
 
-   tracks[nParts] = Pt;
+   // power sums of the track pt, the 2-, 3- and 4-particle correlators are
+   // derived from them after the loop (no per track array needed)
+   const Double_t Pt2 = Pt*Pt;
+   const Double_t Pt3 = Pt2*Pt;
    Q1 += Pt;
-   Q2 +=  Pt*Pt;
-   Q3 += Pt*Pt*Pt;
-   Q4 += Pt*Pt*Pt*Pt;
+   Q2 += Pt2;
+   Q3 += Pt3;
+   Q4 += Pt3*Pt;
    nParts++;
   
  }
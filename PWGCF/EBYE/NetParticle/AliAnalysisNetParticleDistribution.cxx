@@ -53,7 +53,8 @@ AliAnalysisNetParticleDistribution::AliAnalysisNetParticleDistribution() :
   fMCNp(NULL),
   fMCNpPt(NULL),
   fRedFactp(NULL),
-  fHnTrackUnCorr(NULL) {
+  fHnTrackUnCorr(NULL),
+  fHistSets() {
   // Constructor   
   
   AliLog::SetClassDebugLevel("AliAnalysisNetParticleDistribution",10);
@@ -821,11 +822,13 @@ void AliAnalysisNetParticleDistribution::FillHistSetCent(const Char_t *name, Int
   // -- Fill histogram sets for particle and anti-particle
   //    dependence : centrality 
   
-  // -- Get List
-  TList *list = static_cast<TList*>(fOutList->FindObject(Form("f%s",name)));
+  // -- Get Histograms
+  HistSet &set = GetHistSet(name, kFALSE);
   
   // -- Get Centrality Bin
   Float_t centralityBin = fHelper->GetCentralityBin();
+  Int_t   idxSub        = fHelper->GetSubSampleIdx();
+  Int_t   nBinsCent     = AliAnalysisNetParticleHelper::fgkfHistNBinsCent;
 
   // -- Select MC or Data
   Int_t **np = (isMC) ? fMCNp : fNp;
@@ -836,15 +839,15 @@ void AliAnalysisNetParticleDistribution::FillHistSetCent(const Char_t *name, Int
   Int_t deltaNp = np[idx][1]-np[idx][0];  // p - pbar
 
   // -- Fill Particle / Anti-Particle Distributions
-  (static_cast<TH2D*>(list->FindObject(Form("h%s%s", name, fHelper->GetParticleName(0).Data()))))->Fill(centralityBin, np[idx][0]);
-  (static_cast<TH2D*>(list->FindObject(Form("h%s%s", name, fHelper->GetParticleName(1).Data()))))->Fill(centralityBin, np[idx][1]);
+  (static_cast<TH2D*>(set.fDist[0]))->Fill(centralityBin, np[idx][0]);
+  (static_cast<TH2D*>(set.fDist[1]))->Fill(centralityBin, np[idx][1]);
 
   // -- Fill NetParticle Distributions
-  (static_cast<TH2D*>(list->FindObject(Form("h%sNet%s",  name, fHelper->GetParticleName(1).Data()))))->Fill(centralityBin, deltaNp);
+  (static_cast<TH2D*>(set.fDist[2]))->Fill(centralityBin, deltaNp);
 
   // -- Fill NetParticle vs SumParticle
   Double_t deltaNpOverSumNp = (sumNp == 0.) ? 0. : deltaNp/Double_t(sumNp);
-  (static_cast<TH2D*>(list->FindObject(Form("h%sNet%sOverSum", name, fHelper->GetParticleName(1).Data()))))->Fill(centralityBin, deltaNpOverSumNp);
+  (static_cast<TH2D*>(set.fDist[3]))->Fill(centralityBin, deltaNpOverSumNp);
 
   // -----------------------------------------------------------------------------------------------
 
@@ -854,15 +857,15 @@ void AliAnalysisNetParticleDistribution::FillHistSetCent(const Char_t *name, Int
   Double_t deltaNpX = np[idx][1]-(np[idx][0]*CENT[Int_t(centralityBin)]);
 
   // -- Fill Particle / Anti-Particle Distributions
-  (static_cast<TH2D*>(list->FindObject(Form("h%s%sX", name, fHelper->GetParticleName(0).Data()))))->Fill(centralityBin, np[idx][0]*CENT[Int_t(centralityBin)]);
-  (static_cast<TH2D*>(list->FindObject(Form("h%s%sX", name, fHelper->GetParticleName(1).Data()))))->Fill(centralityBin, np[idx][1]);
+  (static_cast<TH2D*>(set.fDist[4]))->Fill(centralityBin, np[idx][0]*CENT[Int_t(centralityBin)]);
+  (static_cast<TH2D*>(set.fDist[5]))->Fill(centralityBin, np[idx][1]);
 
   // -- Fill NetParticle Distributions
-  (static_cast<TH2D*>(list->FindObject(Form("h%sNet%sX",  name, fHelper->GetParticleName(1).Data()))))->Fill(centralityBin, deltaNpX);
+  (static_cast<TH2D*>(set.fDist[6]))->Fill(centralityBin, deltaNpX);
 
   // -- Fill NetParticle vs SumParticle
   Double_t deltaNpXOverSumNpX = (sumNpX == 0.) ? 0. : deltaNpX/sumNpX;
-  (static_cast<TH2D*>(list->FindObject(Form("h%sNet%sOverSumX", name, fHelper->GetParticleName(1).Data()))))->Fill(centralityBin, deltaNpXOverSumNpX);
+  (static_cast<TH2D*>(set.fDist[7]))->Fill(centralityBin, deltaNpXOverSumNpX);
 
   // -----------------------------------------------------------------------------------------------
 
@@ -870,8 +873,8 @@ void AliAnalysisNetParticleDistribution::FillHistSetCent(const Char_t *name, Int
   Double_t delta = 1.;
   for (Int_t idxOrder = 1; idxOrder <= fOrder; ++idxOrder) {
     delta *= deltaNp;
-    (static_cast<TProfile*>(list->FindObject(Form("p%sNet%s%dM", name, fHelper->GetParticleName(1).Data(), idxOrder))))->Fill(centralityBin, delta);
-    (static_cast<TProfile*>(list->FindObject(Form("p%sNet%s%dM_%02d", name, fHelper->GetParticleName(1).Data(), idxOrder, fHelper->GetSubSampleIdx()))))->Fill(centralityBin, delta);
+    (static_cast<TProfile*>(set.fMoments[idxOrder-1]))->Fill(centralityBin, delta);
+    (static_cast<TProfile*>(set.fMoments[(idxSub+1)*fOrder+idxOrder-1]))->Fill(centralityBin, delta);
   }
 
   // -- Generate reduced factorials - explictly removing the factorials
@@ -888,18 +891,16 @@ void AliAnalysisNetParticleDistribution::FillHistSetCent(const Char_t *name, Int
   }
 
   // -- Fill TProfiles for <f_ik> 
-  TList *fikList    = static_cast<TList*>(list->FindObject(Form("f%sFik",name)));
-  TList *fikListSub = static_cast<TList*>(list->FindObject(Form("f%sFik_%02d",name, fHelper->GetSubSampleIdx())));
-  TH2D  *hCntik     = static_cast<TH2D*>(fikList->FindObject(Form("p%sNet%sFCounts_%02d", name, fHelper->GetParticleName(1).Data(), Int_t(centralityBin))));
-  TH2D  *hCntikSub  = static_cast<TH2D*>(fikListSub->FindObject(Form("p%sNet%sFCounts_%02d_%02d", name, fHelper->GetParticleName(1).Data(), Int_t(centralityBin), fHelper->GetSubSampleIdx())));
+  Int_t  nFik       = (fOrder+1)*(fOrder+1);
+  TH2D  *hCntik     = static_cast<TH2D*>(set.fCounts[Int_t(centralityBin)]);
+  TH2D  *hCntikSub  = static_cast<TH2D*>(set.fCounts[(idxSub+1)*nBinsCent+Int_t(centralityBin)]);
 
   for (Int_t ii = 0; ii <= fOrder; ++ii) {   // ii -> p    -> n1
     for (Int_t kk = 0; kk <= fOrder; ++kk) { // kk -> pbar -> n2
       // -- use the reduced factorials only 
       Double_t fik = fRedFactp[ii][1] * fRedFactp[kk][0];   // n1 *n2 -> p * pbar
-      (static_cast<TProfile*>(fikList->FindObject(Form("p%sNet%sF%02d%02d", name, fHelper->GetParticleName(1).Data(), ii, kk))))->Fill(centralityBin, fik);
-      (static_cast<TProfile*>(fikListSub->FindObject(Form("p%sNet%sF%02d%02d_%02d", 
-							  name, fHelper->GetParticleName(1).Data(), ii, kk, fHelper->GetSubSampleIdx()))))->Fill(centralityBin, fik);
+      (static_cast<TProfile*>(set.fFik[ii*(fOrder+1)+kk]))->Fill(centralityBin, fik);
+      (static_cast<TProfile*>(set.fFik[(idxSub+1)*nFik+ii*(fOrder+1)+kk]))->Fill(centralityBin, fik);
 
       if (fik != 0.) {
 	hCntik->Fill(ii, kk);
@@ -916,11 +917,14 @@ void AliAnalysisNetParticleDistribution::FillHistSetCentPt(const Char_t *name, I
   // -- Add histogram sets for particle and anti-particle
   //    dependence : centrality and pt
 
-  // -- Get List
-  TList *list = static_cast<TList*>(fOutList->FindObject(Form("f%s",name)));  
+  // -- Get Histograms
+  HistSet &set = GetHistSet(name, kTRUE);
 
   // -- Get Centrality Bin
   Float_t centralityBin = fHelper->GetCentralityBin();
+  Int_t   idxSub        = fHelper->GetSubSampleIdx();
+  Int_t   nBinsCent     = AliAnalysisNetParticleHelper::fgkfHistNBinsCent;
+  Int_t   nFik          = (fOrder+1)*(fOrder+1);
 
   // -- Select MC or Data
   Int_t ***npPt = (isMC) ? fMCNpPt : fNpPt;
@@ -934,15 +938,15 @@ void AliAnalysisNetParticleDistribution::FillHistSetCentPt(const Char_t *name, I
     Int_t sumNp   = npPt[idx][1][idxPt]+npPt[idx][0][idxPt]; // p + pbar
 
     // -- Fill Particle / Anti-Particle Distributions
-    (static_cast<TH3D*>(list->FindObject(Form("h%s%s", name, fHelper->GetParticleName(0).Data()))))->Fill(centralityBin, idxPt, npPt[idx][0][idxPt]);
-    (static_cast<TH3D*>(list->FindObject(Form("h%s%s", name, fHelper->GetParticleName(1).Data()))))->Fill(centralityBin, idxPt, npPt[idx][1][idxPt]);
+    (static_cast<TH3D*>(set.fDist[0]))->Fill(centralityBin, idxPt, npPt[idx][0][idxPt]);
+    (static_cast<TH3D*>(set.fDist[1]))->Fill(centralityBin, idxPt, npPt[idx][1][idxPt]);
     
     // -- Fill NetParticle Distributions
-    (static_cast<TH3D*>(list->FindObject(Form("h%sNet%s",  name, fHelper->GetParticleName(1).Data()))))->Fill(centralityBin, idxPt, deltaNp);
+    (static_cast<TH3D*>(set.fDist[2]))->Fill(centralityBin, idxPt, deltaNp);
     
     // -- Fill NetParticle vs SumParticle
     Double_t deltaNpOverSumNp = (sumNp == 0.) ? 0. : deltaNp/Double_t(sumNp);
-    (static_cast<TH3D*>(list->FindObject(Form("h%sNet%sOverSum", name, fHelper->GetParticleName(1).Data()))))->Fill(centralityBin, idxPt, deltaNpOverSumNp);
+    (static_cast<TH3D*>(set.fDist[3]))->Fill(centralityBin, idxPt, deltaNpOverSumNp);
 
     // -----------------------------------------------------------------------------------------------
 
@@ -950,9 +954,8 @@ void AliAnalysisNetParticleDistribution::FillHistSetCentPt(const Char_t *name, I
     Double_t delta = 1.;
     for (Int_t idxOrder = 1; idxOrder <= fOrder; ++idxOrder) {
       delta *= deltaNp;
-      (static_cast<TProfile2D*>(list->FindObject(Form("p%sNet%s%dM", name, fHelper->GetParticleName(1).Data(), idxOrder))))->Fill(centralityBin, idxPt, delta);
-      (static_cast<TProfile2D*>(list->FindObject(Form("p%sNet%s%dM_%02d", 
-						      name, fHelper->GetParticleName(1).Data(), idxOrder, fHelper->GetSubSampleIdx()))))->Fill(centralityBin, idxPt, delta);
+      (static_cast<TProfile2D*>(set.fMoments[idxOrder-1]))->Fill(centralityBin, idxPt, delta);
+      (static_cast<TProfile2D*>(set.fMoments[(idxSub+1)*fOrder+idxOrder-1]))->Fill(centralityBin, idxPt, delta);
     }
     
     // -- Generate reduced factorials - explictly removing the factorials
@@ -969,17 +972,13 @@ void AliAnalysisNetParticleDistribution::FillHistSetCentPt(const Char_t *name, I
     }
 
     // -- Fill TProfiles for <f_ik> 
-    TList *fikListPt    = static_cast<TList*>(list->FindObject(Form("f%sPtFik",name)));
-    TList *fikListPtSub = static_cast<TList*>(list->FindObject(Form("f%sPtFik_%02d",name, fHelper->GetSubSampleIdx())));
-    TH3D  *hCntikPt     = static_cast<TH3D*>(fikListPt->FindObject(Form("p%sNet%sFCounts_%02d", name, fHelper->GetParticleName(1).Data(), Int_t(centralityBin))));
-    TH3D  *hCntikPtSub  = static_cast<TH3D*>(fikListPtSub->FindObject(Form("p%sNet%sFCounts_%02d_%02d", name, fHelper->GetParticleName(1).Data(), 
-									   Int_t(centralityBin), fHelper->GetSubSampleIdx())));
+    TH3D  *hCntikPt     = static_cast<TH3D*>(set.fCounts[Int_t(centralityBin)]);
+    TH3D  *hCntikPtSub  = static_cast<TH3D*>(set.fCounts[(idxSub+1)*nBinsCent+Int_t(centralityBin)]);
     for (Int_t ii = 0; ii <= fOrder; ++ii) {   // ii -> p    -> n1
       for (Int_t kk = 0; kk <= fOrder; ++kk) { // kk -> pbar -> n2
 	Double_t fik = fRedFactp[ii][1] * fRedFactp[kk][0];   // n1 *n2 -> p * pbar
-	(static_cast<TProfile2D*>(fikListPt->FindObject(Form("p%sNet%sF%02d%02d", name, fHelper->GetParticleName(1).Data(), ii, kk))))->Fill(centralityBin, idxPt, fik);
-	(static_cast<TProfile2D*>(fikListPtSub->FindObject(Form("p%sNet%sF%02d%02d_%02d", 
-								name, fHelper->GetParticleName(1).Data(), ii, kk, fHelper->GetSubSampleIdx()))))->Fill(centralityBin, idxPt, fik);
+	(static_cast<TProfile2D*>(set.fFik[ii*(fOrder+1)+kk]))->Fill(centralityBin, idxPt, fik);
+	(static_cast<TProfile2D*>(set.fFik[(idxSub+1)*nFik+ii*(fOrder+1)+kk]))->Fill(centralityBin, idxPt, fik);
 	
 	if (fik != 0.) {
 	  hCntikPt->Fill(ii, kk, idxPt);
@@ -993,3 +992,59 @@ void AliAnalysisNetParticleDistribution::FillHistSetCentPt(const Char_t *name, I
   return;
 }
 
+//________________________________________________________________________
+AliAnalysisNetParticleDistribution::HistSet& AliAnalysisNetParticleDistribution::GetHistSet(const Char_t *name, Bool_t isPt)  {
+  // -- Get the histograms of a set, they are looked up in the output lists
+  //    at the first call only, the set is then filled through the pointers
+
+  std::map<TString, HistSet>::iterator it = fHistSets.find(name);
+  if (it != fHistSets.end())
+    return it->second;
+
+  HistSet &set = fHistSets[name];
+  TList *list = static_cast<TList*>(fOutList->FindObject(Form("f%s",name)));
+
+  TString sAntiPartName   = fHelper->GetParticleName(0);
+  TString sPartName       = fHelper->GetParticleName(1);
+  const Char_t *partName = sPartName.Data();
+  const Char_t *sPt      = (isPt) ? "Pt" : "";
+  Int_t nSub             = fHelper->GetNSubSamples();
+  Int_t nBinsCent        = AliAnalysisNetParticleHelper::fgkfHistNBinsCent;
+
+  // -- Particle / Anti-Particle, NetParticle and NetParticle/SumParticle Distributions
+  for (Int_t ii = 0; ii < 8; ++ii)
+    set.fDist[ii] = NULL;
+  set.fDist[0] = list->FindObject(Form("h%s%s", name, sAntiPartName.Data()));
+  set.fDist[1] = list->FindObject(Form("h%s%s", name, partName));
+  set.fDist[2] = list->FindObject(Form("h%sNet%s", name, partName));
+  set.fDist[3] = list->FindObject(Form("h%sNet%sOverSum", name, partName));
+  if (!isPt) {
+    set.fDist[4] = list->FindObject(Form("h%s%sX", name, sAntiPartName.Data()));
+    set.fDist[5] = list->FindObject(Form("h%s%sX", name, partName));
+    set.fDist[6] = list->FindObject(Form("h%sNet%sX", name, partName));
+    set.fDist[7] = list->FindObject(Form("h%sNet%sOverSumX", name, partName));
+  }
+
+  // -- <NetParticle^k>, <f_ik> and non-zero f_ik counts, for all events and for every SubSample
+  for (Int_t idxSub = -1; idxSub < nSub; ++idxSub) {
+    for (Int_t idxOrder = 1; idxOrder <= fOrder; ++idxOrder) {
+      if (idxSub < 0) set.fMoments.push_back(list->FindObject(Form("p%sNet%s%dM", name, partName, idxOrder)));
+      else            set.fMoments.push_back(list->FindObject(Form("p%sNet%s%dM_%02d", name, partName, idxOrder, idxSub)));
+    }
+
+    TList *fikList = (idxSub < 0) ? static_cast<TList*>(list->FindObject(Form("f%s%sFik", name, sPt)))
+      : static_cast<TList*>(list->FindObject(Form("f%s%sFik_%02d", name, sPt, idxSub)));
+    for (Int_t ii = 0; ii <= fOrder; ++ii) {
+      for (Int_t kk = 0; kk <= fOrder; ++kk) {
+	if (idxSub < 0) set.fFik.push_back(fikList->FindObject(Form("p%sNet%sF%02d%02d", name, partName, ii, kk)));
+	else            set.fFik.push_back(fikList->FindObject(Form("p%sNet%sF%02d%02d_%02d", name, partName, ii, kk, idxSub)));
+      }
+    }
+    for (Int_t idxCent = 0; idxCent < nBinsCent; ++idxCent) {
+      if (idxSub < 0) set.fCounts.push_back(fikList->FindObject(Form("p%sNet%sFCounts_%02d", name, partName, idxCent)));
+      else            set.fCounts.push_back(fikList->FindObject(Form("p%sNet%sFCounts_%02d_%02d", name, partName, idxCent, idxSub)));
+    }
+  }
+
+  return set;
+}
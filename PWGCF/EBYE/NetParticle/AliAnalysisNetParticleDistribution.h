@@ -13,8 +13,12 @@
  *          Michael Weber <m.weber@cern.ch>
  */
 
+#include <map>
+#include <vector>
+
 #include "THnSparse.h"
 #include "TList.h"
+#include "TString.h"
 
 #include "AliAnalysisNetParticleBase.h"
 
@@ -89,6 +93,15 @@ class AliAnalysisNetParticleDistribution : public AliAnalysisNetParticleBase {
   void FillHistSetCent(const Char_t *name, Int_t idx, Bool_t isMC);
   void FillHistSetCentPt(const Char_t *name, Int_t idx, Bool_t isMC);
 
+  /** Histograms of a set, looked up once by name instead of for every event */
+  struct HistSet {
+    TObject              *fDist[8];             // particle, anti-particle, net, net/sum (and their "X" versions for the centrality sets)
+    std::vector<TObject*> fMoments;             // <NetParticle^k>     : [(idxSub+1)*fOrder + k-1], idxSub -1 for all events
+    std::vector<TObject*> fFik;                 // <f_ik>              : [((idxSub+1)*(fOrder+1) + i)*(fOrder+1) + k]
+    std::vector<TObject*> fCounts;              // non-zero f_ik counts : [(idxSub+1)*nBinsCent + idxCent]
+  };
+  HistSet& GetHistSet(const Char_t *name, Bool_t isPt);
+
   /*
    * ---------------------------------------------------------------------------------
    *                             Members - private
@@ -112,8 +125,10 @@ class AliAnalysisNetParticleDistribution : public AliAnalysisNetParticleBase {
   // =======================================================================
   THnSparseD           *fHnTrackUnCorr;         //  THnSparseD : uncorrected probe particles
   // -----------------------------------------------------------------------
+  std::map<TString, HistSet> fHistSets;         //! Histogram sets by name
+  // -----------------------------------------------------------------------
 
-  ClassDef(AliAnalysisNetParticleDistribution, 1);
+  ClassDef(AliAnalysisNetParticleDistribution, 2);
 };
 
 #endif
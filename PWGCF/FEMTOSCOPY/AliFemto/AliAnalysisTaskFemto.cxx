@@ -26,6 +26,7 @@
 #include "AliGenHijingEventHeader.h"
 #include "AliGenCocktailEventHeader.h"
 #include "AliFemtoEventReaderNanoAODChain.h"
+#include "AliInputTreeCache.h"
 
 #ifdef __ROOT__
   /// \cond CLASSIMP
@@ -649,6 +650,11 @@ void AliAnalysisTaskFemto::CreateOutputObjects()
 
   SetFemtoManager(femto_manager);
 
+  // branches read through the AOD chain reader, cached by the input tree cache
+  if (auto *femtoReaderAOD = dynamic_cast<AliFemtoEventReaderAODChain *>(fReader)) {
+    femtoReaderAOD->RegisterUsedBranches("aodTree");
+  }
+
   fOutputList = fManager->Analysis(0)->GetOutputList();
   fOutputList->SetOwner(kTRUE);
 
@@ -670,6 +676,19 @@ void AliAnalysisTaskFemto::CreateOutputObjects()
   PostData(0, fOutputList);
 }
 
+//________________________________________________________________________
+Bool_t AliAnalysisTaskFemto::UserNotify()
+{
+  // New input file: add the registered branches to the cache of the input chain
+  if (dynamic_cast<AliFemtoEventReaderAODChain *>(fReader)) {
+    AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+    if (mgr && mgr->GetTree()) {
+      AliInputTreeCache::Instance()->ConfigureTree(mgr->GetTree(), "aodTree", mgr->GetCacheSize());
+    }
+  }
+  return kTRUE;
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskFemto::Exec(Option_t *)
 {
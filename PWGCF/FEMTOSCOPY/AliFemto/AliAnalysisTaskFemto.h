@@ -90,6 +90,7 @@ public:
   virtual void Exec(Option_t *option);
   virtual void Terminate(Option_t *);
   virtual void FinishTaskOutput();
+  virtual Bool_t UserNotify();
 
   /// Set the femtomanager containing this task's analyses.
   void SetFemtoManager(AliFemtoManager *aManager);
@@ -7,6 +7,7 @@
 #define AliFemtoAnalysis_hh
 
 #include "AliFemtoTypes.h"
+#include "AliFemtoTrack.h"
 #include <TList.h>
 #include <TObjString.h>
 
@@ -28,6 +29,9 @@ public:
 
   virtual void Finish() = 0; ///< Called after analysis is finished
 
+  /// Track fields used by the analysis (AliFemtoTrack::RequiredFields), all by default
+  virtual unsigned int RequiredTrackFields() { return AliFemtoTrack::kAllFields; }
+
 };
 
 #endif
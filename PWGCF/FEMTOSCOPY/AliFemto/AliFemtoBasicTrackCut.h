@@ -37,6 +37,7 @@ public:
 
   virtual AliFemtoString Report();
   virtual TList *ListSettings();
+  virtual unsigned int RequiredTrackFields() const { return 0; }
 
   void SetNSigmaPion(const float& lo, const float& hi);
   void SetNSigmaKaon(const float& lo, const float& hi);
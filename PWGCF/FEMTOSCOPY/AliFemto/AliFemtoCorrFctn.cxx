@@ -34,6 +34,25 @@ void AliFemtoCorrFctn::AddMixedPair(AliFemtoPair*)
   cout << "AliFemtoCorrFctn::AddMixedPair -- Not implemented\n";
 }
 
+void AliFemtoCorrFctn::AddRealPairs(const AliFemtoPairBatch &batch)
+{
+  AliFemtoPair pair;
+  for (unsigned int i = 0; i < batch.Size(); i++) {
+    pair.SetTrack1(batch.Track1(i));
+    pair.SetTrack2(batch.Track2(i));
+    AddRealPair(&pair);
+  }
+}
+void AliFemtoCorrFctn::AddMixedPairs(const AliFemtoPairBatch &batch)
+{
+  AliFemtoPair pair;
+  for (unsigned int i = 0; i < batch.Size(); i++) {
+    pair.SetTrack1(batch.Track1(i));
+    pair.SetTrack2(batch.Track2(i));
+    AddMixedPair(&pair);
+  }
+}
+
 void AliFemtoCorrFctn::AddFirstParticle(AliFemtoParticle*, bool)
 {
   cout << "AliFemtoCorrFctn::AddFirstParticle -- Not implemented\n";
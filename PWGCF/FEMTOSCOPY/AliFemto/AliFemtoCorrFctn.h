@@ -10,6 +10,7 @@
 #include "AliFemtoAnalysis.h"
 #include "AliFemtoEvent.h"
 #include "AliFemtoPair.h"
+#include "AliFemtoPairBatch.h"
 #include "AliFemtoPairCut.h"
 
 #include <TCollection.h>
@@ -44,6 +45,16 @@ public:
   /// Not Implemented - Add background pair
   virtual void AddMixedPair(AliFemtoPair* aPir);
 
+  /// Add a block of signal pairs with precomputed pair variables
+  ///
+  /// Used instead of AddRealPair if the analysis makes pairs in batches
+  /// (AliFemtoSimpleAnalysis::SetUsePairBatches). The default
+  /// implementation is an adapter calling AddRealPair for each pair,
+  /// correlation functions override it to use the arrays of the batch.
+  virtual void AddRealPairs(const AliFemtoPairBatch &batch);
+  /// Add a block of background pairs, see AddRealPairs
+  virtual void AddMixedPairs(const AliFemtoPairBatch &batch);
+
   /// Not Implemented - Add pair with optional
   virtual void AddFirstParticle(AliFemtoParticle *particle, bool mixing);
   virtual void AddSecondParticle(AliFemtoParticle *particle);
@@ -70,11 +81,19 @@ public:
 
   virtual AliFemtoCorrFctn* Clone() const = 0;
 
+  /// Track fields used by the correlation function and its pair selection
+  /// cut (AliFemtoTrack::RequiredFields). The default declares all fields.
+  virtual unsigned int RequiredTrackFields() const { return AliFemtoTrack::kAllFields; }
+
   AliFemtoAnalysis* HbtAnalysis(){return fyAnalysis;};
   void SetAnalysis(AliFemtoAnalysis* aAnalysis);
   void SetPairSelectionCut(AliFemtoPairCut* aCut);
 
 protected:
+  /// Track fields used by the pair selection cut and its cut monitors
+  unsigned int PairCutRequiredTrackFields() const
+    { return fPairCut ? fPairCut->RequiredTrackFields() | fPairCut->MonitorsRequiredTrackFields() : 0; }
+
   AliFemtoAnalysis* fyAnalysis; //! link to the analysis
   AliFemtoPairCut* fPairCut;    //! this is a PairSelection criteria for this Correlation Function
 
@@ -53,6 +53,7 @@ public:
   void SetUseLCMS(int);
   int  GetUseLCMS();
   virtual AliFemtoCorrFctn* Clone() const;
+  virtual unsigned int RequiredTrackFields() const { return PairCutRequiredTrackFields(); }
 
 private:
 
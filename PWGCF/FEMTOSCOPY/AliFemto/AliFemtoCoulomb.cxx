@@ -11,6 +11,8 @@
 
 #include <cstdio>
 #include <cassert>
+#include <fstream>
+#include <sstream>
 //#include "PhysicalConstants.h"
 const double fine_structure_const = 0.00729735;
 
@@ -24,7 +26,11 @@ AliFemtoCoulomb::AliFemtoCoulomb():
   fFile(""),
   fRadius(-1.0),
   fZ1Z2(1.0),
-  fNLines(0)
+  fEta(nullptr),
+  fCoulomb(nullptr),
+  fNLines(0),
+  fFiles(),
+  fTables()
 {
   /// Default constructor
 
@@ -34,18 +40,17 @@ AliFemtoCoulomb::AliFemtoCoulomb():
     assert(0);
   }
   cout << "You have 1 default Coulomb correction!" << endl;
-
-  for (int ie=0; ie<1000; ie++) {
-    fEta[ie] = 0.0;
-    fCoulomb[ie] = 0.0;
-  }
 }
 
 AliFemtoCoulomb::AliFemtoCoulomb(const AliFemtoCoulomb& aCoul):
   fFile(aCoul.fFile),
   fRadius(aCoul.fRadius),
   fZ1Z2(aCoul.fZ1Z2),
-  fNLines(0)
+  fEta(nullptr),
+  fCoulomb(nullptr),
+  fNLines(0),
+  fFiles(aCoul.fFiles),
+  fTables(aCoul.fTables)
 {
   /// copy constructor
 
@@ -56,7 +61,11 @@ AliFemtoCoulomb::AliFemtoCoulomb(const char* readFile, const double& radius, con
   fFile(readFile),
   fRadius(radius),
   fZ1Z2(0),
-  fNLines(0)
+  fEta(nullptr),
+  fCoulomb(nullptr),
+  fNLines(0),
+  fFiles(),
+  fTables()
 { // constructor with explicit filename
 
   fFile = readFile;
@@ -80,6 +89,8 @@ AliFemtoCoulomb& AliFemtoCoulomb::operator=(const AliFemtoCoulomb& aCoul)
   fFile = aCoul.fFile;
   fRadius = aCoul.fRadius;
   fZ1Z2 = aCoul.fZ1Z2;
+  fFiles = aCoul.fFiles;
+  fTables = aCoul.fTables;
 
   CreateLookupTable(fRadius);
 
@@ -128,20 +139,16 @@ void AliFemtoCoulomb::SetChargeProduct(const double& charge)
   }
 }
 
-void AliFemtoCoulomb::CreateLookupTable(const double& radius)
-{ // Read radii from fFile
-  /// Create array(pair) of linear interpolation between radii
-
-  cout << " AliFemtoCoulomb::CreateLookupTable() " << endl;
+const AliFemtoCoulomb::CorrectionFile& AliFemtoCoulomb::ReadFile(const std::string& file)
+{ // Read radii and corrections from the file, only the first time it is used
 
-  if (radius < 0.0) {
-    cout << " AliFemtoCoulomb::CreateLookupTable -> NEGATIVE RADIUS " << endl;
-    cout << "  call AliFemtoCoulomb::SetRadius(r) with positive r " << endl;
-    cerr << " AliFemtoCoulomb::CreateLookupTable -> NEGATIVE RADIUS " << endl;
-    cerr << "  call AliFemtoCoulomb::SetRadius(r) with positive r " << endl;
-    assert(0);
+  std::map<std::string, CorrectionFile>::const_iterator cached = fFiles.find(file);
+  if (cached != fFiles.end()) {
+    return cached->second;
   }
-  ifstream mystream(fFile);
+  CorrectionFile &content = fFiles[file];
+
+  ifstream mystream(file.c_str());
   if (!mystream) {
     cout << "Could not open file" << endl;
     assert(0);
@@ -150,62 +157,87 @@ void AliFemtoCoulomb::CreateLookupTable(const double& radius)
     cout << "Input correction file opened" << endl;
   }
 
-  static char tempstring[2001];
-  static float radii[2000];
-  static int tNRadii = 0;
-  tNRadii = 0;
-  if (!mystream.getline(tempstring,2000)) {
+  std::string firstLine;
+  if (!std::getline(mystream, firstLine)) {
     cout << "Could not read radii from file" << endl;
     assert(0);
   }
-  for (unsigned int ii=0; ii<strlen(tempstring); ii++) {
-    while (tempstring[ii]==' ') ii++;
-    sscanf(&tempstring[ii++],"%f",&radii[++tNRadii]);
-    while ( tempstring[ii]!=' ' && (ii)<strlen(tempstring) )ii++;
+  std::istringstream radii(firstLine);
+  float tRadius;
+  while (radii >> tRadius) {
+    content.fRadii.push_back(tRadius);
   }
+  const int tNRadii = content.fRadii.size();
   cout << " Read " << tNRadii << " radii from file" << endl;
 
-  static double tLowRadius = -1.0;
-  static double tHighRadius = -1.0;
-  static int tLowIndex = 0;
-  tLowRadius = -1.0;
-  tHighRadius = -1.0;
-  tLowIndex = 0;
-  for(int iii=1; iii<=tNRadii-1; iii++) { // Loop to one less than #radii
-    if ( radius >= radii[iii] && radius <= radii[iii+1] ) {
-      tLowRadius = radii[iii];
-      tHighRadius = radii[iii+1];
-      tLowIndex = iii;
+  double tempEta = 0;
+  while (mystream >> tempEta) {
+    content.fEta.push_back(tempEta);
+    for (int i=0; i<tNRadii; i++) {
+      double tCorr = 0;
+      mystream >> tCorr;
+      content.fCorrection.push_back(tCorr);
     }
   }
-  if ( (tLowRadius < 0.0) || (tHighRadius < 0.0) ) {
-    cout << "AliFemtoCoulomb::CreateLookupTable --> Problem interpolating radius" << endl;
-    cout << "  Check range of radii in lookup file...." << endl;
-    cerr << "AliFemtoCoulomb::CreateLookupTable --> Problem interpolating radius" << endl;
-    cerr << "  Check range of radii in lookup file...." << endl;
+  mystream.close();
+  return content;
+}
+
+void AliFemtoCoulomb::CreateLookupTable(const double& radius)
+{ // Read radii from fFile
+  /// Create array(pair) of linear interpolation between radii
+  ///
+  /// The interpolated table of each file and radius is kept, so that
+  /// coming back to a radius does not repeat the interpolation.
+
+  if (radius < 0.0) {
+    cout << " AliFemtoCoulomb::CreateLookupTable -> NEGATIVE RADIUS " << endl;
+    cout << "  call AliFemtoCoulomb::SetRadius(r) with positive r " << endl;
+    cerr << " AliFemtoCoulomb::CreateLookupTable -> NEGATIVE RADIUS " << endl;
+    cerr << "  call AliFemtoCoulomb::SetRadius(r) with positive r " << endl;
     assert(0);
   }
 
-  static double corr[100];           // array of corrections ... must be > tNRadii
-  fNLines = 0;
-  static double tempEta = 0;
-  tempEta = 0;
-  while (mystream >> tempEta) {
-    for (int i=1; i<=tNRadii; i++) {
-      mystream >> corr[i];
+  const std::string file(fFile ? fFile : "");
+  const CorrectionFile &content = ReadFile(file);
+  std::vector<double> &table = fTables[std::make_pair(file, radius)];
+
+  if (table.empty()) {
+    cout << " AliFemtoCoulomb::CreateLookupTable() " << endl;
+
+    const std::vector<double> &radii = content.fRadii;
+    const int tNRadii = radii.size();
+    double tLowRadius = -1.0;
+    double tHighRadius = -1.0;
+    int tLowIndex = 0;
+    for (int iii=0; iii<tNRadii-1; iii++) { // Loop to one less than #radii
+      if ( radius >= radii[iii] && radius <= radii[iii+1] ) {
+        tLowRadius = radii[iii];
+        tHighRadius = radii[iii+1];
+        tLowIndex = iii;
+      }
     }
-    static double tLowCoulomb = 0;
-    static double tHighCoulomb = 0;
-    static double nCorr = 0;
-    tLowCoulomb = corr[tLowIndex];
-    tHighCoulomb = corr[tLowIndex+1];
-    nCorr = ( (radius-tLowRadius)*tHighCoulomb+(tHighRadius-radius)*tLowCoulomb )/(tHighRadius-tLowRadius);
-      fEta[fNLines] = tempEta;     // Eta
-      fCoulomb[fNLines] = nCorr;   // Interpolated Coulomb correction for radius
-      fNLines++;
+    if ( (tLowRadius < 0.0) || (tHighRadius < 0.0) ) {
+      cout << "AliFemtoCoulomb::CreateLookupTable --> Problem interpolating radius" << endl;
+      cout << "  Check range of radii in lookup file...." << endl;
+      cerr << "AliFemtoCoulomb::CreateLookupTable --> Problem interpolating radius" << endl;
+      cerr << "  Check range of radii in lookup file...." << endl;
+      assert(0);
+    }
+
+    const int tNLines = content.fEta.size();
+    table.resize(tNLines);
+    for (int line=0; line<tNLines; line++) {
+      const double tLowCoulomb = content.fCorrection[line*tNRadii + tLowIndex];
+      const double tHighCoulomb = content.fCorrection[line*tNRadii + tLowIndex + 1];
+      table[line] = ( (radius-tLowRadius)*tHighCoulomb+(tHighRadius-radius)*tLowCoulomb )/(tHighRadius-tLowRadius);
+    }
+    cout << "Lookup Table is created with " << tNLines << " points" << endl;
   }
-  mystream.close();
-  cout << "Lookup Table is created with " << fNLines << " points" << endl;
+
+  fEta = content.fEta.data();
+  fCoulomb = table.data();
+  fNLines = table.size();
 }
 
 double AliFemtoCoulomb::CoulombCorrect(const double& eta)
@@ -490,3 +522,21 @@ double AliFemtoCoulomb::CoulombCorrect(const double& mass,
                eta = 2.0 * fZ1Z2 * kReducedMass * fine_structure_const / qInv;
   return CoulombCorrect(eta, fRadius);
 }
+
+void AliFemtoCoulomb::CoulombCorrect(const double& mass,
+                                     const double& charge,
+                                     const double& radius,
+                                     const int& n,
+                                     const double* qInv,
+                                     double* correction)
+{
+  /// Corrections of n pairs of same mass particles, written to correction.
+  /// The look-up table is set up once for all of them.
+
+  fZ1Z2 = charge;
+  const double kEtaQInv = 2.0 * fZ1Z2 * 0.5 * mass * fine_structure_const;
+  for (int i = 0; i < n; i++) {
+    correction[i] = i ? CoulombCorrect(kEtaQInv / qInv[i])
+                      : CoulombCorrect(kEtaQInv / qInv[i], radius);
+  }
+}
@@ -6,10 +6,20 @@
 /// 2. Performs a linear interpolation in R and creates any array of
 ///    interpolations
 /// 3. Interpolates in eta and returns the Coulomb correction to user
+///
+/// Each file is read only once, and the table interpolated for each radius is
+/// kept, so switching between radii or charge products does not read the file
+/// again. Corrections for many pairs of a species can be requested at once
+/// with CoulombCorrect(mass, charge, radius, n, qInv, correction).
 
 #ifndef ALIFEMTOCOULOMB_H
 #define ALIFEMTOCOULOMB_H
 
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
 class TH1D;
 class TH3D;
 class AliFemtoPair;
@@ -37,6 +47,12 @@ public:
                         const double& charge,
                         const double& radius,
                         const double& qInv);
+  void CoulombCorrect(const double& mass,
+                      const double& charge,
+                      const double& radius,
+                      const int& n,
+                      const double* qInv,
+                      double* correction);
 
   TH1D* CorrectionHistogram(const double& mass1,
                             const double& mass2,
@@ -49,14 +65,24 @@ public:
   TH3D* CorrectionHistogram(const TH3D*, const double);
 #endif
 private:
+  /// Content of a correction file
+  struct CorrectionFile {
+    std::vector<double> fRadii;       ///< radii of the columns
+    std::vector<double> fEta;         ///< eta of the lines
+    std::vector<double> fCorrection;  ///< corrections, fRadii.size() per line
+  };
+
   double Eta(const AliFemtoPair* pair);          ///< Calculates eta
   void CreateLookupTable(const double& radius);  ///< Creates look-up table
+  const CorrectionFile& ReadFile(const std::string& file);  ///< Reads file, once
   const char* fFile;                             ///< File to interpolate corrections from
   double fRadius;                                ///< Radius from previous iteration
   double fZ1Z2;                                  ///< Charge product of particles
-  double fEta[1000];                             ///< interpolated Coulomb correction table
-  double fCoulomb[1000];                         ///< interpolated Coulomb correction table
+  const double* fEta;                            ///< eta of the look-up table
+  const double* fCoulomb;                        ///< interpolated Coulomb correction table
   int fNLines;                                   ///< Number of Eta's in lookup-table
+  std::map<std::string, CorrectionFile> fFiles;  ///< files read so far
+  std::map<std::pair<std::string, double>, std::vector<double> > fTables;  ///< tables by file and radius
 
 #ifdef __ROOT__
   /// \cond CLASSIMP
@@ -40,6 +40,7 @@ class AliFemtoPair;
 
 #include "AliFemtoString.h"
 #include "AliFemtoParticleCollection.h"
+#include "AliFemtoTrack.h"
 
 #include <TList.h>
 
@@ -72,6 +73,10 @@ public:
 
   virtual void Finish();
   virtual void Init();
+
+  /// Track fields used by the monitor (AliFemtoTrack::RequiredFields),
+  /// all by default
+  virtual unsigned int RequiredTrackFields() const { return AliFemtoTrack::kAllFields; }
 };
 
 inline
@@ -67,6 +67,20 @@ AliFemtoCutMonitorHandler& AliFemtoCutMonitorHandler::operator=(const AliFemtoCu
   return *this;
 }
 
+// ---------------------------------------------------------------------------
+unsigned int AliFemtoCutMonitorHandler::MonitorsRequiredTrackFields() const
+{
+  unsigned int fields = 0;
+  if (fCollectionsEmpty) return fields;
+
+  for (auto *cut_monitor : *fPassColl) {
+    fields |= cut_monitor->RequiredTrackFields();
+  }
+  for (auto *cut_monitor : *fFailColl) {
+    fields |= cut_monitor->RequiredTrackFields();
+  }
+  return fields;
+}
 // ---------------------------------------------------------------------------
 void AliFemtoCutMonitorHandler::FillCutMonitor(const AliFemtoEvent* event, bool pass)
 {
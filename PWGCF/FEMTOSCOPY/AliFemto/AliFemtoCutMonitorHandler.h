@@ -60,6 +60,9 @@ public:
   virtual void EventBegin(const AliFemtoEvent* aEvent);
   virtual void EventEnd(const AliFemtoEvent* aEvent);
 
+  /// Track fields used by the pass and fail cut monitors
+  unsigned int MonitorsRequiredTrackFields() const;
+
 private:
   bool fCollectionsEmpty;                  ///< Are the collections empty?
   AliFemtoCutMonitorCollection* fPassColl; ///< Collection of cut monitors for passed entities
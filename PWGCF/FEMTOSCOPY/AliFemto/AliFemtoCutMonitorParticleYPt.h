@@ -46,6 +46,7 @@ public:
   void Write();
 
   virtual TList *GetOutputList();
+  virtual unsigned int RequiredTrackFields() const { return 0; }
 
 private:
   TH2D *fYPt;     // Rapidity vs. Pt monitor
@@ -84,6 +84,7 @@ public:
   virtual bool Pass(const AliFemtoPair*);
   virtual AliFemtoString Report();
   virtual TList *ListSettings();
+  virtual unsigned int RequiredTrackFields() const { return 0; }
   AliFemtoDummyPairCut* Clone();
 
 private:
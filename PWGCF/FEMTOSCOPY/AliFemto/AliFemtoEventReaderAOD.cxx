@@ -26,6 +26,7 @@
 #include "AliAODpidUtil.h"
 #include "AliAnalysisUtils.h"
 #include "AliGenHijingEventHeader.h"
+#include "AliInputTreeCache.h"
 
 #include "AliExternalTrackParam.h"
 
@@ -91,6 +92,8 @@ AliFemtoEventReaderAOD::AliFemtoEventReaderAOD():
   fFlatCent(kFALSE),
   fPrimaryVertexCorrectionTPCPoints(kFALSE),
   fShiftPosition(0.),
+  fRequiredTrackFields(AliFemtoTrack::kAllFields),
+  fReadOnlyRequiredBranches(kFALSE),
   f1DcorrectionsPions(0),
   f1DcorrectionsKaons(0),
   f1DcorrectionsProtons(0),
@@ -224,6 +227,8 @@ AliFemtoEventReaderAOD::AliFemtoEventReaderAOD(const AliFemtoEventReaderAOD &aRe
   fFlatCent(aReader.fFlatCent),
   fPrimaryVertexCorrectionTPCPoints(aReader.fPrimaryVertexCorrectionTPCPoints),
   fShiftPosition(aReader.fShiftPosition),
+  fRequiredTrackFields(aReader.fRequiredTrackFields),
+  fReadOnlyRequiredBranches(aReader.fReadOnlyRequiredBranches),
   f1DcorrectionsPions(aReader.f1DcorrectionsPions),
   f1DcorrectionsKaons(aReader.f1DcorrectionsKaons),
   f1DcorrectionsProtons(aReader.f1DcorrectionsProtons),
@@ -346,6 +351,8 @@ AliFemtoEventReaderAOD &AliFemtoEventReaderAOD::operator=(const AliFemtoEventRea
   fFlatCent = aReader.fFlatCent;
   fPrimaryVertexCorrectionTPCPoints = aReader.fPrimaryVertexCorrectionTPCPoints;
   fShiftPosition = aReader.fShiftPosition;
+  fRequiredTrackFields = aReader.fRequiredTrackFields;
+  fReadOnlyRequiredBranches = aReader.fReadOnlyRequiredBranches;
   f1DcorrectionsPions = aReader.f1DcorrectionsPions;
   f1DcorrectionsKaons = aReader.f1DcorrectionsKaons;
   f1DcorrectionsProtons = aReader.f1DcorrectionsProtons;
@@ -440,6 +447,9 @@ AliFemtoEvent *AliFemtoEventReaderAOD::ReturnHbtEvent()
       // cout << "fEvent: " << fEvent << "\n";
       fEvent = new AliAODEvent();
       fEvent->ReadFromTree(fTree);
+      if (fReadOnlyRequiredBranches) {
+        DisableUnusedBranches();
+      }
 
       fNumberofEvent = fTree->GetEntries();
       // cout << "Number of entries in file " << fNumberofEvent << endl;
@@ -1455,23 +1465,25 @@ AliFemtoTrack *AliFemtoEventReaderAOD::CopyAODtoFemtoTrack(const AliAODTrack *tA
   tFemtoTrack->SetTPCClusterMap(tAodTrack->GetTPCClusterMap());
   tFemtoTrack->SetTPCSharedMap(tAodTrack->GetTPCSharedMap());
   tFemtoTrack->SetTPCNCrossedRows(tAodTrack->GetTPCCrossedRows());
-  float globalPositionsAtRadii[9][3];
   float bfield = 5 * fMagFieldSign;
 
-  GetGlobalPositionAtGlobalRadiiThroughTPC(tAodTrack, bfield, globalPositionsAtRadii);
+  if (fRequiredTrackFields & AliFemtoTrack::kNominalTPCPoints) {
+    float globalPositionsAtRadii[9][3];
+    GetGlobalPositionAtGlobalRadiiThroughTPC(tAodTrack, bfield, globalPositionsAtRadii);
 
-  AliFemtoThreeVector tpcPositions[9];
-  std::copy_n(globalPositionsAtRadii, 9, tpcPositions);
+    AliFemtoThreeVector tpcPositions[9];
+    std::copy_n(globalPositionsAtRadii, 9, tpcPositions);
 
-  if (fPrimaryVertexCorrectionTPCPoints) {
-    for (int i = 0; i < 9; i++) {
-      tpcPositions[i] -= kOrigin;
+    if (fPrimaryVertexCorrectionTPCPoints) {
+      for (int i = 0; i < 9; i++) {
+        tpcPositions[i] -= kOrigin;
+      }
     }
-  }
 
-  tFemtoTrack->SetNominalTPCEntrancePoint(tpcPositions[0]);
-  tFemtoTrack->SetNominalTPCPoints(tpcPositions);
-  tFemtoTrack->SetNominalTPCExitPoint(tpcPositions[8]);
+    tFemtoTrack->SetNominalTPCEntrancePoint(tpcPositions[0]);
+    tFemtoTrack->SetNominalTPCPoints(tpcPositions);
+    tFemtoTrack->SetNominalTPCExitPoint(tpcPositions[8]);
+  }
 
   if (fShiftPosition > 0.) {
     Float_t posShifted[3];
@@ -2344,6 +2356,7 @@ void AliFemtoEventReaderAOD::CopyPIDtoFemtoTrack(const AliAODTrack *tAodTrack, A
   aodpid[3] = -100000.0;
   aodpid[4] = -100000.0;
 
+  const bool readTOF = fRequiredTrackFields & AliFemtoTrack::kTOFInfo;
   double tTOF = 0.0;
   Float_t probMis = 1.0;
 
@@ -2352,7 +2365,8 @@ void AliFemtoEventReaderAOD::CopyPIDtoFemtoTrack(const AliAODTrack *tAodTrack, A
 
   ULong_t status = tAodTrack->GetStatus();
 
-  if (((status & AliVTrack::kTOFout) == AliVTrack::kTOFout)
+  if (readTOF
+      && ((status & AliVTrack::kTOFout) == AliVTrack::kTOFout)
       && ((status & AliVTrack::kTIME) == AliVTrack::kTIME))
   {
     tTOF = tAodTrack->GetTOFsignal();
@@ -2364,9 +2378,11 @@ void AliFemtoEventReaderAOD::CopyPIDtoFemtoTrack(const AliAODTrack *tAodTrack, A
     probMis = fAODpidUtil->GetTOFMismatchProbability(tAodTrack);
   }
 
-  // tFemtoTrack->SetTOFsignal(tTOF);
-  tFemtoTrack->SetTOFsignal(tAodTrack->GetTOFsignal());
-  tFemtoTrack->SetTofExpectedTimes(tTOF - aodpid[2], tTOF - aodpid[3], tTOF - aodpid[4], tTOF);
+  if (readTOF) {
+    // tFemtoTrack->SetTOFsignal(tTOF);
+    tFemtoTrack->SetTOFsignal(tAodTrack->GetTOFsignal());
+    tFemtoTrack->SetTofExpectedTimes(tTOF - aodpid[2], tTOF - aodpid[3], tTOF - aodpid[4], tTOF);
+  }
   //////  TPC ////////////////////////////////////////////
 
   const float nsigmaTPCK = fAODpidUtil->NumberOfSigmasTPC(tAodTrack, AliPID::kKaon);
@@ -2420,10 +2436,11 @@ void AliFemtoEventReaderAOD::CopyPIDtoFemtoTrack(const AliAODTrack *tAodTrack, A
   float nsigmaTOFA = -1000.;
   //
   /*******************************/
-  Double_t trackLength = tAodTrack->GetIntegratedLength();
-  Double_t trackTime = tAodTrack->GetTOFsignal() - fAODpidUtil->GetTOFResponse().GetStartTime(tAodTrack->P());
+  Double_t trackLength = readTOF ? tAodTrack->GetIntegratedLength() : 0.;
+  Double_t trackTime = readTOF ? tAodTrack->GetTOFsignal() - fAODpidUtil->GetTOFResponse().GetStartTime(tAodTrack->P()) : 0.;
 
-  if (((status & AliVTrack::kTOFout) == AliVTrack::kTOFout)
+  if (readTOF
+      && ((status & AliVTrack::kTOFout) == AliVTrack::kTOFout)
       && ((status & AliVTrack::kTIME) == AliVTrack::kTIME)
       && probMis < 0.01) {
 
@@ -2718,6 +2735,70 @@ void AliFemtoEventReaderAOD::SetPrimaryVertexCorrectionTPCPoints(bool correctTpc
   fPrimaryVertexCorrectionTPCPoints = correctTpcPoints;
 }
 
+void AliFemtoEventReaderAOD::SetRequiredTrackFields(UInt_t fields)
+{
+  fRequiredTrackFields = fields;
+}
+
+void AliFemtoEventReaderAOD::SetReadOnlyRequiredBranches(Bool_t readOnlyRequired)
+{
+  fReadOnlyRequiredBranches = readOnlyRequired;
+}
+
+void AliFemtoEventReaderAOD::RegisterUsedBranches(const char *tree) const
+{
+  // Complement of DisableUnusedBranches, for the trees read by the
+  // analysis framework (AliFemtoEventReaderAODChain)
+  AliInputTreeCache *cache = AliInputTreeCache::Instance();
+  cache->RegisterBranches(tree, "header* tracks* vertices* tracklets* AliAODVZERO*");
+  if (fReadV0 || fReadCascade) {
+    cache->RegisterBranch(tree, "v0s*");
+  }
+  if (fReadCascade) {
+    cache->RegisterBranch(tree, "cascades*");
+  }
+  if (fjets) {
+    cache->RegisterBranch(tree, "jets*");
+  }
+  if (fReadMC) {
+    cache->RegisterBranch(tree, Form("%s*", AliAODMCParticle::StdBranchName()));
+    cache->RegisterBranch(tree, Form("%s*", AliAODMCHeader::StdBranchName()));
+  }
+}
+
+void AliFemtoEventReaderAOD::DisableUnusedBranches()
+{
+  // Switches off the branches of fTree which are never accessed by the
+  // reader, has to be called after AliAODEvent::ReadFromTree
+  const char *unused[] = {"emcalCells", "phosCells", "caloClusters",
+                          "emcalTrigger", "phosTrigger", "fmdClusters",
+                          "pmdClusters", "dimuons"};
+  for (const char *branch : unused) {
+    if (fTree->GetBranch(branch)) {
+      fTree->SetBranchStatus(Form("%s*", branch), 0);
+    }
+  }
+  if (!fReadCascade) {
+    if (fTree->GetBranch("cascades")) {
+      fTree->SetBranchStatus("cascades*", 0);
+    }
+    if (!fReadV0 && fTree->GetBranch("v0s")) {
+      fTree->SetBranchStatus("v0s*", 0);
+    }
+  }
+  if (!fjets && fTree->GetBranch("jets")) {
+    fTree->SetBranchStatus("jets*", 0);
+  }
+  if (!fReadMC) {
+    if (fTree->GetBranch(AliAODMCParticle::StdBranchName())) {
+      fTree->SetBranchStatus(Form("%s*", AliAODMCParticle::StdBranchName()), 0);
+    }
+    if (fTree->GetBranch(AliAODMCHeader::StdBranchName())) {
+      fTree->SetBranchStatus(Form("%s*", AliAODMCHeader::StdBranchName()), 0);
+    }
+  }
+}
+
 void AliFemtoEventReaderAOD::Set1DCorrectionsPions(TH1D *h1)
 {
   f1DcorrectionsPions = h1;
@@ -128,6 +128,25 @@ public:
 
   void SetShiftedPositions(const AliAODTrack *track ,const Float_t bfield, Float_t posShifted[3], const Double_t radius=1.25);
 
+  /// Track fields (AliFemtoTrack::RequiredFields) computed when converting
+  /// the AOD tracks, all by default. Fields which are not required keep the
+  /// default values of AliFemtoTrack (TOF n sigmas -1000, as for tracks
+  /// without TOF). Typically set to AliFemtoManager::RequiredTrackFields()
+  /// after all analyses were added to the manager.
+  void SetRequiredTrackFields(UInt_t fields);
+  UInt_t GetRequiredTrackFields() const {
+    return fRequiredTrackFields;
+  }
+
+  /// When reading the AODs from the files given with SetInputFile, do not
+  /// read the branches the reader does not use (calorimeters, FMD, PMD,
+  /// muons and, depending on the settings, V0s, cascades, jets and MC)
+  void SetReadOnlyRequiredBranches(Bool_t readOnlyRequired);
+
+  /// Register the branches read by the reader in AliInputTreeCache, so that
+  /// the input tree cache reads them from the first entry
+  void RegisterUsedBranches(const char *tree = "aodTree") const;
+
   void SetUseAliEventCuts(Bool_t useAliEventCuts);
   void SetReadFullMCData(Bool_t should_read=true);
   bool GetReadFullMCData() const;
@@ -240,6 +259,7 @@ protected:
 private:
 
   AliAODMCParticle *GetParticleWithLabel(TClonesArray *mcP, Int_t aLabel);
+  void DisableUnusedBranches();
 
   string fInputFile;       ///< name of input file with AOD filenames
   TChain *fTree;           ///< AOD tree
@@ -260,6 +280,8 @@ private:
   Bool_t fFlatCent;        ///< Boolean determining if the user should flatten the centrality
   Bool_t fPrimaryVertexCorrectionTPCPoints; ///< Boolean determining if the reader should shift all TPC points to be relative to event vertex
   Double_t fShiftPosition; ///< radius at which the spatial position of the track in the shifted coordinate system is calculated
+  UInt_t fRequiredTrackFields; ///< track fields computed in CopyAODtoFemtoTrack, see AliFemtoTrack::RequiredFields
+  Bool_t fReadOnlyRequiredBranches; ///< disable the unused branches of the AOD tree read from fInputFile
   TH1D *f1DcorrectionsPions;    ///<file with corrections, pT dependant
   TH1D *f1DcorrectionsKaons;    ///<file with corrections, pT dependant
   TH1D *f1DcorrectionsProtons;    ///<file with corrections, pT dependant
@@ -309,7 +331,7 @@ private:
 
 #ifdef __ROOT__
   /// \cond CLASSIMP
-  ClassDef(AliFemtoEventReaderAOD, 36);
+  ClassDef(AliFemtoEventReaderAOD, 37);
   /// \endcond
 #endif
 
@@ -8,10 +8,22 @@
 ///////////////////////////////////////////////////////////////////////////
 
 #include "AliFemtoManager.h"
+#include "AliFemtoSimpleAnalysis.h"
+#include "AliFemtoEventAnalysis.h"
+#include "AliFemtoModelCorrFctn.h"
 //#include "AliFemtoParticleCollection.h"
 //#include "AliFemtoTrackCut.h"
 //#include "AliFemtoV0Cut.h"
 #include <cstdio>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <TROOT.h>
 
 #ifdef __ROOT__
   /// \cond CLASSIMP
@@ -19,13 +31,125 @@
   /// \endcond
 #endif
 
+/// \class AliFemtoManagerThreadPool
+/// \brief Threads processing the analyses of the manager, kept for the whole run
+///
+/// The workers wait for the next event; the thread calling Run() processes
+/// analyses as well and returns once all analyses were given the event.
+class AliFemtoManagerThreadPool {
+public:
+  AliFemtoManagerThreadPool(unsigned int nThreads, size_t nAnalyses);
+  ~AliFemtoManagerThreadPool();
+
+  void Run(AliFemtoAnalysisCollection* analyses, const AliFemtoEvent* event);
+  size_t NumberOfAnalyses() const { return fNAnalyses; }
+
+private:
+  AliFemtoManagerThreadPool(const AliFemtoManagerThreadPool&);
+  AliFemtoManagerThreadPool& operator=(const AliFemtoManagerThreadPool&);
 
+  void WorkerLoop();
+  void ProcessAnalyses();
+
+  std::vector<std::thread> fWorkers;      ///< threads besides the calling one
+  std::mutex fMutex;                      ///< protects the fields below
+  std::condition_variable fStart;         ///< signals a new event (or the stop) to the workers
+  std::condition_variable fDone;          ///< signals the end of the workers to Run()
+  unsigned long fGeneration;              ///< number of the current event
+  unsigned int fNBusy;                    ///< workers still processing the current event
+  bool fStop;                             ///< workers have to terminate
+  size_t fNAnalyses;                      ///< number of analyses checked when the pool was created
+  std::vector<AliFemtoAnalysis*> fAnalyses; ///< analyses of the current event
+  const AliFemtoEvent* fEvent;            ///< current event
+  std::atomic<size_t> fNext;              ///< next analysis to be processed
+};
+
+//____________________________
+AliFemtoManagerThreadPool::AliFemtoManagerThreadPool(unsigned int nThreads, size_t nAnalyses):
+  fWorkers(),
+  fMutex(),
+  fStart(),
+  fDone(),
+  fGeneration(0),
+  fNBusy(0),
+  fStop(false),
+  fNAnalyses(nAnalyses),
+  fAnalyses(),
+  fEvent(nullptr),
+  fNext(0)
+{
+  // the calling thread is one of the workers
+  for (unsigned int t = 1; t < nThreads; t++) {
+    fWorkers.emplace_back(&AliFemtoManagerThreadPool::WorkerLoop, this);
+  }
+}
+//____________________________
+AliFemtoManagerThreadPool::~AliFemtoManagerThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(fMutex);
+    fStop = true;
+  }
+  fStart.notify_all();
+  for (auto &thread : fWorkers) {
+    thread.join();
+  }
+}
+//____________________________
+void AliFemtoManagerThreadPool::Run(AliFemtoAnalysisCollection* analyses, const AliFemtoEvent* event)
+{
+  // pass the event to all the analyses and wait until they are done
+  {
+    std::lock_guard<std::mutex> lock(fMutex);
+    fAnalyses.assign(analyses->begin(), analyses->end());
+    fEvent = event;
+    fNext = 0;
+    fNBusy = fWorkers.size();
+    fGeneration++;
+  }
+  fStart.notify_all();
+
+  ProcessAnalyses();
+
+  std::unique_lock<std::mutex> lock(fMutex);
+  fDone.wait(lock, [this]() { return fNBusy == 0; });
+}
+//____________________________
+void AliFemtoManagerThreadPool::WorkerLoop()
+{
+  unsigned long seen = 0;
+  std::unique_lock<std::mutex> lock(fMutex);
+  while (true) {
+    fStart.wait(lock, [this, seen]() { return fStop || fGeneration != seen; });
+    if (fStop) {
+      return;
+    }
+    seen = fGeneration;
+    lock.unlock();
+    ProcessAnalyses();
+    lock.lock();
+    if (--fNBusy == 0) {
+      fDone.notify_one();
+    }
+  }
+}
+//____________________________
+void AliFemtoManagerThreadPool::ProcessAnalyses()
+{
+  // each thread takes the next analysis not yet processed, so that the
+  // threads stay busy if the analyses have different processing times
+  for (size_t i = fNext++; i < fAnalyses.size(); i = fNext++) {
+    fAnalyses[i]->ProcessEvent(fEvent);
+  }
+}
 
 //____________________________
 AliFemtoManager::AliFemtoManager():
   fAnalysisCollection(nullptr),
   fEventReader(nullptr),
-  fEventWriterCollection(nullptr)
+  fEventWriterCollection(nullptr),
+  fNumberOfThreads(1),
+  fThreadPool(nullptr)
 {
   // default constructor
   fAnalysisCollection = new AliFemtoAnalysisCollection;
@@ -35,7 +159,9 @@ AliFemtoManager::AliFemtoManager():
 AliFemtoManager::AliFemtoManager(const AliFemtoManager& aManager):
   fAnalysisCollection(new AliFemtoAnalysisCollection),
   fEventReader(aManager.fEventReader),
-  fEventWriterCollection(new AliFemtoEventWriterCollection)
+  fEventWriterCollection(new AliFemtoEventWriterCollection),
+  fNumberOfThreads(aManager.fNumberOfThreads),
+  fThreadPool(nullptr)
 {
   // copy constructor
   for (auto *analysis : *aManager.fAnalysisCollection) {
@@ -50,6 +176,7 @@ AliFemtoManager::AliFemtoManager(const AliFemtoManager& aManager):
 AliFemtoManager::~AliFemtoManager()
 {
   // destructor
+  delete fThreadPool;
   delete fEventReader;
   // now delete each Analysis in the Collection, and then the Collection itself
   for (auto *analysis : *fAnalysisCollection) {
@@ -71,7 +198,7 @@ AliFemtoManager& AliFemtoManager::operator=(const AliFemtoManager& aManager)
   }
 
   fEventReader = aManager.fEventReader;
-
+  SetNumberOfThreads(aManager.fNumberOfThreads);
 
   for (auto *analysis : *fAnalysisCollection) {
     delete analysis;
@@ -166,6 +293,15 @@ AliFemtoString AliFemtoManager::Report()
   return report;
 }
 //____________________________
+unsigned int AliFemtoManager::RequiredTrackFields() const
+{
+  unsigned int fields = 0;
+  for (auto *analysis : *fAnalysisCollection) {
+    fields |= analysis->RequiredTrackFields();
+  }
+  return fields;
+}
+//____________________________
 AliFemtoAnalysis* AliFemtoManager::Analysis( int n )
 {  // return pointer to n-th analysis
   if ( n < 0 || n > (int) fAnalysisCollection->size() ) {
@@ -210,8 +346,12 @@ int AliFemtoManager::ProcessEvent()
   }
 
   // loop over all the Analysis
-  for (auto *analysis : *fAnalysisCollection) {
-    analysis->ProcessEvent(currentHbtEvent);
+  if (fNumberOfThreads > 1 && fAnalysisCollection->size() > 1 && PrepareThreadPool()) {
+    fThreadPool->Run(fAnalysisCollection, currentHbtEvent);
+  } else {
+    for (auto *analysis : *fAnalysisCollection) {
+      analysis->ProcessEvent(currentHbtEvent);
+    }
   }
 
   if (currentHbtEvent) {
@@ -221,3 +361,99 @@ int AliFemtoManager::ProcessEvent()
 
   return 0;    // 0 = "good return"
 }       // ProcessEvent
+//____________________________
+void AliFemtoManager::SetNumberOfThreads(unsigned int n)
+{
+  // set the number of threads processing the analyses, the threads are
+  // started with the first event
+  if (n != fNumberOfThreads) {
+    delete fThreadPool;
+    fThreadPool = nullptr;
+  }
+  fNumberOfThreads = n;
+}
+//____________________________
+bool AliFemtoManager::PrepareThreadPool()
+{
+  // start the threads once, or again if analyses were added since then;
+  // falls back to the sequential processing if the analyses share objects
+  if (fThreadPool && fThreadPool->NumberOfAnalyses() == fAnalysisCollection->size()) {
+    return true;
+  }
+  delete fThreadPool;
+  fThreadPool = nullptr;
+
+  if (!AnalysesAreIndependent()) {
+    cout << "W-AliFemtoManager::ProcessEvent: the analyses share cuts, cut monitors, "
+            "correlation functions or model managers - processing them sequentially" << endl;
+    fNumberOfThreads = 1;
+    return false;
+  }
+
+  // required for filling histograms and creating objects from several threads
+  static bool threadSafetyEnabled = false;
+  if (!threadSafetyEnabled) {
+    ROOT::EnableThreadSafety();
+    threadSafetyEnabled = true;
+  }
+
+  const size_t nThreads = std::min<size_t>(fNumberOfThreads, fAnalysisCollection->size());
+  fThreadPool = new AliFemtoManagerThreadPool(nThreads, fAnalysisCollection->size());
+  return true;
+}
+//____________________________
+bool AliFemtoManager::AnalysesAreIndependent() const
+{
+  // check that no cut, cut monitor, correlation function or model manager
+  // is used by more than one analysis. Only AliFemtoSimpleAnalysis and
+  // AliFemtoEventAnalysis (and derived classes) can be checked, other
+  // analysis types are never processed concurrently.
+  std::set<const void*> used;
+
+  for (auto *analysis : *fAnalysisCollection) {
+    std::set<const void*> objects;
+    std::vector<AliFemtoCutMonitorHandler*> cuts;
+    AliFemtoCorrFctnCollection* corrFctns = nullptr;
+
+    if (auto *simple = dynamic_cast<AliFemtoSimpleAnalysis*>(analysis)) {
+      cuts = {simple->EventCut(), simple->FirstParticleCut(), simple->SecondParticleCut(), simple->PairCut()};
+      corrFctns = simple->CorrFctnCollection();
+    } else if (auto *eventAnalysis = dynamic_cast<AliFemtoEventAnalysis*>(analysis)) {
+      cuts = {eventAnalysis->EventCut(), eventAnalysis->FirstParticleCut(), eventAnalysis->SecondParticleCut()};
+      corrFctns = eventAnalysis->CorrFctnCollection();
+    } else {
+      return false;
+    }
+
+    // the same cut may be used for both particles of one analysis
+    for (auto *cut : cuts) {
+      if (!cut) {
+        continue;
+      }
+      objects.insert(cut);
+      for (auto *monitor : *cut->PassMonitorColl()) {
+        objects.insert(monitor);
+      }
+      for (auto *monitor : *cut->FailMonitorColl()) {
+        objects.insert(monitor);
+      }
+    }
+    if (corrFctns) {
+      for (auto *corrFctn : *corrFctns) {
+        objects.insert(corrFctn);
+        if (auto *modelCorrFctn = dynamic_cast<AliFemtoModelCorrFctn*>(corrFctn)) {
+          if (modelCorrFctn->GetManager()) {
+            objects.insert(modelCorrFctn->GetManager());
+          }
+        }
+      }
+    }
+
+    for (const void *object : objects) {
+      if (!used.insert(object).second) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
@@ -19,6 +19,8 @@
 #include "AliFemtoEventReader.h"
 #include "AliFemtoEventWriter.h"
 
+class AliFemtoManagerThreadPool;
+
 
 /// \class AliFemtoManager
 /// \brief Main class for managing femtoscopic analyses
@@ -43,16 +45,37 @@
 /// operator private prevents potential dangling pointer (segfault)
 /// errors.
 ///
+/// With `SetNumberOfThreads(n)`, n > 1, the analyses are processed
+/// concurrently by n threads in `ProcessEvent()`. This is opt-in and
+/// requires that no two analyses write to the same object: the analyses
+/// only read the shared AliFemtoEvent, and each analysis must own its
+/// cuts, cut monitors, mixing buffer, correlation functions and model
+/// manager. Before starting the threads the manager checks the cuts,
+/// their monitors, the correlation functions and the model manager of
+/// AliFemtoModelCorrFctn objects, and falls back to the sequential
+/// processing if one of them is used by several analyses, or if an
+/// analysis is neither an AliFemtoSimpleAnalysis nor an
+/// AliFemtoEventAnalysis. Objects shared in other ways (e.g. the model
+/// manager of correlation functions not derived from
+/// AliFemtoModelCorrFctn) are not detected. The threads are started with
+/// the first event and kept until the manager is deleted. The event
+/// writers are always called sequentially before the analyses.
+///
 class AliFemtoManager {
 
 private:
   AliFemtoAnalysisCollection* fAnalysisCollection;       ///< Collection of analyzes
   AliFemtoEventReader*        fEventReader;              ///< Event reader
   AliFemtoEventWriterCollection* fEventWriterCollection; ///< Event writer collection
+  unsigned int fNumberOfThreads;                         ///< Number of threads processing the analyses (<= 1: sequential)
+  AliFemtoManagerThreadPool* fThreadPool;                //!<! Threads processing the analyses, started with the first event
 
   AliFemtoManager(const AliFemtoManager& aManager);
   AliFemtoManager& operator=(const AliFemtoManager& aManager);
 
+  bool PrepareThreadPool();
+  bool AnalysesAreIndependent() const;
+
 public:
   AliFemtoManager();
   virtual ~AliFemtoManager();
@@ -70,6 +93,11 @@ public:
   AliFemtoEventReader* EventReader();
   void SetEventReader(AliFemtoEventReader* r);
 
+  /// Process the analyses of each event concurrently with n threads,
+  /// see the class description for the requirements on the analyses
+  void SetNumberOfThreads(unsigned int n);
+  unsigned int GetNumberOfThreads() const;
+
   /// Calls `Init()` on all owned EventWriters
   ///
   /// Returns 0 for success, 1 for failure.
@@ -82,6 +110,11 @@ public:
   void Finish();
 
   AliFemtoString Report(); //!<
+
+  /// Track fields used by any of the analyses, to be passed to the reader
+  /// (e.g. AliFemtoEventReaderAOD::SetRequiredTrackFields) once all analyses
+  /// were added
+  unsigned int RequiredTrackFields() const;
 #ifdef __ROOT__
   /// \cond CLASSIMP
   ClassDef(AliFemtoManager, 0);
@@ -99,4 +132,6 @@ inline void AliFemtoManager::SetEventWriter(AliFemtoEventWriter* writer){fEventW
 inline AliFemtoEventReader* AliFemtoManager::EventReader(){return fEventReader;}
 inline void AliFemtoManager::SetEventReader(AliFemtoEventReader* reader){fEventReader = reader;}
 
+inline unsigned int AliFemtoManager::GetNumberOfThreads() const {return fNumberOfThreads;}
+
 #endif
@@ -24,6 +24,7 @@ public:
   AliFemtoModelCorrFctn& operator=(const AliFemtoModelCorrFctn& aCorrFctn);
 
   virtual void ConnectToManager(AliFemtoModelManager *aManager);
+  AliFemtoModelManager* GetManager() const { return fManager; }
 
   virtual AliFemtoString Report();
 
@@ -21,6 +21,12 @@
 //#include <iomanip>
 #include <sstream>
 
+#include <TFile.h>
+#include <TH3F.h>
+#include <TMath.h>
+#include <TObjArray.h>
+#include <TRandom3.h>
+
 #ifdef SOLARIS
 # ifndef false
 typedef int bool;
@@ -161,6 +167,13 @@ AliFemtoModelWeightGeneratorLednicky::AliFemtoModelWeightGeneratorLednicky()
   , fNumbNonId(0)
   , fKpKmModel(14)
   , fPhi_OffOn(1)
+  , fTabulated(kFALSE)
+  , fTableNK(200)
+  , fTableKMax(1.0)
+  , fTableNR(100)
+  , fTableRMax(50.0)
+  , fTableNCos(40)
+  , fWeightTables(nullptr)
 {
   // default constructor
   fNumProcessPair = new int[fLLMax+1];
@@ -199,6 +212,13 @@ AliFemtoModelWeightGeneratorLednicky
   , fNumbNonId(aWeight.fNumbNonId)
   , fKpKmModel(aWeight.fKpKmModel)
   , fPhi_OffOn(aWeight.fPhi_OffOn)
+  , fTabulated(aWeight.fTabulated)
+  , fTableNK(aWeight.fTableNK)
+  , fTableKMax(aWeight.fTableKMax)
+  , fTableNR(aWeight.fTableNR)
+  , fTableRMax(aWeight.fTableRMax)
+  , fTableNCos(aWeight.fTableNCos)
+  , fWeightTables(aWeight.fWeightTables ? static_cast<TObjArray*>(aWeight.fWeightTables->Clone()) : nullptr)
 {
   fNumProcessPair = new int[fLLMax+1];
   for (int i=1;i<=fLLMax;i++) {
@@ -247,6 +267,15 @@ AliFemtoModelWeightGeneratorLednicky::operator=(const AliFemtoModelWeightGenerat
   fKpKmModel = aWeight.fKpKmModel;
   fPhi_OffOn = aWeight.fPhi_OffOn;
 
+  fTabulated = aWeight.fTabulated;
+  fTableNK = aWeight.fTableNK;
+  fTableKMax = aWeight.fTableKMax;
+  fTableNR = aWeight.fTableNR;
+  fTableRMax = aWeight.fTableRMax;
+  fTableNCos = aWeight.fTableNCos;
+  delete fWeightTables;
+  fWeightTables = aWeight.fWeightTables ? static_cast<TObjArray*>(aWeight.fWeightTables->Clone()) : nullptr;
+
   for (int i=1;i<=fLLMax;i++) {
     fNumProcessPair[i] = 0;
   }
@@ -395,6 +424,19 @@ double AliFemtoModelWeightGeneratorLednicky::GenerateWeight(AliFemtoPair* aPair)
     return 0;
   }
 
+  // tabulated weight: only depends on k*, r* and the angle between them
+  if (fTabulated && fI3c == 0 && !(epoint1 == epoint2)) {
+    const TH3F *table = GetWeightTable();
+    if (table && fKStar <= table->GetXaxis()->GetXmax() && fRStar <= table->GetYaxis()->GetXmax()) {
+      const double tCosTheta = (fKStar > 0 && fRStar > 0)
+                             ? (fKStarOut*fRStarOut + fKStarSide*fRStarSide + fKStarLong*fRStarLong) / (fKStar*fRStar)
+                             : 1.0;
+      fWein = InterpolateWeight(table, fKStar, fRStar, tCosTheta);
+      aPair->AddWeightToCache(this, fWein);
+      return fWein;
+    }
+  }
+
   double p1[] = {true_p1.x(), true_p1.y(), true_p1.z()},
          p2[] = {true_p2.x(), true_p2.y(), true_p2.z()};
 
@@ -677,6 +719,7 @@ AliFemtoModelWeightGeneratorLednicky::~AliFemtoModelWeightGeneratorLednicky()
   if (fNumProcessPair) {
     delete [] fNumProcessPair;
   }
+  delete fWeightTables;
 }
 
 
@@ -813,3 +856,249 @@ AliFemtoModelWeightGeneratorLednicky::Clone() const
   AliFemtoModelWeightGenerator* tmp = new AliFemtoModelWeightGeneratorLednicky(*this);
   return tmp;
 }
+
+//_____________________________________________
+void AliFemtoModelWeightGeneratorLednicky::SetTabulatedWeights(Bool_t use, Int_t nKStar, Double_t kStarMax, Int_t nRStar, Double_t rStarMax, Int_t nCosTheta)
+{
+  // use the interpolation in tables of (k*, r*, cos(theta)) with the given number of grid points
+  // existing tables with a different grid are rebuilt
+  fTabulated = use;
+  if (nKStar != fTableNK || kStarMax != fTableKMax || nRStar != fTableNR || rStarMax != fTableRMax || nCosTheta != fTableNCos) {
+    delete fWeightTables;
+    fWeightTables = nullptr;
+  }
+  fTableNK = TMath::Max(nKStar, 2);
+  fTableKMax = kStarMax;
+  fTableNR = TMath::Max(nRStar, 2);
+  fTableRMax = rStarMax;
+  fTableNCos = TMath::Max(nCosTheta, 2);
+}
+
+//_____________________________________________
+TString AliFemtoModelWeightGeneratorLednicky::WeightTableSettings() const
+{
+  // the calculation settings the weight tables depend on
+  return TString::Format("ich=%d iqs=%d isi=%d sphere=%d t0=%d ns=%d kpkm=%d/%d",
+                         fIch, fIqs, fIsi, fSphereApp, fT0App, fNS, fKpKmModel, fPhi_OffOn);
+}
+
+//_____________________________________________
+Double_t AliFemtoModelWeightGeneratorLednicky::ExactPRFWeight(Double_t aKStar, Double_t aRStar, Double_t aCosTheta)
+{
+  // weight from the fortran routine for a pair given in the pair rest frame:
+  // k* along z, r* in the x-z plane, equal emission times
+  double p1[] = {0., 0., aKStar},
+         p2[] = {0., 0., -aKStar};
+  fsimomentum(*p1, *p2);
+
+  const double tSinTheta = ::sqrt(TMath::Max(0., 1. - aCosTheta*aCosTheta));
+  double x1[] = {aRStar*tSinTheta, 0., aRStar*aCosTheta, 0.},
+         x2[] = {0., 0., 0., 0.};
+  fsiposition(*x1, *x2);
+
+  FsiSetLL();
+  FsiInit();
+  ltran12();
+  double tWeif = 0, tWei = 0, tWein = 0;
+  fsiw(1, tWeif, tWei, tWein);
+  return tWein;
+}
+
+//_____________________________________________
+TH3F* AliFemtoModelWeightGeneratorLednicky::GetWeightTable()
+{
+  // table of the current pair type, filled with the exact routine if not
+  // available or if the calculation settings have changed
+  if (fLL <= 0 || fLL > fLLMax) {
+    return nullptr;
+  }
+
+  if (!fWeightTables) {
+    fWeightTables = new TObjArray(fLLMax+1);
+    fWeightTables->SetOwner();
+  }
+
+  const TString tSettings = WeightTableSettings();
+  TH3F *table = static_cast<TH3F*>(fWeightTables->At(fLL));
+  if (table && tSettings == table->GetTitle()) {
+    return table;
+  }
+  delete table;
+
+  std::cout << "AliFemtoModelWeightGeneratorLednicky: filling weight table for " << fLLName[fLL]
+            << " (" << fTableNK << " x " << fTableNR << " x " << fTableNCos << " points)" << std::endl;
+
+  table = new TH3F(TString::Format("fsiweight_LL%d", fLL), tSettings,
+                   fTableNK, 0., fTableKMax,
+                   fTableNR, 0., fTableRMax,
+                   fTableNCos, -1., 1.);
+  table->SetDirectory(nullptr);
+
+  for (int i = 1; i <= fTableNK; i++) {
+    const double tKStar = table->GetXaxis()->GetBinCenter(i);
+    for (int j = 1; j <= fTableNR; j++) {
+      const double tRStar = table->GetYaxis()->GetBinCenter(j);
+      for (int k = 1; k <= fTableNCos; k++) {
+        table->SetBinContent(i, j, k, ExactPRFWeight(tKStar, tRStar, table->GetZaxis()->GetBinCenter(k)));
+      }
+    }
+  }
+
+  fWeightTables->AddAt(table, fLL);
+  return table;
+}
+
+namespace {
+  // lower grid point (bin) and fraction for linear interpolation between
+  // bin centers, clamped to the first and last bin center
+  double GridPosition(const TAxis *axis, double x, int &bin)
+  {
+    const int n = axis->GetNbins();
+    const double u = (x - axis->GetXmin()) / axis->GetBinWidth(1) - 0.5;
+    if (u <= 0) {
+      bin = 1;
+      return 0.;
+    }
+    if (u >= n - 1) {
+      bin = n - 1;
+      return 1.;
+    }
+    bin = int(u) + 1;
+    return u - int(u);
+  }
+}
+
+//_____________________________________________
+Double_t AliFemtoModelWeightGeneratorLednicky::InterpolateWeight(const TH3F* aTable, Double_t aKStar, Double_t aRStar, Double_t aCosTheta) const
+{
+  // trilinear interpolation in the weight table
+  int i, j, k;
+  const double
+    fx = GridPosition(aTable->GetXaxis(), aKStar, i),
+    fy = GridPosition(aTable->GetYaxis(), aRStar, j),
+    fz = GridPosition(aTable->GetZaxis(), aCosTheta, k);
+
+  double w = 0;
+  for (int di = 0; di < 2; di++) {
+    const double wx = di ? fx : 1. - fx;
+    for (int dj = 0; dj < 2; dj++) {
+      const double wy = dj ? fy : 1. - fy;
+      for (int dk = 0; dk < 2; dk++) {
+        const double wz = dk ? fz : 1. - fz;
+        w += wx * wy * wz * aTable->GetBinContent(i + di, j + dj, k + dk);
+      }
+    }
+  }
+  return w;
+}
+
+//_____________________________________________
+Bool_t AliFemtoModelWeightGeneratorLednicky::SaveWeightTables(const char* fileName) const
+{
+  // write the weight tables filled so far, to be read with LoadWeightTables
+  if (!fWeightTables) {
+    std::cout << "AliFemtoModelWeightGeneratorLednicky::SaveWeightTables - no tables" << std::endl;
+    return kFALSE;
+  }
+
+  TFile *file = TFile::Open(fileName, "RECREATE");
+  if (!file || file->IsZombie()) {
+    std::cout << "AliFemtoModelWeightGeneratorLednicky::SaveWeightTables - cannot open " << fileName << std::endl;
+    delete file;
+    return kFALSE;
+  }
+  for (int i = 0; i <= fWeightTables->GetLast(); i++) {
+    if (fWeightTables->At(i)) {
+      fWeightTables->At(i)->Write();
+    }
+  }
+  file->Close();
+  delete file;
+  return kTRUE;
+}
+
+//_____________________________________________
+Bool_t AliFemtoModelWeightGeneratorLednicky::LoadWeightTables(const char* fileName)
+{
+  // read weight tables written by SaveWeightTables
+  // tables computed with other calculation settings are not used
+  // the grid is taken from the file, fTabulated is switched on
+  TFile *file = TFile::Open(fileName);
+  if (!file || file->IsZombie()) {
+    std::cout << "AliFemtoModelWeightGeneratorLednicky::LoadWeightTables - cannot open " << fileName << std::endl;
+    delete file;
+    return kFALSE;
+  }
+
+  if (!fWeightTables) {
+    fWeightTables = new TObjArray(fLLMax+1);
+    fWeightTables->SetOwner();
+  }
+
+  const TString tSettings = WeightTableSettings();
+  int nLoaded = 0;
+  for (int ll = 1; ll <= fLLMax; ll++) {
+    TH3F *table = dynamic_cast<TH3F*>(file->Get(TString::Format("fsiweight_LL%d", ll)));
+    if (!table) {
+      continue;
+    }
+    if (tSettings != table->GetTitle()) {
+      std::cout << "AliFemtoModelWeightGeneratorLednicky::LoadWeightTables - skipping table for "
+                << fLLName[ll] << " computed with " << table->GetTitle() << std::endl;
+      continue;
+    }
+    table->SetDirectory(nullptr);
+    delete fWeightTables->At(ll);
+    fWeightTables->AddAt(table, ll);
+    nLoaded++;
+
+    fTableNK = table->GetNbinsX();
+    fTableKMax = table->GetXaxis()->GetXmax();
+    fTableNR = table->GetNbinsY();
+    fTableRMax = table->GetYaxis()->GetXmax();
+    fTableNCos = table->GetNbinsZ();
+  }
+  file->Close();
+  delete file;
+
+  fTabulated = kTRUE;
+  return nLoaded > 0;
+}
+
+//_____________________________________________
+Double_t AliFemtoModelWeightGeneratorLednicky::ValidateWeightTable(Int_t nPoints, UInt_t seed)
+{
+  // compare the interpolated with the exact weight at random points
+  const TH3F *table = GetWeightTable();
+  if (!table || nPoints <= 0) {
+    return -1;
+  }
+
+  TRandom3 rng(seed);
+  const double
+    kMin = table->GetXaxis()->GetBinCenter(1), kMax = table->GetXaxis()->GetXmax(),
+    rMin = table->GetYaxis()->GetBinCenter(1), rMax = table->GetYaxis()->GetXmax();
+
+  double sum = 0, maxDiff = 0, maxK = 0, maxR = 0, maxCos = 0;
+  for (int n = 0; n < nPoints; n++) {
+    const double
+      tKStar = rng.Uniform(kMin, kMax),
+      tRStar = rng.Uniform(rMin, rMax),
+      tCosTheta = rng.Uniform(-1., 1.);
+
+    const double diff = fabs(InterpolateWeight(table, tKStar, tRStar, tCosTheta) - ExactPRFWeight(tKStar, tRStar, tCosTheta));
+    sum += diff;
+    if (diff > maxDiff) {
+      maxDiff = diff;
+      maxK = tKStar;
+      maxR = tRStar;
+      maxCos = tCosTheta;
+    }
+  }
+
+  std::cout << "AliFemtoModelWeightGeneratorLednicky::ValidateWeightTable - " << fLLName[fLL] << ": "
+            << "mean |tabulated - exact| = " << sum / nPoints
+            << ", max = " << maxDiff << " at k* = " << maxK << " r* = " << maxR << " cos(theta) = " << maxCos << std::endl;
+
+  return maxDiff;
+}
@@ -12,6 +12,11 @@
 #include <vector>
 #include <string>
 
+#include <TString.h>
+
+class TH3F;
+class TObjArray;
+
 
 /// \class AliFemtoModelWeightGeneratorLednicky
 /// \brief The most advanced femto weight generator available
@@ -78,6 +83,25 @@ public:
 
   virtual AliFemtoString Report();
 
+// >>> Tabulated weights
+//
+// Instead of calling the fortran routine for every pair, the weight is
+// interpolated (trilinear) in a table of k*, r* and cos(theta), the angle
+// between k* and r* in the pair rest frame. The table of a pair type is
+// filled with the exact routine (at equal emission times in the PRF) when
+// the first pair of this type is processed, or read with LoadWeightTables.
+// Pairs outside of the table range and 3-body calculations use the exact
+// routine. The accuracy is given by the number of grid points and can be
+// checked with ValidateWeightTable.
+  void SetTabulatedWeights(Bool_t use = kTRUE, Int_t nKStar = 200, Double_t kStarMax = 1.0, Int_t nRStar = 100, Double_t rStarMax = 50.0, Int_t nCosTheta = 40);
+  Bool_t GetTabulatedWeights() const;
+  Bool_t SaveWeightTables(const char* fileName) const;
+  Bool_t LoadWeightTables(const char* fileName);
+  /// Compares table and exact weight for nPoints random points of the
+  /// table range of the current pair type, prints the mean and maximum
+  /// absolute deviation and returns the maximum deviation
+  Double_t ValidateWeightTable(Int_t nPoints = 10000, UInt_t seed = 0);
+
 protected:
   // Fsi weight output
   double  fWei;  // normal weight
@@ -124,9 +148,24 @@ protected:
   void FsiNucl();
   bool SetPid(const int aPid1,const int aPid2);
 
+  Double_t ExactPRFWeight(Double_t aKStar, Double_t aRStar, Double_t aCosTheta);
+  TH3F* GetWeightTable();
+  Double_t InterpolateWeight(const TH3F* aTable, Double_t aKStar, Double_t aRStar, Double_t aCosTheta) const;
+  TString WeightTableSettings() const;
+
+  Bool_t    fTabulated;      // interpolate the weights in the tables
+  Int_t     fTableNK;        // number of k* grid points
+  Double_t  fTableKMax;      // maximum k* of the table
+  Int_t     fTableNR;        // number of r* grid points
+  Double_t  fTableRMax;      // maximum r* of the table
+  Int_t     fTableNCos;      // number of cos(theta) grid points
+  TObjArray* fWeightTables;  //! weight tables (TH3F) indexed by the pair type code fLL
+
 #ifdef __ROOT__
-  ClassDef(AliFemtoModelWeightGeneratorLednicky, 2);
+  ClassDef(AliFemtoModelWeightGeneratorLednicky, 3);
 #endif
 };
 
+inline Bool_t AliFemtoModelWeightGeneratorLednicky::GetTabulatedWeights() const { return fTabulated; }
+
 #endif
@@ -0,0 +1,93 @@
+///
+/// \file AliFemtoPairBatch.cxx
+///
+
+#include "AliFemtoPairBatch.h"
+#include "AliFemtoParticle.h"
+#include "AliFemtoTrack.h"
+
+#include <algorithm>
+#include <cmath>
+
+
+AliFemtoPairBatch::AliFemtoPairBatch(unsigned int capacity):
+  fCapacity(std::max(capacity, 1u)),
+  fSize(0),
+  fMagSign(1.0),
+  fDPhiStarRadius(1.2),
+  fTrack1(fCapacity), fTrack2(fCapacity),
+  fE1(fCapacity), fX1(fCapacity), fY1(fCapacity), fZ1(fCapacity), fPt1(fCapacity), fCharge1(fCapacity),
+  fE2(fCapacity), fX2(fCapacity), fY2(fCapacity), fZ2(fCapacity), fPt2(fCapacity), fCharge2(fCapacity),
+  fQInv(fCapacity), fKStar(fCapacity), fKT(fCapacity),
+  fQOut(fCapacity), fQSide(fCapacity), fQLong(fCapacity), fDPhiStar(fCapacity)
+{ // the arrays are allocated once with the full capacity
+}
+
+void AliFemtoPairBatch::Add(AliFemtoParticle *p1, AliFemtoParticle *p2)
+{
+  if (Full()) {
+    return;
+  }
+
+  const unsigned int i = fSize++;
+  fTrack1[i] = p1;
+  fTrack2[i] = p2;
+
+  const AliFemtoLorentzVector &v1 = p1->FourMomentum(),
+                              &v2 = p2->FourMomentum();
+
+  fE1[i] = v1.e(); fX1[i] = v1.x(); fY1[i] = v1.y(); fZ1[i] = v1.z();
+  fE2[i] = v2.e(); fX2[i] = v2.x(); fY2[i] = v2.y(); fZ2[i] = v2.z();
+
+  const AliFemtoTrack *track1 = p1->Track(),
+                      *track2 = p2->Track();
+
+  fPt1[i] = track1 ? track1->Pt() : v1.Perp();
+  fCharge1[i] = track1 ? track1->Charge() : 0;
+  fPt2[i] = track2 ? track2->Pt() : v2.Perp();
+  fCharge2[i] = track2 ? track2->Charge() : 0;
+}
+
+void AliFemtoPairBatch::Compute()
+{
+  // the same expressions as in AliFemtoPair, written on the flat arrays
+  const double bending = -0.07510020733 * fMagSign * fDPhiStarRadius;
+
+  for (unsigned int i = 0; i < fSize; i++) {
+    const double
+      e1 = fE1[i], x1 = fX1[i], y1 = fY1[i], z1 = fZ1[i],
+      e2 = fE2[i], x2 = fX2[i], y2 = fY2[i], z2 = fZ2[i],
+
+      dE = e1 - e2, dx = x1 - x2, dy = y1 - y2, dz = z1 - z2,
+      tE = e1 + e2, tx = x1 + x2, ty = y1 + y2, tz = z1 + z2;
+
+    // qinv = -m(p1 - p2)
+    const double qinvL = dE*dE - dx*dx - dy*dy - dz*dz;
+    fQInv[i] = qinvL < 0 ? std::sqrt(-qinvL) : -std::sqrt(qinvL);
+
+    const double pt = std::sqrt(tx*tx + ty*ty);
+    fKT[i] = 0.5 * pt;
+
+    // LCMS components (QOutCMS, QSideCMS, QLongCMS)
+    fQOut[i] = pt == 0.0 ? 0.0 : (dx*tx + dy*ty) / pt;
+    fQSide[i] = pt == 0.0 ? 0.0 : 2.0 * (x2*y1 - x1*y2) / pt;
+    const double beta = tz / tE;
+    const double gamma = 1.0 / std::sqrt((1. - beta) * (1. + beta));
+    fQLong[i] = gamma * (dz - beta*dE);
+
+    // k* (CalcNonIdPar)
+    const double
+      m1 = std::max(0.0, e1*e1 - x1*x1 - y1*y1 - z1*z1),
+      m2 = std::max(0.0, e2*e2 - x2*x2 - y2*y2 - z2*z2),
+      pinv = std::sqrt(tE*tE - tz*tz - (tx*tx + ty*ty));
+    double q = (m1 - m2) / pinv;
+    q = std::sqrt(q*q - qinvL);
+    fKStar[i] = q / 2;
+
+    // Δϕ* as in AliFemtoCorrFctnDPhiStarDEta
+    const double
+      b1 = fCharge1[i] == 0 ? 0.0 : bending * fCharge1[i] / fPt1[i],
+      b2 = fCharge2[i] == 0 ? 0.0 : bending * fCharge2[i] / fPt2[i];
+    fDPhiStar[i] = std::atan2(y2, x2) - std::atan2(y1, x1) + std::asin(b2) - std::asin(b1);
+  }
+}
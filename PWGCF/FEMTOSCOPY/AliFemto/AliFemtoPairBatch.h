@@ -0,0 +1,103 @@
+///
+/// \file AliFemtoPairBatch.h
+///
+
+#ifndef ALIFEMTOPAIRBATCH_H
+#define ALIFEMTOPAIRBATCH_H
+
+#include <vector>
+
+class AliFemtoParticle;
+
+
+/// \class AliFemtoPairBatch
+/// \brief Block of pairs with their common kinematic variables
+///
+/// The pairs passing the pair cut of an AliFemtoSimpleAnalysis are
+/// collected in blocks. For each block the four-momenta are copied into
+/// flat arrays, and `Compute()` calculates the variables most correlation
+/// functions need (qinv, k*, kT, LCMS qout/qside/qlong, and Δϕ* at one
+/// radius) in a single loop over these arrays. Correlation functions can
+/// read them through `AliFemtoCorrFctn::AddRealPairs/AddMixedPairs`
+/// instead of recomputing them from the AliFemtoPair of each pair.
+///
+/// The definitions are the same as in AliFemtoPair: QInv(), KStar(),
+/// KT(), QOutCMS(), QSideCMS() and QLongCMS(). Δϕ* is computed as in
+/// AliFemtoCorrFctnDPhiStarDEta, for particles without a track (V0s...)
+/// the bending term is zero.
+///
+class AliFemtoPairBatch {
+public:
+
+  AliFemtoPairBatch(unsigned int capacity = 256);
+
+  unsigned int Size() const;
+  unsigned int Capacity() const;
+  bool Empty() const;
+  bool Full() const;
+
+  /// Remove all pairs
+  void Clear();
+
+  /// Append the pair - the four-momenta are copied, the particles
+  /// must stay valid until the batch is cleared
+  void Add(AliFemtoParticle *p1, AliFemtoParticle *p2);
+
+  /// Calculate the pair variables of all pairs
+  void Compute();
+
+  /// Magnetic field of the event (only the sign is used) and the
+  /// radius in m at which Δϕ* is calculated
+  void SetMagneticField(double field);
+  void SetDPhiStarRadius(double radius);
+
+  AliFemtoParticle* Track1(unsigned int i) const;
+  AliFemtoParticle* Track2(unsigned int i) const;
+
+  const double* QInv() const;
+  const double* KStar() const;
+  const double* KT() const;
+  const double* QOut() const;
+  const double* QSide() const;
+  const double* QLong() const;
+  const double* DPhiStar() const;
+
+protected:
+
+  unsigned int fCapacity;
+  unsigned int fSize;
+  double fMagSign;
+  double fDPhiStarRadius;
+
+  std::vector<AliFemtoParticle*> fTrack1;
+  std::vector<AliFemtoParticle*> fTrack2;
+
+  // inputs: four-momenta, pt and charge of the tracks (0 if no track)
+  std::vector<double> fE1, fX1, fY1, fZ1, fPt1, fCharge1;
+  std::vector<double> fE2, fX2, fY2, fZ2, fPt2, fCharge2;
+
+  // outputs
+  std::vector<double> fQInv, fKStar, fKT, fQOut, fQSide, fQLong, fDPhiStar;
+};
+
+inline unsigned int AliFemtoPairBatch::Size() const { return fSize; }
+inline unsigned int AliFemtoPairBatch::Capacity() const { return fCapacity; }
+inline bool AliFemtoPairBatch::Empty() const { return fSize == 0; }
+inline bool AliFemtoPairBatch::Full() const { return fSize >= fCapacity; }
+inline void AliFemtoPairBatch::Clear() { fSize = 0; }
+
+inline void AliFemtoPairBatch::SetMagneticField(double field) { fMagSign = (field > 0) ? 1.0 : (field < 0) ? -1.0 : 0.0; }
+inline void AliFemtoPairBatch::SetDPhiStarRadius(double radius) { fDPhiStarRadius = radius; }
+
+inline AliFemtoParticle* AliFemtoPairBatch::Track1(unsigned int i) const { return fTrack1[i]; }
+inline AliFemtoParticle* AliFemtoPairBatch::Track2(unsigned int i) const { return fTrack2[i]; }
+
+inline const double* AliFemtoPairBatch::QInv() const { return fQInv.data(); }
+inline const double* AliFemtoPairBatch::KStar() const { return fKStar.data(); }
+inline const double* AliFemtoPairBatch::KT() const { return fKT.data(); }
+inline const double* AliFemtoPairBatch::QOut() const { return fQOut.data(); }
+inline const double* AliFemtoPairBatch::QSide() const { return fQSide.data(); }
+inline const double* AliFemtoPairBatch::QLong() const { return fQLong.data(); }
+inline const double* AliFemtoPairBatch::DPhiStar() const { return fDPhiStar.data(); }
+
+#endif
@@ -46,6 +46,10 @@ public:
   virtual AliFemtoString Report() = 0;              ///< user-written method to return string describing cuts
   virtual TList *ListSettings() = 0;                ///< Return a TList of settings
 
+  /// Track fields used by the cut (AliFemtoTrack::RequiredFields), without
+  /// its cut monitors. The default declares all fields.
+  virtual unsigned int RequiredTrackFields() const { return AliFemtoTrack::kAllFields; }
+
   /// the following allows "back-pointing" from the CorrFctn to the "parent" Analysis
   AliFemtoAnalysis* HbtAnalysis() { return fyAnalysis; }
 
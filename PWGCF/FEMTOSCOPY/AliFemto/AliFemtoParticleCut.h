@@ -40,6 +40,10 @@ public:
 
   virtual AliFemtoParticleType Type() = 0;    ///< Pure virtual function which returns the particle type
 
+  /// Track fields used by the cut (AliFemtoTrack::RequiredFields), without
+  /// its cut monitors. The default declares all fields.
+  virtual unsigned int RequiredTrackFields() const { return AliFemtoTrack::kAllFields; }
+
   /// The following allows "back-pointing" from the CorrFctn to the "parent" Analysis
   AliFemtoAnalysis* HbtAnalysis() { return fyAnalysis; };
   void SetAnalysis(AliFemtoAnalysis *anAnalysis) { fyAnalysis = anAnalysis; };
@@ -245,6 +245,37 @@ void AliFemtoQinvCorrFctn::AddMixedPair(AliFemtoPair* pair)
   }
 }
 
+//____________________________
+void AliFemtoQinvCorrFctn::AddRealPairs(const AliFemtoPairBatch &batch)
+{
+  // the own pair cut and the (deta, dphi*) histograms need the pair objects
+  if (fPairCut || fDetaDphiscal) {
+    AliFemtoCorrFctn::AddRealPairs(batch);
+    return;
+  }
+
+  const double *qinv = batch.QInv(),
+               *kt = batch.KT();
+  for (unsigned int i = 0; i < batch.Size(); i++) {
+    fNumerator->Fill(fabs(qinv[i]));
+    fkTMonitor->Fill(kt[i]);
+  }
+}
+
+//____________________________
+void AliFemtoQinvCorrFctn::AddMixedPairs(const AliFemtoPairBatch &batch)
+{
+  if (fPairCut || fDetaDphiscal || fPairKinematics) {
+    AliFemtoCorrFctn::AddMixedPairs(batch);
+    return;
+  }
+
+  const double *qinv = batch.QInv();
+  for (unsigned int i = 0; i < batch.Size(); i++) {
+    fDenominator->Fill(fabs(qinv[i]));
+  }
+}
+
 void AliFemtoQinvCorrFctn::Write()
 {
   // Write out neccessary objects
@@ -65,6 +65,8 @@ public:
   virtual AliFemtoString Report();
   virtual void AddRealPair(AliFemtoPair* aPair);
   virtual void AddMixedPair(AliFemtoPair* aPair);
+  virtual void AddRealPairs(const AliFemtoPairBatch &batch);
+  virtual void AddMixedPairs(const AliFemtoPairBatch &batch);
 
   virtual void Finish();
 
@@ -79,6 +81,7 @@ public:
   void Write();
 
   virtual AliFemtoCorrFctn* Clone() const { return new AliFemtoQinvCorrFctn(*this); }
+  virtual unsigned int RequiredTrackFields() const { return PairCutRequiredTrackFields(); }
 
 private:
   TH1D* fNumerator;          // numerator - real pairs
@@ -184,6 +184,8 @@ AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis():
   fVerbose(kTRUE),
   fPerformSharedDaughterCut(kFALSE),
   fEnablePairMonitors(kFALSE),
+  fPairBatchSize(0),
+  fPairBatch(nullptr),
   freverseParticleVariables(kFALSE)
 {
   // Default constructor
@@ -208,6 +210,8 @@ AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis(const AliFemtoSimpleAnalysis& a):
   fVerbose(a.fVerbose),
   fPerformSharedDaughterCut(a.fPerformSharedDaughterCut),
   fEnablePairMonitors(a.fEnablePairMonitors),
+  fPairBatchSize(a.fPairBatchSize),
+  fPairBatch(nullptr),
   freverseParticleVariables(a.freverseParticleVariables)
 {
   /// Copy constructor
@@ -320,6 +324,8 @@ AliFemtoSimpleAnalysis::~AliFemtoSimpleAnalysis()
     }
     delete fMixingBuffer;
   }
+
+  delete fPairBatch;
 }
 //______________________
 AliFemtoSimpleAnalysis& AliFemtoSimpleAnalysis::operator=(const AliFemtoSimpleAnalysis& aAna)
@@ -405,6 +411,9 @@ AliFemtoSimpleAnalysis& AliFemtoSimpleAnalysis::operator=(const AliFemtoSimpleAn
   fVerbose = aAna.fVerbose;
   fPerformSharedDaughterCut = aAna.fPerformSharedDaughterCut;
   fEnablePairMonitors = aAna.fEnablePairMonitors;
+  fPairBatchSize = aAna.fPairBatchSize;
+  delete fPairBatch;
+  fPairBatch = nullptr;
   freverseParticleVariables = aAna.freverseParticleVariables;
   return *this;
 }
@@ -449,6 +458,26 @@ AliFemtoString AliFemtoSimpleAnalysis::Report()
   return AliFemtoString((const char *)report);
 }
 //_________________________
+unsigned int AliFemtoSimpleAnalysis::RequiredTrackFields()
+{
+  /// Only the cuts on tracks contribute, V0s, cascades and kinks are
+  /// converted by the readers independent of the requested track fields
+
+  unsigned int fields = 0;
+  for (AliFemtoParticleCut *cut : {fFirstParticleCut, fSecondParticleCut}) {
+    if (cut && cut->Type() == hbtTrack) {
+      fields |= cut->RequiredTrackFields() | cut->MonitorsRequiredTrackFields();
+    }
+  }
+  if (fPairCut) {
+    fields |= fPairCut->RequiredTrackFields() | fPairCut->MonitorsRequiredTrackFields();
+  }
+  for (auto *cf : *fCorrFctnCollection) {
+    fields |= cf->RequiredTrackFields();
+  }
+  return fields;
+}
+//_________________________
 void AliFemtoSimpleAnalysis::ProcessEvent(const AliFemtoEvent* hbtEvent)
 {
   // Add event to processed events
@@ -478,6 +507,16 @@ void AliFemtoSimpleAnalysis::ProcessEvent(const AliFemtoEvent* hbtEvent)
   // mixing buffer
   fPicoEvent = new AliFemtoPicoEvent;
 
+  // The pair batch is created at the first event, the magnetic field
+  // of the current event is used also for the mixed pairs
+  if (fPairBatchSize > 0) {
+    if (!fPairBatch || fPairBatch->Capacity() != fPairBatchSize) {
+      delete fPairBatch;
+      fPairBatch = new AliFemtoPairBatch(fPairBatchSize);
+    }
+    fPairBatch->SetMagneticField(hbtEvent->MagneticField());
+  }
+
   AliFemtoParticleCollection *collection1 = fPicoEvent->FirstParticleCollection(),
                              *collection2 = fPicoEvent->SecondParticleCollection();
 
@@ -626,6 +665,12 @@ void AliFemtoSimpleAnalysis::MakePairs(const char* typeIn,
   // Create the pair outside the loop - only allocate once
   AliFemtoPair* tPair = new AliFemtoPair;
 
+  // Collect the pairs in the batch, if configured (see ProcessEvent)
+  AliFemtoPairBatch *tBatch = fPairBatchSize > 0 ? fPairBatch : nullptr;
+  if (tBatch) {
+    tBatch->Clear();
+  }
+
   // Begin the outer loop
   for (AliFemtoParticleConstIterator tPartIter1 = tStartOuterLoop;
                                      tPartIter1 != tEndOuterLoop;
@@ -677,8 +722,15 @@ void AliFemtoSimpleAnalysis::MakePairs(const char* typeIn,
         fPairCut->FillCutMonitor(tPair, tmpPassPair);
       }
 
+      // With batches, the pair is stored and the CF's get it when the batch is full
+      if (tmpPassPair && tBatch) {
+        tBatch->Add(tPair->Track1(), tPair->Track2());
+        if (tBatch->Full()) {
+          FlushPairBatch(these_are_real_pairs);
+        }
+      }
       // If pair passes cut, loop over CF's and add pair to real/mixed
-      if (tmpPassPair) {
+      else if (tmpPassPair) {
         for (auto &tCorrFctn : *fCorrFctnCollection) {
           if (these_are_real_pairs)
             tCorrFctn->AddRealPair(tPair);
@@ -690,10 +742,30 @@ void AliFemtoSimpleAnalysis::MakePairs(const char* typeIn,
     }    // loop over second particle
   }      // loop over first particle
 
+  if (tBatch) {
+    FlushPairBatch(these_are_real_pairs);
+  }
+
   // we are done with the pair
   delete tPair;
 }
 //_________________________
+void AliFemtoSimpleAnalysis::FlushPairBatch(bool realPairs)
+{
+  if (!fPairBatch || fPairBatch->Empty()) {
+    return;
+  }
+
+  fPairBatch->Compute();
+  for (auto &tCorrFctn : *fCorrFctnCollection) {
+    if (realPairs)
+      tCorrFctn->AddRealPairs(*fPairBatch);
+    else
+      tCorrFctn->AddMixedPairs(*fPairBatch);
+  }
+  fPairBatch->Clear();
+}
+//_________________________
 void AliFemtoSimpleAnalysis::EventBegin(const AliFemtoEvent* ev)
 {
   /// Perform initialization operations at the beginning of the event processing
@@ -99,6 +99,13 @@ public:
   void SetEnablePairMonitors(Bool_t aEnable);
   Bool_t EnablePairMonitors();
 
+  /// Pass the pairs to the correlation functions in blocks of size
+  /// pairs together with their common pair variables (see
+  /// AliFemtoPairBatch and AliFemtoCorrFctn::AddRealPairs); 0 passes
+  /// each pair to AddRealPair/AddMixedPair directly (default)
+  void SetUsePairBatches(unsigned int size = 256);
+  unsigned int PairBatchSize() const;
+
   unsigned int NumEventsToMix() const;
   void SetNumEventsToMix(const unsigned int& NumberOfEventsToMix);
   AliFemtoPicoEvent* CurrentPicoEvent();
@@ -115,6 +122,10 @@ public:
   virtual TList* ListSettings();         ///< return list of cut settings for the analysis
   virtual TList* GetOutputList();        ///< Return a TList of objects to be written as output
 
+  /// Track fields used by the track cuts, the pair cut, the correlation
+  /// functions and the cut monitors of the particle and pair cuts
+  virtual unsigned int RequiredTrackFields();
+
   /// Initialization code run at the beginning of processing an event
   ///
   /// This is implemented by calling EventBegin for each member cut
@@ -161,6 +172,10 @@ protected:
                  AliFemtoParticleCollection* ParticlesPssingCut2=NULL,
                  Bool_t enablePairMonitors=kFALSE);
 
+  /// Compute the pair variables of the collected pairs, pass them to
+  /// the correlation functions and clear the batch
+  void FlushPairBatch(bool realPairs);
+
   AliFemtoPicoEventCollectionVectorHideAway* fPicoEventCollectionVectorHideAway; //!<! Mixing Buffer used for Analyses which wrap this one
 
   AliFemtoPairCut*             fPairCut;             ///< cut applied to pairs
@@ -180,6 +195,9 @@ protected:
   Bool_t fPerformSharedDaughterCut;
   Bool_t fEnablePairMonitors;
   
+  unsigned int fPairBatchSize;                       ///< Pairs per AliFemtoPairBatch, 0: no batches
+  AliFemtoPairBatch*           fPairBatch;           //!<! Pairs passing the pair cut, not yet passed to the correlation functions
+
   Bool_t freverseParticleVariables;                  ////set true if you want reverse z,y,z. This additional variable is just for some trains. After that it will be deleted. By default is false so, nothing change in other analyis, Wioleta Rzęsa wrzesa@cern.ch
 
 #ifdef __ROOT__
@@ -313,5 +331,15 @@ inline void AliFemtoSimpleAnalysis::SetReverseParticleVariables(Bool_t value)
 {
   freverseParticleVariables=value;
 }
+
+inline void AliFemtoSimpleAnalysis::SetUsePairBatches(unsigned int size)
+{
+  fPairBatchSize = size;
+}
+
+inline unsigned int AliFemtoSimpleAnalysis::PairBatchSize() const
+{
+  return fPairBatchSize;
+}
 #endif
 
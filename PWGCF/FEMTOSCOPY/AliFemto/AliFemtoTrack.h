@@ -309,6 +309,15 @@ public:
     kTIME=0x80000000
   };
 
+  /// Fields which are costly to compute in the event readers. Cuts,
+  /// correlation functions and cut monitors declare the ones they use via
+  /// RequiredTrackFields(), see AliFemtoEventReaderAOD::SetRequiredTrackFields
+  enum RequiredFields {
+    kNominalTPCPoints = 0x1, ///< nominal TPC entrance, exit and intermediate points
+    kTOFInfo = 0x2,          ///< TOF signal, expected times, n sigmas, velocity and mass
+    kAllFields = 0x3
+  };
+
  private:
   char  fCharge;          ///< track charge
   float fPidProbElectron; ///< electron pid
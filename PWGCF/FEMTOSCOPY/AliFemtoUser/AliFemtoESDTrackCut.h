@@ -27,6 +27,8 @@ public:
 
   virtual AliFemtoString Report();
   virtual TList *ListSettings();
+  /// The TPC points are not used, the TOF information is used for the PID
+  virtual unsigned int RequiredTrackFields() const { return AliFemtoTrack::kTOFInfo; }
   virtual AliFemtoParticleType Type(){return hbtTrack;}
 
   void SetPt(const float& lo, const float& hi);
@@ -1,5 +1,7 @@
 #include <iostream>
 #include <math.h>
+#include <string.h>
+#include <algorithm>
 #include "TChain.h"
 #include "TFile.h"
 #include "TKey.h"
@@ -171,6 +173,9 @@ AliAnalysisTaskSE(),
   fNormQPairSwitch_E1E2(),
   fNormQPairSwitch_E1E3(),
   fNormQPairSwitch_E2E3(),
+  fLowQPartners(),
+  fNormQPartners(),
+  fSwitchTracks(0),
   fMomResC2SC(0x0),
   fMomResC2MC(0x0),
   fWeightmuonCorrection(0x0),
@@ -388,6 +393,9 @@ AliFourPion::AliFourPion(const Char_t *name)
   fNormQPairSwitch_E1E2(),
   fNormQPairSwitch_E1E3(),
   fNormQPairSwitch_E2E3(),
+  fLowQPartners(),
+  fNormQPartners(),
+  fSwitchTracks(0),
   fMomResC2SC(0x0),
   fMomResC2MC(0x0),
   fWeightmuonCorrection(0x0),
@@ -610,6 +618,9 @@ AliFourPion::AliFourPion(const AliFourPion &obj)
     fNormQPairSwitch_E1E2(),
     fNormQPairSwitch_E1E3(),
     fNormQPairSwitch_E2E3(),
+    fLowQPartners(),
+    fNormQPartners(),
+    fSwitchTracks(0),
     fMomResC2SC(obj.fMomResC2SC),
     fMomResC2MC(obj.fMomResC2MC),
     fWeightmuonCorrection(obj.fWeightmuonCorrection),
@@ -2690,26 +2701,16 @@ void AliFourPion::UserExec(Option_t *)
   ////////////////////
   Int_t EDindex3=0, EDindex4=0;
 
-  // reset to defaults
-  for(Int_t i=0; i<fMultLimit; i++) {
-    fLowQPairSwitch_E0E0[i]->Set(kMultLimitPbPb,fDefaultsCharSwitch);
-    fLowQPairSwitch_E0E1[i]->Set(kMultLimitPbPb,fDefaultsCharSwitch);
-    fLowQPairSwitch_E0E2[i]->Set(kMultLimitPbPb,fDefaultsCharSwitch);
-    fLowQPairSwitch_E0E3[i]->Set(kMultLimitPbPb,fDefaultsCharSwitch);
-    fLowQPairSwitch_E1E1[i]->Set(kMultLimitPbPb,fDefaultsCharSwitch);
-    fLowQPairSwitch_E1E2[i]->Set(kMultLimitPbPb,fDefaultsCharSwitch);
-    fLowQPairSwitch_E1E3[i]->Set(kMultLimitPbPb,fDefaultsCharSwitch);
-    fLowQPairSwitch_E2E3[i]->Set(kMultLimitPbPb,fDefaultsCharSwitch);
-    //
-    fNormQPairSwitch_E0E0[i]->Set(kMultLimitPbPb,fDefaultsCharSwitch);
-    fNormQPairSwitch_E0E1[i]->Set(kMultLimitPbPb,fDefaultsCharSwitch);
-    fNormQPairSwitch_E0E2[i]->Set(kMultLimitPbPb,fDefaultsCharSwitch);
-    fNormQPairSwitch_E0E3[i]->Set(kMultLimitPbPb,fDefaultsCharSwitch);
-    fNormQPairSwitch_E1E1[i]->Set(kMultLimitPbPb,fDefaultsCharSwitch);
-    fNormQPairSwitch_E1E2[i]->Set(kMultLimitPbPb,fDefaultsCharSwitch);
-    fNormQPairSwitch_E1E3[i]->Set(kMultLimitPbPb,fDefaultsCharSwitch);
-    fNormQPairSwitch_E2E3[i]->Set(kMultLimitPbPb,fDefaultsCharSwitch);
+  // reset to defaults (only the part set in the previous event)
+  TArrayC **switches[16]={fLowQPairSwitch_E0E0, fLowQPairSwitch_E0E1, fLowQPairSwitch_E0E2, fLowQPairSwitch_E0E3,
+			  fLowQPairSwitch_E1E1, fLowQPairSwitch_E1E2, fLowQPairSwitch_E1E3, fLowQPairSwitch_E2E3,
+			  fNormQPairSwitch_E0E0, fNormQPairSwitch_E0E1, fNormQPairSwitch_E0E2, fNormQPairSwitch_E0E3,
+			  fNormQPairSwitch_E1E1, fNormQPairSwitch_E1E2, fNormQPairSwitch_E1E3, fNormQPairSwitch_E2E3};
+  for(Int_t sw=0; sw<16; sw++){
+    for(Int_t i=0; i<fSwitchTracks; i++) memset(switches[sw][i]->GetArray(), '0', fSwitchTracks);
   }
+  fSwitchTracks=0;
+  for(Int_t en=0; en<=3; en++) fSwitchTracks = std::max(fSwitchTracks, (fEvt+en)->fNtracks);
  
   
   //////////////////////////////////////////
@@ -2867,6 +2868,13 @@ void AliFourPion::UserExec(Option_t *)
       }
     }
   }
+  
+  // partner lists of the particles of the current event, so that the 3- and 4-particle loops
+  // below only visit particles which form a low-q (normalization) pair with the 1st particle
+  for(Int_t en=0; en<=3; en++){
+    FillPairPartners(switches[en], en, fLowQPartners[en]);
+    FillPairPartners(switches[8+en], en, fNormQPartners[en]);
+  }
     
  
   ///////////////////////////////////////////////////  
@@ -2904,7 +2912,9 @@ void AliFourPion::UserExec(Option_t *)
 	  pVect1[3]=(fEvt)->fTracks[i].fP[2];
 	  ch1 = Int_t(((fEvt)->fTracks[i].fCharge + 1)/2.);
 	  
-	  for (Int_t j=i+1; j<(fEvt+en2)->fNtracks; j++) {// 2nd particle
+	  const std::vector<Int_t> &partners2 = fNormQPartners[en2][i];
+	  for (UInt_t jp=0; jp<partners2.size(); jp++) {// 2nd particle
+	    const Int_t j = partners2[jp];
 	    if(en2==0) {if(fNormQPairSwitch_E0E0[i]->At(j)=='0') continue;}
 	    else {if(fNormQPairSwitch_E0E1[i]->At(j)=='0') continue;}
 	    
@@ -2913,7 +2923,9 @@ void AliFourPion::UserExec(Option_t *)
 	    pVect2[3]=(fEvt+en2)->fTracks[j].fP[2];
 	    ch2 = Int_t(((fEvt+en2)->fTracks[j].fCharge + 1)/2.);
 	   
-	    for (Int_t k=j+1; k<(fEvt+en3)->fNtracks; k++) {// 3rd particle
+	    const std::vector<Int_t> &partners3 = fNormQPartners[en3][i];
+	    for (std::vector<Int_t>::const_iterator kp=std::upper_bound(partners3.begin(), partners3.end(), j); kp!=partners3.end(); ++kp) {// 3rd particle
+	      const Int_t k = *kp;
 	      if(en3==0) {
 		if(fNormQPairSwitch_E0E0[i]->At(k)=='0') continue;
 		if(fNormQPairSwitch_E0E0[j]->At(k)=='0') continue;
@@ -2952,7 +2964,9 @@ void AliFourPion::UserExec(Option_t *)
 	      }
 	      
 	      
-	      for (Int_t l=k+1; l<(fEvt+en4)->fNtracks; l++) {// 4th particle
+	      const std::vector<Int_t> &partners4 = fNormQPartners[en4][i];
+	      for (std::vector<Int_t>::const_iterator lp=std::upper_bound(partners4.begin(), partners4.end(), k); lp!=partners4.end(); ++lp) {// 4th particle
+		const Int_t l = *lp;
 		if(en4==0){
 		  if(fNormQPairSwitch_E0E0[i]->At(l)=='0') continue;
 		  if(fNormQPairSwitch_E0E0[j]->At(l)=='0') continue;
@@ -3050,7 +3064,9 @@ void AliFourPion::UserExec(Option_t *)
 	    if((fEvt)->fTracks[i].fPt > fMaxPt) continue;
 
 	    /////////////////////////////////////////////////////////////
-	    for (Int_t j=i+1; j<(fEvt+en2)->fNtracks; j++) {// 2nd particle
+	    const std::vector<Int_t> &partners2 = fLowQPartners[en2][i];
+	    for (UInt_t jp=0; jp<partners2.size(); jp++) {// 2nd particle
+	      const Int_t j = partners2[jp];
 	      if(en2==0) {if(fLowQPairSwitch_E0E0[i]->At(j)=='0') continue;}
 	      else {if(fLowQPairSwitch_E0E1[i]->At(j)=='0') continue;}
 	      if((fEvt+en2)->fTracks[j].fPt < fMinPt) continue; 
@@ -3257,7 +3273,9 @@ void AliFourPion::UserExec(Option_t *)
 	     
 	     
 	      /////////////////////////////////////////////////////////////
-	      for (Int_t k=j+1; k<(fEvt+en3)->fNtracks; k++) {// 3rd particle
+	      const std::vector<Int_t> &partners3 = fLowQPartners[en3][i];
+	      for (std::vector<Int_t>::const_iterator kp=std::upper_bound(partners3.begin(), partners3.end(), j); kp!=partners3.end(); ++kp) {// 3rd particle
+		const Int_t k = *kp;
 		if(en3==0) {
 		  if(fLowQPairSwitch_E0E0[i]->At(k)=='0') continue;
 		  if(fLowQPairSwitch_E0E0[j]->At(k)=='0') continue;
@@ -3655,7 +3673,9 @@ void AliFourPion::UserExec(Option_t *)
 		
 		
 		/////////////////////////////////////////////////////////////
-		for (Int_t l=k+1; l<(fEvt+en4)->fNtracks; l++) {// 4th particle
+		const std::vector<Int_t> &partners4 = fLowQPartners[en4][i];
+		for (std::vector<Int_t>::const_iterator lp=std::upper_bound(partners4.begin(), partners4.end(), k); lp!=partners4.end(); ++lp) {// 4th particle
+		  const Int_t l = *lp;
 		  if(en4==0){
 		    if(fLowQPairSwitch_E0E0[i]->At(l)=='0') continue;
 		    if(fLowQPairSwitch_E0E0[j]->At(l)=='0') continue;
@@ -5245,6 +5265,16 @@ Float_t AliFourPion::FSICorrelation(Int_t charge1, Int_t charge2, Float_t qinv){
   }
 }
 //________________________________________________________________________
+void AliFourPion::FillPairPartners(TArrayC *switches[], Int_t en, std::vector<std::vector<Int_t> > &partners){
+  // For each particle i of the current event the particles j>i of event en with switches[i] set, in increasing order
+  if(partners.size() < UInt_t(kMultLimitPbPb)) partners.resize(kMultLimitPbPb);
+  for(Int_t i=0; i<kMultLimitPbPb; i++) partners[i].clear();
+  for(Int_t i=0; i<(fEvt)->fNtracks; i++){
+    const Char_t *row = switches[i]->GetArray();
+    for(Int_t j=i+1; j<(fEvt+en)->fNtracks; j++) {if(row[j]=='1') partners[i].push_back(j);}
+  }
+}
+//________________________________________________________________________
 void AliFourPion::SetFillBins2(Int_t c1, Int_t c2, Int_t &b1, Int_t &b2){
   if((c1+c2)==1) {b1=0; b2=1;}// Re-assign to merge degenerate histos
   else {b1=c1; b2=c2;}
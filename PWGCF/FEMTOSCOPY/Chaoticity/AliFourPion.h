@@ -26,6 +26,8 @@ class AliAODEvent;
 class AliESDtrackCuts;
 class AliESDpid;
 
+#include <vector>
+
 #include "AliAnalysisTask.h"
 #include "AliAnalysisTaskSE.h"
 #include "AliESDpid.h"
@@ -143,6 +145,7 @@ class AliFourPion : public AliAnalysisTaskSE {
   Float_t MCWeightFSI4(Int_t, Float_t, Float_t, Int_t[4], Float_t[6]);
   //
   void SetFillBins2(Int_t, Int_t, Int_t&, Int_t&);
+  void FillPairPartners(TArrayC *switches[], Int_t en, std::vector<std::vector<Int_t> > &partners);
   void SetFillBins3(Int_t, Int_t, Int_t, Short_t, Int_t&, Int_t&, Int_t&, Bool_t&, Bool_t&, Bool_t&);
   void SetFillBins4(Int_t, Int_t, Int_t, Int_t, Int_t&, Int_t&, Int_t&, Int_t&, Int_t, Bool_t[13]);
   void SetFSIindex(Float_t);
@@ -397,6 +400,11 @@ class AliFourPion : public AliAnalysisTaskSE {
   TArrayC *fNormQPairSwitch_E1E2[kMultLimitPbPb];//!
   TArrayC *fNormQPairSwitch_E1E3[kMultLimitPbPb];//!
   TArrayC *fNormQPairSwitch_E2E3[kMultLimitPbPb];//!
+  //
+  // partners j>i of each particle i of the current event, in event en: the '1' entries of row i of fLowQPairSwitch_E0E<en>
+  std::vector<std::vector<Int_t> > fLowQPartners[4];//!
+  std::vector<std::vector<Int_t> > fNormQPartners[4];//! same for fNormQPairSwitch_E0E<en>
+  Int_t fSwitchTracks;//! rows and columns of the pair switches that may have been set
 
   TF1 *fqOutFcn; //!
   TF1 *fqSideFcn; //!
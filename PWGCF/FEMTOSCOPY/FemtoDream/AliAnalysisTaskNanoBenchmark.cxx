@@ -8,6 +8,9 @@
 #include "AliNanoAODTrack.h"
 #include "AliAODInputHandler.h"
 #include "AliAnalysisManager.h"
+#include "TH1D.h"
+#include "TSystem.h"
+#include <fstream>
 
 ClassImp(AliAnalysisTaskNanoBenchmark)
 AliAnalysisTaskNanoBenchmark::AliAnalysisTaskNanoBenchmark()
@@ -59,7 +62,21 @@ AliAnalysisTaskNanoBenchmark::AliAnalysisTaskNanoBenchmark()
       fXiAntiXiDump(nullptr),
       fDumpster(nullptr),
       fTrackBufferSize(2000),
-      fGTI(nullptr) {
+      fGTI(nullptr),
+      fBenchmarkMaxEvents(0),
+      fBenchmarkMultMin(0),
+      fBenchmarkMultMax(-1),
+      fBenchmarkMixingDepth(0),
+      fBenchmarkReport(""),
+      fBenchmark(nullptr),
+      fBenchmarkWallTime(nullptr),
+      fBenchmarkCPUTime(nullptr),
+      fBenchmarkCounters(nullptr),
+      fBenchmarkPeakMemory(nullptr),
+      fStageTimer(),
+      fEventTimer(),
+      fNEventsSeen(0),
+      fPeakMemory(0) {
 }
 
 AliAnalysisTaskNanoBenchmark::AliAnalysisTaskNanoBenchmark(const char* name, bool isMC)
@@ -111,7 +128,21 @@ AliAnalysisTaskNanoBenchmark::AliAnalysisTaskNanoBenchmark(const char* name, boo
       fXiAntiXiDump(nullptr),
       fDumpster(nullptr),
       fTrackBufferSize(2000),
-      fGTI(nullptr) {
+      fGTI(nullptr),
+      fBenchmarkMaxEvents(0),
+      fBenchmarkMultMin(0),
+      fBenchmarkMultMax(-1),
+      fBenchmarkMixingDepth(0),
+      fBenchmarkReport(""),
+      fBenchmark(nullptr),
+      fBenchmarkWallTime(nullptr),
+      fBenchmarkCPUTime(nullptr),
+      fBenchmarkCounters(nullptr),
+      fBenchmarkPeakMemory(nullptr),
+      fStageTimer(),
+      fEventTimer(),
+      fNEventsSeen(0),
+      fPeakMemory(0) {
   DefineOutput(1, TList::Class());  //Output for the Event Class and Pair Cleaner
   DefineOutput(2, TList::Class());  //Output for the Event Cuts
   DefineOutput(3, TList::Class());  //Output for the Proton Cuts
@@ -251,6 +282,9 @@ void AliAnalysisTaskNanoBenchmark::UserCreateOutputObjects() {
   if (!fConfig) {
     AliError("No Correlation Config \n");
   } else {
+    if (fBenchmarkMixingDepth > 0) {
+      fConfig->SetMixingDepth(fBenchmarkMixingDepth);
+    }
     fPartColl = new AliFemtoDreamPartCollection(fConfig,
                                                 fConfig->GetMinimalBookingME());
     fPairCleaner = new AliFemtoDreamPairCleaner(8, 12,
@@ -300,6 +334,38 @@ void AliAnalysisTaskNanoBenchmark::UserCreateOutputObjects() {
   fQA->SetName("QA");
   fQA->Add(fEvent->GetEvtCutList());
 
+  fBenchmark = new TList();
+  fBenchmark->SetName("Benchmark");
+  fBenchmark->SetOwner();
+  fQA->Add(fBenchmark);
+  fBenchmarkWallTime = new TH1D("WallTime", "Wall time per stage; ; t (s)",
+                                kNBenchmarkStages + 1, 0,
+                                kNBenchmarkStages + 1);
+  fBenchmarkCPUTime = new TH1D("CPUTime", "CPU time per stage; ; t (s)",
+                               kNBenchmarkStages + 1, 0,
+                               kNBenchmarkStages + 1);
+  for (int iStage = 0; iStage <= kNBenchmarkStages; ++iStage) {
+    fBenchmarkWallTime->GetXaxis()->SetBinLabel(
+        iStage + 1, GetBenchmarkStageName(iStage));
+    fBenchmarkCPUTime->GetXaxis()->SetBinLabel(iStage + 1,
+                                               GetBenchmarkStageName(iStage));
+  }
+  fBenchmark->Add(fBenchmarkWallTime);
+  fBenchmark->Add(fBenchmarkCPUTime);
+  const char *counterNames[] = { "Events", "SelectedEvents",
+      "BenchmarkedEvents", "Protons", "AntiProtons", "Lambdas", "AntiLambdas",
+      "Xis", "AntiXis" };
+  fBenchmarkCounters = new TH1D("Counters", "Processed events and particles",
+                                9, 0, 9);
+  for (int iBin = 0; iBin < 9; ++iBin) {
+    fBenchmarkCounters->GetXaxis()->SetBinLabel(iBin + 1, counterNames[iBin]);
+  }
+  fBenchmark->Add(fBenchmarkCounters);
+  fBenchmarkPeakMemory = new TH1D("PeakMemory",
+                                  "Peak resident memory per job; M (MB); jobs",
+                                  4000, 0, 16000);
+  fBenchmark->Add(fBenchmarkPeakMemory);
+
   fDumpster = new TList();
   fDumpster->SetName("Dumpster");
   fDumpster->SetOwner(kTRUE);
@@ -472,10 +538,29 @@ void AliAnalysisTaskNanoBenchmark::UserExec(Option_t *option) {
     AliError("No input event");
     return;
   }
+  ++fNEventsSeen;
+  if (fBenchmarkMaxEvents > 0 && fNEventsSeen > fBenchmarkMaxEvents) {
+    return;
+  }
+  fEventTimer.Start(kTRUE);
+  fStageTimer.Start(kTRUE);
+  fBenchmarkCounters->Fill(0);
   fEvent->SetEvent(fInputEvent);
-  if (!fEventCuts->isSelected(fEvent)) {
+  const bool selected = fEventCuts->isSelected(fEvent);
+  const int mult = fEvent->GetMultiplicity();
+  StopStage(kEventSelection);
+  if (selected) {
+    fBenchmarkCounters->Fill(1);
+  }
+  if (!selected
+      || (fBenchmarkMultMax >= fBenchmarkMultMin
+          && (mult < fBenchmarkMultMin || mult > fBenchmarkMultMax))) {
+    fEventTimer.Stop();
+    fBenchmarkWallTime->Fill(kNBenchmarkStages, fEventTimer.RealTime());
+    fBenchmarkCPUTime->Fill(kNBenchmarkStages, fEventTimer.CpuTime());
     return;
   }
+  fBenchmarkCounters->Fill(2);
 
   // PROTON SELECTION
   ResetGlobalTrackReference();
@@ -500,6 +585,7 @@ void AliAnalysisTaskNanoBenchmark::UserExec(Option_t *option) {
       AntiProtons.push_back(*fTrack);
     }
   }
+  StopStage(kTrackSelection);
 
   std::vector<AliFemtoDreamBasePart> Lambdas;
   std::vector<AliFemtoDreamBasePart> AntiLambdas;
@@ -517,6 +603,7 @@ void AliAnalysisTaskNanoBenchmark::UserExec(Option_t *option) {
       AntiLambdas.push_back(*fv0);
     }
   }
+  StopStage(kv0Selection);
 
   std::vector<AliFemtoDreamBasePart> Xis;
   std::vector<AliFemtoDreamBasePart> AntiXis;
@@ -533,6 +620,7 @@ void AliAnalysisTaskNanoBenchmark::UserExec(Option_t *option) {
       AntiXis.push_back(*fCascade);
     }
   }
+  StopStage(kCascadeSelection);
 
   //loop once over the MC stack to calculate Efficiency/Purity
   if (fIsMC) {
@@ -560,6 +648,7 @@ void AliAnalysisTaskNanoBenchmark::UserExec(Option_t *option) {
       }
     }
   }
+  StopStage(kMCTruth);
 
   fPairCleaner->ResetArray();
   fPairCleaner->CleanTrackAndDecay(&Protons, &Lambdas, 0);
@@ -590,15 +679,18 @@ void AliAnalysisTaskNanoBenchmark::UserExec(Option_t *option) {
   fPairCleaner->StoreParticle(AntiLambdas);
   fPairCleaner->StoreParticle(Xis);
   fPairCleaner->StoreParticle(AntiXis);
+  StopStage(kPairCleaning);
   if (fPairCleaner->GetCounter() > 0) {
     if (fConfig->GetUseEventMixing()) {
       fPartColl->SetEvent(fPairCleaner->GetCleanParticles(),
                           fEvent->GetZVertex(), fEvent->GetMultiplicity(),
                           fEvent->GetV0MCentrality());
     }
+    StopStage(kPairing);
     if (fConfig->GetUsePhiSpinning()) {
       fSample->SetEvent(fPairCleaner->GetCleanParticles(), fEvent);
     }
+    StopStage(kControlSample);
   }
     void SetEvent(std::vector<AliFemtoDreamBasePart> &vec1,
                 std::vector<AliFemtoDreamBasePart> &vec2,
@@ -632,6 +724,21 @@ void AliAnalysisTaskNanoBenchmark::UserExec(Option_t *option) {
     fXiAntiXiDump->SetEvent(Xis, AntiXis, fEvent, 3312, -3312);
   }
     }
+  StopStage(kDumpster);
+
+  fBenchmarkCounters->Fill(3, Protons.size());
+  fBenchmarkCounters->Fill(4, AntiProtons.size());
+  fBenchmarkCounters->Fill(5, Lambdas.size());
+  fBenchmarkCounters->Fill(6, AntiLambdas.size());
+  fBenchmarkCounters->Fill(7, Xis.size());
+  fBenchmarkCounters->Fill(8, AntiXis.size());
+  fEventTimer.Stop();
+  fBenchmarkWallTime->Fill(kNBenchmarkStages, fEventTimer.RealTime());
+  fBenchmarkCPUTime->Fill(kNBenchmarkStages, fEventTimer.CpuTime());
+  if (fBenchmarkCounters->GetBinContent(3) == 1
+      || static_cast<int>(fBenchmarkCounters->GetBinContent(3)) % 100 == 0) {
+    UpdatePeakMemory();
+  }
 
 
   PostData(1, fQA);
@@ -706,3 +813,92 @@ void AliAnalysisTaskNanoBenchmark::StoreGlobalTrackReference(AliVTrack *track) {
   }
   (fGTI[trackID]) = track;
 }
+
+//____________________________________________________________________________________________________
+void AliAnalysisTaskNanoBenchmark::FinishTaskOutput() {
+  // one peak memory entry per job, the merged histogram gives the distribution over the jobs
+  UpdatePeakMemory();
+  if (fBenchmarkPeakMemory) {
+    fBenchmarkPeakMemory->Fill(fPeakMemory / 1024.);
+  }
+}
+
+//____________________________________________________________________________________________________
+void AliAnalysisTaskNanoBenchmark::Terminate(Option_t *) {
+  TList *qa = dynamic_cast<TList*>(GetOutputData(1));
+  TList *benchmark = qa ? dynamic_cast<TList*>(qa->FindObject("Benchmark")) : nullptr;
+  if (!benchmark) {
+    AliError("No benchmark output");
+    return;
+  }
+  TH1 *wallTime = static_cast<TH1*>(benchmark->FindObject("WallTime"));
+  TH1 *cpuTime = static_cast<TH1*>(benchmark->FindObject("CPUTime"));
+  TH1 *counters = static_cast<TH1*>(benchmark->FindObject("Counters"));
+  TH1 *peakMemory = static_cast<TH1*>(benchmark->FindObject("PeakMemory"));
+  const double nEvents = counters->GetBinContent(1);
+  const double totalWallTime = wallTime->GetBinContent(kNBenchmarkStages + 1);
+  const double eventsPerSecond = totalWallTime > 0 ? nEvents / totalWallTime : 0;
+  int lastMemoryBin = peakMemory->FindLastBinAbove(0);
+  const double maxPeakMemory = lastMemoryBin > 0 ? peakMemory->GetXaxis()->GetBinUpEdge(lastMemoryBin) : 0;
+
+  printf("Benchmark %s: %.0f events (%.0f benchmarked), %.2f events/s, peak memory < %.0f MB\n",
+         GetName(), nEvents, counters->GetBinContent(3), eventsPerSecond, maxPeakMemory);
+  for (int iStage = 0; iStage <= kNBenchmarkStages; ++iStage) {
+    printf("  %-18s wall %10.3f s  cpu %10.3f s\n", GetBenchmarkStageName(iStage),
+           wallTime->GetBinContent(iStage + 1), cpuTime->GetBinContent(iStage + 1));
+  }
+
+  if (fBenchmarkReport.IsNull()) {
+    return;
+  }
+  std::ofstream report(fBenchmarkReport.Data());
+  if (!report.good()) {
+    AliError(Form("Cannot write the benchmark report %s", fBenchmarkReport.Data()));
+    return;
+  }
+  report << "{\n";
+  report << "  \"task\": \"" << GetName() << "\",\n";
+  report << "  \"maxEvents\": " << fBenchmarkMaxEvents << ",\n";
+  report << "  \"multiplicityRange\": [" << fBenchmarkMultMin << ", " << fBenchmarkMultMax << "],\n";
+  report << "  \"mixingDepth\": " << (fConfig ? fConfig->GetMixingDepth() : fBenchmarkMixingDepth) << ",\n";
+  report << "  \"eventsPerSecond\": " << eventsPerSecond << ",\n";
+  report << "  \"peakMemoryMB\": " << maxPeakMemory << ",\n";
+  report << "  \"counters\": {";
+  for (int iBin = 1; iBin <= counters->GetNbinsX(); ++iBin) {
+    report << (iBin > 1 ? ", " : "") << "\"" << counters->GetXaxis()->GetBinLabel(iBin) << "\": " << counters->GetBinContent(iBin);
+  }
+  report << "},\n";
+  report << "  \"stages\": {\n";
+  for (int iStage = 0; iStage <= kNBenchmarkStages; ++iStage) {
+    report << "    \"" << GetBenchmarkStageName(iStage) << "\": {\"wallTime\": " << wallTime->GetBinContent(iStage + 1)
+           << ", \"cpuTime\": " << cpuTime->GetBinContent(iStage + 1) << "}" << (iStage < kNBenchmarkStages ? "," : "") << "\n";
+  }
+  report << "  }\n";
+  report << "}\n";
+}
+
+//____________________________________________________________________________________________________
+const char *AliAnalysisTaskNanoBenchmark::GetBenchmarkStageName(int stage) {
+  static const char *stageNames[kNBenchmarkStages + 1] = { "EventSelection",
+      "TrackSelection", "v0Selection", "CascadeSelection", "MCTruth",
+      "PairCleaning", "Pairing", "ControlSample", "Dumpster", "Event" };
+  return (stage >= 0 && stage <= kNBenchmarkStages) ? stageNames[stage] : "";
+}
+
+//____________________________________________________________________________________________________
+void AliAnalysisTaskNanoBenchmark::StopStage(BenchmarkStage stage) {
+  // stages are measured back to back, the timer is restarted for the next one
+  fStageTimer.Stop();
+  fBenchmarkWallTime->Fill(stage, fStageTimer.RealTime());
+  fBenchmarkCPUTime->Fill(stage, fStageTimer.CpuTime());
+  fStageTimer.Start(kTRUE);
+}
+
+//____________________________________________________________________________________________________
+void AliAnalysisTaskNanoBenchmark::UpdatePeakMemory() {
+  ProcInfo_t procInfo;
+  gSystem->GetProcInfo(&procInfo);
+  if (procInfo.fMemResident > fPeakMemory) {
+    fPeakMemory = procInfo.fMemResident;
+  }
+}
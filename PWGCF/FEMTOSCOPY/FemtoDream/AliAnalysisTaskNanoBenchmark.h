@@ -7,6 +7,8 @@
 
 #ifndef PWGCF_FEMTOSCOPY_FEMTODREAM_ALIANALYSISTASKNANOBENCHMARK_H_
 #define PWGCF_FEMTOSCOPY_FEMTODREAM_ALIANALYSISTASKNANOBBENCHMARK_H_
+#include "TStopwatch.h"
+#include "TString.h"
 #include "AliAnalysisTaskSE.h"
 #include "AliFemtoDreamEventCuts.h"
 #include "AliFemtoDreamEvent.h"
@@ -23,13 +25,36 @@
 #include "AliFemtoDreamBaseDump.h"
 
 
+class TH1;
+
+// Benchmark of the FemtoDream chain (track, v0 and cascade cuts, pair
+// cleaner, same/mixed event pairing) on a fixed nanoAOD sample. The wall
+// and CPU time of every stage, the number of processed events and
+// particles and the peak resident memory are booked in the list
+// "Benchmark" of the QA output (slot 1); Terminate prints them and, if a
+// report file is set, writes them as JSON to track the performance run
+// over run.
 class AliAnalysisTaskNanoBenchmark : public AliAnalysisTaskSE {
  public:
+  enum BenchmarkStage {
+    kEventSelection = 0,
+    kTrackSelection = 1,
+    kv0Selection = 2,
+    kCascadeSelection = 3,
+    kMCTruth = 4,
+    kPairCleaning = 5,
+    kPairing = 6,
+    kControlSample = 7,
+    kDumpster = 8,
+    kNBenchmarkStages = 9
+  };
   AliAnalysisTaskNanoBenchmark();
   AliAnalysisTaskNanoBenchmark(const char *name, bool isMC);
   virtual ~AliAnalysisTaskNanoBenchmark();
   virtual void UserCreateOutputObjects();
   virtual void UserExec(Option_t *option);
+  virtual void FinishTaskOutput();
+  virtual void Terminate(Option_t *option);
   void ResetGlobalTrackReference();
   void StoreGlobalTrackReference(AliVTrack *track);
   void SetRunTaskLightWeight(bool light) {
@@ -62,9 +87,29 @@ class AliAnalysisTaskNanoBenchmark : public AliAnalysisTaskSE {
   void SetCorrelationConfig(AliFemtoDreamCollConfig* config) {
     fConfig=config;
   }
+  // process only the first nEvents events of the sample (<= 0: all)
+  void SetBenchmarkMaxEvents(int nEvents) {
+    fBenchmarkMaxEvents = nEvents;
+  }
+  // benchmark only selected events in the multiplicity window [minMult, maxMult]
+  void SetBenchmarkMultiplicity(int minMult, int maxMult) {
+    fBenchmarkMultMin = minMult;
+    fBenchmarkMultMax = maxMult;
+  }
+  // override the mixing depth of the correlation config (<= 0: keep it)
+  void SetBenchmarkMixingDepth(int depth) {
+    fBenchmarkMixingDepth = depth;
+  }
+  // JSON file written by Terminate with the benchmark summary
+  void SetBenchmarkReportFile(const char *fileName) {
+    fBenchmarkReport = fileName;
+  }
+  static const char *GetBenchmarkStageName(int stage);
  private:
   AliAnalysisTaskNanoBenchmark(const AliAnalysisTaskNanoBenchmark &task);
   AliAnalysisTaskNanoBenchmark &operator=(const AliAnalysisTaskNanoBenchmark &task);
+  void StopStage(BenchmarkStage stage);
+  void UpdatePeakMemory();
   bool fisLightWeight;//
   bool fIsMC;        //
   bool fUseDumpster; //
@@ -113,7 +158,21 @@ class AliAnalysisTaskNanoBenchmark : public AliAnalysisTaskSE {
   TList* fDumpster; //!
   int fTrackBufferSize;//
   AliVTrack **fGTI;  //!
-  ClassDef(AliAnalysisTaskNanoBenchmark,4)
+  int fBenchmarkMaxEvents;    //
+  int fBenchmarkMultMin;      //
+  int fBenchmarkMultMax;      //
+  int fBenchmarkMixingDepth;  //
+  TString fBenchmarkReport;   //
+  TList *fBenchmark;          //!
+  TH1 *fBenchmarkWallTime;    //! wall time (s) per stage, last bin: full event
+  TH1 *fBenchmarkCPUTime;     //! CPU time (s) per stage, last bin: full event
+  TH1 *fBenchmarkCounters;    //! processed events and selected particles
+  TH1 *fBenchmarkPeakMemory;  //! peak resident memory (MB), one entry per job
+  TStopwatch fStageTimer;     //!
+  TStopwatch fEventTimer;     //!
+  int fNEventsSeen;           //!
+  long fPeakMemory;           //! kB
+  ClassDef(AliAnalysisTaskNanoBenchmark,5)
 };
 
 #endif /* PWGCF_FEMTOSCOPY_FEMTODREAM_ALIANALYSISTASKNANOBBAR_H_ */
@@ -26,6 +26,7 @@ AliFemtoDreamBasePart::AliFemtoDreamBasePart(const int part)
       fMCTheta(0),
       fPhi(0),
       fPhiAtRadius(),
+      fPhiAtRadiusSpare(),
       fXYZAtRadius(),
       fMCPhi(0),
       fIDTracks(0),
@@ -78,6 +79,7 @@ AliFemtoDreamBasePart::AliFemtoDreamBasePart(const AliFemtoDreamBasePart &part)
       fMCTheta(part.fMCTheta),
       fPhi(part.fPhi),
       fPhiAtRadius(part.fPhiAtRadius),
+      fPhiAtRadiusSpare(),
       fXYZAtRadius(part.fXYZAtRadius),
       fMCPhi(part.fMCPhi),
       fIDTracks(part.fIDTracks),
@@ -133,7 +135,11 @@ AliFemtoDreamBasePart &AliFemtoDreamBasePart::operator=(
   fTheta = obj.fTheta;
   fMCTheta = obj.fMCTheta;
   fPhi = obj.fPhi;
-  fPhiAtRadius = obj.fPhiAtRadius;
+  // the entries are assigned one by one to keep the storage of this particle
+  ClearPhiAtRadius();
+  for (const auto &it : obj.fPhiAtRadius) {
+    AddPhiAtRadius() = it;
+  }
   fXYZAtRadius = obj.fXYZAtRadius;
   fMCPhi = obj.fMCPhi;
   fIDTracks = obj.fIDTracks;
@@ -189,6 +195,7 @@ AliFemtoDreamBasePart::AliFemtoDreamBasePart(
       fMCTheta(),
       fPhi(),
       fPhiAtRadius(0),
+      fPhiAtRadiusSpare(),
       fXYZAtRadius(0),
       fMCPhi(),
       fIDTracks(),
@@ -267,12 +274,8 @@ AliFemtoDreamBasePart::AliFemtoDreamBasePart(
   fPhi.push_back(posTrack->Phi());
   fPhi.push_back(negTrack->Phi());
 
-  std::vector<float> phiAtRadiiPos;
-  std::vector<float> phiAtRadiiNeg;
-  PhiAtRadii(posTrack, inputEvent->GetMagneticField(), phiAtRadiiPos);
-  PhiAtRadii(negTrack, inputEvent->GetMagneticField(), phiAtRadiiNeg);
-  fPhiAtRadius.push_back(phiAtRadiiPos);
-  fPhiAtRadius.push_back(phiAtRadiiNeg);
+  PhiAtRadii(posTrack, inputEvent->GetMagneticField(), AddPhiAtRadius());
+  PhiAtRadii(negTrack, inputEvent->GetMagneticField(), AddPhiAtRadius());
 
   fCharge.push_back(posTrack->Charge() + negTrack->Charge());
   fCharge.push_back(posTrack->Charge());
@@ -297,6 +300,7 @@ AliFemtoDreamBasePart::AliFemtoDreamBasePart(const AliAODRecoDecayHF *dmeson,
       fMCTheta(),
       fPhi(),
       fPhiAtRadius(0),
+      fPhiAtRadiusSpare(),
       fXYZAtRadius(0),
       fMCPhi(),
       fIDTracks(),
@@ -344,7 +348,6 @@ AliFemtoDreamBasePart::AliFemtoDreamBasePart(const AliAODRecoDecayHF *dmeson,
     fInvMass = dynamic_cast<const AliAODRecoCascadeHF *>(dmeson)->DeltaInvMass();
   }
 
-  std::vector<float> phiAtRadii;
   for (size_t iChild = 0; iChild < pdgChildren.size(); iChild++) {
     AliAODTrack *track;
     if (pdgParent != 413 || iChild == 0) {
@@ -358,9 +361,7 @@ AliFemtoDreamBasePart::AliFemtoDreamBasePart(const AliAODRecoDecayHF *dmeson,
     fEta.push_back(track->Eta());
     fTheta.push_back(track->Theta());
     fPhi.push_back(track->Phi());
-    phiAtRadii.clear();
-    PhiAtRadii(track, aod->GetMagneticField(), phiAtRadii);
-    fPhiAtRadius.push_back(phiAtRadii);
+    PhiAtRadii(track, aod->GetMagneticField(), AddPhiAtRadius());
     fCharge.push_back(track->Charge());
     if (pdgParent == 413 ) {
       fSoftPionPx = track->Px();
@@ -7,6 +7,8 @@
 
 #ifndef ALIFEMTODREAMBASEPART_H_
 #define ALIFEMTODREAMBASEPART_H_
+#include <utility>
+#include <vector>
 #include "AliAODTrack.h"
 #include "AliAODMCParticle.h"
 #include "AliMCEvent.h"
@@ -63,7 +65,7 @@ class AliFemtoDreamBasePart {
     return TVector3(-999,-999,-999);
   }
   ;
-  std::vector<TVector3> GetMomenta() const {
+  const std::vector<TVector3>& GetMomenta() const {
     return fP;
   }
   float GetP() const {
@@ -123,7 +125,7 @@ class AliFemtoDreamBasePart {
     fEta.push_back(eta);
   }
   ;
-  std::vector<float> GetEta() const {
+  const std::vector<float>& GetEta() const {
     return fEta;
   }
   ;
@@ -131,7 +133,7 @@ class AliFemtoDreamBasePart {
     fTheta.push_back(theta);
   }
   ;
-  std::vector<float> GetTheta() const {
+  const std::vector<float>& GetTheta() const {
     return fTheta;
   }
   ;
@@ -139,7 +141,7 @@ class AliFemtoDreamBasePart {
     fMCTheta.push_back(theta);
   }
   ;
-  std::vector<float> GetMCTheta() const {
+  const std::vector<float>& GetMCTheta() const {
     return fMCTheta;
   }
   ;
@@ -147,15 +149,34 @@ class AliFemtoDreamBasePart {
     fPhi.push_back(phi);
   }
   ;
-  std::vector<float> GetPhi() const {
+  const std::vector<float>& GetPhi() const {
     return fPhi;
   }
   ;
-  void SetPhiAtRadius(std::vector<float> phiAtRad) {
-    fPhiAtRadius.push_back(phiAtRad);
+  void SetPhiAtRadius(const std::vector<float> &phiAtRad) {
+    AddPhiAtRadius() = phiAtRad;
   }
   ;
-  std::vector<std::vector<float>> GetPhiAtRaidius() const {
+  // Appends an empty entry to the phi at radii, reusing the storage of the
+  // entries removed by ClearPhiAtRadius, such that refilling a particle does
+  // not allocate once the buffers have reached their size
+  std::vector<float>& AddPhiAtRadius() {
+    if (fPhiAtRadiusSpare.empty()) {
+      fPhiAtRadius.emplace_back();
+    } else {
+      fPhiAtRadius.push_back(std::move(fPhiAtRadiusSpare.back()));
+      fPhiAtRadiusSpare.pop_back();
+      fPhiAtRadius.back().clear();
+    }
+    return fPhiAtRadius.back();
+  }
+  void ClearPhiAtRadius() {
+    for (auto &it : fPhiAtRadius) {
+      fPhiAtRadiusSpare.push_back(std::move(it));
+    }
+    fPhiAtRadius.clear();
+  }
+  const std::vector<std::vector<float>>& GetPhiAtRaidius() const {
     return fPhiAtRadius;
   }
   ;
@@ -178,7 +199,7 @@ class AliFemtoDreamBasePart {
     fXYZAtRadius.push_back(XYZAtRad);
   }
   ;
-  std::vector<TVector3> GetXYZAtRadius() {
+  const std::vector<TVector3>& GetXYZAtRadius() const {
     return fXYZAtRadius;
   }
   ;
@@ -186,7 +207,7 @@ class AliFemtoDreamBasePart {
     fMCPhi.push_back(phi);
   }
   ;
-  std::vector<float> GetMCPhi() const {
+  const std::vector<float>& GetMCPhi() const {
     return fMCPhi;
   }
   ;
@@ -194,7 +215,7 @@ class AliFemtoDreamBasePart {
     fIDTracks.push_back(idTracks);
   }
   ;
-  std::vector<int> GetIDTracks() const {
+  const std::vector<int>& GetIDTracks() const {
     return fIDTracks;
   }
   ;
@@ -202,7 +223,7 @@ class AliFemtoDreamBasePart {
     fCharge.push_back(charge);
   }
   ;
-  std::vector<int> GetCharge() const {
+  const std::vector<int>& GetCharge() const {
     return fCharge;
   }
   ;
@@ -371,6 +392,7 @@ class AliFemtoDreamBasePart {
   std::vector<float> fMCTheta;
   std::vector<float> fPhi;
   std::vector<std::vector<float>> fPhiAtRadius;
+  std::vector<std::vector<float>> fPhiAtRadiusSpare;  //! storage of cleared phi at radii
   std::vector<TVector3> fXYZAtRadius;
   std::vector<float> fMCPhi;
   std::vector<int> fIDTracks;
@@ -414,7 +436,7 @@ class AliFemtoDreamBasePart {
   void PhiAtRadii(const AliVTrack *track, const float bfield,
                   std::vector<float> &tmpVec);
 //  AliFemtoDreamBasePart(const AliFemtoDreamBasePart&);
-ClassDef(AliFemtoDreamBasePart, 13)
+ClassDef(AliFemtoDreamBasePart, 14)
   ;
 };
 
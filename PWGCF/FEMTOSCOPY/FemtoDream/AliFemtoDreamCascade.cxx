@@ -552,7 +552,7 @@ void AliFemtoDreamCascade::Reset() {
     fTheta.clear();
     fMCTheta.clear();
     fPhi.clear();
-    fPhiAtRadius.clear();
+    ClearPhiAtRadius();
     fXYZAtRadius.clear();
     fMCPhi.clear();
     fIDTracks.clear();
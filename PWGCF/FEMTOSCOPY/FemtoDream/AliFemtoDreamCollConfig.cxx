@@ -51,7 +51,8 @@ AliFemtoDreamCollConfig::AliFemtoDreamCollConfig()
       fDoDeltaEtaDeltaPhiCut(false),
       fCoutVariables(false),
       fSummedPtLimit1(0.0),
-      fSummedPtLimit2(999.0) {
+      fSummedPtLimit2(999.0),
+      fSkipPairsAboveKStarMax(false) {
   //should not be used, since we need a name to deal with root objects
 }
 
@@ -100,7 +101,8 @@ AliFemtoDreamCollConfig::AliFemtoDreamCollConfig(
       fDoDeltaEtaDeltaPhiCut(config.fDoDeltaEtaDeltaPhiCut),
       fCoutVariables(config.fCoutVariables),
       fSummedPtLimit1(config.fSummedPtLimit1),
-      fSummedPtLimit2(config.fSummedPtLimit2) {
+      fSummedPtLimit2(config.fSummedPtLimit2),
+      fSkipPairsAboveKStarMax(config.fSkipPairsAboveKStarMax) {
 }
 
 AliFemtoDreamCollConfig::AliFemtoDreamCollConfig(const char *name,
@@ -149,7 +151,8 @@ AliFemtoDreamCollConfig::AliFemtoDreamCollConfig(const char *name,
       fDoDeltaEtaDeltaPhiCut(false),
       fCoutVariables(QACouts),
       fSummedPtLimit1(0.0),
-      fSummedPtLimit2(999.0) {
+      fSummedPtLimit2(999.0),
+      fSkipPairsAboveKStarMax(false) {
 }
 AliFemtoDreamCollConfig& AliFemtoDreamCollConfig::operator=(
     const AliFemtoDreamCollConfig& config) {
@@ -198,6 +201,7 @@ AliFemtoDreamCollConfig& AliFemtoDreamCollConfig::operator=(
     this->fCoutVariables = config.fCoutVariables;
     this->fSummedPtLimit1 = config.fSummedPtLimit1;
     this->fSummedPtLimit2 = config.fSummedPtLimit2;
+    this->fSkipPairsAboveKStarMax = config.fSkipPairsAboveKStarMax;
   }
   return *this;
 }
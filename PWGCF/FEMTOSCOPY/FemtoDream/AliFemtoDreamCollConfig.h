@@ -304,6 +304,16 @@ class AliFemtoDreamCollConfig : public TNamed {
   float GetSummedPtLimit2(){
     return fSummedPtLimit2;
   }
+  // Skip pairs with k* above the upper edge of the histograms of the pair
+  // (SetMaxKRel) before the close pair rejection and the filling. Histograms
+  // within the k* range are unchanged, but their overflow bins, the QA with
+  // pairs outside of the range and the k* trees no longer contain these pairs.
+  void SetSkipPairsAboveKStarMax(bool skip) {
+    fSkipPairsAboveKStarMax = skip;
+  }
+  bool GetSkipPairsAboveKStarMax() const {
+    return fSkipPairsAboveKStarMax;
+  }
   static std::vector<float> GetDefaultZbins();
   static std::vector<int> GetHMMultBins();
   static std::vector<int> GetMBMultBins();
@@ -353,7 +363,8 @@ class AliFemtoDreamCollConfig : public TNamed {
   bool fCoutVariables;
   float fSummedPtLimit1;
   float fSummedPtLimit2;
-  ClassDef(AliFemtoDreamCollConfig,18);
+  bool fSkipPairsAboveKStarMax; //
+  ClassDef(AliFemtoDreamCollConfig,19);
 };
 
 #endif /* ALIFEMTODREAMCOLLCONFIG_H_ */
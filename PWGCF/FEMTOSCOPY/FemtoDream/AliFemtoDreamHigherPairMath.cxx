@@ -562,11 +562,17 @@ bool AliFemtoDreamHigherPairMath::DeltaEtaDeltaPhi(int Hist,
             Hist, nDaug2, (unsigned int)part2.GetPhiAtRaidius().size());
     AliWarning(outMessage.Data());
   }
-  std::vector<float> eta1 = part1.GetEta();
-  std::vector<float> eta2 = part2.GetEta();
+  // the phi* of the daughters at the TPC radii are computed once per particle
+  // (see AliFemtoDreamTrack/AliFemtoDreamv0), here only references are taken
+  const std::vector<float> &eta1 = part1.GetEta();
+  const std::vector<float> &eta2 = part2.GetEta();
+  const std::vector<std::vector<float>> &phiAtRadii1 = part1.GetPhiAtRaidius();
+  const std::vector<std::vector<float>> &phiAtRadii2 = part2.GetPhiAtRaidius();
+  const bool fillHists = fWhichPairs.at(Hist);
+  const bool rejPairs = fRejPairs.at(Hist);
 
   for (unsigned int iDaug1 = 0; iDaug1 < nDaug1; ++iDaug1) {
-    std::vector<float> PhiAtRad1 = part1.GetPhiAtRaidius().at(iDaug1);
+    const std::vector<float> &PhiAtRad1 = phiAtRadii1.at(iDaug1);
     float etaPar1;
     if (nDaug1 == 1) {
       etaPar1 = eta1.at(0);
@@ -574,7 +580,7 @@ bool AliFemtoDreamHigherPairMath::DeltaEtaDeltaPhi(int Hist,
       etaPar1 = eta1.at(iDaug1 + 1);
     }
     for (unsigned int iDaug2 = 0; iDaug2 < nDaug2; ++iDaug2) {
-      std::vector<float> phiAtRad2 = part2.GetPhiAtRaidius().at(iDaug2);
+      const std::vector<float> &phiAtRad2 = phiAtRadii2.at(iDaug2);
       float etaPar2;
       if (nDaug2 == 1) {
         etaPar2 = eta2.at(0);
@@ -582,12 +588,20 @@ bool AliFemtoDreamHigherPairMath::DeltaEtaDeltaPhi(int Hist,
         etaPar2 = eta2.at(iDaug2 + 1);
       }
       float deta = etaPar1 - etaPar2;
+      // without histograms the radii only matter if the pair can still be
+      // rejected, which requires the eta term alone to be below 1
+      if (!fillHists
+          && !(pass && rejPairs && deta * deta / fDeltaEtaSqMax < 1.)) {
+        continue;
+      }
       const int size =
           (PhiAtRad1.size() > phiAtRad2.size()) ?
               phiAtRad2.size() : PhiAtRad1.size();
+      const float *phi1 = PhiAtRad1.data();
+      const float *phi2 = phiAtRad2.data();
       float dphiAvg = 0;
       for (int iRad = 0; iRad < size; ++iRad) {
-        float dphi = PhiAtRad1.at(iRad) - phiAtRad2.at(iRad);
+        float dphi = phi1[iRad] - phi2[iRad];
         if (dphi > piHi) {
           dphi += -piHi * 2;
         } else if (dphi < -piHi) {
@@ -596,7 +610,7 @@ bool AliFemtoDreamHigherPairMath::DeltaEtaDeltaPhi(int Hist,
         dphi = TVector2::Phi_mpi_pi(dphi);
 
         dphiAvg += dphi;
-        if (fWhichPairs.at(Hist)) {
+        if (fillHists) {
           if (SEorME) {
             fHists->FillEtaPhiAtRadiiSE(Hist, 9 * iDaug1 + iDaug2, iRad, dphi,
                                         deta, relk);
@@ -606,14 +620,14 @@ bool AliFemtoDreamHigherPairMath::DeltaEtaDeltaPhi(int Hist,
           }
         }
       }
-      if (pass && fRejPairs.at(Hist)) {
+      if (pass && rejPairs) {
         if ((dphiAvg / (float) size) * (dphiAvg / (float) size) / fDeltaPhiSqMax
             + deta * deta / fDeltaEtaSqMax < 1.) {
           pass = false;
         }
       }
       //fill dPhi avg
-      if (fWhichPairs.at(Hist)) {
+      if (fillHists) {
         if (SEorME) {
           fHists->FillEtaPhiAverageSE(Hist, 9 * iDaug1 + iDaug2,
                                       dphiAvg / (float) size, deta, true);
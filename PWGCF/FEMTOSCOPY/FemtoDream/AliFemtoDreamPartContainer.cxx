@@ -12,13 +12,17 @@
 ClassImp(AliFemtoDreamPartContainer)
 AliFemtoDreamPartContainer::AliFemtoDreamPartContainer()
     : fPartBuffer(),
-      fMixingDepth(0) {
+      fMixingDepth(0),
+      fFirst(0),
+      fNEvents(0) {
 
 }
 
 AliFemtoDreamPartContainer::AliFemtoDreamPartContainer(int MixingDepth)
     : fPartBuffer(),
-      fMixingDepth(MixingDepth) {
+      fMixingDepth(MixingDepth),
+      fFirst(0),
+      fNEvents(0) {
 
 }
 
@@ -27,15 +31,10 @@ AliFemtoDreamPartContainer& AliFemtoDreamPartContainer::operator=(
   if (this == &obj) {
     return *this;
   }
-//  std::deque<std::deque<AliFemtoDreamBasePart>>::iterator copyIter;
-//  std::deque<std::deque<AliFemtoDreamBasePart>>::iterator objIter;
-//  for (objIter=obj.fPartBuffer.begin();objIter!=obj.fPartBuffer.end();
-//      ++objIter)
-//  {
-//
-//  }
   this->fMixingDepth = obj.fMixingDepth;
   this->fPartBuffer = obj.fPartBuffer;
+  this->fFirst = obj.fFirst;
+  this->fNEvents = obj.fNEvents;
   return (*this);
 }
 
@@ -44,31 +43,51 @@ AliFemtoDreamPartContainer::~AliFemtoDreamPartContainer() {
 
 void AliFemtoDreamPartContainer::SetEvent(
     std::vector<AliFemtoDreamBasePart> &Particles) {
-  if (!(fPartBuffer.size() < fMixingDepth)) {
-//    std::cout << "Popping Front" << std::endl;
-    fPartBuffer.pop_front();
+  if (fMixingDepth == 0) {
+    return;
+  }
+  if (fNEvents < fMixingDepth) {
+    //Buffer not yet full, the ring starts at position 0
+    if (fPartBuffer.size() < fMixingDepth) {
+      fPartBuffer.resize(fMixingDepth);
+    }
+    fPartBuffer[fNEvents] = Particles;
+    ++fNEvents;
+  } else {
+    //Overwrite the oldest event, its storage is reused
+    fPartBuffer[fFirst] = Particles;
+    fFirst = (fFirst + 1) % fMixingDepth;
   }
-  fPartBuffer.push_back(Particles);
-//  std::cout << "PartBuffer Size: "<<fPartBuffer.size()<<'\t'<<"Input Size: "
-//      << Particles.size() << '\n';
   return;
 }
 
+std::deque<std::vector<AliFemtoDreamBasePart>> AliFemtoDreamPartContainer::GetEventBuffer() const {
+  std::deque<std::vector<AliFemtoDreamBasePart>> buffer;
+  for (unsigned int iEvt = 0; iEvt < fNEvents; ++iEvt) {
+    buffer.push_back(GetEvent(iEvt));
+  }
+  return buffer;
+}
+
 void AliFemtoDreamPartContainer::PrintLastEvent() {
-  for (std::deque<std::vector<AliFemtoDreamBasePart>>::iterator itEvt =
-      fPartBuffer.begin(); itEvt != fPartBuffer.end(); ++itEvt) {
-    std::cout << "Printing Last Event with size: " << itEvt->size() << '\n';
-    for (std::vector<AliFemtoDreamBasePart>::iterator itPart = itEvt->begin();
-        itPart != itEvt->end(); ++itPart) {
+  for (unsigned int iEvt = 0; iEvt < fNEvents; ++iEvt) {
+    const std::vector<AliFemtoDreamBasePart> &Event = GetEvent(iEvt);
+    std::cout << "Printing Last Event with size: " << Event.size() << '\n';
+    for (auto itPart = Event.begin(); itPart != Event.end(); ++itPart) {
       TVector3 P(itPart->GetMomentum());
       std::cout << "Px: " << P.X() << '\t' << "Py: " << P.Y() << '\t' << "Pz: "
                 << P.Z() << std::endl;
     }
   }
 }
+
 std::vector<AliFemtoDreamBasePart> &AliFemtoDreamPartContainer::GetEvent(
     int Depth) {
-  std::deque<std::vector<AliFemtoDreamBasePart>>::iterator itEvt = fPartBuffer
-      .begin() + Depth;
-  return *itEvt;
+  //Depth 0 is the oldest event in the buffer
+  return fPartBuffer[(fFirst + Depth) % fMixingDepth];
+}
+
+const std::vector<AliFemtoDreamBasePart> &AliFemtoDreamPartContainer::GetEvent(
+    int Depth) const {
+  return fPartBuffer[(fFirst + Depth) % fMixingDepth];
 }
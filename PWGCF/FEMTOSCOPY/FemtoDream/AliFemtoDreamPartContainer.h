@@ -16,6 +16,8 @@
 //Class Containing the Particles from previous Events up to a certain mixing
 //depth for one Particle Species and Mult/ZVtx Bin
 //ZVtx bin.
+//The events are kept in a ring buffer, the storage of the oldest event is
+//reused for the next one and the buffered events are accessed by reference
 class AliFemtoDreamPartContainer {
  public:
   AliFemtoDreamPartContainer();
@@ -24,18 +26,21 @@ class AliFemtoDreamPartContainer {
   virtual ~AliFemtoDreamPartContainer();
   void PrintLastEvent();
   void SetEvent(std::vector<AliFemtoDreamBasePart> &Particles);
-  std::deque<std::vector<AliFemtoDreamBasePart>> GetEventBuffer() const {
-    return fPartBuffer;
-  }
-  ;
+  // Copy of the buffer ordered from the oldest to the newest event, use
+  // GetEvent to access the buffered events without copying them
+  std::deque<std::vector<AliFemtoDreamBasePart>> GetEventBuffer() const;
   std::vector<AliFemtoDreamBasePart> &GetEvent(int Depth);
+  const std::vector<AliFemtoDreamBasePart> &GetEvent(int Depth) const;
   unsigned int GetMixingDepth() const {
-    return fPartBuffer.size();
+    return fNEvents;
   }
   ;
  private:
-  std::deque<std::vector<AliFemtoDreamBasePart>> fPartBuffer;
-  unsigned int fMixingDepth;ClassDef(AliFemtoDreamPartContainer,2)
+  std::vector<std::vector<AliFemtoDreamBasePart>> fPartBuffer;
+  unsigned int fMixingDepth;
+  unsigned int fFirst;    // Position of the oldest event in the ring buffer
+  unsigned int fNEvents;  // Number of buffered events
+ClassDef(AliFemtoDreamPartContainer,3)
   ;
 };
 
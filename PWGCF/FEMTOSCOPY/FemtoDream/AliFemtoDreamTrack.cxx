@@ -6,6 +6,7 @@
  */
 #include "AliAnalysisManager.h"
 #include "AliAODPid.h"
+#include "AliPIDNSigmaTable.h"
 #include "AliAODTrack.h"
 #include "AliAODEvent.h"
 #include "AliAODMCParticle.h"
@@ -439,21 +440,21 @@ void AliFemtoDreamTrack::SetESDPIDInformation() {
   this->fbetaTOF = GetBeta(fESDTrack);
   for (int i = 0; i < 6; ++i) {
     if (statusITS == AliPIDResponse::kDetPidOk) {
-      (this->fnSigmaITS)[i] = fPIDResponse->NumberOfSigmas(AliPIDResponse::kITS,
+      (this->fnSigmaITS)[i] = AliPIDNSigmaTable::NumberOfSigmas(fPIDResponse, AliPIDResponse::kITS,
                                                            fESDTrack,
                                                            particleID[i]);
     } else {
       (this->fnSigmaITS)[i] = -999.;
     }
     if (statusTPC == AliPIDResponse::kDetPidOk) {
-      (this->fnSigmaTPC)[i] = fPIDResponse->NumberOfSigmas(AliPIDResponse::kTPC,
+      (this->fnSigmaTPC)[i] = AliPIDNSigmaTable::NumberOfSigmas(fPIDResponse, AliPIDResponse::kTPC,
                                                            fESDTrack,
                                                            particleID[i]);
     } else {
       (this->fnSigmaTPC)[i] = -999.;
     }
     if (statusTOF == AliPIDResponse::kDetPidOk) {
-      (this->fnSigmaTOF)[i] = fPIDResponse->NumberOfSigmas(AliPIDResponse::kTOF,
+      (this->fnSigmaTOF)[i] = AliPIDNSigmaTable::NumberOfSigmas(fPIDResponse, AliPIDResponse::kTOF,
                                                            fESDTrack,
                                                            particleID[i]);
     } else {
@@ -656,7 +657,7 @@ void AliFemtoDreamTrack::SetPhiAtRadii(const float bfield) {
   float phi0 = GetPhi().at(0);
   float pt = GetPt();
   float chg = GetCharge().at(0);
-  std::vector<float> phiatRadius;
+  std::vector<float> &phiatRadius = AddPhiAtRadius();
   for (int radius = 0; radius < 9; radius++) {
    //20-Feb-2022
    //Avoid NAN in asin for low momentum particle (particularly for pions)
@@ -668,7 +669,6 @@ void AliFemtoDreamTrack::SetPhiAtRadii(const float bfield) {
                     / (2. * pt)));
    }//safety check for asin
   }
-  fPhiAtRadius.push_back(phiatRadius);
   return;
 }
 
@@ -720,21 +720,21 @@ void AliFemtoDreamTrack::SetAODPIDInformation() {
   this->fbetaTOF = GetBeta(fAODGlobalTrack);
   for (int i = 0; i < 6; ++i) {
     if (statusITS == AliPIDResponse::kDetPidOk) {
-      (this->fnSigmaITS)[i] = fPIDResponse->NumberOfSigmas(AliPIDResponse::kITS,
+      (this->fnSigmaITS)[i] = AliPIDNSigmaTable::NumberOfSigmas(fPIDResponse, AliPIDResponse::kITS,
                                                            fAODGlobalTrack,
                                                            particleID[i]);
     } else {
       (this->fnSigmaITS)[i] = -999.;
     }
     if (statusTPC == AliPIDResponse::kDetPidOk) {
-      (this->fnSigmaTPC)[i] = fPIDResponse->NumberOfSigmas(AliPIDResponse::kTPC,
+      (this->fnSigmaTPC)[i] = AliPIDNSigmaTable::NumberOfSigmas(fPIDResponse, AliPIDResponse::kTPC,
                                                            fAODGlobalTrack,
                                                            particleID[i]);
     } else {
       (this->fnSigmaTPC)[i] = -999.;
     }
     if (statusTOF == AliPIDResponse::kDetPidOk) {
-      (this->fnSigmaTOF)[i] = fPIDResponse->NumberOfSigmas(AliPIDResponse::kTOF,
+      (this->fnSigmaTOF)[i] = AliPIDNSigmaTable::NumberOfSigmas(fPIDResponse, AliPIDResponse::kTOF,
                                                            fAODGlobalTrack,
                                                            particleID[i]);
     } else {
@@ -951,7 +951,7 @@ void AliFemtoDreamTrack::Reset() {
     fTheta.clear();
     fMCTheta.clear();
     fPhi.clear();
-    fPhiAtRadius.clear();
+    ClearPhiAtRadius();
     fXYZAtRadius.clear();
     fMCPhi.clear();
     fIDTracks.clear();
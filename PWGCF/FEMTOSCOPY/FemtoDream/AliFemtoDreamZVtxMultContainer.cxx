@@ -14,6 +14,12 @@
 #include "TDatabasePDG.h"
 #include "TVector2.h"
 #include "TTree.h"
+#include "TMath.h"
+
+static double PDGMass(int pdg) {
+  TParticlePDG *particle = TDatabasePDG::Instance()->GetParticle(pdg);
+  return particle ? particle->Mass() : 0.;
+}
 
 ClassImp(AliFemtoDreamPartContainer)
 AliFemtoDreamZVtxMultContainer::AliFemtoDreamZVtxMultContainer()
@@ -21,7 +27,11 @@ AliFemtoDreamZVtxMultContainer::AliFemtoDreamZVtxMultContainer()
       fPDGParticleSpecies(0),
       fWhichPairs(),
       fSummedPtLimit1(0.0),
-      fSummedPtLimit2(999.0){
+      fSummedPtLimit2(999.0),
+      fSkipPairsAboveKStarMax(false),
+      fKStarMax(),
+      fKinematics1(),
+      fKinematics2() {
 }
 
 AliFemtoDreamZVtxMultContainer::AliFemtoDreamZVtxMultContainer(
@@ -31,7 +41,11 @@ AliFemtoDreamZVtxMultContainer::AliFemtoDreamZVtxMultContainer(
       fPDGParticleSpecies(conf->GetPDGCodes()),
       fWhichPairs(conf->GetWhichPairs()),
       fSummedPtLimit1(conf->GetSummedPtLimit1()),
-      fSummedPtLimit2(conf->GetSummedPtLimit2()){
+      fSummedPtLimit2(conf->GetSummedPtLimit2()),
+      fSkipPairsAboveKStarMax(conf->GetSkipPairsAboveKStarMax()),
+      fKStarMax(conf->GetMaxKRel()),
+      fKinematics1(),
+      fKinematics2() {
   TDatabasePDG::Instance()->AddParticle("deuteron", "deuteron", 1.8756134,
                                         kTRUE, 0.0, 1, "Nucleus", 1000010020);
   TDatabasePDG::Instance()->AddAntiParticle("anti-deuteron", -1000010020);
@@ -64,6 +78,39 @@ void AliFemtoDreamZVtxMultContainer::SetEvent(
   }
   //  }
 }
+double AliFemtoDreamZVtxMultContainer::KStarMaxDotLimit(int iPair,
+                                                         double mass1,
+                                                         double mass2) const {
+  //Pairs with k* above the upper edge of the histograms of the pair are
+  //identified without boosting, via E1*E2 - p1.p2 > (M^2 - m1^2 - m2^2)/2,
+  //where M is the invariant mass for k* = kmax. The limit is raised by a small
+  //margin, so pairs close to the edge still go through the full computation.
+  //Returns a negative value if no pairs are to be skipped.
+  if (!fSkipPairsAboveKStarMax || iPair >= (int) fKStarMax.size()) {
+    return -1.;
+  }
+  const double kMax2 = fKStarMax[iPair] * fKStarMax[iPair];
+  const double invMassMax = TMath::Sqrt(mass1 * mass1 + kMax2)
+      + TMath::Sqrt(mass2 * mass2 + kMax2);
+  return 0.5 * (invMassMax * invMassMax - mass1 * mass1 - mass2 * mass2)
+      * (1. + 1e-4);
+}
+
+void AliFemtoDreamZVtxMultContainer::FillKinematics(
+    std::vector<AliFemtoDreamBasePart> &Particles, double mass,
+    std::vector<double> &kinematics) {
+  kinematics.resize(4 * Particles.size());
+  double *kine = kinematics.data();
+  for (auto &part : Particles) {
+    const TVector3 mom = part.GetMomentum();
+    kine[1] = mom.X();
+    kine[2] = mom.Y();
+    kine[3] = mom.Z();
+    kine[0] = TMath::Sqrt(mass * mass + mom.Mag2());
+    kine += 4;
+  }
+}
+
 void AliFemtoDreamZVtxMultContainer::PairParticlesSE(
     std::vector<std::vector<AliFemtoDreamBasePart>> &Particles,
     AliFemtoDreamHigherPairMath *HigherMath, int iMult, float cent,
@@ -82,10 +129,17 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesSE(
 
       HigherMath->FillPairCounterSE(HistCounter, itSpec1->size(),
                                     itSpec2->size());
+      const double mass1 = PDGMass(*itPDGPar1);
+      const double mass2 = PDGMass(*itPDGPar2);
+      const double dotLimit = KStarMaxDotLimit(HistCounter, mass1, mass2);
+      if (dotLimit > 0) {
+        FillKinematics(*itSpec1, mass1, fKinematics1);
+        FillKinematics(*itSpec2, mass2, fKinematics2);
+      }
       //Now loop over the actual Particles and correlate them
       for (auto itPart1 = itSpec1->begin(); itPart1 != itSpec1->end();
           ++itPart1) {
-        AliFemtoDreamBasePart part1 = *itPart1;
+        AliFemtoDreamBasePart &part1 = *itPart1;
         std::vector<AliFemtoDreamBasePart>::iterator itPart2;
         if (itSpec1 == itSpec2) {
           itPart2 = itPart1 + 1;
@@ -94,16 +148,22 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesSE(
         }
         auto itStartPart2 = itPart2;
         while (itPart2 != itSpec2->end()) {
-          AliFemtoDreamBasePart part2 = *itPart2;
+          if (dotLimit > 0
+              && AboveDotLimit(
+                  &fKinematics1[4 * (itPart1 - itSpec1->begin())],
+                  &fKinematics2[4 * (itPart2 - itSpec2->begin())],
+                  dotLimit)) {
+            ++itPart2;
+            continue;
+          }
+          AliFemtoDreamBasePart &part2 = *itPart2;
           TLorentzVector PartOne, PartTwo;
           PartOne.SetXYZM(
               itPart1->GetMomentum().X(), itPart1->GetMomentum().Y(),
-              itPart1->GetMomentum().Z(),
-              TDatabasePDG::Instance()->GetParticle(*itPDGPar1)->Mass());
+              itPart1->GetMomentum().Z(), mass1);
           PartTwo.SetXYZM(
               itPart2->GetMomentum().X(), itPart2->GetMomentum().Y(),
-              itPart2->GetMomentum().Z(),
-              TDatabasePDG::Instance()->GetParticle(*itPDGPar2)->Mass());
+              itPart2->GetMomentum().Z(), mass2);
           float RelativeK = HigherMath->RelativePairMomentum(PartOne, PartTwo);
           if (!HigherMath->PassesPairSelection(HistCounter, *itPart1, *itPart2,
                                                RelativeK, true, false)) {
@@ -263,25 +323,39 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesMEPart2Buffer(
         HigherMath->FillEffectiveMixingDepth(HistCounter,
                                              (int) itSpec2->GetMixingDepth());
       }
+      const double mass1 = PDGMass(*itPDGPar1);
+      const double mass2 = PDGMass(*itPDGPar2);
+      const double dotLimit = KStarMaxDotLimit(HistCounter, mass1, mass2);
+      if (dotLimit > 0) {
+        FillKinematics(*itSpec1, mass1, fKinematics1);
+      }
       for (int iDepth = 0; iDepth < (int) itSpec2->GetMixingDepth(); ++iDepth) {
-        std::vector<AliFemtoDreamBasePart> ParticlesOfEvent = itSpec2->GetEvent(
+        std::vector<AliFemtoDreamBasePart> &ParticlesOfEvent = itSpec2->GetEvent(
             iDepth);
         HigherMath->FillPairCounterME(HistCounter, itSpec1->size(),
                                       ParticlesOfEvent.size());
+        if (dotLimit > 0) {
+          FillKinematics(ParticlesOfEvent, mass2, fKinematics2);
+        }
         for (auto itPart1 = itSpec1->begin(); itPart1 != itSpec1->end();
             ++itPart1) {
           for (auto itPart2 = ParticlesOfEvent.begin();
               itPart2 != ParticlesOfEvent.end(); ++itPart2) {
+            if (dotLimit > 0
+                && AboveDotLimit(
+                    &fKinematics1[4 * (itPart1 - itSpec1->begin())],
+                    &fKinematics2[4 * (itPart2 - ParticlesOfEvent.begin())],
+                    dotLimit)) {
+              continue;
+            }
 
             TLorentzVector PartOne, PartTwo;
             PartOne.SetXYZM(
                 itPart1->GetMomentum().X(), itPart1->GetMomentum().Y(),
-                itPart1->GetMomentum().Z(),
-                TDatabasePDG::Instance()->GetParticle(*itPDGPar1)->Mass());
+                itPart1->GetMomentum().Z(), mass1);
             PartTwo.SetXYZM(
                 itPart2->GetMomentum().X(), itPart2->GetMomentum().Y(),
-                itPart2->GetMomentum().Z(),
-                TDatabasePDG::Instance()->GetParticle(*itPDGPar2)->Mass());
+                itPart2->GetMomentum().Z(), mass2);
             float RelativeK = HigherMath->RelativePairMomentum(PartOne, PartTwo);
             if (!HigherMath->PassesPairSelection(HistCounter, *itPart1, *itPart2,
                                                  RelativeK, false, false)) {
@@ -420,22 +494,36 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesMEPart1Buffer(
         HigherMath->FillEffectiveMixingDepth(HistCounter, (int) itSpec_to1->GetMixingDepth());
       }
 
+      const double mass1 = PDGMass(*itPDGPar1);
+      const double mass2 = PDGMass(*itPDGPar2);
+      const double dotLimit = KStarMaxDotLimit(HistCounter, mass1, mass2);
+      if (dotLimit > 0) {
+        FillKinematics(*itSpec_to2, mass2, fKinematics2);
+      }
+
       for (int iDepth = 0; iDepth < (int) itSpec_to1->GetMixingDepth(); ++iDepth) {
-        std::vector<AliFemtoDreamBasePart> ParticlesOfEvent = itSpec_to1->GetEvent(iDepth);
+        std::vector<AliFemtoDreamBasePart> &ParticlesOfEvent = itSpec_to1->GetEvent(iDepth);
         HigherMath->FillPairCounterME(HistCounter, itSpec_to2->size(), ParticlesOfEvent.size());
+        if (dotLimit > 0) {
+          FillKinematics(ParticlesOfEvent, mass1, fKinematics1);
+        }
         
         for (auto itPart1 = ParticlesOfEvent.begin(); itPart1 != ParticlesOfEvent.end(); ++itPart1) {
           for (auto itPart2 = itSpec_to2->begin(); itPart2 != itSpec_to2->end(); ++itPart2) {
+            if (dotLimit > 0
+                && AboveDotLimit(&fKinematics1[4 * (itPart1 - ParticlesOfEvent.begin())],
+                                 &fKinematics2[4 * (itPart2 - itSpec_to2->begin())],
+                                 dotLimit)) {
+              continue;
+            }
             
             TLorentzVector PartOne, PartTwo;
             PartOne.SetXYZM(
                 itPart1->GetMomentum().X(), itPart1->GetMomentum().Y(),
-                itPart1->GetMomentum().Z(),
-                TDatabasePDG::Instance()->GetParticle(*itPDGPar1)->Mass());
+                itPart1->GetMomentum().Z(), mass1);
             PartTwo.SetXYZM(
                 itPart2->GetMomentum().X(), itPart2->GetMomentum().Y(),
-                itPart2->GetMomentum().Z(),
-                TDatabasePDG::Instance()->GetParticle(*itPDGPar2)->Mass());
+                itPart2->GetMomentum().Z(), mass2);
             float RelativeK = HigherMath->RelativePairMomentum(PartOne, PartTwo);
             if (!HigherMath->PassesPairSelection(HistCounter, *itPart1, *itPart2,
                                                  RelativeK, false, false)) {
@@ -49,6 +49,7 @@ class AliFemtoDreamZVtxMultContainer {
                         AliFemtoDreamBasePart &part2);
   float ComputeDeltaPhi(AliFemtoDreamBasePart &part1,
                         AliFemtoDreamBasePart &part2);
+  double KStarMaxDotLimit(int iPair, double mass1, double mass2) const;
   void SetEvent(std::vector<std::vector<AliFemtoDreamBasePart>> &Particles);
   TString ClassName() {
     return "zVtxMult Container";
@@ -66,7 +67,18 @@ class AliFemtoDreamZVtxMultContainer {
 //  float fDeltaPhiEtaMax;
   float fSummedPtLimit1;
   float fSummedPtLimit2;
-ClassDef(AliFemtoDreamZVtxMultContainer, 4)
+  bool fSkipPairsAboveKStarMax;
+  std::vector<float> fKStarMax;
+  std::vector<double> fKinematics1; //! (E, px, py, pz) of the first particles of the pairs
+  std::vector<double> fKinematics2; //! (E, px, py, pz) of the second particles of the pairs
+  void FillKinematics(std::vector<AliFemtoDreamBasePart> &Particles,
+                      double mass, std::vector<double> &kinematics);
+  static bool AboveDotLimit(const double *kine1, const double *kine2,
+                            double limit) {
+    return kine1[0] * kine2[0] - kine1[1] * kine2[1] - kine1[2] * kine2[2]
+        - kine1[3] * kine2[3] > limit;
+  }
+ClassDef(AliFemtoDreamZVtxMultContainer, 5)
   ;
 };
 
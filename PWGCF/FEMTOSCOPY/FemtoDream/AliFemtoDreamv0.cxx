@@ -151,54 +151,54 @@ void AliFemtoDreamv0::Setv0(const AliFemtoDreamBasePart &posDaughter,
   this->fUse = true;
 
   // track IDs
-  auto IDneg = negDaughter.GetIDTracks();
+  const auto &IDneg = negDaughter.GetIDTracks();
   for (const auto &itID : IDneg) {
     this->SetIDTracks(itID);
   }
-  auto IDpos = posDaughter.GetIDTracks();
+  const auto &IDpos = posDaughter.GetIDTracks();
   for (const auto &itID : IDpos) {
     this->SetIDTracks(itID);
   }
 
   // Phi
-  auto Phineg = negDaughter.GetPhi();
+  const auto &Phineg = negDaughter.GetPhi();
   for (size_t i = 0; i < Phineg.size(); ++i) {
     if (i == 0 && ignoreFirstNeg) continue;
     this->SetPhi(Phineg[i]);
   }
-  auto Phipos = posDaughter.GetPhi();
+  const auto &Phipos = posDaughter.GetPhi();
   for (size_t i = 0; i < Phipos.size(); ++i) {
     if (i == 0 && ignoreFirstPos) continue;
     this->SetPhi(Phipos[i]);
   }
 
   // Eta
-  auto Etaneg = negDaughter.GetEta();
+  const auto &Etaneg = negDaughter.GetEta();
   for (size_t i = 0; i < Etaneg.size(); ++i) {
     if (i == 0 && ignoreFirstNeg) continue;
     this->SetEta(Etaneg[i]);
   }
-  auto Etapos = posDaughter.GetEta();
+  const auto &Etapos = posDaughter.GetEta();
   for (size_t i = 0; i < Etapos.size(); ++i) {
     if (i == 0 && ignoreFirstPos) continue;
     this->SetEta(Etapos[i]);
   }
 
   // Theta
-  auto Thetaneg = negDaughter.GetTheta();
+  const auto &Thetaneg = negDaughter.GetTheta();
   for (size_t i = 0; i < Thetaneg.size(); ++i) {
     if (i == 0 && ignoreFirstNeg) continue;
     this->SetTheta(Thetaneg[i]);
   }
-  auto Thetapos = posDaughter.GetTheta();
+  const auto &Thetapos = posDaughter.GetTheta();
   for (size_t i = 0; i < Thetapos.size(); ++i) {
     if (i == 0 && ignoreFirstPos) continue;
     this->SetTheta(Thetapos[i]);
   }
 
   // Charge
-  auto Chargepos = posDaughter.GetCharge();
-  auto Chargeneg = negDaughter.GetCharge();
+  const auto &Chargepos = posDaughter.GetCharge();
+  const auto &Chargeneg = negDaughter.GetCharge();
   this->SetCharge(Chargepos.at(0) + Chargeneg.at(0));
   for (size_t i = 0; i < Chargeneg.size(); ++i) {
     if (i == 0 && ignoreFirstNeg) continue;
@@ -210,11 +210,11 @@ void AliFemtoDreamv0::Setv0(const AliFemtoDreamBasePart &posDaughter,
   }
 
   // Phi At Radii
-  auto PhiAtRadiineg = negDaughter.GetPhiAtRaidius();
+  const auto &PhiAtRadiineg = negDaughter.GetPhiAtRaidius();
   for (const auto &itPhiAtRadius : PhiAtRadiineg) {
     this->SetPhiAtRadius(itPhiAtRadius);
   }
-  auto PhiAtRadiipos = posDaughter.GetPhiAtRaidius();
+  const auto &PhiAtRadiipos = posDaughter.GetPhiAtRaidius();
   for (const auto &itPhiAtRadius : PhiAtRadiipos) {
     this->SetPhiAtRadius(itPhiAtRadius);
   }
@@ -737,7 +737,7 @@ void AliFemtoDreamv0::Reset() {
     fTheta.clear();
     fMCTheta.clear();
     fPhi.clear();
-    fPhiAtRadius.clear();
+    ClearPhiAtRadius();
     fXYZAtRadius.clear();
     fMCPhi.clear();
     fIDTracks.clear();
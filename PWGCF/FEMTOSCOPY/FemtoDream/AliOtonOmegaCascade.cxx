@@ -410,7 +410,7 @@ void AliOtonOmegaCascade::Reset() {
     fTheta.clear();
     fMCTheta.clear();
     fPhi.clear();
-    fPhiAtRadius.clear();
+    ClearPhiAtRadius();
     fMCPhi.clear();
     fIDTracks.clear();
     fCharge.clear();
@@ -73,6 +73,7 @@ ClassImp(AliAnalysisTaskTwoPwrtRP)
     fEPcor(),
     fTracksTPCstandalone(kTRUE),
     fRemoveOutliers(kFALSE),
+    fUseQvectorCorrelations(kFALSE),
     fNevents(0),
     fHistosManager(0x0)
 {
@@ -124,6 +125,7 @@ AliAnalysisTaskTwoPwrtRP::AliAnalysisTaskTwoPwrtRP(const char* name) :
     fEPcor(),
     fTracksTPCstandalone(kTRUE),
     fRemoveOutliers(kFALSE),
+    fUseQvectorCorrelations(kFALSE),
     fNevents(0),
     fHistosManager(0x0)
 {
@@ -598,6 +600,15 @@ void AliAnalysisTaskTwoPwrtRP::UserCreateOutputObjects()
       Float_t cor[AliChargeTwoPwrtRP::N2p][4];
       Float_t qncor[AliChargeOnePwrtRP::Nqvectors][4];
       Int_t it,it2;
+
+      // correlations binned in single track variables only are summed from Q-vectors, the others need the pair loop
+      Bool_t useQvectors[10]={kFALSE};
+      Bool_t needPairLoop=kFALSE;
+      for(Int_t ic=0; ic<fNTwoPwrtRP; ic++){
+        useQvectors[ic]=(fUseQvectorCorrelations&&fChargeCorrelation[ic]->HasSingleTrackBinning());
+        if(!useQvectors[ic]) needPairLoop=kTRUE;
+      }
+
       for(it=0; it<nTracks; it++){
         pt1    =trackMapPtEtaCharge[it][0];
         eta1   =trackMapPtEtaCharge[it][1];
@@ -616,6 +627,16 @@ void AliAnalysisTaskTwoPwrtRP::UserCreateOutputObjects()
           fFlow[ic]->AddTrack( fFlow[ic]->Charge(charge1), trackMapX[it], trackMapY[it]);
         }
 
+        for(Int_t ic=0; ic<fNTwoPwrtRP; ic++){
+          if(!useQvectors[ic]) continue;
+          AliChargeTwoPwrtRP::SetBin(0,Pt1Bin,0,0,Eta1Bin,0,0);
+          fChargeCorrelation[ic]->AddQvectorTrack(fChargeCorrelation[ic]->Bin(), charge1, trackMapPhi[it],
+                                                  f1&(ULong_t(1)<<((UShort_t)(minTwoFlag+ ic))),
+                                                  f1&(ULong_t(1)<<((UShort_t)(diffTwoFlag+ ic))));
+        }
+
+        if(!needPairLoop) continue;
+
 
         for(it2=0; it2<nTracks; it2++){
           if(it==it2) continue;
@@ -700,6 +721,7 @@ void AliAnalysisTaskTwoPwrtRP::UserCreateOutputObjects()
 
 
           for(Int_t ic=0; ic<fNTwoPwrtRP; ic++){
+            if(useQvectors[ic]) continue;
             if((trackMapFlag[it]&(ULong_t(1)<<((UShort_t)(minTwoFlag+ ic))))
                 &&(trackMapFlag[it2]&(ULong_t(1)<<((UShort_t)(diffTwoFlag+ ic))))){
               fChargeCorrelation[ic]->GetTwoParticleCorrelation();
@@ -712,6 +734,8 @@ void AliAnalysisTaskTwoPwrtRP::UserCreateOutputObjects()
         }
         };
 
+        for(Int_t ic=0; ic<fNTwoPwrtRP; ic++) if(useQvectors[ic]) fChargeCorrelation[ic]->FillPairsFromQvectors(Qn);
+
 
         dims[0] = CtBin;
         dimsMax[0] = fNCtbins;
@@ -70,6 +70,7 @@ public:
   void SetTPCtrackcuts(AliCMEAnalysisCuts* cuts) {fTPCtrackcuts=cuts;}
   void SetGlobaltrackcuts(AliCMEAnalysisCuts* cuts) {fGlobaltrackcuts=cuts;}
   void SetRemoveOutliers(Bool_t b=kTRUE) {fRemoveOutliers=b;}
+  void SetUseQvectorCorrelations(Bool_t b=kTRUE) {fUseQvectorCorrelations=b;}  // O(N) Q-vector sums for correlations binned in Ct, 1Pt, 1Eta only
 
   void SetHistogramManager(AliHistogramManager* man) {fHistosManager=man;}
 
@@ -78,6 +79,7 @@ public:
 
   //getters
   Bool_t IsTracksTPCstandalone() const {return fTracksTPCstandalone;}
+  Bool_t IsUseQvectorCorrelations() const {return fUseQvectorCorrelations;}
   TList* GetOutputList() {return &fListHistos; };
   Int_t GetNbinsPt(  )  {return  fNPtbins  ;}
   Int_t GetNbinsEta( )  {return  fNEtabins ;}
@@ -141,6 +143,7 @@ protected:
   AliEventPlaneCorrelations* fEPcor[AliChargeOnePwrtRP::Nqvectors];
   Bool_t fTracksTPCstandalone;
   Bool_t fRemoveOutliers;
+  Bool_t fUseQvectorCorrelations;
   Int_t fNevents;
   AliHistogramManager* fHistosManager;
 
@@ -149,7 +152,7 @@ protected:
 
 
 
-  ClassDef(AliAnalysisTaskTwoPwrtRP, 1);
+  ClassDef(AliAnalysisTaskTwoPwrtRP, 2);
 };
 
 #endif
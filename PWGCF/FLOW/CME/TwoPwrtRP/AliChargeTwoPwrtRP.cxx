@@ -10,6 +10,16 @@ UChar_t AliChargeTwoPwrtRP::fCharge=0;
 UShort_t AliChargeTwoPwrtRP::fBins[]={0};
 Float_t AliChargeTwoPwrtRP::fPair[][2]={{0.}};
 
+namespace {
+  // harmonics of the track Q-vectors (0: multiplicity) and of the self-pair terms
+  const Int_t kNQharmonics = 7;
+  const Int_t kNSelfHarmonics = 4;
+  const Int_t kQharmonics[kNQharmonics] = {0, 1, 2, 3, 4, 6, 8};
+  const Int_t kSelfHarmonics[kNSelfHarmonics] = {0, 2, 4, 8};
+  Int_t QharmonicIndex(Int_t h) {for(Int_t i=0; i<kNQharmonics; i++) if(kQharmonics[i]==h) return i; return -1;}
+  Int_t SelfHarmonicIndex(Int_t h) {for(Int_t i=0; i<kNSelfHarmonics; i++) if(kSelfHarmonics[i]==h) return i; return -1;}
+}
+
 //____________________________________________________________________________
 AliChargeTwoPwrtRP::AliChargeTwoPwrtRP() :
   TObject(),
@@ -43,7 +53,10 @@ AliChargeTwoPwrtRP::AliChargeTwoPwrtRP() :
   fPID2(""),
   fEventPlanes(),
   fXaxisLabel(""),
-  fYaxisLabel("")
+  fYaxisLabel(""),
+  fQ1(),
+  fQ2(),
+  fQ12()
 {
   //fVarNames[0]="1Pt";
   //fVarNames[1]="mPt";
@@ -310,4 +323,100 @@ void AliChargeTwoPwrtRP::Init(TAxis* ax, TAxis* ay, TAxis* az) {
     for(Int_t g=0; g<4; g++) for(Int_t i=0; i<N2p; i++) for(Int_t k=0; k<fNbins; k++) f2pCorrelationShort2[g][i][k] = 0.0;
     for(Int_t g=0; g<4; g++) for(Int_t i=0; i<N3p; i++) for(Int_t j=0; j<AliChargeOnePwrtRP::Nqvectors; j++) for(Int_t k=0; k<fNbins; k++) f3pCorrelationShort2[g][i][j][k] = 0.0;
     for(Int_t g=0; g<4; g++) for(Int_t k=0; k<fNbins; k++) fMult[g][k] = 0;
+    fQ1.assign(fNbins*2*kNQharmonics*2, 0.);
+    fQ2.assign(2*kNQharmonics*2, 0.);
+    fQ12.assign(fNbins*2*kNSelfHarmonics*2, 0.);
+}
+
+//_________________________________________________________________
+  void AliChargeTwoPwrtRP::AddQvectorTrack(Int_t bin, Float_t charge, Float_t phi, Bool_t isTrack1, Bool_t isTrack2){
+    //
+    // Add a track to the Q-vectors of the track 1 and/or track 2 selection
+    // bin: track 1 bin as given by Bin(), charge index 0: +  1: -
+    //
+    if(bin<0||bin>=fNbins) isTrack1=kFALSE;
+    if(!isTrack1&&!isTrack2) return;
+    if(fQ2.empty()) Clear();
+    Int_t ch = (charge==1 ? 0 : 1);
+
+    for(Int_t ih=0; ih<kNQharmonics; ih++){
+      Double_t x = TMath::Cos(kQharmonics[ih]*phi);
+      Double_t y = TMath::Sin(kQharmonics[ih]*phi);
+      if(isTrack1) {Double_t* q = &fQ1[((bin*2+ch)*kNQharmonics+ih)*2]; q[0]+=x; q[1]+=y;}
+      if(isTrack2) {Double_t* q = &fQ2[(ch*kNQharmonics+ih)*2]; q[0]+=x; q[1]+=y;}
+    }
+    if(!isTrack1||!isTrack2) return;
+    for(Int_t ih=0; ih<kNSelfHarmonics; ih++){
+      Double_t* q = &fQ12[((bin*2+ch)*kNSelfHarmonics+ih)*2];
+      q[0]+=TMath::Cos(kSelfHarmonics[ih]*phi);
+      q[1]+=TMath::Sin(kSelfHarmonics[ih]*phi);
+    }
+}
+
+//_________________________________________________________________
+  void AliChargeTwoPwrtRP::PairSum(Int_t bin, Int_t c1, Int_t c2, Int_t a, Int_t b, Double_t &re, Double_t &im) const {
+    //
+    // Sum over pairs of distinct tracks of exp(i(a*phi1+b*phi2)), a>=0
+    // Q1_a*Q2_b minus the tracks paired with themselves (same charge only)
+    //
+    const Double_t* q1 = &fQ1[((bin*2+c1)*kNQharmonics+QharmonicIndex(a))*2];
+    const Double_t* q2 = &fQ2[(c2*kNQharmonics+QharmonicIndex(TMath::Abs(b)))*2];
+    Double_t q2y = (b<0 ? -q2[1] : q2[1]);
+    re = q1[0]*q2[0]-q1[1]*q2y;
+    im = q1[0]*q2y+q1[1]*q2[0];
+    if(c1!=c2) return;
+    const Double_t* s = &fQ12[((bin*2+c1)*kNSelfHarmonics+SelfHarmonicIndex(TMath::Abs(a+b)))*2];
+    re -= s[0];
+    im -= ((a+b)<0 ? -s[1] : s[1]);
+}
+
+//_________________________________________________________________
+  void AliChargeTwoPwrtRP::FillPairsFromQvectors(Float_t Qn[][AliChargeOnePwrtRP::Nqvectors][2]){
+    //
+    // Fill the pair sums of GetTwoParticleCorrelation() for all bins from the Q-vectors
+    // squares via cos^2(x)=(1+cos(2x))/2, e.g. sum cos^2(n(phi1-phi2)) = (M+Re(P(2n,-2n)))/2
+    //
+    if(fQ1.empty()) return;
+    Double_t re, im, re2, im2;
+    Double_t p11[2], p22[2], p44[2], p1m3[2], p2m6[2];
+    for(Int_t bin=0; bin<fNbins; bin++){
+      for(Int_t c1=0; c1<2; c1++){
+        for(Int_t c2=0; c2<2; c2++){
+          PairSum(bin, c1, c2, 0, 0, re, im);
+          Int_t npairs = TMath::Nint(re);
+          if(npairs<=0) continue;
+          Double_t m = npairs;
+          SetCharge(c1==0 ? 1 : -1, c2==0 ? 1 : -1);
+          fMult[fCharge][bin] += npairs;
+
+          for(Int_t n=1; n<=4; n++){
+            PairSum(bin, c1, c2, n, -n, re, im);
+            PairSum(bin, c1, c2, 2*n, -2*n, re2, im2);
+            f2pCorrelationShort[fCharge][n-1][bin]   += re;              // cos(n(phi1-phi2))
+            f2pCorrelationShort2[fCharge][n-1][bin]  += 0.5*(m+re2);
+            f2pCorrelationShort[fCharge][n+3][bin]   += im;              // sin(n(phi1-phi2))
+            f2pCorrelationShort2[fCharge][n+3][bin]  += 0.5*(m-re2);
+          }
+
+          PairSum(bin, c1, c2, 1,  1, p11[0],  p11[1]);
+          PairSum(bin, c1, c2, 2,  2, p22[0],  p22[1]);
+          PairSum(bin, c1, c2, 4,  4, p44[0],  p44[1]);
+          PairSum(bin, c1, c2, 1, -3, p1m3[0], p1m3[1]);
+          PairSum(bin, c1, c2, 2, -6, p2m6[0], p2m6[1]);
+          for(Int_t j=0; j<AliChargeOnePwrtRP::Nqvectors; j++){
+            Double_t x2 = Qn[1][j][0], y2 = Qn[1][j][1];
+            Double_t x4 = Qn[3][j][0], y4 = Qn[3][j][1];
+            // cos(phi1+phi2-2Psi2)
+            f3pCorrelationShort[fCharge][0][j][bin]  += x2*p11[0]+y2*p11[1];
+            f3pCorrelationShort2[fCharge][0][j][bin] += 0.5*(m*(x2*x2+y2*y2)+(x2*x2-y2*y2)*p22[0]+2.*x2*y2*p22[1]);
+            // cos(2(phi1+phi2-2Psi4))
+            f3pCorrelationShort[fCharge][1][j][bin]  += x4*p22[0]+y4*p22[1];
+            f3pCorrelationShort2[fCharge][1][j][bin] += 0.5*(m*(x4*x4+y4*y4)+(x4*x4-y4*y4)*p44[0]+2.*x4*y4*p44[1]);
+            // cos(phi1-3phi2+2Psi2)
+            f3pCorrelationShort[fCharge][2][j][bin]  += x2*p1m3[0]-y2*p1m3[1];
+            f3pCorrelationShort2[fCharge][2][j][bin] += 0.5*(m*(x2*x2+y2*y2)+(x2*x2-y2*y2)*p2m6[0]-2.*x2*y2*p2m6[1]);
+          }
+        }
+      }
+    }
 }
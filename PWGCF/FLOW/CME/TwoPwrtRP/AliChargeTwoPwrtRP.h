@@ -3,6 +3,7 @@
 #ifndef ALICHARGETWOPWRTRP_H
 #define ALICHARGETWOPWRTRP_H
 
+#include <vector>
 #include <TMath.h>
 #include <THn.h>
 #include <TProfile.h>
@@ -49,6 +50,10 @@ class AliChargeTwoPwrtRP : public TObject {
   //void GetTwoParticleCorrelation(Int_t bin, Int_t charge, Float_t c[7][4], Float_t c2[7][4]);
   //void GetTwoParticleCorrelation(Int_t bin, Int_t charge, Float_t c[N2p+N3p][2]);
   void GetTwoParticleCorrelation();
+  // pair sums from per-event Q-vectors instead of the pair loop, only for binning in single track variables (Ct, 1Pt, 1Eta)
+  Bool_t HasSingleTrackBinning() const {return IsSingleTrackVar(fTrackVarX)&&IsSingleTrackVar(fTrackVarY)&&IsSingleTrackVar(fTrackVarZ);}
+  void AddQvectorTrack(Int_t bin, Float_t charge, Float_t phi, Bool_t isTrack1, Bool_t isTrack2);
+  void FillPairsFromQvectors(Float_t Qn[][AliChargeOnePwrtRP::Nqvectors][2]);
   void GetRPcorrelations(Int_t bin, Int_t charge, AliQnCorrectionsQnVector* QvecPsi);
   void GetRPCorrelations(Int_t bin, Int_t charge, Float_t* Qx, Float_t* Qy, Int_t n, Int_t m, Int_t k, Int_t factor1, Int_t factor2, Int_t cor, Int_t holder);
   //Short_t Charge(Int_t ch1, Int_t ch2) {if(ch1==1) {if(ch2==1) return 0; else return 2;} else {if(ch2==1) return 3; else return 1;}} // 0: ++   1: --   2: +-   3: -+
@@ -118,6 +123,9 @@ class AliChargeTwoPwrtRP : public TObject {
 
 
  private:
+  static Bool_t IsSingleTrackVar(Int_t var) {return (var==0||var==1||var==4);} // 0: Ct, 1: 1Pt, 4: 1Eta
+  void PairSum(Int_t bin, Int_t c1, Int_t c2, Int_t a, Int_t b, Double_t &re, Double_t &im) const;
+
   Int_t* fMult[4];
   Float_t* f2pCorrelationShort[4][N2p];
   Float_t* f2pCorrelationShort2[4][N2p];
@@ -154,10 +162,14 @@ class AliChargeTwoPwrtRP : public TObject {
   TString fXaxisLabel;
   TString fYaxisLabel;
 
+  std::vector<Double_t> fQ1;     //! track 1 Q-vectors [bin][charge][harmonic][x,y]
+  std::vector<Double_t> fQ2;     //! track 2 Q-vectors [charge][harmonic][x,y]
+  std::vector<Double_t> fQ12;    //! tracks passing both cuts, for the self-pair terms [bin][charge][harmonic][x,y]
+
   AliChargeTwoPwrtRP(const AliChargeTwoPwrtRP &c);
   AliChargeTwoPwrtRP& operator= (const AliChargeTwoPwrtRP &c);
 
-  ClassDef(AliChargeTwoPwrtRP, 1);
+  ClassDef(AliChargeTwoPwrtRP, 2);
 };
 
 
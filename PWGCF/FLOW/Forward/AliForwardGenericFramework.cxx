@@ -5,6 +5,7 @@
 #include "AliForwardSettings.h"
 #include "TH1D.h"
 #include <complex>
+#include <algorithm>
 #include <cmath>
 #include "TFile.h"
 
@@ -16,6 +17,11 @@ AliForwardGenericFramework::AliForwardGenericFramework(Int_t refbins):
   fQvector(),
   fpvector(),
   fqvector(),
+  fQdense(),
+  fpdense(),
+  fqdense(),
+  fNRefEtaBins(refbins),
+  fNDiffEtaBins(0),
   cumu_rW2(),
   cumu_rW2Two(),
   cumu_rW4(),
@@ -52,6 +58,11 @@ AliForwardGenericFramework::AliForwardGenericFramework(Int_t refbins):
   fpvector = new THnD("pvector", "pvector", dimensions, dbins, dxmin, dxmax);
   fqvector = new THnD("qvector", "qvector", dimensions, dbins, dxmin, dxmax);
 
+  fNDiffEtaBins = fpvector->GetAxis(3)->GetNbins();
+  fQdense.assign(DenseBin(4, 0, 0, 0, fNRefEtaBins), 0.);
+  fpdense.assign(DenseBin(4, 0, 0, 0, fNDiffEtaBins), 0.);
+  fqdense.assign(DenseBin(4, 0, 0, 0, fNDiffEtaBins), 0.);
+
   fAutoRef =  new TH1D("fAutoRef", "fAutoRef", refbins, fSettings.fEtaLowEdge, fSettings.fEtaUpEdge);
   fAutoDiff = new TH1D("fAutoDiff","fAutoDiff", fSettings.fNDiffEtaBins, fSettings.fEtaLowEdge, fSettings.fEtaUpEdge);
   fAutoRef->SetDirectory(0);
@@ -74,6 +85,10 @@ void AliForwardGenericFramework::CumulantsAccumulate(TH2D*& dNdetadphi, double c
     Double_t refEtaBin = fQvector->GetAxis(3)->FindBin(eta);
     Double_t refEta = fQvector->GetAxis(3)->GetBinCenter(refEtaBin);
 
+    // Bins of the Q-vector arrays, as THn::Fill would find them
+    Int_t difBin = fpvector->GetAxis(3)->FindBin(difEta);
+    Int_t refBin = fQvector->GetAxis(3)->FindBin(refEta);
+
     for (Int_t phiBin = 1; phiBin <= dNdetadphi->GetNbinsY(); phiBin++) {//
       /*
       if (useFMD & fSettings.makeFakeHoles){
@@ -109,22 +124,24 @@ void AliForwardGenericFramework::CumulantsAccumulate(TH2D*& dNdetadphi, double c
           }
         }
         
+        Double_t cosnphi = TMath::Cos(n*phi);
+        Double_t sinnphi = TMath::Sin(n*phi);
         for (Int_t p = 1; p <= 4; p++) {
-          Double_t realPart = TMath::Power(weight_n, p)*TMath::Cos(n*phi);
-          Double_t imPart =   TMath::Power(weight_n, p)*TMath::Sin(n*phi);
+          Double_t realPart = TMath::Power(weight_n, p)*cosnphi;
+          Double_t imPart =   TMath::Power(weight_n, p)*sinnphi;
 
-          Double_t re[4] = {0.5, Double_t(n), Double_t(p), difEta};
-          Double_t im[4] = {-0.5, Double_t(n), Double_t(p), difEta};
+          Long64_t re = DenseBin(2, n+1, p, difBin, fNDiffEtaBins);
+          Long64_t im = DenseBin(1, n+1, p, difBin, fNDiffEtaBins);
 
           if (doDiffFlow){
-            fpvector->Fill(re, realPart);
-            fpvector->Fill(im, imPart);
+            fpdense[re] += realPart;
+            fpdense[im] += imPart;
 
             if ((useFMD & !(fSettings.etagap)) ||
                 (!(useFMD) && (fSettings.ref_mode & fSettings.kTPCref)) ||
                 (useFMD && (fSettings.ref_mode & fSettings.kFMDref))) {
-              fqvector->Fill(re, realPart);
-              fqvector->Fill(im, imPart);
+              fqdense[re] += realPart;
+              fqdense[im] += imPart;
               if ((weight_n > 1.0) & !fSettings.etagap) fAutoDiff->Fill(refEta,weight*(weight - 1));
             }
           }
@@ -140,11 +157,9 @@ void AliForwardGenericFramework::CumulantsAccumulate(TH2D*& dNdetadphi, double c
               if (TMath::Abs(eta) > fSettings.fmdhighcut) continue;
             }
 
-            Double_t req[4] = {0.5, static_cast<Double_t>(n), static_cast<Double_t>(p), refEta};
-            Double_t imq[4] = {-0.5, static_cast<Double_t>(n), static_cast<Double_t>(p), refEta};
             if ((weight_n > 1.0) & !fSettings.etagap) fAutoRef->Fill(refEta,weight*(weight - 1));  
-            fQvector->Fill(req, realPart);
-            fQvector->Fill(imq, imPart);
+            fQdense[DenseBin(2, n+1, p, refBin, fNRefEtaBins)] += realPart;
+            fQdense[DenseBin(1, n+1, p, refBin, fNRefEtaBins)] += imPart;
           }
         } // end p loop
       } // End of n loop
@@ -180,8 +195,7 @@ void AliForwardGenericFramework::saveEvent(double cent, double zvertex,UInt_t r,
       }
 
       // index to get sum of weights
-      Int_t index1[4] = {2, 1, 1, refEtaBinB};
-      if (!(fQvector->GetBinContent(index1) > 0)) continue;
+      if (!(DenseContent(fQdense, DenseBin(2, 1, 1, refEtaBinB, fNRefEtaBins)) > 0)) continue;
       // REFERENCE FLOW --------------------------------------------------------------------------------
       if (prevRefEtaBin & (prevbin != refEtaBinB)){ // only used once
 
@@ -277,30 +291,30 @@ TComplex AliForwardGenericFramework::Q(Int_t n, Int_t p, Int_t etabin)
 {
   double sign = (n < 0) ? -1 : 1;
 
-  Int_t imindex[4] = {1, TMath::Abs(n)+1, p, etabin};
-  Int_t reindex[4] = {2, TMath::Abs(n)+1, p, etabin};
+  Long64_t imindex = DenseBin(1, TMath::Abs(n)+1, p, etabin, fNRefEtaBins);
+  Long64_t reindex = DenseBin(2, TMath::Abs(n)+1, p, etabin, fNRefEtaBins);
 
-  return TComplex(fQvector->GetBinContent(reindex),sign*fQvector->GetBinContent(imindex));;
+  return TComplex(DenseContent(fQdense, reindex),sign*DenseContent(fQdense, imindex));;
 }
 
 TComplex AliForwardGenericFramework::p(Int_t n, Int_t p, Int_t etabin)
 {
   double sign = (n > 0) ? 1 : ((n < 0) ? -1 : 1);
 
-  Int_t imindex[4] = {1, TMath::Abs(n)+1, p, etabin};
-  Int_t reindex[4] = {2, TMath::Abs(n)+1, p, etabin};
+  Long64_t imindex = DenseBin(1, TMath::Abs(n)+1, p, etabin, fNDiffEtaBins);
+  Long64_t reindex = DenseBin(2, TMath::Abs(n)+1, p, etabin, fNDiffEtaBins);
 
-  return TComplex(fpvector->GetBinContent(reindex),sign*fpvector->GetBinContent(imindex));;
+  return TComplex(DenseContent(fpdense, reindex),sign*DenseContent(fpdense, imindex));;
 }
 
 
 TComplex AliForwardGenericFramework::q(Int_t n, Int_t p, Int_t etabin)
 {
   double sign = (n > 0) ? 1 : ((n < 0) ? -1 : 1);
-  Int_t imindex[4] = {1, TMath::Abs(n)+1, p, etabin};
-  Int_t reindex[4] = {2, TMath::Abs(n)+1, p, etabin};
+  Long64_t imindex = DenseBin(1, TMath::Abs(n)+1, p, etabin, fNDiffEtaBins);
+  Long64_t reindex = DenseBin(2, TMath::Abs(n)+1, p, etabin, fNDiffEtaBins);
 
-  return TComplex(fqvector->GetBinContent(reindex),sign*fqvector->GetBinContent(imindex));;
+  return TComplex(DenseContent(fqdense, reindex),sign*DenseContent(fqdense, imindex));;
 }
 
 
@@ -381,9 +395,9 @@ TComplex AliForwardGenericFramework::FourDiff_SC(Int_t n1, Int_t n2, Int_t n3, I
 }
 
 void AliForwardGenericFramework::reset() {
-  fQvector->Reset();
-  fpvector->Reset();
-  fqvector->Reset();
+  std::fill(fQdense.begin(), fQdense.end(), 0.);
+  std::fill(fpdense.begin(), fpdense.end(), 0.);
+  std::fill(fqdense.begin(), fqdense.end(), 0.);
   fAutoRef->Reset();
   fAutoDiff->Reset();
 }
@@ -26,6 +26,7 @@
 #include "AliForwardSettings.h"
 #include "AliForwardNUATask.h"
 #include <iostream>
+#include <vector>
 
 /**
  * Class to handle cumulant calculations.
@@ -72,9 +73,36 @@ public:
 
   TH1D* fAutoDiff;//!     // Accumulated reference particles
   TH1D* fAutoRef;//!     // Accumulated reference particles
-  THnD* fQvector;//!     // Accumulated reference particles
-  THnD* fpvector;//!    // Accumulated differential particles
-  THnD* fqvector;//!    // Accumulated differential particles
+  THnD* fQvector;//!     // Binning of reference particles
+  THnD* fpvector;//!    // Binning of differential particles
+  THnD* fqvector;//!    // Binning of differential particles
+
+  // The per event Q-vectors are accumulated in flat arrays with the
+  // layout of the THnDs above (kind, n, p, eta, including under- and
+  // overflow bins), using the same linear bin number as THn.  This
+  // avoids the coordinate lookups of THn::Fill and THn::GetBinContent
+  // for each phi bin and each term of the cumulant formulas.
+  std::vector<Double_t> fQdense;//!  // Accumulated reference particles
+  std::vector<Double_t> fpdense;//!  // Accumulated differential particles
+  std::vector<Double_t> fqdense;//!  // Accumulated differential particles
+  Int_t fNRefEtaBins;//!  // Number of eta bins of fQvector
+  Int_t fNDiffEtaBins;//! // Number of eta bins of fpvector and fqvector
+
+  /**
+   * Linear bin of the Q-vector arrays
+   *
+   * @param kind  1 for imaginary, 2 for real part
+   * @param n     Harmonic bin (n+1)
+   * @param p     Power bin (p)
+   * @param eta   Eta bin
+   * @param nEta  Number of eta bins
+   */
+  static Long64_t DenseBin(Int_t kind, Int_t n, Int_t p, Int_t eta, Int_t nEta) {
+    return eta + Long64_t(nEta+2)*(p + 6*(n + 8*kind));
+  }
+  static Double_t DenseContent(const std::vector<Double_t>& v, Long64_t bin) {
+    return bin < Long64_t(v.size()) ? v[bin] : 0.;
+  }
 
   TComplex Q(Int_t n, Int_t p, Int_t etaBin);
   TComplex p(Int_t n, Int_t p, Int_t etaBin);
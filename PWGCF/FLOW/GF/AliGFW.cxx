@@ -8,7 +8,8 @@ If used, modified, or distributed, please aknowledge the author of this code.
 
 #include "AliGFW.h"
 AliGFW::AliGFW():
-  fInitialized(kFALSE)
+  fInitialized(kFALSE),
+  fUseCache(kTRUE)
 {
 };
 
@@ -94,11 +95,31 @@ Int_t AliGFW::CreateRegions() {
 void AliGFW::Fill(Double_t eta, Int_t ptin, Double_t phi, Double_t weight, Int_t mask, Double_t SecondWeight) {
   if(!fInitialized) CreateRegions();
   if(!fInitialized) return;
+  if(!fCorrCache.empty()) fCorrCache.clear(); //Q-vectors change, so the calculated correlators are not valid anymore
   for(Int_t i=0;i<(Int_t)fRegions.size();++i) {
     if(fRegions.at(i).EtaMin<eta && fRegions.at(i).EtaMax>eta && (fRegions.at(i).BitMask&mask))
       fCumulants.at(i).FillArray(eta,ptin,phi,weight,SecondWeight);
   };
 };
+void AliGFW::Fill(Int_t nTracks, const Double_t *eta, const Int_t *ptin, const Double_t *phi, const Double_t *weight, const Int_t *mask, const Double_t *SecondWeight) {
+  if(!fInitialized) CreateRegions();
+  if(!fInitialized) return;
+  if(!fCorrCache.empty()) fCorrCache.clear();
+  for(Int_t i=0;i<(Int_t)fRegions.size();++i) {
+    fSelPhi.clear();
+    fSelPt.clear();
+    fSelWeight.clear();
+    fSelSecondWeight.clear();
+    for(Int_t j=0;j<nTracks;j++) {
+      if(!(fRegions.at(i).EtaMin<eta[j] && fRegions.at(i).EtaMax>eta[j] && (fRegions.at(i).BitMask&mask[j]))) continue;
+      fSelPhi.push_back(phi[j]);
+      fSelPt.push_back(ptin[j]);
+      fSelWeight.push_back(weight[j]);
+      fSelSecondWeight.push_back(SecondWeight?SecondWeight[j]:-1);
+    };
+    fCumulants.at(i).FillArray((Int_t)fSelPhi.size(),fSelPhi.data(),fSelPt.data(),fSelWeight.data(),SecondWeight?fSelSecondWeight.data():0);
+  };
+};
 TComplex AliGFW::TwoRec(Int_t n1, Int_t n2, Int_t p1, Int_t p2, Int_t ptbin, AliGFWCumulant *r1, AliGFWCumulant *r2, AliGFWCumulant *r3) {
   TComplex part1 = r1->Vec(n1,p1,ptbin);
   TComplex part2 = r2->Vec(n2,p2,ptbin);
@@ -107,10 +128,26 @@ TComplex AliGFW::TwoRec(Int_t n1, Int_t n2, Int_t p1, Int_t p2, Int_t ptbin, Ali
   return formula;
 };
 TComplex AliGFW::RecursiveCorr(AliGFWCumulant *qpoi, AliGFWCumulant *qref, AliGFWCumulant *qol, Int_t ptbin, vector<Int_t> &hars) {
-  vector<Int_t> pows;
-  for(Int_t i=0; i<(Int_t)hars.size(); i++)
-    pows.push_back(1);
-  return RecursiveCorr(qpoi, qref, qol, ptbin, hars, pows);
+  fPowBuffer.assign(hars.size(),1);
+  return fUseCache?CachedCorr(qpoi, qref, qol, ptbin, hars, fPowBuffer):RecursiveCorr(qpoi, qref, qol, ptbin, hars, fPowBuffer);
+};
+TComplex AliGFW::CachedCorr(AliGFWCumulant *qpoi, AliGFWCumulant *qref, AliGFWCumulant *qol, Int_t ptbin, vector<Int_t> &hars, vector<Int_t> &pows) {
+  //Single- and two-particle terms are cheaper to recalculate than to look up
+  if(hars.size()<3) return RecursiveCorr(qpoi, qref, qol, ptbin, hars, pows);
+  const AliGFWCumulant *first = fCumulants.data();
+  fCorrKey.clear();
+  fCorrKey.push_back(qpoi-first);
+  fCorrKey.push_back(qref-first);
+  fCorrKey.push_back(qol?(qol-first):-1);
+  fCorrKey.push_back(ptbin);
+  fCorrKey.insert(fCorrKey.end(),hars.begin(),hars.end());
+  fCorrKey.insert(fCorrKey.end(),pows.begin(),pows.end());
+  auto found = fCorrCache.find(fCorrKey);
+  if(found!=fCorrCache.end()) return found->second;
+  vector<Int_t> key(fCorrKey); //fCorrKey is overwritten in the recursion
+  TComplex val = RecursiveCorr(qpoi, qref, qol, ptbin, hars, pows);
+  fCorrCache.emplace(std::move(key),val);
+  return val;
 };
 
 TComplex AliGFW::RecursiveCorr(AliGFWCumulant *qpoi, AliGFWCumulant *qref, AliGFWCumulant *qol, Int_t ptbin, vector<Int_t> &hars, vector<Int_t> &pows) {
@@ -122,7 +159,7 @@ TComplex AliGFW::RecursiveCorr(AliGFWCumulant *qpoi, AliGFWCumulant *qref, AliGF
   Int_t powlast=pows.at(pows.size()-1);
   hars.erase(hars.end()-1);
   pows.erase(pows.end()-1);
-  TComplex formula = RecursiveCorr(qpoi, qref, qol, ptbin, hars, pows)*qref->Vec(harlast,powlast);
+  TComplex formula = (fUseCache?CachedCorr(qpoi, qref, qol, ptbin, hars, pows):RecursiveCorr(qpoi, qref, qol, ptbin, hars, pows))*qref->Vec(harlast,powlast);
   Int_t lDegeneracy=1;
   Int_t harSize = (Int_t)hars.size();
   for(Int_t i=harSize-1;i>=0;i--) {
@@ -140,7 +177,7 @@ TComplex AliGFW::RecursiveCorr(AliGFWCumulant *qpoi, AliGFWCumulant *qref, AliGF
     //Otherwise, if we are not working with the 1st entry (dif.), then overlap will always be from qref
     //One should thus (probably) make a check if i=0, then qovl=qpoi, otherwise qovl=qref. But need to think more
     //-- This is not aplicable anymore, since the overlap is explicitly specified
-    TComplex subtractVal = RecursiveCorr(qpoi, qref, qol, ptbin, hars, pows);
+    TComplex subtractVal = fUseCache?CachedCorr(qpoi, qref, qol, ptbin, hars, pows):RecursiveCorr(qpoi, qref, qol, ptbin, hars, pows);
     if(lDegeneracy>1) { subtractVal *= lDegeneracy; lDegeneracy=1; };
     formula-=subtractVal;
     hars.at(i)-=harlast;
@@ -155,6 +192,7 @@ void AliGFW::Clear() {
   for(auto ptr = fCumulants.begin(); ptr!=fCumulants.end(); ++ptr) ptr->ResetQs();
   fCalculatedNames.clear();
   fCalculatedQs.clear();
+  fCorrCache.clear();
 };
 TComplex AliGFW::Calculate(TString config, Bool_t SetHarmsToZero) {
   if(config.EqualTo("")) {
@@ -291,7 +329,7 @@ TComplex AliGFW::Calculate(Int_t poi, Int_t ref, vector<Int_t> hars, Int_t ptbin
   AliGFWCumulant *qovl = qpoi;
   return RecursiveCorr(qpoi, qref, qovl, ptbin, hars);
 };
-// TComplex AliGFW::Calculate(CorrConfig corconf, Int_t ptbin, Bool_t SetHarmsToZero, Bool_t DisableOverlap) {
+// TComplex AliGFW::Calculate(const CorrConfig &corconf, Int_t ptbin, Bool_t SetHarmsToZero, Bool_t DisableOverlap) {
 //    vector<Int_t> ptbins;
 //    for(Int_t i=0;i<(Int_t)corconf.size();i++) ptbins.push_back(ptbin);
 //    return Calculate(corconf,ptbins,SetHarmsToZero,DisableOverlap);
@@ -324,8 +362,10 @@ TComplex AliGFW::Calculate(CorrConfig corconf, Int_t ptbin, Bool_t SetHarmsToZer
     if(ovl > -1) //if overlap is defined, then (unless it's explicitly disabled)
       qovl = DisableOverlap?0:&fCumulants.at(ovl);
     else if(ref==poi) qovl = qref; //If ref and poi are the same, then the same is for overlap. Only, when OL not explicitly defined
-    if(SetHarmsToZero) for(Int_t j=0;j<(Int_t)corconf.Hars.at(i).size();j++) corconf.Hars.at(i).at(j) = 0;
-    retval *= RecursiveCorr(qpoi, qref, qovl, ptInd, corconf.Hars.at(i));
+    //the recursion modifies (and restores) the harmonics, so work on a copy; no allocation once the buffer is large enough
+    fHarBuffer.assign(corconf.Hars.at(i).begin(),corconf.Hars.at(i).end());
+    if(SetHarmsToZero) std::fill(fHarBuffer.begin(),fHarBuffer.end(),0);
+    retval *= RecursiveCorr(qpoi, qref, qovl, ptInd, fHarBuffer);
   }
   return retval;
 };
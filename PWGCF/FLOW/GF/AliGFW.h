@@ -11,6 +11,7 @@ If used, modified, or distributed, please aknowledge the author of this code.
 #include <vector>
 #include <utility>
 #include <algorithm>
+#include <unordered_map>
 #include "TString.h"
 #include "TObjArray.h"
 using std::vector;
@@ -63,11 +64,13 @@ class AliGFW {
   void AddRegion(TString refName, Int_t lNhar, Int_t *lNparVec, Double_t lEtaMin, Double_t lEtaMax, Int_t lNpT=1, Int_t BitMask=1);
   Int_t CreateRegions();
   void Fill(Double_t eta, Int_t ptin, Double_t phi, Double_t weight, Int_t mask, Double_t secondWeight=-1);
+  void Fill(Int_t nTracks, const Double_t *eta, const Int_t *ptin, const Double_t *phi, const Double_t *weight, const Int_t *mask, const Double_t *secondWeight=0); //Fill the whole event at once
   void Clear();// { for(auto ptr = fCumulants.begin(); ptr!=fCumulants.end(); ++ptr) ptr->ResetQs(); };
   AliGFWCumulant GetCumulant(Int_t index) { return fCumulants.at(index); };
   TComplex Calculate(TString config, Bool_t SetHarmsToZero=kFALSE);
   CorrConfig GetCorrelatorConfig(TString config, TString head = "", Bool_t ptdif=kFALSE);
-  TComplex Calculate(CorrConfig corconf, Int_t ptbin, Bool_t SetHarmsToZero, Bool_t DisableOverlap=kFALSE);
+  TComplex Calculate(const CorrConfig &corconf, Int_t ptbin, Bool_t SetHarmsToZero, Bool_t DisableOverlap=kFALSE);
+  void SetUseCorrelatorCache(Bool_t newval=kTRUE) { fUseCache = newval; fCorrCache.clear(); };
   // TComplex Calculate(CorrConfig corconf, vector<Int_t> ptbins, Bool_t SetHarmsToZero, Bool_t DisableOverlap=kFALSE);
  private:
   Bool_t fInitialized;
@@ -76,6 +79,25 @@ class AliGFW {
   TComplex TwoRec(Int_t n1, Int_t n2, Int_t p1, Int_t p2, Int_t ptbin, AliGFWCumulant*, AliGFWCumulant*, AliGFWCumulant*);
   TComplex RecursiveCorr(AliGFWCumulant *qpoi, AliGFWCumulant *qref, AliGFWCumulant *qol, Int_t ptbin, vector<Int_t> &hars, vector<Int_t> &pows); //POI, Ref. flow, overlapping region
   TComplex RecursiveCorr(AliGFWCumulant *qpoi, AliGFWCumulant *qref, AliGFWCumulant *qol, Int_t ptbin, vector<Int_t> &hars); //POI, Ref. flow, overlapping region
+  TComplex CachedCorr(AliGFWCumulant *qpoi, AliGFWCumulant *qref, AliGFWCumulant *qol, Int_t ptbin, vector<Int_t> &hars, vector<Int_t> &pows); //Same as RecursiveCorr, but memoized for the current event
+  //Cache of (sub)correlators calculated in the current event. Key: region indices, pT bin, harmonics and powers
+  struct CorrKeyHash {
+    size_t operator()(const vector<Int_t> &key) const {
+      size_t h = key.size();
+      for(auto k: key) h ^= (size_t)(k+0x9e3779b9) + (h<<6) + (h>>2);
+      return h;
+    };
+  };
+  Bool_t fUseCache; //! Memoize the subterms of the correlators, reset in Clear()
+  std::unordered_map<vector<Int_t>, TComplex, CorrKeyHash> fCorrCache; //! Calculated (sub)correlators
+  vector<Int_t> fCorrKey; //! Buffer for building the cache keys
+  vector<Int_t> fHarBuffer; //! Buffer for the harmonics of one subevent
+  vector<Int_t> fPowBuffer; //! Buffer for the powers of one subevent
+  //Tracks selected for one region in the batch fill
+  vector<Double_t> fSelPhi; //!
+  vector<Int_t> fSelPt; //!
+  vector<Double_t> fSelWeight; //!
+  vector<Double_t> fSelSecondWeight; //!
   //Deprecated and not used (for now):
   void AddRegion(Region inreg) { fRegions.push_back(inreg); };
   Region GetRegion(Int_t index) { return fRegions.at(index); };
@@ -47,6 +47,83 @@ void AliGFWCumulant::FillArray(Double_t eta, Int_t ptin, Double_t phi, Double_t
   };
   Inc();
 };
+void AliGFWCumulant::FillArray(Int_t nTracks, const Double_t *phi, const Int_t *ptin, const Double_t *weight, const Double_t *SecondWeight) {
+  //Same as filling the tracks one by one, but harmonics are obtained with the angle-addition recursion
+  //cos((n+1)phi) = cos(n phi)cos(phi) - sin(n phi)sin(phi) instead of calling sin/cos for each of them. The loops over
+  //tracks have no dependencies, so that they can be vectorized. Results are summed in a contiguous array and added to Q-vectors at the end
+  if(nTracks<=0) return;
+  if(!fInitialized)
+    CreateComplexVectorArray(1,1,1);
+  Int_t nPowTot=0;
+  for(Int_t lN=0;lN<fN;lN++) nPowTot+=PW(lN);
+  fBatchQ.assign(2*nPowTot*fPt,0.);
+  fBatchCos1.resize(nTracks);
+  fBatchSin1.resize(nTracks);
+  fBatchCos.resize(nTracks);
+  fBatchSin.resize(nTracks);
+  fBatchPref.resize(nTracks);
+  Double_t *c1 = fBatchCos1.data(), *s1 = fBatchSin1.data();
+  Double_t *cn = fBatchCos.data(), *sn = fBatchSin.data(), *pref = fBatchPref.data();
+  for(Int_t i=0;i<nTracks;i++) {
+    c1[i] = TMath::Cos(phi[i]);
+    s1[i] = TMath::Sin(phi[i]);
+  };
+  //pt bins: if one bin, then fill all the tracks there; otherwise, skip tracks out of range
+  for(Int_t i=0;i<nTracks;i++) {
+    Int_t lPt = (fPt==1)?0:ptin[i];
+    if(lPt<0 || lPt>=fPt) continue;
+    fFilledPts[lPt] = kTRUE;
+    Inc();
+  };
+  Int_t lOffset=0;
+  for(Int_t lN=0; lN<fN; lN++) {
+    if(lN==0) {
+      for(Int_t i=0;i<nTracks;i++) { cn[i]=1.; sn[i]=0.; };
+    } else if(lN==1) {
+      for(Int_t i=0;i<nTracks;i++) { cn[i]=c1[i]; sn[i]=s1[i]; };
+    } else {
+      for(Int_t i=0;i<nTracks;i++) {
+        Double_t lCos = cn[i]*c1[i] - sn[i]*s1[i];
+        sn[i] = sn[i]*c1[i] + cn[i]*s1[i];
+        cn[i] = lCos;
+      };
+    };
+    for(Int_t lPow=0; lPow<PW(lN); lPow++) {
+      //Prefactors: weight^lPow, or SecondWeight^(lPow-1)*weight if second weight is specified (see the single-track FillArray)
+      if(lPow==0)      for(Int_t i=0;i<nTracks;i++) pref[i] = 1.;
+      else if(lPow==1) for(Int_t i=0;i<nTracks;i++) pref[i] = weight[i];
+      else             for(Int_t i=0;i<nTracks;i++) pref[i] *= (SecondWeight && SecondWeight[i]>0)?SecondWeight[i]:weight[i];
+      Double_t *lQ = fBatchQ.data() + 2*(lOffset+lPow);
+      if(fPt==1) {
+        Double_t lRe=0, lIm=0;
+        for(Int_t i=0;i<nTracks;i++) {
+          lRe += pref[i]*cn[i];
+          lIm += pref[i]*sn[i];
+        };
+        lQ[0]+=lRe;
+        lQ[1]+=lIm;
+      } else {
+        for(Int_t i=0;i<nTracks;i++) {
+          if(ptin[i]<0 || ptin[i]>=fPt) continue;
+          Double_t *lQpt = lQ + 2*nPowTot*ptin[i];
+          lQpt[0] += pref[i]*cn[i];
+          lQpt[1] += pref[i]*sn[i];
+        };
+      };
+    };
+    lOffset+=PW(lN);
+  };
+  for(Int_t lPt=0;lPt<fPt;lPt++) {
+    if(!fFilledPts[lPt]) continue;
+    const Double_t *lQ = fBatchQ.data() + 2*nPowTot*lPt;
+    for(Int_t lN=0;lN<fN;lN++) {
+      for(Int_t lPow=0;lPow<PW(lN);lPow++) {
+        fQvector[lPt][lN][lPow](fQvector[lPt][lN][lPow].Re()+lQ[0],fQvector[lPt][lN][lPow].Im()+lQ[1]);
+        lQ+=2;
+      };
+    };
+  };
+};
 void AliGFWCumulant::ResetQs() {
   if(!fNEntries) return; //If 0 entries, then no need to reset. Otherwise, if -1, then just initialized and need to set to 0.
   for(Int_t i=0; i<fPt; i++) {
@@ -18,6 +18,7 @@ class AliGFWCumulant {
   ~AliGFWCumulant();
   void ResetQs();
   void FillArray(Double_t eta, Int_t ptin, Double_t phi, Double_t weight=1, Double_t SecondWeight=-1);
+  void FillArray(Int_t nTracks, const Double_t *phi, const Int_t *ptin, const Double_t *weight, const Double_t *SecondWeight=0); //Batch fill for a whole event
   enum UsedFlags_t {kBlank = 0, kFull=1, kPt=2};
   void SetType(UInt_t infl) { DestroyComplexVectorArray(); fUsed = infl; };
   void Inc() { fNEntries++; };
@@ -39,6 +40,13 @@ class AliGFWCumulant {
   Int_t PW(Int_t ind) { return fPowVec.at(ind); }; //No checks to speed up, be carefull!!!
   void DestroyComplexVectorArray();
   Bool_t IsPtBinFilled(Int_t ptb);
+  //Buffers for the batch fill: per-track cos(n*phi), sin(n*phi) and weight prefactors, and the accumulated Q-vectors as (re,im) pairs
+  vector<Double_t> fBatchCos1; //!
+  vector<Double_t> fBatchSin1; //!
+  vector<Double_t> fBatchCos; //!
+  vector<Double_t> fBatchSin; //!
+  vector<Double_t> fBatchPref; //!
+  vector<Double_t> fBatchQ; //!
 };
 
 #endif
@@ -13,7 +13,10 @@ AliProfileBS::AliProfileBS():
   fNSubs(0),
   fMultiRebin(0),
   fMultiRebinEdges(0),
-  fPresetWeights(0)
+  fPresetWeights(0),
+  fCompactSubs(kFALSE),
+  fSubSums(),
+  fSubEntries()
 {
 };
 AliProfileBS::~AliProfileBS() {
@@ -26,7 +29,10 @@ AliProfileBS::AliProfileBS(const char* name, const char* title, Int_t nbinsx, co
   fNSubs(0),
   fMultiRebin(0),
   fMultiRebinEdges(0),
-  fPresetWeights(0)
+  fPresetWeights(0),
+  fCompactSubs(kFALSE),
+  fSubSums(),
+  fSubEntries()
 {};
 AliProfileBS::AliProfileBS(const char* name, const char* title, Int_t nbinsx, Double_t xlow, Double_t xup):
   TProfile(name,title,nbinsx,xlow,xup),
@@ -35,11 +41,26 @@ AliProfileBS::AliProfileBS(const char* name, const char* title, Int_t nbinsx, Do
   fNSubs(0),
   fMultiRebin(0),
   fMultiRebinEdges(0),
-  fPresetWeights(0)
+  fPresetWeights(0),
+  fCompactSubs(kFALSE),
+  fSubSums(),
+  fSubEntries()
 {};
-void AliProfileBS::InitializeSubsamples(Int_t nSub) {
+void AliProfileBS::InitializeSubsamples(Int_t nSub, Bool_t compact) {
   if(nSub<1) {printf("Number of subprofiles has to be > 0!\n"); return; };
   if(fListOfEntries) delete fListOfEntries;
+  fListOfEntries = 0;
+  fCompactSubs = compact;
+  if(fCompactSubs) {
+    fSubSums.Set(nSub*fNcells*kNSums);
+    fSubSums.Reset();
+    fSubEntries.Set(nSub);
+    fSubEntries.Reset();
+    fNSubs = nSub;
+    return;
+  };
+  fSubSums.Set(0);
+  fSubEntries.Set(0);
   fListOfEntries = new TList();
   fListOfEntries->SetOwner(kTRUE);
   TProfile *dummyPF = (TProfile*)this;
@@ -54,12 +75,23 @@ void AliProfileBS::FillProfile(const Double_t &xv, const Double_t& yv, const Dou
   if(!fNSubs) return;
   Int_t targetInd = rn*fNSubs;
   if(targetInd>=fNSubs) targetInd = 0;
+  if(fCompactSubs) {
+    if(fYmin!=fYmax && (yv<fYmin || yv>fYmax)) return; //Same y-range check as in TProfile::Fill
+    Double_t *lSums = fSubSums.GetArray() + (targetInd*fNcells + fXaxis.FindBin(xv))*kNSums;
+    lSums[kSumW]   += w;
+    lSums[kSumWY]  += w*yv;
+    lSums[kSumWY2] += w*yv*yv;
+    lSums[kSumW2]  += w*w;
+    fSubEntries[targetInd]++;
+    return;
+  };
   ((TProfile*)fListOfEntries->At(targetInd))->Fill(xv,yv,w);
 }
 void AliProfileBS::FillProfile(const Double_t &xv, const Double_t &yv, const Double_t &w) {
   TProfile::Fill(xv,yv,w);
 }
 void AliProfileBS::RebinMulti(Int_t nbins) {
+  MaterializeSubsamples();
   this->RebinX(nbins);
   if(!fListOfEntries) return;
   for(Int_t i=0;i<fListOfEntries->GetEntries();i++)
@@ -71,6 +103,7 @@ TH1 *AliProfileBS::getHist(Int_t ind) {
     if((TProfile*)this) return getHistRebinned((TProfile*)this);//((TProfile*)this)->ProjectionX(Form("%s_hist",this->GetName()));
     else { printf("Empty AliProfileBS addressed, cannot get a histogram\n"); return 0; };
   } else {
+    MaterializeSubsamples();
     if(!fListOfEntries) { printf("No subprofiles exist!\n"); return 0; };
     if(ind<fNSubs) return getHistRebinned((TProfile*)fListOfEntries->At(ind));////((TProfile*)fListOfEntries->At(ind))->ProjectionX(Form("%s_sub%i",((TProfile*)fListOfEntries->At(ind))->GetName(),ind));
     else { printf("Trying to fetch subprofile no %i out of %i, not possible\n",ind,fNSubs); return 0;};
@@ -82,6 +115,7 @@ TProfile *AliProfileBS::getProfile(Int_t ind) {
     if((TProfile*)this) return (TProfile*)this;
     else { printf("Empty AliProfileBS addressed, cannot get a histogram\n"); return 0; };
   } else {
+    MaterializeSubsamples();
     if(!fListOfEntries) { printf("No subprofiles exist!\n"); return 0; };
     if(ind<fNSubs) return (TProfile*)fListOfEntries->At(ind);
     else { printf("Trying to fetch subprofile no %i out of %i, not possible\n",ind,fNSubs); return 0;};
@@ -94,6 +128,13 @@ Long64_t AliProfileBS::Merge(TCollection *collist) {
   TIter all_PBS(collist);
   while ((l_PBS = ((AliProfileBS*) all_PBS()))) {
     (TProfile*)this->Add((TProfile*)l_PBS);
+    if(fCompactSubs && l_PBS->fCompactSubs && fSubSums.GetSize()==l_PBS->fSubSums.GetSize()) { //Plain sum of arrays, nothing to materialize
+      AddCompact(l_PBS);
+      nmerged++;
+      continue;
+    };
+    MaterializeSubsamples();
+    l_PBS->MaterializeSubsamples();
     TList *tarL = l_PBS->fListOfEntries;
     if(!tarL) continue;
     if(!fListOfEntries) {
@@ -148,6 +189,9 @@ TH1 *AliProfileBS::getWeightBasedRebin(Int_t ind) {
 }
 void AliProfileBS::MergeBS(AliProfileBS *target) {
   this->Add(target);
+  if(fCompactSubs && target->fCompactSubs && fSubSums.GetSize()==target->fSubSums.GetSize()) { AddCompact(target); return; };
+  MaterializeSubsamples();
+  target->MaterializeSubsamples();
   TList *tarL = target->fListOfEntries;
   if(!fListOfEntries) {
     if(!target->fListOfEntries) return;
@@ -157,6 +201,7 @@ void AliProfileBS::MergeBS(AliProfileBS *target) {
   for(Int_t i=0; i<fListOfEntries->GetEntries(); i++) ((TProfile*)fListOfEntries->At(i))->Add((TProfile*)tarL->At(i));
 }
 TProfile *AliProfileBS::getSummedProfiles() {
+  MaterializeSubsamples();
   if(!fListOfEntries || !fListOfEntries->GetEntries()) {printf("No subprofiles initialized for the AliProfileBS.\n"); return 0; };
   TProfile *retpf = (TProfile*)fListOfEntries->At(0)->Clone("SummedProfile");
   for(Int_t i=1;i<fListOfEntries->GetEntries();i++) retpf->Add((TProfile*)fListOfEntries->At(i));
@@ -169,3 +214,34 @@ void AliProfileBS::OverrideMainWithSub() {
   ((TProfile*)this)->Add(sum);
   delete sum;
 }
+void AliProfileBS::AddCompact(AliProfileBS *source) {
+  Double_t *lTarget = fSubSums.GetArray();
+  const Double_t *lSource = source->fSubSums.GetArray();
+  for(Int_t i=0;i<fSubSums.GetSize();i++) lTarget[i]+=lSource[i];
+  for(Int_t i=0;i<fSubEntries.GetSize() && i<source->fSubEntries.GetSize();i++) fSubEntries[i]+=source->fSubEntries[i];
+}
+void AliProfileBS::MaterializeSubsamples() {
+  if(!fCompactSubs) return;
+  fCompactSubs = kFALSE;
+  if(fListOfEntries) delete fListOfEntries;
+  fListOfEntries = new TList();
+  fListOfEntries->SetOwner(kTRUE);
+  TProfile *dummyPF = (TProfile*)this;
+  for(Int_t i=0;i<fNSubs;i++) {
+    TProfile *lSub = (TProfile*)dummyPF->Clone(Form("%s_Subpf%i",dummyPF->GetName(),i));
+    lSub->Reset();
+    const Double_t *lSums = fSubSums.GetArray() + i*fNcells*kNSums;
+    for(Int_t bin=0;bin<fNcells;bin++, lSums+=kNSums) {
+      if(lSums[kSumW]==0) continue;
+      lSub->SetBinEntries(bin,lSums[kSumW]);
+      lSub->SetBinContent(bin,lSums[kSumWY]); //For TProfile, the bin content is sum(w*y)...
+      lSub->GetSumw2()->fArray[bin] = lSums[kSumWY2]; //... and the error sum(w*y^2)
+      if(lSub->GetBinSumw2()->fN) lSub->GetBinSumw2()->fArray[bin] = lSums[kSumW2];
+    };
+    lSub->ResetStats();
+    lSub->SetEntries(fSubEntries[i]);
+    fListOfEntries->Add(lSub);
+  };
+  fSubSums.Set(0);
+  fSubEntries.Set(0);
+}
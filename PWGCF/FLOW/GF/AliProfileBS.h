@@ -11,6 +11,7 @@ If used, modified, or distributed, please aknowledge the original author of this
 #include "TString.h"
 #include "TCollection.h"
 #include "TMath.h"
+#include "TArrayD.h"
 
 
 class AliProfileBS: public TProfile {
@@ -21,7 +22,9 @@ public:
   AliProfileBS(const char* name, const char* title, Int_t nbinsx, Double_t xlow, Double_t xup);
   TList *fListOfEntries;
   void MergeBS(AliProfileBS *target);
-  void InitializeSubsamples(Int_t nSub);
+  void InitializeSubsamples(Int_t nSub, Bool_t compact=kFALSE);
+  void MaterializeSubsamples(); //Converts the compact subsamples to TProfiles in fListOfEntries
+  Bool_t IsCompact() { return fCompactSubs; };
   void FillProfile(const Double_t &xv, const Double_t &yv, const Double_t &w, const Double_t &rn);
   void FillProfile(const Double_t &xv, const Double_t &yv, const Double_t &w);
   Long64_t Merge(TCollection *collist);
@@ -31,10 +34,10 @@ public:
   TProfile *getProfile(Int_t ind=-1);
   TProfile *getSummedProfiles();
   void OverrideMainWithSub();
-  Int_t getNSubs() { return fListOfEntries->GetEntries(); };
+  Int_t getNSubs() { return fCompactSubs?fNSubs:fListOfEntries->GetEntries(); };
   void PresetWeights(AliProfileBS *targetBS) { fPresetWeights = targetBS; };
-  void ResetBin(Int_t nbin) { ResetBin((TProfile*)this,nbin); for(Int_t i=0;i<fListOfEntries->GetEntries(); i++) ResetBin((TProfile*)fListOfEntries->At(i),nbin); };
-  ClassDef(AliProfileBS,2);
+  void ResetBin(Int_t nbin) { MaterializeSubsamples(); ResetBin((TProfile*)this,nbin); for(Int_t i=0;i<fListOfEntries->GetEntries(); i++) ResetBin((TProfile*)fListOfEntries->At(i),nbin); };
+  ClassDef(AliProfileBS,3);
 protected:
   TH1* getHistRebinned(TProfile *inpf); //Performs rebinning, if required, and returns a projection of profile
   TH1* getWeightBasedRebin(Int_t ind=-1);
@@ -43,6 +46,13 @@ protected:
   Int_t fMultiRebin; //! externaly set runtime, no need to store
   Double_t *fMultiRebinEdges; //! externaly set runtime, no need to store
   AliProfileBS *fPresetWeights; //! AliProfileBS whose weights we should copy
+  //Compact subsamples: instead of a TProfile per subsample, only the bin sums are kept in one array,
+  //fSubSums[(iSub*fNcells+bin)*kNSums+i] with i = sum(w), sum(w*y), sum(w*y^2), sum(w^2)
+  enum { kSumW=0, kSumWY, kSumWY2, kSumW2, kNSums };
+  Bool_t fCompactSubs;
+  TArrayD fSubSums;
+  TArrayD fSubEntries; //Number of entries per subsample
+  void AddCompact(AliProfileBS *source);
   void ResetBin(TProfile *tpf, Int_t nbin) {tpf->SetBinEntries(nbin,0); tpf->SetBinContent(nbin,0); tpf->SetBinError(nbin,0); };
 };
 #endif
@@ -79,6 +79,12 @@ The names are available via the function PairClassName(Int_t i)
 
 ClassImp(AliDielectron)
 
+namespace {
+  // Histogram classes of the pair types, index of fHistClassIdPair
+  enum { kPairHist=0, kLegHist, kRejPairHist, kRejLegHist, kTrackHist };
+  const char* gkPairHistPrefix[5] = { "Pair_", "Track_Legs_", "RejPair_", "RejTrack_", "Track_" };
+}
+
 const char* AliDielectron::fgkTrackClassNames[6] = {
   "ev1+",
   "ev1-",
@@ -142,6 +148,7 @@ AliDielectron::AliDielectron() :
   fHistoArray(0x0),
   fHistos(0x0),
   fUsedVars(new TBits(AliDielectronVarManager::kNMaxValues)),
+  fTrackToLegCuts(0x0),
   fPairCandidates(new TObjArray(13)),
   fCfManagerPair(0x0),
   fTrackRotator(0x0),
@@ -169,6 +176,7 @@ AliDielectron::AliDielectron() :
   fDontClearArrays(kFALSE),
   fEventProcess(kTRUE),
   fUseGammaTracks(kTRUE),
+  fPairPool(),
   fEstimatorFilename(""),
   fEstimatorObjArray(0x0),
   fTRDpidCorrectionFilename(""),
@@ -187,6 +195,11 @@ AliDielectron::AliDielectron() :
   //
   // Default constructor
   //
+  fPairPool.SetOwner();
+  for (Int_t i=0;i<13;++i){
+    for (Int_t k=0;k<5;++k) fHistClassIdPair[k][i]=-1;
+  }
+  for (Int_t i=0;i<6;++i) fHistClassIdTrack[i]=-1;
 
 	for(Int_t i=0;i<15;i++){
 		for(Int_t j=0;j<15;j++){
@@ -237,6 +250,7 @@ AliDielectron::AliDielectron(const char* name, const char* title) :
   fHistoArray(0x0),
   fHistos(0x0),
   fUsedVars(new TBits(AliDielectronVarManager::kNMaxValues)),
+  fTrackToLegCuts(0x0),
   fPairCandidates(new TObjArray(13)),
   fCfManagerPair(0x0),
   fTrackRotator(0x0),
@@ -264,6 +278,7 @@ AliDielectron::AliDielectron(const char* name, const char* title) :
   fDontClearArrays(kFALSE),
   fEventProcess(kTRUE),
   fUseGammaTracks(kTRUE),
+  fPairPool(),
   fEstimatorFilename(""),
   fEstimatorObjArray(0x0),
   fTRDpidCorrectionFilename(""),
@@ -280,6 +295,11 @@ AliDielectron::AliDielectron(const char* name, const char* title) :
   //
   // Named constructor
   //
+  fPairPool.SetOwner();
+  for (Int_t i=0;i<13;++i){
+    for (Int_t k=0;k<5;++k) fHistClassIdPair[k][i]=-1;
+  }
+  for (Int_t i=0;i<6;++i) fHistClassIdTrack[i]=-1;
 
 	for(Int_t i=0;i<15;i++){
 		for(Int_t j=0;j<15;j++){
@@ -377,6 +397,9 @@ void AliDielectron::Init()
       trk2leg->GetLeg1Filter().AddCuts((AliAnalysisCuts*)thisCut->Clone());
       trk2leg->GetLeg2Filter().AddCuts((AliAnalysisCuts*)thisCut->Clone());
     }
+    // the legs enter many pairs, evaluate the track cuts only once per leg and pair array
+    trk2leg->SetCacheLegs();
+    fTrackToLegCuts=trk2leg;
     // add pair leg cuts to pair filter
     fPairFilter.AddCuts(trk2leg);
   }
@@ -398,6 +421,9 @@ void AliDielectron::Init()
       fEvtVsTrkHist->SetHistogramList(fHistos);
     }
   }
+
+  // make sure the inputs of the derived variables are filled as well
+  AliDielectronVarManager::AddDependencies(fUsedVars);
 }
 
 //________________________________________________________________
@@ -498,6 +524,8 @@ Bool_t AliDielectron::Process(AliVEvent *ev1, AliVEvent *ev2)
     ProcessMC(ev1);
   }
 
+  if (fHistos) UpdateHistClassIds();
+
   //if candidate array doesn't exist, create it
   if (!fPairCandidates->UncheckedAt(0)) {
     InitPairCandidateArrays();
@@ -803,9 +831,9 @@ void AliDielectron::FillHistograms(const AliVEvent *ev, Bool_t pairInfoOnly)
   // Fill Histogram information for tracks and pairs
   //
 
-  TString  className,className2;
   Double_t values[AliDielectronVarManager::kNMaxValues]={0.};
   AliDielectronVarManager::SetFillMap(fUsedVars);
+  UpdateHistClassIds();
 
   //Fill event information
   if (ev){
@@ -816,12 +844,10 @@ void AliDielectron::FillHistograms(const AliVEvent *ev, Bool_t pairInfoOnly)
 
   //Fill track information, separately for the track array candidates
   if (!pairInfoOnly){
-    className2.Form("Track_%s",fgkPairClassNames[1]);  // unlike sign, SE only
+    const Int_t mergedtrkClass=fHistClassIdPair[kTrackHist][1];  // unlike sign, SE only
     for (Int_t i=0; i<6; ++i){
-      className.Form("Track_%s",fgkTrackClassNames[i]);
-      Bool_t mergedtrkClass=fHistos->GetHistogramList()->FindObject(className2.Data())!=0x0;
-      Bool_t trkClass=fHistos->GetHistogramList()->FindObject(className.Data())!=0x0;
-      if (!trkClass && !mergedtrkClass) continue;
+      const Int_t trkClass=fHistClassIdTrack[i];
+      if (trkClass<0 && mergedtrkClass<0) continue;
 
       Double_t ntracks; 
       Double_t nPos = fTracks[0].GetEntriesFast();
@@ -851,10 +877,10 @@ void AliDielectron::FillHistograms(const AliVEvent *ev, Bool_t pairInfoOnly)
 
           AliDielectronVarManager::Fill(part, values);
         }
-        if(trkClass)
-          fHistos->FillClass(className, AliDielectronVarManager::kNMaxValues, values);
-        if(mergedtrkClass && i<2)
-          fHistos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values); //only ev1
+        if(trkClass>=0)
+          fHistos->FillClass(trkClass, AliDielectronVarManager::kNMaxValues, values);
+        if(mergedtrkClass>=0 && i<2)
+          fHistos->FillClass(mergedtrkClass, AliDielectronVarManager::kNMaxValues, values); //only ev1
       }
     }
   }
@@ -862,42 +888,58 @@ void AliDielectron::FillHistograms(const AliVEvent *ev, Bool_t pairInfoOnly)
   //Fill Pair information, separately for all pair candidate arrays and the legs
   TObjArray arrLegs(100);
   for (Int_t i=0; i<13; ++i){
-    className.Form("Pair_%s",fgkPairClassNames[i]);
-    className2.Form("Track_Legs_%s",fgkPairClassNames[i]);
-    Bool_t pairClass=fHistos->GetHistogramList()->FindObject(className.Data())!=0x0;
-    Bool_t legClass=fHistos->GetHistogramList()->FindObject(className2.Data())!=0x0;
-    if (!pairClass&&!legClass) continue;
+    const Int_t pairClass=fHistClassIdPair[kPairHist][i];
+    const Int_t legClass=fHistClassIdPair[kLegHist][i];
+    if (pairClass<0&&legClass<0) continue;
     Int_t ntracks=PairArray(i)->GetEntriesFast();
     for (Int_t ipair=0; ipair<ntracks; ++ipair){
       AliDielectronPair *pair=static_cast<AliDielectronPair*>(PairArray(i)->UncheckedAt(ipair));
 
       //fill pair information
-      if (pairClass){
+      if (pairClass>=0){
         AliDielectronVarManager::Fill(pair, values);
-        fHistos->FillClass(className, AliDielectronVarManager::kNMaxValues, values);
+        fHistos->FillClass(pairClass, AliDielectronVarManager::kNMaxValues, values);
       }
 
       //fill leg information, don't fill the information twice
-      if (legClass){
+      if (legClass>=0){
         AliVParticle *d1=pair->GetFirstDaughterP();
         AliVParticle *d2=pair->GetSecondDaughterP();
         if (!arrLegs.FindObject(d1)){
           AliDielectronVarManager::Fill(d1, values);
-          fHistos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values);
+          fHistos->FillClass(legClass, AliDielectronVarManager::kNMaxValues, values);
           arrLegs.Add(d1);
         }
         if (!arrLegs.FindObject(d2)){
           AliDielectronVarManager::Fill(d2, values);
-          fHistos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values);
+          fHistos->FillClass(legClass, AliDielectronVarManager::kNMaxValues, values);
           arrLegs.Add(d2);
         }
       }
     }
-    if (legClass) arrLegs.Clear();
+    if (legClass>=0) arrLegs.Clear();
   }
 
 }
 
+//________________________________________________________________
+void AliDielectron::UpdateHistClassIds()
+{
+  //
+  // Look up the histogram classes of the track arrays and pair types once,
+  // instead of building and searching the class names for each track and pair.
+  // -1 if the class is not defined
+  //
+  for (Int_t i=0; i<13; ++i){
+    for (Int_t k=0; k<5; ++k){
+      fHistClassIdPair[k][i]=fHistos->GetClassId(Form("%s%s",gkPairHistPrefix[k],fgkPairClassNames[i]));
+    }
+  }
+  for (Int_t i=0; i<6; ++i){
+    fHistClassIdTrack[i]=fHistos->GetClassId(Form("Track_%s",fgkTrackClassNames[i]));
+  }
+}
+
 //________________________________________________________________
 void AliDielectron::FillHistogramsPair(AliDielectronPair *pair,Bool_t fromPreFilter/*=kFALSE*/)
 {
@@ -907,38 +949,29 @@ void AliDielectron::FillHistogramsPair(AliDielectronPair *pair,Bool_t fromPreFil
   //       times. This funtion is used in the track rotation pairing
   //       and those legs are not saved!
   //
-  TString  className,className2;
   Double_t values[AliDielectronVarManager::kNMaxValues];
   AliDielectronVarManager::SetFillMap(fUsedVars);
 
   //Fill Pair information, separately for all pair candidate arrays and the legs
-  TObjArray arrLegs(100);
+  //the class ids are set in Process
   const Int_t type=pair->GetType();
-  if (fromPreFilter) {
-    className.Form("RejPair_%s",fgkPairClassNames[type]);
-    className2.Form("RejTrack_%s",fgkPairClassNames[type]);
-  } else {
-    className.Form("Pair_%s",fgkPairClassNames[type]);
-    className2.Form("Track_Legs_%s",fgkPairClassNames[type]);
-  }
-
-  Bool_t pairClass=fHistos->GetHistogramList()->FindObject(className.Data())!=0x0;
-  Bool_t legClass=fHistos->GetHistogramList()->FindObject(className2.Data())!=0x0;
+  const Int_t pairClass=fHistClassIdPair[fromPreFilter ? kRejPairHist : kPairHist][type];
+  const Int_t legClass=fHistClassIdPair[fromPreFilter ? kRejLegHist : kLegHist][type];
 
   //fill pair information
-  if (pairClass){
+  if (pairClass>=0){
     AliDielectronVarManager::Fill(pair, values);
-    fHistos->FillClass(className, AliDielectronVarManager::kNMaxValues, values);
+    fHistos->FillClass(pairClass, AliDielectronVarManager::kNMaxValues, values);
   }
 
-  if (legClass){
+  if (legClass>=0){
     AliVParticle *d1=pair->GetFirstDaughterP();
     AliDielectronVarManager::Fill(d1, values);
-    fHistos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values);
+    fHistos->FillClass(legClass, AliDielectronVarManager::kNMaxValues, values);
 
     AliVParticle *d2=pair->GetSecondDaughterP();
     AliDielectronVarManager::Fill(d2, values);
-    fHistos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values);
+    fHistos->FillClass(legClass, AliDielectronVarManager::kNMaxValues, values);
   }
 }
 
@@ -1505,7 +1538,7 @@ void AliDielectron::FillPairArrays(Int_t arr1, Int_t arr2, const AliVEvent *ev)
   Int_t ntrack1=arrTracks1.GetEntriesFast();
   Int_t ntrack2=arrTracks2.GetEntriesFast();
 
-  AliDielectronPair *candidate=new AliDielectronPair;
+  AliDielectronPair *candidate=NewPairCandidate();
   candidate->SetKFUsage(fUseKF);
 
   UInt_t selectedMask=(1<<fPairFilter.GetCuts()->GetEntries())-1;
@@ -1553,12 +1586,46 @@ void AliDielectron::FillPairArrays(Int_t arr1, Int_t arr2, const AliVEvent *ev)
       //add the candidate to the candidate array
       PairArray(pairIndex)->Add(candidate);
       //get a new candidate
-      candidate=new AliDielectronPair;
+      candidate=NewPairCandidate();
       candidate->SetKFUsage(fUseKF);
     }
   }
-  //delete the surplus candidate
-  delete candidate;
+  //keep the surplus candidate for the next call
+  fPairPool.Add(candidate);
+}
+
+//________________________________________________________________
+AliDielectronPair* AliDielectron::NewPairCandidate()
+{
+  //
+  // Pair object for a new candidate, taken from the pairs of the previous events if possible.
+  // All the pair members are set again by SetTracks and the setters used in FillPairArrays
+  //
+  AliDielectronPair *pair=static_cast<AliDielectronPair*>(fPairPool.RemoveLast());
+  if (!pair) pair=new AliDielectronPair;
+  return pair;
+}
+
+//________________________________________________________________
+void AliDielectron::ClearArrays()
+{
+  //
+  // Reset the Arrays
+  // the pair objects are kept in the pool for the candidates of the next event
+  //
+  for (Int_t i=0;i<6;++i){
+    fTracks[i].Clear();
+  }
+  for (Int_t i=0;i<13;++i){
+    TObjArray *arr=PairArray(i);
+    if (!arr) continue;
+    for (Int_t j=0;j<arr->GetEntriesFast();++j){
+      TObject *obj=arr->UncheckedAt(j);
+      if (obj && obj->IsA()==AliDielectronPair::Class()) fPairPool.Add(obj);
+      else delete obj;
+    }
+    arr->Clear();
+  }
 }
 
 //________________________________________________________________
@@ -2398,9 +2465,9 @@ void AliDielectron::FillHistogramsFromPairArray(Bool_t pairInfoOnly/*=kFALSE*/)
   // Fill Histogram information for tracks and pairs
   //
 
-  TString  className,className2;
   Double_t values[AliDielectronVarManager::kNMaxValues]={0.};
   AliDielectronVarManager::SetFillMap(fUsedVars);
+  UpdateHistClassIds();
   AliDielectronVarManager::SetLegEffMap(fLegEffMap);
   AliDielectronVarManager::SetPairEffMap(fPairEffMap);
 
@@ -2412,6 +2479,7 @@ void AliDielectron::FillHistogramsFromPairArray(Bool_t pairInfoOnly/*=kFALSE*/)
   }
 
   UInt_t selectedMask=(1<<fPairFilter.GetCuts()->GetEntries())-1;
+  if (fTrackToLegCuts) fTrackToLegCuts->ResetLegCache();
 
   //Fill Pair information, separately for all pair candidate arrays and the legs
   TObjArray arrLegs(100);
@@ -2419,10 +2487,8 @@ void AliDielectron::FillHistogramsFromPairArray(Bool_t pairInfoOnly/*=kFALSE*/)
     Int_t npairs=PairArray(i)->GetEntriesFast();
     if(npairs<1) continue;
 
-    className.Form("Pair_%s",fgkPairClassNames[i]);
-    className2.Form("Track_Legs_%s",fgkPairClassNames[i]);
-    Bool_t pairClass=fHistos->GetHistogramList()->FindObject(className.Data())!=0x0;
-    Bool_t legClass=fHistos->GetHistogramList()->FindObject(className2.Data())!=0x0;
+    const Int_t pairClass=fHistClassIdPair[kPairHist][i];
+    const Int_t legClass=fHistClassIdPair[kLegHist][i];
 
     //    if (!pairClass&&!legClass) continue;
     for (Int_t ipair=0; ipair<npairs; ++ipair){
@@ -2450,29 +2516,30 @@ void AliDielectron::FillHistogramsFromPairArray(Bool_t pairInfoOnly/*=kFALSE*/)
       AliDielectronVarManager::SetFillMap(fUsedVars);
 
       //fill pair information
-      if (pairClass){
+      if (pairClass>=0){
         AliDielectronVarManager::Fill(pair, values);
-        fHistos->FillClass(className, AliDielectronVarManager::kNMaxValues, values);
+        fHistos->FillClass(pairClass, AliDielectronVarManager::kNMaxValues, values);
       }
 
       //fill leg information, don't fill the information twice
-      if (legClass){
+      if (legClass>=0){
         AliVParticle *d1=pair->GetFirstDaughterP();
         AliVParticle *d2=pair->GetSecondDaughterP();
         if (!arrLegs.FindObject(d1)){
           AliDielectronVarManager::Fill(d1, values);
-          fHistos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values);
+          fHistos->FillClass(legClass, AliDielectronVarManager::kNMaxValues, values);
           arrLegs.Add(d1);
         }
         if (!arrLegs.FindObject(d2)){
           AliDielectronVarManager::Fill(d2, values);
-          fHistos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values);
+          fHistos->FillClass(legClass, AliDielectronVarManager::kNMaxValues, values);
           arrLegs.Add(d2);
         }
       }
     }
-    if (legClass) arrLegs.Clear();
+    if (legClass>=0) arrLegs.Clear();
   }
+  if (fTrackToLegCuts) fTrackToLegCuts->ResetLegCache();
 
 }
 
@@ -37,6 +37,7 @@ class AliDielectronCF;
 class AliDielectronDebugTree;
 class AliDielectronTrackRotator;
 class AliDielectronPair;
+class AliDielectronPairLegCuts;
 class AliDielectronSignalMC;
 class AliDielectronMixingHandler;
 
@@ -266,6 +267,9 @@ private:
                                   //  Streaming and merging should be handled
                                   //  by the analysis framework
   TBits *fUsedVars;               // used variables
+  AliDielectronPairLegCuts *fTrackToLegCuts; //! Track cuts applied to the pair legs in the internal train (owned by fPairFilter)
+  Int_t fHistClassIdPair[5][13];  //! Histogram class ids of the pair types (see UpdateHistClassIds)
+  Int_t fHistClassIdTrack[6];     //! Histogram class ids of the track arrays
 
   TObjArray fTracks[6];           //! Selected track candidates
                                   //  0: Event1, positive particles
@@ -310,6 +314,7 @@ private:
   Bool_t fDontClearArrays;      //Don't clear the arrays at the end of the Process function, needed for external use of pair and tracks
   Bool_t fEventProcess;         //Process event (or pair array)
   Bool_t fUseGammaTracks;       // use function SetGammaTracks for MCtruth photons
+  TObjArray fPairPool;          //! pair objects of previous events, reused for new candidates
 
   void FillTrackArrays(AliVEvent * const ev, Int_t eventNr=0);
   void EventPlanePreFilter(Int_t arr1, Int_t arr2, TObjArray arrTracks1, TObjArray arrTracks2, const AliVEvent *ev);
@@ -321,6 +326,7 @@ private:
 
   void InitPairCandidateArrays();
   void ClearArrays();
+  AliDielectronPair* NewPairCandidate();
 
   TObjArray* PairArray(Int_t i);
   TObject* InitEffMap(TString filename, TString generatedname, TString foundname);
@@ -347,13 +353,14 @@ private:
   void  FillHistogramsMC(const AliMCEvent *ev,  AliVEvent *ev1);
   void  FillHistogramsPair(AliDielectronPair *pair,Bool_t fromPreFilter=kFALSE);
   void  FillHistogramsTracks(TObjArray **tracks);
+  void  UpdateHistClassIds();
 
   void  FillDebugTree();
 
   AliDielectron(const AliDielectron &c);
   AliDielectron &operator=(const AliDielectron &c);
 
-  ClassDef(AliDielectron,19);
+  ClassDef(AliDielectron,20);
 };
 
 inline void AliDielectron::InitPairCandidateArrays()
@@ -377,17 +384,4 @@ inline TObjArray* AliDielectron::PairArray(Int_t i)
   return static_cast<TObjArray*>(fPairCandidates->UncheckedAt(i));
 }
 
-inline void AliDielectron::ClearArrays()
-{
-  //
-  // Reset the Arrays
-  //
-  for (Int_t i=0;i<6;++i){
-    fTracks[i].Clear();
-  }
-  for (Int_t i=0;i<13;++i){
-    if (PairArray(i)) PairArray(i)->Delete();
-  }
-}
-
 #endif
@@ -61,7 +61,8 @@ AliDielectronHistos::AliDielectronHistos() :
   fHistoList(),
   fList(0x0),
   fUsedVars(new TBits(AliDielectronVarManager::kNMaxValues)),
-  fReservedWords(new TString)
+  fReservedWords(new TString),
+  fClassTables()
 {
   //
   // Default constructor
@@ -77,7 +78,8 @@ AliDielectronHistos::AliDielectronHistos(const char* name, const char* title) :
   fHistoList(),
   fList(0x0),
   fUsedVars(new TBits(AliDielectronVarManager::kNMaxValues)),
-  fReservedWords(new TString)
+  fReservedWords(new TString),
+  fClassTables()
 {
   //
   // TNamed constructor
@@ -801,6 +803,37 @@ void AliDielectronHistos::FillClass(const char* histClass, Int_t nValues, const
   return;
 }
 
+//_____________________________________________________________________________
+Int_t AliDielectronHistos::GetClassId(const char* histClass)
+{
+  //
+  // Id of class 'histClass' for FillClass(Int_t,...), -1 if the class does not exist
+  //
+  THashList *classTable=(THashList*)fHistoList.FindObject(histClass);
+  if (!classTable) return -1;
+  for (UInt_t i=0; i<fClassTables.size(); ++i){
+    if (fClassTables[i]==classTable) return i;
+  }
+  fClassTables.push_back(classTable);
+  return fClassTables.size()-1;
+}
+
+//_____________________________________________________________________________
+void AliDielectronHistos::FillClass(Int_t classId, Int_t nValues, const Double_t *values)
+{
+  //
+  // Fill class by id (see GetClassId)
+  //
+  if (classId<0 || classId>=(Int_t)fClassTables.size()){
+    Warning("FillClass","Cannot fill class with id %d its not defined. nValues %d",classId,nValues);
+    return;
+  }
+
+  // walk the links directly, no iterator is allocated for each fill
+  for (TObjLink *lnk=fClassTables[classId]->FirstLink(); lnk; lnk=lnk->Next())
+    FillValues(lnk->GetObject(), values);
+}
+
 //_____________________________________________________________________________
 // void AliDielectronHistos::FillClass(const char* histClass, const TVectorD &vals)
 // {
@@ -14,6 +14,8 @@
 //                                                                                       //
 ///////////////////////////////////////////////////////////////////////////////////////////
 
+#include <vector>
+
 #include <Rtypes.h>
 
 #include <TNamed.h>
@@ -148,6 +150,10 @@ public:
   
 //   void FillClass(const char* histClass, const TVectorD &vals);
   void FillClass(const char* histClass, Int_t nValues, const Double_t *values);
+  // filling by class id, without string lookup
+  // the ids are valid until the histogram list is replaced
+  Int_t GetClassId(const char* histClass);
+  void FillClass(Int_t classId, Int_t nValues, const Double_t *values);
   
   TObject* GetHist(const char* histClass, const char* name) const;
   TH1* GetHistogram(const char* histClass, const char* name) const;
@@ -155,7 +161,7 @@ public:
   TH1* GetHistogram(const char* cutClass, const char* histClass, const char* name) const;
 
   void SetHistogramList(THashList &list, Bool_t setOwner=kTRUE);
-  void ResetHistogramList(){fHistoList.Clear();}
+  void ResetHistogramList(){fHistoList.Clear(); fClassTables.clear();}
   const THashList* GetHistogramList() const {return &fHistoList;}
 
   void SetList(TList * const list) { fList=list; }
@@ -199,6 +205,7 @@ private:
 	TBits     *fUsedVars;            // list of used variables
 
   TString *fReservedWords;          //! list of reserved words
+  std::vector<THashList*> fClassTables; //! class tables by class id
   void UserHistogramReservedWords(const char* histClass, const TObject *hist, UInt_t valTypes);
   void FillClass(THashTable *classTable, Int_t nValues, Double_t *values);
   
@@ -211,7 +218,7 @@ private:
   AliDielectronHistos(const AliDielectronHistos &hist);
   AliDielectronHistos& operator = (const AliDielectronHistos &hist);
 
-  ClassDef(AliDielectronHistos,4)
+  ClassDef(AliDielectronHistos,5)
 };
 
 #endif
@@ -43,6 +43,7 @@ Detailed description
 #include "AliDielectronVarManager.h"
 #include "AliDielectronVarCuts.h"
 
+#include "AliPIDNSigmaTable.h"
 #include "AliDielectronPID.h"
 
 ClassImp(AliDielectronPID)
@@ -393,7 +394,7 @@ Bool_t AliDielectronPID::IsSelected(TObject* track)
 
     // check if fFunSigma is set, then check if 'part' is in sigma range of the function
     if(fFunSigma[icut]){
-        val= fPIDResponse->NumberOfSigmasTPC(part, fPartType[icut]);
+        val= AliPIDNSigmaTable::NumberOfSigmasTPC(fPIDResponse, part, fPartType[icut]);
         if (fPartType[icut]==AliPID::kElectron){
             val-=fgCorr;
         }
@@ -472,7 +473,7 @@ Bool_t AliDielectronPID::IsSelectedITS(AliVTrack * const part, Int_t icut)
 
   Double_t mom=part->P();
 
-  Float_t numberOfSigmas=fPIDResponse->NumberOfSigmasITS(part, fPartType[icut]);
+  Float_t numberOfSigmas=AliPIDNSigmaTable::NumberOfSigmasITS(fPIDResponse, part, fPartType[icut]);
 
 //	if(!fgPIDCalibinPU){
 //		// post pid corrections ("eta corrections")
@@ -511,7 +512,7 @@ Bool_t AliDielectronPID::IsSelectedTPC(AliVTrack * const part, Int_t icut, Doubl
   if (fRequirePIDbit[icut]==AliDielectronPID::kIfAvailable&&(pidStatus!=AliPIDResponse::kDetPidOk)) return kTRUE;
 
 
-  Float_t numberOfSigmas=fPIDResponse->NumberOfSigmasTPC(part, fPartType[icut]);
+  Float_t numberOfSigmas=AliPIDNSigmaTable::NumberOfSigmasTPC(fPIDResponse, part, fPartType[icut]);
 	//printf("TPC::icut = %d , nsigma (before) = %f\n",icut,numberOfSigmas);
 
 //	if(!fgPIDCalibinPU){
@@ -624,7 +625,7 @@ Bool_t AliDielectronPID::IsSelectedTOF(AliVTrack * const part, Int_t icut)
   if (fRequirePIDbit[icut]==AliDielectronPID::kRequire&&(pidStatus!=AliPIDResponse::kDetPidOk)) return kFALSE;
   if (fRequirePIDbit[icut]==AliDielectronPID::kIfAvailable&&(pidStatus!=AliPIDResponse::kDetPidOk)) return kTRUE;
 
-  Float_t numberOfSigmas=fPIDResponse->NumberOfSigmasTOF(part, fPartType[icut]);
+  Float_t numberOfSigmas=AliPIDNSigmaTable::NumberOfSigmasTOF(fPIDResponse, part, fPartType[icut]);
 
 //	if(!fgPIDCalibinPU){
 //		// post pid corrections ("eta corrections")
@@ -40,7 +40,9 @@ AliDielectronPairLegCuts::AliDielectronPairLegCuts() :
   AliAnalysisCuts(),
   fFilterLeg1("PairFilterLeg1","PairFilterLeg1"),
   fFilterLeg2("PairFilterLeg2","PairFilterLeg2"),
-  fCutType(kBothLegs)
+  fCutType(kBothLegs),
+  fCacheLegs(kFALSE),
+  fLegCache()
 {
   //
   // Default contructor
@@ -52,7 +54,9 @@ AliDielectronPairLegCuts::AliDielectronPairLegCuts(const char* name, const char*
   AliAnalysisCuts(name,title),
   fFilterLeg1("PairFilterLeg1","PairFilterLeg1"),
   fFilterLeg2("PairFilterLeg2","PairFilterLeg2"),
-  fCutType(kBothLegs)
+  fCutType(kBothLegs),
+  fCacheLegs(kFALSE),
+  fLegCache()
 {
   //
   // Named contructor
@@ -97,31 +101,47 @@ Bool_t AliDielectronPairLegCuts::IsSelected(TObject* track)
     return kFALSE;
   }
   
-  //mask used to require that all cuts are fulfilled
-  UInt_t selectedMaskLeg1=(1<<fFilterLeg1.GetCuts()->GetEntries())-1;
-  UInt_t selectedMaskLeg2=(1<<fFilterLeg2.GetCuts()->GetEntries())-1;
-  
   //test cuts
-  Bool_t isLeg1selected=(fFilterLeg1.IsSelected(leg1)==selectedMaskLeg1);
+  Bool_t isLeg1selected=IsLegSelected(0,leg1);
   if(fCutType==kBothLegs && !isLeg1selected) {
     SetSelected(isLeg1selected);
     return isLeg1selected;
   }
-  Bool_t isLeg2selected=(fFilterLeg2.IsSelected(leg2)==selectedMaskLeg2);
-  
-  Bool_t isLeg1selectedMirror=(fFilterLeg1.IsSelected(leg2)==selectedMaskLeg1);
-  Bool_t isLeg2selectedMirror=(fFilterLeg2.IsSelected(leg1)==selectedMaskLeg2);
+  Bool_t isLeg2selected=IsLegSelected(1,leg2);
   
   Bool_t isSelected=isLeg1selected&&isLeg2selected;
   if (fCutType==kAnyLeg)
     isSelected=isLeg1selected||isLeg2selected;
   
-  if (fCutType==kMixLegs)
-    isSelected=(isLeg1selected&&isLeg2selected)||(isLeg1selectedMirror&&isLeg2selectedMirror);
+  //the mirrored combinations are only needed here
+  if (fCutType==kMixLegs && !isSelected)
+    isSelected=IsLegSelected(0,leg2)&&IsLegSelected(1,leg1);
   
   SetSelected(isSelected);
   return isSelected;
 }
 
+//________________________________________________________________________
+Bool_t AliDielectronPairLegCuts::IsLegSelected(Int_t ileg, TObject *leg)
+{
+  //
+  // check if all cuts of the leg filter ileg (0: leg1, 1: leg2) are fulfilled,
+  // the result is taken from the cache if it was already evaluated for this particle
+  //
+  AliAnalysisFilter &filter=(ileg==0)?fFilterLeg1:fFilterLeg2;
+  //mask used to require that all cuts are fulfilled
+  UInt_t selectedMask=(1<<filter.GetCuts()->GetEntries())-1;
+  if (!fCacheLegs) return filter.IsSelected(leg)==selectedMask;
+
+  const UChar_t evaluated=(ileg==0)?1:4;
+  const UChar_t selected=evaluated<<1;
+  UChar_t &bits=fLegCache[leg];
+  if (!(bits&evaluated)){
+    bits|=evaluated;
+    if (filter.IsSelected(leg)==selectedMask) bits|=selected;
+  }
+  return (bits&selected)!=0;
+}
+
 
 
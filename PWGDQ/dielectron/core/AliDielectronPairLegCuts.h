@@ -20,6 +20,8 @@
 //#                                                           #
 //#############################################################
 
+#include <map>
+
 #include <AliAnalysisFilter.h>
 
 #include <AliAnalysisCuts.h>
@@ -45,16 +47,26 @@ public:
   AliAnalysisFilter& GetLeg2Filter() { return fFilterLeg2; }
 
   void SetCutType(CutType type) {fCutType=type;}
+
+  // keep the leg filter results per particle, until ResetLegCache is called.
+  // Only valid as long as the particles and the event variables do not change
+  void SetCacheLegs(Bool_t cache=kTRUE) { fCacheLegs=cache; fLegCache.clear(); }
+  void ResetLegCache() { fLegCache.clear(); }
 private:
+  Bool_t IsLegSelected(Int_t ileg, TObject *leg);
+
   AliAnalysisFilter fFilterLeg1;     // Analysis Filter for leg1
   AliAnalysisFilter fFilterLeg2;     // Analysis Filter for leg2
 
   CutType fCutType;                  // Type of the cut
 
+  Bool_t fCacheLegs;                 //! Cache the leg filter results
+  std::map<const TObject*,UChar_t> fLegCache; //! Evaluated (bits 0,2) and selected (bits 1,3) by leg1/leg2 filter
+
   AliDielectronPairLegCuts(const AliDielectronPairLegCuts &c);
   AliDielectronPairLegCuts &operator=(const AliDielectronPairLegCuts &c);
   
-  ClassDef(AliDielectronPairLegCuts,1)         //Cut class providing cuts for both legs of a pair
+  ClassDef(AliDielectronPairLegCuts,2)         //Cut class providing cuts for both legs of a pair
 };
 
 #endif
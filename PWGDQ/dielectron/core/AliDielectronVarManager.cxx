@@ -879,6 +879,60 @@ AliDielectronVarManager::~AliDielectronVarManager()
 
 }
 
+//________________________________________________________________
+void AliDielectronVarManager::AddDependencies(TBits *map) {
+  //
+  // Add to the map of used variables the variables needed to compute them,
+  // so that the Req() gated filling of the inputs is triggered as well.
+  // The efficiency maps have to be set before, since their axes are inputs of the efficiencies.
+  //
+  if(!map) return;
+
+  // pairs of (derived variable, input variable)
+  static const Int_t kDependencies[][2] = {
+    {kNclsSFracTPC,    kNclsSTPC},
+    {kNclsSFracITS,    kNclsITS},
+    {kNclsSFracITS,    kNclsSITS},
+    {kNFclsTPCfCross,  kNFclsTPC},
+    {kNFclsTPCfCross,  kNFclsTPCr},
+    {kOneOverPairEff,  kPairEff},
+    {kOneOverPairEffSq,kPairEff},
+    {kPairEff,         kLegEff},
+    {kOneOverLegEff,   kLegEff},
+    {kQnDeltaPhiTrackTPCrpH2,    kPhi},
+    {kQnDeltaPhiTrackTPCrpH2Abs, kPhi},
+    {kQnDeltaPhiTrackV0CrpH2,    kPhi}
+  };
+  const Int_t nDependencies = sizeof(kDependencies)/sizeof(kDependencies[0]);
+
+  // the entries are ordered such that one pass resolves the chains (e.g. OneOverPairEff->PairEff->LegEff)
+  for(Int_t i=0; i<nDependencies; ++i) {
+    if(map->TestBitNumber(kDependencies[i][0])) map->SetBitNumber(kDependencies[i][1]);
+  }
+
+  // axes of the efficiency maps
+  if(map->TestBitNumber(kLegEff) && fgLegEffMap && fgLegEffMap->InheritsFrom(THnBase::Class())) {
+    const THnBase *eff = static_cast<const THnBase*>(fgLegEffMap);
+    for(Int_t idim=0; idim<eff->GetNdimensions(); ++idim) {
+      const Int_t var = GetValueType(eff->GetAxis(idim)->GetName());
+      if(var>=0 && var<kNMaxValues) map->SetBitNumber(var);
+    }
+  }
+  if(map->TestBitNumber(kPairEff) && fgPairEffMap) {
+    if(fgPairEffMap->InheritsFrom(THnBase::Class())) {
+      const THnBase *eff = static_cast<const THnBase*>(fgPairEffMap);
+      for(Int_t idim=0; idim<eff->GetNdimensions(); ++idim) {
+        const Int_t var = GetValueType(eff->GetAxis(idim)->GetName());
+        if(var>=0 && var<kNMaxValues) map->SetBitNumber(var);
+      }
+    }
+    else if(fgPairEffMap->IsA()==TSpline3::Class() && static_cast<TSpline3*>(fgPairEffMap)->GetHistogram()) {
+      const Int_t var = GetValueType(static_cast<TSpline3*>(fgPairEffMap)->GetHistogram()->GetXaxis()->GetName());
+      if(var>=0 && var<kNMaxValues) map->SetBitNumber(var);
+    }
+  }
+}
+
 //________________________________________________________________
 UInt_t AliDielectronVarManager::GetValueType(const char* valname) {
   //
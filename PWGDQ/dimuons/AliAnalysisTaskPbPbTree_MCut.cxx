@@ -57,6 +57,7 @@
 #include "AliOADBContainer.h"
 #include "AliAODv0.h"
 
+#include "AliDimuonTreeWriter.h"
 #include "AliAnalysisTaskPbPbTree_MCut.h"
 #include "AliAODZDC.h"
 #include "AliTriggerAnalysis.h"
@@ -142,7 +143,11 @@ AliAnalysisTaskPbPbTree_MCut::AliAnalysisTaskPbPbTree_MCut() :
   fAODEvent(0x0),
 //  fTrigClass(0x0),
   finpmask(0),
-  fNTracks(0x0)
+  fNTracks(0x0),
+  fCompactTree(kFALSE),
+  fTreeBasketSize(0),
+  fTreeAutoFlush(0),
+  fTreeWriter(0x0)
 {
   //
   //Default ctor
@@ -223,7 +228,11 @@ AliAnalysisTaskPbPbTree_MCut::AliAnalysisTaskPbPbTree_MCut(const char *name) :
   fAODEvent(0x0),
 //  fTrigClass(0x0),
   finpmask(0),
-  fNTracks(0x0)
+  fNTracks(0x0),
+  fCompactTree(kFALSE),
+  fTreeBasketSize(0),
+  fTreeAutoFlush(0),
+  fTreeWriter(0x0)
 {
   //
   // Constructor. Initialization of Inputs and Outputs
@@ -322,7 +331,11 @@ AliAnalysisTaskPbPbTree_MCut::AliAnalysisTaskPbPbTree_MCut(const AliAnalysisTask
 //  fTrigClass(c.fTrigClass),
   finpmask(c.finpmask),
   fMuonTrackCuts(c.fMuonTrackCuts),
-  fNTracks(c.fNTracks)
+  fNTracks(c.fNTracks),
+  fCompactTree(c.fCompactTree),
+  fTreeBasketSize(c.fTreeBasketSize),
+  fTreeAutoFlush(c.fTreeAutoFlush),
+  fTreeWriter(0x0)
 
  {
   //
@@ -337,6 +350,7 @@ AliAnalysisTaskPbPbTree_MCut::~AliAnalysisTaskPbPbTree_MCut() {
   //
   Info("~AliAnalysisTaskPbPbTree_MCut","Calling Destructor");
   if (AliAnalysisManager::GetAnalysisManager()->GetAnalysisType() != AliAnalysisManager::kProofAnalysis) delete fOutputTree;
+  delete fTreeWriter;
 }
 
 //___________________________________________________________________________
@@ -353,59 +367,61 @@ void AliAnalysisTaskPbPbTree_MCut::UserCreateOutputObjects(){
 
   OpenFile(1,"RECREATE");
   fOutputTree = new TTree("PbPbTree","Data Tree");
-
-  fOutputTree->Branch("FiredTriggerClasses",fTrigClass,"FiredTriggerClasses/C");
-  fOutputTree->Branch("inpmask",&finpmask,"inpmask/i");
-
-  fOutputTree->Branch("NMuons",&fNMuons,"NMuons/I");
-  fOutputTree->Branch("Vertex",fVertex,"Vertex[3]/D");
-  fOutputTree->Branch("PercentV0M",&fPercentV0M,"PercentV0M/F");
-  fOutputTree->Branch("PercentCL0",&fPercentCL0,"PercentCL0/F");
-  fOutputTree->Branch("PercentCL1",&fPercentCL1,"PercentCL1/F");
-  fOutputTree->Branch("PercentV0A",&fPercentV0A,"PercentV0A/F");
-  fOutputTree->Branch("PercentV0C",&fPercentV0C,"PercentV0C/F");
-  fOutputTree->Branch("PercentZNA",&fPercentZNA,"PercentZNA/F");
-  fOutputTree->Branch("PercentZNC",&fPercentZNC,"PercentZNC/F");
-  fOutputTree->Branch("NTracks",&fNTracks,"NTracks/I");
-
-  fOutputTree->Branch("Pt",fPt,"Pt[NMuons]/D");
-  fOutputTree->Branch("E",fE,"E[NMuons]/D");
-  fOutputTree->Branch("Px",fPx,"Px[NMuons]/D");
-  fOutputTree->Branch("Py",fPy,"Py[NMuons]/D");
-  fOutputTree->Branch("Pz",fPz,"Pz[NMuons]/D");
-  fOutputTree->Branch("Y",fY,"Y[NMuons]/D");
-  fOutputTree->Branch("Eta",fEta,"Eta[NMuons]/D");
-  fOutputTree->Branch("Phi",fPhi,"Phi[NMuons]/D");
-  fOutputTree->Branch("MatchTrig",fMatchTrig,"MatchTrig[NMuons]/I");
-  fOutputTree->Branch("TrackChi2",fTrackChi2,"TrackChi2[NMuons]/D");
-  fOutputTree->Branch("MatchTrigChi2",fMatchTrigChi2,"MatchTrigChi2[NMuons]/D");
-  fOutputTree->Branch("Charge",fCharge,"Charge[NMuons]/I");
-  fOutputTree->Branch("RAtAbsEnd",fRAtAbsEnd,"RAtAbsEnd[NMuons]/D");
-  fOutputTree->Branch("pDCA",fpDCA,"pDCA[NMuons]/I");
-
-  fOutputTree->Branch("NDimu",&fNDimu,"NDimu/I");
-  fOutputTree->Branch("DimuMu",fDimuMu,"DimuMu[NDimu][2]/I");
-  fOutputTree->Branch("DimuPt",fDimuPt,"DimuPt[NDimu]/D");
-  fOutputTree->Branch("DimuPx",fDimuPx,"DimuPx[NDimu]/D");
-  fOutputTree->Branch("DimuPy",fDimuPy,"DimuPy[NDimu]/D");
-  fOutputTree->Branch("DimuPz",fDimuPz,"DimuPz[NDimu]/D");
-  fOutputTree->Branch("DimuY",fDimuY,"DimuY[NDimu]/D");
-  fOutputTree->Branch("DimuMass",fDimuMass,"DimuMass[NDimu]/D");
-  fOutputTree->Branch("DimuCharge",fDimuCharge,"DimuCharge[NDimu]/I");
-  fOutputTree->Branch("DimuMatch",fDimuMatch,"DimuMatch[NDimu]/I");
-  fOutputTree->Branch("DimuCostHE",fDimuCostHE,"DimuCostHE[NDimu]/D");
-  fOutputTree->Branch("DimuPhiHE",fDimuPhiHE,"DimuPhiHE[NDimu]/D");
-  fOutputTree->Branch("DimuCostCS",fDimuCostCS,"DimuCostCS[NDimu]/D");
-  fOutputTree->Branch("DimuPhiCS",fDimuPhiCS,"DimuPhiCS[NDimu]/D");
-  fOutputTree->Branch("DimuCostEPnB",fDimuCostEPnB,"DimuCostEPnB[NDimu]/D");
-  fOutputTree->Branch("DimuCostRPnB",fDimuCostRPnB,"DimuCostRPnB[NDimu]/D");
-  fOutputTree->Branch("IsPhysSelected",&fIsPhysSelected,"IsPhysSelected/O");
-
-  fOutputTree -> Branch("Psi2Trkl",&fPsi2Trkl,"Psi2Trkl/D");
-  fOutputTree -> Branch("Psi3Trkl",&fPsi3Trkl,"Psi3Trkl/D");
-  fOutputTree -> Branch("Psi2RP",&fPsi2RP,"Psi2RP/D");
-  fOutputTree -> Branch("DimuPhiEP",fDimuPhi,"DimuPhiEP[NDimu]/D");
-
+  fTreeWriter = new AliDimuonTreeWriter(fOutputTree,fCompactTree);
+
+  fTreeWriter->Branch("FiredTriggerClasses",fTrigClass,"FiredTriggerClasses/C");
+  fTreeWriter->Branch("inpmask",&finpmask,"inpmask/i");
+
+  fTreeWriter->Branch("NMuons",&fNMuons,"NMuons/I");
+  fTreeWriter->Branch("Vertex",fVertex,"Vertex[3]/D");
+  fTreeWriter->Branch("PercentV0M",&fPercentV0M,"PercentV0M/F");
+  fTreeWriter->Branch("PercentCL0",&fPercentCL0,"PercentCL0/F");
+  fTreeWriter->Branch("PercentCL1",&fPercentCL1,"PercentCL1/F");
+  fTreeWriter->Branch("PercentV0A",&fPercentV0A,"PercentV0A/F");
+  fTreeWriter->Branch("PercentV0C",&fPercentV0C,"PercentV0C/F");
+  fTreeWriter->Branch("PercentZNA",&fPercentZNA,"PercentZNA/F");
+  fTreeWriter->Branch("PercentZNC",&fPercentZNC,"PercentZNC/F");
+  fTreeWriter->Branch("NTracks",&fNTracks,"NTracks/I");
+
+  fTreeWriter->Branch("Pt",fPt,"Pt[NMuons]/D");
+  fTreeWriter->Branch("E",fE,"E[NMuons]/D");
+  fTreeWriter->Branch("Px",fPx,"Px[NMuons]/D");
+  fTreeWriter->Branch("Py",fPy,"Py[NMuons]/D");
+  fTreeWriter->Branch("Pz",fPz,"Pz[NMuons]/D");
+  fTreeWriter->Branch("Y",fY,"Y[NMuons]/D");
+  fTreeWriter->Branch("Eta",fEta,"Eta[NMuons]/D");
+  fTreeWriter->Branch("Phi",fPhi,"Phi[NMuons]/D");
+  fTreeWriter->BranchShort("MatchTrig",fMatchTrig,"MatchTrig[NMuons]/I",&fNMuons,1500);
+  fTreeWriter->Branch("TrackChi2",fTrackChi2,"TrackChi2[NMuons]/D");
+  fTreeWriter->Branch("MatchTrigChi2",fMatchTrigChi2,"MatchTrigChi2[NMuons]/D");
+  fTreeWriter->BranchShort("Charge",fCharge,"Charge[NMuons]/I",&fNMuons,1500);
+  fTreeWriter->Branch("RAtAbsEnd",fRAtAbsEnd,"RAtAbsEnd[NMuons]/D");
+  fTreeWriter->BranchShort("pDCA",fpDCA,"pDCA[NMuons]/I",&fNMuons,1500);
+
+  fTreeWriter->Branch("NDimu",&fNDimu,"NDimu/I");
+  fTreeWriter->BranchShort("DimuMu",fDimuMu[0],"DimuMu[NDimu][2]/I",&fNDimu,400,2);
+  fTreeWriter->Branch("DimuPt",fDimuPt,"DimuPt[NDimu]/D");
+  fTreeWriter->Branch("DimuPx",fDimuPx,"DimuPx[NDimu]/D");
+  fTreeWriter->Branch("DimuPy",fDimuPy,"DimuPy[NDimu]/D");
+  fTreeWriter->Branch("DimuPz",fDimuPz,"DimuPz[NDimu]/D");
+  fTreeWriter->Branch("DimuY",fDimuY,"DimuY[NDimu]/D");
+  fTreeWriter->Branch("DimuMass",fDimuMass,"DimuMass[NDimu]/D");
+  fTreeWriter->BranchShort("DimuCharge",fDimuCharge,"DimuCharge[NDimu]/I",&fNDimu,400);
+  fTreeWriter->BranchShort("DimuMatch",fDimuMatch,"DimuMatch[NDimu]/I",&fNDimu,400);
+  fTreeWriter->Branch("DimuCostHE",fDimuCostHE,"DimuCostHE[NDimu]/D");
+  fTreeWriter->Branch("DimuPhiHE",fDimuPhiHE,"DimuPhiHE[NDimu]/D");
+  fTreeWriter->Branch("DimuCostCS",fDimuCostCS,"DimuCostCS[NDimu]/D");
+  fTreeWriter->Branch("DimuPhiCS",fDimuPhiCS,"DimuPhiCS[NDimu]/D");
+  fTreeWriter->Branch("DimuCostEPnB",fDimuCostEPnB,"DimuCostEPnB[NDimu]/D");
+  fTreeWriter->Branch("DimuCostRPnB",fDimuCostRPnB,"DimuCostRPnB[NDimu]/D");
+  fTreeWriter->Branch("IsPhysSelected",&fIsPhysSelected,"IsPhysSelected/O");
+
+  fTreeWriter->Branch("Psi2Trkl",&fPsi2Trkl,"Psi2Trkl/D");
+  fTreeWriter->Branch("Psi3Trkl",&fPsi3Trkl,"Psi3Trkl/D");
+  fTreeWriter->Branch("Psi2RP",&fPsi2RP,"Psi2RP/D");
+  fTreeWriter->Branch("DimuPhiEP",fDimuPhi,"DimuPhiEP[NDimu]/D");
+
+  fTreeWriter->Configure(fTreeBasketSize,fTreeAutoFlush);
   fOutputTree->ls();
 
   PostData(1,fOutputTree);
@@ -759,7 +775,7 @@ void AliAnalysisTaskPbPbTree_MCut::UserExec(Option_t *)
   //
   // keep only events where there is at least one dimuon
   if(fNDimu>0){
-    fOutputTree->Fill();
+    fTreeWriter->Fill();
     PostData(1,fOutputTree);
   }
 
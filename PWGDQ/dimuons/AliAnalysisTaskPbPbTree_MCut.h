@@ -9,6 +9,7 @@
 
 class TObjArray;
 class AliVParticle;
+class AliDimuonTreeWriter;
 class AliAODEvent;
 class TLorentzVector;
 class AliMuonTrackCuts;
@@ -34,6 +35,9 @@ class AliAnalysisTaskPbPbTree_MCut: public AliAnalysisTaskSE {
   void SetMassCut(Double_t MassCut) {fMassCut=MassCut;}
   void SetAnalysisType(const char* type) {fkAnalysisType=type;}
   void SetPeriod(TString period) {fPeriod=period;}
+  void SetCompactTree(Bool_t compact=kTRUE) {fCompactTree=compact;}
+  void SetTreeBasketSize(Int_t size) {fTreeBasketSize=size;}
+  void SetTreeAutoFlush(Long64_t autoFlush) {fTreeAutoFlush=autoFlush;}
 
  private:
   AliAnalysisTaskPbPbTree_MCut(const AliAnalysisTaskPbPbTree_MCut&);
@@ -123,7 +127,12 @@ class AliAnalysisTaskPbPbTree_MCut: public AliAnalysisTaskSE {
   Double_t      fDimuCostRPnB[400]; // cost Random-Plane (not boosted)
   Int_t		fDimuMu[400][2];	        // reference to single mus
 
- ClassDef(AliAnalysisTaskPbPbTree_MCut,3);
+  Bool_t        fCompactTree;     // store the tree columns in compact form (see AliDimuonTreeWriter)
+  Int_t         fTreeBasketSize;  // basket size of the tree branches (0: ROOT default)
+  Long64_t      fTreeAutoFlush;   // auto-flush of the tree (0: ROOT default)
+  AliDimuonTreeWriter *fTreeWriter; //! books and fills the tree
+
+ ClassDef(AliAnalysisTaskPbPbTree_MCut,4);
 };
 
 #endif
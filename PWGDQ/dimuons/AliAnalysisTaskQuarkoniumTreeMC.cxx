@@ -45,6 +45,7 @@
 #include "AliAnalysisTaskSE.h"
 #include "AliMultSelection.h" 
 #include "AliAODMCParticle.h"
+#include "AliDimuonTreeWriter.h"
 #include "AliAnalysisTaskQuarkoniumTreeMC.h"
 
 Double_t CostHE_MC(AliAODMCParticle*, AliAODMCParticle*);
@@ -69,7 +70,11 @@ AliAnalysisTaskQuarkoniumTreeMC::AliAnalysisTaskQuarkoniumTreeMC() :
   fNDimu_gen(0x0),
   fNMuons_rec(0x0),
   fNDimu_rec(0x0),
-  fAODEvent(0x0)
+  fAODEvent(0x0),
+  fCompactTree(kFALSE),
+  fTreeBasketSize(0),
+  fTreeAutoFlush(0),
+  fTreeWriter(0x0)
 {
   //
   //Default ctor
@@ -134,7 +139,11 @@ AliAnalysisTaskQuarkoniumTreeMC::AliAnalysisTaskQuarkoniumTreeMC(const char *nam
   fNDimu_gen(0x0),
   fNMuons_rec(0x0),
   fNDimu_rec(0x0),
-  fAODEvent(0x0)
+  fAODEvent(0x0),
+  fCompactTree(kFALSE),
+  fTreeBasketSize(0),
+  fTreeAutoFlush(0),
+  fTreeWriter(0x0)
 {
   //
   // Constructor. Initialization of Inputs and Outputs
@@ -214,7 +223,11 @@ AliAnalysisTaskQuarkoniumTreeMC::AliAnalysisTaskQuarkoniumTreeMC(const AliAnalys
   fNDimu_gen(c.fNDimu_gen),
   fNMuons_rec(c.fNMuons_rec),
   fNDimu_rec(c.fNDimu_rec),
-  fAODEvent(c.fAODEvent)
+  fAODEvent(c.fAODEvent),
+  fCompactTree(c.fCompactTree),
+  fTreeBasketSize(c.fTreeBasketSize),
+  fTreeAutoFlush(c.fTreeAutoFlush),
+  fTreeWriter(0x0)
  {
   //
   // Copy Constructor									
@@ -228,6 +241,7 @@ AliAnalysisTaskQuarkoniumTreeMC::~AliAnalysisTaskQuarkoniumTreeMC() {
   //
   Info("~AliAnalysisTaskQuarkoniumTreeMC","Calling Destructor");
   if (AliAnalysisManager::GetAnalysisManager()->GetAnalysisType() != AliAnalysisManager::kProofAnalysis) delete fOutputTree;
+  delete fTreeWriter;
 }
 
 
@@ -238,52 +252,54 @@ void AliAnalysisTaskQuarkoniumTreeMC::UserCreateOutputObjects(){
    
   OpenFile(1,"RECREATE");
   fOutputTree = new TTree("MCTree","Data Tree");
-
-  fOutputTree->Branch("NMuons_gen",&fNMuons_gen,"NMuons_gen/I");
-  fOutputTree->Branch("NDimu_gen",&fNDimu_gen,"NDimu_gen/I");
-  fOutputTree->Branch("DimuPt_gen",fDimuPt_gen,"DimuPt_gen[NDimu_gen]/D");
-  fOutputTree->Branch("DimuPx_gen",fDimuPx_gen,"DimuPx_gen[NDimu_gen]/D");
-  fOutputTree->Branch("DimuPy_gen",fDimuPy_gen,"DimuPy_gen[NDimu_gen]/D");
-  fOutputTree->Branch("DimuPz_gen",fDimuPz_gen,"DimuPz_gen[NDimu_gen]/D");
-  fOutputTree->Branch("DimuY_gen",fDimuY_gen,"DimuY_gen[NDimu_gen]/D");
-  fOutputTree->Branch("DimuMass_gen",fDimuMass_gen,"DimuMass_gen[NDimu_gen]/D");
-  fOutputTree->Branch("DimuCharge_gen",fDimuCharge_gen,"DimuCharge_gen[NDimu_gen]/I");
-  fOutputTree->Branch("DimuMatch_gen",fDimuMatch_gen,"DimuMatch_gen[NDimu_gen]/I");
-  fOutputTree->Branch("DimuCostHE_gen",fDimuCostHE_gen,"DimuCostHE_gen[NDimu_gen]/D");
-  fOutputTree->Branch("DimuPhiHE_gen",fDimuPhiHE_gen,"DimuPhiHE_gen[NDimu_gen]/D");
-  fOutputTree->Branch("DimuCostCS_gen",fDimuCostCS_gen,"DimuCostCS_gen[NDimu_gen]/D");
-  fOutputTree->Branch("DimuPhiCS_gen",fDimuPhiCS_gen,"DimuPhiCS_gen[NDimu_gen]/D");
-
-  fOutputTree->Branch("NMuons_rec",&fNMuons_rec,"NMuons_rec/I");
-  fOutputTree->Branch("Pt_rec",fPt_rec,"Pt_rec[NMuons_rec]/D");
-  fOutputTree->Branch("E_rec",fE_rec,"E_rec[NMuons_rec]/D");
-  fOutputTree->Branch("Px_rec",fPx_rec,"Px_rec[NMuons_rec]/D");
-  fOutputTree->Branch("Py_rec",fPy_rec,"Py_rec[NMuons_rec]/D");
-  fOutputTree->Branch("Pz_rec",fPz_rec,"Pz_rec[NMuons_rec]/D");
-  fOutputTree->Branch("Y_rec",fY_rec,"Y_rec[NMuons_rec]/D");
-  fOutputTree->Branch("Eta_rec",fEta_rec,"Eta_rec[NMuons_rec]/D");
-  fOutputTree->Branch("MatchTrig_rec",fMatchTrig_rec,"MatchTrig_rec[NMuons_rec]/I");
-  fOutputTree->Branch("TrackChi2_rec",fTrackChi2_rec,"TrackChi2_rec[NMuons_rec]/D");
-  fOutputTree->Branch("MatchTrigChi2_rec",fMatchTrigChi2_rec,"MatchTrigChi2_rec[NMuons_rec]/D");
-  fOutputTree->Branch("Charge_rec",fCharge_rec,"Charge_rec[NMuons_rec]/I");
-  fOutputTree->Branch("RAtAbsEnd_rec",fRAtAbsEnd_rec,"RAtAbsEnd_rec[NMuons_rec]/D");
+  fTreeWriter = new AliDimuonTreeWriter(fOutputTree,fCompactTree);
+
+  fTreeWriter->Branch("NMuons_gen",&fNMuons_gen,"NMuons_gen/I");
+  fTreeWriter->Branch("NDimu_gen",&fNDimu_gen,"NDimu_gen/I");
+  fTreeWriter->Branch("DimuPt_gen",fDimuPt_gen,"DimuPt_gen[NDimu_gen]/D");
+  fTreeWriter->Branch("DimuPx_gen",fDimuPx_gen,"DimuPx_gen[NDimu_gen]/D");
+  fTreeWriter->Branch("DimuPy_gen",fDimuPy_gen,"DimuPy_gen[NDimu_gen]/D");
+  fTreeWriter->Branch("DimuPz_gen",fDimuPz_gen,"DimuPz_gen[NDimu_gen]/D");
+  fTreeWriter->Branch("DimuY_gen",fDimuY_gen,"DimuY_gen[NDimu_gen]/D");
+  fTreeWriter->Branch("DimuMass_gen",fDimuMass_gen,"DimuMass_gen[NDimu_gen]/D");
+  fTreeWriter->BranchShort("DimuCharge_gen",fDimuCharge_gen,"DimuCharge_gen[NDimu_gen]/I",&fNDimu_gen,1000);
+  fTreeWriter->BranchShort("DimuMatch_gen",fDimuMatch_gen,"DimuMatch_gen[NDimu_gen]/I",&fNDimu_gen,1000);
+  fTreeWriter->Branch("DimuCostHE_gen",fDimuCostHE_gen,"DimuCostHE_gen[NDimu_gen]/D");
+  fTreeWriter->Branch("DimuPhiHE_gen",fDimuPhiHE_gen,"DimuPhiHE_gen[NDimu_gen]/D");
+  fTreeWriter->Branch("DimuCostCS_gen",fDimuCostCS_gen,"DimuCostCS_gen[NDimu_gen]/D");
+  fTreeWriter->Branch("DimuPhiCS_gen",fDimuPhiCS_gen,"DimuPhiCS_gen[NDimu_gen]/D");
+
+  fTreeWriter->Branch("NMuons_rec",&fNMuons_rec,"NMuons_rec/I");
+  fTreeWriter->Branch("Pt_rec",fPt_rec,"Pt_rec[NMuons_rec]/D");
+  fTreeWriter->Branch("E_rec",fE_rec,"E_rec[NMuons_rec]/D");
+  fTreeWriter->Branch("Px_rec",fPx_rec,"Px_rec[NMuons_rec]/D");
+  fTreeWriter->Branch("Py_rec",fPy_rec,"Py_rec[NMuons_rec]/D");
+  fTreeWriter->Branch("Pz_rec",fPz_rec,"Pz_rec[NMuons_rec]/D");
+  fTreeWriter->Branch("Y_rec",fY_rec,"Y_rec[NMuons_rec]/D");
+  fTreeWriter->Branch("Eta_rec",fEta_rec,"Eta_rec[NMuons_rec]/D");
+  fTreeWriter->BranchShort("MatchTrig_rec",fMatchTrig_rec,"MatchTrig_rec[NMuons_rec]/I",&fNMuons_rec,100);
+  fTreeWriter->Branch("TrackChi2_rec",fTrackChi2_rec,"TrackChi2_rec[NMuons_rec]/D");
+  fTreeWriter->Branch("MatchTrigChi2_rec",fMatchTrigChi2_rec,"MatchTrigChi2_rec[NMuons_rec]/D");
+  fTreeWriter->BranchShort("Charge_rec",fCharge_rec,"Charge_rec[NMuons_rec]/I",&fNMuons_rec,100);
+  fTreeWriter->Branch("RAtAbsEnd_rec",fRAtAbsEnd_rec,"RAtAbsEnd_rec[NMuons_rec]/D");
  
-  fOutputTree->Branch("NDimu_rec",&fNDimu_rec,"NDimu_rec/I");
-  fOutputTree->Branch("DimuMu_rec",fDimuMu_rec,"DimuMu_rec[NDimu_rec][2]/I");
-  fOutputTree->Branch("DimuPt_rec",fDimuPt_rec,"DimuPt_rec[NDimu_rec]/D");
-  fOutputTree->Branch("DimuPx_rec",fDimuPx_rec,"DimuPx_rec[NDimu_rec]/D");
-  fOutputTree->Branch("DimuPy_rec",fDimuPy_rec,"DimuPy_rec[NDimu_rec]/D");
-  fOutputTree->Branch("DimuPz_rec",fDimuPz_rec,"DimuPz_rec[NDimu_rec]/D");
-  fOutputTree->Branch("DimuY_rec",fDimuY_rec,"DimuY_rec[NDimu_rec]/D");
-  fOutputTree->Branch("DimuMass_rec",fDimuMass_rec,"DimuMass_rec[NDimu_rec]/D");
-  fOutputTree->Branch("DimuCharge_rec",fDimuCharge_rec,"DimuCharge_rec[NDimu_rec]/I");
-  fOutputTree->Branch("DimuMatch_rec",fDimuMatch_rec,"DimuMatch_rec[NDimu_rec]/I");
-  fOutputTree->Branch("DimuCostHE_rec",fDimuCostHE_rec,"DimuCostHE_rec[NDimu_rec]/D");
-  fOutputTree->Branch("DimuPhiHE_rec",fDimuPhiHE_rec,"DimuPhiHE_rec[NDimu_rec]/D");
-  fOutputTree->Branch("DimuCostCS_rec",fDimuCostCS_rec,"DimuCostCS_rec[NDimu_rec]/D");
-  fOutputTree->Branch("DimuPhiCS_rec",fDimuPhiCS_rec,"DimuPhiCS_rec[NDimu_rec]/D");
-
-
+  fTreeWriter->Branch("NDimu_rec",&fNDimu_rec,"NDimu_rec/I");
+  fTreeWriter->Branch("DimuMu_rec",fDimuMu_rec,"DimuMu_rec[NDimu_rec][2]/I");
+  fTreeWriter->Branch("DimuPt_rec",fDimuPt_rec,"DimuPt_rec[NDimu_rec]/D");
+  fTreeWriter->Branch("DimuPx_rec",fDimuPx_rec,"DimuPx_rec[NDimu_rec]/D");
+  fTreeWriter->Branch("DimuPy_rec",fDimuPy_rec,"DimuPy_rec[NDimu_rec]/D");
+  fTreeWriter->Branch("DimuPz_rec",fDimuPz_rec,"DimuPz_rec[NDimu_rec]/D");
+  fTreeWriter->Branch("DimuY_rec",fDimuY_rec,"DimuY_rec[NDimu_rec]/D");
+  fTreeWriter->Branch("DimuMass_rec",fDimuMass_rec,"DimuMass_rec[NDimu_rec]/D");
+  fTreeWriter->BranchShort("DimuCharge_rec",fDimuCharge_rec,"DimuCharge_rec[NDimu_rec]/I",&fNDimu_rec,1000);
+  fTreeWriter->BranchShort("DimuMatch_rec",fDimuMatch_rec,"DimuMatch_rec[NDimu_rec]/I",&fNDimu_rec,1000);
+  fTreeWriter->Branch("DimuCostHE_rec",fDimuCostHE_rec,"DimuCostHE_rec[NDimu_rec]/D");
+  fTreeWriter->Branch("DimuPhiHE_rec",fDimuPhiHE_rec,"DimuPhiHE_rec[NDimu_rec]/D");
+  fTreeWriter->Branch("DimuCostCS_rec",fDimuCostCS_rec,"DimuCostCS_rec[NDimu_rec]/D");
+  fTreeWriter->Branch("DimuPhiCS_rec",fDimuPhiCS_rec,"DimuPhiCS_rec[NDimu_rec]/D");
+
+
+  fTreeWriter->Configure(fTreeBasketSize,fTreeAutoFlush);
   fOutputTree->ls(); 
 
   PostData(1,fOutputTree); 
@@ -479,7 +495,7 @@ void AliAnalysisTaskQuarkoniumTreeMC::UserExec(Option_t *)
        }
        fNMuons_rec =nummu;
        fNDimu_rec=numdimu;     
-       fOutputTree->Fill();
+       fTreeWriter->Fill();
        PostData(1,fOutputTree);
   
 }
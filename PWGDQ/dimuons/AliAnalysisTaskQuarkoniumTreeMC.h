@@ -9,6 +9,7 @@
 
 class TObjArray;
 class AliVParticle;
+class AliDimuonTreeWriter;
 class AliAODEvent;
 class TLorentzVector;
 
@@ -28,6 +29,9 @@ class AliAnalysisTaskQuarkoniumTreeMC : public AliAnalysisTaskSE {
   void SetResonance(TString resonance) {fResonance=resonance;}
   void SetAnalysisType(const char* type) {fkAnalysisType=type;}
   void SetPeriod(TString period) {fPeriod=period;}
+  void SetCompactTree(Bool_t compact=kTRUE) {fCompactTree=compact;}
+  void SetTreeBasketSize(Int_t size) {fTreeBasketSize=size;}
+  void SetTreeAutoFlush(Long64_t autoFlush) {fTreeAutoFlush=autoFlush;}
     
  private:
   AliAnalysisTaskQuarkoniumTreeMC(const AliAnalysisTaskQuarkoniumTreeMC&);
@@ -89,7 +93,12 @@ class AliAnalysisTaskQuarkoniumTreeMC : public AliAnalysisTaskSE {
 
   AliAODEvent* fAODEvent;      //! AOD event  //tolgo !
   
- ClassDef(AliAnalysisTaskQuarkoniumTreeMC,1);
+  Bool_t        fCompactTree;     // store the tree columns in compact form (see AliDimuonTreeWriter)
+  Int_t         fTreeBasketSize;  // basket size of the tree branches (0: ROOT default)
+  Long64_t      fTreeAutoFlush;   // auto-flush of the tree (0: ROOT default)
+  AliDimuonTreeWriter *fTreeWriter; //! books and fills the tree
+
+ ClassDef(AliAnalysisTaskQuarkoniumTreeMC,2);
 };
 
 #endif
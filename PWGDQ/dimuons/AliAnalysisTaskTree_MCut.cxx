@@ -52,6 +52,7 @@
 #include "AliAnalysisTaskSE.h"
 #include "AliMuonTrackCuts.h"   
 
+#include "AliDimuonTreeWriter.h"
 #include "AliAnalysisTaskTree_MCut.h"
 
 Double_t CostHE(AliAODTrack*, AliAODTrack*);
@@ -84,7 +85,11 @@ AliAnalysisTaskTree_MCut::AliAnalysisTaskTree_MCut() :
   fAODEvent(0x0),
 //  fTrigClass(0x0),
   finpmask(0),
-  fNTracks(0x0)
+  fNTracks(0x0),
+  fCompactTree(kFALSE),
+  fTreeBasketSize(0),
+  fTreeAutoFlush(0),
+  fTreeWriter(0x0)
 {
   //
   //Default ctor
@@ -152,7 +157,11 @@ AliAnalysisTaskTree_MCut::AliAnalysisTaskTree_MCut(const char *name) :
   fAODEvent(0x0),
 //  fTrigClass(0x0),
   finpmask(0),
-  fNTracks(0x0)
+  fNTracks(0x0),
+  fCompactTree(kFALSE),
+  fTreeBasketSize(0),
+  fTreeAutoFlush(0),
+  fTreeWriter(0x0)
 {
   //
   // Constructor. Initialization of Inputs and Outputs
@@ -238,7 +247,11 @@ AliAnalysisTaskTree_MCut::AliAnalysisTaskTree_MCut(const AliAnalysisTaskTree_MCu
 //  fTrigClass(c.fTrigClass),
   finpmask(c.finpmask),
   fMuonTrackCuts(c.fMuonTrackCuts) ,
-  fNTracks(c.fNTracks)
+  fNTracks(c.fNTracks),
+  fCompactTree(c.fCompactTree),
+  fTreeBasketSize(c.fTreeBasketSize),
+  fTreeAutoFlush(c.fTreeAutoFlush),
+  fTreeWriter(0x0)
 
  {
   //
@@ -253,6 +266,7 @@ AliAnalysisTaskTree_MCut::~AliAnalysisTaskTree_MCut() {
   //
   Info("~AliAnalysisTaskTree_MCut","Calling Destructor");
   if (AliAnalysisManager::GetAnalysisManager()->GetAnalysisType() != AliAnalysisManager::kProofAnalysis) delete fOutputTree;
+  delete fTreeWriter;
 }
 
 //___________________________________________________________________________
@@ -268,46 +282,47 @@ void AliAnalysisTaskTree_MCut::UserCreateOutputObjects(){
   if (fOutputTree) return; 
    
   fOutputTree = new TTree("ppTree","Data Tree");
-
-  fOutputTree->Branch("FiredTriggerClasses",fTrigClass,"FiredTriggerClasses/C");
-  fOutputTree->Branch("inpmask",&finpmask,"inpmask/i"); 
-
-  fOutputTree->Branch("NMuons",&fNMuons,"NMuons/I");
-  fOutputTree->Branch("Vertex",fVertex,"Vertex[3]/D");
-  fOutputTree->Branch("NTracks",&fNTracks,"NTracks/I");
-
-  fOutputTree->Branch("Pt",fPt,"Pt[NMuons]/D");
-  fOutputTree->Branch("E",fE,"E[NMuons]/D");
-  fOutputTree->Branch("Px",fPx,"Px[NMuons]/D");
-  fOutputTree->Branch("Py",fPy,"Py[NMuons]/D");
-  fOutputTree->Branch("Pz",fPz,"Pz[NMuons]/D");
-  fOutputTree->Branch("Pt",fPt,"Pt[NMuons]/D");
-  fOutputTree->Branch("Y",fY,"Y[NMuons]/D");
-  fOutputTree->Branch("Eta",fEta,"Eta[NMuons]/D");
-  fOutputTree->Branch("Phi",fPhi,"Phi[NMuons]/D");
-  fOutputTree->Branch("MatchTrig",fMatchTrig,"MatchTrig[NMuons]/I");
-  fOutputTree->Branch("TrackChi2",fTrackChi2,"TrackChi2[NMuons]/D");
-  fOutputTree->Branch("MatchTrigChi2",fMatchTrigChi2,"MatchTrigChi2[NMuons]/D");
-  fOutputTree->Branch("Charge",fCharge,"Charge[NMuons]/I");
-  fOutputTree->Branch("RAtAbsEnd",fRAtAbsEnd,"RAtAbsEnd[NMuons]/D");
-  fOutputTree->Branch("pDCA",fpDCA,"pDCA[NMuons]/I");  
-
-  fOutputTree->Branch("NDimu",&fNDimu,"NDimu/I");
-  fOutputTree->Branch("DimuMu",fDimuMu,"DimuMu[NDimu][2]/I");
-  fOutputTree->Branch("DimuPt",fDimuPt,"DimuPt[NDimu]/D");
-  fOutputTree->Branch("DimuPx",fDimuPx,"DimuPx[NDimu]/D");
-  fOutputTree->Branch("DimuPy",fDimuPy,"DimuPy[NDimu]/D");
-  fOutputTree->Branch("DimuPz",fDimuPz,"DimuPz[NDimu]/D");
-  fOutputTree->Branch("DimuY",fDimuY,"DimuY[NDimu]/D");
-  fOutputTree->Branch("DimuMass",fDimuMass,"DimuMass[NDimu]/D");
-  fOutputTree->Branch("DimuCharge",fDimuCharge,"DimuCharge[NDimu]/I");
-  fOutputTree->Branch("DimuMatch",fDimuMatch,"DimuMatch[NDimu]/I");
-  fOutputTree->Branch("DimuCostHE",fDimuCostHE,"DimuCostHE[NDimu]/D");
-  fOutputTree->Branch("DimuPhiHE",fDimuPhiHE,"DimuPhiHE[NDimu]/D");
-  fOutputTree->Branch("DimuCostCS",fDimuCostCS,"DimuCostCS[NDimu]/D");
-  fOutputTree->Branch("DimuPhiCS",fDimuPhiCS,"DimuPhiCS[NDimu]/D");
-  fOutputTree->Branch("IsPhysSelected",&fIsPhysSelected,"IsPhysSelected/O");
-
+  fTreeWriter = new AliDimuonTreeWriter(fOutputTree,fCompactTree);
+
+  fTreeWriter->Branch("FiredTriggerClasses",fTrigClass,"FiredTriggerClasses/C");
+  fTreeWriter->Branch("inpmask",&finpmask,"inpmask/i"); 
+
+  fTreeWriter->Branch("NMuons",&fNMuons,"NMuons/I");
+  fTreeWriter->Branch("Vertex",fVertex,"Vertex[3]/D");
+  fTreeWriter->Branch("NTracks",&fNTracks,"NTracks/I");
+
+  fTreeWriter->Branch("Pt",fPt,"Pt[NMuons]/D");
+  fTreeWriter->Branch("E",fE,"E[NMuons]/D");
+  fTreeWriter->Branch("Px",fPx,"Px[NMuons]/D");
+  fTreeWriter->Branch("Py",fPy,"Py[NMuons]/D");
+  fTreeWriter->Branch("Pz",fPz,"Pz[NMuons]/D");
+  fTreeWriter->Branch("Y",fY,"Y[NMuons]/D");
+  fTreeWriter->Branch("Eta",fEta,"Eta[NMuons]/D");
+  fTreeWriter->Branch("Phi",fPhi,"Phi[NMuons]/D");
+  fTreeWriter->BranchShort("MatchTrig",fMatchTrig,"MatchTrig[NMuons]/I",&fNMuons,1500);
+  fTreeWriter->Branch("TrackChi2",fTrackChi2,"TrackChi2[NMuons]/D");
+  fTreeWriter->Branch("MatchTrigChi2",fMatchTrigChi2,"MatchTrigChi2[NMuons]/D");
+  fTreeWriter->BranchShort("Charge",fCharge,"Charge[NMuons]/I",&fNMuons,1500);
+  fTreeWriter->Branch("RAtAbsEnd",fRAtAbsEnd,"RAtAbsEnd[NMuons]/D");
+  fTreeWriter->BranchShort("pDCA",fpDCA,"pDCA[NMuons]/I",&fNMuons,1500);  
+
+  fTreeWriter->Branch("NDimu",&fNDimu,"NDimu/I");
+  fTreeWriter->BranchShort("DimuMu",fDimuMu[0],"DimuMu[NDimu][2]/I",&fNDimu,400,2);
+  fTreeWriter->Branch("DimuPt",fDimuPt,"DimuPt[NDimu]/D");
+  fTreeWriter->Branch("DimuPx",fDimuPx,"DimuPx[NDimu]/D");
+  fTreeWriter->Branch("DimuPy",fDimuPy,"DimuPy[NDimu]/D");
+  fTreeWriter->Branch("DimuPz",fDimuPz,"DimuPz[NDimu]/D");
+  fTreeWriter->Branch("DimuY",fDimuY,"DimuY[NDimu]/D");
+  fTreeWriter->Branch("DimuMass",fDimuMass,"DimuMass[NDimu]/D");
+  fTreeWriter->BranchShort("DimuCharge",fDimuCharge,"DimuCharge[NDimu]/I",&fNDimu,400);
+  fTreeWriter->BranchShort("DimuMatch",fDimuMatch,"DimuMatch[NDimu]/I",&fNDimu,400);
+  fTreeWriter->Branch("DimuCostHE",fDimuCostHE,"DimuCostHE[NDimu]/D");
+  fTreeWriter->Branch("DimuPhiHE",fDimuPhiHE,"DimuPhiHE[NDimu]/D");
+  fTreeWriter->Branch("DimuCostCS",fDimuCostCS,"DimuCostCS[NDimu]/D");
+  fTreeWriter->Branch("DimuPhiCS",fDimuPhiCS,"DimuPhiCS[NDimu]/D");
+  fTreeWriter->Branch("IsPhysSelected",&fIsPhysSelected,"IsPhysSelected/O");
+
+  fTreeWriter->Configure(fTreeBasketSize,fTreeAutoFlush);
   fOutputTree->ls(); 
 
   PostData(1,fOutputTree); 
@@ -529,7 +544,7 @@ void AliAnalysisTaskTree_MCut::UserExec(Option_t *)
   //
   // keep only events where there is at least one dimuon
   if(fNDimu>0){
-    fOutputTree->Fill();
+    fTreeWriter->Fill();
     PostData(1,fOutputTree);
   } 
 
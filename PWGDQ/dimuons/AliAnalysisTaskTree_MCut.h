@@ -9,6 +9,7 @@
 
 class TObjArray;
 class AliVParticle;
+class AliDimuonTreeWriter;
 class AliAODEvent;
 class TLorentzVector;
 class AliMuonTrackCuts;
@@ -31,6 +32,9 @@ class AliAnalysisTaskTree_MCut: public AliAnalysisTaskSE {
   void SetMassCut(Double_t MassCut) {fMassCut=MassCut;}
   void SetAnalysisType(const char* type) {fkAnalysisType=type;}
   void SetPeriod(TString period) {fPeriod=period;}
+  void SetCompactTree(Bool_t compact=kTRUE) {fCompactTree=compact;}
+  void SetTreeBasketSize(Int_t size) {fTreeBasketSize=size;}
+  void SetTreeAutoFlush(Long64_t autoFlush) {fTreeAutoFlush=autoFlush;}
     
  private:
   AliAnalysisTaskTree_MCut(const AliAnalysisTaskTree_MCut&);
@@ -99,7 +103,12 @@ class AliAnalysisTaskTree_MCut: public AliAnalysisTaskSE {
   
   
   
- ClassDef(AliAnalysisTaskTree_MCut,3);
+  Bool_t        fCompactTree;     // store the tree columns in compact form (see AliDimuonTreeWriter)
+  Int_t         fTreeBasketSize;  // basket size of the tree branches (0: ROOT default)
+  Long64_t      fTreeAutoFlush;   // auto-flush of the tree (0: ROOT default)
+  AliDimuonTreeWriter *fTreeWriter; //! books and fills the tree
+
+ ClassDef(AliAnalysisTaskTree_MCut,4);
 };
 
 #endif
@@ -0,0 +1,107 @@
+/**************************************************************************
+ * Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+//-----------------------------------------------------------------------------
+// Booking and filling of the single muon / dimuon trees, see the header
+//-----------------------------------------------------------------------------
+
+#include "TString.h"
+#include "TTree.h"
+
+#include "AliDimuonTreeWriter.h"
+
+//__________________________________________________________________________
+AliDimuonTreeWriter::AliDimuonTreeWriter(TTree *tree, Bool_t compact) :
+  fTree(tree),
+  fCompact(compact),
+  fShorts()
+{
+  //
+  //constructor
+  //
+}
+
+//__________________________________________________________________________
+AliDimuonTreeWriter::~AliDimuonTreeWriter()
+{
+  //
+  //destructor, the tree is not owned
+  //
+  for(UInt_t i=0;i<fShorts.size();i++) delete [] fShorts[i].fBuffer;
+}
+
+//__________________________________________________________________________
+void AliDimuonTreeWriter::Branch(const char *name, void *address, const char *leaflist)
+{
+  //
+  // book a branch, in compact mode the Double_t leaves are stored as Double32_t
+  //
+  TString leaves(leaflist);
+  if(fCompact && leaves.EndsWith("/D")) leaves[leaves.Length()-1] = 'd';
+  fTree->Branch(name,address,leaves.Data());
+}
+
+//__________________________________________________________________________
+void AliDimuonTreeWriter::BranchShort(const char *name, Int_t *values, const char *leaflist, const Int_t *count, Int_t maxEntries, Int_t width)
+{
+  //
+  // book a branch of Int_t values (leaflist "/I"), with count entries of width
+  // values each (maxEntries if count is 0x0). In compact mode the values are
+  // stored as Short_t and must be within [-32768,32767]
+  //
+  TString leaves(leaflist);
+  if(!fCompact || !leaves.EndsWith("/I")){
+    fTree->Branch(name,values,leaves.Data());
+    return;
+  }
+  leaves[leaves.Length()-1] = 'S';
+
+  ShortColumn column;
+  column.fValues = values;
+  column.fCount = count;
+  column.fWidth = width;
+  column.fMax = maxEntries;
+  column.fBuffer = new Short_t[maxEntries*width];
+  fShorts.push_back(column);
+
+  fTree->Branch(name,column.fBuffer,leaves.Data());
+}
+
+//__________________________________________________________________________
+void AliDimuonTreeWriter::Configure(Int_t basketSize, Long64_t autoFlush)
+{
+  //
+  // basket size of all the branches and auto-flush of the tree (see
+  // TTree::SetAutoFlush), to be called once all the branches are booked
+  //
+  if(basketSize>0) fTree->SetBasketSize("*",basketSize);
+  if(autoFlush!=0) fTree->SetAutoFlush(autoFlush);
+}
+
+//__________________________________________________________________________
+Int_t AliDimuonTreeWriter::Fill()
+{
+  //
+  // convert the Short_t columns and fill the tree
+  //
+  for(UInt_t i=0;i<fShorts.size();i++){
+    const ShortColumn &column = fShorts[i];
+    Int_t n = column.fCount ? *column.fCount : column.fMax;
+    if(n>column.fMax) n = column.fMax;
+    n *= column.fWidth;
+    for(Int_t k=0;k<n;k++) column.fBuffer[k] = (Short_t) column.fValues[k];
+  }
+  return fTree->Fill();
+}
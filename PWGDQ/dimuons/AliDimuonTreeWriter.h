@@ -0,0 +1,61 @@
+#ifndef AliDimuonTreeWriter_H
+#define AliDimuonTreeWriter_H
+
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+//-----------------------------------------------------------------------------
+// Helper to book and fill the single muon / dimuon trees of the
+// PWGDQ/dimuons tree tasks.
+//
+// By default the branches are booked exactly as with TTree::Branch.
+// In compact mode:
+//  - the Double_t columns ("/D") are stored as Double32_t ("/d"), i.e. with
+//    float precision on disk, the arrays in memory are unchanged
+//  - the Int_t columns of small values (trigger matching, charge, pDCA,
+//    muon indices of the dimuons) booked with BranchShort are stored as
+//    Short_t ("/S"), converted from the Int_t arrays of the task in Fill()
+// The basket size and the auto-flush of the tree can be set for the reading
+// downstream (e.g. with RDataFrame), 0 keeps the ROOT defaults.
+//-----------------------------------------------------------------------------
+
+#include <vector>
+
+#include "Rtypes.h"
+
+class TTree;
+
+class AliDimuonTreeWriter {
+  public:
+
+  AliDimuonTreeWriter(TTree *tree, Bool_t compact);
+  virtual ~AliDimuonTreeWriter();
+
+  void Branch(const char *name, void *address, const char *leaflist);
+  void BranchShort(const char *name, Int_t *values, const char *leaflist, const Int_t *count, Int_t maxEntries, Int_t width = 1);
+
+  void Configure(Int_t basketSize, Long64_t autoFlush);
+
+  Int_t Fill();
+
+  Bool_t IsCompact() const {return fCompact;}
+  TTree *GetTree() const {return fTree;}
+
+ private:
+  AliDimuonTreeWriter(const AliDimuonTreeWriter&);
+  AliDimuonTreeWriter& operator=(const AliDimuonTreeWriter&);
+
+  struct ShortColumn {
+    const Int_t *fValues;   // values in the task (Int_t)
+    const Int_t *fCount;    // number of entries (0x0 for a fixed size column)
+    Int_t        fWidth;    // values per entry
+    Int_t        fMax;      // maximum number of entries
+    Short_t     *fBuffer;   // values written to the tree (Short_t)
+  };
+
+  TTree                   *fTree;     // tree (not owned)
+  Bool_t                   fCompact;  // compact storage of the floating point and small integer columns
+  std::vector<ShortColumn> fShorts;   // Short_t columns converted in Fill()
+};
+
+#endif
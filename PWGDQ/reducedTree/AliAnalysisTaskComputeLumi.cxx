@@ -27,6 +27,7 @@
 #include <TBits.h>
 #include <TRandom.h>
 #include <TTimeStamp.h>
+#include <TTree.h>
 
 #include <AliAnalysisTaskSE.h>
 #include <AliInputEventHandler.h>
@@ -71,11 +72,20 @@ AliAnalysisTaskComputeLumi::AliAnalysisTaskComputeLumi() :
   fTrigAliasVsCentV0M_acc(0x0),
   fL0TriggerInputsVsCent_acc(0x0),
   fL0TriggerInputsVsTrigAlias_acc(0x0),
-  fVtxVsCentV0_acc(0x0)
+  fVtxVsCentV0_acc(0x0),
+  fWriteLumiIndex(kFALSE),
+  fLumiIndex(0x0),
+  fIndexRun(-1),
+  fIndexTimeMin(0),
+  fIndexTimeMax(0)
 {
   //
   // Constructor
   //
+  for(Int_t i=0; i<2; ++i) fIndexEvents[i] = 0;
+  for(Int_t i=0; i<2*kNAliases; ++i) fIndexTrigAliases[i] = 0;
+  for(Int_t i=0; i<2*kNL0Inputs; ++i) fIndexL0Inputs[i] = 0;
+  for(Int_t i=0; i<2*kNTrigClasses; ++i) fIndexTrigClasses[i] = 0;
 }
 
 //_________________________________________________________________________________
@@ -91,11 +101,20 @@ AliAnalysisTaskComputeLumi::AliAnalysisTaskComputeLumi(const char *name) :
   fTrigAliasVsCentV0M_acc(0x0),
   fL0TriggerInputsVsCent_acc(0x0),
   fL0TriggerInputsVsTrigAlias_acc(0x0),
-  fVtxVsCentV0_acc(0x0)
+  fVtxVsCentV0_acc(0x0),
+  fWriteLumiIndex(kFALSE),
+  fLumiIndex(0x0),
+  fIndexRun(-1),
+  fIndexTimeMin(0),
+  fIndexTimeMax(0)
 {
   //
   // Constructor
   //
+  for(Int_t i=0; i<2; ++i) fIndexEvents[i] = 0;
+  for(Int_t i=0; i<2*kNAliases; ++i) fIndexTrigAliases[i] = 0;
+  for(Int_t i=0; i<2*kNL0Inputs; ++i) fIndexL0Inputs[i] = 0;
+  for(Int_t i=0; i<2*kNTrigClasses; ++i) fIndexTrigClasses[i] = 0;
   DefineInput(0, TChain::Class());
   DefineOutput(1, TList::Class());   // list of output histograms
 }
@@ -165,6 +184,19 @@ void AliAnalysisTaskComputeLumi::UserCreateOutputObjects()
   fHistogramList->Add(fVtxVsCentV0_before);
   fHistogramList->Add(fVtxVsCentV0_acc);
   
+  if(fWriteLumiIndex) {
+    fLumiIndex = new TTree("LumiIndex", "Trigger counters and time range per run");
+    fLumiIndex->SetDirectory(0);
+    fLumiIndex->Branch("run", &fIndexRun, "run/I");
+    fLumiIndex->Branch("timeMin", &fIndexTimeMin, "timeMin/i");
+    fLumiIndex->Branch("timeMax", &fIndexTimeMax, "timeMax/i");
+    fLumiIndex->Branch("nEvents", fIndexEvents, "nEvents[2]/L");
+    fLumiIndex->Branch("trigAliases", fIndexTrigAliases, Form("trigAliases[2][%d]/L", kNAliases));
+    fLumiIndex->Branch("l0Inputs", fIndexL0Inputs, Form("l0Inputs[2][%d]/L", kNL0Inputs));
+    fLumiIndex->Branch("trigClasses", fIndexTrigClasses, Form("trigClasses[2][%d]/L", kNTrigClasses));
+    fHistogramList->Add(fLumiIndex);
+  }
+  
   fTriggerAnalysis = new AliTriggerAnalysis();
   
   PostData(1, fHistogramList);
@@ -209,6 +241,20 @@ void AliAnalysisTaskComputeLumi::UserExec(Option_t *option)
   }
   UInt_t inputsL0 = ((AliESDEvent*)event)->GetHeader()->GetL0TriggerInputs();
   
+  ULong64_t classMask = event->GetHeader()->GetTriggerMask();
+  ULong64_t classMaskNext50 = event->GetHeader()->GetTriggerMaskNext50();
+  if(fWriteLumiIndex) {
+    if(event->GetRunNumber()!=fIndexRun) {
+      WriteLumiIndexEntry();
+      fIndexRun = event->GetRunNumber();
+      fIndexTimeMin = event->GetTimeStamp();
+      fIndexTimeMax = event->GetTimeStamp();
+    }
+    if(event->GetTimeStamp()<fIndexTimeMin) fIndexTimeMin = event->GetTimeStamp();
+    if(event->GetTimeStamp()>fIndexTimeMax) fIndexTimeMax = event->GetTimeStamp();
+    FillLumiIndex(0, isPhysSel, inputsL0, classMask, classMaskNext50);
+  }
+  
   fVtxVsCentV0_before->Fill(percentileEstimators[0], vtxZ);
   
   fTrigAliasVsCentV0M_before->Fill(percentileEstimators[0], -0.5);
@@ -240,6 +286,8 @@ void AliAnalysisTaskComputeLumi::UserExec(Option_t *option)
     return;        
   }
   
+  if(fWriteLumiIndex) FillLumiIndex(1, isPhysSel, inputsL0, classMask, classMaskNext50);
+  
   fVtxVsCentV0_acc->Fill(percentileEstimators[0], vtxZ);
   
   fTrigAliasVsCentV0M_acc->Fill(percentileEstimators[0], -0.5);
@@ -277,5 +325,39 @@ void AliAnalysisTaskComputeLumi::FinishTaskOutput()
   //
   // Finish Task 
   //
+  if(fWriteLumiIndex) WriteLumiIndexEntry();
   PostData(1, fHistogramList);
 }
+
+
+//_________________________________________________________________________________
+void AliAnalysisTaskComputeLumi::FillLumiIndex(Int_t step, UInt_t trigAliases, UInt_t inputsL0, ULong64_t classMask, ULong64_t classMaskNext50)
+{
+  //
+  // Increment the lumi index counters of the current run, step 0 (before) or 1 (after) the event filter
+  //
+  fIndexEvents[step]++;
+  for (Int_t i=0; i<kNAliases; i++)
+    if (trigAliases & (UInt_t(1)<<i)) fIndexTrigAliases[step*kNAliases+i]++;
+  for (Int_t i=0; i<kNL0Inputs; i++)
+    if (inputsL0 & (UInt_t(1)<<i)) fIndexL0Inputs[step*kNL0Inputs+i]++;
+  for (Int_t i=0; i<50; i++) {
+    if (classMask & (ULong64_t(1)<<i)) fIndexTrigClasses[step*kNTrigClasses+i]++;
+    if (classMaskNext50 & (ULong64_t(1)<<i)) fIndexTrigClasses[step*kNTrigClasses+50+i]++;
+  }
+}
+
+
+//_________________________________________________________________________________
+void AliAnalysisTaskComputeLumi::WriteLumiIndexEntry()
+{
+  //
+  // Fill the lumi index tree with the counters of the current run and reset them
+  //
+  if(!fLumiIndex || fIndexRun<0 || !fIndexEvents[0]) return;
+  fLumiIndex->Fill();
+  for(Int_t i=0; i<2; ++i) fIndexEvents[i] = 0;
+  for(Int_t i=0; i<2*kNAliases; ++i) fIndexTrigAliases[i] = 0;
+  for(Int_t i=0; i<2*kNL0Inputs; ++i) fIndexL0Inputs[i] = 0;
+  for(Int_t i=0; i<2*kNTrigClasses; ++i) fIndexTrigClasses[i] = 0;
+}
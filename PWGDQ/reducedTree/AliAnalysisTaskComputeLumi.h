@@ -32,6 +32,8 @@ public:
   
   // Cuts for selection of event to be written to tree
   void SetEventFilter(AliAnalysisCuts * const filter) {fEventFilter=filter;}
+  // Write the per run (and per job) trigger counters and time range to the "LumiIndex" tree of the output list
+  void SetWriteLumiIndex(Bool_t flag=kTRUE) {fWriteLumiIndex=flag;}
     
  private:
 
@@ -48,9 +50,27 @@ public:
   TH2I* fL0TriggerInputsVsTrigAlias_acc;      //
   TH2I* fVtxVsCentV0_acc;                    //
   
+  // Lumi index: one entry per run and per job, with the counters before/after the event filter
+  // (index 0/1) of the trigger aliases, the L0 inputs and the trigger classes, and the first and last
+  // event time stamps. Summing the entries of a run gives its counters for any trigger selection
+  // without running again over the data; the L0b/L2a scalers of the run are taken from the OCDB.
+  enum {kNAliases=32, kNL0Inputs=32, kNTrigClasses=100};
+  Bool_t   fWriteLumiIndex;                              // fill the lumi index tree
+  TTree*   fLumiIndex;                                   //! lumi index tree (owned by the histogram list)
+  Int_t    fIndexRun;                                    //! run of the current entry
+  UInt_t   fIndexTimeMin;                                //! first event time stamp
+  UInt_t   fIndexTimeMax;                                //! last event time stamp
+  Long64_t fIndexEvents[2];                              //! number of events
+  Long64_t fIndexTrigAliases[2*kNAliases];               //! trigger alias counters
+  Long64_t fIndexL0Inputs[2*kNL0Inputs];                 //! L0 input counters
+  Long64_t fIndexTrigClasses[2*kNTrigClasses];           //! trigger class counters
+  
+  void FillLumiIndex(Int_t step, UInt_t trigAliases, UInt_t inputsL0, ULong64_t classMask, ULong64_t classMaskNext50);
+  void WriteLumiIndexEntry();
+  
   AliAnalysisTaskComputeLumi(const AliAnalysisTaskComputeLumi &c);
   AliAnalysisTaskComputeLumi& operator= (const AliAnalysisTaskComputeLumi &c);
 
-  ClassDef(AliAnalysisTaskComputeLumi, 2); //Analysis Task for computing integrated lumi
+  ClassDef(AliAnalysisTaskComputeLumi, 3); //Analysis Task for computing integrated lumi
 };
 #endif
@@ -42,6 +42,8 @@ ClassImp(AliAnalysisTaskReducedEventProcessor);
 AliAnalysisTaskReducedEventProcessor::AliAnalysisTaskReducedEventProcessor() :
   AliAnalysisTaskSE(),
   fReducedTask(0x0),
+  fReducedTasks(),
+  fOutputList(0x0),
   fRunningMode(kUseEventsFromTree),
   fReducedEvent(),
   fWriteFilteredTree(kFALSE)
@@ -55,6 +57,8 @@ AliAnalysisTaskReducedEventProcessor::AliAnalysisTaskReducedEventProcessor() :
 AliAnalysisTaskReducedEventProcessor::AliAnalysisTaskReducedEventProcessor(const char* name, Int_t runningMode, Bool_t writeFilteredTree) :
   AliAnalysisTaskSE(name),
   fReducedTask(0x0),
+  fReducedTasks(),
+  fOutputList(0x0),
   fRunningMode(runningMode),
   fReducedEvent(),
   fWriteFilteredTree(writeFilteredTree)
@@ -72,6 +76,44 @@ AliAnalysisTaskReducedEventProcessor::AliAnalysisTaskReducedEventProcessor(const
      DefineOutput(2, TTree::Class());
 }
 
+//_________________________________________________________________________________
+AliAnalysisTaskReducedEventProcessor::~AliAnalysisTaskReducedEventProcessor()
+{
+  //
+  // Destructor
+  // The tasks and the histogram lists are owned by the user and by the histogram managers
+  //
+  if(fOutputList) {
+    fOutputList->SetOwner(kFALSE);
+    delete fOutputList;
+  }
+}
+
+//_________________________________________________________________________________
+void AliAnalysisTaskReducedEventProcessor::AddTask(AliReducedAnalysisTaskSE* task)
+{
+  //
+  // Add an analysis task. All the added tasks process the same reduced events, in the order they were added.
+  // The filtered tree, if requested, is written by the first task
+  //
+  if(!task) return;
+  if(!fReducedTask) fReducedTask = task;
+  fReducedTasks.Add(task);
+}
+
+//_________________________________________________________________________________
+void AliAnalysisTaskReducedEventProcessor::PostOutput()
+{
+  //
+  // Post the histogram output (the list of the task if only one task is added, 
+  // otherwise a list with the histogram lists of all the tasks) and the filtered tree
+  //
+  if(fOutputList) PostData(1, fOutputList);
+  else PostData(1, fReducedTask->GetHistogramManager()->GetHistogramOutputList());
+  if(fWriteFilteredTree)
+     PostData(2, fReducedTask->GetFilteredTree());
+}
+
 
 //______________________________________________________________________________
 void AliAnalysisTaskReducedEventProcessor::ConnectInputData(Option_t* /*option*/)
@@ -105,14 +147,20 @@ void AliAnalysisTaskReducedEventProcessor::UserCreateOutputObjects()
   //
   // Add all histogram manager histogram lists to the output TList
   //
-  fReducedTask->GetHistogramManager()->AddHistogramsToOutputList();
-  PostData(1, fReducedTask->GetHistogramManager()->GetHistogramOutputList());
+  for(Int_t i=0; i<fReducedTasks.GetEntriesFast(); ++i)
+    GetReducedTask(i)->GetHistogramManager()->AddHistogramsToOutputList();
+  if(fReducedTasks.GetEntriesFast()>1) {
+    fOutputList = new THashList();
+    fOutputList->SetName(GetName());
+    for(Int_t i=0; i<fReducedTasks.GetEntriesFast(); ++i)
+      fOutputList->Add(GetReducedTask(i)->GetHistogramManager()->GetHistogramOutputList());
+  }
   
   if(fWriteFilteredTree) {
      OpenFile(2);
      fReducedTask->InitFilteredTree();
-     PostData(2, fReducedTask->GetFilteredTree());
   }  
+  PostOutput();
   
   return;
 }
@@ -140,13 +188,12 @@ void AliAnalysisTaskReducedEventProcessor::UserExec(Option_t *){
   
   if(!event) return;
     
-  fReducedTask->SetEvent(event);
-  fReducedTask->Process();
-  PostData(1, fReducedTask->GetHistogramManager()->GetHistogramOutputList());
-  
-  if(fWriteFilteredTree)  {
-     PostData(2, fReducedTask->GetFilteredTree());
+  for(Int_t i=0; i<fReducedTasks.GetEntriesFast(); ++i) {
+    AliReducedAnalysisTaskSE* task = GetReducedTask(i);
+    task->SetEvent(event);
+    task->Process();
   }
+  PostOutput();
 } 
 
 
@@ -156,10 +203,9 @@ void AliAnalysisTaskReducedEventProcessor::FinishTaskOutput()
     //
     // Finish Task 
     //
-  fReducedTask->Finish();
-  PostData(1, fReducedTask->GetHistogramManager()->GetHistogramOutputList());
-  if(fWriteFilteredTree)
-     PostData(2, fReducedTask->GetFilteredTree());
+  for(Int_t i=0; i<fReducedTasks.GetEntriesFast(); ++i)
+    GetReducedTask(i)->Finish();
+  PostOutput();
   
   return;
 }
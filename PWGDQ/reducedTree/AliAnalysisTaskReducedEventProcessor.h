@@ -11,10 +11,13 @@
 #ifndef ALIANALYSISTASKREDUCEDEVENTPROCESSOR_H
 #define ALIANALYSISTASKREDUCEDEVENTPROCESSOR_H
 
+#include <TObjArray.h>
+
 #include "AliAnalysisTaskSE.h"
 #include "AliReducedBaseEvent.h"
 
 class TObject;
+class THashList;
 class AliAnalysis;
 class AliReducedAnalysisTaskSE;
 
@@ -30,9 +33,9 @@ public:
  public:
   AliAnalysisTaskReducedEventProcessor();
   AliAnalysisTaskReducedEventProcessor(const char *name, Int_t runningMode=kUseEventsFromTree, Bool_t writeFilteredTree=kFALSE);
-  virtual ~AliAnalysisTaskReducedEventProcessor(){}
+  virtual ~AliAnalysisTaskReducedEventProcessor();
 
-  void AddTask(AliReducedAnalysisTaskSE* task) {fReducedTask=task;}
+  void AddTask(AliReducedAnalysisTaskSE* task);
 
   virtual void UserExec(Option_t *);
   virtual void UserCreateOutputObjects();
@@ -42,11 +45,15 @@ public:
 
   Int_t GetRunningMode() const {return fRunningMode;}  
   AliReducedAnalysisTaskSE* GetReducedTask() const {return fReducedTask;}
+  AliReducedAnalysisTaskSE* GetReducedTask(Int_t i) const {return (AliReducedAnalysisTaskSE*)fReducedTasks.At(i);}
+  Int_t GetNReducedTasks() const {return fReducedTasks.GetEntriesFast();}
   
   Bool_t GetWriteFilteredTree() const {return fWriteFilteredTree;}
   
  protected:
-  AliReducedAnalysisTaskSE* fReducedTask;      // Pointer to the analysis task which will process the reduced events
+  AliReducedAnalysisTaskSE* fReducedTask;      // Pointer to the analysis task which will process the reduced events (the first one if several are added)
+  TObjArray fReducedTasks;                     // analysis tasks processing the same reduced events, in the order they were added
+  THashList* fOutputList;                      //! output list holding the histogram lists of all the tasks, used only when more than one task is added
   
   Int_t fRunningMode;                               // Running mode, as specified in options 1 and 2 from Constants
   
@@ -57,7 +64,9 @@ public:
   AliAnalysisTaskReducedEventProcessor(const AliAnalysisTaskReducedEventProcessor &c);
   AliAnalysisTaskReducedEventProcessor& operator= (const AliAnalysisTaskReducedEventProcessor &c);
 
-  ClassDef(AliAnalysisTaskReducedEventProcessor, 4);
+  void PostOutput();
+  
+  ClassDef(AliAnalysisTaskReducedEventProcessor, 5);
 };
 
 #endif
@@ -49,7 +49,8 @@ AliHistogramManager::AliHistogramManager() :
   fBinsAllocated(0),
   fVariableNames(),
   fVariableUnits(),
-  fNVars(0)
+  fNVars(0),
+  fFillPlans()
 {
   //
   // Constructor
@@ -71,7 +72,8 @@ AliHistogramManager::AliHistogramManager(const Char_t* name, Int_t nvars) :
   fBinsAllocated(0),
   fVariableNames(),
   fVariableUnits(),
-  fNVars(nvars)
+  fNVars(nvars),
+  fFillPlans()
 {
   //
   // Constructor
@@ -133,6 +135,17 @@ void AliHistogramManager::AddHistClass(const Char_t* histClass) {
   fMainList.Add(hList);
 }
 
+//__________________________________________________________________
+Int_t AliHistogramManager::GetHistClassId(const Char_t* className) const {
+  //
+  // get the integer id of a histogram class, to be used with FillHistClass(Int_t, Float_t*)
+  // the class id is the position of the class in the main list and the index of its fill plan
+  //
+  THashList* hList = (THashList*)fMainList.FindObject(className);
+  if(!hList) return -1;
+  return fMainList.IndexOf(hList);
+}
+
 //_________________________________________________________________
 void AliHistogramManager::AddHistogram(const Char_t* histClass,
 		                       const Char_t* name, const Char_t* title, Bool_t isProfile,
@@ -630,34 +643,120 @@ void AliHistogramManager::FillHistClass(const Char_t* className, Float_t* values
     cout << "         Histogram list not filled" << endl; */
     return;
   }
-  if(!hList) {
-    return;
+  FillHistClass(fMainList.IndexOf(hList), values);
+}
+
+
+//__________________________________________________________________
+void AliHistogramManager::FillHistClass(Int_t classId, Float_t* values) {
+  //
+  //  fill a class of histograms using its precomputed fill plan
+  //
+  // the plans are transient, create them also after the manager was streamed
+  if(Int_t(fFillPlans.size())!=fMainList.GetEntries()) {
+    fFillPlans.resize(fMainList.GetEntries());
+    for(Int_t i=0; i<fMainList.GetEntries(); ++i) {
+      fFillPlans[i].fList = (THashList*)fMainList.At(i);
+      fFillPlans[i].fNHistograms = -1;
+    }
   }
-    
-  TIter next(hList);
+  if(classId<0 || classId>=Int_t(fFillPlans.size())) return;
+  FillPlan& plan = fFillPlans[classId];
+  // (re)build the plan if histograms were added to the class since the last fill
+  if(plan.fNHistograms!=plan.fList->GetEntries()) BuildFillPlan(plan);
+  
+  Double_t fillValues[20]={0.0};
+  const Int_t* vars = 0x0;
+  for(std::vector<FillPlanEntry>::const_iterator it=plan.fEntries.begin(); it!=plan.fEntries.end(); ++it) {
+    vars = &plan.fVars[it->fFirstVar];
+    if(it->fVarW>AliReducedVarManager::kNothing) {
+      switch(it->fKind) {
+        case kTH1:
+          ((TH1*)it->fHist)->Fill(values[vars[0]],values[it->fVarW]);
+          break;
+        case kTProfile:
+          ((TProfile*)it->fHist)->Fill(values[vars[0]],values[vars[1]],values[it->fVarW]);
+          break;
+        case kTH2:
+          ((TH2*)it->fHist)->Fill(values[vars[0]],values[vars[1]],values[it->fVarW]);
+          break;
+        case kTProfile2D:
+          ((TProfile2D*)it->fHist)->Fill(values[vars[0]],values[vars[1]],values[vars[2]],values[it->fVarW]);
+          break;
+        case kTH3:
+          ((TH3*)it->fHist)->Fill(values[vars[0]],values[vars[1]],values[vars[2]],values[it->fVarW]);
+          break;
+        case kTProfile3D:
+          ((TProfile3D*)it->fHist)->Fill(values[vars[0]],values[vars[1]],values[vars[2]],values[vars[3]],values[it->fVarW]);
+          break;
+        case kTHn:
+          for(Int_t idim=0;idim<it->fNVars;++idim) fillValues[idim] = values[vars[idim]];
+          ((THnBase*)it->fHist)->Fill(fillValues,values[it->fVarW]);
+          break;
+        default:
+          break;
+      }
+    }
+    else {
+      switch(it->fKind) {
+        case kTH1:
+          ((TH1*)it->fHist)->Fill(values[vars[0]]);
+          break;
+        case kTProfile:
+          ((TProfile*)it->fHist)->Fill(values[vars[0]],values[vars[1]]);
+          break;
+        case kTH2:
+          ((TH2*)it->fHist)->Fill(values[vars[0]],values[vars[1]]);
+          break;
+        case kTProfile2D:
+          ((TProfile2D*)it->fHist)->Fill(values[vars[0]],values[vars[1]],values[vars[2]]);
+          break;
+        case kTH3:
+          ((TH3*)it->fHist)->Fill(values[vars[0]],values[vars[1]],values[vars[2]]);
+          break;
+        case kTProfile3D:
+          ((TProfile3D*)it->fHist)->Fill(values[vars[0]],values[vars[1]],values[vars[2]],values[vars[3]]);
+          break;
+        case kTHn:
+          for(Int_t idim=0;idim<it->fNVars;++idim) fillValues[idim] = values[vars[idim]];
+          ((THnBase*)it->fHist)->Fill(fillValues);
+          break;
+        default:
+          break;
+      }
+    }
+  }
+}
+
+
+//__________________________________________________________________
+void AliHistogramManager::BuildFillPlan(FillPlan& plan) {
+  //
+  //  decode the histogram types and variables of a histogram class from the UniqueID's
+  //  Histograms using variables not flagged in fUsedVars are left out of the plan
+  //
+  plan.fEntries.clear();
+  plan.fVars.clear();
+  plan.fNHistograms = plan.fList->GetEntries();
+  
+  TIter next(plan.fList);
   TObject* h=0x0;
   Bool_t isProfile;
   Bool_t isTHn;
   Int_t thnDim=0;
-  Bool_t isSparse=kFALSE;
-  Double_t fillValues[20]={0.0};
   Int_t uid = 0;
-  Int_t varX=-1, varY=-1, varZ=-1, varT=-1, varW=-1;
+  Int_t varW=-1, varT=-1;
   Int_t dimension=0;
+  Int_t vars[20]={0};
   while((h=next())) {
-    Bool_t allVarsGood = kTRUE;
     uid = h->GetUniqueID();
     isProfile = (uid%10==1 ? kTRUE : kFALSE);   // units digit encodes the isProfile
     isTHn = ((uid%100)>10 ? kTRUE : kFALSE);      
     if(isTHn) thnDim = (uid%100)-10;        // the excess over 10 from the last 2 digits give the dimension of the THn
-    if(isTHn && ((TString)h->ClassName()).Contains("Sparse")) isSparse = kTRUE;
     dimension = 0;
     if(!isTHn) dimension = ((TH1*)h)->GetDimension();
         
     uid = (uid-(uid%100))/100;
-    varX = -1;
-    varY = -1;
-    varZ = -1;
     varT = -1;
     varW = -1;
     if(uid>0) {
@@ -665,106 +764,39 @@ void AliHistogramManager::FillHistClass(const Char_t* className, Float_t* values
       if(varW==0) varW=AliReducedVarManager::kNothing;
       uid = (uid-(uid%(fNVars+1)))/(fNVars+1);
       if(uid>0) varT = uid - 1;
-      //cout << "Filling " << h->GetName() << " with varT " << varT << endl;
     }
-        
+    
+    FillPlanEntry entry;
+    entry.fHist = h;
+    entry.fVarW = (varW>AliReducedVarManager::kNothing ? varW : -1);
+    entry.fNVars = 0;
     if(!isTHn) {
-      varX = ((TH1*)h)->GetXaxis()->GetUniqueID();
-      if(fUsedVars[varX]) {
-        switch(dimension) {
-          case 1:
-            if(isProfile) {
-              varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-              if(!fUsedVars[varY]) break;
-              if(varW>AliReducedVarManager::kNothing) { 
-                if(!fUsedVars[varW]) break;
-                ((TProfile*)h)->Fill(values[varX],values[varY],values[varW]);
-              }
-              else 
-                ((TProfile*)h)->Fill(values[varX],values[varY]);
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH1F*)h)->Fill(values[varX],values[varW]);
-              }
-              else
-                ((TH1F*)h)->Fill(values[varX]);
-            }
-          break;
-          case 2:
-            varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-            if(!fUsedVars[varY]) break;
-            if(isProfile) {
-              varZ = ((TH1*)h)->GetZaxis()->GetUniqueID();
-              if(!fUsedVars[varZ]) break;
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TProfile2D*)h)->Fill(values[varX],values[varY],values[varZ],values[varW]);
-              }
-              else
-                ((TProfile2D*)h)->Fill(values[varX],values[varY],values[varZ]);        
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH2F*)h)->Fill(values[varX],values[varY], values[varW]);
-              }
-              else
-                ((TH2F*)h)->Fill(values[varX],values[varY]);
-            }
-          break;
-          case 3:
-            varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-            if(!fUsedVars[varY]) break;
-            varZ = ((TH1*)h)->GetZaxis()->GetUniqueID();
-            if(!fUsedVars[varZ]) break;
-            if(isProfile) {
-              if(!fUsedVars[varT]) break;
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TProfile3D*)h)->Fill(values[varX],values[varY],values[varZ],values[varT],values[varW]);
-              }
-              else
-                ((TProfile3D*)h)->Fill(values[varX],values[varY],values[varZ],values[varT]);
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH3F*)h)->Fill(values[varX],values[varY],values[varZ],values[varW]);
-              }
-              else
-                ((TH3F*)h)->Fill(values[varX],values[varY],values[varZ]);
-            }
-          break;
-          default:
-          break;
-        }  // end switch
+      vars[entry.fNVars++] = ((TH1*)h)->GetXaxis()->GetUniqueID();
+      if(dimension>1 || isProfile) vars[entry.fNVars++] = ((TH1*)h)->GetYaxis()->GetUniqueID();
+      if(dimension>2 || (dimension==2 && isProfile)) vars[entry.fNVars++] = ((TH1*)h)->GetZaxis()->GetUniqueID();
+      if(dimension==3 && isProfile) vars[entry.fNVars++] = varT;
+      switch(dimension) {
+        case 1: entry.fKind = (isProfile ? kTProfile : kTH1); break;
+        case 2: entry.fKind = (isProfile ? kTProfile2D : kTH2); break;
+        case 3: entry.fKind = (isProfile ? kTProfile3D : kTH3); break;
+        default: continue;
       }
-    }  // end if(!isTHn)
+    }
     else {
-      for(Int_t idim=0;idim<thnDim;++idim) {
-        if (isSparse) {
-          allVarsGood &= fUsedVars[((THnSparseF*)h)->GetAxis(idim)->GetUniqueID()];
-          fillValues[idim] = values[((THnSparseF*)h)->GetAxis(idim)->GetUniqueID()];
-        } else {
-          allVarsGood &= fUsedVars[((THnF*)h)->GetAxis(idim)->GetUniqueID()];
-          fillValues[idim] = values[((THnF*)h)->GetAxis(idim)->GetUniqueID()];
-        }
-      }
-      if(allVarsGood) {
-        if(varW>AliReducedVarManager::kNothing) {
-          if(fUsedVars[varW]) {
-            if (isSparse) ((THnSparseF*)h)->Fill(fillValues,values[varW]);
-            else          ((THnF*)h)->Fill(fillValues,values[varW]);
-          }
-        }
-        else {
-          if (isSparse) ((THnSparseF*)h)->Fill(fillValues);
-          else          ((THnF*)h)->Fill(fillValues);
-        }
-      }
+      entry.fKind = kTHn;
+      for(Int_t idim=0;idim<thnDim;++idim) 
+        vars[entry.fNVars++] = ((THnBase*)h)->GetAxis(idim)->GetUniqueID();
     }
+    
+    Bool_t allVarsGood = kTRUE;
+    for(Int_t ivar=0;ivar<entry.fNVars;++ivar) 
+      allVarsGood &= (vars[ivar]>=0 && vars[ivar]<AliReducedVarManager::kNVars && fUsedVars[vars[ivar]]);
+    if(entry.fVarW>AliReducedVarManager::kNothing) allVarsGood &= fUsedVars[entry.fVarW];
+    if(!allVarsGood) continue;
+    
+    entry.fFirstVar = plan.fVars.size();
+    plan.fVars.insert(plan.fVars.end(), vars, vars+entry.fNVars);
+    plan.fEntries.push_back(entry);
   }
 }
 
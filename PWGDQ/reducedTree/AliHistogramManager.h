@@ -8,6 +8,8 @@
 #ifndef ALIHISTOGRAMMANAGER_H
 #define ALIHISTOGRAMMANAGER_H
 
+#include <vector>
+
 #include <TString.h>
 #include <TObject.h>
 #include <THn.h>
@@ -69,6 +71,8 @@ class AliHistogramManager : public TObject {
                         TAxis* axis);
   
   void FillHistClass(const Char_t* className, Float_t* values);
+  void FillHistClass(Int_t classId, Float_t* values);
+  Int_t GetHistClassId(const Char_t* className) const;    // integer id of a histogram class, -1 if not found
   
   void SetUseDefaultVariableNames(Bool_t flag) {fUseDefaultVariableNames = flag;};
   void SetDefaultVarNames(TString* vars, TString* units);
@@ -106,9 +110,29 @@ class AliHistogramManager : public TObject {
   TString fVariableUnits[AliReducedVarManager::kNVars];               //! variable units
   Int_t fNVars;                          // maximum number of variables
   
+  // Fill plan of a histogram class: the histogram types and variables decoded once from the UniqueID's
+  enum HistKind {
+    kTH1=0, kTH2, kTH3, kTProfile, kTProfile2D, kTProfile3D, kTHn
+  };
+  struct FillPlanEntry {
+    TObject* fHist;      // histogram
+    Int_t fKind;         // one of HistKind
+    Int_t fFirstVar;     // index of the first variable in FillPlan::fVars
+    Int_t fNVars;        // number of variables (axes, plus the profiled variable for profiles)
+    Int_t fVarW;         // weight variable, -1 if not weighted
+  };
+  struct FillPlan {
+    THashList* fList;                      // histogram class list
+    Int_t fNHistograms;                    // number of histograms in the list when the plan was built
+    std::vector<FillPlanEntry> fEntries;   // histograms to be filled
+    std::vector<Int_t> fVars;              // flat array with the variables of all the entries
+  };
+  std::vector<FillPlan> fFillPlans;       //! fill plans, indexed by the histogram class id
+  
   void MakeAxisLabels(TAxis* ax, const Char_t* labels);
+  void BuildFillPlan(FillPlan& plan);
   
-  ClassDef(AliHistogramManager, 4)
+  ClassDef(AliHistogramManager, 5)
 };
 
 #endif
@@ -41,6 +41,8 @@ AliMixingHandler::AliMixingHandler(Int_t mixingSetup /* = kMixResonanceLegs*/) :
   fPoolSize(),
   fIsInitialized(kFALSE),
   fMixLikeSign(kTRUE),
+  fCompactLegs(kFALSE),
+  fHistClassArray(0x0),
   fVariableLimits(),
   fVariables(),
   fNMixingVariables(0),
@@ -81,6 +83,8 @@ AliMixingHandler::AliMixingHandler(const Char_t* name, const Char_t* title, Int_
   fPoolSize(),
   fIsInitialized(kFALSE),
   fMixLikeSign(kTRUE),
+  fCompactLegs(kFALSE),
+  fHistClassArray(0x0),
   fVariableLimits(),
   fVariables(),
   fNMixingVariables(0),
@@ -113,6 +117,7 @@ AliMixingHandler::~AliMixingHandler() {
    fCrossPairsCuts.Clear("C");
    fLikePairsLeg1Cuts.Clear("C");
    fLikePairsLeg2Cuts.Clear("C");
+   if(fHistClassArray) delete fHistClassArray;
 }
 
 
@@ -159,7 +164,10 @@ void AliMixingHandler::Init() {
     cout << "AliMixingHandler::Init(): ERROR No names for the histogram classes provided!" << endl;
     return;
   }
-  TObjArray* histClassArr = fHistClassNames.Tokenize(";");
+  // the names are tokenized only once, the array is used for all the mixing calls
+  if(fHistClassArray) delete fHistClassArray;
+  fHistClassArray = fHistClassNames.Tokenize(";");
+  TObjArray* histClassArr = fHistClassArray;
   Int_t nClassesPerCut = 0;
   if(fMixingSetup==kMixResonanceLegs) nClassesPerCut = 3;
   if(fMixingSetup==kMixCorrelation) nClassesPerCut = 1;
@@ -237,6 +245,11 @@ void AliMixingHandler::FillEvent(TList* leg1List, TList* leg2List, Float_t* valu
   AliReducedTrackInfo* track = 0x0;
   if (leg1List) {
     for(Int_t it=0; it<entries1; ++it) {
+      // compact legs: keep only the base track information of the full tracks
+      if(fCompactLegs && leg1List->At(it)->IsA()==AliReducedTrackInfo::Class()) {
+         list1->Add(new AliReducedBaseTrack(*(AliReducedBaseTrack*)leg1List->At(it)));
+         continue;
+      }
       // HACK: to transmit the VZERO and TPC event plane Q vector to event mixing
       if(fMixingSetup==kMixResonanceLegs && leg1List->At(it)->IsA()==AliReducedTrackInfo::Class()) {  
          track = (AliReducedTrackInfo*)leg1List->At(it)->Clone();  
@@ -253,6 +266,11 @@ void AliMixingHandler::FillEvent(TList* leg1List, TList* leg2List, Float_t* valu
   }
   if (leg2List) {
     for(Int_t it=0; it<entries2; ++it) {
+      // compact legs: keep only the base track information of the full tracks
+      if(fCompactLegs && leg2List->At(it)->IsA()==AliReducedTrackInfo::Class()) {
+        list2->Add(new AliReducedBaseTrack(*(AliReducedBaseTrack*)leg2List->At(it)));
+        continue;
+      }
       // HACK: to transmit the VZERO and TPC event plane Q vector to event mixing
       if(fMixingSetup==kMixResonanceLegs && leg2List->At(it)->IsA()==AliReducedTrackInfo::Class()) {  
         track = (AliReducedTrackInfo*)leg2List->At(it)->Clone();  
@@ -453,7 +471,7 @@ void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2
   Int_t entries = leg1Pool->GetEntries();
   if(entries<2) return;
   
-  TObjArray* histClassArr = fHistClassNames.Tokenize(";");
+  TObjArray* histClassArr = fHistClassArray;
   
   TIter iterEv1Leg1Pool(leg1Pool);
   TIter iterEv1Leg2Pool(leg2Pool);
@@ -713,6 +731,7 @@ void AliMixingHandler::PrintMixingLists(Int_t debugLevel) {
    cout << "Track downscale :: " << fDownscaleTracks << endl;
    cout << "No. parallel cuts :: " << fNParallelCuts << endl;
    cout << "Histogram class names :: " << fHistClassNames.Data() << endl;
+   cout << "Compact legs :: " << fCompactLegs << endl;
   
    if(debugLevel<1) return;
   
@@ -45,6 +45,7 @@ public:
   void SetNParallelPairCuts(Int_t n) {fNParallelPairCuts = n;}
   void SetHistogramManager(AliHistogramManager* histos) {fHistos = histos;}
   void SetHistClassNames(const Char_t* names) {fHistClassNames = names;}
+  void SetCompactLegs(Bool_t flag=kTRUE) {fCompactLegs = flag;}
   void AddCrossPairsCut(AliReducedInfoCut* cut) {fCrossPairsCuts.Add(cut);}
   void AddOppositeSignPairsCut(AliReducedInfoCut* cut) {fCrossPairsCuts.Add(cut);}    // synonim function to AddCrossPairsCut() used for charged legs
   void AddLikePairsLeg1Cut(AliReducedInfoCut* cut) {fLikePairsLeg1Cuts.Add(cut);}
@@ -69,6 +70,7 @@ public:
   TString GetHistClassNames() const {return fHistClassNames;};
   Int_t GetNMixingVariables() const {return fNMixingVariables;}
   Int_t GetMixingSetup() const {return fMixingSetup;}
+  Bool_t GetCompactLegs() const {return fCompactLegs;}
   
   void Init();
   Int_t FindEventCategory(Float_t* values);
@@ -100,6 +102,10 @@ private:
   TArrayI fPoolSize;               // counters for the pool sizes
   Bool_t fIsInitialized;           // check if the mixing handler is initialized
   Bool_t fMixLikeSign;             // mix or not like-sign tracks (default is true)
+  Bool_t fCompactLegs;             // store the AliReducedTrackInfo legs in the pools as AliReducedBaseTrack copies (default is false)
+                                   // NOTE: only the kinematics, charge and flags of the legs are then available for the mixed pairs,
+                                   //       the mixed-event flow, SPD pair type and EMCal matched energy of the legs are not filled
+  TObjArray* fHistClassArray;      //! histogram class names, tokenized once in Init()
   
   TArrayF fVariableLimits[kNMaxVariables];
   Int_t fVariables[kNMaxVariables];
@@ -115,7 +121,7 @@ private:
   ULong_t IncrementPoolSizes(TList* list1, TList* list2, Int_t eventCategory);
   void ResetPoolSizes(ULong_t mixingMask, Int_t category);  
   
-  ClassDef(AliMixingHandler,4);
+  ClassDef(AliMixingHandler,5);
 };
 
 #endif
@@ -48,7 +48,8 @@ AliReducedAnalysisJpsi2eeCorrelations::AliReducedAnalysisJpsi2eeCorrelations() :
   fOptionRunCorrelationMixing(kTRUE),
   fAssociatedTrackCuts(),
   fAssociatedTracks(),
-  fAssociatedTracksMB()
+  fAssociatedTracksMB(),
+  fCorrSEHistClassNames()
 {
   //
   // default constructor
@@ -65,7 +66,8 @@ AliReducedAnalysisJpsi2eeCorrelations::AliReducedAnalysisJpsi2eeCorrelations(con
   fMBEventCuts(),
   fAssociatedTrackCuts(),
   fAssociatedTracks(),
-  fAssociatedTracksMB()
+  fAssociatedTracksMB(),
+  fCorrSEHistClassNames()
 {
   //
   // named constructor
@@ -298,7 +300,7 @@ void AliReducedAnalysisJpsi2eeCorrelations::RunSameEventCorrelation(TString pair
   //
   if(fJpsiCandidates.GetEntries()==0) return;
   if(fAssociatedTracks.GetEntries()==0) return;
-  TString pairTypeNames[3] = {"PP","PM","MM"};
+  if(fCorrSEHistClassNames.empty()) BuildCorrelationHistClassNames();
 
   TIter nextAssocTrack(&fAssociatedTracks);
   TIter nextJpsi(&fJpsiCandidates);
@@ -307,6 +309,7 @@ void AliReducedAnalysisJpsi2eeCorrelations::RunSameEventCorrelation(TString pair
   AliReducedBaseTrack* assoc = 0x0;
   for(Int_t it=0;it<fJpsiCandidates.GetEntries(); ++it) {
      jpsi = (AliReducedPairInfo*)nextJpsi();
+     if (!fOptionUseLikeSignPairs && ((Int_t)jpsi->PairType() == 0 || (Int_t)jpsi->PairType() == 2)) continue;
      
      nextAssocTrack.Reset();
      for(Int_t ia=0;ia<fAssociatedTracks.GetEntries(); ++ia) {
@@ -320,15 +323,13 @@ void AliReducedAnalysisJpsi2eeCorrelations::RunSameEventCorrelation(TString pair
         // TODO: we need to make sure there are equal numbers of bits for both trigger and assoc
         //           Right now, the extra bits from the particle with more bits (cuts defined) are ignored
         if(!(jpsi->GetFlags() & assoc->GetFlags())) continue;
-        if (!fOptionUseLikeSignPairs && ((Int_t)jpsi->PairType() == 0 || (Int_t)jpsi->PairType() == 2)) continue;
 
         AliReducedVarManager::FillCorrelationInfo(jpsi, assoc, fValues);
 
         // fill correlation histograms
         // TODO: isMCTruth must be handled; can be either a Bool or a bit map
         //             Not sure if we need MC truth for correlation -> if so remove from code
-        Bool_t isMCTruth = kFALSE;
-        FillCorrelationHistograms(jpsi, assoc, Form("CorrSE%s", pairTypeNames[(Int_t)jpsi->PairType()].Data()), isMCTruth);
+        FillSameEventCorrelationHistograms(jpsi, assoc);
      }  // end loop over associated tracks
   }  // end loop over jpsi candidates
 }
@@ -408,3 +409,44 @@ void AliReducedAnalysisJpsi2eeCorrelations::FillCorrelationHistograms(AliReduced
     }
   }
 }
+
+//___________________________________________________________________________
+void AliReducedAnalysisJpsi2eeCorrelations::BuildCorrelationHistClassNames() {
+  //
+  // build the names of the same event correlation histogram classes once,
+  // instead of formatting them for each jpsi - associated track pair
+  //
+  TString pairTypeNames[3] = {"PP","PM","MM"};
+  Int_t nAssocCuts = fAssociatedTrackCuts.GetEntries();
+  Int_t nPairCuts  = (fPairCuts.GetEntries()>1 ? fPairCuts.GetEntries() : 1);
+  fCorrSEHistClassNames.assign(3*nAssocCuts*nPairCuts, "");
+  for(Int_t iType=0; iType<3; ++iType) {
+    for(Int_t iTrackCut=0; iTrackCut<nAssocCuts; ++iTrackCut) {
+      for(Int_t iPairCut=0; iPairCut<nPairCuts; ++iPairCut) {
+        TString& name = fCorrSEHistClassNames[(iType*nAssocCuts+iTrackCut)*nPairCuts+iPairCut];
+        name = Form("CorrSE%s_%s_%s", pairTypeNames[iType].Data(), fTrackCuts.At(iTrackCut)->GetName(), fAssociatedTrackCuts.At(iTrackCut)->GetName());
+        if(fPairCuts.GetEntries()>1) name += Form("_%s", fPairCuts.At(iPairCut)->GetName());
+      }
+    }
+  }
+}
+
+//___________________________________________________________________________
+void AliReducedAnalysisJpsi2eeCorrelations::FillSameEventCorrelationHistograms(AliReducedPairInfo* jpsi, AliReducedBaseTrack* assoc) {
+  //
+  // fill same event correlation histograms, same as FillCorrelationHistograms() with the
+  // "CorrSE<pair type>" classes but with the class names built in BuildCorrelationHistClassNames()
+  //
+  ULong_t trackMask = jpsi->GetFlags() & assoc->GetFlags();
+  ULong_t pairMask  = (fPairCuts.GetEntries()>1 ? jpsi->GetQualityFlags() : ULong_t(1));
+  Int_t nAssocCuts = fAssociatedTrackCuts.GetEntries();
+  Int_t nPairCuts  = (fPairCuts.GetEntries()>1 ? fPairCuts.GetEntries() : 1);
+  Int_t offset = (Int_t)jpsi->PairType()*nAssocCuts*nPairCuts;
+  for(Int_t iTrackCut=0; iTrackCut<nAssocCuts; ++iTrackCut) {
+    if(!(trackMask & (ULong_t(1)<<iTrackCut))) continue;
+    for(Int_t iPairCut=0; iPairCut<nPairCuts; ++iPairCut) {
+      if(!(pairMask & (ULong_t(1)<<iPairCut))) continue;
+      fHistosManager->FillHistClass(fCorrSEHistClassNames[offset+iTrackCut*nPairCuts+iPairCut].Data(), fValues);
+    }
+  }
+}
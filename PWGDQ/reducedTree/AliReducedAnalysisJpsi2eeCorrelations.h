@@ -12,7 +12,10 @@
 #ifndef ALIREDUCEDANALYSISJPSI2EECORRELATIONS_H
 #define ALIREDUCEDANALYSISJPSI2EECORRELATIONS_H
 
+#include <vector>
+
 #include <TList.h>
+#include <TString.h>
 
 #include "AliReducedAnalysisTaskSE.h"
 #include "AliReducedAnalysisJpsi2ee.h"
@@ -71,6 +74,8 @@ protected:
   TList fAssociatedTracks;      // list of selected associated tracks
   TList fAssociatedTracksMB;    // list of selected associated tracks in MB events (for mixing with EMCal trigger)
 
+  std::vector<TString> fCorrSEHistClassNames;   //! same event correlation histogram classes per (pair type, assoc track cut, pair cut)
+
   Bool_t IsMBEventSelected(AliReducedBaseEvent* event, Float_t* values=0x0);
   Bool_t IsAssociatedTrackSelected(AliReducedBaseTrack* track, Float_t* values=0x0);
 
@@ -80,8 +85,10 @@ protected:
   void FillAssociatedTrackHistograms(TString trackClass = "AssociatedTrack");
   void FillAssociatedTrackHistograms(AliReducedTrackInfo* track, TString trackClass = "AssociatedTrack");
   void FillCorrelationHistograms(AliReducedPairInfo* jpsi, AliReducedBaseTrack* assoc, TString corrClass="CorrSE", Bool_t isMCTruth=kFALSE);
+  void FillSameEventCorrelationHistograms(AliReducedPairInfo* jpsi, AliReducedBaseTrack* assoc);
+  void BuildCorrelationHistClassNames();
 
-  ClassDef(AliReducedAnalysisJpsi2eeCorrelations, 4);
+  ClassDef(AliReducedAnalysisJpsi2eeCorrelations, 5);
 };
 
 #endif
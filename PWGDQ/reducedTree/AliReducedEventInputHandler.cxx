@@ -5,9 +5,13 @@
 
 #include <TTree.h>
 #include <TFile.h>
+#include <TObjArray.h>
+#include <TString.h>
 #include "AliReducedEventInputHandler.h"
 #include "AliReducedBaseEvent.h"
 #include "AliReducedEventInfo.h"
+#include "AliReducedVarManager.h"
+#include "AliInputTreeCache.h"
 
 ClassImp(AliReducedEventInputHandler)
 
@@ -15,6 +19,7 @@ ClassImp(AliReducedEventInputHandler)
 AliReducedEventInputHandler::AliReducedEventInputHandler() :
     AliInputEventHandler(),
     fEventInputOption(kReducedBaseEvent),
+    fReadOnlyUsedTrackInfo(kFALSE),
     fReducedEvent(0)
 {
   // Default constructor
@@ -24,6 +29,7 @@ AliReducedEventInputHandler::AliReducedEventInputHandler() :
 AliReducedEventInputHandler::AliReducedEventInputHandler(const char* name, const char* title):
   AliInputEventHandler(name, title),
   fEventInputOption(kReducedBaseEvent),
+  fReadOnlyUsedTrackInfo(kFALSE),
   fReducedEvent(0)
  {
     // Constructor
@@ -45,6 +51,9 @@ Bool_t AliReducedEventInputHandler::Init(TTree* tree, Option_t* opt)
 
     SwitchOffBranches();
     SwitchOnBranches();
+    if(fReadOnlyUsedTrackInfo) SwitchOffUnusedTrackBranches();
+    // cache the branches registered by the tasks, with the train's cache settings
+    AliInputTreeCache::Instance()->ConfigureTree(fTree);
     
     // Get pointer to the event
     if (!fReducedEvent) {
@@ -63,6 +72,44 @@ Bool_t AliReducedEventInputHandler::Init(TTree* tree, Option_t* opt)
 }
 
 
+//______________________________________________________________________________
+void AliReducedEventInputHandler::SwitchOffUnusedTrackBranches()
+{
+   //
+   // The Event branch is split, each data member of the tracks is stored in its own branch
+   // (fTracks.fTOFbeta, ...). Switch off the branches of the track detector information
+   // for which none of the corresponding AliReducedVarManager variables is used (in histograms,
+   // cuts, mixing, etc.), so that they are not read and decompressed.
+   // NOTE: the variables must be flagged as used before the tree is connected (i.e. before the run starts),
+   //       and the tracks must not be used directly for this information (e.g. when writing filtered trees)
+   //
+   struct TrackBranchGroup {
+      Int_t fFirstVar;          // first variable using the branches
+      Int_t fLastVar;           // last variable using the branches
+      const char* fBranches;    // branches (space separated)
+   };
+   const TrackBranchGroup groups[] = {
+      {AliReducedVarManager::kTPCdEdxQmax, AliReducedVarManager::kTPCdEdxQmaxOverQtot+3, "fTracks.fTPCdEdxInfoQmax* fTracks.fTPCdEdxInfoQtot*"},
+      {AliReducedVarManager::kTOFbeta, AliReducedVarManager::kTOFnSig+3, "fTracks.fTOF*"},
+      {AliReducedVarManager::kTRDntracklets, AliReducedVarManager::kTRDpidProbabilitiesLQ2D+1, "fTracks.fTRDntracklets* fTracks.fTRDpid*"},
+      {AliReducedVarManager::kTRDGTUtracklets, AliReducedVarManager::kTRDGTUPID, "fTracks.fTRDGTU*"}
+   };
+   
+   for(UInt_t ig=0; ig<sizeof(groups)/sizeof(groups[0]); ++ig) {
+      Bool_t used = kFALSE;
+      for(Int_t iv=groups[ig].fFirstVar; iv<=groups[ig].fLastVar; ++iv) 
+         if(AliReducedVarManager::GetUsedVar((AliReducedVarManager::Variables)iv)) {used = kTRUE; break;}
+      if(used) continue;
+      
+      TObjArray* branches = TString(groups[ig].fBranches).Tokenize(" ");
+      for(Int_t ib=0; ib<branches->GetEntries(); ++ib) {
+         UInt_t found = 0;
+         fTree->SetBranchStatus(branches->At(ib)->GetName(), 0, &found);
+      }
+      delete branches;
+   }
+}
+
 //______________________________________________________________________________
 Bool_t AliReducedEventInputHandler::BeginEvent(Long64_t entry)
 {
@@ -72,6 +119,7 @@ Bool_t AliReducedEventInputHandler::BeginEvent(Long64_t entry)
       prevRunNumber = fReducedEvent->RunNo();
     } 
     fTree->GetEvent(entry);
+    AliInputTreeCache::Instance()->CountEvent(fTree->GetName());
     
     // set transient pointer to event inside tracks
     // fEvent->ConnectTracks();
@@ -94,6 +142,14 @@ Bool_t AliReducedEventInputHandler::Notify(const char* path)
   return kTRUE;
 }
 
+//______________________________________________________________________________
+Bool_t AliReducedEventInputHandler::TerminateIO()
+{
+  // Report the bytes read per event
+  if (fTree) AliInputTreeCache::Instance()->Print(fTree->GetName());
+  return kTRUE;
+}
+
 //______________________________________________________________________________
 Bool_t AliReducedEventInputHandler::FinishEvent()
 {
@@ -30,19 +30,25 @@ class AliReducedEventInputHandler : public AliInputEventHandler {
     virtual Bool_t                             Notify() { return AliVEventHandler::Notify();};
     virtual Bool_t                             Notify(const char* path);
     virtual Bool_t                             FinishEvent();
+    virtual Bool_t                             TerminateIO();
              
                  void                                SetInputEventType(Int_t type) {fEventInputOption = type;} ;
                  Int_t                               GetInputEventType() const {return fEventInputOption;};
+                 void                                SetReadOnlyUsedTrackInfo(Bool_t flag=kTRUE) {fReadOnlyUsedTrackInfo = flag;}
+                 Bool_t                              GetReadOnlyUsedTrackInfo() const {return fReadOnlyUsedTrackInfo;}
                  
  private:
     AliReducedEventInputHandler(const AliReducedEventInputHandler& handler);             
     AliReducedEventInputHandler& operator=(const AliReducedEventInputHandler& handler);      
     
+    void SwitchOffUnusedTrackBranches();
+    
     Int_t  fEventInputOption;                          // one of the options listed in EReducedEventInputType
+    Bool_t fReadOnlyUsedTrackInfo;                // if true, do not read the track detector information not used by the AliReducedVarManager variables
     AliReducedBaseEvent* fReducedEvent;   //! Pointer to the event
     //AliReducedEventInfo* fReducedEvent;   //! Pointer to the event
     
-    ClassDef(AliReducedEventInputHandler, 2);
+    ClassDef(AliReducedEventInputHandler, 3);
 };
 
 #endif
@@ -65,6 +65,7 @@ fFillSecondaryCellTiming(0), fFillOpAngleCutHisto(0),      fCheckAccInSector(0),
 fPairWithOtherDetector(0),   fOtherDetectorInputName(""),
 fPhotonMom1(),               fPhotonMom1Boost(),           fPhotonMom2(),                fMCPrimMesonMom(),
 fMCProdVertex(),
+fMixModule1(),               fMixModule2(),
 
 // Histograms
 fhReMod(0x0),                fhReSameSideEMCALMod(0x0),    fhReSameSectorEMCALMod(0x0),  fhReDiffPHOSMod(0x0),
@@ -4823,6 +4824,21 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
     }
     
     Int_t nMixed = evMixList->GetSize() ;
+    
+    // The (super) module is obtained from the photon eta/phi with the geometry,
+    // get it once per photon and not once per pair
+    const Int_t kMixModuleUnknown = -1000;
+    if ( nMixed > 0 )
+    {
+      fMixModule1.assign(nPhot, kMixModuleUnknown);
+      for(Int_t i1 = 0; i1 < nPhot; i1++)
+      {
+        AliCaloTrackParticle * p1 = (AliCaloTrackParticle*) (GetInputAODBranch()->At(i1)) ;
+        if ( p1->Pt() < GetMinPt() || p1->Pt()  > GetMaxPt() ) continue ;
+        fMixModule1[i1] = GetModuleNumber(p1);
+      }
+    }
+    
     for(Int_t ii=0; ii<nMixed; ii++)
     {
       TClonesArray* ev2= (TClonesArray*) (evMixList->At(ii));
@@ -4832,6 +4848,9 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
       
       fhEventMixBin->Fill(eventbin, GetEventWeight()) ;
       
+      // Determined when the photon is first paired
+      fMixModule2.assign(nPhot2, kMixModuleUnknown);
+      
       //---------------------------------
       // First loop on photons/clusters
       //---------------------------------
@@ -4847,7 +4866,7 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
         
         //Get kinematics of cluster and (super) module of this cluster
         fPhotonMom1.SetPxPyPzE(p1->Px(),p1->Py(),p1->Pz(),p1->E());
-        module1 = GetModuleNumber(p1);
+        module1 = fMixModule1[i1];
         
         //---------------------------------
         // Second loop on other mixed event photons/clusters
@@ -4893,7 +4912,8 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
           AliDebug(2,Form("Mixed Event: pT: fPhotonMom1 %2.2f, fPhotonMom2 %2.2f; Pair: pT %2.2f, mass %2.3f, a %2.3f",p1->Pt(), p2->Pt(), pt,m,a));
           
           // In case we want only pairs in same (super) module, check their origin.
-          module2 = GetModuleNumber(p2);
+          if ( fMixModule2[i2] == kMixModuleUnknown ) fMixModule2[i2] = GetModuleNumber(p2);
+          module2 = fMixModule2[i2];
                     
           //-------------------------------------------------------------------------------------------------
           // Fill module dependent histograms, put a cut on assymmetry on the first available cut in the array
@@ -30,6 +30,8 @@ class TH3F ;
 class TH2F ;
 class TObjString;
 
+#include <vector>
+
 // Analysis
 #include "AliAnaCaloTrackCorrBaseClass.h"
 class AliAODEvent ;
@@ -243,6 +245,9 @@ class AliAnaPi0 : public AliAnaCaloTrackCorrBaseClass {
   TLorentzVector fPhotonMom2;          //!<! Photon cluster momentum, temporary array
   TLorentzVector fMCPrimMesonMom;      //!<! Pi0/Eta MC primary momentum, temporary array
   TVector3       fMCProdVertex;        //!<! Pi0/Eta MC Production vertex, temporary array
+  
+  std::vector<Int_t> fMixModule1;      //!<! (Super) module of the current event photons, for mixing
+  std::vector<Int_t> fMixModule2;      //!<! (Super) module of the mixed event photons, kMixModuleUnknown if not determined yet
     
   // ----------
   // Histograms
@@ -618,7 +623,7 @@ class AliAnaPi0 : public AliAnaCaloTrackCorrBaseClass {
   AliAnaPi0 & operator = (const AliAnaPi0 & api0) ;
   
   /// \cond CLASSIMP
-  ClassDef(AliAnaPi0,37) ;
+  ClassDef(AliAnaPi0,38) ;
   /// \endcond
   
 } ;
@@ -378,7 +378,11 @@ AliAnalysisTaskGammaConvV1::AliAnalysisTaskGammaConvV1(): AliAnalysisTaskSE(),
   fFileWasAlreadyReported(kFALSE),
   fAODMCTrackArray(NULL),
   fAddressChanges(NULL),
-  fMapPhotonHeaders()
+  fMapPhotonHeaders(),
+  fUsePhotonPairCache(kTRUE),
+  fReaderGammaIndex(),
+  fPhotonPairCache(),
+  fPhotonPairCacheUsed()
 {
 
 }
@@ -702,7 +706,11 @@ AliAnalysisTaskGammaConvV1::AliAnalysisTaskGammaConvV1(const char *name):
   fFileWasAlreadyReported(kFALSE),
   fAODMCTrackArray(NULL),
   fAddressChanges(NULL),
-  fMapPhotonHeaders()
+  fMapPhotonHeaders(),
+  fUsePhotonPairCache(kTRUE),
+  fReaderGammaIndex(),
+  fPhotonPairCache(),
+  fPhotonPairCacheUsed()
 {
   // Define output slots here
   DefineOutput(1, TList::Class());
@@ -736,6 +744,7 @@ AliAnalysisTaskGammaConvV1::~AliAnalysisTaskGammaConvV1()
     fWeightCentrality = 0x0;
   }
 
+  for (Int_t key : fPhotonPairCacheUsed) delete fPhotonPairCache[key];
 }
 //___________________________________________________________
 void AliAnalysisTaskGammaConvV1::InitBack(){
@@ -2484,6 +2493,7 @@ void AliAnalysisTaskGammaConvV1::UserExec(Option_t *)
   }
 
   fReaderGammas = fV0Reader->GetReconstructedGammas(); // Gammas from default Cut
+  ResetPhotonPairCache();
 
   // ------------------- BeginEvent ----------------------------
 
@@ -2691,7 +2701,9 @@ void AliAnalysisTaskGammaConvV1::UserExec(Option_t *)
           CalculateBackgroundSwapp();
         } else {
           CalculateBackgroundRP(); // Combinatorial Background
-          fBGHandlerRP[iCut]->AddEvent(fGammaCandidates,fInputEvent); // Store Event for mixed Events
+          // the pool is only read for event mixing
+          if(!((AliConversionMesonCuts*)fMesonCutArray->At(iCut))->UseRotationMethod())
+            fBGHandlerRP[iCut]->AddEvent(fGammaCandidates,fInputEvent); // Store Event for mixed Events
         }
       }
       if(((AliConversionMesonCuts*)fMesonCutArray->At(iCut))->UseMCPSmearing() && fIsMC > 0 ){
@@ -4082,6 +4094,50 @@ void AliAnalysisTaskGammaConvV1::ProcessMCParticles(int isCurrentEventSelected)
   }
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskGammaConvV1::ResetPhotonPairCache(){
+  // The pairs of the previous event are deleted and the photons of the reader are indexed
+  for (Int_t key : fPhotonPairCacheUsed){
+    delete fPhotonPairCache[key];
+    fPhotonPairCache[key] = 0x0;
+  }
+  fPhotonPairCacheUsed.clear();
+  fReaderGammaIndex.clear();
+  if (!fUsePhotonPairCache || !fDoMesonAnalysis || fnCuts < 2 || !fReaderGammas) return;
+
+  Int_t nGammas = fReaderGammas->GetEntriesFast();
+  fPhotonPairCache.resize(nGammas*nGammas, 0x0);
+  for (Int_t i = 0; i < nGammas; i++){
+    fReaderGammaIndex[fReaderGammas->At(i)] = i;
+  }
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskGammaConvV1::FillPhotonPair(AliAODConversionMother &pair, AliAODConversionPhoton *gamma0, AliAODConversionPhoton *gamma1){
+  // Meson candidate of the two photons, including the DCA to the primary vertex.
+  // The candidate only depends on the two photons of the reader, so with several cut sets it is built
+  // once per event and ordered pair of photons, and the cut sets selecting the same pair copy it.
+  // Cut sets smearing the photon momenta (MC) build their own candidates.
+  Bool_t lUseCache = !fReaderGammaIndex.empty() && !(fIsMC > 0 && fiMesonCut->UseMCPSmearing());
+  if (lUseCache){
+    auto lIndex0 = fReaderGammaIndex.find(gamma0);
+    auto lIndex1 = fReaderGammaIndex.find(gamma1);
+    if (lIndex0 != fReaderGammaIndex.end() && lIndex1 != fReaderGammaIndex.end()){
+      Int_t key = lIndex0->second*fReaderGammas->GetEntriesFast() + lIndex1->second;
+      if (!fPhotonPairCache[key]){
+        fPhotonPairCache[key] = new AliAODConversionMother(gamma0,gamma1);
+        fPhotonPairCache[key]->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
+        fPhotonPairCacheUsed.push_back(key);
+      }
+      pair = *fPhotonPairCache[key];
+      return;
+    }
+  }
+
+  pair = AliAODConversionMother(gamma0,gamma1);
+  pair.CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskGammaConvV1::CalculatePi0Candidates(){
   
@@ -4099,9 +4155,11 @@ void AliAnalysisTaskGammaConvV1::CalculatePi0Candidates(){
         gamma0->GetTrackLabelNegative() == gamma1->GetTrackLabelPositive() ||
         gamma0->GetTrackLabelPositive() == gamma1->GetTrackLabelNegative() ) continue;
 
-        AliAODConversionMother *pi0cand = new AliAODConversionMother(gamma0,gamma1);
+        // candidate on the stack, no allocation per pair
+        AliAODConversionMother pi0candidate;
+        FillPhotonPair(pi0candidate,gamma0,gamma1);
+        AliAODConversionMother *pi0cand = &pi0candidate;
         pi0cand->SetLabels(firstGammaIndex,secondGammaIndex);
-        pi0cand->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
 
         if((fiMesonCut->MesonIsSelected(pi0cand,kTRUE,fiEventCut->GetEtaShift()))){
           if(fDoCentralityFlat > 0){
@@ -4340,8 +4398,6 @@ void AliAnalysisTaskGammaConvV1::CalculatePi0Candidates(){
             }
           }
         }
-        delete pi0cand;
-        pi0cand=0x0;
       }
     }
   }
@@ -4924,20 +4980,18 @@ void AliAnalysisTaskGammaConvV1::CalculateBackground(){
         AliAODConversionPhoton currentEventGoodV02 = *(AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent2));
 
         if(fiMesonCut->DoBGProbability()){
-          AliAODConversionMother *backgroundCandidateProb = new AliAODConversionMother(&currentEventGoodV0,&currentEventGoodV02);
-          Double_t massBGprob = backgroundCandidateProb->M();
+          // only the mass is needed, no need to build the candidate
+          Double_t massBGprob = AliAODConversionMother::GetPairKinematics(&currentEventGoodV0,&currentEventGoodV02).M();
           if(massBGprob>0.1 && massBGprob<0.14){
             if(fRandom.Rndm()>fBGHandler[fiCut]->GetBGProb(zbin,mbin)){
-              delete backgroundCandidateProb;
               continue;
             }
           }
-          delete backgroundCandidateProb;
-          backgroundCandidateProb = 0x0;
         }
 
         RotateParticle(&currentEventGoodV02);
-        AliAODConversionMother *backgroundCandidate = new AliAODConversionMother(&currentEventGoodV0,&currentEventGoodV02);
+        AliAODConversionMother backgroundCandidateOnStack(&currentEventGoodV0,&currentEventGoodV02);
+        AliAODConversionMother *backgroundCandidate = &backgroundCandidateOnStack;
         backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
         if((fiMesonCut->MesonIsSelected(backgroundCandidate,kFALSE,fiEventCut->GetEtaShift()))){
           if(fDoCentralityFlat > 0) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightCentrality[fiCut]*fWeightJetJetMC);
@@ -4952,8 +5006,6 @@ void AliAnalysisTaskGammaConvV1::CalculateBackground(){
             else sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightJetJetMC);
           }
         }
-        delete backgroundCandidate;
-        backgroundCandidate = 0x0;
         }
       }
     }
@@ -4978,7 +5030,8 @@ void AliAnalysisTaskGammaConvV1::CalculateBackground(){
             RotateParticleAccordingToEP(&previousGoodV0,bgEventVertex->fEP,fEventPlaneAngle);
           }
 
-          AliAODConversionMother *backgroundCandidate = new AliAODConversionMother(&currentEventGoodV0,&previousGoodV0);
+          AliAODConversionMother backgroundCandidateOnStack(&currentEventGoodV0,&previousGoodV0);
+          AliAODConversionMother *backgroundCandidate = &backgroundCandidateOnStack;
           backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
           if((fiMesonCut->MesonIsSelected(backgroundCandidate,kFALSE,fiEventCut->GetEtaShift()))){
             if(fDoCentralityFlat > 0) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightCentrality[fiCut]*fWeightJetJetMC);
@@ -4993,8 +5046,6 @@ void AliAnalysisTaskGammaConvV1::CalculateBackground(){
               else sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightJetJetMC);
             }
           }
-          delete backgroundCandidate;
-          backgroundCandidate = 0x0;
         }
         }
       }
@@ -5019,7 +5070,8 @@ void AliAnalysisTaskGammaConvV1::CalculateBackground(){
             }
 
 
-            AliAODConversionMother *backgroundCandidate = new AliAODConversionMother(&currentEventGoodV0,&previousGoodV0);
+            AliAODConversionMother backgroundCandidateOnStack(&currentEventGoodV0,&previousGoodV0);
+            AliAODConversionMother *backgroundCandidate = &backgroundCandidateOnStack;
             backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
             if((fiMesonCut->MesonIsSelected(backgroundCandidate,kFALSE,fiEventCut->GetEtaShift()))){
               if(fDoCentralityFlat > 0) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightCentrality[fiCut]*fWeightJetJetMC);
@@ -5040,8 +5092,6 @@ void AliAnalysisTaskGammaConvV1::CalculateBackground(){
                 else sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightJetJetMC);
               }
             }
-            delete backgroundCandidate;
-            backgroundCandidate = 0x0;
           }
         }
         }
@@ -5100,16 +5150,18 @@ void AliAnalysisTaskGammaConvV1::CalculateBackgroundSwapp(){
               lvRotationPhoton1.Rotate(rotationAngle, lvRotationPion);
               lvRotationPhoton2.Rotate(rotationAngle, lvRotationPion);
             }
-            std::unique_ptr<AliAODConversionPhoton> currentEventGoodV0Rotation1 (new AliAODConversionPhoton(&lvRotationPhoton1));
-            std::unique_ptr<AliAODConversionPhoton> currentEventGoodV0Rotation2 (new AliAODConversionPhoton(&lvRotationPhoton2));
+            AliAODConversionPhoton currentEventGoodV0Rotation1(&lvRotationPhoton1);
+            AliAODConversionPhoton currentEventGoodV0Rotation2(&lvRotationPhoton2);
             for(auto const& kCurrentGammaCandidates  : *fGammaCandidates){
               if(currentEventGoodV0Temp1 == ((AliAODConversionPhoton*) kCurrentGammaCandidates) || currentEventGoodV0Temp2 == ((AliAODConversionPhoton*) kCurrentGammaCandidates)) continue;
 
-              std::unique_ptr<AliAODConversionMother> backgroundCandidate1(new AliAODConversionMother(currentEventGoodV0Rotation1.get(), ((AliAODConversionPhoton*) kCurrentGammaCandidates)));
-              std::unique_ptr<AliAODConversionMother> backgroundCandidate2(new AliAODConversionMother(currentEventGoodV0Rotation2.get(), ((AliAODConversionPhoton*) kCurrentGammaCandidates)));
+              AliAODConversionMother backgroundCandidate1OnStack(&currentEventGoodV0Rotation1, ((AliAODConversionPhoton*) kCurrentGammaCandidates));
+              AliAODConversionMother backgroundCandidate2OnStack(&currentEventGoodV0Rotation2, ((AliAODConversionPhoton*) kCurrentGammaCandidates));
+              AliAODConversionMother *backgroundCandidate1 = &backgroundCandidate1OnStack;
+              AliAODConversionMother *backgroundCandidate2 = &backgroundCandidate2OnStack;
               if( fabs(currentEventGoodV0Temp1->Eta()) <= fiPhotonCut->GetEtaCut())
               {
-                if(((AliConversionMesonCuts*) fMesonCutArray->At(fiCut))->MesonIsSelected(backgroundCandidate1.get(),kFALSE,fiEventCut->GetEtaShift()))
+                if(((AliConversionMesonCuts*) fMesonCutArray->At(fiCut))->MesonIsSelected(backgroundCandidate1,kFALSE,fiEventCut->GetEtaShift()))
                 {
                   vSwappingInvMassPT.push_back({backgroundCandidate1->M(),backgroundCandidate1->Pt()});
                   if(fDoJetAnalysis){
@@ -5124,7 +5176,7 @@ void AliAnalysisTaskGammaConvV1::CalculateBackgroundSwapp(){
               }
               if( fabs(currentEventGoodV0Temp2->Eta()) <= fiPhotonCut->GetEtaCut())
               {
-                if(((AliConversionMesonCuts*) fMesonCutArray->At(fiCut))->MesonIsSelected(backgroundCandidate2.get(),kFALSE,fiEventCut->GetEtaShift()))
+                if(((AliConversionMesonCuts*) fMesonCutArray->At(fiCut))->MesonIsSelected(backgroundCandidate2,kFALSE,fiEventCut->GetEtaShift()))
                 {
                   vSwappingInvMassPT.push_back({backgroundCandidate2->M(),backgroundCandidate2->Pt()});
                   if(fDoJetAnalysis){
@@ -5207,9 +5259,14 @@ void AliAnalysisTaskGammaConvV1::CalculateBackgroundRP(){
 
   } else {
     // Do Event Mixing
-    for(Int_t nEventsInBG=0;nEventsInBG <fBGHandlerRP[fiCut]->GetNBGEvents(fGammaCandidates,fInputEvent);nEventsInBG++){
-
-      AliGammaConversionPhotonVector *previousEventGammas = fBGHandlerRP[fiCut]->GetBGGoodGammas(fGammaCandidates,fInputEvent,nEventsInBG);
+    // the pool bins need the event plane, determine them once for all pool events
+    Int_t poolPsiBin = 0;
+    Int_t poolZBin = 0;
+    if(!fBGHandlerRP[fiCut]->FindBins(fGammaCandidates,fInputEvent,poolPsiBin,poolZBin)) return;
+    Int_t nBGEvents = fBGHandlerRP[fiCut]->GetNBGEvents(poolPsiBin,poolZBin);
+    for(Int_t nEventsInBG=0;nEventsInBG <nBGEvents;nEventsInBG++){
+
+      AliGammaConversionPhotonVector *previousEventGammas = fBGHandlerRP[fiCut]->GetBGGoodGammas(poolPsiBin,poolZBin,nEventsInBG);
 
       if(previousEventGammas){
         // test weighted background
@@ -55,6 +55,9 @@ class AliAnalysisTaskGammaConvV1 : public AliAnalysisTaskSE {
     void InitJets();
     void ProcessPhotonsHighPtHadronAnalysis();
     void CalculatePi0Candidates();
+    void SetUsePhotonPairCache(Bool_t flag)                       { fUsePhotonPairCache         = flag    ;}
+    void ResetPhotonPairCache();
+    void FillPhotonPair(AliAODConversionMother &pair, AliAODConversionPhoton *gamma0, AliAODConversionPhoton *gamma1);
     void CalculateBackground();
     void CalculateBackgroundSwapp();
     void CalculateBackgroundRP();
@@ -432,12 +435,16 @@ class AliAnalysisTaskGammaConvV1 : public AliAnalysisTaskSE {
     TH1F*                             fAddressChanges;                                //! count if addresses of aod mc tracks arrays ever change            
 
     AliConversionPhotonCuts::TMapPhotonBool fMapPhotonHeaders;                   // map to remember if the photon tracks are from selected headers
+    Bool_t                            fUsePhotonPairCache;                        // share the meson candidates of the same photon pair between the cut sets
+    std::map<const TObject*,Int_t>    fReaderGammaIndex;                          //! index of the photons in fReaderGammas
+    std::vector<AliAODConversionMother*> fPhotonPairCache;                        //! meson candidates of the current event, by ordered pair of reader photons
+    std::vector<Int_t>                fPhotonPairCacheUsed;                       //! filled entries of fPhotonPairCache
 
   private:
 
     AliAnalysisTaskGammaConvV1(const AliAnalysisTaskGammaConvV1&); // Prevent copy-construction
     AliAnalysisTaskGammaConvV1 &operator=(const AliAnalysisTaskGammaConvV1&); // Prevent assignment
-    ClassDef(AliAnalysisTaskGammaConvV1, 57);
+    ClassDef(AliAnalysisTaskGammaConvV1, 58);
 };
 
 #endif
@@ -93,6 +93,25 @@ AliAODConversionParticle(),
   fLabel[2]=0;
 }
 
+AliAODConversionMother::PairKinematics AliAODConversionMother::GetPairKinematics(const AliAODConversionPhoton *y1, const AliAODConversionPhoton *y2){
+  // Four-momentum, opening angle and alpha of the pair as in the constructor from two photons
+  PairKinematics pair;
+  pair.fPx = y1->Px()+y2->Px();
+  pair.fPy = y1->Py()+y2->Py();
+  pair.fPz = y1->Pz()+y2->Pz();
+  pair.fE  = y1->E()+y2->E();
+
+  TVector3 v1(y1->Px(),y1->Py(),y1->Pz());
+  TVector3 v2(y2->Px(),y2->Py(),y2->Pz());
+  pair.fOpeningAngle = v1.Angle(v2);
+
+  pair.fAlpha = -1;
+  if((y1->E()+y2->E()) != 0){
+    pair.fAlpha = (y1->E()-y2->E())/(y1->E()+y2->E());
+  }
+  return pair;
+}
+
 AliAODConversionMother::AliAODConversionMother(const AliAODConversionMother *meson, const AliAODConversionPhoton *gamma):
 AliAODConversionParticle(),
   fOpeningAngle(-1),
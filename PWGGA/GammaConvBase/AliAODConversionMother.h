@@ -21,6 +21,23 @@ class AliAODConversionMother : public AliAODConversionParticle{
 
   public:
 
+    /// Kinematics of a photon pair, computed on the stack without building the mother.
+    /// Same values as the corresponding getters of AliAODConversionMother(y1,y2), which
+    /// is only needed when the candidate is kept or passed to the meson cuts.
+    struct PairKinematics {
+      Double_t fPx;
+      Double_t fPy;
+      Double_t fPz;
+      Double_t fE;
+      Double_t fOpeningAngle;
+      Double_t fAlpha;
+
+      Double_t M() const { Double_t mm = fE*fE - (fPx*fPx + fPy*fPy + fPz*fPz); return mm < 0.0 ? -TMath::Sqrt(-mm) : TMath::Sqrt(mm); }
+      Double_t Pt() const { return TMath::Sqrt(fPx*fPx + fPy*fPy); }
+      Double_t Rapidity() const { return 0.5*TMath::Log((fE+fPz)/(fE-fPz)); }
+    };
+    static PairKinematics GetPairKinematics(const AliAODConversionPhoton *y1, const AliAODConversionPhoton *y2);
+
     //Default Constructor
     AliAODConversionMother();
 
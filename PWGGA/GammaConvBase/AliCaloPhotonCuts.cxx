@@ -59,7 +59,9 @@
 #include "AliCaloTrackMatcher.h"
 #include "AliCaloTriggerMimicHelper.h"
 #include "AliPhotonIsolation.h"
+#include <map>
 #include <memory>
+#include <tuple>
 #include <vector>
 
 class iostream;
@@ -68,6 +70,17 @@ using namespace std;
 
 ClassImp(AliCaloPhotonCuts)
 
+namespace {
+  // Non-linearity corrected cluster energies, shared by all cut sets of the process.
+  // The correction only depends on the NonLinearity switch, the cluster type, the period,
+  // the MC flag, the cluster energy, whether the cluster has a single cell and on the
+  // supermodule of the leading cell (cluster type 4 only). The cut sets of a wagon apply
+  // it to their own copies of the same clusters, which therefore find the result here.
+  typedef std::tuple<Int_t, Int_t, Int_t, Int_t, Float_t, Bool_t, Int_t> NonLinearityKey_t;
+  std::map<NonLinearityKey_t, Float_t> gNonLinearityCache;
+  const UInt_t kNonLinearityCacheSize = 100000; // the cache is cleared when reaching this size
+}
+
 
 const char* AliCaloPhotonCuts::fgkCutNames[AliCaloPhotonCuts::kNCuts] = {
   "ClusterType",          //0    0: all,    1: EMCAL,   2: PHOS
@@ -7216,6 +7229,15 @@ void AliCaloPhotonCuts::ApplyNonLinearity(AliVCluster* cluster, Int_t isMC, AliV
     printf("AliCaloPhotonCuts:Period name has been set to %s, period-enum: %o\n",fPeriodName.Data(),fCurrentMC ) ;
   }
 
+  const NonLinearityKey_t nonLinearityKey(fSwitchNonLinearity, fClusterType, fCurrentMC, isMC, energy, cluster->GetNCells() == 1, clusterSMID);
+  const Bool_t useNonLinearityCache = (energy == energy);
+  if(useNonLinearityCache){
+    std::map<NonLinearityKey_t, Float_t>::const_iterator cached = gNonLinearityCache.find(nonLinearityKey);
+    if(cached != gNonLinearityCache.end()){
+      cluster->SetE(cached->second);
+      return;
+    }
+  }
 
   Bool_t fPeriodNameAvailable = kTRUE;
   switch(fSwitchNonLinearity){
@@ -8927,6 +8949,10 @@ void AliCaloPhotonCuts::ApplyNonLinearity(AliVCluster* cluster, Int_t isMC, AliV
     return;
   }
 
+  if(useNonLinearityCache){
+    if(gNonLinearityCache.size() >= kNonLinearityCacheSize) gNonLinearityCache.clear();
+    gNonLinearityCache[nonLinearityKey] = energy;
+  }
   cluster->SetE(energy);
 
   return;
@@ -39,6 +39,7 @@
 #include <vector>
 #include <map>
 #include <utility>
+#include <algorithm>
 
 class iostream;
 
@@ -61,8 +62,14 @@ AliCaloTrackMatcher::AliCaloTrackMatcher(const char *name, Int_t clusterType, In
   fGeomEMCAL(NULL),
   fGeomPHOS(NULL),
   fArrClusters(NULL),
-  fMapTrackToCluster(),
-  fMapClusterToTrack(),
+  fTrackToCluster(),
+  fClusterToTrack(),
+  fMatchedPairs(),
+  fClusterGrid(),
+  fClusterCandidates(),
+  fClusterGridCellSize(0),
+  fAODTrackIDToPos(),
+  fAODTrackPosFilled(kFALSE),
   fNEntries(1),
   fVectorDeltaEtaDeltaPhi(0),
   fMap_TrID_ClID_ToIndex(),
@@ -88,8 +95,8 @@ AliCaloTrackMatcher::AliCaloTrackMatcher(const char *name, Int_t clusterType, In
 //________________________________________________________________________
 AliCaloTrackMatcher::~AliCaloTrackMatcher(){
     // default deconstructor
-    fMapTrackToCluster.clear();
-    fMapClusterToTrack.clear();
+    fTrackToCluster.Clear();
+    fClusterToTrack.Clear();
     fVectorDeltaEtaDeltaPhi.clear();
     fMap_TrID_ClID_ToIndex.clear();
 
@@ -110,8 +117,11 @@ AliCaloTrackMatcher::~AliCaloTrackMatcher(){
 
 //________________________________________________________________________
 void AliCaloTrackMatcher::Terminate(Option_t *){
-  fMapTrackToCluster.clear();
-  fMapClusterToTrack.clear();
+  fTrackToCluster.Clear();
+  fClusterToTrack.Clear();
+  fMatchedPairs.clear();
+  fAODTrackIDToPos.clear();
+  fAODTrackPosFilled = kFALSE;
   fVectorDeltaEtaDeltaPhi.clear();
   fMap_TrID_ClID_ToIndex.clear();
 
@@ -181,8 +191,11 @@ void AliCaloTrackMatcher::UserCreateOutputObjects(){
 //________________________________________________________________________
 void AliCaloTrackMatcher::Initialize(Int_t runNumber){
   // Initialize function to be called once before analysis
-  fMapTrackToCluster.clear();
-  fMapClusterToTrack.clear();
+  fTrackToCluster.Clear();
+  fClusterToTrack.Clear();
+  fMatchedPairs.clear();
+  fAODTrackIDToPos.clear();
+  fAODTrackPosFilled = kFALSE;
   fNEntries = 1;
   fVectorDeltaEtaDeltaPhi.clear();
   fMap_TrID_ClID_ToIndex.clear();
@@ -252,6 +265,8 @@ void AliCaloTrackMatcher::ProcessEvent(AliVEvent *event){
       return;
     }
   }
+  FillClusterGrid(event,nClus);
+
   static AliESDtrackCuts *EsdTrackCuts = 0x0;
   static int prevRun = -1;
   // Using standard function for setting Cuts
@@ -454,51 +469,36 @@ void AliCaloTrackMatcher::ProcessEvent(AliVEvent *event){
     // cout << "eta/phi: " << eta << ", " << phi << endl;
     // cout << "nClus: " << nClus << endl;
     Int_t nClusterMatchesToTrack = 0;
-    for(Int_t iclus=0;iclus < nClus;iclus++){
-      AliVCluster* cluster = NULL;
-      if(fArrClusters){
-        if(esdev){
-          if(fArrClusters)
-            cluster = new AliESDCaloCluster(*(AliESDCaloCluster*)fArrClusters->At(iclus));
-        } else if(aodev){
-          if(fArrClusters)
-            cluster = new AliAODCaloCluster(*(AliAODCaloCluster*)fArrClusters->At(iclus));
-        }
-      }
-      else
-        cluster = event->GetCaloCluster(iclus);
-      if (!cluster){
-        if(fArrClusters) delete cluster;
-        continue;
-      }
+    // only clusters in the grid cells around the track can pass the matching window
+    GetClusterCandidates(exPos);
+    for(UInt_t icand=0;icand < fClusterCandidates.size();icand++){
+      Int_t iclus = fClusterCandidates[icand];
+      // the clusters are only read, the ones of the correction framework are used without a copy
+      AliVCluster* cluster = fArrClusters ? (AliVCluster*)fArrClusters->At(iclus) : event->GetCaloCluster(iclus);
+      if (!cluster) continue;
       // cout << "-------------------------LOOPING: " << iclus << ", " << cluster->GetID() << endl;
       cluster->GetPosition(clsPos);
       Double_t dR = TMath::Sqrt(TMath::Power(exPos[0]-clsPos[0],2)+TMath::Power(exPos[1]-clsPos[1],2)+TMath::Power(exPos[2]-clsPos[2],2));
       //cout << "dR: " << dR << endl;
       if (dR > fMatchingWindow){
-        if(fArrClusters) delete cluster;
         continue;
       }
       Double_t clusterR = TMath::Sqrt( clsPos[0]*clsPos[0] + clsPos[1]*clsPos[1] );
       AliExternalTrackParam trackParamTmp(emcParam);//Retrieve the starting point every time before the extrapolation
       if(fClusterType == 1 || fClusterType == 3 || fClusterType == 4){
         if (!cluster->IsEMCAL()){
-          if(fArrClusters) delete cluster;
           continue;
         }
         if(!AliEMCALRecoUtils::ExtrapolateTrackToCluster(&trackParamTmp, cluster, fMassHypothesis, 5., dEta, dPhi)){
           FillfHistControlMatches(4.,inTrack->Pt());
-          if(fArrClusters) delete cluster;
           continue;
         }
       }else if(fClusterType == 2){
         if (!cluster->IsPHOS()){
-          if(fArrClusters) delete cluster;
           continue;
         }
         if(!AliTrackerBase::PropagateTrackToBxByBz(&trackParamTmp, clusterR, fMassHypothesis, 5., kTRUE, 0.8, -1)){
           FillfHistControlMatches(4.,inTrack->Pt());
-          if(fArrClusters) delete cluster;
           continue;
         }
         Double_t trkPos[3] = {0,0,0};
@@ -513,30 +513,120 @@ void AliCaloTrackMatcher::ProcessEvent(AliVEvent *event){
 
       //cout << dEta << " - " << dPhi << " - " << dR2 << endl;
       if(dR2 > fMatchingResidual){
-        if(fArrClusters) delete cluster;
         continue;
       }
       nClusterMatchesToTrack++;
-      if(aodev){
-        fMapTrackToCluster.insert(make_pair(itr,cluster->GetID()));
-        fMapClusterToTrack.insert(make_pair(cluster->GetID(),itr));
-      }else{
-        fMapTrackToCluster.insert(make_pair(inTrack->GetID(),cluster->GetID()));
-        fMapClusterToTrack.insert(make_pair(cluster->GetID(),inTrack->GetID()));
-      }
+      if(aodev) fMatchedPairs.push_back(make_pair(itr,cluster->GetID()));
+      else fMatchedPairs.push_back(make_pair(inTrack->GetID(),cluster->GetID()));
       fVectorDeltaEtaDeltaPhi.push_back(make_pair(dEta,dPhi));
       fMap_TrID_ClID_ToIndex[make_pair(inTrack->GetID(),cluster->GetID())] = fNEntries++;
       if( (Int_t)fVectorDeltaEtaDeltaPhi.size() != (fNEntries-1)) AliFatal("Fatal error in AliCaloTrackMatcher, vector and map are not in sync!");
-      if(fArrClusters) delete cluster;
     }
     if(nClusterMatchesToTrack == 0) FillfHistControlMatches(5.,inTrack->Pt());
     else FillfHistControlMatches(6.,inTrack->Pt());
     delete trackParam;
   }
 
+  // flat track <-> cluster adjacency, in the same order as the matches were found
+  fTrackToCluster.Build(fMatchedPairs);
+  for(UInt_t i=0;i<fMatchedPairs.size();i++) fMatchedPairs[i] = make_pair(fMatchedPairs[i].second,fMatchedPairs[i].first);
+  fClusterToTrack.Build(fMatchedPairs);
+  fMatchedPairs.clear();
+
   return;
 }
 
+//________________________________________________________________________
+void AliCaloTrackMatcher::FillClusterGrid(AliVEvent *event, Int_t nClus){
+  // Sort the clusters into cubic cells with the size of the matching window (at least 10 cm),
+  // so that a track only has to be compared to the clusters in the 27 cells around it.
+  // The cluster positions are read without copying the clusters.
+  fClusterGridCellSize = TMath::Max(fMatchingWindow,10.);
+  vector<pairInt> cellToCluster;
+  cellToCluster.reserve(nClus);
+  Float_t clsPos[3] = {0.,0.,0.};
+  for(Int_t iclus=0;iclus < nClus;iclus++){
+    AliVCluster* cluster = fArrClusters ? (AliVCluster*)fArrClusters->At(iclus) : event->GetCaloCluster(iclus);
+    if(!cluster) continue;
+    cluster->GetPosition(clsPos);
+    cellToCluster.push_back(make_pair(GetClusterGridCell(clsPos[0],clsPos[1],clsPos[2]),iclus));
+  }
+  fClusterGrid.Build(cellToCluster);
+}
+
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::GetClusterGridCell(Double_t x, Double_t y, Double_t z, Int_t dx, Int_t dy, Int_t dz){
+  // 128 cells per coordinate cover +-64*10 cm, which contains both calorimeters
+  Int_t ix = TMath::FloorNint(x/fClusterGridCellSize)+dx+64;
+  Int_t iy = TMath::FloorNint(y/fClusterGridCellSize)+dy+64;
+  Int_t iz = TMath::FloorNint(z/fClusterGridCellSize)+dz+64;
+  if(ix<0 || ix>127 || iy<0 || iy>127 || iz<0 || iz>127) return -1;
+  return (ix*128+iy)*128+iz;
+}
+
+//________________________________________________________________________
+void AliCaloTrackMatcher::GetClusterCandidates(Double_t *exPos){
+  // cluster indices from the cells around exPos, in ascending order as in a loop over all clusters
+  fClusterCandidates.clear();
+  for(Int_t dx=-1;dx<=1;dx++){
+    for(Int_t dy=-1;dy<=1;dy++){
+      for(Int_t dz=-1;dz<=1;dz++){
+        Int_t cell = GetClusterGridCell(exPos[0],exPos[1],exPos[2],dx,dy,dz);
+        if(cell<0) continue;
+        const Int_t *clusters = 0;
+        Int_t nClusters = fClusterGrid.Get(cell,clusters);
+        fClusterCandidates.insert(fClusterCandidates.end(),clusters,clusters+nClusters);
+      }
+    }
+  }
+  sort(fClusterCandidates.begin(),fClusterCandidates.end());
+}
+
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::GetAODTrackPosition(AliVEvent *event, Int_t trackID){
+  // position of the track with a given ID in the AOD event. The lookup table is built on the first call
+  // in each event; as before, the first track with the ID is taken (for running mode 7 the first hybrid one)
+  if(!fAODTrackPosFilled){
+    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
+      AliAODTrack* currTrack  = static_cast<AliAODTrack*>(event->GetTrack(iTrack));
+      // even though hybrid tracks don't contain dublicates
+      // the hybrid track can share an ID with another copy if it is a copy
+      if(fRunningMode==7 &&!currTrack->IsHybridGlobalConstrainedGlobal()) continue;
+      fAODTrackIDToPos.insert(make_pair(currTrack->GetID(),iTrack));
+    }
+    fAODTrackPosFilled = kTRUE;
+  }
+  map<Int_t,Int_t>::const_iterator it = fAODTrackIDToPos.find(trackID);
+  if(it == fAODTrackIDToPos.end()) return -1;
+  return it->second;
+}
+
+//________________________________________________________________________
+void AliCaloTrackMatcher::Adjacency::Build(vector<pairInt> &pairs){
+  // stable sort keeps the order in which the values were added for each key
+  Clear();
+  stable_sort(pairs.begin(),pairs.end(),[](const pairInt &a, const pairInt &b){ return a.first < b.first; });
+  fValues.reserve(pairs.size());
+  for(UInt_t i=0;i<pairs.size();i++){
+    if(fKeys.empty() || fKeys.back() != pairs[i].first){
+      fKeys.push_back(pairs[i].first);
+      fOffsets.push_back(i);
+    }
+    fValues.push_back(pairs[i].second);
+  }
+  fOffsets.push_back(fValues.size());
+}
+
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::Adjacency::Get(Int_t key, const Int_t *&values) const {
+  values = 0;
+  vector<Int_t>::const_iterator it = lower_bound(fKeys.begin(),fKeys.end(),key);
+  if(it == fKeys.end() || *it != key) return 0;
+  Int_t i = it-fKeys.begin();
+  values = fValues.data()+fOffsets[i];
+  return fOffsets[i+1]-fOffsets[i];
+}
+
 //________________________________________________________________________
 Bool_t AliCaloTrackMatcher::PropagateV0TrackToClusterAndGetMatchingResidual(AliVTrack* inSecTrack, AliVCluster* cluster, AliVEvent* event, Float_t &dEta, Float_t &dPhi){
 
@@ -766,10 +856,10 @@ Bool_t AliCaloTrackMatcher::PropagateV0TrackToClusterAndGetMatchingResidual(AliV
 //________________________________________________________________________
 //________________________________________________________________________
 Bool_t AliCaloTrackMatcher::GetTrackClusterMatchingResidual(Int_t trackID, Int_t clusterID, Float_t &dEta, Float_t &dPhi){
-  Int_t position = fMap_TrID_ClID_ToIndex[make_pair(trackID,clusterID)];
-  if(position == 0) return kFALSE;
+  mapT::const_iterator itPos = fMap_TrID_ClID_ToIndex.find(make_pair(trackID,clusterID));
+  if(itPos == fMap_TrID_ClID_ToIndex.end() || itPos->second == 0) return kFALSE;
 
-  pairFloat tempEtaPhi = fVectorDeltaEtaDeltaPhi.at(position-1);
+  pairFloat tempEtaPhi = fVectorDeltaEtaDeltaPhi.at(itPos->second-1);
   dEta = tempEtaPhi.first;
   dPhi = tempEtaPhi.second;
   return kTRUE;
@@ -777,18 +867,17 @@ Bool_t AliCaloTrackMatcher::GetTrackClusterMatchingResidual(Int_t trackID, Int_t
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
-        }else if(tempTrack->Charge()<0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (-dPhiMin > tempDPhi) && (tempDPhi > -dPhiMax) ) matched++;
-        }
+  const Int_t *matchedTracks = 0;
+  Int_t nMatchedTracks = fClusterToTrack.Get(clusterID,matchedTracks);
+  for (Int_t iMatch=0; iMatch<nMatchedTracks; iMatch++){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(matchedTracks[iMatch]));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),clusterID,tempDEta,tempDPhi)){
+      if(tempTrack->Charge()>0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
+      }else if(tempTrack->Charge()<0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (-dPhiMin > tempDPhi) && (tempDPhi > -dPhiMax) ) matched++;
       }
     }
   }
@@ -799,23 +888,22 @@ Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
-
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-
-        if (match_dPhi && match_dEta )matched++;
-      }
+  const Int_t *matchedTracks = 0;
+  Int_t nMatchedTracks = fClusterToTrack.Get(clusterID,matchedTracks);
+  for (Int_t iMatch=0; iMatch<nMatchedTracks; iMatch++){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(matchedTracks[iMatch]));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),clusterID,tempDEta,tempDPhi)){
+      Bool_t match_dEta = kFALSE;
+      Bool_t match_dPhi = kFALSE;
+      if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+      else match_dEta = kFALSE;
+
+      if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+      else match_dPhi = kFALSE;
+
+      if (match_dPhi && match_dEta )matched++;
     }
   }
   return matched;
@@ -824,15 +912,14 @@ Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dR){
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
-      }
+  const Int_t *matchedTracks = 0;
+  Int_t nMatchedTracks = fClusterToTrack.Get(clusterID,matchedTracks);
+  for (Int_t iMatch=0; iMatch<nMatchedTracks; iMatch++){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(matchedTracks[iMatch]));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),clusterID,tempDEta,tempDPhi)){
+      if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
     }
   }
   return matched;
@@ -843,32 +930,22 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t
 
   Int_t TrackPos = -1;
   if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliAODTrack* currTrack  = static_cast<AliAODTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        // even though hybrid tracks don't contain dublicates
-        // the hybrid track can share an ID with another copy if it is a copy
-        if(fRunningMode==7 &&!currTrack->IsHybridGlobalConstrainedGlobal()) continue;
-        TrackPos = iTrack;
-        break;
-      }
-    }
+    TrackPos = GetAODTrackPosition(event,trackID);
     if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
   }else TrackPos = trackID; // for ESD just take trackID
 
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return matched;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
-        }else if(tempTrack->Charge()<0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (-dPhiMin > tempDPhi) && (tempDPhi > -dPhiMax) ) matched++;
-        }
+  const Int_t *matchedClusters = 0;
+  Int_t nMatchedClusters = fTrackToCluster.Get(TrackPos,matchedClusters);
+  for (Int_t iMatch=0; iMatch<nMatchedClusters; iMatch++){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),matchedClusters[iMatch],tempDEta,tempDPhi)){
+      if(tempTrack->Charge()>0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
+      }else if(tempTrack->Charge()<0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (-dPhiMin > tempDPhi) && (tempDPhi > -dPhiMax) ) matched++;
       }
     }
   }
@@ -879,38 +956,28 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t
 Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
   Int_t TrackPos = -1;
   if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliAODTrack* currTrack  = static_cast<AliAODTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        // even though hybrid tracks don't contain dublicates
-        // the hybrid track can share an ID with another copy if it is a copy
-        if(fRunningMode==7 &&!currTrack->IsHybridGlobalConstrainedGlobal()) continue;
-        TrackPos = iTrack;
-        break;
-      }
-    }
+    TrackPos = GetAODTrackPosition(event,trackID);
     if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
   }else TrackPos = trackID; // for ESD just take trackID
 
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return matched;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
+  const Int_t *matchedClusters = 0;
+  Int_t nMatchedClusters = fTrackToCluster.Get(TrackPos,matchedClusters);
+  for (Int_t iMatch=0; iMatch<nMatchedClusters; iMatch++){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),matchedClusters[iMatch],tempDEta,tempDPhi)){
+      Bool_t match_dEta = kFALSE;
+      Bool_t match_dPhi = kFALSE;
+      if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+      else match_dEta = kFALSE;
 
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
+      if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+      else match_dPhi = kFALSE;
 
-        if (match_dPhi && match_dEta )matched++;
+      if (match_dPhi && match_dEta )matched++;
 
-      }
     }
   }
   return matched;
@@ -920,29 +987,19 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t
 Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, Float_t dR){
   Int_t TrackPos = -1;
   if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-       AliAODTrack* currTrack  = static_cast<AliAODTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        // even though hybrid tracks don't contain dublicates
-        // the hybrid track can share an ID with another copy if it is a copy
-        if(fRunningMode==7 &&!currTrack->IsHybridGlobalConstrainedGlobal()) continue;
-        TrackPos = iTrack;
-        break;
-      }
-    }
+    TrackPos = GetAODTrackPosition(event,trackID);
     if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
   }else TrackPos = trackID; // for ESD just take trackID
 
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return matched;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
-      }
+  const Int_t *matchedClusters = 0;
+  Int_t nMatchedClusters = fTrackToCluster.Get(TrackPos,matchedClusters);
+  for (Int_t iMatch=0; iMatch<nMatchedClusters; iMatch++){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),matchedClusters[iMatch],tempDEta,tempDPhi)){
+      if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
     }
   }
   return matched;
@@ -951,18 +1008,17 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
   vector<Int_t> tempMatchedTracks;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){ 
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedTracks.push_back(it->second);
-        }else if(tempTrack->Charge()<0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (-dPhiMin > tempDPhi) && (tempDPhi > -dPhiMax) ) tempMatchedTracks.push_back(it->second);
-        }
+  const Int_t *matchedTracks = 0;
+  Int_t nMatchedTracks = fClusterToTrack.Get(clusterID,matchedTracks);
+  for (Int_t iMatch=0; iMatch<nMatchedTracks; iMatch++){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(matchedTracks[iMatch]));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),clusterID,tempDEta,tempDPhi)){ 
+      if(tempTrack->Charge()>0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedTracks.push_back(matchedTracks[iMatch]);
+      }else if(tempTrack->Charge()<0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (-dPhiMin > tempDPhi) && (tempDPhi > -dPhiMax) ) tempMatchedTracks.push_back(matchedTracks[iMatch]);
       }
     }
   }
@@ -972,24 +1028,23 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID,  TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
   vector<Int_t> tempMatchedTracks;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
+  const Int_t *matchedTracks = 0;
+  Int_t nMatchedTracks = fClusterToTrack.Get(clusterID,matchedTracks);
+  for (Int_t iMatch=0; iMatch<nMatchedTracks; iMatch++){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(matchedTracks[iMatch]));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),clusterID,tempDEta,tempDPhi)){
+      Bool_t match_dEta = kFALSE;
+      Bool_t match_dPhi = kFALSE;
+      if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+      else match_dEta = kFALSE;
+
+      if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+      else match_dPhi = kFALSE;
+
+      if (match_dPhi && match_dEta )tempMatchedTracks.push_back(matchedTracks[iMatch]);
 
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-
-        if (match_dPhi && match_dEta )tempMatchedTracks.push_back(it->second);
-
-      }
     }
   }
   return tempMatchedTracks;
@@ -998,15 +1053,14 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID,  Float_t dR){
   vector<Int_t> tempMatchedTracks;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedTracks.push_back(it->second);
-      }
+  const Int_t *matchedTracks = 0;
+  Int_t nMatchedTracks = fClusterToTrack.Get(clusterID,matchedTracks);
+  for (Int_t iMatch=0; iMatch<nMatchedTracks; iMatch++){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(matchedTracks[iMatch]));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),clusterID,tempDEta,tempDPhi)){
+      if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedTracks.push_back(matchedTracks[iMatch]);
     }
   }
   return tempMatchedTracks;
@@ -1016,32 +1070,22 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event
 vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
   Int_t TrackPos = -1;
   if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliAODTrack* currTrack  = static_cast<AliAODTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        // even though hybrid tracks don't contain dublicates
-        // the hybrid track can share an ID with another copy if it is a copy
-        if(fRunningMode==7 &&!currTrack->IsHybridGlobalConstrainedGlobal()) continue;
-        TrackPos = iTrack;
-        break;
-      }
-    }
+    TrackPos = GetAODTrackPosition(event,trackID);
     if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
   }else TrackPos = trackID; // for ESD just take trackID
 
   vector<Int_t> tempMatchedClusters;
-  multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return tempMatchedClusters;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedClusters.push_back(it->second);
-        }else if(tempTrack->Charge()<0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (-dPhiMin > tempDPhi) && (tempDPhi > -dPhiMax) ) tempMatchedClusters.push_back(it->second);
-        }
+  const Int_t *matchedClusters = 0;
+  Int_t nMatchedClusters = fTrackToCluster.Get(TrackPos,matchedClusters);
+  for (Int_t iMatch=0; iMatch<nMatchedClusters; iMatch++){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),matchedClusters[iMatch],tempDEta,tempDPhi)){
+      if(tempTrack->Charge()>0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedClusters.push_back(matchedClusters[iMatch]);
+      }else if(tempTrack->Charge()<0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (-dPhiMin > tempDPhi) && (tempDPhi > -dPhiMax) ) tempMatchedClusters.push_back(matchedClusters[iMatch]);
       }
     }
   }
@@ -1053,37 +1097,27 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event
 vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
   Int_t TrackPos = -1;
   if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-       AliAODTrack* currTrack  = static_cast<AliAODTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        // even though hybrid tracks don't contain dublicates
-        // the hybrid track can share an ID with another copy if it is a copy
-        if(fRunningMode==7 &&!currTrack->IsHybridGlobalConstrainedGlobal()) continue;
-        TrackPos = iTrack;
-        break;
-      }
-    }
+    TrackPos = GetAODTrackPosition(event,trackID);
     if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
   }else TrackPos = trackID; // for ESD just take trackID
 
   vector<Int_t> tempMatchedClusters;
-  multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return tempMatchedClusters;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
-
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-
-        if (match_dPhi && match_dEta )tempMatchedClusters.push_back(it->second);
-      }
+  const Int_t *matchedClusters = 0;
+  Int_t nMatchedClusters = fTrackToCluster.Get(TrackPos,matchedClusters);
+  for (Int_t iMatch=0; iMatch<nMatchedClusters; iMatch++){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),matchedClusters[iMatch],tempDEta,tempDPhi)){
+      Bool_t match_dEta = kFALSE;
+      Bool_t match_dPhi = kFALSE;
+      if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+      else match_dEta = kFALSE;
+
+      if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+      else match_dPhi = kFALSE;
+
+      if (match_dPhi && match_dEta )tempMatchedClusters.push_back(matchedClusters[iMatch]);
     }
   }
   return tempMatchedClusters;
@@ -1093,28 +1127,18 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event
 vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, Float_t dR){
   Int_t TrackPos = -1;
   if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliAODTrack* currTrack  = static_cast<AliAODTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        // even though hybrid tracks don't contain dublicates
-        // the hybrid track can share an ID with another copy if it is a copy
-        if(fRunningMode==7 &&!currTrack->IsHybridGlobalConstrainedGlobal()) continue;
-        TrackPos = iTrack;
-        break;
-      }
-    }
+    TrackPos = GetAODTrackPosition(event,trackID);
     if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
   }else TrackPos = trackID; // for ESD just take trackID
   vector<Int_t> tempMatchedClusters;
-  multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return tempMatchedClusters;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedClusters.push_back(it->second);
-      }
+  const Int_t *matchedClusters = 0;
+  Int_t nMatchedClusters = fTrackToCluster.Get(TrackPos,matchedClusters);
+  for (Int_t iMatch=0; iMatch<nMatchedClusters; iMatch++){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),matchedClusters[iMatch],tempDEta,tempDPhi)){
+      if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedClusters.push_back(matchedClusters[iMatch]);
     }
   }
   return tempMatchedClusters;
@@ -1574,11 +1598,12 @@ void AliCaloTrackMatcher::DebugMatching(){
       cout << itr << " (" << tCharge << ") - " << GetNMatchedClusterIDsForTrack(fInputEvent,inTrack->GetID(),5,-5,0.2,-0.4) << "\t\t";
     }
     cout << endl;
-    multimap<Int_t,Int_t>::iterator it;
-    for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it) cout << it->first << " => " << it->second << '\n';
+    Int_t tempClus = -1;
+    for (UInt_t i=0; i<fTrackToCluster.fKeys.size(); i++)
+      for (Int_t j=fTrackToCluster.fOffsets[i]; j<fTrackToCluster.fOffsets[i+1]; j++) {cout << fTrackToCluster.fKeys[i] << " => " << fTrackToCluster.fValues[j] << '\n'; tempClus = fTrackToCluster.fValues[j];}
     cout << "mapClusterToTrack" << endl;
-    Int_t tempClus = it->second;
-    for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it) cout << it->first << " => " << it->second << '\n';
+    for (UInt_t i=0; i<fClusterToTrack.fKeys.size(); i++)
+      for (Int_t j=fClusterToTrack.fOffsets[i]; j<fClusterToTrack.fOffsets[i+1]; j++) cout << fClusterToTrack.fKeys[i] << " => " << fClusterToTrack.fValues[j] << '\n';
     vector<Int_t> tempTracks = GetMatchedTrackIDsForCluster(fInputEvent,tempClus, 5, -5, 0.2, -0.4);
     for(UInt_t iJ=0; iJ<tempTracks.size();iJ++){
       cout << tempClus << " - " << tempTracks.at(iJ) << endl;
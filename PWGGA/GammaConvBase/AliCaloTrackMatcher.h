@@ -51,6 +51,11 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     vector<Int_t> GetMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin);
     vector<Int_t> GetMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, Float_t dR);
 
+    // all associations of the current event (residual below fMatchingResidual), without copying:
+    // return the number of entries and point the array to them. Tracks are given by position in the event for AODs, by ID for ESDs
+    Int_t GetMatchedTrackPositionsForCluster(Int_t clusterID, const Int_t *&trackPositions) const {return fClusterToTrack.Get(clusterID,trackPositions);}
+    Int_t GetMatchedClusterIDsForTrackPosition(Int_t trackPosition, const Int_t *&clusterIDs) const {return fTrackToCluster.Get(trackPosition,clusterIDs);}
+
     // for cluster <-> V0-track matching
     Bool_t PropagateV0TrackToClusterAndGetMatchingResidual(AliVTrack* inSecTrack, AliVCluster* cluster, AliVEvent* event, Float_t &dEta, Float_t &dPhi);
     Bool_t IsSecTrackClusterAlreadyTried(Int_t trackID, Int_t clusterID);
@@ -86,6 +91,16 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     typedef pair<Float_t, Float_t> pairFloat;
     typedef map<pairInt, Int_t> mapT;
 
+    // flat (CSR) adjacency: the values associated to fKeys[i] are fValues[fOffsets[i]] ... fValues[fOffsets[i+1]-1]
+    struct Adjacency {
+      vector<Int_t> fKeys;
+      vector<Int_t> fOffsets;
+      vector<Int_t> fValues;
+      void Build(vector<pairInt> &pairs);
+      Int_t Get(Int_t key, const Int_t *&values) const;
+      void Clear() {fKeys.clear(); fOffsets.clear(); fValues.clear();}
+    };
+
     AliCaloTrackMatcher (const AliCaloTrackMatcher&); // not implemented
     AliCaloTrackMatcher & operator=(const AliCaloTrackMatcher&); // not implemented
 
@@ -93,6 +108,10 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     void Initialize(Int_t runNumber);
     void ProcessEvent(AliVEvent *event);
     void SetLogBinningYTH2(TH2* histoRebin);
+    void FillClusterGrid(AliVEvent *event, Int_t nClus);
+    Int_t GetClusterGridCell(Double_t x, Double_t y, Double_t z, Int_t dx=0, Int_t dy=0, Int_t dz=0);
+    void GetClusterCandidates(Double_t *exPos);
+    Int_t GetAODTrackPosition(AliVEvent *event, Int_t trackID);
 
     // debug methods
     void DebugMatching();
@@ -121,8 +140,14 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
 
     TClonesArray*         fArrClusters;            //! array with clusters
 
-    multimap<Int_t,Int_t> fMapTrackToCluster;      //! connects a given track ID with all associated cluster IDs
-    multimap<Int_t,Int_t> fMapClusterToTrack;      //! connects a given cluster ID with all associated track IDs
+    Adjacency             fTrackToCluster;         //! connects a given track ID with all associated cluster IDs
+    Adjacency             fClusterToTrack;         //! connects a given cluster ID with all associated track IDs
+    vector<pairInt>       fMatchedPairs;           //! (track, cluster) associations found in ProcessEvent
+    Adjacency             fClusterGrid;            //! cluster indices per spatial cell of the current event
+    vector<Int_t>         fClusterCandidates;      //! clusters around the current track
+    Double_t              fClusterGridCellSize;    //! cell size of fClusterGrid
+    map<Int_t,Int_t>      fAODTrackIDToPos;        //! AOD track ID to position in the event
+    Bool_t                fAODTrackPosFilled;      //! fAODTrackIDToPos is filled for the current event
 
     Int_t                 fNEntries;               //! number of current TrackID/ClusterID -> Eta/Phi connections
     vector<pairFloat>     fVectorDeltaEtaDeltaPhi; //! vector of all matching residuals for a specific TrackID/ClusterID
@@ -145,7 +170,7 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     Bool_t                fDoLightOutput;          // switch for running light output, kFALSE -> normal mode, kTRUE -> light mode
 
     Double_t              fMassHypothesis;          // mass used for track propagation to calorimeter surface
-    ClassDef(AliCaloTrackMatcher,11)
+    ClassDef(AliCaloTrackMatcher,12)
 };
 
 #endif
@@ -60,6 +60,12 @@ class AliConversionAODBGHandlerRP: public TObject{
                                                       AliVEvent *fInputEvent );
     Int_t GetNBGEvents                              ( TList * const eventGammas,
                                                       AliVEvent *fInputEvent );
+    // access by bins as obtained from FindBins, to avoid recomputing the event plane for every pool event
+    AliGammaConversionPhotonVector* GetBGGoodGammas ( Int_t psibin,
+                                                      Int_t zbin,
+                                                      Int_t event )                                 { return &(fBGEvents[psibin][zbin][event]) ;}
+    Int_t GetNBGEvents                              ( Int_t psibin,
+                                                      Int_t zbin ) const                            { return fNBGEvents[psibin][zbin]          ;}
     Int_t GetNRPBins                                ()const                                         { return fNBinsRP                             ;}
     Int_t GetNZBins                                 ()const                                         { return fNBinsZ                              ;}
     Int_t GetNMultiplicityBins                      ()const                                         { return fNBinsMultiplicity                   ;}
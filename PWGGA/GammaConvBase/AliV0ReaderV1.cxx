@@ -650,8 +650,8 @@ void AliV0ReaderV1::UserExec(Option_t *option){
 Bool_t AliV0ReaderV1::ProcessEvent(AliVEvent *inputEvent,AliMCEvent *mcEvent)
 {
   if (!fConversionCuts->GetPIDResponse()) fConversionCuts->InitPIDResponse();
-  //Reset the TClonesArray
-  fConversionGammas->Delete();
+  //Reset the TClonesArray, the photons do not allocate memory: keep the slots to be reused for the next photons
+  fConversionGammas->Clear();
 
   //Clear TBits object with accepted v0s from previous event
   if (kAddv0sInESDFilter){fPCMv0BitField->Clear();}
@@ -1286,7 +1286,7 @@ Bool_t AliV0ReaderV1::GetAODConversionGammas(){
   if(fConversionGammas == NULL){
     fConversionGammas = new TClonesArray("AliAODConversionPhoton",100);
   }
-  fConversionGammas->Delete();//Reset the TClonesArray
+  fConversionGammas->Clear();//Reset the TClonesArray, keeping the slots
 
   //Get Gammas from satellite AOD gamma branch
 
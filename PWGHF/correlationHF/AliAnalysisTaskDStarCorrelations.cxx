@@ -80,6 +80,7 @@ fCorrelator(0x0),
 fselect(0),
 fmontecarlo(kFALSE),
 fmixing(kFALSE),
+fSharedPoolName(""),
 fmult(kFALSE),
 fnmultBins(-1),
 fmultarray(0x0),
@@ -144,6 +145,7 @@ fCorrelator(0x0),
 fselect(0),
 fmontecarlo(kFALSE),
 fmixing(kFALSE),
+fSharedPoolName(""),
 fmult(kFALSE),
 fnmultBins(-1),
 fmultarray(0x0),
@@ -341,6 +343,7 @@ void AliAnalysisTaskDStarCorrelations::UserCreateOutputObjects(){
 	fCorrelator->SetDeltaPhiInterval(  -0.5*Pi, 1.5*Pi); // set correct phi interval
 	//fCorrelator->SetDeltaPhiInterval((-0.5)*Pi,(1.5)*Pi); // set correct phi interval
 	fCorrelator->SetEventMixing(fmixing); //set kFALSE/kTRUE for mixing Off/On
+	fCorrelator->SetSharedPoolName(fSharedPoolName);
 	fCorrelator->SetAssociatedParticleType(fselect); // set 1/2/3 for hadron/kaons/kzeros
 	fCorrelator->SetApplyDisplacementCut(fDisplacement); //set kFALSE/kTRUE for using the displacement cut
 	fCorrelator->SetUseMC(fmontecarlo);
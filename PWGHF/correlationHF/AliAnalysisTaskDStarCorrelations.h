@@ -97,6 +97,7 @@ class AliAnalysisTaskDStarCorrelations : public AliAnalysisTaskSE
     void SetCorrelator(Int_t l) {fselect = l;} // select 1 for hadrons, 2 for Kaons, 3 for Kzeros
     void SetMonteCarlo(Bool_t k) {fmontecarlo = k; printf("Siamo qui    \n");}
     void SetUseMixing (Bool_t j) {fmixing = j;}
+    void SetSharedMixingPool(const char* name) {fSharedPoolName = name;} // share the mixing pool with other correlation wagons (same pool binning and associated cuts)
     void SetUseMult (Bool_t j) {fmult = j;}
     void SetUseFullMode (Bool_t j) {fFullmode = j;}
     void SetCollSys(CollSyst system){fSystem=system;} // select between pp (kFALSE) or PbPb (kTRUE)
@@ -191,6 +192,7 @@ private:
   Int_t fselect; // select what to correlate with a D* 1-chargedtracks,2-chargedkaons,3-k0s
   Bool_t fmontecarlo;//switch for MC
   Bool_t fmixing;// switch for event mixing
+  TString fSharedPoolName;// name of the mixing pool shared with other wagons (empty: private pool)
   Bool_t fmult;// switch for multiplicity analysis
   Int_t fnmultBins;
   Double_t* fmultarray;//[fnmultBins]
@@ -251,7 +253,7 @@ private:
     TTree *fTreeD;
    
   TProfile* fMultEstimatorAvg[4];
-  ClassDef(AliAnalysisTaskDStarCorrelations,11); // class for D meson correlations
+  ClassDef(AliAnalysisTaskDStarCorrelations,12); // class for D meson correlations
   
 };
 
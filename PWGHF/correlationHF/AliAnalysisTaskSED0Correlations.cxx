@@ -97,6 +97,7 @@ AliAnalysisTaskSE(),
   fRecoD0(kTRUE),
   fSelEvType(kFALSE),
   fMixing(kFALSE),
+  fSharedPoolName(""),
   fCounter(0),
   fNPtBins(1),
   fFillOnlyD0D0bar(0),
@@ -183,6 +184,7 @@ AliAnalysisTaskSED0Correlations::AliAnalysisTaskSED0Correlations(const char *nam
   fRecoD0(kTRUE),
   fSelEvType(kFALSE),
   fMixing(kFALSE),
+  fSharedPoolName(""),
   fCounter(0),
   fNPtBins(1),
   fFillOnlyD0D0bar(0),
@@ -293,6 +295,7 @@ AliAnalysisTaskSED0Correlations::AliAnalysisTaskSED0Correlations(const AliAnalys
   fRecoD0(source.fRecoD0),
   fSelEvType(source.fSelEvType),
   fMixing(source.fMixing),
+  fSharedPoolName(source.fSharedPoolName),
   fCounter(source.fCounter),
   fNPtBins(source.fNPtBins),
   fFillOnlyD0D0bar(source.fFillOnlyD0D0bar),
@@ -550,6 +553,7 @@ void AliAnalysisTaskSED0Correlations::UserCreateOutputObjects()
   fCorrelatorKc->SetDeltaPhiInterval(-TMath::Pi()/2,3*TMath::Pi()/2);
   fCorrelatorK0->SetDeltaPhiInterval(-TMath::Pi()/2,3*TMath::Pi()/2);
   fCorrelatorTr->SetEventMixing(fMixing);// sets the analysis on a single event (kFALSE) or mixed events (kTRUE)
+  fCorrelatorTr->SetSharedPoolName(fSharedPoolName);
   fCorrelatorKc->SetEventMixing(fMixing);
   fCorrelatorK0->SetEventMixing(fMixing);
   fCorrelatorTr->SetAssociatedParticleType(1);// set 1 for correlations with hadrons, 2 with kaons, 3 with KZeros
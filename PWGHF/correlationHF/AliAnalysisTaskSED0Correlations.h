@@ -104,6 +104,7 @@ class AliAnalysisTaskSED0Correlations : public AliAnalysisTaskSE
   void PrintBinsAndLimits();
   Int_t PtBinCorr(Double_t pt) const;
   void SetEvMixing(Bool_t mix) {fMixing=mix;}
+  void SetSharedMixingPool(const char* name) {fSharedPoolName=name;} // share the track mixing pool with other correlation wagons (same pool binning and track cuts)
   void SetEtaForCorrel(Double_t etacorr) {fEtaForCorrel=etacorr;}
   void SetSpeed(SpeedType speed) {fSpeed=speed;}
   void SetMergePools(Bool_t mergepools) {fMergePools=mergepools;}
@@ -184,6 +185,7 @@ class AliAnalysisTaskSED0Correlations : public AliAnalysisTaskSE
   Bool_t    fRecoD0;   		       	// flag for using MC reconstructed (kTRUE) or pure kinematic MC (kFALSE) - D0
   Bool_t    fSelEvType;		       	// flag for enabling selection of event tpye (PP, GS, FE, ...) on MC analysis
   Bool_t    fMixing;			// flag to enable also event mixing
+  TString   fSharedPoolName;		// name of the track mixing pool shared with other wagons (empty: private pool)
   AliNormalizationCounter *fCounter;	//!AliNormalizationCounter on output slot 4
   Int_t     fNPtBins;             	// Number of pt bins
   Int_t     fFillOnlyD0D0bar;     	// flag to fill mass histogram with D0/D0bar only (0 = fill with both, 1 = fill with D0 only, 2 = fill with D0bar only)
@@ -240,7 +242,7 @@ class AliAnalysisTaskSED0Correlations : public AliAnalysisTaskSE
   TObjArray *fTrackArray;		// Array with selected tracks for association
   Bool_t    fTrackArrayFilled;		// Flag to fill fTrackArray or not (if already filled)
 
-  ClassDef(AliAnalysisTaskSED0Correlations,18); // AliAnalysisTaskSE for D0->Kpi - h correlations
+  ClassDef(AliAnalysisTaskSED0Correlations,19); // AliAnalysisTaskSE for D0->Kpi - h correlations
 };
 
 #endif
@@ -74,6 +74,7 @@ fMCGenEvType(kFALSE),
 fAutoSignalSBRange(kFALSE),
 farrayMC(0x0),
 fMixing(kFALSE),
+fSharedPoolName(""),
 fAssoParType(0),
 fDplusCuts(0),
 fAssoCuts(0),
@@ -145,6 +146,7 @@ fMCGenEvType(kFALSE),
 fAutoSignalSBRange(kFALSE),
 farrayMC(0x0),
 fMixing(kFALSE),
+fSharedPoolName(""),
 fAssoParType(0),
 fDplusCuts(0),
 fAssoCuts(AsscCuts),
@@ -229,6 +231,7 @@ fMCGenEvType(source.fMCGenEvType),
 fAutoSignalSBRange(source.fAutoSignalSBRange),
 farrayMC(source.farrayMC),
 fMixing(source.fMixing),
+fSharedPoolName(source.fSharedPoolName),
 fAssoParType(source.fAssoParType),
 fDplusCuts(source.fDplusCuts),
 fAssoCuts(source.fAssoCuts),
@@ -549,6 +552,7 @@ void AliAnalysisTaskSEDplusCorrelations::UserCreateOutputObjects()
     fCorrelator = new AliHFCorrelator("Correlator",fAssoCuts,fSystem,fDplusCuts);
     fCorrelator->SetDeltaPhiInterval(-0.5*Pi, 1.5*Pi);
     fCorrelator->SetEventMixing(fMixing);
+    fCorrelator->SetSharedPoolName(fSharedPoolName);
     fCorrelator->SetAssociatedParticleType(fAssoParType);
     //fCorrelator->SetApplyDisplacementCut(fDisplacement); //set kFALSE/kTRUE for using the displacement cut
     fCorrelator->SetUseReco(fRecoTrk);
@@ -53,6 +53,7 @@ class AliAnalysisTaskSEDplusCorrelations : public AliAnalysisTaskSE
     void SetCorrFormTrack(Bool_t reco){fRecoTrk=reco;}
     void SetDataOrMC(Bool_t readMC){fReadMC=readMC;}
     void SetEventMixing(Bool_t mixing){fMixing=mixing;}
+    void SetSharedMixingPool(const char* name){fSharedPoolName=name;} // share the mixing pool with other correlation wagons (same pool binning and associated cuts)
     void SetCorrelator(Int_t number) {fAssoParType = number;} // select 1 for hadrons, 2 for Kaons, 3 for Kzeros
     void SetSystem(Bool_t system){fSystem=system;} // select between pp (kFALSE) or PbPb (kTRUE)
     //void SetEtaRange(Double_t etacorr) {fEtaRange=etacorr;}
@@ -129,6 +130,7 @@ class AliAnalysisTaskSEDplusCorrelations : public AliAnalysisTaskSE
     Bool_t fMCGenEvType; //Gen MC event type
     TClonesArray* farrayMC; //! mcarray
     Bool_t fMixing;// switch for event mixing
+    TString fSharedPoolName;// name of the mixing pool shared with other wagons (empty: private pool)
     Int_t fAssoParType; // Correlation Option between D+ and (1-chargedtracks,2-chargedkaons,3-k0s )
     AliRDHFCutsDplustoKpipi *fDplusCuts;  // Cuts D+
     AliHFAssociatedTrackCuts *fAssoCuts; // cuts for associated track
@@ -188,7 +190,7 @@ class AliAnalysisTaskSEDplusCorrelations : public AliAnalysisTaskSE
     std::vector<Double_t>  fRSBLowLim;      // Right SB upper lim
     std::vector<Double_t>  fRSBUppLim;      // Right SB upper lim
     
-    ClassDef(AliAnalysisTaskSEDplusCorrelations,10); // class for D+ meson correlations
+    ClassDef(AliAnalysisTaskSEDplusCorrelations,11); // class for D+ meson correlations
     
 };
 
@@ -39,10 +39,36 @@
 #include "AliReducedParticle.h"
 #include "AliCentrality.h"
 #include "AliAODMCParticle.h"
+#include "AliAnalysisManager.h"
+#include <map>
+#include <string>
 
 using std::cout;
 using std::endl;
 
+namespace {
+  // mixing pools shared between correlators with the same event binning (e.g. D0, D+ and D*+ wagons of a train)
+  struct SharedPool {
+    AliEventPoolManager* fPoolMgr; // pool manager
+    Int_t fNUsers; // number of correlators using the pool
+    std::vector<Double_t> fCentBins; // multiplicity/centrality binning
+    std::vector<Double_t> fZvtxBins; // z vertex binning
+    Long64_t fPendingEntry; // entry of the event waiting to be added to the pool
+    AliEventPool* fPendingPool; // pool of the waiting event
+    TObjArray* fPendingEvent; // associated particles of the waiting event
+  };
+
+  std::map<std::string, SharedPool>& SharedPools(){
+    static std::map<std::string, SharedPool> pools;
+    return pools;
+  }
+
+  Long64_t CurrentEntry(){
+    AliAnalysisManager* mgr = AliAnalysisManager::GetAnalysisManager();
+    return mgr ? mgr->GetCurrentEntry() : -1;
+  }
+}
+
 //_____________________________________________________
 AliHFCorrelator::AliHFCorrelator() :
 //
@@ -91,7 +117,25 @@ fnMultBinLimits(1),
 fMultBinLimits(0),
 fMinMultCand(-1.),
 fMaxMultCand(100000.),
-fStoreInfoSoftPiME(kFALSE)
+fStoreInfoSoftPiME(kFALSE),
+fSharedPoolName(),
+fOwnPoolMgr(kTRUE),
+fTrackBuffer(0x0),
+fCacheValid(kFALSE),
+fCacheEvent(0x0),
+fCacheTrack(),
+fCacheEta(),
+fCachePhi(),
+fCachePt(),
+fCacheD0(),
+fCacheWeight(),
+fCachePx(),
+fCachePy(),
+fCachePz(),
+fCacheE(),
+fCacheLabel(),
+fCacheID(),
+fCacheCharge()
 {
 	// default constructor	
 }
@@ -142,7 +186,25 @@ fnMultBinLimits(1),
 fMultBinLimits(0),
 fMinMultCand(-1.),
 fMaxMultCand(100000.),
-fStoreInfoSoftPiME(kFALSE)
+fStoreInfoSoftPiME(kFALSE),
+fSharedPoolName(),
+fOwnPoolMgr(kTRUE),
+fTrackBuffer(0x0),
+fCacheValid(kFALSE),
+fCacheEvent(0x0),
+fCacheTrack(),
+fCacheEta(),
+fCachePhi(),
+fCachePt(),
+fCacheD0(),
+fCacheWeight(),
+fCachePx(),
+fCachePy(),
+fCachePz(),
+fCacheE(),
+fCacheLabel(),
+fCacheID(),
+fCacheCharge()
 {
 	fhadcuts = cuts;
      if(!fDMesonCutObject) AliInfo("D meson cut object not loaded - if using centrality the estimator will be V0M!");
@@ -192,7 +254,25 @@ fnMultBinLimits(1),
 fMultBinLimits(0),
 fMinMultCand(-1.),
 fMaxMultCand(100000.),
-fStoreInfoSoftPiME(kFALSE)
+fStoreInfoSoftPiME(kFALSE),
+fSharedPoolName(),
+fOwnPoolMgr(kTRUE),
+fTrackBuffer(0x0),
+fCacheValid(kFALSE),
+fCacheEvent(0x0),
+fCacheTrack(),
+fCacheEta(),
+fCachePhi(),
+fCachePt(),
+fCacheD0(),
+fCacheWeight(),
+fCachePx(),
+fCachePy(),
+fCachePz(),
+fCacheE(),
+fCacheLabel(),
+fCacheID(),
+fCacheCharge()
 {
 	fhadcuts = cuts;
     fDMesonCutObject = cutObject;
@@ -209,11 +289,23 @@ AliHFCorrelator::~AliHFCorrelator()
 // destructor
 //	
 	
+	if(fPoolMgr && !fOwnPoolMgr) { // shared pool, deleted with its last user
+	  std::map<std::string, SharedPool>::iterator shared = SharedPools().find(fSharedPoolName.Data());
+	  if(shared!=SharedPools().end() && --(shared->second.fNUsers)==0) {
+	    delete shared->second.fPendingEvent;
+	    delete shared->second.fPoolMgr;
+	    SharedPools().erase(shared);
+	  }
+	  fPoolMgr=0;
+	  fPool=0;
+	}
 	if(fPoolMgr)  {delete fPoolMgr; fPoolMgr=0;}       
 	if(fPool) {delete fPool; fPool=0;}
 	if(fhadcuts) {delete fhadcuts; fhadcuts=0;}
 	if(fAODEvent) {delete fAODEvent; fAODEvent=0;}
     if(fDMesonCutObject) {delete fDMesonCutObject; fDMesonCutObject=0;}
+	if(fAssociatedTracks==fTrackBuffer) fAssociatedTracks=0;
+	if(fTrackBuffer) {delete fTrackBuffer; fTrackBuffer=0;}
 	if(fAssociatedTracks) {delete fAssociatedTracks; fAssociatedTracks=0;}
 	if(fmcArray) {delete fmcArray; fmcArray=0;}
 	if(fReducedPart) {delete fReducedPart; fReducedPart=0;}
@@ -275,8 +367,35 @@ Bool_t AliHFCorrelator::DefineEventPool(){
 	Int_t NofZVrtxBins = fhadcuts->GetNZvtxPoolBins();
 	Double_t *ZVrtxBins = fhadcuts->GetZvtxPoolBins();
 		
-			
-	fPoolMgr = new AliEventPoolManager(MaxNofEvents, MinNofTracks, NofCentBins, CentBins, NofZVrtxBins, ZVrtxBins);
+	if(!fSharedPoolName.IsNull()) { // reuse the pool of another correlator, if the binning is the same
+	  std::vector<Double_t> centBins(CentBins,CentBins+NofCentBins+1);
+	  std::vector<Double_t> zVrtxBins(ZVrtxBins,ZVrtxBins+NofZVrtxBins+1);
+	  std::map<std::string, SharedPool>::iterator shared = SharedPools().find(fSharedPoolName.Data());
+	  if(shared!=SharedPools().end()) {
+	    if(shared->second.fCentBins==centBins && shared->second.fZvtxBins==zVrtxBins) {
+	      fPoolMgr = shared->second.fPoolMgr;
+	      fOwnPoolMgr = kFALSE;
+	      shared->second.fNUsers++;
+	      return kTRUE;
+	    }
+	    AliWarning(Form("Binning different from the shared pool %s, using a private pool",fSharedPoolName.Data()));
+	    fSharedPoolName = "";
+	  }
+	  else {
+	    fPoolMgr = new AliEventPoolManager(MaxNofEvents, MinNofTracks, NofCentBins, CentBins, NofZVrtxBins, ZVrtxBins);
+	    SharedPool &pool = SharedPools()[fSharedPoolName.Data()];
+	    pool.fPoolMgr = fPoolMgr;
+	    pool.fNUsers = 1;
+	    pool.fCentBins = centBins;
+	    pool.fZvtxBins = zVrtxBins;
+	    pool.fPendingEntry = -1;
+	    pool.fPendingPool = 0x0;
+	    pool.fPendingEvent = 0x0;
+	    fOwnPoolMgr = kFALSE;
+	  }
+	}
+
+	if(!fPoolMgr) fPoolMgr = new AliEventPoolManager(MaxNofEvents, MinNofTracks, NofCentBins, CentBins, NofZVrtxBins, ZVrtxBins);
 	if(!fPoolMgr) return kFALSE;
 
 	Double_t targetFrac = fhadcuts->GetTargetFracTracks();
@@ -298,6 +417,8 @@ Bool_t AliHFCorrelator::Initialize(){
     return kFALSE;
   }
     //std::cout << "No AOD event" << std::endl;
+  fCacheValid = kFALSE;
+  CommitSharedPool();
 	
 	AliCentrality *centralityObj = 0;
 	//Int_t multiplicity = -1;
@@ -364,17 +485,14 @@ Bool_t AliHFCorrelator::ProcessAssociatedTracks(Int_t EventLoopIndex, const TObj
   // associatedTracks is not deleted, it should be (if needed) deleted in the user task
   
   if(!fmixing){ // analysis on Single Event
-    if(fAssociatedTracks){
+    if(fAssociatedTracks && fAssociatedTracks!=fTrackBuffer){
       fAssociatedTracks->Delete();
       delete fAssociatedTracks;
     }      
-    if(fselect==kHadron || fselect ==kKaon){
-      fAssociatedTracks = AcceptAndReduceTracks(fAODEvent);
-      fAssociatedTracks->SetOwner(kTRUE);
-    }
-    if(fselect==kKZero) {
-      fAssociatedTracks = AcceptAndReduceKZero(fAODEvent);
-      fAssociatedTracks->SetOwner(kTRUE);
+    fAssociatedTracks = NULL;
+    if(fselect==kHadron || fselect ==kKaon || fselect==kKZero){ // selection cached once per event, reduced particles in a reusable buffer
+      FillAssociatedTrackBuffer();
+      fAssociatedTracks = fTrackBuffer;
     }	
     if(fselect==kElectron && associatedTracks) {
       fAssociatedTracks=(TObjArray*)associatedTracks->Clone();// Maybe better to call the copy constructor
@@ -430,7 +548,17 @@ Bool_t AliHFCorrelator::PoolUpdate(const TObjArray* associatedTracks){
 		  objArr = new TObjArray(*associatedTracks);
 		}
 		else return kFALSE;
-		if(objArr->GetEntriesFast()>0) fPool->UpdatePool(objArr); // updating the pool only if there are entries in the array
+		if(objArr->GetEntriesFast()==0) {delete objArr; return kTRUE;} // updating the pool only if there are entries in the array
+		Long64_t entry = CurrentEntry();
+		if(!fSharedPoolName.IsNull() && entry>=0) { // shared pool: added once, when the next event starts (the other correlators still mix with it)
+		  SharedPool &shared = SharedPools()[fSharedPoolName.Data()];
+		  if(shared.fPendingEntry==entry) {delete objArr; return kTRUE;}
+		  CommitSharedPool();
+		  shared.fPendingEntry = entry;
+		  shared.fPendingPool = fPool;
+		  shared.fPendingEvent = objArr;
+		}
+		else fPool->UpdatePool(objArr);
 	}
 		
 	return kTRUE;
@@ -466,6 +594,48 @@ Int_t AliHFCorrelator::MultBin(Double_t Mult) const {
 
 //_____________________________________________________
 TObjArray*  AliHFCorrelator::AcceptAndReduceTracks(AliAODEvent* inputEvent){
+  // selected tracks (new array owning the reduced particles), the selection is cached once per event
+  FillAssociatedCache(inputEvent);
+  return ReduceCachedParticles();
+}
+
+//_____________________________________________________
+TObjArray*  AliHFCorrelator::AcceptAndReduceKZero(AliAODEvent* inputEvent){
+  // selected kzeros (new array owning the reduced particles), the selection is cached once per event
+  FillAssociatedCache(inputEvent);
+  return ReduceCachedParticles();
+}
+
+//_____________________________________________________
+void AliHFCorrelator::FillAssociatedCache(AliAODEvent* inputEvent){
+  // applies the selection of the associated particles which does not depend on the trigger
+  // and stores the accepted particles as arrays (one per quantity)
+
+  if(fCacheValid && fCacheEvent==inputEvent) return;
+
+  fCacheTrack.clear();
+  fCacheEta.clear();
+  fCachePhi.clear();
+  fCachePt.clear();
+  fCacheD0.clear();
+  fCacheWeight.clear();
+  fCachePx.clear();
+  fCachePy.clear();
+  fCachePz.clear();
+  fCacheE.clear();
+  fCacheLabel.clear();
+  fCacheID.clear();
+  fCacheCharge.clear();
+
+  if(fselect==kKZero) CacheAssociatedKZero(inputEvent);
+  else CacheAssociatedTracks(inputEvent);
+
+  fCacheEvent = inputEvent;
+  fCacheValid = kTRUE;
+}
+
+//_____________________________________________________
+void AliHFCorrelator::CacheAssociatedTracks(AliAODEvent* inputEvent){
 
   Double_t weight=1.;
   Int_t nTracks = inputEvent->GetNumberOfTracks();
@@ -477,18 +647,14 @@ TObjArray*  AliHFCorrelator::AcceptAndReduceTracks(AliAODEvent* inputEvent){
   
   Double_t Bz = inputEvent->GetMagneticField();
 	
-  
-  TObjArray* tracksClone = new TObjArray;
-  tracksClone->SetOwner(kTRUE);
-  
   //*******************************************************
   // use reconstruction
   if(fUseReco){
+    fCacheTrack.reserve(nTracks);
     for (Int_t iTrack=0; iTrack<nTracks; ++iTrack) {
       AliAODTrack* track = dynamic_cast<AliAODTrack*>(inputEvent->GetTrack(iTrack));
       if (!track) continue;
       if(!fhadcuts->IsHadronSelected(track,&vESD,Bz)) continue; // apply ESD level selections
-      if(!fhadcuts->Charge(fDCharge,track)) continue; // apply selection on charge, if required
 
       Double_t pT = track->Pt();
       
@@ -511,16 +677,27 @@ TObjArray*  AliHFCorrelator::AcceptAndReduceTracks(AliAODEvent* inputEvent){
       }
       
       if(!fhadcuts->CheckHadronKinematic(pT,d0)) continue; // apply kinematic cuts
-      Bool_t rejectsoftpi = kTRUE;// TO BE CHECKED: DO WE WANT IT TO kTRUE AS A DEFAULT?
-      if(fD0cand && !fmixing) rejectsoftpi = fhadcuts->InvMassDstarRejection(fD0cand,track,fhypD0); // TO BE CHECKED: WHY NOT FOR EM?
-      
       
       if(fselect ==kKaon){	
 	if(!fhadcuts->CheckKaonCompatibility(track,fmontecarlo,fmcArray,fPIDmode)) continue; // check if it is a Kaon - data and MC
       }
       weight=fhadcuts->GetTrackWeight(pT,track->Eta(),pos[2]);
-      if(fStoreInfoSoftPiME) tracksClone->Add(new AliReducedParticle(track->Eta(), track->Phi(), pT,track->GetLabel(),track->GetID(),d0,rejectsoftpi,track->Charge(),weight,track->Px(),track->Py(),track->Pz(),track->E(0.1396)));
-      else tracksClone->Add(new AliReducedParticle(track->Eta(), track->Phi(), pT,track->GetLabel(),track->GetID(),d0,rejectsoftpi,track->Charge(),weight));
+
+      fCacheTrack.push_back(track);
+      fCacheEta.push_back(track->Eta());
+      fCachePhi.push_back(track->Phi());
+      fCachePt.push_back(pT);
+      fCacheD0.push_back(d0);
+      fCacheWeight.push_back(weight);
+      fCacheLabel.push_back(track->GetLabel());
+      fCacheID.push_back(track->GetID());
+      fCacheCharge.push_back(track->Charge());
+      if(fStoreInfoSoftPiME) {
+        fCachePx.push_back(track->Px());
+        fCachePy.push_back(track->Py());
+        fCachePz.push_back(track->Pz());
+        fCacheE.push_back(track->E(0.1396));
+      }
     } // end loop on tracks
   } // end if use reconstruction kTRUE
   
@@ -546,20 +723,24 @@ if(fselect ==kHadron) {if(!((PDG==321)||(PDG==211)||(PDG==2212)||(PDG==13)||(PDG
       Double_t d0 =1; // set 1 fot the moment - no displacement calculation implemented yet
       if(!fhadcuts->CheckHadronKinematic(pT,d0)) continue; // apply kinematic cuts
       
-      tracksClone->Add(new AliReducedParticle(mcPart->Eta(), mcPart->Phi(), pT,iPart,-1,d0,kFALSE,mcPart->Charge()));
+      fCacheTrack.push_back(NULL);
+      fCacheEta.push_back(mcPart->Eta());
+      fCachePhi.push_back(mcPart->Phi());
+      fCachePt.push_back(pT);
+      fCacheD0.push_back(d0);
+      fCacheWeight.push_back(1.);
+      fCacheLabel.push_back(iPart);
+      fCacheID.push_back(-1);
+      fCacheCharge.push_back(mcPart->Charge());
     }
     
   } // end if use  MC truth
-  
-  
-  return tracksClone;
 }
 
 //_____________________________________________________
-TObjArray*  AliHFCorrelator::AcceptAndReduceKZero(AliAODEvent* inputEvent){
+void AliHFCorrelator::CacheAssociatedKZero(AliAODEvent* inputEvent){
 	
 	Int_t nOfVZeros = inputEvent->GetNumberOfV0s();
-	TObjArray* KZeroClone = new TObjArray;
 	AliAODVertex *vertex1 = (AliAODVertex*)inputEvent->GetPrimaryVertex();
 
  // use reconstruction	 	
@@ -617,7 +798,15 @@ TObjArray*  AliHFCorrelator::AcceptAndReduceKZero(AliAODEvent* inputEvent){
 		// if there are more D* candidates per event, loopindex == 0 makes sure you fill the mass spectra only once!
 		
 		if(TMath::Abs(fk0InvMass-mPDGK0)>3*0.004) continue; // select candidates within 3 sigma
-		KZeroClone->Add(new AliReducedParticle(k0eta,k0Phi,k0pt,v0label));
+		fCacheTrack.push_back(NULL);
+		fCacheEta.push_back(k0eta);
+		fCachePhi.push_back(k0Phi);
+		fCachePt.push_back(k0pt);
+		fCacheD0.push_back(1.);
+		fCacheWeight.push_back(1.);
+		fCacheLabel.push_back(v0label);
+		fCacheID.push_back(-1);
+		fCacheCharge.push_back(0);
 		
 	}
      } // end if use reconstruction kTRUE
@@ -642,12 +831,83 @@ TObjArray*  AliHFCorrelator::AcceptAndReduceKZero(AliAODEvent* inputEvent){
             Double_t d0 =1; // set 1 fot the moment - no displacement calculation implemented yet
 			if(!fhadcuts->CheckHadronKinematic(pT,d0)) continue; // apply kinematic cuts
 			
-			KZeroClone->Add(new AliReducedParticle(mcPart->Eta(), mcPart->Phi(), pT,iPart,-1,d0,kTRUE,mcPart->Charge()));
+			fCacheTrack.push_back(NULL);
+			fCacheEta.push_back(mcPart->Eta());
+			fCachePhi.push_back(mcPart->Phi());
+			fCachePt.push_back(pT);
+			fCacheD0.push_back(d0);
+			fCacheWeight.push_back(1.);
+			fCacheLabel.push_back(iPart);
+			fCacheID.push_back(-1);
+			fCacheCharge.push_back(mcPart->Charge());
 		}
 		
 	} // end if use  MC truth
+}
 
+//_____________________________________________________
+Bool_t AliHFCorrelator::AcceptCachedParticle(Int_t i, Bool_t &rejectsoftpi){
+  // selection of the cached particle i which depends on the trigger
+
+  rejectsoftpi = kTRUE;// TO BE CHECKED: DO WE WANT IT TO kTRUE AS A DEFAULT?
+  AliAODTrack* track = fCacheTrack[i];
+  if(!track) return kTRUE; // MC truth and kzeros
+  if(!fhadcuts->Charge(fDCharge,track)) return kFALSE; // apply selection on charge, if required
+  if(fD0cand && !fmixing) rejectsoftpi = fhadcuts->InvMassDstarRejection(fD0cand,track,fhypD0); // TO BE CHECKED: WHY NOT FOR EM?
+  return kTRUE;
+}
+
+//_____________________________________________________
+AliReducedParticle* AliHFCorrelator::ReduceCachedParticle(Int_t i, Bool_t rejectsoftpi, TClonesArray* buffer) const{
+  // reduced particle for the cached particle i, created in the buffer if given
+
+  AliReducedParticle part;
+  if(fselect==kKZero && fUseReco) part = AliReducedParticle(fCacheEta[i],fCachePhi[i],fCachePt[i],fCacheLabel[i]);
+  else if(!fCacheTrack[i]) part = AliReducedParticle(fCacheEta[i],fCachePhi[i],fCachePt[i],fCacheLabel[i],-1,fCacheD0[i],fselect==kKZero,fCacheCharge[i]);
+  else if(fStoreInfoSoftPiME) part = AliReducedParticle(fCacheEta[i],fCachePhi[i],fCachePt[i],fCacheLabel[i],fCacheID[i],fCacheD0[i],rejectsoftpi,fCacheCharge[i],fCacheWeight[i],fCachePx[i],fCachePy[i],fCachePz[i],fCacheE[i]);
+  else part = AliReducedParticle(fCacheEta[i],fCachePhi[i],fCachePt[i],fCacheLabel[i],fCacheID[i],fCacheD0[i],rejectsoftpi,fCacheCharge[i],fCacheWeight[i]);
 
+  if(buffer) return new((*buffer)[buffer->GetEntriesFast()]) AliReducedParticle(part);
+  return new AliReducedParticle(part);
+}
 
-	return KZeroClone;
+//_____________________________________________________
+TObjArray* AliHFCorrelator::ReduceCachedParticles(){
+  // new array owning the reduced particles of the cache (as given to the event pool)
+
+  TObjArray* tracksClone = new TObjArray(fCachePt.size());
+  tracksClone->SetOwner(kTRUE);
+  Bool_t rejectsoftpi = kTRUE;
+  for(UInt_t i=0; i<fCachePt.size(); i++){
+    if(!AcceptCachedParticle(i,rejectsoftpi)) continue;
+    tracksClone->Add(ReduceCachedParticle(i,rejectsoftpi));
+  }
+  return tracksClone;
+}
+
+//_____________________________________________________
+void AliHFCorrelator::FillAssociatedTrackBuffer(){
+  // reduced particles for the current trigger, stored in a buffer reused for all triggers and events
+
+  FillAssociatedCache(fAODEvent);
+  if(!fTrackBuffer) fTrackBuffer = new TClonesArray("AliReducedParticle",100);
+  fTrackBuffer->Clear(); // reduced particles do not own memory
+  Bool_t rejectsoftpi = kTRUE;
+  for(UInt_t i=0; i<fCachePt.size(); i++){
+    if(!AcceptCachedParticle(i,rejectsoftpi)) continue;
+    ReduceCachedParticle(i,rejectsoftpi,fTrackBuffer);
+  }
+}
+
+//_____________________________________________________
+void AliHFCorrelator::CommitSharedPool(){
+  // adds the event waiting in the shared pool, once all the correlators are done with it
+
+  if(fSharedPoolName.IsNull()) return;
+  std::map<std::string, SharedPool>::iterator shared = SharedPools().find(fSharedPoolName.Data());
+  if(shared==SharedPools().end() || !shared->second.fPendingEvent) return;
+  if(shared->second.fPendingEntry==CurrentEntry()) return;
+  shared->second.fPendingPool->UpdatePool(shared->second.fPendingEvent);
+  shared->second.fPendingEvent = 0x0;
+  shared->second.fPendingPool = 0x0;
 }
@@ -36,6 +36,7 @@
 #include "AliReducedParticle.h"
 #include "AliVertexingHFUtils.h"
 #include "AliRDHFCuts.h"
+#include <vector>
 
 
 class AliHFCorrelator : public TNamed
@@ -75,7 +76,7 @@ class AliHFCorrelator : public TNamed
 	
 	
 	void SetAssociatedParticleType(Int_t type){fselect = type;}
-	void SetAODEvent(AliAODEvent* inputevent){fAODEvent = inputevent;}
+	void SetAODEvent(AliAODEvent* inputevent){fAODEvent = inputevent; fCacheValid = kFALSE;}
 	void SetMCArray(TClonesArray* mcArray){fmcArray = mcArray;}
 	void SetUseMC(Bool_t useMC){fmontecarlo = useMC;}
 	void SetApplyDisplacementCut(Int_t applycut){fUseImpactParameter = applycut;}
@@ -98,6 +99,7 @@ class AliHFCorrelator : public TNamed
 	Double_t SetCorrectPhiRange(Double_t phi); // sets all the angles in the correct range
 	void SetPidAssociated() {fhadcuts->SetPidAssociated();}
     	void SetStoreInfoSoftPiME(Bool_t storeInfoSoftPiME) {fStoreInfoSoftPiME=storeInfoSoftPiME;}
+	void SetSharedPoolName(const char* name) {fSharedPoolName = name;} // share the mixing pool with the correlators using the same name (same pool binning and associated track selection required)
 
 	//getters
 	AliEventPool* GetPool() {return fPool;}
@@ -130,6 +132,16 @@ class AliHFCorrelator : public TNamed
 	AliHFCorrelator(const AliHFCorrelator& vtxr);
 	AliHFCorrelator& operator=(const AliHFCorrelator& vtxr );
 
+	// event level cache of the associated particle selection, shared by all the triggers and by the pool update
+	void FillAssociatedCache(AliAODEvent* inputEvent); // applies the trigger independent selection once per event
+	void CacheAssociatedTracks(AliAODEvent* inputEvent);
+	void CacheAssociatedKZero(AliAODEvent* inputEvent);
+	Bool_t AcceptCachedParticle(Int_t i, Bool_t &rejectsoftpi); // trigger dependent selection (charge, soft pion)
+	AliReducedParticle* ReduceCachedParticle(Int_t i, Bool_t rejectsoftpi, TClonesArray* buffer=NULL) const;
+	TObjArray* ReduceCachedParticles(); // new array owning the reduced particles (for the pool and the user tasks)
+	void FillAssociatedTrackBuffer(); // reduced particles of the current trigger in the reusable buffer
+	void CommitSharedPool(); // adds the previous event to the shared pool
+
 	AliEventPoolManager* fPoolMgr;         //! event pool manager
 	AliEventPool * fPool; //! Pool for event mixing
 	AliHFAssociatedTrackCuts* fhadcuts;//! hadron cuts
@@ -175,8 +187,27 @@ class AliHFCorrelator : public TNamed
 	Double_t fMaxMultCand; /// minimum mult of the candidate
 
     Bool_t fStoreInfoSoftPiME; //save info on px, py, pz, E to use soft-pi cut in ME online analysis
-
-	ClassDef(AliHFCorrelator,4); // class for HF correlations
+	TString fSharedPoolName; // name of the mixing pool shared between correlators (empty: private pool)
+	Bool_t fOwnPoolMgr; //! the pool manager is not shared
+	TClonesArray* fTrackBuffer; //! reusable array of the reduced particles for the single event analysis
+
+	Bool_t fCacheValid; //! cache filled for the current event
+	AliAODEvent* fCacheEvent; //! event the cache was filled for
+	std::vector<AliAODTrack*> fCacheTrack; //! selected tracks (NULL for MC particles and KZeros)
+	std::vector<Double_t> fCacheEta; //! eta
+	std::vector<Double_t> fCachePhi; //! phi
+	std::vector<Double_t> fCachePt; //! pt
+	std::vector<Double_t> fCacheD0; //! impact parameter
+	std::vector<Double_t> fCacheWeight; //! efficiency weight
+	std::vector<Double_t> fCachePx; //! px (soft pion info for the mixing)
+	std::vector<Double_t> fCachePy; //! py
+	std::vector<Double_t> fCachePz; //! pz
+	std::vector<Double_t> fCacheE; //! energy with the pion mass
+	std::vector<Int_t> fCacheLabel; //! MC label
+	std::vector<Int_t> fCacheID; //! track ID
+	std::vector<Short_t> fCacheCharge; //! charge
+
+	ClassDef(AliHFCorrelator,5); // class for HF correlations
 };
 
 
@@ -28,6 +28,8 @@ class AliHFDhadronCorrSystUnc : public TNamed{
   AliHFDhadronCorrSystUnc(const char* name);
   ~AliHFDhadronCorrSystUnc();
   void InitEmptyHistosFromTemplate();
+  Bool_t LoadUncertaintiesFromTable(const char *config);
+  static void SetUncertaintyTableFile(const char *fileName);
   void InitStandardUncertaintiesPP2010(Int_t meson,Double_t ptD,Double_t minptAss,Double_t maxptAss);
   void InitStandardUncertaintiesPPb2013(Int_t meson,Double_t ptD,Double_t minptAss,Double_t maxptAss);
   void InitStandardUncertaintiesPPb2016(Int_t meson,Double_t ptD,Double_t minptAss,Double_t maxptAss);
@@ -22,6 +22,7 @@
 // Authors:
 //   Markus Fasel <M.Fasel@gsi.de>
 //
+#include <TArrayI.h>
 #include <TAxis.h>
 #include <TClass.h>
 #include <TF1.h>
@@ -283,6 +284,41 @@ Bool_t AliHFEpid::IsSelected(const AliHFEpidObject * const track, AliHFEcontaine
   return isSelected;
 }
 
+//____________________________________________________________
+Int_t AliHFEpid::SelectCandidates(Int_t ncandidates, const AliHFEpidObject * const *tracks, Bool_t *selected, AliHFEpidQAmanager *pidqa){
+  //
+  // Select all electron candidates of an event in one go
+  // The detectors are evaluated in the sorted order, each of them for all
+  // candidates which survived the previous detectors, so a track is dropped
+  // at the first detector rejecting it. The QA of a detector is filled in its
+  // pass (the detector PID objects fill it with their corrected track copy),
+  // hence grouped per detector instead of interleaved per track.
+  // The per-step correction containers are not filled, tasks needing
+  // them have to use the single track IsSelected
+  // Returns the number of selected candidates
+  //
+  if(ncandidates <= 0) return 0;
+  if(!TestBit(kDetectorsSorted)) SortDetectors();
+  TArrayI active(ncandidates);
+  Int_t nactive = 0;
+  for(Int_t icand = 0; icand < ncandidates; icand++){
+    selected[icand] = tracks[icand] != NULL;
+    if(selected[icand]) active[nactive++] = icand;
+  }
+  for(UInt_t idet = 0; idet < fNPIDdetectors && nactive; idet++){
+    AliHFEpidBase *detpid = fDetectorPID[fSortedOrder[idet]];
+    AliDebug(2, Form("Using Detector %s for %d candidates\n", SortedDetectorName(idet), nactive));
+    Int_t nsurvivors = 0;
+    for(Int_t iact = 0; iact < nactive; iact++){
+      Int_t icand = active[iact];
+      if(TMath::Abs(detpid->IsSelected(tracks[icand], pidqa)) != 11) selected[icand] = kFALSE;
+      else active[nsurvivors++] = icand;
+    }
+    nactive = nsurvivors;
+  }
+  return nactive;
+}
+
 //____________________________________________________________
 void AliHFEpid::SortDetectors(){
   //
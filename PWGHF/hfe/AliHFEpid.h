@@ -64,6 +64,7 @@ class AliHFEpid : public TNamed{
     
     Bool_t InitializePID(Int_t run = 0);
     Bool_t IsSelected(const AliHFEpidObject * const track, AliHFEcontainer *cont = NULL, const Char_t *contname = "trackContainer", AliHFEpidQAmanager *qa = NULL);
+    Int_t SelectCandidates(Int_t ncandidates, const AliHFEpidObject * const *tracks, Bool_t *selected, AliHFEpidQAmanager *qa = NULL);
 
     Bool_t HasMCData() const { return TestBit(kHasMCData); };
 
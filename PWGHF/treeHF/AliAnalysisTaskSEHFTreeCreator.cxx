@@ -342,6 +342,12 @@ fApplyPhysicsSelOnline(false),
 fEnableEventDownsampling(false),
 fFracToKeepEventDownsampling(1.1),
 fSeedEventDownsampling(0),
+fCandBufferSize(0),
+fFloat16NBits(0),
+fFloatCompression(-1),
+fFloatBasketSize(0),
+fSharePIDNsigma(true),
+fPIDNsigmaTable(nullptr),
 fCdbEntry(nullptr)
 {
   fParticleCollArray.SetOwner(kTRUE);
@@ -517,6 +523,7 @@ AliAnalysisTaskSEHFTreeCreator::~AliAnalysisTaskSEHFTreeCreator()
   delete fTreeHandlerGenLb;
   delete fTreeHandlerGenParticle;
   delete fTreeEvChar;
+  delete fPIDNsigmaTable;
 }
 
 //________________________________________________________________________
@@ -689,6 +696,9 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
   fTreeEvChar->Branch("pthard", &fpthard);
   fTreeEvChar->SetMaxVirtualSize(1.e+8/nEnabledTrees);
 
+  // nsigma of the tracks computed once per event and PID object, shared by all the species
+  if(fSharePIDNsigma && !fPIDNsigmaTable) fPIDNsigmaTable = new AliHFPIDNsigmaTable();
+
   if(fWriteVariableTreeD0){
     OpenFile(6);
     TString nameoutput = "tree_D0";
@@ -701,6 +711,10 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
     fTreeHandlerD0->SetTrackingEfficiency(fTrackingEfficiency);
     fTreeHandlerD0->SetJetProperties(fJetRadius,fJetAlgorithm,fMinJetPt);
     fTreeHandlerD0->SetSubJetProperties(fSubJetRadius,fSubJetAlgorithm,fSoftDropZCut,fSoftDropBeta);
+    fTreeHandlerD0->SetCandidateBufferSize(fCandBufferSize);
+    fTreeHandlerD0->SetFloat16MantissaBits(fFloat16NBits);
+    fTreeHandlerD0->SetFloatBranchCompression(fFloatCompression,fFloatBasketSize);
+    fTreeHandlerD0->SetPIDNsigmaTable(fPIDNsigmaTable);
     fVariablesTreeD0 = (TTree*)fTreeHandlerD0->BuildTree(nameoutput,nameoutput);
     fVariablesTreeD0->SetMaxVirtualSize(1.e+8/nEnabledTrees);
     fTreeEvChar->AddFriend(fVariablesTreeD0);
@@ -731,6 +745,10 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
     fTreeHandlerDs->SetTrackingEfficiency(fTrackingEfficiency);
     fTreeHandlerDs->SetJetProperties(fJetRadius,fJetAlgorithm,fMinJetPt);
     fTreeHandlerDs->SetSubJetProperties(fSubJetRadius,fSubJetAlgorithm,fSoftDropZCut,fSoftDropBeta);
+    fTreeHandlerDs->SetCandidateBufferSize(fCandBufferSize);
+    fTreeHandlerDs->SetFloat16MantissaBits(fFloat16NBits);
+    fTreeHandlerDs->SetFloatBranchCompression(fFloatCompression,fFloatBasketSize);
+    fTreeHandlerDs->SetPIDNsigmaTable(fPIDNsigmaTable);
     fVariablesTreeDs = (TTree*)fTreeHandlerDs->BuildTree(nameoutput,nameoutput);
     fVariablesTreeDs->SetMaxVirtualSize(1.e+8/nEnabledTrees);
     fTreeEvChar->AddFriend(fVariablesTreeDs);
@@ -760,6 +778,10 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
     fTreeHandlerDplus->SetTrackingEfficiency(fTrackingEfficiency);
     fTreeHandlerDplus->SetJetProperties(fJetRadius,fJetAlgorithm,fMinJetPt);
     fTreeHandlerDplus->SetSubJetProperties(fSubJetRadius,fSubJetAlgorithm,fSoftDropZCut,fSoftDropBeta);
+    fTreeHandlerDplus->SetCandidateBufferSize(fCandBufferSize);
+    fTreeHandlerDplus->SetFloat16MantissaBits(fFloat16NBits);
+    fTreeHandlerDplus->SetFloatBranchCompression(fFloatCompression,fFloatBasketSize);
+    fTreeHandlerDplus->SetPIDNsigmaTable(fPIDNsigmaTable);
     fVariablesTreeDplus = (TTree*)fTreeHandlerDplus->BuildTree(nameoutput,nameoutput);
     fVariablesTreeDplus->SetMaxVirtualSize(1.e+8/nEnabledTrees);
     fTreeEvChar->AddFriend(fVariablesTreeDplus);
@@ -788,6 +810,10 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
     fTreeHandlerLctopKpi->SetTrackingEfficiency(fTrackingEfficiency);
     fTreeHandlerLctopKpi->SetJetProperties(fJetRadius,fJetAlgorithm,fMinJetPt);
     fTreeHandlerLctopKpi->SetSubJetProperties(fSubJetRadius,fSubJetAlgorithm,fSoftDropZCut,fSoftDropBeta);
+    fTreeHandlerLctopKpi->SetCandidateBufferSize(fCandBufferSize);
+    fTreeHandlerLctopKpi->SetFloat16MantissaBits(fFloat16NBits);
+    fTreeHandlerLctopKpi->SetFloatBranchCompression(fFloatCompression,fFloatBasketSize);
+    fTreeHandlerLctopKpi->SetPIDNsigmaTable(fPIDNsigmaTable);
     fVariablesTreeLctopKpi = (TTree*)fTreeHandlerLctopKpi->BuildTree(nameoutput,nameoutput);
     fVariablesTreeLctopKpi->SetMaxVirtualSize(1.e+8/nEnabledTrees);
     fTreeEvChar->AddFriend(fVariablesTreeLctopKpi);
@@ -817,6 +843,10 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
     fTreeHandlerBplus->SetTrackingEfficiency(fTrackingEfficiency);
     fTreeHandlerBplus->SetJetProperties(fJetRadius,fJetAlgorithm,fMinJetPt);
     fTreeHandlerBplus->SetSubJetProperties(fSubJetRadius,fSubJetAlgorithm,fSoftDropZCut,fSoftDropBeta);
+    fTreeHandlerBplus->SetCandidateBufferSize(fCandBufferSize);
+    fTreeHandlerBplus->SetFloat16MantissaBits(fFloat16NBits);
+    fTreeHandlerBplus->SetFloatBranchCompression(fFloatCompression,fFloatBasketSize);
+    fTreeHandlerBplus->SetPIDNsigmaTable(fPIDNsigmaTable);
     fVariablesTreeBplus = (TTree*)fTreeHandlerBplus->BuildTree(nameoutput,nameoutput);
     fVariablesTreeBplus->SetMaxVirtualSize(1.e+8/nEnabledTrees);
     fTreeEvChar->AddFriend(fVariablesTreeBplus);
@@ -845,6 +875,10 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
     fTreeHandlerDstar->SetTrackingEfficiency(fTrackingEfficiency);
     fTreeHandlerDstar->SetJetProperties(fJetRadius,fJetAlgorithm,fMinJetPt);
     fTreeHandlerDstar->SetSubJetProperties(fSubJetRadius,fSubJetAlgorithm,fSoftDropZCut,fSoftDropBeta);
+    fTreeHandlerDstar->SetCandidateBufferSize(fCandBufferSize);
+    fTreeHandlerDstar->SetFloat16MantissaBits(fFloat16NBits);
+    fTreeHandlerDstar->SetFloatBranchCompression(fFloatCompression,fFloatBasketSize);
+    fTreeHandlerDstar->SetPIDNsigmaTable(fPIDNsigmaTable);
     fVariablesTreeDstar = (TTree*)fTreeHandlerDstar->BuildTree(nameoutput,nameoutput);
     fVariablesTreeDstar->SetMaxVirtualSize(1.e+8/nEnabledTrees);
     fTreeEvChar->AddFriend(fVariablesTreeDstar);
@@ -874,6 +908,10 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
     fTreeHandlerLc2V0bachelor->SetTrackingEfficiency(fTrackingEfficiency);
     fTreeHandlerLc2V0bachelor->SetJetProperties(fJetRadius,fJetAlgorithm,fMinJetPt);
     fTreeHandlerLc2V0bachelor->SetSubJetProperties(fSubJetRadius,fSubJetAlgorithm,fSoftDropZCut,fSoftDropBeta);
+    fTreeHandlerLc2V0bachelor->SetCandidateBufferSize(fCandBufferSize);
+    fTreeHandlerLc2V0bachelor->SetFloat16MantissaBits(fFloat16NBits);
+    fTreeHandlerLc2V0bachelor->SetFloatBranchCompression(fFloatCompression,fFloatBasketSize);
+    fTreeHandlerLc2V0bachelor->SetPIDNsigmaTable(fPIDNsigmaTable);
     fVariablesTreeLc2V0bachelor = (TTree*)fTreeHandlerLc2V0bachelor->BuildTree(nameoutput,nameoutput);
     fVariablesTreeLc2V0bachelor->SetMaxVirtualSize(1.e+8/nEnabledTrees);
     fTreeEvChar->AddFriend(fVariablesTreeLc2V0bachelor);
@@ -903,6 +941,10 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
     fTreeHandlerBs->SetTrackingEfficiency(fTrackingEfficiency);
     fTreeHandlerBs->SetJetProperties(fJetRadius,fJetAlgorithm,fMinJetPt);
     fTreeHandlerBs->SetSubJetProperties(fSubJetRadius,fSubJetAlgorithm,fSoftDropZCut,fSoftDropBeta);
+    fTreeHandlerBs->SetCandidateBufferSize(fCandBufferSize);
+    fTreeHandlerBs->SetFloat16MantissaBits(fFloat16NBits);
+    fTreeHandlerBs->SetFloatBranchCompression(fFloatCompression,fFloatBasketSize);
+    fTreeHandlerBs->SetPIDNsigmaTable(fPIDNsigmaTable);
     fVariablesTreeBs = (TTree*)fTreeHandlerBs->BuildTree(nameoutput,nameoutput);
     fVariablesTreeBs->SetMaxVirtualSize(1.e+8/nEnabledTrees);
     fTreeEvChar->AddFriend(fVariablesTreeBs);
@@ -932,6 +974,10 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
     fTreeHandlerLb->SetTrackingEfficiency(fTrackingEfficiency);
     fTreeHandlerLb->SetJetProperties(fJetRadius,fJetAlgorithm,fMinJetPt);
     fTreeHandlerLb->SetSubJetProperties(fSubJetRadius,fSubJetAlgorithm,fSoftDropZCut,fSoftDropBeta);
+    fTreeHandlerLb->SetCandidateBufferSize(fCandBufferSize);
+    fTreeHandlerLb->SetFloat16MantissaBits(fFloat16NBits);
+    fTreeHandlerLb->SetFloatBranchCompression(fFloatCompression,fFloatBasketSize);
+    fTreeHandlerLb->SetPIDNsigmaTable(fPIDNsigmaTable);
     fVariablesTreeLb = (TTree*)fTreeHandlerLb->BuildTree(nameoutput,nameoutput);
     fVariablesTreeLb->SetMaxVirtualSize(1.e+8/nEnabledTrees);
     fTreeEvChar->AddFriend(fVariablesTreeLb);
@@ -1309,78 +1355,33 @@ void AliAnalysisTaskSEHFTreeCreator::UserExec(Option_t */*option*/)
     fzVtxGen = mcHeader->GetVtxZ();
   }
 
-  Bool_t isSameEvSelD0=kTRUE;
-  Bool_t isSameEvSelDs=kTRUE;
-  Bool_t isSameEvSelDplus=kTRUE;
-  Bool_t isSameEvSelLctopKpi=kTRUE;
-  Bool_t isSameEvSelBplus=kTRUE;
-  Bool_t isSameEvSelBs=kTRUE;
-  Bool_t isSameEvSelDstar=kTRUE;
-  Bool_t isSameEvSelLc2V0bachelor=kTRUE;
-  Bool_t isSameEvSelLb=kTRUE;
-  if(fWriteVariableTreeD0)
-    isSameEvSelD0=!((fFiltCutsD0toKpi->IsEventSelected(aod) && !fCutsD0toKpi->IsEventSelected(aod))||(!fFiltCutsD0toKpi->IsEventSelected(aod) && fCutsD0toKpi->IsEventSelected(aod)));
-  if(fWriteVariableTreeDs)
-    isSameEvSelDs=!((fFiltCutsDstoKKpi->IsEventSelected(aod) && !fCutsDstoKKpi->IsEventSelected(aod))||(!fFiltCutsDstoKKpi->IsEventSelected(aod) && fCutsDstoKKpi->IsEventSelected(aod)));
-  if(fWriteVariableTreeDplus)
-    isSameEvSelDplus=!((fFiltCutsDplustoKpipi->IsEventSelected(aod) && !fCutsDplustoKpipi->IsEventSelected(aod))||(!fFiltCutsDplustoKpipi->IsEventSelected(aod) && fCutsDplustoKpipi->IsEventSelected(aod)));
-  if(fWriteVariableTreeLctopKpi)
-    isSameEvSelLctopKpi=!((fFiltCutsLctopKpi->IsEventSelected(aod) && !fCutsLctopKpi->IsEventSelected(aod))||(!fFiltCutsLctopKpi->IsEventSelected(aod) && fCutsLctopKpi->IsEventSelected(aod)));
-  if(fWriteVariableTreeBplus)
-    isSameEvSelBplus = !((fFiltCutsBplustoD0pi->IsEventSelected(aod) && !fCutsBplustoD0pi->IsEventSelected(aod)) || (!fFiltCutsBplustoD0pi->IsEventSelected(aod) && fCutsBplustoD0pi->IsEventSelected(aod)));
-  if(fWriteVariableTreeBs)
-    isSameEvSelBs = !((fFiltCutsBstoDspi->IsEventSelected(aod) && !fCutsBstoDspi->IsEventSelected(aod)) || (!fFiltCutsBstoDspi->IsEventSelected(aod) && fCutsBstoDspi->IsEventSelected(aod)));
-  if(fWriteVariableTreeDstar)
-    isSameEvSelDstar=!((fFiltCutsDstartoKpipi->IsEventSelected(aod) && !fCutsDstartoKpipi->IsEventSelected(aod))||(!fFiltCutsDstartoKpipi->IsEventSelected(aod) && fCutsDstartoKpipi->IsEventSelected(aod)));
-  if(fWriteVariableTreeLc2V0bachelor)
-    isSameEvSelLc2V0bachelor=!((fFiltCutsLc2V0bachelor->IsEventSelected(aod) && !fCutsLc2V0bachelor->IsEventSelected(aod))||(!fFiltCutsLc2V0bachelor->IsEventSelected(aod) && fCutsLc2V0bachelor->IsEventSelected(aod)));
-  if(fWriteVariableTreeLb)
-    isSameEvSelLb = !((fFiltCutsLbtoLcpi->IsEventSelected(aod) && !fCutsLbtoLcpi->IsEventSelected(aod)) || (!fFiltCutsLbtoLcpi->IsEventSelected(aod) && fCutsLbtoLcpi->IsEventSelected(aod)));
-
-  Bool_t isSameEvSel = isSameEvSelD0 && isSameEvSelDs && isSameEvSelDplus && isSameEvSelLctopKpi && isSameEvSelBplus && isSameEvSelBs && isSameEvSelDstar && isSameEvSelLc2V0bachelor && isSameEvSelLb;
+  // event selection of the filtering and analysis cuts of each enabled species, evaluated once per event
+  const Int_t kNSpeciesEvSel = 9;
+  AliRDHFCuts *filtCuts[kNSpeciesEvSel] = {fFiltCutsD0toKpi, fFiltCutsDstoKKpi, fFiltCutsDplustoKpipi, fFiltCutsLctopKpi, fFiltCutsBplustoD0pi,
+                                           fFiltCutsBstoDspi, fFiltCutsDstartoKpipi, fFiltCutsLc2V0bachelor, fFiltCutsLbtoLcpi};
+  AliRDHFCuts *anCuts[kNSpeciesEvSel] = {fCutsD0toKpi, fCutsDstoKKpi, fCutsDplustoKpipi, fCutsLctopKpi, fCutsBplustoD0pi,
+                                         fCutsBstoDspi, fCutsDstartoKpipi, fCutsLc2V0bachelor, fCutsLbtoLcpi};
+  Bool_t isEnabled[kNSpeciesEvSel] = {fWriteVariableTreeD0!=0, fWriteVariableTreeDs!=0, fWriteVariableTreeDplus!=0, fWriteVariableTreeLctopKpi!=0, fWriteVariableTreeBplus!=0,
+                                      fWriteVariableTreeBs!=0, fWriteVariableTreeDstar!=0, fWriteVariableTreeLc2V0bachelor!=0, fWriteVariableTreeLb!=0};
+  Bool_t isFiltEvSel[kNSpeciesEvSel];
+  Bool_t isSameEvSel = kTRUE;
+  for(Int_t iSpecies=0; iSpecies<kNSpeciesEvSel; iSpecies++) {
+    if(!isEnabled[iSpecies]) continue;
+    isFiltEvSel[iSpecies] = filtCuts[iSpecies]->IsEventSelected(aod);
+    if(isFiltEvSel[iSpecies] != anCuts[iSpecies]->IsEventSelected(aod)) isSameEvSel = kFALSE;
+  }
   if(!isSameEvSel) {
     Printf("AliAnalysisTaskSEHFTreeCreator::UserExec: differences in the event selection cuts same meson");
     return;
   }
-  if((fWriteVariableTreeD0 && fWriteVariableTreeDs && (fFiltCutsD0toKpi->IsEventSelected(aod)!=fFiltCutsDstoKKpi->IsEventSelected(aod))) ||
-     (fWriteVariableTreeD0 && fWriteVariableTreeDplus && (fFiltCutsD0toKpi->IsEventSelected(aod)!=fFiltCutsDplustoKpipi->IsEventSelected(aod))) ||
-     (fWriteVariableTreeDs && fWriteVariableTreeDplus && (fFiltCutsDstoKKpi->IsEventSelected(aod)!=fFiltCutsDplustoKpipi->IsEventSelected(aod))) ||
-     (fWriteVariableTreeD0 && fWriteVariableTreeLctopKpi && (fFiltCutsD0toKpi->IsEventSelected(aod)!=fFiltCutsLctopKpi->IsEventSelected(aod))) ||
-     (fWriteVariableTreeDs && fWriteVariableTreeLctopKpi && (fFiltCutsDstoKKpi->IsEventSelected(aod)!=fFiltCutsLctopKpi->IsEventSelected(aod))) ||
-     (fWriteVariableTreeDplus && fWriteVariableTreeLctopKpi && (fFiltCutsDplustoKpipi->IsEventSelected(aod)!=fFiltCutsLctopKpi->IsEventSelected(aod))) ||
-     (fWriteVariableTreeD0 && fWriteVariableTreeBplus && (fFiltCutsD0toKpi->IsEventSelected(aod)!=fFiltCutsBplustoD0pi->IsEventSelected(aod))) ||
-     (fWriteVariableTreeDs && fWriteVariableTreeBplus && (fFiltCutsDstoKKpi->IsEventSelected(aod)!=fFiltCutsBplustoD0pi->IsEventSelected(aod))) ||
-     (fWriteVariableTreeDplus && fWriteVariableTreeBplus && (fFiltCutsDplustoKpipi->IsEventSelected(aod)!=fFiltCutsBplustoD0pi->IsEventSelected(aod))) ||
-     (fWriteVariableTreeLctopKpi && fWriteVariableTreeBplus && (fFiltCutsLctopKpi->IsEventSelected(aod)!=fFiltCutsBplustoD0pi->IsEventSelected(aod))) ||
-     (fWriteVariableTreeD0 && fWriteVariableTreeDstar && (fFiltCutsD0toKpi->IsEventSelected(aod)!=fFiltCutsDstartoKpipi->IsEventSelected(aod))) ||
-     (fWriteVariableTreeDplus && fWriteVariableTreeDstar && (fFiltCutsDplustoKpipi->IsEventSelected(aod)!=fFiltCutsDstartoKpipi->IsEventSelected(aod))) ||
-     (fWriteVariableTreeDs && fWriteVariableTreeDstar && (fFiltCutsDstoKKpi->IsEventSelected(aod)!=fFiltCutsDstartoKpipi->IsEventSelected(aod))) ||
-     (fWriteVariableTreeLctopKpi && fWriteVariableTreeDstar && (fFiltCutsLctopKpi->IsEventSelected(aod)!=fFiltCutsDstartoKpipi->IsEventSelected(aod))) ||
-     (fWriteVariableTreeBplus && fWriteVariableTreeDstar && (fFiltCutsBplustoD0pi->IsEventSelected(aod)!=fFiltCutsDstartoKpipi->IsEventSelected(aod))) ||
-     (fWriteVariableTreeD0 && fWriteVariableTreeLc2V0bachelor && (fFiltCutsD0toKpi->IsEventSelected(aod)!=fFiltCutsLc2V0bachelor->IsEventSelected(aod))) ||
-     (fWriteVariableTreeDplus && fWriteVariableTreeLc2V0bachelor && (fFiltCutsDplustoKpipi->IsEventSelected(aod)!=fFiltCutsLc2V0bachelor->IsEventSelected(aod))) ||
-     (fWriteVariableTreeDs && fWriteVariableTreeLc2V0bachelor && (fFiltCutsDstoKKpi->IsEventSelected(aod)!=fFiltCutsLc2V0bachelor->IsEventSelected(aod))) ||
-     (fWriteVariableTreeLctopKpi && fWriteVariableTreeLc2V0bachelor && (fFiltCutsLctopKpi->IsEventSelected(aod)!=fFiltCutsLc2V0bachelor->IsEventSelected(aod))) ||
-     (fWriteVariableTreeBplus && fWriteVariableTreeLc2V0bachelor && (fFiltCutsBplustoD0pi->IsEventSelected(aod)!=fFiltCutsLc2V0bachelor->IsEventSelected(aod))) ||
-     (fWriteVariableTreeDstar && fWriteVariableTreeLc2V0bachelor && (fFiltCutsDstartoKpipi->IsEventSelected(aod)!=fFiltCutsLc2V0bachelor->IsEventSelected(aod))) ||
-     (fWriteVariableTreeD0 && fWriteVariableTreeBs && (fFiltCutsD0toKpi->IsEventSelected(aod)!=fFiltCutsBstoDspi->IsEventSelected(aod))) ||
-     (fWriteVariableTreeDplus && fWriteVariableTreeBs && (fFiltCutsDplustoKpipi->IsEventSelected(aod)!=fFiltCutsBstoDspi->IsEventSelected(aod))) ||
-     (fWriteVariableTreeDs && fWriteVariableTreeBs && (fFiltCutsDstoKKpi->IsEventSelected(aod)!=fFiltCutsBstoDspi->IsEventSelected(aod))) ||
-     (fWriteVariableTreeLctopKpi && fWriteVariableTreeBs && (fFiltCutsLctopKpi->IsEventSelected(aod)!=fFiltCutsBstoDspi->IsEventSelected(aod))) ||
-     (fWriteVariableTreeBplus && fWriteVariableTreeBs && (fFiltCutsBplustoD0pi->IsEventSelected(aod)!=fFiltCutsBstoDspi->IsEventSelected(aod))) ||
-     (fWriteVariableTreeDstar && fWriteVariableTreeBs && (fFiltCutsDstartoKpipi->IsEventSelected(aod)!=fFiltCutsBstoDspi->IsEventSelected(aod))) ||
-     (fWriteVariableTreeLc2V0bachelor && fWriteVariableTreeBs && (fFiltCutsLc2V0bachelor->IsEventSelected(aod)!=fFiltCutsBstoDspi->IsEventSelected(aod))) ||
-     (fWriteVariableTreeD0 && fWriteVariableTreeLb && (fFiltCutsD0toKpi->IsEventSelected(aod)!=fFiltCutsLbtoLcpi->IsEventSelected(aod))) ||
-     (fWriteVariableTreeDplus && fWriteVariableTreeLb && (fFiltCutsDplustoKpipi->IsEventSelected(aod)!=fFiltCutsLbtoLcpi->IsEventSelected(aod))) ||
-     (fWriteVariableTreeDs && fWriteVariableTreeLb && (fFiltCutsDstoKKpi->IsEventSelected(aod)!=fFiltCutsLbtoLcpi->IsEventSelected(aod))) ||
-     (fWriteVariableTreeLctopKpi && fWriteVariableTreeLb && (fFiltCutsLctopKpi->IsEventSelected(aod)!=fFiltCutsLbtoLcpi->IsEventSelected(aod))) ||
-     (fWriteVariableTreeBplus && fWriteVariableTreeLb && (fFiltCutsBplustoD0pi->IsEventSelected(aod)!=fFiltCutsLbtoLcpi->IsEventSelected(aod))) ||
-     (fWriteVariableTreeDstar && fWriteVariableTreeLb && (fFiltCutsDstartoKpipi->IsEventSelected(aod)!=fFiltCutsLbtoLcpi->IsEventSelected(aod))) ||
-     (fWriteVariableTreeLc2V0bachelor && fWriteVariableTreeLb && (fFiltCutsLc2V0bachelor->IsEventSelected(aod)!=fFiltCutsLbtoLcpi->IsEventSelected(aod))) ||
-     (fWriteVariableTreeBs && fWriteVariableTreeLb && (fFiltCutsBstoDspi->IsEventSelected(aod)!=fFiltCutsLbtoLcpi->IsEventSelected(aod)))
-     ){
-    Printf("AliAnalysisTaskSEHFTreeCreator::UserExec: differences in the event selection cuts different meson");
-    return;
+  Int_t firstEnabled = -1;
+  for(Int_t iSpecies=0; iSpecies<kNSpeciesEvSel; iSpecies++) {
+    if(!isEnabled[iSpecies]) continue;
+    if(firstEnabled < 0) firstEnabled = iSpecies;
+    else if(isFiltEvSel[iSpecies] != isFiltEvSel[firstEnabled]) {
+      Printf("AliAnalysisTaskSEHFTreeCreator::UserExec: differences in the event selection cuts different meson");
+      return;
+    }
   }
 
   // AOD primary vertex
@@ -1592,6 +1593,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserExec(Option_t */*option*/)
   fTreeEvChar->Fill();
   //get PID response
   if(!fPIDresp) fPIDresp = ((AliInputEventHandler*)(AliAnalysisManager::GetAnalysisManager()->GetInputEventHandler()))->GetPIDResponse();
+  if(fPIDNsigmaTable) fPIDNsigmaTable->Reset();
 
   if(fWriteVariableTreeD0) Process2Prong(array2prong,aod,mcArray,aod->GetMagneticField(),mcHeader);
   if(fWriteVariableTreeDs || fWriteVariableTreeDplus || fWriteVariableTreeLctopKpi) Process3Prong(array3Prong,aod,mcArray,aod->GetMagneticField(),mcHeader);
@@ -1806,6 +1808,18 @@ Bool_t AliAnalysisTaskSEHFTreeCreator::RetrieveEventObjects()
   return kTRUE;
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskSEHFTreeCreator::FinishTaskOutput()
+{
+  /// Fill the trees with the candidates still in the buffers of the tree handlers
+
+  AliHFTreeHandler* handlers[] = {fTreeHandlerD0,fTreeHandlerDs,fTreeHandlerDplus,fTreeHandlerLctopKpi,fTreeHandlerBplus,
+                                  fTreeHandlerBs,fTreeHandlerDstar,fTreeHandlerLc2V0bachelor,fTreeHandlerLb};
+  for(AliHFTreeHandler* handler : handlers) {
+    if(handler) handler->FlushTree();
+  }
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskSEHFTreeCreator::Terminate(Option_t */*option*/)
 {
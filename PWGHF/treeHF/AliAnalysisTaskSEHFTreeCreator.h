@@ -42,6 +42,7 @@
 #include "AliNormalizationCounter.h"
 #include "AliPIDResponse.h"
 #include "AliHFTreeHandler.h"
+#include "AliHFPIDNsigmaTable.h"
 #include "AliHFTreeHandlerD0toKpi.h"
 #include "AliHFTreeHandlerDplustoKpipi.h"
 #include "AliHFTreeHandlerDstoKKpi.h"
@@ -89,6 +90,7 @@ public:
     virtual void UserExec(Option_t *option);
     virtual void ExecOnce();
     virtual Bool_t RetrieveEventObjects();
+    virtual void FinishTaskOutput();
     virtual void Terminate(Option_t *option);
     
     void SetRefMult(Double_t refMult) { fRefMult = refMult; }
@@ -159,6 +161,11 @@ public:
     void SetSoftDropBeta(Double_t d) {fSoftDropBeta = d; }
     void SetTrackingEfficiency(Double_t d) {fTrackingEfficiency = d;}
     void SetDoPtHard(bool b) {fDoPtHard = b;}
+
+    void SetCandidateBufferSize(int n) {fCandBufferSize = n;}
+    void SetFloat16MantissaBits(int nbits) {fFloat16NBits = nbits;}
+    void SetFloatBranchCompression(int settings, int basketsize=0) {fFloatCompression = settings; fFloatBasketSize = basketsize;}
+    void SetSharePIDNsigmaTable(bool share=true) {fSharePIDNsigma = share;}
   
     void SetGoodTrackFilterBit(Int_t i) { fGoodTrackFilterBit = i; }
     void SetGoodTrackEtaRange(Double_t d) { fGoodTrackEtaRange = d; }
@@ -526,10 +533,17 @@ private:
     float fFracToKeepEventDownsampling;                            /// fraction of events to be kept by event downsampling
     unsigned long fSeedEventDownsampling;                          /// seed for event downsampling
 
+    int fCandBufferSize;                                           /// number of candidates buffered in the tree handlers before filling (0 = off)
+    int fFloat16NBits;                                             /// mantissa bits for Float16_t PID and DCA branches (0 = float)
+    int fFloatCompression;                                         /// compression settings of the float branches (-1 = default)
+    int fFloatBasketSize;                                          /// basket size of the float branches (0 = default)
+    bool fSharePIDNsigma;                                          /// share the per-event nsigma of the tracks between the tree handlers
+    AliHFPIDNsigmaTable *fPIDNsigmaTable;                          //!<! per-event nsigma table of the tracks
+
     AliCDBEntry *fCdbEntry;
 
     /// \cond CLASSIMP
-    ClassDef(AliAnalysisTaskSEHFTreeCreator,30);
+    ClassDef(AliAnalysisTaskSEHFTreeCreator,32);
     /// \endcond
 };
 
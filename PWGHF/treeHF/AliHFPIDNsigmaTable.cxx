@@ -0,0 +1,63 @@
+/* Copyright(c) 1998-2008, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/* $Id$ */
+
+//*************************************************************************
+// \class AliHFPIDNsigmaTable
+// \brief per-event table of the TPC and TOF nsigma of the tracks, shared by
+// the tree handlers of all the species
+/////////////////////////////////////////////////////////////
+
+#include "AliHFPIDNsigmaTable.h"
+
+/// \cond CLASSIMP
+ClassImp(AliHFPIDNsigmaTable);
+/// \endcond
+
+//________________________________________________________________
+AliHFPIDNsigmaTable::AliHFPIDNsigmaTable():
+  TObject(),
+  fTable()
+{
+  //
+  // Default constructor
+  //
+}
+
+//________________________________________________________________
+bool AliHFPIDNsigmaTable::GetNsigma(const AliAODTrack* track, const AliAODPidHF* pidhf, int det, int hypo, double &nsigma) const
+{
+  if(det<0 || det>=kNDet || hypo<0 || hypo>=kNHypo) return false;
+  auto it = fTable.find(track);
+  if(it==fTable.end()) return false;
+  for(const Entry_t &entry : it->second) {
+    if(entry.fPidHF!=pidhf) continue;
+    if(!(entry.fFilled & (1u<<(det*kNHypo+hypo)))) return false;
+    nsigma = entry.fNsigma[det][hypo];
+    return true;
+  }
+  return false;
+}
+
+//________________________________________________________________
+void AliHFPIDNsigmaTable::SetNsigma(const AliAODTrack* track, const AliAODPidHF* pidhf, int det, int hypo, double nsigma)
+{
+  if(det<0 || det>=kNDet || hypo<0 || hypo>=kNHypo) return;
+  std::vector<Entry_t> &entries = fTable[track];
+  Entry_t *entry = nullptr;
+  for(Entry_t &e : entries) {
+    if(e.fPidHF==pidhf) {
+      entry = &e;
+      break;
+    }
+  }
+  if(!entry) {
+    entries.push_back(Entry_t());
+    entry = &entries.back();
+    entry->fPidHF = pidhf;
+    entry->fFilled = 0;
+  }
+  entry->fNsigma[det][hypo] = nsigma;
+  entry->fFilled |= (1u<<(det*kNHypo+hypo));
+}
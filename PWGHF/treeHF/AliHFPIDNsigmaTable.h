@@ -0,0 +1,56 @@
+#ifndef ALIHFPIDNSIGMATABLE_H
+#define ALIHFPIDNSIGMATABLE_H
+
+/* Copyright(c) 1998-2008, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/* $Id$ */
+
+//*************************************************************************
+// \class AliHFPIDNsigmaTable
+// \brief per-event table of the TPC and TOF nsigma of the tracks, shared by
+// the tree handlers of all the species so that the nsigma of a track used in
+// several candidates is computed only once per PID object
+/////////////////////////////////////////////////////////////
+
+#include <vector>
+#include <unordered_map>
+#include <TObject.h>
+
+class AliAODTrack;
+class AliAODPidHF;
+
+class AliHFPIDNsigmaTable : public TObject
+{
+  public:
+
+    enum {
+      kNDet  = 2, // TPC, TOF (same order as AliHFTreeHandler::piddet)
+      kNHypo = 3  // pion, kaon, proton
+    };
+
+    AliHFPIDNsigmaTable();
+    virtual ~AliHFPIDNsigmaTable() {}
+
+    //to be called at the beginning of each event
+    void Reset() {fTable.clear();}
+
+    //pidhf is the PID object the nsigma was computed with (nullptr for AliPIDResponse)
+    bool GetNsigma(const AliAODTrack* track, const AliAODPidHF* pidhf, int det, int hypo, double &nsigma) const;
+    void SetNsigma(const AliAODTrack* track, const AliAODPidHF* pidhf, int det, int hypo, double nsigma);
+
+  private:
+
+    struct Entry_t {
+      const AliAODPidHF* fPidHF;      // PID object
+      double fNsigma[kNDet][kNHypo];  // nsigma values
+      unsigned int fFilled;           // bit det*kNHypo+hypo set if the value is filled
+    };
+
+    std::unordered_map<const AliAODTrack*, std::vector<Entry_t> > fTable; //!<! entries for each track of the current event
+
+  /// \cond CLASSIMP
+  ClassDef(AliHFPIDNsigmaTable,1); ///
+  /// \endcond
+};
+#endif
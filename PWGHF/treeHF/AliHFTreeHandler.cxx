@@ -21,9 +21,12 @@
 
 #include <cmath>
 #include <limits>
+#include <cstring>
 
 #include "TMath.h"
 #include "TFile.h"
+#include "TBranch.h"
+#include "TLeaf.h"
 
 #include "AliHFTreeHandler.h"
 #include "AliPID.h"
@@ -148,7 +151,17 @@ AliHFTreeHandler::AliHFTreeHandler():
   fMinJetPt(0.0),
   fSoftDropZCut(0.1),
   fSoftDropBeta(0.0),
-  fTrackingEfficiency(1.0)
+  fTrackingEfficiency(1.0),
+  fCandBufferSize(0),
+  fFloat16NBits(0),
+  fFloatCompression(-1),
+  fFloatBasketSize(0),
+  fConfiguredTree(nullptr),
+  fNBufferedCand(0),
+  fColumnAddress(),
+  fColumnSize(),
+  fColumns(),
+  fPIDNsigmaTable(nullptr)
 {
   //
   // Default constructor
@@ -300,7 +313,17 @@ AliHFTreeHandler::AliHFTreeHandler(int PIDopt):
   fMinJetPt(0.0),
   fSoftDropZCut(0.1),
   fSoftDropBeta(0.0),
-  fTrackingEfficiency(1.0)
+  fTrackingEfficiency(1.0),
+  fCandBufferSize(0),
+  fFloat16NBits(0),
+  fFloatCompression(-1),
+  fFloatBasketSize(0),
+  fConfiguredTree(nullptr),
+  fNBufferedCand(0),
+  fColumnAddress(),
+  fColumnSize(),
+  fColumns(),
+  fPIDNsigmaTable(nullptr)
 {
   //
   // Standard constructor
@@ -434,8 +457,8 @@ void AliHFTreeHandler::AddCommonDmesonVarBranches(Bool_t HasSecVtx) {
     fTreeVar->Branch("norm_dl_xy",&fNormDecayLengthXY);
     fTreeVar->Branch("cos_p",&fCosP);
     fTreeVar->Branch("cos_p_xy",&fCosPXY);
-    fTreeVar->Branch("imp_par_xy",&fImpParXY);
-    fTreeVar->Branch("dca",&fDCA);
+    AddTruncatedFloatBranch("imp_par_xy",&fImpParXY);
+    AddTruncatedFloatBranch("dca",&fDCA);
   }
 } 
 
@@ -605,7 +628,7 @@ void AliHFTreeHandler::AddPidBranches(bool usePionHypo, bool useKaonHypo, bool u
         for(unsigned int iPartHypo=0; iPartHypo<knMaxHypo4Pid; iPartHypo++) {
           if(!useHypo[iPartHypo]) continue;
           if(fPidOpt==kNsigmaPID || fPidOpt==kNsigmaPIDfloatandint || fPidOpt>=kRawAndNsigmaPID) 
-            fTreeVar->Branch(Form("nsig%s_%s_%d",detName[iDet].Data(),partHypoName[iPartHypo].Data(),iProng),&fPIDNsigmaVector[iProng][iDet][iPartHypo]);
+            AddTruncatedFloatBranch(Form("nsig%s_%s_%d",detName[iDet].Data(),partHypoName[iPartHypo].Data(),iProng),&fPIDNsigmaVector[iProng][iDet][iPartHypo]);
           if(fPidOpt==kNsigmaPIDint || fPidOpt==kNsigmaPIDfloatandint) 
             fTreeVar->Branch(Form("int_nsig%s_%s_%d",detName[iDet].Data(),partHypoName[iPartHypo].Data(),iProng),&fPIDNsigmaIntVector[iProng][iDet][iPartHypo]);
         }
@@ -615,7 +638,7 @@ void AliHFTreeHandler::AddPidBranches(bool usePionHypo, bool useKaonHypo, bool u
       for(unsigned int iPartHypo=0; iPartHypo<knMaxHypo4Pid; iPartHypo++) {
         if(!useHypo[iPartHypo]) continue;
         if(fPidOpt==kNsigmaCombPID || fPidOpt==kNsigmaCombPIDfloatandint || fPidOpt==kNsigmaDetAndCombPID)
-          fTreeVar->Branch(Form("nsigComb_%s_%d",partHypoName[iPartHypo].Data(),iProng),&fPIDNsigmaVector[iProng][kCombTPCTOF][iPartHypo]);
+          AddTruncatedFloatBranch(Form("nsigComb_%s_%d",partHypoName[iPartHypo].Data(),iProng),&fPIDNsigmaVector[iProng][kCombTPCTOF][iPartHypo]);
         if(fPidOpt==kNsigmaCombPIDint || fPidOpt==kNsigmaCombPIDfloatandint) 
           fTreeVar->Branch(Form("int_nsigComb_%s_%d",partHypoName[iPartHypo].Data(),iProng),&fPIDNsigmaIntVector[iProng][kCombTPCTOF][iPartHypo]);
       }
@@ -623,7 +646,7 @@ void AliHFTreeHandler::AddPidBranches(bool usePionHypo, bool useKaonHypo, bool u
     if(fPidOpt==kRawPID || fPidOpt==kRawAndNsigmaPID) {
       for(unsigned int iDet=0; iDet<knMaxDet4Pid; iDet++) {
         if(!useDet[iDet]) continue;
-        fTreeVar->Branch(Form("%s_%d",rawPidName[iDet].Data(),iProng),&fPIDrawVector[iProng][iDet]);
+        AddTruncatedFloatBranch(Form("%s_%d",rawPidName[iDet].Data(),iProng),&fPIDrawVector[iProng][iDet]);
       }
       if(useTPC) fTreeVar->Branch(Form("pTPC_prong%d",iProng),&fTPCPProng[iProng]);
       if(useTOF) {
@@ -634,7 +657,7 @@ void AliHFTreeHandler::AddPidBranches(bool usePionHypo, bool useKaonHypo, bool u
     }
     if(fPidOpt==kBayesianPID || fPidOpt==kBayesianAndNsigmaPID) {
       for(unsigned int iPartHypo=0; iPartHypo<knMaxHypo4Pid; iPartHypo++) {
-        fTreeVar->Branch(Form("probBayes_%s_%d",partHypoName[iPartHypo].Data(),iProng),&fPIDprobBayesVector[iProng][iPartHypo]);
+        AddTruncatedFloatBranch(Form("probBayes_%s_%d",partHypoName[iPartHypo].Data(),iProng),&fPIDprobBayesVector[iProng][iPartHypo]);
       }
     }
   }
@@ -653,6 +676,88 @@ void AliHFTreeHandler::SetUpCombinedPid() {
 
 }
 
+//________________________________________________________________
+void AliHFTreeHandler::AddTruncatedFloatBranch(TString name, float* address)
+{
+  //PID and DCA variables: stored as Float16_t with truncated mantissa if enabled
+  //(relative precision 2^-nbits, no range limits), as float otherwise
+
+  if(fFloat16NBits>0 && fFloat16NBits<=14)
+    fTreeVar->Branch(name.Data(),address,Form("%s/f[0,0,%d]",name.Data(),fFloat16NBits));
+  else
+    fTreeVar->Branch(name.Data(),address);
+}
+
+//________________________________________________________________
+void AliHFTreeHandler::ConfigureTree()
+{
+  //set compression and basket size of the float branches and set up the candidate buffer,
+  //with one column per leaf holding the values of the buffered candidates
+
+  fConfiguredTree=fTreeVar;
+  fColumnAddress.clear();
+  fColumnSize.clear();
+  fColumns.clear();
+  fNBufferedCand=0;
+  if(!fTreeVar) return;
+
+  TObjArray* branches = fTreeVar->GetListOfBranches();
+  for(int iBranch=0; iBranch<branches->GetEntriesFast(); iBranch++) {
+    TBranch* branch = (TBranch*)branches->UncheckedAt(iBranch);
+    TLeaf* leaf = (TLeaf*)branch->GetListOfLeaves()->At(0);
+    if(!leaf) continue;
+    TString type = leaf->GetTypeName();
+    if(type!="Float_t" && type!="Float16_t") continue;
+    if(fFloatCompression>=0) branch->SetCompressionSettings(fFloatCompression);
+    if(fFloatBasketSize>0) branch->SetBasketSize(fFloatBasketSize);
+  }
+
+  if(fCandBufferSize<=0) return;
+
+  TObjArray* leaves = fTreeVar->GetListOfLeaves();
+  for(int iLeaf=0; iLeaf<leaves->GetEntriesFast(); iLeaf++) {
+    TLeaf* leaf = (TLeaf*)leaves->UncheckedAt(iLeaf);
+    if(leaf->GetLeafCount() || leaf->GetBranch()->IsA()!=TBranch::Class() || !leaf->GetValuePointer()) {
+      AliWarning(Form("Leaf %s cannot be buffered, candidates filled one by one",leaf->GetName()));
+      fCandBufferSize=0;
+      fColumnAddress.clear();
+      fColumnSize.clear();
+      return;
+    }
+    fColumnAddress.push_back((char*)leaf->GetValuePointer());
+    fColumnSize.push_back(leaf->GetLenType()*leaf->GetLenStatic());
+  }
+  fColumns.resize(fColumnAddress.size());
+  for(unsigned int iCol=0; iCol<fColumns.size(); iCol++) fColumns[iCol].reserve(fCandBufferSize*fColumnSize[iCol]);
+}
+
+//________________________________________________________________
+void AliHFTreeHandler::AppendCandidate()
+{
+  //copy the variables of the current candidate to the buffer, fill the tree when full
+
+  for(unsigned int iCol=0; iCol<fColumns.size(); iCol++)
+    fColumns[iCol].insert(fColumns[iCol].end(),fColumnAddress[iCol],fColumnAddress[iCol]+fColumnSize[iCol]);
+  fNBufferedCand++;
+  if(fNBufferedCand>=(unsigned int)fCandBufferSize) FlushTree();
+}
+
+//________________________________________________________________
+void AliHFTreeHandler::FlushTree()
+{
+  //fill the tree with the buffered candidates, in the order in which they were appended
+
+  if(!fNBufferedCand || !fTreeVar) return;
+
+  for(unsigned int iCand=0; iCand<fNBufferedCand; iCand++) {
+    for(unsigned int iCol=0; iCol<fColumns.size(); iCol++)
+      memcpy(fColumnAddress[iCol],&fColumns[iCol][iCand*fColumnSize[iCol]],fColumnSize[iCol]);
+    fTreeVar->Fill();
+  }
+  for(unsigned int iCol=0; iCol<fColumns.size(); iCol++) fColumns[iCol].clear();
+  fNBufferedCand=0;
+}
+
 //________________________________________________________________
 bool AliHFTreeHandler::SetSingleTrackVars(AliAODTrack* prongtracks[]) {
 
@@ -910,9 +1015,12 @@ bool AliHFTreeHandler::SetPidVars(AliAODTrack* prongtracks[], AliPIDResponse* pi
         if(useHypo[iPartHypo]) {
           if(useTPC) {
             double nSigmaTPC = -999;
-            if(pidhf) pidhf->GetnSigmaTPC(prongtracks[iProng],parthypo[iPartHypo],nSigmaTPC);
-            else {
-              nSigmaTPC = pidrespo->NumberOfSigmasTPC(prongtracks[iProng],parthypo[iPartHypo]);
+            if(!fPIDNsigmaTable || !fPIDNsigmaTable->GetNsigma(prongtracks[iProng],pidhf,kTPC,iPartHypo,nSigmaTPC)) {
+              if(pidhf) pidhf->GetnSigmaTPC(prongtracks[iProng],parthypo[iPartHypo],nSigmaTPC);
+              else nSigmaTPC = pidrespo->NumberOfSigmasTPC(prongtracks[iProng],parthypo[iPartHypo]);
+              if(fPIDNsigmaTable) fPIDNsigmaTable->SetNsigma(prongtracks[iProng],pidhf,kTPC,iPartHypo,nSigmaTPC);
+            }
+            if(!pidhf) {
               if(fApplyNsigmaTPCDataCorr && nSigmaTPC>-990.) {
                 float sigma=1., mean=0.;
                 GetNsigmaTPCMeanSigmaData(mean, sigma, parthypo[iPartHypo], prongtracks[iProng]->GetTPCmomentum(), prongtracks[iProng]->Eta());
@@ -923,8 +1031,11 @@ bool AliHFTreeHandler::SetPidVars(AliAODTrack* prongtracks[], AliPIDResponse* pi
           }
           if(useTOF){
             double nSigmaTOF = -999;
-            if(pidhf) pidhf->GetnSigmaTOF(prongtracks[iProng],parthypo[iPartHypo],nSigmaTOF);
-            else nSigmaTOF = pidrespo->NumberOfSigmasTOF(prongtracks[iProng],parthypo[iPartHypo]);
+            if(!fPIDNsigmaTable || !fPIDNsigmaTable->GetNsigma(prongtracks[iProng],pidhf,kTOF,iPartHypo,nSigmaTOF)) {
+              if(pidhf) pidhf->GetnSigmaTOF(prongtracks[iProng],parthypo[iPartHypo],nSigmaTOF);
+              else nSigmaTOF = pidrespo->NumberOfSigmasTOF(prongtracks[iProng],parthypo[iPartHypo]);
+              if(fPIDNsigmaTable) fPIDNsigmaTable->SetNsigma(prongtracks[iProng],pidhf,kTOF,iPartHypo,nSigmaTOF);
+            }
             sig[iProng][kTOF][iPartHypo] = nSigmaTOF;
           }
           if(((fPidOpt>=kNsigmaCombPID && fPidOpt<=kNsigmaCombPIDfloatandint) || fPidOpt==kNsigmaDetAndCombPID) && useTPC && useTOF) {
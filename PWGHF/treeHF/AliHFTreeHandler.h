@@ -22,6 +22,7 @@
 // N. Zardoshti, nima.zardoshti@cern.ch
 /////////////////////////////////////////////////////////////
 
+#include <vector>
 #include <TTree.h>
 #include "AliAODTrack.h"
 #include "AliPIDResponse.h"
@@ -29,6 +30,7 @@
 #include "AliAODMCParticle.h"
 #include "AliAODPidHF.h"
 #include "AliHFJet.h"
+#include "AliHFPIDNsigmaTable.h"
 
 #ifdef HAVE_FASTJET
 #include "AliHFJetFinder.h"
@@ -106,11 +108,14 @@ class AliHFTreeHandler : public TObject
         fCandType=0;
       }
       else {      
-        fTreeVar->Fill(); 
+        if(fConfiguredTree!=fTreeVar) ConfigureTree();
+        if(fCandBufferSize>0) AppendCandidate();
+        else fTreeVar->Fill(); 
         fCandType=0;
         fRunNumberPrevCand = fRunNumber;
       }
     } 
+    void FlushTree(); //to be called at the end of the job if the candidate buffer is enabled!
     
     //common methods
     void SetFillJets(bool FillJets) {fFillJets=FillJets;}
@@ -121,7 +126,13 @@ class AliHFTreeHandler : public TObject
     void SetOptPID(int PIDopt) {fPidOpt=PIDopt;}
     void SetOptSingleTrackVars(int opt) {fSingleTrackOpt=opt;}
     void SetFillOnlySignal(bool fillopt=true) {fFillOnlySignal=fillopt;}
+    //output size and fill speed options, to be set before BuildTree
+    void SetCandidateBufferSize(int ncand) {fCandBufferSize=ncand;}
+    void SetFloat16MantissaBits(int nbits) {fFloat16NBits=nbits;}
+    void SetFloatBranchCompression(int settings, int basketsize=0) {fFloatCompression=settings; fFloatBasketSize=basketsize;}
     void SetUpCombinedPid(); 
+    //per-event nsigma table shared between the handlers (not owned, reset by the owner for each event)
+    void SetPIDNsigmaTable(AliHFPIDNsigmaTable* table) {fPIDNsigmaTable=table;}
 
     void SetCandidateType(bool issignal, bool isbkg, bool isprompt, bool isFD, bool isreflected);
     void SetIsSelectedStd(bool isselected, bool isselectedTopo, bool isselectedPID, bool isselectedTracks) {
@@ -193,6 +204,7 @@ class AliHFTreeHandler : public TObject
     void AddJetBranches();
     void AddGenJetBranches();
     void AddPidBranches(bool usePionHypo, bool useKaonHypo, bool useProtonHypo, bool useTPC, bool useTOF);
+    void AddTruncatedFloatBranch(TString name, float* address);
     bool SetSingleTrackVars(AliAODTrack* prongtracks[]);
     bool SetPidVars(AliAODTrack* prongtracks[], AliPIDResponse* pidrespo, bool usePionHypo, bool useKaonHypo, bool useProtonHypo, bool useTPC, bool useTOF, AliAODPidHF* pidhf);
   
@@ -204,6 +216,10 @@ class AliHFTreeHandler : public TObject
   
     void GetNsigmaTPCMeanSigmaData(float &mean, float &sigma, AliPID::EParticleType species, float pTPC, float eta);
 
+    //candidate buffer methods
+    void ConfigureTree();
+    void AppendCandidate();
+
     TTree* fTreeVar; /// tree with variables
     AliPIDCombined* fPidCombined; /// bayesian PID object
     unsigned int fNProngs; /// number of prongs
@@ -335,8 +351,19 @@ class AliHFTreeHandler : public TObject
     Double_t fSoftDropBeta; //soft drop beta  parameter
     Double_t fTrackingEfficiency;
 
+    int fCandBufferSize; /// number of candidates buffered before filling the tree (0 = fill each candidate)
+    int fFloat16NBits; /// mantissa bits of the PID and DCA branches stored as Float16_t (0 = float)
+    int fFloatCompression; /// compression settings of the float branches (-1 = tree settings)
+    int fFloatBasketSize; /// basket size of the float branches (0 = tree default)
+    TTree* fConfiguredTree; //!<! tree for which the branches and the candidate buffer were set up
+    unsigned int fNBufferedCand; //!<! number of candidates in the buffer
+    std::vector<char*> fColumnAddress; //!<! address of the variable of each column
+    std::vector<unsigned int> fColumnSize; //!<! size in bytes of each column entry
+    std::vector<std::vector<char> > fColumns; //!<! candidate buffer, one column per tree leaf
+    AliHFPIDNsigmaTable* fPIDNsigmaTable; //!<! shared per-event nsigma table (not owned)
+
   /// \cond CLASSIMP
-  ClassDef(AliHFTreeHandler,9); ///
+  ClassDef(AliHFTreeHandler,11); ///
   /// \endcond
 };
 #endif
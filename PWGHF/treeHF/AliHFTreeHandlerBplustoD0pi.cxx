@@ -121,10 +121,10 @@ TTree* AliHFTreeHandlerBplustoD0pi::BuildTree(TString name, TString title)
 
   //set Bplus variables
   fTreeVar->Branch("cos_t_star",&fCosThetaStar);
-  fTreeVar->Branch("imp_par_prod",&fImpParProd);
+  AddTruncatedFloatBranch("imp_par_prod",&fImpParProd);
   fTreeVar->Branch("max_norm_d0d0exp",&fNormd0MeasMinusExp);
   for(unsigned int iProng=0; iProng<fNProngs; iProng++){
-    fTreeVar->Branch(Form("imp_par_prong%d",iProng),&fImpParProng[iProng]);
+    AddTruncatedFloatBranch(Form("imp_par_prong%d",iProng),&fImpParProng[iProng]);
   }
   fTreeVar->Branch("angle_prongs",&fAngleProngs);
 
@@ -139,11 +139,11 @@ TTree* AliHFTreeHandlerBplustoD0pi::BuildTree(TString name, TString title)
   fTreeVar->Branch("norm_dl_xy_D0",&fNormDecayLengthXY_D0);
   fTreeVar->Branch("cos_p_D0",&fCosP_D0);
   fTreeVar->Branch("cos_p_xy_D0",&fCosPXY_D0);
-  fTreeVar->Branch("imp_par_xy_D0",&fImpParXY_D0);
+  AddTruncatedFloatBranch("imp_par_xy_D0",&fImpParXY_D0);
   fTreeVar->Branch("cos_t_star_D0",&fCosThetaStar_D0);
-  fTreeVar->Branch("imp_par_prod_D0",&fImpParProd_D0);
+  AddTruncatedFloatBranch("imp_par_prod_D0",&fImpParProd_D0);
   fTreeVar->Branch("max_norm_d0d0exp_D0",&fNormd0MeasMinusExp_D0);
-  fTreeVar->Branch("dca_D0",&fDCA_D0);
+  AddTruncatedFloatBranch("dca_D0",&fDCA_D0);
   fTreeVar->Branch("angle_prongs_D0",&fAngleProngs_D0);
     
   //set single-track variables
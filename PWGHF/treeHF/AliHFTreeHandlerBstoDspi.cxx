@@ -126,10 +126,10 @@ TTree* AliHFTreeHandlerBstoDspi::BuildTree(TString name, TString title)
 
   //set Bs variables
   fTreeVar->Branch("cos_t_star",&fCosThetaStar);
-  fTreeVar->Branch("imp_par_prod",&fImpParProd);
+  AddTruncatedFloatBranch("imp_par_prod",&fImpParProd);
   fTreeVar->Branch("max_norm_d0d0exp",&fNormd0MeasMinusExp);
   for(unsigned int iProng=0; iProng<fNProngs; iProng++){
-    fTreeVar->Branch(Form("imp_par_prong%d",iProng),&fImpParProng[iProng]);
+    AddTruncatedFloatBranch(Form("imp_par_prong%d",iProng),&fImpParProng[iProng]);
   }
 
   //set Ds variables
@@ -143,8 +143,8 @@ TTree* AliHFTreeHandlerBstoDspi::BuildTree(TString name, TString title)
   fTreeVar->Branch("norm_dl_xy_Ds",&fNormDecayLengthXY_Ds);
   fTreeVar->Branch("cos_p_Ds",&fCosP_Ds);
   fTreeVar->Branch("cos_p_xy_Ds",&fCosPXY_Ds);
-  fTreeVar->Branch("imp_par_xy_Ds",&fImpParXY_Ds);
-  fTreeVar->Branch("dca_Ds",&fDCA_Ds);
+  AddTruncatedFloatBranch("imp_par_xy_Ds",&fImpParXY_Ds);
+  AddTruncatedFloatBranch("dca_Ds",&fDCA_Ds);
   fTreeVar->Branch("sig_vert_Ds",&fSigmaVertex_Ds);
   fTreeVar->Branch("delta_mass_KK_Ds",&fMassKK_Ds);
   fTreeVar->Branch("cos_PiDs_Ds",&fCosPiDs_Ds);
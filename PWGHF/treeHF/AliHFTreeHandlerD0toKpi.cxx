@@ -88,12 +88,12 @@ TTree* AliHFTreeHandlerD0toKpi::BuildTree(TString name, TString title)
 
   //set D0 variables
   fTreeVar->Branch("cos_t_star",&fCosThetaStar);
-  fTreeVar->Branch("imp_par_prod",&fImpParProd);
+  AddTruncatedFloatBranch("imp_par_prod",&fImpParProd);
   fTreeVar->Branch("max_norm_d0d0exp",&fNormd0MeasMinusExp);
   fTreeVar->Branch("norm_dl",&fNormDecayLength);
   for(unsigned int iProng=0; iProng<fNProngs; iProng++){
-    fTreeVar->Branch(Form("imp_par_prong%d",iProng),&fImpParProng[iProng]);
-    fTreeVar->Branch(Form("imp_par_err_prong%d",iProng),&fImpParErrProng[iProng]);
+    AddTruncatedFloatBranch(Form("imp_par_prong%d",iProng),&fImpParProng[iProng]);
+    AddTruncatedFloatBranch(Form("imp_par_err_prong%d",iProng),&fImpParErrProng[iProng]);
   }
 
   //set single-track variables
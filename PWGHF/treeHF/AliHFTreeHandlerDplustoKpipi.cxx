@@ -82,7 +82,7 @@ TTree* AliHFTreeHandlerDplustoKpipi::BuildTree(TString name, TString title)
   fTreeVar->Branch("sig_vert",&fSigmaVertex);
   fTreeVar->Branch("max_norm_d0d0exp",&fNormd0MeasMinusExp);
   for(unsigned int iProng=0; iProng<fNProngs; iProng++){
-    fTreeVar->Branch(Form("imp_par_prong%d",iProng),&fImpParProng[iProng]);
+    AddTruncatedFloatBranch(Form("imp_par_prong%d",iProng),&fImpParProng[iProng]);
   }
 
   //set single-track variables
@@ -96,11 +96,11 @@ TTree* AliHFTreeHandlerDstartoKpipi::BuildTree(TString name, TString title)
 
   //set Dstar variables
   fTreeVar->Branch("cos_t_star",&fCosThetaStar);
-  fTreeVar->Branch("imp_par_prod",&fImpParProd);
+  AddTruncatedFloatBranch("imp_par_prod",&fImpParProd);
   fTreeVar->Branch("max_norm_d0d0exp",&fNormd0MeasMinusExp);
   fTreeVar->Branch("angle_D0dkpPisoft",&fAngleD0dkpPisoft);
   for(unsigned int iProng=0; iProng<fNProngs; iProng++){
-    fTreeVar->Branch(Form("imp_par_prong%d",iProng),&fImpParProng[iProng]);
+    AddTruncatedFloatBranch(Form("imp_par_prong%d",iProng),&fImpParProng[iProng]);
   }
 
   //set D0 variables
@@ -97,7 +97,7 @@ TTree* AliHFTreeHandlerDstoKKpi::BuildTree(TString name, TString title)
   fTreeVar->Branch("cos_PiKPhi_3",&fCosPiKPhi);
   fTreeVar->Branch("max_norm_d0d0exp",&fNormd0MeasMinusExp);
   for(unsigned int iProng=0; iProng<fNProngs; iProng++){
-    fTreeVar->Branch(Form("imp_par_prong%d",iProng),&fImpParProng[iProng]);
+    AddTruncatedFloatBranch(Form("imp_par_prong%d",iProng),&fImpParProng[iProng]);
   }
     
   //set single-track variables
@@ -139,16 +139,16 @@ TTree* AliHFTreeHandlerLbtoLcpi::BuildTree(TString name, TString title)
 
   //set Lb variables
   fTreeVar->Branch("cos_t_star",&fCosThetaStar);
-  fTreeVar->Branch("imp_par_prod",&fImpParProd);
+  AddTruncatedFloatBranch("imp_par_prod",&fImpParProd);
   fTreeVar->Branch("ctau",&fcTau);
   fTreeVar->Branch("chi2_over_ndf",&fChi2OverNDF);
   for(unsigned int iProng=0; iProng<fNProngs; iProng++){
-    fTreeVar->Branch(Form("imp_par_prong%d",iProng),&fImpParProng[iProng]);
+    AddTruncatedFloatBranch(Form("imp_par_prong%d",iProng),&fImpParProng[iProng]);
   }
 
   //set Lc variables
   fTreeVar->Branch("inv_mass_Lc",&fInvMass_Lc);
-  fTreeVar->Branch("imp_par_Lc", &fImpPar_Lc);
+  AddTruncatedFloatBranch("imp_par_Lc",&fImpPar_Lc);
   fTreeVar->Branch("pt_Lc",&fPt_Lc);
   fTreeVar->Branch("y_Lc",&fY_Lc);
   fTreeVar->Branch("eta_Lc",&fEta_Lc);
@@ -158,15 +158,15 @@ TTree* AliHFTreeHandlerLbtoLcpi::BuildTree(TString name, TString title)
   fTreeVar->Branch("norm_dl_xy_Lc",&fNormDecayLengthXY_Lc);
   fTreeVar->Branch("cos_p_Lc",&fCosP_Lc);
   fTreeVar->Branch("cos_p_xy_Lc",&fCosPXY_Lc);
-  fTreeVar->Branch("imp_par_xy_Lc",&fImpParXY_Lc);
-  fTreeVar->Branch("dca_Lc",&fDCA_Lc);
+  AddTruncatedFloatBranch("imp_par_xy_Lc",&fImpParXY_Lc);
+  AddTruncatedFloatBranch("dca_Lc",&fDCA_Lc);
   fTreeVar->Branch("sig_vert_Lc",&fSigmaVertex_Lc);
   fTreeVar->Branch("dist_12_Lc",&fDist12toPrim_Lc);
   fTreeVar->Branch("dist_23_Lc",&fDist23toPrim_Lc);
   fTreeVar->Branch("max_norm_d0d0exp_Lc",&fNormd0MeasMinusExp_Lc);
   fTreeVar->Branch("sum_d0d0_prongs_Lc",&fSumImpParProngs_Lc);
   for(unsigned int iProng=0; iProng<3; iProng++){
-    fTreeVar->Branch(Form("dca_prong%d_Lc",iProng),&fDCAProng_Lc[iProng]);
+    AddTruncatedFloatBranch(Form("dca_prong%d_Lc",iProng),&fDCAProng_Lc[iProng]);
   }
 
   //set single-track variables
@@ -97,8 +97,8 @@ TTree* AliHFTreeHandlerLc2V0bachelor::BuildTree(TString name, TString title)
   fTreeVar->Branch("cos_t_star", &fCosThetaStar);
   fTreeVar->Branch("signd0", &fsignd0);
   fTreeVar->Branch("inv_mass_K0s", &fInvMassK0s);
-  fTreeVar->Branch("dca_K0s", &fDCAK0s);
-  fTreeVar->Branch("imp_par_K0s", &fImpParK0s);
+  AddTruncatedFloatBranch("dca_K0s",&fDCAK0s);
+  AddTruncatedFloatBranch("imp_par_K0s",&fImpParK0s);
   fTreeVar->Branch("d_len_K0s", &fDecayLengthK0s);
   fTreeVar->Branch("armenteros_K0s", &fArmqTOverAlpha);
   fTreeVar->Branch("ctau_K0s", &fcTauK0s);
@@ -107,7 +107,7 @@ TTree* AliHFTreeHandlerLc2V0bachelor::BuildTree(TString name, TString title)
   fTreeVar->Branch("eta_K0s", &fEtaK0s);
   fTreeVar->Branch("phi_K0s", &fPhiK0s);
   for(unsigned int iProng=0; iProng<fNProngs; iProng++){
-    fTreeVar->Branch(Form("imp_par_prong%d", iProng), &fImpParProng[iProng]);
+    AddTruncatedFloatBranch(Form("imp_par_prong%d",iProng),&fImpParProng[iProng]);
   }
 
   //set single-track variables
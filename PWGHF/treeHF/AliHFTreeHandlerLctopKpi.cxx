@@ -99,8 +99,8 @@ TTree* AliHFTreeHandlerLctopKpi::BuildTree(TString name, TString title)
   fTreeVar->Branch("max_norm_d0d0exp",&fNormd0MeasMinusExp);
   fTreeVar->Branch("sum_d0d0_prongs",&fSumImpParProngs);
   for(unsigned int iProng=0; iProng<fNProngs; iProng++){
-    fTreeVar->Branch(Form("imp_par_prong%d",iProng),&fImpParProng[iProng]);
-    fTreeVar->Branch(Form("dca_prong%d",iProng),&fDCAProng[iProng]);
+    AddTruncatedFloatBranch(Form("imp_par_prong%d",iProng),&fImpParProng[iProng]);
+    AddTruncatedFloatBranch(Form("dca_prong%d",iProng),&fDCAProng[iProng]);
   }
   fTreeVar->Branch("resonant_decay_mc",&fResonantDecayType);
 
@@ -7,6 +7,7 @@
 
 #pragma link C++ class   AliAnalysisTaskSEHFTreeCreator+;
 #pragma link C++ class   AliHFJet+;
+#pragma link C++ class   AliHFPIDNsigmaTable+;
 #pragma link C++ class   AliHFTreeHandler+;
 #pragma link C++ class   AliHFTreeHandlerD0toKpi+; 
 #pragma link C++ class   AliHFTreeHandlerDplustoKpipi+;
@@ -31,6 +31,7 @@
 #include "AliAODPid.h"
 #include "AliPID.h"
 #include "AliPIDResponse.h"
+#include "AliPIDNSigmaTable.h"
 #include "AliAODpidUtil.h"
 #include "AliESDtrack.h"
 
@@ -659,7 +660,7 @@ Int_t AliAODPidHF::MatchTPCTOF(AliAODTrack *track, Int_t specie){
     
     Double_t nSigmaTPC=0.;
     if(okTPC) {
-      nSigmaTPC = fPidResponse->NumberOfSigmasTPC(track, (AliPID::EParticleType)specie);
+      nSigmaTPC = AliPIDNSigmaTable::NumberOfSigmasTPC(fPidResponse, track, (AliPID::EParticleType)specie);
       if(fApplyNsigmaTPCDataCorr && nSigmaTPC>-990.) { 
         Float_t mean=0., sigma=1.; 
         GetNsigmaTPCMeanSigmaData(mean, sigma, (AliPID::EParticleType)specie, track->GetTPCmomentum(),track->Eta());
@@ -669,7 +670,7 @@ Int_t AliAODPidHF::MatchTPCTOF(AliAODTrack *track, Int_t specie){
     }
     Double_t nSigmaTOF=0.;
     if(okTOF) {
-      nSigmaTOF=fPidResponse->NumberOfSigmasTOF(track,(AliPID::EParticleType)specie);
+      nSigmaTOF=AliPIDNSigmaTable::NumberOfSigmasTOF(fPidResponse, track,(AliPID::EParticleType)specie);
     }
     Int_t iPart=specie-2; //species is 2 for pions,3 for kaons and 4 for protons
     if(iPart<0 || iPart>2) return -1;
@@ -917,7 +918,7 @@ Int_t AliAODPidHF::GetnSigmaITS(AliAODTrack *track,Int_t species, Double_t &nsig
   else { // new pid
     
     AliPID::EParticleType type=AliPID::EParticleType(species);
-    nsigmaITS = fPidResponse->NumberOfSigmasITS(track,type);
+    nsigmaITS = AliPIDNSigmaTable::NumberOfSigmasITS(fPidResponse, track,type);
     
   } //new pid
   
@@ -947,7 +948,7 @@ Int_t AliAODPidHF::GetnSigmaTPC(AliAODTrack *track, Int_t species, Double_t &nsi
   } else{
     if(!fPidResponse) return -1;
     AliPID::EParticleType type=AliPID::EParticleType(species);
-    nsigmaTPC = fPidResponse->NumberOfSigmasTPC(track,type);
+    nsigmaTPC = AliPIDNSigmaTable::NumberOfSigmasTPC(fPidResponse, track,type);
     if(fApplyNsigmaTPCDataCorr && nsigmaTPC>-990.) {
       Float_t mean=0., sigma=1.; 
       GetNsigmaTPCMeanSigmaData(mean, sigma, type, track->GetTPCmomentum(), track->Eta());
@@ -966,7 +967,7 @@ Int_t AliAODPidHF::GetnSigmaTOF(AliAODTrack *track,Int_t species, Double_t &nsig
   if(!CheckTOFPIDStatus(track)) return -1;
   
   if(fPidResponse){
-    nsigma = fPidResponse->NumberOfSigmasTOF(track,(AliPID::EParticleType)species);
+    nsigma = AliPIDNSigmaTable::NumberOfSigmasTOF(fPidResponse, track,(AliPID::EParticleType)species);
     return 1;
   }else{
     AliFatal("To use TOF PID you need to attach AliPIDResponseTask");
@@ -1332,12 +1333,12 @@ Float_t AliAODPidHF::NumberOfSigmas(AliPID::EParticleType specie, AliPIDResponse
   switch (detector) {
     case AliPIDResponse::kITS:
     {
-      return fPidResponse->NumberOfSigmasITS(track, specie);
+      return AliPIDNSigmaTable::NumberOfSigmasITS(fPidResponse, track, specie);
       break;
     }
     case AliPIDResponse::kTPC:
     {
-      Double_t nsigmaTPC = fPidResponse->NumberOfSigmasTPC(track, specie);
+      Double_t nsigmaTPC = AliPIDNSigmaTable::NumberOfSigmasTPC(fPidResponse, track, specie);
       if(fApplyNsigmaTPCDataCorr && nsigmaTPC>-990.) {
         Float_t mean=0., sigma=1.; 
         GetNsigmaTPCMeanSigmaData(mean, sigma, specie, track->GetTPCmomentum(), track->Eta());
@@ -1348,7 +1349,7 @@ Float_t AliAODPidHF::NumberOfSigmas(AliPID::EParticleType specie, AliPIDResponse
     }
     case AliPIDResponse::kTOF:
     {
-      return fPidResponse->NumberOfSigmasTOF(track, specie);
+      return AliPIDNSigmaTable::NumberOfSigmasTOF(fPidResponse, track, specie);
       break;
     }
     default:
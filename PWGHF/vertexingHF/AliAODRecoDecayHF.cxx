@@ -38,6 +38,8 @@
 ClassImp(AliAODRecoDecayHF);
 /// \endcond
 
+Bool_t AliAODRecoDecayHF::fgUseCachedVariables = kTRUE;
+
 //--------------------------------------------------------------------------
 AliAODRecoDecayHF::AliAODRecoDecayHF() :
   AliAODRecoDecay(),
@@ -48,7 +50,10 @@ AliAODRecoDecayHF::AliAODRecoDecayHF() :
   fd0err(0x0), 
   fProngID(0x0),
   fSelectionMap(0),
-  fIsFilled(1) 
+  fIsFilled(1),
+  fCachePrimVtx(0x0),
+  fCacheSecVtx(0x0),
+  fCacheMask(0)
 {
   //
   // Default Constructor
@@ -66,7 +71,10 @@ AliAODRecoDecayHF::AliAODRecoDecayHF(AliAODVertex *vtx2,Int_t nprongs,Short_t ch
   fd0err(0x0),
   fProngID(0x0),
   fSelectionMap(0),
-  fIsFilled(1)
+  fIsFilled(1),
+  fCachePrimVtx(0x0),
+  fCacheSecVtx(0x0),
+  fCacheMask(0)
 {
   //
   // Constructor with AliAODVertex for decay vertex
@@ -85,7 +93,10 @@ AliAODRecoDecayHF::AliAODRecoDecayHF(AliAODVertex *vtx2,Int_t nprongs,Short_t ch
   fd0err(0x0),
   fProngID(0x0),
   fSelectionMap(0),
-  fIsFilled(1)
+  fIsFilled(1),
+  fCachePrimVtx(0x0),
+  fCacheSecVtx(0x0),
+  fCacheMask(0)
 {
   //
   // Constructor with AliAODVertex for decay vertex and without prongs momenta
@@ -106,7 +117,10 @@ AliAODRecoDecayHF::AliAODRecoDecayHF(Double_t vtx1[3],Double_t vtx2[3],
   fd0err(0x0),
   fProngID(0x0), 
   fSelectionMap(0),
-  fIsFilled(1)
+  fIsFilled(1),
+  fCachePrimVtx(0x0),
+  fCacheSecVtx(0x0),
+  fCacheMask(0)
 {
   //
   // Constructor that can used for a "MC" object
@@ -128,7 +142,10 @@ AliAODRecoDecayHF::AliAODRecoDecayHF(const AliAODRecoDecayHF &source) :
   fd0err(0x0),
   fProngID(0x0),
   fSelectionMap(source.fSelectionMap),
-  fIsFilled(source.fIsFilled)
+  fIsFilled(source.fIsFilled),
+  fCachePrimVtx(0x0),
+  fCacheSecVtx(0x0),
+  fCacheMask(0)
 {
   //
   // Copy constructor
@@ -160,6 +177,7 @@ AliAODRecoDecayHF &AliAODRecoDecayHF::operator=(const AliAODRecoDecayHF &source)
   fListOfCuts = source.fListOfCuts;
   fSelectionMap = source.fSelectionMap;
   fIsFilled=source.fIsFilled;
+  InvalidateCache();
 
   if(source.GetOwnPrimaryVtx()) {
     delete fOwnPrimaryVtx;
@@ -337,6 +355,7 @@ void AliAODRecoDecayHF::RecalculateImpPars(AliAODVertex *vtxAODNew,AliAODEvent*
   //
   // now recalculate the daughters impact parameters
   //
+  InvalidateCache();
   Double_t dz[2],covdz[3];
   for(Int_t i=0; i<GetNDaughters(); i++) {
     AliAODTrack *t = (AliAODTrack*)GetDaughter(i);
@@ -494,3 +513,54 @@ void AliAODRecoDecayHF::DeleteRecoD(){
 
   return;
 }
+//-----------------------------------------------------------------------------
+Double_t AliAODRecoDecayHF::GetCachedVariable(Int_t ivar) const
+{
+  //
+  // Topological variable ivar (ECachedVar) w.r.t. GetPrimaryVtx(), computed at
+  // the first call and then taken from the cache, which is reset when the
+  // primary or secondary vertex (pointer or position) changes, e.g. at the next event
+  //
+  AliAODVertex *primVtx = GetPrimaryVtx();
+  if(!fgUseCachedVariables || !primVtx) return ComputeCachedVariable(ivar,primVtx);
+
+  AliAODVertex *secVtx = GetSecondaryVtx();
+  Double_t pos[6]={primVtx->GetX(),primVtx->GetY(),primVtx->GetZ(),0.,0.,0.};
+  if(secVtx) {
+    pos[3]=secVtx->GetX();
+    pos[4]=secVtx->GetY();
+    pos[5]=secVtx->GetZ();
+  }
+  if(primVtx!=fCachePrimVtx || secVtx!=fCacheSecVtx || memcmp(pos,fCacheVtxPos,6*sizeof(Double_t))) {
+    fCachePrimVtx=primVtx;
+    fCacheSecVtx=secVtx;
+    memcpy(fCacheVtxPos,pos,6*sizeof(Double_t));
+    fCacheMask=0;
+  }
+  if(!TESTBIT(fCacheMask,ivar)) {
+    fCacheValues[ivar]=ComputeCachedVariable(ivar,primVtx);
+    SETBIT(fCacheMask,ivar);
+  }
+  return fCacheValues[ivar];
+}
+//-----------------------------------------------------------------------------
+Double_t AliAODRecoDecayHF::ComputeCachedVariable(Int_t ivar,AliAODVertex *primVtx) const
+{
+  //
+  // Compute the topological variable ivar (ECachedVar) w.r.t. primVtx
+  //
+  switch(ivar) {
+  case kCacheDecayLength:        return AliAODRecoDecay::DecayLength(primVtx);
+  case kCacheDecayLengthError:   return AliAODRecoDecay::DecayLengthError(primVtx);
+  case kCacheNormDecayLength:    return AliAODRecoDecay::NormalizedDecayLength(primVtx);
+  case kCacheDecayLengthXY:      return AliAODRecoDecay::DecayLengthXY(primVtx);
+  case kCacheDecayLengthXYError: return AliAODRecoDecay::DecayLengthXYError(primVtx);
+  case kCacheNormDecayLengthXY:  return AliAODRecoDecay::NormalizedDecayLengthXY(primVtx);
+  case kCacheCosPointingAngle:   return AliAODRecoDecay::CosPointingAngle(primVtx);
+  case kCacheCosPointingAngleXY: return AliAODRecoDecay::CosPointingAngleXY(primVtx);
+  case kCacheImpParXY:           return AliAODRecoDecay::ImpParXY(primVtx);
+  default: break;
+  }
+  printf("AliAODRecoDecayHF::ComputeCachedVariable: unknown variable %d\n",ivar);
+  return -999.;
+}
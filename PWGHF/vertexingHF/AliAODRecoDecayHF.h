@@ -23,6 +23,8 @@ class AliAODRecoDecayHF : public AliAODRecoDecay {
 
  public:
 
+  enum { kRefillFailed = BIT(14) };
+
   AliAODRecoDecayHF();
   AliAODRecoDecayHF(AliAODVertex *vtx2,Int_t nprongs,Short_t charge,
 		    Double_t *px,Double_t *py,Double_t *pz,
@@ -39,15 +41,15 @@ class AliAODRecoDecayHF : public AliAODRecoDecay {
    
 
   /// primary vertex
-  void SetPrimaryVtxRef(TObject *vtx) { fEventPrimaryVtx = vtx; }
+  void SetPrimaryVtxRef(TObject *vtx) { fEventPrimaryVtx = vtx; InvalidateCache(); }
   AliAODVertex* GetPrimaryVtxRef() const { return (AliAODVertex*)(fEventPrimaryVtx.GetObject()); }
-  void SetOwnPrimaryVtx(const AliAODVertex *vtx) { UnsetOwnPrimaryVtx(); fOwnPrimaryVtx = new AliAODVertex(*vtx);}
+  void SetOwnPrimaryVtx(const AliAODVertex *vtx) { UnsetOwnPrimaryVtx(); fOwnPrimaryVtx = new AliAODVertex(*vtx); InvalidateCache();}
   void CheckOwnPrimaryVtx() const 
     {if(!fOwnPrimaryVtx) printf("fOwnPrimaryVtx not set"); return;}
   AliAODVertex* GetOwnPrimaryVtx() const {return fOwnPrimaryVtx;}
   void GetOwnPrimaryVtx(Double_t vtx[3]) const 
     {CheckOwnPrimaryVtx();fOwnPrimaryVtx->GetPosition(vtx);}
-  void UnsetOwnPrimaryVtx() {if(fOwnPrimaryVtx) {delete fOwnPrimaryVtx; fOwnPrimaryVtx=0;} return;}
+  void UnsetOwnPrimaryVtx() {if(fOwnPrimaryVtx) {delete fOwnPrimaryVtx; fOwnPrimaryVtx=0;} InvalidateCache(); return;}
   void UnsetOwnSecondaryVtx() {if(fOwnSecondaryVtx) {delete fOwnSecondaryVtx; fOwnSecondaryVtx=0;} return;}
   AliAODVertex* GetPrimaryVtx() const { return (GetOwnPrimaryVtx() ? GetOwnPrimaryVtx() : GetPrimaryVtxRef()); }
   AliAODVertex* RemoveDaughtersFromPrimaryVtx(AliAODEvent *aod);  
@@ -55,33 +57,47 @@ class AliAODRecoDecayHF : public AliAODRecoDecay {
 
   void     SetIsFilled(Int_t filled){fIsFilled=filled;}
   Int_t    GetIsFilled() const {return fIsFilled;}  
+  /// flag set by AliAnalysisVertexingHF::FillRecoCand when the refilling failed, to avoid repeating it in each task
+  void     SetRefillFailed(Bool_t failed=kTRUE){SetBit(kRefillFailed,failed);}
+  Bool_t   GetRefillFailed() const {return TestBit(kRefillFailed);}
   virtual void DeleteRecoD();
 
+  /// cache of the topological variables with respect to the primary vertex:
+  /// filled at the first call of each variable and kept as long as the primary
+  /// and secondary vertices are unchanged, so that the wagons of a train
+  /// selecting the same candidate in an event do not recompute them
+  enum ECachedVar {kCacheDecayLength, kCacheDecayLengthError, kCacheNormDecayLength,
+		   kCacheDecayLengthXY, kCacheDecayLengthXYError, kCacheNormDecayLengthXY,
+		   kCacheCosPointingAngle, kCacheCosPointingAngleXY, kCacheImpParXY, kNCachedVars};
+  Double_t GetCachedVariable(Int_t ivar) const;
+  void     InvalidateCache() const {fCacheMask=0;}
+  static void SetUseCachedVariables(Bool_t use=kTRUE) {fgUseCachedVariables=use;}
+
   /// kinematics & topology
   Double_t DecayLength2() const 
     { return AliAODRecoDecay::DecayLength2(GetPrimaryVtx());}
   Double_t DecayLength() const 
-    { return AliAODRecoDecay::DecayLength(GetPrimaryVtx());}
+    { return GetCachedVariable(kCacheDecayLength);}
   Double_t DecayLengthError() const 
-    { return AliAODRecoDecay::DecayLengthError(GetPrimaryVtx());}
+    { return GetCachedVariable(kCacheDecayLengthError);}
   Double_t NormalizedDecayLength() const 
-    { return AliAODRecoDecay::NormalizedDecayLength(GetPrimaryVtx());}
+    { return GetCachedVariable(kCacheNormDecayLength);}
   Double_t NormalizedDecayLength2() const 
     { return AliAODRecoDecay::NormalizedDecayLength2(GetPrimaryVtx());}
   Double_t DecayLengthXY() const 
-    { return AliAODRecoDecay::DecayLengthXY(GetPrimaryVtx());}
+    { return GetCachedVariable(kCacheDecayLengthXY);}
   Double_t DecayLengthXYError() const 
-    { return AliAODRecoDecay::DecayLengthXYError(GetPrimaryVtx());}
+    { return GetCachedVariable(kCacheDecayLengthXYError);}
   Double_t NormalizedDecayLengthXY() const 
-    { return AliAODRecoDecay::NormalizedDecayLengthXY(GetPrimaryVtx());}
+    { return GetCachedVariable(kCacheNormDecayLengthXY);}
   Double_t Ct(UInt_t pdg) const 
     { return AliAODRecoDecay::Ct(pdg,GetPrimaryVtx());}
   Double_t CosPointingAngle() const 
-    { return AliAODRecoDecay::CosPointingAngle(GetPrimaryVtx());}
+    { return GetCachedVariable(kCacheCosPointingAngle);}
   Double_t CosPointingAngleXY() const 
-    { return AliAODRecoDecay::CosPointingAngleXY(GetPrimaryVtx());}
+    { return GetCachedVariable(kCacheCosPointingAngleXY);}
   Double_t ImpParXY() const 
-    { return AliAODRecoDecay::ImpParXY(GetPrimaryVtx());}
+    { return GetCachedVariable(kCacheImpParXY);}
   Double_t QtProngFlightLine(Int_t ip) const 
     { return AliAODRecoDecay::QtProngFlightLine(ip,GetPrimaryVtx());}
   Double_t QlProngFlightLine(Int_t ip) const 
@@ -142,8 +158,17 @@ class AliAODRecoDecayHF : public AliAODRecoDecay {
   ULong_t       fSelectionMap; /// used to store outcome of selection in AliAnalysisVertexingHF
   Int_t         fIsFilled;  // 0 if standard refiltering; 1 if data members of candidates are empty, 2 if data members are refilled in analysis task 
 
+  Double_t ComputeCachedVariable(Int_t ivar,AliAODVertex *primVtx) const;
+
+  mutable AliAODVertex *fCachePrimVtx;  //!<! primary vertex of the cached variables
+  mutable AliAODVertex *fCacheSecVtx;   //!<! secondary vertex of the cached variables
+  mutable Double_t      fCacheVtxPos[6];  //!<! positions of the two vertices of the cached variables
+  mutable UInt_t        fCacheMask;     //!<! bit map of the cached variables
+  mutable Double_t      fCacheValues[kNCachedVars]; //!<! cached variables
+  static Bool_t         fgUseCachedVariables; /// switch for the cache of the topological variables
+
   /// \cond CLASSIMP
-  ClassDef(AliAODRecoDecayHF,7)  // base class for AOD reconstructed heavy-flavour decays
+  ClassDef(AliAODRecoDecayHF,8)  // base class for AOD reconstructed heavy-flavour decays
   /// \endcond
 };
 
@@ -45,6 +45,7 @@
 #include "AliGenPythiaEventHeader.h"
 #include "AliAnalysisUtils.h"
 #include "AliAnalysisVertexingHF.h"
+#include "AliHFTrackIndex.h"
 #include "AliAnalysisTaskCombinHF.h"
 
 /// \cond CLASSIMP
@@ -222,7 +223,11 @@ AliAnalysisTaskCombinHF::AliAnalysisTaskCombinHF():
   fMinMultiplicity(-0.5),
   fMaxMultiplicity(199.5),
   fKaonTracks(0x0),
-  fPionTracks(0x0)
+  fPionTracks(0x0),
+  fTrackIndexName(""),
+  fTrackIndexSelection(""),
+  fTrackIndex(0x0),
+  fTrackIndexBit(-1)
 {
   /// default constructor
 }
@@ -398,7 +403,11 @@ AliAnalysisTaskCombinHF::AliAnalysisTaskCombinHF(Int_t meson, AliRDHFCuts* analy
   fMinMultiplicity(-0.5),
   fMaxMultiplicity(199.5),
   fKaonTracks(0x0),
-  fPionTracks(0x0)
+  fPionTracks(0x0),
+  fTrackIndexName(""),
+  fTrackIndexSelection(""),
+  fTrackIndex(0x0),
+  fTrackIndexBit(-1)
 {
   /// standard constructor
   DefineOutput(1,TList::Class());  //My private output
@@ -1234,7 +1243,19 @@ void AliAnalysisTaskCombinHF::UserExec(Option_t */*option*/){
     pdgOfD=441;
   }
   fMassMeson = TDatabasePDG::Instance()->GetParticle(pdgOfD)->Mass();
-  
+
+  // track selection from the index filled by AliAnalysisTaskSEHFTrackIndex, if available
+  fTrackIndex=0x0;
+  fTrackIndexBit=-1;
+  if(!fTrackIndexName.IsNull()){
+    AliHFTrackIndex* trackIndex=AliHFTrackIndex::GetFromEvent(aod,fTrackIndexName.Data());
+    if(trackIndex && trackIndex->IsFilledFor(aod)){
+      fTrackIndexBit=trackIndex->GetSelectionBit(fTrackIndexSelection.Data());
+      if(fTrackIndexBit>=0) fTrackIndex=trackIndex;
+      else AliWarning(Form("Track selection %s not found in %s, apply the track cuts",fTrackIndexSelection.Data(),fTrackIndexName.Data()));
+    }
+  }
+
   // select and flag tracks
   UChar_t* status = new UChar_t[ntracks];
   for(Int_t iTr=0; iTr<ntracks; iTr++){
@@ -1251,7 +1272,7 @@ void AliAnalysisTaskCombinHF::UserExec(Option_t */*option*/){
     }
     Double_t d0z0[2],covd0z0[3];
     track->PropagateToDCA(vtTrc,magField,99999.,d0z0,covd0z0);
-    if(IsTrackSelected(track)) status[iTr]+=1;
+    if(IsTrackSelected(track,iTr)) status[iTr]+=1;
     
     // PID
     if (fPIDstrategy == knSigma) {
@@ -1340,6 +1361,10 @@ void AliAnalysisTaskCombinHF::UserExec(Option_t */*option*/){
   fKaonTracks->Delete();
   fPionTracks->Delete();
   AliAnalysisVertexingHF* vHF=new AliAnalysisVertexingHF();
+  Double_t massDau1=TDatabasePDG::Instance()->GetParticle(pdg2pr[0])->Mass();
+  Double_t massDau2=TDatabasePDG::Instance()->GetParticle(pdg2pr[1])->Mass();
+  Bool_t prefilterLS=(nProngs==2 && !(fReadMC && fSignalOnlyMC));
+  if(prefilterLS) LoadPairingBuffer(aod,status,pidBitToTestTr2,massDau2);
 
   for(Int_t iTr1=0; iTr1<ntracks; iTr1++){
     AliAODTrack* trK=dynamic_cast<AliAODTrack*>(aod->GetTrack(iTr1));
@@ -1366,12 +1391,15 @@ void AliAnalysisTaskCombinHF::UserExec(Option_t */*option*/){
     py[0] = tmpp[1];
     pz[0] = tmpp[2];
     dgLabels[0]=trK->GetLabel();
+    if(prefilterLS) ComputePairMasses(px[0],py[0],pz[0],massDau1);
     Int_t firstTr2=0;
     if(pidBitToTestTr2==pidBitToTestTr1) firstTr2=iTr1+1; //avoid double counting for etac and J/psi
     for(Int_t iTr2=firstTr2; iTr2<ntracks; iTr2++){
       if((status[iTr2] & 1)==0) continue;
       if((status[iTr2] & pidBitToTestTr2)==0) continue;
       if(iTr1==iTr2) continue;
+      // LS pairs outside the mass window give no contribution: skip them before accessing the track
+      if(prefilterLS && fPairCharge[iTr2]==chargeK && !IsPairInMassWindow(iTr2)) continue;
       AliAODTrack* trPi1=dynamic_cast<AliAODTrack*>(aod->GetTrack(iTr2));
       if(!trPi1){
         AliWarning("Error in casting track to AOD track. Not a standard AOD?");
@@ -1872,8 +1900,10 @@ void AliAnalysisTaskCombinHF::FillMEHistosLS(Int_t pdgD,Int_t nProngs, AliAODRec
   return;
 }
 //________________________________________________________________________
-Bool_t AliAnalysisTaskCombinHF::IsTrackSelected(AliAODTrack* track){
+Bool_t AliAnalysisTaskCombinHF::IsTrackSelected(AliAODTrack* track, Int_t iTrack){
   /// track selection cuts
+  /// iTrack is the index of the track in the AOD event, used to read the result of
+  /// fTrackCutsAll from the AliHFTrackIndex instead of evaluating the cuts
   
   fHistTrackSelSteps->Fill(0.);
   if(track->Charge()==0) return kFALSE;
@@ -1928,7 +1958,11 @@ Bool_t AliAnalysisTaskCombinHF::IsTrackSelected(AliAODTrack* track){
     if(av && !(av->GetType()==AliAODVertex::kKink)) fHistTrackSelSteps->Fill(14.);
   }
   //
-  if(!SelectAODTrack(track,fTrackCutsAll)) return kFALSE;
+  if(fTrackIndex && iTrack>=0 && iTrack<fTrackIndex->GetNTracks()){
+    if(!fTrackIndex->IsSelected(iTrack,fTrackIndexBit)) return kFALSE;
+  }else{
+    if(!SelectAODTrack(track,fTrackCutsAll)) return kFALSE;
+  }
   fHistTrackSelSteps->Fill(15.);
   return kTRUE;
 }
@@ -2108,6 +2142,8 @@ void AliAnalysisTaskCombinHF::DoMixingWithCuts(){
   AliAODRecoDecay* tmpRD3 = new AliAODRecoDecay(0x0,3,1,d03);
   UInt_t pdg0[2]={321,211};
   //  UInt_t pdgp[3]={321,211,211};
+  Double_t massK=TDatabasePDG::Instance()->GetParticle(321)->Mass();
+  Double_t massPi=TDatabasePDG::Instance()->GetParticle(211)->Mass();
   Double_t px[3],py[3],pz[3];
   Int_t evId1,esdId1,nk1,np1;
   Int_t evId2,esdId2,nk2,np2;
@@ -2138,43 +2174,41 @@ void AliAnalysisTaskCombinHF::DoMixingWithCuts(){
         printf("AnalysisTaskCombinHF::DoMixingWithCuts ERROR: same event in mixing??? %d %d   %f %f  %f %f\n",iEv1,iEv2,zVertex1,zVertex2,mult1,mult2);
         continue;
       }
-      TObjArray* parray2=(TObjArray*)parray->Clone();
-      Int_t nPions=parray2->GetEntries();
+      Int_t nPions=parray->GetEntries();
       Int_t nKaonsForCheck=karray->GetEntries();
       sscanf((eventInfo->String()).Data(),"Ev%d_esd%d_Pi%d_K%d",&evId2,&esdId2,&np2,&nk2);
       if(nk2!=nKaonsForCheck || np2!=nPions){ 
         printf("AnalysisTaskCombinHF::DoMixingWithCuts ERROR: read event does not match to the stored one\n");
-        delete parray2;
         continue;
       }
       if(evId2==evId1 && esdId2==esdId1){
         printf("AnalysisTaskCombinHF::DoMixingWithCuts ERROR: same event in mixing??? %d %d   nK=%d %d  nPi=%d %d\n",evId1,evId2,nKaons,nKaonsForCheck,nPionsForCheck,nPions);
-        delete parray2;
         continue;
       }
-      if(CanBeMixed(zVertex1,zVertex2,mult1,mult2)){
+      if(fMeson==kDzero && CanBeMixed(zVertex1,zVertex2,mult1,mult2)){
+        LoadPairingBuffer(parray,massPi);
         for(Int_t iTr1=0; iTr1<nKaons; iTr1++){
           TLorentzVector* trK=(TLorentzVector*)karray1->At(iTr1);
           Double_t chargeK=trK->T();
           px[0] = trK->Px();
           py[0] = trK->Py();
           pz[0] = trK->Pz();
+          ComputePairMasses(px[0],py[0],pz[0],massK);
           for(Int_t iTr2=0; iTr2<nPions; iTr2++){
-            TLorentzVector* trPi1=(TLorentzVector*)parray2->At(iTr2);
-            Double_t chargePi1=trPi1->T();
-            px[1] = trPi1->Px();
-            py[1] = trPi1->Py();
-            pz[1] = trPi1->Pz();
-            if(fMeson==kDzero && chargePi1*chargeK<0){
+            if(!IsPairInMassWindow(iTr2)) continue;
+            Double_t chargePi1=fPairCharge[iTr2];
+            px[1] = fPairPx[iTr2];
+            py[1] = fPairPy[iTr2];
+            pz[1] = fPairPz[iTr2];
+            if(chargePi1*chargeK<0){
               FillMEHistos(421,2,tmpRD2,px,py,pz,pdg0);
             }
-            if(fMeson==kDzero && chargePi1*chargeK>0){
+            if(chargePi1*chargeK>0){
               FillMEHistosLS(421,2,tmpRD2,px,py,pz,pdg0,(Int_t)chargePi1);
             }
           }
         }
       }
-      delete parray2;
     }
     delete karray1;
   }
@@ -2231,6 +2265,8 @@ void AliAnalysisTaskCombinHF::DoMixingWithPools(Int_t poolIndex){
     pdg2pr[1]=2212;
     pdgOfD=441;
   }
+  Double_t massDau1=TDatabasePDG::Instance()->GetParticle(pdg2pr[0])->Mass();
+  Double_t massDau2=TDatabasePDG::Instance()->GetParticle(pdg2pr[1])->Mass();
 
   for(Int_t iEv1=0; iEv1<nEvents; iEv1++){
     fEventBuffer[poolIndex]->GetEvent(iEv1);
@@ -2280,6 +2316,30 @@ void AliAnalysisTaskCombinHF::DoMixingWithPools(Int_t poolIndex){
         parray3=(TObjArray*)parray->Clone();
         nPions3=parray3->GetEntries();
       }
+      if(nProngs==2){
+        // 2-prong candidates: pair masses of each kaon with all pions of the event computed in one batch,
+        // only pairs within the mass window are passed to the filling of the histograms
+        LoadPairingBuffer(parray2,massDau2);
+        for(Int_t iTr1=0; iTr1<nKaons; iTr1++){
+          TLorentzVector* trK=(TLorentzVector*)karray1->At(iTr1);
+          Double_t chargeK=trK->T();
+          px[0] = trK->Px();
+          py[0] = trK->Py();
+          pz[0] = trK->Pz();
+          ComputePairMasses(px[0],py[0],pz[0],massDau1);
+          for(Int_t iTr2=0; iTr2<nPions; iTr2++){
+            if(!IsPairInMassWindow(iTr2)) continue;
+            Double_t chargePi1=fPairCharge[iTr2];
+            px[1] = fPairPx[iTr2];
+            py[1] = fPairPy[iTr2];
+            pz[1] = fPairPz[iTr2];
+            if(chargePi1*chargeK<0) FillMEHistos(pdgOfD,nProngs,tmpRD2,px,py,pz,pdg2pr);
+            else if(chargePi1*chargeK>0) FillMEHistosLS(pdgOfD,nProngs,tmpRD2,px,py,pz,pdg2pr,(Int_t)chargePi1);
+          }
+        }
+        delete parray2;
+        continue;
+      }
       for(Int_t iTr1=0; iTr1<nKaons; iTr1++){
         TLorentzVector* trK=(TLorentzVector*)karray1->At(iTr1);
         Double_t chargeK=trK->T();
@@ -2339,6 +2399,83 @@ void AliAnalysisTaskCombinHF::DoMixingWithPools(Int_t poolIndex){
   delete tmpRD3;
 }
 //_________________________________________________________________
+void AliAnalysisTaskCombinHF::LoadPairingBuffer(TObjArray* tracks, Double_t mass){
+  /// copy the momenta of the tracks of an event (TLorentzVectors with charge in
+  /// the time component) into the flat arrays used by ComputePairMasses
+
+  Int_t nTracks=tracks->GetEntriesFast();
+  fPairPx.resize(nTracks);
+  fPairPy.resize(nTracks);
+  fPairPz.resize(nTracks);
+  fPairE.resize(nTracks);
+  fPairCharge.resize(nTracks);
+  fPairMass2.resize(nTracks);
+  Double_t mass2=mass*mass;
+  for(Int_t iTr=0; iTr<nTracks; iTr++){
+    TLorentzVector* tr=(TLorentzVector*)tracks->UncheckedAt(iTr);
+    fPairPx[iTr]=tr->Px();
+    fPairPy[iTr]=tr->Py();
+    fPairPz[iTr]=tr->Pz();
+    fPairCharge[iTr]=tr->T();
+    fPairE[iTr]=TMath::Sqrt(fPairPx[iTr]*fPairPx[iTr]+fPairPy[iTr]*fPairPy[iTr]+fPairPz[iTr]*fPairPz[iTr]+mass2);
+  }
+}
+//_________________________________________________________________
+void AliAnalysisTaskCombinHF::LoadPairingBuffer(AliAODEvent* aod, const UChar_t* status, Int_t pidBit, Double_t mass){
+  /// copy the momenta of the AOD tracks into the flat arrays used by ComputePairMasses,
+  /// indexed as the tracks of the event. Tracks not selected with pidBit get charge 0
+
+  Int_t nTracks=aod->GetNumberOfTracks();
+  fPairPx.assign(nTracks,0.);
+  fPairPy.assign(nTracks,0.);
+  fPairPz.assign(nTracks,0.);
+  fPairE.assign(nTracks,mass);
+  fPairCharge.assign(nTracks,0.);
+  fPairMass2.resize(nTracks);
+  Double_t mass2=mass*mass;
+  Double_t tmpp[3];
+  for(Int_t iTr=0; iTr<nTracks; iTr++){
+    if((status[iTr] & 1)==0 || (status[iTr] & pidBit)==0) continue;
+    AliAODTrack* tr=dynamic_cast<AliAODTrack*>(aod->GetTrack(iTr));
+    if(!tr) continue;
+    tr->GetPxPyPz(tmpp);
+    fPairPx[iTr]=tmpp[0];
+    fPairPy[iTr]=tmpp[1];
+    fPairPz[iTr]=tmpp[2];
+    fPairCharge[iTr]=tr->Charge();
+    fPairE[iTr]=TMath::Sqrt(tmpp[0]*tmpp[0]+tmpp[1]*tmpp[1]+tmpp[2]*tmpp[2]+mass2);
+  }
+}
+//_________________________________________________________________
+void AliAnalysisTaskCombinHF::ComputePairMasses(Double_t px, Double_t py, Double_t pz, Double_t mass){
+  /// invariant mass squared of the track (px,py,pz,mass) with all the tracks in the pairing buffer.
+  /// Plain loop over the flat arrays without branches, so that it can be vectorized by the compiler
+
+  Int_t nTracks=fPairE.size();
+  const Double_t* bpx=fPairPx.data();
+  const Double_t* bpy=fPairPy.data();
+  const Double_t* bpz=fPairPz.data();
+  const Double_t* be=fPairE.data();
+  Double_t* m2=fPairMass2.data();
+  Double_t e=TMath::Sqrt(px*px+py*py+pz*pz+mass*mass);
+  for(Int_t iTr=0; iTr<nTracks; iTr++){
+    Double_t sumPx=px+bpx[iTr];
+    Double_t sumPy=py+bpy[iTr];
+    Double_t sumPz=pz+bpz[iTr];
+    Double_t sumE=e+be[iTr];
+    m2[iTr]=sumE*sumE-sumPx*sumPx-sumPy*sumPy-sumPz*sumPz;
+  }
+}
+//_________________________________________________________________
+Bool_t AliAnalysisTaskCombinHF::IsPairInMassWindow(Int_t iPartner) const {
+  /// check on the mass computed by ComputePairMasses. The window is slightly enlarged to be safe
+  /// against rounding, the exact cut is applied when filling the histograms
+
+  const Double_t tol=1.e-6;
+  Double_t m2=fPairMass2[iPartner];
+  return m2>fMinMass*fMinMass*(1.-tol) && m2<fMaxMass*fMaxMass*(1.+tol);
+}
+//_________________________________________________________________
 void AliAnalysisTaskCombinHF::FinishTaskOutput()
 {
   /// perform mixed event analysis
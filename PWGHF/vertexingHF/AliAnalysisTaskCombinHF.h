@@ -17,11 +17,14 @@
 #include <TH3F.h>
 #include <TObjString.h>
 #include <THnSparse.h>
+#include <vector>
 #include "AliAnalysisTaskSE.h"
 #include "AliAODTrack.h"
 #include "AliNormalizationCounter.h"
 #include "AliRDHFCuts.h"
 
+class AliHFTrackIndex;
+
 class AliAnalysisTaskCombinHF : public AliAnalysisTaskSE
 {
 public:
@@ -70,6 +73,11 @@ public:
     if(fTrackCutsAll) delete fTrackCutsAll;
     fTrackCutsAll=new AliESDtrackCuts(*cuts);
   }
+  /// read the result of the track cuts from the AliHFTrackIndex attached to the event,
+  /// the selection (name of the AliESDtrackCuts in the index) should be equivalent to SetTrackCuts
+  void SetUseHFTrackIndex(const char* selection, const char* indexName="HFTrackIndex"){
+    fTrackIndexSelection=selection; fTrackIndexName=indexName;
+  }
   void SetPionTrackCuts(AliESDtrackCuts* cuts){
     if(fTrackCutsPion) delete fTrackCutsPion;
     fTrackCutsPion=new AliESDtrackCuts(*cuts);
@@ -136,7 +144,7 @@ public:
     fBayesThresProton=thresProton;
   }
   
-  Bool_t IsTrackSelected(AliAODTrack* track);
+  Bool_t IsTrackSelected(AliAODTrack* track, Int_t iTrack=-1);
   Bool_t IsKaon(AliAODTrack* track);
   Bool_t IsPion(AliAODTrack* track);
   Bool_t IsProton(AliAODTrack* track);
@@ -165,6 +173,10 @@ private:
   Double_t ComputeInvMassKK(TLorentzVector* tr1, TLorentzVector* tr2) const;
   Double_t CosPiKPhiRFrame(TLorentzVector* dauK1, TLorentzVector* dauK2, TLorentzVector* daupi) const;
   Double_t CosPiDsLabFrame(TLorentzVector* dauK1, TLorentzVector* dauK2, TLorentzVector* daupi) const;
+  void LoadPairingBuffer(TObjArray* tracks, Double_t mass);
+  void LoadPairingBuffer(AliAODEvent* aod, const UChar_t* status, Int_t pidBit, Double_t mass);
+  void ComputePairMasses(Double_t px, Double_t py, Double_t pz, Double_t mass);
+  Bool_t IsPairInMassWindow(Int_t iPartner) const;
 
   TList *fOutput;                       //!<! list with output histograms
   TList *fListCuts;                     //!<! list with cut values 
@@ -342,9 +354,19 @@ private:
   Double_t fMaxMultiplicity;       /// upper limit for multiplcities in MC histos
   TObjArray* fKaonTracks;          /// array of kaon-compatible tracks (TLorentzVectors)
   TObjArray* fPionTracks;          /// array of pion-compatible tracks (TLorentzVectors)
+  std::vector<Double_t> fPairPx;     //!<! px of the partner tracks in the pairing buffer
+  std::vector<Double_t> fPairPy;     //!<! py of the partner tracks in the pairing buffer
+  std::vector<Double_t> fPairPz;     //!<! pz of the partner tracks in the pairing buffer
+  std::vector<Double_t> fPairE;      //!<! energy of the partner tracks (mass of 2nd daughter)
+  std::vector<Double_t> fPairCharge; //!<! charge of the partner tracks (0 = not usable)
+  std::vector<Double_t> fPairMass2;  //!<! pair inv. mass squared computed by ComputePairMasses
+  TString fTrackIndexName;         /// name of the AliHFTrackIndex in the event (empty = not used)
+  TString fTrackIndexSelection;    /// name of the track selection in the AliHFTrackIndex
+  AliHFTrackIndex* fTrackIndex;      //!<! track index of the current event
+  Int_t fTrackIndexBit;              //!<! bit of the track selection in the index
     
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisTaskCombinHF,42); /// D0D+ task from AOD tracks
+  ClassDef(AliAnalysisTaskCombinHF,44); /// D0D+ task from AOD tracks
   /// \endcond
 };
 
@@ -101,7 +101,8 @@ AliAnalysisTaskSE(),
     fListBDTNtuple(0),
     fRemoveSoftPion(false),
     fEnableDownsamplqn(false),
-    fFracToKeepDownSamplqn(1.1)
+    fFracToKeepDownSamplqn(1.1),
+    fBDTsPerPtBin()
 {
     // Default constructor
     for (Int_t ih=0; ih<13; ih++) fBDT1Cut[ih] = -2;
@@ -161,7 +162,8 @@ AliAnalysisTaskSECharmHadronvnTMVA::AliAnalysisTaskSECharmHadronvnTMVA(const cha
     fEnableDownsamplqn(false),
     fListRDHFBDT(0),
     fListBDTNtuple(0),
-    fFracToKeepDownSamplqn(1.1)
+    fFracToKeepDownSamplqn(1.1),
+    fBDTsPerPtBin()
 {
     // standard constructor
     for (Int_t ih=0; ih<13; ih++) fBDT1Cut[ih] = -2;
@@ -1594,8 +1596,6 @@ int AliAnalysisTaskSECharmHadronvnTMVA::ProcessBDT(AliAODEvent *fAOD, AliAODReco
         // Data fill this
         Int_t thisptbin = fRDCuts->PtBin(tmp[0]);
         if(thisptbin<0) return 0;
-        Float_t *ptbin = fRDCuts->GetPtBinLimits();
-        TString ptstring = Form("_%.0f_%.0f",ptbin[thisptbin],ptbin[thisptbin+1]);
   //  printf("ptstring = _%.0f_%.0f\n",ptbin[thisptbin],ptbin[thisptbin+1]);
     Double_t bdt1resp1 = -3; Double_t bdt2resp1_0 = -3; Double_t bdt2resp1_1 = -3; Double_t bdt2resp1_2 = -3;
     Double_t bdt1resp = -3; Double_t bdt2resp_0 = -3; Double_t bdt2resp_1 = -3; Double_t bdt2resp_2 = -3;
@@ -1608,10 +1608,10 @@ int AliAnalysisTaskSECharmHadronvnTMVA::ProcessBDT(AliAODEvent *fAOD, AliAODReco
             BDTClsVar[5] = tmp[11]; BDTClsVar[6] = tmp[14]; BDTClsVar[7] = tmp[15]; BDTClsVar[8] = tmp[16]; BDTClsVar[9] = tmp[17];
             
             
-            AliRDHFBDT *thisbdt1   = (AliRDHFBDT*)fListRDHFBDT->FindObject(Form("_BDT1%s",ptstring.Data()));
-            AliRDHFBDT *thisbdt2ll = (AliRDHFBDT*)fListRDHFBDT->FindObject(Form("_BDT2%s_0",ptstring.Data()));
-            AliRDHFBDT *thisbdt2mm = (AliRDHFBDT*)fListRDHFBDT->FindObject(Form("_BDT2%s_1",ptstring.Data()));
-            AliRDHFBDT *thisbdt2hh = (AliRDHFBDT*)fListRDHFBDT->FindObject(Form("_BDT2%s_2",ptstring.Data()));
+            AliRDHFBDT *thisbdt1   = GetBDT(thisptbin,0);
+            AliRDHFBDT *thisbdt2ll = GetBDT(thisptbin,1);
+            AliRDHFBDT *thisbdt2mm = GetBDT(thisptbin,2);
+            AliRDHFBDT *thisbdt2hh = GetBDT(thisptbin,3);
 
               //  Float_t bdt1resp1; Float_t bdt2resp1;
             bdt1resp1 = thisbdt1->GetResponse(BDTClsVar);
@@ -1636,10 +1636,10 @@ int AliAnalysisTaskSECharmHadronvnTMVA::ProcessBDT(AliAODEvent *fAOD, AliAODReco
             BDTClsVar[5] = tmp[11]; BDTClsVar[6] = tmp[14]; BDTClsVar[7] = tmp[15]; BDTClsVar[8] = tmp[16]; BDTClsVar[9] = tmp[17];
 
         // Data application
-            AliRDHFBDT *thisbdt1 = (AliRDHFBDT*)fListRDHFBDT->FindObject(Form("_BDT1%s",ptstring.Data()));
-            AliRDHFBDT *thisbdt2ll = (AliRDHFBDT*)fListRDHFBDT->FindObject(Form("_BDT2%s_0",ptstring.Data()));
-            AliRDHFBDT *thisbdt2mm = (AliRDHFBDT*)fListRDHFBDT->FindObject(Form("_BDT2%s_1",ptstring.Data()));
-            AliRDHFBDT *thisbdt2hh = (AliRDHFBDT*)fListRDHFBDT->FindObject(Form("_BDT2%s_2",ptstring.Data()));
+            AliRDHFBDT *thisbdt1 = GetBDT(thisptbin,0);
+            AliRDHFBDT *thisbdt2ll = GetBDT(thisptbin,1);
+            AliRDHFBDT *thisbdt2mm = GetBDT(thisptbin,2);
+            AliRDHFBDT *thisbdt2hh = GetBDT(thisptbin,3);
             
           //  thisbdt2ll->Print();
             //   Float_t bdt1resp; Float_t bdt2resp;
@@ -1671,3 +1671,22 @@ int AliAnalysisTaskSECharmHadronvnTMVA::ProcessBDT(AliAODEvent *fAOD, AliAODReco
     
     
 }
+
+//________________________________________________________________________
+AliRDHFBDT* AliAnalysisTaskSECharmHadronvnTMVA::GetBDT(int ptbin, int iBDT)
+{
+    // BDTs are looked up by name only once per pt bin, the per-candidate path is a plain array access
+    const int nBDTsPerPtBin = 4;
+    if(!fListRDHFBDT || ptbin<0 || ptbin>=fRDCuts->GetNPtBins()) return nullptr;
+    if(fBDTsPerPtBin.empty()) {
+        fBDTsPerPtBin.resize(nBDTsPerPtBin*fRDCuts->GetNPtBins(), nullptr);
+        Float_t *ptbinlims = fRDCuts->GetPtBinLimits();
+        for(int iPt=0; iPt<fRDCuts->GetNPtBins(); iPt++) {
+            TString ptstring = Form("_%.0f_%.0f",ptbinlims[iPt],ptbinlims[iPt+1]);
+            fBDTsPerPtBin[nBDTsPerPtBin*iPt] = (AliRDHFBDT*)fListRDHFBDT->FindObject(Form("_BDT1%s",ptstring.Data()));
+            for(int iBDT2=0; iBDT2<nBDTsPerPtBin-1; iBDT2++)
+                fBDTsPerPtBin[nBDTsPerPtBin*iPt+iBDT2+1] = (AliRDHFBDT*)fListRDHFBDT->FindObject(Form("_BDT2%s_%d",ptstring.Data(),iBDT2));
+        }
+    }
+    return fBDTsPerPtBin[nBDTsPerPtBin*ptbin+iBDT];
+}
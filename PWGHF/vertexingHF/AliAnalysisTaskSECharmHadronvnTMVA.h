@@ -55,6 +55,7 @@ class AliAnalysisTaskSECharmHadronvnTMVA : public AliAnalysisTaskSE
     void SetNormMethod(int norm)                                      {fNormMethod = norm;}
     void SetOADBFileName(TString filename)                            {fOADBFileName = filename;}
     int ProcessBDT(AliAODEvent *fAOD, AliAODRecoDecayHF2Prong *dD0, int isSelected, AliAnalysisVertexingHF *vHF);
+    AliRDHFBDT* GetBDT(int ptbin, int iBDT);
 
     void SetFlowMethod(int meth)                                      {fFlowMethod = meth;}
     void SetEventPlaneDetector(int det)                               {fEvPlaneDet = det;}
@@ -163,9 +164,10 @@ class AliAnalysisTaskSECharmHadronvnTMVA : public AliAnalysisTaskSE
     TList            *fListBDTNtuple;       //!<!
     Double_t         fBDT1Cut[13];          ///
     Double_t         fBDT2Cut[13];            ///
+    std::vector<AliRDHFBDT*> fBDTsPerPtBin; //!<! BDTs of each pt bin, resolved once from fListRDHFBDT
 
 
-    ClassDef(AliAnalysisTaskSECharmHadronvnTMVA,6); // AliAnalysisTaskSE for the HF vn analysis
+    ClassDef(AliAnalysisTaskSECharmHadronvnTMVA,7); // AliAnalysisTaskSE for the HF vn analysis
 };
 
 #endif
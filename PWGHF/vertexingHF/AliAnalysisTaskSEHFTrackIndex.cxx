@@ -0,0 +1,139 @@
+/**************************************************************************
+ * Copyright(c) 1998-2009, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/* $Id$ */
+
+////////////////////////////////////////////////////////////
+// Fill of the HF track pre-selection index once per event,
+// shared by all the HF tasks of the train
+////////////////////////////////////////////////////////////
+
+#include <TObjArray.h>
+#include <TMath.h>
+
+#include "AliAnalysisManager.h"
+#include "AliInputEventHandler.h"
+#include "AliAODEvent.h"
+#include "AliESDtrackCuts.h"
+#include "AliPIDResponse.h"
+#include "AliHFTrackIndex.h"
+#include "AliAnalysisTaskSE.h"
+#include "AliAnalysisTaskSEHFTrackIndex.h"
+
+ClassImp(AliAnalysisTaskSEHFTrackIndex)
+
+
+//________________________________________________________________________
+AliAnalysisTaskSEHFTrackIndex::AliAnalysisTaskSEHFTrackIndex():
+  AliAnalysisTaskSE(),
+  fIndexName("HFTrackIndex"),
+  fTrackCuts(0x0),
+  fFillPID(kTRUE),
+  fTrackIndex(0x0)
+{
+  // Default constructor
+}
+//_______________________________________________________
+AliAnalysisTaskSEHFTrackIndex::AliAnalysisTaskSEHFTrackIndex(const char *name, const char *indexName):
+  AliAnalysisTaskSE(name),
+  fIndexName(indexName),
+  fTrackCuts(new TObjArray()),
+  fFillPID(kTRUE),
+  fTrackIndex(0x0)
+{
+  // Standard constructor
+  fTrackCuts->SetOwner();
+}
+//_______________________________________________________
+AliAnalysisTaskSEHFTrackIndex::~AliAnalysisTaskSEHFTrackIndex()
+{
+  // Destructor, the track index is owned by the input event
+  delete fTrackCuts;
+}
+//________________________________________________________________________
+Int_t AliAnalysisTaskSEHFTrackIndex::AddSelection(AliESDtrackCuts* cuts)
+{
+  // register a track cut set, returns its bit in the selection mask
+
+  if(!fTrackCuts || !cuts) return -1;
+  if(fTrackCuts->GetEntriesFast()>=32){
+    printf("AliAnalysisTaskSEHFTrackIndex::AddSelection: maximum number of track selections (32) reached\n");
+    return -1;
+  }
+  if(fTrackCuts->FindObject(cuts->GetName())){
+    printf("AliAnalysisTaskSEHFTrackIndex::AddSelection: track selection %s already registered\n",cuts->GetName());
+    return -1;
+  }
+  fTrackCuts->AddLast(cuts);
+  return fTrackCuts->GetEntriesFast()-1;
+}
+//________________________________________________________________________
+AliHFTrackIndex* AliAnalysisTaskSEHFTrackIndex::CreateTrackIndex() const
+{
+  // new track index with the registered track cuts, the bits follow the order of fTrackCuts
+
+  AliHFTrackIndex *index=new AliHFTrackIndex(fIndexName.Data());
+  for(Int_t i=0; i<fTrackCuts->GetEntriesFast(); i++) index->AddSelection((AliESDtrackCuts*)fTrackCuts->At(i));
+  return index;
+}
+//________________________________________________________
+void AliAnalysisTaskSEHFTrackIndex::UserCreateOutputObjects()
+{
+  // no output
+}
+//________________________________________________________________________
+void AliAnalysisTaskSEHFTrackIndex::UserExec(Option_t */*option*/)
+{
+  // fill the track index and attach it to the input event
+
+  AliAODEvent *aod = dynamic_cast<AliAODEvent*> (InputEvent());
+  if(!aod || !fTrackCuts){
+    printf("AliAnalysisTaskSEHFTrackIndex::UserExec: aod not found!\n");
+    return;
+  }
+  // the list of the input event may be rebuilt when a new file is opened:
+  // attach a new track index whenever ours is not in the event
+  TObject *inEvent=aod->FindListObject(fIndexName.Data());
+  if(!inEvent){
+    fTrackIndex=CreateTrackIndex();
+    aod->AddObject(fTrackIndex);
+  }else if(inEvent!=fTrackIndex){
+    printf("AliAnalysisTaskSEHFTrackIndex::UserExec: object %s already present in the event\n",fIndexName.Data());
+    fTrackIndex=0x0;
+    return;
+  }
+
+  AliPIDResponse *pidResp=0x0;
+  if(fFillPID){
+    AliInputEventHandler *inputHandler=(AliInputEventHandler*)((AliAnalysisManager::GetAnalysisManager())->GetInputEventHandler());
+    if(inputHandler) pidResp=inputHandler->GetPIDResponse();
+  }
+  fTrackIndex->SetPIDResponse(pidResp);
+
+  // the AODs with null vertex pointer didn't pass the PhysSel
+  if(!aod->GetPrimaryVertex() || TMath::Abs(aod->GetMagneticField())<0.001){
+    fTrackIndex->Reset();
+    return;
+  }
+  fTrackIndex->Fill(aod);
+
+  return;
+}
+//_________________________
+void AliAnalysisTaskSEHFTrackIndex::Terminate(Option_t */*option*/)
+{
+  // Terminate analysis
+  return;
+}
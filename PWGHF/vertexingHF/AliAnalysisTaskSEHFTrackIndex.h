@@ -0,0 +1,59 @@
+#ifndef ALIANALYSISTASKSEHFTRACKINDEX_H
+#define ALIANALYSISTASKSEHFTRACKINDEX_H
+
+/* Copyright(c) 1998-2009, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/* $Id$ */
+
+//*************************************************************************
+// Class AliAnalysisTaskSEHFTrackIndex
+// AliAnalysisTaskSE to fill once per event the AliHFTrackIndex with the
+// track pre-selection (track cut bits, PID n-sigmas, impact parameters)
+// and attach it to the input event, to be added to the train before the
+// HF analysis tasks. The tasks retrieve it with
+// AliHFTrackIndex::GetFromEvent(InputEvent(),name).
+//*************************************************************************
+
+#include "AliAnalysisTaskSE.h"
+
+class AliESDtrackCuts;
+class AliHFTrackIndex;
+
+
+class AliAnalysisTaskSEHFTrackIndex : public AliAnalysisTaskSE
+{
+ public:
+
+  AliAnalysisTaskSEHFTrackIndex();
+  AliAnalysisTaskSEHFTrackIndex(const char *name, const char *indexName="HFTrackIndex");
+  virtual ~AliAnalysisTaskSEHFTrackIndex();
+
+
+  // Implementation of interface methods
+  virtual void UserCreateOutputObjects();
+  virtual void UserExec(Option_t *option);
+  virtual void Terminate(Option_t *option);
+
+  /// the task takes ownership of the cuts, the selection is identified by the name of the cuts
+  Int_t AddSelection(AliESDtrackCuts* cuts);
+  void SetFillPID(Bool_t fill=kTRUE){fFillPID=fill;}
+  /// track index attached to the current input event (0x0 before the first event)
+  AliHFTrackIndex* GetTrackIndex() const {return fTrackIndex;}
+
+ private:
+
+  AliAnalysisTaskSEHFTrackIndex(const AliAnalysisTaskSEHFTrackIndex &source);
+  AliAnalysisTaskSEHFTrackIndex& operator=(const AliAnalysisTaskSEHFTrackIndex& source);
+
+  AliHFTrackIndex* CreateTrackIndex() const;
+
+  TString fIndexName;             // name of the track index in the input event
+  TObjArray* fTrackCuts;          // track cut sets, in the order of their bits
+  Bool_t fFillPID;                // compute the PID n-sigmas
+  AliHFTrackIndex* fTrackIndex;   //! track index attached to the input event (owned by the event)
+
+  ClassDef(AliAnalysisTaskSEHFTrackIndex,2); // AliAnalysisTaskSE to fill the HF track pre-selection index
+};
+
+#endif
@@ -0,0 +1,152 @@
+/**************************************************************************
+ * Copyright(c) 1998-2009, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/* $Id$ */
+
+////////////////////////////////////////////////////////////
+// Refill of the HF candidates of the delta AOD once per event,
+// shared by all the HF tasks of the train
+////////////////////////////////////////////////////////////
+
+#include <TClonesArray.h>
+
+#include "AliAnalysisManager.h"
+#include "AliAODHandler.h"
+#include "AliAODExtension.h"
+#include "AliAODEvent.h"
+#include "AliAODVertex.h"
+#include "AliAODRecoDecayHF2Prong.h"
+#include "AliAODRecoDecayHF3Prong.h"
+#include "AliAODRecoCascadeHF.h"
+#include "AliAnalysisVertexingHF.h"
+#include "AliAnalysisTaskSE.h"
+#include "AliAnalysisTaskSEPrefillVertexingHF.h"
+
+ClassImp(AliAnalysisTaskSEPrefillVertexingHF)
+
+
+//________________________________________________________________________
+AliAnalysisTaskSEPrefillVertexingHF::AliAnalysisTaskSEPrefillVertexingHF():
+  AliAnalysisTaskSE(),
+  fRefill2Prongs(kTRUE),
+  fRefill3Prongs(kTRUE),
+  fRefillDstar(kFALSE),
+  fRecoSecVtxDstar(kFALSE),
+  fRefillCascades(kFALSE),
+  fRecoSecVtxCascades(kFALSE)
+{
+  // Default constructor
+}
+//_______________________________________________________
+AliAnalysisTaskSEPrefillVertexingHF::AliAnalysisTaskSEPrefillVertexingHF(const char *name):
+  AliAnalysisTaskSE(name),
+  fRefill2Prongs(kTRUE),
+  fRefill3Prongs(kTRUE),
+  fRefillDstar(kFALSE),
+  fRecoSecVtxDstar(kFALSE),
+  fRefillCascades(kFALSE),
+  fRecoSecVtxCascades(kFALSE)
+{
+  // Standard constructor
+}
+//_______________________________________________________
+AliAnalysisTaskSEPrefillVertexingHF::~AliAnalysisTaskSEPrefillVertexingHF()
+{
+  // Destructor
+}
+//________________________________________________________
+void AliAnalysisTaskSEPrefillVertexingHF::UserCreateOutputObjects()
+{
+  // no output
+}
+//________________________________________________________________________
+TClonesArray* AliAnalysisTaskSEPrefillVertexingHF::GetCandidateArray(AliAODEvent *aod, const char* name) const
+{
+  // candidate branch from the AOD event or from the delta AOD extension
+
+  TClonesArray *array=0x0;
+  if(!dynamic_cast<AliAODEvent*>(InputEvent()) && AODEvent() && IsStandardAOD()) {
+    // In case there is an AOD handler writing a standard AOD, the braches
+    // of the deltaAOD (AliAOD.VertexingHF.root) are in the AliAODExtension
+    AliAODHandler* aodHandler = (AliAODHandler*)
+      ((AliAnalysisManager::GetAnalysisManager())->GetOutputEventHandler());
+    if(aodHandler->GetExtensions()) {
+      AliAODExtension *ext = (AliAODExtension*)aodHandler->GetExtensions()->FindObject("AliAOD.VertexingHF.root");
+      AliAODEvent *aodFromExt = ext->GetAOD();
+      array=(TClonesArray*)aodFromExt->GetList()->FindObject(name);
+    }
+  } else {
+    array=(TClonesArray*)aod->GetList()->FindObject(name);
+  }
+  return array;
+}
+//________________________________________________________________________
+void AliAnalysisTaskSEPrefillVertexingHF::UserExec(Option_t */*option*/)
+{
+  // refill the candidates which are not yet filled
+
+  AliAODEvent *aod = dynamic_cast<AliAODEvent*> (InputEvent());
+  if(!aod && AODEvent() && IsStandardAOD()) aod = dynamic_cast<AliAODEvent*> (AODEvent());
+  if(!aod){
+    printf("AliAnalysisTaskSEPrefillVertexingHF::UserExec: aod not found!\n");
+    return;
+  }
+  // the AODs with null vertex pointer didn't pass the PhysSel
+  if(!aod->GetPrimaryVertex() || TMath::Abs(aod->GetMagneticField())<0.001) return;
+
+  AliAnalysisVertexingHF *vHF=new AliAnalysisVertexingHF();
+
+  // D0toKpi
+  TClonesArray *arrayD0toKpi = fRefill2Prongs ? GetCandidateArray(aod,"D0toKpi") : 0x0;
+  if(arrayD0toKpi){
+    for(Int_t iD0toKpi=0; iD0toKpi<arrayD0toKpi->GetEntriesFast(); iD0toKpi++){
+      AliAODRecoDecayHF2Prong *d=(AliAODRecoDecayHF2Prong*)arrayD0toKpi->UncheckedAt(iD0toKpi);
+      if(d && d->GetIsFilled()==0) vHF->FillRecoCand(aod,d);
+    }
+  }
+  // 3Prong
+  TClonesArray *array3Prong = fRefill3Prongs ? GetCandidateArray(aod,"Charm3Prong") : 0x0;
+  if(array3Prong){
+    for(Int_t i3Prong=0; i3Prong<array3Prong->GetEntriesFast(); i3Prong++){
+      AliAODRecoDecayHF3Prong *d=(AliAODRecoDecayHF3Prong*)array3Prong->UncheckedAt(i3Prong);
+      if(d && d->GetIsFilled()==0) vHF->FillRecoCand(aod,d);
+    }
+  }
+  // DStar
+  TClonesArray *arrayDstar = fRefillDstar ? GetCandidateArray(aod,"Dstar") : 0x0;
+  if(arrayDstar){
+    for(Int_t iDstar=0; iDstar<arrayDstar->GetEntriesFast(); iDstar++){
+      AliAODRecoCascadeHF *d=(AliAODRecoCascadeHF*)arrayDstar->UncheckedAt(iDstar);
+      if(d && d->GetIsFilled()==0) vHF->FillRecoCasc(aod,d,kTRUE,fRecoSecVtxDstar);
+    }
+  }
+  // Cascades
+  TClonesArray *arrayCascade = fRefillCascades ? GetCandidateArray(aod,"CascadesHF") : 0x0;
+  if(arrayCascade){
+    for(Int_t iCasc=0; iCasc<arrayCascade->GetEntriesFast(); iCasc++){
+      AliAODRecoCascadeHF *d=(AliAODRecoCascadeHF*)arrayCascade->UncheckedAt(iCasc);
+      if(d && d->GetIsFilled()==0) vHF->FillRecoCasc(aod,d,kFALSE,fRecoSecVtxCascades);
+    }
+  }
+  delete vHF;
+
+  return;
+}
+//_________________________
+void AliAnalysisTaskSEPrefillVertexingHF::Terminate(Option_t */*option*/)
+{
+  // Terminate analysis
+  return;
+}
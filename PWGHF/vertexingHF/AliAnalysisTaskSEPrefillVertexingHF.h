@@ -0,0 +1,65 @@
+#ifndef ALIANALYSISTASKSEPREFILLVERTEXINGHF_H
+#define ALIANALYSISTASKSEPREFILLVERTEXINGHF_H
+
+/* Copyright(c) 1998-2009, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/* $Id$ */ 
+
+//*************************************************************************
+// Class AliAnalysisTaskSEPrefillVertexingHF
+// AliAnalysisTaskSE to refill once per event the HF candidates of the
+// delta AOD (secondary vertex and daughter momenta, see FillRecoCand),
+// to be added to the train before the HF analysis tasks.
+// The refilled candidates are flagged (IsFilled=2) in the shared
+// TClonesArrays so that the FillRecoCand calls of the following tasks
+// return immediately, the candidates for which the refilling failed are
+// flagged with AliAODRecoDecayHF::SetRefillFailed.
+// The vertices are deleted by AliAnalysisTaskSECleanupVertexingHF,
+// to be added at the end of the train.
+//*************************************************************************
+
+#include "AliAnalysisTaskSE.h"
+
+class TClonesArray;
+class AliAODEvent;
+
+
+class AliAnalysisTaskSEPrefillVertexingHF : public AliAnalysisTaskSE
+{
+ public:
+
+  AliAnalysisTaskSEPrefillVertexingHF();
+  AliAnalysisTaskSEPrefillVertexingHF(const char *name);
+  virtual ~AliAnalysisTaskSEPrefillVertexingHF();
+
+
+  // Implementation of interface methods
+  virtual void UserCreateOutputObjects();
+  virtual void UserExec(Option_t *option);
+  virtual void Terminate(Option_t *option);
+
+  void SetRefill2Prongs(Bool_t refill=kTRUE){fRefill2Prongs=refill;}
+  void SetRefill3Prongs(Bool_t refill=kTRUE){fRefill3Prongs=refill;}
+  /// the D* and cascade candidates are refilled only on request, since the
+  /// result depends on the recoSecVtx option of FillRecoCasc used by the task
+  void SetRefillDstar(Bool_t refill=kTRUE, Bool_t recoSecVtx=kFALSE){fRefillDstar=refill; fRecoSecVtxDstar=recoSecVtx;}
+  void SetRefillCascades(Bool_t refill=kTRUE, Bool_t recoSecVtx=kFALSE){fRefillCascades=refill; fRecoSecVtxCascades=recoSecVtx;}
+
+ private:
+
+  AliAnalysisTaskSEPrefillVertexingHF(const AliAnalysisTaskSEPrefillVertexingHF &source);
+  AliAnalysisTaskSEPrefillVertexingHF& operator=(const AliAnalysisTaskSEPrefillVertexingHF& source);
+  TClonesArray* GetCandidateArray(AliAODEvent *aod, const char* name) const;
+
+  Bool_t fRefill2Prongs;       // refill the D0toKpi candidates
+  Bool_t fRefill3Prongs;       // refill the Charm3Prong candidates
+  Bool_t fRefillDstar;         // refill the Dstar candidates
+  Bool_t fRecoSecVtxDstar;     // recoSecVtx option for the Dstar candidates
+  Bool_t fRefillCascades;      // refill the CascadesHF candidates
+  Bool_t fRecoSecVtxCascades;  // recoSecVtx option for the CascadesHF candidates
+
+  ClassDef(AliAnalysisTaskSEPrefillVertexingHF,1); // AliAnalysisTaskSE to refill the HF candidates once per event
+};
+
+#endif
@@ -397,7 +397,8 @@ AliAnalysisTaskSEXicZero2XiPifromKFP::AliAnalysisTaskSEXicZero2XiPifromKFP() :
   f2DHist_YvsPt_OmegaNotFromOmegac0_Rec(0),
   f2DHist_YvsPt_OmegaNotFromOmegac0_Gen(0),
   fWriteXic0Tree(kFALSE),
-  fWriteXic0MCGenTree(kFALSE)
+  fWriteXic0MCGenTree(kFALSE),
+  fUseKFParticleSIMD(kFALSE)
 {
     // default constructor, don't allocate memory here!
     // this is used by root for IO purposes, it needs to remain empty
@@ -717,7 +718,8 @@ AliAnalysisTaskSEXicZero2XiPifromKFP::AliAnalysisTaskSEXicZero2XiPifromKFP(const
   f2DHist_YvsPt_OmegaNotFromOmegac0_Rec(0),
   f2DHist_YvsPt_OmegaNotFromOmegac0_Gen(0),
   fWriteXic0Tree(kFALSE),
-  fWriteXic0MCGenTree(kFALSE)
+  fWriteXic0MCGenTree(kFALSE),
+  fUseKFParticleSIMD(kFALSE)
 {
     // constructor
     DefineInput(0, TChain::Class());    // define the input of the analysis: in this case we take a 'chain' of events
@@ -2879,18 +2881,29 @@ void AliAnalysisTaskSEXicZero2XiPifromKFP::MakeAnaXicZeroFromV0(AliAODEvent *AOD
               fHistMassXiMinus_M->Fill(kfpXiMinus_m.GetMass());
               if ( AliVertexingHFUtils::CheckKFParticleCov(kfpXiMinus_m) && TMath::Abs(kfpXiMinus_m.GetE())>TMath::Abs(kfpXiMinus_m.GetPz()) ) {
 
-              for (Int_t itrkBP=0; itrkBP<flag_trkP; itrkBP++) { // Loop for first bachelor pion+
+              // reconstruct the XicZero candidates of all the first bachelor pions+ at once
+              std::vector<Int_t> vBPIndex;
+              std::vector<KFParticle> vXicZeroDs[2];
+              for (Int_t itrkBP=0; itrkBP<flag_trkP; itrkBP++) {
                 if ( trackP[itrkBP]->GetID()==trkP->GetID() ) continue;
-
 //            if ( !fAnaCuts->SingleTrkCuts(trackP[itrkBP]) ) continue;
                 if ( !fAnaCuts->PassedTrackQualityCuts_PrimaryPion(trackP[itrkBP]) ) continue;
+                vBPIndex.push_back(itrkBP);
+                vXicZeroDs[0].push_back(AliVertexingHFUtils::CreateKFParticleFromAODtrack(trackP[itrkBP], 211));
+                vXicZeroDs[1].push_back(kfpXiMinus_m);
+              }
+              std::vector<KFParticle> vXic0;
+              AliVertexingHFUtils::ConstructKFParticles(NDaughters, vXicZeroDs, vXic0, fUseKFParticleSIMD);
+
+              for (UInt_t iBP=0; iBP<vBPIndex.size(); iBP++) { // Loop for first bachelor pion+
+                Int_t itrkBP = vBPIndex[iBP];
 
             // DCA of Cascade-bachelor to PV (cm)
 //            Double_t d0z0bach[2],covd0z0bach[3];
 //            if (!trackN[itrkPion2]->PropagateToDCA(fpVtx,fBzkG,kVeryBig,d0z0bach,covd0z0bach)) continue;
 //            if ( d0z0bach[0] <= fAnaCuts->GetProdDcaBachToPrimVertexMin() ) continue;
 
-                KFParticle kfpBP    = AliVertexingHFUtils::CreateKFParticleFromAODtrack(trackP[itrkBP], 211);
+                KFParticle &kfpBP   = vXicZeroDs[0][iBP];
 
                 // select primary pion tracks
                 /*
@@ -2907,10 +2920,8 @@ void AliAnalysisTaskSEXicZero2XiPifromKFP::MakeAnaXicZeroFromV0(AliAODEvent *AOD
 //              }
 //            }
 
-                // reconstruct XicZero
-                KFParticle kfpXic0;
-                const KFParticle *vXicZeroDs[2] = {&kfpBP, &kfpXiMinus_m};
-                kfpXic0.Construct(vXicZeroDs, NDaughters);
+                // XicZero reconstructed from {kfpBP, kfpXiMinus_m}
+                KFParticle &kfpXic0 = vXic0[iBP];
                 fHistProbXicZero->Fill(TMath::Prob(kfpXic0.GetChi2(), kfpXic0.GetNDF()));
 
 
@@ -3207,18 +3218,29 @@ void AliAnalysisTaskSEXicZero2XiPifromKFP::MakeAnaXicZeroFromV0(AliAODEvent *AOD
 //              kfpXiPlus_m.SetMassConstraint(massXi);
               fHistMassXiPlus_M->Fill(kfpXiPlus_m.GetMass());
               if ( AliVertexingHFUtils::CheckKFParticleCov(kfpXiPlus_m) && TMath::Abs(kfpXiPlus_m.GetE())>TMath::Abs(kfpXiPlus_m.GetPz()) ) {
-              for (Int_t itrkBP=0; itrkBP<flag_trkN; itrkBP++) { // Loop for first bachelor pion-
+              // reconstruct the Anti-XicZero candidates of all the first bachelor pions- at once
+              std::vector<Int_t> vBPIndex;
+              std::vector<KFParticle> vXicZeroDs[2];
+              for (Int_t itrkBP=0; itrkBP<flag_trkN; itrkBP++) {
                 if ( trackN[itrkBP]->GetID()==trkN->GetID() ) continue;
-
 //            if ( !fAnaCuts->SingleTrkCuts(trackN[itrkBP]) ) continue;
                 if ( !fAnaCuts->PassedTrackQualityCuts_PrimaryPion(trackN[itrkBP]) ) continue;
+                vBPIndex.push_back(itrkBP);
+                vXicZeroDs[0].push_back(AliVertexingHFUtils::CreateKFParticleFromAODtrack(trackN[itrkBP], -211));
+                vXicZeroDs[1].push_back(kfpXiPlus_m);
+              }
+              std::vector<KFParticle> vAntiXic0;
+              AliVertexingHFUtils::ConstructKFParticles(NDaughters, vXicZeroDs, vAntiXic0, fUseKFParticleSIMD);
+
+              for (UInt_t iBP=0; iBP<vBPIndex.size(); iBP++) { // Loop for first bachelor pion-
+                Int_t itrkBP = vBPIndex[iBP];
 
             // DCA of Cascade-bachelor to PV (cm)
 //            Double_t d0z0bach[2],covd0z0bach[3];
 //            if (!trackP[itrkPion2]->PropagateToDCA(fpVtx,fBzkG,kVeryBig,d0z0bach,covd0z0bach)) continue;
 //            if ( d0z0bach[0] <= fAnaCuts->GetProdDcaBachToPrimVertexMin() ) continue;
 
-                KFParticle kfpBP    = AliVertexingHFUtils::CreateKFParticleFromAODtrack(trackN[itrkBP], -211);
+                KFParticle &kfpBP   = vXicZeroDs[0][iBP];
 
                 // select primary pion tracks
                 /*
@@ -3235,10 +3257,8 @@ void AliAnalysisTaskSEXicZero2XiPifromKFP::MakeAnaXicZeroFromV0(AliAODEvent *AOD
 //              }
 //            }
 
-                // reconstruct Anti-XicZero
-                KFParticle kfpAntiXicZero;
-                const KFParticle *vXicZeroDs[2] = {&kfpBP, &kfpXiPlus_m};
-                kfpAntiXicZero.Construct(vXicZeroDs, NDaughters);
+                // Anti-XicZero reconstructed from {kfpBP, kfpXiPlus_m}
+                KFParticle &kfpAntiXicZero = vAntiXic0[iBP];
                 fHistProbAntiXicZero->Fill(TMath::Prob(kfpAntiXicZero.GetChi2(), kfpAntiXicZero.GetNDF()));
                 // check rapidity of Anti-XicZero
                 if ( TMath::Abs(kfpAntiXicZero.GetE())<=TMath::Abs(kfpAntiXicZero.GetPz()) ) continue;
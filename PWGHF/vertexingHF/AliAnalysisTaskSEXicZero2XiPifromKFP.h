@@ -76,6 +76,10 @@ class AliAnalysisTaskSEXicZero2XiPifromKFP : public AliAnalysisTaskSE
         void SetWriteXic0Tree(Bool_t a) {fWriteXic0Tree = a;}
         Bool_t GetWriteXic0Tree() const {return fWriteXic0Tree;}
 
+        /// fit the XicZero candidates with the same Xi in the SIMD lanes of KFParticleSIMD
+        void SetUseKFParticleSIMD(Bool_t a) {fUseKFParticleSIMD = a;}
+        Bool_t GetUseKFParticleSIMD() const {return fUseKFParticleSIMD;}
+
         void FillEventROOTObjects();
         void FillTreeGenXic0(AliAODMCParticle *mcpart, Int_t CheckOrigin, Double_t MLoverP);
         void FillTreeRecXic0FromV0(KFParticle kfpXicZero, AliAODTrack *trackPi, KFParticle kfpBP, KFParticle kfpXiMinus, KFParticle kfpXiMinus_m, AliAODTrack *trackPiFromXi, AliAODv0 *v0, KFParticle kfpK0Short, KFParticle kfpLambda, KFParticle kfpLambda_m, AliAODTrack *trkP, AliAODTrack *trkN, KFParticle PV, TClonesArray *mcArray, Int_t lab_Xic0);
@@ -407,11 +411,12 @@ class AliAnalysisTaskSEXicZero2XiPifromKFP : public AliAnalysisTaskSE
         THnSparseF*             fHistMCGen_PiXiMassvsPiPt_PionMinus; //!<! mcArray
         Bool_t                  fWriteXic0MCGenTree; ///< flag to decide whether to write the MC candidate variables on a tree variables
         Bool_t                  fWriteXic0Tree; ///< flag to decide whether to write XicZero tree
+        Bool_t                  fUseKFParticleSIMD; ///< flag to construct the XicZero candidates with KFParticleSIMD
 
         AliAnalysisTaskSEXicZero2XiPifromKFP(const AliAnalysisTaskSEXicZero2XiPifromKFP &source); // not implemented
         AliAnalysisTaskSEXicZero2XiPifromKFP& operator=(const AliAnalysisTaskSEXicZero2XiPifromKFP& source); // not implemented
 
-        ClassDef(AliAnalysisTaskSEXicZero2XiPifromKFP, 11);
+        ClassDef(AliAnalysisTaskSEXicZero2XiPifromKFP, 12);
 };
 
 #endif
@@ -139,6 +139,7 @@ fFindVertexForDstar(kTRUE),
 fFindVertexForCascades(kTRUE),
 fV0TypeForCascadeVertex(0),
 fMassCutBeforeVertexing(kFALSE),
+fPairPrefilterBeforeVertexing(kFALSE),
 fMassCalc2(0),
 fMassCalc3(0),
 fMassCalc4(0),
@@ -153,6 +154,10 @@ fOKInvMassD0to4p(kFALSE),
 fOKInvMassLctoV0(kFALSE),
 fnTrksTotal(0),
 fnSeleTrksTotal(0),
+fnPairsTotal(0),
+fnPairsPassMass(0),
+fnPairsPassDCA(0),
+fnPairVertices(0),
 fMakeReducedRHF(kFALSE),
 fUseTRefArrayForSecVert(kTRUE),
 fMassDzero(0.),
@@ -239,6 +244,7 @@ fFindVertexForDstar(source.fFindVertexForDstar),
 fFindVertexForCascades(source.fFindVertexForCascades),
 fV0TypeForCascadeVertex(source.fV0TypeForCascadeVertex),
 fMassCutBeforeVertexing(source.fMassCutBeforeVertexing),
+fPairPrefilterBeforeVertexing(source.fPairPrefilterBeforeVertexing),
 fMassCalc2(source.fMassCalc2),
 fMassCalc3(source.fMassCalc3),
 fMassCalc4(source.fMassCalc4),
@@ -253,6 +259,10 @@ fOKInvMassD0to4p(source.fOKInvMassD0to4p),
 fOKInvMassLctoV0(source.fOKInvMassLctoV0),
 fnTrksTotal(0),
 fnSeleTrksTotal(0),
+fnPairsTotal(0),
+fnPairsPassMass(0),
+fnPairsPassDCA(0),
+fnPairVertices(0),
 fMakeReducedRHF(kFALSE),
 fUseTRefArrayForSecVert(kTRUE),
 fMassDzero(source.fMassDzero),
@@ -338,6 +348,7 @@ AliAnalysisVertexingHF &AliAnalysisVertexingHF::operator=(const AliAnalysisVerte
   fFindVertexForCascades = source.fFindVertexForCascades;
   fV0TypeForCascadeVertex = source.fV0TypeForCascadeVertex;
   fMassCutBeforeVertexing = source.fMassCutBeforeVertexing;
+  fPairPrefilterBeforeVertexing = source.fPairPrefilterBeforeVertexing;
   fMassCalc2 = source.fMassCalc2;
   fMassCalc3 = source.fMassCalc3;
   fMassCalc4 = source.fMassCalc4;
@@ -631,6 +642,16 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
   AliDebug(1,Form(" Selected tracks: %d",nSeleTrks));
   fnSeleTrksTotal += nSeleTrks;
 
+  // momenta of the selected tracks at the primary vertex, for the mass cuts before vertexing
+  Double_t *pxAtVtx = new Double_t[trkEntries];
+  Double_t *pyAtVtx = new Double_t[trkEntries];
+  Double_t *pzAtVtx = new Double_t[trkEntries];
+  for(Int_t iTrk=0; iTrk<nSeleTrks; iTrk++) {
+    Double_t mom[3];
+    ((AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrk))->GetPxPyPz(mom);
+    pxAtVtx[iTrk]=mom[0]; pyAtVtx[iTrk]=mom[1]; pzAtVtx[iTrk]=mom[2];
+  }
+
 
   TObjArray *twoTrackArray1    = new TObjArray(2);
   TObjArray *twoTrackArray2    = new TObjArray(2);
@@ -663,7 +684,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
     Double_t minPtV0fromDp=fCutsDplustoK0spi->GetMinV0PtCut();
     if(minPtV0fromDp<minPtV0) minPtV0=minPtV0fromDp;
   }
-   
+
   // LOOP ON  POSITIVE  TRACKS
   for(iTrkP1=0; iTrkP1<nSeleTrks; iTrkP1++) {
 
@@ -856,49 +877,35 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
       // get track from tracks array
       negtrack1 = (AliESDtrack*)seleTrksArray.UncheckedAt(iTrkN1);
 
-      if(negtrack1->Charge()>0 && !fLikeSign) continue;
-
-      if(!TESTBIT(seleFlags[iTrkN1],kBitDispl)) continue;
-
-      if(fMixEvent) {
-	if(evtNumber[iTrkP1]==evtNumber[iTrkN1]) continue;
-      }
-
-      if(postrack1->Charge()==negtrack1->Charge()) { // like-sign
-	isLikeSign2Prong=kTRUE;
-	if(!fLikeSign)    continue;
-	if(iTrkN1<iTrkP1) continue; // this is needed to avoid double-counting of like-sign
-      } else { // unlike-sign
-	isLikeSign2Prong=kFALSE;
-	if(postrack1->Charge()<0 || negtrack1->Charge()>0) continue;  // this is needed to avoid double-counting of unlike-sign
-	if(fMixEvent) {
-	  if(evtNumber[iTrkP1]==evtNumber[iTrkN1]) continue;
-	}
-
-      }
-
-      // back to primary vertex
-      //      postrack1->PropagateToDCA(fV1,fBzkG,kVeryBig);
-      //      negtrack1->PropagateToDCA(fV1,fBzkG,kVeryBig);
-      SetParametersAtVertex(postrack1,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkP1));
-      SetParametersAtVertex(negtrack1,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkN1));
+      // charge, flags, 2 prong mass cuts before vertexing and DCA between the two tracks
+      Bool_t make2Prong=kFALSE,makeMoreProngs=kFALSE;
+      Int_t pairStage = SelectPair(iTrkP1,iTrkN1,seleTrksArray,tracksAtVertex,seleFlags,evtNumber,
+				   pxAtVtx,pyAtVtx,pzAtVtx,dcaMax,isLikeSign2Prong,make2Prong,makeMoreProngs,dcap1n1);
+      if(pairStage>kPairRejected) fnPairsTotal++;
+      if(pairStage>kPairFailMass && make2Prong) fnPairsPassMass++;
+      if(pairStage!=kPairSelected) { negtrack1=0; continue; }
+      fnPairsPassDCA++;
       negtrack1->GetPxPyPz(momneg1);
 
-      // DCA between the two tracks
-      dcap1n1 = postrack1->GetDCA(negtrack1,fBzkG,xdummy,ydummy);
-      if(dcap1n1>dcaMax) { negtrack1=0; continue; }
-
       // Vertexing
-      twoTrackArray1->AddAt(postrack1,0);
-      twoTrackArray1->AddAt(negtrack1,1);
-      AliAODVertex *vertexp1n1 = ReconstructSecondaryVertex(twoTrackArray1,dispersion,fUseTRefArrayForSecVert);
-      if(!vertexp1n1) {
-	twoTrackArray1->Clear();
-	negtrack1=0;
-	continue;
+      // with the pair prefilter, the vertex of a pair that is only used for 3 and 4 prongs
+      // is fitted when the first triplet passes its mass cut
+      AliAODVertex *vertexp1n1 = 0x0;
+      Bool_t pairVertexDone = kFALSE;
+      if(make2Prong || !fPairPrefilterBeforeVertexing) {
+	twoTrackArray1->AddAt(postrack1,0);
+	twoTrackArray1->AddAt(negtrack1,1);
+	vertexp1n1 = ReconstructSecondaryVertex(twoTrackArray1,dispersion,fUseTRefArrayForSecVert);
+	fnPairVertices++;
+	pairVertexDone = kTRUE;
+	if(!vertexp1n1) {
+	  twoTrackArray1->Clear();
+	  negtrack1=0;
+	  continue;
+	}
       }
       // 2 prong candidate
-      if(fD0toKpi || fJPSItoEle || fDstar || fLikeSign) {
+      if(make2Prong) {
 
 	io2Prong = Make2Prong(twoTrackArray1,event,vertexp1n1,dcap1n1,okD0,okJPSI,okD0fromDstar);
 
@@ -1058,8 +1065,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
       }
 
       twoTrackArray1->Clear();
-      if( (!f3Prong && !f4Prong) ||
-	  (isLikeSign2Prong && !f3Prong) ) {
+      if(!makeMoreProngs) {
 	negtrack1=0;
 	delete vertexp1n1;
 	continue;
@@ -1183,6 +1189,17 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	  }
 	}
 
+	// pair vertex, if not fitted yet
+	if(!pairVertexDone) {
+	  vertexp1n1 = ReconstructPairVertex(twoTrackArray1,postrack1,negtrack1,dispersion);
+	  pairVertexDone = kTRUE;
+	}
+	if(!vertexp1n1) {
+	  threeTrackArray->Clear();
+	  postrack2=0;
+	  break;
+	}
+
 	// Vertexing
 	twoTrackArray2->AddAt(postrack2,0);
 	twoTrackArray2->AddAt(negtrack1,1);
@@ -1444,6 +1461,17 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	  continue;
 	}
 
+	// pair vertex, if not fitted yet
+	if(f3Prong && !pairVertexDone) {
+	  vertexp1n1 = ReconstructPairVertex(twoTrackArray1,postrack1,negtrack1,dispersion);
+	  pairVertexDone = kTRUE;
+	}
+	if(f3Prong && !vertexp1n1) {
+	  threeTrackArray->Clear();
+	  negtrack2=0;
+	  break;
+	}
+
 	// Vertexing
 	twoTrackArray2->AddAt(postrack1,0);
 	twoTrackArray2->AddAt(negtrack2,1);
@@ -1548,6 +1576,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
   fourTrackArray->Delete();  delete fourTrackArray;
   delete [] seleFlags; seleFlags=NULL;
   if(evtNumber) {delete [] evtNumber; evtNumber=NULL;}
+  delete [] pxAtVtx; delete [] pyAtVtx; delete [] pzAtVtx;
   tracksAtVertex.Delete();
 
   if(fInputAOD) {
@@ -1709,13 +1738,16 @@ Bool_t AliAnalysisVertexingHF::FillRecoCand(AliVEvent *event,AliAODRecoDecayHF3P
   // save the TRefs to the candidate AliAODRecoDecayHF3Prong rd
   // and fill on-the-fly the data member of rd
   if(rd->GetIsFilled()!=0)return kTRUE;//if 0: reduced dAOD. skip if rd is already filled (1: standard dAOD, 2 already refilled)
+  if(rd->GetRefillFailed())return kFALSE;//already tried in this event by another task
   if(!fAODMap)MapAODtracks(event);//fill the AOD index map if it is not yet done
-  TObjArray *threeTrackArray   = new TObjArray(3);
 
   AliAODTrack *track1 =(AliAODTrack*)event->GetTrack(fAODMap[rd->GetProngID(0)]);//retrieve daughter from the trackID through the AOD index map
-  if(!track1)return kFALSE;
+  if(!track1){rd->SetRefillFailed(); return kFALSE;}
   AliAODTrack *track2 =(AliAODTrack*)event->GetTrack(fAODMap[rd->GetProngID(1)]);
-  if(!track2)return kFALSE;
+  if(!track2){rd->SetRefillFailed(); return kFALSE;}
+  AliAODTrack *track3 =(AliAODTrack*)event->GetTrack(fAODMap[rd->GetProngID(2)]);
+  if(!track3){rd->SetRefillFailed(); return kFALSE;}
+  TObjArray *threeTrackArray   = new TObjArray(3);
   AliESDtrack *postrack1 = 0;
   AliESDtrack *negtrack1 = 0;
   postrack1 = new AliESDtrack(track1);
@@ -1735,8 +1767,6 @@ Bool_t AliAnalysisVertexingHF::FillRecoCand(AliVEvent *event,AliAODRecoDecayHF3P
   fV1->GetCovMatrix(cov);
   if(!fVertexerTracks)fVertexerTracks=new AliVertexerTracks(fBzkG);
 
-  AliAODTrack *track3 =(AliAODTrack*)event->GetTrack(fAODMap[rd->GetProngID(2)]);
-  if(!track3)return kFALSE;
   AliESDtrack *esdt3 = new AliESDtrack(track3);
 
   Double_t dca2;
@@ -1756,6 +1786,7 @@ Bool_t AliAnalysisVertexingHF::FillRecoCand(AliVEvent *event,AliAODRecoDecayHF3P
     delete postrack1; postrack1=NULL;
     delete negtrack1; negtrack1=NULL;
     delete esdt3; esdt3=NULL;
+    rd->SetRefillFailed();
     return kFALSE;
   }
 
@@ -1779,15 +1810,16 @@ Bool_t AliAnalysisVertexingHF::FillRecoCand(AliVEvent *event,AliAODRecoDecayHF2P
   // save the TRefs to the candidate AliAODRecoDecayHF2Prong rd
   // and fill on-the-fly the data member of rd
   if(rd->GetIsFilled()!=0)return kTRUE;//if 0: reduced dAOD. skip if rd is already filled (1:standard dAOD, 2 already refilled)
+  if(rd->GetRefillFailed())return kFALSE;//already tried in this event by another task
   if(!fAODMap)MapAODtracks(event);//fill the AOD index map if it is not yet done
 
   Double_t dispersion;
-  TObjArray *twoTrackArray1    = new TObjArray(2);
 
   AliAODTrack *track1 =(AliAODTrack*)event->GetTrack(fAODMap[rd->GetProngID(0)]);//retrieve daughter from the trackID through the AOD index map
-  if(!track1)return kFALSE;
+  if(!track1){rd->SetRefillFailed(); return kFALSE;}
   AliAODTrack *track2 =(AliAODTrack*)event->GetTrack(fAODMap[rd->GetProngID(1)]);
-  if(!track2)return kFALSE;
+  if(!track2){rd->SetRefillFailed(); return kFALSE;}
+  TObjArray *twoTrackArray1    = new TObjArray(2);
 
   AliESDtrack *esdt1 = 0;
   AliESDtrack *esdt2 = 0;
@@ -1817,6 +1849,7 @@ Bool_t AliAnalysisVertexingHF::FillRecoCand(AliVEvent *event,AliAODRecoDecayHF2P
     delete fV1; fV1=0;
     delete esdt1; esdt1=NULL;
     delete esdt2; esdt2=NULL;
+    rd->SetRefillFailed();
     return kFALSE;     }
   Bool_t okD0=kFALSE;
   Bool_t okJPSI=kFALSE;
@@ -2941,6 +2974,8 @@ void AliAnalysisVertexingHF::PrintStatus() const {
   }
   if(fRecoPrimVtxSkippingTrks) printf("RecoPrimVtxSkippingTrks\n");
   if(fRmTrksFromPrimVtx) printf("RmTrksFromPrimVtx\n");
+  if(fMassCutBeforeVertexing) printf("Mass cuts of 3 and 4 prongs and cascades before vertexing\n");
+  if(fPairPrefilterBeforeVertexing) printf("Mass cuts of 2 prongs before vertexing, pair vertex for 3 and 4 prongs fitted when needed\n");
   if(fD0toKpi) {
     printf("Reconstruct D0->Kpi candidates with cuts:\n");
     if(fCutsD0toKpi) fCutsD0toKpi->PrintAll();
@@ -2985,39 +3020,140 @@ void AliAnalysisVertexingHF::PrintStatus() const {
   return;
 }
 //-----------------------------------------------------------------------------
+Int_t AliAnalysisVertexingHF::SelectPair(Int_t iTrkP1,Int_t iTrkN1,
+					 const TObjArray &seleTrksArray,const TObjArray &tracksAtVertex,
+					 const UChar_t *seleFlags,const Int_t *evtNumber,
+					 const Double_t *pxAtVtx,const Double_t *pyAtVtx,const Double_t *pzAtVtx,
+					 Double_t dcaMax,Bool_t &isLikeSign2Prong,
+					 Bool_t &make2Prong,Bool_t &makeMoreProngs,Double_t &dca)
+{
+  /// Selection of the pair of displaced tracks iTrkP1, iTrkN1 before the pair vertexing:
+  /// charges and flags, 2 prong mass cuts before vertexing (fPairPrefilterBeforeVertexing)
+  /// and DCA between the two tracks. The tracks are set back to their parameters
+  /// at the primary vertex. Returns the stage at which the pair was rejected,
+  /// or kPairSelected. make2Prong and makeMoreProngs tell whether the pair is used
+  /// for 2 prong candidates and for 3-4 prong candidates
+
+  make2Prong=kFALSE; makeMoreProngs=kFALSE;
+
+  AliESDtrack *postrack1 = (AliESDtrack*)seleTrksArray.UncheckedAt(iTrkP1);
+  AliESDtrack *negtrack1 = (AliESDtrack*)seleTrksArray.UncheckedAt(iTrkN1);
+
+  if(!TESTBIT(seleFlags[iTrkP1],kBitDispl)) return kPairRejected;
+  if(postrack1->Charge()<0 && !fLikeSign) return kPairRejected;
+
+  if(negtrack1->Charge()>0 && !fLikeSign) return kPairRejected;
+
+  if(!TESTBIT(seleFlags[iTrkN1],kBitDispl)) return kPairRejected;
+
+  if(fMixEvent) {
+    if(evtNumber[iTrkP1]==evtNumber[iTrkN1]) return kPairRejected;
+  }
+
+  if(postrack1->Charge()==negtrack1->Charge()) { // like-sign
+    isLikeSign2Prong=kTRUE;
+    if(!fLikeSign)    return kPairRejected;
+    if(iTrkN1<iTrkP1) return kPairRejected; // this is needed to avoid double-counting of like-sign
+  } else { // unlike-sign
+    isLikeSign2Prong=kFALSE;
+    if(postrack1->Charge()<0 || negtrack1->Charge()>0) return kPairRejected;  // this is needed to avoid double-counting of unlike-sign
+  }
+
+  // 2 prong mass cuts for all enabled species before vertexing, with momenta at the primary vertex
+  make2Prong = (fD0toKpi || fJPSItoEle || fDstar || fLikeSign);
+  makeMoreProngs = (f3Prong || f4Prong) && !(isLikeSign2Prong && !f3Prong);
+  if(make2Prong && fPairPrefilterBeforeVertexing) {
+    Double_t pxDau[2]={pxAtVtx[iTrkP1],pxAtVtx[iTrkN1]};
+    Double_t pyDau[2]={pyAtVtx[iTrkP1],pyAtVtx[iTrkN1]};
+    Double_t pzDau[2]={pzAtVtx[iTrkP1],pzAtVtx[iTrkN1]};
+    make2Prong = SelectInvMassAndPt2prong(pxDau,pyDau,pzDau);
+  }
+  if(!make2Prong && !makeMoreProngs) return kPairFailMass;
+
+  // back to primary vertex
+  //      postrack1->PropagateToDCA(fV1,fBzkG,kVeryBig);
+  //      negtrack1->PropagateToDCA(fV1,fBzkG,kVeryBig);
+  SetParametersAtVertex(postrack1,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkP1));
+  SetParametersAtVertex(negtrack1,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkN1));
+
+  // DCA between the two tracks
+  Double_t xdummy,ydummy;
+  dca = postrack1->GetDCA(negtrack1,fBzkG,xdummy,ydummy);
+  if(dca>dcaMax) return kPairFailDCA;
+
+  return kPairSelected;
+}
+//-----------------------------------------------------------------------------
+void AliAnalysisVertexingHF::PrintCandidateCounters() const {
+  /// Print the number of tracks and pairs at each stage of the candidate finding
+
+  printf("Tracks: total %d, selected %d\n",fnTrksTotal,fnSeleTrksTotal);
+  printf("Pairs: total %d, for 2 prongs %d, passing DCA cut %d, vertices fitted %d\n",
+	 fnPairsTotal,fnPairsPassMass,fnPairsPassDCA,fnPairVertices);
+
+  return;
+}
+//-----------------------------------------------------------------------------
+AliAODVertex* AliAnalysisVertexingHF::ReconstructPairVertex(TObjArray *twoTrackArray,
+							    AliESDtrack *postrack,AliESDtrack *negtrack,
+							    Double_t &dispersion)
+{
+  /// Secondary vertex of a pair of tracks which is only needed for
+  /// 3 and 4 prong candidates (pair prefilter before vertexing)
+
+  twoTrackArray->AddAt(postrack,0);
+  twoTrackArray->AddAt(negtrack,1);
+  AliAODVertex *vertex = ReconstructSecondaryVertex(twoTrackArray,dispersion,fUseTRefArrayForSecVert);
+  twoTrackArray->Clear();
+  fnPairVertices++;
+
+  return vertex;
+}
+//-----------------------------------------------------------------------------
 AliAODVertex* AliAnalysisVertexingHF::ReconstructSecondaryVertex(TObjArray *trkArray,
 								 Double_t &dispersion,Bool_t useTRefArray) const
 {
   /// Secondary vertex reconstruction with AliVertexerTracks or AliKFParticle
   //AliCodeTimerAuto("",0);
 
+  if(fSecVtxWithKF) AliKFParticle::SetField(fBzkG);
+  AliESDVertex *vertexESD = FitSecondaryVertex(trkArray,fVertexerTracks);
+  if(!vertexESD) return 0x0;
+
+  return ConvertToAODVertex(vertexESD,trkArray->GetEntriesFast(),dispersion,useTRefArray);
+}
+//-----------------------------------------------------------------------------
+AliESDVertex* AliAnalysisVertexingHF::FitSecondaryVertex(TObjArray *trkArray,
+							 AliVertexerTracks *vertexer) const
+{
+  /// Secondary vertex fit with the given AliVertexerTracks instance or AliKFParticle
+  /// (the KF field has to be set before). Does not modify the tracks nor the data members,
+  /// so that it can run concurrently with different vertexer instances.
+
   AliESDVertex *vertexESD = 0;
-  AliAODVertex *vertexAOD = 0;
 
   if(!fSecVtxWithKF) { // AliVertexerTracks
 
-    fVertexerTracks->SetVtxStart(fV1);
-    vertexESD = (AliESDVertex*)fVertexerTracks->VertexForSelectedESDTracks(trkArray);
+    vertexer->SetVtxStart(fV1);
+    vertexESD = (AliESDVertex*)vertexer->VertexForSelectedESDTracks(trkArray);
 
-    if(!vertexESD) return vertexAOD;
+    if(!vertexESD) return vertexESD;
 
     if(vertexESD->GetNContributors()!=trkArray->GetEntriesFast()) {
       //AliDebug(2,"vertexing failed");
       delete vertexESD; vertexESD=NULL;
-      return vertexAOD;
+      return vertexESD;
     }
 
     Double_t vertRadius2=vertexESD->GetX()*vertexESD->GetX()+vertexESD->GetY()*vertexESD->GetY();
     if(vertRadius2>8.){
       // vertex outside beam pipe, reject candidate to avoid propagation through material
       delete vertexESD; vertexESD=NULL;
-      return vertexAOD;
+      return vertexESD;
     }
 
   } else { // Kalman Filter vertexer (AliKFParticle)
 
-    AliKFParticle::SetField(fBzkG);
-
     AliKFVertex vertexKF;
 
     Int_t nTrks = trkArray->GetEntriesFast();
@@ -3033,15 +3169,22 @@ AliAODVertex* AliAnalysisVertexingHF::ReconstructSecondaryVertex(TObjArray *trkA
 
   }
 
-  // convert to AliAODVertex
+  return vertexESD;
+}
+//-----------------------------------------------------------------------------
+AliAODVertex* AliAnalysisVertexingHF::ConvertToAODVertex(AliESDVertex *vertexESD,Int_t nTrks,
+							 Double_t &dispersion,Bool_t useTRefArray) const
+{
+  /// Convert the fitted secondary vertex to AliAODVertex, the ESD vertex is deleted
+
   Double_t pos[3],cov[6],chi2perNDF;
   vertexESD->GetXYZ(pos); // position
   vertexESD->GetCovMatrix(cov); //covariance matrix
   chi2perNDF = vertexESD->GetChi2toNDF();
   dispersion = vertexESD->GetDispersion();
   delete vertexESD; vertexESD=NULL;
-  Int_t nprongs= (useTRefArray ? 0 : trkArray->GetEntriesFast());
-  vertexAOD = new AliAODVertex(pos,cov,chi2perNDF,0x0,-1,AliAODVertex::kUndef,nprongs);
+  Int_t nprongs= (useTRefArray ? 0 : nTrks);
+  AliAODVertex *vertexAOD = new AliAODVertex(pos,cov,chi2perNDF,0x0,-1,AliAODVertex::kUndef,nprongs);
 
   return vertexAOD;
 }
@@ -3117,6 +3260,18 @@ Bool_t AliAnalysisVertexingHF::SelectInvMassAndPtCascade(TObjArray *trkArray){
   return retval;
 }
 //-----------------------------------------------------------------------------
+Bool_t AliAnalysisVertexingHF::SelectInvMassAndPt2prong(Double_t *px,
+							Double_t *py,
+							Double_t *pz){
+  /// Check invariant mass cut and pt candidate cut for all enabled 2 prong species,
+  /// same as done in Make2Prong
+
+  if(fD0toKpi   && SelectInvMassAndPtD0Kpi(px,py,pz))     return kTRUE;
+  if(fJPSItoEle && SelectInvMassAndPtJpsiee(px,py,pz))    return kTRUE;
+  if(fDstar     && SelectInvMassAndPtDstarD0pi(px,py,pz)) return kTRUE;
+  return kFALSE;
+}
+//-----------------------------------------------------------------------------
 Bool_t AliAnalysisVertexingHF::SelectInvMassAndPtD0Kpi(Double_t *px,
 						       Double_t *py,
 						       Double_t *pz){
@@ -73,6 +73,7 @@ class AliAnalysisVertexingHF : public TNamed {
   Bool_t FillRecoCasc(AliVEvent *event,AliAODRecoCascadeHF *rc,Bool_t isDStar,Bool_t recoSecVtx=kFALSE);
   Bool_t RecoSecondaryVertexForCascades(AliVEvent *event, AliAODRecoCascadeHF *rc);
   void PrintStatus() const;
+  void PrintCandidateCounters() const;
   void SetSecVtxWithKF() { fSecVtxWithKF=kTRUE; }
   void SetD0toKpiOn() { fD0toKpi=kTRUE; }
   void SetD0toKpiOff() { fD0toKpi=kFALSE; }
@@ -180,6 +181,7 @@ class AliAnalysisVertexingHF : public TNamed {
   void SetCutsDStartoKpipi(AliRDHFCutsDStartoKpipi* cuts) { fCutsDStartoKpipi = cuts; }
   AliRDHFCutsDStartoKpipi* GetCutsDStartoKpipi() const { return fCutsDStartoKpipi; }
   void SetMassCutBeforeVertexing(Bool_t flag) { fMassCutBeforeVertexing=flag; }
+  void SetPairPrefilterBeforeVertexing(Bool_t flag) { fPairPrefilterBeforeVertexing=flag; }
 
   void SetMasses();
   Bool_t CheckCutsConsistency();
@@ -250,6 +252,7 @@ class AliAnalysisVertexingHF : public TNamed {
   //
  private:
   //
+  enum { kPairRejected = 0, kPairFailMass = 1, kPairFailDCA = 2, kPairSelected = 3 };
   enum { kBitDispl = 0, kBitSoftPi = 1, kBit3Prong = 2, kBitPionCompat = 3, kBitKaonCompat = 4, kBitProtonCompat = 5, kBitBachelor = 6};
 
   Bool_t fInputAOD; /// input from AOD (kTRUE) or ESD (kFALSE)
@@ -329,6 +332,7 @@ class AliAnalysisVertexingHF : public TNamed {
   Bool_t fFindVertexForCascades;  /// reconstruct a secondary vertex or assume it's from the primary vertex
   Int_t  fV0TypeForCascadeVertex;  /// Select which V0 type we want to use for the cascas
   Bool_t fMassCutBeforeVertexing; /// to go faster in PbPb
+  Bool_t fPairPrefilterBeforeVertexing; /// apply the 2 prong mass cuts before the pair vertexing and fit the pair vertex for 3/4 prongs only when needed
   // dummies for invariant mass calculation
   AliAODRecoDecay *fMassCalc2; /// for 2 prong
   AliAODRecoDecay *fMassCalc3; /// for 3 prong
@@ -345,6 +349,10 @@ class AliAnalysisVertexingHF : public TNamed {
 
   Int_t  fnTrksTotal;
   Int_t  fnSeleTrksTotal;
+  Int_t  fnPairsTotal;      /// pairs of displaced tracks considered
+  Int_t  fnPairsPassMass;   /// pairs considered for a 2 prong candidate
+  Int_t  fnPairsPassDCA;    /// pairs passing the DCA cut
+  Int_t  fnPairVertices;    /// pair vertices fitted
   Bool_t fMakeReducedRHF;// switch the reduction of dAOD size on/off
   Bool_t fUseTRefArrayForSecVert;// flag to control the usage of TRefArray
 
@@ -403,6 +411,17 @@ class AliAnalysisVertexingHF : public TNamed {
   void MapAODtracks(AliVEvent *aod);
   AliAODVertex* PrimaryVertex(const TObjArray *trkArray=0x0,AliVEvent *event=0x0) const;
   AliAODVertex* ReconstructSecondaryVertex(TObjArray *trkArray,Double_t &dispersion,Bool_t useTRefArray=kTRUE) const;
+  AliESDVertex* FitSecondaryVertex(TObjArray *trkArray,AliVertexerTracks *vertexer) const;
+  AliAODVertex* ConvertToAODVertex(AliESDVertex *vertexESD,Int_t nTrks,Double_t &dispersion,Bool_t useTRefArray) const;
+  Int_t SelectPair(Int_t iTrkP1,Int_t iTrkN1,
+		   const TObjArray &seleTrksArray,const TObjArray &tracksAtVertex,
+		   const UChar_t *seleFlags,const Int_t *evtNumber,
+		   const Double_t *pxAtVtx,const Double_t *pyAtVtx,const Double_t *pzAtVtx,
+		   Double_t dcaMax,Bool_t &isLikeSign2Prong,
+		   Bool_t &make2Prong,Bool_t &makeMoreProngs,Double_t &dca);
+  AliAODVertex* ReconstructPairVertex(TObjArray *twoTrackArray,AliESDtrack *postrack,AliESDtrack *negtrack,Double_t &dispersion);
+
+  Bool_t SelectInvMassAndPt2prong(Double_t *px,Double_t *py,Double_t *pz);
 
   Bool_t SelectInvMassAndPt3prong(Double_t *px,Double_t *py,Double_t *pz, Int_t pidLcStatus=3);
   Bool_t SelectInvMassAndPt4prong(Double_t *px,Double_t *py,Double_t *pz);
@@ -431,7 +450,7 @@ class AliAnalysisVertexingHF : public TNamed {
 				  TObjArray *twoTrackArrayV0);
 
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisVertexingHF,31);  // Reconstruction of HF decay candidates
+  ClassDef(AliAnalysisVertexingHF,34);  // Reconstruction of HF decay candidates
   /// \endcond
 };
 
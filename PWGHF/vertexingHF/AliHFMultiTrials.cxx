@@ -22,6 +22,9 @@
 #include <TF1.h>
 #include <TLatex.h>
 #include <TFile.h>
+#include <TVectorD.h>
+#include <ROOT/TSeq.hxx>
+#include <ROOT/TProcessExecutor.hxx>
 #include "AliHFMassFitter.h"
 #include "AliHFMassFitterVAR.h"
 #include "AliHFMultiTrials.h"
@@ -91,7 +94,8 @@ AliHFMultiTrials::AliHFMultiTrials() :
   fMinYieldGlob(0),
   fMaxYieldGlob(0),
   fMassFitters(),
-  fAcceptValidFit(kFALSE)
+  fAcceptValidFit(kFALSE),
+  fNumOfParallelFits(1)
 {
   // constructor
   Int_t rebinStep[4]={3,4,5,6};
@@ -195,7 +199,6 @@ Bool_t AliHFMultiTrials::DoMultiTrials(TH1D* hInvMassHisto, TPad* thePad){
   if(!hOK) return kFALSE;
 
   Int_t itrial=0;
-  Int_t types=0;
   Int_t itrialBC=0;
   Int_t totTrials=fNumOfRebinSteps*fNumOfFirstBinSteps*fNumOfLowLimFitSteps*fNumOfUpLimFitSteps;
 
@@ -203,12 +206,16 @@ Bool_t AliHFMultiTrials::DoMultiTrials(TH1D* hInvMassHisto, TPad* thePad){
   fMaxYieldGlob=0.;
   Float_t xnt[15];
 
+  // build the grid of trials and the rebinned histograms
+  std::vector<TH1F*> rebinnedHistos;
+  std::vector<TrialConf> trials;
   for(Int_t ir=0; ir<fNumOfRebinSteps; ir++){
     Int_t rebin=fRebinSteps[ir];
     for(Int_t iFirstBin=1; iFirstBin<=fNumOfFirstBinSteps; iFirstBin++) {
       TH1F* hRebinned=0x0;
       if(fNumOfFirstBinSteps==1) hRebinned=RebinHisto(hInvMassHisto,rebin,-1);
       else hRebinned=RebinHisto(hInvMassHisto,rebin,iFirstBin);
+      rebinnedHistos.push_back(hRebinned);
       for(Int_t iMinMass=0; iMinMass<fNumOfLowLimFitSteps; iMinMass++){
         Double_t minMassForFit=fLowLimFitSteps[iMinMass];
         Double_t hmin=TMath::Max(minMassForFit,hRebinned->GetBinLowEdge(2));
@@ -232,219 +239,290 @@ Bool_t AliHFMultiTrials::DoMultiTrials(TH1D* hInvMassHisto, TPad* thePad){
               if (igs==kFreeSigFreeMean  && !fUseFreeS) continue;
               if (igs==kFixSigFreeMean  && !fUseFixSigFreeMean) continue;
               if (igs==kFixSigFixMean   && !fUseFixSigFixMean) continue;
-              Int_t theCase=igs*kNBkgFuncCases+typeb;
-              Int_t globBin=itrial+theCase*totTrials;
-              for(Int_t j=0; j<15; j++) xnt[j]=0.;
-
-              Bool_t mustDeleteFitter = kTRUE;
-              AliHFMassFitterVAR*  fitter=0x0;
-              //if D0 Reflection
-              if(fhTemplRefl){
-                fitter=new AliHFMassFitterVAR(hRebinned,hmin,hmax,1,typeb,2);
-                fitter->SetTemplateReflections(fhTemplRefl);
-                fitter->SetFixReflOverS(fFixRefloS,kTRUE);
-              }
-              else {
-                if(typeb<=kPol2Bkg){
-                  fitter=new AliHFMassFitterVAR(hRebinned,hmin, hmax,1,typeb,types);
-                }else if(typeb==kPowBkg){
-                  fitter=new AliHFMassFitterVAR(hRebinned,hmin, hmax,1,4,types);
-                }else if(typeb==kPowTimesExpoBkg){
-                  fitter=new AliHFMassFitterVAR(hRebinned,hmin, hmax,1,5,types);
-                }else{
-                  fitter=new AliHFMassFitterVAR(hRebinned,hmin, hmax,1,6,types);
-                  if(typeb==kPol3Bkg) fitter->SetBackHighPolDegree(3);
-                  if(typeb==kPol4Bkg) fitter->SetBackHighPolDegree(4);
-                  if(typeb==kPol5Bkg) fitter->SetBackHighPolDegree(5);
-                }
-                fitter->SetReflectionSigmaFactor(0);
-              }
-              if(fFitOption==0) {
-                fitter->SetUseLikelihoodFit();
-                Printf("Using likelihood fit");
-              }
-              else if(fFitOption==1) {
-                fitter->SetUseChi2Fit();
-                Printf("Using chi2 fit");
-              }
-              else if (fFitOption==2) {
-                fitter->SetUseLikelihoodWithWeightsFit();
-                Printf("Using likelihood fit with weights");
-              }
-              fitter->SetInitialGaussianMean(fMassD);
-              fitter->SetInitialGaussianSigma(fSigmaGausMC);
-              xnt[0]=rebin;
-              xnt[1]=iFirstBin;
-              xnt[2]=minMassForFit;
-              xnt[3]=maxMassForFit;
-              xnt[4]=typeb;
-              xnt[6]=0;
-              if(igs==kFixSigFreeMean){
-                fitter->SetFixGaussianSigma(fSigmaGausMC,kTRUE);
-                xnt[5]=1;
-              }else if(igs==kFixSigUpFreeMean){
-                fitter->SetFixGaussianSigma(fSigmaGausMC*(1.+fSigmaMCVariation),kTRUE);
-                xnt[5]=2;
-              }else if(igs==kFixSigDownFreeMean){
-                fitter->SetFixGaussianSigma(fSigmaGausMC*(1.-fSigmaMCVariation),kTRUE);
-                xnt[5]=3;
-              }else if(igs==kFreeSigFreeMean){
-                xnt[5]=0;
-              }else if(igs==kFixSigFixMean){
-                fitter->SetFixGaussianSigma(fSigmaGausMC,kTRUE);
-                fitter->SetFixGaussianMean(fMassD,kTRUE);
-                xnt[5]=1;
-                xnt[6]=1;
-              }else if(igs==kFreeSigFixMean){
-                fitter->SetFixGaussianMean(fMassD,kTRUE);
-                xnt[5]=0;
-                xnt[6]=1;
-              }
-              if(fAcceptValidFit) fitter->SetAcceptValidFit();
-              Bool_t out=kFALSE;
-              Double_t chisq=-1.;
-              Double_t sigma=0.;
-              Double_t esigma=0.;
-              Double_t pos=.0;
-              Double_t epos=.0;
-              Double_t ry=.0;
-              Double_t ery=.0;
-              Double_t significance=0.;
-              Double_t erSignif=0.;
-              Double_t bkg=0.;
-              Double_t erbkg=0.;
-              Double_t bkgBEdge=0;
-              Double_t erbkgBEdge=0;
-              TF1* fB1=0x0;
-              if(typeb<kNBkgFuncCases){
-                printf("****** START FIT OF HISTO %s WITH REBIN %d FIRST BIN %d MASS RANGE %f-%f BACKGROUND FIT FUNCTION=%d CONFIG SIGMA/MEAN=%d\n",hInvMassHisto->GetName(),rebin,iFirstBin,minMassForFit,maxMassForFit,typeb,igs);
-                out=fitter->MassFitter(0);
-                chisq=fitter->GetReducedChiSquare();
-                fitter->Significance(fnSigmaForBkgEval,significance,erSignif);
-                sigma=fitter->GetSigma();
-                pos=fitter->GetMean();
-                esigma=fitter->GetSigmaUncertainty();
-                if(esigma<0.00001) esigma=0.0001;
-                epos=fitter->GetMeanUncertainty();
-                if(epos<0.00001) epos=0.0001;
-                ry=fitter->GetRawYield();
-                ery=fitter->GetRawYieldError();
-                fB1=fitter->GetBackgroundFullRangeFunc();
-                fitter->Background(fnSigmaForBkgEval,bkg,erbkg);
-                Double_t minval = hInvMassHisto->GetXaxis()->GetBinLowEdge(hInvMassHisto->FindBin(pos-fnSigmaForBkgEval*sigma));
-                Double_t maxval = hInvMassHisto->GetXaxis()->GetBinUpEdge(hInvMassHisto->FindBin(pos+fnSigmaForBkgEval*sigma));
-                fitter->Background(minval,maxval,bkgBEdge,erbkgBEdge);
-                if(out && fDrawIndividualFits && thePad){
-                  thePad->Clear();
-                  fitter->DrawHere(thePad, fnSigmaForBkgEval);
-                  fMassFitters.push_back(fitter);
-                  mustDeleteFitter = kFALSE;
-                  for (auto format : fInvMassFitSaveAsFormats) {
-                    thePad->SaveAs(Form("FitOutput_%s_Trial%d.%s",hInvMassHisto->GetName(),globBin, format.c_str()));
-                  }
-                }
-              }
-              // else{
-              //   out=DoFitWithPol3Bkg(hRebinned,hmin,hmax,igs);
-              //   if(out && thePad){
-              // 	thePad->Clear();
-              // 	hRebinned->Draw();
-              // 	TF1* fSB=(TF1*)hRebinned->GetListOfFunctions()->FindObject("fSB");
-              // 	fB1=new TF1("fB1","[0]+[1]*x+[2]*x*x+[3]*x*x*x",hmin,hmax);
-              // 	for(Int_t j=0; j<4; j++) fB1->SetParameter(j,fSB->GetParameter(3+j));
-              // 	fB1->SetLineColor(2);
-              // 	fB1->Draw("same");
-              // 	fSB->SetLineColor(4);
-              // 	fSB->Draw("same");
-              // 	thePad->Update();
-              // 	chisq=fSB->GetChisquare()/fSB->GetNDF();;
-              // 	sigma=fSB->GetParameter(2);
-              // 	esigma=fSB->GetParError(2);
-              // 	if(esigma<0.00001) esigma=0.0001;
-              // 	pos=fSB->GetParameter(1);
-              // 	epos=fSB->GetParError(1);
-              // 	if(epos<0.00001) epos=0.0001;
-              // 	ry=fSB->GetParameter(0)/hRebinned->GetBinWidth(1);
-              // 	ery=fSB->GetParError(0)/hRebinned->GetBinWidth(1);
-              //   }
-              // }
-              xnt[7]=chisq;
-              if(out && chisq>0. && sigma>0.5*fSigmaGausMC && sigma<2.0*fSigmaGausMC){
-                xnt[8]=significance;
-                xnt[9]=pos;
-                xnt[10]=epos;
-                xnt[11]=sigma;
-                xnt[12]=esigma;
-                xnt[13]=ry;
-                xnt[14]=ery;
-                fHistoRawYieldDistAll->Fill(ry);
-                fHistoRawYieldTrialAll->SetBinContent(globBin,ry);
-                fHistoRawYieldTrialAll->SetBinError(globBin,ery);
-                fHistoSigmaTrialAll->SetBinContent(globBin,sigma);
-                fHistoSigmaTrialAll->SetBinError(globBin,esigma);
-                fHistoMeanTrialAll->SetBinContent(globBin,pos);
-                fHistoMeanTrialAll->SetBinError(globBin,epos);
-                fHistoChi2TrialAll->SetBinContent(globBin,chisq);
-                fHistoChi2TrialAll->SetBinError(globBin,0.00001);
-                fHistoSignifTrialAll->SetBinContent(globBin,significance);
-                fHistoSignifTrialAll->SetBinError(globBin,erSignif);
-                if(fSaveBkgVal) {
-                  fHistoBkgTrialAll->SetBinContent(globBin,bkg);
-                  fHistoBkgTrialAll->SetBinError(globBin,erbkg);
-                  fHistoBkgInBinEdgesTrialAll->SetBinContent(globBin,bkgBEdge);
-                  fHistoBkgInBinEdgesTrialAll->SetBinError(globBin,erbkgBEdge);
-                }
-
-                if(ry<fMinYieldGlob) fMinYieldGlob=ry;
-                if(ry>fMaxYieldGlob) fMaxYieldGlob=ry;
-                fHistoRawYieldDist[theCase]->Fill(ry);
-                fHistoRawYieldTrial[theCase]->SetBinContent(itrial,ry);
-                fHistoRawYieldTrial[theCase]->SetBinError(itrial,ery);
-                fHistoSigmaTrial[theCase]->SetBinContent(itrial,sigma);
-                fHistoSigmaTrial[theCase]->SetBinError(itrial,esigma);
-                fHistoMeanTrial[theCase]->SetBinContent(itrial,pos);
-                fHistoMeanTrial[theCase]->SetBinError(itrial,epos);
-                fHistoChi2Trial[theCase]->SetBinContent(itrial,chisq);
-                fHistoChi2Trial[theCase]->SetBinError(itrial,0.00001);
-                fHistoSignifTrial[theCase]->SetBinContent(itrial,significance);
-                fHistoSignifTrial[theCase]->SetBinError(itrial,erSignif);
-                if(fSaveBkgVal) {
-                  fHistoBkgTrial[theCase]->SetBinContent(itrial,bkg);
-                  fHistoBkgTrial[theCase]->SetBinError(itrial,erbkg);
-                  fHistoBkgInBinEdgesTrial[theCase]->SetBinContent(itrial,bkgBEdge);
-                  fHistoBkgInBinEdgesTrial[theCase]->SetBinError(itrial,erbkgBEdge);
-                }
-
-                for(Int_t iStepBC=0; iStepBC<fNumOfnSigmaBinCSteps; iStepBC++){
-                  Double_t minMassBC=fMassD-fnSigmaBinCSteps[iStepBC]*sigma;
-                  Double_t maxMassBC=fMassD+fnSigmaBinCSteps[iStepBC]*sigma;
-                  if(minMassBC>minMassForFit &&
-                      maxMassBC<maxMassForFit &&
-                      minMassBC>(hRebinned->GetXaxis()->GetXmin()) &&
-                      maxMassBC<(hRebinned->GetXaxis()->GetXmax())){
-                    Double_t cnts,ecnts;
-                    BinCount(hRebinned,fB1,1,minMassBC,maxMassBC,cnts,ecnts);
-                    ++itrialBC;
-                    fHistoRawYieldDistBinCAll->Fill(cnts);
-                    fHistoRawYieldTrialBinCAll->SetBinContent(globBin,iStepBC+1,cnts);
-                    fHistoRawYieldTrialBinCAll->SetBinError(globBin,iStepBC+1,ecnts);
-                    fHistoRawYieldTrialBinC[theCase]->SetBinContent(itrial,iStepBC+1,cnts);
-                    fHistoRawYieldTrialBinC[theCase]->SetBinError(itrial,iStepBC+1,ecnts);
-                    fHistoRawYieldDistBinC[theCase]->Fill(cnts);
-                  }
-                }
-              }
-              if (mustDeleteFitter) delete fitter;
-              fNtupleMultiTrials->Fill(xnt);
+              TrialConf conf;
+              conf.fHisto=rebinnedHistos.size()-1;
+              conf.fRebin=rebin;
+              conf.fFirstBin=iFirstBin;
+              conf.fMinMass=minMassForFit;
+              conf.fMaxMass=maxMassForFit;
+              conf.fHmin=hmin;
+              conf.fHmax=hmax;
+              conf.fTypeb=typeb;
+              conf.fIgs=igs;
+              conf.fTrial=itrial;
+              conf.fCase=igs*kNBkgFuncCases+typeb;
+              conf.fGlobBin=itrial+conf.fCase*totTrials;
+              trials.push_back(conf);
             }
           }
         }
       }
-      delete hRebinned;
     }
   }
+
+  Int_t nResults=kNTrialResults+3*fNumOfnSigmaBinCSteps;
+  if(fNumOfParallelFits>1 && trials.size()>1){
+    // independent fits in forked worker processes, since the mass fitters use
+    // the global TMinuit and the global list of functions; results gathered in the order of the grid
+    if(fDrawIndividualFits && thePad) Printf("AliHFMultiTrials: individual fits are not drawn with parallel fits");
+    ROOT::TProcessExecutor pool(fNumOfParallelFits);
+    auto fitTrial = [&](UInt_t i) {
+      const TrialConf& conf=trials[i];
+      TVectorD* res=new TVectorD(nResults);
+      AliHFMassFitterVAR* fitter=CreateFitter(rebinnedHistos[conf.fHisto],conf);
+      FitTrial(fitter,hInvMassHisto,rebinnedHistos[conf.fHisto],conf,res->GetMatrixArray());
+      delete fitter;
+      return res;
+    };
+    std::vector<TVectorD*> results=pool.Map(fitTrial,ROOT::TSeqU(trials.size()));
+    for(UInt_t i=0; i<trials.size(); i++){
+      FillTrialResults(trials[i],results[i]->GetMatrixArray(),itrialBC,xnt);
+      delete results[i];
+    }
+  }else{
+    std::vector<Double_t> res(nResults);
+    for(UInt_t i=0; i<trials.size(); i++){
+      const TrialConf& conf=trials[i];
+      TH1F* hRebinned=rebinnedHistos[conf.fHisto];
+      AliHFMassFitterVAR* fitter=CreateFitter(hRebinned,conf);
+      Bool_t out=FitTrial(fitter,hInvMassHisto,hRebinned,conf,res.data());
+      Bool_t mustDeleteFitter = kTRUE;
+      if(out && fDrawIndividualFits && thePad){
+        thePad->Clear();
+        fitter->DrawHere(thePad, fnSigmaForBkgEval);
+        fMassFitters.push_back(fitter);
+        mustDeleteFitter = kFALSE;
+        for (auto format : fInvMassFitSaveAsFormats) {
+          thePad->SaveAs(Form("FitOutput_%s_Trial%d.%s",hInvMassHisto->GetName(),conf.fGlobBin, format.c_str()));
+        }
+      }
+      FillTrialResults(conf,res.data(),itrialBC,xnt);
+      if (mustDeleteFitter) delete fitter;
+    }
+  }
+
+  for(UInt_t i=0; i<rebinnedHistos.size(); i++) delete rebinnedHistos[i];
   return kTRUE;
 }
+//________________________________________________________________________
+AliHFMassFitterVAR* AliHFMultiTrials::CreateFitter(TH1F* hRebinned, const TrialConf& conf) const{
+  // fitter for the trial conf
+  Int_t types=0;
+  Int_t typeb=conf.fTypeb;
+  Int_t igs=conf.fIgs;
+  AliHFMassFitterVAR*  fitter=0x0;
+  //if D0 Reflection
+  if(fhTemplRefl){
+    fitter=new AliHFMassFitterVAR(hRebinned,conf.fHmin,conf.fHmax,1,typeb,2);
+    fitter->SetTemplateReflections(fhTemplRefl);
+    fitter->SetFixReflOverS(fFixRefloS,kTRUE);
+  }
+  else {
+    if(typeb<=kPol2Bkg){
+      fitter=new AliHFMassFitterVAR(hRebinned,conf.fHmin,conf.fHmax,1,typeb,types);
+    }else if(typeb==kPowBkg){
+      fitter=new AliHFMassFitterVAR(hRebinned,conf.fHmin,conf.fHmax,1,4,types);
+    }else if(typeb==kPowTimesExpoBkg){
+      fitter=new AliHFMassFitterVAR(hRebinned,conf.fHmin,conf.fHmax,1,5,types);
+    }else{
+      fitter=new AliHFMassFitterVAR(hRebinned,conf.fHmin,conf.fHmax,1,6,types);
+      if(typeb==kPol3Bkg) fitter->SetBackHighPolDegree(3);
+      if(typeb==kPol4Bkg) fitter->SetBackHighPolDegree(4);
+      if(typeb==kPol5Bkg) fitter->SetBackHighPolDegree(5);
+    }
+    fitter->SetReflectionSigmaFactor(0);
+  }
+  if(fFitOption==0) {
+    fitter->SetUseLikelihoodFit();
+    Printf("Using likelihood fit");
+  }
+  else if(fFitOption==1) {
+    fitter->SetUseChi2Fit();
+    Printf("Using chi2 fit");
+  }
+  else if (fFitOption==2) {
+    fitter->SetUseLikelihoodWithWeightsFit();
+    Printf("Using likelihood fit with weights");
+  }
+  fitter->SetInitialGaussianMean(fMassD);
+  fitter->SetInitialGaussianSigma(fSigmaGausMC);
+  if(igs==kFixSigFreeMean){
+    fitter->SetFixGaussianSigma(fSigmaGausMC,kTRUE);
+  }else if(igs==kFixSigUpFreeMean){
+    fitter->SetFixGaussianSigma(fSigmaGausMC*(1.+fSigmaMCVariation),kTRUE);
+  }else if(igs==kFixSigDownFreeMean){
+    fitter->SetFixGaussianSigma(fSigmaGausMC*(1.-fSigmaMCVariation),kTRUE);
+  }else if(igs==kFixSigFixMean){
+    fitter->SetFixGaussianSigma(fSigmaGausMC,kTRUE);
+    fitter->SetFixGaussianMean(fMassD,kTRUE);
+  }else if(igs==kFreeSigFixMean){
+    fitter->SetFixGaussianMean(fMassD,kTRUE);
+  }
+  if(fAcceptValidFit) fitter->SetAcceptValidFit();
+  return fitter;
+}
+//________________________________________________________________________
+Bool_t AliHFMultiTrials::FitTrial(AliHFMassFitterVAR* fitter, TH1D* hInvMassHisto, TH1F* hRebinned, const TrialConf& conf, Double_t* res) const{
+  // run the fit of the trial conf and store the results in res (ETrialResult,
+  // followed by flag, counts and error of each bin counting step)
+  for(Int_t j=0; j<kNTrialResults+3*fNumOfnSigmaBinCSteps; j++) res[j]=0.;
+  res[kTrialChi2]=-1.;
+  printf("****** START FIT OF HISTO %s WITH REBIN %d FIRST BIN %d MASS RANGE %f-%f BACKGROUND FIT FUNCTION=%d CONFIG SIGMA/MEAN=%d\n",hInvMassHisto->GetName(),conf.fRebin,conf.fFirstBin,conf.fMinMass,conf.fMaxMass,conf.fTypeb,conf.fIgs);
+  Bool_t out=fitter->MassFitter(0);
+  Double_t chisq=fitter->GetReducedChiSquare();
+  Double_t significance=0.,erSignif=0.;
+  fitter->Significance(fnSigmaForBkgEval,significance,erSignif);
+  Double_t sigma=fitter->GetSigma();
+  Double_t pos=fitter->GetMean();
+  Double_t esigma=fitter->GetSigmaUncertainty();
+  if(esigma<0.00001) esigma=0.0001;
+  Double_t epos=fitter->GetMeanUncertainty();
+  if(epos<0.00001) epos=0.0001;
+  Double_t bkg=0.,erbkg=0.;
+  fitter->Background(fnSigmaForBkgEval,bkg,erbkg);
+  Double_t minval = hInvMassHisto->GetXaxis()->GetBinLowEdge(hInvMassHisto->FindBin(pos-fnSigmaForBkgEval*sigma));
+  Double_t maxval = hInvMassHisto->GetXaxis()->GetBinUpEdge(hInvMassHisto->FindBin(pos+fnSigmaForBkgEval*sigma));
+  Double_t bkgBEdge=0.,erbkgBEdge=0.;
+  fitter->Background(minval,maxval,bkgBEdge,erbkgBEdge);
+  res[kTrialOut]=out;
+  res[kTrialChi2]=chisq;
+  res[kTrialSigma]=sigma;
+  res[kTrialESigma]=esigma;
+  res[kTrialMean]=pos;
+  res[kTrialEMean]=epos;
+  res[kTrialRawYield]=fitter->GetRawYield();
+  res[kTrialERawYield]=fitter->GetRawYieldError();
+  res[kTrialSignif]=significance;
+  res[kTrialESignif]=erSignif;
+  res[kTrialBkg]=bkg;
+  res[kTrialEBkg]=erbkg;
+  res[kTrialBkgBEdge]=bkgBEdge;
+  res[kTrialEBkgBEdge]=erbkgBEdge;
+
+  if(out && chisq>0. && sigma>0.5*fSigmaGausMC && sigma<2.0*fSigmaGausMC){
+    TF1* fB1=fitter->GetBackgroundFullRangeFunc();
+    for(Int_t iStepBC=0; iStepBC<fNumOfnSigmaBinCSteps; iStepBC++){
+      Double_t minMassBC=fMassD-fnSigmaBinCSteps[iStepBC]*sigma;
+      Double_t maxMassBC=fMassD+fnSigmaBinCSteps[iStepBC]*sigma;
+      if(minMassBC>conf.fMinMass &&
+          maxMassBC<conf.fMaxMass &&
+          minMassBC>(hRebinned->GetXaxis()->GetXmin()) &&
+          maxMassBC<(hRebinned->GetXaxis()->GetXmax())){
+        Double_t cnts,ecnts;
+        BinCount(hRebinned,fB1,1,minMassBC,maxMassBC,cnts,ecnts);
+        res[kNTrialResults+3*iStepBC]=1.;
+        res[kNTrialResults+3*iStepBC+1]=cnts;
+        res[kNTrialResults+3*iStepBC+2]=ecnts;
+      }
+    }
+  }
+  return out;
+}
+//________________________________________________________________________
+void AliHFMultiTrials::FillTrialResults(const TrialConf& conf, const Double_t* res, Int_t& itrialBC, Float_t* xnt){
+  // fill the output histograms and ntuple with the results of the trial conf
+  for(Int_t j=0; j<15; j++) xnt[j]=0.;
+  Int_t igs=conf.fIgs;
+  Int_t theCase=conf.fCase;
+  Int_t globBin=conf.fGlobBin;
+  Int_t itrial=conf.fTrial;
+  xnt[0]=conf.fRebin;
+  xnt[1]=conf.fFirstBin;
+  xnt[2]=conf.fMinMass;
+  xnt[3]=conf.fMaxMass;
+  xnt[4]=conf.fTypeb;
+  xnt[6]=0;
+  if(igs==kFixSigFreeMean){
+    xnt[5]=1;
+  }else if(igs==kFixSigUpFreeMean){
+    xnt[5]=2;
+  }else if(igs==kFixSigDownFreeMean){
+    xnt[5]=3;
+  }else if(igs==kFreeSigFreeMean){
+    xnt[5]=0;
+  }else if(igs==kFixSigFixMean){
+    xnt[5]=1;
+    xnt[6]=1;
+  }else if(igs==kFreeSigFixMean){
+    xnt[5]=0;
+    xnt[6]=1;
+  }
+  Bool_t out=(res[kTrialOut]>0.5);
+  Double_t chisq=res[kTrialChi2];
+  Double_t sigma=res[kTrialSigma];
+  Double_t esigma=res[kTrialESigma];
+  Double_t pos=res[kTrialMean];
+  Double_t epos=res[kTrialEMean];
+  Double_t ry=res[kTrialRawYield];
+  Double_t ery=res[kTrialERawYield];
+  Double_t significance=res[kTrialSignif];
+  Double_t erSignif=res[kTrialESignif];
+  Double_t bkg=res[kTrialBkg];
+  Double_t erbkg=res[kTrialEBkg];
+  Double_t bkgBEdge=res[kTrialBkgBEdge];
+  Double_t erbkgBEdge=res[kTrialEBkgBEdge];
+  xnt[7]=chisq;
+  if(out && chisq>0. && sigma>0.5*fSigmaGausMC && sigma<2.0*fSigmaGausMC){
+    xnt[8]=significance;
+    xnt[9]=pos;
+    xnt[10]=epos;
+    xnt[11]=sigma;
+    xnt[12]=esigma;
+    xnt[13]=ry;
+    xnt[14]=ery;
+    fHistoRawYieldDistAll->Fill(ry);
+    fHistoRawYieldTrialAll->SetBinContent(globBin,ry);
+    fHistoRawYieldTrialAll->SetBinError(globBin,ery);
+    fHistoSigmaTrialAll->SetBinContent(globBin,sigma);
+    fHistoSigmaTrialAll->SetBinError(globBin,esigma);
+    fHistoMeanTrialAll->SetBinContent(globBin,pos);
+    fHistoMeanTrialAll->SetBinError(globBin,epos);
+    fHistoChi2TrialAll->SetBinContent(globBin,chisq);
+    fHistoChi2TrialAll->SetBinError(globBin,0.00001);
+    fHistoSignifTrialAll->SetBinContent(globBin,significance);
+    fHistoSignifTrialAll->SetBinError(globBin,erSignif);
+    if(fSaveBkgVal) {
+      fHistoBkgTrialAll->SetBinContent(globBin,bkg);
+      fHistoBkgTrialAll->SetBinError(globBin,erbkg);
+      fHistoBkgInBinEdgesTrialAll->SetBinContent(globBin,bkgBEdge);
+      fHistoBkgInBinEdgesTrialAll->SetBinError(globBin,erbkgBEdge);
+    }
+
+    if(ry<fMinYieldGlob) fMinYieldGlob=ry;
+    if(ry>fMaxYieldGlob) fMaxYieldGlob=ry;
+    fHistoRawYieldDist[theCase]->Fill(ry);
+    fHistoRawYieldTrial[theCase]->SetBinContent(itrial,ry);
+    fHistoRawYieldTrial[theCase]->SetBinError(itrial,ery);
+    fHistoSigmaTrial[theCase]->SetBinContent(itrial,sigma);
+    fHistoSigmaTrial[theCase]->SetBinError(itrial,esigma);
+    fHistoMeanTrial[theCase]->SetBinContent(itrial,pos);
+    fHistoMeanTrial[theCase]->SetBinError(itrial,epos);
+    fHistoChi2Trial[theCase]->SetBinContent(itrial,chisq);
+    fHistoChi2Trial[theCase]->SetBinError(itrial,0.00001);
+    fHistoSignifTrial[theCase]->SetBinContent(itrial,significance);
+    fHistoSignifTrial[theCase]->SetBinError(itrial,erSignif);
+    if(fSaveBkgVal) {
+      fHistoBkgTrial[theCase]->SetBinContent(itrial,bkg);
+      fHistoBkgTrial[theCase]->SetBinError(itrial,erbkg);
+      fHistoBkgInBinEdgesTrial[theCase]->SetBinContent(itrial,bkgBEdge);
+      fHistoBkgInBinEdgesTrial[theCase]->SetBinError(itrial,erbkgBEdge);
+    }
+
+    for(Int_t iStepBC=0; iStepBC<fNumOfnSigmaBinCSteps; iStepBC++){
+      if(res[kNTrialResults+3*iStepBC]<0.5) continue;
+      Double_t cnts=res[kNTrialResults+3*iStepBC+1];
+      Double_t ecnts=res[kNTrialResults+3*iStepBC+2];
+      ++itrialBC;
+      fHistoRawYieldDistBinCAll->Fill(cnts);
+      fHistoRawYieldTrialBinCAll->SetBinContent(globBin,iStepBC+1,cnts);
+      fHistoRawYieldTrialBinCAll->SetBinError(globBin,iStepBC+1,ecnts);
+      fHistoRawYieldTrialBinC[theCase]->SetBinContent(itrial,iStepBC+1,cnts);
+      fHistoRawYieldTrialBinC[theCase]->SetBinError(itrial,iStepBC+1,ecnts);
+      fHistoRawYieldDistBinC[theCase]->Fill(cnts);
+    }
+  }
+  fNtupleMultiTrials->Fill(xnt);
+}
 
 //________________________________________________________________________
 void AliHFMultiTrials::SaveToRoot(TString fileName, TString option) const{
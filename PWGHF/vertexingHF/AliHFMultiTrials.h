@@ -86,6 +86,7 @@ class AliHFMultiTrials : public TNamed {
   void SetSaveBkgValue(Bool_t opt=kTRUE, Double_t nsigma=3) {fSaveBkgVal=opt; fnSigmaForBkgEval=nsigma;}
 
   void SetDrawIndividualFits(Bool_t opt=kTRUE){fDrawIndividualFits=opt;}
+  void SetNumOfParallelFits(Int_t nproc){fNumOfParallelFits=nproc;}
 
   Bool_t DoMultiTrials(TH1D* hInvMassHisto, TPad* thePad=0x0);
   void SaveToRoot(TString fileName, TString option="recreate") const;
@@ -101,10 +102,31 @@ class AliHFMultiTrials : public TNamed {
 
   enum EBkgFuncCases{ kExpoBkg, kLinBkg, kPol2Bkg, kPol3Bkg, kPol4Bkg, kPol5Bkg, kPowBkg, kPowTimesExpoBkg, kNBkgFuncCases };
   enum EFitParamCases{ kFixSigFreeMean, kFixSigUpFreeMean, kFixSigDownFreeMean, kFreeSigFreeMean, kFixSigFixMean, kFreeSigFixMean, kNFitConfCases};
+  enum ETrialResult{ kTrialOut, kTrialChi2, kTrialSigma, kTrialESigma, kTrialMean, kTrialEMean, kTrialRawYield, kTrialERawYield,
+                     kTrialSignif, kTrialESignif, kTrialBkg, kTrialEBkg, kTrialBkgBEdge, kTrialEBkgBEdge, kNTrialResults };
 
  private:
 
+  /// configuration of one trial of the grid
+  struct TrialConf {
+    Int_t fHisto;       /// index of the rebinned histogram
+    Int_t fRebin;       /// rebin
+    Int_t fFirstBin;    /// first bin used for rebin
+    Double_t fMinMass;  /// min. mass for fit
+    Double_t fMaxMass;  /// max. mass for fit
+    Double_t fHmin;     /// min. mass for fit within the histogram
+    Double_t fHmax;     /// max. mass for fit within the histogram
+    Int_t fTypeb;       /// background function (EBkgFuncCases)
+    Int_t fIgs;         /// sigma/mean configuration (EFitParamCases)
+    Int_t fTrial;       /// trial bin in the histograms of the case
+    Int_t fCase;        /// case (background function and sigma/mean configuration)
+    Int_t fGlobBin;     /// bin in the histograms of all trials
+  };
+
   Bool_t CreateHistos();
+  AliHFMassFitterVAR* CreateFitter(TH1F* hRebinned, const TrialConf& conf) const;
+  Bool_t FitTrial(AliHFMassFitterVAR* fitter, TH1D* hInvMassHisto, TH1F* hRebinned, const TrialConf& conf, Double_t* res) const;
+  void FillTrialResults(const TrialConf& conf, const Double_t* res, Int_t& itrialBC, Float_t* xnt);
   TH1F* RebinHisto(TH1D* hOrig, Int_t reb, Int_t firstUse) const;
   void BinCount(TH1F* h, TF1* fB, Int_t rebin, Double_t minMass, Double_t maxMass, Double_t& count, Double_t& ecount) const;
   Bool_t DoFitWithPol3Bkg(TH1F* histoToFit, Double_t  hmin, Double_t  hmax,
@@ -181,9 +203,10 @@ class AliHFMultiTrials : public TNamed {
 
   std::vector<AliHFMassFitterVAR*> fMassFitters; //!<! Mass fitters
   Bool_t fAcceptValidFit; /// accept fits proviing ROOT::Fit::FitResult::IsValid() true, neverteless the status code
+  Int_t fNumOfParallelFits; /// number of worker processes for the fits (1 = serial)
 
   /// \cond CLASSIMP
-  ClassDef(AliHFMultiTrials,6); /// class for multiple trials of invariant mass fit
+  ClassDef(AliHFMultiTrials,7); /// class for multiple trials of invariant mass fit
   /// \endcond
 };
 
@@ -0,0 +1,226 @@
+/**************************************************************************
+ * Copyright(c) 1998-2009, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/* $Id$ */
+
+/////////////////////////////////////////////////////////////
+///
+/// Per-event index of the track pre-selection (selection bits,
+/// PID n-sigmas, impact parameters, compact track parameters)
+/// shared by the HF tasks of a train
+///
+/////////////////////////////////////////////////////////////
+
+#include <TMath.h>
+
+#include "AliLog.h"
+#include "AliVEvent.h"
+#include "AliVHeader.h"
+#include "AliAODEvent.h"
+#include "AliAODTrack.h"
+#include "AliAODVertex.h"
+#include "AliESDtrackCuts.h"
+#include "AliPIDResponse.h"
+#include "AliExternalTrackParam.h"
+#include "AliHFTrackIndex.h"
+
+/// \cond CLASSIMP
+ClassImp(AliHFTrackIndex);
+/// \endcond
+
+const Float_t AliHFTrackIndex::kNoPID=-999.;
+const Float_t AliHFTrackIndex::kNoDCA=-999.;
+
+//________________________________________________________________________
+AliHFTrackIndex::AliHFTrackIndex():
+  TNamed("HFTrackIndex","HF track pre-selection"),
+  fSelections(),
+  fPIDResponse(0x0),
+  fNTracks(0),
+  fRunNumber(-1),
+  fEventId(0),
+  fEvent(0x0),
+  fSelMask(),
+  fNSigmaTPC(),
+  fNSigmaTOF(),
+  fDCA(),
+  fParam(),
+  fCov()
+{
+  /// Default constructor
+}
+//________________________________________________________________________
+AliHFTrackIndex::AliHFTrackIndex(const char* name):
+  TNamed(name,"HF track pre-selection"),
+  fSelections(),
+  fPIDResponse(0x0),
+  fNTracks(0),
+  fRunNumber(-1),
+  fEventId(0),
+  fEvent(0x0),
+  fSelMask(),
+  fNSigmaTPC(),
+  fNSigmaTOF(),
+  fDCA(),
+  fParam(),
+  fCov()
+{
+  /// Standard constructor
+}
+//________________________________________________________________________
+AliHFTrackIndex::~AliHFTrackIndex()
+{
+  /// Destructor, the track cuts are owned by the producer task
+}
+//________________________________________________________________________
+Int_t AliHFTrackIndex::AddSelection(AliESDtrackCuts* cuts)
+{
+  /// Register a track cut set, returns the bit used for it in the selection mask
+
+  if(!cuts) return -1;
+  if(GetNSelections()>=32){
+    AliError("Maximum number of track selections (32) reached");
+    return -1;
+  }
+  if(fSelections.FindObject(cuts->GetName())){
+    AliError(Form("Track selection %s already registered",cuts->GetName()));
+    return -1;
+  }
+  fSelections.AddLast(cuts);
+  return GetNSelections()-1;
+}
+//________________________________________________________________________
+Int_t AliHFTrackIndex::GetSelectionBit(const char* name) const
+{
+  /// Bit of the selection mask for the track cuts with the given name, -1 if not registered
+
+  TObject* cuts=fSelections.FindObject(name);
+  if(!cuts) return -1;
+  return fSelections.IndexOf(cuts);
+}
+//________________________________________________________________________
+void AliHFTrackIndex::Reset()
+{
+  /// Clear the per-event content, the allocated memory is kept
+
+  fNTracks=0;
+  fRunNumber=-1;
+  fEventId=0;
+  fEvent=0x0;
+  fSelMask.clear();
+  fNSigmaTPC.clear();
+  fNSigmaTOF.clear();
+  fDCA.clear();
+  fParam.clear();
+  fCov.clear();
+}
+//________________________________________________________________________
+Bool_t AliHFTrackIndex::IsFilledFor(const AliVEvent* ev) const
+{
+  /// Check that the index corresponds to the current event
+
+  if(!ev || ev!=fEvent) return kFALSE;
+  if(ev->GetRunNumber()!=fRunNumber || ev->GetNumberOfTracks()!=fNTracks) return kFALSE;
+  AliVHeader* header=ev->GetHeader();
+  if(header && header->GetEventIdAsLong()!=fEventId) return kFALSE;
+  return kTRUE;
+}
+//________________________________________________________________________
+void AliHFTrackIndex::Fill(AliAODEvent* aod)
+{
+  /// Evaluate the track selections, the PID n-sigmas and the impact parameters
+  /// of all the tracks of the event
+
+  Reset();
+  if(!aod) return;
+  fNTracks=aod->GetNumberOfTracks();
+  fRunNumber=aod->GetRunNumber();
+  AliVHeader* header=aod->GetHeader();
+  if(header) fEventId=header->GetEventIdAsLong();
+  fEvent=aod;
+
+  fSelMask.assign(fNTracks,0);
+  fNSigmaTPC.assign(fNTracks*kNSpecies,kNoPID);
+  fNSigmaTOF.assign(fNTracks*kNSpecies,kNoPID);
+  fDCA.assign(2*fNTracks,kNoDCA);
+  fParam.assign(kNParam*fNTracks,0.);
+  fCov.assign(kNCov*fNTracks,0.);
+
+  const AliVVertex* vtx=aod->GetPrimaryVertex();
+  Double_t magField=aod->GetMagneticField();
+  Int_t nSel=GetNSelections();
+  const AliPID::EParticleType species[kNSpecies]={AliPID::kPion,AliPID::kKaon,AliPID::kProton};
+  AliExternalTrackParam par;
+
+  for(Int_t iTrack=0; iTrack<fNTracks; iTrack++){
+    AliAODTrack* track=dynamic_cast<AliAODTrack*>(aod->GetTrack(iTrack));
+    if(!track) continue;
+
+    UInt_t mask=0;
+    for(Int_t iSel=0; iSel<nSel; iSel++){
+      AliESDtrackCuts* cuts=(AliESDtrackCuts*)fSelections.UncheckedAt(iSel);
+      if(cuts->IsSelected(track)) mask|=(1u<<iSel);
+    }
+    fSelMask[iTrack]=mask;
+
+    if(fPIDResponse){
+      Bool_t okTPC=(fPIDResponse->CheckPIDStatus(AliPIDResponse::kTPC,track)==AliPIDResponse::kDetPidOk);
+      Bool_t okTOF=(fPIDResponse->CheckPIDStatus(AliPIDResponse::kTOF,track)==AliPIDResponse::kDetPidOk);
+      for(Int_t iSp=0; iSp<kNSpecies; iSp++){
+        if(okTPC) fNSigmaTPC[iTrack*kNSpecies+iSp]=fPIDResponse->NumberOfSigmasTPC(track,species[iSp]);
+        if(okTOF) fNSigmaTOF[iTrack*kNSpecies+iSp]=fPIDResponse->NumberOfSigmasTOF(track,species[iSp]);
+      }
+    }
+
+    // track parameters as stored in the AOD, the propagation to the DCA is done on a copy
+    par.CopyFromVTrack(track);
+    Float_t* p=&fParam[kNParam*iTrack];
+    p[0]=par.GetX();
+    p[1]=par.GetAlpha();
+    const Double_t* param=par.GetParameter();
+    for(Int_t j=0; j<5; j++) p[2+j]=param[j];
+    const Double_t* cov=par.GetCovariance();
+    Float_t* c=&fCov[kNCov*iTrack];
+    for(Int_t j=0; j<kNCov; j++) c[j]=cov[j];
+
+    Double_t d0z0[2],covd0z0[3];
+    if(vtx && par.PropagateToDCA(vtx,magField,kVeryBig,d0z0,covd0z0)){
+      fDCA[2*iTrack]=d0z0[0];
+      fDCA[2*iTrack+1]=d0z0[1];
+    }
+  }
+}
+//________________________________________________________________________
+Bool_t AliHFTrackIndex::GetTrackParam(Int_t iTrack, AliExternalTrackParam& par) const
+{
+  /// Track parameters (at the AOD reference point) from the compact storage
+
+  if(iTrack<0 || iTrack>=fNTracks) return kFALSE;
+  const Float_t* p=&fParam[kNParam*iTrack];
+  const Float_t* c=&fCov[kNCov*iTrack];
+  Double_t param[5],cov[kNCov];
+  for(Int_t j=0; j<5; j++) param[j]=p[2+j];
+  for(Int_t j=0; j<kNCov; j++) cov[j]=c[j];
+  par.Set((Double_t)p[0],(Double_t)p[1],param,cov);
+  return kTRUE;
+}
+//________________________________________________________________________
+AliHFTrackIndex* AliHFTrackIndex::GetFromEvent(AliVEvent* ev, const char* name)
+{
+  /// Index attached to the event by AliAnalysisTaskSEHFTrackIndex, 0x0 if not present
+
+  if(!ev) return 0x0;
+  return dynamic_cast<AliHFTrackIndex*>(ev->FindListObject(name));
+}
@@ -0,0 +1,93 @@
+#ifndef ALIHFTRACKINDEX_H
+#define ALIHFTRACKINDEX_H
+
+/* Copyright(c) 1998-2009, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/* $Id$ */
+
+//*************************************************************************
+/// \class Class AliHFTrackIndex
+/// \brief Per-event index of the track pre-selection for the HF tasks
+///
+/// Filled once per event by AliAnalysisTaskSEHFTrackIndex and attached
+/// to the input event, so that the HF tasks of a train can read the
+/// result of the track selection instead of repeating it.
+/// For each AOD track (same index as in AliAODEvent::GetTrack) it stores
+///   - a bit mask with the result of each registered AliESDtrackCuts set
+///   - the TPC and TOF n-sigmas for the pion, kaon and proton hypotheses
+///     (kNoPID if the detector PID is not available)
+///   - the impact parameters in xy and z w.r.t. the primary vertex
+///   - the track parameters and covariance matrix in single precision
+/// The tasks should check IsFilledFor(event) before using the index.
+//*************************************************************************
+
+#include <vector>
+
+#include <TNamed.h>
+#include <TObjArray.h>
+
+class AliVEvent;
+class AliAODEvent;
+class AliESDtrackCuts;
+class AliPIDResponse;
+class AliExternalTrackParam;
+
+class AliHFTrackIndex : public TNamed
+{
+ public:
+
+  enum ESpecies {kPion, kKaon, kProton, kNSpecies};
+  static const Float_t kNoPID;       /// n-sigma value if the PID is not available
+  static const Float_t kNoDCA;       /// impact parameter value if the propagation fails
+
+  AliHFTrackIndex();
+  AliHFTrackIndex(const char* name);
+  virtual ~AliHFTrackIndex();
+
+  Int_t AddSelection(AliESDtrackCuts* cuts);
+  Int_t GetNSelections() const {return fSelections.GetEntriesFast();}
+  Int_t GetSelectionBit(const char* name) const;
+  void SetPIDResponse(AliPIDResponse* pid){fPIDResponse=pid;}
+
+  void Fill(AliAODEvent* aod);
+  void Reset();
+  Bool_t IsFilledFor(const AliVEvent* ev) const;
+
+  Int_t GetNTracks() const {return fNTracks;}
+  UInt_t GetSelectionMask(Int_t iTrack) const {return fSelMask[iTrack];}
+  Bool_t IsSelected(Int_t iTrack, Int_t bit) const {return (fSelMask[iTrack]>>bit)&1;}
+  Float_t GetNSigmaTPC(Int_t iTrack, Int_t species) const {return fNSigmaTPC[iTrack*kNSpecies+species];}
+  Float_t GetNSigmaTOF(Int_t iTrack, Int_t species) const {return fNSigmaTOF[iTrack*kNSpecies+species];}
+  Float_t GetDCAxy(Int_t iTrack) const {return fDCA[2*iTrack];}
+  Float_t GetDCAz(Int_t iTrack) const {return fDCA[2*iTrack+1];}
+  Bool_t GetTrackParam(Int_t iTrack, AliExternalTrackParam& par) const;
+
+  static AliHFTrackIndex* GetFromEvent(AliVEvent* ev, const char* name="HFTrackIndex");
+
+ private:
+
+  AliHFTrackIndex(const AliHFTrackIndex &source);
+  AliHFTrackIndex& operator=(const AliHFTrackIndex& source);
+
+  enum {kNParam=7, kNCov=15};  // x, alpha and the 5 track parameters; covariance matrix elements
+
+  TObjArray fSelections;          /// track cut sets, one bit each (not owned)
+  AliPIDResponse* fPIDResponse;   //! PID response for the n-sigmas
+  Int_t fNTracks;                 //! number of tracks in the current event
+  Int_t fRunNumber;               //! run of the current event
+  ULong64_t fEventId;             //! id of the current event (bunch crossing, orbit, period)
+  const AliVEvent* fEvent;        //! event for which the index was filled
+  std::vector<UInt_t> fSelMask;   //! track selection bits
+  std::vector<Float_t> fNSigmaTPC; //! TPC n-sigmas, kNSpecies per track
+  std::vector<Float_t> fNSigmaTOF; //! TOF n-sigmas, kNSpecies per track
+  std::vector<Float_t> fDCA;      //! impact parameters xy and z
+  std::vector<Float_t> fParam;    //! x, alpha and track parameters, kNParam per track
+  std::vector<Float_t> fCov;      //! covariance matrix, kNCov per track
+
+  /// \cond CLASSIMP
+  ClassDef(AliHFTrackIndex,1); /// per-event index of the HF track pre-selection
+  /// \endcond
+};
+
+#endif
@@ -37,6 +37,7 @@
 #include <TH2F.h>
 #include <TList.h>
 #include <TObjArray.h>
+#include <TObjString.h>
 #include <TString.h>
 #include <TCanvas.h>
 #include <AliPhysicsSelection.h>
@@ -46,6 +47,14 @@
 ClassImp(AliNormalizationCounter);
 /// \endcond
 
+// keywords of the "Event" rubric, in the order of AliNormalizationCounter::EEventType
+static const char* kEventTypeNames[AliNormalizationCounter::kNEventTypes]={
+  "triggered","V0AND","PileUp","PbPbC0SMH-B-NOPF-ALLNOTRD","Candles0.3","PrimaryV","countForNorm",
+  "noPrimaryV","zvtxGT10","!V0A&Candle03","!V0A&PrimaryV","Candid(Filter)","Candid(Analysis)",
+  "NCandid(Filter)","NCandid(Analysis)"
+};
+static const char* kEventRubric="triggered/V0AND/PileUp/PbPbC0SMH-B-NOPF-ALLNOTRD/Candles0.3/PrimaryV/countForNorm/noPrimaryV/zvtxGT10/!V0A&Candle03/!V0A&PrimaryV/Candid(Filter)/Candid(Analysis)/NCandid(Filter)/NCandid(Analysis)";
+
 //____________________________________________
 AliNormalizationCounter::AliNormalizationCounter(): 
 TNamed(),
@@ -61,7 +70,14 @@ fHistTrackFilterSpdMult(0),
 fHistTrackAnaSpdMult(0),
 fHistGenVertexZ(0),
 fHistGenVertexZRecoPV(0),
-fHistRecoVertexZ(0)
+fHistRecoVertexZ(0),
+fUseDenseCounters(kFALSE),
+fDenseRuns(),
+fDenseNMult(1),
+fDenseCounts(),
+fDenseLastRun(-1),
+fDenseLastRunIndex(-1),
+fDenseView(0x0)
 {
   // empty constructor
 }
@@ -81,7 +97,14 @@ fHistTrackFilterSpdMult(0),
 fHistTrackAnaSpdMult(0),
 fHistGenVertexZ(0),
 fHistGenVertexZRecoPV(0),
-fHistRecoVertexZ(0)
+fHistRecoVertexZ(0),
+fUseDenseCounters(kFALSE),
+fDenseRuns(),
+fDenseNMult(1),
+fDenseCounts(),
+fDenseLastRun(-1),
+fDenseLastRunIndex(-1),
+fDenseView(0x0)
 {
   ;
 }
@@ -109,17 +132,24 @@ AliNormalizationCounter::~AliNormalizationCounter()
   delete fHistGenVertexZ;
   delete fHistGenVertexZRecoPV;
   delete fHistRecoVertexZ;
+  delete fDenseView;
 }
 
 //______________________________________________
 void AliNormalizationCounter::Init()
 {
   //variables initialization
-  fCounters.AddRubric("Event","triggered/V0AND/PileUp/PbPbC0SMH-B-NOPF-ALLNOTRD/Candles0.3/PrimaryV/countForNorm/noPrimaryV/zvtxGT10/!V0A&Candle03/!V0A&PrimaryV/Candid(Filter)/Candid(Analysis)/NCandid(Filter)/NCandid(Analysis)");
-  if(fMultiplicity)  fCounters.AddRubric("Multiplicity", 5000);
-  if(fSpherocity)  fCounters.AddRubric("Spherocity", (Int_t)fSpherocitySteps+1);
-  fCounters.AddRubric("Run", 1000000);
-  fCounters.Init();
+  if(fUseDenseCounters && fSpherocity){
+    AliWarning("Spherocity not supported by the dense counters, the AliCounterCollection will be used");
+    fUseDenseCounters=kFALSE;
+  }
+  if(!fUseDenseCounters){
+    fCounters.AddRubric("Event",kEventRubric);
+    if(fMultiplicity)  fCounters.AddRubric("Multiplicity", 5000);
+    if(fSpherocity)  fCounters.AddRubric("Spherocity", (Int_t)fSpherocitySteps+1);
+    fCounters.AddRubric("Run", 1000000);
+    fCounters.Init();
+  }
   fHistTrackFilterEvMult=new TH2F("FiltCandidvsTracksinEv","FiltCandidvsTracksinEv",10000,-0.5,9999.5,200,-0.5,199.5);
   fHistTrackFilterEvMult->GetYaxis()->SetTitle("NCandidates");
   fHistTrackFilterEvMult->GetXaxis()->SetTitle("NTracksinEvent");
@@ -161,7 +191,23 @@ Long64_t AliNormalizationCounter::Merge(TCollection* list){
 }
 //_______________________________________
 void AliNormalizationCounter::Add(const AliNormalizationCounter *norm){
-  fCounters.Add(&(norm->fCounters));
+  if(fUseDenseCounters!=norm->fUseDenseCounters){
+    AliError(Form("Counters %s and %s have different storage, counts of the second one not added",GetName(),norm->GetName()));
+  }else if(fUseDenseCounters){
+    ResizeDenseCounters(norm->fDenseNMult);
+    for(UInt_t jRun=0; jRun<norm->fDenseRuns.size(); jRun++){
+      Int_t iRun=GetDenseRunIndex(norm->fDenseRuns[jRun],kTRUE);
+      for(Int_t evType=0; evType<kNEventTypes; evType++){
+        for(Int_t multBin=0; multBin<norm->fDenseNMult; multBin++){
+          fDenseCounts[DenseIndex(iRun,evType,multBin)]+=norm->fDenseCounts[norm->DenseIndex(jRun,evType,multBin)];
+        }
+      }
+    }
+    delete fDenseView;
+    fDenseView=0x0;
+  }else{
+    fCounters.Add(&(norm->fCounters));
+  }
   fHistTrackFilterEvMult->Add(norm->fHistTrackFilterEvMult);
   fHistTrackAnaEvMult->Add(norm->fHistTrackAnaEvMult);
   fHistTrackFilterSpdMult->Add(norm->fHistTrackFilterSpdMult);
@@ -308,6 +354,11 @@ void AliNormalizationCounter::StoreCandidates(AliVEvent *event,Int_t nCand,Bool_
   Int_t runNumber = event->GetRunNumber();
   Int_t multiplicity = Multiplicity(event);
   if(nCand==0)return;
+  if(fUseDenseCounters){
+    FillDenseCounters(flagFilter ? kCandidFilter : kCandidAnalysis,runNumber,multiplicity);
+    FillDenseCounters(flagFilter ? kNCandidFilter : kNCandidAnalysis,runNumber,multiplicity,nCand);
+    return;
+  }
   if(flagFilter){
     if(fMultiplicity) 
       fCounters.Count(Form("Event:Candid(Filter)/Run:%d/Multiplicity:%d",runNumber,multiplicity));
@@ -336,10 +387,11 @@ void AliNormalizationCounter::StoreCandidates(AliVEvent *event,Int_t nCand,Bool_
 //_______________________________________________________________________
 TH1D* AliNormalizationCounter::DrawAgainstRuns(TString candle,Bool_t drawHist){
   //
-  fCounters.SortRubric("Run");
+  AliCounterCollection* counters=GetCounter();
+  counters->SortRubric("Run");
   TString selection;
   selection.Form("event:%s",candle.Data());
-  TH1D* histoneD = fCounters.Get("run",selection.Data());
+  TH1D* histoneD = counters->Get("run",selection.Data());
 
   histoneD->Sumw2();
   if(drawHist)histoneD->DrawClone();
@@ -348,7 +400,7 @@ TH1D* AliNormalizationCounter::DrawAgainstRuns(TString candle,Bool_t drawHist){
 //___________________________________________________________________________
 TH1D* AliNormalizationCounter::DrawRatio(TString candle1,TString candle2){
   //
-  fCounters.SortRubric("Run");
+  GetCounter()->SortRubric("Run");
   TString name;
 
   name.Form("%s/%s",candle1.Data(),candle2.Data());
@@ -365,10 +417,11 @@ TH1D* AliNormalizationCounter::DrawRatio(TString candle1,TString candle2){
 }
 //___________________________________________________________________________
 void AliNormalizationCounter::PrintRubrics(){
-  fCounters.PrintKeyWords();
+  GetCounter()->PrintKeyWords();
 }
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetSum(TString candle){
+  if(fUseDenseCounters) return GetDenseSumForCandle(candle);
   TString selection="event:";
   selection.Append(candle);
   return fCounters.GetSum(selection.Data());
@@ -400,6 +453,14 @@ Double_t AliNormalizationCounter::GetNEventsForNorm(){
 }
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t runnumber){
+  if(fUseDenseCounters){
+    if(GetDenseRunIndex(runnumber,kFALSE)<0){
+      printf("WARNING: %d is not a valid run number\n",runnumber);
+      return 0.;
+    }
+    Double_t noVtxzGT10=GetDenseSum(kNoPrimaryV,runnumber)*GetDenseSum(kZvtxGT10,runnumber)/GetDenseSum(kPrimaryV,runnumber);
+    return GetDenseSum(kCountForNorm,runnumber)-noVtxzGT10;
+  }
   TString listofruns = fCounters.GetKeyWords("RUN");
   if(!listofruns.Contains(Form("%d",runnumber))){
     printf("WARNING: %d is not a valid run number\n",runnumber);
@@ -423,6 +484,13 @@ Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t minmultiplicity, Int_t
     return 0.;
   }
 
+  if(fUseDenseCounters){
+    Double_t sumnoPV=GetDenseSum(kNoPrimaryV,-1,minmultiplicity,maxmultiplicity);
+    Double_t sumPv=GetDenseSum(kPrimaryV,-1,minmultiplicity,maxmultiplicity);
+    Double_t noVtxzGT10 = sumPv>0. ? sumnoPV * GetDenseSum(kZvtxGT10,-1,minmultiplicity,maxmultiplicity) / sumPv : 0.;
+    return GetDenseSum(kCountForNorm,-1,minmultiplicity,maxmultiplicity) - noVtxzGT10;
+  }
+
   TString listofruns = fCounters.GetKeyWords("Multiplicity");
 
   Int_t nmultbins = maxmultiplicity - minmultiplicity;
@@ -531,6 +599,8 @@ Double_t AliNormalizationCounter::GetSum(TString candle,Int_t minmultiplicity, I
     return 0.;
   }
 
+  if(fUseDenseCounters) return GetDenseSumForCandle(candle,minmultiplicity,maxmultiplicity);
+
   TString listofruns = fCounters.GetKeyWords("Multiplicity");
   Double_t sum=0.;
   for (Int_t ibin=minmultiplicity; ibin<=maxmultiplicity; ibin++) {
@@ -549,33 +619,34 @@ Double_t AliNormalizationCounter::GetSum(TString candle,Int_t minmultiplicity, I
 //___________________________________________________________________________
 TH1D* AliNormalizationCounter::DrawNEventsForNorm(Bool_t drawRatio){
   //usare algebra histos
-  fCounters.SortRubric("Run");
+  AliCounterCollection* counters=GetCounter();
+  counters->SortRubric("Run");
   TString selection;
 
   selection.Form("event:noPrimaryV");
-  TH1D* hnoPrimV = fCounters.Get("run",selection.Data());
+  TH1D* hnoPrimV = counters->Get("run",selection.Data());
   hnoPrimV->Sumw2();
 
   selection.Form("event:zvtxGT10");
-  TH1D*  hzvtx= fCounters.Get("run",selection.Data());
+  TH1D*  hzvtx= counters->Get("run",selection.Data());
   hzvtx->Sumw2();
 
   selection.Form("event:PrimaryV");
-  TH1D* hPrimV = fCounters.Get("run",selection.Data());
+  TH1D* hPrimV = counters->Get("run",selection.Data());
   hPrimV->Sumw2();
 
   hzvtx->Multiply(hnoPrimV);
   hzvtx->Divide(hPrimV);
 
   selection.Form("event:countForNorm");
-  TH1D* hCountForNorm = fCounters.Get("run",selection.Data());
+  TH1D* hCountForNorm = counters->Get("run",selection.Data());
   hCountForNorm->Sumw2();
 
   hCountForNorm->Add(hzvtx,-1.);
 
   if(drawRatio){
     selection.Form("event:triggered");
-    TH1D* htriggered = fCounters.Get("run",selection.Data());
+    TH1D* htriggered = counters->Get("run",selection.Data());
     htriggered->Sumw2();
     hCountForNorm->Divide(htriggered);
   }
@@ -605,6 +676,15 @@ Int_t AliNormalizationCounter::Multiplicity(AliVEvent* event){
 //___________________________________________________________________________
 void AliNormalizationCounter::FillCounters(TString name, Int_t runNumber, Int_t multiplicity, Double_t spherocity){
 
+  if(fUseDenseCounters){
+    Int_t evType=GetEventType(name);
+    if(evType<0){
+      AliError(Form("Unknown event type %s",name.Data()));
+      return;
+    }
+    FillDenseCounters(evType,runNumber,multiplicity);
+    return;
+  }
 
   Int_t sphToInteger=spherocity*fSpherocitySteps;
   if(fMultiplicity  && !fSpherocity) 
@@ -617,3 +697,148 @@ void AliNormalizationCounter::FillCounters(TString name, Int_t runNumber, Int_t
     fCounters.Count(Form("Event:%s/Run:%d",name.Data(),runNumber));
   return;
 }
+
+//___________________________________________________________________________
+Int_t AliNormalizationCounter::GetEventType(TString name) const {
+  // index of an event type in the "Event" rubric (case insensitive as in AliCounterCollection)
+
+  for(Int_t evType=0; evType<kNEventTypes; evType++){
+    if(name.CompareTo(kEventTypeNames[evType],TString::kIgnoreCase)==0) return evType;
+  }
+  return -1;
+}
+
+//___________________________________________________________________________
+Int_t AliNormalizationCounter::GetDenseRunIndex(Int_t runNumber, Bool_t create){
+  // index of the run in the dense counters, a new run is appended if create is true
+
+  if(runNumber==fDenseLastRun && fDenseLastRunIndex>=0) return fDenseLastRunIndex;
+  Int_t iRun=-1;
+  for(UInt_t jRun=0; jRun<fDenseRuns.size(); jRun++){
+    if(fDenseRuns[jRun]==runNumber){
+      iRun=jRun;
+      break;
+    }
+  }
+  if(iRun<0){
+    if(!create) return -1;
+    iRun=fDenseRuns.size();
+    fDenseRuns.push_back(runNumber);
+    fDenseCounts.resize(fDenseCounts.size()+kNEventTypes*fDenseNMult,0.);
+  }
+  fDenseLastRun=runNumber;
+  fDenseLastRunIndex=iRun;
+  return iRun;
+}
+
+//___________________________________________________________________________
+void AliNormalizationCounter::ResizeDenseCounters(Int_t nMult){
+  // enlarge the multiplicity axis of the dense counters to nMult bins
+
+  if(nMult<=fDenseNMult) return;
+  Int_t nRuns=fDenseRuns.size();
+  std::vector<Double_t> counts(nRuns*kNEventTypes*nMult,0.);
+  for(Int_t iRun=0; iRun<nRuns; iRun++){
+    for(Int_t evType=0; evType<kNEventTypes; evType++){
+      for(Int_t multBin=0; multBin<fDenseNMult; multBin++){
+        counts[(iRun*kNEventTypes+evType)*nMult+multBin]=fDenseCounts[DenseIndex(iRun,evType,multBin)];
+      }
+    }
+  }
+  fDenseCounts.swap(counts);
+  fDenseNMult=nMult;
+}
+
+//___________________________________________________________________________
+void AliNormalizationCounter::FillDenseCounters(Int_t evType, Int_t runNumber, Int_t multiplicity, Double_t weight){
+  // increment the dense counter of the event type, multiplicity is used only if activated
+
+  Int_t iRun=GetDenseRunIndex(runNumber,kTRUE);
+  Int_t multBin=0;
+  if(fMultiplicity && multiplicity>=0){
+    multBin=multiplicity+1;
+    if(multBin>=fDenseNMult) ResizeDenseCounters(TMath::Max(multBin+1,2*fDenseNMult));
+  }
+  fDenseCounts[DenseIndex(iRun,evType,multBin)]+=weight;
+  if(fDenseView){
+    delete fDenseView;
+    fDenseView=0x0;
+  }
+}
+
+//___________________________________________________________________________
+Double_t AliNormalizationCounter::GetDenseSum(Int_t evType, Int_t runNumber, Int_t minMult, Int_t maxMult) const {
+  // sum of the dense counters of an event type for one run (all runs if runNumber<0)
+  // and multiplicities in [minMult,maxMult]. Negative multiplicities are included if minMult<0
+
+  Double_t sum=0.;
+  for(UInt_t iRun=0; iRun<fDenseRuns.size(); iRun++){
+    if(runNumber>=0 && fDenseRuns[iRun]!=runNumber) continue;
+    if(minMult<0) sum+=fDenseCounts[DenseIndex(iRun,evType,0)];
+    Int_t firstBin=TMath::Max(minMult,0)+1;
+    Int_t lastBin=TMath::Min((Long64_t)maxMult+1,(Long64_t)fDenseNMult-1);
+    for(Int_t multBin=firstBin; multBin<=lastBin; multBin++) sum+=fDenseCounts[DenseIndex(iRun,evType,multBin)];
+  }
+  return sum;
+}
+
+//___________________________________________________________________________
+Double_t AliNormalizationCounter::GetDenseSumForCandle(TString candle, Int_t minMult, Int_t maxMult) const {
+  // sum of the dense counters for a selection in the syntax of GetSum, e.g. "countForNorm/Run:123/Multiplicity:10"
+
+  TObjArray* tokens=candle.Tokenize("/");
+  Int_t evType=-1;
+  Int_t runNumber=-1;
+  Bool_t ok=(tokens->GetEntriesFast()>0);
+  for(Int_t iTok=0; iTok<tokens->GetEntriesFast() && ok; iTok++){
+    TString tok=((TObjString*)tokens->At(iTok))->String();
+    if(iTok==0){
+      evType=GetEventType(tok);
+      if(evType<0) ok=kFALSE;
+      continue;
+    }
+    Int_t colon=tok.First(':');
+    if(colon<0){
+      ok=kFALSE;
+      break;
+    }
+    TString key=tok(0,colon);
+    TString value=tok(colon+1,tok.Length()-colon-1);
+    key.ToLower();
+    if(key=="run") runNumber=value.Atoi();
+    else if(key=="multiplicity") minMult=maxMult=value.Atoi();
+    else ok=kFALSE;
+  }
+  delete tokens;
+  if(!ok){
+    AliError(Form("Selection %s not supported by the dense counters",candle.Data()));
+    return 0.;
+  }
+  return GetDenseSum(evType,runNumber,minMult,maxMult);
+}
+
+//___________________________________________________________________________
+AliCounterCollection* AliNormalizationCounter::GetCounter(){
+  // counter collection, built from the dense counters when they are used
+
+  if(!fUseDenseCounters) return &fCounters;
+  if(fDenseView) return fDenseView;
+  fDenseView=new AliCounterCollection(GetName());
+  fDenseView->AddRubric("Event",kEventRubric);
+  if(fMultiplicity) fDenseView->AddRubric("Multiplicity", 5000);
+  fDenseView->AddRubric("Run", 1000000);
+  fDenseView->Init();
+  for(UInt_t iRun=0; iRun<fDenseRuns.size(); iRun++){
+    for(Int_t evType=0; evType<kNEventTypes; evType++){
+      for(Int_t multBin=0; multBin<fDenseNMult; multBin++){
+        Double_t counts=fDenseCounts[DenseIndex(iRun,evType,multBin)];
+        if(counts<=0.) continue;
+        TString key;
+        key.Form("Event:%s/Run:%d",kEventTypeNames[evType],fDenseRuns[iRun]);
+        if(fMultiplicity) key.Append(Form("/Multiplicity:%d",multBin-1));
+        fDenseView->Count(key.Data(),(Int_t)counts);
+      }
+    }
+  }
+  return fDenseView;
+}
@@ -25,8 +25,15 @@
 /// \author Authors: G. Ortona, ortona@to.infn.it
 /// \author D. Caffarri, davide.caffarri@pd.to.infn.it
 /// with many thanks to P. Pillot
+///
+/// The counts are stored by default in an AliCounterCollection, keyed by strings.
+/// With SetUseDenseCounters() they are stored instead in a dense array indexed by
+/// (run, event type, multiplicity), with the list of runs as only dictionary: filling
+/// and merging then reduce to array operations. The AliCounterCollection of a dense
+/// counter is built on demand by GetCounter() for the drawing methods.
 /////////////////////////////////////////////////////////////
 
+#include <vector>
 #include <TROOT.h>
 #include <TSystem.h>
 #include <TNtuple.h>
@@ -54,10 +61,12 @@ class AliNormalizationCounter : public TNamed
   virtual ~AliNormalizationCounter();
   Long64_t Merge(TCollection* list);
 
-  AliCounterCollection* GetCounter(){return &fCounters;}
+  AliCounterCollection* GetCounter();
   void Init();
   void Add(const AliNormalizationCounter*);
   void SetESD(Bool_t flag){fESD=flag;}
+  void SetUseDenseCounters(Bool_t flag=kTRUE){fUseDenseCounters=flag;} /// to be called before Init()
+  Bool_t GetUseDenseCounters() const {return fUseDenseCounters;}
   void SetStudyMultiplicity(Bool_t flag, Float_t etaRange){ fMultiplicity=flag; fMultiplicityEtaRange=etaRange; }
   void SetStudySpherocity(Bool_t flag, Double_t nsteps=100.){fSpherocity=flag;
     fSpherocitySteps=nsteps;}
@@ -83,11 +92,26 @@ class AliNormalizationCounter : public TNamed
   TH1F* GetHistoGenVertexZRecoPV() const { return fHistGenVertexZRecoPV;}
   TH1F* GetHistoRecoVertexZ() const { return fHistRecoVertexZ;}
 
+  /// event types of the "Event" rubric, in the order of the dense counters
+  enum EEventType {kTriggered, kV0AND, kPileUp, kPbPbC0SMH, kCandles03, kPrimaryV, kCountForNorm,
+                   kNoPrimaryV, kZvtxGT10, kNoV0AandCandle03, kNoV0AandPrimaryV, kCandidFilter,
+                   kCandidAnalysis, kNCandidFilter, kNCandidAnalysis, kNEventTypes};
+
  private:
   AliNormalizationCounter(const AliNormalizationCounter &source);
   AliNormalizationCounter& operator=(const AliNormalizationCounter& source);
   Int_t Multiplicity(AliVEvent* event);
   void FillCounters(TString name, Int_t runNumber, Int_t multiplicity, Double_t spherocity);
+  Int_t GetEventType(TString name) const;
+  Int_t GetDenseRunIndex(Int_t runNumber, Bool_t create);
+  void ResizeDenseCounters(Int_t nMult);
+  void FillDenseCounters(Int_t evType, Int_t runNumber, Int_t multiplicity, Double_t weight=1.);
+  Double_t GetDenseSum(Int_t evType, Int_t runNumber=-1, Int_t minMult=kMinInt, Int_t maxMult=kMaxInt) const;
+  Double_t GetDenseSumForCandle(TString candle, Int_t minMult=kMinInt, Int_t maxMult=kMaxInt) const;
+  /// index in fDenseCounts, multiplicity bin 0 holds the negative (=not set) values
+  Int_t DenseIndex(Int_t iRun, Int_t evType, Int_t multBin) const {
+    return (iRun*kNEventTypes+evType)*fDenseNMult+multBin;
+  }
 
 
   AliCounterCollection fCounters; /// internal counter
@@ -103,9 +127,16 @@ class AliNormalizationCounter : public TNamed
   TH1F *fHistGenVertexZ;       /// histo of generated z vertex
   TH1F *fHistGenVertexZRecoPV; /// histo of generated z vertex for events with reco vert
   TH1F *fHistRecoVertexZ;      /// histo of reconstructed z vertex
+  Bool_t fUseDenseCounters;           /// flag to store the counts in fDenseCounts instead of fCounters
+  std::vector<Int_t> fDenseRuns;      /// run numbers of the dense counters
+  Int_t fDenseNMult;                  /// number of multiplicity bins of the dense counters
+  std::vector<Double_t> fDenseCounts; /// dense counters, see DenseIndex
+  Int_t fDenseLastRun;                //!<! run number of the last filled dense counter
+  Int_t fDenseLastRunIndex;           //!<! index in fDenseRuns of fDenseLastRun
+  AliCounterCollection* fDenseView;   //!<! AliCounterCollection built from the dense counters
 
   /// \cond CLASSIMP    
-  ClassDef(AliNormalizationCounter,8);
+  ClassDef(AliNormalizationCounter,9);
   /// \endcond
 };
 #endif
@@ -32,6 +32,9 @@
 #include "AliAODMCParticle.h"
 #include "AliAODRecoDecayHF.h"
 #include "AliVertexingHFUtils.h"
+#ifdef WITH_KFPARTICLE_SIMD
+#include "KFParticleSIMD.h"
+#endif
 
 #ifndef HomogeneousField
 #define HomogeneousField 
@@ -4216,6 +4219,55 @@ KFParticle AliVertexingHFUtils::CreateKFParticleCasc(KFParticle kfpV0, AliAODTra
   return kfpCasc;
 }
 
+//______________________________________________________________________
+void AliVertexingHFUtils::ConstructKFParticles(Int_t nDaughters, std::vector<KFParticle> *daughters, std::vector<KFParticle> &mothers, Bool_t useSIMD)
+{
+  // mothers[i] = KFParticle constructed from the daughters[iDau][i]
+  // the SIMD lanes of the last pack are padded with copies of the last candidate
+
+  const Int_t kMaxDaughters=4;
+  if(nDaughters<1 || nDaughters>kMaxDaughters){
+    printf("AliVertexingHFUtils::ConstructKFParticles: wrong number of daughters %d\n",nDaughters);
+    mothers.clear();
+    return;
+  }
+  Int_t nCand=daughters[0].size();
+  for(Int_t iDau=1; iDau<nDaughters; iDau++) nCand=TMath::Min(nCand,(Int_t)daughters[iDau].size());
+  mothers.resize(nCand);
+  if(nCand==0) return;
+
+#ifdef WITH_KFPARTICLE_SIMD
+  if(useSIMD){
+    const Int_t nLanes=float_v::Size;
+    KFParticle *lanes[float_v::Size];
+    KFParticleSIMD packs[kMaxDaughters];
+    const KFParticleSIMD *vPacks[kMaxDaughters];
+    for(Int_t iFirst=0; iFirst<nCand; iFirst+=nLanes){
+      Int_t nInPack=TMath::Min(nLanes,nCand-iFirst);
+      for(Int_t iDau=0; iDau<nDaughters; iDau++){
+        for(Int_t iLane=0; iLane<nLanes; iLane++) lanes[iLane]=&(daughters[iDau][iFirst+TMath::Min(iLane,nInPack-1)]);
+        packs[iDau]=KFParticleSIMD(lanes,nLanes);
+        vPacks[iDau]=&packs[iDau];
+      }
+      KFParticleSIMD motherPack;
+      motherPack.Construct(vPacks,nDaughters);
+      for(Int_t iLane=0; iLane<nInPack; iLane++) motherPack.GetKFParticle(mothers[iFirst+iLane],iLane);
+    }
+    return;
+  }
+#else
+  (void)useSIMD;
+#endif
+
+  const KFParticle *vDaughters[kMaxDaughters];
+  for(Int_t iCand=0; iCand<nCand; iCand++){
+    for(Int_t iDau=0; iDau<nDaughters; iDau++) vDaughters[iDau]=&(daughters[iDau][iCand]);
+    mothers[iCand]=KFParticle();
+    mothers[iCand].Construct(vDaughters,nDaughters);
+  }
+  return;
+}
+
 //______________________________________________________________________
 Double_t AliVertexingHFUtils::DecayLengthFromKF(KFParticle kfpParticle, KFParticle PV)
 {
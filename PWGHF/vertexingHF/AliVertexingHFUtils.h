@@ -267,6 +267,9 @@ class AliVertexingHFUtils : public TObject{
   static KFParticle CreateKFParticleFromAODtrack(AliAODTrack *track, Int_t pdg);
   static KFParticle CreateKFParticleV0(AliAODTrack *track1, AliAODTrack *track2, Int_t pdg1, Int_t pdg2);
   static KFParticle CreateKFParticleCasc(KFParticle kfpV0, AliAODTrack *btrack, Int_t pdg_V0, Int_t pdg_btrack);
+  /// KFParticle::Construct of many mothers: mothers[i] is built from daughters[0][i],...,daughters[nDaughters-1][i].
+  /// With useSIMD (and KFParticle built with Vc) the candidates are fitted in the SIMD lanes of KFParticleSIMD
+  static void ConstructKFParticles(Int_t nDaughters, std::vector<KFParticle> *daughters, std::vector<KFParticle> &mothers, Bool_t useSIMD=kTRUE);
   static Double_t DecayLengthFromKF(KFParticle kfpParticle, KFParticle PV);
   static Double_t DecayLengthXYFromKF(KFParticle kfpParticle, KFParticle PV);
   static Double_t ldlFromKF(KFParticle kfpParticle, KFParticle PV); /// l/dl
@@ -45,6 +45,8 @@
 #pragma link C++ class AliAnalysisTaskSEBPlustoD0Pi+;
 #pragma link C++ class AliAnalysisTaskSESelectHF+;
 #pragma link C++ class AliAnalysisTaskSECleanupVertexingHF+;
+#pragma link C++ class AliAnalysisTaskSEPrefillVertexingHF+;
+#pragma link C++ class AliAnalysisTaskSEHFTrackIndex+;
 #pragma link C++ class AliAnalysisTaskSECompareHF+;
 #pragma link C++ class AliAnalysisTaskSELambdac+;
 #pragma link C++ class AliAnalysisTaskSED0BDT+;
@@ -93,6 +95,7 @@
 #pragma link C++ class AliHFMassFitter+;
 #pragma link C++ class AliHFPtSpectrum+;
 #pragma link C++ class AliHFsubtractBFDcuts+;
+#pragma link C++ class AliHFTrackIndex+;
 #pragma link C++ class AliNormalizationCounter+;
 #pragma link C++ class AliAnalysisTaskSEMonitNorm+;
 #pragma link C++ class AliAnalysisTaskSEBkgLikeSignD0+;
@@ -10,6 +10,7 @@
 ///////////////////////////////////////////////////////////////////////////
 
 #include <Riostream.h>
+#include <utility>
 #include <vector>
 
 #include "AliRDHFBDT.h"
@@ -28,7 +29,17 @@ AliRDHFBDT::AliRDHFBDT() :
  fNTrees(0),
  fDescStr("BDT"),
  fNVars(0),
- fVarName(0)
+ fVarName(0),
+ fFlatBuilt(kFALSE),
+ fFlatValid(kFALSE),
+ fFlatSelector(),
+ fFlatCutValue(),
+ fFlatCutGT(),
+ fFlatLeft(),
+ fFlatRight(),
+ fFlatTreeRoot(),
+ fFlatTreeDepth(),
+ fFlatNorm(0)
 {
   //
   // Default Constructor
@@ -43,7 +54,17 @@ AliRDHFBDT::AliRDHFBDT(const TString& strVarName) :
  fNTrees(0),
  fDescStr("BDT"),
  fNVars(0),
- fVarName(0)
+ fVarName(0),
+ fFlatBuilt(kFALSE),
+ fFlatValid(kFALSE),
+ fFlatSelector(),
+ fFlatCutValue(),
+ fFlatCutGT(),
+ fFlatLeft(),
+ fFlatRight(),
+ fFlatTreeRoot(),
+ fFlatTreeDepth(),
+ fFlatNorm(0)
 {
   //
   // Copy constructor
@@ -63,12 +84,21 @@ AliRDHFBDT::AliRDHFBDT(const AliRDHFBDT &source):
   fNTrees(source.fNTrees),
   fDescStr(source.fDescStr),
   fNVars(source.fNVars),
-  fVarName(0)
+  fVarName(source.fVarName),
+ fFlatBuilt(kFALSE),
+ fFlatValid(kFALSE),
+ fFlatSelector(),
+ fFlatCutValue(),
+ fFlatCutGT(),
+ fFlatLeft(),
+ fFlatRight(),
+ fFlatTreeRoot(),
+ fFlatTreeDepth(),
+ fFlatNorm(0)
 {
   //
   // assignment operator
   //
-  for(Int_t i = 0; i < fNVars; i++) fVarName[i] = source.fVarName[i];
   fDTWeights=source.fDTWeights;
 }
 //--------------------------------------------------------------------------
@@ -80,6 +110,75 @@ AliRDHFBDT::~AliRDHFBDT() {
 }
 //---------------------------------------------------------------------------
 Double_t AliRDHFBDT::GetResponse( const std::vector<Double_t>& inputValues )
+{
+	if(!fFlatBuilt) BuildFlatForest();
+	if(!fFlatValid) return GetResponseSlow(inputValues);
+
+	Double_t res = 0;
+	for (size_t iTree=0; iTree<fFlatTreeRoot.size(); iTree++){
+		Int_t node = fFlatTreeRoot[iTree];
+		while(fFlatSelector[node]>=0){
+			Bool_t goesRight = (inputValues[fFlatSelector[node]] > fFlatCutValue[node]) == (fFlatCutGT[node]==1);
+			node = goesRight ? fFlatRight[node] : fFlatLeft[node];
+		}
+		res += fFlatCutValue[node];
+	}
+	return res / fFlatNorm;
+}
+//---------------------------------------------------------------------------
+Bool_t AliRDHFBDT::BuildFlatForest()
+{
+	fFlatBuilt = kTRUE;
+	fFlatValid = kFALSE;
+	fFlatSelector.clear(); fFlatCutValue.clear(); fFlatCutGT.clear();
+	fFlatLeft.clear(); fFlatRight.clear(); fFlatTreeRoot.clear(); fFlatTreeDepth.clear();
+	fFlatNorm = 0;
+
+	for(Int_t iTree=0; iTree<GetNTrees(); iTree++){
+		AliRDHFDecisionTree *tree = GetDecisionTree(iTree);
+		if(!tree || tree->GetNNodes()==0) return kFALSE;
+		Double_t weight = GetBoostWeight(iTree);
+		fFlatNorm += weight;
+
+		// breadth-first copy: (original index, depth) of the nodes still to be placed
+		std::vector<std::pair<Int_t,Int_t> > queue(1, std::make_pair(0,0));
+		Int_t offset = fFlatSelector.size();
+		Int_t depth = 0;
+		fFlatTreeRoot.push_back(offset);
+		for(size_t iQueue=0; iQueue<queue.size(); iQueue++){
+			Int_t flatInd = offset + iQueue;
+			AliRDHFDTNode *node = tree->GetNode(queue[iQueue].first);
+			if(queue[iQueue].second>depth) depth = queue[iQueue].second;
+			AliRDHFDTNode::ENodeType type = node->GetNodeType();
+			if(type==AliRDHFDTNode::kSignal || type==AliRDHFDTNode::kBkg){
+				fFlatSelector.push_back(-1);
+				fFlatCutValue.push_back(type==AliRDHFDTNode::kSignal ? weight : -weight);
+				fFlatCutGT.push_back(0);
+				fFlatLeft.push_back(flatInd);
+				fFlatRight.push_back(flatInd);
+			}
+			else if((type==AliRDHFDTNode::kRoot || type==AliRDHFDTNode::kMed) && node->CheckNodeIntegrity()){
+				if(node->GetLNodeInd()<0 || node->GetLNodeInd()>=tree->GetNNodes() ||
+				   node->GetRNodeInd()<0 || node->GetRNodeInd()>=tree->GetNNodes()) return kFALSE;
+				fFlatSelector.push_back(node->GetSelector());
+				fFlatCutValue.push_back(node->GetCutValue());
+				fFlatCutGT.push_back(node->GetCutType()==AliRDHFDTNode::kGT ? 1 : 0);
+				fFlatLeft.push_back(offset + queue.size());
+				queue.push_back(std::make_pair(node->GetLNodeInd(), queue[iQueue].second+1));
+				fFlatRight.push_back(offset + queue.size());
+				queue.push_back(std::make_pair(node->GetRNodeInd(), queue[iQueue].second+1));
+				if(node->GetSelector()<0 || node->GetSelector()>=fNVars) return kFALSE;
+			}
+			else return kFALSE; // null or broken nodes are handled by the slow path
+			if(queue.size() > (size_t)tree->GetNNodes()) return kFALSE; // cyclic links
+		}
+		fFlatTreeDepth.push_back(depth);
+	}
+	fFlatValid = fFlatNorm!=0;
+	return fFlatValid;
+}
+//---------------------------------------------------------------------------
+Double_t AliRDHFBDT::GetResponseSlow( const std::vector<Double_t>& inputValues )
 {
 	Double_t res = 0;
     Double_t norm = 0;
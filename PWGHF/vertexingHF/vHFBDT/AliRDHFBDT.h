@@ -53,6 +53,8 @@ class AliRDHFBDT : public AliVCuts
    AliRDHFDecisionTree *GetDecisionTree(Int_t i);
    Double_t GetBoostWeight(Int_t i);
    Double_t GetResponse( const std::vector<Double_t>& inputValues );
+   /// Convert the trees into the flat (breadth-first, structure-of-arrays) representation used for the evaluation
+   Bool_t BuildFlatForest();
    Bool_t CompareVarName( const TString& inputVarName );
    
    AliRDHFDecisionTree *AddDecisionTree(AliRDHFDecisionTree *tree, Double_t weight);
@@ -73,9 +75,23 @@ class AliRDHFBDT : public AliVCuts
    TString fDescStr;
    Int_t fNVars;
    std::vector<TString> fVarName;
-   
+
+   Double_t GetResponseSlow( const std::vector<Double_t>& inputValues );
+
+   // Flat forest: all the nodes of all the trees stored breadth-first in plain arrays
+   Bool_t fFlatBuilt;                    //! flat forest already built
+   Bool_t fFlatValid;                    //! flat forest usable (all the trees are well formed)
+   std::vector<Int_t> fFlatSelector;     //! variable index of each node (-1 for leaves)
+   std::vector<Double_t> fFlatCutValue;  //! cut value of internal nodes, decision (+-1) of leaves
+   std::vector<Char_t> fFlatCutGT;       //! 1 if the cut selects the right daughter for larger values
+   std::vector<Int_t> fFlatLeft;         //! index of the left daughter
+   std::vector<Int_t> fFlatRight;        //! index of the right daughter
+   std::vector<Int_t> fFlatTreeRoot;     //! index of the root node of each tree
+   std::vector<Int_t> fFlatTreeDepth;    //! depth of each tree
+   Double_t fFlatNorm;                   //! sum of the boost weights
+
    /// \cond CLASSIMP
-   ClassDef(AliRDHFBDT,1);  /// 
+   ClassDef(AliRDHFBDT,2);  /// 
    /// \endcond
 };
 
@@ -24,7 +24,8 @@ ClassImp(AliHFMLResponse);
 
 //________________________________________________________________
 AliHFMLResponse::AliHFMLResponse() : AliMLResponse(),
-                                     fVars{}
+                                     fVars{},
+                                     fVarValues{}
 {
     //
     // Default constructor
@@ -34,7 +35,8 @@ AliHFMLResponse::AliHFMLResponse() : AliMLResponse(),
 //________________________________________________________________
 AliHFMLResponse::AliHFMLResponse(const Char_t *name, const Char_t *title, 
                                  const std::string configfilepath) : AliMLResponse(name, title),
-                                                                     fVars{}
+                                                                     fVars{},
+                                                                     fVarValues{}
 {
     //
     // Standard constructor
@@ -53,7 +55,8 @@ AliHFMLResponse::~AliHFMLResponse()
 
 //--------------------------------------------------------------------------
 AliHFMLResponse::AliHFMLResponse(const AliHFMLResponse &source) : AliMLResponse(source),
-                                                                  fVars(source.fVars)
+                                                                  fVars(source.fVars),
+                                                                  fVarValues{}
 {
     //
     // Copy constructor
@@ -70,58 +73,71 @@ AliHFMLResponse &AliHFMLResponse::operator=(const AliHFMLResponse &source)
 
     AliMLResponse::operator=(source);
     fVars = source.fVars;
+    fVarValues.clear();
 
     return *this;
 }
 
 //________________________________________________________________
-double AliHFMLResponse::Predict(AliAODRecoDecayHF *cand, double bfield, AliAODPidHF *pidHF, int masshypo)
+bool AliHFMLResponse::FillBoundVariables(AliAODRecoDecayHF *cand, double bfield, AliAODPidHF *pidHF, int masshypo)
 {
     SetMapOfVariables(cand, bfield, pidHF, masshypo);
     if (fVars.empty())
     {
         AliWarning("Map of features empty!");
-        return -999.;
+        return false;
+    }
+
+    // the keys of fVars do not change from one candidate to the next, so the model variables
+    // are resolved only once and afterwards the map is simply copied in key order
+    if (fVarValues.size() != fVars.size() || !AreVariablesBound())
+    {
+        std::vector<std::string> names;
+        for (const auto &var : fVars)
+            names.push_back(var.first);
+        BindVariables(names);
+        fVarValues.resize(fVars.size());
     }
 
-    return Predict(cand->Pt(), fVars);
+    std::size_t iVar = 0;
+    for (const auto &var : fVars)
+        fVarValues[iVar++] = var.second;
+
+    return true;
+}
+
+//________________________________________________________________
+double AliHFMLResponse::Predict(AliAODRecoDecayHF *cand, double bfield, AliAODPidHF *pidHF, int masshypo)
+{
+    if (!FillBoundVariables(cand, bfield, pidHF, masshypo))
+        return -999.;
+
+    return Predict(cand->Pt(), fVarValues.data());
 }
 
 //________________________________________________________________
 bool AliHFMLResponse::IsSelected(double &prob, AliAODRecoDecayHF *cand, double bfield, AliAODPidHF *pidHF, int masshypo)
 {   
-    SetMapOfVariables(cand, bfield, pidHF, masshypo);
-    if (fVars.empty())
-    {
-        AliWarning("Map of features empty!");
+    if (!FillBoundVariables(cand, bfield, pidHF, masshypo))
         return false;
-    }
 
-    return IsSelected(cand->Pt(), fVars, prob);
+    return IsSelected(cand->Pt(), fVarValues.data(), prob);
 }
 
 //________________________________________________________________
 bool AliHFMLResponse::PredictMultiClass(std::vector<double> &outScores, AliAODRecoDecayHF *cand, double bfield, AliAODPidHF *pidHF, int masshypo)
 {
-    SetMapOfVariables(cand, bfield, pidHF, masshypo);
-    if (fVars.empty())
-    {
-        AliWarning("Map of features empty!");
+    if (!FillBoundVariables(cand, bfield, pidHF, masshypo))
         return false;
-    }
 
-    return PredictMultiClass(cand->Pt(), fVars, outScores);
+    return PredictMultiClass(cand->Pt(), fVarValues.data(), outScores);
 }
 
 //________________________________________________________________
 bool AliHFMLResponse::IsSelectedMultiClass(std::vector<double> &outScores, AliAODRecoDecayHF *cand, double bfield, AliAODPidHF *pidHF, int masshypo)
 {   
-    SetMapOfVariables(cand, bfield, pidHF, masshypo);
-    if (fVars.empty())
-    {
-        AliWarning("Map of features empty!");
+    if (!FillBoundVariables(cand, bfield, pidHF, masshypo))
         return false;
-    }
 
-    return IsSelectedMultiClass(cand->Pt(), fVars, outScores);
+    return IsSelectedMultiClass(cand->Pt(), fVarValues.data(), outScores);
 }
@@ -52,8 +52,11 @@ public:
 protected:
     /// method used to define map of name <-> variables (features) --> to be implemented for each derived class
     virtual void SetMapOfVariables(AliAODRecoDecayHF * /*cand*/, double /*bfield*/, AliAODPidHF * /*pidHF*/, int /*masshypo*/) { return; }
+    /// method to fill the map and copy it into the array of values bound to the model variables
+    bool FillBoundVariables(AliAODRecoDecayHF *cand, double bfield, AliAODPidHF *pidHF, int masshypo);
 
     std::map<std::string, double> fVars;       /// map of variables (features) that can be used for the ML model application
+    std::vector<double> fVarValues;            //!<! values of fVars in key order, bound to the model variables
 
     /// \cond CLASSIMP
     ClassDef(AliHFMLResponse, 2); ///
@@ -24,6 +24,8 @@
  * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
  ************************************************************************************/
+#include <vector>
+
 #include <TH1F.h>
 #include <TH2F.h>
 #include <TH3F.h>
@@ -34,6 +36,7 @@
 #include "AliJetContainer.h"
 #include "AliParticleContainer.h"
 
+#include "AliEmcalJetMatcherKDTree.h"
 #include "AliAnalysisTaskEmcalJetTagger.h"
 
 ClassImp(AliAnalysisTaskEmcalJetTagger);
@@ -348,108 +351,45 @@ void AliAnalysisTaskEmcalJetTagger::MatchJetsGeo(Int_t c1, Int_t c2,
   }
   fMatchingDone = kFALSE;
 
-  TArrayI faMatchIndex1;
-  faMatchIndex1.Set(nJets2+1);
-  faMatchIndex1.Reset(-1);
-
-  TArrayI faMatchIndex2;
-  faMatchIndex2.Set(nJets1+1);
-  faMatchIndex2.Reset(-1);
-
-  static TArrayS iFlag(nJets1*nJets2);
-  if(iFlag.GetSize()<(nJets1*nJets2)){
-    iFlag.Set(nJets1*nJets2+1);
-  }
-  iFlag.Reset(0);
-
-  //AliJetContainer *cont1 = GetJetContainer(c1);
-  //AliJetContainer *cont2 = GetJetContainer(c2);
-  //Printf("eta cont 1 %f - %f", cont1->GetJetEtaMin(), cont1->GetJetEtaMax());
-  //Printf("phi cont 1 %f - %f", cont1->GetJetPhiMin(), cont1->GetJetPhiMax());
-  //if(type==1)
-  //  cont2->SetJetEtaLimits(cont2->GetJetEtaMin()-0.1,cont2->GetJetEtaMax()+0.1);
-  //else if(type==2) {
-  //  cont2->SetJetEtaLimits(cont2->GetJetEtaMin()-0.1,cont2->GetJetEtaMax()+0.1);
-  //  cont2->SetJetPhiLimits(cont2->GetJetPhiMin()-0.1,cont2->GetJetPhiMax()+0.1);
-  //} 
-  //else if(type==3) {
-  //  cont1->SetJetEtaLimits(cont1->GetJetEtaMin()-0.1,cont1->GetJetEtaMax()+0.1);
-  //  cont1->SetJetPhiLimits(cont1->GetJetPhiMin()-0.1,cont1->GetJetPhiMax()+0.1);
-  //  cont2->SetJetEtaLimits(cont2->GetJetEtaMin()-0.1,cont2->GetJetEtaMax()+0.1);
-  //  cont2->SetJetPhiLimits(cont2->GetJetPhiMin()-0.1,cont2->GetJetPhiMax()+0.1);
-  //}
-
-  // find the closest distance to the full jet
+  // accepted jets and their index in the jet arrays
+  std::vector<AliEmcalJet*> jets1, jets2;
+  std::vector<Int_t> index1, index2;
   for(int i = 0;i<nJets1;i++){
-
     AliEmcalJet *jet1 = static_cast<AliEmcalJet*>(GetAcceptJetFromArray(i, c1));
     if(!jet1) continue;
-
-    Float_t dist = maxDist;
-    
-    for(int j = 0;j <nJets2; j++){
-      AliEmcalJet *jet2 = static_cast<AliEmcalJet*>(GetAcceptJetFromArray(j, c2));
-      if(!jet2) continue;
-
-      Double_t dR = jet1->DeltaR(jet2);
-      if(dR<dist && dR<maxDist){
-	faMatchIndex2[i]=j;
-	dist = dR;
-      }
-    }//j jet loop
-    if(faMatchIndex2[i]>=0) {
-      iFlag[i*nJets2+faMatchIndex2[i]]+=1;//j closest to i
-      if(iDebug>10) Printf("Full Distance (%d)--(%d) %3.3f flag[%d] = %d",i,faMatchIndex2[i],dist,i*nJets2+faMatchIndex2[i],iFlag[i*nJets2+faMatchIndex2[i]]);
-    }
-  }//i jet loop
-
-  // other way around
+    jets1.push_back(jet1);
+    index1.push_back(i);
+  }
   for(int j = 0;j<nJets2;j++){
     AliEmcalJet *jet2 = static_cast<AliEmcalJet*>(GetAcceptJetFromArray(j, c2));
-    if(!jet2)
-      continue;
+    if(!jet2) continue;
+    jets2.push_back(jet2);
+    index2.push_back(j);
+  }
 
-    Float_t dist = maxDist;
-    for(int i = 0;i<nJets1;i++){
-      AliEmcalJet *jet1 = static_cast<AliEmcalJet*>(GetAcceptJetFromArray(i, c1));
-      if(!jet1)	continue;
+  // closest jets within maxDist in both directions, from kd-trees
+  std::vector<Int_t> faMatchIndex2, faMatchIndex1;
+  PWGJE::EMCALJetTasks::AliEmcalJetMatcherKDTree::MatchBijective(jets1, jets2, maxDist, faMatchIndex2, faMatchIndex1);
 
-      Double_t dR = jet1->DeltaR(jet2);
-      if(dR<dist && dR<maxDist){
-	faMatchIndex1[j]=i;
-        dist = dR;
-      }   
-    }
-    if(faMatchIndex1[j]>=0) {
-      iFlag[faMatchIndex1[j]*nJets2+j]+=2;//i closest to j
-      if(iDebug>10) Printf("Other way Distance (%d)--(%d) %3.3f flag[%d] = %d",faMatchIndex1[j],j,dist,faMatchIndex1[j]*nJets2+j,iFlag[faMatchIndex1[j]*nJets2+j]);
-    }
-  }
-    
   // check for "true" correlations
-  for(int i = 0;i<nJets1;i++){
-    AliEmcalJet *jet1 = static_cast<AliEmcalJet*>(GetJetFromArray(i, c1));
-    for(int j = 0;j<nJets2;j++){
-      AliEmcalJet *jet2 = static_cast<AliEmcalJet*>(GetJetFromArray(j, c2));
-      AliDebug(11,Form("%s: Flag[%d][%d] %d ",GetName(),i,j,iFlag[i*nJets2+j]));
-      
-      // we have a uniqe correlation
-      if(iFlag[i*nJets2+j]==3) {
-        Double_t dR = jet1->DeltaR(jet2);
-	if(iDebug>1) Printf("closest jets %d  %d  dR =  %f",j,i,dR);
-	
-	if(fJetTaggingType==kTag) {
-	  jet1->SetTaggedJet(jet2);
-	  jet1->SetTagStatus(1);
-	  
-	  jet2->SetTaggedJet(jet1);
-	  jet2->SetTagStatus(1);
-	}
-	else if(fJetTaggingType==kClosest) {
-	  jet1->SetClosestJet(jet2,dR);
-	  jet2->SetClosestJet(jet1,dR);
-	}
-      }
+  for(size_t i = 0;i<jets1.size();i++){
+    // we have a uniqe correlation
+    if(faMatchIndex2[i]<0) continue;
+    AliEmcalJet *jet1 = jets1[i];
+    AliEmcalJet *jet2 = jets2[faMatchIndex2[i]];
+    Double_t dR = jet1->DeltaR(jet2);
+    if(iDebug>1) Printf("closest jets %d  %d  dR =  %f",index2[faMatchIndex2[i]],index1[i],dR);
+
+    if(fJetTaggingType==kTag) {
+      jet1->SetTaggedJet(jet2);
+      jet1->SetTagStatus(1);
+
+      jet2->SetTaggedJet(jet1);
+      jet2->SetTagStatus(1);
+    }
+    else if(fJetTaggingType==kClosest) {
+      jet1->SetClosestJet(jet2,dR);
+      jet2->SetClosestJet(jet1,dR);
     }
   }
   fMatchingDone = kTRUE;
@@ -34,6 +34,9 @@
 #include <TH1F.h>
 #include <TH2F.h>
 #include <TProfile.h>
+#include <TMatrixDSym.h>
+#include <TVectorD.h>
+#include <TDecompChol.h>
 // aliroot includes
 #include <AliAnalysisTask.h>
 #include <AliAnalysisManager.h>
@@ -62,9 +65,9 @@ AliAnalysisTaskLocalRho::AliAnalysisTaskLocalRho() :
   fUseScaledRho(0), fCentralityClasses(0), fUserSuppliedV2(0), fUserSuppliedV3(0), fUserSuppliedR2(0), 
   fUserSuppliedR3(0), fNAcceptedTracks(0), fNAcceptedTracksQCn(0), fInCentralitySelection(-1), 
   fFitModulationType(kNoFit), fQCRecovery(kTryFit), fUsePtWeight(kTRUE), fUsePtWeightErrorPropagation(kFALSE), fDetectorType(kTPC), 
-  fFitModulationOptions("WLQI"), fRunModeType(kGrid), fFitModulation(0), fMinPvalue(0.01), fMaxPvalue(1), 
+  fFitModulationOptions("WLQI"), fRunModeType(kGrid), fFitModulation(0), fFitMethod(kTF1Fit), fReuseV0EventPlane(kFALSE), fMinPvalue(0.01), fMaxPvalue(1), 
   fLocalJetMinEta(-10), fLocalJetMaxEta(-10), fLocalJetMinPhi(-10), fLocalJetMaxPhi(-10), fSoftTrackMinPt(0.15), 
-  fSoftTrackMaxPt(5.), fHistPvalueCDF(0), fHistRhoStatusCent(0), fAbsVnHarmonics(kTRUE), fExcludeLeadingJetsFromFit(1.), 
+  fSoftTrackMaxPt(5.), fHistPvalueCDF(0), fHistRhoStatusCent(0), fHistLinearFitValidation(0), fAbsVnHarmonics(kTRUE), fExcludeLeadingJetsFromFit(1.), 
   fRebinSwapHistoOnTheFly(kTRUE), fPercentageOfFits(10.), fUseV0EventPlaneFromHeader(kTRUE), fOutputList(0), 
   fOutputListGood(0), fOutputListBad(0), fHistSwap(0), fHistAnalysisSummary(0), fProfV2(0), fProfV2Cumulant(0), 
   fProfV3(0), fProfV3Cumulant(0) 
@@ -84,9 +87,9 @@ AliAnalysisTaskLocalRho::AliAnalysisTaskLocalRho(const char* name, runModeType t
   fUseScaledRho(0), fCentralityClasses(0), fUserSuppliedV2(0), fUserSuppliedV3(0), fUserSuppliedR2(0), 
   fUserSuppliedR3(0), fNAcceptedTracks(0), fNAcceptedTracksQCn(0), fInCentralitySelection(-1), 
   fFitModulationType(kNoFit), fQCRecovery(kTryFit), fUsePtWeight(kTRUE), fUsePtWeightErrorPropagation(kFALSE), fDetectorType(kTPC), 
-  fFitModulationOptions("WLQI"), fRunModeType(type), fFitModulation(0), fMinPvalue(0.01), fMaxPvalue(1), 
+  fFitModulationOptions("WLQI"), fRunModeType(type), fFitModulation(0), fFitMethod(kTF1Fit), fReuseV0EventPlane(kFALSE), fMinPvalue(0.01), fMaxPvalue(1), 
   fLocalJetMinEta(-10), fLocalJetMaxEta(-10), fLocalJetMinPhi(-10), fLocalJetMaxPhi(-10), fSoftTrackMinPt(0.15), 
-  fSoftTrackMaxPt(5.), fHistPvalueCDF(0), fHistRhoStatusCent(0), fAbsVnHarmonics(kTRUE), fExcludeLeadingJetsFromFit(1.), 
+  fSoftTrackMaxPt(5.), fHistPvalueCDF(0), fHistRhoStatusCent(0), fHistLinearFitValidation(0), fAbsVnHarmonics(kTRUE), fExcludeLeadingJetsFromFit(1.), 
   fRebinSwapHistoOnTheFly(kTRUE), fPercentageOfFits(10.), fUseV0EventPlaneFromHeader(kTRUE), fOutputList(0), 
   fOutputListGood(0), fOutputListBad(0), fHistSwap(0), fHistAnalysisSummary(0), fProfV2(0), fProfV2Cumulant(0), 
   fProfV3(0), fProfV3Cumulant(0) 
@@ -218,6 +221,7 @@ void AliAnalysisTaskLocalRho::UserCreateOutputObjects()
   // cdf of chisquare distribution
   fHistPvalueCDF = BookTH1F("fHistPvalueCDF", "CDF #chi^{2}", 500, 0, 1);
   fHistRhoStatusCent = BookTH2F("fHistRhoStatusCent", "centrality", "status [0=ok, 1=failed]", 101, -1, 100, 2, -.5, 1.5);
+  if(fFitMethod == kLinearFitValidation) fHistLinearFitValidation = BookTH2F("fHistLinearFitValidation", "parameter [0=#rho_{0}, 1=v_{2}, 2=v_{3}]", "closed form - fit (#rho_{0}: relative)", 3, -.5, 2.5, 200, -.1, .1);
   // vn profiles
   Float_t temp[fCentralityClasses->GetSize()];
   for(Int_t i(0); i < fCentralityClasses->GetSize(); i++) temp[i] = fCentralityClasses->At(i);
@@ -470,8 +474,14 @@ void AliAnalysisTaskLocalRho::CalculateEventPlaneVZERO(Double_t vzero[2][2]) con
     // prior to this task (make sure the calibration is available for the dataset
     // you want to use)
     Double_t a(0), b(0), c(0), d(0), e(0), f(0), g(0), h(0);
-    vzero[0][0] = InputEvent()->GetEventplane()->CalculateVZEROEventPlane(InputEvent(), 8, 2, a, b);
-    vzero[1][0] = InputEvent()->GetEventplane()->CalculateVZEROEventPlane(InputEvent(), 9, 2, c, d);
+    if(fReuseV0EventPlane) {
+      // second harmonic event planes were already retrieved from the header in RetrieveEventObjects
+      vzero[0][0] = fEPV0A;
+      vzero[1][0] = fEPV0C;
+    } else {
+      vzero[0][0] = InputEvent()->GetEventplane()->CalculateVZEROEventPlane(InputEvent(), 8, 2, a, b);
+      vzero[1][0] = InputEvent()->GetEventplane()->CalculateVZEROEventPlane(InputEvent(), 9, 2, c, d);
+    }
     vzero[0][1] = InputEvent()->GetEventplane()->CalculateVZEROEventPlane(InputEvent(), 8, 3, e, f);
     vzero[1][1] = InputEvent()->GetEventplane()->CalculateVZEROEventPlane(InputEvent(), 9, 3, g, h);
     return;
@@ -931,7 +941,25 @@ Bool_t AliAnalysisTaskLocalRho::CorrectRho(Double_t psi2, Double_t psi3)
   } break;
   default : break;
   }
-  _tempSwap.Fit(fFitModulation, fFitModulationOptions.Data(), "", 0, TMath::TwoPi());
+  if(fFitMethod == kTF1Fit || !FitModulationLinear(_tempSwap)) {
+    _tempSwap.Fit(fFitModulation, fFitModulationOptions.Data(), "", 0, TMath::TwoPi());
+  } else if(fFitMethod == kLinearFitValidation) {
+    // redo the fit with minuit, compare, and continue with the closed form estimate
+    Int_t nPar(fFitModulation->GetNpar());
+    Double_t linearChi2(fFitModulation->GetChisquare());
+    Int_t linearNDF(fFitModulation->GetNDF());
+    Double_t linear[8];
+    for(Int_t i(0); i < nPar && i < 8; i++) linear[i] = fFitModulation->GetParameter(i);
+    _tempSwap.Fit(fFitModulation, fFitModulationOptions.Data(), "", 0, TMath::TwoPi());
+    if(fHistLinearFitValidation) {
+      if(fFitModulation->GetParameter(0) != 0) fHistLinearFitValidation->Fill(0., linear[0]/fFitModulation->GetParameter(0) - 1.);
+      if(nPar > 3) fHistLinearFitValidation->Fill(1., TMath::Abs(linear[3]) - TMath::Abs(fFitModulation->GetParameter(3)));
+      if(nPar > 7) fHistLinearFitValidation->Fill(2., TMath::Abs(linear[7]) - TMath::Abs(fFitModulation->GetParameter(7)));
+    }
+    for(Int_t i(0); i < nPar && i < 8; i++) fFitModulation->SetParameter(i, linear[i]);
+    fFitModulation->SetChisquare(linearChi2);
+    fFitModulation->SetNDF(linearNDF);
+  }
   // the quality of the fit is evaluated from 1 - the cdf of the chi square distribution
   Double_t CDF(1.-ChiSquareCDF(fFitModulation->GetNDF(), fFitModulation->GetChisquare()));
   if(fFillHistograms) fHistPvalueCDF->Fill(CDF);
@@ -994,6 +1022,100 @@ Bool_t AliAnalysisTaskLocalRho::CorrectRho(Double_t psi2, Double_t psi3)
   return kTRUE;
 }
 
+//_____________________________________________________________________________
+Bool_t AliAnalysisTaskLocalRho::FitModulationLinear(const TH1& hist)
+{
+  // Closed form estimate of the modulation parameters, replacing the minuit fit of fFitModulation
+  // rho(phi) = rho0 * (1 + k * (v2 cos(n1(phi-psi2)) + v3 cos(n2(phi-psi3)))) is linear in
+  // (rho0, rho0*v2, rho0*v3) for fixed event planes, and for free event planes (kFourierSeries) in
+  // (rho0, rho0*v2 cos(n1 psi2), rho0*v2 sin(n1 psi2), ...), so the least squares solution follows from
+  // the normal equations. as in the fit, option 'I' uses the bin averages of the basis functions and
+  // option 'W' sets all weights to 1. the chi2 and ndf are stored in fFitModulation for the p-value cut
+  // returns kFALSE if the modulation type or the histogram do not allow a closed form estimate, or if
+  // a likelihood fit is requested (option 'L'), which the least squares solution does not reproduce
+  #ifdef ALIANALYSISTASKLOCALRHO_DEBUG_FLAG_0
+      printf("__FILE__ = %s \n __LINE __ %i , __FUNC__ %s \n ", __FILE__, __LINE__, __func__);
+  #endif
+  if(fFitModulationOptions.Contains("L")) return kFALSE;
+  Int_t nHarm(0);
+  Bool_t freePsi(kFALSE);
+  switch (fFitModulationType) {
+  case kNoFit : break;
+  case kV2 : case kV3 : { nHarm = 1; } break;
+  case kCombined : { nHarm = 2; } break;
+  case kFourierSeries : { nHarm = 2; freePsi = kTRUE; } break;
+  default : return kFALSE;
+  }
+  Double_t k(fFitModulation->GetParameter(2));
+  Double_t harm[2] = {fFitModulation->GetParameter(2), (nHarm > 1) ? fFitModulation->GetParameter(5) : 0.};
+  Double_t psi[2] = {freePsi ? 0. : fFitModulation->GetParameter(4), (nHarm > 1 && !freePsi) ? fFitModulation->GetParameter(6) : 0.};
+  Int_t nPar((fFitModulationType == kNoFit) ? 0 : 1 + (freePsi ? 2 : 1)*nHarm);
+  Bool_t integral(fFitModulationOptions.Contains("I")), unitWeights(fFitModulationOptions.Contains("W"));
+  Int_t nBins(hist.GetNbinsX());
+  // basis functions per bin: [0] constant, then cos (and sin for free event planes) per harmonic
+  Double_t basis[200][5];
+  if(nBins > 200) return kFALSE;
+  for(Int_t i(0); i < nBins; i++) {
+    Double_t lo(hist.GetXaxis()->GetBinLowEdge(i+1)), hi(hist.GetXaxis()->GetBinUpEdge(i+1)), x(.5*(lo+hi));
+    basis[i][0] = 1.;
+    for(Int_t h(0); h < nHarm; h++) {
+      Double_t n(harm[h]);
+      Double_t c((integral) ? (TMath::Sin(n*(hi-psi[h]))-TMath::Sin(n*(lo-psi[h])))/(n*(hi-lo)) : TMath::Cos(n*(x-psi[h])));
+      if(freePsi) {
+        basis[i][1+2*h] = k*c;
+        basis[i][2+2*h] = k*((integral) ? (TMath::Cos(n*lo)-TMath::Cos(n*hi))/(n*(hi-lo)) : TMath::Sin(n*x));
+      } else basis[i][1+h] = k*c;
+    }
+  }
+  Double_t sol[5] = {fFitModulation->GetParameter(0), 0., 0., 0., 0.};
+  Int_t nPoints(0);
+  if(nPar > 0) {
+    TMatrixDSym a(nPar);
+    TVectorD b(nPar);
+    for(Int_t i(0); i < nBins; i++) {
+      Double_t y(hist.GetBinContent(i+1)), e(hist.GetBinError(i+1));
+      if(e <= 0) continue;
+      Double_t w((unitWeights) ? 1. : 1./(e*e));
+      nPoints++;
+      for(Int_t r(0); r < nPar; r++) {
+        b(r) += w*y*basis[i][r];
+        for(Int_t c(0); c <= r; c++) a(r, c) += w*basis[i][r]*basis[i][c];
+      }
+    }
+    if(nPoints <= nPar) return kFALSE;
+    for(Int_t r(0); r < nPar; r++) for(Int_t c(0); c < r; c++) a(c, r) = a(r, c);
+    TDecompChol chol(a);
+    if(!chol.Decompose() || !chol.Solve(b)) return kFALSE;
+    for(Int_t r(0); r < nPar; r++) sol[r] = b(r);
+    if(sol[0] <= 0) return kFALSE;
+    fFitModulation->SetParameter(0, sol[0]);
+    if(freePsi) {
+      fFitModulation->SetParameter(3, TMath::Sqrt(sol[1]*sol[1]+sol[2]*sol[2])/sol[0]);
+      fFitModulation->SetParameter(4, TMath::ATan2(sol[2], sol[1])/harm[0]);
+      fFitModulation->SetParameter(7, TMath::Sqrt(sol[3]*sol[3]+sol[4]*sol[4])/sol[0]);
+      fFitModulation->SetParameter(6, TMath::ATan2(sol[4], sol[3])/harm[1]);
+    } else {
+      fFitModulation->SetParameter(3, sol[1]/sol[0]);
+      if(nHarm > 1) fFitModulation->SetParameter(7, sol[2]/sol[0]);
+    }
+  }
+  // chi2 of the solution, from the bin errors
+  Double_t chi2(0);
+  nPoints = 0;
+  for(Int_t i(0); i < nBins; i++) {
+    Double_t y(hist.GetBinContent(i+1)), e(hist.GetBinError(i+1));
+    if(e <= 0) continue;
+    Double_t f(0);
+    for(Int_t r(0); r < TMath::Max(nPar, 1); r++) f += sol[r]*basis[i][r];
+    chi2 += (y-f)*(y-f)/(e*e);
+    nPoints++;
+  }
+  fFitModulation->SetChisquare(chi2);
+  fFitModulation->SetNDF(nPoints - nPar);
+  fFitModulation->SetNumberFitPoints(nPoints);
+  return kTRUE;
+}
+
 //_____________________________________________________________________________
 void AliAnalysisTaskLocalRho::FillAnalysisSummaryHistogram() const
 {
@@ -1027,6 +1149,10 @@ void AliAnalysisTaskLocalRho::FillAnalysisSummaryHistogram() const
   fHistAnalysisSummary->SetBinContent(41, (int)fRebinSwapHistoOnTheFly);
   fHistAnalysisSummary->GetXaxis()->SetBinLabel(42, "fUsePtWeight");
   fHistAnalysisSummary->SetBinContent(42, (int)fUsePtWeight);
+  fHistAnalysisSummary->GetXaxis()->SetBinLabel(43, "fFitMethod");
+  fHistAnalysisSummary->SetBinContent(43, (int)fFitMethod);
+  fHistAnalysisSummary->GetXaxis()->SetBinLabel(44, "fReuseV0EventPlane");
+  fHistAnalysisSummary->SetBinContent(44, (int)fReuseV0EventPlane);
   fHistAnalysisSummary->GetXaxis()->SetBinLabel(45, "fLocalJetMinEta");
   fHistAnalysisSummary->SetBinContent(45,fLocalJetMinEta );
   fHistAnalysisSummary->GetXaxis()->SetBinLabel(46, "fLocalJetMaxEta");
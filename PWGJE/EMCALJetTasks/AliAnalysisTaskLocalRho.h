@@ -70,6 +70,7 @@ class AliAnalysisTaskLocalRho : public AliAnalysisTaskEmcalJet {
   enum detectorType       { kTPC, kVZEROA, kVZEROC, kVZEROComb};  // detector that was used
   enum qcRecovery         { kFixedRho, kNegativeVn, kTryFit };    // how to deal with negative cn value for qcn value
   enum runModeType        { kLocal, kGrid };                      // run mode type
+  enum fitMethodType      { kTF1Fit, kLinearFit, kLinearFitValidation }; // minuit fit (default), closed form estimate, closed form estimate validated by minuit fit
   // constructors, destructor
   AliAnalysisTaskLocalRho();
   AliAnalysisTaskLocalRho(const char *name, runModeType type);
@@ -114,6 +115,8 @@ class AliAnalysisTaskLocalRho : public AliAnalysisTaskEmcalJet {
   void                    SetModulationFitType(fitModulationType type)    {fFitModulationType = type; }
   void                    SetQCnRecoveryType(qcRecovery type)             {fQCRecovery = type; }
   void                    SetModulationFitOptions(TString opt)            {fFitModulationOptions = opt; }
+  void                    SetModulationFitMethod(fitMethodType m)         {fFitMethod = m; }
+  void                    SetReuseV0EventPlane(Bool_t r)                  {fReuseV0EventPlane = r; }
   void                    SetReferenceDetector(detectorType type)         {fDetectorType = type; }
   void                    SetUsePtWeight(Bool_t w)                        {fUsePtWeight = w; }
   void                    SetUsePtWeightErrorPropagation(Bool_t w)        {fUsePtWeightErrorPropagation = w;}
@@ -141,6 +144,7 @@ class AliAnalysisTaskLocalRho : public AliAnalysisTaskEmcalJet {
   Bool_t                  QCnRecovery(Double_t psi2, Double_t psi3);
   // analysis details
   Bool_t                  CorrectRho(Double_t psi2, Double_t psi3);
+  Bool_t                  FitModulationLinear(const TH1& hist);
   void                    FillEventPlaneHistograms(Double_t psi2, Double_t psi3) const;
   void                    FillAnalysisSummaryHistogram() const;
   // track selection
@@ -170,6 +174,8 @@ class AliAnalysisTaskLocalRho : public AliAnalysisTaskEmcalJet {
   TString                 fFitModulationOptions;  ///< fit options for modulation fit
   runModeType             fRunModeType;           ///< run mode type 
   TF1*                    fFitModulation;         ///< modulation fit for rho
+  fitMethodType           fFitMethod;             ///< method used to determine the modulation parameters
+  Bool_t                  fReuseV0EventPlane;     ///< take psi2 of V0A / V0C from the event plane retrieved by the base task
   Float_t                 fMinPvalue;             ///< minimum value of p
   Float_t                 fMaxPvalue;             ///< maximum value of p
   // additional jet cuts (most are inherited)
@@ -182,6 +188,7 @@ class AliAnalysisTaskLocalRho : public AliAnalysisTaskEmcalJet {
   // general qa histograms
   TH1F*                   fHistPvalueCDF;         //!<! cdf value of chisquare p
   TH2F*                   fHistRhoStatusCent;     //!<! status of rho vs centrality
+  TH2F*                   fHistLinearFitValidation; //!<! difference between closed form estimate and minuit fit
   // general settings
   Bool_t                  fAbsVnHarmonics;                ///< force postive local rho
   Float_t                 fExcludeLeadingJetsFromFit;     ///< exclude n leading jets from fit
@@ -204,6 +211,6 @@ class AliAnalysisTaskLocalRho : public AliAnalysisTaskEmcalJet {
   AliAnalysisTaskLocalRho(const AliAnalysisTaskLocalRho&);                  // not implemented
   AliAnalysisTaskLocalRho& operator=(const AliAnalysisTaskLocalRho&);       // not implemented
 
-  ClassDef(AliAnalysisTaskLocalRho, 6);
+  ClassDef(AliAnalysisTaskLocalRho, 7);
 };
 #endif
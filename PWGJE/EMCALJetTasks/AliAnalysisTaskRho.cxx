@@ -41,6 +41,9 @@ Bool_t AliAnalysisTaskRho::Run()
   if (fOutRhoScaled)
     fOutRhoScaled->SetVal(0);
 
+  if (fRhoEstimator == kGridMedian)
+    return RunGridMedian();
+
   if (!fJets){
     AliErrorStream() << "No jet container attached" << std::endl;
     return kFALSE;
@@ -104,7 +107,7 @@ Bool_t AliAnalysisTaskRho::Run()
 
   if (NjetAcc > 0) {
     //find median value
-    Double_t rho = TMath::Median(NjetAcc, rhovec);
+    Double_t rho = Median(NjetAcc, rhovec);
     fOutRho->SetVal(rho);
 
     if (fOutRhoScaled) {
@@ -24,12 +24,15 @@
  * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
  ************************************************************************************/
+#include <algorithm>
+
 #include <TFile.h>
 #include <TF1.h>
 #include <TH1F.h>
 #include <TH2F.h>
 #include <TH3F.h>
 #include <TClonesArray.h>
+#include <TMath.h>
 #include <TGrid.h>
 
 #include "AliLog.h"
@@ -38,6 +41,7 @@
 #include "AliParticleContainer.h"
 #include "AliClusterContainer.h"
 #include "AliVVZERO.h"
+#include "AliTLorentzVector.h"
 
 #include "AliAnalysisTaskRhoBase.h"
 
@@ -54,6 +58,13 @@ AliAnalysisTaskRhoBase::AliAnalysisTaskRhoBase() :
   fInEventSigmaRho(35.83),
   fAttachToEvent(kTRUE),
   fIsPbPb(kTRUE),
+  fRhoEstimator(kJetMedian),
+  fGridCellSize(0.55),
+  fGridEtaMin(-0.9),
+  fGridEtaMax(0.9),
+  fGridPhiMin(0),
+  fGridPhiMax(TMath::TwoPi()),
+  fGridCellPt(),
   fOutRho(0),
   fOutRhoScaled(0),
   fCompareRho(0),
@@ -96,6 +107,13 @@ AliAnalysisTaskRhoBase::AliAnalysisTaskRhoBase(const char *name, Bool_t histo) :
   fInEventSigmaRho(35.83),
   fAttachToEvent(kTRUE),
   fIsPbPb(kTRUE),
+  fRhoEstimator(kJetMedian),
+  fGridCellSize(0.55),
+  fGridEtaMin(-0.9),
+  fGridEtaMax(0.9),
+  fGridPhiMin(0),
+  fGridPhiMax(TMath::TwoPi()),
+  fGridCellPt(),
   fOutRho(0),
   fOutRhoScaled(0),
   fCompareRho(0),
@@ -291,6 +309,61 @@ Bool_t AliAnalysisTaskRhoBase::Run()
   return kTRUE;
 }
 
+Double_t AliAnalysisTaskRhoBase::Median(Int_t n, Double_t *values)
+{
+  if (n <= 0) return 0;
+
+  Int_t half = n / 2;
+  std::nth_element(values, values + half, values + n);
+  Double_t median = values[half];
+  // for even size the lower central value is the largest one of the lower half
+  if (n % 2 == 0) median = 0.5 * (median + *std::max_element(values, values + half));
+
+  return median;
+}
+
+Double_t AliAnalysisTaskRhoBase::GetGridMedianRho()
+{
+  // same binning as the FastJet grid estimator: the requested cell size is rounded
+  // such that an integer number of cells covers the grid range
+  Int_t nEta = TMath::Max(1, TMath::Nint((fGridEtaMax - fGridEtaMin) / fGridCellSize));
+  Int_t nPhi = TMath::Max(1, TMath::Nint((fGridPhiMax - fGridPhiMin) / fGridCellSize));
+  Double_t dEta = (fGridEtaMax - fGridEtaMin) / nEta;
+  Double_t dPhi = (fGridPhiMax - fGridPhiMin) / nPhi;
+
+  fGridCellPt.assign(nEta * nPhi, 0.);
+
+  TIter nextPartCont(&fParticleCollArray);
+  TIter nextClusCont(&fClusterCollArray);
+  for (auto next : {&nextPartCont, &nextClusCont}) {
+    AliEmcalContainer *cont = 0;
+    while ((cont = static_cast<AliEmcalContainer*>((*next)()))) {
+      for (auto mom : cont->accepted_momentum()) {
+        Int_t iEta = TMath::FloorNint((mom.first.Eta() - fGridEtaMin) / dEta);
+        Int_t iPhi = TMath::FloorNint((mom.first.Phi_0_2pi() - fGridPhiMin) / dPhi);
+        if (iEta < 0 || iEta >= nEta || iPhi < 0 || iPhi >= nPhi) continue;
+        fGridCellPt[iEta * nPhi + iPhi] += mom.first.Pt();
+      }
+    }
+  }
+
+  // cells are equal in size: the median density is the median pt sum over the cell area
+  return Median(fGridCellPt.size(), fGridCellPt.data()) / (dEta * dPhi);
+}
+
+Bool_t AliAnalysisTaskRhoBase::RunGridMedian()
+{
+  Double_t rho = GetGridMedianRho();
+  fOutRho->SetVal(rho);
+
+  if (fOutRhoScaled) {
+    Double_t rhoScaled = rho * GetScaleFactor(fCent);
+    fOutRhoScaled->SetVal(rhoScaled);
+  }
+
+  return kTRUE;
+}
+
 Bool_t AliAnalysisTaskRhoBase::FillHistograms() 
 {
   Int_t Ntracks   = 0;
@@ -34,6 +34,8 @@ class TH2F;
 class TH3F;
 class AliRhoParameter;
 
+#include <vector>
+
 #include "AliAnalysisTaskEmcalJet.h"
 
 /**
@@ -44,9 +46,24 @@ class AliRhoParameter;
  * @since May 17, 2012
  * 
  * Calculates parameterized rho for given centrality independent of input.
+ *
+ * Derived tasks computing rho as the median of the kT jet pt densities can
+ * alternatively use a grid median estimator (kGridMedian), in the spirit of the
+ * FastJet GridMedianBackgroundEstimator: the accepted tracks and clusters are
+ * projected on a grid of eta-phi cells and rho is the median of the cell pt densities.
+ * This requires no (ghosted) jet finding for the background.
  */
 class AliAnalysisTaskRhoBase : public AliAnalysisTaskEmcalJet {
  public:
+  /**
+   * @enum ERhoEstimator_t
+   * @brief Estimator used for the median rho calculation
+   */
+  enum ERhoEstimator_t {
+    kJetMedian  = 0,  ///< median of the pt densities of the background jets
+    kGridMedian = 1   ///< median of the pt densities of a grid of eta-phi cells
+  };
+
   /**
    * @brief Dummy constructor, for ROOT I/O
    */
@@ -85,9 +102,24 @@ class AliAnalysisTaskRhoBase : public AliAnalysisTaskEmcalJet {
   void                   SetInEventSigmaRho(Double_t s)                        { fInEventSigmaRho      = s       ;                   }
   void                   SetAttachToEvent(Bool_t a)                            { fAttachToEvent        = a       ;                   }
   void                   SetSmallSystem(Bool_t setter = kTRUE)                 { fIsPbPb               = !setter ;                   }
+  void                   SetRhoEstimator(ERhoEstimator_t e)                    { fRhoEstimator         = e       ;                   }
+  void                   SetGridCellSize(Double_t s)                           { fGridCellSize         = s       ;                   }
+  void                   SetGridEtaRange(Double_t emi, Double_t ema)           { fGridEtaMin           = emi     ; fGridEtaMax = ema; }
+  void                   SetGridPhiRange(Double_t pmi, Double_t pma)           { fGridPhiMin           = pmi     ; fGridPhiMax = pma; }
 
   const char*            GetOutRhoName() const                                 { return fOutRhoName.Data()       ;                   }
   const char*            GetOutRhoScaledName() const                           { return fOutRhoScaledName.Data() ;                   }
+  ERhoEstimator_t        GetRhoEstimator() const                               { return fRhoEstimator            ;                   }
+
+  /**
+   * @brief Median of an array, same definition as TMath::Median (mean of the two central values for even size).
+   *
+   * Uses a partial selection instead of a full sort. The order of the array is modified.
+   * @param n Size of the array
+   * @param values Array of values
+   * @return Median of the values, 0 for an empty array
+   */
+  static Double_t        Median(Int_t n, Double_t *values);
 
  protected:
   /**
@@ -120,6 +152,19 @@ class AliAnalysisTaskRhoBase : public AliAnalysisTaskEmcalJet {
    */
   virtual Double_t       GetScaleFactor(Double_t cent);
 
+  /**
+   * @brief Calculate rho as the median of the pt densities of the grid cells,
+   * using the accepted tracks and clusters of all the attached containers.
+   * @return Median pt density
+   */
+  Double_t               GetGridMedianRho();
+
+  /**
+   * @brief Set the output rho objects using the grid median estimator.
+   * @return Always true
+   */
+  Bool_t                 RunGridMedian();
+
   TString                fOutRhoName;                    ///< name of output rho object
   TString                fOutRhoScaledName;              ///< name of output scaled rho object
   TString                fCompareRhoName;                ///< name of rho object to compare
@@ -129,6 +174,13 @@ class AliAnalysisTaskRhoBase : public AliAnalysisTaskEmcalJet {
   Double_t               fInEventSigmaRho;               ///< in-event sigma rho
   Bool_t                 fAttachToEvent;                 ///< whether or not attach rho to the event objects list
   Bool_t                 fIsPbPb;                        ///< different histogram ranges for pp/pPb and PbPb
+  ERhoEstimator_t        fRhoEstimator;                  ///< estimator used by the derived median rho tasks
+  Double_t               fGridCellSize;                  ///< requested eta and phi size of the grid cells
+  Double_t               fGridEtaMin;                    ///< minimum eta of the grid
+  Double_t               fGridEtaMax;                    ///< maximum eta of the grid
+  Double_t               fGridPhiMin;                    ///< minimum phi of the grid
+  Double_t               fGridPhiMax;                    ///< maximum phi of the grid
+  std::vector<Double_t>  fGridCellPt;                    //!<! pt sums of the grid cells in the current event
   
   AliRhoParameter       *fOutRho;                        //!<! output rho object
   AliRhoParameter       *fOutRhoScaled;                  //!<! output scaled rho object
@@ -161,6 +213,6 @@ class AliAnalysisTaskRhoBase : public AliAnalysisTaskEmcalJet {
   AliAnalysisTaskRhoBase(const AliAnalysisTaskRhoBase&);             // not implemented
   AliAnalysisTaskRhoBase& operator=(const AliAnalysisTaskRhoBase&);  // not implemented
   
-  ClassDef(AliAnalysisTaskRhoBase, 11); // Rho base task
+  ClassDef(AliAnalysisTaskRhoBase, 12); // Rho base task
 };
 #endif
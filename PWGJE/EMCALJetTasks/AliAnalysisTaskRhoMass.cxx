@@ -33,6 +33,7 @@
 #include "AliEmcalJet.h"
 #include "AliLog.h"
 #include "AliRhoParameter.h"
+#include "AliAnalysisTaskRhoBase.h"
 
 ClassImp(AliAnalysisTaskRhoMass)
 
@@ -145,7 +146,7 @@ Bool_t AliAnalysisTaskRhoMass::Run()
 
   if (NjetAcc > 0) {
     //find median value
-    Double_t rhom = TMath::Median(NjetAcc, rhomvec);
+    Double_t rhom = AliAnalysisTaskRhoBase::Median(NjetAcc, rhomvec);
     fOutRhoMass->SetVal(rhom);
 
     Int_t Ntracks = fTracks->GetEntries();
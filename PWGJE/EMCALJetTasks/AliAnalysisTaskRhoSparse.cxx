@@ -83,6 +83,9 @@ Bool_t AliAnalysisTaskRhoSparse::Run()
   if (fOutRhoScaled)
     fOutRhoScaled->SetVal(0);
 
+  if (fRhoEstimator == kGridMedian)
+    return RunGridMedian();
+
   if (!fJets)
     return kFALSE;
   const Int_t Njets = fJets->GetEntries();
@@ -223,7 +226,7 @@ Bool_t AliAnalysisTaskRhoSparse::Run()
 
   if (NjetAcc > 0) {
     //find median value
-    Double_t rho = TMath::Median(NjetAcc, rhovec);
+    Double_t rho = Median(NjetAcc, rhovec);
 
     if(fRhoCMS){
       rho = rho * OccCorr;
@@ -0,0 +1,122 @@
+/************************************************************************************
+ * Copyright (C) 2017, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#include <algorithm>
+
+#include <TMath.h>
+
+#include "AliEmcalJet.h"
+#include "AliEmcalJetMatcherKDTree.h"
+
+namespace PWGJE {
+
+  namespace EMCALJetTasks {
+
+  AliEmcalJetMatcherKDTree::AliEmcalJetMatcherKDTree() :
+      fEta(),
+      fPhi(),
+      fJetIndex(),
+      fTree()
+  {
+  }
+
+  void AliEmcalJetMatcherKDTree::Build(const std::vector<AliEmcalJet *> &jets) {
+    fEta.clear();
+    fPhi.clear();
+    fJetIndex.clear();
+    fTree.reset();
+    for(size_t ijet = 0; ijet < jets.size(); ijet++) {
+      if(!jets[ijet]) continue;
+      for(int image = -1; image <= 1; image++) {
+        fEta.push_back(jets[ijet]->Eta());
+        fPhi.push_back(jets[ijet]->Phi() + image * TMath::TwoPi());
+        fJetIndex.push_back(ijet);
+      }
+    }
+    if(fEta.empty()) return;
+
+    fTree.reset(new TKDTreeID(fEta.size(), 2, 1));
+    fTree->SetData(0, fEta.data());
+    fTree->SetData(1, fPhi.data());
+    fTree->Build();
+  }
+
+  Int_t AliEmcalJetMatcherKDTree::FindNearest(const AliEmcalJet &jet, Double_t &distance) {
+    distance = -1.;
+    if(!fTree) return -1;
+    Double_t point[2] = {jet.Eta(), jet.Phi()};
+    Int_t index(-1);
+    fTree->FindNearestNeighbors(point, 1, &index, &distance);
+    return index >= 0 ? fJetIndex[index] : -1;
+  }
+
+  void AliEmcalJetMatcherKDTree::FindInRange(const AliEmcalJet &jet, Double_t range, std::vector<Int_t> &indices) {
+    indices.clear();
+    if(!fTree) return;
+    Double_t point[2] = {jet.Eta(), jet.Phi()};
+    std::vector<Int_t> points;
+    fTree->FindInRange(point, range, points);
+    for(auto ipoint : points) indices.push_back(fJetIndex[ipoint]);
+    std::sort(indices.begin(), indices.end());
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+  }
+
+  Bool_t AliEmcalJetMatcherKDTree::MatchBijective(const std::vector<AliEmcalJet *> &jetsBase, const std::vector<AliEmcalJet *> &jetsTag, Double_t maxDist,
+                                                  std::vector<Int_t> &matchTag, std::vector<Int_t> &matchBase) {
+    matchTag.assign(jetsBase.size(), -1);
+    matchBase.assign(jetsTag.size(), -1);
+    if(jetsBase.empty() || jetsTag.empty()) return kFALSE;
+
+    AliEmcalJetMatcherKDTree treeBase, treeTag;
+    treeBase.Build(jetsBase);
+    treeTag.Build(jetsTag);
+
+    // closest tag jet for each base jet and vice versa
+    std::vector<Int_t> closestTag(jetsBase.size(), -1), closestBase(jetsTag.size(), -1);
+    Double_t distance(-1.);
+    for(size_t ibase = 0; ibase < jetsBase.size(); ibase++) {
+      if(!jetsBase[ibase]) continue;
+      Int_t index = treeTag.FindNearest(*jetsBase[ibase], distance);
+      if(index >= 0 && distance < maxDist) closestTag[ibase] = index;
+    }
+    for(size_t itag = 0; itag < jetsTag.size(); itag++) {
+      if(!jetsTag[itag]) continue;
+      Int_t index = treeBase.FindNearest(*jetsTag[itag], distance);
+      if(index >= 0 && distance < maxDist) closestBase[itag] = index;
+    }
+
+    // "true" correlations: the base jet is the closest to the tag jet and vice versa
+    for(size_t ibase = 0; ibase < jetsBase.size(); ibase++) {
+      Int_t itag = closestTag[ibase];
+      if(itag < 0 || closestBase[itag] != static_cast<Int_t>(ibase)) continue;
+      matchTag[ibase] = itag;
+      matchBase[itag] = ibase;
+    }
+    return kTRUE;
+  }
+
+  }
+}
@@ -0,0 +1,114 @@
+/************************************************************************************
+ * Copyright (C) 2017, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#ifndef ALIEMCALJETMATCHERKDTREE_H
+#define ALIEMCALJETMATCHERKDTREE_H
+
+#include <memory>
+#include <vector>
+#include <Rtypes.h>
+#include <TKDTree.h>
+
+class AliEmcalJet;
+
+namespace PWGJE {
+namespace EMCALJetTasks {
+
+/**
+ * @class AliEmcalJetMatcherKDTree
+ * @brief Geometric neighbour search for jets in the \f$\eta\f$-\f$\varphi\f$ plane based on a kd-tree
+ * @ingroup PWGJEBASE
+ *
+ * Factored out of AliEmcalJetTaggerTaskFast in order to be shared by the
+ * jet matching tasks. The jets are stored together with their images at
+ * \f$\varphi \pm 2\pi\f$, so that the distances found are the same as the
+ * ones from AliEmcalJet::DeltaR for distances below \f$\pi\f$.
+ *
+ * Usage:
+ * ~~~{.cxx}
+ * AliEmcalJetMatcherKDTree matcher;
+ * matcher.Build(jetsTag);
+ * Double_t distance(-1.);
+ * Int_t index = matcher.FindNearest(*jetBase, distance);  // index in jetsTag
+ * ~~~
+ */
+class AliEmcalJetMatcherKDTree {
+public:
+  AliEmcalJetMatcherKDTree();
+  ~AliEmcalJetMatcherKDTree() {}
+
+  /**
+   * @brief Build the kd-tree for a set of jets
+   * @param[in] jets Jets to search in, indices returned by the search functions refer to this vector
+   */
+  void Build(const std::vector<AliEmcalJet *> &jets);
+
+  /**
+   * @brief Find the jet closest to a given jet
+   * @param[in] jet Jet for which the closest neighbour is searched
+   * @param[out] distance Distance in \f$\eta\f$-\f$\varphi\f$ to the closest jet
+   * @return Index of the closest jet (-1 if no jets are stored)
+   */
+  Int_t FindNearest(const AliEmcalJet &jet, Double_t &distance);
+
+  /**
+   * @brief Find all jets within a given distance (below \f$\pi\f$) from a jet
+   * @param[in] jet Jet for which the neighbours are searched
+   * @param[in] range Maximum distance in \f$\eta\f$-\f$\varphi\f$
+   * @param[out] indices Indices of the jets in range, in increasing order
+   */
+  void FindInRange(const AliEmcalJet &jet, Double_t range, std::vector<Int_t> &indices);
+
+  /**
+   * @brief Bijective geometric matching of two jet collections
+   *
+   * Pairs are matched if each jet is the closest to the other one and their
+   * distance is below maxDist.
+   *
+   * @param[in] jetsBase Base jets
+   * @param[in] jetsTag Tag jets
+   * @param[in] maxDist Maximum matching distance
+   * @param[out] matchTag Index of the matched tag jet for each base jet (-1 if not matched)
+   * @param[out] matchBase Index of the matched base jet for each tag jet (-1 if not matched)
+   * @return False if one of the collections is empty
+   */
+  static Bool_t MatchBijective(const std::vector<AliEmcalJet *> &jetsBase, const std::vector<AliEmcalJet *> &jetsTag, Double_t maxDist,
+                               std::vector<Int_t> &matchTag, std::vector<Int_t> &matchBase);
+
+private:
+  AliEmcalJetMatcherKDTree(const AliEmcalJetMatcherKDTree &);
+  AliEmcalJetMatcherKDTree &operator=(const AliEmcalJetMatcherKDTree &);
+
+  std::vector<Double_t>       fEta;           ///< Jet eta of the tree points (tree does not own the data)
+  std::vector<Double_t>       fPhi;           ///< Jet phi of the tree points, including the images at \f$\varphi \pm 2\pi\f$
+  std::vector<Int_t>          fJetIndex;      ///< Index of the jet for each tree point
+  std::unique_ptr<TKDTreeID>  fTree;          ///< kd-tree over (eta, phi)
+};
+
+}
+}
+
+#endif
@@ -31,7 +31,6 @@
 #include <TH2.h>
 #include <TH3.h>
 #include <THnSparse.h>
-#include <TKDTree.h>
 
 #include "AliAnalysisManager.h"
 #include "AliEmcalJet.h"
@@ -39,6 +38,7 @@
 #include "AliJetContainer.h"
 #include "AliParticleContainer.h"
 
+#include "AliEmcalJetMatcherKDTree.h"
 #include "AliEmcalJetTaggerTaskFast.h"
 
 /// \cond CLASSIMP
@@ -75,8 +75,6 @@ namespace PWGJE {
 #ifdef JETTAGGERFAST_TEST
       , fIndexErrorRateBase(nullptr)
       , fIndexErrorRateTag(nullptr)
-      , fContainerErrorRateBase(nullptr)
-      , fContainerErrorRateTag(nullptr)
 #endif
   {
     SetMakeGeneralHistograms(kTRUE);
@@ -108,8 +106,6 @@ namespace PWGJE {
 #ifdef JETTAGGERFAST_TEST
       , fIndexErrorRateBase(nullptr)
       , fIndexErrorRateTag(nullptr)
-      , fContainerErrorRateBase(nullptr)
-      , fContainerErrorRateTag(nullptr)
 #endif
   {
     SetMakeGeneralHistograms(kTRUE);
@@ -210,14 +206,10 @@ namespace PWGJE {
     fOutput->Add(fNAccJets);
 
 #ifdef JETTAGGERFAST_TEST
-    fIndexErrorRateBase = new TH1F("indexErrorsBase", "Index errors nearest neighbor base jets", 1, 0.5, 1.5);
-    fIndexErrorRateTag = new TH1F("indexErrorsTag", "Index errors nearest neighbors tag jets", 1, 0.5, 1.5);
-    fContainerErrorRateBase = new TH1F("containerErrorsBase", "Matching errors container - kdtree base jets", 1, 0.5, 1.5);
-    fContainerErrorRateTag = new TH1F("containerErrorsTag", "Matching errors container - kdtree tag jets", 1, 0.5, 1.5);
+    fIndexErrorRateBase = new TH1F("indexErrorsBase", "Nearest neighbor errors base jets", 1, 0.5, 1.5);
+    fIndexErrorRateTag = new TH1F("indexErrorsTag", "Nearest neighbor errors tag jets", 1, 0.5, 1.5);
     fOutput->Add(fIndexErrorRateBase);
     fOutput->Add(fIndexErrorRateTag);
-    fOutput->Add(fContainerErrorRateBase);
-    fOutput->Add(fContainerErrorRateTag);
 #endif
 
     if(fUseSumw2) {
@@ -369,134 +361,58 @@ namespace PWGJE {
                 kNacceptedTag = contTag.GetNAcceptedJets();
     if(!(kNacceptedBase && kNacceptedTag)) return false;
 
-    // Build kd-trees
-    TArrayD etaBase(kNacceptedBase), phiBase(kNacceptedBase),
-            etaTag(kNacceptedTag), phiTag(kNacceptedTag);
-    std::vector<AliEmcalJet *> jetsBase(kNacceptedBase), jetsTag(kNacceptedTag); // the storages are needed later for applying the tagging, in order to avoid multiple occurrence of jet selection
-
-    int countBase(0), countTag(0);
-    for(auto jb : contBase.accepted()) {
-      etaBase[countBase] = jb->Eta();
-      phiBase[countBase] = jb->Phi();
-      jetsBase[countBase] = jb;
-      countBase++;
-    }
-    for(auto jt : contTag.accepted()) {
-      etaTag[countTag] = jt->Eta();
-      phiTag[countTag] = jt->Phi();
-      jetsTag[countTag] = jt;
-      countTag++;
-    }
-    TKDTreeID treeBase(etaBase.GetSize(), 2, 1), treeTag(etaTag.GetSize(), 2, 1);
-    treeBase.SetData(0, etaBase.GetArray());
-    treeBase.SetData(1, phiBase.GetArray());
-    treeBase.Build();
-    treeTag.SetData(0, etaTag.GetArray());
-    treeTag.SetData(1, phiTag.GetArray());
-    treeTag.Build();
-
-    TArrayI faMatchIndexTag(kNacceptedBase), faMatchIndexBase(kNacceptedTag);
-    faMatchIndexBase.Reset(-1);
-    faMatchIndexTag.Reset(-1);
-
-    // find the closest distance to the full jet
-    countBase = 0;
-    for(auto j : contBase.accepted()) {
-      Double_t point[2] = {j->Eta(), j->Phi()};
-      Int_t index(-1); Double_t distance(-1);
-      treeTag.FindNearestNeighbors(point, 1, &index, &distance);
-      // test whether indices are matching:
-      if(index >= 0 && distance < maxDist){
-        AliDebugStream(1) << "Found closest tag jet for " << countBase << " with match index " << index << " and distance " << distance << std::endl;
-        faMatchIndexTag[countBase]=index;
-      } else {
-        AliDebugStream(1) << "Not found closest tag jet for " << countBase << ", distance to closest " << distance << std::endl;
-      }
-
-#ifdef JETTAGGERFAST_TEST
-      if(index>-1){
-        Double_t distanceTest(-1);
-        distanceTest = TMath::Sqrt(TMath::Power(etaTag[index] - j->Eta(), 2) +  TMath::Power(phiTag[index] - j->Phi(), 2));
-        if(TMath::Abs(distanceTest - distance) > DBL_EPSILON){
-          AliDebugStream(1) << "Mismatch in distance from tag jet with index from tree: " << distanceTest << ", distance from tree " << distance << std::endl;
-          fIndexErrorRateBase->Fill(1);
-        }
-      }
-#endif
-
-      countBase++;
-    }
-
-    // other way around
-    countTag = 0;
-    for(auto j : contTag.accepted()){
-      Double_t point[2] = {j->Eta(), j->Phi()};
-      Int_t index(-1); Double_t distance(-1);
-      treeBase.FindNearestNeighbors(point, 1, &index, &distance);
-      if(index >= 0 && distance < maxDist){
-        AliDebugStream(1) << "Found closest base jet for " << countBase << " with match index " << index << " and distance " << distance << std::endl;
-        faMatchIndexBase[countTag]=index;
-      } else {
-        AliDebugStream(1) << "Not found closest tag jet for " << countBase << ", distance to closest " << distance << std::endl;
-      }
-
-#ifdef JETTAGGERFAST_TEST
-      if(index>-1){
-        Double_t distanceTest(-1);
-        distanceTest = TMath::Sqrt(TMath::Power(etaBase[index] - j->Eta(), 2) +  TMath::Power(phiBase[index] - j->Phi(), 2));
-        if(TMath::Abs(distanceTest - distance) > DBL_EPSILON){
-          AliDebugStream(1) << "Mismatch in distance from base jet with index from tree: " << distanceTest << ", distance from tree " << distance << std::endl;
-          fIndexErrorRateTag->Fill(1);
-        }
-      }
-#endif
+    // the storages are needed later for applying the tagging, in order to avoid multiple occurrence of jet selection
+    std::vector<AliEmcalJet *> jetsBase, jetsTag;
+    jetsBase.reserve(kNacceptedBase);
+    jetsTag.reserve(kNacceptedTag);
+    for(auto jb : contBase.accepted()) jetsBase.push_back(jb);
+    for(auto jt : contTag.accepted()) jetsTag.push_back(jt);
 
-      countTag++;
-    }
+    // closest tag jet for each base jet and vice versa, from kd-trees
+    std::vector<Int_t> faMatchIndexTag, faMatchIndexBase;
+    AliEmcalJetMatcherKDTree::MatchBijective(jetsBase, jetsTag, maxDist, faMatchIndexTag, faMatchIndexBase);
 
     // check for "true" correlations
     // these are pairs where the base jet is the closest to the tag jet and vice versa
-    // As the lists are linear a loop over the outer base jet is sufficient.
     AliDebugStream(1) << "Starting true jet loop: nbase(" << kNacceptedBase << "), ntag(" << kNacceptedTag << ")\n";
     for(int ibase = 0; ibase < kNacceptedBase; ibase++) {
       AliDebugStream(2) << "base jet " << ibase << ": match index in tag jet container " << faMatchIndexTag[ibase] << "\n";
-      if(faMatchIndexTag[ibase] > -1){
-       AliDebugStream(2) << "tag jet " << faMatchIndexTag[ibase] << ": matched base jet " << faMatchIndexBase[faMatchIndexTag[ibase]] << "\n";
-      }
-      if(faMatchIndexTag[ibase] > -1 && faMatchIndexBase[faMatchIndexTag[ibase]] == ibase) {
-        AliDebugStream(2) << "found a true match \n";
-        AliEmcalJet *jetBase = jetsBase[ibase],
-                    *jetTag = jetsTag[faMatchIndexTag[ibase]];
-        if(jetBase && jetTag) {
+      if(faMatchIndexTag[ibase] < 0) continue;
+      AliDebugStream(2) << "found a true match \n";
+      AliEmcalJet *jetBase = jetsBase[ibase],
+                  *jetTag = jetsTag[faMatchIndexTag[ibase]];
+      if(!(jetBase && jetTag)) continue;
+      Double_t dR = jetBase->DeltaR(jetTag);
 #ifdef JETTAGGERFAST_TEST
-          if(TMath::Abs(etaBase[ibase] - jetBase->Eta()) > DBL_EPSILON || TMath::Abs(phiBase[ibase] - jetBase->Phi()) > DBL_EPSILON){
-            AliErrorStream() << "Selected incorrect base jet for tagging : eta test(" << jetBase->Eta() << ")/true(" << etaBase[ibase]
-                             << "), phi test(" << jetBase->Phi() << ")/true(" << phiBase[ibase] << ")\n";
-            fContainerErrorRateBase->Fill(1);
-          }
-          if(TMath::Abs(etaTag[faMatchIndexTag[ibase]] - jetTag->Eta()) > DBL_EPSILON || TMath::Abs(phiTag[faMatchIndexTag[ibase]] - jetTag->Phi()) > DBL_EPSILON){
-            AliErrorStream() << "Selected incorrect tag jet for tagging : eta test(" << jetTag->Eta() << ")/true(" << etaTag[faMatchIndexTag[ibase]]
-                             << "), phi test(" << jetTag->Phi() << ")/true(" << phiTag[faMatchIndexTag[ibase]] << ")\n";
-            fContainerErrorRateTag->Fill(1);
-          }
-#endif
-          // Test if the position of the jets correp
-          Double_t dR = jetBase->DeltaR(jetTag);
-          switch(fJetTaggingType){
-          case kTag:
-            jetBase->SetTaggedJet(jetTag);
-            jetBase->SetTagStatus(1);
-
-            jetTag->SetTaggedJet(jetBase);
-            jetTag->SetTagStatus(1);
-            break;
-          case kClosest:
-            jetBase->SetClosestJet(jetTag,dR);
-            jetTag->SetClosestJet(jetBase,dR);
-            break;
-          };
+      // cross check with the brute force search for the closest jets
+      for(auto jt : jetsTag) {
+        if(jetBase->DeltaR(jt) < dR - DBL_EPSILON) {
+          AliDebugStream(1) << "Found tag jet closer than the matched one: " << jetBase->DeltaR(jt) << ", matched " << dR << std::endl;
+          fIndexErrorRateBase->Fill(1);
+          break;
+        }
+      }
+      for(auto jb : jetsBase) {
+        if(jetTag->DeltaR(jb) < dR - DBL_EPSILON) {
+          AliDebugStream(1) << "Found base jet closer than the matched one: " << jetTag->DeltaR(jb) << ", matched " << dR << std::endl;
+          fIndexErrorRateTag->Fill(1);
+          break;
         }
       }
+#endif
+      switch(fJetTaggingType){
+      case kTag:
+        jetBase->SetTaggedJet(jetTag);
+        jetBase->SetTagStatus(1);
+
+        jetTag->SetTaggedJet(jetBase);
+        jetTag->SetTagStatus(1);
+        break;
+      case kClosest:
+        jetBase->SetClosestJet(jetTag,dR);
+        jetTag->SetClosestJet(jetBase,dR);
+        break;
+      };
     }
     return kTRUE;
   }
@@ -48,7 +48,7 @@ namespace EMCALJetTasks {
  * @since Nov 8, 2017
  *
  * Class based on AliAnalysisTaskEmcalJetTagger. Navigation finding closest neighbor
- * however is based on a kd-tree.
+ * however is based on a kd-tree (see AliEmcalJetMatcherKDTree).
  *
  */
 class AliEmcalJetTaggerTaskFast : public AliAnalysisTaskEmcalJet {
@@ -226,10 +226,8 @@ class AliEmcalJetTaggerTaskFast : public AliAnalysisTaskEmcalJet {
   TH3             *fh3PtJetAreaDRConst;          //!<! \f$ p_{t}\f$ jet vs Area vs delta R of constituents
   TH1             *fNAccJets;                    //!<! number of jets per event
 #ifdef JETTAGGERFAST_TEST
-  TH1             *fIndexErrorRateBase;          //!<! Monitoring number of errors between index in kd-tree and data block for base jets
-  TH1             *fIndexErrorRateTag;           //!<! Monitoring number of errors between index in kd-tree and data block for tag jets
-  TH1             *fContainerErrorRateBase;      //!<! Monitoring number of errors between index in kd-tree and jet vector for base jets
-  TH1             *fContainerErrorRateTag;       //!<! Monitoring number of errors between index in kd-tree and jet vector for tag jets
+  TH1             *fIndexErrorRateBase;          //!<! Monitoring number of base jets with a closer tag jet than the matched one
+  TH1             *fIndexErrorRateTag;           //!<! Monitoring number of tag jets with a closer base jet than the matched one
 #endif
   AliEmcalJetTaggerTaskFast(const AliEmcalJetTaggerTaskFast&);            // not implemented
   AliEmcalJetTaggerTaskFast &operator=(const AliEmcalJetTaggerTaskFast&); // not implemented
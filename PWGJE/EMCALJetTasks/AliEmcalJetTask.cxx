@@ -24,6 +24,9 @@
  * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS      *
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                       *
  **************************************************************************************/
+#include <map>
+#include <string>
+#include <thread>
 #include <vector>
 
 #include <TClonesArray.h>
@@ -48,6 +51,8 @@
 #include "AliEmcalJetUtility.h"
 #include "AliParticleContainer.h"
 #include "AliClusterContainer.h"
+#include "AliTrackContainer.h"
+#include "AliMCParticleContainer.h"
 #include "AliEmcalClusterJetConstituent.h"
 #include "AliEmcalParticleJetConstituent.h"
 
@@ -58,6 +63,30 @@ using std::cout;
 using std::endl;
 using std::cerr;
 
+namespace {
+  /// Jet finder that produced a shared jet input or clustering result
+  struct SharedJetFinderEntry {
+    AliEmcalJetTask *fTask;   ///< producer task
+    const AliVEvent *fEvent;  ///< event the result was produced for
+    Long64_t         fEntry;  ///< current entry of the analysis manager when the result was produced
+  };
+
+  std::map<std::string, SharedJetFinderEntry> &SharedJetInputs() {
+    static std::map<std::string, SharedJetFinderEntry> inputs;
+    return inputs;
+  }
+
+  std::map<std::string, SharedJetFinderEntry> &SharedClusterings() {
+    static std::map<std::string, SharedJetFinderEntry> clusterings;
+    return clusterings;
+  }
+
+  Long64_t CurrentEntry() {
+    AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+    return mgr ? mgr->GetCurrentEntry() : -1;
+  }
+}
+
 /// \cond CLASSIMP
 ClassImp(AliEmcalJetTask);
 /// \endcond
@@ -94,6 +123,7 @@ AliEmcalJetTask::AliEmcalJetTask() :
   fRandom(0),
   fLocked(0),
   fFillConstituents(kTRUE),
+  fFillConstituentsView(kFALSE),
   fJetsName(),
   fIsInit(0),
   fIsPSelSet(0),
@@ -103,6 +133,16 @@ AliEmcalJetTask::AliEmcalJetTask() :
   fFillGhost(kFALSE),
   fJets(0),
   fFastJetWrapper("AliEmcalJetTask","AliEmcalJetTask"),
+  fShareClustering(kFALSE),
+  fActiveWrapper(0),
+  fInputKey(),
+  fClusteringKey(),
+  fAddJetAlgo(),
+  fAddRadius(),
+  fAddRecombScheme(),
+  fNThreads(1),
+  fAddWrappers(),
+  fAddJets(),
   fYAMLConfig(),
   fClusterContainerIndexMap(),
   fParticleContainerIndexMap()
@@ -139,6 +179,7 @@ AliEmcalJetTask::AliEmcalJetTask(const char *name) :
   fRandom(0),
   fLocked(0),
   fFillConstituents(kTRUE),
+  fFillConstituentsView(kFALSE),
   fJetsName(),
   fIsInit(0),
   fIsPSelSet(0),
@@ -148,6 +189,16 @@ AliEmcalJetTask::AliEmcalJetTask(const char *name) :
   fFillGhost(kFALSE),
   fJets(0),
   fFastJetWrapper(name,name),
+  fShareClustering(kFALSE),
+  fActiveWrapper(0),
+  fInputKey(),
+  fClusteringKey(),
+  fAddJetAlgo(),
+  fAddRadius(),
+  fAddRecombScheme(),
+  fNThreads(1),
+  fAddWrappers(),
+  fAddJets(),
   fYAMLConfig(),
   fClusterContainerIndexMap(),
   fParticleContainerIndexMap()
@@ -159,6 +210,15 @@ AliEmcalJetTask::AliEmcalJetTask(const char *name) :
  */
 AliEmcalJetTask::~AliEmcalJetTask()
 {
+  for (auto wrapper : fAddWrappers) delete wrapper;
+
+  // make sure no other jet finder picks up a result of this task
+  for (auto registry : {&SharedJetInputs(), &SharedClusterings()}) {
+    for (auto it = registry->begin(); it != registry->end(); ) {
+      if (it->second.fTask == this) it = registry->erase(it);
+      else ++it;
+    }
+  }
 }
 
 /**
@@ -178,6 +238,23 @@ AliEmcalJetUtility* AliEmcalJetTask::AddUtility(AliEmcalJetUtility* utility)
   return utility;
 }
 
+/**
+ * Add a jet definition clustered on the same input as the main jet definition of this task.
+ * The jets are stored in a separate jet collection, whose name is generated
+ * as for the main one. The jet selection of this task is applied, utilities are not
+ * executed. Clusterings are run concurrently if SetNThreads() is larger than 1.
+ * @param algo Jet algorithm
+ * @param r Jet radius
+ * @param reco Recombination scheme
+ */
+void AliEmcalJetTask::AddJetDefinition(EJetAlgo_t algo, Double_t r, ERecoScheme_t reco)
+{
+  if (IsLocked()) return;
+  fAddJetAlgo.push_back(algo);
+  fAddRadius.push_back(r);
+  fAddRecombScheme.push_back(reco);
+}
+
 /**
  * This method is called once before analyzing the first event. It executes
  * the Init() method of all utilities (if any).
@@ -243,6 +320,9 @@ Bool_t AliEmcalJetTask::Run()
   InitEvent();
   // clear the jet array (normally a null operation)
   fJets->Delete();
+  for (auto jets : fAddJets) {
+    if (jets) jets->Delete();
+  }
   Int_t n = FindJets();
 
   if (n == 0) return kFALSE;
@@ -266,14 +346,25 @@ Int_t AliEmcalJetTask::FindJets()
     return 0;
   }
 
+  fActiveWrapper = &fFastJetWrapper;
+  Bool_t shareClustering = IsSharingAllowed();
+  if (shareClustering && FindSharedClustering()) {
+    AliDebug(2,Form("Using the clustering result of another jet finder with key %s", fClusteringKey.Data()));
+    RunJetFinders(kFALSE);
+    return fActiveWrapper->GetInclusiveJets().size();
+  }
+
   fFastJetWrapper.Clear();
 
   AliDebug(2,Form("Jet type = %d", fJetType));
 
+  // the constituent loops are skipped if another jet finder already built the same input
+  Bool_t sharedInput = shareClustering && FindSharedInput();
+
   Int_t iColl = 1;
   TIter nextPartColl(&fParticleCollArray);
   AliParticleContainer* tracks = 0;
-  while ((tracks = static_cast<AliParticleContainer*>(nextPartColl()))) {
+  while (!sharedInput && (tracks = static_cast<AliParticleContainer*>(nextPartColl()))) {
     AliDebug(2,Form("Tracks from collection %d: '%s'. Embedded: %i, nTracks: %i", iColl-1, tracks->GetName(), tracks->GetIsEmbedding(), tracks->GetNParticles()));
     AliParticleIterableMomentumContainer itcont = tracks->accepted_momentum();
     for (AliParticleIterableMomentumContainer::iterator it = itcont.begin(); it != itcont.end(); it++) {
@@ -335,7 +426,7 @@ Int_t AliEmcalJetTask::FindJets()
   iColl = 1;
   TIter nextClusColl(&fClusterCollArray);
   AliClusterContainer* clusters = 0;
-  while ((clusters = static_cast<AliClusterContainer*>(nextClusColl()))) {
+  while (!sharedInput && (clusters = static_cast<AliClusterContainer*>(nextClusColl()))) {
     AliDebug(2,Form("Clusters from collection %d: '%s'. Embedded: %i, nClusters: %i", iColl-1, clusters->GetName(), clusters->GetIsEmbedding(), clusters->GetNClusters()));
     AliClusterIterableMomentumContainer itcont = clusters->accepted_momentum();
     for (AliClusterIterableMomentumContainer::iterator it = itcont.begin(); it != itcont.end(); it++) {
@@ -349,22 +440,185 @@ Int_t AliEmcalJetTask::FindJets()
   if (fFastJetWrapper.GetInputVectors().size() == 0) return 0;
 
   // run jet finder
-  fFastJetWrapper.Run();
+  if (RunJetFinders(kTRUE) == 0 && shareClustering) RegisterSharedClustering();
 
   return fFastJetWrapper.GetInclusiveJets().size();
 }
 
+/**
+ * Runs the jet finder and the additional jet definitions (see AddJetDefinition()) on the
+ * jet input of the event. The additional wrappers receive a copy of the input vectors.
+ * If FastJet has been built with thread safety, the clusterings are distributed over
+ * up to fNThreads threads, since they are independent of each other.
+ * @param runMain If kFALSE only the additional jet definitions are run
+ * @return Status returned by the FastJet wrapper of this task (0 on success)
+ */
+Int_t AliEmcalJetTask::RunJetFinders(Bool_t runMain)
+{
+  std::vector<AliFJWrapper*> wrappers;
+  if (runMain) wrappers.push_back(&fFastJetWrapper);
+  for (auto wrapper : fAddWrappers) {
+    if (!wrapper) continue;
+    wrapper->Clear();
+    wrapper->AddInputVectors(fActiveWrapper->GetInputVectors());
+    wrappers.push_back(wrapper);
+  }
+
+  std::vector<Int_t> status(wrappers.size(), 0);
+#ifdef FASTJET_HAVE_THREAD_SAFETY
+  Int_t nThreads = TMath::Min(fNThreads, static_cast<Int_t>(wrappers.size()));
+  if (nThreads > 1) {
+    std::vector<std::thread> pool;
+    for (Int_t ithread = 0; ithread < nThreads; ithread++) {
+      pool.emplace_back([&wrappers, &status, ithread, nThreads]() {
+        for (UInt_t iwrapper = ithread; iwrapper < wrappers.size(); iwrapper += nThreads) status[iwrapper] = wrappers[iwrapper]->Run();
+      });
+    }
+    for (auto &thread : pool) thread.join();
+  }
+  else
+#endif
+  {
+    for (UInt_t iwrapper = 0; iwrapper < wrappers.size(); iwrapper++) status[iwrapper] = wrappers[iwrapper]->Run();
+  }
+
+  return runMain ? status[0] : 0;
+}
+
+/**
+ * Checks whether the input and the clustering of this jet finder may be shared
+ * with other jet finders. Sharing is disabled when the input is modified
+ * randomly (artificial tracking inefficiency) or when jet utilities are attached,
+ * since they may change the state of the FastJet wrapper.
+ * @return kTRUE if sharing is enabled and allowed
+ */
+Bool_t AliEmcalJetTask::IsSharingAllowed() const
+{
+  if (!fShareClustering || fClusteringKey.IsNull()) return kFALSE;
+  if (fApplyArtificialTrackingEfficiency) return kFALSE;
+  if (fUtilities && fUtilities->GetEntriesFast() > 0) return kFALSE;
+  return AliAnalysisManager::GetAnalysisManager() != 0;
+}
+
+/**
+ * Generates the keys identifying the jet input (particle and cluster containers
+ * with all their selection settings) and the clustering (input, algorithm, radius,
+ * recombination scheme and ghost specification). Jet finders with identical keys
+ * share their results within the same event. Containers of classes which do not
+ * describe all their cuts in AliEmcalContainer::GetSelectionKey() (user-defined
+ * containers) are only shared if the same container object is used.
+ */
+void AliEmcalJetTask::GenerateSharingKeys()
+{
+  fInputKey = "";
+
+  TIter nextPartColl(&fParticleCollArray);
+  AliParticleContainer* tracks = 0;
+  while ((tracks = static_cast<AliParticleContainer*>(nextPartColl()))) {
+    fInputKey += "P:" + GetContainerSharingKey(tracks) + ";";
+  }
+
+  TIter nextClusColl(&fClusterCollArray);
+  AliClusterContainer* clusters = 0;
+  while ((clusters = static_cast<AliClusterContainer*>(nextClusColl()))) {
+    fInputKey += "C:" + GetContainerSharingKey(clusters) + ";";
+  }
+
+  if (fApplyQoverPtShift) fInputKey += TString::Format("Q:%g;", fQoverPtShift);
+
+  fClusteringKey = fInputKey + TString::Format("|%d:%d:%d:%g:%g:%d", fJetType, fJetAlgo, fRecombScheme, fRadius, fGhostArea, fLegacyMode);
+}
+
+/**
+ * Key of a jet input container for the sharing between jet finders.
+ * @param cont Particle or cluster container
+ * @return Selection key for the standard container classes, address of the container otherwise
+ */
+TString AliEmcalJetTask::GetContainerSharingKey(const AliEmcalContainer* cont)
+{
+  TClass* cl = cont->IsA();
+  if (cl == AliParticleContainer::Class() || cl == AliTrackContainer::Class() ||
+      cl == AliMCParticleContainer::Class() || cl == AliClusterContainer::Class()) {
+    return cont->GetSelectionKey();
+  }
+  return TString::Format("%s:%p", cl->GetName(), static_cast<const void*>(cont));
+}
+
+/**
+ * Looks for a jet finder that already clustered the same input with the same
+ * jet definition in the current event. If found, its wrapper is used
+ * to fill the jet branch of this task.
+ * @return kTRUE if a shared clustering result is available
+ */
+Bool_t AliEmcalJetTask::FindSharedClustering()
+{
+  auto entry = SharedClusterings().find(fClusteringKey.Data());
+  if (entry == SharedClusterings().end()) return kFALSE;
+  if (entry->second.fTask == this || entry->second.fEvent != InputEvent() || entry->second.fEntry != CurrentEntry()) return kFALSE;
+
+  fActiveWrapper = &(entry->second.fTask->fFastJetWrapper);
+  return kTRUE;
+}
+
+/**
+ * Looks for a jet finder that already built the same jet input in the current event
+ * and copies its input vectors into the wrapper of this task.
+ * @return kTRUE if a shared jet input was found
+ */
+Bool_t AliEmcalJetTask::FindSharedInput()
+{
+  auto entry = SharedJetInputs().find(fInputKey.Data());
+  if (entry == SharedJetInputs().end()) return kFALSE;
+  if (entry->second.fTask == this || entry->second.fEvent != InputEvent() || entry->second.fEntry != CurrentEntry()) return kFALSE;
+
+  fFastJetWrapper.AddInputVectors(entry->second.fTask->fFastJetWrapper.GetInputVectors());
+  AliDebug(2,Form("Using %d input vectors of another jet finder with key %s", (Int_t)fFastJetWrapper.GetInputVectors().size(), fInputKey.Data()));
+  return kTRUE;
+}
+
+/**
+ * Publishes the jet input and the clustering result of the current event to
+ * the other jet finders with identical keys.
+ */
+void AliEmcalJetTask::RegisterSharedClustering()
+{
+  SharedJetFinderEntry entry = {this, InputEvent(), CurrentEntry()};
+  SharedJetInputs()[fInputKey.Data()] = entry;
+  SharedClusterings()[fClusteringKey.Data()] = entry;
+}
+
 /**
  * This method fills the jet output branch (TClonesArray) with the jet found by the FastJet
  * wrapper. Before filling the jet branch, the utilities are prepared. Then the utilities are
  * called for each jet and finally after jet finding the terminate method of all utilities is called.
+ * The jet branches of the additional jet definitions are filled afterwards, without utilities.
  */
 void AliEmcalJetTask::FillJetBranch()
 {
   PrepareUtilities();
 
+  // clustering result of this task or of another jet finder sharing it
+  FillJetArray(*fActiveWrapper, fJets, fRadius, kTRUE);
+
+  TerminateUtilities();
+
+  for (UInt_t idef = 0; idef < fAddWrappers.size(); idef++) {
+    if (!fAddWrappers[idef]) continue;
+    FillJetArray(*fAddWrappers[idef], fAddJets[idef], fAddRadius[idef], kFALSE);
+  }
+}
+
+/**
+ * Fills a jet array with the jets found by a FastJet wrapper, applying the jet selection of this task.
+ * @param wrapper FastJet wrapper containing the clustering result
+ * @param jets Output jet array
+ * @param radius Jet radius used for the acceptance type
+ * @param execUtilities If kTRUE the utilities are executed for each jet
+ */
+void AliEmcalJetTask::FillJetArray(AliFJWrapper& wrapper, TClonesArray* jets, Double_t radius, Bool_t execUtilities)
+{
   // loop over fastjet jets
-  std::vector<fastjet::PseudoJet> jets_incl = fFastJetWrapper.GetInclusiveJets();
+  std::vector<fastjet::PseudoJet> jets_incl = wrapper.GetInclusiveJets();
   // sort jets according to jet pt
   static Int_t indexes[9999] = {-1};
   GetSortedArray(indexes, jets_incl);
@@ -372,27 +626,27 @@ void AliEmcalJetTask::FillJetBranch()
   AliDebug(1,Form("%d jets found", (Int_t)jets_incl.size()));
   for (UInt_t ijet = 0, jetCount = 0; ijet < jets_incl.size(); ++ijet) {
     Int_t ij = indexes[ijet];
-    AliDebug(3,Form("Jet pt = %f, area = %f", jets_incl[ij].perp(), fFastJetWrapper.GetJetArea(ij)));
+    AliDebug(3,Form("Jet pt = %f, area = %f", jets_incl[ij].perp(), wrapper.GetJetArea(ij)));
 
     if (jets_incl[ij].perp() < fMinJetPt) continue;
-    if (fFastJetWrapper.GetJetArea(ij) < fMinJetArea) continue;
+    if (wrapper.GetJetArea(ij) < fMinJetArea) continue;
     if ((jets_incl[ij].eta() < fJetEtaMin) || (jets_incl[ij].eta() > fJetEtaMax) ||
         (jets_incl[ij].phi() < fJetPhiMin) || (jets_incl[ij].phi() > fJetPhiMax))
       continue;
 
-    AliEmcalJet *jet = new ((*fJets)[jetCount])
+    AliEmcalJet *jet = new ((*jets)[jetCount])
     		          AliEmcalJet(jets_incl[ij].perp(), jets_incl[ij].eta(), jets_incl[ij].phi(), jets_incl[ij].m());
     jet->SetLabel(ij);
 
-    fastjet::PseudoJet area(fFastJetWrapper.GetJetAreaVector(ij));
+    fastjet::PseudoJet area(wrapper.GetJetAreaVector(ij));
     jet->SetArea(area.perp());
     jet->SetAreaEta(area.eta());
     jet->SetAreaPhi(area.phi());
     jet->SetAreaE(area.E());
-    jet->SetJetAcceptanceType(FindJetAcceptanceType(jet->Eta(), jet->Phi_0_2pi(), fRadius));
+    jet->SetJetAcceptanceType(FindJetAcceptanceType(jet->Eta(), jet->Phi_0_2pi(), radius));
 
     // Fill constituent info
-    std::vector<fastjet::PseudoJet> constituents(fFastJetWrapper.GetJetConstituents(ij));
+    std::vector<fastjet::PseudoJet> constituents(wrapper.GetJetConstituents(ij));
     FillJetConstituents(jet, constituents, constituents);
 
     if (fGeom) {
@@ -403,13 +657,11 @@ void AliEmcalJetTask::FillJetBranch()
         jet->SetAxisInEmcal(kTRUE);
     }
 
-    ExecuteUtilities(jet, ij);
+    if (execUtilities) ExecuteUtilities(jet, ij);
 
     AliDebug(2,Form("Added jet n. %d, pt = %f, area = %f, constituents = %d", jetCount, jet->Pt(), jet->Area(), jet->GetNumberOfConstituents()));
     jetCount++;
   }
-
-  TerminateUtilities();
 }
 
 /**
@@ -506,7 +758,36 @@ void AliEmcalJetTask::ExecOnce()
     fFastJetWrapper.SetLegacyMode(kTRUE);
   }
 
+  // setup the wrappers of the additional jet definitions, sharing the input of this task
+  for (UInt_t idef = 0; idef < fAddRadius.size(); idef++) {
+    EJetAlgo_t algo = static_cast<EJetAlgo_t>(fAddJetAlgo[idef]);
+    ERecoScheme_t reco = static_cast<ERecoScheme_t>(fAddRecombScheme[idef]);
+    TString jetsName = AliJetContainer::GenerateJetName(fJetType, algo, reco, fAddRadius[idef], GetParticleContainer(0), GetClusterContainer(0), fJetsTag);
+    if (InputEvent()->FindListObject(jetsName)) {
+      AliError(Form("%s: Object with name %s already in event! Skipping this jet definition", GetName(), jetsName.Data()));
+      fAddWrappers.push_back(0);
+      fAddJets.push_back(0);
+      continue;
+    }
+    TClonesArray *jets = new TClonesArray("AliEmcalJet");
+    jets->SetName(jetsName);
+    ::Info("AliEmcalJetTask::ExecOnce", "Jet collection with name '%s' has been added to the event.", jetsName.Data());
+    InputEvent()->AddObject(jets);
+
+    AliFJWrapper *wrapper = new AliFJWrapper(jetsName, jetsName);
+    wrapper->SetAreaType(fastjet::active_area_explicit_ghosts);
+    wrapper->SetGhostArea(fGhostArea);
+    wrapper->SetR(fAddRadius[idef]);
+    wrapper->SetAlgorithm(ConvertToFJAlgo(algo));
+    wrapper->SetRecombScheme(ConvertToFJRecoScheme(reco));
+    wrapper->SetMaxRap(1);
+    if (fLegacyMode) wrapper->SetLegacyMode(kTRUE);
+    fAddWrappers.push_back(wrapper);
+    fAddJets.push_back(jets);
+  }
+
   InitUtilities();
+  fActiveWrapper = &fFastJetWrapper;
 
   AliAnalysisTaskEmcal::ExecOnce();
 
@@ -514,6 +795,13 @@ void AliEmcalJetTask::ExecOnce()
   // containers' arrays are setup.
   fClusterContainerIndexMap.CopyMappingFrom(AliClusterContainer::GetEmcalContainerIndexMap(), fClusterCollArray);
   fParticleContainerIndexMap.CopyMappingFrom(AliParticleContainer::GetEmcalContainerIndexMap(), fParticleCollArray);
+
+  if (fShareClustering) {
+    GenerateSharingKeys();
+    if (!IsSharingAllowed()) {
+      AliWarning(Form("%s: Sharing of the clustering is not possible with artificial tracking inefficiency or jet utilities, disabling it.", GetName()));
+    }
+  }
 }
 
 /**
@@ -735,6 +1023,7 @@ void AliEmcalJetTask::FillJetConstituents(AliEmcalJet *jet, std::vector<fastjet:
   jet->SetMCPt(mcpt);
   jet->SetPtEmc(emcpt);
   jet->SortConstituents();
+  if (fFillConstituentsView) jet->FillConstituentsView();
 }
 
 /**
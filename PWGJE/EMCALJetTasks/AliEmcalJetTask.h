@@ -72,6 +72,18 @@ namespace fastjet {
  * and its derived classes. Utilities can be added via the AddUtility(AliEmcalJetUtility*) method.
  * All the utilities added in the list will be executed. Users can implement new utilities
  * deriving a new class from AliEmcalJetUtility to interface functionalities of the FastJet contribs.
+ *
+ * Jet finders running on the same input can share their work via SetShareClustering().
+ * Within an event, the jet input (constituent list) is built only once for all the jet
+ * finders using the same containers and cuts, and jet finders that also use the same jet
+ * definition (algorithm, radius, recombination scheme, ghost area) reuse the clustering
+ * of the first one, applying only their own jet selection (pt, area, acceptance).
+ * Sharing is disabled for jet finders with utilities or artificial tracking inefficiency.
+ *
+ * Additional jet definitions (algorithm, radius, recombination scheme) can be clustered
+ * on the same input with AddJetDefinition(), each one written to its own jet collection.
+ * With SetNThreads() the clusterings of an event are distributed over several threads,
+ * provided that FastJet was built with thread safety (FASTJET_HAVE_THREAD_SAFETY).
  */
 class AliEmcalJetTask : public AliAnalysisTaskEmcal {
  public:
@@ -109,6 +121,8 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   void                   SetLegacyMode(Bool_t mode)                 { if (IsLocked()) return; fLegacyMode       = mode  ; }
   void                   SetFillGhost(Bool_t b=kTRUE)               { if (IsLocked()) return; fFillGhost        = b     ; }
   void                   SetRadius(Double_t r)                      { if (IsLocked()) return; fRadius           = r     ; }
+  void                   SetShareClustering(Bool_t b=kTRUE)         { if (IsLocked()) return; fShareClustering  = b     ; }
+  void                   SetNThreads(Int_t n)                       { if (IsLocked()) return; fNThreads         = n     ; }
 
   void                   SetEtaRange(Double_t emi, Double_t ema);
   void                   SetMinJetClusPt(Double_t min);
@@ -118,6 +132,7 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   void                   SetApplyPtDependentTrackingEfficiency(Bool_t b=kTRUE) { if (IsLocked()) return; fApplyPtDependentTrackingEfficiency = b; }
 
   AliEmcalJetUtility*    AddUtility(AliEmcalJetUtility* utility);
+  void                   AddJetDefinition(EJetAlgo_t algo, Double_t r, ERecoScheme_t reco);
 
   Double_t               GetGhostArea()                   { return fGhostArea         ; }
   const char*            GetJetsName()                    { return fJetsName.Data()   ; }
@@ -136,6 +151,10 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   Int_t                  GetRecombScheme()                { return fRecombScheme      ; }
   Double_t               GetTrackEfficiency()             { return fTrackEfficiency   ; }
   Bool_t                 GetTrackEfficiencyOnlyForEmbedding() { return fTrackEfficiencyOnlyForEmbedding; }
+  Bool_t                 GetShareClustering()             { return fShareClustering   ; }
+  Int_t                  GetNThreads()                    { return fNThreads          ; }
+  Int_t                  GetNAdditionalJetDefinitions()   { return fAddRadius.size()  ; }
+  TClonesArray*          GetAdditionalJets(Int_t i)       { return i >= 0 && i < (Int_t)fAddJets.size() ? fAddJets[i] : 0; }
 
   TClonesArray*          GetJets()                        { return fJets              ; }
   TObjArray*             GetUtilities()                   { return fUtilities         ; }
@@ -162,6 +181,17 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
    */
   void                   SetFillJetConsituents(Bool_t doFill) { fFillConstituents = doFill; }
 
+  /**
+   * @brief Switch for filling the contiguous constituent view of the jets
+   *
+   * When enabled the kinematics of the constituents (pt, eta, phi, mass, charge, label) are
+   * copied once per jet into the AliEmcalJet constituent view after jet finding, so that
+   * shape observables in the user tasks can be computed as array reductions.
+   *
+   * @param doFill Switch for filling the constituent view
+   */
+  void                   SetFillConstituentsView(Bool_t doFill) { fFillConstituentsView = doFill; }
+
   static AliEmcalJetTask* AddTaskEmcalJet(
       const TString nTracks                      = "usedefault",
       const TString nClusters                    = "usedefault",
@@ -187,7 +217,15 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
  protected:
 
   Int_t                  FindJets();
+  Bool_t                 FindSharedClustering();
+  Bool_t                 FindSharedInput();
+  void                   RegisterSharedClustering();
+  void                   GenerateSharingKeys();
+  static TString         GetContainerSharingKey(const AliEmcalContainer* cont);
+  Bool_t                 IsSharingAllowed() const;
   void                   FillJetBranch();
+  void                   FillJetArray(AliFJWrapper& wrapper, TClonesArray* jets, Double_t radius, Bool_t execUtilities);
+  Int_t                  RunJetFinders(Bool_t runMain);
   void                   ExecOnce();
   void                   InitEvent();
   void                   InitUtilities();
@@ -226,6 +264,7 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   TRandom3               fRandom;                 //!<! Random number generator for artificial tracking efficiency
   Bool_t                 fLocked;                 ///< true if lock is set
   Bool_t	               fFillConstituents;		 ///< If true jet consituents will be filled to the AliEmcalJet
+  Bool_t                 fFillConstituentsView;   ///< If true the constituent view of the AliEmcalJet will be filled
 
   TString                fJetsName;               //!<!name of jet collection
   Bool_t                 fIsInit;                 //!<!=true if already initialized
@@ -237,6 +276,16 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
 
   TClonesArray          *fJets;                   //!<!jet collection
   AliFJWrapper           fFastJetWrapper;         //!<!fastjet wrapper
+  Bool_t                 fShareClustering;        ///< =true share jet inputs and clustering with jet finders with identical settings
+  AliFJWrapper          *fActiveWrapper;          //!<!wrapper holding the clustering result of the current event (own or shared)
+  TString                fInputKey;               //!<!key identifying the jet input (containers and cuts)
+  TString                fClusteringKey;          //!<!key identifying the clustering (input, algorithm, radius, ghosts)
+  std::vector<Int_t>     fAddJetAlgo;             ///< jet algorithms of the additional jet definitions
+  std::vector<Double_t>  fAddRadius;              ///< radii of the additional jet definitions
+  std::vector<Int_t>     fAddRecombScheme;        ///< recombination schemes of the additional jet definitions
+  Int_t                  fNThreads;               ///< max number of threads used to run the clusterings of an event
+  std::vector<AliFJWrapper*> fAddWrappers;        //!<!fastjet wrappers of the additional jet definitions
+  std::vector<TClonesArray*> fAddJets;            //!<!jet collections of the additional jet definitions
 
   static const Int_t     fgkConstIndexShift;      //!<!contituent index shift
   PWG::Tools::AliYAMLConfiguration fYAMLConfig; ///< yaml configuration
@@ -252,7 +301,7 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   AliEmcalJetTask &operator=(const AliEmcalJetTask&); // not implemented
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalJetTask, 31);
+  ClassDef(AliEmcalJetTask, 34);
   /// \endcond
 };
 #endif
@@ -466,11 +466,16 @@ Bool_t AliEmcalPicoTrackInGridMaker::CreateGridCells() {
   if(!trackCont) return kFALSE;
   trackCont->ResetCurrentID();
   while((track = trackCont->GetNextAcceptParticle())) {
-    if(track->Pt()<fMinCellE) continue;
-    Int_t id = GetGridID(track);
-    Int_t type = GetCellType(track);
+    Double_t pt = track->Pt();
+    if(pt<fMinCellE) continue;
+    //acceptance and cell index from eta,phi evaluated once per track
+    Double_t eta = track->Eta();
+    Double_t phi = track->Phi();
+    Int_t type = GetCellType(eta,phi);
+    if(type<0) continue;
+    Int_t id = GetGridID(eta,phi,type);
     if(id>-1)
-      fCellGrid[type].AddAt(fCellGrid[type].At(id)+track->Pt(),id);
+      fCellGrid[type].AddAt(fCellGrid[type].At(id)+pt,id);
     }
   return kTRUE;
 }
@@ -499,9 +504,75 @@ Bool_t AliEmcalPicoTrackInGridMaker::CreateGridMiniPatches() {
       }
     }
   }
+  CreateMiniPatchSums();
   return kTRUE;
 }
 
+//________________________________________________________________________
+void AliEmcalPicoTrackInGridMaker::CreateMiniPatchSums() {
+  //summed-area tables of the mini patch grids
+  //entry (r,c) holds the sum over all mini patches with row<r and col<c, so that
+  //any rectangle of mini patches is obtained from 4 entries (see GetMiniPatchSum)
+  for(Int_t type = 0; type<2; type++) {
+    Int_t nRow = GetNRowMiniPatches(type);
+    Int_t nCol = GetNColMiniPatches(type);
+    Int_t nSum = (nRow+1)*(nCol+1);
+    fMiniPatchSum[type].Set(nSum);
+    fMiniPatchSum[type].Reset(0.);
+    fActiveMPSum[type].Set(nSum);
+    fActiveMPSum[type].Reset(0);
+    fActiveCellSum[type].Set(nSum);
+    fActiveCellSum[type].Reset(0);
+    if(nRow*nCol>fMiniPatchGrid[type].GetSize()) {
+      AliError(Form("Mini patch grid of type %d smaller than %d x %d",type,nRow,nCol));
+      continue;
+    }
+    Double_t *esum = fMiniPatchSum[type].GetArray();
+    Int_t    *msum = fActiveMPSum[type].GetArray();
+    Int_t    *csum = fActiveCellSum[type].GetArray();
+    for(Int_t row = 0; row<nRow; row++) {
+      Double_t erow = 0.;
+      Int_t    mrow = 0;
+      Int_t    crow = 0;
+      for(Int_t col = 0; col<nCol; col++) {
+        Int_t id = GetMiniPatchID(row,col,type);
+        Double_t e = fMiniPatchGrid[type].At(id);
+        erow += e;
+        if(e>0.) {
+          mrow++;
+          crow += fActiveAreaMP[type].At(id);
+        }
+        Int_t is = (row+1)*(nCol+1)+col+1;
+        Int_t iu = row*(nCol+1)+col+1;
+        esum[is] = esum[iu] + erow;
+        msum[is] = msum[iu] + mrow;
+        csum[is] = csum[iu] + crow;
+      }
+    }
+  }
+}
+
+//________________________________________________________________________
+Double_t AliEmcalPicoTrackInGridMaker::GetMiniPatchSum(const Int_t type, const Int_t row, const Int_t col, const Int_t nRow, const Int_t nCol, Int_t &activeMP, Int_t &activeCells) const {
+  //energy in the nRow x nCol mini patches starting at mini patch (row,col) of detector type X (0: EMCal 1: DCal)
+  //activeMP: number of mini patches with energy, activeCells: number of cells with energy
+  activeMP = 0;
+  activeCells = 0;
+  if(type<0 || type>1) return 0.;
+  Int_t nC = GetNColMiniPatches(type);
+  Int_t nR = GetNRowMiniPatches(type);
+  if(row<0 || col<0 || nRow<1 || nCol<1 || row+nRow>nR || col+nCol>nC) return 0.;
+  if(fMiniPatchSum[type].GetSize()!=(nR+1)*(nC+1)) return 0.;
+  Int_t i00 = row*(nC+1)+col;
+  Int_t i01 = i00+nCol;
+  Int_t i10 = i00+nRow*(nC+1);
+  Int_t i11 = i10+nCol;
+  activeMP = fActiveMPSum[type].At(i11) - fActiveMPSum[type].At(i01) - fActiveMPSum[type].At(i10) + fActiveMPSum[type].At(i00);
+  if(activeMP<1) return 0.; //exactly zero for empty patches, independent of rounding
+  activeCells = fActiveCellSum[type].At(i11) - fActiveCellSum[type].At(i01) - fActiveCellSum[type].At(i10) + fActiveCellSum[type].At(i00);
+  return fMiniPatchSum[type].At(i11) - fMiniPatchSum[type].At(i01) - fMiniPatchSum[type].At(i10) + fMiniPatchSum[type].At(i00);
+}
+
 //________________________________________________________________________
 Int_t AliEmcalPicoTrackInGridMaker::GetNRowMiniPatches(const Int_t type) const {
   //returns number of rows of mini patches in detector of type X (0: EMCal 1: DCal)
@@ -527,24 +598,18 @@ Bool_t AliEmcalPicoTrackInGridMaker::CreateGridPatches(const Int_t dim, const In
   Int_t stepm = (Int_t)(dim/2.); //step size through grid in mini patches
   if(level==1 && fL1Slide)  stepm = GetSlidingStepSizeMiniPatches(dim,level);
   //loop over edges of mini patches
+  //patch contents are taken from the summed-area tables of the mini patches (constant cost per patch)
+  Int_t activeMP = 0;
+  Int_t activeCells = 0;
   for(Int_t type = 0; type<2; type++) {
     Int_t np = 0; //patch number
       for(Int_t j = 0; j<=(GetNColMiniPatches(type)-nm); j+=stepm) {
     for(Int_t i = 0; i<=(GetNRowMiniPatches(type)-nm); i+=stepm) {
       //      for(Int_t j = 0; j<=(GetNColMiniPatches(type)-nm); j+=stepm) {
-	//loop over mini patches in patch
-	for(Int_t k = 0; k<nm; k++) {
-	  for(Int_t l = 0; l<nm; l++) {
-	    Int_t row = i+k;
-	    Int_t col = j+l;
-	    Int_t id = GetMiniPatchID(row,col,type);
-	    fPatchGrid[type][pt].AddAt(fPatchGrid[type][pt].At(np)+fMiniPatchGrid[type].At(id),np);
-	    if(fMiniPatchGrid[type].At(id)>0.) {
-	      fActiveAreaMPP[type][pt].AddAt(fActiveAreaMPP[type][pt].At(np)+1,np);
-	      fActiveAreaCP[type][pt].AddAt(fActiveAreaCP[type][pt].At(np)+fActiveAreaMP[type].At(id),np);
-	    }
-	  }
-	}
+	Double_t e = GetMiniPatchSum(type,i,j,nm,nm,activeMP,activeCells);
+	fPatchGrid[type][pt].AddAt(e,np);
+	fActiveAreaMPP[type][pt].AddAt(activeMP,np);
+	fActiveAreaCP[type][pt].AddAt(activeCells,np);
 	np++;
       }
     }
@@ -583,6 +648,12 @@ Int_t AliEmcalPicoTrackInGridMaker::GetGridID(const Int_t row, const Int_t col,
 Int_t AliEmcalPicoTrackInGridMaker::GetGridID(const Double_t eta, const Double_t phi) const {
   
   Int_t type = GetCellType(eta,phi);
+  return GetGridID(eta,phi,type);
+}
+
+//________________________________________________________________________
+Int_t AliEmcalPicoTrackInGridMaker::GetGridID(const Double_t eta, const Double_t phi, const Int_t type) const {
+  //cell id for a position of which the detector type is already known
   if(type<0 || type>1) return -1; //position is not in EMCal or DCal
 
   // grid ID convention:
@@ -31,6 +31,8 @@ class AliEmcalPicoTrackInGridMaker : public AliAnalysisTaskEmcalJet {
   void               SetPatchTypeForSubtraction(Int_t dim, Int_t lev)  { fPatchSub = GetPatchType(dim,lev); }
   void               SetMeanRho(Double_t r)                            { fRhoMean = r; }
 
+  Double_t           GetMiniPatchSum(const Int_t type, const Int_t row, const Int_t col, const Int_t nRow, const Int_t nCol, Int_t &activeMP, Int_t &activeCells) const;
+
  protected:
   void               UserCreateOutputObjects();
   Bool_t             Run();
@@ -42,6 +44,7 @@ class AliEmcalPicoTrackInGridMaker : public AliAnalysisTaskEmcalJet {
 
   Bool_t             InitMiniPatches();
   Bool_t             CreateGridMiniPatches();
+  void               CreateMiniPatchSums();
   Bool_t             CreateGridPatches(const Int_t dim, const Int_t level);
 
   Bool_t             InitPatches(const Int_t dim, const Int_t level); //give dimension in cell units
@@ -57,6 +60,7 @@ class AliEmcalPicoTrackInGridMaker : public AliAnalysisTaskEmcalJet {
  
   Int_t              GetGridID(const AliVParticle *vp) const {return GetGridID(vp->Eta(),vp->Phi());}
   Int_t              GetGridID(const Double_t eta, const Double_t phi) const;
+  Int_t              GetGridID(const Double_t eta, const Double_t phi, const Int_t type) const;
   Int_t              GetGridID(const Int_t row, const Int_t col, const Int_t type) const;
   void               GetEtaPhiFromGridID(const Int_t id, const Int_t type, Double_t &eta, Double_t &phi) const;
   Int_t              GetNCellsRow(const Int_t type) const;
@@ -102,6 +106,9 @@ class AliEmcalPicoTrackInGridMaker : public AliAnalysisTaskEmcalJet {
   TArrayD            fCellGrid[2];          // grid of cells in EMCal and DCal
   TArrayD            fMiniPatchGrid[2];     // grid of mini patches in EMCal and DCal
   TArrayI            fActiveAreaMP[2];      // active area for each mini patch
+  TArrayD            fMiniPatchSum[2];      //! summed-area table of the mini patch energies
+  TArrayI            fActiveMPSum[2];       //! summed-area table of the active mini patches
+  TArrayI            fActiveCellSum[2];     //! summed-area table of the active cells
   TArrayD            fPatchGrid[2][5];      // grid of trigger patches: 4x4 L0, 4x4 L1, 8x8 L1, 16x16 L1, 32x32 L1
   TArrayI            fActiveAreaMPP[2][5];  // active area in mini patches for each trigger patch
   TArrayI            fActiveAreaCP[2][5];   // active area in cells for each trigger patch
@@ -134,6 +141,6 @@ class AliEmcalPicoTrackInGridMaker : public AliAnalysisTaskEmcalJet {
 
   TH2F              *fMultVsRho;            //! track multiplicity vs rho from EMCal
 
-  ClassDef(AliEmcalPicoTrackInGridMaker, 3); // Task to make PicoTracks in a grid corresponding to EMCAL/DCAL acceptance
+  ClassDef(AliEmcalPicoTrackInGridMaker, 4); // Task to make PicoTracks in a grid corresponding to EMCAL/DCAL acceptance
 };
 #endif
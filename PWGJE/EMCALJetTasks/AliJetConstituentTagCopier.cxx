@@ -24,7 +24,8 @@ AliJetConstituentTagCopier::AliJetConstituentTagCopier() :
   AliAnalysisTaskEmcal("AliJetConstituentTagCopier", kFALSE),
   fCleanBeforeCopy(kFALSE),
   fMCLabelShift(0),
-  fMCParticleContainer(0)
+  fMCParticleContainer(0),
+  fUseLabelHashMap(kTRUE)
 {
   // Default constructor.
 }
@@ -34,7 +35,8 @@ AliJetConstituentTagCopier::AliJetConstituentTagCopier(const char *name) :
   AliAnalysisTaskEmcal(name, kFALSE),
   fCleanBeforeCopy(kFALSE),
   fMCLabelShift(0),
-  fMCParticleContainer(0)
+  fMCParticleContainer(0),
+  fUseLabelHashMap(kTRUE)
 {
   // Standard constructor.
 }
@@ -48,6 +50,8 @@ AliJetConstituentTagCopier::~AliJetConstituentTagCopier()
 //________________________________________________________________________
 Bool_t AliJetConstituentTagCopier::Run()
 {
+  if (fMCParticleContainer) fMCParticleContainer->SetUseLabelHashMap(fUseLabelHashMap);
+
   for (Int_t i = 0; i < fParticleCollArray.GetEntriesFast(); i++) {
     AliParticleContainer *cont = static_cast<AliParticleContainer*>(fParticleCollArray.At(i));
     if (!cont) continue;
@@ -19,6 +19,7 @@ class AliJetConstituentTagCopier : public AliAnalysisTaskEmcal {
   void                        ConnectMCParticleContainerID(AliParticleContainer *cont)  { fMCParticleContainer   = cont      ; }
   void                        SetCleanBeforeCopy(Bool_t c)                              { fCleanBeforeCopy       = c         ; }
   void                        SetMCLabelShift(Int_t s)                                  { fMCLabelShift          = s         ; }
+  void                        SetUseLabelHashMap(Bool_t b)                              { fUseLabelHashMap       = b         ; }
 
  protected:
   Bool_t                      Run();
@@ -28,12 +29,13 @@ class AliJetConstituentTagCopier : public AliAnalysisTaskEmcal {
   Bool_t                      fCleanBeforeCopy;                       // clean bit map before copying
   Int_t                       fMCLabelShift;                          // if MC label > fMCLabelShift, MC label -= fMCLabelShift
   AliParticleContainer       *fMCParticleContainer;                   // MC particle container
+  Bool_t                      fUseLabelHashMap;                       // look up MC particles via the label hash map of the container
 
  private:
   AliJetConstituentTagCopier(const AliJetConstituentTagCopier&);            // not implemented
   AliJetConstituentTagCopier &operator=(const AliJetConstituentTagCopier&); // not implemented
 
-  ClassDef(AliJetConstituentTagCopier, 4) // Copy tags from particle level constituent to detector level
+  ClassDef(AliJetConstituentTagCopier, 5) // Copy tags from particle level constituent to detector level
 };
 
 #endif
@@ -0,0 +1,142 @@
+/************************************************************************************
+ * Copyright (C) 2021, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#include <algorithm>
+#include <cmath>
+#include <TLorentzVector.h>
+#include "fastjet/ClusterSequence.hh"
+#include "fastjet/JetDefinition.hh"
+#include "fastjet/PseudoJet.hh"
+
+#include "AliClusterContainer.h"
+#include "AliEmcalJet.h"
+#include "AliLog.h"
+#include "AliParticleContainer.h"
+#include "AliVCluster.h"
+#include "AliVParticle.h"
+
+#include "AliJetDeclusteringCache.h"
+
+ClassImp(PWGJE::EMCALJetTasks::AliJetDeclusteringCache)
+
+using namespace PWGJE::EMCALJetTasks;
+
+AliJetDeclusteringCache::AliJetDeclusteringCache():
+  TObject(),
+  fReclusteringRadius(1.),
+  fRecombinationScheme(fastjet::E_scheme),
+  fSplittings(),
+  fJetRanges()
+{
+
+}
+
+void AliJetDeclusteringCache::Reset() {
+  fSplittings.clear();
+  fJetRanges.clear();
+}
+
+AliJetSplittingRange AliJetDeclusteringCache::GetSplittings(const AliEmcalJet &jet, const AliParticleContainer *tracks, const AliClusterContainer *clusters, const Double_t *vertexpos) {
+  auto cached = fJetRanges.find(&jet);
+  if (cached == fJetRanges.end()) {
+    CachedJet entry;
+    entry.fOffset = fSplittings.size();
+    entry.fJetPt = 0;
+    entry.fValid = Decluster(jet, tracks, clusters, vertexpos, entry.fJetPt);
+    entry.fNSplittings = static_cast<Int_t>(fSplittings.size()) - entry.fOffset;
+    cached = fJetRanges.insert(std::make_pair(&jet, entry)).first;
+  }
+  const CachedJet &entry = cached->second;
+  if (!entry.fValid) return AliJetSplittingRange();
+  return AliJetSplittingRange(&fSplittings, entry.fOffset, entry.fNSplittings, entry.fJetPt);
+}
+
+Bool_t AliJetDeclusteringCache::Decluster(const AliEmcalJet &jet, const AliParticleContainer *tracks, const AliClusterContainer *clusters, const Double_t *vertexpos, Double_t &jetpt) {
+  std::vector<fastjet::PseudoJet> inputVectors;
+
+  for (Int_t i = 0; i < jet.GetNumberOfTracks(); i++) {
+    AliVParticle *track = tracks ? jet.TrackAt(i, tracks->GetArray()) : jet.Track(i);
+    if (!track) continue;
+    inputVectors.push_back(fastjet::PseudoJet(track->Px(), track->Py(), track->Pz(), track->E()));
+    inputVectors.back().set_user_index(jet.TrackAt(i) + 100);
+  }
+
+  if (clusters) {
+    if (!vertexpos) {
+      AliErrorGeneral("AliJetDeclusteringCache::Decluster", "Vertex position not defined, clusters are not used");
+    } else {
+      for (Int_t icl = 0; icl < jet.GetNumberOfClusters(); icl++) {
+        AliVCluster *cluster = jet.ClusterAt(icl, clusters->GetArray());
+        if (!cluster) continue;
+        TLorentzVector clustervec;
+        cluster->GetMomentum(clustervec, vertexpos, (AliVCluster::VCluUserDefEnergy_t)clusters->GetDefaultClusterEnergy());
+        inputVectors.push_back(fastjet::PseudoJet(clustervec.Px(), clustervec.Py(), clustervec.Pz(), clustervec.E()));
+        inputVectors.back().set_user_index(jet.ClusterAt(icl) + 1000);
+      }
+    }
+  }
+
+  if (inputVectors.empty()) return false;
+
+  fastjet::JetDefinition jetdef(fastjet::cambridge_algorithm, fReclusteringRadius, static_cast<fastjet::RecombinationScheme>(fRecombinationScheme), fastjet::BestFJ30);
+  try {
+    fastjet::ClusterSequence clusterseq(inputVectors, jetdef);
+    std::vector<fastjet::PseudoJet> outputJets = sorted_by_pt(clusterseq.inclusive_jets(0));
+    if (outputJets.empty()) return false;
+
+    fastjet::PseudoJet j1, j2, jj = outputJets[0];
+    jetpt = jj.perp();
+    while (jj.has_parents(j1, j2)) {
+      if (j1.perp() < j2.perp()) std::swap(j1, j2);
+      AliJetSplitting splitting;
+      splitting.fPtHard = j1.perp();
+      splitting.fPtSoft = j2.perp();
+      splitting.fZ = j2.perp() / (j1.perp() + j2.perp());
+      splitting.fTheta = j1.delta_R(j2);
+      splitting.fKt = j2.perp() * std::sin(splitting.fTheta);
+      splitting.fMass = jj.m();
+      fSplittings.push_back(splitting);
+      jj = j1;
+    }
+  } catch (fastjet::Error &e) {
+    AliErrorGeneral("AliJetDeclusteringCache::Decluster", Form("FastJet error: %s", e.message().data()));
+    return false;
+  }
+  return true;
+}
+
+Int_t AliJetDeclusteringCache::FindSoftDropSplitting(const AliJetSplittingRange &splittings, Double_t zcut, Double_t beta, Double_t r0) {
+  for (Int_t i = 0; i < splittings.size(); i++) {
+    if (splittings[i].fZ > zcut * std::pow(splittings[i].fTheta / r0, beta)) return i;
+  }
+  return -1;
+}
+
+Int_t AliJetDeclusteringCache::CountSoftDropSplittings(const AliJetSplittingRange &splittings, Double_t zcut, Double_t beta, Double_t r0) {
+  return std::count_if(splittings.begin(), splittings.end(), [zcut, beta, r0](const AliJetSplitting &splitting) {
+    return splitting.fZ > zcut * std::pow(splitting.fTheta / r0, beta);
+  });
+}
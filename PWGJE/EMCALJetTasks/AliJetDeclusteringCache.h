@@ -0,0 +1,202 @@
+/************************************************************************************
+ * Copyright (C) 2021, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#ifndef __ALIJETDECLUSTERINGCACHE_H__
+#define __ALIJETDECLUSTERINGCACHE_H__
+#include <TObject.h>
+#include <map>
+#include <vector>
+
+class AliEmcalJet;
+class AliParticleContainer;
+class AliClusterContainer;
+
+namespace PWGJE {
+
+namespace EMCALJetTasks {
+
+/**
+ * @struct AliJetSplitting
+ * @brief Parameters of a splitting along the primary (harder) branch of the C/A tree of a jet
+ * @ingroup PWGJEBASE
+ */
+struct AliJetSplitting {
+  Double_t        fZ;                   ///< momentum fraction of the softer prong, \f$p_{t,soft}/(p_{t,soft}+p_{t,hard})\f$
+  Double_t        fTheta;               ///< angle \f$\Delta R\f$ between the prongs
+  Double_t        fKt;                  ///< relative transverse momentum, \f$p_{t,soft} \sin(\Delta R)\f$
+  Double_t        fMass;                ///< invariant mass of the parent
+  Double_t        fPtHard;              ///< \f$p_{t}\f$ of the harder prong
+  Double_t        fPtSoft;              ///< \f$p_{t}\f$ of the softer prong
+};
+
+/**
+ * @class AliJetSplittingRange
+ * @brief Lightweight view on the splittings of one jet stored in an AliJetDeclusteringCache
+ * @ingroup PWGJEBASE
+ *
+ * The view refers to the splitting array of the cache by position, so it stays valid
+ * when further jets are added to the cache, until the cache is reset. Pointers and
+ * references obtained from begin(), end() and operator[] are only valid until the
+ * next call of AliJetDeclusteringCache::GetSplittings().
+ */
+class AliJetSplittingRange {
+public:
+  AliJetSplittingRange(): fSplittings(nullptr), fOffset(0), fSize(0), fJetPt(0), fValid(false) {}
+  AliJetSplittingRange(const std::vector<AliJetSplitting> *splittings, Int_t offset, Int_t size, Double_t jetpt): fSplittings(splittings), fOffset(offset), fSize(size), fJetPt(jetpt), fValid(true) {}
+
+  const AliJetSplitting *begin() const { return fSize ? fSplittings->data() + fOffset : nullptr; }
+  const AliJetSplitting *end() const { return begin() + fSize; }
+  Int_t size() const { return fSize; }
+  Bool_t empty() const { return fSize == 0; }
+  const AliJetSplitting &operator[](Int_t i) const { return (*fSplittings)[fOffset + i]; }
+
+  /**
+   * @brief Transverse momentum of the leading reclustered jet
+   * @return \f$p_{t}\f$ of the reclustered jet
+   */
+  Double_t GetJetPt() const { return fJetPt; }
+
+  /**
+   * @brief Check whether the reclustering produced a jet (false for jets without constituents or on FastJet errors)
+   * @return True if the reclustered jet exists
+   */
+  Bool_t IsValid() const { return fValid; }
+
+private:
+  const std::vector<AliJetSplitting> *fSplittings;  ///< splitting array of the owning cache
+  Int_t                         fOffset;        ///< index of the first splitting of the jet
+  Int_t                         fSize;          ///< number of splittings of the jet
+  Double_t                      fJetPt;         ///< pt of the leading reclustered jet
+  Bool_t                        fValid;         ///< true if the reclustering produced a jet
+};
+
+/**
+ * @class AliJetDeclusteringCache
+ * @brief Per-event cache of the primary declustering of jets
+ * @ingroup PWGJEBASE
+ *
+ * The constituents of a jet are reclustered with the Cambridge/Aachen algorithm
+ * only the first time the jet is requested in an event, and the splittings along
+ * the harder branch are stored in a flat array. Grooming settings (soft drop with
+ * different \f$z_{cut}\f$ and \f$\beta\f$), Lund-plane fillers and other substructure
+ * observables can then be evaluated from the cached splittings without reclustering.
+ * The cache must be reset at the beginning of each event, since jets are identified
+ * by their address.
+ */
+class AliJetDeclusteringCache : public TObject {
+public:
+  /**
+   * @brief Constructor
+   */
+  AliJetDeclusteringCache();
+
+  /**
+   * @brief Destructor
+   */
+  virtual ~AliJetDeclusteringCache() {}
+
+  /**
+   * @brief Set the radius used for the C/A reclustering of the jet constituents
+   * @param r Reclustering radius
+   */
+  void SetReclusteringRadius(Double_t r) { fReclusteringRadius = r; }
+
+  /**
+   * @brief Set the recombination scheme used for the C/A reclustering (fastjet::RecombinationScheme)
+   * @param scheme Recombination scheme
+   */
+  void SetRecombinationScheme(Int_t scheme) { fRecombinationScheme = scheme; }
+
+  /**
+   * @brief Clear the cached splittings, to be called at the beginning of each event
+   */
+  void Reset();
+
+  /**
+   * @brief Get the splittings along the primary branch of the jet, reclustering it only if not yet cached
+   *
+   * @param jet Jet to be declustered
+   * @param tracks Container with tracks / particles (if null the tracks associated to the jet are used)
+   * @param clusters Container with calorimeter clusters (optional)
+   * @param vertexpos Position of the primary vertex (mandatory in case a cluster container is set)
+   * @return Splittings of the jet, ordered from the first (widest) splitting
+   */
+  AliJetSplittingRange GetSplittings(const AliEmcalJet &jet, const AliParticleContainer *tracks = nullptr, const AliClusterContainer *clusters = nullptr, const Double_t *vertexpos = nullptr);
+
+  /**
+   * @brief Number of jets declustered in the current event
+   * @return Number of cached jets
+   */
+  Int_t GetNCachedJets() const { return fJetRanges.size(); }
+
+  /**
+   * @brief Find the splitting selected by the soft drop condition \f$z > z_{cut} (\Delta R/R_{0})^{\beta}\f$
+   *
+   * @param splittings Splittings of the jet
+   * @param zcut Soft drop \f$z_{cut}\f$
+   * @param beta Soft drop \f$\beta\f$
+   * @param r0 Jet radius \f$R_{0}\f$ normalizing the angle
+   * @return Index of the first splitting passing the condition, -1 if the jet is fully groomed away
+   */
+  static Int_t FindSoftDropSplitting(const AliJetSplittingRange &splittings, Double_t zcut, Double_t beta, Double_t r0);
+
+  /**
+   * @brief Count the splittings passing the soft drop condition (\f$n_{SD}\f$)
+   *
+   * @param splittings Splittings of the jet
+   * @param zcut Soft drop \f$z_{cut}\f$
+   * @param beta Soft drop \f$\beta\f$
+   * @param r0 Jet radius \f$R_{0}\f$ normalizing the angle
+   * @return Number of splittings passing the condition
+   */
+  static Int_t CountSoftDropSplittings(const AliJetSplittingRange &splittings, Double_t zcut, Double_t beta, Double_t r0);
+
+private:
+  /**
+   * @struct CachedJet
+   * @brief Location of the splittings of a jet in the flat splitting array
+   */
+  struct CachedJet {
+    Int_t         fOffset;        ///< index of the first splitting
+    Int_t         fNSplittings;   ///< number of splittings
+    Double_t      fJetPt;         ///< pt of the leading reclustered jet
+    Bool_t        fValid;         ///< true if the reclustering produced a jet
+  };
+
+  Bool_t Decluster(const AliEmcalJet &jet, const AliParticleContainer *tracks, const AliClusterContainer *clusters, const Double_t *vertexpos, Double_t &jetpt);
+
+  Double_t                                          fReclusteringRadius;   ///< radius of the C/A reclustering
+  Int_t                                             fRecombinationScheme;  ///< recombination scheme of the C/A reclustering
+  std::vector<AliJetSplitting>                      fSplittings;           //!<! splittings of all the cached jets
+  std::map<const AliEmcalJet *, CachedJet>          fJetRanges;            //!<! location of the splittings of each cached jet
+
+  ClassDef(AliJetDeclusteringCache, 1);
+};
+
+}
+
+}
+#endif
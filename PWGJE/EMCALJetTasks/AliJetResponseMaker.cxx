@@ -19,6 +19,10 @@
 
 #include "AliJetResponseMaker.h"
 
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
 #include <TClonesArray.h>
 #include <TH2F.h>
 #include <THnSparse.h>
@@ -35,6 +39,19 @@
 #include "AliParticleContainer.h"
 #include "AliClusterContainer.h"
 #include "AliAnalysisTaskEmcalEmbeddingHelper.h"
+#include "AliEmcalJetMatcherKDTree.h"
+
+namespace {
+  /// Pt of the constituents of a detector level jet associated with one MC particle
+  struct MCLabelSharedPt {
+    MCLabelSharedPt() : fTrackPt(0), fClusterPt(0), fFirstClusterFraction(0), fFoundInTracks(kFALSE), fFoundInClusters(kFALSE) {}
+    Double_t fTrackPt;               // summed pt of the tracks
+    Double_t fClusterPt;             // summed pt of the clusters (cells weighted by their amplitude fraction)
+    Double_t fFirstClusterFraction;  // amplitude fraction of the first associated cell (1 for clusters)
+    Bool_t   fFoundInTracks;         // associated with at least one track
+    Bool_t   fFoundInClusters;       // associated with at least one cluster/cell
+  };
+}
 
 ClassImp(AliJetResponseMaker)
 
@@ -1417,6 +1434,9 @@ Bool_t AliJetResponseMaker::DoJetMatching()
 void AliJetResponseMaker::DoJetLoop()
 {
   // Do the jet loop.
+  // Only pairs which can fulfil the matching criteria are compared:
+  // for the geometrical matching the jets2 within the matching distance (kd-tree),
+  // for the MC label matching the jets2 sharing at least one particle with jet1.
 
   AliJetContainer *jets1 = static_cast<AliJetContainer*>(fJetCollArray.At(0));
   AliJetContainer *jets2 = static_cast<AliJetContainer*>(fJetCollArray.At(1));
@@ -1426,18 +1446,74 @@ void AliJetResponseMaker::DoJetLoop()
   AliEmcalJet* jet1 = 0;
   AliEmcalJet* jet2 = 0;
 
+  std::vector<AliEmcalJet*> jetsVec2;
   jets2->ResetCurrentID();
-  while ((jet2 = jets2->GetNextJet())) jet2->ResetMatching();
+  while ((jet2 = jets2->GetNextJet())) {
+    jet2->ResetMatching();
+    jetsVec2.push_back(jet2);
+  }
+
+  Double_t maxDist = TMath::Max(fMatchingPar1, fMatchingPar2);
+  Bool_t geoCandidates = (fMatching == kGeometrical && maxDist < TMath::Pi());
+  Bool_t labelCandidates = (fMatching == kMCLabel && fMatchingPar1 < 1 && fMatchingPar2 < 1 && !(fUseCellsToMatch && fCaloCells));
+
+  PWGJE::EMCALJetTasks::AliEmcalJetMatcherKDTree matcher;
+  if (geoCandidates) matcher.Build(jetsVec2);
+
+  // jets2 containing a given particle (index in the particle container of jets2)
+  std::unordered_multimap<Int_t, Int_t> jetsOfParticle;
+  AliParticleContainer *tracks2 = jets2->GetParticleContainer();
+  if (labelCandidates && !tracks2) labelCandidates = kFALSE;
+  if (labelCandidates) {
+    for (UInt_t ijet2 = 0; ijet2 < jetsVec2.size(); ijet2++) {
+      for (Int_t iTrack2 = 0; iTrack2 < jetsVec2[ijet2]->GetNumberOfTracks(); iTrack2++) {
+        jetsOfParticle.insert(std::make_pair(jetsVec2[ijet2]->TrackAt(iTrack2), (Int_t)ijet2));
+      }
+    }
+  }
 
+  std::vector<Int_t> candidates;
   jets1->ResetCurrentID();
   while ((jet1 = jets1->GetNextJet())) {
     jet1->ResetMatching();
 
     if (jet1->MCPt() < fMinJetMCPt) continue;
 
-    jets2->ResetCurrentID();
-    while ((jet2 = jets2->GetNextJet())) {
-      SetMatchingLevel(jet1, jet2, fMatching);
+    if (geoCandidates) {
+      matcher.FindInRange(*jet1, maxDist, candidates);
+    }
+    else if (labelCandidates) {
+      candidates.clear();
+      for (Int_t iTrack = 0; iTrack < jet1->GetNumberOfTracks(); iTrack++) {
+        AliVParticle *track = jet1->Track(iTrack);
+        if (!track) continue;
+        Int_t MClabel = TMath::Abs(track->GetLabel()) - fMCLabelShift;
+        if (MClabel <= 0) continue;
+        Int_t index = tracks2->GetIndexFromLabel(MClabel);
+        if (index < 0) continue;
+        auto range = jetsOfParticle.equal_range(index);
+        for (auto it = range.first; it != range.second; ++it) candidates.push_back(it->second);
+      }
+      for (Int_t iClus = 0; iClus < jet1->GetNumberOfClusters(); iClus++) {
+        AliVCluster *clus = jet1->Cluster(iClus);
+        if (!clus) continue;
+        Int_t MClabel = TMath::Abs(clus->GetLabel()) - fMCLabelShift;
+        if (MClabel <= 0) continue;
+        Int_t index = tracks2->GetIndexFromLabel(MClabel);
+        if (index < 0) continue;
+        auto range = jetsOfParticle.equal_range(index);
+        for (auto it = range.first; it != range.second; ++it) candidates.push_back(it->second);
+      }
+      std::sort(candidates.begin(), candidates.end());
+      candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+    }
+    else {
+      candidates.resize(jetsVec2.size());
+      for (UInt_t ijet2 = 0; ijet2 < jetsVec2.size(); ijet2++) candidates[ijet2] = ijet2;
+    }
+
+    for (auto ijet2 : candidates) {
+      SetMatchingLevel(jet1, jetsVec2[ijet2], fMatching);
     } // jet2 loop
   } // jet1 loop
 }
@@ -1467,28 +1543,42 @@ void AliJetResponseMaker::GetMCLabelMatchingLevel(AliEmcalJet *jet1, AliEmcalJet
   d2 = jet2->Pt();
   Double_t totalPt1 = d1; // the total pt of the reconstructed jet will be cleaned from the background
 
-  // remove completely tracks that are not MC particles (label == 0)
-  if (tracks1 && tracks1->GetArray()) {
-    for (Int_t iTrack = 0; iTrack < jet1->GetNumberOfTracks(); iTrack++) {
-      AliVParticle *track = jet1->Track(iTrack);
-      if (!track) {
-        AliWarning(Form("Could not find track %d!", iTrack));
-        continue;
-      }
+  // constituents of jet1 indexed by the associated particle in tracks2,
+  // so that the shared pt is found in a single pass over the constituents of each jet
+  std::unordered_map<Int_t, MCLabelSharedPt> sharedPt;
 
-      Int_t MClabel = TMath::Abs(track->GetLabel());
-      MClabel -= fMCLabelShift;
-      if (MClabel != 0) continue;
+  for (Int_t iTrack = 0; iTrack < jet1->GetNumberOfTracks(); iTrack++) {
+    AliVParticle *track = jet1->Track(iTrack);
+    if (!track) {
+      AliWarning(Form("Could not find track %d!", iTrack));
+      continue;
+    }
 
-      // this is not a MC particle; remove it completely
-      AliDebug(3,Form("Track %d (pT = %f) is not a MC particle (MClabel = %d)!",iTrack,track->Pt(),MClabel));
-      totalPt1 -= track->Pt();
-      d1 -= track->Pt();
+    Int_t MClabel = TMath::Abs(track->GetLabel());
+    MClabel -= fMCLabelShift;
+    if (MClabel == 0) {
+      // remove completely tracks that are not MC particles (label == 0)
+      if (tracks1 && tracks1->GetArray()) {
+        AliDebug(3,Form("Track %d (pT = %f) is not a MC particle (MClabel = %d)!",iTrack,track->Pt(),MClabel));
+        totalPt1 -= track->Pt();
+        d1 -= track->Pt();
+      }
+      continue;
+    }
+    if (MClabel < 0) continue;
+
+    Int_t index = tracks2->GetIndexFromLabel(MClabel);
+    if (index < 0) {
+      AliDebug(2,Form("Track %d (pT = %f) does not have an associated MC particle (MClabel = %d)!",iTrack,track->Pt(),MClabel));
+      continue;
     }
+
+    MCLabelSharedPt &shared = sharedPt[index];
+    shared.fTrackPt += track->Pt();
+    shared.fFoundInTracks = kTRUE;
   }
 
-  // remove completely clusters that are not MC particles (label == 0)
-  if (fUseCellsToMatch && fCaloCells) { 
+  if (fUseCellsToMatch && fCaloCells) { // if the cell colection is available, look for cells with a matched MC particle
     for (Int_t iClus = 0; iClus < jet1->GetNumberOfClusters(); iClus++) {
       AliVCluster *clus = jet1->Cluster(iClus);
       if (!clus) {
@@ -1504,153 +1594,77 @@ void AliJetResponseMaker::GetMCLabelMatchingLevel(AliEmcalJet *jet1, AliEmcalJet
 
         Int_t MClabel = TMath::Abs(fCaloCells->GetCellMCLabel(cellId));
         MClabel -= fMCLabelShift;
-        if (MClabel != 0) continue;
+        if (MClabel == 0) {
+          // this is not a MC particle; remove it completely
+          AliDebug(3,Form("Cell %d (frac = %f) is not a MC particle (MClabel = %d)!",iCell,cellFrac,MClabel));
+          totalPt1 -= part.Pt() * cellFrac;
+          d1 -= part.Pt() * cellFrac;
+          continue;
+        }
+        if (MClabel < 0) continue;
 
-        // this is not a MC particle; remove it completely
-        AliDebug(3,Form("Cell %d (frac = %f) is not a MC particle (MClabel = %d)!",iCell,cellFrac,MClabel));
-        totalPt1 -= part.Pt() * cellFrac;
-        d1 -= part.Pt() * cellFrac;
+        Int_t index = tracks2->GetIndexFromLabel(MClabel);
+        if (index < 0) {
+          AliDebug(3,Form("Cell %d (frac = %f) does not have an associated MC particle (MClabel = %d)!",iCell,cellFrac,MClabel));
+          continue;
+        }
+
+        MCLabelSharedPt &shared = sharedPt[index];
+        if (!shared.fFoundInClusters) shared.fFirstClusterFraction = cellFrac;
+        shared.fClusterPt += part.Pt() * cellFrac;
+        shared.fFoundInClusters = kTRUE;
       }
     }
   }
-  else {
+  else { //otherwise look for the first contributor to the cluster, and if matched to a MC label remove it
     for (Int_t iClus = 0; iClus < jet1->GetNumberOfClusters(); iClus++) {
       AliVCluster *clus = jet1->Cluster(iClus);
       if (!clus) {
         AliWarning(Form("Could not find cluster %d!", iClus));
         continue;
       }
-      TLorentzVector part;
+      AliTLorentzVector part;
       clus->GetMomentum(part, fVertex);
 
       Int_t MClabel = TMath::Abs(clus->GetLabel());
       MClabel -= fMCLabelShift;
-      if (MClabel != 0) continue;
-
-      // this is not a MC particle; remove it completely
-      AliDebug(3,Form("Cluster %d (pT = %f) is not a MC particle (MClabel = %d)!",iClus,part.Pt(),MClabel));
-      totalPt1 -= part.Pt();
-      d1 -= part.Pt();
-    }
-  }
-
-  for (Int_t iTrack2 = 0; iTrack2 < jet2->GetNumberOfTracks(); iTrack2++) {
-    Bool_t track2Found = kFALSE;
-    Int_t index2 = jet2->TrackAt(iTrack2);
-
-    // now look for common particles in the track array
-    for (Int_t iTrack = 0; iTrack < jet1->GetNumberOfTracks(); iTrack++) {
-      AliVParticle *track = jet1->Track(iTrack);
-      if (!track) {
-        AliWarning(Form("Could not find track %d!", iTrack));
+      if (MClabel == 0) {
+        // this is not a MC particle; remove it completely
+        AliDebug(3,Form("Cluster %d (pT = %f) is not a MC particle (MClabel = %d)!",iClus,part.Pt(),MClabel));
+        totalPt1 -= part.Pt();
+        d1 -= part.Pt();
         continue;
       }
-      Int_t MClabel = TMath::Abs(track->GetLabel());
-      MClabel -= fMCLabelShift;	  
-      if (MClabel <= 0) continue;
+      if (MClabel < 0) continue;
 
-      Int_t index = -1;
-      index = tracks2->GetIndexFromLabel(MClabel);
+      Int_t index = tracks2->GetIndexFromLabel(MClabel);
       if (index < 0) {
-        AliDebug(2,Form("Track %d (pT = %f) does not have an associated MC particle (MClabel = %d)!",iTrack,track->Pt(),MClabel));
+        AliDebug(3,Form("Cluster %d (pT = %f) does not have an associated MC particle (MClabel = %d)!",iClus,part.Pt(),MClabel));
         continue;
       }
 
-      if (index2 != index) continue;
-
-      // found common particle
-      d1 -= track->Pt();
-
-      if (!track2Found) {
-        AliVParticle *MCpart = jet2->Track(iTrack2);
-        AliDebug(3,Form("Track %d (pT = %f, eta = %f, phi = %f) is associated with the MC particle %d (pT = %f, eta = %f, phi = %f)!",
-            iTrack,track->Pt(),track->Eta(),track->Phi(),MClabel,MCpart->Pt(),MCpart->Eta(),MCpart->Phi()));
-        d2 -= MCpart->Pt();
-      }
-
-      track2Found = kTRUE;
-    }
-
-    // now look for common particles in the cluster array
-    if (fUseCellsToMatch && fCaloCells) { // if the cell colection is available, look for cells with a matched MC particle
-      for (Int_t iClus = 0; iClus < jet1->GetNumberOfClusters(); iClus++) {
-        AliVCluster *clus = jet1->Cluster(iClus);
-        if (!clus) {
-          AliWarning(Form("Could not find cluster %d!", iClus));
-          continue;
-        }
-        AliTLorentzVector part;
-        clus->GetMomentum(part, fVertex);
-
-        for (Int_t iCell = 0; iCell < clus->GetNCells(); iCell++) {
-          Int_t cellId = clus->GetCellAbsId(iCell);
-          Double_t cellFrac = clus->GetCellAmplitudeFraction(iCell);
-
-          Int_t MClabel = TMath::Abs(fCaloCells->GetCellMCLabel(cellId));
-          MClabel -= fMCLabelShift;
-          if (MClabel <= 0) continue;
-
-          Int_t index1 = -1;
-          index1 = tracks2->GetIndexFromLabel(MClabel);
-          if (index1 < 0) {
-            AliDebug(3,Form("Cell %d (frac = %f) does not have an associated MC particle (MClabel = %d)!",iCell,cellFrac,MClabel));
-            continue;
-          }
-
-          if (index2 != index1) continue;
-
-          // found common particle
-          d1 -= part.Pt() * cellFrac;
-
-          if (!track2Found) { // only if it is not already found among charged tracks (charged particles are most likely already found)
-            AliVParticle *MCpart = jet2->Track(iTrack2);
-            AliDebug(3,Form("Cell %d belonging to cluster %d (pT = %f, eta = %f, phi = %f) is associated with the MC particle %d (pT = %f, eta = %f, phi = %f)!",
-                iCell,iClus,part.Pt(),part.Eta(),part.Phi_0_2pi(),MClabel,MCpart->Pt(),MCpart->Eta(),MCpart->Phi()));
-            d2 -= MCpart->Pt() * cellFrac;
-          }
-
-          track2Found = kTRUE;
-        }
-      }
+      MCLabelSharedPt &shared = sharedPt[index];
+      if (!shared.fFoundInClusters) shared.fFirstClusterFraction = 1.;
+      shared.fClusterPt += part.Pt();
+      shared.fFoundInClusters = kTRUE;
     }
-    else { //otherwise look for the first contributor to the cluster, and if matched to a MC label remove it
-      for (Int_t iClus = 0; iClus < jet1->GetNumberOfClusters(); iClus++) {
-        AliVCluster *clus = jet1->Cluster(iClus);
-        if (!clus) {
-          AliWarning(Form("Could not find cluster %d!", iClus));
-          continue;
-        }
-        AliTLorentzVector part;
-        clus->GetMomentum(part, fVertex);
-
-        Int_t MClabel = TMath::Abs(clus->GetLabel());
-        MClabel -= fMCLabelShift;
-        if (MClabel <= 0) continue;
-
-        Int_t index = -1;
-        index = tracks2->GetIndexFromLabel(MClabel);
-
-        if (index < 0) {
-          AliDebug(3,Form("Cluster %d (pT = %f) does not have an associated MC particle (MClabel = %d)!",iClus,part.Pt(),MClabel));
-          continue;
-        }
-
-        if (index2 != index) continue;
-
-        // found common particle
-        d1 -= part.Pt();
-
-        if (!track2Found) { // only if it is not already found among charged tracks (charged particles are most likely already found)
-          AliVParticle *MCpart = jet2->Track(iTrack2);
-          AliDebug(3,Form("Cluster %d (pT = %f, eta = %f, phi = %f) is associated with the MC particle %d (pT = %f, eta = %f, phi = %f)!",
-              iClus,part.Pt(),part.Eta(),part.Phi_0_2pi(),MClabel,MCpart->Pt(),MCpart->Eta(),MCpart->Phi()));
-
-          d2 -= MCpart->Pt();
-        }
+  }
 
-        track2Found = kTRUE;
-      }
-    }
+  for (Int_t iTrack2 = 0; iTrack2 < jet2->GetNumberOfTracks(); iTrack2++) {
+    auto shared = sharedPt.find(jet2->TrackAt(iTrack2));
+    if (shared == sharedPt.end()) continue;
+
+    // found common particle
+    d1 -= shared->second.fTrackPt + shared->second.fClusterPt;
+
+    AliVParticle *MCpart = jet2->Track(iTrack2);
+    AliDebug(3,Form("MC particle %d (pT = %f, eta = %f, phi = %f) is shared with the detector level jet",
+        jet2->TrackAt(iTrack2),MCpart->Pt(),MCpart->Eta(),MCpart->Phi()));
+    // clusters are only considered if the particle is not already found among charged tracks
+    if (shared->second.fFoundInTracks)
+      d2 -= MCpart->Pt();
+    else
+      d2 -= MCpart->Pt() * shared->second.fFirstClusterFraction;
   }
 
   if (d1 < 0)
@@ -677,27 +677,9 @@ Float_t AliAnalysisTaskEmcalQGTagging::GetJetMass(AliEmcalJet *jet,Int_t jetCont
 //________________________________________________________________________
 Float_t AliAnalysisTaskEmcalQGTagging::Angularity(AliEmcalJet *jet, Int_t jetContNb = 0){
 
-  AliJetContainer *jetCont = GetJetContainer(jetContNb);
   if (!jet->GetNumberOfTracks())
       return 0; 
-    Double_t den=0.;
-    Double_t num = 0.;
-    AliVParticle *vp1 = 0x0;
-    for(UInt_t i = 0; i < jet->GetNumberOfTracks(); i++) {
-      vp1 = static_cast<AliVParticle*>(jet->TrackAt(i, jetCont->GetParticleContainer()->GetArray()));
-      
-      if (!vp1){
-        Printf("AliVParticle associated to constituent not found");
-        continue;
-      }
-      
-      Double_t dphi = RelativePhi(vp1->Phi(),jet->Phi());
-      Double_t dr2 = (vp1->Eta()-jet->Eta())*(vp1->Eta()-jet->Eta()) + dphi*dphi;
-      Double_t dr = TMath::Sqrt(dr2);
-      num=num+vp1->Pt()*dr;
-      den=den+vp1->Pt();
-    }
-    return num/den;
+  return GetConstituentsView(jet, jetContNb).Angularity(jet->Eta(), jet->Phi(), 1., -1., kTRUE);
 } 
 
 //________________________________________________________________________
@@ -798,26 +780,19 @@ Float_t AliAnalysisTaskEmcalQGTagging::GetJetCoronna(AliEmcalJet *jet, Int_t jet
 //________________________________________________________________________
 Float_t AliAnalysisTaskEmcalQGTagging::PTD(AliEmcalJet *jet, Int_t jetContNb = 0){
 
-  AliJetContainer *jetCont = GetJetContainer(jetContNb);
   if (!jet->GetNumberOfTracks())
       return 0; 
-    Double_t den=0.;
-    Double_t num = 0.;
-    AliVParticle *vp1 = 0x0;
-    for(UInt_t i = 0; i < jet->GetNumberOfTracks(); i++) {
-      vp1 = static_cast<AliVParticle*>(jet->TrackAt(i, jetCont->GetParticleContainer()->GetArray()));
-      
-      if (!vp1){
-        Printf("AliVParticle associated to constituent not found");
-        continue;
-      }
-      
-      num=num+vp1->Pt()*vp1->Pt();
-      den=den+vp1->Pt();
-    }
-    return TMath::Sqrt(num)/den;
+  return GetConstituentsView(jet, jetContNb).PtD(kTRUE);
 } 
 
+//________________________________________________________________________
+const PWG::JETFW::AliEmcalJetConstituentsView &AliAnalysisTaskEmcalQGTagging::GetConstituentsView(AliEmcalJet *jet, Int_t jetContNb){
+  // constituent kinematics are copied once per jet, either by the jet finder or on first use
+  if (jet->HasConstituentsView()) return jet->GetConstituentsView();
+  AliJetContainer *jetCont = GetJetContainer(jetContNb);
+  return jet->FillConstituentsView(jetCont->GetParticleContainer()->GetArray());
+}
+
 //________________________________________________________________________
 Float_t AliAnalysisTaskEmcalQGTagging::GetJetpTD(AliEmcalJet *jet, Int_t jetContNb = 0){
   //calc subtracted jet mass
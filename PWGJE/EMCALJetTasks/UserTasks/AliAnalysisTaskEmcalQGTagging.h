@@ -93,6 +93,7 @@ class AliAnalysisTaskEmcalQGTagging : public AliAnalysisTaskEmcalJet {
   Float_t                            GetJetCoronna(AliEmcalJet *jet, Int_t jetContNb);
   Float_t                            PTD(AliEmcalJet *jet, Int_t jetContNb);
   Float_t                            GetJetpTD(AliEmcalJet *jet, Int_t jetContNb);
+  const PWG::JETFW::AliEmcalJetConstituentsView &GetConstituentsView(AliEmcalJet *jet, Int_t jetContNb);
   Float_t                            Circularity(AliEmcalJet *jet, Int_t jetContNb); 
   Float_t                            GetJetCircularity(AliEmcalJet *jet, Int_t jetContNb);
   Float_t                            LeSub(AliEmcalJet *jet, Int_t jetContNb);
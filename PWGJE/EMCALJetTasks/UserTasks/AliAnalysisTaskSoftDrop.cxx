@@ -20,6 +20,9 @@
 #include "AliAnalysisManager.h"
 #include "AliAnalysisTaskSoftDrop.h"
 
+using PWGJE::EMCALJetTasks::AliJetDeclusteringCache;
+using PWGJE::EMCALJetTasks::AliJetSplittingRange;
+
 ClassImp(AliAnalysisTaskSoftDrop)
 
 //________________________________________________________________________
@@ -41,11 +44,14 @@ AliAnalysisTaskSoftDrop::AliAnalysisTaskSoftDrop() :
   fhZg(0),
   fJetsCont(0),
   fTracksCont(0),
-  fCaloClustersCont(0)
+  fCaloClustersCont(0),
+  fDeclusteringCache()
 
 {
   // Default constructor.
 
+  fDeclusteringCache.SetReclusteringRadius(0.4);
+
   fHistTracksPt       = new TH1*[fNcentBins];
   fHistNTracks        = new TH1*[fNcentBins];
   fHistClustersPt     = new TH1*[fNcentBins];
@@ -88,10 +94,13 @@ AliAnalysisTaskSoftDrop::AliAnalysisTaskSoftDrop(const char *name) :
   fhZg(0),
   fJetsCont(0),
   fTracksCont(0),
-  fCaloClustersCont(0)
+  fCaloClustersCont(0),
+  fDeclusteringCache()
 {
   // Standard constructor.
 
+  fDeclusteringCache.SetReclusteringRadius(0.4);
+
   fHistTracksPt       = new TH1*[fNcentBins];
   fHistNTracks        = new TH1*[fNcentBins];
   fHistClustersPt     = new TH1*[fNcentBins];
@@ -393,6 +402,7 @@ Bool_t AliAnalysisTaskSoftDrop::FillHistograms()
 
   if (fJetsCont) {
     Int_t count = 0;
+    fDeclusteringCache.Reset();
     for (auto jet : fJetsCont->accepted() ) {
       count++;
       fHistJetsPtArea[fCentBin]->Fill(jet->Pt(), jet->Area());
@@ -408,19 +418,22 @@ Bool_t AliAnalysisTaskSoftDrop::FillHistograms()
 
       Double_t jetpt_ungrmd = jet->Pt() / ( jet->GetShapeProperties()->GetSoftDropPtfrac() );
 
-      std::vector<fastjet::PseudoJet> particles;
-      UShort_t ntracks = jet->GetNumberOfTracks();
-      for (int j = 0; j < ntracks; j++) {
-        particles.push_back( fastjet::PseudoJet( jet->Track(j)->Px(), jet->Track(j)->Py(), jet->Track(j)->Pz(), jet->Track(j)->E() ) );
-      }
-      fastjet::JetDefinition jet_def(fastjet::cambridge_algorithm, 0.4, fastjet::E_scheme);
-      fastjet::ClusterSequence cs(particles, jet_def);
-      std::vector<fastjet::PseudoJet> jets = sorted_by_pt(cs.inclusive_jets());
-
-      if (jets.size() > 0) {
+      // C/A declustering done once per jet, shared by all the grooming settings
+      AliJetSplittingRange splittings = fDeclusteringCache.GetSplittings(*jet);
+      if (splittings.IsValid()) {
+        Double_t inpt = splittings.GetJetPt();
         fSDM = 0;
-        SoftDropDeepDeclustering( jets[0], jets[0].pt() );
-        fhCorrPtZg2->Fill( jets[0].pt(), SoftDropDeclustering(jets[0], 0.5, 1.5) );
+        for (const auto &splitting : splittings) {
+          if (splitting.fZ > 0.1) {
+            fSDM++;
+            fhCorrPtZgD->Fill(inpt, splitting.fZ);
+            fhCorrPtRgD->Fill(inpt, splitting.fTheta);
+            fhCorrPtZgSDstep->Fill(inpt, splitting.fZ, fSDM);
+            fhCorrPtRgSDstep->Fill(inpt, splitting.fTheta, fSDM);
+          }
+        }
+        Int_t isd = AliJetDeclusteringCache::FindSoftDropSplitting(splittings, 0.5, 1.5, 0.4);
+        fhCorrPtZg2->Fill(inpt, isd >= 0 ? splittings[isd].fZ : 0.);
       }
 
       fhZg->Fill(jet->GetShapeProperties()->GetSoftDropZg());
@@ -504,37 +517,6 @@ void AliAnalysisTaskSoftDrop::CheckClusTrackMatching()
   }
 }
 
-void AliAnalysisTaskSoftDrop::SoftDropDeepDeclustering(fastjet::PseudoJet jet, const Float_t inpt) {
-
-  fastjet::PseudoJet jet1;
-  fastjet::PseudoJet jet2;
-
-  if ( jet.has_parents(jet1, jet2) ) {
-
-    Float_t pt1 = jet1.pt();
-    Float_t pt2 = jet2.pt();
-
-    Float_t dr = TMath::Sqrt( jet1.plain_distance(jet2) );
-
-    Float_t z;
-    if (pt1 < pt2) z = pt1/(pt1+pt2);
-    else z = pt2/(pt1+pt2);
-
-    if (z > 0.1) {
-      fSDM++;
-      fhCorrPtZgD->Fill(inpt, z);
-      fhCorrPtRgD->Fill(inpt, dr);
-      fhCorrPtZgSDstep->Fill(inpt, z,  fSDM);
-      fhCorrPtRgSDstep->Fill(inpt, dr, fSDM);
-    }
-
-    if (pt1 > pt2) SoftDropDeepDeclustering(jet1, inpt);
-    else SoftDropDeepDeclustering(jet2, inpt);
-
-  }
-
-}
-
 Float_t AliAnalysisTaskSoftDrop::SoftDropDeclustering(fastjet::PseudoJet jet, const Float_t zcut, const Float_t beta) {
 
   fastjet::PseudoJet jet1;
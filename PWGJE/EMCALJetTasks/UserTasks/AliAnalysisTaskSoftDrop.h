@@ -12,6 +12,7 @@ class AliClusterContainer;
 
 #include "AliAnalysisTaskEmcalJet.h"
 #include "FJ_includes.h"
+#include "AliJetDeclusteringCache.h"
 
 class AliAnalysisTaskSoftDrop : public AliAnalysisTaskEmcalJet {
  public:
@@ -45,8 +46,6 @@ class AliAnalysisTaskSoftDrop : public AliAnalysisTaskEmcalJet {
   Bool_t                      Run()              ;
   void                        CheckClusTrackMatching();
 
-  void                        SoftDropDeepDeclustering(fastjet::PseudoJet jet, const Float_t inpt); 
-
   // General histograms
   TH1                       **fHistTracksPt;            //!Track pt spectrum
   TH1                       **fHistClustersPt;          //!Cluster pt spectrum
@@ -80,6 +79,7 @@ class AliAnalysisTaskSoftDrop : public AliAnalysisTaskEmcalJet {
   AliJetContainer            *fJetsCont;                   //!Jets
   AliParticleContainer       *fTracksCont;                 //!Tracks
   AliClusterContainer        *fCaloClustersCont;           //!Clusters  
+  PWGJE::EMCALJetTasks::AliJetDeclusteringCache fDeclusteringCache; //!<! C/A declustering of the jets in the current event
 
  private:
   AliAnalysisTaskSoftDrop(const AliAnalysisTaskSoftDrop&);            // not implemented
@@ -87,6 +87,6 @@ class AliAnalysisTaskSoftDrop : public AliAnalysisTaskEmcalJet {
 
   Int_t                       fSDM;                     ///< number of the SD iterations
 
-  ClassDef(AliAnalysisTaskSoftDrop, 1) // jet sample analysis task
+  ClassDef(AliAnalysisTaskSoftDrop, 2) // jet sample analysis task
 };
 #endif
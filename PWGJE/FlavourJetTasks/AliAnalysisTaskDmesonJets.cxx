@@ -1836,6 +1836,8 @@ AliAnalysisTaskDmesonJets::AnalysisEngine::AnalysisEngine() :
   fRandomGen(0),
   fTrackEfficiency(0),
   fRejectISR(kFALSE),
+  fLocalReclustering(kFALSE),
+  fLocalReclusteringValidation(0),
   fDmesonJets(),
   fCandidateArray(0),
   fMCContainer(),
@@ -1879,6 +1881,8 @@ AliAnalysisTaskDmesonJets::AnalysisEngine::AnalysisEngine(ECandidateType_t type,
   fOutputHandler(nullptr),
   fRandomGen(0),
   fTrackEfficiency(0),
+  fLocalReclustering(kFALSE),
+  fLocalReclusteringValidation(0),
   fDmesonJets(),
   fCandidateArray(0),
   fMCContainer(),
@@ -1918,6 +1922,8 @@ AliAnalysisTaskDmesonJets::AnalysisEngine::AnalysisEngine(const AliAnalysisTaskD
   fD0Extended(source.fD0Extended),
   fRandomGen(source.fRandomGen),
   fTrackEfficiency(source.fTrackEfficiency),
+  fLocalReclustering(source.fLocalReclustering),
+  fLocalReclusteringValidation(source.fLocalReclusteringValidation),
   fDmesonJets(),
   fCandidateArray(source.fCandidateArray),
   fMCContainer(source.fMCContainer),
@@ -2555,6 +2561,8 @@ void AliAnalysisTaskDmesonJets::AnalysisEngine::RunDetectorLevelAnalysis()
   std::array<int, 3> nAccCharm = {0};
   std::array<std::array<int, 3>, 5> nAccCharmPt = {{{0}}};
 
+  if (fLocalReclustering) BuildLocalReclusteringInput();
+
   for (Int_t icharm = 0; icharm < nD; icharm++) {   //loop over D candidates
     AliAODRecoDecayHF2Prong* charmCand = static_cast<AliAODRecoDecayHF2Prong*>(fCandidateArray->At(icharm)); // D candidates
     if (!charmCand) continue;
@@ -2570,9 +2578,13 @@ void AliAnalysisTaskDmesonJets::AnalysisEngine::RunDetectorLevelAnalysis()
       DmesonJet.fSelectionType = im + 1;
       if (ExtractRecoDecayAttributes(charmCand, DmesonJet, im)) {
         for (auto& def : fJetDefinitions) {
-          if (FindJet(charmCand, DmesonJet, def)) {
+          if (FindJet(charmCand, DmesonJet, def, fLocalReclustering)) {
             Double_t jetPt = DmesonJet.fJets[def.GetName()].fMomentum.Pt();
             if (jetPt > maxJetPt[&def]) maxJetPt[&def] = jetPt;
+            if (fLocalReclustering && fLocalReclusteringValidation > 0) {
+              Double_t rnd = fRandomGen ? fRandomGen->Rndm() : gRandom->Rndm();
+              if (rnd < fLocalReclusteringValidation) ValidateLocalReclustering(charmCand, DmesonJet, def);
+            }
           }
           else {
             AliWarning(Form("Could not find jet '%s' for D meson '%s': pT = %.3f, eta = %.3f, phi = %.3f",
@@ -2672,9 +2684,10 @@ void AliAnalysisTaskDmesonJets::AnalysisEngine::RunDetectorLevelAnalysis()
 /// \param Dcand Valid pointer to a D meson candidate object
 /// \param DmesonJet Reference to a AliDmesonJetInfo object where the result will be stored
 /// \param r Jet radius
+/// \param localReclustering If kTRUE, only the neighbourhood of the D meson cached by BuildLocalReclusteringInput() is reclustered
 ///
 /// \return kTRUE on success, kFALSE otherwise
-Bool_t AliAnalysisTaskDmesonJets::AnalysisEngine::FindJet(AliAODRecoDecayHF2Prong* Dcand, AliDmesonJetInfo& DmesonJet, AliHFJetDefinition& jetDef)
+Bool_t AliAnalysisTaskDmesonJets::AnalysisEngine::FindJet(AliAODRecoDecayHF2Prong* Dcand, AliDmesonJetInfo& DmesonJet, AliHFJetDefinition& jetDef, Bool_t localReclustering)
 {
   TString hname;
 
@@ -2688,7 +2701,10 @@ Bool_t AliAnalysisTaskDmesonJets::AnalysisEngine::FindJet(AliAODRecoDecayHF2Pron
 
   fFastJetWrapper->AddInputVector(DmesonJet.fD.Px(), DmesonJet.fD.Py(), DmesonJet.fD.Pz(), DmesonJet.fD.E(), 0);
 
-  if (jetDef.fJetType != AliJetContainer::kNeutralJet) {
+  if (localReclustering) {
+    AddLocalInputVectors(Dcand, DmesonJet, jetDef);
+  }
+  else if (jetDef.fJetType != AliJetContainer::kNeutralJet) {
     for (auto track_cont : fTrackContainers) {
       AliHFTrackContainer* hftrack_cont = dynamic_cast<AliHFTrackContainer*>(track_cont);
       if (hftrack_cont) hftrack_cont->SetDMesonCandidate(Dcand);
@@ -2707,7 +2723,7 @@ Bool_t AliAnalysisTaskDmesonJets::AnalysisEngine::FindJet(AliAODRecoDecayHF2Pron
     }
   }
 
-  if (jetDef.fJetType != AliJetContainer::kChargedJet) {
+  if (!localReclustering && jetDef.fJetType != AliJetContainer::kChargedJet) {
     for (auto clus_cont : fClusterContainers) {
       hname = TString::Format("%s/%s/fHistClusterRejectionReason", GetName(), jetDef.GetName());
       AddInputVectors(clus_cont, -100, static_cast<TH2*>(fHistManager->FindObject(hname)));
@@ -2763,7 +2779,8 @@ Bool_t AliAnalysisTaskDmesonJets::AnalysisEngine::FindJet(AliAODRecoDecayHF2Pron
 /// Adds all the particles contained in the container into the fastjet wrapper
 ///
 /// \param cont Pointer to a valid AliEmcalContainer object
-void AliAnalysisTaskDmesonJets::AnalysisEngine::AddInputVectors(AliEmcalContainer* cont, Int_t offset, TH2* rejectHist, Double_t eff)
+/// \param input If not null, the accepted particles are stored in this cache instead of the fastjet wrapper
+void AliAnalysisTaskDmesonJets::AnalysisEngine::AddInputVectors(AliEmcalContainer* cont, Int_t offset, TH2* rejectHist, Double_t eff, LocalReclusteringInput* input)
 {
   auto itcont = cont->all_momentum();
   for (AliEmcalIterableMomentumContainer::iterator it = itcont.begin(); it != itcont.end(); it++) {
@@ -2780,10 +2797,137 @@ void AliAnalysisTaskDmesonJets::AnalysisEngine::AddInputVectors(AliEmcalContaine
       }
     }
     Int_t uid = offset >= 0 ? it.current_index() + offset: -it.current_index() - offset;
-    fFastJetWrapper->AddInputVector(it->first.Px(), it->first.Py(), it->first.Pz(), it->first.E(), uid);
+    if (input) {
+      LocalReclusteringInput::Particle part = {it->first.Px(), it->first.Py(), it->first.Pz(), it->first.E(), uid, -1, it->second};
+      input->fParticles.push_back(part);
+    }
+    else {
+      fFastJetWrapper->AddInputVector(it->first.Px(), it->first.Py(), it->first.Pz(), it->first.E(), uid);
+    }
+  }
+}
+
+/// Caches the accepted tracks and clusters of the event for each jet definition
+/// and clusters them once (without the D meson candidate and without ghosts).
+/// The candidate loop then only reclusters the particles of the event jets
+/// found within 2R of each D meson candidate (see AddLocalInputVectors()).
+/// The rejection histograms and the artificial tracking inefficiency are applied
+/// once per event, instead of once per candidate as in the full reclustering.
+void AliAnalysisTaskDmesonJets::AnalysisEngine::BuildLocalReclusteringInput()
+{
+  TString hname;
+
+  fLocalReclusteringInput.clear();
+
+  for (auto track_cont : fTrackContainers) {
+    AliHFTrackContainer* hftrack_cont = dynamic_cast<AliHFTrackContainer*>(track_cont);
+    if (hftrack_cont) hftrack_cont->SetDMesonCandidate(nullptr);
+  }
+
+  for (auto& jetDef : fJetDefinitions) {
+    LocalReclusteringInput& input = fLocalReclusteringInput[jetDef.GetName()];
+
+    if (jetDef.fJetType != AliJetContainer::kNeutralJet) {
+      for (auto track_cont : fTrackContainers) {
+        hname = TString::Format("%s/%s/fHistTrackRejectionReason", GetName(), jetDef.GetName());
+        AddInputVectors(track_cont, 100, static_cast<TH2*>(fHistManager->FindObject(hname)), fTrackEfficiency, &input);
+      }
+    }
+
+    if (jetDef.fJetType != AliJetContainer::kChargedJet) {
+      for (auto clus_cont : fClusterContainers) {
+        hname = TString::Format("%s/%s/fHistClusterRejectionReason", GetName(), jetDef.GetName());
+        AddInputVectors(clus_cont, -100, static_cast<TH2*>(fHistManager->FindObject(hname)), 0., &input);
+      }
+    }
+
+    std::vector<fastjet::PseudoJet> particles;
+    particles.reserve(input.fParticles.size());
+    for (UInt_t ipart = 0; ipart < input.fParticles.size(); ipart++) {
+      const LocalReclusteringInput::Particle& part = input.fParticles[ipart];
+      particles.push_back(fastjet::PseudoJet(part.fPx, part.fPy, part.fPz, part.fE));
+      particles.back().set_user_index(ipart);
+    }
+
+    fastjet::JetDefinition fjJetDef(AliEmcalJetTask::ConvertToFJAlgo(jetDef.fJetAlgo), jetDef.fRadius, AliEmcalJetTask::ConvertToFJRecoScheme(jetDef.fRecoScheme));
+    fastjet::ClusterSequence clustSeq(particles, fjJetDef);
+    std::vector<fastjet::PseudoJet> jets = clustSeq.inclusive_jets();
+
+    input.fJetEta.resize(jets.size());
+    input.fJetPhi.resize(jets.size());
+    for (UInt_t ijet = 0; ijet < jets.size(); ijet++) {
+      input.fJetEta[ijet] = jets[ijet].eta();
+      input.fJetPhi[ijet] = jets[ijet].phi();
+      std::vector<fastjet::PseudoJet> constituents(clustSeq.constituents(jets[ijet]));
+      for (auto& constituent : constituents) input.fParticles[constituent.user_index()].fJet = ijet;
+    }
+  }
+}
+
+/// Adds to the fastjet wrapper the cached particles of the event jets
+/// whose axis is within 2R of the D meson candidate, excluding the daughters of the candidate
+///
+/// \param Dcand Valid pointer to a D meson candidate object
+/// \param DmesonJet Reference to a AliDmesonJetInfo object with the D meson momentum
+/// \param jetDef Jet definition
+void AliAnalysisTaskDmesonJets::AnalysisEngine::AddLocalInputVectors(AliAODRecoDecayHF2Prong* Dcand, const AliDmesonJetInfo& DmesonJet, AliHFJetDefinition& jetDef)
+{
+  TString hname;
+
+  LocalReclusteringInput& input = fLocalReclusteringInput[jetDef.GetName()];
+
+  Double_t maxDist2 = 4 * jetDef.fRadius * jetDef.fRadius;
+  std::vector<Bool_t> jetSelected(input.fJetEta.size(), kFALSE);
+  for (UInt_t ijet = 0; ijet < input.fJetEta.size(); ijet++) {
+    Double_t deta = input.fJetEta[ijet] - DmesonJet.fD.Eta();
+    Double_t dphi = TVector2::Phi_mpi_pi(input.fJetPhi[ijet] - DmesonJet.fD.Phi());
+    jetSelected[ijet] = deta * deta + dphi * dphi < maxDist2;
+  }
+
+  TObjArray daughters;
+  if (jetDef.fJetType != AliJetContainer::kNeutralJet) {
+    for (auto track_cont : fTrackContainers) {
+      AliHFTrackContainer* hftrack_cont = dynamic_cast<AliHFTrackContainer*>(track_cont);
+      if (!hftrack_cont) continue;
+      hftrack_cont->SetDMesonCandidate(Dcand);
+      hname = TString::Format("%s/%s/fHistDMesonDaughterNotInJet", GetName(), jetDef.GetName());
+      TH1* histDaughterNotInJet = static_cast<TH1*>(fHistManager->FindObject(hname));
+      const TObjArray& daughterList = hftrack_cont->GetDaughterList();
+      for (Int_t i = 0; i < daughterList.GetEntriesFast(); i++) {
+        AliVParticle* daughter = static_cast<AliVParticle*>(daughterList.At(i));
+        if (!hftrack_cont->GetArray()->FindObject(daughter)) histDaughterNotInJet->Fill(daughter->Pt());
+        daughters.AddLast(daughter);
+      }
+    }
+  }
+
+  for (auto& part : input.fParticles) {
+    if (part.fJet < 0 || !jetSelected[part.fJet]) continue;
+    if (part.fUserIndex >= 100 && daughters.FindObject(part.fObject)) continue;
+    fFastJetWrapper->AddInputVector(part.fPx, part.fPy, part.fPz, part.fE, part.fUserIndex);
   }
 }
 
+/// Compares the jet found with the local reclustering with the jet obtained from the full reclustering of the event
+///
+/// \param Dcand Valid pointer to a D meson candidate object
+/// \param DmesonJet Reference to a AliDmesonJetInfo object with the result of the local reclustering
+/// \param jetDef Jet definition
+void AliAnalysisTaskDmesonJets::AnalysisEngine::ValidateLocalReclustering(AliAODRecoDecayHF2Prong* Dcand, const AliDmesonJetInfo& DmesonJet, AliHFJetDefinition& jetDef)
+{
+  AliDmesonJetInfo fullDmesonJet(DmesonJet);
+  if (!FindJet(Dcand, fullDmesonJet, jetDef, kFALSE)) return;
+
+  const AliJetInfo& localJet = DmesonJet.fJets.at(jetDef.GetName());
+  const AliJetInfo& fullJet = fullDmesonJet.fJets[jetDef.GetName()];
+
+  TString hname = TString::Format("%s/%s/fHistLocalReclusteringDeltaPt", GetName(), jetDef.GetName());
+  fHistManager->FillTH2(hname, fullJet.fMomentum.Pt(), localJet.fMomentum.Pt() - fullJet.fMomentum.Pt());
+
+  hname = TString::Format("%s/%s/fHistLocalReclusteringDeltaNConst", GetName(), jetDef.GetName());
+  fHistManager->FillTH2(hname, fullJet.fMomentum.Pt(), localJet.fNConstituents - fullJet.fNConstituents);
+}
+
 /// Run a particle level analysis
 void AliAnalysisTaskDmesonJets::AnalysisEngine::RunParticleLevelAnalysis()
 {
@@ -2963,6 +3107,8 @@ AliAnalysisTaskDmesonJets::AliAnalysisTaskDmesonJets() :
   fNOutputTrees(0),
   fTrackEfficiency(0),
   fRejectISR(kFALSE),
+  fLocalReclustering(kFALSE),
+  fLocalReclusteringValidation(0),
   fJetAreaType(fastjet::active_area),
   fJetGhostArea(0.005),
   fMCContainer(0),
@@ -2985,6 +3131,8 @@ AliAnalysisTaskDmesonJets::AliAnalysisTaskDmesonJets(const char* name, Int_t nOu
   fNOutputTrees(nOutputTrees),
   fTrackEfficiency(0),
   fRejectISR(kFALSE),
+  fLocalReclustering(kFALSE),
+  fLocalReclusteringValidation(0),
   fJetAreaType(fastjet::active_area),
   fJetGhostArea(0.005),
   fMCContainer(0),
@@ -3313,6 +3461,16 @@ void AliAnalysisTaskDmesonJets::UserCreateOutputObjects()
       htitle = hname + ";#it{p}_{T,track} (GeV/#it{c});counts";
       fHistManager.CreateTH1(hname, htitle, 200, 0, 100);
 
+      if (fLocalReclustering && fLocalReclusteringValidation > 0 && param.fMCMode != kMCTruth) {
+        hname = TString::Format("%s/%s/fHistLocalReclusteringDeltaPt", param.GetName(), jetDef.GetName());
+        htitle = hname + ";#it{p}_{T,jet}^{full} (GeV/#it{c});#it{p}_{T,jet}^{local} - #it{p}_{T,jet}^{full} (GeV/#it{c});counts";
+        fHistManager.CreateTH2(hname, htitle, 150, 0, 150, 200, -10, 10);
+
+        hname = TString::Format("%s/%s/fHistLocalReclusteringDeltaNConst", param.GetName(), jetDef.GetName());
+        htitle = hname + ";#it{p}_{T,jet}^{full} (GeV/#it{c});#it{N}_{constituents}^{local} - #it{N}_{constituents}^{full};counts";
+        fHistManager.CreateTH2(hname, htitle, 150, 0, 150, 21, -10.5, 10.5);
+      }
+
       hname = TString::Format("%s/%s/fHistRejectedJetPt", param.GetName(), jetDef.GetName());
       htitle = hname + ";#it{p}_{T,jet} (GeV/#it{c});counts";
       fHistManager.CreateTH1(hname, htitle, 150, 0, 150);
@@ -3447,6 +3605,8 @@ void AliAnalysisTaskDmesonJets::ExecOnce()
     params.fFastJetWrapper = fFastJetWrapper;
     params.fTrackEfficiency = fTrackEfficiency;
     params.fRejectISR = fRejectISR;
+    params.fLocalReclustering = fLocalReclustering;
+    params.fLocalReclusteringValidation = fLocalReclusteringValidation;
     params.fRandomGen = rnd;
 
     for (auto &jetdef: params.fJetDefinitions) {
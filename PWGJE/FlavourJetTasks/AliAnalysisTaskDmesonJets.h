@@ -53,6 +53,7 @@ class AliRhoParameter;
 #include <list>
 #include <vector>
 #include <map>
+#include <string>
 
 #include "AliTLorentzVector.h"
 #include "THistManager.h"
@@ -773,6 +774,8 @@ class AliAnalysisTaskDmesonJets : public AliAnalysisTaskEmcalLight
     TRandom                           *fRandomGen             ; //!<! Random number generator
     Double_t                           fTrackEfficiency       ; //!<! Artificial tracking inefficiency (0...1) -> set automatically at ExecOnce by AliAnalysisTaskDmesonJets
     Bool_t                             fRejectISR             ; //!<! Reject initial state radiation
+    Bool_t                             fLocalReclustering     ; //!<! Recluster only the neighbourhood of each D meson candidate -> set automatically at ExecOnce by AliAnalysisTaskDmesonJets
+    Double_t                           fLocalReclusteringValidation; //!<! Fraction of the candidates for which the local reclustering is compared to the full reclustering
     std::map<int, AliDmesonJetInfo>    fDmesonJets            ; //!<! Array containing the D meson jets
     TClonesArray                      *fCandidateArray        ; //!<! D meson candidate array
     AliHFAODMCParticleContainer*       fMCContainer           ; //!<! MC particle container
@@ -789,7 +792,30 @@ class AliAnalysisTaskDmesonJets : public AliAnalysisTaskEmcalLight
 
   private:
 
-    void                AddInputVectors(AliEmcalContainer* cont, Int_t offset, TH2* rejectHist=0, Double_t eff=0.);
+    /// \struct LocalReclusteringInput
+    /// \brief Jet finder input of one jet definition, cached once per event for the local reclustering
+    struct LocalReclusteringInput {
+      /// \struct Particle
+      /// \brief Accepted track or cluster
+      struct Particle {
+        Double_t                       fPx                    ; ///<  Momentum x
+        Double_t                       fPy                    ; ///<  Momentum y
+        Double_t                       fPz                    ; ///<  Momentum z
+        Double_t                       fE                     ; ///<  Energy
+        Int_t                          fUserIndex             ; ///<  User index of the fastjet input vector
+        Int_t                          fJet                   ; ///<  Index of the event jet that contains the particle
+        const TObject                 *fObject                ; ///<  Track or cluster object
+      };
+
+      std::vector<Particle>            fParticles             ; ///<  Accepted tracks and clusters
+      std::vector<Double_t>            fJetEta                ; ///<  Pseudorapidity of the event jets
+      std::vector<Double_t>            fJetPhi                ; ///<  Azimuthal angle of the event jets
+    };
+
+    void                AddInputVectors(AliEmcalContainer* cont, Int_t offset, TH2* rejectHist=0, Double_t eff=0., LocalReclusteringInput* input=0);
+    void                BuildLocalReclusteringInput();
+    void                AddLocalInputVectors(AliAODRecoDecayHF2Prong* Dcand, const AliDmesonJetInfo& DmesonJet, AliHFJetDefinition& jetDef);
+    void                ValidateLocalReclustering(AliAODRecoDecayHF2Prong* Dcand, const AliDmesonJetInfo& DmesonJet, AliHFJetDefinition& jetDef);
     void                SetCandidateProperties(Double_t range);
     AliAODMCParticle*   MatchToMC() const;
     void                RunDetectorLevelAnalysis();
@@ -798,7 +824,11 @@ class AliAnalysisTaskDmesonJets : public AliAnalysisTaskEmcalLight
     Bool_t              ExtractRecoDecayAttributes(const AliAODRecoDecayHF2Prong* Dcand, AliDmesonJetInfo& DmesonJet, UInt_t i);
     Bool_t              ExtractD0Attributes(const AliAODRecoDecayHF2Prong* Dcand, AliDmesonJetInfo& DmesonJet, UInt_t i);
     Bool_t              ExtractDstarAttributes(const AliAODRecoCascadeHF* DstarCand, AliDmesonJetInfo& DmesonJet, UInt_t i);
-    Bool_t              FindJet(AliAODRecoDecayHF2Prong* Dcand, AliDmesonJetInfo& DmesonJet, AliHFJetDefinition& jetDef);
+    Bool_t              FindJet(AliAODRecoDecayHF2Prong* Dcand, AliDmesonJetInfo& DmesonJet, AliHFJetDefinition& jetDef, Bool_t localReclustering=kFALSE);
+
+#if !(defined(__CINT__) || defined(__MAKECINT__))
+    std::map<std::string, LocalReclusteringInput> fLocalReclusteringInput; //!<! Cached jet finder input for the local reclustering (one per jet definition)
+#endif
 
     /// \cond CLASSIMP
     ClassDef(AnalysisEngine, 3);
@@ -829,6 +859,8 @@ class AliAnalysisTaskDmesonJets : public AliAnalysisTaskEmcalLight
   void SetOutputType(EOutputType_t b)             { SetOutputTypeInternal(b); }
   void SetTrackEfficiency(Double_t t)             { fTrackEfficiency    = t ; }
   void SetRejectISR(Bool_t b)                     { fRejectISR          = b ; }
+  void SetLocalReclustering(Bool_t b,
+      Double_t validation = 0.)                   { fLocalReclustering  = b ; fLocalReclusteringValidation = validation; }
   void SetJetArea(Int_t type,
       Double_t garea = 0.005)                     { fJetAreaType        = type; fJetGhostArea = garea; }
 
@@ -861,6 +893,8 @@ class AliAnalysisTaskDmesonJets : public AliAnalysisTaskEmcalLight
   Int_t                fNOutputTrees              ; ///<  Maximum number of output trees
   Double_t             fTrackEfficiency           ; ///<  Artificial tracking inefficiency (0...1)
   Bool_t               fRejectISR                 ; ///<  Reject initial state radiation
+  Bool_t               fLocalReclustering         ; ///<  Cluster the event once and recluster only the 2R neighbourhood of each D meson candidate
+  Double_t             fLocalReclusteringValidation; ///<  Fraction of the candidates for which the local reclustering is compared to the full reclustering
   Int_t                fJetAreaType               ; ///<  Jet area type
   Double_t             fJetGhostArea              ; ///<  Area of the ghost particles
   AliHFAODMCParticleContainer* fMCContainer       ; //!<! MC particle container
@@ -873,7 +907,7 @@ class AliAnalysisTaskDmesonJets : public AliAnalysisTaskEmcalLight
   AliAnalysisTaskDmesonJets& operator=(const AliAnalysisTaskDmesonJets& source);
 
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisTaskDmesonJets, 10);
+  ClassDef(AliAnalysisTaskDmesonJets, 11);
   /// \endcond
 };
 
@@ -69,6 +69,7 @@
 #include "AliPIDResponse.h"
 #include "AliAODPid.h"
 #include "AliExternalTrackParam.h"
+#include "AliEtaPhiConeIndex.h"
 #include "AliAnalysisTaskJetChem.h"
 #include "AliPhysicsSelection.h"
 #include "AliBackgroundSelection.h"
@@ -183,6 +184,9 @@ AliAnalysisTaskJetChem::AliAnalysisTaskJetChem()
    ,fListALa(0)
    ,fListALaMC(0)
    ,fListALaStandard(0)
+   ,fV0ConeIndexK0s(0)
+   ,fV0ConeIndexLa(0)
+   ,fV0ConeIndexALa(0)
    ,fListFeeddownLaCand(0)
    ,fListFeeddownALaCand(0)
    ,jetConeFDLalist(0)
@@ -530,6 +534,9 @@ AliAnalysisTaskJetChem::AliAnalysisTaskJetChem(const char *name)
   ,fListALa(0)
   ,fListALaMC(0)
   ,fListALaStandard(0)
+  ,fV0ConeIndexK0s(0)
+  ,fV0ConeIndexLa(0)
+  ,fV0ConeIndexALa(0)
   ,fListFeeddownLaCand(0)
   ,fListFeeddownALaCand(0)
   ,jetConeFDLalist(0)
@@ -880,6 +887,9 @@ AliAnalysisTaskJetChem::AliAnalysisTaskJetChem(const  AliAnalysisTaskJetChem &co
   ,fListALa(copy.fListALa)
   ,fListALaMC(copy.fListALaMC)
   ,fListALaStandard(copy.fListALaStandard)
+  ,fV0ConeIndexK0s(copy.fV0ConeIndexK0s)
+  ,fV0ConeIndexLa(copy.fV0ConeIndexLa)
+  ,fV0ConeIndexALa(copy.fV0ConeIndexALa)
   ,fListFeeddownLaCand(copy.fListFeeddownLaCand)
   ,fListFeeddownALaCand(copy.fListFeeddownALaCand)
   ,jetConeFDLalist(copy.jetConeFDLalist)
@@ -1235,6 +1245,9 @@ AliAnalysisTaskJetChem& AliAnalysisTaskJetChem::operator=(const AliAnalysisTaskJ
     fListALa                        = o.fListALa;
     fListALaMC                      = o.fListALaMC;
     fListALaStandard                = o.fListALaStandard;
+    fV0ConeIndexK0s                 = o.fV0ConeIndexK0s;
+    fV0ConeIndexLa                  = o.fV0ConeIndexLa;
+    fV0ConeIndexALa                 = o.fV0ConeIndexALa;
     fListFeeddownLaCand             = o.fListFeeddownLaCand;
     fListFeeddownALaCand            = o.fListFeeddownALaCand;
     jetConeFDLalist                 = o.jetConeFDLalist;
@@ -1521,6 +1534,9 @@ AliAnalysisTaskJetChem::~AliAnalysisTaskJetChem()
   if(fListK0sStandard) delete fListK0sStandard;
   if(fListLaStandard) delete fListLaStandard;
   if(fListALaStandard) delete fListALaStandard;
+  if(fV0ConeIndexK0s) delete fV0ConeIndexK0s;
+  if(fV0ConeIndexLa) delete fV0ConeIndexLa;
+  if(fV0ConeIndexALa) delete fV0ConeIndexALa;
   if(fListFeeddownLaCand) delete fListFeeddownLaCand;
   if(fListFeeddownALaCand) delete fListFeeddownALaCand;
   if(jetConeFDLalist) delete jetConeFDLalist;
@@ -1786,6 +1802,9 @@ void AliAnalysisTaskJetChem::UserCreateOutputObjects()
   fListLaStandard->SetOwner(kFALSE);
   fListALaStandard = new TList(); 
   fListALaStandard->SetOwner(kFALSE);
+  fV0ConeIndexK0s = new AliEtaPhiConeIndex();
+  fV0ConeIndexLa = new AliEtaPhiConeIndex();
+  fV0ConeIndexALa = new AliEtaPhiConeIndex();
   fListFeeddownLaCand = new TList();    //feeddown Lambda candidates
   fListFeeddownLaCand->SetOwner(kFALSE);
   fListFeeddownALaCand = new TList();   //feeddown Antilambda candidates
@@ -3294,6 +3313,11 @@ void AliAnalysisTaskJetChem::UserExec(Option_t *)
   if(fUseExtraTracks == -1)    nALa = GetListOfV0s(fListALa,fALaType,kAntiLambda,kTrackAODExtraonlyCuts,myPrimaryVertex,fAOD);// only v0s from PYTHIA embedding
   if(fUseExtraTracks ==  0)    nALa = GetListOfV0s(fListALa,fALaType,kAntiLambda,kTrackAODCuts,myPrimaryVertex,fAOD);//all standard tracks of event, no embedded tracks
 
+  // eta-phi index of the V0 lists, used by all cone queries (jet, random, median and perp. cones) of this event
+  fV0ConeIndexK0s->Build(fListK0s);
+  fV0ConeIndexLa->Build(fListLa);
+  fV0ConeIndexALa->Build(fListALa);
+
   if(fDebug>2)Printf("%s:%d Selected Rec ALa candidates after cuts: %d %d",(char*)__FILE__,__LINE__,nALa,fListALa->GetEntries());
   if(nALa != fListALa->GetEntries()) Printf("%s:%d Mismatch selected ALa: %d %d",(char*)__FILE__,__LINE__,nALa,fListALa->GetEntries());
   if(fMatchMode == 2){
@@ -5938,6 +5962,9 @@ void AliAnalysisTaskJetChem::UserExec(Option_t *)
   fListK0s->Clear();
   fListLa->Clear();
   fListALa->Clear();
+  fV0ConeIndexK0s->Reset();
+  fV0ConeIndexLa->Reset();
+  fV0ConeIndexALa->Reset();
 
   fListK0sMC->Clear();
   fListLaMC->Clear();
@@ -6977,32 +7004,44 @@ void AliAnalysisTaskJetChem::GetTracksInCone(TList* inputlist, TList* outputlist
   Bool_t isBadMaxPt = kFALSE;
   Bool_t isBadMinPt = kTRUE;   
 
-  Double_t jetMom[3];
   if(!jet)return;
-  jet->PxPyPz(jetMom);
-  TVector3 jet3mom(jetMom);
 
+  std::vector<AliVParticle*> inCone;
+  const AliEtaPhiConeIndex* index = GetV0ConeIndex(inputlist);
+  if(index){ // V0 lists of the event are indexed in eta-phi, only the cells overlapping the cone are checked
+    std::vector<Int_t> found;
+    index->FindInCone(jet, radius, found);
+    for(UInt_t i=0; i<found.size(); i++) inCone.push_back(const_cast<AliVParticle*>(index->GetParticle(found[i])));
+  }
+  else {
+    Double_t jetMom[3];
+    jet->PxPyPz(jetMom);
+    TVector3 jet3mom(jetMom);
 
-  for (Int_t itrack=0; itrack<inputlist->GetSize(); itrack++){//loop over all K0s found in event
+    for (Int_t itrack=0; itrack<inputlist->GetSize(); itrack++){//loop over all K0s found in event
 
-    AliVParticle* track = dynamic_cast<AliVParticle*>(inputlist->At(itrack));
-    if(!track)continue;
-    Double_t trackMom[3];
-    track->PxPyPz(trackMom);
-    TVector3 track3mom(trackMom);
+      AliVParticle* track = dynamic_cast<AliVParticle*>(inputlist->At(itrack));
+      if(!track)continue;
+      Double_t trackMom[3];
+      track->PxPyPz(trackMom);
+      TVector3 track3mom(trackMom);
 
-    Double_t dR = jet3mom.DeltaR(track3mom);
+      Double_t dR = jet3mom.DeltaR(track3mom);
 
-    if(dR<radius){//fill all the V0s inside cone into outputlist, radius is return value of GetFFRadius() 
+      if(dR<radius) inCone.push_back(track);
+    }
+  }
 
-      outputlist->Add(track);
-      
-      sumPt += track->Pt();
+  for (UInt_t itrack=0; itrack<inCone.size(); itrack++){//fill all the V0s inside cone into outputlist, radius is return value of GetFFRadius() 
 
-      if(maxPt>0 && track->Pt()>maxPt) isBadMaxPt = kTRUE;   // reject jets containing any track with pt larger than this value, use GetFFMaxTrackPt()
-      if(minPt>0 && track->Pt()>minPt) isBadMinPt = kFALSE;  // reject jets with leading track with pt smaller than this value, use GetFFMinLTrackPt()
+    AliVParticle* track = inCone[itrack];
 
-    }
+    outputlist->Add(track);
+      
+    sumPt += track->Pt();
+
+    if(maxPt>0 && track->Pt()>maxPt) isBadMaxPt = kTRUE;   // reject jets containing any track with pt larger than this value, use GetFFMaxTrackPt()
+    if(minPt>0 && track->Pt()>minPt) isBadMinPt = kFALSE;  // reject jets with leading track with pt smaller than this value, use GetFFMinLTrackPt()
   }
 
   isBadPt = kFALSE; 
@@ -7070,46 +7109,61 @@ void AliAnalysisTaskJetChem::GetTracksInPerpCone(TList* inputlist, TList* output
   //TVector3 perpjetminus3momTest(jetMomminusTest);   //new TVector3 for -90deg rotated jet axis with rotation method from ROOT
 
 
-  for (Int_t itrack=0; itrack<inputlist->GetSize(); itrack++){ //collect V0 content in perp cone, rotated clockwise 
+  const AliEtaPhiConeIndex* index = GetV0ConeIndex(inputlist);
+  if(index){ // V0 lists of the event are indexed in eta-phi, only the cells overlapping the cones are checked
+    std::vector<Int_t> found;
+    const TVector3* perpAxes[2] = {&perpjetplus3mom, &perpjetneg3mom};
+    for(Int_t iaxis=0; iaxis<2; iaxis++){ //collect V0 content in perp cone, rotated clockwise, then counterclockwise
+      index->FindInCone(perpAxes[iaxis]->Eta(), perpAxes[iaxis]->Phi(), radius, found);
+      for(UInt_t i=0; i<found.size(); i++){
+        AliVParticle* track = const_cast<AliVParticle*>(index->GetParticle(found[i]));
+        outputlist->Add(track); // output list is jetPerpConeK0list
+        sumPerpPt += track->Pt();
+      }
+    }
+  }
+  else {
+    for (Int_t itrack=0; itrack<inputlist->GetSize(); itrack++){ //collect V0 content in perp cone, rotated clockwise 
 
-    AliVParticle* track = dynamic_cast<AliVParticle*>(inputlist->At(itrack)); //inputlist is fListK0s, all reconstructed K0s in event
-    if(!track){std::cout<<"K0s track not found!!!"<<std::endl; continue;}
+      AliVParticle* track = dynamic_cast<AliVParticle*>(inputlist->At(itrack)); //inputlist is fListK0s, all reconstructed K0s in event
+      if(!track){std::cout<<"K0s track not found!!!"<<std::endl; continue;}
 
-    Double_t trackMom[3];//3-mom of V0 particle
-    track->PxPyPz(trackMom);
-    TVector3 track3mom(trackMom);
+      Double_t trackMom[3];//3-mom of V0 particle
+      track->PxPyPz(trackMom);
+      TVector3 track3mom(trackMom);
 
-    Double_t dR = perpjetplus3mom.DeltaR(track3mom);
+      Double_t dR = perpjetplus3mom.DeltaR(track3mom);
 
-    if(dR<radius){
+      if(dR<radius){
 
-      outputlist->Add(track); // output list is jetPerpConeK0list
+        outputlist->Add(track); // output list is jetPerpConeK0list
       
-      sumPerpPt += track->Pt();
+        sumPerpPt += track->Pt();
 
 
+      }
     }
-  }
 
 
-  for (Int_t itrack=0; itrack<inputlist->GetSize(); itrack++){//collect V0 content in perp cone, rotated counterclockwise 
+    for (Int_t itrack=0; itrack<inputlist->GetSize(); itrack++){//collect V0 content in perp cone, rotated counterclockwise 
 
-    AliVParticle* track = dynamic_cast<AliVParticle*>(inputlist->At(itrack)); //inputlist is fListK0s, all reconstructed K0s in event
-    if(!track){std::cout<<"K0s track not found!!!"<<std::endl; continue;}
+      AliVParticle* track = dynamic_cast<AliVParticle*>(inputlist->At(itrack)); //inputlist is fListK0s, all reconstructed K0s in event
+      if(!track){std::cout<<"K0s track not found!!!"<<std::endl; continue;}
 
-    Double_t trackMom[3];//3-mom of V0 particle
-    track->PxPyPz(trackMom);
-    TVector3 track3mom(trackMom);
+      Double_t trackMom[3];//3-mom of V0 particle
+      track->PxPyPz(trackMom);
+      TVector3 track3mom(trackMom);
 
-    Double_t dR = perpjetneg3mom.DeltaR(track3mom);
+      Double_t dR = perpjetneg3mom.DeltaR(track3mom);
 
-    if(dR<radius){
+      if(dR<radius){
 
-      outputlist->Add(track); // output list is jetPerpConeK0list
+        outputlist->Add(track); // output list is jetPerpConeK0list
       
-      sumPerpPt += track->Pt();
+        sumPerpPt += track->Pt();
 
 
+      }
     }
   }
 
@@ -7441,6 +7495,18 @@ Bool_t AliAnalysisTaskJetChem::IsParticleInCone(const AliVParticle* part1, const
 }
 //__________________________________________________________________________________________________________________
 
+const AliEtaPhiConeIndex* AliAnalysisTaskJetChem::GetV0ConeIndex(const TList* list) const
+{
+// eta-phi index built for this list in the current event, 0 if the list is not indexed
+  if(!list) return 0;
+  const AliEtaPhiConeIndex* indices[3] = {fV0ConeIndexK0s, fV0ConeIndexLa, fV0ConeIndexALa};
+  for(Int_t i=0; i<3; i++){
+    if(indices[i] && indices[i]->GetSource() == list && indices[i]->GetNEntries() == list->GetSize()) return indices[i];
+  }
+  return 0;
+}
+//__________________________________________________________________________________________________________________
+
 
 Bool_t AliAnalysisTaskJetChem::IsRCJCOverlap(TList* recjetlist, const AliVParticle* part, Double_t dDistance) const{
   
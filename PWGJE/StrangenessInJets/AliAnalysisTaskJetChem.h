@@ -30,6 +30,7 @@ class TList;
 class AliAODMCParticle;
 class AliAODTrack;
 class TRandom3;
+class AliEtaPhiConeIndex;
 
 #include "AliAnalysisTaskFragmentationFunction.h"
 #include "AliPID.h"
@@ -126,6 +127,7 @@ class AliAnalysisTaskJetChem : public AliAnalysisTaskFragmentationFunction {
   Int_t  GetListOfMCParticles(TList *outputlist, Int_t particletype, AliAODEvent* mcaodevent);
   void   GetTracksInCone(TList* inputlist, TList* outputlist, const AliAODJet* jet, Double_t radius, Double_t& sumPt, Double_t minPt, Double_t maxPt, Bool_t& isBadPt);
   void   GetTracksInPerpCone(TList* inputlist, TList* outputlist, const AliAODJet* jet, Double_t radius, Double_t& sumPerpPt);
+  const AliEtaPhiConeIndex* GetV0ConeIndex(const TList* list) const;
   Bool_t MCLabelCheck(AliAODv0* v0, Int_t particletype, const AliAODTrack* trackNeg, const AliAODTrack* trackPos, TList *listmc, Int_t& negDaughterpdg, Int_t& posDaughterpdg, Int_t& motherType, Int_t& v0Label, Double_t& MCPt, Bool_t& fPhysicalPrimary, Int_t& MCv0PDGCode, TString& generatorName, Bool_t& isinjected);
   Bool_t IsParticleMatching(const AliAODMCParticle* mcp0, Int_t v0Label);
   Bool_t DaughterTrackCheck(AliAODv0* v0, Int_t& nnum, Int_t& pnum);
@@ -342,6 +344,9 @@ class AliAnalysisTaskJetChem : public AliAnalysisTaskFragmentationFunction {
   TList* fListALa;                                         //! ALa list 
   TList* fListALaMC;                                       //! MC gen PYTHIA ALa list 
   TList* fListALaStandard;                                 //! ALa list 
+  AliEtaPhiConeIndex* fV0ConeIndexK0s;                     //! eta-phi index of fListK0s
+  AliEtaPhiConeIndex* fV0ConeIndexLa;                      //! eta-phi index of fListLa
+  AliEtaPhiConeIndex* fV0ConeIndexALa;                     //! eta-phi index of fListALa
 
   TList* fListFeeddownLaCand;                              //! feeddown from Xi (-,0) 
   TList* fListFeeddownALaCand;                             //! feeddown from Xibar (+,0) 
@@ -616,7 +621,7 @@ class AliAnalysisTaskJetChem : public AliAnalysisTaskFragmentationFunction {
   TH1F* fh1MCEtaAntiLambda;
 
 
-  ClassDef(AliAnalysisTaskJetChem, 3);
+  ClassDef(AliAnalysisTaskJetChem, 4);
 };
 
 #endif
@@ -41,6 +41,7 @@
 //#include "AliJetObject.cxx"
 #include "TRandom3.h"
 
+#include "AliEtaPhiConeIndex.h"
 #include "AliAnalysisTaskV0sInJets.h"
 
 ClassImp(AliAnalysisTaskV0sInJets)
@@ -99,6 +100,7 @@ AliAnalysisTaskV0sInJets::AliAnalysisTaskV0sInJets():
   fbMCAnalysis(0),
 //  fbTreeOutput(0),
   fRandom(0),
+  fV0ConeIndex(0),
 
   fdCutVertexZ(10),
   fdCutVertexR2(1),
@@ -357,6 +359,7 @@ AliAnalysisTaskV0sInJets::AliAnalysisTaskV0sInJets(const char* name):
   fbMCAnalysis(0),
 //  fbTreeOutput(0),
   fRandom(0),
+  fV0ConeIndex(0),
 
   fdCutVertexZ(10),
   fdCutVertexR2(1),
@@ -616,6 +619,8 @@ AliAnalysisTaskV0sInJets::~AliAnalysisTaskV0sInJets()
 */
   delete fRandom;
   fRandom = 0;
+  delete fV0ConeIndex;
+  fV0ConeIndex = 0;
 }
 
 void AliAnalysisTaskV0sInJets::UserCreateOutputObjects()
@@ -624,6 +629,7 @@ void AliAnalysisTaskV0sInJets::UserCreateOutputObjects()
   // Called once
 
   fRandom = new TRandom3(0);
+  fV0ConeIndex = new AliEtaPhiConeIndex();
 
 /*
   if (!fBranchV0Rec && fbTreeOutput)
@@ -1668,6 +1674,46 @@ void AliAnalysisTaskV0sInJets::UserExec(Option_t*)
   fh1VtxZ[iCentIndex]->Fill(dPrimVtxPos[2]);
   fh2VtxXY[iCentIndex]->Fill(dPrimVtxPos[0], dPrimVtxPos[1]);
 
+  // Find the V0 candidates in the jet, perp., rnd. and med. cones once per event
+  // using an eta-phi index of all candidates instead of testing every cone for every candidate
+  std::vector<Int_t> vecV0InJet(iNV0s, -1); // first selected jet containing the V0
+  std::vector<Int_t> vecV0InPerp(iNV0s, -1); // first perp. cone containing the V0
+  std::vector<UChar_t> vecV0InCone(iNV0s, 0); // bits: 0 rnd. cone, 1 med. cone
+  if(bJetEventGood && iNJetSel && iNV0s)
+  {
+    fV0ConeIndex->Reset();
+    for(Int_t iV0 = 0; iV0 < iNV0s; iV0++)
+      fV0ConeIndex->Add(fAODIn->GetV0(iV0), iV0);
+    fV0ConeIndex->Build();
+    std::vector<Int_t> vecFound;
+    for(Int_t iJet = 0; iJet < iNJetSel; iJet++)
+    {
+      fV0ConeIndex->FindInCone((AliAODJet*)jetArraySel->At(iJet), fdRadiusJet, vecFound);
+      for(UInt_t i = 0; i < vecFound.size(); i++)
+        if(vecV0InJet[fV0ConeIndex->GetId(vecFound[i])] < 0)
+          vecV0InJet[fV0ConeIndex->GetId(vecFound[i])] = iJet;
+    }
+    for(Int_t iJet = 0; iJet < iNJetPerp; iJet++)
+    {
+      fV0ConeIndex->FindInCone((AliAODJet*)jetArrayPerp->At(iJet), fdRadiusJet, vecFound);
+      for(UInt_t i = 0; i < vecFound.size(); i++)
+        if(vecV0InPerp[fV0ConeIndex->GetId(vecFound[i])] < 0)
+          vecV0InPerp[fV0ConeIndex->GetId(vecFound[i])] = iJet;
+    }
+    if(jetRnd)
+    {
+      fV0ConeIndex->FindInCone(jetRnd, fdRadiusJet, vecFound);
+      for(UInt_t i = 0; i < vecFound.size(); i++)
+        vecV0InCone[fV0ConeIndex->GetId(vecFound[i])] |= 1 << 0;
+    }
+    if(jetMed)
+    {
+      fV0ConeIndex->FindInCone(jetMed, fdRadiusJet, vecFound);
+      for(UInt_t i = 0; i < vecFound.size(); i++)
+        vecV0InCone[fV0ConeIndex->GetId(vecFound[i])] |= 1 << 1;
+    }
+  }
+
   //===== Start of loop over V0 candidates =====
   if(fDebug > 2) printf("TaskV0sInJets: Start of V0 loop\n");
   for(Int_t iV0 = 0; iV0 < iNV0s; iV0++)
@@ -2075,53 +2121,21 @@ void AliAnalysisTaskV0sInJets::UserExec(Option_t*)
     // Selection of V0s in jet cones, perpendicular cones, random cones, outside cones
     if(bJetEventGood && iNJetSel && (bIsCandidateK0s || bIsCandidateLambda || bIsCandidateALambda))
     {
-      // Selection of V0s in jet cones
-      if(fDebug > 5) printf("TaskV0sInJets: Searching for V0 %d %d in %d jet cones\n", bIsCandidateK0s, bIsCandidateLambda, iNJetSel);
-      for(Int_t iJet = 0; iJet < iNJetSel; iJet++)
+      // Selection of V0s in jet cones, perp. cones, rnd. cone and med. cone (from the eta-phi index)
+      if(vecV0InJet[iV0] >= 0)
       {
-        jet = (AliAODJet*)jetArraySel->At(iJet); // load a jet in the list
+        jet = (AliAODJet*)jetArraySel->At(vecV0InJet[iV0]); // jet containing the V0
         vecJetMomentum = TVector3(jet->Px(), jet->Py(), jet->Pz()); // set the vector of jet momentum
-        if(fDebug > 5) printf("TaskV0sInJets: Checking if V0 %d %d in jet cone %d\n", bIsCandidateK0s, bIsCandidateLambda, iJet);
-        if(IsParticleInCone(v0, jet, fdRadiusJet)) // If good jet in event, find out whether V0 is in that jet
-        {
-          if(fDebug > 5) printf("TaskV0sInJets: V0 %d %d found in jet cone %d\n", bIsCandidateK0s, bIsCandidateLambda, iJet);
-          bIsInConeJet = kTRUE;
-          break;
-        }
-      }
-      // Selection of V0s in perp. cones
-      if(fDebug > 5) printf("TaskV0sInJets: Searching for V0 %d %d in %d perp. cones\n", bIsCandidateK0s, bIsCandidateLambda, iNJetSel);
-      for(Int_t iJet = 0; iJet < iNJetPerp; iJet++)
-      {
-        jetPerp = (AliAODJet*)jetArrayPerp->At(iJet); // load a jet in the list
-        if(fDebug > 5) printf("TaskV0sInJets: Checking if V0 %d %d in perp. cone %d\n", bIsCandidateK0s, bIsCandidateLambda, iJet);
-        if(IsParticleInCone(v0, jetPerp, fdRadiusJet)) // V0 in perp. cone
-        {
-          if(fDebug > 5) printf("TaskV0sInJets: V0 %d %d found in perp. cone %d\n", bIsCandidateK0s, bIsCandidateLambda, iJet);
-          bIsInConePerp = kTRUE;
-          break;
-        }
+        bIsInConeJet = kTRUE;
       }
-      // Selection of V0s in random cones
-      if(jetRnd)
+      if(vecV0InPerp[iV0] >= 0)
       {
-        if(fDebug > 5) printf("TaskV0sInJets: Searching for V0 %d %d in the rnd. cone\n", bIsCandidateK0s, bIsCandidateLambda);
-        if(IsParticleInCone(v0, jetRnd, fdRadiusJet)) // V0 in rnd. cone?
-        {
-          if(fDebug > 5) printf("TaskV0sInJets: V0 %d %d found in the rnd. cone\n", bIsCandidateK0s, bIsCandidateLambda);
-          bIsInConeRnd = kTRUE;
-        }
-      }
-      // Selection of V0s in median-cluster cones
-      if(jetMed)
-      {
-        if(fDebug > 5) printf("TaskV0sInJets: Searching for V0 %d %d in the med. cone\n", bIsCandidateK0s, bIsCandidateLambda);
-        if(IsParticleInCone(v0, jetMed, fdRadiusJet)) // V0 in med. cone?
-        {
-          if(fDebug > 5) printf("TaskV0sInJets: V0 %d %d found in the med. cone\n", bIsCandidateK0s, bIsCandidateLambda);
-          bIsInConeMed = kTRUE;
-        }
+        jetPerp = (AliAODJet*)jetArrayPerp->At(vecV0InPerp[iV0]); // perp. cone containing the V0
+        bIsInConePerp = kTRUE;
       }
+      bIsInConeRnd = vecV0InCone[iV0] & (1 << 0);
+      bIsInConeMed = vecV0InCone[iV0] & (1 << 1);
+      if(fDebug > 5) printf("TaskV0sInJets: V0 %d %d found in jet cone %d, perp. cone %d, rnd. cone %d, med. cone %d\n", bIsCandidateK0s, bIsCandidateLambda, bIsInConeJet, bIsInConePerp, bIsInConeRnd, bIsInConeMed);
       // Selection of V0s outside jet cones
       if(fDebug > 5) printf("TaskV0sInJets: Searching for V0 %d %d outside jet cones\n", bIsCandidateK0s, bIsCandidateLambda);
       if(!OverlapWithJets(jetArraySel, v0, dRadiusExcludeCone)) // V0 oustide jet cones
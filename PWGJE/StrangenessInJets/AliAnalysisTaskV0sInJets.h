@@ -13,6 +13,7 @@ class TClonesArray;
 class AliAODv0;
 class AliAODVertex;
 class AliAODJet;
+class AliEtaPhiConeIndex;
 
 #include "AliAnalysisTaskSE.h"
 #include "THnSparse.h"
@@ -113,6 +114,7 @@ private:
   Bool_t fbMCAnalysis; // switch for the analysis of simulated data
 //  Bool_t fbTreeOutput; // switch for the output tree
   TRandom* fRandom; //! random-number generator
+  AliEtaPhiConeIndex* fV0ConeIndex; //! eta-phi index of the V0 candidates of the event
 
   // event cuts
   Double_t fdCutVertexZ; // [cm] maximum |z| of primary vertex
@@ -376,7 +378,7 @@ private:
   AliAnalysisTaskV0sInJets(const AliAnalysisTaskV0sInJets&); // not implemented
   AliAnalysisTaskV0sInJets& operator=(const AliAnalysisTaskV0sInJets&); // not implemented
 
-  ClassDef(AliAnalysisTaskV0sInJets, 3) // example of analysis
+  ClassDef(AliAnalysisTaskV0sInJets, 4) // example of analysis
 };
 
 #endif
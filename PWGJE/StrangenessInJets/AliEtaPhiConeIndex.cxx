@@ -0,0 +1,204 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+// eta-phi cell index of the V0 candidates of an event for fast cone queries
+// The candidates are sorted once per event into cells of fdCellSize in eta and phi.
+// A query "candidates within R of an axis" only visits the cells overlapping the cone
+// and applies the exact DeltaR cut of TVector3 (eta and phi of the momentum vectors),
+// so the selection is identical to the loop over all candidates.
+
+#include <algorithm>
+#include "TMath.h"
+#include "TVector2.h"
+#include "TVector3.h"
+#include "TCollection.h"
+#include "AliVParticle.h"
+
+#include "AliEtaPhiConeIndex.h"
+
+ClassImp(AliEtaPhiConeIndex)
+
+namespace
+{
+const Int_t kiNEtaCellsMax = 400; // cap of the number of eta cells, the outermost cells absorb the rest
+}
+
+AliEtaPhiConeIndex::AliEtaPhiConeIndex(Double_t dCellSize):
+  TObject(),
+  fdCellSize(dCellSize),
+  fdEtaMin(0),
+  fiNEta(0),
+  fiNPhi(0),
+  fdPhiCellSize(0),
+  fSource(0),
+  fEntries(),
+  fCellStart(),
+  fCellEntries()
+{
+// Constructor
+}
+
+void AliEtaPhiConeIndex::Reset()
+{
+// remove all entries, the allocated memory is kept for the next event
+  fEntries.clear();
+  fCellStart.clear();
+  fCellEntries.clear();
+  fiNEta = 0;
+  fiNPhi = 0;
+  fSource = 0;
+}
+
+void AliEtaPhiConeIndex::Add(const AliVParticle* part, Int_t iId)
+{
+// add a particle to the index
+  if(!part)
+    return;
+  TVector3 vecMom(part->Px(), part->Py(), part->Pz());
+  Entry_t entry;
+  entry.fdEta = vecMom.Eta();
+  entry.fdPhi = vecMom.Phi();
+  entry.fId = (iId < 0 ? (Int_t)fEntries.size() : iId);
+  entry.fPart = part;
+  fEntries.push_back(entry);
+}
+
+void AliEtaPhiConeIndex::Build(const TCollection* list)
+{
+// index all particles of the list
+  Reset();
+  if(list)
+  {
+    TIter next(list);
+    Int_t iPos = 0;
+    while(TObject* obj = next())
+    {
+      AliVParticle* part = dynamic_cast<AliVParticle*>(obj);
+      if(part)
+        Add(part, iPos);
+      iPos++;
+    }
+  }
+  Build();
+  fSource = list;
+}
+
+Int_t AliEtaPhiConeIndex::EtaCell(Double_t dEta) const
+{
+// eta cell, clamped to the existing cells
+  Double_t dCell = TMath::Floor((dEta - fdEtaMin) / fdCellSize);
+  if(!(dCell > 0))
+    return 0;
+  if(dCell > fiNEta - 1)
+    return fiNEta - 1;
+  return (Int_t)dCell;
+}
+
+Int_t AliEtaPhiConeIndex::PhiCell(Double_t dPhi) const
+{
+// phi cell of phi in [-pi, pi]
+  Int_t iCell = (Int_t)TMath::Floor((dPhi + TMath::Pi()) / fdPhiCellSize);
+  if(iCell < 0)
+    return 0;
+  if(iCell > fiNPhi - 1)
+    return fiNPhi - 1;
+  return iCell;
+}
+
+void AliEtaPhiConeIndex::Build()
+{
+// sort the entries into the eta-phi cells (counting sort)
+  fCellStart.clear();
+  fCellEntries.clear();
+  Int_t iNEntries = fEntries.size();
+  if(!iNEntries || fdCellSize <= 0)
+  {
+    fiNEta = 0;
+    fiNPhi = 0;
+    return;
+  }
+  Double_t dEtaMin = fEntries[0].fdEta, dEtaMax = fEntries[0].fdEta;
+  for(Int_t i = 1; i < iNEntries; i++)
+  {
+    dEtaMin = TMath::Min(dEtaMin, fEntries[i].fdEta);
+    dEtaMax = TMath::Max(dEtaMax, fEntries[i].fdEta);
+  }
+  fdEtaMin = dEtaMin;
+  fiNEta = (Int_t)TMath::Min((Double_t)kiNEtaCellsMax, TMath::Floor((dEtaMax - dEtaMin) / fdCellSize) + 1);
+  fiNPhi = TMath::Max(1, (Int_t)TMath::Floor(TMath::TwoPi() / fdCellSize));
+  fdPhiCellSize = TMath::TwoPi() / fiNPhi;
+
+  Int_t iNCells = fiNEta * fiNPhi;
+  std::vector<Int_t> cellOfEntry(iNEntries);
+  fCellStart.assign(iNCells + 1, 0);
+  for(Int_t i = 0; i < iNEntries; i++)
+  {
+    cellOfEntry[i] = EtaCell(fEntries[i].fdEta) * fiNPhi + PhiCell(fEntries[i].fdPhi);
+    fCellStart[cellOfEntry[i] + 1]++;
+  }
+  for(Int_t iCell = 0; iCell < iNCells; iCell++)
+    fCellStart[iCell + 1] += fCellStart[iCell];
+  fCellEntries.resize(iNEntries);
+  std::vector<Int_t> fill(fCellStart.begin(), fCellStart.end() - 1);
+  for(Int_t i = 0; i < iNEntries; i++)
+    fCellEntries[fill[cellOfEntry[i]]++] = i;
+}
+
+Int_t AliEtaPhiConeIndex::FindInCone(Double_t dEtaAxis, Double_t dPhiAxis, Double_t dRMax, std::vector<Int_t>& entries) const
+{
+// collect the entries within dRMax of the axis given by eta and phi (as TVector3::Eta, TVector3::Phi)
+// returns the number of entries found
+  entries.clear();
+  if(!fiNEta || !fiNPhi || dRMax <= 0)
+    return 0;
+  Int_t iEtaLow = TMath::Max(0, EtaCell(dEtaAxis - dRMax) - 1);
+  Int_t iEtaHigh = TMath::Min(fiNEta - 1, EtaCell(dEtaAxis + dRMax) + 1);
+  // one cell margin on each side against rounding at the cell edges
+  Double_t dPhiShifted = TVector2::Phi_mpi_pi(dPhiAxis) + TMath::Pi();
+  Int_t iPhiLow = (Int_t)TMath::Floor((dPhiShifted - dRMax) / fdPhiCellSize) - 1;
+  Int_t iPhiHigh = (Int_t)TMath::Floor((dPhiShifted + dRMax) / fdPhiCellSize) + 1;
+  if(iPhiHigh - iPhiLow + 1 >= fiNPhi)
+  {
+    iPhiLow = 0;
+    iPhiHigh = fiNPhi - 1;
+  }
+  for(Int_t iEta = iEtaLow; iEta <= iEtaHigh; iEta++)
+  {
+    for(Int_t iPhi = iPhiLow; iPhi <= iPhiHigh; iPhi++)
+    {
+      Int_t iCell = iEta * fiNPhi + ((iPhi % fiNPhi) + fiNPhi) % fiNPhi;
+      for(Int_t iPos = fCellStart[iCell]; iPos < fCellStart[iCell + 1]; iPos++)
+      {
+        const Entry_t& entry = fEntries[fCellEntries[iPos]];
+        Double_t dEta = dEtaAxis - entry.fdEta;
+        Double_t dPhi = TVector2::Phi_mpi_pi(dPhiAxis - entry.fdPhi);
+        if(TMath::Sqrt(dEta * dEta + dPhi * dPhi) < dRMax)
+          entries.push_back(fCellEntries[iPos]);
+      }
+    }
+  }
+  std::sort(entries.begin(), entries.end());
+  return entries.size();
+}
+
+Int_t AliEtaPhiConeIndex::FindInCone(const AliVParticle* axis, Double_t dRMax, std::vector<Int_t>& entries) const
+{
+// collect the entries within dRMax of the momentum direction of axis (e.g. a jet)
+  entries.clear();
+  if(!axis)
+    return 0;
+  TVector3 vecAxis(axis->Px(), axis->Py(), axis->Pz());
+  return FindInCone(vecAxis.Eta(), vecAxis.Phi(), dRMax, entries);
+}
@@ -0,0 +1,64 @@
+#ifndef AliEtaPhiConeIndex_cxx
+#define AliEtaPhiConeIndex_cxx
+
+// eta-phi cell index of the V0 candidates of an event for fast cone queries
+// shared by AliAnalysisTaskV0sInJets and AliAnalysisTaskJetChem
+
+#include <vector>
+#include "TObject.h"
+
+class TCollection;
+class AliVParticle;
+
+class AliEtaPhiConeIndex : public TObject
+{
+public:
+  AliEtaPhiConeIndex(Double_t dCellSize = 0.2); // Constructor
+  virtual ~AliEtaPhiConeIndex() {}
+
+  void SetCellSize(Double_t dSize = 0.2) {fdCellSize = dSize;}
+  Double_t GetCellSize() const {return fdCellSize;}
+
+  void Reset(); // remove all entries
+  void Add(const AliVParticle* part, Int_t iId = -1); // add a particle, iId is an external index (default: entry number)
+  void Build(); // sort the entries into the cells, to be called after the last Add
+  void Build(const TCollection* list); // Reset, Add all particles of the list and Build
+
+  Int_t GetNEntries() const {return (Int_t)fEntries.size();}
+  const AliVParticle* GetParticle(Int_t iEntry) const {return fEntries[iEntry].fPart;}
+  Int_t GetId(Int_t iEntry) const {return fEntries[iEntry].fId;}
+  const TCollection* GetSource() const {return fSource;}
+
+  // entries with momentum direction closer than dRMax to the axis (same metric as TVector3::DeltaR), in the order they were added
+  Int_t FindInCone(Double_t dEtaAxis, Double_t dPhiAxis, Double_t dRMax, std::vector<Int_t>& entries) const;
+  Int_t FindInCone(const AliVParticle* axis, Double_t dRMax, std::vector<Int_t>& entries) const;
+
+private:
+  struct Entry_t
+  {
+    Double_t fdEta; // pseudorapidity of the momentum
+    Double_t fdPhi; // azimuth of the momentum, as TVector3::Phi
+    Int_t fId; // external index
+    const AliVParticle* fPart; // particle (not owned)
+  };
+
+  Int_t EtaCell(Double_t dEta) const;
+  Int_t PhiCell(Double_t dPhi) const;
+
+  Double_t fdCellSize; // cell size in eta and (approximately) in phi
+  Double_t fdEtaMin; //! lower eta edge of the first cell
+  Int_t fiNEta; //! number of eta cells
+  Int_t fiNPhi; //! number of phi cells
+  Double_t fdPhiCellSize; //! exact phi cell size (2 pi / fiNPhi)
+  const TCollection* fSource; //! list the index was built from
+  std::vector<Entry_t> fEntries; //! entries in the order they were added
+  std::vector<Int_t> fCellStart; //! first position of each cell in fCellEntries
+  std::vector<Int_t> fCellEntries; //! entry numbers sorted by cell
+
+  AliEtaPhiConeIndex(const AliEtaPhiConeIndex&); // not implemented
+  AliEtaPhiConeIndex& operator=(const AliEtaPhiConeIndex&); // not implemented
+
+  ClassDef(AliEtaPhiConeIndex, 1) // eta-phi cell index for cone queries
+};
+
+#endif
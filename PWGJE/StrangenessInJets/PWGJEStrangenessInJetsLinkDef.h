@@ -9,5 +9,6 @@
 #pragma link C++ class AliAnalysisTaskV0sInJets+;
 #pragma link C++ class AliAnalysisTaskJetChem+;
 #pragma link C++ class AliAnalysisTaskJetChem::AliFragFuncHistosInvMass+;
+#pragma link C++ class AliEtaPhiConeIndex+;
 
 #endif
@@ -60,7 +60,14 @@ AliFMDDensityCalculator::AliFMDDensityCalculator()
     fDoTiming(false),
     fHTiming(0), 
     fMaxOutliers(0.05),
-    fOutlierCut(0.50)
+    fOutlierCut(0.50),
+    fLookupStep(0),
+    fLookupMax(10),
+    fLookupMaxError(1e-3),
+    fLookupNEta(0),
+    fLookupNPoints(0),
+    fLookup(0),
+    fLookupGood(0)
 {
   // 
   // Constructor 
@@ -98,7 +105,14 @@ AliFMDDensityCalculator::AliFMDDensityCalculator(const char* title)
     fDoTiming(false),
     fHTiming(0), 
     fMaxOutliers(0.05),
-    fOutlierCut(0.50)
+    fOutlierCut(0.50),
+    fLookupStep(0),
+    fLookupMax(10),
+    fLookupMaxError(1e-3),
+    fLookupNEta(0),
+    fLookupNPoints(0),
+    fLookup(0),
+    fLookupGood(0)
 {
   // 
   // Constructor 
@@ -167,7 +181,14 @@ AliFMDDensityCalculator::AliFMDDensityCalculator(const
     fDoTiming(o.fDoTiming),
     fHTiming(o.fHTiming), 
   fMaxOutliers(o.fMaxOutliers),
-  fOutlierCut(o.fOutlierCut)
+  fOutlierCut(o.fOutlierCut),
+  fLookupStep(o.fLookupStep),
+  fLookupMax(o.fLookupMax),
+  fLookupMaxError(o.fLookupMaxError),
+  fLookupNEta(o.fLookupNEta),
+  fLookupNPoints(o.fLookupNPoints),
+  fLookup(o.fLookup),
+  fLookupGood(o.fLookupGood)
 {
   // 
   // Copy constructor 
@@ -232,6 +253,13 @@ AliFMDDensityCalculator::operator=(const AliFMDDensityCalculator& o)
   fHTiming            = o.fHTiming;
   fMaxOutliers        = o.fMaxOutliers;
   fOutlierCut         = o.fOutlierCut;
+  fLookupStep         = o.fLookupStep;
+  fLookupMax          = o.fLookupMax;
+  fLookupMaxError     = o.fLookupMaxError;
+  fLookupNEta         = o.fLookupNEta;
+  fLookupNPoints      = o.fLookupNPoints;
+  fLookup             = o.fLookup;
+  fLookupGood         = o.fLookupGood;
 
   fRingHistos.Delete();
   TIter    next(&o.fRingHistos);
@@ -427,6 +455,14 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
       // etaCache[i] = phiCache[i] = AliESDFMD::kInvalidEta;
       memset(etaCache, 0, sizeof(Double_t)*20*512);
       memset(phiCache, 0, sizeof(Double_t)*20*512);
+
+      // The multiplicity cut depends on the strip through eta only.
+      // Evaluate it once per strip, and again only if eta changes
+      // (e.g., when re-calculating for the (x,y) of the IP)
+      Double_t cutEta[512];
+      Double_t cutCache[512];
+      Bool_t   cutValid[512];
+      for (UShort_t t = 0; t < nt; t++) cutValid[t] = kFALSE;
       // etaCache.Reset(AliESDFMD::kInvalidEta);
       // phiCache.Reset(AliESDFMD::kInvalidEta);
 
@@ -489,7 +525,14 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
 
 	  // --- Get the low multiplicity cut ------------------------
 	  Double_t cut  = 1024;
-	  if (eta != AliESDFMD::kInvalidEta) cut = GetMultCut(d, r, eta,false);
+	  if (eta != AliESDFMD::kInvalidEta) {
+	    if (!cutValid[t] || cutEta[t] != eta) {
+	      cutEta[t]   = eta;
+	      cutCache[t] = GetMultCut(d, r, eta,false);
+	      cutValid[t] = kTRUE;
+	    }
+	    cut = cutCache[t];
+	  }
 	  else AliWarningF("Eta for FMD%d%c[%02d,%03d] is invalid: %f", 
 			   d, r, s, t, eta);
 
@@ -771,6 +814,85 @@ AliFMDDensityCalculator::CacheMaxWeights(const TAxis& axis)
 
   // Cache cuts in histogram
   fCuts.FillHistogram(fLowCuts);
+
+  CacheLookup(cor);
+}
+
+//_____________________________________________________________________
+void
+AliFMDDensityCalculator::CacheLookup(const AliFMDCorrELossFit* cor)
+{
+  // 
+  // Tabulate the weighted energy loss fits of all rings and eta bins
+  // with a valid maximum weight.  The linear interpolation of each
+  // table is compared to the exact evaluation half way between the
+  // grid points.  If the deviation is too large anywhere, the table
+  // is flagged as not usable, and NParticles evaluates the fit for
+  // that eta bin.
+  // 
+  fLookupNEta    = 0;
+  fLookupNPoints = 0;
+  fLookup.Set(0);
+  fLookupGood.Set(0);
+  if (fLookupStep <= 0 || fLookupMax <= fLookupStep) return;
+
+  DGUARD(fDebug, 2, "Cache lookup tables in FMD density calculator");
+  Int_t nEta     = fFMD1iMax.fN;
+  Int_t nPoints  = Int_t(fLookupMax / fLookupStep) + 1;
+  fLookupNEta    = nEta;
+  fLookupNPoints = nPoints;
+  fLookup.Set(5 * nEta * nPoints);
+  fLookupGood.Set(5 * nEta);
+
+  for (UShort_t d=1; d<=3; d++) { 
+    UShort_t nr = (d == 1 ? 1 : 2);
+    for (UShort_t q=0; q<nr; q++) { 
+      Char_t   r      = (q == 0 ? 'I' : 'O');
+      Int_t    iring  = (d == 1 ? 0 : (d - 2) * 2 + 1 + q);
+      Int_t    nGood  = 0;
+      Int_t    nBad   = 0;
+      Double_t maxErr = 0;
+      for (Int_t i = 0; i < nEta; i++) { 
+	Int_t m = GetMaxWeight(d, r, i);
+	if (m < 1) continue;
+	AliFMDCorrELossFit::ELossFit* fit = cor->FindFit(d, r, i+1, -1);
+	if (!fit) continue;
+
+	UShort_t n = TMath::Min(fMaxParticles, UShort_t(m));
+	Float_t* v = &(fLookup.fArray[(iring * nEta + i) * nPoints]);
+	for (Int_t k = 0; k < nPoints; k++) 
+	  v[k] = fit->EvaluateWeighted(k * fLookupStep, n);
+
+	Double_t err = 0;
+	for (Int_t k = 0; k < nPoints-1; k++) { 
+	  Double_t exact = fit->EvaluateWeighted((k + .5) * fLookupStep, n);
+	  err            = TMath::Max(err, TMath::Abs(.5*(v[k]+v[k+1])-exact));
+	}
+	maxErr = TMath::Max(maxErr, err);
+	if (err > fLookupMaxError) { nBad++; continue; }
+	fLookupGood[iring * nEta + i] = 1;
+	nGood++;
+      }
+      AliInfo(Form("FMD%d%c: %d lookup tables (max deviation %g), "
+		   "%d eta bins evaluated exactly", d, r, nGood, maxErr, nBad));
+    }
+  }
+}
+
+//_____________________________________________________________________
+const Float_t*
+AliFMDDensityCalculator::GetLookup(UShort_t d, Char_t r, Int_t iEta) const
+{
+  // 
+  // Get the lookup table for FMD<i>dr</i> in eta bin @a iEta.  Returns
+  // null if there is no good table.
+  // 
+  if (fLookupNPoints <= 0 || iEta < 0 || iEta >= fLookupNEta) return 0;
+  Int_t iring = (d == 1 ? 0 : 
+		 (d - 2) * 2 + 1 + (r == 'I' || r == 'i' ? 0 : 1));
+  Int_t idx   = iring * fLookupNEta + iEta;
+  if (!fLookupGood[idx]) return 0;
+  return &(fLookup.fArray[idx * fLookupNPoints]);
 }
 
 //_____________________________________________________________________
@@ -864,6 +986,19 @@ AliFMDDensityCalculator::NParticles(Float_t  mult,
   if (lowFlux) return 1;
   
   AliForwardCorrectionManager&  fcm = AliForwardCorrectionManager::Instance();
+  if (fLookupNPoints > 0) { 
+    // Interpolate in the table of the weighted fit if possible
+    Double_t u = mult / fLookupStep;
+    Int_t    k = Int_t(u);
+    const Float_t* v = 0;
+    if (k + 1 < fLookupNPoints && 
+	(v = GetLookup(d, r, fcm.GetELossFit()->FindEtaBin(eta) - 1))) { 
+      Double_t ret = v[k] + (u - k) * (v[k+1] - v[k]);
+      fWeightedSum->Fill(ret);
+      fSumOfWeights->Fill(ret);
+      return ret;
+    }
+  }
   AliFMDCorrELossFit::ELossFit* fit = fcm.GetELossFit()->FindFit(d,r,eta, -1);
   if (!fit) { 
     AliWarning(Form("No energy loss fit for FMD%d%c at eta=%f qual=%d", 
@@ -1120,6 +1255,7 @@ AliFMDDensityCalculator::CreateOutputObjects(TList* dir)
   d->Add(AliForwardUtil::MakeParameter("maxOutliers",  fMaxOutliers));
   d->Add(AliForwardUtil::MakeParameter("outlierCut",   fOutlierCut));
   d->Add(AliForwardUtil::MakeParameter("hitThreshold", fHitThreshold));
+  d->Add(AliForwardUtil::MakeParameter("lookupStep",   fLookupStep));
   d->Add(nFiles);
   // d->Add(nxi);
   fCuts.Output(d,"lCuts");
@@ -1201,6 +1337,11 @@ AliFMDDensityCalculator::Print(Option_t* option) const
   PFV("Threshold(hit)",         fHitThreshold);
   PFV("Max(outliers)",          fMaxOutliers);
   PFV("Cut(outlier)",           fOutlierCut);
+  PFV("Lookup step",            fLookupStep);
+  if (fLookupStep > 0) { 
+    PFV("Lookup max",           fLookupMax);
+    PFV("Lookup max deviation", fLookupMaxError);
+  }
   PFV("Lower cut", "");
   fCuts.Print();
 
@@ -16,6 +16,8 @@
 #include <TNamed.h>
 #include <TList.h>
 #include <TArrayI.h>
+#include <TArrayF.h>
+#include <TArrayC.h>
 #include <TVector3.h>
 #include "AliForwardUtil.h"
 #include "AliFMDMultCuts.h"
@@ -198,6 +200,28 @@ public:
    * @param ratio Maximum ratio (number between 0 and 1) 
    */
   void SetMaxOutliers(Double_t ratio=0.10) { fMaxOutliers = ratio; }
+  /** 
+   * Use lookup tables of the weighted energy loss fits instead of
+   * evaluating AliFMDCorrELossFit::ELossFit::EvaluateWeighted for
+   * each strip.  At initialisation the weighted fit of each ring and
+   * @f$\eta@f$ bin is tabulated on a grid of @f$\Delta/\Delta_{mip}@f$
+   * from 0 to @a max in steps of @a step.  The table is linearly
+   * interpolated.  In between the grid points the interpolation is
+   * checked against the exact evaluation, and the table of an
+   * @f$\eta@f$ bin is not used if the deviation exceeds @a maxError.
+   * Signals beyond @a max are always evaluated exactly.
+   * 
+   * @param step     Grid step (if 0 or less, tables are not used)
+   * @param max      Largest tabulated signal 
+   * @param maxError Maximum absolute deviation from exact evaluation
+   */
+  void SetUseLookup(Double_t step=0.01, Double_t max=10, 
+		    Double_t maxError=1e-3) 
+  { 
+    fLookupStep     = step;
+    fLookupMax      = max;
+    fLookupMaxError = maxError;
+  }
   /** 
    * Set the maximum relative diviation between @f$N_{ch}^{Poisson}@f$
    * and @f$N_{ch}^{\Delta}@f$
@@ -297,6 +321,23 @@ protected:
    * @param axis Default @f$\eta@f$ axis from parent task 
    */  
   void CacheMaxWeights(const TAxis& axis);
+  /** 
+   * Tabulate the weighted energy loss fits (see SetUseLookup).  Must
+   * be called after CacheMaxWeights
+   * 
+   * @param cor Energy loss fits 
+   */
+  void CacheLookup(const AliFMDCorrELossFit* cor);
+  /** 
+   * Get the lookup table of FMD<i>dr</i> in @f$\eta@f$ bin @a iEta 
+   * 
+   * @param d     Detector
+   * @param r     Ring
+   * @param iEta  Eta bin (0 based)
+   * 
+   * @return Pointer to table, or null if there is no (good) table 
+   */
+  const Float_t* GetLookup(UShort_t d, Char_t r, Int_t iEta) const;
   /** 
    * Find the (cached) maximum weight for FMD<i>dr</i> in 
    * @f$\eta@f$ bin @a iEta
@@ -504,8 +545,15 @@ protected:
   TProfile*              fHTiming;
   Double_t               fMaxOutliers; // Maximum ratio of outlier bins 
   Double_t               fOutlierCut;  // Maximum relative diviation 
+  Double_t               fLookupStep;  // Step of lookup tables (<=0: none)
+  Double_t               fLookupMax;   // Largest signal in lookup tables
+  Double_t               fLookupMaxError; // Max deviation of lookup 
+  Int_t                  fLookupNEta;  //! Number of eta bins in tables
+  Int_t                  fLookupNPoints; //! Number of points per table
+  TArrayF                fLookup;      //! Tables of weighted fits
+  TArrayC                fLookupGood;  //! Whether table is usable
 
-  ClassDef(AliFMDDensityCalculator,16); // Calculate Nch density 
+  ClassDef(AliFMDDensityCalculator,17); // Calculate Nch density 
 };
 
 #endif
@@ -222,8 +222,24 @@ AliFMDSharingFilter::Filter(const AliESDFMD& input,
       UShort_t    nsec   = (q == 0 ?  20 :  40);
       UShort_t    nstr   = (q == 0 ? 512 : 256);
       RingHistos* histos = GetRingHistos(d, r);
+
+      // The cuts depend on the strip through eta only, which is the
+      // same in all sectors.  Evaluate them once per strip, and again
+      // only if the eta of the strip changes.
+      Double_t cutEta[512];
+      Double_t lowCuts[512];
+      Double_t highCuts[512];
+      Bool_t   cutValid[512];
+      for (UShort_t t = 0; t < nstr; t++) cutValid[t] = kFALSE;
       
       for(UShort_t s = 0; s < nsec;  s++) {	
+	// Signals of the sector, read once per strip rather than once
+	// for the strip and once or twice as the neighbour of the
+	// previous strips
+	Float_t signal[512];
+	for (UShort_t t = 0; t < nstr; t++) 
+	  signal[t] = SignalInStrip(input,d,r,s,t);
+
 	// `used' flags if the _current_ strip was used by _previous_ 
 	// iteration. 
 	Bool_t   used            = kFALSE;
@@ -241,9 +257,9 @@ AliFMDSharingFilter::Filter(const AliESDFMD& input,
 	  // nDistanceAfter++;
 
 	  output.SetMultiplicity(d,r,s,t,0.);
-	  Float_t mult         = SignalInStrip(input,d,r,s,t);
-	  Float_t multNext     = (t<nstr-1) ? SignalInStrip(input,d,r,s,t+1) :0;
-	  Float_t multNextNext = (t<nstr-2) ? SignalInStrip(input,d,r,s,t+2) :0;
+	  Float_t mult         = signal[t];
+	  Float_t multNext     = (t<nstr-1) ? signal[t+1] :0;
+	  Float_t multNextNext = (t<nstr-2) ? signal[t+2] :0;
 	  if (multNext     ==  AliESDFMD::kInvalidMult) multNext     = 0;
 	  if (multNextNext ==  AliESDFMD::kInvalidMult) multNextNext = 0;
 	  if(!fThreeStripSharing) multNextNext = 0;
@@ -262,8 +278,14 @@ AliFMDSharingFilter::Filter(const AliESDFMD& input,
 	    mult = AliESDFMD::kInvalidMult;
 	  }
 	  
-	  Double_t lowCut  = GetLowCut(d, r, eta);
-	  Double_t highCut = GetHighCut(d, r, eta, false);
+	  if (!cutValid[t] || cutEta[t] != eta) {
+	    cutEta[t]   = eta;
+	    lowCuts[t]  = GetLowCut(d, r, eta);
+	    highCuts[t] = GetHighCut(d, r, eta, false);
+	    cutValid[t] = kTRUE;
+	  }
+	  Double_t lowCut  = lowCuts[t];
+	  Double_t highCut = highCuts[t];
 	  if (mult != AliESDFMD::kInvalidMult && mult > lowCut) {
 	    // Always fill the ESD sum histogram 
 	    histos->fSumESD->Fill(eta, phi, mult);
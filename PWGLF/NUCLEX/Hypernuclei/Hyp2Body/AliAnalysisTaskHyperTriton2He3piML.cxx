@@ -120,6 +120,7 @@ AliAnalysisTaskHyperTriton2He3piML::AliAnalysisTaskHyperTriton2He3piML(
       fUseCustomBethe{false},
       fCustomBethe{0.f, 0.f, 0.f, 0.f, 0.f},
       fCustomResolution{1.f},
+      fNucleiPID{},
       fHistCentTrigger{nullptr},
       fHistNsigmaHe3{nullptr},
       fHistNsigmaPi{nullptr},
@@ -319,6 +320,11 @@ void AliAnalysisTaskHyperTriton2He3piML::UserCreateOutputObjects()
   fFatParticle = fLambda ? AliPID::kProton : fNucleus;
   fHyperPDG = fLambda ? 3122 : (fNucleus == AliPID::kHe3 ? 1010010030 : 1010010040);
   fV0Vertexer.fNucleus = fNucleus;
+
+  fNucleiPID.EnableSpecies(AliPID::kPion);
+  fNucleiPID.EnableSpecies(fFatParticle);
+  if (fUseCustomBethe)
+    fNucleiPID.SetCustomBetheBloch(fFatParticle, fCustomBethe, fCustomResolution);
 } // end UserCreateOutputObjects
 
 void AliAnalysisTaskHyperTriton2He3piML::UserExec(Option_t *)
@@ -640,6 +646,9 @@ void AliAnalysisTaskHyperTriton2He3piML::UserExec(Option_t *)
 
   int nV0s = (fUseOnTheFly || fUseNanoAODs) ? esdEvent->GetNumberOfV0s() : V0Vector.size();
 
+  /// TPC n-sigma of all the tracks, computed once instead of for each V0 a track belongs to
+  fNucleiPID.Process(vEvent, fPIDResponse);
+
   for (int iV0 = 0; iV0 < nV0s; iV0++)
   { // This is the begining of the V0 loop (we analyse only offline
     // V0s)
@@ -874,16 +883,11 @@ bool AliAnalysisTaskHyperTriton2He3piML::FillHyperCandidate(T *v0, AliVEvent *ev
     return false;
 
   // Official means of acquiring N-sigmas
-  float nSigmaPosPi = fPIDResponse->NumberOfSigmasTPC(pTrack, AliPID::kPion);
-  float nSigmaPosHe3 = fPIDResponse->NumberOfSigmasTPC(pTrack, fFatParticle);
-  float nSigmaNegPi = fPIDResponse->NumberOfSigmasTPC(nTrack, AliPID::kPion);
-  float nSigmaNegHe3 = fPIDResponse->NumberOfSigmasTPC(nTrack, fFatParticle);
-
-  if (fUseCustomBethe)
-  {
-    nSigmaNegHe3 = customNsigma(nTrack->GetTPCmomentum(), nTrack->GetTPCsignal());
-    nSigmaPosHe3 = customNsigma(pTrack->GetTPCmomentum(), pTrack->GetTPCsignal());
-  }
+  // (or custom Bethe-Bloch for the nucleus), computed once per event
+  float nSigmaPosPi = fNucleiPID.GetNsigmaTPC(lKeyPos, AliPID::kPion);
+  float nSigmaPosHe3 = fNucleiPID.GetNsigmaTPC(lKeyPos, fFatParticle);
+  float nSigmaNegPi = fNucleiPID.GetNsigmaTPC(lKeyNeg, AliPID::kPion);
+  float nSigmaNegHe3 = fNucleiPID.GetNsigmaTPC(lKeyNeg, fFatParticle);
 
   const float nSigmaNegAbsHe3 = std::abs(nSigmaNegHe3);
   const float nSigmaPosAbsHe3 = std::abs(nSigmaPosHe3);
@@ -12,6 +12,7 @@ class TTree;
 #include <string>
 #include <vector>
 #include "AliVertexerHyperTriton2Body.h"
+#include "AliLightNucleiPID.h"
 #include "AliAnalysisTaskSE.h"
 #include "AliEventCuts.h"
 #include "Math/Vector4D.h"
@@ -229,6 +230,7 @@ private:
   bool fUseCustomBethe;
   float fCustomBethe[5];
   float fCustomResolution;
+  AliLightNucleiPID fNucleiPID; //! TPC n-sigma of the tracks of the event
 
   /// Control histograms to monitor the filtering
   TH2D *fHistCentTrigger;          //!
@@ -312,7 +314,7 @@ private:
   AliAnalysisTaskHyperTriton2He3piML &operator=(
       const AliAnalysisTaskHyperTriton2He3piML &); // not implemented
 
-  ClassDef(AliAnalysisTaskHyperTriton2He3piML, 7);
+  ClassDef(AliAnalysisTaskHyperTriton2He3piML, 8);
 };
 
 #endif
@@ -535,6 +535,24 @@ std::vector<AliESDv0> AliVertexerHyperTriton2Body::Tracks2V0vertices3Body(std::v
 
     fMagneticField = magneticField;
 
+    /// Mass hypothesis of each track for the V0 refit, evaluated once per track
+    /// instead of once per pair. Only the TPC PID enters, so the rotation of
+    /// the track parameters in the pair loops does not change it.
+    std::vector<AliPID::EParticleType> hypoLists[2][2];
+    for (int charge{0}; charge < 2; ++charge)
+    {
+        for (int index{0}; index < 2; ++index)
+        {
+            hypoLists[charge][index].resize(tracks[charge][index].size(), AliPID::kPion);
+            for (size_t iTrack = 0; iTrack < tracks[charge][index].size(); iTrack++)
+            {
+                auto trk = tracks[charge][index][iTrack];
+                if (trk && std::abs(fPID->NumberOfSigmasTPC(trk, fNucleus)) < 5)
+                    hypoLists[charge][index][iTrack] = fNucleus;
+            }
+        }
+    }
+
     if (!fLikeSign)
     {
         for (int index{0}; index < 2; ++index)
@@ -563,8 +581,8 @@ std::vector<AliESDv0> AliVertexerHyperTriton2Body::Tracks2V0vertices3Body(std::v
                         double params[5]{ptrk->GetY(), ptrk->GetZ(), -ptrk->GetSnp(), ptrk->GetTgl(), ptrk->GetSigned1Pt()};
                         ptrk->SetParamOnly(ptrk->GetX(), ptrk->GetAlpha(), params);
                     }
-                    AliPID::EParticleType pParticle = std::abs(fPID->NumberOfSigmasTPC(ptrk, fNucleus)) < 5 ? fNucleus : AliPID::kPion;
-                    AliPID::EParticleType nParticle = std::abs(fPID->NumberOfSigmasTPC(ntrk, fNucleus)) < 5 ? fNucleus : AliPID::kPion;
+                    AliPID::EParticleType pParticle = hypoLists[1][index == 1 ? 0 : 1][pidx];
+                    AliPID::EParticleType nParticle = hypoLists[0][index][nidx];
 
                     CreateV0(vtxT3D, nidx, ntrk, pidx, ptrk, pParticle, nParticle);
 
@@ -597,8 +615,8 @@ std::vector<AliESDv0> AliVertexerHyperTriton2Body::Tracks2V0vertices3Body(std::v
                     auto ptrk = tracks[charge][1][pidx];
                     if (!ptrk)
                         continue;
-                    AliPID::EParticleType pParticle = std::abs(fPID->NumberOfSigmasTPC(ptrk, fNucleus)) < 5 ? fNucleus : AliPID::kPion;
-                    AliPID::EParticleType nParticle = std::abs(fPID->NumberOfSigmasTPC(ntrk, fNucleus)) < 5 ? fNucleus : AliPID::kPion;
+                    AliPID::EParticleType pParticle = hypoLists[charge][1][pidx];
+                    AliPID::EParticleType nParticle = hypoLists[charge][0][nidx];
 
                     CreateV0(vtxT3D, nidx, ntrk, pidx, ptrk, pParticle, nParticle);
                 }
@@ -0,0 +1,104 @@
+#include "AliLightNucleiPID.h"
+
+#include <algorithm>
+
+#include <AliExternalTrackParam.h>
+#include <AliPIDResponse.h>
+#include <AliVEvent.h>
+#include <AliVTrack.h>
+
+AliLightNucleiPID::AliLightNucleiPID()
+    : fEnabled{}, fParameters{}, fActive{}, fRun{-1}, fPID{nullptr}, fMomentumTPC{}, fSignalTPC{}, fNsigmaTPC{}, fExpectedTPC{} {
+  for (int iSpecies{0}; iSpecies < AliPID::kSPECIESC; ++iSpecies) {
+    fEnabled[iSpecies] = false;
+    fActive[iSpecies] = -1;
+  }
+}
+
+void AliLightNucleiPID::SetCustomBetheBloch(AliPID::EParticleType sp, const float bethe[5], float resolution,
+                                            int firstRun, int lastRun) {
+  BetheBlochParameters par;
+  par.fSpecies = sp;
+  par.fFirstRun = firstRun;
+  par.fLastRun = lastRun;
+  std::copy(bethe, bethe + 5, par.fBethe);
+  par.fResolution = resolution;
+  fParameters.push_back(par);
+  fEnabled[sp] = true;
+  fRun = -1; /// select the parameters again at the next event
+}
+
+void AliLightNucleiPID::SetupRun(int run) {
+  /// The last matching range wins, so that a default for all the runs can be
+  /// overridden for some periods
+  for (int iSpecies{0}; iSpecies < AliPID::kSPECIESC; ++iSpecies)
+    fActive[iSpecies] = -1;
+  for (size_t iPar{0}; iPar < fParameters.size(); ++iPar) {
+    const BetheBlochParameters &par = fParameters[iPar];
+    if (run >= par.fFirstRun && run <= par.fLastRun)
+      fActive[par.fSpecies] = iPar;
+  }
+  fRun = run;
+}
+
+double AliLightNucleiPID::CustomNsigma(const BetheBlochParameters &par, double mom, double signal, float &expected) {
+  const float bg = mom / AliPID::ParticleMass(par.fSpecies);
+  const float *p = par.fBethe;
+  expected = AliExternalTrackParam::BetheBlochAleph(bg, p[0], p[1], p[2], p[3], p[4]);
+  return (signal - expected) / (par.fResolution * expected);
+}
+
+void AliLightNucleiPID::Process(AliVEvent *event, AliPIDResponse *pid) {
+  fPID = pid;
+  if (event->GetRunNumber() != fRun)
+    SetupRun(event->GetRunNumber());
+
+  const int nTracks = event->GetNumberOfTracks();
+  fMomentumTPC.resize(nTracks);
+  fSignalTPC.resize(nTracks);
+  for (int iSpecies{0}; iSpecies < AliPID::kSPECIESC; ++iSpecies) {
+    if (!fEnabled[iSpecies])
+      continue;
+    fNsigmaTPC[iSpecies].assign(nTracks, -999.f);
+    fExpectedTPC[iSpecies].resize(fActive[iSpecies] >= 0 ? nTracks : 0);
+  }
+
+  /// Single pass over the tracks: collect the TPC information and evaluate the
+  /// species that use the PID response
+  for (int iTrack{0}; iTrack < nTracks; ++iTrack) {
+    AliVTrack *track = dynamic_cast<AliVTrack *>(event->GetTrack(iTrack));
+    if (!track) {
+      fMomentumTPC[iTrack] = -1.; /// flags the missing track
+      fSignalTPC[iTrack] = 0.;
+      continue;
+    }
+    fMomentumTPC[iTrack] = track->GetTPCmomentum();
+    fSignalTPC[iTrack] = track->GetTPCsignal();
+    for (int iSpecies{0}; iSpecies < AliPID::kSPECIESC; ++iSpecies) {
+      if (fEnabled[iSpecies] && fActive[iSpecies] < 0)
+        fNsigmaTPC[iSpecies][iTrack] = fPID->NumberOfSigmasTPC(track, AliPID::EParticleType(iSpecies));
+    }
+  }
+
+  /// Custom parametrisations, species by species over the collected arrays
+  for (int iSpecies{0}; iSpecies < AliPID::kSPECIESC; ++iSpecies) {
+    if (!fEnabled[iSpecies] || fActive[iSpecies] < 0)
+      continue;
+    const BetheBlochParameters &par = fParameters[fActive[iSpecies]];
+    float *nsigma = fNsigmaTPC[iSpecies].data();
+    float *expected = fExpectedTPC[iSpecies].data();
+    for (int iTrack{0}; iTrack < nTracks; ++iTrack) {
+      if (fMomentumTPC[iTrack] < 0.)
+        continue;
+      nsigma[iTrack] = CustomNsigma(par, fMomentumTPC[iTrack], fSignalTPC[iTrack], expected[iTrack]);
+    }
+  }
+}
+
+float AliLightNucleiPID::NsigmaTPC(AliVTrack *track, AliPID::EParticleType sp) const {
+  if (fActive[sp] >= 0) {
+    float expected{0.f};
+    return CustomNsigma(fParameters[fActive[sp]], track->GetTPCmomentum(), track->GetTPCsignal(), expected);
+  }
+  return fPID ? fPID->NumberOfSigmasTPC(track, sp) : -999.f;
+}
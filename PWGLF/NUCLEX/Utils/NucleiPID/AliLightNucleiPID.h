@@ -0,0 +1,73 @@
+#ifndef ALILIGHTNUCLEIPID_H
+#define ALILIGHTNUCLEIPID_H
+
+#include <climits>
+#include <vector>
+
+#include <AliPID.h>
+
+class AliPIDResponse;
+class AliVEvent;
+class AliVTrack;
+
+/// TPC PID of the light nuclei (and of the light decay daughters) for all the
+/// tracks of an event.
+///
+/// The n-sigma of the enabled species are computed once per event in Process()
+/// and then looked up by track index, instead of being recomputed for each
+/// candidate a track enters. The TPC momentum and signal of the tracks are
+/// collected in one loop; the species using a custom Bethe-Bloch parametrisation
+/// are then evaluated species by species over these arrays. The custom
+/// parametrisations can be given for run ranges: the parameters of the current
+/// run are selected once per run and not inside the track loop.
+///
+/// The custom expected signal is AliExternalTrackParam::BetheBlochAleph(p/m) with
+/// p the TPC momentum and m the mass of the species, the n-sigma is
+/// (signal - expected) / (resolution * expected).
+class AliLightNucleiPID {
+public:
+  AliLightNucleiPID();
+
+  void EnableSpecies(AliPID::EParticleType sp, bool enable = true) { fEnabled[sp] = enable; }
+  void SetCustomBetheBloch(AliPID::EParticleType sp, const float bethe[5], float resolution,
+                           int firstRun = 0, int lastRun = INT_MAX);
+
+  void Process(AliVEvent *event, AliPIDResponse *pid);
+
+  /// n-sigma of the track with index iTrack of the last processed event
+  float GetNsigmaTPC(int iTrack, AliPID::EParticleType sp) const { return fNsigmaTPC[sp][iTrack]; }
+  /// Custom expected signal of the track, -1 if the species uses the PID response
+  float GetExpectedSignalTPC(int iTrack, AliPID::EParticleType sp) const {
+    return fActive[sp] >= 0 ? fExpectedTPC[sp][iTrack] : -1.f;
+  }
+  /// n-sigma of a single track (e.g. from another event) with the current parameters
+  float NsigmaTPC(AliVTrack *track, AliPID::EParticleType sp) const;
+
+  bool IsEnabled(AliPID::EParticleType sp) const { return fEnabled[sp]; }
+  bool HasCustomBetheBloch(AliPID::EParticleType sp) const { return fActive[sp] >= 0; }
+
+private:
+  struct BetheBlochParameters {
+    AliPID::EParticleType fSpecies;
+    int fFirstRun;
+    int fLastRun;
+    float fBethe[5];
+    float fResolution;
+  };
+
+  void SetupRun(int run);
+  static double CustomNsigma(const BetheBlochParameters &par, double mom, double signal, float &expected);
+
+  bool fEnabled[AliPID::kSPECIESC];
+  std::vector<BetheBlochParameters> fParameters;
+  int fActive[AliPID::kSPECIESC]; ///< Index in fParameters for the current run, -1 if none
+
+  int fRun;
+  AliPIDResponse *fPID;
+  std::vector<double> fMomentumTPC;
+  std::vector<double> fSignalTPC;
+  std::vector<float> fNsigmaTPC[AliPID::kSPECIESC];
+  std::vector<float> fExpectedTPC[AliPID::kSPECIESC];
+};
+
+#endif
@@ -39,6 +39,7 @@ public:
    virtual ~AliRsnCutMiniPair() { }
 
    virtual Bool_t IsSelected(TObject *obj);
+   EType          GetType() const {return fType;}
 
 private:
 
@@ -12,6 +12,7 @@
 // Author: A. Pulvirenti
 // Developers: F. Bellini (fbellini@cern.ch)
 
+#include <algorithm>
 #include <Riostream.h>
 
 #include <TObjString.h>
@@ -49,6 +50,7 @@
 
 #include "AliRsnMiniAnalysisTask.h"
 #include "AliRsnMiniResonanceFinder.h"
+#include "AliRsnMiniPairTable.h"
 //#include "AliSpherocityUtils.h"
 #include "AliPPVsMultUtils.h"
 
@@ -78,6 +80,9 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask() :
    fMaxDiffMult(10),
    fMaxDiffVz(1.0),
    fMaxDiffAngle(1E20),
+   fOnlineMix(kFALSE),
+   fOnlineMixPoolDepth(100),
+   fMixPools(),
    fOutput(0x0),
    fHistograms("AliRsnMiniOutput", 0),
    fValues("AliRsnMiniValue", 0),
@@ -116,7 +121,9 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask() :
    fComputeSpherocity(kFALSE),
    fTrackFilter(0x0),
    fSpherocity(-10),
-   fResonanceFinders(0)
+   fResonanceFinders(0),
+   fPairTables(0),
+   fMixTables(0)
 {
 //
 // Dummy constructor ALWAYS needed for I/O.
@@ -150,6 +157,9 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const char *name, Bool_t useMC,Bo
    fMaxDiffMult(10),
    fMaxDiffVz(1.0),
    fMaxDiffAngle(1E20),
+   fOnlineMix(kFALSE),
+   fOnlineMixPoolDepth(100),
+   fMixPools(),
    fOutput(0x0),
    fHistograms("AliRsnMiniOutput", 0),
    fValues("AliRsnMiniValue", 0),
@@ -188,7 +198,9 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const char *name, Bool_t useMC,Bo
    fComputeSpherocity(kFALSE),
    fTrackFilter(0x0),
    fSpherocity(-10),
-   fResonanceFinders(0)
+   fResonanceFinders(0),
+   fPairTables(0),
+   fMixTables(0)
 {
 //
 // Default constructor.
@@ -223,6 +235,9 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const AliRsnMiniAnalysisTask &cop
    fMaxDiffMult(copy.fMaxDiffMult),
    fMaxDiffVz(copy.fMaxDiffVz),
    fMaxDiffAngle(copy.fMaxDiffAngle),
+   fOnlineMix(copy.fOnlineMix),
+   fOnlineMixPoolDepth(copy.fOnlineMixPoolDepth),
+   fMixPools(),
    fOutput(0x0),
    fHistograms(copy.fHistograms),
    fValues(copy.fValues),
@@ -259,7 +274,9 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const AliRsnMiniAnalysisTask &cop
    fComputeSpherocity(copy.fComputeSpherocity),
    fTrackFilter(copy.fTrackFilter),
    fSpherocity(copy.fSpherocity),
-   fResonanceFinders(copy.fResonanceFinders)
+   fResonanceFinders(copy.fResonanceFinders),
+   fPairTables(0),
+   fMixTables(0)
 {
 //
 // Copy constructor.
@@ -299,6 +316,8 @@ AliRsnMiniAnalysisTask &AliRsnMiniAnalysisTask::operator=(const AliRsnMiniAnalys
    fMaxDiffMult = copy.fMaxDiffMult;
    fMaxDiffVz = copy.fMaxDiffVz;
    fMaxDiffAngle = copy.fMaxDiffAngle;
+   fOnlineMix = copy.fOnlineMix;
+   fOnlineMixPoolDepth = copy.fOnlineMixPoolDepth;
    fHistograms = copy.fHistograms;
    fValues = copy.fValues;
    fHEventStat = copy.fHEventStat;
@@ -345,6 +364,7 @@ AliRsnMiniAnalysisTask::~AliRsnMiniAnalysisTask()
 // Clean-up the output list, but not the histograms that are put inside
 // (the list is owner and will clean-up these histograms). Protect in PROOF case.
 //
+   ClearMixPools();
    if (fOutput && !AliAnalysisManager::GetAnalysisManager()->IsProofMode()) {
       delete fOutput;
       delete fEvBuffer;
@@ -504,6 +524,10 @@ void AliRsnMiniAnalysisTask::UserCreateOutputObjects()
       }
    }
 
+   // group the pair outputs built from the same pairs
+   AliRsnMiniPairTable::BuildTables(fPairTables, &fHistograms, &fValues, kFALSE);
+   AliRsnMiniPairTable::BuildTables(fMixTables, &fHistograms, &fValues, kTRUE);
+
    // post data for ALL output slots >0 here, to get at least an empty histogram
    PostData(1, fOutput);
    if (fRsnTreeInFile) PostData(2, fEvBuffer);
@@ -557,6 +581,11 @@ void AliRsnMiniAnalysisTask::UserExec(Option_t *)
    // if the event is not empty, store it
    if (fMiniEvent->IsEmpty()) {
       AliDebugClass(2, Form("Rejecting empty event #%d", fEvNum));
+   } else if (fOnlineMix) {
+      // single-event outputs and mixing with the events in the pool
+      fMiniEvent->ID() = fEvNum;
+      FillEventOutputs(fMiniEvent, fEvNum);
+      MixOnline(fMiniEvent);
    } else {
       Int_t id = fEvBuffer->GetEntries();
       AliDebugClass(2, Form("Adding event #%d with ID = %d", fEvNum, id));
@@ -582,15 +611,20 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
 // FInish task: loop on each of the selected events, and compute both single-event and mixing 
 //
 
+   // with the online mixing all the events have already been processed in UserExec
+   if (fOnlineMix) {
+      ClearMixPools();
+      PostData(1, fOutput);
+      if (fRsnTreeInFile) PostData(2, fEvBuffer);
+      return;
+   }
+
    // security code: reassign the buffer to the mini-event cursor
    fEvBuffer->SetBranchAddress("events", &fMiniEvent);
    TStopwatch timer;
    // prepare variables
    Int_t ievt, nEvents = (Int_t)fEvBuffer->GetEntries();
-   Int_t idef, nDefs   = fHistograms.GetEntries();
    Int_t imix, iloop, ifill;
-   AliRsnMiniOutput *def = 0x0;
-   AliRsnMiniOutput::EComputation compType;
 
    Int_t printNum = fMixPrintRefresh;
    if (printNum < 0) {
@@ -612,45 +646,7 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
          timer.Stop(); timer.Print(); fflush(stdout); timer.Start(kFALSE);
       }
       // fill
-      for (idef = 0; idef < nDefs; idef++) {
-         def = (AliRsnMiniOutput *)fHistograms[idef];
-         if (!def) continue;
-         compType = def->GetComputation();
-         // execute computation in the appropriate way
-         switch (compType) {
-            case AliRsnMiniOutput::kEventOnly:
-               //AliDebugClass(1, Form("Event %d, def '%s': event-value histogram filling", ievt, def->GetName()));
-               ifill = 1;
-               def->FillEvent(fMiniEvent, &fValues);
-               break;
-            case AliRsnMiniOutput::kTruePair:
-               //AliDebugClass(1, Form("Event %d, def '%s': true-pair histogram filling", ievt, def->GetName()));
-               ifill = def->FillPair(fMiniEvent, fMiniEvent, &fValues);
-               break;
-            case AliRsnMiniOutput::kTrackPair:
-               //AliDebugClass(1, Form("Event %d, def '%s': pair-value histogram filling", ievt, def->GetName()));
-               ifill = def->FillPair(fMiniEvent, fMiniEvent, &fValues);
-               break;
-            case AliRsnMiniOutput::kTrackPairRotated1:
-               //AliDebugClass(1, Form("Event %d, def '%s': rotated (1) background histogram filling", ievt, def->GetName()));
-               ifill = def->FillPair(fMiniEvent, fMiniEvent, &fValues);
-               break;
-            case AliRsnMiniOutput::kTrackPairRotated2:
-               //AliDebugClass(1, Form("Event %d, def '%s': rotated (2) background histogram filling", ievt, def->GetName()));
-               ifill = def->FillPair(fMiniEvent, fMiniEvent, &fValues);
-               break;
-            case AliRsnMiniOutput::kSingleRec:
-               //AliDebugClass(1, Form("Event %d, def '%s': single reconstructed track histogram filling", ievt, def->GetName()));
-               ifill = def->FillSingleRec(fMiniEvent, &fValues);
-               break;
-            default:
-               // other kinds are processed elsewhere
-               ifill = 0;
-               AliDebugClass(2, Form("Computation = %d", (Int_t)compType));
-         }
-         // message
-         AliDebugClass(1, Form("Event %6d: def = '%15s' -- fills = %5d", ievt, def->GetName(), ifill));
-      }
+      FillEventOutputs(fMiniEvent, ievt);
    }
 
    // if no mixing is required, stop here and post the output
@@ -708,6 +704,8 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
    // perform mixing
    TObjArray *list = 0x0;
    TObjString *os = 0x0;
+   AliRsnMiniPairTable *table = 0x0;
+   Int_t itab, nTables = fMixTables.GetEntriesFast();
    for (ievt = 0; ievt < nEvents; ievt++) {
       if (printNum&&(ievt%printNum==0)) {
          AliInfo(Form("[%s] EventMixing %d/%d",GetName(),ievt,nEvents));
@@ -721,14 +719,12 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
       while ( (os = (TObjString *)next()) ) {
          imix = os->GetString().Atoi();
          fEvBuffer->GetEntry(imix);
-         for (idef = 0; idef < nDefs; idef++) {
-            def = (AliRsnMiniOutput *)fHistograms[idef];
-            if (!def) continue;
-            if (!def->IsTrackPairMix()) continue;
-            ifill += def->FillPair(&evMain, fMiniEvent, &fValues, kTRUE);
-            if (!def->IsSymmetric()) {
+         for (itab = 0; itab < nTables; itab++) {
+            table = (AliRsnMiniPairTable *)fMixTables[itab];
+            ifill += table->Fill(&evMain, fMiniEvent, &fValues, kTRUE);
+            if (!table->IsSymmetric()) {
                AliDebugClass(2, "Reflecting non symmetric pair");
-               ifill += def->FillPair(fMiniEvent, &evMain, &fValues, kFALSE);
+               ifill += table->Fill(fMiniEvent, &evMain, &fValues, kFALSE);
             }
          }
       }
@@ -1707,6 +1703,157 @@ void AliRsnMiniAnalysisTask::SetDselection(UShort_t originDselection)
 	
 	return;
 }
+//__________________________________________________________________________________________________
+/// Fill all the outputs which need only one event: event values, single tracks,
+/// same-event pairs and rotated background.
+///
+void AliRsnMiniAnalysisTask::FillEventOutputs(AliRsnMiniEvent *event, Int_t ievt)
+{
+   Int_t idef, nDefs = fHistograms.GetEntries();
+   Int_t ifill;
+   AliRsnMiniOutput *def = 0x0;
+   AliRsnMiniOutput::EComputation compType;
+
+   for (idef = 0; idef < nDefs; idef++) {
+      def = (AliRsnMiniOutput *)fHistograms[idef];
+      if (!def) continue;
+      compType = def->GetComputation();
+      // execute computation in the appropriate way
+      switch (compType) {
+         case AliRsnMiniOutput::kEventOnly:
+            //AliDebugClass(1, Form("Event %d, def '%s': event-value histogram filling", ievt, def->GetName()));
+            ifill = 1;
+            def->FillEvent(event, &fValues);
+            break;
+         case AliRsnMiniOutput::kTruePair:
+         case AliRsnMiniOutput::kTrackPair:
+         case AliRsnMiniOutput::kTrackPairRotated1:
+         case AliRsnMiniOutput::kTrackPairRotated2:
+            // filled below, all the outputs built from the same pairs together
+            continue;
+         case AliRsnMiniOutput::kSingleRec:
+            //AliDebugClass(1, Form("Event %d, def '%s': single reconstructed track histogram filling", ievt, def->GetName()));
+            ifill = def->FillSingleRec(event, &fValues);
+            break;
+         default:
+            // other kinds are processed elsewhere
+            ifill = 0;
+            AliDebugClass(2, Form("Computation = %d", (Int_t)compType));
+      }
+      // message
+      AliDebugClass(1, Form("Event %6d: def = '%15s' -- fills = %5d", ievt, def->GetName(), ifill));
+   }
+
+   // same-event, true and rotated pairs
+   AliRsnMiniPairTable *table = 0x0;
+   Int_t itab, nTables = fPairTables.GetEntriesFast();
+   for (itab = 0; itab < nTables; itab++) {
+      table = (AliRsnMiniPairTable *)fPairTables[itab];
+      ifill = table->Fill(event, event, &fValues);
+      AliDebugClass(1, Form("Event %6d: pair table of '%15s' (%d outputs) -- fills = %5d", ievt, table->GetOutput(0)->GetName(), table->GetNOutputs(), ifill));
+   }
+}
+
+//__________________________________________________________________________________________________
+/// Online mixing: pair the current event with the matching events of the pools.
+/// In the binned mixing the pools are indexed by TMath::Floor(value / max. difference) of vz,
+/// multiplicity and angle; the bins of EventsMatch() are not aligned with these ones, so the
+/// own pool and its neighbours are searched and EventsMatch() decides as in the offline mixing.
+/// In the continuous mixing a single pool of the last fOnlineMixPoolDepth events is searched.
+/// As in the mixing done at the end of the job, each event is used in at most fNMix pairs of events.
+///
+void AliRsnMiniAnalysisTask::MixOnline(AliRsnMiniEvent *event)
+{
+   if (fNMix < 1) return;
+
+   std::vector<Int_t> key;
+   if (!fContinuousMix) {
+      key.push_back((Int_t)TMath::Floor(event->Vz() / fMaxDiffVz));
+      key.push_back((Int_t)TMath::Floor(event->Mult() / fMaxDiffMult));
+      key.push_back((Int_t)TMath::Floor(event->Angle() / fMaxDiffAngle));
+   }
+   std::deque<std::pair<AliRsnMiniEvent*, Int_t> > &pool = fMixPools[key];
+
+   // candidates of the own and of the neighbouring pools
+   std::vector<std::pair<AliRsnMiniEvent*, Int_t>*> candidates;
+   std::vector<std::deque<std::pair<AliRsnMiniEvent*, Int_t> >*> searched;
+   if (fContinuousMix) {
+      searched.push_back(&pool);
+   } else {
+      std::vector<Int_t> nkey(3);
+      for (Int_t dvz = -1; dvz <= 1; dvz++) for (Int_t dmult = -1; dmult <= 1; dmult++) for (Int_t dangle = -1; dangle <= 1; dangle++) {
+         nkey[0] = key[0] + dvz;
+         nkey[1] = key[1] + dmult;
+         nkey[2] = key[2] + dangle;
+         auto found = fMixPools.find(nkey);
+         if (found != fMixPools.end() && !found->second.empty()) searched.push_back(&found->second);
+      }
+   }
+   for (auto spool : searched) {
+      for (auto &entry : *spool) {
+         if (entry.second < fNMix && EventsMatch(event, entry.first)) candidates.push_back(&entry);
+      }
+   }
+   // most recent events first
+   std::sort(candidates.begin(), candidates.end(),
+      [](const std::pair<AliRsnMiniEvent*, Int_t> *a, const std::pair<AliRsnMiniEvent*, Int_t> *b) {return a->first->ID() > b->first->ID();});
+
+   Int_t itab, nTables = fMixTables.GetEntriesFast();
+   Int_t nmatched = 0, ifill = 0;
+   AliRsnMiniPairTable *table = 0x0;
+   for (auto cand : candidates) {
+      if (nmatched >= fNMix) break;
+      for (itab = 0; itab < nTables; itab++) {
+         table = (AliRsnMiniPairTable *)fMixTables[itab];
+         ifill += table->Fill(event, cand->first, &fValues, kTRUE);
+         if (!table->IsSymmetric()) {
+            AliDebugClass(2, "Reflecting non symmetric pair");
+            ifill += table->Fill(cand->first, event, &fValues, kFALSE);
+         }
+      }
+      cand->second++;
+      nmatched++;
+   }
+   AliDebugClass(1, Form("Event %6d: mixed with %d events of %d matching ones -- fills = %5d", event->ID(), nmatched, (Int_t)candidates.size(), ifill));
+
+   // remove the events which have enough matches
+   for (auto spool : searched) {
+      for (auto it = spool->begin(); it != spool->end();) {
+         if (it->second >= fNMix) {
+            delete it->first;
+            it = spool->erase(it);
+         } else {
+            ++it;
+         }
+      }
+   }
+
+   // store the current event for the next ones, without the references to the input event
+   if (nmatched < fNMix) {
+      AliRsnMiniEvent *stored = new AliRsnMiniEvent(*event);
+      stored->SetRef(0x0);
+      stored->SetRefMC(0x0);
+      stored->SetQnVector(0x0);
+      pool.push_back(std::make_pair(stored, nmatched));
+   }
+   const UInt_t depth = fContinuousMix ? TMath::Max(fOnlineMixPoolDepth, fNMix) : fNMix;
+   while (pool.size() > depth) {
+      delete pool.front().first;
+      pool.pop_front();
+   }
+}
+
+//__________________________________________________________________________________________________
+/// Delete the events in the online mixing pools.
+///
+void AliRsnMiniAnalysisTask::ClearMixPools()
+{
+   for (auto &pool : fMixPools) {
+      for (auto &entry : pool.second) delete entry.first;
+   }
+   fMixPools.clear();
+}
+
 //__________________________________________________________________________________________________
 /// Check if two events are compatible.
 ///
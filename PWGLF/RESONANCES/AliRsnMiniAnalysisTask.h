@@ -15,6 +15,11 @@
 #ifndef ALIRSNMINIANALYSISTASK_H
 #define ALIRSNMINIANALYSISTASK_H
 
+#include <deque>
+#include <map>
+#include <utility>
+#include <vector>
+
 #include <TString.h>
 #include <TClonesArray.h>
 
@@ -63,6 +68,8 @@ public:
    void                UseMultiplicity(const char *type)  {fUseCentrality = kFALSE; fCentralityType = type; if(!fCentralityType.Contains("AliMultSelection")) fCentralityType.ToUpper();}
    void                UseContinuousMix()                 {fContinuousMix = kTRUE;}
    void                UseBinnedMix()                     {fContinuousMix = kFALSE;}
+   void                UseOnlineMix(Bool_t yn = kTRUE)    {fOnlineMix = yn;}
+   void                SetOnlineMixPoolDepth(Int_t n)     {fOnlineMixPoolDepth = n;}
    void                SetNMix(Int_t nmix)                {fNMix = nmix;}
    void                SetMaxDiffMult (Double_t val)      {fMaxDiffMult  = val;}
    void                SetMaxDiffVz   (Double_t val)      {fMaxDiffVz    = val;}
@@ -120,6 +127,9 @@ private:
    void     FillTrueMotherAOD(AliRsnMiniEvent *event);
    void     StoreTrueMother(AliRsnMiniPair *pair, AliRsnMiniEvent *event);
    Bool_t   EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEvent *event2);
+   void     FillEventOutputs(AliRsnMiniEvent *event, Int_t ievt);
+   void     MixOnline(AliRsnMiniEvent *event);
+   void     ClearMixPools();
    AliQnCorrectionsQnVector * GetQnVectorFromList(const TList *list, const char *subdetector, const char *expectedstep) const;
 
    Bool_t               fUseMC;           ///<  use or not MC info
@@ -139,6 +149,9 @@ private:
    Double_t             fMaxDiffMult;     ///<  mixing --> max difference in multiplicity
    Double_t             fMaxDiffVz;       ///<  mixing --> max difference in Vz of prim vert
    Double_t             fMaxDiffAngle;    ///<  mixing --> max difference in reaction plane angle
+   Bool_t               fOnlineMix;       ///<  mixing --> done in UserExec with in-memory pools instead of at the end of the job
+   Int_t                fOnlineMixPoolDepth; ///<  mixing --> max number of events in the pool of the continuous online mixing
+   std::map<std::vector<Int_t>, std::deque<std::pair<AliRsnMiniEvent*, Int_t> > > fMixPools; //!<! online mixing pools: events and their number of matches
 
    TList               *fOutput;          ///< output list
    TClonesArray         fHistograms;      ///< list of histogram definitions
@@ -181,9 +194,11 @@ private:
    AliAnalysisFilter   *fTrackFilter;       //!<! track filter for spherocity estimator 
    Double_t             fSpherocity;        ///< stores value of spherocity
    TObjArray            fResonanceFinders;  ///< list of AliRsnMiniResonanceFinder objects
+   TObjArray            fPairTables;        //!<! same-event pair outputs grouped by pair definition (AliRsnMiniPairTable)
+   TObjArray            fMixTables;         //!<! mixing pair outputs grouped by pair definition (AliRsnMiniPairTable)
 
 /// \cond CLASSIMP
-   ClassDef(AliRsnMiniAnalysisTask, 22);     
+   ClassDef(AliRsnMiniAnalysisTask, 24);     
 /// \endcond
 };
 
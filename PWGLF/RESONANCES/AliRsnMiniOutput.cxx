@@ -25,6 +25,7 @@
 
 #include "AliLog.h"
 #include "AliRsnCutSet.h"
+#include "AliRsnCutMiniPair.h"
 #include "AliRsnMiniAxis.h"
 #include "AliRsnMiniOutput.h"
 #include "AliRsnMiniValue.h"
@@ -642,6 +643,96 @@ Bool_t AliRsnMiniOutput::FillSingleRec(AliRsnMiniEvent *event, TClonesArray *val
    return kTRUE;
 }
 
+//________________________________________________________________________________________
+Bool_t AliRsnMiniOutput::IsPairComputation() const
+{
+//
+// Tells if the output is filled with pairs of particles (same event, mixing or rotated)
+//
+
+   switch (fComputation) {
+      case kTrackPair:
+      case kTrackPairMix:
+      case kTrackPairRotated1:
+      case kTrackPairRotated2:
+      case kTruePair:
+         return kTRUE;
+      default:
+         return kFALSE;
+   }
+}
+
+//________________________________________________________________________________________
+Bool_t AliRsnMiniOutput::SameCriteria() const
+{
+//
+// Tells if the criteria for the two daughters are the same,
+// in which case each pair of the same event is considered only once
+//
+
+   //return ((fCharge[0] == fCharge[1]) && (fCutID[0] == fCutID[1]));
+   if (fCheckSameCutID) return ((fCharge[0] == fCharge[1]) && (fCutID[0] == fCutID[1]));
+   return ((fCharge[0] == fCharge[1]) && (fDaughter[0] == fDaughter[1]));
+}
+
+//________________________________________________________________________________________
+Bool_t AliRsnMiniOutput::HasSamePairs(const AliRsnMiniOutput *out) const
+{
+//
+// Tells if the passed output is built from the same pairs as this one:
+// same daughter selection (charge, cut ID), same assigned masses,
+// same reference mass and same rotation.
+// Same-event and true pairs are the same pairs, the true pair check
+// is applied separately for each output.
+//
+
+   if (!out || !IsPairComputation() || !out->IsPairComputation()) return kFALSE;
+   if ((fComputation == kTrackPairMix) != (out->fComputation == kTrackPairMix)) return kFALSE;
+   if ((fComputation == kTrackPairRotated1) != (out->fComputation == kTrackPairRotated1)) return kFALSE;
+   if ((fComputation == kTrackPairRotated2) != (out->fComputation == kTrackPairRotated2)) return kFALSE;
+   if (SameCriteria() != out->SameCriteria()) return kFALSE;
+   if (fMotherMass != out->fMotherMass) return kFALSE;
+   for (Int_t i = 0; i < 2; i++) {
+      if (fCharge[i] != out->fCharge[i]) return kFALSE;
+      if (fCutID[i] != out->fCutID[i]) return kFALSE;
+      if (fUseStoredMass[i] != out->fUseStoredMass[i]) return kFALSE;
+      if (GetMass(i) != out->GetMass(i)) return kFALSE;
+   }
+   return kTRUE;
+}
+
+//________________________________________________________________________________________
+Bool_t AliRsnMiniOutput::CanSharePairs(TClonesArray *valueList) const
+{
+//
+// Tells if the output can be filled from a pair shared with other outputs.
+// This is not the case if one of the values modifies the pair (the cos(theta*)
+// values boost the first daughter in place) or if it is randomized (PhiV),
+// since the result would depend on the other outputs filled with the same pair.
+//
+
+   Int_t i, ival, nval = valueList->GetEntries();
+   for (i = 0; i < fAxes.GetEntries(); i++) {
+      AliRsnMiniAxis *axis = (AliRsnMiniAxis *)fAxes[i];
+      if (!axis) continue;
+      ival = axis->GetValueID();
+      if (ival < 0 || ival >= nval) continue;
+      AliRsnMiniValue *val = (AliRsnMiniValue *)valueList->At(ival);
+      if (!val) continue;
+      if (val->GetType() == AliRsnMiniValue::kCosThetaStar) return kFALSE;
+      if (val->GetType() == AliRsnMiniValue::kCosThetaStarAbs) return kFALSE;
+      if (val->GetType() == AliRsnMiniValue::kPhiV) return kFALSE;
+   }
+   if (fPairCuts) {
+      TObjArray *cuts = fPairCuts->GetCuts();
+      for (i = 0; i < cuts->GetEntriesFast(); i++) {
+         AliRsnCutMiniPair *cut = dynamic_cast<AliRsnCutMiniPair *>(cuts->At(i));
+         if (cut && cut->GetType() == AliRsnCutMiniPair::kPhiVRange) return kFALSE;
+      }
+   }
+   return kTRUE;
+}
+
 //________________________________________________________________________________________
 Int_t AliRsnMiniOutput::FillPair(AliRsnMiniEvent *event1, AliRsnMiniEvent *event2, TClonesArray *valueList, Bool_t refFirst)
 {
@@ -653,13 +744,7 @@ Int_t AliRsnMiniOutput::FillPair(AliRsnMiniEvent *event1, AliRsnMiniEvent *event
 //
 
    // check computation type
-   Bool_t okComp = kFALSE;
-   if (fComputation == kTrackPair)         okComp = kTRUE;
-   if (fComputation == kTrackPairMix)      okComp = kTRUE;
-   if (fComputation == kTrackPairRotated1) okComp = kTRUE;
-   if (fComputation == kTrackPairRotated2) okComp = kTRUE;
-   if (fComputation == kTruePair)          okComp = kTRUE;
-   if (!okComp) {
+   if (!IsPairComputation()) {
       AliError(Form("[%s] This method can be called only for pair-based computations", GetName()));
       return kFALSE;
    }
@@ -667,23 +752,22 @@ Int_t AliRsnMiniOutput::FillPair(AliRsnMiniEvent *event1, AliRsnMiniEvent *event
    // loop variables
    Int_t i1, i2, start, nadded = 0;
    AliRsnMiniParticle *p1, *p2;
-   Double_t mass1, mass2;
 
    // it is necessary to know if criteria for the two daughters are the same
    // and if the two events are the same or not (mixing)
-   //Bool_t sameCriteria = ((fCharge[0] == fCharge[1]) && (fCutID[0] == fCutID[1]));
-   Bool_t sameCriteria = ((fCharge[0] == fCharge[1]) && (fDaughter[0] == fDaughter[1]));
-   if(fCheckSameCutID) sameCriteria = ((fCharge[0] == fCharge[1]) && (fCutID[0] == fCutID[1]));
+   Bool_t sameCriteria = SameCriteria();
    Bool_t sameEvent = (event1->ID() == event2->ID());
 
-   TString selList1  = "";
-   TString selList2  = "";
    Int_t   n1 = event1->CountParticles(fSel1, fCharge[0], fCutID[0]);
    Int_t   n2 = event2->CountParticles(fSel2, fCharge[1], fCutID[1]);
-   for (i1 = 0; i1 < n1; i1++) selList1.Append(Form("%d ", fSel1[i1]));
-   for (i2 = 0; i2 < n2; i2++) selList2.Append(Form("%d ", fSel2[i2]));
-   AliDebugClass(1, Form("[%10s] Part #1: [%s] -- evID %6d -- charge = %c -- cut ID = %d --> %4d tracks (%s)", GetName(), (event1 == event2 ? "def" : "mix"), event1->ID(), fCharge[0], fCutID[0], n1, selList1.Data()));
-   AliDebugClass(1, Form("[%10s] Part #2: [%s] -- evID %6d -- charge = %c -- cut ID = %d --> %4d tracks (%s)", GetName(), (event1 == event2 ? "def" : "mix"), event2->ID(), fCharge[1], fCutID[1], n2, selList2.Data()));
+   if (AliDebugLevelClass() >= 1) {
+      TString selList1  = "";
+      TString selList2  = "";
+      for (i1 = 0; i1 < n1; i1++) selList1.Append(Form("%d ", fSel1[i1]));
+      for (i2 = 0; i2 < n2; i2++) selList2.Append(Form("%d ", fSel2[i2]));
+      AliDebugClass(1, Form("[%10s] Part #1: [%s] -- evID %6d -- charge = %c -- cut ID = %d --> %4d tracks (%s)", GetName(), (event1 == event2 ? "def" : "mix"), event1->ID(), fCharge[0], fCutID[0], n1, selList1.Data()));
+      AliDebugClass(1, Form("[%10s] Part #2: [%s] -- evID %6d -- charge = %c -- cut ID = %d --> %4d tracks (%s)", GetName(), (event1 == event2 ? "def" : "mix"), event2->ID(), fCharge[1], fCutID[1], n2, selList2.Data()));
+   }
    if (!n1 || !n2) {
       AliDebugClass(1, "No pairs to mix");
       return 0;
@@ -692,9 +776,6 @@ Int_t AliRsnMiniOutput::FillPair(AliRsnMiniEvent *event1, AliRsnMiniEvent *event
    // external loop
    for (i1 = 0; i1 < n1; i1++) {
       p1 = event1->GetParticle(fSel1[i1]);
-      //p1 = event1->GetParticle(i1);
-      //if (p1->Charge() != fCharge[0]) continue;
-      //if (!p1->HasCutBit(fCutID[0])) continue;
       // define starting point for inner loop
       // if daughter selection criteria (charge, cuts) are the same
       // and the two events coincide, internal loop must start from
@@ -705,51 +786,78 @@ Int_t AliRsnMiniOutput::FillPair(AliRsnMiniEvent *event1, AliRsnMiniEvent *event
       // internal loop
       for (i2 = start; i2 < n2; i2++) {
          p2 = event2->GetParticle(fSel2[i2]);
-         //p2 = event2->GetParticle(i2);
-         //if (p2->Charge() != fCharge[1]) continue;
-         //if (!p2->HasCutBit(fCutID[1])) continue;
          // avoid to mix a particle with itself
          if (sameEvent && (p1->Index() == p2->Index()) && (!p1->IsResonance())) {
             AliDebugClass(2, "Skipping same index");
             continue;
          }
-         // sum momenta
-          
-         mass1 = p1->StoredMass(kFALSE);
-         if(!fUseStoredMass[0] || mass1 < 0.0) mass1 = GetMass(0);
-         mass2 = p2->StoredMass(kFALSE);
-         if(!fUseStoredMass[1] || mass2 < 0.0) mass2 = GetMass(1);
-         fPair.Fill(p1, p2, mass1, mass2, fMotherMass);
-	 
-         // do rotation if needed
-         if (fComputation == kTrackPairRotated1) fPair.InvertP(kTRUE);
-         if (fComputation == kTrackPairRotated2) fPair.InvertP(kFALSE);
-         // if required, check that this is a true pair
-         if (fComputation == kTruePair) {
-            if (fPair.Mother() < 0)  {
-               continue;
-            } else if (fPair.MotherPDG() != fMotherPDG) {
-               continue;
-            }
-            Bool_t decayMatch = kFALSE;
-            if (AliRsnDaughter::IsEquivalentPDGCode(p1->PDGAbs() , GetPDG(0))
+         // sum momenta and rotate if needed
+         FillPairKinematics(fPair, p1, p2);
+         // check true pair and pair cuts
+         if (!AcceptPair(fPair, p1, p2)) continue;
+         // get computed values & fill histogram
+         nadded++;
+         ComputeValues(&fPair, (refFirst ? event1 : event2), valueList);
+         FillHistogram();
+      } // end internal loop
+   } // end external loop
+
+   AliDebugClass(1, Form("Pairs added in total = %4d", nadded));
+   return nadded;
+}
+
+//________________________________________________________________________________________
+void AliRsnMiniOutput::FillPairKinematics(AliRsnMiniPair &pair, AliRsnMiniParticle *p1, AliRsnMiniParticle *p2) const
+{
+//
+// Fills the pair with the two particles using the masses assigned
+// in this output, and applies the rotation if required
+//
+
+   Double_t mass1 = p1->StoredMass(kFALSE);
+   if (!fUseStoredMass[0] || mass1 < 0.0) mass1 = GetMass(0);
+   Double_t mass2 = p2->StoredMass(kFALSE);
+   if (!fUseStoredMass[1] || mass2 < 0.0) mass2 = GetMass(1);
+   pair.Fill(p1, p2, mass1, mass2, fMotherMass);
+
+   // do rotation if needed
+   if (fComputation == kTrackPairRotated1) pair.InvertP(kTRUE);
+   if (fComputation == kTrackPairRotated2) pair.InvertP(kFALSE);
+}
+
+//________________________________________________________________________________________
+Bool_t AliRsnMiniOutput::AcceptPair(AliRsnMiniPair &pair, AliRsnMiniParticle *p1, AliRsnMiniParticle *p2)
+{
+//
+// Checks a filled pair against the true pair requirements (if needed) and the pair cuts
+//
+
+   // if required, check that this is a true pair
+   if (fComputation == kTruePair) {
+      if (pair.Mother() < 0)  {
+         return kFALSE;
+      } else if (pair.MotherPDG() != fMotherPDG) {
+         return kFALSE;
+      }
+      Bool_t decayMatch = kFALSE;
+      if (AliRsnDaughter::IsEquivalentPDGCode(p1->PDGAbs() , GetPDG(0))
 		&& AliRsnDaughter::IsEquivalentPDGCode(p2->PDGAbs() , GetPDG(1)))
-               decayMatch = kTRUE;
-            if (AliRsnDaughter::IsEquivalentPDGCode(p2->PDGAbs() , GetPDG(0))
+         decayMatch = kTRUE;
+      if (AliRsnDaughter::IsEquivalentPDGCode(p2->PDGAbs() , GetPDG(0))
 		&& AliRsnDaughter::IsEquivalentPDGCode(p1->PDGAbs() , GetPDG(1)))
-               decayMatch = kTRUE;
-            if (!decayMatch) continue;
-	    if ( (fMaxNSisters>0) && (p1->NTotSisters()==p2->NTotSisters()) && (p1->NTotSisters()>fMaxNSisters)) continue;
-	    if ( fCheckP &&(TMath::Abs(fPair.PmotherX()-(p1->Px(1)+p2->Px(1)))/(TMath::Abs(fPair.PmotherX())+1.e-13)) > 0.00001 &&
-		          (TMath::Abs(fPair.PmotherY()-(p1->Py(1)+p2->Py(1)))/(TMath::Abs(fPair.PmotherY())+1.e-13)) > 0.00001 &&
-     			  (TMath::Abs(fPair.PmotherZ()-(p1->Pz(1)+p2->Pz(1)))/(TMath::Abs(fPair.PmotherZ())+1.e-13)) > 0.00001 ) continue;
+         decayMatch = kTRUE;
+      if (!decayMatch) return kFALSE;
+	    if ( (fMaxNSisters>0) && (p1->NTotSisters()==p2->NTotSisters()) && (p1->NTotSisters()>fMaxNSisters)) return kFALSE;
+	    if ( fCheckP &&(TMath::Abs(pair.PmotherX()-(p1->Px(1)+p2->Px(1)))/(TMath::Abs(pair.PmotherX())+1.e-13)) > 0.00001 &&
+		          (TMath::Abs(pair.PmotherY()-(p1->Py(1)+p2->Py(1)))/(TMath::Abs(pair.PmotherY())+1.e-13)) > 0.00001 &&
+     			  (TMath::Abs(pair.PmotherZ()-(p1->Pz(1)+p2->Pz(1)))/(TMath::Abs(pair.PmotherZ())+1.e-13)) > 0.00001 ) return kFALSE;
 	    if ( fCheckFeedDown ){
 	    		Int_t pdgGranma = 0;
 	  		Bool_t isFromB=kFALSE;
 	  		Bool_t isQuarkFound=kFALSE;
 			
-			if(fPair.IsFromB() == kTRUE) isFromB = kTRUE;
-			if(fPair.IsQuarkFound() == kTRUE) isQuarkFound = kTRUE;
+			if(pair.IsFromB() == kTRUE) isFromB = kTRUE;
+			if(pair.IsQuarkFound() == kTRUE) isQuarkFound = kTRUE;
 	  		if(fRejectIfNoQuark && !isQuarkFound) pdgGranma = -99999;
 	  		if(isFromB){
 	  		  if (!fKeepDfromB) pdgGranma = -9999; //skip particle if come from a B meson.
@@ -759,32 +867,24 @@ Int_t AliRsnMiniOutput::FillPair(AliRsnMiniEvent *event1, AliRsnMiniEvent *event
 			  }
 	  		if (pdgGranma == -99999){
 	  			AliDebug(2,"This particle does not have a quark in his genealogy\n");
-	  			continue;
+	  			return kFALSE;
 	  		}
 	  		if (pdgGranma == -9999){
 	  			AliDebug(2,"This particle come from a B decay channel but according to the settings of the task, we keep only the prompt charm particles\n");
-	  			continue;
+	  			return kFALSE;
 	  		}
 	 
 	  		if (pdgGranma == -999){
 	  			AliDebug(2,"This particle come from a prompt charm particles but according to the settings of the task, we want only the ones coming from B\n");
-	  			continue;
+	  			return kFALSE;
 	  		}
 		    }
-         }
-         // check pair against cuts
-         if (fPairCuts) {
-            if (!fPairCuts->IsSelected(&fPair)) continue;
-         }
-         // get computed values & fill histogram
-         nadded++;
-         if (refFirst) ComputeValues(event1, valueList); else ComputeValues(event2, valueList);
-         FillHistogram();
-      } // end internal loop
-   } // end external loop
-
-   AliDebugClass(1, Form("Pairs added in total = %4d", nadded));
-   return nadded;
+   }
+   // check pair against cuts
+   if (fPairCuts) {
+      if (!fPairCuts->IsSelected(&pair)) return kFALSE;
+   }
+   return kTRUE;
 }
 //___________________________________________________________
 void AliRsnMiniOutput::SetDselection(UShort_t originDselection)
@@ -814,11 +914,14 @@ void AliRsnMiniOutput::SetDselection(UShort_t originDselection)
 	return;
 }
 //________________________________________________________________________________________
-void AliRsnMiniOutput::ComputeValues(AliRsnMiniEvent *event, TClonesArray *valueList)
+void AliRsnMiniOutput::ComputeValues(AliRsnMiniPair *pair, AliRsnMiniEvent *event, TClonesArray *valueList, Double_t *values, UChar_t *computed)
 {
 //
-// Using the arguments and the internal 'fPair' data member,
-// compute all values to be stored in the histogram
+// Using the arguments and the passed pair,
+// compute all values to be stored in the histogram.
+// If the 'values' and 'computed' arrays (indexed by value ID) are passed,
+// the values already computed for the same pair by another output are taken
+// from there, and the ones computed here are added.
 //
 
    // check size of computed array
@@ -845,7 +948,15 @@ void AliRsnMiniOutput::ComputeValues(AliRsnMiniEvent *event, TClonesArray *value
          continue;
       }
       // if none of the above exit points is taken, compute value
-      fComputed[i] = val->Eval(&fPair, event);
+      if (!values) {
+         fComputed[i] = val->Eval(pair, event);
+      } else {
+         if (!computed[ival]) {
+            values[ival] = val->Eval(pair, event);
+            computed[ival] = 1;
+         }
+         fComputed[i] = values[ival];
+      }
    }
 }
 
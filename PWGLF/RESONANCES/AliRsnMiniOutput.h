@@ -120,12 +120,19 @@ public:
    Bool_t          FillSingleRec(AliRsnMiniEvent *event1, TClonesArray *valueList);
    Bool_t          FillEvent(AliRsnMiniEvent *event, TClonesArray *valueList);
    Int_t           FillPair(AliRsnMiniEvent *event1, AliRsnMiniEvent *event2, TClonesArray *valueList, Bool_t refFirst = kTRUE);
+   Bool_t          IsPairComputation() const;
+   Bool_t          HasSamePairs(const AliRsnMiniOutput *out) const;
+   Bool_t          CanSharePairs(TClonesArray *valueList) const;
 
 private:
 
    void   CreateHistogram(const char *name);
    void   CreateHistogramSparse(const char *name);
-   void   ComputeValues(AliRsnMiniEvent *event, TClonesArray *valueList);
+   Bool_t SameCriteria() const;
+   void   FillPairKinematics(AliRsnMiniPair &pair, AliRsnMiniParticle *p1, AliRsnMiniParticle *p2) const;
+   Bool_t AcceptPair(AliRsnMiniPair &pair, AliRsnMiniParticle *p1, AliRsnMiniParticle *p2);
+   void   ComputeValues(AliRsnMiniEvent *event, TClonesArray *valueList) {ComputeValues(&fPair, event, valueList);}
+   void   ComputeValues(AliRsnMiniPair *pair, AliRsnMiniEvent *event, TClonesArray *valueList, Double_t *values = 0, UChar_t *computed = 0);
    void   FillHistogram();
 
    EOutputType      fOutputType;       //  type of output
@@ -156,6 +163,8 @@ private:
    Bool_t           fCheckHistRange;   //  check if values is in histogram range
    Bool_t           fCheckSameCutID; // alternate check for whether the two daughters are of the same type, using fCutID instead of fDaughter
 
+   friend class AliRsnMiniPairTable;
+
    ClassDef(AliRsnMiniOutput, 7)  // AliRsnMiniOutput class
 };
 
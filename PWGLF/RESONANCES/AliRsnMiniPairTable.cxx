@@ -0,0 +1,196 @@
+//
+// Pairs of one daughter definition shared by several outputs.
+// All the outputs of the table are built from the same pairs
+// (same charges, cut IDs, masses and rotation, see AliRsnMiniOutput::HasSamePairs),
+// so the list of selected particles and the pair kinematics are computed
+// once for each pair, and each value is evaluated once for each pair
+// and then read by all the outputs which use it in an axis.
+// The true pair checks and the pair cuts are still applied by each output.
+//
+
+#include <algorithm>
+
+#include "TClonesArray.h"
+
+#include "AliLog.h"
+#include "AliRsnMiniParticle.h"
+#include "AliRsnMiniEvent.h"
+#include "AliRsnMiniOutput.h"
+#include "AliRsnMiniPairTable.h"
+
+ClassImp(AliRsnMiniPairTable)
+
+//__________________________________________________________________________________________________
+AliRsnMiniPairTable::AliRsnMiniPairTable() :
+   TObject(),
+   fOutputs(),
+   fShared(kFALSE),
+   fPair(),
+   fSel1(0),
+   fSel2(0),
+   fValues(),
+   fComputed()
+{
+//
+// Constructor
+//
+}
+
+//__________________________________________________________________________________________________
+AliRsnMiniPairTable::AliRsnMiniPairTable(const AliRsnMiniPairTable &copy) :
+   TObject(copy),
+   fOutputs(copy.fOutputs),
+   fShared(copy.fShared),
+   fPair(),
+   fSel1(0),
+   fSel2(0),
+   fValues(),
+   fComputed()
+{
+//
+// Copy constructor, the outputs are shared with the copied table
+//
+}
+
+//__________________________________________________________________________________________________
+AliRsnMiniPairTable &AliRsnMiniPairTable::operator=(const AliRsnMiniPairTable &copy)
+{
+//
+// Assignment operator, the outputs are shared with the copied table
+//
+
+   if (this == &copy)
+      return *this;
+   TObject::operator=(copy);
+   fOutputs.Clear();
+   fOutputs.AddAll(&copy.fOutputs);
+   fShared = copy.fShared;
+
+   return (*this);
+}
+
+//__________________________________________________________________________________________________
+void AliRsnMiniPairTable::BuildTables(TObjArray &tables, TClonesArray *outputs, TClonesArray *valueList, Bool_t mixing)
+{
+//
+// Groups the pair outputs of the list in tables of outputs built from the same pairs.
+// If 'mixing' is true only the mixing outputs are considered, otherwise only the
+// outputs filled with pairs of the same event (same event, true and rotated pairs).
+// The tables are added to the passed array, which owns them.
+//
+
+   tables.SetOwner();
+   tables.Delete();
+
+   Int_t i, j, n = outputs->GetEntries();
+   for (i = 0; i < n; i++) {
+      AliRsnMiniOutput *out = (AliRsnMiniOutput *)outputs->At(i);
+      if (!out || !out->IsPairComputation()) continue;
+      if (out->IsTrackPairMix() != mixing) continue;
+      for (j = 0; j < tables.GetEntriesFast(); j++) {
+         if (((AliRsnMiniPairTable *)tables.At(j))->Add(out, valueList)) break;
+      }
+      if (j < tables.GetEntriesFast()) continue;
+      AliRsnMiniPairTable *table = new AliRsnMiniPairTable();
+      table->Add(out, valueList);
+      tables.Add(table);
+   }
+
+   for (j = 0; j < tables.GetEntriesFast(); j++) {
+      AliRsnMiniPairTable *table = (AliRsnMiniPairTable *)tables.At(j);
+      AliDebugClass(1, Form("Pair table %d (%s): %d outputs, first is '%s'", j, (mixing ? "mix" : "def"), table->GetNOutputs(), table->GetOutput(0)->GetName()));
+   }
+}
+
+//__________________________________________________________________________________________________
+Bool_t AliRsnMiniPairTable::Add(AliRsnMiniOutput *out, TClonesArray *valueList)
+{
+//
+// Adds an output to the table, if it is built from the same pairs as the outputs
+// already there and if it can be filled from a shared pair.
+// An output which cannot share the pair (see AliRsnMiniOutput::CanSharePairs)
+// is accepted only by an empty table and is then the only output of it.
+// Returns kTRUE if the output was added.
+//
+
+   if (!out || !out->IsPairComputation()) return kFALSE;
+
+   if (!GetNOutputs()) {
+      fShared = out->CanSharePairs(valueList);
+      fOutputs.Add(out);
+      return kTRUE;
+   }
+
+   if (!fShared || !out->CanSharePairs(valueList)) return kFALSE;
+   if (!GetOutput(0)->HasSamePairs(out)) return kFALSE;
+   fOutputs.Add(out);
+   return kTRUE;
+}
+
+//__________________________________________________________________________________________________
+Bool_t AliRsnMiniPairTable::IsSymmetric() const
+{
+//
+// Symmetric pairs need not to be reflected in the mixing.
+// The charges and the daughters are the same for all the outputs.
+//
+
+   return (GetNOutputs() && GetOutput(0)->IsSymmetric());
+}
+
+//__________________________________________________________________________________________________
+Int_t AliRsnMiniPairTable::Fill(AliRsnMiniEvent *event1, AliRsnMiniEvent *event2, TClonesArray *valueList, Bool_t refFirst)
+{
+//
+// Loops on the pairs of the passed mini-events, as AliRsnMiniOutput::FillPair,
+// and fills all the outputs of the table with each pair.
+// Returns the number of successful fillings, summed over the outputs.
+// Last argument tells if the reference event for event-based values is the first or the second.
+//
+
+   Int_t nout = GetNOutputs();
+   if (!nout) return 0;
+   AliRsnMiniOutput *def = GetOutput(0);
+   if (nout == 1) return def->FillPair(event1, event2, valueList, refFirst);
+
+   // loop variables
+   Int_t i1, i2, iout, start, nadded = 0;
+   AliRsnMiniParticle *p1, *p2;
+   AliRsnMiniOutput *out;
+
+   Bool_t sameCriteria = def->SameCriteria();
+   Bool_t sameEvent = (event1->ID() == event2->ID());
+   AliRsnMiniEvent *refEvent = (refFirst ? event1 : event2);
+
+   Int_t n1 = event1->CountParticles(fSel1, def->GetCharge(0), def->GetCutID(0));
+   Int_t n2 = event2->CountParticles(fSel2, def->GetCharge(1), def->GetCutID(1));
+   AliDebugClass(1, Form("[%10s] %d outputs -- evID %6d / %6d --> %4d / %4d tracks", def->GetName(), nout, event1->ID(), event2->ID(), n1, n2));
+   if (!n1 || !n2) return 0;
+
+   Int_t nval = valueList->GetEntries();
+   fValues.resize(nval);
+   fComputed.resize(nval);
+
+   for (i1 = 0; i1 < n1; i1++) {
+      p1 = event1->GetParticle(fSel1[i1]);
+      start = ((sameEvent && sameCriteria) ? i1 + 1 : 0);
+      for (i2 = start; i2 < n2; i2++) {
+         p2 = event2->GetParticle(fSel2[i2]);
+         // avoid to mix a particle with itself
+         if (sameEvent && (p1->Index() == p2->Index()) && (!p1->IsResonance())) continue;
+         // pair kinematics, once for all the outputs
+         def->FillPairKinematics(fPair, p1, p2);
+         std::fill(fComputed.begin(), fComputed.end(), 0);
+         for (iout = 0; iout < nout; iout++) {
+            out = GetOutput(iout);
+            if (!out->AcceptPair(fPair, p1, p2)) continue;
+            nadded++;
+            out->ComputeValues(&fPair, refEvent, valueList, fValues.data(), fComputed.data());
+            out->FillHistogram();
+         }
+      }
+   }
+
+   AliDebugClass(1, Form("Pairs added in total = %4d", nadded));
+   return nadded;
+}
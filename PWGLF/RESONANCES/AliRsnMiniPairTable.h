@@ -0,0 +1,55 @@
+#ifndef ALIRSNMINIPAIRTABLE_H
+#define ALIRSNMINIPAIRTABLE_H
+
+//
+// Pairs of one daughter definition shared by several outputs.
+// All the outputs of the table are built from the same pairs
+// (same charges, cut IDs, masses and rotation, see AliRsnMiniOutput::HasSamePairs),
+// so the list of selected particles and the pair kinematics are computed
+// once for each pair, and each value is evaluated once for each pair
+// and then read by all the outputs which use it in an axis.
+// The true pair checks and the pair cuts are still applied by each output.
+//
+
+#include <vector>
+
+#include "TObject.h"
+#include "TArrayI.h"
+#include "TObjArray.h"
+
+#include "AliRsnMiniPair.h"
+
+class TClonesArray;
+class AliRsnMiniEvent;
+class AliRsnMiniOutput;
+
+class AliRsnMiniPairTable : public TObject {
+public:
+
+   AliRsnMiniPairTable();
+   AliRsnMiniPairTable(const AliRsnMiniPairTable &copy);
+   AliRsnMiniPairTable &operator=(const AliRsnMiniPairTable &copy);
+   virtual ~AliRsnMiniPairTable() { }
+
+   static void       BuildTables(TObjArray &tables, TClonesArray *outputs, TClonesArray *valueList, Bool_t mixing);
+
+   Bool_t            Add(AliRsnMiniOutput *out, TClonesArray *valueList);
+   Int_t             GetNOutputs() const {return fOutputs.GetEntriesFast();}
+   AliRsnMiniOutput *GetOutput(Int_t i) const {return (AliRsnMiniOutput *)fOutputs.At(i);}
+   Bool_t            IsSymmetric() const;
+   Int_t             Fill(AliRsnMiniEvent *event1, AliRsnMiniEvent *event2, TClonesArray *valueList, Bool_t refFirst = kTRUE);
+
+private:
+
+   TObjArray             fOutputs;   //! outputs filled from the table (not owned)
+   Bool_t                fShared;    //! the outputs can be filled from the same pair object
+   AliRsnMiniPair        fPair;      //! pair shared by the outputs
+   TArrayI               fSel1;      //! list of selected particles for definition 1
+   TArrayI               fSel2;      //! list of selected particles for definition 2
+   std::vector<Double_t> fValues;    //! values of the current pair, by value ID
+   std::vector<UChar_t>  fComputed;  //! flags of the values already computed for the current pair
+
+   ClassDef(AliRsnMiniPairTable, 1)  // AliRsnMiniPairTable class
+};
+
+#endif
@@ -153,14 +153,17 @@ Int_t AliRsnMiniResonanceFinder::RunResonanceFinder(AliRsnMiniEvent* event)
    // it is necessary to know if criteria for the two daughters are the same
    Bool_t sameCriteria = ((fCharge[0] == fCharge[1]) && (fDaughter[0] == fDaughter[1]));
 
-   TString selList1  = "";
-   TString selList2  = "";
    Int_t   n1 = event->CountParticles(fSel1, fCharge[0], fCutID[0]);
    Int_t   n2 = event->CountParticles(fSel2, fCharge[1], fCutID[1]);
-   for (i1 = 0; i1 < n1; i1++) selList1.Append(Form("%d ", fSel1[i1]));
-   for (i2 = 0; i2 < n2; i2++) selList2.Append(Form("%d ", fSel2[i2]));
-   AliDebugClass(1, Form("[%10s] Part #1: -- evID %6d -- charge = %c -- cut ID = %d --> %4d tracks (%s)", GetName(), event->ID(), fCharge[0], fCutID[0], n1, selList1.Data()));
-   AliDebugClass(1, Form("[%10s] Part #2: -- evID %6d -- charge = %c -- cut ID = %d --> %4d tracks (%s)", GetName(), event->ID(), fCharge[1], fCutID[1], n2, selList2.Data()));
+   // the lists of selected particles are built only for the debug printout
+   if (AliDebugLevelClass() >= 1) {
+      TString selList1  = "";
+      TString selList2  = "";
+      for (i1 = 0; i1 < n1; i1++) selList1.Append(Form("%d ", fSel1[i1]));
+      for (i2 = 0; i2 < n2; i2++) selList2.Append(Form("%d ", fSel2[i2]));
+      AliDebugClass(1, Form("[%10s] Part #1: -- evID %6d -- charge = %c -- cut ID = %d --> %4d tracks (%s)", GetName(), event->ID(), fCharge[0], fCutID[0], n1, selList1.Data()));
+      AliDebugClass(1, Form("[%10s] Part #2: -- evID %6d -- charge = %c -- cut ID = %d --> %4d tracks (%s)", GetName(), event->ID(), fCharge[1], fCutID[1], n2, selList2.Data()));
+   }
    if (!n1 || !n2) {
       AliDebugClass(1, "No pairs to mix");
       return 0;
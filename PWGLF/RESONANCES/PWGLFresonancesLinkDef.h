@@ -69,6 +69,7 @@
 #pragma link C++ class AliRsnMiniEvent+;
 #pragma link C++ class AliRsnMiniAxis+;
 #pragma link C++ class AliRsnMiniOutput+;
+#pragma link C++ class AliRsnMiniPairTable+;
 #pragma link C++ class AliRsnMiniValue+;
 #pragma link C++ class AliRsnMiniMonitor+;
 #pragma link C++ class AliRsnMiniAnalysisTask+;
@@ -50,6 +50,8 @@
 #include "AliAODHeader.h"
 // STL includes
 #include <iostream>
+#include <algorithm>
+#include <cmath>
 using namespace std;
 
 
@@ -143,7 +145,10 @@ void AliSpherocityUtils::Init(){
 		cout<<"Kinematic cuts:   "<<fPtMinCut<<"<pT<"<<fPtMaxCut<<" GeV/c,   "<<fEtaMinCut<<"<|eta|<"<<fEtaMaxCut<<endl;
 	else
 		cout<<"Kinematic cuts:   "<<fPtMinCut<<"<pT<"<<fPtMaxCut<<" GeV/c,   "<<fEtaMinCut<<"<eta<"<<fEtaMinCut<<endl;
-	cout<<"Step size for spherocity calculation:"<<fSizeStep*2*TMath::Pi()/360.0<<"  radians"<<endl;
+	if(fSizeStep>0)
+		cout<<"Step size for spherocity calculation:"<<fSizeStep*2*TMath::Pi()/360.0<<"  radians"<<endl;
+	else
+		cout<<"Spherocity calculation: exact minimisation"<<endl;
 	cout<<"-----------------------------------------------------------------------------------"<<endl;
 	cout<<"-----------------------------------------------------------------------------------"<<endl;
 
@@ -365,6 +370,9 @@ Int_t AliSpherocityUtils::ReadESDEvent( vector<Float_t> &ptArray,  vector<Float_
 Float_t AliSpherocityUtils::AnalyseGetSpherocity( const vector<Float_t> &pt, const vector<Float_t> &eta, const vector<Float_t> &phi ){
 
 
+	if(fSizeStep<=0)
+		return GetSpherocityExact(fNrec, pt, phi);
+
 	Float_t spherocity = -10.0;
 	Float_t pFull = 0;
 	Float_t Spherocity = 2;
@@ -404,6 +412,46 @@ Float_t AliSpherocityUtils::AnalyseGetSpherocity( const vector<Float_t> &pt, con
 
 	return spherocity;
 
+}
+//_____________________________________________________________________
+Float_t AliSpherocityUtils::GetSpherocityExact( Int_t n, const vector<Float_t> &pt, const vector<Float_t> &phi, Bool_t isPtWeighted ){
+
+	// sum_i w_i |sin(phi_i - theta)| is concave between two track directions (mod pi),
+	// hence its minimum is found for an axis along one of the tracks. With the directions
+	// sorted, the sum for each candidate axis follows from running sums of w cos and w sin:
+	// S(theta) = cos(theta) (Sy[>=theta] - Sy[<theta]) - sin(theta) (Sx[>=theta] - Sx[<theta])
+
+	if( n <= 0 )
+		return -10.0;
+
+	vector< pair<Double_t, Double_t> > dir(n); // (phi mod pi, weight)
+	Double_t sumw = 0, sumx = 0, sumy = 0;
+	for(Int_t i1 = 0; i1 < n; ++i1){
+		Double_t alpha = fmod( (Double_t)phi[i1], TMath::Pi() );
+		if( alpha < 0 ) alpha += TMath::Pi();
+		dir[i1] = make_pair( alpha, isPtWeighted ? (Double_t)pt[i1] : 1.0 );
+		sumw += dir[i1].second;
+		sumx += dir[i1].second * TMath::Cos( alpha );
+		sumy += dir[i1].second * TMath::Sin( alpha );
+	}
+	if( sumw <= 0 )
+		return -10.0;
+	sort( dir.begin(), dir.end() );
+
+	Double_t lowx = 0, lowy = 0; // directions below the candidate axis
+	Double_t minSum = sumw;
+	for(Int_t i1 = 0; i1 < n; ++i1){
+		Double_t c = TMath::Cos( dir[i1].first );
+		Double_t s = TMath::Sin( dir[i1].first );
+		Double_t sum = c * (sumy - 2*lowy) - s * (sumx - 2*lowx);
+		if( sum < minSum ) minSum = sum;
+		lowx += dir[i1].second * c;
+		lowy += dir[i1].second * s;
+	}
+	if( minSum < 0 ) minSum = 0;
+
+	return TMath::Power( minSum / sumw, 2 ) * TMath::Pi() * TMath::Pi() / 4.0;
+
 }
 //_____________________________________________________________________
 Float_t AliSpherocityUtils::GetSpherocity( TH1D * hphi, TH1D *heta )
@@ -38,7 +38,7 @@ class AliSpherocityUtils : public TObject {
   void  SetAODTrackFilter(Int_t aodtrackF) {fAODFilterGlobal = aodtrackF;}
 
   void  SetMinMult(Int_t minnch)        {fMinMult    = minnch;}
-  void  SetStepSize(Float_t sizestep)   {fSizeStep   = sizestep;}
+  void  SetStepSize(Float_t sizestep)   {fSizeStep   = sizestep;} // <=0: exact minimisation
   void  SetIsEtaAbs(Bool_t isabseta)    {fIsAbsEta   = isabseta;}
   void  SetTrackEtaMin(Float_t etaminF) {fEtaMinCut  = etaminF;}
   void  SetTrackEtaMax(Float_t etamaxF) {fEtaMaxCut  = etamaxF;}
@@ -63,6 +63,9 @@ class AliSpherocityUtils : public TObject {
   Float_t AnalyseGetSpherocity(const std::vector<Float_t> &pt,
 		  const std::vector<Float_t> &eta,
 		  const std::vector<Float_t> &phi);
+  // exact minimisation over the transverse axis, O(N log N)
+  static Float_t GetSpherocityExact(Int_t n, const std::vector<Float_t> &pt,
+		  const std::vector<Float_t> &phi, Bool_t isPtWeighted = kTRUE);
 
 
   //EvSel Snippets
@@ -202,6 +202,7 @@ fkSandboxMode ( kFALSE ),
 //---> Fill tree with specific config
 fkSaveSpecificConfig(kFALSE),
 fkConfigToSave(""),
+fkUseCutTree(kTRUE),
 
 //---> Variables for fTreeEvent
 fCentrality(0),
@@ -531,7 +532,11 @@ fHistEventCounter(0),
 fHistEventCounterDifferential(0),
 fHistCentrality(0),
 fHistEventMatrix(0),
-fRecPointRadii(0)
+fRecPointRadii(0),
+fV0CutTree(),
+fCascadeCutTree(),
+fDeferredAxes(),
+fDeferredHistos()
 //------------------------------------------------
 // Tree Variables
 {
@@ -606,6 +611,7 @@ fkSandboxMode ( kFALSE ),
 //---> Fill tree with specific config
 fkSaveSpecificConfig(kFALSE),
 fkConfigToSave(""),
+fkUseCutTree(kTRUE),
 
 //---> Variables for fTreeEvent
 fCentrality(0),
@@ -936,7 +942,11 @@ fHistEventCounter(0),
 fHistEventCounterDifferential(0),
 fHistCentrality(0),
 fHistEventMatrix(0),
-fRecPointRadii(0)
+fRecPointRadii(0),
+fV0CutTree(),
+fCascadeCutTree(),
+fDeferredAxes(),
+fDeferredHistos()
 {
   
   //Re-vertex: Will only apply for cascade candidates
@@ -1669,6 +1679,10 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserCreateOutputObjects()
   
   AliWarning( Form("Initialized %i cascade output objects!", lTotalCfgs));
   
+  //Group configurations sharing cut values
+  BuildCutTrees();
+  if( fkUseCutTree ) AliWarning( Form("Cut trees: %i V0 and %i cascade nodes", (Int_t) fV0CutTree.size()-1, (Int_t) fCascadeCutTree.size()-1));
+  
   //Regular Output: Slots 1-8
   PostData(1, fListHist    );
   PostData(2, fListK0Short    );
@@ -2420,21 +2434,60 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
     TH3F *histoout         = 0x0;
     AliV0Result *lV0Result = 0x0;
     
+    if( fkUseCutTree ){
+      //Candidate properties for each mass hypothesis, then walk the cut tree
+      V0CutTreeCandidate lCand;
+      lCand.fOnFlyStatus = lOnFlyStatus;
+      lCand.fLeastNcrOverLength = lLeastNcrOverLength;
+      lCand.fITSorTOFsatisfied = lITSorTOFsatisfied;
+      
+      lCand.fMass[AliV0Result::kK0Short] = fTreeVariableInvMassK0s;
+      lCand.fRap[AliV0Result::kK0Short] = fTreeVariableRapK0Short;
+      lCand.fPDGMass[AliV0Result::kK0Short] = 0.497;
+      lCand.fNegdEdx[AliV0Result::kK0Short] = fTreeVariableNSigmasNegPion;
+      lCand.fPosdEdx[AliV0Result::kK0Short] = fTreeVariableNSigmasPosPion;
+      lCand.fBaryonMomentum[AliV0Result::kK0Short] = -0.5;
+      lCand.fBaryonPt[AliV0Result::kK0Short] = -0.5;
+      lCand.fBaryondEdxFromProton[AliV0Result::kK0Short] = 0;
+      
+      lCand.fMass[AliV0Result::kLambda] = fTreeVariableInvMassLambda;
+      lCand.fRap[AliV0Result::kLambda] = fTreeVariableRapLambda;
+      lCand.fPDGMass[AliV0Result::kLambda] = 1.115683;
+      lCand.fNegdEdx[AliV0Result::kLambda] = fTreeVariableNSigmasNegPion;
+      lCand.fPosdEdx[AliV0Result::kLambda] = fTreeVariableNSigmasPosProton;
+      lCand.fBaryonMomentum[AliV0Result::kLambda] = fTreeVariablePosInnerP;
+      lCand.fBaryonPt[AliV0Result::kLambda] = lThisPosInnerPt;
+      lCand.fBaryondEdxFromProton[AliV0Result::kLambda] = fTreeVariableNSigmasPosProton;
+      
+      lCand.fMass[AliV0Result::kAntiLambda] = fTreeVariableInvMassAntiLambda;
+      lCand.fRap[AliV0Result::kAntiLambda] = fTreeVariableRapLambda;
+      lCand.fPDGMass[AliV0Result::kAntiLambda] = 1.115683;
+      lCand.fNegdEdx[AliV0Result::kAntiLambda] = fTreeVariableNSigmasNegProton;
+      lCand.fPosdEdx[AliV0Result::kAntiLambda] = fTreeVariableNSigmasPosPion;
+      lCand.fBaryonMomentum[AliV0Result::kAntiLambda] = fTreeVariableNegInnerP;
+      lCand.fBaryonPt[AliV0Result::kAntiLambda] = lThisNegInnerPt;
+      lCand.fBaryondEdxFromProton[AliV0Result::kAntiLambda] = fTreeVariableNSigmasNegProton;
+      
+      FillV0CutTree(0, lCand);
+    }
+    
     //pointers to valid results
     AliV0Result *lPointers[50000];
     Long_t lValidConfigurations=0;
     
-    for( Int_t icfg=0; icfg<fListK0Short->GetEntries(); icfg++ ){
-      lPointers[lValidConfigurations] = (AliV0Result*) fListK0Short->At(icfg);
-      lValidConfigurations++;
-    }
-    for( Int_t icfg=0; icfg<fListLambda->GetEntries(); icfg++ ){
-      lPointers[lValidConfigurations] = (AliV0Result*) fListLambda->At(icfg);
-      lValidConfigurations++;
-    }
-    for( Int_t icfg=0; icfg<fListAntiLambda->GetEntries(); icfg++ ){
-      lPointers[lValidConfigurations] = (AliV0Result*) fListAntiLambda->At(icfg);
-      lValidConfigurations++;
+    if( !fkUseCutTree ){
+      for( Int_t icfg=0; icfg<fListK0Short->GetEntries(); icfg++ ){
+        lPointers[lValidConfigurations] = (AliV0Result*) fListK0Short->At(icfg);
+        lValidConfigurations++;
+      }
+      for( Int_t icfg=0; icfg<fListLambda->GetEntries(); icfg++ ){
+        lPointers[lValidConfigurations] = (AliV0Result*) fListLambda->At(icfg);
+        lValidConfigurations++;
+      }
+      for( Int_t icfg=0; icfg<fListAntiLambda->GetEntries(); icfg++ ){
+        lPointers[lValidConfigurations] = (AliV0Result*) fListAntiLambda->At(icfg);
+        lValidConfigurations++;
+      }
     }
     
     for(Int_t lcfg=0; lcfg<lValidConfigurations; lcfg++){
@@ -3594,26 +3647,87 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
     TH3F *histoout         = 0x0;
     AliCascadeResult *lCascadeResult = 0x0;
     
+    if( fkUseCutTree ){
+      //Candidate properties for each mass hypothesis, then walk the cut tree
+      CascadeCutTreeCandidate lCand;
+      lCand.fLeastNcrOverLength = lLeastNcrOverLength;
+      lCand.fLeastNbrCrossedRows = lLeastNbrCrossedRows;
+      lCand.fITSorTOFsatisfied = lITSorTOFsatisfied;
+      
+      //For parametric V0 Mass selection
+      lCand.fExpV0Mass =
+      fLambdaMassMean[0]+
+      fLambdaMassMean[1]*TMath::Exp(fLambdaMassMean[2]*lV0Pt)+
+      fLambdaMassMean[3]*TMath::Exp(fLambdaMassMean[4]*lV0Pt);
+      
+      lCand.fExpV0Sigma =
+      fLambdaMassSigma[0]+fLambdaMassSigma[1]*lV0Pt+
+      fLambdaMassSigma[2]*TMath::Exp(fLambdaMassSigma[3]*lV0Pt);
+      
+      //For 2.76TeV-like parametric V0 CosPA
+      lCand.f276TeVV0CosPA = 0.998;
+      Float_t pThr=1.5;
+      if (lV0TotMomentum<pThr) {
+        const Double_t bend=0.03; // approximate Xi bending angle
+        const Double_t qt=0.211;  // max Lambda pT in Omega decay
+        const Double_t cpaThr=TMath::Cos(TMath::ATan(qt/pThr) + bend);
+        Double_t
+        cpaCut=(0.998/cpaThr)*TMath::Cos(TMath::ATan(qt/lV0TotMomentum) + bend);
+        lCand.f276TeVV0CosPA = cpaCut;
+      }
+      
+      lCand.fValid[AliCascadeResult::kXiMinus] = lValidXiMinus;
+      lCand.fValid[AliCascadeResult::kXiPlus] = lValidXiPlus;
+      lCand.fValid[AliCascadeResult::kOmegaMinus] = lValidOmegaMinus;
+      lCand.fValid[AliCascadeResult::kOmegaPlus] = lValidOmegaPlus;
+      
+      for( Int_t ihypo=0; ihypo<4; ihypo++ ){
+        Bool_t lIsOmega = ( ihypo == AliCascadeResult::kOmegaMinus || ihypo == AliCascadeResult::kOmegaPlus );
+        Bool_t lIsMinus = ( ihypo == AliCascadeResult::kXiMinus || ihypo == AliCascadeResult::kOmegaMinus );
+        lCand.fCharge[ihypo]   = lIsMinus ? -1 : +1;
+        lCand.fMass[ihypo]     = lIsOmega ? fTreeCascVarMassAsOmega : fTreeCascVarMassAsXi;
+        lCand.fV0Mass[ihypo]   = lIsMinus ? fTreeCascVarV0MassLambda : fTreeCascVarV0MassAntiLambda;
+        lCand.fRap[ihypo]      = lIsOmega ? fTreeCascVarRapOmega : fTreeCascVarRapXi;
+        lCand.fPDGMass[ihypo]  = lIsOmega ? 1.67245 : 1.32171;
+        lCand.fNegdEdx[ihypo]  = lIsMinus ? fTreeCascVarNegNSigmaPion : fTreeCascVarNegNSigmaProton;
+        lCand.fPosdEdx[ihypo]  = lIsMinus ? fTreeCascVarPosNSigmaProton : fTreeCascVarPosNSigmaPion;
+        lCand.fBachdEdx[ihypo] = lIsOmega ? fTreeCascVarBachNSigmaKaon : fTreeCascVarBachNSigmaPion;
+        lCand.fNegTOFsigma[ihypo]  = lIsMinus ? fTreeCascVarNegTOFNSigmaPion : fTreeCascVarNegTOFNSigmaProton;
+        lCand.fPosTOFsigma[ihypo]  = lIsMinus ? fTreeCascVarPosTOFNSigmaProton : fTreeCascVarPosTOFNSigmaPion;
+        lCand.fBachTOFsigma[ihypo] = lIsOmega ? fTreeCascVarBachTOFNSigmaKaon : fTreeCascVarBachTOFNSigmaPion;
+      }
+      lCand.fMLpredNN[AliCascadeResult::kXiMinus]     = fTreeCascVarMLNNPredXiMinus;
+      lCand.fMLpredNN[AliCascadeResult::kXiPlus]      = fTreeCascVarMLNNPredXiPlus;
+      lCand.fMLpredNN[AliCascadeResult::kOmegaMinus]  = fTreeCascVarMLNNPredOmegaMinus;
+      lCand.fMLpredNN[AliCascadeResult::kOmegaPlus]   = fTreeCascVarMLNNPredOmegaPlus;
+      lCand.fMLpredBDT[AliCascadeResult::kXiMinus]    = fTreeCascVarMLBDTPredXiMinus;
+      lCand.fMLpredBDT[AliCascadeResult::kXiPlus]     = fTreeCascVarMLBDTPredXiPlus;
+      lCand.fMLpredBDT[AliCascadeResult::kOmegaMinus] = fTreeCascVarMLBDTPredOmegaMinus;
+      lCand.fMLpredBDT[AliCascadeResult::kOmegaPlus]  = fTreeCascVarMLBDTPredOmegaPlus;
+      
+      FillCascadeCutTree(0, lCand);
+    }
+    
     //pointers to valid results
     AliCascadeResult *lPointers[50000];
     Long_t lValidConfigurations=0;
     
-    if( lValidXiMinus )
+    if( lValidXiMinus && !fkUseCutTree )
       for( Int_t icfg=0; icfg<fListXiMinus->GetEntries(); icfg++ ){
         lPointers[lValidConfigurations] = (AliCascadeResult*) fListXiMinus->At(icfg);
         lValidConfigurations++;
       }
-    if( lValidXiPlus )
+    if( lValidXiPlus && !fkUseCutTree )
       for( Int_t icfg=0; icfg<fListXiPlus->GetEntries(); icfg++ ){
         lPointers[lValidConfigurations] = (AliCascadeResult*) fListXiPlus->At(icfg);
         lValidConfigurations++;
       }
-    if( lValidOmegaMinus )
+    if( lValidOmegaMinus && !fkUseCutTree )
       for( Int_t icfg=0; icfg<fListOmegaMinus->GetEntries(); icfg++ ){
         lPointers[lValidConfigurations] = (AliCascadeResult*) fListOmegaMinus->At(icfg);
         lValidConfigurations++;
       }
-    if( lValidOmegaPlus )
+    if( lValidOmegaPlus && !fkUseCutTree )
       for( Int_t icfg=0; icfg<fListOmegaPlus->GetEntries(); icfg++ ){
         lPointers[lValidConfigurations] = (AliCascadeResult*) fListOmegaPlus->At(icfg);
         lValidConfigurations++;
@@ -3995,6 +4109,9 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
     
   }// end of the Cascade loop (ESD or AOD)
   
+  //Merge the superlight fills of this event into the histograms
+  FlushDeferredHistos();
+  
   // Post output data.
   //Regular Output: Slots 1-8
   PostData(1, fListHist    );
@@ -4012,6 +4129,13 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
   if(fkSaveCascadeTree)  PostData(11, fTreeCascade );
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::FinishTaskOutput()
+{
+  //Fills left over by an event that stopped early
+  FlushDeferredHistos();
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskStrangenessVsMultiplicityRun2::Terminate(Option_t *)
 {
@@ -4115,6 +4239,578 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::AddConfiguration( AliCascadeR
   }
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::BuildCutTrees()
+{
+  //Group the superlight configurations by shared cut values
+  fV0CutTree.clear();
+  fV0CutTree.push_back(CutTreeNode());
+  TList *lV0Lists[3] = {fListK0Short, fListLambda, fListAntiLambda};
+  for( Int_t ilist=0; ilist<3; ilist++ ){
+    if( !lV0Lists[ilist] ) continue;
+    for( Int_t icfg=0; icfg<lV0Lists[ilist]->GetEntries(); icfg++ )
+      AddToCutTree(fV0CutTree, lV0Lists[ilist]->At(icfg), kNV0CutStages, &SameV0CutStage);
+  }
+  
+  fCascadeCutTree.clear();
+  fCascadeCutTree.push_back(CutTreeNode());
+  TList *lCascadeLists[4] = {fListXiMinus, fListXiPlus, fListOmegaMinus, fListOmegaPlus};
+  for( Int_t ilist=0; ilist<4; ilist++ ){
+    if( !lCascadeLists[ilist] ) continue;
+    for( Int_t icfg=0; icfg<lCascadeLists[ilist]->GetEntries(); icfg++ )
+      AddToCutTree(fCascadeCutTree, lCascadeLists[ilist]->At(icfg), kNCascadeCutStages, &SameCascadeCutStage);
+  }
+  
+  fDeferredAxes.clear();
+  fDeferredHistos.clear();
+  BuildDeferredHistos(fV0CutTree);
+  BuildDeferredHistos(fCascadeCutTree);
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::AddToCutTree(std::vector<CutTreeNode> &lTree, TObject *lResult, Int_t lNStages, Bool_t (*lSameStage)(Int_t, const TObject*, const TObject*))
+{
+  //Descend through the nodes sharing the cut values, open a new branch at the first difference
+  Int_t lNode = 0;
+  for( Int_t istage=0; istage<lNStages; istage++ ){
+    Int_t lChild = -1;
+    for( UInt_t ich=0; ich<lTree[lNode].fChildren.size(); ich++ ){
+      Int_t lCandidate = lTree[lNode].fChildren[ich];
+      if( lSameStage(istage, lTree[lCandidate].fRepresentative, lResult) ){
+        lChild = lCandidate;
+        break;
+      }
+    }
+    if( lChild < 0 ){
+      lChild = lTree.size();
+      lTree.push_back(CutTreeNode(istage, lResult));
+      lTree[lNode].fChildren.push_back(lChild);
+    }
+    lNode = lChild;
+  }
+  lTree[lNode].fResults.push_back(lResult);
+}
+
+//________________________________________________________________________
+Bool_t AliAnalysisTaskStrangenessVsMultiplicityRun2::SameV0CutStage(Int_t lStage, const TObject *lFirst, const TObject *lSecond)
+{
+  //True if both configurations use the same cut values in this stage
+  const AliV0Result *a = static_cast<const AliV0Result*>(lFirst);
+  const AliV0Result *b = static_cast<const AliV0Result*>(lSecond);
+  switch( lStage ){
+    case 0: return a->GetMassHypothesis() == b->GetMassHypothesis() && a->GetUseOnTheFly() == b->GetUseOnTheFly();
+    case 1: return a->GetCutMinEtaTracks() == b->GetCutMinEtaTracks() && a->GetCutMaxEtaTracks() == b->GetCutMaxEtaTracks() &&
+      a->GetCutMinRapidity() == b->GetCutMinRapidity() && a->GetCutMaxRapidity() == b->GetCutMaxRapidity();
+    case 2: return a->GetCutV0Radius() == b->GetCutV0Radius() && a->GetCutMaxV0Radius() == b->GetCutMaxV0Radius();
+    case 3: return a->GetCutDCANegToPV() == b->GetCutDCANegToPV();
+    case 4: return a->GetCutDCAPosToPV() == b->GetCutDCAPosToPV();
+    case 5: return a->GetCutDCAV0Daughters() == b->GetCutDCAV0Daughters();
+    case 6: return a->GetCutV0CosPA() == b->GetCutV0CosPA() && a->GetCutUseVarV0CosPA() == b->GetCutUseVarV0CosPA() &&
+      a->GetCutVarV0CosPAExp0Const() == b->GetCutVarV0CosPAExp0Const() && a->GetCutVarV0CosPAExp0Slope() == b->GetCutVarV0CosPAExp0Slope() &&
+      a->GetCutVarV0CosPAExp1Const() == b->GetCutVarV0CosPAExp1Const() && a->GetCutVarV0CosPAExp1Slope() == b->GetCutVarV0CosPAExp1Slope() &&
+      a->GetCutVarV0CosPAConst() == b->GetCutVarV0CosPAConst();
+    case 7: return a->GetCutProperLifetime() == b->GetCutProperLifetime();
+    case 8: return a->GetCutLeastNumberOfCrossedRows() == b->GetCutLeastNumberOfCrossedRows();
+    case 9: return a->GetCutLeastNumberOfCrossedRowsOverFindable() == b->GetCutLeastNumberOfCrossedRowsOverFindable();
+    case 10: return a->GetCutMinBaryonMomentum() == b->GetCutMinBaryonMomentum();
+    case 11: return a->GetCutTPCdEdx() == b->GetCutTPCdEdx();
+    case 12: return a->GetCutArmenteros() == b->GetCutArmenteros() && a->GetCutArmenterosParameter() == b->GetCutArmenterosParameter();
+    case 13: return a->GetCutUseITSRefitTracks() == b->GetCutUseITSRefitTracks();
+    case 14: return a->GetCutMaxChi2PerCluster() == b->GetCutMaxChi2PerCluster();
+    case 15: return a->GetCutMinTrackLength() == b->GetCutMinTrackLength() && a->GetCutUseParametricLength() == b->GetCutUseParametricLength();
+    case 16: return a->GetCut276TeVLikedEdx() == b->GetCut276TeVLikedEdx();
+    case 17: return a->GetCutAtLeastOneTOF() == b->GetCutAtLeastOneTOF();
+    case 18: return a->GetCutIsCowboy() == b->GetCutIsCowboy();
+    case 19: return a->GetCutMinCrossedRowsOverLength() == b->GetCutMinCrossedRowsOverLength();
+    case 20: return a->GetCutITSorTOF() == b->GetCutITSorTOF();
+  }
+  return kFALSE;
+}
+
+//________________________________________________________________________
+Bool_t AliAnalysisTaskStrangenessVsMultiplicityRun2::PassesV0CutStage(Int_t lStage, const AliV0Result *lV0Result, const V0CutTreeCandidate &lCand) const
+{
+  //Same checks as in the configuration loop of UserExec, split in stages
+  const Int_t lHypo = lV0Result->GetMassHypothesis();
+  switch( lStage ){
+    case 0: //Check 1: Offline Vertexer
+      return lCand.fOnFlyStatus == lV0Result->GetUseOnTheFly();
+    case 1: //Check 2: Basic Acceptance cuts
+      return lV0Result->GetCutMinEtaTracks() < fTreeVariableNegEta && fTreeVariableNegEta < lV0Result->GetCutMaxEtaTracks() &&
+      lV0Result->GetCutMinEtaTracks() < fTreeVariablePosEta && fTreeVariablePosEta < lV0Result->GetCutMaxEtaTracks() &&
+      lCand.fRap[lHypo] > lV0Result->GetCutMinRapidity() &&
+      lCand.fRap[lHypo] < lV0Result->GetCutMaxRapidity();
+    case 2: //Check 3: Topological Variables
+      return fTreeVariableV0Radius > lV0Result->GetCutV0Radius() &&
+      fTreeVariableV0Radius < lV0Result->GetCutMaxV0Radius();
+    case 3:
+      return fTreeVariableDcaNegToPrimVertex > lV0Result->GetCutDCANegToPV();
+    case 4:
+      return fTreeVariableDcaPosToPrimVertex > lV0Result->GetCutDCAPosToPV();
+    case 5:
+      return fTreeVariableDcaV0Daughters < lV0Result->GetCutDCAV0Daughters();
+    case 6: {
+      //Variable V0 CosPA
+      Float_t lV0CosPACut = lV0Result -> GetCutV0CosPA();
+      if( lV0Result->GetCutUseVarV0CosPA() ){
+        Float_t lVarV0CosPApar[5];
+        lVarV0CosPApar[0] = lV0Result->GetCutVarV0CosPAExp0Const();
+        lVarV0CosPApar[1] = lV0Result->GetCutVarV0CosPAExp0Slope();
+        lVarV0CosPApar[2] = lV0Result->GetCutVarV0CosPAExp1Const();
+        lVarV0CosPApar[3] = lV0Result->GetCutVarV0CosPAExp1Slope();
+        lVarV0CosPApar[4] = lV0Result->GetCutVarV0CosPAConst();
+        Float_t lVarV0CosPA = TMath::Cos(
+                                         lVarV0CosPApar[0]*TMath::Exp(lVarV0CosPApar[1]*fTreeVariablePt) +
+                                         lVarV0CosPApar[2]*TMath::Exp(lVarV0CosPApar[3]*fTreeVariablePt) +
+                                         lVarV0CosPApar[4]);
+        //Only use if tighter than the non-variable cut
+        if( lVarV0CosPA > lV0CosPACut ) lV0CosPACut = lVarV0CosPA;
+      }
+      return fTreeVariableV0CosineOfPointingAngle > lV0CosPACut;
+    }
+    case 7:
+      return fTreeVariableDistOverTotMom*lCand.fPDGMass[lHypo] < lV0Result->GetCutProperLifetime();
+    case 8:
+      return fTreeVariableLeastNbrCrossedRows > lV0Result->GetCutLeastNumberOfCrossedRows();
+    case 9:
+      return fTreeVariableLeastRatioCrossedRowsOverFindable > lV0Result->GetCutLeastNumberOfCrossedRowsOverFindable();
+    case 10: //Check 4: Minimum momentum of baryon daughter
+      return ( lHypo == AliV0Result::kK0Short || lCand.fBaryonMomentum[lHypo] > lV0Result->GetCutMinBaryonMomentum() );
+    case 11: //Check 5: TPC dEdx selections
+      return TMath::Abs(lCand.fNegdEdx[lHypo])<lV0Result->GetCutTPCdEdx() &&
+      TMath::Abs(lCand.fPosdEdx[lHypo])<lV0Result->GetCutTPCdEdx();
+    case 12: //Check 6: Armenteros-Podolanski space cut (for K0Short analysis)
+      return ( ( lV0Result->GetCutArmenteros() == kFALSE || lHypo != AliV0Result::kK0Short ) || ( fTreeVariablePtArmV0>lV0Result->GetCutArmenterosParameter()*TMath::Abs(fTreeVariableAlphaV0) ) );
+    case 13: //Check 7: kITSrefit track selection if requested
+      return ( (fTreeVariableNegTrackStatus & AliESDtrack::kITSrefit) &&
+              (fTreeVariablePosTrackStatus & AliESDtrack::kITSrefit) ) ||
+      !lV0Result->GetCutUseITSRefitTracks();
+    case 14: //Check 8: Max Chi2/Clusters if not absurd
+      return lV0Result->GetCutMaxChi2PerCluster()>1e+3 ||
+      (fTreeVariableMaxChi2PerCluster < lV0Result->GetCutMaxChi2PerCluster());
+    case 15: //Check 9: Min Track Length if positive
+      return lV0Result->GetCutMinTrackLength()<0 ||
+      (fTreeVariableMinTrackLength > lV0Result->GetCutMinTrackLength()&& !lV0Result->GetCutUseParametricLength()) ||
+      (fTreeVariableMinTrackLength > lV0Result->GetCutMinTrackLength()
+       - (TMath::Power(1/(fTreeVariablePt+1e-6),1.5))
+       - TMath::Max(fTreeVariableV0Radius-85., 0.)
+       && lV0Result->GetCutUseParametricLength());
+    case 16: //Check 10: Special 2.76TeV-like dedx
+      return !lV0Result->GetCut276TeVLikedEdx() ||
+      ( lHypo == AliV0Result::kK0Short ||
+       ( lCand.fBaryonPt[lHypo] > 1.0 || TMath::Abs(lCand.fBaryondEdxFromProton[lHypo])<3.0 ) );
+    case 17: //Check 14: has at least one track with some TOF info
+      return lV0Result->GetCutAtLeastOneTOF() == kFALSE ||
+      ( TMath::Abs(fTreeVariableNegTOFSignal) < 100 ||
+       TMath::Abs(fTreeVariablePosTOFSignal) < 100 );
+    case 18: //Check 15: cowboy/sailor for V0
+      return lV0Result->GetCutIsCowboy()==0 ||
+      (lV0Result->GetCutIsCowboy()== 1 && fTreeVariableIsCowboy==kTRUE ) ||
+      (lV0Result->GetCutIsCowboy()==-1 && fTreeVariableIsCowboy==kFALSE);
+    case 19: //Check 16: modern track quality selections
+      return lV0Result->GetCutMinCrossedRowsOverLength()<0 ||
+      (lCand.fLeastNcrOverLength>lV0Result->GetCutMinCrossedRowsOverLength());
+    case 20: //Check 17: ITS or TOF required
+      return lV0Result->GetCutITSorTOF()==kFALSE || lCand.fITSorTOFsatisfied==kTRUE;
+  }
+  return kFALSE;
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::FillV0CutTree(Int_t lNode, const V0CutTreeCandidate &lCand)
+{
+  //Evaluate each child once, descend only into passing ones, fill the leaf configurations
+  for( UInt_t ich=0; ich<fV0CutTree[lNode].fChildren.size(); ich++ ){
+    Int_t lChild = fV0CutTree[lNode].fChildren[ich];
+    const CutTreeNode &lChildNode = fV0CutTree[lChild];
+    const AliV0Result *lV0Result = static_cast<const AliV0Result*>(lChildNode.fRepresentative);
+    if( !PassesV0CutStage(lChildNode.fStage, lV0Result, lCand) ) continue;
+    if( lChildNode.fStage < kNV0CutStages-1 ){
+      FillV0CutTree(lChild, lCand);
+      continue;
+    }
+    Float_t lMass = lCand.fMass[lV0Result->GetMassHypothesis()];
+    for( UInt_t ires=0; ires<lChildNode.fResults.size(); ires++ )
+      FillDeferred( lChildNode.fDeferred[ires], fCentrality, fTreeVariablePt, lMass );
+  }
+}
+
+//________________________________________________________________________
+Bool_t AliAnalysisTaskStrangenessVsMultiplicityRun2::SameCascadeCutStage(Int_t lStage, const TObject *lFirst, const TObject *lSecond)
+{
+  //True if both configurations use the same cut values in this stage
+  const AliCascadeResult *a = static_cast<const AliCascadeResult*>(lFirst);
+  const AliCascadeResult *b = static_cast<const AliCascadeResult*>(lSecond);
+  switch( lStage ){
+    case 0: return a->GetMassHypothesis() == b->GetMassHypothesis() && a->GetSwapBachelorCharge() == b->GetSwapBachelorCharge();
+    case 1: return a->GetCutMinEtaTracks() == b->GetCutMinEtaTracks() && a->GetCutMaxEtaTracks() == b->GetCutMaxEtaTracks() &&
+      a->GetCutMinRapidity() == b->GetCutMinRapidity() && a->GetCutMaxRapidity() == b->GetCutMaxRapidity();
+    case 2: return a->GetCutDCANegToPV() == b->GetCutDCANegToPV();
+    case 3: return a->GetCutDCAPosToPV() == b->GetCutDCAPosToPV();
+    case 4: return a->GetCutDCAV0Daughters() == b->GetCutDCAV0Daughters();
+    case 5: return a->GetCutV0CosPA() == b->GetCutV0CosPA() && a->GetCutUseVarV0CosPA() == b->GetCutUseVarV0CosPA() &&
+      a->GetCutVarV0CosPAExp0Const() == b->GetCutVarV0CosPAExp0Const() && a->GetCutVarV0CosPAExp0Slope() == b->GetCutVarV0CosPAExp0Slope() &&
+      a->GetCutVarV0CosPAExp1Const() == b->GetCutVarV0CosPAExp1Const() && a->GetCutVarV0CosPAExp1Slope() == b->GetCutVarV0CosPAExp1Slope() &&
+      a->GetCutVarV0CosPAConst() == b->GetCutVarV0CosPAConst();
+    case 6: return a->GetCutV0Radius() == b->GetCutV0Radius();
+    case 7: return a->GetCutDCAV0ToPV() == b->GetCutDCAV0ToPV();
+    case 8: return a->GetCutV0Mass() == b->GetCutV0Mass();
+    case 9: return a->GetCutDCABachToPV() == b->GetCutDCABachToPV();
+    case 10: return a->GetCutDCACascDaughters() == b->GetCutDCACascDaughters() && a->GetCutUseVarDCACascDau() == b->GetCutUseVarDCACascDau() &&
+      a->GetCutVarDCACascDauExp0Const() == b->GetCutVarDCACascDauExp0Const() && a->GetCutVarDCACascDauExp0Slope() == b->GetCutVarDCACascDauExp0Slope() &&
+      a->GetCutVarDCACascDauExp1Const() == b->GetCutVarDCACascDauExp1Const() && a->GetCutVarDCACascDauExp1Slope() == b->GetCutVarDCACascDauExp1Slope() &&
+      a->GetCutVarDCACascDauConst() == b->GetCutVarDCACascDauConst();
+    case 11: return a->GetCutCascCosPA() == b->GetCutCascCosPA() && a->GetCutUseVarCascCosPA() == b->GetCutUseVarCascCosPA() &&
+      a->GetCutVarCascCosPAExp0Const() == b->GetCutVarCascCosPAExp0Const() && a->GetCutVarCascCosPAExp0Slope() == b->GetCutVarCascCosPAExp0Slope() &&
+      a->GetCutVarCascCosPAExp1Const() == b->GetCutVarCascCosPAExp1Const() && a->GetCutVarCascCosPAExp1Slope() == b->GetCutVarCascCosPAExp1Slope() &&
+      a->GetCutVarCascCosPAConst() == b->GetCutVarCascCosPAConst();
+    case 12: return a->GetCutCascRadius() == b->GetCutCascRadius();
+    case 13: return a->GetCutV0MassSigma() == b->GetCutV0MassSigma();
+    case 14: return a->GetCutProperLifetime() == b->GetCutProperLifetime();
+    case 15: return a->GetCutLeastNumberOfClusters() == b->GetCutLeastNumberOfClusters();
+    case 16: return a->GetCutTPCdEdx() == b->GetCutTPCdEdx();
+    case 17: return a->GetCutUseTOFUnchecked() == b->GetCutUseTOFUnchecked();
+    case 18: return a->GetCutXiRejection() == b->GetCutXiRejection();
+    case 19: return a->GetCutDCABachToBaryon() == b->GetCutDCABachToBaryon();
+    case 20: return a->GetCutBachBaryonCosPA() == b->GetCutBachBaryonCosPA() && a->GetCutUseVarBBCosPA() == b->GetCutUseVarBBCosPA() &&
+      a->GetCutVarBBCosPAExp0Const() == b->GetCutVarBBCosPAExp0Const() && a->GetCutVarBBCosPAExp0Slope() == b->GetCutVarBBCosPAExp0Slope() &&
+      a->GetCutVarBBCosPAExp1Const() == b->GetCutVarBBCosPAExp1Const() && a->GetCutVarBBCosPAExp1Slope() == b->GetCutVarBBCosPAExp1Slope() &&
+      a->GetCutVarBBCosPAConst() == b->GetCutVarBBCosPAConst();
+    case 21: return a->GetCutMinV0Lifetime() == b->GetCutMinV0Lifetime() && a->GetCutMaxV0Lifetime() == b->GetCutMaxV0Lifetime();
+    case 22: return a->GetCutUseITSRefitTracks() == b->GetCutUseITSRefitTracks();
+    case 23: return a->GetCutMaxChi2PerCluster() == b->GetCutMaxChi2PerCluster();
+    case 24: return a->GetCutMinTrackLength() == b->GetCutMinTrackLength() && a->GetCutUseParametricLength() == b->GetCutUseParametricLength();
+    case 25: return a->GetCutUse276TeVV0CosPA() == b->GetCutUse276TeVV0CosPA();
+    case 26: return a->GetCutDCACascadeToPV() == b->GetCutDCACascadeToPV();
+    case 27: return a->GetCutAtLeastOneTOF() == b->GetCutAtLeastOneTOF();
+    case 28: return a->GetCutUseITSRefitNegative() == b->GetCutUseITSRefitNegative() &&
+      a->GetCutUseITSRefitPositive() == b->GetCutUseITSRefitPositive() &&
+      a->GetCutUseITSRefitBachelor() == b->GetCutUseITSRefitBachelor();
+    case 29: return a->GetCutIsCowboy() == b->GetCutIsCowboy();
+    case 30: return a->GetCutIsCascadeCowboy() == b->GetCutIsCascadeCowboy();
+    case 31: return a->GetCutMinCrossedRowsOverLength() == b->GetCutMinCrossedRowsOverLength();
+    case 32: return a->GetCutLeastNumberOfCrossedRows() == b->GetCutLeastNumberOfCrossedRows();
+    case 33: return a->GetCutITSorTOF() == b->GetCutITSorTOF();
+    case 34: return a->GetIsModelNN() == b->GetIsModelNN() && a->GetCutMLthrsh() == b->GetCutMLthrsh();
+  }
+  return kFALSE;
+}
+
+//________________________________________________________________________
+Bool_t AliAnalysisTaskStrangenessVsMultiplicityRun2::PassesCascadeCutStage(Int_t lStage, const AliCascadeResult *lCascadeResult, const CascadeCutTreeCandidate &lCand) const
+{
+  //Same checks as in the configuration loop of UserExec, split in stages
+  const Int_t lHypo = lCascadeResult->GetMassHypothesis();
+  switch( lStage ){
+    case 0: { //Check 1: Charge consistent with expectations
+      Short_t lCharge = lCand.fCharge[lHypo];
+      if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
+      return lCand.fValid[lHypo] && fTreeCascVarCharge == lCharge;
+    }
+    case 1: //Check 2: Basic Acceptance cuts
+      return lCascadeResult->GetCutMinEtaTracks() < fTreeCascVarPosEta && fTreeCascVarPosEta < lCascadeResult->GetCutMaxEtaTracks() &&
+      lCascadeResult->GetCutMinEtaTracks() < fTreeCascVarNegEta && fTreeCascVarNegEta < lCascadeResult->GetCutMaxEtaTracks() &&
+      lCascadeResult->GetCutMinEtaTracks() < fTreeCascVarBachEta && fTreeCascVarBachEta < lCascadeResult->GetCutMaxEtaTracks() &&
+      lCand.fRap[lHypo] > lCascadeResult->GetCutMinRapidity() &&
+      lCand.fRap[lHypo] < lCascadeResult->GetCutMaxRapidity();
+    case 2: //Check 3: Topological Variables, V0 selections
+      return fTreeCascVarDCANegToPrimVtx > lCascadeResult->GetCutDCANegToPV();
+    case 3:
+      return fTreeCascVarDCAPosToPrimVtx > lCascadeResult->GetCutDCAPosToPV();
+    case 4:
+      return fTreeCascVarDCAV0Daughters < lCascadeResult->GetCutDCAV0Daughters();
+    case 5: {
+      //Variable V0 CosPA
+      Float_t lV0CosPACut = lCascadeResult -> GetCutV0CosPA();
+      if( lCascadeResult->GetCutUseVarV0CosPA() ){
+        Float_t lVarV0CosPApar[5];
+        lVarV0CosPApar[0] = lCascadeResult->GetCutVarV0CosPAExp0Const();
+        lVarV0CosPApar[1] = lCascadeResult->GetCutVarV0CosPAExp0Slope();
+        lVarV0CosPApar[2] = lCascadeResult->GetCutVarV0CosPAExp1Const();
+        lVarV0CosPApar[3] = lCascadeResult->GetCutVarV0CosPAExp1Slope();
+        lVarV0CosPApar[4] = lCascadeResult->GetCutVarV0CosPAConst();
+        Float_t lVarV0CosPA = TMath::Cos(
+                                         lVarV0CosPApar[0]*TMath::Exp(lVarV0CosPApar[1]*fTreeCascVarPt) +
+                                         lVarV0CosPApar[2]*TMath::Exp(lVarV0CosPApar[3]*fTreeCascVarPt) +
+                                         lVarV0CosPApar[4]);
+        //Only use if tighter than the non-variable cut
+        if( lVarV0CosPA > lV0CosPACut ) lV0CosPACut = lVarV0CosPA;
+      }
+      return fTreeCascVarV0CosPointingAngle > lV0CosPACut;
+    }
+    case 6:
+      return fTreeCascVarV0Radius > lCascadeResult->GetCutV0Radius();
+    case 7: //Cascade selections
+      return fTreeCascVarDCAV0ToPrimVtx > lCascadeResult->GetCutDCAV0ToPV();
+    case 8:
+      return TMath::Abs(lCand.fV0Mass[lHypo]-1.116) < lCascadeResult->GetCutV0Mass();
+    case 9:
+      return fTreeCascVarDCABachToPrimVtx > lCascadeResult->GetCutDCABachToPV();
+    case 10: {
+      //Variable DCA Casc Dau
+      Float_t lDCACascDauCut = lCascadeResult -> GetCutDCACascDaughters();
+      if( lCascadeResult->GetCutUseVarDCACascDau() ){
+        Float_t lVarDCACascDaupar[5];
+        lVarDCACascDaupar[0] = lCascadeResult->GetCutVarDCACascDauExp0Const();
+        lVarDCACascDaupar[1] = lCascadeResult->GetCutVarDCACascDauExp0Slope();
+        lVarDCACascDaupar[2] = lCascadeResult->GetCutVarDCACascDauExp1Const();
+        lVarDCACascDaupar[3] = lCascadeResult->GetCutVarDCACascDauExp1Slope();
+        lVarDCACascDaupar[4] = lCascadeResult->GetCutVarDCACascDauConst();
+        Float_t lVarDCACascDau = lVarDCACascDaupar[0]*TMath::Exp(lVarDCACascDaupar[1]*fTreeCascVarPt) +
+        lVarDCACascDaupar[2]*TMath::Exp(lVarDCACascDaupar[3]*fTreeCascVarPt) +
+        lVarDCACascDaupar[4];
+        //Loosest: default cut, parametric can go tighter
+        if( lVarDCACascDau < lDCACascDauCut ) lDCACascDauCut = lVarDCACascDau;
+      }
+      return fTreeCascVarDCACascDaughters < lDCACascDauCut;
+    }
+    case 11: {
+      //Variable Cascade CosPA
+      Float_t lCascCosPACut = lCascadeResult -> GetCutCascCosPA();
+      if( lCascadeResult->GetCutUseVarCascCosPA() ){
+        Float_t lVarCascCosPApar[5];
+        lVarCascCosPApar[0] = lCascadeResult->GetCutVarCascCosPAExp0Const();
+        lVarCascCosPApar[1] = lCascadeResult->GetCutVarCascCosPAExp0Slope();
+        lVarCascCosPApar[2] = lCascadeResult->GetCutVarCascCosPAExp1Const();
+        lVarCascCosPApar[3] = lCascadeResult->GetCutVarCascCosPAExp1Slope();
+        lVarCascCosPApar[4] = lCascadeResult->GetCutVarCascCosPAConst();
+        Float_t lVarCascCosPA = TMath::Cos(
+                                           lVarCascCosPApar[0]*TMath::Exp(lVarCascCosPApar[1]*fTreeCascVarPt) +
+                                           lVarCascCosPApar[2]*TMath::Exp(lVarCascCosPApar[3]*fTreeCascVarPt) +
+                                           lVarCascCosPApar[4]);
+        //Only use if tighter than the non-variable cut
+        if( lVarCascCosPA > lCascCosPACut ) lCascCosPACut = lVarCascCosPA;
+      }
+      return fTreeCascVarCascCosPointingAngle > lCascCosPACut;
+    }
+    case 12:
+      return fTreeCascVarCascRadius > lCascadeResult->GetCutCascRadius();
+    case 13: //Parametric V0 Mass cut if requested
+      return ( lCascadeResult->GetCutV0MassSigma() > 50 ) ||
+      (TMath::Abs( (lCand.fV0Mass[lHypo]-lCand.fExpV0Mass) / lCand.fExpV0Sigma ) < lCascadeResult->GetCutV0MassSigma() );
+    case 14: //Miscellaneous
+      return fTreeCascVarDistOverTotMom*lCand.fPDGMass[lHypo] < lCascadeResult->GetCutProperLifetime();
+    case 15:
+      return fTreeCascVarLeastNbrClusters > lCascadeResult->GetCutLeastNumberOfClusters();
+    case 16: //Check 4: TPC dEdx selections
+      return TMath::Abs(lCand.fNegdEdx[lHypo] )<lCascadeResult->GetCutTPCdEdx() &&
+      TMath::Abs(lCand.fPosdEdx[lHypo] )<lCascadeResult->GetCutTPCdEdx() &&
+      TMath::Abs(lCand.fBachdEdx[lHypo])<lCascadeResult->GetCutTPCdEdx();
+    case 17: //Check 4bis: TOF selections (experimental), always pass if unchecked TOF is not used
+      return lCascadeResult->GetCutUseTOFUnchecked() == kFALSE ||
+      ( TMath::Abs(lCand.fNegTOFsigma[lHypo] )< 4 &&
+       TMath::Abs(lCand.fPosTOFsigma[lHypo] )< 4 &&
+       TMath::Abs(lCand.fBachTOFsigma[lHypo])< 4 );
+    case 18: //Check 5: Xi rejection for Omega analysis
+      return ( lHypo != AliCascadeResult::kOmegaMinus && lHypo != AliCascadeResult::kOmegaPlus ) ||
+      ( TMath::Abs( fTreeCascVarMassAsXi - 1.32171 ) > lCascadeResult->GetCutXiRejection() );
+    case 19: //Check 6: Experimental DCA Bachelor to Baryon cut
+      return fTreeCascVarDCABachToBaryon > lCascadeResult->GetCutDCABachToBaryon();
+    case 20: {
+      //Check 7: Experimental Bach Baryon CosPA
+      Float_t lBBCosPACut = lCascadeResult -> GetCutBachBaryonCosPA();
+      if( lCascadeResult->GetCutUseVarBBCosPA() ){
+        Float_t lVarBBCosPApar[5];
+        lVarBBCosPApar[0] = lCascadeResult->GetCutVarBBCosPAExp0Const();
+        lVarBBCosPApar[1] = lCascadeResult->GetCutVarBBCosPAExp0Slope();
+        lVarBBCosPApar[2] = lCascadeResult->GetCutVarBBCosPAExp1Const();
+        lVarBBCosPApar[3] = lCascadeResult->GetCutVarBBCosPAExp1Slope();
+        lVarBBCosPApar[4] = lCascadeResult->GetCutVarBBCosPAConst();
+        Float_t lVarBBCosPA = TMath::Cos(
+                                         lVarBBCosPApar[0]*TMath::Exp(lVarBBCosPApar[1]*fTreeCascVarPt) +
+                                         lVarBBCosPApar[2]*TMath::Exp(lVarBBCosPApar[3]*fTreeCascVarPt) +
+                                         lVarBBCosPApar[4]);
+        //Only use if looser than the non-variable cut (WARNING: BEWARE INVERSE LOGIC)
+        if( lVarBBCosPA > lBBCosPACut ) lBBCosPACut = lVarBBCosPA;
+      }
+      return fTreeCascVarWrongCosPA < lBBCosPACut;
+    }
+    case 21: //Check 8: Min/Max V0 Lifetime cut
+      return ( fTreeCascVarV0Lifetime > lCascadeResult->GetCutMinV0Lifetime() ) &&
+      ( fTreeCascVarV0Lifetime < lCascadeResult->GetCutMaxV0Lifetime() ||
+       lCascadeResult->GetCutMaxV0Lifetime() > 1e+3 );
+    case 22: //Check 9: kITSrefit track selection if requested
+      return ( (fTreeCascVarPosTrackStatus & AliESDtrack::kITSrefit) &&
+              (fTreeCascVarNegTrackStatus & AliESDtrack::kITSrefit) &&
+              (fTreeCascVarBachTrackStatus & AliESDtrack::kITSrefit) ) ||
+      !lCascadeResult->GetCutUseITSRefitTracks();
+    case 23: //Check 10: Max Chi2/Clusters if not absurd
+      return lCascadeResult->GetCutMaxChi2PerCluster()>1e+3 ||
+      (fTreeCascVarMaxChi2PerCluster < lCascadeResult->GetCutMaxChi2PerCluster());
+    case 24: //Check 11: Min Track Length if positive, [min - (1/pt)^1.5] if parametric requested
+      return lCascadeResult->GetCutMinTrackLength()<0 ||
+      (fTreeCascVarMinTrackLength > lCascadeResult->GetCutMinTrackLength() && !lCascadeResult->GetCutUseParametricLength())||
+      (fTreeCascVarMinTrackLength > lCascadeResult->GetCutMinTrackLength()
+       - (TMath::Power(1/(fTreeCascVarPt+1e-6),1.5))
+       - TMath::Max(fTreeCascVarV0Radius-85., 0.)
+       && lCascadeResult->GetCutUseParametricLength());
+    case 25: //Check 12: Check if special V0 CosPA cut used
+      return lCascadeResult->GetCutUse276TeVV0CosPA()==kFALSE ||
+      fTreeCascVarV0CosPointingAngle>lCand.f276TeVV0CosPA;
+    case 26: //Check 13: 3D Cascade DCA to PV
+      return lCascadeResult->GetCutDCACascadeToPV() > 999 ||
+      (TMath::Sqrt(fTreeCascVarCascDCAtoPVz*fTreeCascVarCascDCAtoPVz + fTreeCascVarCascDCAtoPVxy*fTreeCascVarCascDCAtoPVxy)<lCascadeResult->GetCutDCACascadeToPV() );
+    case 27: //Check 14: has at least one track with some TOF info
+      return lCascadeResult->GetCutAtLeastOneTOF() == kFALSE ||
+      ( TMath::Abs(fTreeCascVarNegTOFSignal) < 100 ||
+       TMath::Abs(fTreeCascVarPosTOFSignal) < 100 ||
+       TMath::Abs(fTreeCascVarBachTOFSignal) < 100 );
+    case 28: //Check 15: check each prong for ITS refit
+      return ( lCascadeResult->GetCutUseITSRefitNegative()==kFALSE || fTreeCascVarNegTrackStatus & AliESDtrack::kITSrefit ) &&
+      ( lCascadeResult->GetCutUseITSRefitPositive()==kFALSE || fTreeCascVarPosTrackStatus & AliESDtrack::kITSrefit ) &&
+      ( lCascadeResult->GetCutUseITSRefitBachelor()==kFALSE || fTreeCascVarBachTrackStatus & AliESDtrack::kITSrefit );
+    case 29: //Check 16: cowboy/sailor for V0
+      return lCascadeResult->GetCutIsCowboy()==0 ||
+      (lCascadeResult->GetCutIsCowboy()== 1 && fTreeCascVarIsCowboy==kTRUE ) ||
+      (lCascadeResult->GetCutIsCowboy()==-1 && fTreeCascVarIsCowboy==kFALSE);
+    case 30: //Check 17: cowboy/sailor for cascade
+      return lCascadeResult->GetCutIsCascadeCowboy()==0 ||
+      (lCascadeResult->GetCutIsCascadeCowboy()== 1 && fTreeCascVarIsCascadeCowboy==kTRUE ) ||
+      (lCascadeResult->GetCutIsCascadeCowboy()==-1 && fTreeCascVarIsCascadeCowboy==kFALSE);
+    case 31: //Check 18: modern track quality selections
+      return lCascadeResult->GetCutMinCrossedRowsOverLength()<0 ||
+      (lCand.fLeastNcrOverLength>lCascadeResult->GetCutMinCrossedRowsOverLength());
+    case 32: //Check 19: modern track quality selections
+      return lCascadeResult->GetCutLeastNumberOfCrossedRows()<0 ||
+      (lCand.fLeastNbrCrossedRows>lCascadeResult->GetCutLeastNumberOfCrossedRows());
+    case 33: //Check 20: ITS or TOF required
+      return lCascadeResult->GetCutITSorTOF()==kFALSE || lCand.fITSorTOFsatisfied==kTRUE;
+    case 34: { //Check 21: ML threshold selection
+      Double_t lMLpred = lCascadeResult->GetIsModelNN() ? lCand.fMLpredNN[lHypo] : lCand.fMLpredBDT[lHypo];
+      return lMLpred > lCascadeResult->GetCutMLthrsh();
+    }
+  }
+  return kFALSE;
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::FillCascadeCutTree(Int_t lNode, const CascadeCutTreeCandidate &lCand)
+{
+  //Evaluate each child once, descend only into passing ones, fill the leaf configurations
+  for( UInt_t ich=0; ich<fCascadeCutTree[lNode].fChildren.size(); ich++ ){
+    Int_t lChild = fCascadeCutTree[lNode].fChildren[ich];
+    const CutTreeNode &lChildNode = fCascadeCutTree[lChild];
+    const AliCascadeResult *lCascadeResult = static_cast<const AliCascadeResult*>(lChildNode.fRepresentative);
+    if( !PassesCascadeCutStage(lChildNode.fStage, lCascadeResult, lCand) ) continue;
+    if( lChildNode.fStage < kNCascadeCutStages-1 ){
+      FillCascadeCutTree(lChild, lCand);
+      continue;
+    }
+    Float_t lMass = lCand.fMass[lCascadeResult->GetMassHypothesis()];
+    for( UInt_t ires=0; ires<lChildNode.fResults.size(); ires++ ){
+      AliCascadeResult *lResult = static_cast<AliCascadeResult*>(lChildNode.fResults[ires]);
+      if( fkSaveSpecificConfig && fkConfigToSave.EqualTo( lResult->GetName() ) ) fTreeCascade->Fill();
+      FillDeferred( lChildNode.fDeferred[ires], fCentrality, fTreeCascVarPt, lMass );
+    }
+  }
+}
+
+//________________________________________________________________________
+Bool_t AliAnalysisTaskStrangenessVsMultiplicityRun2::SameAxis(const TAxis *lFirst, const TAxis *lSecond)
+{
+  //True if both axes have the same bin edges
+  if( lFirst->GetNbins() != lSecond->GetNbins() ) return kFALSE;
+  if( lFirst->GetXmin() != lSecond->GetXmin() || lFirst->GetXmax() != lSecond->GetXmax() ) return kFALSE;
+  const TArrayD *lFirstBins = lFirst->GetXbins();
+  const TArrayD *lSecondBins = lSecond->GetXbins();
+  if( lFirstBins->GetSize() != lSecondBins->GetSize() ) return kFALSE;
+  for( Int_t ibin=0; ibin<lFirstBins->GetSize(); ibin++ )
+    if( lFirstBins->At(ibin) != lSecondBins->At(ibin) ) return kFALSE;
+  return kTRUE;
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::BuildDeferredHistos(std::vector<CutTreeNode> &lTree)
+{
+  //Assign a deferred histogram to each leaf configuration, sharing axes where possible
+  for( UInt_t inode=0; inode<lTree.size(); inode++ ){
+    CutTreeNode &lNode = lTree[inode];
+    lNode.fDeferred.clear();
+    for( UInt_t ires=0; ires<lNode.fResults.size(); ires++ ){
+      TH3F *lHisto = 0x0;
+      if( lNode.fResults[ires]->InheritsFrom(AliV0Result::Class()) )
+        lHisto = static_cast<AliV0Result*>(lNode.fResults[ires])->GetHistogram();
+      else
+        lHisto = static_cast<AliCascadeResult*>(lNode.fResults[ires])->GetHistogram();
+      
+      Int_t lAxes = -1;
+      for( UInt_t iaxes=0; iaxes<fDeferredAxes.size() && lAxes<0; iaxes++ ){
+        TH3F *lReference = fDeferredAxes[iaxes].fReference;
+        if( SameAxis(lReference->GetXaxis(), lHisto->GetXaxis()) &&
+           SameAxis(lReference->GetYaxis(), lHisto->GetYaxis()) &&
+           SameAxis(lReference->GetZaxis(), lHisto->GetZaxis()) ) lAxes = iaxes;
+      }
+      if( lAxes < 0 ){
+        lAxes = fDeferredAxes.size();
+        fDeferredAxes.push_back(DeferredAxes(lHisto));
+      }
+      lNode.fDeferred.push_back(fDeferredHistos.size());
+      fDeferredHistos.push_back(DeferredHisto(lHisto, lAxes));
+    }
+  }
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::FillDeferred(Int_t lDeferred, Double_t x, Double_t y, Double_t z)
+{
+  //Equivalent of TH3F::Fill(x,y,z), applied to the histogram by FlushDeferredHistos
+  DeferredHisto &lHisto = fDeferredHistos[lDeferred];
+  DeferredAxes &lAxes = fDeferredAxes[lHisto.fAxes];
+  if( lAxes.fBin < 0 || x != lAxes.fX || y != lAxes.fY || z != lAxes.fZ ){
+    TH3F *lReference = lAxes.fReference;
+    Int_t lBinX = lReference->GetXaxis()->FindBin(x);
+    Int_t lBinY = lReference->GetYaxis()->FindBin(y);
+    Int_t lBinZ = lReference->GetZaxis()->FindBin(z);
+    lAxes.fX = x;
+    lAxes.fY = y;
+    lAxes.fZ = z;
+    lAxes.fBin = lReference->GetBin(lBinX, lBinY, lBinZ);
+    lAxes.fInRange =
+    lBinX > 0 && lBinX <= lReference->GetXaxis()->GetNbins() &&
+    lBinY > 0 && lBinY <= lReference->GetYaxis()->GetNbins() &&
+    lBinZ > 0 && lBinZ <= lReference->GetZaxis()->GetNbins();
+  }
+  lHisto.fBins.push_back(lAxes.fBin);
+  if( !lAxes.fInRange && !TH1::StatOverflows() ) return;
+  lHisto.fStats[0]  += 1;
+  lHisto.fStats[1]  += 1;
+  lHisto.fStats[2]  += x;
+  lHisto.fStats[3]  += x*x;
+  lHisto.fStats[4]  += y;
+  lHisto.fStats[5]  += y*y;
+  lHisto.fStats[6]  += x*y;
+  lHisto.fStats[7]  += z;
+  lHisto.fStats[8]  += z*z;
+  lHisto.fStats[9]  += x*z;
+  lHisto.fStats[10] += y*z;
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::FlushDeferredHistos()
+{
+  //Merge the pending fills: bin contents, errors, statistics and entries
+  for( UInt_t ihisto=0; ihisto<fDeferredHistos.size(); ihisto++ ){
+    DeferredHisto &lHisto = fDeferredHistos[ihisto];
+    if( lHisto.fBins.empty() ) continue;
+    TH3F *lTarget = lHisto.fHisto;
+    Double_t lStats[11];
+    lTarget->GetStats(lStats);
+    Double_t lEntries = lTarget->GetEntries();
+    TArrayD *lSumw2 = lTarget->GetSumw2N() ? lTarget->GetSumw2() : 0x0;
+    for( UInt_t ibin=0; ibin<lHisto.fBins.size(); ibin++ ){
+      lTarget->AddBinContent(lHisto.fBins[ibin]);
+      if( lSumw2 ) lSumw2->fArray[lHisto.fBins[ibin]] += 1;
+    }
+    for( Int_t istat=0; istat<11; istat++ ){
+      lStats[istat] += lHisto.fStats[istat];
+      lHisto.fStats[istat] = 0;
+    }
+    lTarget->PutStats(lStats);
+    lTarget->SetEntries(lEntries + lHisto.fBins.size());
+    lHisto.fBins.clear();
+  }
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskStrangenessVsMultiplicityRun2::SetupStandardVertexing()
 //Meant to store standard re-vertexing configuration
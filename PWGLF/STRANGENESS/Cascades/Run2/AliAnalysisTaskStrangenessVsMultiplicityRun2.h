@@ -33,6 +33,7 @@ class TVector3;
 class THnSparse;
 class TRandom3;
 class TProfile;
+class TAxis;
 
 class AliESDpid;
 class AliESDtrackCuts;
@@ -46,6 +47,8 @@ class AliV0Result;
 class AliCascadeResult;
 class AliExternalTrackParam;
 
+#include <vector>
+
 //#include "TString.h"
 //#include "AliESDtrackCuts.h"
 #include "AliAnalysisTaskSE.h"
@@ -65,6 +68,7 @@ public:
   
   virtual void   UserCreateOutputObjects();
   virtual void   UserExec(Option_t *option);
+  virtual void   FinishTaskOutput();
   virtual void   Terminate(Option_t *);
   Double_t MyRapidity(Double_t rE, Double_t rPz) const;
   
@@ -251,6 +255,11 @@ public:
     fkSaveSpecificConfig = kTRUE;
   }
   //---------------------------------------------------------------------------------------
+  //Superlight mode: evaluate configurations through cut trees (default) or one by one
+  void SetUseCutTree ( Bool_t lOpt = kTRUE ) {
+    fkUseCutTree = lOpt;
+  }
+  //---------------------------------------------------------------------------------------
   //Function to load ML models 
   void Create_ML_Model(TString FileName, TString ModelType, TString Particle); 
   //---------------------------------------------------------------------------------------
@@ -335,6 +344,9 @@ private:
   Bool_t fkSaveSpecificConfig;
   TString fkConfigToSave;
   
+  //if true, superlight configurations are evaluated through the cut trees
+  Bool_t fkUseCutTree;
+  
   //===========================================================================================
   //   Pointers to ML Classes
   //===========================================================================================
@@ -734,12 +746,108 @@ private:
   TH2D *fHistEventMatrix; //!
   TH1D *fRecPointRadii;
   
+  //===========================================================================================
+  //   Cut trees for the superlight adaptive output mode
+  //===========================================================================================
+  // The selection of a configuration is split in consecutive cut stages. Configurations
+  // sharing the cut values of the first stages share the corresponding nodes of the tree,
+  // so each node is evaluated once per candidate with any of its configurations and a
+  // failing node skips all configurations below it. Leaves keep the configurations
+  // sharing the values of all stages.
+  struct CutTreeNode {
+    CutTreeNode(Int_t lStage = -1, TObject *lRepresentative = 0x0) :
+    fStage(lStage), fRepresentative(lRepresentative), fChildren(), fResults(), fDeferred() {}
+    Int_t fStage;                   // cut stage evaluated at this node (-1: root)
+    TObject *fRepresentative;       // configuration providing the cut values of the stage
+    std::vector<Int_t> fChildren;   // indices of the child nodes
+    std::vector<TObject*> fResults; // configurations passing all stages (leaves only)
+    std::vector<Int_t> fDeferred;   // deferred histogram of each configuration (leaves only)
+  };
+  //Candidate properties per mass hypothesis, filled once per candidate
+  struct V0CutTreeCandidate {
+    Int_t   fOnFlyStatus;
+    Float_t fMass[3];
+    Float_t fRap[3];
+    Float_t fPDGMass[3];
+    Float_t fNegdEdx[3];
+    Float_t fPosdEdx[3];
+    Float_t fBaryonMomentum[3];
+    Float_t fBaryonPt[3];
+    Float_t fBaryondEdxFromProton[3];
+    Float_t fLeastNcrOverLength;
+    Bool_t  fITSorTOFsatisfied;
+  };
+  struct CascadeCutTreeCandidate {
+    Bool_t   fValid[4];
+    Short_t  fCharge[4];
+    Float_t  fMass[4];
+    Float_t  fV0Mass[4];
+    Float_t  fRap[4];
+    Float_t  fPDGMass[4];
+    Float_t  fNegdEdx[4];
+    Float_t  fPosdEdx[4];
+    Float_t  fBachdEdx[4];
+    Float_t  fNegTOFsigma[4];
+    Float_t  fPosTOFsigma[4];
+    Float_t  fBachTOFsigma[4];
+    Double_t fMLpredNN[4];
+    Double_t fMLpredBDT[4];
+    Float_t  fExpV0Mass;
+    Float_t  fExpV0Sigma;
+    Float_t  f276TeVV0CosPA;
+    Float_t  fLeastNcrOverLength;
+    Int_t    fLeastNbrCrossedRows;
+    Bool_t   fITSorTOFsatisfied;
+  };
+  static const Int_t kNV0CutStages = 21;
+  static const Int_t kNCascadeCutStages = 35;
+  
+  void BuildCutTrees();
+  static void AddToCutTree(std::vector<CutTreeNode> &lTree, TObject *lResult, Int_t lNStages, Bool_t (*lSameStage)(Int_t, const TObject*, const TObject*));
+  static Bool_t SameV0CutStage(Int_t lStage, const TObject *lFirst, const TObject *lSecond);
+  static Bool_t SameCascadeCutStage(Int_t lStage, const TObject *lFirst, const TObject *lSecond);
+  Bool_t PassesV0CutStage(Int_t lStage, const AliV0Result *lV0Result, const V0CutTreeCandidate &lCand) const;
+  Bool_t PassesCascadeCutStage(Int_t lStage, const AliCascadeResult *lCascadeResult, const CascadeCutTreeCandidate &lCand) const;
+  void FillV0CutTree(Int_t lNode, const V0CutTreeCandidate &lCand);
+  void FillCascadeCutTree(Int_t lNode, const CascadeCutTreeCandidate &lCand);
+  
+  std::vector<CutTreeNode> fV0CutTree;      //! V0 cut tree (node 0: root)
+  std::vector<CutTreeNode> fCascadeCutTree; //! Cascade cut tree (node 0: root)
+  
+  // Deferred filling of the cut tree leaves: the bin of a candidate is located once for
+  // all histograms with identical axes, fills are kept as bin lists and statistics and
+  // merged into the histograms at the end of the event
+  struct DeferredAxes {
+    DeferredAxes(TH3F *lReference = 0x0) : fReference(lReference), fX(0), fY(0), fZ(0), fBin(-1), fInRange(kFALSE) {}
+    TH3F *fReference;  // histogram providing the axes
+    Double_t fX, fY, fZ; // last located values
+    Int_t fBin;        // global bin of the last located values (-1: none yet)
+    Bool_t fInRange;   // last located values inside the axes ranges
+  };
+  struct DeferredHisto {
+    DeferredHisto(TH3F *lHisto = 0x0, Int_t lAxes = -1) : fHisto(lHisto), fAxes(lAxes), fBins() {
+      for(Int_t i=0; i<11; i++) fStats[i] = 0;
+    }
+    TH3F *fHisto;             // target histogram
+    Int_t fAxes;              // index of the shared axes
+    std::vector<Int_t> fBins; // global bins filled in the current event
+    Double_t fStats[11];      // statistics of the in-range fills (TH3::GetStats convention)
+  };
+  static Bool_t SameAxis(const TAxis *lFirst, const TAxis *lSecond);
+  void BuildDeferredHistos(std::vector<CutTreeNode> &lTree);
+  void FillDeferred(Int_t lDeferred, Double_t x, Double_t y, Double_t z);
+  void FlushDeferredHistos();
+  
+  std::vector<DeferredAxes>  fDeferredAxes;   //! distinct axes of the leaf histograms
+  std::vector<DeferredHisto> fDeferredHistos; //! leaf histograms and their pending fills
+  
   AliAnalysisTaskStrangenessVsMultiplicityRun2(const AliAnalysisTaskStrangenessVsMultiplicityRun2&);            // not implemented
   AliAnalysisTaskStrangenessVsMultiplicityRun2& operator=(const AliAnalysisTaskStrangenessVsMultiplicityRun2&); // not implemented
   
-  ClassDef(AliAnalysisTaskStrangenessVsMultiplicityRun2, 5);
+  ClassDef(AliAnalysisTaskStrangenessVsMultiplicityRun2, 6);
   //1: first implementation
   //5: Addition of ML classes data members
+  //6: Addition of cut tree switch
 };
 
 #endif
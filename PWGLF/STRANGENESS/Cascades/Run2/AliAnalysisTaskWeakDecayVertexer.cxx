@@ -54,6 +54,7 @@ class AliAODv0;
 #include "TRandom3.h"
 #include "TLorentzVector.h"
 #include "TObjectTable.h"
+#include "TArrayD.h"
 //#include "AliLog.h"
 
 #include "AliESDEvent.h"
@@ -684,6 +685,10 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
     TArrayI neg(nentr);
     TArrayI pos(nentr);
     
+    //Helix circles in XY, computed once per selected track
+    Bool_t lPreselectXY = UseXYPairPreselection();
+    TArrayD lCircles(lPreselectXY ? 3*nentr : 0);
+    
     Long_t nneg=0, npos=0, nvtx=0;
     
     Long_t i;
@@ -712,6 +717,8 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
         //Select on single-track to PV DCA here, do not call that O(N^2)
         if (esdTrack->GetSign() < 0. && TMath::Abs(d)>fV0VertexerSels[1]) neg[nneg++]=i;
         if (esdTrack->GetSign() > 0. && TMath::Abs(d)>fV0VertexerSels[2]) pos[npos++]=i;
+        
+        if (lPreselectXY) GetHelixCircle(esdTrack, lCircles.GetArray()+3*i, b);
     }
     
       int nHypSel = fV0HypSelArray ? fV0HypSelArray->GetEntriesFast() : 0;
@@ -739,6 +746,9 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
             
             fHistV0Statistics->Fill(1.5); //pass distance to PV
             
+            //Same XY skip as in GetDCAV0Dau, before copying the track parameters
+            if (lPreselectXY && IsFarInXY(lCircles.GetArray()+3*nidx, lCircles.GetArray()+3*pidx)) continue;
+            
             AliExternalTrackParam nt(*ntrk), pt(*ptrk);
             Bool_t lUsedOptimalParams = kFALSE;
             
@@ -933,6 +943,11 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0verticesMC(AliESDEvent *event)
     TArrayI neg(nentr);
     TArrayI pos(nentr);
     
+    //Per-track DCA to PV and helix circles in XY, computed once per selected track
+    TArrayD lDCAxy(nentr);
+    Bool_t lPreselectXY = UseXYPairPreselection();
+    TArrayD lCircles(lPreselectXY ? 3*nentr : 0);
+    
     Long_t nneg=0, npos=0, nvtx=0;
     
     //Particles of interest
@@ -985,6 +1000,9 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0verticesMC(AliESDEvent *event)
         
         if (esdTrack->GetSign() < 0.) neg[nneg++]=i;
         else pos[npos++]=i;
+        
+        lDCAxy[i] = d;
+        if (lPreselectXY) GetHelixCircle(esdTrack, lCircles.GetArray()+3*i, b);
     }
     
     for (i=0; i<nneg; i++) {
@@ -1015,11 +1033,14 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0verticesMC(AliESDEvent *event)
             Double_t lNegMassForTracking = ntrk->GetMassForTracking();
             Double_t lPosMassForTracking = ptrk->GetMassForTracking();
             
-            if (TMath::Abs(ntrk->GetD(xPrimaryVertex,yPrimaryVertex,b))<fV0VertexerSels[1])
-                if (TMath::Abs(ptrk->GetD(xPrimaryVertex,yPrimaryVertex,b))<fV0VertexerSels[2]) continue;
+            if (TMath::Abs(lDCAxy[nidx])<fV0VertexerSels[1])
+                if (TMath::Abs(lDCAxy[pidx])<fV0VertexerSels[2]) continue;
             
             fHistV0Statistics->Fill(1.5); //pass distance to PV
             
+            //Same XY skip as in GetDCAV0Dau, before copying the track parameters
+            if (lPreselectXY && IsFarInXY(lCircles.GetArray()+3*nidx, lCircles.GetArray()+3*pidx)) continue;
+            
             AliExternalTrackParam nt(*ntrk), pt(*ptrk);
             Bool_t lUsedOptimalParams = kFALSE;
             
@@ -2941,6 +2962,35 @@ void AliAnalysisTaskWeakDecayVertexer::GetHelixCenter(const AliExternalTrackPara
     return;
 }
 
+///________________________________________________________________________
+Bool_t AliAnalysisTaskWeakDecayVertexer::UseXYPairPreselection() const {
+    // The XY skip of GetDCAV0Dau can be applied before the pair is set up if the
+    // daughters keep the ESD track parameters (no OTF params, no re-propagation)
+    return fkDoImprovedDCAV0DauPropagation && fkSkipLargeXYDCA &&
+    !fkUseOptimalTrackParams && !fkResetInitialPositions && fV0VertexerSels[3] < 2000;
+}
+
+///________________________________________________________________________
+void AliAnalysisTaskWeakDecayVertexer::GetHelixCircle(const AliExternalTrackParam *track, Double_t circle[3], Double_t b){
+    // Center (x, y) and radius of the helix projection in XY, as used in GetDCAV0Dau
+    Double_t helix[6];
+    track->GetHelixParameters(helix,b);
+    GetHelixCenter( track, circle, b );
+    circle[2] = TMath::Abs(1./helix[4]);
+}
+
+///________________________________________________________________________
+Bool_t AliAnalysisTaskWeakDecayVertexer::IsFarInXY(const Double_t lNegCircle[3], const Double_t lPosCircle[3]) const {
+    // True if the pair would be skipped by the XY pre-optimization of GetDCAV0Dau
+    Double_t lDist = TMath::Sqrt(
+                                 TMath::Power( lNegCircle[0] - lPosCircle[0] , 2) +
+                                 TMath::Power( lNegCircle[1] - lPosCircle[1] , 2)
+                                 );
+    if( lDist > lNegCircle[2] + lPosCircle[2] + 2*fV0VertexerSels[3] ) return kTRUE;
+    if( lDist < TMath::Abs(lNegCircle[2] - lPosCircle[2]) - 2*fV0VertexerSels[3] ) return kTRUE;
+    return kFALSE;
+}
+
 ///________________________________________________________________________
 void AliAnalysisTaskWeakDecayVertexer::SelectiveResetV0s(AliESDEvent *event, Int_t lType){
     //Selectively reset V0s
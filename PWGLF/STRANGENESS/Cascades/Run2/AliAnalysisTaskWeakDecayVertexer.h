@@ -318,6 +318,10 @@ public:
     //Improved DCA V0 Dau
     Double_t GetDCAV0Dau ( AliExternalTrackParam *pt, AliExternalTrackParam *nt, Double_t &xp, Double_t &xn, Double_t b, Double_t lNegMassForTracking=0.139, Double_t lPosMassForTracking=0.139);
     void GetHelixCenter(const AliExternalTrackParam *track,Double_t center[2], Double_t b);
+    //XY pair preselection with helix circles computed once per track
+    Bool_t UseXYPairPreselection() const;
+    void GetHelixCircle(const AliExternalTrackParam *track, Double_t circle[3], Double_t b);
+    Bool_t IsFarInXY(const Double_t lNegCircle[3], const Double_t lPosCircle[3]) const;
     //---------------------------------------------------------------------------------------
     
     //---------------------------------------------------------------------------------------
@@ -965,20 +965,24 @@ Double_t AliAnalysisTaskSpectraFlatenicity::GetFlatenicityMC() {
     Double_t phi = particle->Phi();
     Double_t eta = particle->Eta();
 
-    Int_t i_segment = 0;
-    for (int i_eta = 0; i_eta < nRings; ++i_eta) {
-
-      for (int i_phi = 0; i_phi < nSectors; ++i_phi) {
-
-        if (eta >= minEta[i_eta] && eta < maxEta[i_eta] &&
-            phi >= PhiBins[i_phi] && phi < PhiBins[i_phi + 1]) {
-          nMult++;
-          RhoLattice[i_segment] += 1.0;
-          multLattice[i_segment] += 1.0;
-        }
-        i_segment++;
-      }
-    }
+    // rings do not overlap: find the ring, the sector follows from phi
+    Int_t i_eta = 0;
+    while (i_eta < nRings && !(eta >= minEta[i_eta] && eta < maxEta[i_eta]))
+      i_eta++;
+    if (i_eta == nRings)
+      continue;
+    if (phi < PhiBins[0] || phi >= PhiBins[nSectors])
+      continue;
+    Int_t i_phi = TMath::Min(Int_t(phi / deltaPhi), nSectors - 1);
+    // protect against rounding at the sector edges
+    if (phi < PhiBins[i_phi])
+      i_phi--;
+    else if (phi >= PhiBins[i_phi + 1])
+      i_phi++;
+    Int_t i_segment = i_eta * nSectors + i_phi;
+    nMult++;
+    RhoLattice[i_segment] += 1.0;
+    multLattice[i_segment] += 1.0;
   }
 
   Int_t i_seg = 0;
@@ -65,6 +65,7 @@
 //_____ AnalysisTask headers
 #include "AliAnalysisTaskSE.h"
 #include "AliAnalysisTaskGenUeSpherocity.h"
+#include "AliSpherocityUtils.h"
 
 //_____ STL includes
 #include <iostream>
@@ -1392,6 +1393,8 @@ void AliAnalysisTaskGenUeSpherocity::ParticleSel(Bool_t fIsPseudoRec, const vect
 
 Float_t AliAnalysisTaskGenUeSpherocity::GetSpherocity(Int_t nch_so, const vector<Float_t> &pt, const vector<Float_t> &eta, const vector<Float_t> &phi, const Bool_t isPtWeighted ){
 
+	if(fSizeStep<=0)
+		return AliSpherocityUtils::GetSpherocityExact(nch_so, pt, phi, isPtWeighted);
 
 	Float_t spherocity = -10.0;
 	Float_t pFull = 0;
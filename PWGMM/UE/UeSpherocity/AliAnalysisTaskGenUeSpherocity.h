@@ -57,6 +57,7 @@ class AliAnalysisTaskGenUeSpherocity : public AliAnalysisTaskSE { //
 		virtual void SetYRange(Float_t y){ fY=y; }
 		virtual void SetGenerator(TString generator){fGenerator=generator;}
 		virtual void SetMinPtLeading(Double_t minptl){fMinPtLeading=minptl;}
+		virtual void SetStepSize(Float_t sizestep){fSizeStep=sizestep;} // <=0: exact minimisation
 
 	private:
 
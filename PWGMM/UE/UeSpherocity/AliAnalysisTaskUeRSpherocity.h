@@ -34,6 +34,7 @@ class AliAnalysisTaskUeRSpherocity : public AliAnalysisTaskSE {
 		virtual bool     MakeAnalysis( Int_t index_sample, Int_t index_leading, Double_t etaCut );
 		virtual void     SetAnalysisType(const char* analysisType) {fAnalysisType = analysisType;}
 		virtual void     SetPeriod(const TString period) {fdata_set = period;}
+		virtual void     SetSpheroUtils(AliSpherocityUtils* so) {fSpheroUtils = so;} // e.g. SetStepSize(0) for the exact spherocity
 
 		virtual void     SetTrackCuts(AliAnalysisFilter* fTrackFilter);
 		virtual Double_t DeltaPhi(Double_t phia, Double_t phib,
@@ -153,10 +153,9 @@ void AliAnalysisTaskUeSpherocity::UserCreateOutputObjects()
 	// This method is called once per worker node
 	// Here we define the output: histograms and debug tree if requested 
 
-	if(!fSpheroUtils){
+	if(!fSpheroUtils)
 		fSpheroUtils = new AliSpherocityUtils();
-		fSpheroUtils->Init();
-	}
+	fSpheroUtils->Init();
 
 	// Definition of trackcuts
 	if(!fTrackFilter){	
@@ -36,6 +36,7 @@ class AliAnalysisTaskUeSpherocity : public AliAnalysisTaskSE {
 		virtual void     SetAnalysisType(const char* analysisType) {fAnalysisType = analysisType;}
 		virtual void     SetHisto(TH1D *hBining) {fSoBining = hBining;}
 		virtual void     SetAnalysisMC(Bool_t isMC) {fAnalysisMC = isMC;}
+		virtual void     SetSpheroUtils(AliSpherocityUtils* so) {fSpheroUtils = so;} // e.g. SetStepSize(0) for the exact spherocity
 
 		virtual Int_t    GetMultiplicityParticles(Double_t etaCut);
 		virtual Double_t GetSpheroPercentile( Double_t valES, Int_t valMult );
@@ -50,6 +50,7 @@
 #include "TFile.h"
 #include "TMatrixD.h"
 #include "TRandom3.h"
+#include "TF1.h"
 
 #include "AliHeader.h"  
 #include "AliGenEventHeader.h"  
@@ -88,6 +89,7 @@
 #include "TVectorD.h"
 #include "TStatToolkit.h"
 #include "AliESDtools.h"
+#include "AliPIDtools.h"
 #include "TVectorF.h"
 #include "AliTPCROC.h"
 using namespace std;
@@ -124,6 +126,11 @@ ClassImp(AliAnalysisTaskFilteredTree)
   , fProcessAll(kFALSE)
   , fProcessCosmics(kFALSE)
   , fProcessITSTPCmatchOut(kFALSE)  // swittch to process ITS/TPC standalone tracks
+  , fOutputCompression(-1)
+  , fTreeAutoFlush(0)
+  , fFlatTrackParams(0)
+  , fFlatCovariance(1)
+  , fPtDownsampling(0)
   , fHighPtTree(0)
   , fV0Tree(0)
   , fdEdxTree(0)
@@ -170,6 +177,18 @@ AliAnalysisTaskFilteredTree::~AliAnalysisTaskFilteredTree()
   delete fFilteredTreeAcceptanceCuts;
   delete fFilteredTreeRecAcceptanceCuts;
   delete fEsdTrackCuts;
+  delete fPtDownsampling;
+}
+
+//_____________________________________________________________________________
+void AliAnalysisTaskFilteredTree::SetPtDownsampling(const TF1 *keepProbability)
+{
+  //
+  // Set the probability to keep a highPt track as a function of pt (a copy is stored with the task)
+  // NULL restores the Tsallis flat pt / flat q/pt downsampling
+  //
+  delete fPtDownsampling;
+  fPtDownsampling = (keepProbability!=NULL) ? (TF1*)keepProbability->Clone() : NULL;
 }
 
 //____________________________________________________________________________
@@ -208,7 +227,9 @@ void AliAnalysisTaskFilteredTree::UserCreateOutputObjects()
 
   //
   //get the output file to make sure the trees will be associated to it
-  OpenFile(1);
+  TFile * outputFile = OpenFile(1);
+  // branches are created at the first fill and take the compression of the file
+  if (outputFile && fOutputCompression>=0) outputFile->SetCompressionSettings(fOutputCompression);
   fTreeSRedirector = new TTreeSRedirector();
 
   //
@@ -219,6 +240,10 @@ void AliAnalysisTaskFilteredTree::UserCreateOutputObjects()
   fLaserTree = ((*fTreeSRedirector)<<"Laser").GetTree();
   fMCEffTree = ((*fTreeSRedirector)<<"MCEffTree").GetTree();
   fCosmicPairsTree = ((*fTreeSRedirector)<<"CosmicPairs").GetTree();
+  if (fTreeAutoFlush!=0){
+    TTree * trees[6]={fV0Tree, fHighPtTree, fdEdxTree, fLaserTree, fMCEffTree, fCosmicPairsTree};
+    for (Int_t iTree=0; iTree<6; iTree++) if (trees[iTree]) trees[iTree]->SetAutoFlush(fTreeAutoFlush);
+  }
 
   if (!fDummyTrack)  {
     fDummyTrack=new AliESDtrack();
@@ -732,7 +757,7 @@ void AliAnalysisTaskFilteredTree::Process(AliESDEvent *const esdEvent, AliMCEven
       ///    if( downscaleCounter>0 && TMath::Exp(2*scalempt)<downscaleF) continue;
       /// New code using flat pt and flat q/pt mixture
       Double_t weight=0;
-      Int_t selectionPtMask=DownsampleTsalisCharged(track->Pt(), 1./fLowPtTrackDownscaligF, 1/fLowPtTrackDownscaligF, fSqrtS, fChargedEffectiveMass,&weight);
+      Int_t selectionPtMask=DownsampleHighPtTrack(track->Pt(),&weight);
       fSelectedTracksMask->Fill(selectionPtMask);
       if( downscaleCounter>0 && selectionPtMask==0) continue;
 
@@ -1049,7 +1074,7 @@ void AliAnalysisTaskFilteredTree::ProcessAll(AliESDEvent *const esdEvent, AliMCE
       // if (downscaleCounter > 0 && TMath::Exp(2 * scalempt) < downscaleF) continue;
       /// New code using flat pt and flat q/pt mixture
       Double_t weight=0, weightMC=0;
-      Int_t selectionPtMask=DownsampleTsalisCharged(track->Pt(), 1./fLowPtTrackDownscaligF, 1/fLowPtTrackDownscaligF, fSqrtS, fChargedEffectiveMass,&weight);
+      Int_t selectionPtMask=DownsampleHighPtTrack(track->Pt(),&weight);
       Int_t selectionPtMaskMC=0;
       if (particle) selectionPtMaskMC=DownsampleTsalisCharged(particle->Pt(), 1./fLowPtTrackDownscaligF, 1/fLowPtTrackDownscaligF, fSqrtS, fChargedEffectiveMass,&weightMC);
       Int_t selectionPIDMask=PIDSelection(track, particle);
@@ -1506,13 +1531,10 @@ void AliAnalysisTaskFilteredTree::ProcessAll(AliESDEvent *const esdEvent, AliMCE
         TVectorD tofPID(nSpecies);
         track->GetIntegratedTimes(tofTime.GetMatrixArray(),nSpecies);
 	if(pidResponse){
-          for (Int_t ispecie=0; ispecie<nSpecies; ++ispecie) {
-            //if (ispecie == Int_t(AliPID::kMuon)) continue;
-            tpcNsigma[ispecie] = pidResponse->NumberOfSigmas(AliPIDResponse::kTPC, track, (AliPID::EParticleType)ispecie);
-            tofNsigma[ispecie] = pidResponse->NumberOfSigmas(AliPIDResponse::kTOF, track, (AliPID::EParticleType)ispecie);
-            itsNsigma[ispecie] = pidResponse->NumberOfSigmas(AliPIDResponse::kTOF, track, (AliPID::EParticleType)ispecie);
-	    //
-          }	
+          const AliVTrack *pidTrack=track;
+          AliPIDtools::NumberOfSigmas(pidResponse, AliPIDResponse::kTPC, 1, &pidTrack, tpcNsigma.GetMatrixArray(), nSpecies);
+          AliPIDtools::NumberOfSigmas(pidResponse, AliPIDResponse::kTOF, 1, &pidTrack, tofNsigma.GetMatrixArray(), nSpecies);
+          itsNsigma = tofNsigma;  // filled with the TOF n-sigma as in the previous versions of the tree
 	  pidResponse->ComputePIDProbability(AliPIDResponse::kTPC, track, nSpecies, tpcPID.GetMatrixArray());
 	  pidResponse->ComputePIDProbability(AliPIDResponse::kTOF, track, nSpecies, tofPID.GetMatrixArray());	    
 	}
@@ -1546,9 +1568,10 @@ void AliAnalysisTaskFilteredTree::ProcessAll(AliESDEvent *const esdEvent, AliMCE
             "vertexPosTPC.="<<&vertexPosTPC<<          // TPC vertex position
             "vertexPosSPD.="<<&vertexPosSPD<<          // SPD vertex position
             "ntracksTPC="<<ntracksTPC<<               // total number of the TPC tracks which were refitted
-            "ntracksITS="<<ntracksITS<<               // total number of the ITS tracks which were refitted
-            //
-            "esdTrack.="<<track<<                  // esdTrack as used in the physical analysis
+            "ntracksITS="<<ntracksITS;               // total number of the ITS tracks which were refitted
+          if (fFlatTrackParams==0) (*fTreeSRedirector)<<"highPt"<<
+            "esdTrack.="<<track;                   // esdTrack as used in the physical analysis
+          (*fTreeSRedirector)<<"highPt"<<
 	    "tofClInfo.="<<&tofClInfo<<           // tof info
 	    //            "friendTrack.="<<friendTrack<<      // esdFriendTrack associated to the esdTrack
 	    "tofNsigma.="<<&tofNsigma<<
@@ -1556,28 +1579,38 @@ void AliAnalysisTaskFilteredTree::ProcessAll(AliESDEvent *const esdEvent, AliMCE
 	    "itsNsigma.="<<&itsNsigma<<
 	    "tofTime.="<<&tofTime<<                // tof time
 	    "tofPID.="<<&tofPID<<                  // bayesian PID - without priors
-	    "tpcPID.="<<&tpcPID<<                  // bayesian PID - without priors
-	    
+	    "tpcPID.="<<&tpcPID;                   // bayesian PID - without priors
+          if (fFlatTrackParams==0) (*fTreeSRedirector)<<"highPt"<<
 	    "friendTrack.="<<friendTrackStore<<      // esdFriendTrack associated to the esdTrack 
             "extTPCInnerC.="<<tpcInnerC<<          // TPC track from the first tracking iteration propagated and updated at vertex 
             "extInnerParamV.="<<trackInnerV<<      // TPC+TRD  inner param after refit  propagate to vertex 
             "extInnerParamC.="<<trackInnerC<<      // TPC+TRD  inner param after refit  propagate and updated at vertex 
             "extInnerParam.="<<trackInnerC2<<      // TPC+TRD  inner param after refit propagate to refernce TPC layer
             "extOuterITS.="<<outerITSc<<           // ITS outer track propagated to the TPC refernce radius
-            "extInnerParamRef.="<<trackInnerC3<<   // TPC+TRD  inner param after refit propagated to the first TPC reference 
+            "extInnerParamRef.="<<trackInnerC3;    // TPC+TRD  inner param after refit propagated to the first TPC reference
+          (*fTreeSRedirector)<<"highPt"<<
             "chi2TPCInnerC="<<chi2(0,0)<<           // chi2   of tracks ???
             "chi2InnerC="<<chi2trackC(0,0)<<        // chi2s  of tracks TPCinner to the combined
             "chi2OuterITS="<<chi2OuterITS(0,0)<<    // chi2s  of tracks TPC at inner wall to the ITSout
             "centralityF="<<centralityF;
 	  // info for 2 track resolution studies and matching efficency studies 
 	  //
-	  (*fTreeSRedirector)<<"highPt"<<
+	  if (fFlatTrackParams==0) (*fTreeSRedirector)<<"highPt"<<
 	    "paramITS.="<<&paramITS<<                // nearest ITS track  -   chi2 distance at vertex
 	    "paramITSC.="<<&paramITSC<<              // nearest ITS track  -  to constrained track   chi2 distance at vertex
-	    "paramComb.="<<&paramComb<<              // nearest comb. tack -   chi2 distance at inner wall
+	    "paramComb.="<<&paramComb;               // nearest comb. tack -   chi2 distance at inner wall
+	  (*fTreeSRedirector)<<"highPt"<<
 	    "indexNearestITS="<<indexNearestITS<<    // index of  nearest ITS track
 	    "indexNearestITSC="<<indexNearestITSC<<  // index of  nearest ITS track for constrained track
 	    "indexNearestComb="<<indexNearestComb;   // index of  nearest track for constrained track
+	  if (fFlatTrackParams!=0){
+	    // flat schema - only the selected track parameters as scalar branches
+	    TTreeStream &stream=(*fTreeSRedirector)<<"highPt";
+	    const AliExternalTrackParam *flatParams[kNFlatParams]={track, tpcInnerC, trackInnerV, trackInnerC, trackInnerC2, outerITSc, trackInnerC3, &paramITS, &paramITSC, &paramComb};
+	    for (Int_t iParam=0; iParam<kNFlatParams; iParam++){
+	      if (fFlatTrackParams&(1<<iParam)) StreamFlatTrackParam(stream, iParam, flatParams[iParam]);
+	    }
+	  }
 
           if (mcEvent){
             Int_t multMCTracksAll= mcEvent->GetNumberOfTracks();
@@ -3790,3 +3823,34 @@ Int_t  AliAnalysisTaskFilteredTree::DownsampleTsalisCharged(Double_t pt, Double_
   if (gRandom->Rndm()<factorPt) triggerMask|=4;
   return triggerMask;
 }
+
+/// Downsampling of the highPt tracks
+/// \param pt
+/// \param weight - relative Tsallis yield, or the keep probability if the run time function is used
+/// \return trigger bitmask as in DownsampleTsalisCharged, bit 4 - run time pt downsampling function
+Int_t  AliAnalysisTaskFilteredTree::DownsampleHighPtTrack(Double_t pt, Double_t *weight){
+  if (fPtDownsampling==NULL) return DownsampleTsalisCharged(pt, 1./fLowPtTrackDownscaligF, 1/fLowPtTrackDownscaligF, fSqrtS, fChargedEffectiveMass, weight);
+  (*weight)=fPtDownsampling->Eval(pt);
+  return (gRandom->Rndm()<(*weight)) ? 8:0;
+}
+
+/// Stream track parameter as scalar branches <name>_X, <name>_Alpha, <name>_P0-4 and <name>_C0-14 (flat schema)
+/// Values are buffered in fFlatParamBuffer as the stream reads them at the end of the entry
+/// \param stream - highPt tree stream
+/// \param index  - EFlatTrackParam
+/// \param param  - track parameter, NULL is written as 0
+void AliAnalysisTaskFilteredTree::StreamFlatTrackParam(TTreeStream &stream, Int_t index, const AliExternalTrackParam *param){
+  static const char *kParamNames[kNFlatParams]={"esdTrack", "extTPCInnerC", "extInnerParamV", "extInnerParamC", "extInnerParam",
+                                                "extOuterITS", "extInnerParamRef", "paramITS", "paramITSC", "paramComb"};
+  static const Int_t kDiagonal[5]={0,2,5,9,14};
+  const Int_t nCov=(fFlatCovariance>1) ? 15 : (fFlatCovariance==1) ? 5:0;
+  Float_t *values=fFlatParamBuffer[index];
+  values[0]=(param) ? param->GetX():0;
+  values[1]=(param) ? param->GetAlpha():0;
+  for (Int_t i=0; i<5; i++) values[2+i]=(param) ? param->GetParameter()[i]:0;
+  for (Int_t i=0; i<nCov; i++) values[7+i]=(param) ? param->GetCovariance()[(nCov==5) ? kDiagonal[i]:i]:0;
+  stream<<TString::Format("%s_X=",kParamNames[index]).Data()<<values[0]<<
+    TString::Format("%s_Alpha=",kParamNames[index]).Data()<<values[1];
+  for (Int_t i=0; i<5; i++) stream<<TString::Format("%s_P%d=",kParamNames[index],i).Data()<<values[2+i];
+  for (Int_t i=0; i<nCov; i++) stream<<TString::Format("%s_C%d=",kParamNames[index],(nCov==5) ? kDiagonal[i]:i).Data()<<values[7+i];
+}
@@ -22,6 +22,10 @@
    3.) "Laser"      - dump laser tracks with space points if exists
    4.) "CosmicTree" - cosmic track candidate (random or triggered) + esdTracks(up/down)+ optional points
    5.) "dEdx"       - tree with high dEdx tpc tracks
+
+   Flat schema of the "highPt" tree (SetFlatTrackParams):
+     instead of the full track objects only the selected track parameters are written as scalar branches
+     (<param>_X, <param>_Alpha, <param>_P0-4 and optionally the diagonal or full covariance <param>_C0-14)
 */
 class AliESDEvent;
 class AliMCEvent;
@@ -44,6 +48,8 @@ class TTree;
 class TTreeSRedirector;
 class TParticle;
 class TH3D;
+class TF1;
+class TTreeStream;
 class AliESDtools;
 #include <string>
 
@@ -58,6 +64,10 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
                       kTPCITSAnalysisMode=0,
                       kTPCAnalysisMode=1 };
 
+  /// track parameters of the "highPt" tree which can be written in the flat schema (bit index)
+  enum EFlatTrackParam { kFlatEsdTrack=0, kFlatTPCInnerC, kFlatInnerParamV, kFlatInnerParamC, kFlatInnerParam,
+                         kFlatOuterITS, kFlatInnerParamRef, kFlatParamITS, kFlatParamITSC, kFlatParamComb, kNFlatParams };
+
   AliAnalysisTaskFilteredTree(const char *name = "AliAnalysisTaskFilteredTree");
   virtual ~AliAnalysisTaskFilteredTree();
   
@@ -118,6 +128,10 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
   void SetLowPtTrackDownscaligF(Double_t fact) { fLowPtTrackDownscaligF = fact; }
   void SetLowPtV0DownscaligF(Double_t fact)    { fLowPtV0DownscaligF = fact; }
   void SetFriendDownscaling(Double_t fact)    { fFriendDownscaling = fact; }
+  void SetOutputCompression(Int_t settings)   { fOutputCompression = settings; }
+  void SetTreeAutoFlush(Long64_t autoFlush)   { fTreeAutoFlush = autoFlush; }
+  void SetFlatTrackParams(Int_t mask, Int_t covariance=1) { fFlatTrackParams = mask; fFlatCovariance = covariance; }
+  void SetPtDownsampling(const TF1 *keepProbability);
   
   void   SetProcessCosmics(Bool_t flag) { fProcessCosmics = flag; }
   Bool_t GetProcessCosmics() { return fProcessCosmics; }
@@ -144,8 +158,11 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
   /// sqrt s - mass dependent downsampling trigger (pt spectra as parameterized in https://iopscience.iop.org/article/10.1088/2399-6528/aab00f/pdf)
   static Double_t TsalisCharged(Double_t pt, Double_t mass, Double_t sqrts);
   static Int_t    DownsampleTsalisCharged(Double_t pt, Double_t factorPt, Double_t factor1Pt,  Double_t sqrts, Double_t mass, Double_t *weight);
+  Int_t  DownsampleHighPtTrack(Double_t pt, Double_t *weight);
   Int_t  PIDSelection(AliESDtrack *track, TParticle *particle = nullptr);
  private:
+  void StreamFlatTrackParam(TTreeStream &stream, Int_t index, const AliExternalTrackParam *param);
+
   AliESDEvent *fESD;    //! ESD event
   AliMCEvent *fMC;      //! MC event
   AliESDfriend *fESDfriend; //! ESDfriend event
@@ -178,6 +195,12 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
   
   Bool_t fProcessCosmics; // look for cosmic pairs from random trigger
   Bool_t fProcessITSTPCmatchOut;  // switch to process ITS/TPC standalone tracks
+  Int_t fOutputCompression;  // compression settings of the output trees (100*algorithm+level, e.g. 404 LZ4, 505 ZSTD), -1 keeps the file default
+  Long64_t fTreeAutoFlush;   // auto flush of the output trees (>0 entries, <0 bytes), 0 keeps the ROOT default
+  Int_t fFlatTrackParams;    // bit mask of EFlatTrackParam written in the flat schema of the highPt tree, 0 - full objects
+  Int_t fFlatCovariance;     // covariance in the flat schema: 0 - none, 1 - diagonal, 2 - full
+  TF1 * fPtDownsampling;     // optional keep probability as a function of pt for the highPt tracks (replaces the Tsallis downsampling)
+  Float_t fFlatParamBuffer[kNFlatParams][22]; //! values of the flat track parameters streamed for the current track
 
   TTree* fHighPtTree;       //! list send on output slot 0
   TTree* fV0Tree;           //! list send on output slot 0
@@ -205,7 +228,7 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
 
   AliAnalysisTaskFilteredTree(const AliAnalysisTaskFilteredTree&); // not implemented
   AliAnalysisTaskFilteredTree& operator=(const AliAnalysisTaskFilteredTree&); // not implemented
-  ClassDef(AliAnalysisTaskFilteredTree, 1); // example of analysis
+  ClassDef(AliAnalysisTaskFilteredTree, 3); // example of analysis
 };
 
 #endif
@@ -37,7 +37,12 @@
   tree->SetEntryList(entryList)
   tree->Scan("AliESDtools::GetTrackMatchEff(0,0):AliESDtools::GetTrackCounters(0,0):AliESDtools::GetTrackCounters(4,0):AliESDtools::GetMeanHisTPCVertexA():AliESDtools::GetMeanHisTPCVertexC():Entry$",\
       "AliESDtools::SCalculateEventVariables(Entry$)")
-  /// 2.) Exercise: stream event information
+  /// 2.) Exercise: cache event variables in a friend tree - ranges of entries can be processed by parallel jobs
+  tools.CacheEventVariablesToTree("eventVariables0.root",0,1000);
+  tools.CacheEventVariablesToTree("eventVariables1.root",1000,-1);
+  AliESDtools::AddEventVariablesFriend(tree,"eventVariables0.root;eventVariables1.root");
+  tree->Draw("eventVariables.trackCounters.fElements[0]");
+  /// 3.) Exercise: stream event information
   TTreeSRedirector *pcstream = new TTreeSRedirector("test.root","recreate")
   tools->SetStreamer(pcstream);
   tree->Draw("AliESDtools::SDumpEventVariables()","AliESDtools::SCalculateEventVariables(Entry$)");
@@ -118,7 +123,9 @@ AliESDtools::AliESDtools():
   fCacheTrackChi2(nullptr),             // chi2 counter
   fCacheTrackMatchEff(nullptr),         // matchEff counter
   fLumiGraph(nullptr),                  // graph for the interaction rate info for a run
-  fStreamer(nullptr)
+  fStreamer(nullptr),
+  fLastLoadedEntry(-1),
+  fLastPileupEntry(-1)
 {
   fgInstance=this;
   fTriggerAnalysis=new AliTriggerAnalysis;
@@ -772,16 +779,23 @@ Int_t AliESDtools::CalculateEventVariables(){
 /// \param verbose  - verbosity
 /// \return         - 1  - no load needed, 2 - reset event and load branches
 Double_t AliESDtools::LoadESD(Int_t entry, Int_t verbose) {
-  static Int_t lastEntry = -1;
-  if (lastEntry==entry) return 1;
-  lastEntry = entry;
-  fgInstance->fEvent->Reset();
-  fgInstance->fESDtree->GetEntry(entry);
+  return fgInstance->LoadEntry(entry, verbose);
+}
+
+/// Load ESD entry into the event of this instance
+/// \param entry    - entry number
+/// \param verbose  - verbosity
+/// \return         - 1  - no load needed, 2 - reset event and load branches
+Double_t AliESDtools::LoadEntry(Int_t entry, Int_t verbose) {
+  if (fLastLoadedEntry==entry) return 1;
+  fLastLoadedEntry = entry;
+  fEvent->Reset();
+  fESDtree->GetEntry(entry);
   if (verbose & 0x1) {
-    Int_t nTracks = fgInstance->fEvent->GetNumberOfTracks();
+    Int_t nTracks = fEvent->GetNumberOfTracks();
     printf("connect nTracks=%d\n", nTracks);
   }
-  fgInstance->fEvent->ConnectTracks();
+  fEvent->ConnectTracks();
   return 2;
 }
 /// Find (biggest) pile-up TPC vertex  - high efficiency for the PbPb - for pp should be still optimized
@@ -790,15 +804,13 @@ Double_t AliESDtools::LoadESD(Int_t entry, Int_t verbose) {
 /// \param verbose
 /// \return
 Double_t AliESDtools::CachePileupVertexTPC(Int_t entry, Int_t doReset, Int_t verbose) {
-  static Int_t oldEntry = -1;
-
-  if (oldEntry != entry) {
+  if (fLastPileupEntry != entry) {
     if (doReset>0) {
       fHisTPCVertexA->Reset();
       fHisTPCVertexC->Reset();
     }
-    if (!fTaskMode) LoadESD(entry);
-    oldEntry = entry;
+    if (!fTaskMode) LoadEntry(entry);
+    fLastPileupEntry = entry;
     Int_t nNumberOfTracks = fEvent->GetNumberOfTracks();
     const Int_t bufSize = 20000;
     const Float_t kMinDCA = 3;
@@ -955,6 +967,62 @@ Int_t AliESDtools::FillMCCounters() {
 
 /// DumpEvent variables ito the tree
 /// \return
+/// Calculate event variables for a range of entries of the input tree and store them in the tree "eventVariables"
+/// The output tree is aligned with the input entries and can be attached as a friend tree (see AddEventVariablesFriend),
+/// so that TTree::Draw queries do not recalculate the variables in each session.
+/// Independent ranges of entries can be processed in parallel by several instances (jobs), each writing its own file.
+/// \param outputName - output file name
+/// \param firstEntry - first entry
+/// \param nEntries   - number of entries (-1 - all remaining entries)
+/// \return           - number of processed entries
+Int_t AliESDtools::CacheEventVariablesToTree(const char *outputName, Int_t firstEntry, Int_t nEntries){
+  if (fESDtree==nullptr || fTaskMode) {
+    ::Error("AliESDtools::CacheEventVariablesToTree","Input tree not set or task mode");
+    return 0;
+  }
+  Int_t lastEntry=fESDtree->GetEntries();
+  if (nEntries>=0) lastEntry=TMath::Min(lastEntry, firstEntry+nEntries);
+  TTreeSRedirector *pcstream = new TTreeSRedirector(outputName,"recreate");
+  fTaskMode=kTRUE;    // entry is loaded here - not to be reloaded using the event number in CalculateEventVariables
+  for (Int_t entry=firstEntry; entry<lastEntry; entry++){
+    LoadEntry(entry);
+    CalculateEventVariables();
+    Double_t meanTPCVertexA=fHisTPCVertexA->GetMean();
+    Double_t meanTPCVertexC=fHisTPCVertexC->GetMean();
+    (*pcstream)<<"eventVariables"<<
+      "entry="<<entry<<
+      "trackCounters.="<<fCacheTrackCounters<<          // GetTrackCounters
+      "trackTPCCountersZ.="<<fCacheTrackTPCCountersZ<<  // GetTrackTPCCountersZ
+      "trackdEdxRatio.="<<fCacheTrackdEdxRatio<<        // GetTrackdEdxRatio
+      "trackNcl.="<<fCacheTrackNcl<<                    // GetTrackNcl
+      "trackChi2.="<<fCacheTrackChi2<<                  // GetTrackChi2
+      "trackMatchEff.="<<fCacheTrackMatchEff<<          // GetTrackMatchEff
+      "tpcVertexInfo.="<<fTPCVertexInfo<<               // GetVertexInfo
+      "itsVertexInfo.="<<fITSVertexInfo<<
+      "meanTPCVertexA="<<meanTPCVertexA<<               // GetMeanHisTPCVertexA
+      "meanTPCVertexC="<<meanTPCVertexC<<               // GetMeanHisTPCVertexC
+      "\n";
+  }
+  fTaskMode=kFALSE;
+  delete pcstream;
+  return lastEntry-firstEntry;
+}
+
+/// Attach event variables cached by CacheEventVariablesToTree as friend tree "eventVariables"
+/// e.g. tree->Draw("eventVariables.trackCounters.fElements[0]") instead of AliESDtools::GetTrackCounters(0,0)
+/// \param tree      - input ESD tree (chain)
+/// \param fileNames - files with cached variables in the order of the entries, separated by ";"
+/// \return          - number of attached files
+Int_t AliESDtools::AddEventVariablesFriend(TTree *tree, const char *fileNames){
+  if (tree==nullptr) return 0;
+  TChain *chain = new TChain("eventVariables");
+  TObjArray *files = TString(fileNames).Tokenize(";");
+  for (Int_t iFile=0; iFile<files->GetEntriesFast(); iFile++) chain->AddFile(files->At(iFile)->GetName());
+  delete files;
+  tree->AddFriend(chain,"eventVariables");
+  return chain->GetNtrees();
+}
+
 Int_t AliESDtools::DumpEventVariables() {
   if (fStreamer== nullptr) {
     ::Error("AliESDtools::DumpEventVariable","Streamer not set");
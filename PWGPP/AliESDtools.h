@@ -21,6 +21,7 @@ class AliESDtools : public TNamed {
   void Init(TTree* tree, AliESDEvent *event= nullptr);
   void SetStreamer(TTreeSRedirector *streamer){fStreamer=streamer;}
   static Double_t LoadESD(Int_t entry, Int_t verbose=0);
+  Double_t LoadEntry(Int_t entry, Int_t verbose=0);
   void SetMCEvent(AliMCEvent*event){fMCEvent=event;}
   Bool_t IsPileup(Int_t index);
   /// caching
@@ -37,6 +38,8 @@ class AliESDtools : public TNamed {
   //
   void FindTPCSPDtracks(Float_t dcaCut, Float_t dcaCutZ, Float_t dcaChi2Cut);
   Int_t DumpEventVariables();
+  Int_t CacheEventVariablesToTree(const char *outputName, Int_t firstEntry=0, Int_t nEntries=-1);
+  static Int_t AddEventVariablesFriend(TTree *tree, const char *fileNames);
   static Int_t SDumpEventVariables(){return fgInstance->DumpEventVariables();}
   // static functions for querying cached variables in TTree formula
   static Int_t    SCalculateEventVariables(Int_t entry){LoadESD(entry,0); return fgInstance->CalculateEventVariables();}
@@ -94,6 +97,8 @@ class AliESDtools : public TNamed {
   TGraph           * fLumiGraph;                  // graph for the interaction rate info for a run
   //
   TTreeSRedirector * fStreamer;                  /// streamer
+  Int_t fLastLoadedEntry;                        //! last entry loaded by LoadEntry
+  Int_t fLastPileupEntry;                        //! last entry cached in CachePileupVertexTPC
   static AliESDtools* fgInstance;                /// instance of the tool -needed in order to use static functions (for TTreeFormula)
   private:
   AliESDtools(AliESDtools&);
@@ -10,6 +10,7 @@
 
 std::map<Int_t, AliTPCPIDResponse *> AliPIDtools::pidTPC;     /// we should use better hash map
 std::map<Int_t, AliPIDResponse *> AliPIDtools::pidAll;        /// we should use better hash map
+std::map<Int_t, AliPIDtools::SignalTable> AliPIDtools::signalTables;
 AliESDtrack  AliPIDtools::dummyTrack;/// dummy value to save CPU - unfortunately PID object use AliVtrack - for the moment create global variable t avoid object constructions
 TTree *       AliPIDtools::fFilteredTree = NULL;
 TTree *       AliPIDtools::fFilteredTreeV0 = NULL;
@@ -98,6 +99,7 @@ Int_t AliPIDtools::LoadPID(Int_t run, Int_t passNumber, TString recoPass, Bool_t
   Int_t  hash=GetHash(run,passNumber, recoPass,isMC);
   pidAll[hash]=pid;     /// we should clone them
   pidTPC[hash]=&tpcpid;  ///
+  signalTables.erase(hash);  /// tables rebuilt at first use
   return hash;
 }
 
@@ -114,6 +116,148 @@ Double_t AliPIDtools::GetExpectedTOFSignal(Int_t hash, const AliVTrack *track, I
   return tofPID.GetExpectedSignal(track, (AliPID::EParticleType)type);
 }
 
+/// Build tables of the expected signals on an equidistant log(bg) grid for the given PID hash
+/// Tables are used by the batch interface, values outside of the grid are computed directly
+/// \param hash    - hash value of the PID version
+/// \param nBins   - number of grid points
+/// \param bgMin   - lower edge of the grid
+/// \param bgMax   - upper edge of the grid
+/// \return        - kFALSE if the PID is not loaded
+Bool_t AliPIDtools::BuildSignalTables(Int_t hash, Int_t nBins, Double_t bgMin, Double_t bgMax){
+  auto it=pidAll.find(hash);
+  if (it==pidAll.end() || it->second==nullptr || nBins<2) return kFALSE;
+  SignalTable &table=signalTables[hash];
+  table.fNBins=nBins;
+  table.fLogBgMin=TMath::Log(bgMin);
+  table.fLogBgStep=(TMath::Log(bgMax)-table.fLogBgMin)/(nBins-1);
+  table.fBethe.resize(nBins);
+  table.fTPC.resize(AliPID::kSPECIESC*nBins);
+  table.fITS.resize(AliPID::kSPECIESC*nBins);
+  for (Int_t ibin=0; ibin<nBins; ibin++){
+    Double_t bg=TMath::Exp(table.fLogBgMin+ibin*table.fLogBgStep);
+    table.fBethe[ibin]=BetheBlochAleph(hash,bg);
+    for (Int_t ispecies=0; ispecies<AliPID::kSPECIESC; ispecies++){
+      Double_t p=bg*AliPID::ParticleMass(ispecies);
+      table.fTPC[ispecies*nBins+ibin]=GetExpectedTPCSignal(hash,p,ispecies);
+      table.fITS[ispecies*nBins+ibin]=GetExpectedITSSignal(hash,p,ispecies);
+    }
+  }
+  return kTRUE;
+}
+
+/// Return signal tables of the PID hash - built at first use
+const AliPIDtools::SignalTable * AliPIDtools::GetSignalTable(Int_t hash){
+  auto it=signalTables.find(hash);
+  if (it!=signalTables.end()) return &(it->second);
+  if (!BuildSignalTables(hash)) return NULL;
+  return &signalTables[hash];
+}
+
+/// Linear interpolation in log(bg)
+/// \return kFALSE if bg is outside of the grid
+Bool_t AliPIDtools::Interpolate(const SignalTable &table, const Float_t *values, Double_t bg, Float_t &value){
+  if (bg<=0) return kFALSE;
+  Double_t x=(TMath::Log(bg)-table.fLogBgMin)/table.fLogBgStep;
+  if (x<0 || x>=table.fNBins-1) return kFALSE;
+  Int_t ibin=Int_t(x);
+  Double_t frac=x-ibin;
+  value=values[ibin]+(values[ibin+1]-values[ibin])*frac;
+  return kTRUE;
+}
+
+/// BetheBlochAleph interpolated in the table of the PID hash
+Double_t AliPIDtools::BetheBlochAlephFast(Int_t hash, Double_t bg){
+  const SignalTable *table=GetSignalTable(hash);
+  Float_t value=0;
+  if (table && Interpolate(*table,table->fBethe.data(),bg,value)) return value;
+  return BetheBlochAleph(hash,bg);
+}
+
+/// Expected TPC signal (without eta, multiplicity and pile-up corrections) for an array of momenta and all species
+/// \param hash       - hash value of the PID version
+/// \param n          - number of momenta
+/// \param p          - momenta
+/// \param expected   - output array expected[i*nSpecies+species]
+/// \param nSpecies   - number of species (<=AliPID::kSPECIESC)
+/// \return           - number of filled momenta (0 if the PID is not loaded)
+Int_t AliPIDtools::GetExpectedTPCSignals(Int_t hash, Int_t n, const Double_t *p, Float_t *expected, Int_t nSpecies){
+  const SignalTable *table=GetSignalTable(hash);
+  if (table==NULL) return 0;
+  if (nSpecies>AliPID::kSPECIESC) nSpecies=AliPID::kSPECIESC;
+  for (Int_t ispecies=0; ispecies<nSpecies; ispecies++){
+    const Float_t *values=&(table->fTPC[ispecies*table->fNBins]);
+    Double_t invMass=1./AliPID::ParticleMass(ispecies);
+    for (Int_t i=0; i<n; i++){
+      Float_t &value=expected[i*nSpecies+ispecies];
+      if (!Interpolate(*table,values,p[i]*invMass,value)) value=GetExpectedTPCSignal(hash,p[i],ispecies);
+    }
+  }
+  return n;
+}
+
+/// Expected ITS signal for an array of momenta and all species, see GetExpectedTPCSignals
+Int_t AliPIDtools::GetExpectedITSSignals(Int_t hash, Int_t n, const Double_t *p, Float_t *expected, Int_t nSpecies){
+  const SignalTable *table=GetSignalTable(hash);
+  if (table==NULL) return 0;
+  if (nSpecies>AliPID::kSPECIESC) nSpecies=AliPID::kSPECIESC;
+  for (Int_t ispecies=0; ispecies<nSpecies; ispecies++){
+    const Float_t *values=&(table->fITS[ispecies*table->fNBins]);
+    Double_t invMass=1./AliPID::ParticleMass(ispecies);
+    for (Int_t i=0; i<n; i++){
+      Float_t &value=expected[i*nSpecies+ispecies];
+      if (!Interpolate(*table,values,p[i]*invMass,value)) value=GetExpectedITSSignal(hash,p[i],ispecies);
+    }
+  }
+  return n;
+}
+
+/// Expected TOF signal for an array of tracks and all species
+/// \param expected   - output array expected[i*nSpecies+species]
+/// \return           - number of filled tracks (0 if the PID is not loaded)
+Int_t AliPIDtools::GetExpectedTOFSignals(Int_t hash, Int_t nTracks, const AliVTrack * const *tracks, Float_t *expected, Int_t nSpecies){
+  auto it=pidAll.find(hash);
+  if (it==pidAll.end() || it->second==nullptr) return 0;
+  AliTOFPIDResponse &tofPID=it->second->GetTOFResponse();
+  for (Int_t i=0; i<nTracks; i++){
+    for (Int_t ispecies=0; ispecies<nSpecies; ispecies++){
+      expected[i*nSpecies+ispecies]=tracks[i] ? tofPID.GetExpectedSignal(tracks[i],(AliPID::EParticleType)ispecies) : 0;
+    }
+  }
+  return nTracks;
+}
+
+/// n-sigmas of an array of tracks for all species
+/// \param hash       - hash value of the PID version
+/// \param detCode    - detector code (0-ITS, 1-TPC, 2-TRD, 3-TOF)  AliPIDResponse::enum EDetector
+/// \param nTracks    - number of tracks
+/// \param tracks     - tracks
+/// \param nSigma     - output array nSigma[i*nSpecies+species], -999 if the detector PID is not available for the track
+/// \param nSpecies   - number of species
+/// \return           - number of filled tracks (0 if the PID is not loaded)
+Int_t AliPIDtools::NumberOfSigmas(Int_t hash, Int_t detCode, Int_t nTracks, const AliVTrack * const *tracks, Double_t *nSigma, Int_t nSpecies){
+  auto it=pidAll.find(hash);
+  if (it==pidAll.end()) return 0;
+  return NumberOfSigmas(it->second,detCode,nTracks,tracks,nSigma,nSpecies);
+}
+
+/// n-sigmas of an array of tracks for all species using the given PID response, see above
+/// The detector PID status is checked once per track
+Int_t AliPIDtools::NumberOfSigmas(AliPIDResponse *pid, Int_t detCode, Int_t nTracks, const AliVTrack * const *tracks, Double_t *nSigma, Int_t nSpecies){
+  if (pid==nullptr) return 0;
+  AliPIDResponse::EDetector det=(AliPIDResponse::EDetector)detCode;
+  for (Int_t i=0; i<nTracks; i++){
+    Double_t *values=&(nSigma[i*nSpecies]);
+    if (tracks[i]==nullptr || pid->CheckPIDStatus(det,tracks[i])!=AliPIDResponse::kDetPidOk){
+      for (Int_t ispecies=0; ispecies<nSpecies; ispecies++) values[ispecies]=-999.;
+      continue;
+    }
+    for (Int_t ispecies=0; ispecies<nSpecies; ispecies++){
+      values[ispecies]=pid->NumberOfSigmas(det,tracks[i],(AliPID::EParticleType)ispecies);
+    }
+  }
+  return nTracks;
+}
+
 ///  SetFiltered tree
 /// \param filteredTree   - pointer to filtered tree
 /// \return
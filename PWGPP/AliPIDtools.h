@@ -21,8 +21,16 @@
 /// #### Example 3: Draw Expected dEdx
 /// AliPIDtools::SetFilteredTreeV0(treeV0)
 /// treeV0->Draw("log(track0.fTPCsignal/(AliPIDtools::GetExpectedTPCSignalV0(pidHash,0,0x1,0)))","type==1&&abs(log(track1.fTPCsignal/(AliPIDtools::GetExpectedTPCSignalV0(pidHash,0,0x1,1))))<0.1","colz",20000)
+/// #### Example 4: batch interface - expected signals for an array of momenta and n-sigmas of all species for an array of tracks
+/// \code
+/// Float_t expected[n*AliPID::kSPECIESC];
+/// AliPIDtools::GetExpectedTPCSignals(hash, n, momenta, expected);      // expected[i*AliPID::kSPECIESC+species], interpolated in tables built per hash
+/// Double_t nSigma[nTracks*AliPID::kSPECIESC];
+/// AliPIDtools::NumberOfSigmas(pidResponse, AliPIDResponse::kTPC, nTracks, tracks, nSigma);
+/// \endcode
 
 #include "map"
+#include "vector"
 #include  "AliESDtrack.h"
 class AliPIDResponse;
 class AliTPCPIDResponse;
@@ -68,6 +76,15 @@ public:
   static Float_t ComputePIDProbabilityCombined(Int_t hash, Int_t detMask, Int_t particleType, Int_t source=-1, Int_t corrMask=-1,Int_t norm=1, Float_t fakeProb=0.01);
   static Float_t ComputePIDProbabilityCombinedMask(Int_t hash, Int_t detMask, Int_t particleMask, Int_t source=-1, Int_t corrMask=-1,Int_t norm=1, Float_t fakeProb=0.01);
   //
+  // Batch interface - expected signals interpolated in log(bg) tables precomputed per PID hash, n-sigmas for arrays of tracks
+  static Bool_t   BuildSignalTables(Int_t hash, Int_t nBins=2000, Double_t bgMin=0.05, Double_t bgMax=20000.);
+  static Double_t BetheBlochAlephFast(Int_t hash, Double_t bg);
+  static Int_t    GetExpectedTPCSignals(Int_t hash, Int_t n, const Double_t *p, Float_t *expected, Int_t nSpecies=AliPID::kSPECIESC);
+  static Int_t    GetExpectedITSSignals(Int_t hash, Int_t n, const Double_t *p, Float_t *expected, Int_t nSpecies=AliPID::kSPECIESC);
+  static Int_t    GetExpectedTOFSignals(Int_t hash, Int_t nTracks, const AliVTrack * const *tracks, Float_t *expected, Int_t nSpecies=AliPID::kSPECIESC);
+  static Int_t    NumberOfSigmas(Int_t hash, Int_t detCode, Int_t nTracks, const AliVTrack * const *tracks, Double_t *nSigma, Int_t nSpecies=AliPID::kSPECIESC);
+  static Int_t    NumberOfSigmas(AliPIDResponse *pid, Int_t detCode, Int_t nTracks, const AliVTrack * const *tracks, Double_t *nSigma, Int_t nSpecies=AliPID::kSPECIESC);
+  //
   static Bool_t    RegisterPIDAliases(Int_t pidHash, TString fakeRate="0.1", Int_t suffix=-1);
   static Bool_t    RegisterPIDAliasesV0(Int_t pidHash, Float_t powerLike=0.6, Float_t powerLegN=0.2, Float_t powerLeg=0.2,  const char *fakeR="0.1", const char *  suffix="");
   //
@@ -84,6 +101,18 @@ public:
   static TTree *       fFilteredTreeV0;  /// pointer to filteredTree V0
   static void UnitTest();                       /// unit test of invariants
 private:
+  /// expected signals on an equidistant log(bg) grid, built once per PID hash
+  struct SignalTable {
+    Int_t    fNBins;                /// number of grid points
+    Double_t fLogBgMin;             /// log(bg) of the first grid point
+    Double_t fLogBgStep;            /// grid spacing in log(bg)
+    std::vector<Float_t> fBethe;    /// Aleph Bethe-Bloch [bin]
+    std::vector<Float_t> fTPC;      /// expected TPC signal without corrections [species*fNBins+bin]
+    std::vector<Float_t> fITS;      /// expected ITS signal [species*fNBins+bin]
+  };
+  static std::map<Int_t, SignalTable> signalTables;   /// tables by PID hash
+  static const SignalTable *GetSignalTable(Int_t hash);
+  static Bool_t Interpolate(const SignalTable &table, const Float_t *values, Double_t bg, Float_t &value);
   static AliESDtrack  dummyTrack;     /// dummy value to save CPU - unfortunately PID object use AliVtrack - for the moment create global varaible t avoid object constructions
 
 };
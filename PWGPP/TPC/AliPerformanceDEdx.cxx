@@ -351,7 +351,7 @@ Long64_t AliPerformanceDEdx::Merge(TCollection* const list)
     AliPerformanceDEdx* entry = dynamic_cast<AliPerformanceDEdx*>(obj);
     if (entry == 0) continue; 
     if (merge) {
-        if ((fDeDxHisto) && (entry->fDeDxHisto)) { fDeDxHisto->Add(entry->fDeDxHisto); }        
+        if ((fDeDxHisto) && (entry->fDeDxHisto)) { AddTHnSparse(fDeDxHisto, entry->fDeDxHisto); }        
     }
     // the analysisfolder is only merged if present
     if (entry->fFolderObj) { objArrayList->Add(entry->fFolderObj); }
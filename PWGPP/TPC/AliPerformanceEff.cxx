@@ -70,7 +70,10 @@ AliPerformanceEff::AliPerformanceEff(TRootIOCtor* b):
   fAnalysisFolder(NULL),
   fNClsTreeFile(NULL),
   fNClsTree(NULL),
-  fNClsVec(NULL)
+  fNClsVec(NULL),
+  fRecPerLabel(),
+  fFakesPerLabel(),
+  fLastRecPerLabel()
 {
   // io constructor
 }
@@ -88,7 +91,10 @@ AliPerformanceEff::AliPerformanceEff(const Char_t* name, const Char_t* title, In
   fAnalysisFolder(NULL),
   fNClsTreeFile(NULL),
   fNClsTree(NULL),
-  fNClsVec(NULL)
+  fNClsVec(NULL),
+  fRecPerLabel(),
+  fFakesPerLabel(),
+  fLastRecPerLabel()
 {
   // named constructor
   //
@@ -199,6 +205,27 @@ void AliPerformanceEff::Init()
   }
 }
 
+//_____________________________________________________________________________
+void AliPerformanceEff::CountRecLabels(const Int_t *labels, Int_t nRec, Int_t nPart)
+{
+  //
+  // Count the reconstructed tracks (positive label) and the fakes (negative label)
+  // assigned to each MC particle, so that the MC loop does not rescan all tracks
+  //
+  fRecPerLabel.assign(nPart, 0);
+  fFakesPerLabel.assign(nPart, 0);
+  fLastRecPerLabel.assign(nPart, -1);
+  for(Int_t iRec=0; iRec<nRec; ++iRec)
+  {
+    Int_t label = labels[iRec];
+    if (label > 0 && label < nPart) {
+      fRecPerLabel[label]++;
+      fLastRecPerLabel[label] = iRec;
+    }
+    else if (label < 0 && -label < nPart) fFakesPerLabel[-label]++;
+  }
+}
+
 //_____________________________________________________________________________
 void AliPerformanceEff::ProcessTPC(AliMCEvent* const mcEvent, AliVEvent *const vEvent)
 {
@@ -259,6 +286,7 @@ void AliPerformanceEff::ProcessTPC(AliMCEvent* const mcEvent, AliVEvent *const v
       AliDebug(AliLog::kFatal, "nMCTracks mismatch");
     }
   }
+  CountRecLabels(labelsRec, vEvent->GetNumberOfTracks(), nPart);
   //Int_t nPart  = stack->GetNprimary();
   for (Int_t iMc = 0; iMc < nPart; ++iMc) {
     if (iMc == 0) continue;		//Cannot distinguish between track or fake track
@@ -293,20 +321,13 @@ void AliPerformanceEff::ProcessTPC(AliMCEvent* const mcEvent, AliVEvent *const v
     if (fReadNClsTree && (*fNClsVec)[iMc] == 0) continue;
     Bool_t findable = IsFindable(mcEvent,iMc);
 
-    Bool_t recStatus = kFALSE;
-    Int_t nClones = 0, nFakes = 0;
+    // check reconstructed
+    Bool_t recStatus = fRecPerLabel[iMc] > 0;
+    Int_t nClones = recStatus ? TMath::Min(fRecPerLabel[iMc] - 1, fgkMaxClones) : 0;
+    //In order to relate the fake track to track parameters, we assign it to the best matching ESD track.
+    Int_t nFakes = TMath::Min(fFakesPerLabel[iMc], fgkMaxFakes);
     Int_t nClsRec = 0;
-    for(Int_t iRec=0; iRec<vEvent->GetNumberOfTracks(); ++iRec) 
-    {
-      // check reconstructed
-      if(iMc == labelsRec[iRec]) {
-        if (recStatus && nClones < fgkMaxClones) nClones++;
-        recStatus = kTRUE;
-        if (fReadNClsTree) nClsRec = ((AliVTrack*) vEvent->GetTrack(iRec))->GetTPCNcls();
-      }
-      //In order to relate the fake track to track parameters, we assign it to the best matching ESD track.
-      if (labelsRec[iRec] < 0 && -labelsRec[iRec] == iMc && nFakes < fgkMaxFakes) nFakes++;
-    }
+    if (fReadNClsTree && recStatus) nClsRec = ((AliVTrack*) vEvent->GetTrack(fLastRecPerLabel[iMc]))->GetTPCNcls();
 
     // Only 5 charged particle species (e,mu,pi,K,p)
     if (fCutsMC.IsPdgParticle(TMath::Abs(particle->GetPdgCode())) == kFALSE) continue; 
@@ -404,6 +425,7 @@ void AliPerformanceEff::ProcessTPCSec(AliMCEvent* const mcEvent, AliVEvent *cons
         AliDebug(AliLog::kFatal, "nMCTracks mismatch");
       }
     }
+    CountRecLabels(labelsRecSec, multRec, nPart);
     for (Int_t iMc = 0; iMc < nPart; ++iMc) 
       {
 	if (iMc == 0) continue;		//Cannot distinguish between track or fake track
@@ -443,22 +465,14 @@ void AliPerformanceEff::ProcessTPCSec(AliMCEvent* const mcEvent, AliVEvent *cons
 	
 	Bool_t findable = IsFindable(mcEvent,iMc);
 	
-	Bool_t recStatus = kFALSE;
-	Int_t nClones = 0, nFakes = 0;
+	// check reconstructed
+	Bool_t recStatus = fRecPerLabel[iMc] > 0;
+	Int_t nClones = recStatus ? TMath::Min(fRecPerLabel[iMc] - 1, fgkMaxClones) : 0;
+	//In order to relate the fake track to track parameters, we assign it to the best matching ESD track.
+	Int_t nFakes = TMath::Min(fFakesPerLabel[iMc], fgkMaxFakes);
 	Int_t nClsRec = 0;
-	for(Int_t iRec=0; iRec<multRec; ++iRec) 
-	  {
-	    // check reconstructed
-	    if(iMc == labelsRecSec[iRec])
-	      {
-		if (recStatus && nClones < fgkMaxClones) nClones++;
-		recStatus = kTRUE;
-		if (fReadNClsTree) nClsRec = ((AliVTrack*) vEvent->GetTrack(iRec))->GetTPCNcls();
-	      }
-	    //In order to relate the fake track to track parameters, we assign it to the best matching ESD track.
-	    if (labelsRecSec[iRec] < 0 && -labelsRecSec[iRec] == iMc && nFakes < fgkMaxFakes) nFakes++;
-	  }
-	
+	if (fReadNClsTree && recStatus) nClsRec = ((AliVTrack*) vEvent->GetTrack(fLastRecPerLabel[iMc]))->GetTPCNcls();
+
 	// Only 5 charged particle species (e,mu,pi,K,p)
 	if (fCutsMC.IsPdgParticle(TMath::Abs(particle->GetPdgCode())) == kFALSE) continue; 
 	
@@ -550,6 +564,7 @@ void AliPerformanceEff::ProcessTPCITS(AliMCEvent* const mcEvent, AliVEvent *cons
   //
   //Int_t nPart  = stack->GetNtrack();
   Int_t nPart  = mcEvent->GetNumberOfPrimaries();
+  CountRecLabels(labelsRecTPCITS, vEvent->GetNumberOfTracks(), nPart);
   for (Int_t iMc = 0; iMc < nPart; ++iMc) 
   {
     if (iMc == 0) continue;		//Cannot distinguish between track or fake track
@@ -564,19 +579,11 @@ void AliPerformanceEff::ProcessTPCITS(AliMCEvent* const mcEvent, AliVEvent *cons
 
     Bool_t findable = IsFindable(mcEvent,iMc);
 
-    Bool_t recStatus = kFALSE;
-    Int_t nClones = 0, nFakes = 0;
-    for(Int_t iRec=0; iRec<vEvent->GetNumberOfTracks(); ++iRec) 
-    {
-      // check reconstructed
-      if(iMc == labelsRecTPCITS[iRec]) 
-      {
-        if (recStatus && nClones < fgkMaxClones) nClones++;
-	recStatus = kTRUE;
-      }
-      //In order to relate the fake track to track parameters, we assign it to the best matching reconstructed track.
-      if (labelsRecTPCITS[iRec] < 0 && -labelsRecTPCITS[iRec] == iMc && nFakes < fgkMaxFakes) nFakes++;
-    }
+    // check reconstructed
+    Bool_t recStatus = fRecPerLabel[iMc] > 0;
+    Int_t nClones = recStatus ? TMath::Min(fRecPerLabel[iMc] - 1, fgkMaxClones) : 0;
+    //In order to relate the fake track to track parameters, we assign it to the best matching reconstructed track.
+    Int_t nFakes = TMath::Min(fFakesPerLabel[iMc], fgkMaxFakes);
 
     // Only 5 charged particle species (e,mu,pi,K,p)
     if (fCutsMC.IsPdgParticle(TMath::Abs(particle->GetPdgCode())) == kFALSE) continue; 
@@ -654,6 +661,7 @@ void AliPerformanceEff::ProcessConstrained(AliMCEvent* const mcEvent, AliVEvent
 
   //Int_t nPart  = stack->GetNtrack();
   Int_t nPart  = mcEvent->GetNumberOfPrimaries();
+  CountRecLabels(labelsRecConstrained, vEvent->GetNumberOfTracks(), nPart);
   for (Int_t iMc = 0; iMc < nPart; ++iMc) 
   {
     if (iMc == 0) continue;		//Cannot distinguish between track or fake track
@@ -668,19 +676,11 @@ void AliPerformanceEff::ProcessConstrained(AliMCEvent* const mcEvent, AliVEvent
 
     Bool_t findable = IsFindable(mcEvent,iMc);
 
-    Bool_t recStatus = kFALSE;
-    Int_t nClones = 0, nFakes = 0;
-    for(Int_t iRec=0; iRec<vEvent->GetNumberOfTracks(); ++iRec) 
-    {
-      // check reconstructed
-      if(iMc == labelsRecConstrained[iRec]) 
-      {
-        if (recStatus && nClones < fgkMaxClones) nClones++;
-	recStatus = kTRUE;
-      }
-      //In order to relate the fake track to track parameters, we assign it to the best matching reconstructed track.
-      if (labelsRecConstrained[iRec] < 0 && -labelsRecConstrained[iRec] == iMc && nFakes < fgkMaxFakes) nFakes++;
-    }
+    // check reconstructed
+    Bool_t recStatus = fRecPerLabel[iMc] > 0;
+    Int_t nClones = recStatus ? TMath::Min(fRecPerLabel[iMc] - 1, fgkMaxClones) : 0;
+    //In order to relate the fake track to track parameters, we assign it to the best matching reconstructed track.
+    Int_t nFakes = TMath::Min(fFakesPerLabel[iMc], fgkMaxFakes);
 
     // Only 5 charged particle species (e,mu,pi,K,p)
     if (fCutsMC.IsPdgParticle(TMath::Abs(particle->GetPdgCode())) == kFALSE) continue; 
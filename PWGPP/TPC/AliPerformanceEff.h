@@ -78,6 +78,7 @@ private:
   // Helper Method
   TH1D* AddHistoEff(Int_t axis, const Char_t *name, const Char_t* vsTitle, const Int_t type, const Int_t secondary = 0);
   TH1D* WeightedProjection(THnSparseF* src, Int_t axis, Int_t nWeights, Int_t* weightCoords);
+  void CountRecLabels(const Int_t *labels, Int_t nRec, Int_t nPart);
 
   // Control histograms
   THnSparseF *fEffHisto; //-> mceta:mcphi:mcpt:pid:isPrim:recStatus:findable:charge
@@ -94,6 +95,11 @@ private:
   TTree* fNClsTree; //!
   std::vector<short>* fNClsVec; //!
 
+  // reconstructed tracks per MC label in the current event
+  std::vector<Int_t> fRecPerLabel; //! number of tracks with label
+  std::vector<Int_t> fFakesPerLabel; //! number of tracks with -label
+  std::vector<Int_t> fLastRecPerLabel; //! index of the last track with label
+
   AliPerformanceEff(const AliPerformanceEff&); // not implemented
   AliPerformanceEff& operator=(const AliPerformanceEff&); // not implemented
 
@@ -801,11 +801,11 @@ Long64_t AliPerformanceMatch::Merge(TCollection* const list)
     AliPerformanceMatch* entry = dynamic_cast<AliPerformanceMatch*>(obj);
     if (entry == 0) continue; 
     if (merge) {
-        if ((fResolHisto) && (entry->fResolHisto)) { fResolHisto->Add(entry->fResolHisto); }
-        if ((fPullHisto) && (entry->fPullHisto)) { fPullHisto->Add(entry->fPullHisto); }
-        if ((fTrackingEffHisto) && (entry->fTrackingEffHisto)) { fTrackingEffHisto->Add(entry->fTrackingEffHisto); }
+        if ((fResolHisto) && (entry->fResolHisto)) { AddTHnSparse(fResolHisto, entry->fResolHisto); }
+        if ((fPullHisto) && (entry->fPullHisto)) { AddTHnSparse(fPullHisto, entry->fPullHisto); }
+        if ((fTrackingEffHisto) && (entry->fTrackingEffHisto)) { AddTHnSparse(fTrackingEffHisto, entry->fTrackingEffHisto); }
 
-        if ((fTPCConstrain) && (entry->fTPCConstrain)) { fTPCConstrain->Add(entry->fTPCConstrain); }
+        if ((fTPCConstrain) && (entry->fTPCConstrain)) { AddTHnSparse(fTPCConstrain, entry->fTPCConstrain); }
     }
     // the analysisfolder is only merged if present
     if (entry->fFolderObj) { objArrayList->Add(entry->fFolderObj); }
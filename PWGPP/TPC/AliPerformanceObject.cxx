@@ -23,6 +23,8 @@
 //------------------------------------------------------------------------------
 
 #include <iostream>
+#include <vector>
+#include <algorithm>
 
 #include "TCanvas.h"
 #include "TH1.h"
@@ -176,6 +178,81 @@ Double_t * AliPerformanceObject::CreateLogAxis(Int_t nbins, Double_t xmin, Doubl
 return xbins;
 }
 
+//_____________________________________________________________________________
+Long64_t AliPerformanceObject::AddTHnSparse(THnSparse *target, const THnSparse *source, Long64_t blockSize)
+{
+  // Add the filled bins of source to target (same binning required).
+  // The source bins are read in blocks of at most blockSize bins as
+  // (coordinate, content, error2) lists sorted by coordinate, so the
+  // temporary memory is bounded and the target only grows by the bins
+  // actually added (THnSparse::Add reserves for the full source first).
+  // Returns the number of added bins.
+
+  if (!target || !source) return 0;
+  const Int_t nDim = target->GetNdimensions();
+  if (source->GetNdimensions() != nDim) {
+    AliErrorClass(Form("cannot add %s to %s: different number of dimensions", source->GetName(), target->GetName()));
+    return 0;
+  }
+  for (Int_t iDim=0; iDim<nDim; iDim++) {
+    if (source->GetAxis(iDim)->GetNbins() != target->GetAxis(iDim)->GetNbins()) {
+      AliErrorClass(Form("cannot add %s to %s: different binning of axis %d", source->GetName(), target->GetName(), iDim));
+      return 0;
+    }
+  }
+  const Bool_t errors = source->GetCalculateErrors() || target->GetCalculateErrors();
+  if (errors && !target->GetCalculateErrors()) target->Sumw2();
+
+  const Long64_t nBins = source->GetNbins();
+  const Long64_t nBlock = TMath::Max(1LL, TMath::Min(nBins, blockSize));
+  std::vector<Int_t> coord(nBlock*nDim);
+  std::vector<Double_t> content(nBlock), error2(nBlock);
+  std::vector<Long64_t> order(nBlock);
+  Long64_t nAdded = 0;
+  for (Long64_t first=0; first<nBins; first+=nBlock) {
+    const Long64_t n = TMath::Min(nBlock, nBins-first);
+    for (Long64_t i=0; i<n; i++) {
+      content[i] = source->GetBinContent(first+i, &coord[i*nDim]);
+      error2[i] = errors ? source->GetBinError2(first+i) : 0.;
+      order[i] = i;
+    }
+    std::sort(order.begin(), order.begin()+n, [&coord, nDim](Long64_t a, Long64_t b) {
+      return std::lexicographical_compare(&coord[a*nDim], &coord[a*nDim]+nDim, &coord[b*nDim], &coord[b*nDim]+nDim);
+    });
+    for (Long64_t i=0; i<n; i++) {
+      const Long64_t iBin = order[i];
+      if (content[iBin]==0 && error2[iBin]==0) continue;
+      const Long64_t bin = target->GetBin(&coord[iBin*nDim]);
+      target->AddBinContent(bin, content[iBin]);
+      if (errors) target->AddBinError2(bin, error2[iBin]);
+      nAdded++;
+    }
+  }
+  target->SetEntries(target->GetEntries() + source->GetEntries());
+
+return nAdded;
+}
+
+//_____________________________________________________________________________
+Long64_t AliPerformanceObject::MergeTHnSparse(THnSparse *target, TCollection *list, Long64_t blockSize)
+{
+  // Add all THnSparse in the list to target with AddTHnSparse
+  // Returns the number of merged histograms
+
+  if (!target || !list) return 0;
+  TIter next(list);
+  TObject *obj = 0;
+  Long64_t count = 0;
+  while ((obj = next())) {
+    THnSparse *source = dynamic_cast<THnSparse*>(obj);
+    if (!source || source == target) continue;
+    AddTHnSparse(target, source, blockSize);
+    count++;
+  }
+
+return count;
+}
+
 //_____________________________________________________________________________
 void AliPerformanceObject::InitHighMult() {
 
@@ -100,6 +100,10 @@ public :
   // merging of thnsparse
   Bool_t GetMergeTHnSparseObj() { return fMergeTHnSparseObj; }
   void SetMergeTHnSparseObj(Bool_t merge) {fMergeTHnSparseObj = merge; }  
+
+  // bounded memory merging of THnSparse (also usable from merging macros)
+  static Long64_t AddTHnSparse(THnSparse *target, const THnSparse *source, Long64_t blockSize = 1000000);
+  static Long64_t MergeTHnSparse(THnSparse *target, TCollection *list, Long64_t blockSize = 1000000);
   
   void SetRunNumber(Int_t run) { fRunNumber = run; }
   Int_t GetRunNumber() const { return fRunNumber; }
@@ -1121,9 +1121,9 @@ Long64_t AliPerformanceTPC::Merge(TCollection* list)
     AliPerformanceTPC* entry = dynamic_cast<AliPerformanceTPC*>(obj);
     if (entry == 0) continue; 
     if (merge) {
-        if ((fTPCClustHisto) && (entry->fTPCClustHisto)) { fTPCClustHisto->Add(entry->fTPCClustHisto); }
-        if ((fTPCEventHisto) && (entry->fTPCEventHisto)) { fTPCEventHisto->Add(entry->fTPCEventHisto); }
-        if ((fTPCTrackHisto) && (entry->fTPCTrackHisto)) { fTPCTrackHisto->Add(entry->fTPCTrackHisto); }
+        if ((fTPCClustHisto) && (entry->fTPCClustHisto)) { AddTHnSparse(fTPCClustHisto, entry->fTPCClustHisto); }
+        if ((fTPCEventHisto) && (entry->fTPCEventHisto)) { AddTHnSparse(fTPCEventHisto, entry->fTPCEventHisto); }
+        if ((fTPCTrackHisto) && (entry->fTPCTrackHisto)) { AddTHnSparse(fTPCTrackHisto, entry->fTPCTrackHisto); }
     }
     // the analysisfolder is only merged if present
     if (entry->fFolderObj) { objArrayList->Add(entry->fFolderObj); }
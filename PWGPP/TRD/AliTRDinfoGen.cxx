@@ -804,7 +804,14 @@ void AliTRDinfoGen::UserExec(Option_t *){
         if(selected){ 
           fTracksBarrel->Add(new AliTRDtrackInfo(*fTrackInfo));
           nBarrel++;
-          if(fTrackInfo->GetTrack()) nBarrelFriend++;
+          if((track = fTrackInfo->GetTrack())){
+            nBarrelFriend++;
+            // fill the compact TRD summary of the event
+            for(Int_t ipl = 0; ipl < AliTRDgeometry::kNlayer; ipl++){
+              if(!(tracklet = track->GetTracklet(ipl)) || !tracklet->IsOK()) continue;
+              fEventInfo->AddTracklet(fTracksBarrel->GetEntriesFast()-1, tracklet->GetDetector(), tracklet->GetYfit(0)-tracklet->GetYref(0));
+            }
+          }
         }
       } else {
         AliDebug(1, Form("KinkEv[%3d] Track[%d] Kink[%3d %3d %3d]\n"
@@ -7,6 +7,9 @@
 //                                                                        //
 ////////////////////////////////////////////////////////////////////////////
 
+#include <climits>
+#include <cstring>
+
 #include "TH1.h"
 #include "TMath.h"
 
@@ -29,11 +32,15 @@ AliTRDeventInfo::AliTRDeventInfo():
   ,fRun(NULL)
   ,fCentrality(-1)
   ,fMult(-1)
+  ,fTrackletTrk()
+  ,fTrackletDet()
+  ,fTrackletDy()
 {
   //
   // Default Constructor
   // 
   SetBit(kOwner, 0);
+  memset(fNtrackletsChmb, 0, kNchambers*sizeof(UShort_t));
 }
 
 //____________________________________________________________________
@@ -43,11 +50,15 @@ AliTRDeventInfo::AliTRDeventInfo(AliESDHeader *header, AliESDRun *run):
   ,fRun(run)
   ,fCentrality(-1)
   ,fMult(-1)
+  ,fTrackletTrk()
+  ,fTrackletDet()
+  ,fTrackletDy()
 {
   //
   // Constructor with Arguments
   //
   SetBit(kOwner, 0);
+  memset(fNtrackletsChmb, 0, kNchambers*sizeof(UShort_t));
 //  fHeader->Print();
 /*  for(Int_t ilevel(0); ilevel<3; ilevel++){
     printf("L%d :: ", ilevel);
@@ -67,12 +78,16 @@ AliTRDeventInfo::AliTRDeventInfo(const AliTRDeventInfo &info):
   ,fRun(info.fRun)
   ,fCentrality(info.fCentrality)
   ,fMult(info.fMult)
+  ,fTrackletTrk(info.fTrackletTrk)
+  ,fTrackletDet(info.fTrackletDet)
+  ,fTrackletDy(info.fTrackletDy)
 {
   //
   // Copy Constructor
   // Flat Copy
   // 
   SetBit(kOwner, 0);
+  memcpy(fNtrackletsChmb, info.fNtrackletsChmb, kNchambers*sizeof(UShort_t));
 }
 
 //____________________________________________________________________
@@ -86,6 +101,10 @@ AliTRDeventInfo& AliTRDeventInfo::operator=(const AliTRDeventInfo& info){
   fRun        = info.fRun;
   fCentrality = info.fCentrality;
   fMult       = info.fMult;
+  memcpy(fNtrackletsChmb, info.fNtrackletsChmb, kNchambers*sizeof(UShort_t));
+  fTrackletTrk = info.fTrackletTrk;
+  fTrackletDet = info.fTrackletDet;
+  fTrackletDy  = info.fTrackletDy;
   SetBit(kOwner, 0);
   return *this;
 }
@@ -111,6 +130,11 @@ void AliTRDeventInfo::Delete(const Option_t *){
   };
   fHeader = NULL;
   fRun = NULL;
+  // release the TRD summary (the object is rebuilt by placement new in AliTRDinfoGen)
+  memset(fNtrackletsChmb, 0, kNchambers*sizeof(UShort_t));
+  std::vector<Int_t>().swap(fTrackletTrk);
+  std::vector<Short_t>().swap(fTrackletDet);
+  std::vector<Float_t>().swap(fTrackletDy);
 }
 
 //____________________________________________________________________
@@ -123,6 +147,20 @@ void AliTRDeventInfo::SetOwner()
   fRun = new AliESDRun(*fRun);
 }
 
+//____________________________________________________________________
+void AliTRDeventInfo::AddTracklet(Int_t itrk, Int_t det, Float_t dy)
+{
+  //
+  // Register one tracklet of barrel track "itrk" in chamber "det"
+  // with residual "dy" to the TRD summary of the event
+  //
+  if(det<0 || det>=kNchambers) return;
+  if(fNtrackletsChmb[det]<USHRT_MAX) fNtrackletsChmb[det]++;
+  fTrackletTrk.push_back(itrk);
+  fTrackletDet.push_back(det);
+  fTrackletDy.push_back(dy);
+}
+
 //____________________________________________________________________
 UShort_t  AliTRDeventInfo::GetBunchFill() const
 {
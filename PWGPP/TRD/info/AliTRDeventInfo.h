@@ -12,6 +12,8 @@
 //                                                                        //
 ////////////////////////////////////////////////////////////////////////////
 
+#include <vector>
+
 #include <TObject.h>
 #include <TString.h>
 
@@ -23,6 +25,7 @@ public:
   enum{
     kCentralityClasses = 5
    ,kLHCbunches = 3500
+   ,kNchambers  = 540
   };
   AliTRDeventInfo();
   AliTRDeventInfo(AliESDHeader *header, AliESDRun *run);
@@ -47,6 +50,14 @@ public:
   void          SetMultiplicity(Int_t n)               { fMult = n>=0?GetMultiplicityBin(n):-1;}
   void          SetOwner();
 
+  // compact TRD summary of the barrel tracks, filled once per event by AliTRDinfoGen
+  void          AddTracklet(Int_t itrk, Int_t det, Float_t dy);
+  Int_t         GetNTrackletsChamber(Int_t det) const  { return det>=0&&det<kNchambers?fNtrackletsChmb[det]:0; }
+  Int_t         GetNTracklets() const                  { return fTrackletDet.size(); }
+  Int_t         GetTrackletTrack(Int_t i) const        { return fTrackletTrk[i]; }
+  Int_t         GetTrackletDetector(Int_t i) const     { return fTrackletDet[i]; }
+  Float_t       GetTrackletDy(Int_t i) const           { return fTrackletDy[i]; }
+
 private:
   enum{
     kOwner = BIT(14)
@@ -57,6 +68,10 @@ private:
   AliESDRun*    fRun;         //! The ESD Run Info
   Int_t         fCentrality;  //! Centrality class based on AliCentrality
   Int_t         fMult;        //! Centrality class based on AliMultiplicity
+  UShort_t      fNtrackletsChmb[kNchambers]; //! no. of barrel tracklets per chamber
+  std::vector<Int_t>   fTrackletTrk; //! index of the track in the barrel track list
+  std::vector<Short_t> fTrackletDet; //! chamber of the tracklet
+  std::vector<Float_t> fTrackletDy;  //! tracklet fit - track reference in y at the anode wire
 
   ClassDef(AliTRDeventInfo, 2) // Event info  relevant for TRD analysis
 };
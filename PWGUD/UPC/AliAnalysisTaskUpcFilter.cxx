@@ -19,6 +19,8 @@
 #include "TObjString.h"
 #include "TFile.h"
 #include "TArrayF.h"
+#include "TEntryList.h"
+#include "TTreeFormula.h"
 
 // aliroot headers
 #include "AliAnalysisManager.h"
@@ -67,9 +69,12 @@ ClassImp(AliAnalysisTaskUpcFilter);
 //_____________________________________________________________________________
 AliAnalysisTaskUpcFilter::AliAnalysisTaskUpcFilter(const char *name)
  :AliAnalysisTaskSE(name),
-  fIsESD(0), fIsMC(0), fFillSPD(0), fMuonCuts(0x0), fTriggerAna(0x0), fCutsList(0x0), fPIDResponse(0x0), fMuonCutsPassName(0x0),
+  fIsESD(0), fIsMC(0), fFillSPD(0), fFillIndex(0), fMuonCuts(0x0), fTriggerAna(0x0), fCutsList(0x0), fPIDResponse(0x0), fMuonCutsPassName(0x0),
   fHistList(0x0), fCounter(0x0), fTriggerCounter(0x0), fMuonCounter(0x0),
-  fUPCEvent(0x0), fUPCTree(0x0)
+  fUPCEvent(0x0), fUPCTree(0x0),
+  fIndexTree(0x0), fIdxFile(0x0), fIdxEntry(0), fIdxRun(0), fIdxTrgMask(0), fIdxL0Inputs(0),
+  fIdxNTracks(0), fIdxNMuon(0), fIdxNTracklets(0), fIdxV0ADecision(0), fIdxV0CDecision(0),
+  fIdxADADecision(0), fIdxADCDecision(0), fIdxZNAEnergy(0), fIdxZNCEnergy(0)
 {
 
   // Constructor
@@ -83,6 +88,17 @@ AliAnalysisTaskUpcFilter::AliAnalysisTaskUpcFilter(const char *name)
 
 }//AliAnalysisTaskUpcFilter
 
+//_____________________________________________________________________________
+void AliAnalysisTaskUpcFilter::SetFillIndex(Bool_t fill)
+{
+  // enable the index tree, defines the output slot 3 for it
+  // (to be called before the output containers are connected)
+
+  fFillIndex = fill;
+  if( fill && GetNoutputs() < 4 ) DefineOutput(3, TTree::Class());
+
+}//SetFillIndex
+
 //_____________________________________________________________________________
 AliAnalysisTaskUpcFilter::~AliAnalysisTaskUpcFilter()
 {
@@ -94,6 +110,8 @@ AliAnalysisTaskUpcFilter::~AliAnalysisTaskUpcFilter()
   if(fMuonCounter) {delete fMuonCounter; fMuonCounter = 0x0;}
   if(fUPCEvent) {delete fUPCEvent; fUPCEvent = 0x0;}
   if(fUPCTree) {delete fUPCTree; fUPCTree = 0x0;}
+  if(fIndexTree) {delete fIndexTree; fIndexTree = 0x0;}
+  if(fIdxFile) {delete fIdxFile; fIdxFile = 0x0;}
   if(fMuonCuts) {delete fMuonCuts; fMuonCuts = 0x0;}
   if(fTriggerAna) {delete fTriggerAna; fTriggerAna = 0x0;}
   if(fCutsList) {delete[] fCutsList; fCutsList=0x0;}
@@ -245,6 +263,29 @@ void AliAnalysisTaskUpcFilter::UserCreateOutputObjects()
   PostData(1, fUPCTree);
   PostData(2, fHistList);
 
+  //index tree: few bytes per analyzed event, used to build a TEntryList of candidates
+  if( !fFillIndex ) return;
+  OpenFile(3);
+  fIndexTree = new TTree("fUPCIndex", "fUPCIndex");
+  pwd->cd();
+  fIdxFile = new TString();
+  fIndexTree->Branch("file", &fIdxFile);
+  fIndexTree->Branch("entry", &fIdxEntry, "entry/L");
+  fIndexTree->Branch("run", &fIdxRun, "run/I");
+  fIndexTree->Branch("trgMask", &fIdxTrgMask, "trgMask/l");
+  fIndexTree->Branch("l0Inputs", &fIdxL0Inputs, "l0Inputs/i");
+  fIndexTree->Branch("nTracks", &fIdxNTracks, "nTracks/I");
+  fIndexTree->Branch("nMuon", &fIdxNMuon, "nMuon/I");
+  fIndexTree->Branch("nTracklets", &fIdxNTracklets, "nTracklets/I");
+  fIndexTree->Branch("v0A", &fIdxV0ADecision, "v0A/I");
+  fIndexTree->Branch("v0C", &fIdxV0CDecision, "v0C/I");
+  fIndexTree->Branch("adA", &fIdxADADecision, "adA/I");
+  fIndexTree->Branch("adC", &fIdxADCDecision, "adC/I");
+  fIndexTree->Branch("znA", &fIdxZNAEnergy, "znA/D");
+  fIndexTree->Branch("znC", &fIdxZNCEnergy, "znC/D");
+
+  PostData(3, fIndexTree);
+
 }//UserCreateOutputObjects
 
 //_____________________________________________________________________________
@@ -315,6 +356,8 @@ void AliAnalysisTaskUpcFilter::UserExec(Option_t *)
 
   //end of list of trigger classes
 
+  if( fFillIndex ) FillIndex(vEvent, trgClasses);
+
   Bool_t isTrg = kFALSE;
   for(Int_t itrg=1; itrg<fgkNtrg; itrg++) {
     if( !trgClasses[itrg] || !fTrgMask[itrg] ) continue;
@@ -884,6 +927,92 @@ void AliAnalysisTaskUpcFilter::Terminate(Option_t *)
   cout<<"Analysis complete."<<endl;
 }//Terminate
 
+//_____________________________________________________________________________
+void AliAnalysisTaskUpcFilter::FillIndex(AliVEvent *vEvent, const Bool_t *trgClasses)
+{
+  // one index entry per analyzed event, before any selection
+
+  TTree *inputTree = (TTree*) GetInputData(0);
+  fIdxFile->Clear();
+  if( inputTree && inputTree->GetCurrentFile() ) *fIdxFile = inputTree->GetCurrentFile()->GetName();
+  fIdxEntry = inputTree ? inputTree->GetTree()->GetReadEntry() : -1;
+  fIdxRun = vEvent->GetRunNumber();
+
+  fIdxTrgMask = 0;
+  for(Int_t itrg=1; itrg<fgkNtrg && itrg<64; itrg++) {
+    if( trgClasses[itrg] && fTrgMask[itrg] ) fIdxTrgMask |= (1ULL<<itrg);
+  }
+  fIdxL0Inputs = vEvent->GetHeader() ? vEvent->GetHeader()->GetL0TriggerInputs() : 0;
+
+  fIdxNTracks = vEvent->GetNumberOfTracks();
+  fIdxNMuon = 0;
+  if( fIsESD ) {
+    AliESDEvent *esdEvent = dynamic_cast<AliESDEvent*>(vEvent);
+    if( esdEvent ) fIdxNMuon = esdEvent->GetNumberOfMuonTracks();
+  } else {
+    AliAODEvent *aodEvent = dynamic_cast<AliAODEvent*>(vEvent);
+    if( aodEvent ) fIdxNMuon = aodEvent->GetNumberOfMuonTracks();
+    fIdxNTracks -= fIdxNMuon; // AOD track array includes the muon tracks
+  }
+  fIdxNTracklets = vEvent->GetMultiplicity() ? vEvent->GetMultiplicity()->GetNumberOfTracklets() : -1;
+
+  AliVVZERO *dataVZERO = vEvent->GetVZEROData();
+  fIdxV0ADecision = dataVZERO ? dataVZERO->GetV0ADecision() : -999;
+  fIdxV0CDecision = dataVZERO ? dataVZERO->GetV0CDecision() : -999;
+  AliVAD *dataAD = vEvent->GetADData();
+  fIdxADADecision = dataAD ? dataAD->GetADADecision() : -999;
+  fIdxADCDecision = dataAD ? dataAD->GetADCDecision() : -999;
+  AliVZDC *dataZDC = vEvent->GetZDCData();
+  fIdxZNAEnergy = dataZDC ? dataZDC->GetZNATowerEnergy()[0] : -999.;
+  fIdxZNCEnergy = dataZDC ? dataZDC->GetZNCTowerEnergy()[0] : -999.;
+
+  fIndexTree->Fill();
+  PostData(3, fIndexTree);
+
+}//FillIndex
+
+//_____________________________________________________________________________
+TEntryList *AliAnalysisTaskUpcFilter::MakeEntryList(TTree *indexTree, const char *selection, const char *inputTreeName)
+{
+  // entry list of the input events passing the selection on the index tree,
+  // e.g. "nTracks>=2 && nTracks<=4 && v0A==0"
+  // set it to the input chain (chain->SetEntryList(list)) to read only the candidate events,
+  // the file names must be given in the chain as during the filtering
+
+  if( !indexTree ) return 0x0;
+
+  TTreeFormula *formula = new TTreeFormula("UPCIndexSelection", selection, indexTree);
+  if( formula->GetNdim() == 0 ) {
+    ::Error("AliAnalysisTaskUpcFilter::MakeEntryList", "invalid selection %s", selection);
+    delete formula;
+    return 0x0;
+  }
+  indexTree->SetNotify(formula); // update the formula leaves for a chain of index trees
+
+  TString *file = 0x0;
+  Long64_t entry = 0;
+  indexTree->SetBranchAddress("file", &file);
+  indexTree->SetBranchAddress("entry", &entry);
+
+  TEntryList *list = new TEntryList("UPCEntryList", selection);
+  for(Long64_t ientry=0; ientry<indexTree->GetEntries(); ientry++) {
+    if( indexTree->LoadTree(ientry) < 0 ) break;
+    indexTree->GetEntry(ientry);
+    formula->GetNdata();
+    if( formula->EvalInstance() == 0 ) continue;
+    list->SetTree(inputTreeName, file->Data());
+    list->Enter(entry);
+  }
+
+  indexTree->SetNotify(0x0);
+  indexTree->ResetBranchAddresses();
+  delete file;
+  delete formula;
+
+  return list;
+
+}//MakeEntryList
+
 
 
 
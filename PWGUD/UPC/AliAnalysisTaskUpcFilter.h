@@ -15,6 +15,7 @@ class AliMuonTrackCuts;
 class AliESDtrackCuts;
 class AliPIDResponse;
 class AliTriggerAnalysis;
+class TEntryList;
 
 class AliAnalysisTaskUpcFilter : public AliAnalysisTaskSE {
  public:
@@ -24,6 +25,7 @@ class AliAnalysisTaskUpcFilter : public AliAnalysisTaskSE {
   void SetIsESD(Bool_t isESD) {fIsESD = isESD;}
   void SetIsMC(Bool_t isMC) {fIsMC = isMC;}
   void SetFillSPD(Bool_t fill=kTRUE) {fFillSPD = fill;}
+  void SetFillIndex(Bool_t fill=kTRUE);
   void SetAllTrg(Bool_t set);
   void SetTrgClass(Int_t idx, Bool_t set);
   void SetMuonTrackCutsPassName(const char *passname) {fMuonCutsPassName->Clear(); fMuonCutsPassName->SetString(passname);}
@@ -36,6 +38,8 @@ class AliAnalysisTaskUpcFilter : public AliAnalysisTaskSE {
   void RunESDMC();
   virtual void Terminate(Option_t *);
 
+  static TEntryList *MakeEntryList(TTree *indexTree, const char *selection, const char *inputTreeName="esdTree");
+
  private:
   AliAnalysisTaskUpcFilter(const AliAnalysisTaskUpcFilter &o); // not implemented
   AliAnalysisTaskUpcFilter &operator=(const AliAnalysisTaskUpcFilter &o); // not implemented
@@ -43,6 +47,7 @@ class AliAnalysisTaskUpcFilter : public AliAnalysisTaskSE {
   Bool_t fIsESD; // analysis type, ESD / AOD
   Bool_t fIsMC; // mc or data selection
   Bool_t fFillSPD; // fill SPD fired FO chips
+  Bool_t fFillIndex; // fill index tree of all analyzed events
 
   static const Int_t fgkNtrg = 51; // number of trigger classes
 
@@ -61,10 +66,25 @@ class AliAnalysisTaskUpcFilter : public AliAnalysisTaskSE {
   AliUPCEvent *fUPCEvent; // output UPC event
   TTree *fUPCTree; // output tree
 
+  void FillIndex(AliVEvent *vEvent, const Bool_t *trgClasses);
+
+  TTree *fIndexTree; // output index tree, one entry per analyzed event
+  TString *fIdxFile; //! input file of the event
+  Long64_t fIdxEntry; //! entry of the event in the input file
+  Int_t fIdxRun; //! run number
+  ULong64_t fIdxTrgMask; //! fired unmasked trigger classes, bit = class index
+  UInt_t fIdxL0Inputs; //! L0 trigger inputs
+  Int_t fIdxNTracks; //! number of central barrel tracks
+  Int_t fIdxNMuon; //! number of muon tracks
+  Int_t fIdxNTracklets; //! number of SPD tracklets
+  Int_t fIdxV0ADecision, fIdxV0CDecision; //! V0 decisions
+  Int_t fIdxADADecision, fIdxADCDecision; //! AD decisions, -999 if not available
+  Double_t fIdxZNAEnergy, fIdxZNCEnergy; //! ZN common tower energy
+
   enum EvtCount{ kAna=1, kTrg, kSpecific, kPass1, kPass2, kPassX, kWritten, kAOD, kMunTrack, kCenTrack, kESD, kPidErr };
   enum MuonCount{kMunAll=1, kMunRabs, kMunEta, kMunPDCA};
 
-  ClassDef(AliAnalysisTaskUpcFilter, 1); 
+  ClassDef(AliAnalysisTaskUpcFilter, 2); 
 };
 
 #endif
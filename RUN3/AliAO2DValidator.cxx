@@ -0,0 +1,335 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/* AliAO2DValidator
+ *
+ * Validation of the AO2D.root files written by AliAnalysisTaskAO2Dconverter.
+ * For every time frame (DF_ directory) all the tables are read through a
+ * TTreeCache, optionally with the branches decompressed in parallel by ROOT
+ * implicit multithreading, to measure the read throughput. The index columns
+ * are read alone with TTreeReader and checked against the size of the table
+ * they point to:
+ *   O2collision_001.fIndexBCs          -> O2bc
+ *   O2track.fIndexCollisions           -> O2collision_001 (sorted, -1 allowed)
+ *   O2mctracklabel.fIndexMcParticles   -> O2mcparticle_001 (-1 allowed)
+ *   O2mcparticle_001.fIndexMcCollisions -> O2mccollision (sorted)
+ *   O2mcparticle_001 mothers/daughters -> O2mcparticle_001
+ *   O2mccollision.fIndexBCs            -> O2bc
+ *   O2mccollisionlabel.fIndexMcCollisions -> O2mccollision (-1 allowed)
+ * and the tables joined row by row (track cov/extra/label, collision label)
+ * must have the same number of rows as the table they extend.
+ */
+
+#include <TFile.h>
+#include <TDirectory.h>
+#include <TKey.h>
+#include <TTree.h>
+#include <TBranch.h>
+#include <TClass.h>
+#include <TMath.h>
+#include <TROOT.h>
+#include <TStopwatch.h>
+#include <TTreeReader.h>
+#include <TTreeReaderValue.h>
+#include <TTreeReaderArray.h>
+
+#include "AliLog.h"
+#include "AliAnalysisTaskAO2Dconverter.h"
+#include "AliAO2DValidator.h"
+
+ClassImp(AliAO2DValidator);
+
+//________________________________________________________________________
+AliAO2DValidator::AliAO2DValidator(const char *name) : TNamed(name, "AO2D validator")
+{
+  // Constructor
+}
+
+//________________________________________________________________________
+Bool_t AliAO2DValidator::Validate(const char *fname)
+{
+  // Validate all the time frames of the file, returns kFALSE if any check failed
+  fNTimeFrames = 0;
+  fTotalTime = 0;
+  fTables.clear();
+  fChecks.clear();
+
+  if (fNThreads != 0)
+  {
+#ifdef R__USE_IMT
+    if (fNThreads > 0)
+      ROOT::EnableImplicitMT(fNThreads);
+    else
+      ROOT::EnableImplicitMT();
+    AliInfo(Form("Tables decompressed with %u threads", ROOT::GetImplicitMTPoolSize()));
+#else
+    AliWarning("ROOT built without implicit multithreading support, tables are read sequentially");
+    fNThreads = 0;
+#endif
+  }
+
+  TFile *file = TFile::Open(fname, "READ");
+  if (!file || file->IsZombie())
+  {
+    AliError(Form("Cannot open %s", fname));
+    delete file;
+    return kFALSE;
+  }
+
+  TStopwatch watch;
+  watch.Start();
+  TIter next(file->GetListOfKeys());
+  while (TKey *key = static_cast<TKey *>(next()))
+  {
+    if (fMaxTimeFrames > 0 && fNTimeFrames >= fMaxTimeFrames)
+      break;
+    TString dname = key->GetName();
+    if (!dname.BeginsWith("DF_"))
+      continue;
+    TDirectory *dir = file->GetDirectory(dname);
+    if (!dir)
+      continue;
+    ValidateTimeFrame(dir);
+    fNTimeFrames++;
+  }
+  watch.Stop();
+  fTotalTime = watch.RealTime();
+
+  file->Close();
+  delete file;
+  return GetNErrors() == 0;
+}
+
+//________________________________________________________________________
+void AliAO2DValidator::ValidateTimeFrame(TDirectory *dir)
+{
+  // Measure all the tables of one time frame and check their index columns
+  std::vector<TTree *> trees;
+  TIter next(dir->GetListOfKeys());
+  while (TKey *key = static_cast<TKey *>(next()))
+  {
+    TClass *cl = TClass::GetClass(key->GetClassName());
+    if (!cl || !cl->InheritsFrom(TTree::Class()))
+      continue;
+    TTree *tree = static_cast<TTree *>(key->ReadObj());
+    MeasureTable(tree);
+    trees.push_back(tree);
+  }
+
+  auto table = [&trees](AliAnalysisTaskAO2Dconverter::TreeIndex i) -> TTree * {
+    for (TTree *tree : trees)
+      if (AliAnalysisTaskAO2Dconverter::TreeName[i].EqualTo(tree->GetName()))
+        return tree;
+    return nullptr;
+  };
+  TTree *bcs = table(AliAnalysisTaskAO2Dconverter::kBC);
+  TTree *collisions = table(AliAnalysisTaskAO2Dconverter::kEvents);
+  TTree *tracks = table(AliAnalysisTaskAO2Dconverter::kTracks);
+  TTree *mcParticles = table(AliAnalysisTaskAO2Dconverter::kMcParticle);
+  TTree *mcCollisions = table(AliAnalysisTaskAO2Dconverter::kMcCollision);
+  TTree *mcTrackLabels = table(AliAnalysisTaskAO2Dconverter::kMcTrackLabel);
+  TTree *mcCollisionLabels = table(AliAnalysisTaskAO2Dconverter::kMcCollisionLabel);
+
+  if (collisions && bcs)
+    CheckIndex(collisions, "fIndexBCs", bcs, kFALSE, kTRUE);
+  if (tracks && collisions)
+    CheckIndex(tracks, "fIndexCollisions", collisions, kTRUE, kTRUE);
+  if (tracks)
+  {
+    CheckSameLength(table(AliAnalysisTaskAO2Dconverter::kTracksCov), tracks);
+    CheckSameLength(table(AliAnalysisTaskAO2Dconverter::kTracksExtra), tracks);
+    CheckSameLength(mcTrackLabels, tracks);
+  }
+  if (mcTrackLabels && mcParticles)
+    CheckIndex(mcTrackLabels, "fIndexMcParticles", mcParticles, kTRUE, kFALSE);
+  if (mcParticles)
+  {
+    if (mcCollisions)
+      CheckIndex(mcParticles, "fIndexMcCollisions", mcCollisions, kFALSE, kTRUE);
+    CheckMcParticleFamily(mcParticles);
+  }
+  if (mcCollisions && bcs)
+    CheckIndex(mcCollisions, "fIndexBCs", bcs, kFALSE, kTRUE);
+  if (collisions)
+    CheckSameLength(mcCollisionLabels, collisions);
+  if (mcCollisionLabels && mcCollisions)
+    CheckIndex(mcCollisionLabels, "fIndexMcCollisions", mcCollisions, kTRUE, kFALSE);
+
+  // Release the trees of this time frame before reading the next one
+  for (TTree *tree : trees)
+    delete tree;
+}
+
+//________________________________________________________________________
+void AliAO2DValidator::MeasureTable(TTree *tree)
+{
+  // Sizes of the table and, optionally, time to read all its branches
+  TableStat_t &stat = GetTable(tree->GetName());
+  stat.fNTimeFrames++;
+  stat.fEntries += tree->GetEntries();
+  stat.fTotBytes += tree->GetTotBytes();
+  stat.fZipBytes += tree->GetZipBytes();
+  TIter next(tree->GetListOfBranches());
+  while (TBranch *branch = static_cast<TBranch *>(next()))
+    stat.fBaskets += branch->GetWriteBasket();
+
+  if (!fMeasureThroughput || !tree->GetEntries())
+    return;
+  TFile *file = tree->GetCurrentFile();
+  tree->SetCacheSize(fCacheSize);
+  tree->AddBranchToCache("*", kTRUE);
+  tree->StopCacheLearningPhase();
+  tree->SetImplicitMT(fNThreads != 0);
+  Long64_t bytesBefore = file ? file->GetBytesRead() : 0;
+  TStopwatch watch;
+  watch.Start();
+  for (Long64_t i = 0, n = tree->GetEntries(); i < n; ++i)
+    tree->GetEntry(i);
+  watch.Stop();
+  stat.fReadTime += watch.RealTime();
+  if (file)
+    stat.fReadBytes += file->GetBytesRead() - bytesBefore;
+  tree->SetCacheSize(0);
+}
+
+//________________________________________________________________________
+AliAO2DValidator::TableStat_t &AliAO2DValidator::GetTable(const char *name)
+{
+  for (TableStat_t &stat : fTables)
+    if (stat.fName.EqualTo(name))
+      return stat;
+  fTables.push_back(TableStat_t{name, 0, 0, 0, 0, 0, 0, 0.});
+  return fTables.back();
+}
+
+//________________________________________________________________________
+AliAO2DValidator::CheckStat_t &AliAO2DValidator::GetCheck(const char *name)
+{
+  for (CheckStat_t &stat : fChecks)
+    if (stat.fName.EqualTo(name))
+      return stat;
+  fChecks.push_back(CheckStat_t{name, 0, 0, 0});
+  return fChecks.back();
+}
+
+//________________________________________________________________________
+void AliAO2DValidator::CheckIndex(TTree *tree, const char *branch, TTree *target, Bool_t allowUnassigned, Bool_t sorted)
+{
+  // Every row of tree must point with branch to a row of target (or to -1 if allowUnassigned).
+  // If sorted, the assigned indices must not decrease, as required for the grouping in O2.
+  CheckStat_t &check = GetCheck(Form("%s.%s -> %s", tree->GetName(), branch, target->GetName()));
+  if (!tree->GetBranch(branch))
+  {
+    AliError(Form("Branch %s missing in %s", branch, tree->GetName()));
+    check.fErrors += tree->GetEntries();
+    return;
+  }
+  const Long64_t nTarget = target->GetEntries();
+  Int_t last = -1;
+  TTreeReader reader(tree);
+  TTreeReaderValue<Int_t> index(reader, branch);
+  while (reader.Next())
+  {
+    const Int_t i = *index;
+    check.fChecked++;
+    if (i < 0)
+    {
+      if (i != -1 || !allowUnassigned)
+        check.fErrors++;
+      continue;
+    }
+    if (i >= nTarget)
+      check.fErrors++;
+    if (sorted)
+    {
+      if (i < last)
+        check.fUnsorted++;
+      last = i;
+    }
+  }
+}
+
+//________________________________________________________________________
+void AliAO2DValidator::CheckMcParticleFamily(TTree *tree)
+{
+  // Mothers and daughters of the MC particles must be rows of the same table (or -1)
+  CheckStat_t &check = GetCheck(Form("%s mothers/daughters -> %s", tree->GetName(), tree->GetName()));
+  if (!tree->GetBranch("fIndexArray_Mothers") || !tree->GetBranch("fIndexSlice_Daughters"))
+  {
+    AliError(Form("Mother or daughter branch missing in %s", tree->GetName()));
+    check.fErrors += tree->GetEntries();
+    return;
+  }
+  const Long64_t n = tree->GetEntries();
+  auto valid = [n](Int_t i) { return i == -1 || (i >= 0 && i < n); };
+  TTreeReader reader(tree);
+  TTreeReaderArray<Int_t> mothers(reader, "fIndexArray_Mothers");
+  TTreeReaderArray<Int_t> daughters(reader, "fIndexSlice_Daughters");
+  while (reader.Next())
+  {
+    check.fChecked++;
+    Bool_t ok = kTRUE;
+    for (size_t i = 0; i < mothers.GetSize(); ++i)
+      ok = ok && valid(mothers[i]);
+    if (daughters.GetSize() == 2)
+    {
+      ok = ok && valid(daughters[0]) && valid(daughters[1]);
+      if (daughters[0] >= 0 && daughters[1] >= 0 && daughters[0] > daughters[1])
+        ok = kFALSE;
+    }
+    if (!ok)
+      check.fErrors++;
+  }
+}
+
+//________________________________________________________________________
+void AliAO2DValidator::CheckSameLength(TTree *tree, TTree *reference)
+{
+  // Tables joined row by row must have the same number of rows
+  if (!tree)
+    return;
+  CheckStat_t &check = GetCheck(Form("%s rows == %s rows", tree->GetName(), reference->GetName()));
+  check.fChecked += tree->GetEntries();
+  check.fErrors += TMath::Abs(tree->GetEntries() - reference->GetEntries());
+}
+
+//________________________________________________________________________
+Long64_t AliAO2DValidator::GetNErrors() const
+{
+  Long64_t n = 0;
+  for (const CheckStat_t &check : fChecks)
+    n += check.fErrors + check.fUnsorted;
+  return n;
+}
+
+//________________________________________________________________________
+void AliAO2DValidator::Print(Option_t *) const
+{
+  // Per table sizes and throughput, followed by the consistency checks
+  Printf("%d time frames validated in %.1f s", fNTimeFrames, fTotalTime);
+  Printf("%-20s %12s %8s %10s %10s %7s %12s %12s", "Table", "Rows", "Baskets", "Tot (MB)", "Zip (MB)", "Ratio", "Read (MB/s)", "Unzip (MB/s)");
+  for (const TableStat_t &stat : fTables)
+  {
+    const Double_t ratio = stat.fZipBytes > 0 ? Double_t(stat.fTotBytes) / stat.fZipBytes : 0.;
+    const Double_t readRate = stat.fReadTime > 0 ? stat.fReadBytes / 1.e6 / stat.fReadTime : 0.;
+    const Double_t unzipRate = stat.fReadTime > 0 ? stat.fTotBytes / 1.e6 / stat.fReadTime : 0.;
+    Printf("%-20s %12lld %8lld %10.2f %10.2f %7.2f %12.1f %12.1f", stat.fName.Data(), stat.fEntries, stat.fBaskets,
+           stat.fTotBytes / 1.e6, stat.fZipBytes / 1.e6, ratio, readRate, unzipRate);
+  }
+  Printf("%-60s %12s %10s %10s", "Check", "Rows", "Errors", "Unsorted");
+  for (const CheckStat_t &check : fChecks)
+    Printf("%-60s %12lld %10lld %10lld", check.fName.Data(), check.fChecked, check.fErrors, check.fUnsorted);
+  Printf("%s: %lld errors", GetName(), GetNErrors());
+}
@@ -0,0 +1,82 @@
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. */
+/* See cxx source for full Copyright notice */
+/* $Id$ */
+
+#ifndef AliAO2DValidator_H
+#define AliAO2DValidator_H
+
+#include <TNamed.h>
+#include <TString.h>
+
+#include <vector>
+
+class TDirectory;
+class TTree;
+
+/* AliAO2DValidator
+ *
+ * Reads the AO2D.root written by AliAnalysisTaskAO2Dconverter, checks the
+ * index columns between the tables of each time frame (DF_ directory) and
+ * reports per table the compression ratio and the read throughput.
+ */
+class AliAO2DValidator : public TNamed
+{
+public:
+  AliAO2DValidator(const char *name = "AO2DValidator");
+  virtual ~AliAO2DValidator() {}
+
+  /// Decompress the branches of a table with ROOT implicit multithreading (0: off, <0: all the cores)
+  void SetNumberOfThreads(Int_t nThreads = -1) { fNThreads = nThreads; }
+  /// Size of the TTreeCache used for reading the tables
+  void SetCacheSize(Long64_t bytes = 30000000) { fCacheSize = bytes; }
+  /// Read all the branches of every table to measure the read throughput
+  void SetMeasureThroughput(Bool_t measure = kTRUE) { fMeasureThroughput = measure; }
+  /// Stop after this many time frames (<=0: all)
+  void SetMaxTimeFrames(Int_t n) { fMaxTimeFrames = n; }
+
+  Bool_t Validate(const char *fname = "AO2D.root");
+  virtual void Print(Option_t *option = "") const;
+
+  Int_t GetNTimeFrames() const { return fNTimeFrames; }
+  Long64_t GetNErrors() const;
+
+private:
+  struct TableStat_t { // Size and read performance of one table summed over the time frames
+    TString fName;         // Name of the tree
+    Int_t fNTimeFrames;    // Number of time frames containing the table
+    Long64_t fEntries;     // Number of rows
+    Long64_t fBaskets;     // Number of baskets of all the branches
+    Long64_t fTotBytes;    // Uncompressed size
+    Long64_t fZipBytes;    // Compressed size
+    Long64_t fReadBytes;   // Bytes read from the file during the throughput measurement
+    Double_t fReadTime;    // Real time of the throughput measurement (s)
+  };
+  struct CheckStat_t { // Result of one consistency check summed over the time frames
+    TString fName;         // Description of the check
+    Long64_t fChecked;     // Number of checked rows
+    Long64_t fErrors;      // Number of rows failing the check
+    Long64_t fUnsorted;    // Number of rows with an index smaller than the previous row
+  };
+
+  void ValidateTimeFrame(TDirectory *dir);
+  void MeasureTable(TTree *tree);
+  TableStat_t &GetTable(const char *name);
+  CheckStat_t &GetCheck(const char *name);
+  void CheckIndex(TTree *tree, const char *branch, TTree *target, Bool_t allowUnassigned, Bool_t sorted);
+  void CheckMcParticleFamily(TTree *tree);
+  void CheckSameLength(TTree *tree, TTree *reference);
+
+  Int_t fNThreads = 0;                 // Threads for the decompression (0: off, <0: all the cores)
+  Long64_t fCacheSize = 30000000;      // TTreeCache size for reading
+  Bool_t fMeasureThroughput = kTRUE;   // Read all the branches and measure the throughput
+  Int_t fMaxTimeFrames = 0;            // Maximum number of time frames to validate (<=0: all)
+
+  Int_t fNTimeFrames = 0;              //! Number of validated time frames
+  Double_t fTotalTime = 0;             //! Real time of the validation (s)
+  std::vector<TableStat_t> fTables;    //! Statistics per table
+  std::vector<CheckStat_t> fChecks;    //! Statistics per consistency check
+
+  ClassDef(AliAO2DValidator, 1);
+};
+
+#endif
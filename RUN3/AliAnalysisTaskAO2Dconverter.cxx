@@ -19,6 +19,7 @@
  */
 
 #include <algorithm>
+#include <cstring>
 #include <TFile.h>
 #include <TDirectory.h>
 #include <TChain.h>
@@ -30,6 +31,7 @@
 #include <TRandom.h>
 #include <TH2.h>
 #include <TSystem.h>
+#include <TROOT.h>
 #include "AliAnalysisTask.h"
 #include "AliAnalysisManager.h"
 #include "AliCDBManager.h"
@@ -223,6 +225,30 @@ namespace
 
   // No compression for ZDC for the moment
 
+  // Column version of AliMathBase::TruncateFloatFraction: same bit masking, applied in a
+  // branch-free loop that the compiler can vectorize
+  void TruncateFloatColumn(Float_t *values, size_t n, UInt_t mask)
+  {
+    if (mask == 0xFFFFFFFF)
+      return;
+    for (size_t i = 0; i < n; ++i) {
+      UInt_t bits;
+      std::memcpy(&bits, &values[i], sizeof(bits));
+      bits &= mask;
+      std::memcpy(&values[i], &bits, sizeof(bits));
+    }
+  }
+
+  // Packs the correlations 128*C[i,j]/Sqrt(C[i,i])/Sqrt(C[j,j]) of one covariance column.
+  // Rows with undefined sigmas (e.g. tracklets) get 0
+  void PackRhoColumn(Char_t *rho, const Double_t *cov, const Float_t *sigmaA, const Float_t *sigmaB, size_t n)
+  {
+    for (size_t i = 0; i < n; ++i) {
+      const bool defined = sigmaA[i] > 0.f && sigmaB[i] > 0.f;
+      rho[i] = defined ? (Char_t)(128. * cov[i] / sigmaA[i] / sigmaB[i]) : 0;
+    }
+  }
+
 } // namespace
 
 AliAnalysisTaskAO2Dconverter::AliAnalysisTaskAO2Dconverter(const char* name)
@@ -399,6 +425,22 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
   /// algorithm = 5 : ZSTD compression algorithm is used
   /// So fCompress = 409 is LZ4 algorithm level 9
 
+  // Optionally move the basket compression to a pool of threads. With implicit MT the branches of each tree
+  // are filled and compressed in parallel, so the event loop does not serialise on the compression
+  if (fNWriterThreads != 0)
+  {
+#ifdef R__USE_IMT
+    if (fNWriterThreads > 0)
+      ROOT::EnableImplicitMT(fNWriterThreads);
+    else
+      ROOT::EnableImplicitMT();
+    AliInfo(Form("Output trees compressed with %u threads", ROOT::GetImplicitMTPoolSize()));
+#else
+    AliWarning("ROOT built without implicit multithreading support, output trees are written sequentially");
+    fNWriterThreads = 0;
+#endif
+  }
+
   fOutputFile = TFile::Open("AO2D.root", "RECREATE", "O2 AOD", fCompress); // File to store the trees of time frames
   fOutputFile->Print();
 
@@ -571,8 +613,10 @@ void AliAnalysisTaskAO2Dconverter::UserExec(Option_t *)
   // Now fill the content of the TF
   FillEventInTF();
 
-  // Finish the current TF and initialize a new one, if the size is above the limit
-  if (fBytes > fMaxBytes)
+  // Finish the current TF and initialize a new one, if the size or the memory is above the limit.
+  // The TF is only closed between events, so all the indices (including the MC labels) stay
+  // local to the TF and are restarted by InitTF
+  if (fBytes > fMaxBytes || IsTFMemoryBudgetExceeded())
   {
     AliInfo(Form("Total size of output trees: %lu bytes\n", fBytes));
     fBytes = 0; // Reset the byte counter
@@ -651,6 +695,7 @@ TTree *AliAnalysisTaskAO2Dconverter::CreateTree(TreeIndex t)
   AliInfo(Form("Creating tree %s\n", TreeName[t].Data()));
   fTree[t] = new TTree(TreeName[t], TreeTitle[t]);
   fTree[t]->SetAutoFlush(0);
+  fTree[t]->SetImplicitMT(fNWriterThreads != 0);
   return fTree[t];
 } // TTree* AliAnalysisTaskAO2Dconverter::CreateTree(TreeIndex t)
 
@@ -691,6 +736,83 @@ void AliAnalysisTaskAO2Dconverter::FillTree(TreeIndex t)
     fBytes += nbytes;
 } // void AliAnalysisTaskAO2Dconverter::FillTree(TreeIndex t)
 
+void AliAnalysisTaskAO2Dconverter::StageTrackCov(const AliESDtrack *track)
+{
+  if (!fTreeStatus[kTracksCov])
+    return;
+  // Order of the off-diagonal elements as in the fRho* members of the tracks structure
+  if (!track) {
+    for (Int_t i = 0; i < kNCovDiag; ++i)
+      trackCovColumns.fSigma[i].push_back(NAN);
+    for (Int_t i = 0; i < kNCovOffDiag; ++i)
+      trackCovColumns.fCov[i].push_back(0.);
+    return;
+  }
+  trackCovColumns.fSigma[0].push_back(TMath::Sqrt(track->GetSigmaY2()));
+  trackCovColumns.fSigma[1].push_back(TMath::Sqrt(track->GetSigmaZ2()));
+  trackCovColumns.fSigma[2].push_back(TMath::Sqrt(track->GetSigmaSnp2()));
+  trackCovColumns.fSigma[3].push_back(TMath::Sqrt(track->GetSigmaTgl2()));
+  trackCovColumns.fSigma[4].push_back(TMath::Sqrt(track->GetSigma1Pt2()));
+  trackCovColumns.fCov[0].push_back(track->GetSigmaZY());
+  trackCovColumns.fCov[1].push_back(track->GetSigmaSnpY());
+  trackCovColumns.fCov[2].push_back(track->GetSigmaSnpZ());
+  trackCovColumns.fCov[3].push_back(track->GetSigmaTglY());
+  trackCovColumns.fCov[4].push_back(track->GetSigmaTglZ());
+  trackCovColumns.fCov[5].push_back(track->GetSigmaTglSnp());
+  trackCovColumns.fCov[6].push_back(track->GetSigma1PtY());
+  trackCovColumns.fCov[7].push_back(track->GetSigma1PtZ());
+  trackCovColumns.fCov[8].push_back(track->GetSigma1PtSnp());
+  trackCovColumns.fCov[9].push_back(track->GetSigma1PtTgl());
+} // void AliAnalysisTaskAO2Dconverter::StageTrackCov(const AliESDtrack *track)
+
+void AliAnalysisTaskAO2Dconverter::FillTracksCov()
+{
+  // Truncates and packs the covariance of all the tracks of the event column by column,
+  // then fills the TracksCov tree row by row
+  const size_t n = trackCovColumns.fSigma[0].size();
+  if (n == 0)
+    return;
+
+  for (Int_t i = 0; i < kNCovDiag; ++i)
+    TruncateFloatColumn(trackCovColumns.fSigma[i].data(), n, mTrackCovDiag);
+
+  // Indices of the two sigmas entering each correlation (Y, Z, Snp, Tgl, 1Pt)
+  static const Int_t kRhoSigmaA[kNCovOffDiag] = {1, 2, 2, 3, 3, 3, 4, 4, 4, 4};
+  static const Int_t kRhoSigmaB[kNCovOffDiag] = {0, 0, 1, 0, 1, 2, 0, 1, 2, 3};
+  for (Int_t i = 0; i < kNCovOffDiag; ++i) {
+    trackCovColumns.fRho[i].resize(n);
+    PackRhoColumn(trackCovColumns.fRho[i].data(), trackCovColumns.fCov[i].data(),
+                  trackCovColumns.fSigma[kRhoSigmaA[i]].data(), trackCovColumns.fSigma[kRhoSigmaB[i]].data(), n);
+  }
+
+  for (size_t row = 0; row < n; ++row) {
+    tracks.fSigmaY = trackCovColumns.fSigma[0][row];
+    tracks.fSigmaZ = trackCovColumns.fSigma[1][row];
+    tracks.fSigmaSnp = trackCovColumns.fSigma[2][row];
+    tracks.fSigmaTgl = trackCovColumns.fSigma[3][row];
+    tracks.fSigma1Pt = trackCovColumns.fSigma[4][row];
+    tracks.fRhoZY = trackCovColumns.fRho[0][row];
+    tracks.fRhoSnpY = trackCovColumns.fRho[1][row];
+    tracks.fRhoSnpZ = trackCovColumns.fRho[2][row];
+    tracks.fRhoTglY = trackCovColumns.fRho[3][row];
+    tracks.fRhoTglZ = trackCovColumns.fRho[4][row];
+    tracks.fRhoTglSnp = trackCovColumns.fRho[5][row];
+    tracks.fRho1PtY = trackCovColumns.fRho[6][row];
+    tracks.fRho1PtZ = trackCovColumns.fRho[7][row];
+    tracks.fRho1PtSnp = trackCovColumns.fRho[8][row];
+    tracks.fRho1PtTgl = trackCovColumns.fRho[9][row];
+    FillTree(kTracksCov);
+  }
+
+  // Keep the capacity for the next event
+  for (Int_t i = 0; i < kNCovDiag; ++i)
+    trackCovColumns.fSigma[i].clear();
+  for (Int_t i = 0; i < kNCovOffDiag; ++i) {
+    trackCovColumns.fCov[i].clear();
+    trackCovColumns.fRho[i].clear();
+  }
+} // void AliAnalysisTaskAO2Dconverter::FillTracksCov()
+
 void AliAnalysisTaskAO2Dconverter::WriteTree(TreeIndex t)
 {
   if (!fTreeStatus[t])
@@ -713,6 +835,13 @@ void AliAnalysisTaskAO2Dconverter::InitTF(ULong64_t tfId)
   fBCCount = 0;
   fTfInitialized = true;
 
+  // Reference for the memory budget of this TF
+  if (fMaxMemoryPerTF > 0) {
+    ProcInfo_t procInfo;
+    gSystem->GetProcInfo(&procInfo);
+    fMemResidentAtTFStart = procInfo.fMemResident;
+  }
+
   // Reset the offsets
   fOffsetMuTrackID = 0;
   fOffsetTrack = 0;
@@ -1744,24 +1873,8 @@ void AliAnalysisTaskAO2Dconverter::FillEventInTF()
       tracks.fTgl = AliMathBase::TruncateFloatFraction(track->GetTgl(), mTrackTgl);
       tracks.fSigned1Pt = AliMathBase::TruncateFloatFraction(track->GetSigned1Pt(), mTrack1Pt);
 
-      // Modified covariance matrix
-      // First sigmas on the diagonal
-      tracks.fSigmaY = AliMathBase::TruncateFloatFraction(TMath::Sqrt(track->GetSigmaY2()), mTrackCovDiag);
-      tracks.fSigmaZ = AliMathBase::TruncateFloatFraction(TMath::Sqrt(track->GetSigmaZ2()), mTrackCovDiag);
-      tracks.fSigmaSnp = AliMathBase::TruncateFloatFraction(TMath::Sqrt(track->GetSigmaSnp2()), mTrackCovDiag);
-      tracks.fSigmaTgl = AliMathBase::TruncateFloatFraction(TMath::Sqrt(track->GetSigmaTgl2()), mTrackCovDiag);
-      tracks.fSigma1Pt = AliMathBase::TruncateFloatFraction(TMath::Sqrt(track->GetSigma1Pt2()), mTrackCovDiag);
-      //
-      tracks.fRhoZY = (Char_t)(128. * track->GetSigmaZY() / tracks.fSigmaZ / tracks.fSigmaY);
-      tracks.fRhoSnpY = (Char_t)(128. * track->GetSigmaSnpY() / tracks.fSigmaSnp / tracks.fSigmaY);
-      tracks.fRhoSnpZ = (Char_t)(128. * track->GetSigmaSnpZ() / tracks.fSigmaSnp / tracks.fSigmaZ);
-      tracks.fRhoTglY = (Char_t)(128. * track->GetSigmaTglY() / tracks.fSigmaTgl / tracks.fSigmaY);
-      tracks.fRhoTglZ = (Char_t)(128. * track->GetSigmaTglZ() / tracks.fSigmaTgl / tracks.fSigmaZ);
-      tracks.fRhoTglSnp = (Char_t)(128. * track->GetSigmaTglSnp() / tracks.fSigmaTgl / tracks.fSigmaSnp);
-      tracks.fRho1PtY = (Char_t)(128. * track->GetSigma1PtY() / tracks.fSigma1Pt / tracks.fSigmaY);
-      tracks.fRho1PtZ = (Char_t)(128. * track->GetSigma1PtZ() / tracks.fSigma1Pt / tracks.fSigmaZ);
-      tracks.fRho1PtSnp = (Char_t)(128. * track->GetSigma1PtSnp() / tracks.fSigma1Pt / tracks.fSigmaSnp);
-      tracks.fRho1PtTgl = (Char_t)(128. * track->GetSigma1PtTgl() / tracks.fSigma1Pt / tracks.fSigmaTgl);
+      // Modified covariance matrix: staged in columns, truncated and packed in bulk in FillTracksCov
+      StageTrackCov(track);
 
       const AliExternalTrackParam *intp = track->GetInnerParam();
       tracks.fTPCinnerP = AliMathBase::TruncateFloatFraction((intp ? intp->GetP() : 0), mTrack1Pt); // Set the momentum to 0 if the track did not reach TPC
@@ -1956,7 +2069,6 @@ void AliAnalysisTaskAO2Dconverter::FillEventInTF()
       // tracks.fTOFclsIndex += tracks.fNTOFcls;
       // tracks.fNTOFcls = ntofcls_filled;
       FillTree(kTracks);
-      FillTree(kTracksCov);
       FillTree(kTracksExtra);
       if (fTreeStatus[kTracks])
         ntrk_filled++;
@@ -2005,21 +2117,7 @@ void AliAnalysisTaskAO2Dconverter::FillEventInTF()
         tracks.fY = NAN;
         tracks.fZ = NAN;
         tracks.fSigned1Pt = NAN;
-        tracks.fSigmaY = NAN;
-        tracks.fSigmaZ = NAN;
-        tracks.fSigmaSnp = NAN;
-        tracks.fSigmaTgl = NAN;
-        tracks.fSigma1Pt = NAN;
-        tracks.fRhoZY = 0;
-        tracks.fRhoSnpY = 0;
-        tracks.fRhoSnpZ = 0;
-        tracks.fRhoTglY = 0;
-        tracks.fRhoTglZ = 0;
-        tracks.fRhoTglSnp = 0;
-        tracks.fRho1PtY = 0;
-        tracks.fRho1PtZ = 0;
-        tracks.fRho1PtSnp = 0;
-        tracks.fRho1PtTgl = 0;
+        StageTrackCov(nullptr); // NAN sigmas and null correlations
         tracks.fTPCinnerP = NAN;
         tracks.fFlags = 0;
         tracks.fITSClusterMap = 0;
@@ -2058,11 +2156,12 @@ void AliAnalysisTaskAO2Dconverter::FillEventInTF()
         }
 
         FillTree(kTracks);
-        FillTree(kTracksCov);
         FillTree(kTracksExtra);
         if (fTreeStatus[kTracks]) ntracklet_filled++;
       }
     } // end loop on tracklets
+    // The covariance rows are written in the same order as the track and tracklet rows above
+    FillTracksCov();
     eventextra.fNentries[kTracks] = ntrk_filled + ntracklet_filled;
     eventextra.fNentries[kTracksCov] = eventextra.fNentries[kTracks];
     eventextra.fNentries[kTracksExtra] = eventextra.fNentries[kTracks];
@@ -2918,6 +3017,21 @@ void AliAnalysisTaskAO2Dconverter::FinishTF()
     }
 } // AliAnalysisTaskAO2Dconverter::FinishTF()
 
+Bool_t AliAnalysisTaskAO2Dconverter::IsTFMemoryBudgetExceeded()
+{
+  if (fMaxMemoryPerTF <= 0)
+    return kFALSE;
+  // The growth with respect to the start of the TF is used instead of the absolute value,
+  // since the memory released by the previous TF is not necessarily given back to the system
+  ProcInfo_t procInfo;
+  gSystem->GetProcInfo(&procInfo);
+  const Long_t growth = procInfo.fMemResident - fMemResidentAtTFStart;
+  if (growth <= fMaxMemoryPerTF)
+    return kFALSE;
+  AliInfo(Form("Resident memory grew by %ld kB in TF %d, closing it after %d BCs\n", growth, fTFCount, fBCCount));
+  return kTRUE;
+} // Bool_t AliAnalysisTaskAO2Dconverter::IsTFMemoryBudgetExceeded()
+
 Bool_t AliAnalysisTaskAO2Dconverter::Select(TParticle *part, Float_t rv, Float_t zv)
 {
   /// Selection accoring to eta of the mother and production point
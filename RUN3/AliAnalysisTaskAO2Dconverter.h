@@ -18,10 +18,12 @@
 #include <Rtypes.h>
 
 #include <map>
+#include <vector>
 
 class AliVEvent;
 class AliESDEvent;
 class AliAODEvent;
+class AliESDtrack;
 class AliGRPObject;
 class TFile;
 class TDirectory;
@@ -53,10 +55,14 @@ public:
   virtual void Terminate(Option_t *option);
 
   void SetBasketSize(int events, int tracks) { fBasketSizeEvents = events; fBasketSizeTracks = tracks; }
+  /// Compress and write the output baskets with ROOT implicit multithreading (0: off, <0: all the cores)
+  void SetNumberOfWriterThreads(Int_t nThreads = -1) { fNWriterThreads = nThreads; }
 
   virtual void SetTruncation(Bool_t trunc=kTRUE) {fTruncate = trunc;}
   virtual void SetCompression(UInt_t compress=101) {fCompress = compress; }
   virtual void SetMaxBytes(ULong_t nbytes = 100000000) {fMaxBytes = nbytes;}
+  /// Close the current TF early when the resident memory grew by more than kbytes since its start (0: no limit)
+  void SetMaxMemoryPerTF(Long_t kbytes = 2000000) { fMaxMemoryPerTF = kbytes; }
   void SetEMCALAmplitudeThreshold(Double_t threshold) { fEMCALAmplitudeThreshold = threshold; }
   void SetEMCALFractionL1MonitoringEvents(Double_t fraction) { fFractionL1MonitorEventsEMCAL = fraction; }
   void SetEMCALTriggerReducedPayload(Bool_t reduced) { fEMCALReducedTriggerPayload = reduced; }
@@ -210,6 +216,9 @@ private:
   void InitTF(ULong64_t tfId);           // Initialize output subdir and trees for TF tfId
   void FillEventInTF();
   void FinishTF();
+  Bool_t IsTFMemoryBudgetExceeded(); // Check the resident memory growth of the current TF
+  void StageTrackCov(const AliESDtrack *track); // Stage the covariance of one track (tracklet if nullptr) for FillTracksCov
+  void FillTracksCov();                         // Truncate and pack the staged covariances in bulk and fill the TracksCov tree
 
   // Task configuration variables
   TString fPruneList = "";                // Names of the branches that will not be saved to output file
@@ -357,6 +366,15 @@ private:
     Float_t fTrackTimeRes = -999.f; /// Track time reso
   } tracks;                      //! structure to keep track information
 
+  // Per-event columns of the track covariance, processed in bulk before filling the TracksCov tree
+  static const Int_t kNCovDiag = 5;     // Y, Z, Snp, Tgl, 1Pt
+  static const Int_t kNCovOffDiag = 10; // Same order as the fRho* members of the tracks structure
+  struct {
+    std::vector<Float_t> fSigma[kNCovDiag];   /// Sqrt of the diagonal elements
+    std::vector<Double_t> fCov[kNCovOffDiag]; /// Off-diagonal elements
+    std::vector<Char_t> fRho[kNCovOffDiag];   /// Packed correlations
+  } trackCovColumns;             //! structure to stage the track covariances of one event
+
   struct {
     // HMPID data
 
@@ -709,6 +727,7 @@ private:
   Bool_t fStoreHF = kFALSE; // produce HF trees
   /// Compression algotythm and level, see TFile.cxx and RZip.cxx
   UInt_t fCompress = 101; /// This is the default level in Root (zip level 1)
+  Int_t fNWriterThreads = 0; /// Number of threads used by ROOT IMT to compress the output trees (0: sequential)
   Bool_t fSkipPileup = kFALSE;       /// Skip pileup events
   Bool_t fSkipTPCPileup = kFALSE;    /// Skip TPC pileup (SetRejectTPCPileupWithITSTPCnCluCorr)
   TString fCentralityMethod = "V0M"; /// Centrality method
@@ -723,6 +742,8 @@ private:
   /// Byte counter
   ULong_t fBytes = 0; ///! Number of bytes stored in all trees
   ULong_t fMaxBytes = 100000000; ///| Approximative size limit on the total TF output trees
+  Long_t fMaxMemoryPerTF = 0; /// Limit on the resident memory growth (kB) during one TF, checked after each event (0: no limit)
+  Long_t fMemResidentAtTFStart = 0; ///! Resident memory (kB) when the current TF was initialized
 
   /// Meta data
   TMap fMetaData; ///! meta data object for output file
@@ -734,7 +755,7 @@ private:
   FwdTrackPars MUONtoFwdTrack(AliESDMuonTrack&); // Converts MUON Tracks from ESD between RUN2 and RUN3 coordinates
   FwdTrackPars MUONtoFwdTrack(AliAODTrack&); // Converts MUON Tracks from AOD between RUN2 and RUN3 coordinates
 
-  ClassDef(AliAnalysisTaskAO2Dconverter, 29);
+  ClassDef(AliAnalysisTaskAO2Dconverter, 31);
 };
 
 #endif
@@ -2,6 +2,7 @@
 #pragma link off all globals;
 #pragma link off all classes;
 #pragma link off all functions;
+#pragma link C++ class AliAO2DValidator+;
 #pragma link C++ class AliAnalysisTaskAO2Dconverter+;
 #pragma link C++ class AliAnalysisTaskHistogram+;
 #endif
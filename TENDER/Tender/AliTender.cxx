@@ -17,11 +17,14 @@
 
 #include <TChain.h>
 #include <TFile.h>
+#include <THashList.h>
+#include <TObjString.h>
  
 #include "AliTender.h"
 #include "AliTenderSupply.h"
 #include "AliAnalysisManager.h"
 #include "AliCDBManager.h"
+#include "AliCDBEntry.h"
 #include "AliESDEvent.h"
 #include "AliESDInputHandler.h"
 #include "AliLog.h"
@@ -170,6 +173,7 @@ void AliTender::UserExec(Option_t* option)
       fCDBkey = fCDB->SetLock(kTRUE, fCDBkey);
     } 
   }
+  if (fRunChanged) LoadCDBObjects();
   TIter next(fSupplies);
   AliTenderSupply *supply;
   while ((supply=(AliTenderSupply*)next())) supply->ProcessEvent();
@@ -181,6 +185,35 @@ void AliTender::UserExec(Option_t* option)
   if (!opt.Contains("NoPost")) PostData(1, fESD);
 }
 
+//______________________________________________________________________________
+void AliTender::LoadCDBObjects()
+{
+// Load the OCDB objects declared by the supplies (AliTenderSupply::AddCDBPath)
+// once for the new run. Objects used by several supplies are loaded once; the
+// supplies then get them from the cache of the CDB manager.
+  if (!fSupplies || !fCDB || !fCDB->IsDefaultStorageSet()) return;
+  THashList paths;
+  TIter next(fSupplies);
+  AliTenderSupply *supply;
+  while ((supply=(AliTenderSupply*)next())) {
+    const TObjArray *supplyPaths = supply->GetCDBPaths();
+    if (!supplyPaths) continue;
+    TIter nextPath(supplyPaths);
+    TObject *path;
+    while ((path=nextPath())) {
+      if (!paths.FindObject(path->GetName())) paths.Add(path);
+    }
+  }
+  if (!paths.GetEntries()) return;
+  if (!fCDB->GetCacheFlag()) AliWarning("CDB cache is disabled, the supplies will reload the OCDB objects");
+  TIter nextPath(&paths);
+  TObject *path;
+  while ((path=nextPath())) {
+    if (!fCDB->Get(path->GetName(), fRun)) AliError(Form("OCDB object %s not found for run %d", path->GetName(), fRun));
+  }
+  if (fDebug > 0) Printf("AliTender: loaded %d OCDB objects for run %d", paths.GetEntries(), fRun);
+}
+
 //______________________________________________________________________________
 void AliTender::SetDefaultCDBStorage(const char *dbString)
 {
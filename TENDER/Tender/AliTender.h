@@ -47,6 +47,8 @@ private:
   AliTender(const AliTender &other);
   AliTender& operator=(const AliTender &other);
 
+  void                      LoadCDBObjects();
+
 public:  
   AliTender();
   AliTender(const char *name);
@@ -75,6 +77,6 @@ public:
 //  virtual Bool_t            Notify() {return kTRUE;}
   virtual void              UserExec(Option_t *option);
     
-  ClassDef(AliTender,4)  // Class describing the tender car for ESD analysis
+  ClassDef(AliTender,6)  // Class describing the tender car for ESD analysis
 };
 #endif
@@ -15,6 +15,8 @@
 
 /* $Id$ */
  
+#include <TObjString.h>
+
 #include "AliTender.h"
 #include "AliTenderSupply.h"
 
@@ -23,7 +25,8 @@ ClassImp(AliTenderSupply)
 //______________________________________________________________________________
 AliTenderSupply::AliTenderSupply()
                 :TNamed(),
-                 fTender(NULL)
+                 fTender(NULL),
+                 fCDBPaths(NULL)
 {
 // Dummy constructor
 }
@@ -31,7 +34,8 @@ AliTenderSupply::AliTenderSupply()
 //______________________________________________________________________________
 AliTenderSupply::AliTenderSupply(const char* name, const AliTender *tender)
                 :TNamed(name, "ESD analysis tender car"),
-                 fTender(tender)
+                 fTender(tender),
+                 fCDBPaths(NULL)
 {
 // Default constructor
 }
@@ -39,16 +43,22 @@ AliTenderSupply::AliTenderSupply(const char* name, const AliTender *tender)
 //______________________________________________________________________________
 AliTenderSupply::AliTenderSupply(const AliTenderSupply &other)
                 :TNamed(other),
-                 fTender(other.fTender)
+                 fTender(other.fTender),
+                 fCDBPaths(NULL)
                  
 {
 // Copy constructor
+   if (other.fCDBPaths) {
+      fCDBPaths = new TObjArray(*other.fCDBPaths);
+      fCDBPaths->SetOwner(kTRUE);
+   }
 }
 
 //______________________________________________________________________________
 AliTenderSupply::~AliTenderSupply()
 {
 // Destructor
+   delete fCDBPaths;
 }
 
 //______________________________________________________________________________
@@ -58,5 +68,25 @@ AliTenderSupply& AliTenderSupply::operator=(const AliTenderSupply &other)
    if (&other == this) return *this;
    TNamed::operator=(other);
    fTender = other.fTender;
+   delete fCDBPaths;
+   fCDBPaths = NULL;
+   if (other.fCDBPaths) {
+      fCDBPaths = new TObjArray(*other.fCDBPaths);
+      fCDBPaths->SetOwner(kTRUE);
+   }
    return *this;
 }
+
+//______________________________________________________________________________
+void AliTenderSupply::AddCDBPath(const char *path)
+{
+// Declare an OCDB object used by the supply. The tender loads all declared
+// objects once per run, before the supplies are called, so that the objects
+// shared by several supplies are loaded once and the supplies only hit the
+// cache of the CDB manager.
+   if (!fCDBPaths) {
+      fCDBPaths = new TObjArray();
+      fCDBPaths->SetOwner(kTRUE);
+   }
+   if (!fCDBPaths->FindObject(path)) fCDBPaths->Add(new TObjString(path));
+}
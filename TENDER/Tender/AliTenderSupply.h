@@ -14,12 +14,14 @@
 #include "TNamed.h"
 #endif
 
+class TObjArray;
 class AliTender;
 
 class AliTenderSupply : public TNamed {
 
 protected:
   const AliTender          *fTender;         // Tender car
+  TObjArray                *fCDBPaths;       // OCDB objects used by the supply, loaded once per run by the tender
   
 public:  
   AliTenderSupply();
@@ -33,7 +35,9 @@ public:
   virtual void              ProcessEvent() = 0;
   
   void                      SetTender(const AliTender *tender) {fTender = tender;}
+  void                      AddCDBPath(const char *path);
+  const TObjArray          *GetCDBPaths() const {return fCDBPaths;}
     
-  ClassDef(AliTenderSupply,1)  // Base class for tender user algorithms
+  ClassDef(AliTenderSupply,3)  // Base class for tender user algorithms
 };
 #endif
@@ -376,6 +376,11 @@ void AliPHOSTenderSupply::InitTender()
       }
   }
 
+  //Time calibration is filled again at the first use in this run
+  fTimeShiftHG.clear() ;
+  fTimeShiftLG.clear() ;
+  fCellDDL.clear() ;
+
   //Non-linearity correction
   if(fNonlinearityVersion==""){ //non-linearity not set by user yet
     if(fRunNumber>209122){ //Run2
@@ -1154,6 +1159,9 @@ void AliPHOSTenderSupply::ForceUsingCalibration(const char * filename){
   }
   fPHOSCalibData = (AliPHOSCalibData*)fc->Get("PHOSCalibration") ;
   fc->Close() ;
+  fTimeShiftHG.clear() ;
+  fTimeShiftLG.clear() ;
+  fCellDDL.clear() ;
   fUsePrivateCalib=kTRUE; 
 }
 //________________________________________________________________________
@@ -1458,20 +1466,15 @@ Double_t AliPHOSTenderSupply::CalibrateTOF(Double_t tof, Int_t absId, Bool_t isH
   //Apply time re-calibration separately for HG and LG channels
   //By default (if not filled) shifts are zero.  
     
-  Int_t relId[4];
-  fPHOSGeo->AbsToRelNumbering(absId,relId) ;
-  Int_t   module = relId[0];
-  Int_t   column = relId[3];
-  Int_t   row    = relId[2];
+  if(fTimeShiftHG.empty())
+    FillTimeCalibration() ;
   if(isHG)
-    tof-=fPHOSCalibData->GetTimeShiftEmc(module, column, row);
+    tof-=fTimeShiftHG[absId];
   else{
-    tof-=fPHOSCalibData->GetLGTimeShiftEmc(module, column, row);
+    tof-=fTimeShiftLG[absId];
   }
   //Apply L1phase
-  //First eval DDL
-  const Int_t nmod=5; 
-  Int_t ddl = (nmod-module) * 4 + (row-1)/16 - 6; //convert offline module numbering to online.
+  Int_t ddl = fCellDDL[absId] ;
   //L1phase is 0 for Run1
   if(fRunNumber>209122){ //Run2
     AliVEvent * event = fTask->InputEvent(); 
@@ -1486,6 +1489,26 @@ Double_t AliPHOSTenderSupply::CalibrateTOF(Double_t tof, Int_t absId, Bool_t isH
   
 }
 //________________________________________________________________________
+void AliPHOSTenderSupply::FillTimeCalibration(){
+  //Read time shifts and DDL of all channels once per run
+  //instead of converting absId and querying calibration for each cell
+  const Int_t nCells = fPHOSGeo->GetNModules()*fPHOSGeo->GetNPhi()*fPHOSGeo->GetNZ() ;
+  fTimeShiftHG.assign(nCells+1,0.) ; //absId starts from 1
+  fTimeShiftLG.assign(nCells+1,0.) ;
+  fCellDDL.assign(nCells+1,0) ;
+  const Int_t nmod=5; 
+  Int_t relId[4];
+  for(Int_t absId=1; absId<=nCells; absId++){
+    fPHOSGeo->AbsToRelNumbering(absId,relId) ;
+    Int_t   module = relId[0];
+    Int_t   column = relId[3];
+    Int_t   row    = relId[2];
+    fTimeShiftHG[absId]=fPHOSCalibData->GetTimeShiftEmc(module, column, row);
+    fTimeShiftLG[absId]=fPHOSCalibData->GetLGTimeShiftEmc(module, column, row);
+    fCellDDL[absId] = (nmod-module) * 4 + (row-1)/16 - 6; //convert offline module numbering to online.
+  }
+}
+//________________________________________________________________________
 void AliPHOSTenderSupply::DistanceToBadChannel(Int_t mod, TVector3 * locPos, Double_t &minDist){
   //Check if distance to bad channel was reduced
   Int_t range = minDist/2.2 +1 ; //Distance at which bad channels should be serached
@@ -12,6 +12,8 @@
 //                                                                    //
 ////////////////////////////////////////////////////////////////////////
 
+#include <vector>
+
 #include <AliTenderSupply.h>
 
 class TVector3;
@@ -86,6 +88,7 @@ protected:
   Double_t EvalEcross(AliVCluster * clu) ;  
   Double_t EvalTOF(AliVCluster * clu,AliVCaloCells * cells); 
   Double_t CalibrateTOF(Double_t tof, Int_t absId, Bool_t isHG); 
+  void   FillTimeCalibration() ;
   void DistanceToBadChannel(Int_t mod, TVector3 * locPos, Double_t &minDist) ;
   void TCardEmulation(AliAODCaloCells * cells) ;
   Float_t InducedAmpTCard(float amp, int dphi);
@@ -127,9 +130,14 @@ private:
   Float_t fTCardCorrInduceEnerFrac[3];
   Float_t fTCardCorrInduceEnerFracP1[3];
   Float_t fTCardCorrInduceEnerFracWidth[3];
+
+  //Time calibration of the current run, filled at first use
+  std::vector<Float_t> fTimeShiftHG ;        //! HG time shift by absId
+  std::vector<Float_t> fTimeShiftLG ;        //! LG time shift by absId
+  std::vector<Int_t>   fCellDDL ;            //! DDL by absId (for L1phase)
   
  
-  ClassDef(AliPHOSTenderSupply, 9); // PHOS tender task
+  ClassDef(AliPHOSTenderSupply, 10); // PHOS tender task
 };
 
 
@@ -38,7 +38,8 @@ fDebug(0),
   fParams(0),
   fOADBObjPath("$OADB/PWGPP/data/CorrPTInv.root"),
   fOADBObjName("CorrPTInv"),
-  fOADBCont(0)
+  fOADBCont(0),
+  fCorrectTPCInner(kTRUE)
 {
   // default ctor
 }
@@ -51,7 +52,8 @@ AliTrackFixTenderSupply::AliTrackFixTenderSupply(const char *name, const AliTend
   fParams(0),
   fOADBObjPath("$OADB/PWGPP/data/CorrPTInv.root"),
   fOADBObjName("CorrPTInv"),
-  fOADBCont(0)
+  fOADBCont(0),
+  fCorrectTPCInner(kTRUE)
 {
   // named ctor
   //
@@ -93,6 +95,8 @@ void AliTrackFixTenderSupply::ProcessEvent()
   AliExternalTrackParam* extPar = 0;
   double xOrig = 0;
   double xyzTPCInner[3] = {0,0,0};
+  double xIniCorMode[AliOADBTrackFix::kNCorModes];
+  for (int imd=0;imd<AliOADBTrackFix::kNCorModes;imd++) xIniCorMode[imd] = fParams->GetXIniPtInvCorr(imd);
   for (int itr=0;itr<nTracks;itr++) {
     //
     AliESDtrack* trc = event->GetTrack(itr);
@@ -102,7 +106,7 @@ void AliTrackFixTenderSupply::ProcessEvent()
     // correct the main parameterization
     int cormode = trc->IsOn(AliESDtrack::kITSin) ? AliOADBTrackFix::kCorModeGlob : AliOADBTrackFix::kCorModeTPCInner;
     xOrig = trc->GetX();
-    double xIniCor = fParams->GetXIniPtInvCorr(cormode);
+    double xIniCor = xIniCorMode[cormode];
     const AliExternalTrackParam* parInner = trc->GetInnerParam();
     if (!parInner) {
       AliError("Failed to extract inner param");
@@ -130,10 +134,10 @@ void AliTrackFixTenderSupply::ProcessEvent()
       trc->AliExternalTrackParam::Print();
     }
     // correct TPCinner param
-    if ( (extPar=(AliExternalTrackParam*)trc->GetTPCInnerParam()) ) {
+    if ( fCorrectTPCInner && (extPar=(AliExternalTrackParam*)trc->GetTPCInnerParam()) ) {
       cormode = AliOADBTrackFix::kCorModeTPCInner;
       xOrig = extPar->GetX();
-      xIniCor = fParams->GetXIniPtInvCorr(cormode);
+      xIniCor = xIniCorMode[cormode];
       if (fDebug>1) {
 	AliInfo(Form("TPCinner Param before corr. in mode %s, xIni:%.1f",cormode== AliOADBTrackFix::kCorModeGlob ?  "Glo":"TPC",xIniCor));
 	extPar->AliExternalTrackParam::Print();
@@ -194,6 +198,7 @@ Bool_t AliTrackFixTenderSupply::GetRunCorrections(int run)
   if (!fOADBCont) if (!LoadOADBObjects()) return kFALSE;
   fParams = dynamic_cast<AliOADBTrackFix*>(fOADBCont->GetObject(run,"default"));
   if (!fParams) {AliError(Form("No correction parameters for found for run %d",run)); return kFALSE;}
+  fParams->InitPtInvCorrTables();
   AliInfo(Form("Loaded correction parameters for run %d",run));
   //
   return kTRUE;
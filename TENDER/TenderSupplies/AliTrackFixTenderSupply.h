@@ -10,6 +10,8 @@
 //                                                                    //
 //  19/06/2012: RS: Add 1/pt shift from AODB to TPC and TPC-ITS       //
 //                  Optionally correct also track coordinate          //
+//  Corrections are looked up in per-run tables of AliOADBTrackFix,   //
+//  the TPCinner param can be left untouched if not used downstream   //
 //                                                                    //
 ////////////////////////////////////////////////////////////////////////
 
@@ -43,6 +45,9 @@ public:
   TString& GetOADBObjPath()                 const  { return (TString&)fOADBObjPath; }
   TString& GetOADBObjName()                 const  { return (TString&)fOADBObjName; }
   //
+  void     SetCorrectTPCInnerParam(Bool_t v=kTRUE) {fCorrectTPCInner = v;}
+  Bool_t   GetCorrectTPCInnerParam()        const  {return fCorrectTPCInner;}
+  //
   void     SetDebugLevel(Int_t l=1)                {fDebug = l;}
   Int_t    GetDebugLevel()                  const  {return fDebug;}
   //
@@ -57,8 +62,9 @@ private:
   TString           fOADBObjPath;            // path of file with parameters to use, starting from OADB dir
   TString           fOADBObjName;            // name of the corrections object in the OADB container
   AliOADBContainer* fOADBCont;               // OADB container with parameters collection
+  Bool_t            fCorrectTPCInner;        // correct also the TPCinner param of the tracks
   //
-  ClassDef(AliTrackFixTenderSupply, 1);  // track fixing tender task 
+  ClassDef(AliTrackFixTenderSupply, 2);  // track fixing tender task 
 };
 
 
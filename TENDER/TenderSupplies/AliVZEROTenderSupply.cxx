@@ -67,6 +67,11 @@ AliVZEROTenderSupply::AliVZEROTenderSupply(const char *name, const AliTender *te
   //
   // named ctor
   //
+  AddCDBPath("GRP/Geometry/Data");
+  AddCDBPath("GRP/Calib/LHCClockPhase");
+  AddCDBPath("VZERO/Calib/Data");
+  AddCDBPath("VZERO/Calib/TimeSlewing");
+  AddCDBPath("VZERO/Calib/RecoParam");
 }
 
 //_____________________________________________________